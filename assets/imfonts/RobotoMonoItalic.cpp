@@ -1,6364 +0,0 @@
-#include "imfonts.h"
-
-unsigned char RobotoMono_Italic_ttf[] = {
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x47, 0x44, 0x45, 0x46, 0x0b, 0x31, 0x0b,
-    0x32, 0x00, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x40, 0x47, 0x53, 0x55, 0x42, 0xe6, 0x11, 0xdf, 0x13, 0x00, 0x00,
-    0x01, 0x4c, 0x00, 0x00, 0x02, 0x48, 0x4f, 0x53, 0x2f, 0x32, 0xba, 0xd5, 0xea, 0x35, 0x00, 0x00, 0x03, 0x94, 0x00,
-    0x00, 0x00, 0x60, 0x63, 0x6d, 0x61, 0x70, 0x53, 0xe7, 0xa2, 0x2f, 0x00, 0x00, 0x03, 0xf4, 0x00, 0x00, 0x08, 0x6a,
-    0x63, 0x76, 0x74, 0x20, 0x5f, 0xbf, 0x12, 0x2b, 0x00, 0x01, 0xcb, 0x1c, 0x00, 0x00, 0x00, 0x9c, 0x66, 0x70, 0x67,
-    0x6d, 0xe1, 0x14, 0xdb, 0xf0, 0x00, 0x01, 0xcb, 0xb8, 0x00, 0x00, 0x0b, 0x97, 0x67, 0x61, 0x73, 0x70, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x01, 0xcb, 0x14, 0x00, 0x00, 0x00, 0x08, 0x67, 0x6c, 0x79, 0x66, 0xcd, 0x03, 0xfe, 0x2a, 0x00,
-    0x00, 0x0c, 0x60, 0x00, 0x01, 0x7e, 0xee, 0x68, 0x65, 0x61, 0x64, 0xfa, 0x26, 0x10, 0x10, 0x00, 0x01, 0x8b, 0x50,
-    0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61, 0x0c, 0xf6, 0x03, 0xfd, 0x00, 0x01, 0x8b, 0x88, 0x00, 0x00, 0x00,
-    0x24, 0x68, 0x6d, 0x74, 0x78, 0xb0, 0xde, 0x8e, 0xff, 0x00, 0x01, 0x8b, 0xac, 0x00, 0x00, 0x10, 0x22, 0x6c, 0x6f,
-    0x63, 0x61, 0xc1, 0xcd, 0x20, 0x31, 0x00, 0x01, 0x9b, 0xd0, 0x00, 0x00, 0x08, 0x24, 0x6d, 0x61, 0x78, 0x70, 0x05,
-    0xd4, 0x0d, 0x20, 0x00, 0x01, 0xa3, 0xf4, 0x00, 0x00, 0x00, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x48, 0x56, 0x6e, 0xae,
-    0x00, 0x01, 0xa4, 0x14, 0x00, 0x00, 0x03, 0x2a, 0x70, 0x6f, 0x73, 0x74, 0xe5, 0x42, 0xa7, 0xe9, 0x00, 0x01, 0xa7,
-    0x40, 0x00, 0x00, 0x23, 0xd1, 0x70, 0x72, 0x65, 0x70, 0x37, 0x75, 0x3b, 0xbf, 0x00, 0x01, 0xd7, 0x50, 0x00, 0x00,
-    0x00, 0xae, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x08, 0x00,
-    0xcc, 0x00, 0xcc, 0x00, 0x01, 0x01, 0x21, 0x01, 0x27, 0x00, 0x01, 0x01, 0x58, 0x01, 0x63, 0x00, 0x01, 0x01, 0x78,
-    0x01, 0x78, 0x00, 0x01, 0x01, 0x7d, 0x01, 0x7e, 0x00, 0x01, 0x01, 0x80, 0x01, 0x80, 0x00, 0x01, 0x01, 0x92, 0x01,
-    0x94, 0x00, 0x01, 0x01, 0xcc, 0x01, 0xcc, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1e, 0x00, 0x2c,
-    0x00, 0x01, 0x44, 0x46, 0x4c, 0x54, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x01, 0x73, 0x6d, 0x63, 0x70, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x01, 0xbe, 0x00, 0xdc, 0x01, 0x9d, 0x01, 0x9e, 0x01,
-    0x9f, 0x01, 0xa0, 0x01, 0xa1, 0x01, 0xa2, 0x01, 0xa3, 0x01, 0xa4, 0x01, 0xa5, 0x01, 0xa6, 0x01, 0xa7, 0x01, 0xa8,
-    0x01, 0xa9, 0x01, 0xaa, 0x01, 0xab, 0x01, 0xd7, 0x01, 0xac, 0x01, 0xad, 0x01, 0xae, 0x01, 0xaf, 0x01, 0xb0, 0x01,
-    0xb1, 0x01, 0xb2, 0x01, 0xb3, 0x01, 0xb4, 0x01, 0xb5, 0x01, 0x9d, 0x01, 0x9e, 0x01, 0x9f, 0x01, 0xa0, 0x01, 0xa1,
-    0x01, 0xa2, 0x01, 0xa3, 0x01, 0xa4, 0x01, 0xa5, 0x01, 0xa6, 0x01, 0xa7, 0x01, 0xa8, 0x01, 0xa9, 0x01, 0xaa, 0x01,
-    0xab, 0x01, 0xd7, 0x01, 0xac, 0x01, 0xad, 0x01, 0xae, 0x01, 0xaf, 0x01, 0xb0, 0x01, 0xb1, 0x01, 0xb2, 0x01, 0xb3,
-    0x01, 0xb4, 0x01, 0xb5, 0x01, 0xe1, 0x02, 0x9a, 0x02, 0x99, 0x02, 0x9a, 0x02, 0x9b, 0x02, 0x9b, 0x02, 0x9c, 0x02,
-    0x9d, 0x02, 0x9e, 0x02, 0x9f, 0x02, 0xa0, 0x02, 0xa1, 0x02, 0xa2, 0x02, 0xa3, 0x02, 0xa4, 0x02, 0xa5, 0x02, 0xa6,
-    0x02, 0xa7, 0x02, 0xa8, 0x02, 0xa9, 0x02, 0xaa, 0x02, 0xab, 0x02, 0xac, 0x02, 0xad, 0x02, 0xae, 0x02, 0xaf, 0x02,
-    0xb0, 0x02, 0xb1, 0x02, 0xb2, 0x02, 0xb3, 0x02, 0xb4, 0x02, 0xb5, 0x02, 0xb6, 0x02, 0x9c, 0x02, 0x9d, 0x02, 0x9e,
-    0x02, 0x9f, 0x02, 0xa0, 0x02, 0xa1, 0x02, 0xa2, 0x02, 0xa3, 0x02, 0xa4, 0x02, 0xa5, 0x02, 0xa6, 0x02, 0xa7, 0x02,
-    0xa8, 0x02, 0xa9, 0x02, 0xaa, 0x02, 0xab, 0x02, 0xac, 0x02, 0xad, 0x02, 0xae, 0x02, 0xaf, 0x02, 0xb0, 0x02, 0xb1,
-    0x02, 0xb2, 0x02, 0xb3, 0x02, 0xb4, 0x02, 0xb5, 0x02, 0xb6, 0x02, 0xeb, 0x02, 0xb7, 0x02, 0xb7, 0x02, 0xb8, 0x02,
-    0xb8, 0x02, 0xb9, 0x02, 0xb9, 0x02, 0xba, 0x02, 0xba, 0x02, 0xbb, 0x02, 0xbb, 0x02, 0xbd, 0x02, 0xbd, 0x02, 0xbe,
-    0x02, 0xbe, 0x02, 0xbf, 0x02, 0xbf, 0x02, 0xc0, 0x02, 0xc0, 0x02, 0xc1, 0x02, 0xc1, 0x02, 0xc2, 0x02, 0xc2, 0x02,
-    0xc3, 0x02, 0xc3, 0x02, 0xc4, 0x02, 0xc4, 0x02, 0xc5, 0x02, 0xc5, 0x02, 0xc7, 0x02, 0xc7, 0x02, 0xc8, 0x02, 0xc8,
-    0x02, 0xc9, 0x02, 0xc9, 0x02, 0xca, 0x02, 0xca, 0x02, 0xcb, 0x02, 0xcb, 0x02, 0xcc, 0x02, 0xcc, 0x02, 0xcd, 0x02,
-    0xce, 0x02, 0xce, 0x02, 0xcf, 0x02, 0xcf, 0x02, 0xd0, 0x02, 0xd0, 0x02, 0xd1, 0x02, 0xd1, 0x02, 0xd2, 0x02, 0xd2,
-    0x02, 0xd3, 0x02, 0xd3, 0x02, 0xd4, 0x02, 0xd4, 0x02, 0xd5, 0x02, 0xd5, 0x02, 0xd6, 0x02, 0xd6, 0x02, 0xd7, 0x02,
-    0xd7, 0x02, 0xd8, 0x02, 0xd8, 0x02, 0xd9, 0x02, 0xd9, 0x02, 0xda, 0x02, 0xda, 0x02, 0xdb, 0x02, 0xdb, 0x02, 0xdc,
-    0x02, 0xdc, 0x02, 0xdd, 0x02, 0xdd, 0x02, 0xde, 0x02, 0xde, 0x02, 0xdf, 0x02, 0xdf, 0x02, 0xe0, 0x02, 0xe0, 0x02,
-    0x7a, 0x02, 0x7a, 0x02, 0xe2, 0x02, 0xe2, 0x02, 0xe3, 0x02, 0xe3, 0x02, 0xe4, 0x02, 0xe4, 0x02, 0xe5, 0x02, 0xe5,
-    0x02, 0xe6, 0x02, 0xe6, 0x02, 0xe7, 0x02, 0xe7, 0x02, 0xe8, 0x02, 0xe8, 0x02, 0xe9, 0x02, 0xe9, 0x02, 0xea, 0x02,
-    0xea, 0x02, 0xeb, 0x02, 0xec, 0x02, 0xec, 0x02, 0xed, 0x02, 0xed, 0x02, 0xee, 0x02, 0xee, 0x02, 0x99, 0x00, 0x02,
-    0x00, 0x0d, 0x00, 0x23, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x43, 0x00, 0x5c, 0x00, 0x1a, 0x00, 0x83, 0x00, 0x83, 0x00,
-    0x34, 0x00, 0x85, 0x00, 0x85, 0x00, 0x35, 0x01, 0xe5, 0x01, 0xe6, 0x00, 0x36, 0x01, 0xe8, 0x02, 0x2a, 0x00, 0x38,
-    0x02, 0x2d, 0x02, 0x3e, 0x00, 0x7b, 0x02, 0x41, 0x02, 0x5f, 0x00, 0x8d, 0x02, 0x61, 0x02, 0x72, 0x00, 0xac, 0x02,
-    0x75, 0x02, 0x76, 0x00, 0xbe, 0x02, 0x79, 0x02, 0x79, 0x00, 0xc0, 0x02, 0x7b, 0x02, 0x94, 0x00, 0xc1, 0x03, 0xe3,
-    0x03, 0xe3, 0x00, 0xdb, 0x00, 0x03, 0x04, 0xac, 0x01, 0x90, 0x00, 0x05, 0x00, 0x00, 0x05, 0x9a, 0x05, 0x33, 0x00,
-    0x00, 0x01, 0x1f, 0x05, 0x9a, 0x05, 0x33, 0x00, 0x00, 0x03, 0xd1, 0x00, 0x66, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x02, 0xff, 0x10, 0x00, 0x20, 0x5b, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x70, 0x79, 0x72, 0x73, 0x00, 0x01, 0x00, 0x00, 0xff, 0xfd, 0x08, 0x62, 0xfd, 0xd5,
-    0x00, 0x00, 0x08, 0x62, 0x02, 0x2b, 0x20, 0x00, 0x01, 0x9f, 0x4f, 0x01, 0x00, 0x00, 0x04, 0x3a, 0x05, 0xb0, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x06, 0x44, 0x00,
-    0x00, 0x00, 0xe0, 0x00, 0x80, 0x00, 0x06, 0x00, 0x60, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x21,
-    0x00, 0x7e, 0x00, 0xa0, 0x00, 0xac, 0x00, 0xad, 0x00, 0xbf, 0x00, 0xc6, 0x00, 0xcf, 0x00, 0xe6, 0x00, 0xef, 0x00,
-    0xfe, 0x01, 0x0f, 0x01, 0x11, 0x01, 0x25, 0x01, 0x27, 0x01, 0x30, 0x01, 0x53, 0x01, 0x5f, 0x01, 0x67, 0x01, 0x7e,
-    0x01, 0x7f, 0x01, 0x92, 0x01, 0xa1, 0x01, 0xb0, 0x01, 0xf0, 0x01, 0xff, 0x02, 0x1b, 0x02, 0x37, 0x02, 0x59, 0x02,
-    0xbc, 0x02, 0xc7, 0x02, 0xc9, 0x02, 0xdd, 0x02, 0xf3, 0x03, 0x01, 0x03, 0x03, 0x03, 0x09, 0x03, 0x0f, 0x03, 0x23,
-    0x03, 0x8a, 0x03, 0x8c, 0x03, 0x92, 0x03, 0xa1, 0x03, 0xb0, 0x03, 0xb9, 0x03, 0xc9, 0x03, 0xce, 0x03, 0xd2, 0x03,
-    0xd6, 0x04, 0x25, 0x04, 0x2f, 0x04, 0x45, 0x04, 0x4f, 0x04, 0x62, 0x04, 0x6f, 0x04, 0x77, 0x04, 0x86, 0x04, 0xce,
-    0x04, 0xd7, 0x04, 0xe1, 0x04, 0xf5, 0x05, 0x01, 0x05, 0x10, 0x05, 0x13, 0x1e, 0x01, 0x1e, 0x3f, 0x1e, 0x85, 0x1e,
-    0xf1, 0x1e, 0xf3, 0x1e, 0xf9, 0x1f, 0x4d, 0x20, 0x0b, 0x20, 0x15, 0x20, 0x1e, 0x20, 0x22, 0x20, 0x26, 0x20, 0x30,
-    0x20, 0x33, 0x20, 0x3a, 0x20, 0x3c, 0x20, 0x44, 0x20, 0x74, 0x20, 0x7f, 0x20, 0xa4, 0x20, 0xa7, 0x20, 0xac, 0x21,
-    0x05, 0x21, 0x13, 0x21, 0x16, 0x21, 0x22, 0x21, 0x26, 0x21, 0x2e, 0x21, 0x5e, 0x22, 0x02, 0x22, 0x06, 0x22, 0x0f,
-    0x22, 0x12, 0x22, 0x1a, 0x22, 0x1e, 0x22, 0x2b, 0x22, 0x48, 0x22, 0x60, 0x22, 0x65, 0x25, 0xca, 0xf6, 0xc3, 0xfe,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x20, 0x00, 0x22,
-    0x00, 0xa0, 0x00, 0xa1, 0x00, 0xad, 0x00, 0xae, 0x00, 0xc0, 0x00, 0xc7, 0x00, 0xd0, 0x00, 0xe7, 0x00, 0xf0, 0x00,
-    0xff, 0x01, 0x10, 0x01, 0x12, 0x01, 0x26, 0x01, 0x28, 0x01, 0x31, 0x01, 0x54, 0x01, 0x60, 0x01, 0x68, 0x01, 0x7f,
-    0x01, 0x92, 0x01, 0xa0, 0x01, 0xaf, 0x01, 0xf0, 0x01, 0xfa, 0x02, 0x18, 0x02, 0x37, 0x02, 0x59, 0x02, 0xbc, 0x02,
-    0xc6, 0x02, 0xc9, 0x02, 0xd8, 0x02, 0xf3, 0x03, 0x00, 0x03, 0x03, 0x03, 0x09, 0x03, 0x0f, 0x03, 0x23, 0x03, 0x84,
-    0x03, 0x8c, 0x03, 0x8e, 0x03, 0x93, 0x03, 0xa3, 0x03, 0xb1, 0x03, 0xba, 0x03, 0xca, 0x03, 0xd1, 0x03, 0xd6, 0x04,
-    0x00, 0x04, 0x26, 0x04, 0x30, 0x04, 0x46, 0x04, 0x50, 0x04, 0x63, 0x04, 0x70, 0x04, 0x78, 0x04, 0x88, 0x04, 0xcf,
-    0x04, 0xd8, 0x04, 0xe2, 0x04, 0xf6, 0x05, 0x02, 0x05, 0x11, 0x1e, 0x00, 0x1e, 0x3e, 0x1e, 0x80, 0x1e, 0xa0, 0x1e,
-    0xf2, 0x1e, 0xf4, 0x1f, 0x4d, 0x20, 0x00, 0x20, 0x13, 0x20, 0x17, 0x20, 0x20, 0x20, 0x25, 0x20, 0x30, 0x20, 0x32,
-    0x20, 0x39, 0x20, 0x3c, 0x20, 0x44, 0x20, 0x74, 0x20, 0x7f, 0x20, 0xa3, 0x20, 0xa7, 0x20, 0xab, 0x21, 0x05, 0x21,
-    0x13, 0x21, 0x16, 0x21, 0x22, 0x21, 0x26, 0x21, 0x2e, 0x21, 0x5b, 0x22, 0x02, 0x22, 0x06, 0x22, 0x0f, 0x22, 0x11,
-    0x22, 0x1a, 0x22, 0x1e, 0x22, 0x2b, 0x22, 0x48, 0x22, 0x60, 0x22, 0x64, 0x25, 0xca, 0xf6, 0xc3, 0xfe, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0x00, 0x01, 0x04, 0x0c, 0x04, 0x06, 0xff, 0xf5, 0x00, 0x00, 0xff, 0xe2, 0x01, 0x43, 0xff, 0xc0,
-    0x01, 0x37, 0xff, 0xbf, 0x00, 0x00, 0x01, 0x2a, 0x00, 0x00, 0x01, 0x25, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x01,
-    0x1f, 0x00, 0x00, 0x01, 0x1d, 0x00, 0x00, 0x01, 0x13, 0x00, 0x00, 0x01, 0x16, 0xff, 0x15, 0xff, 0x03, 0xfe, 0xf6,
-    0xfe, 0xe9, 0x01, 0x58, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x63, 0xfe, 0x42, 0x00, 0x8d, 0xfd, 0xd6, 0xfd, 0xa5, 0xfd,
-    0xc6, 0xfd, 0xb1, 0xfd, 0xa5, 0xfd, 0xa4, 0xfd, 0x9f, 0xfd, 0x9a, 0xfd, 0x87, 0x00, 0x00, 0xff, 0x67, 0xff, 0x66,
-    0x00, 0x00, 0x00, 0x00, 0xfd, 0x07, 0x00, 0x00, 0xff, 0x47, 0xfc, 0xfb, 0xfc, 0xf8, 0x00, 0x00, 0xfc, 0xb6, 0x00,
-    0x00, 0xfc, 0xae, 0x00, 0x00, 0xfc, 0xa3, 0x00, 0x00, 0xfc, 0x9f, 0x00, 0x00, 0xfe, 0x91, 0x00, 0x00, 0xfe, 0x8e,
-    0x00, 0x00, 0xfc, 0x47, 0x00, 0x00, 0xe5, 0x4c, 0xe5, 0x0c, 0xe4, 0xbd, 0xe4, 0xeb, 0xe4, 0x51, 0xe4, 0xe9, 0xe4,
-    0x01, 0xe1, 0x58, 0x00, 0x00, 0xe1, 0x4f, 0xe1, 0x4e, 0xe1, 0x4c, 0xe1, 0x43, 0xe3, 0x13, 0xe1, 0x3b, 0xe3, 0x0b,
-    0xe1, 0x32, 0xe1, 0x03, 0xe0, 0xf9, 0x00, 0x00, 0xe0, 0xd3, 0x00, 0x00, 0xe0, 0x77, 0xe0, 0x6a, 0xe0, 0x68, 0xe0,
-    0x5d, 0xdf, 0x91, 0xe0, 0x52, 0xe0, 0x26, 0xdf, 0x83, 0xde, 0xa9, 0xdf, 0x77, 0xdf, 0x76, 0xdf, 0x6f, 0xdf, 0x6c,
-    0xdf, 0x60, 0xdf, 0x44, 0xdf, 0x2d, 0xdf, 0x2a, 0xdb, 0xc6, 0x0a, 0xce, 0x02, 0x93, 0x01, 0x97, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xd0, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x1e, 0x00, 0x00, 0x01, 0x1e, 0x00,
-    0x00, 0x01, 0x1e, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x62, 0x01, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x62, 0x01, 0x7e,
-    0x00, 0x00, 0x01, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xae, 0x00, 0x00, 0x01, 0xf6, 0x00, 0x00, 0x02,
-    0x1e, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x02, 0x4c, 0x00, 0x00, 0x02, 0xd6, 0x00, 0x00, 0x02, 0xe6, 0x00, 0x00,
-    0x02, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xde, 0x00, 0x00, 0x02, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x10, 0x01,
-    0xea, 0x01, 0xeb, 0x01, 0xec, 0x01, 0xed, 0x01, 0xee, 0x01, 0xef, 0x00, 0x7f, 0x01, 0xe6, 0x01, 0xfa, 0x01, 0xfb,
-    0x01, 0xfc, 0x01, 0xfd, 0x01, 0xfe, 0x01, 0xff, 0x00, 0x80, 0x00, 0x81, 0x02, 0x00, 0x02, 0x01, 0x02, 0x02, 0x02,
-    0x03, 0x02, 0x04, 0x00, 0x82, 0x00, 0x83, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02, 0x0a,
-    0x00, 0x84, 0x00, 0x85, 0x02, 0x15, 0x02, 0x16, 0x02, 0x17, 0x02, 0x18, 0x02, 0x19, 0x02, 0x1a, 0x00, 0x86, 0x00,
-    0x87, 0x02, 0x1b, 0x02, 0x1c, 0x02, 0x1d, 0x02, 0x1e, 0x02, 0x1f, 0x00, 0x88, 0x01, 0xe5, 0x03, 0xe3, 0x00, 0x89,
-    0x01, 0xe7, 0x00, 0x8a, 0x00, 0x8b, 0x00, 0x8c, 0x02, 0x4e, 0x02, 0x4f, 0x02, 0x50, 0x02, 0x51, 0x00, 0x8d, 0x02,
-    0x52, 0x02, 0x53, 0x02, 0x54, 0x02, 0x55, 0x02, 0x56, 0x02, 0x57, 0x02, 0x58, 0x02, 0x59, 0x00, 0x8e, 0x00, 0x8f,
-    0x02, 0x5a, 0x02, 0x5b, 0x02, 0x5c, 0x02, 0x5d, 0x02, 0x5e, 0x02, 0x5f, 0x02, 0x60, 0x00, 0x90, 0x00, 0x91, 0x02,
-    0x61, 0x02, 0x62, 0x02, 0x63, 0x02, 0x64, 0x02, 0x65, 0x02, 0x66, 0x00, 0x92, 0x00, 0x93, 0x02, 0x75, 0x02, 0x76,
-    0x02, 0x79, 0x02, 0x7b, 0x02, 0x7c, 0x02, 0x7d, 0x01, 0xe8, 0x01, 0xe9, 0x01, 0xf0, 0x02, 0x0b, 0x02, 0x95, 0x02,
-    0x96, 0x02, 0x97, 0x02, 0x98, 0x02, 0x73, 0x02, 0x74, 0x02, 0x77, 0x02, 0x78, 0x00, 0xab, 0x00, 0xac, 0x02, 0xef,
-    0x00, 0xad, 0x02, 0xf0, 0x02, 0xf1, 0x02, 0xf2, 0x00, 0xae, 0x00, 0xaf, 0x02, 0xf9, 0x02, 0xfa, 0x02, 0xfb, 0x00,
-    0xb0, 0x02, 0xfc, 0x02, 0xfd, 0x00, 0xb1, 0x02, 0xfe, 0x02, 0xff, 0x00, 0xb2, 0x03, 0x00, 0x00, 0xb3, 0x03, 0x01,
-    0x00, 0xb4, 0x03, 0x02, 0x03, 0x03, 0x00, 0xb5, 0x03, 0x04, 0x00, 0xb6, 0x00, 0xb7, 0x03, 0x05, 0x03, 0x06, 0x03,
-    0x07, 0x03, 0x08, 0x03, 0x09, 0x03, 0x0a, 0x03, 0x0b, 0x03, 0x0c, 0x00, 0xc1, 0x03, 0x0e, 0x03, 0x0f, 0x00, 0xc2,
-    0x03, 0x0d, 0x00, 0xc3, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc6, 0x00, 0xc7, 0x00, 0xc8, 0x00, 0xc9, 0x03, 0x10, 0x00,
-    0xca, 0x00, 0xcb, 0x03, 0x4f, 0x03, 0x16, 0x00, 0xcf, 0x03, 0x17, 0x00, 0xd0, 0x03, 0x18, 0x03, 0x19, 0x03, 0x1a,
-    0x03, 0x1b, 0x00, 0xd1, 0x00, 0xd2, 0x00, 0xd3, 0x03, 0x1d, 0x03, 0x50, 0x03, 0x1e, 0x00, 0xd4, 0x03, 0x1f, 0x00,
-    0xd5, 0x03, 0x20, 0x03, 0x21, 0x00, 0xd6, 0x03, 0x22, 0x00, 0xd7, 0x00, 0xd8, 0x00, 0xd9, 0x03, 0x23, 0x03, 0x1c,
-    0x00, 0xda, 0x03, 0x24, 0x03, 0x25, 0x03, 0x26, 0x03, 0x27, 0x03, 0x28, 0x03, 0x29, 0x03, 0x2a, 0x00, 0xdb, 0x03,
-    0x2b, 0x03, 0x2c, 0x03, 0x2d, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0xe8, 0x00, 0xe9, 0x03, 0x2e, 0x00, 0xea, 0x00, 0xeb,
-    0x00, 0xec, 0x03, 0x2f, 0x00, 0xed, 0x00, 0xee, 0x00, 0xef, 0x00, 0xf0, 0x03, 0x30, 0x00, 0xf1, 0x03, 0x31, 0x03,
-    0x32, 0x00, 0xf2, 0x03, 0x33, 0x00, 0xf3, 0x03, 0x34, 0x03, 0x51, 0x03, 0x35, 0x00, 0xfe, 0x03, 0x36, 0x00, 0xff,
-    0x03, 0x37, 0x03, 0x38, 0x03, 0x39, 0x03, 0x3a, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x3b, 0x03, 0x52, 0x03,
-    0x3c, 0x01, 0x03, 0x01, 0x04, 0x01, 0x05, 0x03, 0xfa, 0x03, 0x53, 0x03, 0x54, 0x01, 0x13, 0x01, 0x14, 0x01, 0x15,
-    0x01, 0x16, 0x03, 0x55, 0x03, 0x56, 0x01, 0x26, 0x01, 0x27, 0x03, 0xff, 0x04, 0x00, 0x03, 0xf9, 0x03, 0xf8, 0x01,
-    0x28, 0x01, 0x29, 0x01, 0x2a, 0x01, 0x2b, 0x03, 0xfb, 0x03, 0xfc, 0x01, 0x2c, 0x01, 0x2d, 0x03, 0xf3, 0x03, 0xf4,
-    0x03, 0x57, 0x03, 0x58, 0x03, 0xe5, 0x03, 0xe6, 0x01, 0x2e, 0x01, 0x2f, 0x03, 0xfd, 0x03, 0xfe, 0x01, 0x30, 0x01,
-    0x31, 0x03, 0xe7, 0x03, 0xe8, 0x01, 0x32, 0x01, 0x33, 0x01, 0x34, 0x01, 0x35, 0x01, 0x36, 0x01, 0x37, 0x03, 0x59,
-    0x03, 0x5a, 0x03, 0xe9, 0x03, 0xea, 0x03, 0x5b, 0x03, 0x5c, 0x04, 0x07, 0x04, 0x08, 0x03, 0xeb, 0x03, 0xec, 0x01,
-    0x38, 0x01, 0x39, 0x03, 0xed, 0x03, 0xee, 0x01, 0x3a, 0x01, 0x3b, 0x01, 0x3c, 0x03, 0xf7, 0x01, 0x3d, 0x01, 0x3e,
-    0x03, 0xf5, 0x03, 0xf6, 0x03, 0x5d, 0x03, 0x5e, 0x03, 0x5f, 0x01, 0x3f, 0x01, 0x40, 0x04, 0x05, 0x04, 0x06, 0x01,
-    0x41, 0x01, 0x42, 0x04, 0x01, 0x04, 0x02, 0x03, 0xef, 0x03, 0xf0, 0x04, 0x03, 0x04, 0x04, 0x01, 0x43, 0x03, 0x6a,
-    0x03, 0x69, 0x03, 0x6b, 0x03, 0x6c, 0x03, 0x6d, 0x03, 0x6e, 0x03, 0x6f, 0x01, 0x44, 0x01, 0x45, 0x03, 0xf1, 0x03,
-    0xf2, 0x03, 0x84, 0x03, 0x85, 0x01, 0x46, 0x01, 0x47, 0x03, 0x86, 0x03, 0x87, 0x04, 0x09, 0x04, 0x0a, 0x01, 0x48,
-    0x03, 0x88, 0x04, 0x0b, 0x03, 0x89, 0x03, 0x8a, 0x01, 0x64, 0x01, 0x65, 0x04, 0x0d, 0x04, 0x0c, 0x01, 0x79, 0x03,
-    0xe4, 0x01, 0x7b, 0x00, 0x06, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x04, 0x10, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0a,
-    0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00,
-    0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d,
-    0x00, 0x1e, 0x00, 0x1f, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00,
-    0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x30,
-    0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00,
-    0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43,
-    0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00,
-    0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56,
-    0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00,
-    0x60, 0x00, 0x00, 0x01, 0xee, 0x01, 0xef, 0x01, 0xf1, 0x01, 0xf3, 0x01, 0xfa, 0x01, 0xff, 0x02, 0x03, 0x02, 0x06,
-    0x02, 0x05, 0x02, 0x07, 0x02, 0x09, 0x02, 0x08, 0x02, 0x0a, 0x02, 0x0c, 0x02, 0x0e, 0x02, 0x0d, 0x02, 0x0f, 0x02,
-    0x10, 0x02, 0x12, 0x02, 0x11, 0x02, 0x13, 0x02, 0x14, 0x02, 0x15, 0x02, 0x17, 0x02, 0x16, 0x02, 0x18, 0x02, 0x1a,
-    0x02, 0x19, 0x02, 0x1c, 0x02, 0x1b, 0x02, 0x1d, 0x02, 0x1e, 0x01, 0x6e, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x63, 0x00,
-    0x67, 0x01, 0x70, 0x00, 0x75, 0x00, 0x83, 0x00, 0x6d, 0x00, 0x69, 0x01, 0x7f, 0x00, 0x73, 0x00, 0x68, 0x01, 0x8d,
-    0x00, 0x7f, 0x00, 0x81, 0x01, 0x8a, 0x00, 0x70, 0x01, 0x8e, 0x01, 0x8f, 0x00, 0x65, 0x00, 0x74, 0x01, 0x85, 0x01,
-    0x87, 0x01, 0x86, 0x00, 0xc3, 0x01, 0x8b, 0x00, 0x6a, 0x00, 0x79, 0x00, 0xb7, 0x00, 0x84, 0x00, 0x87, 0x00, 0x7e,
-    0x00, 0x61, 0x00, 0x6c, 0x01, 0x89, 0x00, 0x95, 0x01, 0x8c, 0x00, 0xaf, 0x00, 0x6b, 0x00, 0x7a, 0x01, 0x72, 0x00,
-    0x03, 0x01, 0xea, 0x01, 0xed, 0x01, 0xfe, 0x00, 0x92, 0x00, 0x93, 0x01, 0x64, 0x01, 0x65, 0x01, 0x6b, 0x01, 0x6c,
-    0x01, 0x67, 0x01, 0x68, 0x00, 0x86, 0x01, 0x90, 0x02, 0x20, 0x02, 0x8e, 0x01, 0x76, 0x01, 0x7b, 0x01, 0x74, 0x01,
-    0x75, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6f, 0x00, 0x76, 0x01, 0x69, 0x01, 0x6d, 0x01, 0x73, 0x01, 0xec, 0x01, 0xf4,
-    0x01, 0xeb, 0x01, 0xf5, 0x01, 0xf2, 0x01, 0xf7, 0x01, 0xf8, 0x01, 0xf9, 0x01, 0xf6, 0x01, 0xfc, 0x01, 0xfd, 0x00,
-    0x00, 0x01, 0xfb, 0x02, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00, 0x8a, 0x00, 0x9c, 0x00, 0xa2, 0x00, 0x6e, 0x00, 0x9e,
-    0x00, 0x9f, 0x00, 0xa0, 0x00, 0x77, 0x00, 0xa3, 0x00, 0xa1, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x02, 0x01, 0x9e, 0x04,
-    0x20, 0x03, 0xd9, 0x06, 0x09, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x34, 0x4b, 0xb0, 0x1d, 0x50, 0x58, 0x40, 0x0d, 0x02,
-    0x01, 0x00, 0x00, 0x01, 0x59, 0x03, 0x01, 0x01, 0x01, 0x3e, 0x00, 0x4c, 0x1b, 0x40, 0x13, 0x03, 0x01, 0x01, 0x00,
-    0x00, 0x01, 0x55, 0x03, 0x01, 0x01, 0x01, 0x00, 0x59, 0x02, 0x01, 0x00, 0x01, 0x00, 0x4d, 0x59, 0xb6, 0x12, 0x12,
-    0x12, 0x11, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x03, 0x07, 0x13, 0x37, 0x17, 0x05, 0x03, 0x23, 0x13, 0x37, 0x33, 0x02,
-    0x6b, 0x4d, 0x80, 0x3d, 0x11, 0x91, 0x01, 0x48, 0x4d, 0x7f, 0x3c, 0x11, 0x93, 0x05, 0x8b, 0xfe, 0x96, 0x01, 0x01,
-    0x81, 0x68, 0x0a, 0x74, 0xfe, 0x96, 0x01, 0x79, 0x66, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1a, 0x00, 0x00, 0x04,
-    0xc3, 0x05, 0xb0, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x74, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x27, 0x0e, 0x0b, 0x02,
-    0x03, 0x0c, 0x02, 0x02, 0x00, 0x01, 0x03, 0x00, 0x61, 0x08, 0x01, 0x06, 0x06, 0x3c, 0x4b, 0x0f, 0x0a, 0x02, 0x04,
-    0x04, 0x05, 0x59, 0x09, 0x07, 0x02, 0x05, 0x05, 0x3f, 0x4b, 0x0d, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x1b, 0x40,
-    0x25, 0x09, 0x07, 0x02, 0x05, 0x0f, 0x0a, 0x02, 0x04, 0x03, 0x05, 0x04, 0x62, 0x0e, 0x0b, 0x02, 0x03, 0x0c, 0x02,
-    0x02, 0x00, 0x01, 0x03, 0x00, 0x61, 0x08, 0x01, 0x06, 0x06, 0x3c, 0x4b, 0x0d, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c,
-    0x59, 0x40, 0x1a, 0x1f, 0x1e, 0x1d, 0x1c, 0x1b, 0x1a, 0x19, 0x18, 0x17, 0x16, 0x15, 0x14, 0x13, 0x12, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x08, 0x1d, 0x2b, 0x01, 0x23, 0x03, 0x23, 0x13, 0x23, 0x37, 0x33,
-    0x13, 0x23, 0x37, 0x21, 0x13, 0x33, 0x03, 0x33, 0x13, 0x33, 0x03, 0x33, 0x07, 0x23, 0x03, 0x33, 0x07, 0x23, 0x03,
-    0x23, 0x03, 0x33, 0x13, 0x23, 0x02, 0x8b, 0xfb, 0x95, 0x91, 0x96, 0xe6, 0x18, 0xfe, 0x81, 0xf9, 0x19, 0x01, 0x12,
-    0x98, 0x91, 0x99, 0xfa, 0x99, 0x90, 0x98, 0xc5, 0x18, 0xdf, 0x80, 0xd9, 0x18, 0xf2, 0x95, 0x91, 0x34, 0xfa, 0x81,
-    0xfb, 0x01, 0x9a, 0xfe, 0x66, 0x01, 0x9a, 0x89, 0x01, 0x62, 0x8b, 0x01, 0xa0, 0xfe, 0x60, 0x01, 0xa0, 0xfe, 0x60,
-    0x8b, 0xfe, 0x9e, 0x89, 0xfe, 0x66, 0x02, 0x23, 0x01, 0x62, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7c, 0xff, 0x30, 0x04,
-    0x5f, 0x06, 0x9c, 0x00, 0x43, 0x00, 0x43, 0x40, 0x40, 0x12, 0x01, 0x02, 0x00, 0x34, 0x01, 0x03, 0x05, 0x02, 0x4a,
-    0x00, 0x01, 0x02, 0x04, 0x02, 0x01, 0x04, 0x70, 0x00, 0x04, 0x05, 0x02, 0x04, 0x05, 0x6e, 0x00, 0x00, 0x00, 0x02,
-    0x01, 0x00, 0x02, 0x63, 0x00, 0x05, 0x03, 0x03, 0x05, 0x57, 0x00, 0x05, 0x05, 0x03, 0x59, 0x00, 0x03, 0x05, 0x03,
-    0x4d, 0x40, 0x3e, 0x3a, 0x39, 0x33, 0x32, 0x1e, 0x1c, 0x18, 0x17, 0x11, 0x10, 0x06, 0x08, 0x14, 0x2b, 0x01, 0x36,
-    0x2e, 0x02, 0x27, 0x2e, 0x03, 0x37, 0x3e, 0x03, 0x37, 0x37, 0x33, 0x07, 0x1e, 0x03, 0x07, 0x23, 0x36, 0x2e, 0x02,
-    0x27, 0x26, 0x0e, 0x02, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x07, 0x23, 0x37, 0x2e,
-    0x03, 0x37, 0x33, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x03, 0x4c, 0x06, 0x21, 0x40, 0x54, 0x2d, 0x4a, 0x80,
-    0x5d, 0x30, 0x06, 0x06, 0x41, 0x6a, 0x8e, 0x54, 0x27, 0x92, 0x28, 0x56, 0x70, 0x40, 0x16, 0x05, 0xb4, 0x03, 0x0c,
-    0x2b, 0x4e, 0x3f, 0x38, 0x5f, 0x47, 0x2e, 0x06, 0x06, 0x22, 0x41, 0x56, 0x2f, 0x49, 0x7f, 0x5b, 0x2f, 0x06, 0x06,
-    0x47, 0x73, 0x97, 0x56, 0x23, 0x92, 0x23, 0x58, 0x7e, 0x4e, 0x22, 0x05, 0xb5, 0x04, 0x14, 0x36, 0x59, 0x41, 0x3a,
-    0x6a, 0x54, 0x37, 0x01, 0x7e, 0x36, 0x52, 0x3f, 0x2e, 0x11, 0x1d, 0x4c, 0x67, 0x85, 0x57, 0x57, 0x8b, 0x65, 0x3f,
-    0x0a, 0xdc, 0xde, 0x11, 0x59, 0x7e, 0x97, 0x4f, 0x33, 0x6c, 0x58, 0x3a, 0x02, 0x01, 0x21, 0x3f, 0x5a, 0x37, 0x39,
-    0x53, 0x3e, 0x2e, 0x12, 0x1e, 0x4b, 0x65, 0x84, 0x57, 0x5c, 0x8d, 0x63, 0x3b, 0x09, 0xc0, 0xc1, 0x0d, 0x4f, 0x75,
-    0x96, 0x55, 0x3b, 0x68, 0x4e, 0x2f, 0x01, 0x02, 0x1f, 0x3d, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x82, 0xff,
-    0xe9, 0x04, 0x50, 0x05, 0xc7, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x41, 0x00, 0x57, 0x00, 0x5b, 0x00, 0x3e, 0x40, 0x3b,
-    0x5b, 0x5a, 0x02, 0x02, 0x03, 0x59, 0x01, 0x06, 0x07, 0x02, 0x4a, 0x00, 0x02, 0x00, 0x01, 0x04, 0x02, 0x01, 0x63,
-    0x00, 0x04, 0x00, 0x07, 0x06, 0x04, 0x07, 0x63, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x44, 0x4b, 0x00,
-    0x06, 0x06, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x45, 0x05, 0x4c, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x24, 0x08,
-    0x08, 0x1c, 0x2b, 0x13, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x17, 0x06,
-    0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x22, 0x0e, 0x02, 0x07, 0x01, 0x3e, 0x03,
-    0x17, 0x1e, 0x03, 0x07, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x17, 0x06, 0x1e, 0x02, 0x17, 0x32, 0x3e, 0x02,
-    0x37, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x22, 0x0e, 0x02, 0x07, 0x05, 0x27, 0x01, 0x17, 0x8d, 0x07, 0x2f, 0x4c, 0x66,
-    0x3f, 0x3c, 0x59, 0x3a, 0x19, 0x04, 0x07, 0x07, 0x2f, 0x4b, 0x67, 0x3e, 0x3c, 0x59, 0x3a, 0x1a, 0x04, 0x8a, 0x02,
-    0x07, 0x18, 0x2a, 0x22, 0x22, 0x33, 0x22, 0x14, 0x04, 0x07, 0x02, 0x07, 0x18, 0x2a, 0x22, 0x23, 0x32, 0x23, 0x14,
-    0x03, 0x01, 0x28, 0x07, 0x2f, 0x4c, 0x67, 0x3f, 0x3c, 0x59, 0x3a, 0x1a, 0x04, 0x08, 0x07, 0x2f, 0x4b, 0x67, 0x3e,
-    0x3c, 0x5a, 0x3a, 0x1a, 0x04, 0x8a, 0x02, 0x08, 0x18, 0x2a, 0x22, 0x22, 0x33, 0x22, 0x14, 0x04, 0x07, 0x02, 0x07,
-    0x17, 0x2a, 0x22, 0x23, 0x33, 0x23, 0x14, 0x04, 0xfe, 0x76, 0x67, 0x02, 0xd7, 0x68, 0x04, 0xa9, 0x3b, 0x69, 0x4e,
-    0x2c, 0x01, 0x02, 0x2e, 0x4e, 0x66, 0x38, 0x4d, 0x3b, 0x67, 0x4e, 0x2c, 0x02, 0x01, 0x2f, 0x4e, 0x64, 0x38, 0x02,
-    0x1c, 0x38, 0x2e, 0x1e, 0x1c, 0x2d, 0x3a, 0x1e, 0x4f, 0x1c, 0x39, 0x2f, 0x1e, 0x01, 0x1c, 0x2f, 0x3a, 0x1e, 0xfc,
-    0xa6, 0x3b, 0x69, 0x4e, 0x2b, 0x01, 0x02, 0x2e, 0x4e, 0x65, 0x38, 0x4e, 0x3b, 0x68, 0x4c, 0x2c, 0x01, 0x01, 0x2f,
-    0x4d, 0x65, 0x38, 0x02, 0x1c, 0x38, 0x2f, 0x1d, 0x01, 0x1c, 0x2e, 0x3a, 0x1e, 0x50, 0x1c, 0x39, 0x2e, 0x1e, 0x01,
-    0x1c, 0x2e, 0x3a, 0x1e, 0x96, 0x41, 0x04, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3f, 0xff, 0xeb, 0x04,
-    0x66, 0x05, 0xc7, 0x00, 0x2c, 0x00, 0x3b, 0x00, 0x4e, 0x00, 0x76, 0x40, 0x15, 0x41, 0x1a, 0x0a, 0x05, 0x04, 0x01,
-    0x05, 0x31, 0x30, 0x22, 0x1b, 0x00, 0x05, 0x04, 0x01, 0x25, 0x01, 0x02, 0x04, 0x03, 0x4a, 0x4b, 0xb0, 0x19, 0x50,
-    0x58, 0x40, 0x22, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x44, 0x4b, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x03,
-    0x01, 0x02, 0x02, 0x3d, 0x4b, 0x06, 0x01, 0x04, 0x04, 0x02, 0x5b, 0x03, 0x01, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x1b,
-    0x40, 0x20, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x44, 0x4b, 0x00, 0x01, 0x01, 0x02, 0x59, 0x00, 0x02,
-    0x02, 0x3d, 0x4b, 0x06, 0x01, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x45, 0x03, 0x4c, 0x59, 0x40, 0x0f, 0x2e,
-    0x2d, 0x4b, 0x49, 0x2d, 0x3b, 0x2e, 0x3b, 0x23, 0x14, 0x1e, 0x2e, 0x07, 0x08, 0x18, 0x2b, 0x13, 0x3e, 0x03, 0x37,
-    0x2e, 0x03, 0x37, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x07, 0x13, 0x36, 0x36, 0x37, 0x33, 0x06,
-    0x06, 0x07, 0x17, 0x23, 0x27, 0x06, 0x06, 0x27, 0x2e, 0x03, 0x05, 0x16, 0x36, 0x37, 0x03, 0x07, 0x0e, 0x03, 0x07,
-    0x06, 0x1e, 0x02, 0x13, 0x06, 0x1e, 0x02, 0x17, 0x37, 0x36, 0x36, 0x37, 0x36, 0x2e, 0x02, 0x23, 0x26, 0x0e, 0x02,
-    0x45, 0x06, 0x3b, 0x5b, 0x72, 0x3b, 0x13, 0x24, 0x19, 0x0d, 0x03, 0x06, 0x3d, 0x65, 0x89, 0x52, 0x3e, 0x67, 0x49,
-    0x25, 0x04, 0x03, 0x2c, 0x43, 0x53, 0x2b, 0x72, 0xe6, 0x32, 0x3c, 0x0e, 0xa0, 0x0d, 0x63, 0x59, 0x85, 0xca, 0x3d,
-    0x4e, 0xb1, 0x64, 0x54, 0x8e, 0x64, 0x33, 0x01, 0x7f, 0x4c, 0x87, 0x3d, 0xf0, 0x1f, 0x20, 0x41, 0x37, 0x26, 0x06,
-    0x06, 0x15, 0x33, 0x4e, 0x5a, 0x04, 0x06, 0x0f, 0x17, 0x0c, 0x80, 0x32, 0x48, 0x06, 0x03, 0x0b, 0x1b, 0x2c, 0x1f,
-    0x2b, 0x45, 0x33, 0x1f, 0x01, 0x6e, 0x4b, 0x7a, 0x67, 0x55, 0x25, 0x27, 0x50, 0x52, 0x55, 0x2d, 0x50, 0x86, 0x5f,
-    0x33, 0x02, 0x02, 0x30, 0x51, 0x6c, 0x3e, 0x39, 0x5d, 0x4e, 0x43, 0x1f, 0x57, 0xfe, 0x74, 0x46, 0x96, 0x55, 0x7f,
-    0xdb, 0x5b, 0xeb, 0x6c, 0x3b, 0x46, 0x02, 0x01, 0x38, 0x65, 0x8d, 0x95, 0x02, 0x3c, 0x2a, 0x01, 0xae, 0x19, 0x19,
-    0x3b, 0x44, 0x4d, 0x2a, 0x32, 0x55, 0x3e, 0x24, 0x03, 0xdd, 0x1e, 0x3c, 0x39, 0x38, 0x1b, 0x5c, 0x25, 0x5c, 0x41,
-    0x1b, 0x35, 0x2a, 0x1b, 0x01, 0x22, 0x3a, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x26, 0x04, 0x20, 0x03, 0x0d,
-    0x06, 0x08, 0x00, 0x05, 0x00, 0x2d, 0x4b, 0xb0, 0x1f, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x59, 0x00,
-    0x01, 0x01, 0x3e, 0x00, 0x4c, 0x1b, 0x40, 0x10, 0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0x01, 0x00, 0x59,
-    0x00, 0x00, 0x01, 0x00, 0x4d, 0x59, 0xb4, 0x12, 0x11, 0x02, 0x08, 0x16, 0x2b, 0x01, 0x03, 0x07, 0x13, 0x37, 0x17,
-    0x02, 0xfa, 0x4c, 0x88, 0x3d, 0x10, 0x9a, 0x05, 0x88, 0xfe, 0x99, 0x01, 0x01, 0x7f, 0x69, 0x09, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x01, 0x46, 0xfe, 0x2a, 0x03, 0xec, 0x06, 0x6c, 0x00, 0x1d, 0x00, 0x06, 0xb3, 0x16, 0x07, 0x01, 0x30,
-    0x2b, 0x01, 0x3e, 0x05, 0x37, 0x17, 0x0e, 0x02, 0x02, 0x07, 0x07, 0x06, 0x06, 0x1e, 0x03, 0x17, 0x07, 0x2e, 0x04,
-    0x36, 0x37, 0x01, 0x59, 0x0e, 0x35, 0x4d, 0x68, 0x82, 0x9f, 0x5f, 0x1b, 0x6e, 0xa1, 0x72, 0x48, 0x14, 0x02, 0x0b,
-    0x0e, 0x02, 0x14, 0x30, 0x50, 0x3c, 0x2f, 0x4e, 0x73, 0x4f, 0x2e, 0x13, 0x05, 0x0c, 0x02, 0x4b, 0x62, 0xcf, 0xcc,
-    0xc0, 0xaa, 0x8a, 0x30, 0x7c, 0x51, 0xd5, 0xf1, 0xfe, 0xfa, 0x83, 0x0f, 0x48, 0xa4, 0xac, 0xac, 0xa0, 0x8d, 0x36,
-    0x70, 0x37, 0x96, 0xaf, 0xc0, 0xc3, 0xc0, 0x57, 0x00, 0x00, 0x01, 0x00, 0xa0, 0xfe, 0x29, 0x03, 0x48, 0x06, 0x6b,
-    0x00, 0x1d, 0x00, 0x06, 0xb3, 0x16, 0x07, 0x01, 0x30, 0x2b, 0x01, 0x0e, 0x05, 0x07, 0x27, 0x3e, 0x02, 0x12, 0x37,
-    0x37, 0x36, 0x36, 0x2e, 0x03, 0x27, 0x37, 0x1e, 0x04, 0x06, 0x07, 0x03, 0x35, 0x0e, 0x35, 0x4d, 0x68, 0x83, 0x9f,
-    0x5f, 0x1c, 0x6f, 0xa1, 0x72, 0x48, 0x14, 0x02, 0x0a, 0x0e, 0x02, 0x15, 0x30, 0x4f, 0x3b, 0x2e, 0x4f, 0x74, 0x4f,
-    0x2e, 0x13, 0x05, 0x0c, 0x02, 0x49, 0x62, 0xcf, 0xcb, 0xc1, 0xa9, 0x8b, 0x2f, 0x73, 0x51, 0xd7, 0xf5, 0x01, 0x08,
-    0x83, 0x0f, 0x47, 0xa4, 0xac, 0xae, 0xa1, 0x8c, 0x36, 0x70, 0x37, 0x96, 0xaf, 0xc0, 0xc4, 0xc0, 0x57, 0x00, 0x00,
-    0x01, 0x00, 0xb5, 0x00, 0xef, 0x04, 0x57, 0x04, 0xc8, 0x00, 0x0e, 0x00, 0x1a, 0x40, 0x17, 0x0e, 0x0d, 0x0c, 0x0b,
-    0x0a, 0x09, 0x08, 0x07, 0x06, 0x03, 0x02, 0x01, 0x0c, 0x00, 0x47, 0x00, 0x00, 0x00, 0x69, 0x14, 0x01, 0x08, 0x15,
-    0x2b, 0x01, 0x25, 0x37, 0x05, 0x13, 0x33, 0x03, 0x25, 0x17, 0x05, 0x13, 0x07, 0x03, 0x01, 0x27, 0x02, 0x13, 0xfe,
-    0xa2, 0x4d, 0x01, 0x4f, 0x2a, 0xae, 0x5e, 0x01, 0x73, 0x19, 0xfe, 0x7d, 0xc8, 0x98, 0x97, 0xfe, 0xfd, 0x85, 0x02,
-    0xae, 0x60, 0xaa, 0x99, 0x01, 0xa9, 0xfe, 0x5a, 0x94, 0xb8, 0x5e, 0xfe, 0xb8, 0x69, 0x01, 0x6c, 0xfe, 0xa1, 0x6f,
-    0x00, 0x01, 0x00, 0x72, 0x00, 0x92, 0x04, 0x5c, 0x04, 0xb6, 0x00, 0x0b, 0x00, 0x29, 0x40, 0x26, 0x00, 0x05, 0x00,
-    0x05, 0x72, 0x00, 0x02, 0x01, 0x02, 0x73, 0x04, 0x01, 0x00, 0x01, 0x01, 0x00, 0x55, 0x04, 0x01, 0x00, 0x00, 0x01,
-    0x5a, 0x03, 0x01, 0x01, 0x00, 0x01, 0x4e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x01, 0x21,
-    0x07, 0x21, 0x03, 0x23, 0x13, 0x21, 0x37, 0x21, 0x13, 0x33, 0x02, 0xd1, 0x01, 0x8b, 0x20, 0xfe, 0x75, 0x4e, 0xb5,
-    0x4f, 0xfe, 0x75, 0x21, 0x01, 0x89, 0x4a, 0xb5, 0x03, 0x0d, 0xb8, 0xfe, 0x3d, 0x01, 0xc3, 0xb8, 0x01, 0xa9, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0xc2, 0xfe, 0xb0, 0x02, 0x2f, 0x00, 0xdb, 0x00, 0x09, 0x00, 0x10, 0x40, 0x0d, 0x04, 0x03,
-    0x02, 0x00, 0x47, 0x00, 0x00, 0x00, 0x69, 0x18, 0x01, 0x08, 0x15, 0x2b, 0x25, 0x06, 0x06, 0x07, 0x27, 0x36, 0x36,
-    0x37, 0x37, 0x33, 0x02, 0x12, 0x13, 0x76, 0x59, 0x6e, 0x35, 0x45, 0x0f, 0x20, 0xc4, 0x2c, 0x71, 0xc3, 0x48, 0x41,
-    0x46, 0x9a, 0x57, 0xb3, 0x00, 0x01, 0x00, 0xcc, 0x02, 0x31, 0x03, 0xce, 0x02, 0xc9, 0x00, 0x03, 0x00, 0x18, 0x40,
-    0x15, 0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x01, 0x00, 0x4d, 0x11, 0x10,
-    0x02, 0x08, 0x16, 0x2b, 0x01, 0x21, 0x37, 0x21, 0x03, 0xb3, 0xfd, 0x19, 0x1b, 0x02, 0xe7, 0x02, 0x31, 0x98, 0x00,
-    0x01, 0x01, 0x8e, 0xff, 0xec, 0x02, 0xaa, 0x01, 0x09, 0x00, 0x13, 0x00, 0x13, 0x40, 0x10, 0x00, 0x00, 0x00, 0x01,
-    0x5b, 0x00, 0x01, 0x01, 0x45, 0x01, 0x4c, 0x28, 0x24, 0x02, 0x08, 0x16, 0x2b, 0x25, 0x34, 0x3e, 0x02, 0x33, 0x36,
-    0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x01, 0x8e, 0x15, 0x25, 0x35, 0x20, 0x1f, 0x34, 0x25,
-    0x15, 0x16, 0x26, 0x36, 0x1f, 0x1e, 0x33, 0x25, 0x15, 0x73, 0x1f, 0x37, 0x28, 0x17, 0x01, 0x14, 0x26, 0x33, 0x1f,
-    0x20, 0x34, 0x27, 0x16, 0x13, 0x24, 0x32, 0x00, 0x01, 0x00, 0x72, 0xff, 0x83, 0x04, 0x7c, 0x05, 0xb0, 0x00, 0x03,
-    0x00, 0x13, 0x40, 0x10, 0x00, 0x00, 0x01, 0x00, 0x73, 0x00, 0x01, 0x01, 0x3c, 0x01, 0x4c, 0x11, 0x10, 0x02, 0x08,
-    0x16, 0x2b, 0x05, 0x23, 0x01, 0x33, 0x01, 0x1d, 0xab, 0x03, 0x60, 0xaa, 0x7d, 0x06, 0x2d, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x7f, 0xff, 0xe9, 0x04, 0x5a, 0x05, 0xc7, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x33, 0x00, 0x26, 0x40, 0x23, 0x29,
-    0x1d, 0x02, 0x03, 0x02, 0x01, 0x4a, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x44, 0x4b, 0x00, 0x03, 0x03,
-    0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x2a, 0x2c, 0x2d, 0x24, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x0e, 0x03,
-    0x27, 0x2e, 0x05, 0x37, 0x13, 0x3e, 0x05, 0x17, 0x1e, 0x05, 0x07, 0x01, 0x01, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e,
-    0x02, 0x07, 0x05, 0x01, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x04, 0x1b, 0x11, 0x4f, 0x83, 0xbd, 0x7f,
-    0x50, 0x7b, 0x59, 0x38, 0x1d, 0x04, 0x09, 0x36, 0x0b, 0x2a, 0x41, 0x58, 0x71, 0x8c, 0x55, 0x51, 0x7a, 0x59, 0x38,
-    0x1c, 0x04, 0x09, 0xfc, 0xf1, 0x02, 0x6e, 0x01, 0x14, 0x33, 0x55, 0x40, 0x55, 0x79, 0x53, 0x2f, 0x0b, 0x02, 0x1b,
-    0xfd, 0x95, 0x01, 0x15, 0x33, 0x55, 0x3f, 0x55, 0x79, 0x52, 0x2f, 0x0b, 0x02, 0x2f, 0x70, 0xd3, 0xa3, 0x60, 0x03,
-    0x02, 0x31, 0x52, 0x6e, 0x7f, 0x8a, 0x45, 0x01, 0x55, 0x4a, 0x91, 0x82, 0x6e, 0x4f, 0x2b, 0x02, 0x02, 0x31, 0x53,
-    0x6e, 0x80, 0x8a, 0x45, 0xfe, 0xd8, 0x01, 0xb0, 0x39, 0x68, 0x50, 0x30, 0x02, 0x03, 0x41, 0x6e, 0x8d, 0x49, 0x5f,
-    0xfe, 0x54, 0x38, 0x66, 0x4e, 0x30, 0x02, 0x03, 0x42, 0x6f, 0x8d, 0x49, 0x00, 0x01, 0x01, 0x1a, 0x00, 0x00, 0x03,
-    0x7f, 0x05, 0xb0, 0x00, 0x06, 0x00, 0x13, 0x40, 0x10, 0x05, 0x03, 0x02, 0x03, 0x00, 0x48, 0x00, 0x00, 0x00, 0x3d,
-    0x00, 0x4c, 0x10, 0x01, 0x08, 0x15, 0x2b, 0x21, 0x23, 0x13, 0x05, 0x37, 0x25, 0x33, 0x02, 0x88, 0xb5, 0xd3, 0xfe,
-    0x74, 0x20, 0x02, 0x32, 0x13, 0x04, 0xbf, 0x90, 0xb1, 0xd0, 0x00, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x00, 0x04, 0x1a,
-    0x05, 0xc6, 0x00, 0x24, 0x00, 0x28, 0x40, 0x25, 0x00, 0x02, 0x01, 0x04, 0x01, 0x02, 0x04, 0x70, 0x00, 0x01, 0x01,
-    0x03, 0x5b, 0x00, 0x03, 0x03, 0x44, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x59, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x1a,
-    0x24, 0x14, 0x2b, 0x10, 0x05, 0x08, 0x19, 0x2b, 0x21, 0x21, 0x37, 0x01, 0x3e, 0x03, 0x37, 0x36, 0x2e, 0x02, 0x27,
-    0x26, 0x0e, 0x02, 0x07, 0x07, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x01, 0x21, 0x03, 0xae, 0xfc,
-    0x61, 0x16, 0x02, 0x1a, 0x29, 0x5e, 0x52, 0x3b, 0x08, 0x06, 0x16, 0x36, 0x52, 0x35, 0x47, 0x6e, 0x51, 0x32, 0x09,
-    0xb4, 0x0a, 0x56, 0x88, 0xb1, 0x65, 0x56, 0x92, 0x67, 0x34, 0x07, 0x06, 0x43, 0x5f, 0x71, 0x35, 0xfe, 0x42, 0x02,
-    0xbf, 0x8d, 0x02, 0x0b, 0x29, 0x5b, 0x66, 0x70, 0x3e, 0x33, 0x5b, 0x44, 0x29, 0x02, 0x02, 0x2b, 0x4f, 0x6f, 0x42,
-    0x01, 0x64, 0xa7, 0x77, 0x41, 0x02, 0x02, 0x39, 0x68, 0x91, 0x58, 0x4d, 0x8c, 0x7e, 0x70, 0x32, 0xfe, 0x58, 0x00,
-    0x00, 0x01, 0x00, 0x2f, 0xff, 0xea, 0x04, 0x1f, 0x05, 0xc6, 0x00, 0x40, 0x00, 0x45, 0x40, 0x42, 0x20, 0x01, 0x07,
-    0x00, 0x01, 0x4a, 0x00, 0x02, 0x01, 0x00, 0x01, 0x02, 0x00, 0x70, 0x00, 0x05, 0x07, 0x06, 0x07, 0x05, 0x06, 0x70,
-    0x00, 0x00, 0x00, 0x07, 0x05, 0x00, 0x07, 0x63, 0x00, 0x01, 0x01, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x44, 0x4b, 0x00,
-    0x06, 0x06, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x45, 0x04, 0x4c, 0x40, 0x3e, 0x36, 0x34, 0x30, 0x2f, 0x2b, 0x29, 0x24,
-    0x14, 0x28, 0x20, 0x08, 0x08, 0x18, 0x2b, 0x01, 0x17, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e,
-    0x02, 0x07, 0x07, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x27, 0x2e,
-    0x03, 0x37, 0x17, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x01, 0xa0, 0x77,
-    0x3d, 0x71, 0x5a, 0x3b, 0x08, 0x06, 0x12, 0x33, 0x51, 0x39, 0x3b, 0x64, 0x4d, 0x32, 0x0a, 0xb3, 0x0a, 0x55, 0x83,
-    0xa7, 0x5b, 0x5a, 0x91, 0x63, 0x2f, 0x08, 0x05, 0x30, 0x4b, 0x5e, 0x34, 0x33, 0x49, 0x2b, 0x10, 0x04, 0x09, 0x55,
-    0x87, 0xb0, 0x63, 0x5a, 0x96, 0x69, 0x38, 0x05, 0xb4, 0x04, 0x1b, 0x39, 0x58, 0x39, 0x41, 0x6d, 0x52, 0x34, 0x07,
-    0x07, 0x1e, 0x40, 0x60, 0x3c, 0x8c, 0x03, 0x31, 0x02, 0x22, 0x41, 0x61, 0x41, 0x36, 0x5b, 0x42, 0x25, 0x02, 0x01,
-    0x24, 0x42, 0x5d, 0x39, 0x01, 0x5d, 0x96, 0x69, 0x38, 0x01, 0x02, 0x3b, 0x69, 0x94, 0x5b, 0x3c, 0x65, 0x52, 0x40,
-    0x17, 0x16, 0x43, 0x56, 0x63, 0x36, 0x65, 0xa2, 0x72, 0x3b, 0x02, 0x02, 0x3a, 0x69, 0x94, 0x5c, 0x01, 0x38, 0x5c,
-    0x42, 0x26, 0x01, 0x02, 0x27, 0x49, 0x69, 0x40, 0x3e, 0x5e, 0x40, 0x22, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x1b, 0x00, 0x00, 0x04, 0x33, 0x05, 0xb0, 0x00, 0x0a, 0x00, 0x0e, 0x00, 0x27, 0x40, 0x24, 0x0d, 0x01, 0x00,
-    0x04, 0x01, 0x4a, 0x05, 0x01, 0x00, 0x03, 0x01, 0x01, 0x02, 0x00, 0x01, 0x62, 0x00, 0x04, 0x04, 0x3c, 0x4b, 0x00,
-    0x02, 0x02, 0x3d, 0x02, 0x4c, 0x11, 0x12, 0x11, 0x11, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x01, 0x33, 0x07, 0x23,
-    0x03, 0x23, 0x13, 0x21, 0x37, 0x01, 0x33, 0x01, 0x21, 0x13, 0x07, 0x03, 0x6e, 0xc5, 0x1a, 0xc5, 0x3b, 0xb5, 0x3b,
-    0xfd, 0x7c, 0x15, 0x03, 0x1f, 0xc7, 0xfc, 0xed, 0x01, 0xb6, 0x84, 0x27, 0x01, 0xe9, 0x97, 0xfe, 0xae, 0x01, 0x52,
-    0x77, 0x03, 0xe7, 0xfc, 0x39, 0x02, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x8f, 0xff, 0xe9, 0x04, 0x9a,
-    0x05, 0xb0, 0x00, 0x29, 0x00, 0x3c, 0x40, 0x39, 0x05, 0x01, 0x06, 0x02, 0x29, 0x01, 0x04, 0x06, 0x02, 0x4a, 0x00,
-    0x04, 0x06, 0x05, 0x06, 0x04, 0x05, 0x70, 0x00, 0x02, 0x00, 0x06, 0x04, 0x02, 0x06, 0x63, 0x00, 0x01, 0x01, 0x00,
-    0x59, 0x00, 0x00, 0x00, 0x3c, 0x4b, 0x00, 0x05, 0x05, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x45, 0x03, 0x4c, 0x28, 0x24,
-    0x14, 0x28, 0x22, 0x11, 0x11, 0x07, 0x08, 0x1b, 0x2b, 0x13, 0x13, 0x21, 0x07, 0x21, 0x03, 0x36, 0x17, 0x1e, 0x03,
-    0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x27, 0x33, 0x1e, 0x03, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27,
-    0x26, 0x06, 0x07, 0xfe, 0xc5, 0x02, 0xd7, 0x20, 0xfd, 0xc5, 0x74, 0x6e, 0x80, 0x65, 0x8d, 0x55, 0x20, 0x09, 0x0a,
-    0x50, 0x84, 0xb4, 0x6e, 0x5a, 0x8f, 0x65, 0x37, 0x03, 0xa9, 0x03, 0x1e, 0x39, 0x55, 0x39, 0x49, 0x72, 0x4f, 0x2f,
-    0x08, 0x06, 0x12, 0x34, 0x5a, 0x41, 0x49, 0x72, 0x38, 0x02, 0xdd, 0x02, 0xd3, 0xb4, 0xfe, 0x7b, 0x41, 0x02, 0x02,
-    0x52, 0x87, 0xab, 0x5a, 0x69, 0xb6, 0x84, 0x4a, 0x03, 0x02, 0x3c, 0x6b, 0x93, 0x58, 0x36, 0x5b, 0x44, 0x27, 0x02,
-    0x02, 0x38, 0x60, 0x7c, 0x42, 0x3a, 0x6f, 0x57, 0x38, 0x02, 0x02, 0x31, 0x2b, 0x00, 0x02, 0x00, 0x75, 0xff, 0xe9,
-    0x03, 0xf9, 0x05, 0xb2, 0x00, 0x21, 0x00, 0x38, 0x00, 0x3c, 0x40, 0x39, 0x07, 0x01, 0x04, 0x01, 0x01, 0x4a, 0x00,
-    0x01, 0x07, 0x01, 0x04, 0x05, 0x01, 0x04, 0x63, 0x00, 0x00, 0x00, 0x03, 0x5b, 0x06, 0x01, 0x03, 0x03, 0x3c, 0x4b,
-    0x00, 0x05, 0x05, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x45, 0x02, 0x4c, 0x23, 0x22, 0x00, 0x00, 0x30, 0x2e, 0x22, 0x38,
-    0x23, 0x38, 0x00, 0x21, 0x00, 0x20, 0x28, 0x26, 0x21, 0x08, 0x08, 0x17, 0x2b, 0x01, 0x07, 0x23, 0x26, 0x0e, 0x02,
-    0x07, 0x36, 0x36, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x37, 0x3e, 0x05, 0x33, 0x01, 0x26,
-    0x0e, 0x02, 0x07, 0x07, 0x06, 0x14, 0x1e, 0x03, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x03, 0xc0, 0x11,
-    0x0c, 0x78, 0xbc, 0x8e, 0x65, 0x22, 0x40, 0xa1, 0x5e, 0x62, 0x8a, 0x54, 0x20, 0x08, 0x09, 0x4d, 0x80, 0xb0, 0x6d,
-    0x6f, 0x9b, 0x5e, 0x21, 0x0b, 0x0c, 0x10, 0x3e, 0x5e, 0x81, 0xa7, 0xcf, 0x7d, 0xfe, 0xc9, 0x33, 0x5d, 0x4f, 0x40,
-    0x17, 0x08, 0x04, 0x0e, 0x1d, 0x30, 0x48, 0x31, 0x47, 0x6e, 0x4e, 0x2e, 0x07, 0x06, 0x0d, 0x2f, 0x53, 0x05, 0xb2,
-    0xa6, 0x01, 0x47, 0x80, 0xb2, 0x6b, 0x42, 0x51, 0x01, 0x02, 0x53, 0x85, 0xa8, 0x57, 0x66, 0xb8, 0x8b, 0x50, 0x03,
-    0x03, 0x66, 0xa0, 0xc4, 0x61, 0x57, 0x71, 0xd4, 0xb9, 0x98, 0x6e, 0x3d, 0xfd, 0x6f, 0x02, 0x20, 0x38, 0x4c, 0x2b,
-    0x40, 0x25, 0x58, 0x57, 0x52, 0x40, 0x28, 0x02, 0x02, 0x3a, 0x62, 0x7c, 0x3f, 0x36, 0x73, 0x5f, 0x3e, 0x00, 0x01,
-    0x00, 0xbf, 0x00, 0x00, 0x04, 0xae, 0x05, 0xb0, 0x00, 0x06, 0x00, 0x19, 0x40, 0x16, 0x00, 0x01, 0x01, 0x02, 0x59,
-    0x00, 0x02, 0x02, 0x3c, 0x4b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x11, 0x11, 0x11, 0x03, 0x08, 0x17, 0x2b, 0x01,
-    0x01, 0x23, 0x01, 0x21, 0x37, 0x21, 0x04, 0x9c, 0xfc, 0xe9, 0xc6, 0x03, 0x12, 0xfd, 0x07, 0x1a, 0x03, 0xbc, 0x05,
-    0x3e, 0xfa, 0xc2, 0x05, 0x0e, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0xff, 0xea, 0x04, 0x68, 0x05, 0xc6,
-    0x00, 0x25, 0x00, 0x39, 0x00, 0x4d, 0x00, 0x35, 0x40, 0x32, 0x19, 0x05, 0x02, 0x02, 0x05, 0x01, 0x4a, 0x00, 0x05,
-    0x00, 0x02, 0x03, 0x05, 0x02, 0x63, 0x00, 0x04, 0x04, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x44, 0x4b, 0x00, 0x03, 0x03,
-    0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x4a, 0x48, 0x40, 0x3e, 0x36, 0x34, 0x2c, 0x2a, 0x22, 0x20, 0x2e,
-    0x06, 0x08, 0x15, 0x2b, 0x01, 0x0e, 0x03, 0x07, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x3e, 0x03,
-    0x37, 0x26, 0x26, 0x37, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x01, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x06,
-    0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x13, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x06, 0x1e, 0x02, 0x17,
-    0x16, 0x3e, 0x02, 0x04, 0x61, 0x05, 0x2d, 0x47, 0x5c, 0x34, 0x2e, 0x47, 0x2d, 0x13, 0x04, 0x08, 0x57, 0x88, 0xaf,
-    0x60, 0x59, 0x97, 0x6c, 0x37, 0x08, 0x06, 0x31, 0x50, 0x68, 0x3c, 0x4e, 0x4b, 0x07, 0x07, 0x4d, 0x7d, 0xa3, 0x5d,
-    0x55, 0x8d, 0x63, 0x31, 0xfe, 0xee, 0x06, 0x19, 0x39, 0x57, 0x39, 0x3f, 0x6e, 0x53, 0x34, 0x07, 0x06, 0x18, 0x39,
-    0x58, 0x39, 0x3e, 0x6d, 0x54, 0x36, 0x5a, 0x05, 0x15, 0x32, 0x4d, 0x33, 0x39, 0x60, 0x48, 0x2c, 0x06, 0x05, 0x14,
-    0x31, 0x4d, 0x33, 0x38, 0x61, 0x49, 0x2d, 0x04, 0x3d, 0x3d, 0x67, 0x54, 0x44, 0x19, 0x1b, 0x4a, 0x58, 0x64, 0x35,
-    0x63, 0x9f, 0x6d, 0x39, 0x02, 0x02, 0x39, 0x69, 0x94, 0x5d, 0x44, 0x71, 0x5c, 0x47, 0x1a, 0x36, 0xa4, 0x5e, 0x5e,
-    0x99, 0x6c, 0x38, 0x02, 0x02, 0x3a, 0x66, 0x8e, 0xfd, 0x02, 0x36, 0x61, 0x48, 0x2b, 0x02, 0x01, 0x2a, 0x4e, 0x6a,
-    0x3d, 0x38, 0x5e, 0x44, 0x27, 0x01, 0x02, 0x28, 0x49, 0x67, 0x02, 0xe2, 0x30, 0x57, 0x43, 0x28, 0x01, 0x01, 0x28,
-    0x47, 0x61, 0x36, 0x30, 0x57, 0x41, 0x27, 0x01, 0x01, 0x27, 0x47, 0x5f, 0x00, 0x02, 0x00, 0xc3, 0xff, 0xfe, 0x04,
-    0x3d, 0x05, 0xc6, 0x00, 0x23, 0x00, 0x3a, 0x00, 0x3f, 0x40, 0x3c, 0x05, 0x01, 0x01, 0x04, 0x01, 0x4a, 0x07, 0x01,
-    0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x63, 0x00, 0x05, 0x05, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x44, 0x4b, 0x06, 0x01,
-    0x00, 0x00, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x3d, 0x03, 0x4c, 0x25, 0x24, 0x01, 0x00, 0x32, 0x30, 0x24, 0x3a, 0x25,
-    0x3a, 0x22, 0x20, 0x13, 0x11, 0x09, 0x07, 0x00, 0x23, 0x01, 0x23, 0x08, 0x08, 0x14, 0x2b, 0x25, 0x16, 0x3e, 0x02,
-    0x37, 0x06, 0x06, 0x27, 0x2e, 0x03, 0x37, 0x3e, 0x03, 0x17, 0x1e, 0x05, 0x07, 0x07, 0x0e, 0x05, 0x23, 0x23, 0x37,
-    0x01, 0x16, 0x3e, 0x02, 0x37, 0x37, 0x36, 0x34, 0x2e, 0x03, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x06, 0x1e, 0x02, 0x01,
-    0x1e, 0x7b, 0xbb, 0x8c, 0x61, 0x20, 0x3f, 0xa1, 0x60, 0x62, 0x89, 0x54, 0x1f, 0x08, 0x0a, 0x4c, 0x80, 0xb1, 0x6e,
-    0x50, 0x79, 0x59, 0x39, 0x1e, 0x04, 0x08, 0x09, 0x10, 0x3b, 0x5b, 0x7e, 0xa6, 0xcf, 0x7e, 0x17, 0x10, 0x01, 0x38,
-    0x34, 0x5f, 0x50, 0x41, 0x17, 0x07, 0x03, 0x0d, 0x1d, 0x30, 0x47, 0x32, 0x48, 0x6f, 0x4e, 0x2e, 0x07, 0x06, 0x0d,
-    0x2d, 0x53, 0xa3, 0x01, 0x40, 0x79, 0xaf, 0x6f, 0x46, 0x4e, 0x02, 0x02, 0x55, 0x88, 0xa9, 0x56, 0x66, 0xbb, 0x8e,
-    0x52, 0x02, 0x01, 0x34, 0x56, 0x73, 0x81, 0x8b, 0x43, 0x43, 0x72, 0xd3, 0xb7, 0x95, 0x6a, 0x3b, 0xa5, 0x01, 0xdd,
-    0x02, 0x22, 0x3c, 0x4f, 0x2c, 0x3b, 0x25, 0x58, 0x5a, 0x55, 0x42, 0x29, 0x02, 0x02, 0x3d, 0x64, 0x7e, 0x3f, 0x35,
-    0x75, 0x62, 0x41, 0x00, 0x00, 0xff, 0xff, 0x01, 0xbf, 0xff, 0xec, 0x03, 0x72, 0x04, 0x75, 0x02, 0x26, 0x00, 0x10,
-    0x31, 0x00, 0x01, 0x07, 0x00, 0x10, 0x00, 0xc8, 0x03, 0x6c, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x03, 0x6c, 0xb0,
-    0x33, 0x2b, 0x00, 0xff, 0xff, 0x01, 0x42, 0xfe, 0xb0, 0x03, 0x69, 0x04, 0x75, 0x02, 0x27, 0x00, 0x10, 0x00, 0xbf,
-    0x03, 0x6c, 0x01, 0x07, 0x00, 0x0e, 0x00, 0x80, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x03, 0x6c, 0xb0,
-    0x33, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xa1, 0x00, 0xc9, 0x04, 0x34, 0x04, 0x50, 0x00, 0x08, 0x00, 0x06,
-    0xb3, 0x07, 0x04, 0x01, 0x30, 0x2b, 0x01, 0x07, 0x17, 0x05, 0x07, 0x01, 0x37, 0x01, 0x07, 0x01, 0xa0, 0x41, 0x26,
-    0x02, 0x33, 0x21, 0xfd, 0x0a, 0x1a, 0x03, 0x79, 0x1e, 0x02, 0x97, 0x14, 0x0f, 0xf0, 0xbb, 0x01, 0x7b, 0x92, 0x01,
-    0x7a, 0xc9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x7e, 0x01, 0x6d, 0x04, 0x46, 0x03, 0xad, 0x00, 0x03, 0x00, 0x07, 0x00,
-    0x22, 0x40, 0x1f, 0x00, 0x01, 0x00, 0x00, 0x03, 0x01, 0x00, 0x61, 0x00, 0x03, 0x02, 0x02, 0x03, 0x55, 0x00, 0x03,
-    0x03, 0x02, 0x59, 0x00, 0x02, 0x03, 0x02, 0x4d, 0x11, 0x11, 0x11, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x21, 0x37,
-    0x21, 0x03, 0x21, 0x37, 0x21, 0x04, 0x2a, 0xfc, 0x9c, 0x1d, 0x03, 0x63, 0x64, 0xfc, 0x9c, 0x1d, 0x03, 0x63, 0x03,
-    0x0c, 0xa1, 0xfd, 0xc0, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x65, 0x00, 0xc0, 0x04, 0x1b, 0x04, 0x48, 0x00,
-    0x08, 0x00, 0x06, 0xb3, 0x04, 0x01, 0x01, 0x30, 0x2b, 0x13, 0x37, 0x01, 0x07, 0x01, 0x37, 0x25, 0x37, 0x27, 0xe2,
-    0x20, 0x03, 0x19, 0x1a, 0xfc, 0x64, 0x24, 0x02, 0x93, 0x47, 0x2d, 0x03, 0x91, 0xb7, 0xfe, 0x85, 0x91, 0xfe, 0x84,
-    0xc9, 0xf0, 0x14, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x17, 0xff, 0xf3, 0x04, 0x58, 0x05, 0xc6, 0x00, 0x27,
-    0x00, 0x37, 0x00, 0x68, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x25, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x03, 0x70,
-    0x06, 0x01, 0x03, 0x04, 0x00, 0x03, 0x04, 0x6e, 0x00, 0x00, 0x00, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x44, 0x4b, 0x00,
-    0x04, 0x04, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x3d, 0x05, 0x4c, 0x1b, 0x40, 0x25, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01,
-    0x03, 0x70, 0x06, 0x01, 0x03, 0x04, 0x00, 0x03, 0x04, 0x6e, 0x00, 0x00, 0x00, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x44,
-    0x4b, 0x00, 0x04, 0x04, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x45, 0x05, 0x4c, 0x59, 0x40, 0x10, 0x00, 0x00, 0x34, 0x32,
-    0x2c, 0x2a, 0x00, 0x27, 0x00, 0x27, 0x24, 0x14, 0x2e, 0x07, 0x08, 0x17, 0x2b, 0x01, 0x3e, 0x03, 0x37, 0x3e, 0x03,
-    0x37, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x07, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07,
-    0x06, 0x06, 0x07, 0x01, 0x36, 0x36, 0x37, 0x36, 0x1e, 0x02, 0x15, 0x06, 0x06, 0x07, 0x06, 0x2e, 0x02, 0x01, 0xd6,
-    0x06, 0x1b, 0x2d, 0x44, 0x30, 0x27, 0x54, 0x49, 0x34, 0x08, 0x07, 0x15, 0x32, 0x4d, 0x31, 0x32, 0x5a, 0x48, 0x32,
-    0x0a, 0xb3, 0x0a, 0x52, 0x7d, 0x9e, 0x56, 0x54, 0x8d, 0x62, 0x31, 0x07, 0x07, 0x40, 0x5f, 0x71, 0x38, 0x3b, 0x35,
-    0x0b, 0xfe, 0xfd, 0x01, 0x3d, 0x32, 0x18, 0x2a, 0x1e, 0x10, 0x01, 0x40, 0x30, 0x18, 0x29, 0x1e, 0x10, 0x01, 0x99,
-    0x3f, 0x5f, 0x51, 0x48, 0x29, 0x21, 0x4a, 0x54, 0x5f, 0x36, 0x32, 0x4f, 0x37, 0x1f, 0x01, 0x01, 0x19, 0x32, 0x4c,
-    0x32, 0x01, 0x59, 0x88, 0x5b, 0x2e, 0x02, 0x02, 0x32, 0x5e, 0x88, 0x58, 0x4e, 0x82, 0x6f, 0x61, 0x2d, 0x31, 0x70,
-    0x4a, 0xfe, 0xc4, 0x31, 0x41, 0x02, 0x01, 0x10, 0x1e, 0x29, 0x18, 0x31, 0x3d, 0x02, 0x01, 0x0f, 0x1c, 0x28, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x43, 0xff, 0xf8, 0x04, 0x93, 0x05, 0xb4, 0x00, 0x5c, 0x00, 0x73, 0x00, 0xa3, 0x4b,
-    0xb0, 0x14, 0x50, 0x58, 0x40, 0x13, 0x1f, 0x01, 0x09, 0x02, 0x6a, 0x0a, 0x02, 0x03, 0x09, 0x44, 0x01, 0x05, 0x00,
-    0x45, 0x01, 0x06, 0x05, 0x04, 0x4a, 0x1b, 0x40, 0x16, 0x1f, 0x01, 0x09, 0x02, 0x6a, 0x01, 0x08, 0x09, 0x0a, 0x01,
-    0x03, 0x08, 0x44, 0x01, 0x05, 0x00, 0x45, 0x01, 0x06, 0x05, 0x05, 0x4a, 0x59, 0x4b, 0xb0, 0x14, 0x50, 0x58, 0x40,
-    0x27, 0x00, 0x02, 0x00, 0x09, 0x03, 0x02, 0x09, 0x63, 0x08, 0x01, 0x03, 0x01, 0x01, 0x00, 0x05, 0x03, 0x00, 0x63,
-    0x00, 0x04, 0x04, 0x07, 0x5b, 0x00, 0x07, 0x07, 0x3c, 0x4b, 0x00, 0x05, 0x05, 0x06, 0x5b, 0x00, 0x06, 0x06, 0x3d,
-    0x06, 0x4c, 0x1b, 0x40, 0x2c, 0x00, 0x02, 0x00, 0x09, 0x08, 0x02, 0x09, 0x63, 0x00, 0x08, 0x03, 0x00, 0x08, 0x57,
-    0x00, 0x03, 0x01, 0x01, 0x00, 0x05, 0x03, 0x00, 0x63, 0x00, 0x04, 0x04, 0x07, 0x5b, 0x00, 0x07, 0x07, 0x3c, 0x4b,
-    0x00, 0x05, 0x05, 0x06, 0x5b, 0x00, 0x06, 0x06, 0x3d, 0x06, 0x4c, 0x59, 0x40, 0x0e, 0x6e, 0x6c, 0x2c, 0x2c, 0x25,
-    0x2c, 0x2c, 0x26, 0x2c, 0x26, 0x26, 0x0a, 0x08, 0x1d, 0x2b, 0x01, 0x0e, 0x05, 0x27, 0x26, 0x26, 0x27, 0x0e, 0x03,
-    0x23, 0x22, 0x2e, 0x03, 0x36, 0x37, 0x3e, 0x05, 0x17, 0x16, 0x17, 0x03, 0x06, 0x06, 0x16, 0x16, 0x17, 0x16, 0x3e,
-    0x04, 0x37, 0x36, 0x36, 0x2e, 0x03, 0x27, 0x26, 0x0e, 0x04, 0x07, 0x06, 0x06, 0x1e, 0x03, 0x17, 0x32, 0x36, 0x37,
-    0x17, 0x06, 0x06, 0x27, 0x2e, 0x04, 0x36, 0x37, 0x3e, 0x05, 0x17, 0x1e, 0x04, 0x14, 0x05, 0x0e, 0x02, 0x1e, 0x02,
-    0x17, 0x16, 0x3e, 0x02, 0x37, 0x13, 0x26, 0x26, 0x27, 0x26, 0x0e, 0x04, 0x04, 0x88, 0x07, 0x16, 0x24, 0x33, 0x45,
-    0x59, 0x38, 0x3c, 0x47, 0x0b, 0x14, 0x2c, 0x32, 0x39, 0x21, 0x29, 0x36, 0x20, 0x0e, 0x03, 0x07, 0x04, 0x08, 0x1e,
-    0x2e, 0x40, 0x53, 0x67, 0x3f, 0x6d, 0x41, 0x76, 0x03, 0x05, 0x06, 0x17, 0x1a, 0x26, 0x39, 0x2b, 0x1e, 0x14, 0x0b,
-    0x04, 0x07, 0x04, 0x0f, 0x26, 0x44, 0x67, 0x49, 0x54, 0x8f, 0x75, 0x5d, 0x45, 0x2e, 0x0c, 0x0b, 0x08, 0x0e, 0x28,
-    0x4b, 0x71, 0x50, 0x3f, 0x76, 0x36, 0x16, 0x39, 0x86, 0x44, 0x62, 0x93, 0x67, 0x3e, 0x1c, 0x02, 0x0d, 0x0e, 0x39,
-    0x57, 0x74, 0x91, 0xab, 0x64, 0x59, 0x86, 0x5d, 0x39, 0x1a, 0xfd, 0x49, 0x02, 0x06, 0x03, 0x02, 0x0c, 0x18, 0x14,
-    0x1d, 0x31, 0x29, 0x23, 0x0e, 0x72, 0x0d, 0x18, 0x0e, 0x2f, 0x4a, 0x3a, 0x2b, 0x1e, 0x14, 0x03, 0x1b, 0x2b, 0x69,
-    0x6b, 0x64, 0x4d, 0x2e, 0x01, 0x02, 0x3f, 0x39, 0x18, 0x2c, 0x21, 0x14, 0x25, 0x3b, 0x4b, 0x4d, 0x48, 0x1b, 0x33,
-    0x72, 0x6e, 0x64, 0x4b, 0x2b, 0x02, 0x03, 0x58, 0xfe, 0x07, 0x12, 0x2c, 0x28, 0x1c, 0x01, 0x02, 0x27, 0x40, 0x52,
-    0x52, 0x4b, 0x19, 0x39, 0x7a, 0x76, 0x6b, 0x51, 0x32, 0x02, 0x02, 0x36, 0x61, 0x83, 0x91, 0x99, 0x46, 0x3f, 0x84,
-    0x7d, 0x6e, 0x54, 0x31, 0x01, 0x23, 0x1d, 0x77, 0x26, 0x23, 0x01, 0x01, 0x3a, 0x63, 0x86, 0x99, 0xa5, 0x52, 0x55,
-    0xb6, 0xad, 0x9b, 0x73, 0x41, 0x02, 0x02, 0x3b, 0x63, 0x82, 0x92, 0x9a, 0xca, 0x0c, 0x27, 0x2f, 0x2f, 0x27, 0x1a,
-    0x01, 0x02, 0x14, 0x23, 0x2b, 0x16, 0x01, 0xc2, 0x05, 0x07, 0x01, 0x03, 0x22, 0x3a, 0x4d, 0x54, 0x54, 0x00, 0x00,
-    0x00, 0x02, 0xff, 0xe2, 0x00, 0x00, 0x04, 0x02, 0x05, 0xb0, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x25, 0x40, 0x22, 0x0a,
-    0x01, 0x04, 0x02, 0x01, 0x4a, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x62, 0x00, 0x02, 0x02, 0x3c, 0x4b, 0x03,
-    0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x10, 0x05, 0x08, 0x19, 0x2b, 0x01, 0x21, 0x03, 0x23,
-    0x01, 0x33, 0x13, 0x23, 0x01, 0x21, 0x03, 0x03, 0x27, 0xfe, 0x2b, 0xb4, 0xbc, 0x02, 0xc5, 0x98, 0xc3, 0xad, 0xfe,
-    0x48, 0x01, 0x77, 0x4c, 0x01, 0x79, 0xfe, 0x87, 0x05, 0xb0, 0xfa, 0x50, 0x02, 0x1a, 0x02, 0x76, 0x00, 0x03, 0x00,
-    0x3e, 0x00, 0x00, 0x04, 0x72, 0x05, 0xb0, 0x00, 0x16, 0x00, 0x23, 0x00, 0x30, 0x00, 0x42, 0x40, 0x3f, 0x0c, 0x01,
-    0x03, 0x04, 0x11, 0x01, 0x02, 0x03, 0x02, 0x4a, 0x00, 0x04, 0x07, 0x01, 0x03, 0x02, 0x04, 0x03, 0x63, 0x00, 0x05,
-    0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x3c, 0x4b, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x06, 0x01, 0x01, 0x01, 0x3d, 0x01,
-    0x4c, 0x17, 0x17, 0x00, 0x00, 0x30, 0x2e, 0x26, 0x24, 0x17, 0x23, 0x17, 0x22, 0x1a, 0x18, 0x00, 0x16, 0x00, 0x15,
-    0x21, 0x08, 0x08, 0x15, 0x2b, 0x33, 0x13, 0x05, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x1e, 0x03, 0x07, 0x0e, 0x03,
-    0x23, 0x03, 0x03, 0x05, 0x3e, 0x03, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x25, 0x17, 0x3e, 0x03, 0x37, 0x36, 0x2e, 0x02,
-    0x27, 0x25, 0x3e, 0xfd, 0x01, 0x99, 0x54, 0x99, 0x73, 0x3e, 0x08, 0x05, 0x2f, 0x49, 0x5f, 0x34, 0x34, 0x4c, 0x32,
-    0x15, 0x04, 0x07, 0x5e, 0x91, 0xb8, 0x60, 0xa5, 0x5b, 0x01, 0x0a, 0x3d, 0x71, 0x5c, 0x3d, 0x08, 0x07, 0x19, 0x38,
-    0x55, 0x36, 0xfe, 0xf2, 0xf0, 0x37, 0x6c, 0x58, 0x3c, 0x07, 0x07, 0x1f, 0x3e, 0x57, 0x31, 0xff, 0x00, 0x05, 0xb0,
-    0x01, 0x03, 0x31, 0x5f, 0x8b, 0x5d, 0x3d, 0x61, 0x4c, 0x3b, 0x16, 0x14, 0x45, 0x57, 0x66, 0x36, 0x67, 0xa0, 0x6e,
-    0x38, 0x02, 0xa9, 0xfd, 0xf4, 0x02, 0x01, 0x26, 0x45, 0x64, 0x3f, 0x36, 0x5b, 0x43, 0x27, 0x03, 0x9b, 0x02, 0x01,
-    0x20, 0x3e, 0x5a, 0x3b, 0x36, 0x51, 0x36, 0x1d, 0x02, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x64, 0xff, 0xe9, 0x04,
-    0x85, 0x05, 0xc6, 0x00, 0x33, 0x00, 0x36, 0x40, 0x33, 0x00, 0x02, 0x03, 0x05, 0x03, 0x02, 0x05, 0x70, 0x06, 0x01,
-    0x05, 0x04, 0x03, 0x05, 0x04, 0x6e, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x44, 0x4b, 0x00, 0x04, 0x04,
-    0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x33, 0x00, 0x33, 0x2d, 0x24, 0x14, 0x2d, 0x24,
-    0x07, 0x08, 0x19, 0x2b, 0x01, 0x0e, 0x03, 0x27, 0x2e, 0x05, 0x37, 0x37, 0x3e, 0x05, 0x17, 0x1e, 0x03, 0x17, 0x23,
-    0x2e, 0x03, 0x27, 0x26, 0x0e, 0x04, 0x07, 0x07, 0x06, 0x06, 0x1e, 0x03, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x04, 0x16,
-    0x14, 0x5c, 0x89, 0xb1, 0x69, 0x56, 0x85, 0x61, 0x3e, 0x21, 0x04, 0x0a, 0x20, 0x0d, 0x31, 0x49, 0x62, 0x7d, 0x98,
-    0x5b, 0x67, 0x98, 0x66, 0x35, 0x04, 0xb3, 0x03, 0x1a, 0x39, 0x5b, 0x44, 0x42, 0x6b, 0x55, 0x3f, 0x2f, 0x1f, 0x09,
-    0x22, 0x07, 0x06, 0x0a, 0x1d, 0x38, 0x58, 0x3f, 0x48, 0x71, 0x56, 0x3b, 0x12, 0x01, 0xb8, 0x63, 0xab, 0x7c, 0x45,
-    0x03, 0x02, 0x39, 0x5f, 0x7e, 0x8e, 0x97, 0x49, 0xcb, 0x4f, 0x9e, 0x91, 0x7d, 0x5b, 0x33, 0x02, 0x02, 0x4b, 0x7e,
-    0xa8, 0x60, 0x3c, 0x70, 0x58, 0x37, 0x02, 0x02, 0x2a, 0x49, 0x64, 0x6f, 0x75, 0x36, 0xce, 0x2f, 0x6d, 0x6c, 0x65,
-    0x4f, 0x31, 0x02, 0x03, 0x30, 0x54, 0x72, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2e, 0x00, 0x00, 0x04, 0x7d,
-    0x05, 0xb0, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x2c, 0x40, 0x29, 0x05, 0x01, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00,
-    0x3c, 0x4b, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x04, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x0e, 0x0e, 0x00, 0x00, 0x0e,
-    0x1b, 0x0e, 0x1a, 0x11, 0x0f, 0x00, 0x0d, 0x00, 0x0c, 0x21, 0x06, 0x08, 0x15, 0x2b, 0x33, 0x13, 0x05, 0x1e, 0x03,
-    0x07, 0x07, 0x0e, 0x03, 0x23, 0x13, 0x03, 0x17, 0x3e, 0x03, 0x37, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x2e, 0xfc, 0x01,
-    0x3c, 0x90, 0xd3, 0x83, 0x31, 0x11, 0x0f, 0x16, 0x79, 0xbc, 0xfa, 0x97, 0x47, 0xc8, 0x85, 0x75, 0xba, 0x8a, 0x58,
-    0x12, 0x10, 0x0d, 0x15, 0x50, 0x8f, 0x6e, 0x05, 0xb0, 0x01, 0x03, 0x6f, 0xb7, 0xf2, 0x87, 0x6b, 0x90, 0xf6, 0xb5,
-    0x67, 0x05, 0x18, 0xfb, 0x7f, 0x01, 0x01, 0x52, 0x8d, 0xbf, 0x6d, 0x6e, 0x60, 0xb7, 0x91, 0x5b, 0x04, 0x00, 0x00,
-    0x01, 0x00, 0x48, 0x00, 0x00, 0x04, 0xa1, 0x05, 0xb0, 0x00, 0x0b, 0x00, 0x29, 0x40, 0x26, 0x00, 0x05, 0x00, 0x00,
-    0x01, 0x05, 0x00, 0x61, 0x00, 0x04, 0x04, 0x03, 0x59, 0x00, 0x03, 0x03, 0x3c, 0x4b, 0x00, 0x01, 0x01, 0x02, 0x59,
-    0x00, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x01, 0x21, 0x03,
-    0x21, 0x07, 0x21, 0x13, 0x21, 0x07, 0x21, 0x03, 0x21, 0x03, 0xbf, 0xfd, 0xb3, 0x5a, 0x02, 0xb0, 0x1c, 0xfc, 0x9c,
-    0xfd, 0x03, 0x5c, 0x1c, 0xfd, 0x59, 0x51, 0x02, 0x4e, 0x02, 0xa1, 0xfd, 0xfc, 0x9d, 0x05, 0xb0, 0x9e, 0xfe, 0x2c,
-    0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x04, 0xb2, 0x05, 0xb0, 0x00, 0x09, 0x00, 0x23, 0x40, 0x20, 0x00, 0x04, 0x00,
-    0x00, 0x01, 0x04, 0x00, 0x61, 0x00, 0x03, 0x03, 0x02, 0x59, 0x00, 0x02, 0x02, 0x3c, 0x4b, 0x00, 0x01, 0x01, 0x3d,
-    0x01, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x10, 0x05, 0x08, 0x19, 0x2b, 0x01, 0x21, 0x03, 0x23, 0x13, 0x21, 0x07, 0x21,
-    0x03, 0x21, 0x03, 0xc3, 0xfd, 0xb4, 0x70, 0xb6, 0xfc, 0x03, 0x65, 0x1c, 0xfd, 0x53, 0x57, 0x02, 0x4c, 0x02, 0x83,
-    0xfd, 0x7d, 0x05, 0xb0, 0x9e, 0xfe, 0x0e, 0x00, 0x00, 0x01, 0x00, 0x60, 0xff, 0xe8, 0x04, 0x85, 0x05, 0xc6, 0x00,
-    0x33, 0x00, 0x32, 0x40, 0x2f, 0x00, 0x02, 0x03, 0x06, 0x03, 0x02, 0x06, 0x70, 0x00, 0x06, 0x00, 0x05, 0x04, 0x06,
-    0x05, 0x61, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x44, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x00, 0x00,
-    0x00, 0x45, 0x00, 0x4c, 0x11, 0x13, 0x2d, 0x24, 0x14, 0x2d, 0x22, 0x07, 0x08, 0x1b, 0x2b, 0x25, 0x06, 0x06, 0x27,
-    0x2e, 0x05, 0x37, 0x37, 0x3e, 0x05, 0x17, 0x1e, 0x03, 0x17, 0x23, 0x2e, 0x03, 0x27, 0x26, 0x0e, 0x04, 0x07, 0x07,
-    0x06, 0x06, 0x1e, 0x03, 0x17, 0x16, 0x36, 0x37, 0x13, 0x21, 0x37, 0x21, 0x03, 0xfc, 0x5f, 0xfb, 0x8f, 0x56, 0x88,
-    0x65, 0x44, 0x25, 0x07, 0x0a, 0x1a, 0x0d, 0x32, 0x4b, 0x64, 0x7f, 0x9a, 0x5c, 0x62, 0x99, 0x69, 0x38, 0x02, 0xb1,
-    0x04, 0x1e, 0x3a, 0x5b, 0x40, 0x43, 0x6c, 0x56, 0x43, 0x30, 0x21, 0x09, 0x1c, 0x07, 0x02, 0x0f, 0x23, 0x3d, 0x59,
-    0x3f, 0x55, 0x9f, 0x3d, 0x39, 0xfe, 0xe1, 0x1b, 0x01, 0xcb, 0xbf, 0x68, 0x6f, 0x05, 0x03, 0x3b, 0x61, 0x81, 0x91,
-    0x9b, 0x4a, 0xa9, 0x4f, 0xa1, 0x95, 0x81, 0x5f, 0x35, 0x02, 0x02, 0x46, 0x78, 0xa2, 0x5e, 0x39, 0x68, 0x50, 0x2f,
-    0x02, 0x02, 0x2b, 0x4b, 0x66, 0x71, 0x76, 0x37, 0xac, 0x31, 0x6f, 0x6d, 0x65, 0x4f, 0x33, 0x03, 0x05, 0x2d, 0x3f,
-    0x01, 0x47, 0x9c, 0x00, 0x01, 0x00, 0x20, 0x00, 0x00, 0x04, 0xb4, 0x05, 0xb0, 0x00, 0x0b, 0x00, 0x21, 0x40, 0x1e,
-    0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x62, 0x05, 0x01, 0x03, 0x03, 0x3c, 0x4b, 0x02, 0x01, 0x00, 0x00, 0x3d,
-    0x00, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x21, 0x23, 0x13, 0x21, 0x03, 0x23, 0x13,
-    0x33, 0x03, 0x21, 0x13, 0x33, 0x03, 0xb7, 0xab, 0x75, 0xfd, 0xbe, 0x75, 0xaa, 0xfd, 0xaa, 0x6d, 0x02, 0x42, 0x6d,
-    0xab, 0x02, 0xa1, 0xfd, 0x5f, 0x05, 0xb0, 0xfd, 0x8e, 0x02, 0x72, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x04, 0x94,
-    0x05, 0xb0, 0x00, 0x0b, 0x00, 0x23, 0x40, 0x20, 0x05, 0x01, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x00, 0x3c, 0x4b,
-    0x04, 0x01, 0x02, 0x02, 0x03, 0x59, 0x00, 0x03, 0x03, 0x3d, 0x03, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06,
-    0x08, 0x1a, 0x2b, 0x01, 0x21, 0x07, 0x21, 0x03, 0x21, 0x07, 0x21, 0x37, 0x21, 0x13, 0x21, 0x01, 0x3d, 0x03, 0x57,
-    0x1d, 0xfe, 0xae, 0xc5, 0x01, 0x53, 0x1c, 0xfc, 0xa9, 0x1c, 0x01, 0x4b, 0xc5, 0xfe, 0xb4, 0x05, 0xb0, 0xa1, 0xfb,
-    0x91, 0xa0, 0xa0, 0x04, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3f, 0xff, 0xea, 0x04, 0x8c, 0x05, 0xb0, 0x00,
-    0x17, 0x00, 0x22, 0x40, 0x1f, 0x00, 0x02, 0x00, 0x03, 0x00, 0x02, 0x03, 0x70, 0x00, 0x00, 0x00, 0x3c, 0x4b, 0x00,
-    0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x45, 0x01, 0x4c, 0x24, 0x14, 0x25, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x01,
-    0x33, 0x03, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x27, 0x17, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x03, 0xd3,
-    0xb9, 0xad, 0x0f, 0x5c, 0x8b, 0xb4, 0x66, 0x61, 0x94, 0x65, 0x35, 0x01, 0xb6, 0x02, 0x1a, 0x38, 0x58, 0x3e, 0x42,
-    0x6f, 0x56, 0x39, 0x0b, 0x05, 0xb0, 0xfc, 0x0b, 0x63, 0xaa, 0x7e, 0x46, 0x02, 0x02, 0x45, 0x77, 0xa0, 0x5c, 0x01,
-    0x38, 0x65, 0x4e, 0x30, 0x01, 0x02, 0x31, 0x55, 0x70, 0x3e, 0x00, 0x01, 0x00, 0x3e, 0x00, 0x00, 0x04, 0xfc, 0x05,
-    0xb0, 0x00, 0x0c, 0x00, 0x1e, 0x40, 0x1b, 0x0a, 0x06, 0x02, 0x00, 0x01, 0x01, 0x4a, 0x02, 0x01, 0x01, 0x01, 0x3c,
-    0x4b, 0x03, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x12, 0x13, 0x11, 0x12, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x07, 0x03,
-    0x23, 0x13, 0x33, 0x03, 0x37, 0x01, 0x33, 0x01, 0x01, 0x23, 0x02, 0x10, 0xc5, 0x54, 0xb9, 0xfd, 0xb9, 0x7b, 0x9e,
-    0x01, 0xfb, 0xea, 0xfd, 0x9a, 0x01, 0x7d, 0xcf, 0x02, 0xa2, 0xbf, 0xfe, 0x1d, 0x05, 0xb0, 0xfd, 0x44, 0xa5, 0x02,
-    0x17, 0xfd, 0x7a, 0xfc, 0xd6, 0x00, 0x00, 0x00, 0x01, 0x00, 0x58, 0x00, 0x00, 0x03, 0xdb, 0x05, 0xb0, 0x00, 0x05,
-    0x00, 0x19, 0x40, 0x16, 0x00, 0x02, 0x02, 0x3c, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x5a, 0x00, 0x01, 0x01, 0x3d, 0x01,
-    0x4c, 0x11, 0x11, 0x10, 0x03, 0x08, 0x17, 0x2b, 0x25, 0x21, 0x07, 0x21, 0x13, 0x33, 0x01, 0x28, 0x02, 0xb3, 0x1c,
-    0xfc, 0x99, 0xfc, 0xb5, 0x9d, 0x9d, 0x05, 0xb0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x27, 0x00, 0x00, 0x04, 0xc0, 0x05,
-    0xb0, 0x00, 0x0e, 0x00, 0x2e, 0x40, 0x2b, 0x0a, 0x07, 0x01, 0x03, 0x02, 0x00, 0x01, 0x4a, 0x00, 0x02, 0x00, 0x01,
-    0x00, 0x02, 0x01, 0x70, 0x05, 0x04, 0x02, 0x00, 0x00, 0x3c, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x00,
-    0x00, 0x00, 0x0e, 0x00, 0x0e, 0x13, 0x13, 0x11, 0x12, 0x06, 0x08, 0x18, 0x2b, 0x01, 0x13, 0x01, 0x33, 0x03, 0x23,
-    0x13, 0x13, 0x01, 0x23, 0x0b, 0x02, 0x23, 0x13, 0x01, 0xff, 0x67, 0x01, 0x76, 0xe4, 0xfc, 0xb0, 0x66, 0x74, 0xfe,
-    0x7b, 0x69, 0x6b, 0x5b, 0x63, 0xb0, 0xfd, 0x05, 0xb0, 0xfd, 0x2a, 0x02, 0xd6, 0xfa, 0x50, 0x02, 0x4e, 0x02, 0x46,
-    0xfd, 0x01, 0x03, 0x04, 0xfd, 0xa3, 0xfd, 0xc4, 0x05, 0xb0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x22, 0x00, 0x00, 0x04,
-    0xb3, 0x05, 0xb0, 0x00, 0x09, 0x00, 0x1e, 0x40, 0x1b, 0x07, 0x02, 0x02, 0x00, 0x02, 0x01, 0x4a, 0x03, 0x01, 0x02,
-    0x02, 0x3c, 0x4b, 0x01, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x12, 0x11, 0x12, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x21,
-    0x23, 0x01, 0x03, 0x23, 0x13, 0x33, 0x01, 0x13, 0x33, 0x03, 0xb6, 0xb2, 0xfe, 0x96, 0xc1, 0xb7, 0xfd, 0xb2, 0x01,
-    0x6a, 0xc1, 0xb7, 0x04, 0x48, 0xfb, 0xb8, 0x05, 0xb0, 0xfb, 0xba, 0x04, 0x46, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x66, 0xff, 0xea, 0x04, 0x6d, 0x05, 0xc6, 0x00, 0x1d, 0x00, 0x3b, 0x00, 0x1f, 0x40, 0x1c, 0x00, 0x02, 0x02, 0x01,
-    0x5b, 0x00, 0x01, 0x01, 0x44, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x2d, 0x2d,
-    0x2d, 0x26, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x0e, 0x05, 0x27, 0x2e, 0x05, 0x37, 0x37, 0x3e, 0x05, 0x17, 0x1e, 0x05,
-    0x07, 0x27, 0x36, 0x36, 0x2e, 0x03, 0x27, 0x26, 0x0e, 0x04, 0x07, 0x07, 0x06, 0x06, 0x1e, 0x03, 0x17, 0x16, 0x3e,
-    0x04, 0x37, 0x04, 0x49, 0x0d, 0x2f, 0x47, 0x60, 0x7b, 0x97, 0x5a, 0x56, 0x83, 0x5e, 0x3c, 0x1e, 0x03, 0x0a, 0x1a,
-    0x0d, 0x2f, 0x47, 0x61, 0x7b, 0x97, 0x5a, 0x57, 0x83, 0x5e, 0x3b, 0x1d, 0x03, 0x0a, 0xb3, 0x06, 0x07, 0x09, 0x1c,
-    0x37, 0x55, 0x3e, 0x41, 0x69, 0x53, 0x3f, 0x2e, 0x1e, 0x09, 0x1c, 0x06, 0x06, 0x0a, 0x1c, 0x38, 0x55, 0x3e, 0x41,
-    0x6a, 0x52, 0x3e, 0x2d, 0x1e, 0x09, 0x02, 0x85, 0x4d, 0x9f, 0x95, 0x84, 0x60, 0x36, 0x02, 0x02, 0x3d, 0x64, 0x84,
-    0x92, 0x98, 0x47, 0xa6, 0x4d, 0x9f, 0x95, 0x84, 0x61, 0x36, 0x02, 0x02, 0x3d, 0x64, 0x84, 0x93, 0x99, 0x47, 0x04,
-    0x2e, 0x6c, 0x6d, 0x67, 0x50, 0x32, 0x02, 0x02, 0x2b, 0x4d, 0x65, 0x71, 0x74, 0x34, 0xa9, 0x2d, 0x6c, 0x6e, 0x68,
-    0x51, 0x33, 0x02, 0x02, 0x2b, 0x4d, 0x66, 0x71, 0x74, 0x35, 0x00, 0x00, 0x02, 0x00, 0x51, 0x00, 0x00, 0x04, 0xa7,
-    0x05, 0xb0, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x2b, 0x40, 0x28, 0x00, 0x03, 0x05, 0x01, 0x02, 0x00, 0x03, 0x02, 0x63,
-    0x00, 0x04, 0x04, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x3c, 0x4b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x00, 0x00, 0x1b,
-    0x19, 0x11, 0x0f, 0x00, 0x0e, 0x00, 0x0d, 0x21, 0x11, 0x06, 0x08, 0x16, 0x2b, 0x01, 0x03, 0x23, 0x13, 0x05, 0x1e,
-    0x03, 0x07, 0x0e, 0x03, 0x23, 0x25, 0x05, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x25, 0x01, 0x6b, 0x66,
-    0xb4, 0xfc, 0x01, 0xbf, 0x5c, 0x9b, 0x6d, 0x37, 0x08, 0x09, 0x5c, 0x91, 0xb9, 0x64, 0xfe, 0xf9, 0x01, 0x0c, 0x42,
-    0x76, 0x5d, 0x3d, 0x08, 0x07, 0x19, 0x3b, 0x5b, 0x3b, 0xfe, 0xe0, 0x02, 0x48, 0xfd, 0xb8, 0x05, 0xb0, 0x01, 0x03,
-    0x3f, 0x70, 0x9b, 0x5f, 0x69, 0xa5, 0x72, 0x3c, 0x99, 0x02, 0x29, 0x4b, 0x6c, 0x43, 0x39, 0x63, 0x4a, 0x2d, 0x03,
-    0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5d, 0xff, 0x0a, 0x04, 0x77, 0x05, 0xc6, 0x00, 0x21, 0x00, 0x3f, 0x00, 0x2a,
-    0x40, 0x27, 0x05, 0x01, 0x00, 0x03, 0x01, 0x4a, 0x07, 0x06, 0x02, 0x00, 0x47, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x00,
-    0x01, 0x01, 0x44, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x2d, 0x2d, 0x2d, 0x2a,
-    0x04, 0x08, 0x18, 0x2b, 0x01, 0x0e, 0x03, 0x07, 0x17, 0x07, 0x27, 0x06, 0x06, 0x27, 0x2e, 0x05, 0x37, 0x37, 0x3e,
-    0x05, 0x17, 0x1e, 0x05, 0x07, 0x27, 0x36, 0x36, 0x2e, 0x03, 0x27, 0x26, 0x0e, 0x04, 0x07, 0x07, 0x06, 0x06, 0x1e,
-    0x03, 0x17, 0x16, 0x3e, 0x04, 0x37, 0x04, 0x59, 0x0e, 0x32, 0x4d, 0x6a, 0x46, 0xcf, 0x87, 0xeb, 0x20, 0x41, 0x21,
-    0x59, 0x86, 0x5f, 0x3c, 0x1e, 0x02, 0x0a, 0x14, 0x0d, 0x31, 0x49, 0x63, 0x7f, 0x9b, 0x5d, 0x59, 0x87, 0x60, 0x3c,
-    0x1d, 0x02, 0x0a, 0xb4, 0x07, 0x07, 0x08, 0x1c, 0x38, 0x5a, 0x41, 0x44, 0x6d, 0x57, 0x41, 0x2f, 0x1f, 0x09, 0x15,
-    0x07, 0x07, 0x09, 0x1c, 0x39, 0x59, 0x41, 0x45, 0x6e, 0x56, 0x40, 0x2e, 0x1f, 0x09, 0x02, 0x98, 0x54, 0xa5, 0x96,
-    0x84, 0x34, 0xd6, 0x71, 0xf3, 0x08, 0x08, 0x01, 0x02, 0x3e, 0x67, 0x88, 0x96, 0x9c, 0x48, 0x80, 0x4f, 0xa4, 0x99,
-    0x88, 0x63, 0x38, 0x02, 0x02, 0x3f, 0x67, 0x88, 0x97, 0x9d, 0x49, 0x03, 0x30, 0x70, 0x72, 0x6b, 0x53, 0x34, 0x02,
-    0x02, 0x2d, 0x4f, 0x69, 0x75, 0x78, 0x37, 0x83, 0x2f, 0x71, 0x72, 0x6b, 0x54, 0x35, 0x02, 0x02, 0x2c, 0x4f, 0x6a,
-    0x75, 0x79, 0x38, 0x00, 0x02, 0x00, 0x47, 0x00, 0x00, 0x04, 0x7f, 0x05, 0xb0, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x2b,
-    0x40, 0x28, 0x0f, 0x01, 0x00, 0x04, 0x01, 0x4a, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x61, 0x00, 0x05, 0x05,
-    0x02, 0x5b, 0x00, 0x02, 0x02, 0x3c, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x28, 0x21, 0x2a, 0x21, 0x11,
-    0x10, 0x06, 0x08, 0x1a, 0x2b, 0x01, 0x21, 0x03, 0x23, 0x13, 0x05, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x13, 0x07,
-    0x23, 0x01, 0x17, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x02, 0x80, 0xfe, 0xe2, 0x67, 0xb4, 0xfd,
-    0x01, 0x93, 0x5f, 0xa0, 0x70, 0x39, 0x08, 0x06, 0x38, 0x59, 0x73, 0x42, 0xc3, 0x02, 0xbf, 0xfe, 0x4f, 0xe6, 0x40,
-    0x78, 0x5f, 0x40, 0x08, 0x07, 0x1b, 0x3f, 0x5f, 0x3c, 0xf6, 0x02, 0x52, 0xfd, 0xae, 0x05, 0xb0, 0x01, 0x03, 0x3c,
-    0x6d, 0x9d, 0x63, 0x4b, 0x7a, 0x62, 0x4a, 0x1b, 0xfd, 0x96, 0x0d, 0x02, 0xea, 0x02, 0x27, 0x49, 0x6a, 0x43, 0x3d,
-    0x63, 0x47, 0x28, 0x03, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x53, 0xff, 0xea, 0x04, 0x8d, 0x05, 0xc6, 0x00, 0x3d,
-    0x00, 0x39, 0x40, 0x36, 0x29, 0x01, 0x05, 0x04, 0x01, 0x4a, 0x00, 0x01, 0x02, 0x04, 0x02, 0x01, 0x04, 0x70, 0x00,
-    0x04, 0x05, 0x02, 0x04, 0x05, 0x6e, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x44, 0x4b, 0x00, 0x05, 0x05,
-    0x03, 0x5b, 0x00, 0x03, 0x03, 0x45, 0x03, 0x4c, 0x3a, 0x38, 0x34, 0x33, 0x2f, 0x2d, 0x24, 0x14, 0x2e, 0x06, 0x08,
-    0x17, 0x2b, 0x01, 0x36, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x37, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x23, 0x2e, 0x03,
-    0x27, 0x26, 0x0e, 0x02, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x33,
-    0x1e, 0x03, 0x17, 0x16, 0x3e, 0x02, 0x03, 0x67, 0x07, 0x2c, 0x4d, 0x63, 0x2f, 0x47, 0x8c, 0x6d, 0x40, 0x05, 0x06,
-    0x5c, 0x8f, 0xb0, 0x59, 0x5e, 0x9e, 0x71, 0x3e, 0x03, 0xb8, 0x03, 0x1f, 0x3d, 0x5b, 0x3f, 0x36, 0x6a, 0x56, 0x39,
-    0x06, 0x06, 0x2d, 0x4d, 0x5f, 0x2d, 0x4a, 0x8f, 0x6e, 0x3f, 0x06, 0x07, 0x60, 0x92, 0xb4, 0x5a, 0x60, 0xa7, 0x7d,
-    0x46, 0x02, 0xb7, 0x03, 0x29, 0x47, 0x65, 0x40, 0x38, 0x6e, 0x5a, 0x3c, 0x01, 0x78, 0x3d, 0x57, 0x3f, 0x2c, 0x12,
-    0x1b, 0x4a, 0x65, 0x85, 0x57, 0x5f, 0x98, 0x6a, 0x36, 0x02, 0x02, 0x44, 0x75, 0x9f, 0x5e, 0x3a, 0x65, 0x4c, 0x2d,
-    0x02, 0x01, 0x21, 0x3f, 0x5b, 0x3a, 0x3a, 0x52, 0x3b, 0x2a, 0x10, 0x1b, 0x4d, 0x6a, 0x8b, 0x5a, 0x62, 0x97, 0x65,
-    0x32, 0x02, 0x01, 0x41, 0x73, 0xa2, 0x62, 0x3f, 0x67, 0x4a, 0x2b, 0x01, 0x01, 0x1d, 0x3c, 0x5b, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0xc2, 0x00, 0x00, 0x04, 0xf7, 0x05, 0xb0, 0x00, 0x07, 0x00, 0x1b, 0x40, 0x18, 0x02, 0x01, 0x00,
-    0x00, 0x03, 0x59, 0x00, 0x03, 0x03, 0x3c, 0x4b, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x10, 0x04,
-    0x08, 0x18, 0x2b, 0x01, 0x21, 0x03, 0x23, 0x13, 0x21, 0x37, 0x21, 0x04, 0xdb, 0xfe, 0x4c, 0xe1, 0xb0, 0xe1, 0xfe,
-    0x4b, 0x1c, 0x04, 0x19, 0x05, 0x12, 0xfa, 0xee, 0x05, 0x12, 0x9e, 0x00, 0x01, 0x00, 0x68, 0xff, 0xea, 0x04, 0xb5,
-    0x05, 0xb0, 0x00, 0x19, 0x00, 0x21, 0x40, 0x1e, 0x04, 0x03, 0x02, 0x01, 0x01, 0x3c, 0x4b, 0x00, 0x02, 0x02, 0x00,
-    0x5c, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x19, 0x25, 0x15, 0x25, 0x05, 0x08, 0x17,
-    0x2b, 0x01, 0x03, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x13, 0x33, 0x03, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02,
-    0x37, 0x13, 0x04, 0xb5, 0xa7, 0x0f, 0x5c, 0x8c, 0xb6, 0x6a, 0x64, 0x9a, 0x65, 0x2c, 0x0b, 0xaa, 0xac, 0xa5, 0x07,
-    0x12, 0x36, 0x5b, 0x43, 0x47, 0x75, 0x57, 0x38, 0x0c, 0xac, 0x05, 0xb0, 0xfc, 0x27, 0x64, 0xb4, 0x87, 0x4e, 0x02,
-    0x02, 0x53, 0x87, 0xaf, 0x5e, 0x03, 0xdb, 0xfc, 0x25, 0x3b, 0x74, 0x5e, 0x3d, 0x02, 0x02, 0x37, 0x5e, 0x7a, 0x40,
-    0x03, 0xda, 0x00, 0x01, 0x00, 0xcd, 0x00, 0x00, 0x04, 0xe6, 0x05, 0xb0, 0x00, 0x06, 0x00, 0x15, 0x40, 0x12, 0x02,
-    0x01, 0x00, 0x00, 0x3c, 0x4b, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x03, 0x08, 0x17, 0x2b, 0x01,
-    0x01, 0x33, 0x01, 0x23, 0x03, 0x33, 0x02, 0x1e, 0x02, 0x02, 0xc6, 0xfd, 0x5f, 0x9d, 0xdb, 0xbc, 0x01, 0x2c, 0x04,
-    0x84, 0xfa, 0x50, 0x05, 0xb0, 0x00, 0x01, 0x00, 0x95, 0x00, 0x00, 0x05, 0x03, 0x05, 0xb0, 0x00, 0x0c, 0x00, 0x21,
-    0x40, 0x1e, 0x0a, 0x05, 0x00, 0x03, 0x01, 0x00, 0x01, 0x4a, 0x04, 0x03, 0x02, 0x00, 0x00, 0x3c, 0x4b, 0x02, 0x01,
-    0x01, 0x01, 0x3d, 0x01, 0x4c, 0x12, 0x11, 0x12, 0x11, 0x11, 0x05, 0x08, 0x19, 0x2b, 0x01, 0x01, 0x33, 0x01, 0x23,
-    0x03, 0x01, 0x23, 0x13, 0x33, 0x03, 0x01, 0x33, 0x03, 0x43, 0x01, 0x12, 0xae, 0xfe, 0x70, 0xb8, 0x09, 0xfe, 0x9e,
-    0xbb, 0x38, 0xaa, 0x3a, 0x01, 0x59, 0x9e, 0x01, 0x8c, 0x04, 0x24, 0xfa, 0x50, 0x04, 0x45, 0xfb, 0xbb, 0x05, 0xb0,
-    0xfb, 0xe1, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf1, 0x00, 0x00, 0x04, 0xee, 0x05, 0xb0, 0x00, 0x0b, 0x00,
-    0x1f, 0x40, 0x1c, 0x09, 0x06, 0x03, 0x03, 0x01, 0x00, 0x01, 0x4a, 0x03, 0x01, 0x00, 0x00, 0x3c, 0x4b, 0x02, 0x01,
-    0x01, 0x01, 0x3d, 0x01, 0x4c, 0x12, 0x12, 0x12, 0x11, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x01, 0x33, 0x01, 0x01, 0x23,
-    0x03, 0x01, 0x23, 0x01, 0x01, 0x33, 0x02, 0x86, 0x01, 0x89, 0xdf, 0xfd, 0xee, 0x01, 0x2e, 0xc9, 0xdc, 0xfe, 0x6c,
-    0xe0, 0x02, 0x1f, 0xfe, 0xda, 0xc9, 0x03, 0x76, 0x02, 0x3a, 0xfd, 0x25, 0xfd, 0x2b, 0x02, 0x45, 0xfd, 0xbb, 0x02,
-    0xe7, 0x02, 0xc9, 0x00, 0x01, 0x00, 0xd4, 0x00, 0x00, 0x04, 0xf1, 0x05, 0xb0, 0x00, 0x08, 0x00, 0x1b, 0x40, 0x18,
-    0x06, 0x01, 0x01, 0x00, 0x01, 0x4a, 0x02, 0x01, 0x00, 0x00, 0x3c, 0x4b, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x12,
-    0x12, 0x11, 0x03, 0x08, 0x17, 0x2b, 0x01, 0x01, 0x33, 0x01, 0x03, 0x23, 0x13, 0x01, 0x33, 0x02, 0x5a, 0x01, 0xc0,
-    0xd7, 0xfd, 0xa3, 0x5f, 0xa8, 0x5e, 0xfe, 0xe9, 0xc4, 0x02, 0xd6, 0x02, 0xda, 0xfc, 0x64, 0xfd, 0xec, 0x02, 0x2a,
-    0x03, 0x86, 0x00, 0x00, 0x01, 0x00, 0x13, 0x00, 0x00, 0x04, 0x81, 0x05, 0xb0, 0x00, 0x09, 0x00, 0x1f, 0x40, 0x1c,
-    0x00, 0x02, 0x02, 0x03, 0x59, 0x00, 0x03, 0x03, 0x3c, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x3d,
-    0x01, 0x4c, 0x11, 0x12, 0x11, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x37, 0x21, 0x07, 0x21, 0x37, 0x01, 0x21, 0x37, 0x21,
-    0x07, 0xfc, 0x02, 0xd7, 0x19, 0xfc, 0x59, 0x15, 0x03, 0x6d, 0xfd, 0x52, 0x1a, 0x03, 0x80, 0x15, 0x9d, 0x9d, 0x99,
-    0x04, 0x79, 0x9e, 0x96, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x0e, 0xfe, 0xc8, 0x03, 0xc5, 0x06, 0x80, 0x00, 0x07,
-    0x00, 0x22, 0x40, 0x1f, 0x00, 0x03, 0x00, 0x00, 0x01, 0x03, 0x00, 0x61, 0x00, 0x01, 0x02, 0x02, 0x01, 0x55, 0x00,
-    0x01, 0x01, 0x02, 0x59, 0x00, 0x02, 0x01, 0x02, 0x4d, 0x11, 0x11, 0x11, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x23,
-    0x01, 0x33, 0x07, 0x21, 0x01, 0x21, 0x03, 0xac, 0xd6, 0xfe, 0xfb, 0xd7, 0x18, 0xfe, 0x7e, 0x01, 0x35, 0x01, 0x82,
-    0x05, 0xe8, 0xf9, 0x78, 0x98, 0x07, 0xb8, 0x00, 0x01, 0x01, 0x78, 0xff, 0x83, 0x03, 0x4f, 0x05, 0xb0, 0x00, 0x03,
-    0x00, 0x13, 0x40, 0x10, 0x00, 0x01, 0x00, 0x01, 0x73, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x4c, 0x11, 0x10, 0x02, 0x08,
-    0x16, 0x2b, 0x01, 0x33, 0x01, 0x23, 0x01, 0x78, 0x9b, 0x01, 0x3c, 0x9b, 0x05, 0xb0, 0xf9, 0xd3, 0x00, 0x00, 0x01,
-    0x00, 0xfa, 0xfe, 0xc8, 0x03, 0xb1, 0x06, 0x80, 0x00, 0x07, 0x00, 0x22, 0x40, 0x1f, 0x00, 0x00, 0x00, 0x03, 0x02,
-    0x00, 0x03, 0x61, 0x00, 0x02, 0x01, 0x01, 0x02, 0x55, 0x00, 0x02, 0x02, 0x01, 0x59, 0x00, 0x01, 0x02, 0x01, 0x4d,
-    0x11, 0x11, 0x11, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x21, 0x01, 0x21, 0x37, 0x33, 0x01, 0x23, 0x02, 0x2f, 0x01,
-    0x82, 0xfe, 0xcb, 0xfe, 0x7e, 0x18, 0xd7, 0x01, 0x05, 0xd7, 0x06, 0x80, 0xf8, 0x48, 0x98, 0x06, 0x88, 0x00, 0x01,
-    0x00, 0xe8, 0x02, 0xa5, 0x03, 0xd1, 0x05, 0xb0, 0x00, 0x08, 0x00, 0x1c, 0x40, 0x19, 0x07, 0x06, 0x02, 0x00, 0x01,
-    0x01, 0x4a, 0x02, 0x01, 0x00, 0x01, 0x00, 0x73, 0x00, 0x01, 0x01, 0x3c, 0x01, 0x4c, 0x11, 0x11, 0x10, 0x03, 0x08,
-    0x17, 0x2b, 0x01, 0x23, 0x01, 0x33, 0x13, 0x23, 0x03, 0x27, 0x07, 0x01, 0x99, 0xb1, 0x01, 0xbe, 0x7d, 0xae, 0x9e,
-    0x6c, 0x01, 0x1c, 0x02, 0xa5, 0x03, 0x0b, 0xfc, 0xf5, 0x01, 0xe6, 0x45, 0x46, 0x00, 0x01, 0x00, 0x14, 0xff, 0x69,
-    0x03, 0xa9, 0x00, 0x00, 0x00, 0x03, 0x00, 0x18, 0x40, 0x15, 0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0x01,
-    0x00, 0x59, 0x00, 0x00, 0x01, 0x00, 0x4d, 0x11, 0x10, 0x02, 0x08, 0x16, 0x2b, 0x05, 0x21, 0x37, 0x21, 0x03, 0x8e,
-    0xfc, 0x86, 0x1a, 0x03, 0x7b, 0x97, 0x97, 0x00, 0x00, 0x01, 0x02, 0x23, 0x04, 0xbf, 0x03, 0x70, 0x05, 0xc9, 0x00,
-    0x03, 0x00, 0x26, 0x4b, 0xb0, 0x28, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x73, 0x00, 0x01, 0x01, 0x3c,
-    0x01, 0x4c, 0x1b, 0x40, 0x09, 0x00, 0x01, 0x00, 0x01, 0x72, 0x00, 0x00, 0x00, 0x69, 0x59, 0xb4, 0x11, 0x10, 0x02,
-    0x08, 0x16, 0x2b, 0x01, 0x23, 0x03, 0x33, 0x03, 0x70, 0x86, 0xc7, 0xcc, 0x04, 0xbf, 0x01, 0x0a, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x61, 0xff, 0xeb, 0x04, 0x0f, 0x04, 0x50, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x40, 0x40, 0x3d, 0x2d,
-    0x03, 0x02, 0x00, 0x05, 0x01, 0x4a, 0x00, 0x03, 0x02, 0x01, 0x02, 0x03, 0x01, 0x70, 0x00, 0x01, 0x00, 0x06, 0x05,
-    0x01, 0x06, 0x63, 0x00, 0x02, 0x02, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x47, 0x4b, 0x07, 0x01, 0x05, 0x05, 0x00, 0x5b,
-    0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x30, 0x2f, 0x35, 0x33, 0x2f, 0x3d, 0x30, 0x3d, 0x24, 0x14, 0x25, 0x2a, 0x25,
-    0x08, 0x08, 0x19, 0x2b, 0x21, 0x26, 0x34, 0x37, 0x06, 0x06, 0x27, 0x2e, 0x03, 0x37, 0x3e, 0x05, 0x33, 0x17, 0x37,
-    0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x07, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x03, 0x06, 0x06, 0x17,
-    0x07, 0x25, 0x16, 0x36, 0x37, 0x37, 0x27, 0x22, 0x0e, 0x02, 0x07, 0x06, 0x1e, 0x02, 0x02, 0xfc, 0x08, 0x03, 0x47,
-    0xa7, 0x61, 0x44, 0x79, 0x59, 0x31, 0x04, 0x04, 0x31, 0x4e, 0x66, 0x73, 0x7b, 0x3c, 0xce, 0x0d, 0x06, 0x1b, 0x38,
-    0x51, 0x31, 0x2b, 0x53, 0x45, 0x32, 0x0a, 0xb5, 0x09, 0x58, 0x81, 0x9a, 0x4a, 0x52, 0x8e, 0x65, 0x34, 0x09, 0x54,
-    0x09, 0x01, 0x0d, 0x02, 0xfe, 0x18, 0x60, 0xa6, 0x38, 0x27, 0x9b, 0x37, 0x7d, 0x6e, 0x4e, 0x08, 0x05, 0x16, 0x30,
-    0x44, 0x1e, 0x3a, 0x1e, 0x3f, 0x4c, 0x02, 0x01, 0x2c, 0x50, 0x72, 0x48, 0x46, 0x6c, 0x51, 0x38, 0x23, 0x0f, 0x01,
-    0x56, 0x33, 0x4e, 0x36, 0x1c, 0x01, 0x01, 0x14, 0x2a, 0x41, 0x2d, 0x01, 0x52, 0x79, 0x50, 0x27, 0x01, 0x02, 0x30,
-    0x5d, 0x86, 0x57, 0xfe, 0x09, 0x37, 0x6e, 0x36, 0x11, 0x8c, 0x02, 0x5b, 0x4c, 0xdc, 0x01, 0x0e, 0x2c, 0x52, 0x43,
-    0x2b, 0x42, 0x2d, 0x18, 0x00, 0x00, 0x02, 0x00, 0x41, 0xff, 0xe9, 0x04, 0x20, 0x06, 0x00, 0x00, 0x19, 0x00, 0x2d,
-    0x00, 0xa0, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x0e, 0x0f, 0x01, 0x04, 0x03, 0x25, 0x01, 0x05, 0x04, 0x0a, 0x01,
-    0x00, 0x05, 0x03, 0x4a, 0x1b, 0x40, 0x0e, 0x0f, 0x01, 0x04, 0x03, 0x25, 0x01, 0x05, 0x04, 0x0a, 0x01, 0x01, 0x05,
-    0x03, 0x4a, 0x59, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x1b, 0x00, 0x02, 0x02, 0x3e, 0x4b, 0x00, 0x04, 0x04, 0x03,
-    0x5b, 0x00, 0x03, 0x03, 0x47, 0x4b, 0x00, 0x05, 0x05, 0x00, 0x5c, 0x01, 0x01, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x1b,
-    0x4b, 0xb0, 0x23, 0x50, 0x58, 0x40, 0x1f, 0x00, 0x02, 0x02, 0x3e, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03,
-    0x03, 0x47, 0x4b, 0x00, 0x01, 0x01, 0x3d, 0x4b, 0x00, 0x05, 0x05, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c,
-    0x1b, 0x40, 0x1f, 0x00, 0x02, 0x03, 0x02, 0x72, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x47, 0x4b, 0x00,
-    0x01, 0x01, 0x3d, 0x4b, 0x00, 0x05, 0x05, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x59, 0x59, 0x40, 0x09,
-    0x27, 0x2b, 0x23, 0x11, 0x13, 0x26, 0x06, 0x08, 0x1a, 0x2b, 0x01, 0x0e, 0x05, 0x27, 0x26, 0x26, 0x27, 0x07, 0x23,
-    0x01, 0x33, 0x03, 0x36, 0x36, 0x17, 0x1e, 0x05, 0x07, 0x27, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x03,
-    0x16, 0x16, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x04, 0x17, 0x09, 0x25, 0x3a, 0x50, 0x68, 0x80, 0x4d, 0x58, 0x94, 0x31,
-    0x24, 0xa8, 0x01, 0x0b, 0xb5, 0x6c, 0x3e, 0x9a, 0x5e, 0x49, 0x6f, 0x4f, 0x31, 0x19, 0x04, 0x07, 0xb4, 0x07, 0x05,
-    0x2a, 0x5a, 0x4e, 0x2f, 0x50, 0x45, 0x3b, 0x19, 0x52, 0x1b, 0x6e, 0x53, 0x53, 0x7a, 0x54, 0x30, 0x0a, 0x02, 0x17,
-    0x43, 0x87, 0x7c, 0x6c, 0x50, 0x2c, 0x02, 0x02, 0x45, 0x4a, 0x7c, 0x06, 0x00, 0xfd, 0xc5, 0x45, 0x46, 0x02, 0x02,
-    0x30, 0x51, 0x6a, 0x79, 0x7f, 0x3d, 0x01, 0x3d, 0x87, 0x72, 0x4c, 0x02, 0x01, 0x18, 0x2d, 0x3e, 0x24, 0xfe, 0x24,
-    0x4b, 0x5a, 0x02, 0x02, 0x47, 0x74, 0x90, 0x47, 0x00, 0x00, 0x01, 0x00, 0x75, 0xff, 0xe9, 0x04, 0x2c, 0x04, 0x50,
-    0x00, 0x2f, 0x00, 0x3b, 0x40, 0x38, 0x00, 0x04, 0x05, 0x01, 0x05, 0x04, 0x01, 0x70, 0x00, 0x01, 0x00, 0x05, 0x01,
-    0x00, 0x6e, 0x00, 0x05, 0x05, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x47, 0x4b, 0x06, 0x01, 0x00, 0x00, 0x02, 0x5b, 0x00,
-    0x02, 0x02, 0x45, 0x02, 0x4c, 0x01, 0x00, 0x24, 0x22, 0x1e, 0x1d, 0x19, 0x17, 0x0c, 0x0a, 0x06, 0x05, 0x00, 0x2f,
-    0x01, 0x2f, 0x07, 0x08, 0x14, 0x2b, 0x25, 0x16, 0x3e, 0x02, 0x37, 0x37, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x37,
-    0x3e, 0x05, 0x17, 0x1e, 0x03, 0x07, 0x27, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x07, 0x06, 0x14, 0x1e,
-    0x03, 0x02, 0x15, 0x31, 0x60, 0x4f, 0x38, 0x0b, 0xab, 0x09, 0x5a, 0x84, 0xa0, 0x4f, 0x72, 0xa0, 0x62, 0x24, 0x0a,
-    0x05, 0x09, 0x2e, 0x47, 0x5f, 0x76, 0x8a, 0x4e, 0x54, 0x8e, 0x65, 0x36, 0x04, 0xaa, 0x02, 0x1c, 0x39, 0x52, 0x34,
-    0x53, 0x7f, 0x5a, 0x37, 0x0a, 0x05, 0x05, 0x0f, 0x20, 0x36, 0x4d, 0x81, 0x01, 0x1d, 0x37, 0x4f, 0x31, 0x01, 0x53,
-    0x87, 0x5f, 0x33, 0x02, 0x03, 0x5c, 0x95, 0xc0, 0x66, 0x2b, 0x49, 0x8a, 0x7a, 0x65, 0x48, 0x26, 0x02, 0x02, 0x3c,
-    0x67, 0x8f, 0x55, 0x01, 0x32, 0x56, 0x41, 0x26, 0x02, 0x03, 0x43, 0x70, 0x8e, 0x49, 0x2a, 0x2b, 0x5a, 0x55, 0x4d,
-    0x39, 0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x76, 0xff, 0xea, 0x04, 0xa0, 0x06, 0x00, 0x00, 0x19, 0x00, 0x2d, 0x00,
-    0x89, 0x40, 0x0e, 0x0a, 0x01, 0x05, 0x00, 0x25, 0x01, 0x04, 0x05, 0x0f, 0x01, 0x02, 0x04, 0x03, 0x4a, 0x4b, 0xb0,
-    0x19, 0x50, 0x58, 0x40, 0x1b, 0x00, 0x01, 0x01, 0x3e, 0x4b, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x47,
-    0x4b, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x03, 0x01, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x1b, 0x4b, 0xb0, 0x23, 0x50, 0x58,
-    0x40, 0x1f, 0x00, 0x01, 0x01, 0x3e, 0x4b, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x02,
-    0x02, 0x3d, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x45, 0x03, 0x4c, 0x1b, 0x40, 0x1f, 0x00, 0x01,
-    0x00, 0x01, 0x72, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x02, 0x02, 0x3d, 0x4b, 0x00,
-    0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x45, 0x03, 0x4c, 0x59, 0x59, 0x40, 0x09, 0x25, 0x2d, 0x23, 0x11, 0x13,
-    0x26, 0x06, 0x08, 0x1a, 0x2b, 0x13, 0x3e, 0x05, 0x17, 0x16, 0x16, 0x17, 0x13, 0x33, 0x01, 0x23, 0x37, 0x06, 0x06,
-    0x27, 0x2e, 0x05, 0x37, 0x33, 0x06, 0x14, 0x1e, 0x03, 0x17, 0x16, 0x36, 0x37, 0x13, 0x26, 0x26, 0x27, 0x26, 0x0e,
-    0x02, 0x07, 0x7e, 0x08, 0x26, 0x3c, 0x53, 0x69, 0x82, 0x4d, 0x51, 0x8c, 0x33, 0x68, 0xb5, 0xfe, 0xf5, 0xa4, 0x13,
-    0x3f, 0x9b, 0x5d, 0x46, 0x6d, 0x4f, 0x33, 0x1c, 0x06, 0x06, 0xb4, 0x05, 0x0d, 0x1c, 0x32, 0x4a, 0x33, 0x59, 0x85,
-    0x32, 0x57, 0x1d, 0x6b, 0x4d, 0x54, 0x7c, 0x56, 0x33, 0x09, 0x02, 0x1f, 0x43, 0x88, 0x7e, 0x6c, 0x50, 0x2c, 0x02,
-    0x02, 0x3c, 0x42, 0x02, 0x32, 0xfa, 0x00, 0x72, 0x43, 0x45, 0x02, 0x02, 0x31, 0x52, 0x6b, 0x77, 0x7c, 0x3b, 0x28,
-    0x58, 0x55, 0x4c, 0x3b, 0x24, 0x01, 0x03, 0x58, 0x45, 0x01, 0xf9, 0x45, 0x4f, 0x02, 0x03, 0x48, 0x75, 0x91, 0x48,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x6c, 0xff, 0xeb, 0x04, 0x2b, 0x04, 0x50, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x40,
-    0x40, 0x3d, 0x1d, 0x1c, 0x02, 0x03, 0x02, 0x01, 0x4a, 0x00, 0x05, 0x00, 0x02, 0x03, 0x05, 0x02, 0x61, 0x07, 0x01,
-    0x04, 0x04, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x47, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x06, 0x01, 0x00, 0x00, 0x45,
-    0x00, 0x4c, 0x23, 0x22, 0x01, 0x00, 0x28, 0x27, 0x22, 0x2d, 0x23, 0x2d, 0x1a, 0x18, 0x14, 0x13, 0x0e, 0x0c, 0x00,
-    0x21, 0x01, 0x21, 0x08, 0x08, 0x14, 0x2b, 0x05, 0x2e, 0x03, 0x37, 0x37, 0x3e, 0x05, 0x17, 0x1e, 0x03, 0x07, 0x07,
-    0x21, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x36, 0x37, 0x17, 0x0e, 0x03, 0x13, 0x26, 0x0e, 0x02, 0x07, 0x05, 0x37, 0x36,
-    0x2e, 0x02, 0x02, 0x1c, 0x6e, 0xa7, 0x6c, 0x2f, 0x09, 0x05, 0x08, 0x2e, 0x49, 0x61, 0x77, 0x8b, 0x4d, 0x70, 0x9a,
-    0x5a, 0x1e, 0x0d, 0x0d, 0xfd, 0x17, 0x08, 0x19, 0x40, 0x6a, 0x49, 0x5e, 0x9f, 0x40, 0x68, 0x25, 0x63, 0x72, 0x7c,
-    0x45, 0x46, 0x70, 0x57, 0x40, 0x15, 0x02, 0x34, 0x04, 0x09, 0x14, 0x38, 0x58, 0x14, 0x02, 0x56, 0x8e, 0xba, 0x68,
-    0x2b, 0x47, 0x8b, 0x7e, 0x6a, 0x4d, 0x2a, 0x02, 0x03, 0x5b, 0x94, 0xbd, 0x64, 0x53, 0x42, 0x7e, 0x64, 0x3e, 0x02,
-    0x03, 0x50, 0x42, 0x58, 0x34, 0x4f, 0x34, 0x19, 0x03, 0xcb, 0x03, 0x35, 0x58, 0x72, 0x3a, 0x02, 0x12, 0x37, 0x68,
-    0x52, 0x33, 0x00, 0x01, 0x00, 0xcd, 0x00, 0x00, 0x04, 0xe9, 0x06, 0x2d, 0x00, 0x1b, 0x00, 0x37, 0x40, 0x34, 0x0d,
-    0x01, 0x03, 0x02, 0x0e, 0x01, 0x01, 0x03, 0x02, 0x4a, 0x00, 0x02, 0x00, 0x03, 0x01, 0x02, 0x03, 0x63, 0x05, 0x01,
-    0x00, 0x00, 0x01, 0x59, 0x04, 0x01, 0x01, 0x01, 0x3f, 0x4b, 0x07, 0x01, 0x06, 0x06, 0x3d, 0x06, 0x4c, 0x00, 0x00,
-    0x00, 0x1b, 0x00, 0x1b, 0x11, 0x15, 0x25, 0x25, 0x11, 0x11, 0x08, 0x08, 0x1a, 0x2b, 0x21, 0x13, 0x21, 0x37, 0x21,
-    0x37, 0x3e, 0x03, 0x17, 0x16, 0x16, 0x17, 0x07, 0x26, 0x26, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x07, 0x21, 0x07, 0x21,
-    0x03, 0x01, 0x4c, 0xa3, 0xfe, 0xde, 0x1a, 0x01, 0x20, 0x0b, 0x0d, 0x4d, 0x79, 0xa3, 0x64, 0x41, 0x7d, 0x3f, 0x25,
-    0x31, 0x65, 0x34, 0x41, 0x68, 0x4e, 0x31, 0x0a, 0x0b, 0x01, 0x95, 0x19, 0xfe, 0x6c, 0xa3, 0x03, 0xab, 0x8f, 0x4c,
-    0x60, 0x9d, 0x6f, 0x3b, 0x01, 0x01, 0x18, 0x10, 0x98, 0x11, 0x14, 0x01, 0x01, 0x24, 0x45, 0x63, 0x3f, 0x4d, 0x8f,
-    0xfc, 0x55, 0x00, 0x02, 0x00, 0x2d, 0xfe, 0x52, 0x04, 0x52, 0x04, 0x51, 0x00, 0x2b, 0x00, 0x3f, 0x01, 0x8b, 0x4b,
-    0xb0, 0x17, 0x50, 0x58, 0x40, 0x13, 0x0a, 0x01, 0x06, 0x00, 0x37, 0x01, 0x05, 0x06, 0x21, 0x01, 0x04, 0x05, 0x18,
-    0x17, 0x02, 0x03, 0x04, 0x04, 0x4a, 0x1b, 0x40, 0x13, 0x0a, 0x01, 0x06, 0x01, 0x37, 0x01, 0x05, 0x06, 0x21, 0x01,
-    0x04, 0x05, 0x18, 0x17, 0x02, 0x03, 0x04, 0x04, 0x4a, 0x59, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40, 0x20, 0x00, 0x06,
-    0x06, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x05, 0x05, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x45, 0x4b,
-    0x00, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x41, 0x02, 0x4c, 0x1b, 0x4b, 0xb0, 0x10, 0x50, 0x58, 0x40, 0x20,
-    0x00, 0x06, 0x06, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x05, 0x05, 0x04, 0x5b, 0x00, 0x04, 0x04,
-    0x45, 0x4b, 0x00, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x49, 0x02, 0x4c, 0x1b, 0x4b, 0xb0, 0x12, 0x50, 0x58,
-    0x40, 0x20, 0x00, 0x06, 0x06, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x05, 0x05, 0x04, 0x5b, 0x00,
-    0x04, 0x04, 0x45, 0x4b, 0x00, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x41, 0x02, 0x4c, 0x1b, 0x4b, 0xb0, 0x16,
-    0x50, 0x58, 0x40, 0x20, 0x00, 0x06, 0x06, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x05, 0x05, 0x04,
-    0x5b, 0x00, 0x04, 0x04, 0x45, 0x4b, 0x00, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x49, 0x02, 0x4c, 0x1b, 0x4b,
-    0xb0, 0x17, 0x50, 0x58, 0x40, 0x20, 0x00, 0x06, 0x06, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x05,
-    0x05, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x45, 0x4b, 0x00, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x41, 0x02, 0x4c,
-    0x1b, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x24, 0x00, 0x01, 0x01, 0x3f, 0x4b, 0x00, 0x06, 0x06, 0x00, 0x5b, 0x00,
-    0x00, 0x00, 0x47, 0x4b, 0x00, 0x05, 0x05, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x45, 0x4b, 0x00, 0x03, 0x03, 0x02, 0x5b,
-    0x00, 0x02, 0x02, 0x49, 0x02, 0x4c, 0x1b, 0x4b, 0xb0, 0x1d, 0x50, 0x58, 0x40, 0x24, 0x00, 0x01, 0x01, 0x3f, 0x4b,
-    0x00, 0x06, 0x06, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x05, 0x05, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x45,
-    0x4b, 0x00, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x41, 0x02, 0x4c, 0x1b, 0x40, 0x24, 0x00, 0x01, 0x01, 0x3f,
-    0x4b, 0x00, 0x06, 0x06, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x05, 0x05, 0x04, 0x5b, 0x00, 0x04, 0x04,
-    0x45, 0x4b, 0x00, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x49, 0x02, 0x4c, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
-    0x59, 0x40, 0x0a, 0x25, 0x2d, 0x27, 0x27, 0x25, 0x13, 0x26, 0x07, 0x08, 0x1b, 0x2b, 0x13, 0x3e, 0x05, 0x17, 0x16,
-    0x16, 0x17, 0x37, 0x33, 0x03, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x27, 0x37, 0x16, 0x16, 0x17, 0x16, 0x3e, 0x02, 0x37,
-    0x37, 0x06, 0x06, 0x27, 0x2e, 0x05, 0x37, 0x33, 0x06, 0x14, 0x1e, 0x03, 0x17, 0x16, 0x36, 0x37, 0x13, 0x26, 0x26,
-    0x27, 0x26, 0x0e, 0x02, 0x07, 0x7f, 0x09, 0x25, 0x3c, 0x51, 0x6a, 0x81, 0x4e, 0x55, 0x91, 0x30, 0x23, 0xa6, 0xb4,
-    0x0e, 0x55, 0x85, 0xaf, 0x69, 0x36, 0x6a, 0x60, 0x52, 0x1f, 0x67, 0x2f, 0x81, 0x54, 0x45, 0x71, 0x55, 0x39, 0x0d,
-    0x14, 0x3f, 0x96, 0x5b, 0x47, 0x6d, 0x4f, 0x33, 0x1b, 0x06, 0x07, 0xb4, 0x05, 0x0c, 0x1d, 0x32, 0x49, 0x34, 0x5a,
-    0x85, 0x32, 0x55, 0x1c, 0x6b, 0x4e, 0x54, 0x7c, 0x55, 0x32, 0x0a, 0x02, 0x1f, 0x43, 0x89, 0x7e, 0x6c, 0x50, 0x2c,
-    0x02, 0x02, 0x43, 0x47, 0x77, 0xfb, 0xdd, 0x65, 0xa8, 0x77, 0x41, 0x03, 0x01, 0x1a, 0x30, 0x45, 0x2d, 0x6f, 0x43,
-    0x50, 0x02, 0x02, 0x29, 0x4c, 0x6c, 0x41, 0x5f, 0x3f, 0x42, 0x02, 0x02, 0x31, 0x51, 0x6b, 0x77, 0x7d, 0x3b, 0x28,
-    0x58, 0x54, 0x4d, 0x3b, 0x24, 0x02, 0x02, 0x59, 0x47, 0x01, 0xf3, 0x47, 0x50, 0x02, 0x03, 0x48, 0x75, 0x91, 0x48,
-    0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x04, 0x20, 0x06, 0x00, 0x00, 0x1b, 0x00, 0x41, 0x4b, 0xb0, 0x23, 0x50,
-    0x58, 0x40, 0x16, 0x00, 0x04, 0x04, 0x3e, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x03,
-    0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x1b, 0x40, 0x16, 0x00, 0x04, 0x00, 0x04, 0x72, 0x00, 0x02, 0x02, 0x00, 0x5b,
-    0x00, 0x00, 0x00, 0x47, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x59, 0xb7, 0x11, 0x15, 0x25, 0x15, 0x24,
-    0x05, 0x08, 0x19, 0x2b, 0x01, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x03, 0x23, 0x13, 0x36, 0x2e, 0x02, 0x27, 0x26,
-    0x0e, 0x02, 0x07, 0x03, 0x23, 0x01, 0x33, 0x01, 0x8c, 0x21, 0x4d, 0x57, 0x61, 0x36, 0x5c, 0x7c, 0x48, 0x18, 0x09,
-    0x72, 0xb5, 0x73, 0x06, 0x0c, 0x2c, 0x4d, 0x3b, 0x2e, 0x53, 0x4b, 0x43, 0x1c, 0x89, 0xb5, 0x01, 0x0b, 0xb5, 0x03,
-    0x98, 0x28, 0x44, 0x30, 0x1b, 0x01, 0x02, 0x46, 0x74, 0x97, 0x52, 0xfd, 0x57, 0x02, 0xac, 0x35, 0x5d, 0x47, 0x29,
-    0x02, 0x01, 0x17, 0x2b, 0x3a, 0x22, 0xfc, 0xed, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5c, 0x00, 0x00,
-    0x03, 0xe9, 0x05, 0xc5, 0x00, 0x09, 0x00, 0x17, 0x00, 0x2d, 0x40, 0x2a, 0x00, 0x06, 0x06, 0x05, 0x5b, 0x00, 0x05,
-    0x05, 0x44, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x59, 0x00, 0x00, 0x00, 0x3f, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x02, 0x59,
-    0x00, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x26, 0x23, 0x11, 0x11, 0x11, 0x11, 0x10, 0x07, 0x08, 0x1b, 0x2b, 0x01, 0x21,
-    0x03, 0x21, 0x07, 0x21, 0x37, 0x21, 0x13, 0x21, 0x01, 0x36, 0x36, 0x37, 0x36, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x07,
-    0x06, 0x26, 0x01, 0x18, 0x02, 0x1a, 0xa0, 0x01, 0x57, 0x1d, 0xfc, 0x90, 0x1d, 0x01, 0x64, 0x84, 0xfe, 0x9b, 0x01,
-    0x9b, 0x01, 0x3c, 0x30, 0x18, 0x27, 0x1d, 0x0f, 0x3c, 0x30, 0x2f, 0x3d, 0x04, 0x3a, 0xfc, 0x66, 0xa0, 0xa0, 0x02,
-    0xf9, 0x01, 0xba, 0x30, 0x3f, 0x02, 0x01, 0x10, 0x1c, 0x28, 0x18, 0x30, 0x3b, 0x02, 0x02, 0x39, 0x00, 0x02, 0x00,
-    0x23, 0xfe, 0x49, 0x03, 0xc4, 0x05, 0xc5, 0x00, 0x15, 0x00, 0x23, 0x00, 0x35, 0x40, 0x32, 0x0b, 0x01, 0x02, 0x03,
-    0x0a, 0x01, 0x01, 0x02, 0x02, 0x4a, 0x00, 0x05, 0x05, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x44, 0x4b, 0x00, 0x03, 0x03,
-    0x00, 0x59, 0x00, 0x00, 0x00, 0x3f, 0x4b, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x49, 0x01, 0x4c, 0x26,
-    0x23, 0x15, 0x25, 0x25, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x01, 0x21, 0x03, 0x0e, 0x03, 0x23, 0x22, 0x26, 0x27, 0x37,
-    0x16, 0x16, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x13, 0x21, 0x01, 0x34, 0x36, 0x37, 0x36, 0x1e, 0x02, 0x15, 0x06, 0x06,
-    0x07, 0x06, 0x26, 0x01, 0x75, 0x02, 0x13, 0xb9, 0x0e, 0x4c, 0x78, 0xa3, 0x65, 0x36, 0x67, 0x35, 0x1a, 0x2d, 0x59,
-    0x2d, 0x41, 0x67, 0x4a, 0x2f, 0x09, 0x9e, 0xfe, 0xa1, 0x01, 0x93, 0x3b, 0x30, 0x18, 0x28, 0x1d, 0x10, 0x01, 0x3c,
-    0x30, 0x30, 0x3c, 0x04, 0x3a, 0xfb, 0xbf, 0x62, 0xa0, 0x71, 0x3d, 0x09, 0x08, 0x9a, 0x08, 0x07, 0x01, 0x01, 0x28,
-    0x49, 0x66, 0x3e, 0x03, 0xa1, 0x01, 0xbb, 0x30, 0x3e, 0x02, 0x01, 0x0f, 0x1d, 0x27, 0x18, 0x30, 0x3c, 0x02, 0x02,
-    0x3a, 0x00, 0x00, 0x01, 0x00, 0x42, 0x00, 0x00, 0x04, 0x64, 0x06, 0x00, 0x00, 0x0c, 0x00, 0x3e, 0xb6, 0x0a, 0x06,
-    0x02, 0x00, 0x02, 0x01, 0x4a, 0x4b, 0xb0, 0x23, 0x50, 0x58, 0x40, 0x11, 0x00, 0x01, 0x01, 0x3e, 0x4b, 0x00, 0x02,
-    0x02, 0x3f, 0x4b, 0x03, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x1b, 0x40, 0x11, 0x00, 0x01, 0x02, 0x01, 0x72, 0x00,
-    0x02, 0x02, 0x3f, 0x4b, 0x03, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x59, 0xb6, 0x12, 0x13, 0x11, 0x12, 0x04, 0x08,
-    0x18, 0x2b, 0x01, 0x07, 0x03, 0x23, 0x01, 0x33, 0x03, 0x37, 0x01, 0x33, 0x01, 0x01, 0x23, 0x01, 0xda, 0xa3, 0x3f,
-    0xb6, 0x01, 0x0b, 0xb6, 0xa2, 0x85, 0x01, 0x92, 0xec, 0xfd, 0xfe, 0x01, 0x78, 0xd7, 0x01, 0xf7, 0x89, 0xfe, 0x92,
-    0x06, 0x00, 0xfc, 0x5e, 0x7b, 0x01, 0x61, 0xfe, 0x34, 0xfd, 0x92, 0x00, 0x00, 0x01, 0x00, 0x5c, 0x00, 0x00, 0x03,
-    0xe9, 0x06, 0x00, 0x00, 0x09, 0x00, 0x3f, 0x4b, 0xb0, 0x23, 0x50, 0x58, 0x40, 0x16, 0x00, 0x04, 0x04, 0x00, 0x59,
-    0x00, 0x00, 0x00, 0x3e, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x02, 0x59, 0x00, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x1b, 0x40,
-    0x14, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x04, 0x61, 0x03, 0x01, 0x01, 0x01, 0x02, 0x59, 0x00, 0x02, 0x02, 0x3d,
-    0x02, 0x4c, 0x59, 0xb7, 0x11, 0x11, 0x11, 0x11, 0x10, 0x05, 0x08, 0x19, 0x2b, 0x01, 0x21, 0x03, 0x21, 0x07, 0x21,
-    0x37, 0x21, 0x13, 0x21, 0x01, 0x67, 0x02, 0x1a, 0xef, 0x01, 0x57, 0x1d, 0xfc, 0x90, 0x1d, 0x01, 0x64, 0xd3, 0xfe,
-    0x9a, 0x06, 0x00, 0xfa, 0xa0, 0xa0, 0xa0, 0x04, 0xbf, 0x00, 0x00, 0x01, 0xff, 0xf2, 0x00, 0x00, 0x04, 0x75, 0x04,
-    0x4f, 0x00, 0x2a, 0x00, 0x65, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0xb6, 0x09, 0x01, 0x02, 0x03, 0x00, 0x01, 0x4a, 0x1b,
-    0xb6, 0x09, 0x01, 0x02, 0x03, 0x07, 0x01, 0x4a, 0x59, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x16, 0x05, 0x01, 0x03,
-    0x03, 0x00, 0x5b, 0x08, 0x07, 0x01, 0x03, 0x00, 0x00, 0x47, 0x4b, 0x06, 0x04, 0x02, 0x02, 0x02, 0x3d, 0x02, 0x4c,
-    0x1b, 0x40, 0x1a, 0x08, 0x01, 0x07, 0x07, 0x3f, 0x4b, 0x05, 0x01, 0x03, 0x03, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00,
-    0x47, 0x4b, 0x06, 0x04, 0x02, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x59, 0x40, 0x10, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x2a,
-    0x13, 0x25, 0x13, 0x25, 0x15, 0x26, 0x23, 0x09, 0x08, 0x1b, 0x2b, 0x01, 0x07, 0x36, 0x36, 0x17, 0x32, 0x1e, 0x02,
-    0x17, 0x36, 0x36, 0x33, 0x1e, 0x03, 0x07, 0x03, 0x23, 0x13, 0x36, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x07, 0x03, 0x23,
-    0x13, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x06, 0x07, 0x03, 0x23, 0x13, 0x01, 0x4e, 0x14, 0x2a, 0x6c, 0x48, 0x1f, 0x38,
-    0x2f, 0x23, 0x09, 0x2a, 0x6a, 0x46, 0x3f, 0x54, 0x2f, 0x0f, 0x05, 0x87, 0xac, 0x88, 0x03, 0x06, 0x15, 0x29, 0x1f,
-    0x36, 0x50, 0x0e, 0x8e, 0xac, 0x89, 0x03, 0x05, 0x15, 0x26, 0x1e, 0x32, 0x46, 0x1a, 0x95, 0xac, 0xbb, 0x04, 0x3b,
-    0x67, 0x39, 0x42, 0x01, 0x0d, 0x1c, 0x2c, 0x1e, 0x34, 0x3f, 0x01, 0x32, 0x53, 0x69, 0x37, 0xfc, 0xd8, 0x03, 0x2b,
-    0x1c, 0x31, 0x25, 0x15, 0x3c, 0x34, 0xfc, 0xbe, 0x03, 0x2c, 0x1b, 0x2f, 0x24, 0x16, 0x01, 0x01, 0x2b, 0x29, 0xfc,
-    0xa2, 0x04, 0x3a, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x04, 0x1e, 0x04, 0x4f, 0x00, 0x1b, 0x00, 0x4c, 0xb5, 0x01,
-    0x01, 0x01, 0x02, 0x01, 0x4a, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x13, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x05, 0x04,
-    0x02, 0x00, 0x00, 0x47, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x1b, 0x40, 0x17, 0x05, 0x01, 0x04, 0x04,
-    0x3f, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c,
-    0x59, 0x40, 0x0d, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x1b, 0x15, 0x25, 0x15, 0x25, 0x06, 0x08, 0x18, 0x2b, 0x01, 0x07,
-    0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x03, 0x23, 0x13, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x03, 0x23,
-    0x13, 0x01, 0x9d, 0x17, 0x21, 0x4e, 0x58, 0x62, 0x36, 0x5b, 0x7c, 0x49, 0x19, 0x09, 0x73, 0xb5, 0x73, 0x06, 0x0b,
-    0x2b, 0x4e, 0x3c, 0x2f, 0x55, 0x4a, 0x41, 0x1b, 0x87, 0xb5, 0xbc, 0x04, 0x3b, 0xa1, 0x28, 0x44, 0x30, 0x19, 0x01,
-    0x02, 0x44, 0x71, 0x96, 0x52, 0xfd, 0x51, 0x02, 0xac, 0x37, 0x5e, 0x46, 0x29, 0x01, 0x01, 0x19, 0x2d, 0x3f, 0x24,
-    0xfc, 0xf7, 0x04, 0x3a, 0x00, 0x02, 0x00, 0x60, 0xff, 0xe9, 0x04, 0x33, 0x04, 0x50, 0x00, 0x17, 0x00, 0x2f, 0x00,
-    0x1f, 0x40, 0x1c, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x00,
-    0x01, 0x01, 0x45, 0x01, 0x4c, 0x29, 0x2b, 0x29, 0x26, 0x04, 0x08, 0x18, 0x2b, 0x13, 0x3e, 0x05, 0x17, 0x1e, 0x03,
-    0x07, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x33, 0x06, 0x1e, 0x04, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x37, 0x36,
-    0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x6e, 0x09, 0x2d, 0x46, 0x5f, 0x75, 0x8b, 0x50, 0x72, 0xa1, 0x62, 0x25,
-    0x0b, 0x02, 0x0e, 0x59, 0x8e, 0xc1, 0x76, 0x71, 0xa1, 0x62, 0x26, 0x0b, 0xb5, 0x05, 0x01, 0x0f, 0x20, 0x36, 0x4d,
-    0x34, 0x53, 0x80, 0x5b, 0x36, 0x0b, 0x02, 0x07, 0x09, 0x32, 0x60, 0x4e, 0x54, 0x80, 0x5a, 0x36, 0x0a, 0x02, 0x20,
-    0x49, 0x8d, 0x7d, 0x69, 0x4b, 0x29, 0x02, 0x03, 0x5f, 0x99, 0xc3, 0x66, 0x17, 0x6d, 0xca, 0x99, 0x5a, 0x03, 0x03,
-    0x5d, 0x98, 0xc0, 0x66, 0x2a, 0x5a, 0x56, 0x4e, 0x3b, 0x24, 0x02, 0x03, 0x48, 0x74, 0x91, 0x48, 0x16, 0x3f, 0x8a,
-    0x75, 0x4d, 0x03, 0x03, 0x49, 0x76, 0x93, 0x48, 0x00, 0x00, 0x02, 0xff, 0xf7, 0xfe, 0x60, 0x04, 0x1c, 0x04, 0x50,
-    0x00, 0x17, 0x00, 0x28, 0x00, 0x61, 0x40, 0x0e, 0x0d, 0x01, 0x04, 0x02, 0x21, 0x01, 0x05, 0x04, 0x08, 0x01, 0x00,
-    0x05, 0x03, 0x4a, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x1b, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x03, 0x01, 0x02, 0x02,
-    0x3f, 0x4b, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x4b, 0x00, 0x01, 0x01, 0x41, 0x01, 0x4c, 0x1b,
-    0x40, 0x1f, 0x00, 0x02, 0x02, 0x3f, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x47, 0x4b, 0x00, 0x05,
-    0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x4b, 0x00, 0x01, 0x01, 0x41, 0x01, 0x4c, 0x59, 0x40, 0x09, 0x24, 0x2b,
-    0x23, 0x11, 0x13, 0x24, 0x06, 0x08, 0x1a, 0x2b, 0x01, 0x0e, 0x03, 0x27, 0x26, 0x26, 0x27, 0x03, 0x23, 0x01, 0x37,
-    0x07, 0x36, 0x36, 0x17, 0x1e, 0x05, 0x07, 0x23, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x06, 0x07, 0x03, 0x16, 0x17, 0x16,
-    0x3e, 0x02, 0x37, 0x04, 0x13, 0x0c, 0x47, 0x79, 0xae, 0x73, 0x52, 0x92, 0x35, 0x61, 0xb5, 0x01, 0x04, 0xa4, 0x13,
-    0x3f, 0x9d, 0x5f, 0x4a, 0x6e, 0x4f, 0x31, 0x19, 0x04, 0x07, 0xb5, 0x07, 0x07, 0x2e, 0x5c, 0x4e, 0x55, 0x82, 0x32,
-    0x5b, 0x3c, 0x99, 0x54, 0x7d, 0x57, 0x33, 0x0a, 0x02, 0x18, 0x64, 0xc9, 0xa0, 0x62, 0x02, 0x02, 0x3b, 0x41, 0xfd,
-    0xf7, 0x05, 0xda, 0x01, 0x77, 0x45, 0x47, 0x02, 0x02, 0x30, 0x51, 0x6a, 0x78, 0x7f, 0x3d, 0x3d, 0x87, 0x72, 0x4c,
-    0x02, 0x02, 0x53, 0x42, 0xfd, 0xf5, 0x8c, 0x05, 0x02, 0x48, 0x76, 0x92, 0x48, 0x00, 0x02, 0x00, 0x76, 0xfe, 0x60,
-    0x04, 0x51, 0x04, 0x50, 0x00, 0x19, 0x00, 0x2f, 0x00, 0x78, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x0e, 0x0a, 0x01,
-    0x05, 0x00, 0x27, 0x01, 0x04, 0x05, 0x0f, 0x01, 0x03, 0x04, 0x03, 0x4a, 0x1b, 0x40, 0x0e, 0x0a, 0x01, 0x05, 0x01,
-    0x27, 0x01, 0x04, 0x05, 0x0f, 0x01, 0x03, 0x04, 0x03, 0x4a, 0x59, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x1b, 0x00,
-    0x05, 0x05, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x45,
-    0x4b, 0x00, 0x02, 0x02, 0x41, 0x02, 0x4c, 0x1b, 0x40, 0x1f, 0x00, 0x01, 0x01, 0x3f, 0x4b, 0x00, 0x05, 0x05, 0x00,
-    0x5b, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x45, 0x4b, 0x00, 0x02, 0x02,
-    0x41, 0x02, 0x4c, 0x59, 0x40, 0x09, 0x27, 0x2d, 0x23, 0x11, 0x13, 0x26, 0x06, 0x08, 0x1a, 0x2b, 0x13, 0x3e, 0x05,
-    0x17, 0x16, 0x16, 0x17, 0x37, 0x33, 0x01, 0x23, 0x13, 0x06, 0x06, 0x27, 0x2e, 0x05, 0x37, 0x33, 0x06, 0x14, 0x1e,
-    0x03, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x13, 0x26, 0x26, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x7f, 0x09, 0x26, 0x3c, 0x52,
-    0x6a, 0x83, 0x4f, 0x51, 0x8d, 0x33, 0x20, 0xa8, 0xfe, 0xfc, 0xb5, 0x62, 0x3f, 0x93, 0x57, 0x48, 0x6e, 0x50, 0x34,
-    0x1b, 0x06, 0x07, 0xb4, 0x05, 0x0d, 0x1d, 0x32, 0x4a, 0x34, 0x2a, 0x4a, 0x42, 0x3a, 0x1a, 0x5e, 0x20, 0x6a, 0x49,
-    0x54, 0x7f, 0x57, 0x34, 0x09, 0x02, 0x1f, 0x45, 0x89, 0x7e, 0x6c, 0x4e, 0x2b, 0x02, 0x02, 0x3c, 0x42, 0x6c, 0xfa,
-    0x26, 0x02, 0x02, 0x3b, 0x3d, 0x02, 0x02, 0x30, 0x51, 0x6a, 0x77, 0x7e, 0x3c, 0x28, 0x59, 0x56, 0x4e, 0x3c, 0x25,
-    0x01, 0x01, 0x15, 0x26, 0x35, 0x20, 0x02, 0x18, 0x42, 0x49, 0x02, 0x03, 0x49, 0x77, 0x93, 0x48, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0xd7, 0x00, 0x00, 0x04, 0x61, 0x04, 0x50, 0x00, 0x13, 0x00, 0x66, 0x4b, 0xb0, 0x17, 0x50, 0x58,
-    0x40, 0x0b, 0x03, 0x01, 0x01, 0x00, 0x0f, 0x04, 0x02, 0x02, 0x01, 0x02, 0x4a, 0x1b, 0x40, 0x0b, 0x03, 0x01, 0x01,
-    0x03, 0x0f, 0x04, 0x02, 0x02, 0x01, 0x02, 0x4a, 0x59, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x12, 0x00, 0x01, 0x01,
-    0x00, 0x5b, 0x03, 0x04, 0x02, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x1b, 0x40, 0x16, 0x00,
-    0x03, 0x03, 0x3f, 0x4b, 0x00, 0x01, 0x01, 0x00, 0x5b, 0x04, 0x01, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x02, 0x02, 0x3d,
-    0x02, 0x4c, 0x59, 0x40, 0x0f, 0x01, 0x00, 0x0e, 0x0d, 0x0c, 0x0b, 0x08, 0x06, 0x00, 0x13, 0x01, 0x13, 0x05, 0x08,
-    0x14, 0x2b, 0x01, 0x16, 0x16, 0x17, 0x07, 0x26, 0x26, 0x27, 0x26, 0x06, 0x07, 0x03, 0x23, 0x13, 0x33, 0x07, 0x3e,
-    0x03, 0x03, 0xa3, 0x30, 0x60, 0x2e, 0x2e, 0x30, 0x60, 0x31, 0x7e, 0xb4, 0x3c, 0x78, 0xb5, 0xbb, 0xac, 0x1e, 0x26,
-    0x56, 0x60, 0x6b, 0x04, 0x50, 0x01, 0x0b, 0x11, 0xb4, 0x0b, 0x0e, 0x01, 0x01, 0x76, 0x6d, 0xfd, 0x49, 0x04, 0x3a,
-    0xac, 0x2c, 0x48, 0x33, 0x1b, 0x00, 0x01, 0x00, 0x7c, 0xff, 0xea, 0x04, 0x28, 0x04, 0x4f, 0x00, 0x41, 0x00, 0x36,
-    0x40, 0x33, 0x00, 0x01, 0x02, 0x04, 0x02, 0x01, 0x04, 0x70, 0x00, 0x04, 0x05, 0x02, 0x04, 0x05, 0x6e, 0x00, 0x02,
-    0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x05, 0x05, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x45, 0x03, 0x4c,
-    0x3e, 0x3c, 0x38, 0x37, 0x33, 0x31, 0x1d, 0x1b, 0x17, 0x16, 0x12, 0x10, 0x06, 0x08, 0x14, 0x2b, 0x01, 0x36, 0x2e,
-    0x02, 0x27, 0x2e, 0x03, 0x37, 0x3e, 0x05, 0x17, 0x1e, 0x03, 0x07, 0x27, 0x34, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02,
-    0x07, 0x06, 0x1e, 0x02, 0x17, 0x1e, 0x05, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x17, 0x1e, 0x03, 0x33, 0x16,
-    0x3e, 0x02, 0x03, 0x32, 0x06, 0x2a, 0x45, 0x52, 0x21, 0x3c, 0x82, 0x6c, 0x43, 0x03, 0x02, 0x29, 0x42, 0x57, 0x61,
-    0x65, 0x31, 0x4c, 0x8d, 0x6a, 0x3e, 0x01, 0xb3, 0x22, 0x3b, 0x4d, 0x2a, 0x28, 0x55, 0x4a, 0x34, 0x06, 0x06, 0x29,
-    0x42, 0x4f, 0x21, 0x29, 0x58, 0x54, 0x4b, 0x36, 0x1e, 0x02, 0x04, 0x58, 0x84, 0xa0, 0x4c, 0x50, 0x95, 0x74, 0x45,
-    0x02, 0xb4, 0x01, 0x26, 0x40, 0x56, 0x31, 0x28, 0x5a, 0x50, 0x39, 0x01, 0x26, 0x2e, 0x3c, 0x26, 0x17, 0x08, 0x0f,
-    0x2c, 0x46, 0x69, 0x4b, 0x37, 0x5b, 0x49, 0x36, 0x23, 0x11, 0x01, 0x02, 0x2c, 0x55, 0x7d, 0x53, 0x01, 0x2d, 0x44,
-    0x2f, 0x18, 0x01, 0x01, 0x12, 0x27, 0x3f, 0x2d, 0x2d, 0x39, 0x22, 0x14, 0x07, 0x0a, 0x1a, 0x24, 0x2f, 0x3f, 0x52,
-    0x33, 0x57, 0x7e, 0x4f, 0x25, 0x02, 0x01, 0x2e, 0x59, 0x83, 0x57, 0x01, 0x34, 0x4c, 0x31, 0x19, 0x01, 0x10, 0x25,
-    0x40, 0x00, 0x00, 0x01, 0x00, 0xc4, 0xff, 0xeb, 0x04, 0x36, 0x05, 0x40, 0x00, 0x1b, 0x00, 0x64, 0x40, 0x0a, 0x0d,
-    0x01, 0x02, 0x01, 0x0e, 0x01, 0x03, 0x02, 0x02, 0x4a, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x1e, 0x07, 0x01, 0x06,
-    0x00, 0x00, 0x06, 0x66, 0x04, 0x01, 0x01, 0x01, 0x00, 0x59, 0x05, 0x01, 0x00, 0x00, 0x3f, 0x4b, 0x00, 0x02, 0x02,
-    0x03, 0x5b, 0x00, 0x03, 0x03, 0x45, 0x03, 0x4c, 0x1b, 0x40, 0x1d, 0x07, 0x01, 0x06, 0x00, 0x06, 0x72, 0x04, 0x01,
-    0x01, 0x01, 0x00, 0x59, 0x05, 0x01, 0x00, 0x00, 0x3f, 0x4b, 0x00, 0x02, 0x02, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x45,
-    0x03, 0x4c, 0x59, 0x40, 0x0f, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x1b, 0x11, 0x15, 0x25, 0x25, 0x11, 0x11, 0x08, 0x08,
-    0x1a, 0x2b, 0x01, 0x03, 0x21, 0x07, 0x21, 0x03, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27,
-    0x2e, 0x03, 0x37, 0x13, 0x21, 0x37, 0x21, 0x13, 0x02, 0xd4, 0x2e, 0x01, 0x90, 0x19, 0xfe, 0x70, 0x62, 0x05, 0x0b,
-    0x22, 0x3f, 0x30, 0x37, 0x6d, 0x36, 0x11, 0x3f, 0x9a, 0x47, 0x51, 0x70, 0x44, 0x19, 0x07, 0x62, 0xfe, 0xec, 0x19,
-    0x01, 0x13, 0x2e, 0x05, 0x40, 0xfe, 0xfa, 0x8f, 0xfd, 0xb3, 0x2c, 0x4c, 0x38, 0x22, 0x01, 0x02, 0x14, 0x0c, 0x85,
-    0x23, 0x16, 0x02, 0x01, 0x3d, 0x65, 0x85, 0x4a, 0x02, 0x4c, 0x8f, 0x01, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x8d, 0xff, 0xea, 0x04, 0x54, 0x04, 0x3a, 0x00, 0x17, 0x00, 0x3d, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x12, 0x03,
-    0x01, 0x01, 0x01, 0x3f, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5c, 0x04, 0x01, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x1b, 0x40,
-    0x16, 0x03, 0x01, 0x01, 0x01, 0x3f, 0x4b, 0x00, 0x04, 0x04, 0x3d, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5c, 0x00, 0x00,
-    0x00, 0x45, 0x00, 0x4c, 0x59, 0xb7, 0x11, 0x13, 0x25, 0x15, 0x22, 0x05, 0x08, 0x19, 0x2b, 0x25, 0x06, 0x06, 0x27,
-    0x2e, 0x03, 0x37, 0x13, 0x33, 0x03, 0x06, 0x06, 0x16, 0x16, 0x17, 0x16, 0x36, 0x37, 0x13, 0x33, 0x03, 0x23, 0x03,
-    0x0c, 0x40, 0xa6, 0x69, 0x61, 0x7b, 0x43, 0x11, 0x09, 0x6c, 0xb5, 0x6b, 0x06, 0x02, 0x1d, 0x44, 0x3f, 0x64, 0x9a,
-    0x35, 0x87, 0xb6, 0xbc, 0xa3, 0x95, 0x4f, 0x5c, 0x02, 0x02, 0x51, 0x82, 0xa3, 0x53, 0x02, 0x83, 0xfd, 0x7a, 0x32,
-    0x69, 0x56, 0x38, 0x02, 0x03, 0x59, 0x52, 0x03, 0x09, 0xfb, 0xc6, 0x00, 0x00, 0x01, 0x00, 0xae, 0x00, 0x00, 0x04,
-    0x94, 0x04, 0x3b, 0x00, 0x08, 0x00, 0x1b, 0x40, 0x18, 0x01, 0x01, 0x01, 0x00, 0x01, 0x4a, 0x02, 0x01, 0x00, 0x00,
-    0x3f, 0x4b, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x11, 0x11, 0x13, 0x03, 0x08, 0x17, 0x2b, 0x01, 0x17, 0x37, 0x01,
-    0x33, 0x01, 0x23, 0x01, 0x37, 0x02, 0x0c, 0x05, 0x1d, 0x01, 0xa6, 0xc0, 0xfd, 0xaa, 0x8a, 0xfe, 0xfa, 0xae, 0x01,
-    0x0a, 0x44, 0x45, 0x03, 0x2f, 0xfb, 0xc6, 0x04, 0x3a, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x84, 0x00, 0x00, 0x04,
-    0xda, 0x04, 0x3a, 0x00, 0x12, 0x00, 0x22, 0x40, 0x1f, 0x0d, 0x0c, 0x06, 0x01, 0x04, 0x02, 0x00, 0x01, 0x4a, 0x04,
-    0x01, 0x02, 0x00, 0x00, 0x3f, 0x4b, 0x03, 0x01, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x11, 0x14, 0x11, 0x14, 0x13, 0x05,
-    0x08, 0x19, 0x2b, 0x01, 0x07, 0x37, 0x01, 0x33, 0x13, 0x07, 0x37, 0x13, 0x33, 0x01, 0x23, 0x03, 0x37, 0x07, 0x01,
-    0x23, 0x03, 0x33, 0x01, 0x23, 0x06, 0x37, 0x01, 0x1c, 0x75, 0x2f, 0x02, 0x35, 0xef, 0xa4, 0xfe, 0x65, 0x8e, 0x32,
-    0x03, 0x3a, 0xfe, 0xef, 0x8f, 0x24, 0x9c, 0x01, 0x7d, 0x8a, 0x9f, 0x02, 0xa8, 0xfd, 0x42, 0x9a, 0x9e, 0x02, 0xba,
-    0xfb, 0xc6, 0x02, 0xa1, 0x9a, 0xae, 0xfd, 0x73, 0x04, 0x3a, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x04, 0x98, 0x04,
-    0x3a, 0x00, 0x0b, 0x00, 0x1f, 0x40, 0x1c, 0x09, 0x06, 0x03, 0x03, 0x01, 0x00, 0x01, 0x4a, 0x03, 0x01, 0x00, 0x00,
-    0x3f, 0x4b, 0x02, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x12, 0x12, 0x12, 0x11, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x01,
-    0x33, 0x01, 0x01, 0x23, 0x03, 0x01, 0x23, 0x01, 0x01, 0x33, 0x02, 0x61, 0x01, 0x57, 0xe0, 0xfe, 0x1d, 0x01, 0x38,
-    0xc4, 0xe2, 0xfe, 0x9e, 0xdf, 0x01, 0xef, 0xfe, 0xd1, 0xc5, 0x02, 0xaa, 0x01, 0x90, 0xfd, 0xe1, 0xfd, 0xe5, 0x01,
-    0x9b, 0xfe, 0x65, 0x02, 0x2b, 0x02, 0x0f, 0x00, 0x01, 0xff, 0xe4, 0xfe, 0x48, 0x04, 0xbc, 0x04, 0x3a, 0x00, 0x18,
-    0x00, 0x27, 0x40, 0x24, 0x16, 0x0d, 0x01, 0x03, 0x02, 0x00, 0x0c, 0x01, 0x01, 0x02, 0x02, 0x4a, 0x03, 0x01, 0x00,
-    0x00, 0x3f, 0x4b, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x49, 0x01, 0x4c, 0x16, 0x25, 0x25, 0x12, 0x04,
-    0x08, 0x18, 0x2b, 0x01, 0x17, 0x01, 0x33, 0x01, 0x0e, 0x03, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x3e,
-    0x03, 0x37, 0x37, 0x01, 0x33, 0x02, 0x04, 0x15, 0x01, 0xd0, 0xd3, 0xfd, 0x14, 0x1e, 0x4c, 0x5d, 0x6f, 0x41, 0x1d,
-    0x3b, 0x1d, 0x29, 0x16, 0x2c, 0x15, 0x27, 0x42, 0x36, 0x2c, 0x13, 0x67, 0xfe, 0xf1, 0xc1, 0x01, 0x77, 0x78, 0x03,
-    0x3b, 0xfb, 0x1e, 0x34, 0x62, 0x4d, 0x2d, 0x0b, 0x05, 0x99, 0x02, 0x06, 0x01, 0x24, 0x36, 0x41, 0x1d, 0x9c, 0x03,
-    0xfc, 0x00, 0x00, 0x01, 0x00, 0x3d, 0x00, 0x00, 0x04, 0x46, 0x04, 0x3a, 0x00, 0x09, 0x00, 0x1f, 0x40, 0x1c, 0x00,
-    0x02, 0x02, 0x03, 0x59, 0x00, 0x03, 0x03, 0x3f, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x3d, 0x01,
-    0x4c, 0x11, 0x12, 0x11, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x25, 0x21, 0x07, 0x21, 0x37, 0x01, 0x21, 0x37, 0x21, 0x07,
-    0x01, 0x41, 0x02, 0x97, 0x19, 0xfc, 0x7e, 0x17, 0x02, 0xe7, 0xfd, 0x9c, 0x18, 0x03, 0x57, 0x16, 0x97, 0x97, 0x90,
-    0x03, 0x11, 0x99, 0x8b, 0x00, 0x00, 0x00, 0x01, 0x01, 0x34, 0xfe, 0x93, 0x04, 0x56, 0x06, 0x40, 0x00, 0x2a, 0x00,
-    0x32, 0x40, 0x2f, 0x1f, 0x01, 0x01, 0x02, 0x2a, 0x01, 0x00, 0x01, 0x02, 0x4a, 0x00, 0x00, 0x01, 0x00, 0x73, 0x00,
-    0x03, 0x00, 0x04, 0x02, 0x03, 0x04, 0x63, 0x00, 0x02, 0x01, 0x01, 0x02, 0x57, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x00,
-    0x01, 0x02, 0x01, 0x4f, 0x11, 0x17, 0x11, 0x19, 0x10, 0x05, 0x08, 0x19, 0x2b, 0x01, 0x2e, 0x03, 0x37, 0x37, 0x36,
-    0x2e, 0x02, 0x27, 0x37, 0x36, 0x36, 0x37, 0x37, 0x3e, 0x03, 0x37, 0x17, 0x0e, 0x03, 0x07, 0x07, 0x06, 0x06, 0x07,
-    0x1e, 0x03, 0x07, 0x07, 0x06, 0x06, 0x16, 0x16, 0x17, 0x03, 0x2c, 0x59, 0x7c, 0x4a, 0x1b, 0x08, 0x16, 0x07, 0x12,
-    0x35, 0x5a, 0x42, 0x0f, 0x8a, 0xa1, 0x14, 0x16, 0x0c, 0x41, 0x6c, 0x98, 0x63, 0x0a, 0x49, 0x5e, 0x3b, 0x1e, 0x08,
-    0x16, 0x11, 0x8e, 0x78, 0x30, 0x44, 0x28, 0x0d, 0x05, 0x15, 0x06, 0x02, 0x1b, 0x43, 0x3f, 0xfe, 0x93, 0x06, 0x57,
-    0x84, 0xa0, 0x4f, 0xaa, 0x40, 0x63, 0x45, 0x26, 0x03, 0x90, 0x02, 0x87, 0x8b, 0xaa, 0x5c, 0xa5, 0x7e, 0x4f, 0x06,
-    0x75, 0x05, 0x40, 0x63, 0x7a, 0x3d, 0xaa, 0x83, 0xab, 0x33, 0x1a, 0x49, 0x58, 0x65, 0x35, 0xaa, 0x32, 0x74, 0x65,
-    0x49, 0x08, 0x00, 0x00, 0x00, 0x01, 0x01, 0x6f, 0xfe, 0x72, 0x03, 0x23, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x13, 0x40,
-    0x10, 0x00, 0x01, 0x01, 0x3c, 0x4b, 0x00, 0x00, 0x00, 0x41, 0x00, 0x4c, 0x11, 0x10, 0x02, 0x08, 0x16, 0x2b, 0x01,
-    0x23, 0x01, 0x33, 0x02, 0x01, 0x92, 0x01, 0x22, 0x92, 0xfe, 0x72, 0x07, 0x3e, 0x00, 0x00, 0x01, 0x00, 0xb2, 0xfe,
-    0x8f, 0x03, 0xd4, 0x06, 0x3b, 0x00, 0x2a, 0x00, 0x5b, 0x40, 0x0a, 0x16, 0x01, 0x02, 0x01, 0x09, 0x01, 0x03, 0x02,
-    0x02, 0x4a, 0x4b, 0xb0, 0x14, 0x50, 0x58, 0x40, 0x18, 0x00, 0x01, 0x02, 0x01, 0x72, 0x00, 0x02, 0x00, 0x03, 0x00,
-    0x02, 0x03, 0x63, 0x00, 0x00, 0x00, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x41, 0x04, 0x4c, 0x1b, 0x40, 0x1d, 0x00, 0x01,
-    0x02, 0x01, 0x72, 0x00, 0x02, 0x00, 0x03, 0x00, 0x02, 0x03, 0x63, 0x00, 0x00, 0x04, 0x04, 0x00, 0x57, 0x00, 0x00,
-    0x00, 0x04, 0x5b, 0x00, 0x04, 0x00, 0x04, 0x4f, 0x59, 0x40, 0x0c, 0x2a, 0x29, 0x22, 0x21, 0x20, 0x1f, 0x18, 0x17,
-    0x10, 0x05, 0x08, 0x15, 0x2b, 0x17, 0x3e, 0x03, 0x37, 0x37, 0x36, 0x36, 0x37, 0x2e, 0x03, 0x37, 0x37, 0x36, 0x36,
-    0x2e, 0x03, 0x27, 0x37, 0x1e, 0x03, 0x07, 0x07, 0x06, 0x16, 0x17, 0x07, 0x06, 0x06, 0x07, 0x07, 0x0e, 0x03, 0x07,
-    0xb2, 0x43, 0x5d, 0x3e, 0x22, 0x09, 0x16, 0x11, 0x8c, 0x78, 0x30, 0x43, 0x28, 0x0d, 0x05, 0x16, 0x04, 0x07, 0x03,
-    0x0f, 0x24, 0x3c, 0x2d, 0x1d, 0x5a, 0x7b, 0x48, 0x17, 0x09, 0x15, 0x0e, 0x67, 0x83, 0x0f, 0x8a, 0xa2, 0x13, 0x16,
-    0x0c, 0x43, 0x6d, 0x97, 0x61, 0xfc, 0x04, 0x44, 0x65, 0x79, 0x39, 0xa9, 0x82, 0xab, 0x32, 0x1a, 0x4a, 0x59, 0x65,
-    0x35, 0xab, 0x24, 0x4c, 0x4a, 0x44, 0x35, 0x24, 0x05, 0x72, 0x06, 0x56, 0x83, 0xa0, 0x50, 0xab, 0x81, 0x89, 0x06,
-    0x90, 0x04, 0x86, 0x8b, 0xa9, 0x5b, 0xa4, 0x7f, 0x50, 0x06, 0x00, 0x01, 0x00, 0x1c, 0x01, 0x90, 0x04, 0x86, 0x03,
-    0x24, 0x00, 0x27, 0x00, 0x2d, 0x40, 0x2a, 0x27, 0x01, 0x01, 0x02, 0x15, 0x14, 0x02, 0x00, 0x03, 0x02, 0x4a, 0x00,
-    0x02, 0x00, 0x01, 0x03, 0x02, 0x01, 0x63, 0x00, 0x03, 0x00, 0x00, 0x03, 0x57, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00,
-    0x00, 0x03, 0x00, 0x4f, 0x26, 0x29, 0x28, 0x24, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x0e, 0x03, 0x27, 0x22, 0x2e, 0x02,
-    0x27, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x27, 0x3e, 0x03, 0x17, 0x16, 0x16, 0x17, 0x1e, 0x03, 0x33, 0x32,
-    0x3e, 0x02, 0x37, 0x04, 0x86, 0x06, 0x30, 0x52, 0x72, 0x47, 0x2d, 0x50, 0x49, 0x43, 0x20, 0x14, 0x2c, 0x30, 0x35,
-    0x1c, 0x28, 0x40, 0x2e, 0x1f, 0x07, 0x83, 0x07, 0x33, 0x53, 0x71, 0x47, 0x58, 0x93, 0x3f, 0x15, 0x2b, 0x30, 0x35,
-    0x1d, 0x28, 0x41, 0x30, 0x1f, 0x08, 0x02, 0xe6, 0x41, 0x7b, 0x60, 0x3a, 0x01, 0x17, 0x26, 0x33, 0x1d, 0x12, 0x23,
-    0x1d, 0x11, 0x20, 0x33, 0x42, 0x24, 0x11, 0x41, 0x78, 0x5c, 0x36, 0x01, 0x01, 0x51, 0x3a, 0x13, 0x24, 0x1c, 0x11,
-    0x22, 0x37, 0x45, 0x24, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x51, 0xfe, 0x8c, 0x03, 0x07, 0x04, 0x51, 0x00, 0x03,
-    0x00, 0x13, 0x00, 0x3b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x15, 0x00, 0x02, 0x02, 0x03, 0x5b, 0x00, 0x03, 0x03,
-    0x47, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x41, 0x01, 0x4c, 0x1b, 0x40, 0x12, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x01, 0x5d, 0x00, 0x02, 0x02, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x47, 0x02, 0x4c, 0x59, 0xb6, 0x26, 0x23,
-    0x11, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x33, 0x03, 0x23, 0x01, 0x06, 0x06, 0x07, 0x06, 0x2e, 0x02, 0x35, 0x36,
-    0x36, 0x37, 0x36, 0x1e, 0x02, 0x01, 0xfc, 0xb5, 0xab, 0xb5, 0x01, 0xb6, 0x02, 0x3f, 0x30, 0x18, 0x29, 0x1e, 0x10,
-    0x01, 0x3d, 0x32, 0x19, 0x29, 0x1e, 0x10, 0x02, 0x63, 0xfc, 0x29, 0x05, 0x55, 0x31, 0x3e, 0x02, 0x01, 0x0f, 0x1d,
-    0x28, 0x18, 0x32, 0x41, 0x02, 0x01, 0x10, 0x1e, 0x2a, 0x00, 0x00, 0x01, 0x00, 0x7a, 0xff, 0x0b, 0x04, 0x2f, 0x05,
-    0x26, 0x00, 0x33, 0x00, 0x49, 0x40, 0x46, 0x1c, 0x01, 0x05, 0x03, 0x0e, 0x01, 0x02, 0x00, 0x02, 0x4a, 0x00, 0x04,
-    0x05, 0x01, 0x05, 0x04, 0x01, 0x70, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x6e, 0x00, 0x03, 0x00, 0x05, 0x04, 0x03,
-    0x05, 0x63, 0x06, 0x01, 0x00, 0x02, 0x02, 0x00, 0x57, 0x06, 0x01, 0x00, 0x00, 0x02, 0x59, 0x00, 0x02, 0x00, 0x02,
-    0x4d, 0x01, 0x00, 0x28, 0x26, 0x22, 0x21, 0x1b, 0x1a, 0x0d, 0x0c, 0x06, 0x05, 0x00, 0x33, 0x01, 0x33, 0x07, 0x08,
-    0x14, 0x2b, 0x25, 0x16, 0x3e, 0x02, 0x37, 0x37, 0x0e, 0x03, 0x07, 0x07, 0x23, 0x37, 0x2e, 0x03, 0x37, 0x37, 0x3e,
-    0x03, 0x37, 0x37, 0x33, 0x07, 0x1e, 0x03, 0x07, 0x27, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x07, 0x06,
-    0x14, 0x1e, 0x03, 0x02, 0x19, 0x31, 0x60, 0x4f, 0x38, 0x0b, 0xab, 0x09, 0x4b, 0x71, 0x8c, 0x48, 0x27, 0xb5, 0x2a,
-    0x51, 0x73, 0x45, 0x19, 0x09, 0x05, 0x0c, 0x4b, 0x77, 0xa1, 0x63, 0x27, 0xb5, 0x28, 0x42, 0x6c, 0x4c, 0x27, 0x03,
-    0xaa, 0x02, 0x1c, 0x39, 0x52, 0x34, 0x53, 0x7f, 0x5a, 0x37, 0x0a, 0x05, 0x05, 0x0f, 0x20, 0x36, 0x4d, 0x81, 0x01,
-    0x1d, 0x37, 0x4f, 0x31, 0x01, 0x4b, 0x7e, 0x5d, 0x39, 0x08, 0xe3, 0xf2, 0x17, 0x66, 0x8c, 0xa7, 0x58, 0x2b, 0x63,
-    0xb5, 0x91, 0x62, 0x0e, 0xdd, 0xe4, 0x0f, 0x44, 0x63, 0x7e, 0x49, 0x01, 0x32, 0x56, 0x41, 0x26, 0x02, 0x03, 0x43,
-    0x70, 0x8e, 0x49, 0x2a, 0x2b, 0x5a, 0x55, 0x4d, 0x39, 0x24, 0x00, 0x01, 0x00, 0x09, 0x00, 0x00, 0x04, 0x97, 0x05,
-    0xc6, 0x00, 0x2b, 0x00, 0x3e, 0x40, 0x3b, 0x00, 0x06, 0x07, 0x04, 0x07, 0x06, 0x04, 0x70, 0x08, 0x01, 0x04, 0x0a,
-    0x09, 0x02, 0x03, 0x00, 0x04, 0x03, 0x61, 0x00, 0x07, 0x07, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x44, 0x4b, 0x02, 0x01,
-    0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x2b, 0x15, 0x24, 0x14,
-    0x25, 0x11, 0x16, 0x11, 0x11, 0x14, 0x0b, 0x08, 0x1d, 0x2b, 0x01, 0x07, 0x06, 0x06, 0x07, 0x25, 0x07, 0x21, 0x37,
-    0x17, 0x3e, 0x03, 0x37, 0x37, 0x23, 0x37, 0x33, 0x13, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x27, 0x36, 0x2e, 0x02,
-    0x27, 0x26, 0x0e, 0x02, 0x07, 0x03, 0x21, 0x07, 0x01, 0xc6, 0x1e, 0x0a, 0x33, 0x2e, 0x02, 0xd0, 0x1b, 0xfc, 0x17,
-    0x1b, 0x41, 0x24, 0x32, 0x21, 0x13, 0x05, 0x1e, 0xa0, 0x1a, 0x9c, 0x21, 0x0c, 0x53, 0x82, 0xaa, 0x63, 0x57, 0x85,
-    0x5a, 0x2a, 0x04, 0xb6, 0x03, 0x13, 0x30, 0x4d, 0x35, 0x3d, 0x63, 0x48, 0x2d, 0x08, 0x22, 0x01, 0x37, 0x1b, 0x02,
-    0x72, 0xe1, 0x47, 0x7e, 0x37, 0x02, 0x97, 0x96, 0x01, 0x0e, 0x37, 0x46, 0x4d, 0x23, 0xe2, 0x98, 0x01, 0x04, 0x61,
-    0xa2, 0x75, 0x40, 0x02, 0x02, 0x3b, 0x66, 0x8c, 0x55, 0x01, 0x32, 0x56, 0x3f, 0x24, 0x02, 0x02, 0x2f, 0x51, 0x69,
-    0x37, 0xfe, 0xfa, 0x98, 0x00, 0x00, 0x02, 0x00, 0x10, 0xff, 0xe5, 0x04, 0xaa, 0x04, 0x39, 0x00, 0x22, 0x00, 0x36,
-    0x00, 0x61, 0x40, 0x20, 0x19, 0x17, 0x11, 0x0f, 0x04, 0x03, 0x01, 0x20, 0x1a, 0x0e, 0x09, 0x04, 0x02, 0x03, 0x21,
-    0x08, 0x06, 0x03, 0x00, 0x02, 0x03, 0x4a, 0x18, 0x10, 0x02, 0x01, 0x48, 0x22, 0x07, 0x02, 0x00, 0x47, 0x4b, 0xb0,
-    0x1f, 0x50, 0x58, 0x40, 0x15, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x3f, 0x4b, 0x00, 0x02, 0x02, 0x00,
-    0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x1b, 0x40, 0x13, 0x00, 0x01, 0x00, 0x03, 0x02, 0x01, 0x03, 0x63, 0x00,
-    0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x59, 0x40, 0x09, 0x33, 0x31, 0x29, 0x27, 0x2f, 0x22,
-    0x04, 0x08, 0x16, 0x2b, 0x25, 0x06, 0x06, 0x27, 0x26, 0x26, 0x27, 0x07, 0x27, 0x37, 0x26, 0x26, 0x37, 0x36, 0x37,
-    0x27, 0x37, 0x17, 0x36, 0x36, 0x17, 0x16, 0x16, 0x17, 0x37, 0x17, 0x07, 0x16, 0x16, 0x07, 0x06, 0x06, 0x07, 0x17,
-    0x07, 0x01, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x03, 0x39,
-    0x45, 0x96, 0x55, 0x4c, 0x8b, 0x3b, 0x78, 0x6f, 0x80, 0x15, 0x0d, 0x09, 0x18, 0x71, 0x60, 0x8e, 0x5a, 0x42, 0x8f,
-    0x4f, 0x48, 0x85, 0x38, 0x8d, 0x70, 0x8e, 0x17, 0x10, 0x0a, 0x0b, 0x3f, 0x31, 0x5c, 0x8f, 0xfd, 0x94, 0x08, 0x18,
-    0x3e, 0x65, 0x45, 0x4c, 0x82, 0x63, 0x3f, 0x09, 0x07, 0x17, 0x3d, 0x64, 0x45, 0x4c, 0x83, 0x64, 0x3f, 0x52, 0x30,
-    0x38, 0x02, 0x01, 0x34, 0x32, 0x6d, 0x90, 0x6c, 0x45, 0x8d, 0x48, 0xb0, 0x8b, 0x81, 0x80, 0x79, 0x2a, 0x31, 0x01,
-    0x01, 0x30, 0x2d, 0x7e, 0x92, 0x79, 0x47, 0x92, 0x4b, 0x53, 0x94, 0x43, 0x7c, 0x7f, 0x02, 0x15, 0x3e, 0x7c, 0x66,
-    0x42, 0x02, 0x02, 0x40, 0x6a, 0x88, 0x46, 0x3d, 0x7d, 0x65, 0x42, 0x02, 0x02, 0x3f, 0x6a, 0x88, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x56, 0x00, 0x00, 0x05, 0x22, 0x05, 0xb0, 0x00, 0x17, 0x00, 0x33, 0x40, 0x30, 0x09, 0x01, 0x01,
-    0x08, 0x01, 0x02, 0x03, 0x01, 0x02, 0x62, 0x07, 0x01, 0x03, 0x06, 0x01, 0x04, 0x05, 0x03, 0x04, 0x61, 0x0a, 0x01,
-    0x00, 0x00, 0x3c, 0x4b, 0x00, 0x05, 0x05, 0x3d, 0x05, 0x4c, 0x17, 0x16, 0x15, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x12, 0x11, 0x11, 0x11, 0x0b, 0x08, 0x1d, 0x2b, 0x01, 0x01, 0x33, 0x01, 0x21, 0x07, 0x25, 0x07, 0x07, 0x21, 0x07,
-    0x21, 0x03, 0x23, 0x13, 0x21, 0x37, 0x21, 0x37, 0x21, 0x37, 0x21, 0x01, 0x33, 0x02, 0x6d, 0x01, 0xdb, 0xda, 0xfd,
-    0xeb, 0x01, 0x2f, 0x16, 0xfe, 0x91, 0x06, 0x22, 0x01, 0x7b, 0x16, 0xfe, 0x88, 0x39, 0xb5, 0x39, 0xfe, 0x8f, 0x15,
-    0x01, 0x70, 0x1e, 0xfe, 0x8f, 0x15, 0x01, 0x39, 0xfe, 0xe4, 0xc3, 0x03, 0x0c, 0x02, 0xa4, 0xfd, 0x30, 0x79, 0x03,
-    0x07, 0xa5, 0x78, 0xfe, 0xba, 0x01, 0x46, 0x78, 0xa9, 0x79, 0x02, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x58,
-    0xfe, 0xf2, 0x03, 0x39, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x24, 0x40, 0x21, 0x00, 0x00, 0x04, 0x01, 0x01,
-    0x00, 0x01, 0x5d, 0x00, 0x02, 0x02, 0x03, 0x59, 0x00, 0x03, 0x03, 0x3c, 0x02, 0x4c, 0x00, 0x00, 0x07, 0x06, 0x05,
-    0x04, 0x00, 0x03, 0x00, 0x03, 0x11, 0x05, 0x08, 0x15, 0x2b, 0x01, 0x13, 0x33, 0x03, 0x13, 0x23, 0x13, 0x33, 0x01,
-    0x58, 0x8a, 0xb5, 0x8a, 0xa8, 0xb5, 0x84, 0xb5, 0xfe, 0xf2, 0x03, 0x17, 0xfc, 0xe9, 0x03, 0xc8, 0x02, 0xf6, 0x00,
-    0x00, 0x02, 0xff, 0xd7, 0xfe, 0x0e, 0x04, 0x92, 0x05, 0xc5, 0x00, 0x53, 0x00, 0x6d, 0x00, 0x39, 0x40, 0x36, 0x62,
-    0x57, 0x2e, 0x05, 0x04, 0x01, 0x04, 0x01, 0x4a, 0x00, 0x04, 0x05, 0x01, 0x05, 0x04, 0x01, 0x70, 0x00, 0x01, 0x02,
-    0x05, 0x01, 0x02, 0x6e, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x5f, 0x00, 0x05, 0x05, 0x03, 0x5b, 0x00, 0x03, 0x03,
-    0x44, 0x05, 0x4c, 0x44, 0x42, 0x3e, 0x3d, 0x39, 0x37, 0x24, 0x14, 0x2c, 0x06, 0x08, 0x17, 0x2b, 0x01, 0x0e, 0x03,
-    0x07, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x37, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37,
-    0x36, 0x2e, 0x04, 0x27, 0x2e, 0x03, 0x37, 0x3e, 0x03, 0x37, 0x26, 0x26, 0x37, 0x3e, 0x05, 0x17, 0x1e, 0x03, 0x07,
-    0x23, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x06, 0x1e, 0x04, 0x17, 0x1e, 0x03, 0x25, 0x26, 0x26, 0x27,
-    0x06, 0x06, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x16, 0x17, 0x3e, 0x03, 0x37, 0x36, 0x2e, 0x04, 0x04, 0x35, 0x05,
-    0x25, 0x3d, 0x50, 0x2e, 0x38, 0x29, 0x06, 0x08, 0x62, 0x93, 0xb5, 0x5a, 0x64, 0xaa, 0x7a, 0x40, 0x05, 0xb9, 0x05,
-    0x24, 0x48, 0x6a, 0x41, 0x35, 0x6f, 0x5f, 0x42, 0x08, 0x05, 0x15, 0x2b, 0x3c, 0x43, 0x44, 0x1e, 0x4e, 0x93, 0x6f,
-    0x3e, 0x08, 0x04, 0x26, 0x3b, 0x4e, 0x2e, 0x36, 0x26, 0x06, 0x05, 0x31, 0x4d, 0x63, 0x71, 0x79, 0x3b, 0x64, 0xa1,
-    0x6e, 0x37, 0x06, 0xb4, 0x04, 0x1d, 0x40, 0x60, 0x3f, 0x36, 0x6f, 0x5e, 0x41, 0x09, 0x06, 0x14, 0x29, 0x3a, 0x43,
-    0x46, 0x20, 0x4d, 0x94, 0x70, 0x3e, 0xfe, 0x23, 0x26, 0x4c, 0x25, 0x4c, 0x68, 0x0c, 0x09, 0x31, 0x57, 0x6d, 0x31,
-    0x26, 0x4a, 0x25, 0x25, 0x42, 0x35, 0x23, 0x06, 0x06, 0x15, 0x2c, 0x3e, 0x44, 0x45, 0x01, 0xb7, 0x36, 0x57, 0x46,
-    0x37, 0x16, 0x38, 0x89, 0x4e, 0x65, 0x90, 0x5b, 0x2a, 0x02, 0x02, 0x38, 0x6c, 0xa0, 0x6a, 0x02, 0x42, 0x68, 0x48,
-    0x26, 0x01, 0x01, 0x18, 0x35, 0x55, 0x3b, 0x28, 0x3e, 0x31, 0x25, 0x1d, 0x16, 0x0a, 0x1a, 0x42, 0x5f, 0x87, 0x5f,
-    0x34, 0x57, 0x46, 0x38, 0x16, 0x39, 0x8a, 0x4d, 0x42, 0x6c, 0x54, 0x3d, 0x27, 0x11, 0x01, 0x02, 0x3b, 0x6d, 0x9f,
-    0x66, 0x3d, 0x65, 0x4a, 0x2a, 0x02, 0x01, 0x17, 0x35, 0x55, 0x3c, 0x2a, 0x40, 0x31, 0x24, 0x1c, 0x16, 0x0a, 0x1a,
-    0x41, 0x5f, 0x87, 0x9e, 0x0c, 0x1a, 0x0e, 0x15, 0x60, 0x51, 0x40, 0x54, 0x38, 0x24, 0x10, 0x0c, 0x1a, 0x0e, 0x0b,
-    0x23, 0x31, 0x40, 0x28, 0x28, 0x40, 0x32, 0x26, 0x1e, 0x17, 0x00, 0x00, 0x02, 0x01, 0x8e, 0x04, 0xee, 0x04, 0x05,
-    0x05, 0xc7, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x17, 0x40, 0x14, 0x03, 0x01, 0x01, 0x01, 0x00, 0x5b, 0x02, 0x01, 0x00,
-    0x00, 0x44, 0x01, 0x4c, 0x24, 0x24, 0x24, 0x22, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x34, 0x36, 0x37, 0x36, 0x16, 0x07,
-    0x06, 0x06, 0x07, 0x06, 0x26, 0x25, 0x36, 0x36, 0x37, 0x36, 0x16, 0x15, 0x06, 0x06, 0x07, 0x06, 0x26, 0x01, 0x8f,
-    0x3b, 0x2f, 0x2e, 0x3e, 0x01, 0x01, 0x3c, 0x2e, 0x2f, 0x3c, 0x01, 0xa1, 0x01, 0x3b, 0x2f, 0x2f, 0x3c, 0x01, 0x3c,
-    0x2f, 0x2e, 0x3c, 0x05, 0x59, 0x2e, 0x3d, 0x02, 0x01, 0x3b, 0x2f, 0x2e, 0x3c, 0x02, 0x01, 0x3a, 0x2d, 0x2e, 0x3e,
-    0x02, 0x01, 0x3b, 0x30, 0x2e, 0x3c, 0x02, 0x01, 0x3a, 0x00, 0x03, 0x00, 0x43, 0xff, 0xe9, 0x04, 0x5f, 0x04, 0x50,
-    0x00, 0x25, 0x00, 0x3b, 0x00, 0x55, 0x00, 0x55, 0x40, 0x52, 0x1b, 0x08, 0x02, 0x05, 0x02, 0x01, 0x4a, 0x00, 0x02,
-    0x03, 0x05, 0x03, 0x02, 0x05, 0x70, 0x0a, 0x01, 0x05, 0x04, 0x03, 0x05, 0x04, 0x6e, 0x00, 0x01, 0x00, 0x03, 0x02,
-    0x01, 0x03, 0x63, 0x00, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x63, 0x00, 0x07, 0x07, 0x08, 0x5b, 0x00, 0x08, 0x08,
-    0x47, 0x4b, 0x00, 0x06, 0x06, 0x09, 0x5b, 0x00, 0x09, 0x09, 0x45, 0x09, 0x4c, 0x00, 0x00, 0x52, 0x50, 0x44, 0x42,
-    0x36, 0x34, 0x2c, 0x2a, 0x00, 0x25, 0x00, 0x25, 0x29, 0x22, 0x12, 0x29, 0x22, 0x0b, 0x08, 0x19, 0x2b, 0x01, 0x06,
-    0x06, 0x27, 0x2e, 0x03, 0x37, 0x37, 0x3e, 0x03, 0x17, 0x16, 0x16, 0x07, 0x27, 0x36, 0x26, 0x23, 0x22, 0x0e, 0x02,
-    0x07, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x25, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37,
-    0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x04, 0x07, 0x3e, 0x05, 0x17, 0x1e, 0x05, 0x07, 0x0e, 0x05, 0x27, 0x2e, 0x03,
-    0x03, 0x2d, 0x0e, 0x86, 0x73, 0x3d, 0x57, 0x36, 0x17, 0x03, 0x08, 0x06, 0x2b, 0x48, 0x65, 0x3f, 0x6f, 0x72, 0x05,
-    0x6d, 0x04, 0x34, 0x45, 0x29, 0x3c, 0x29, 0x18, 0x04, 0x08, 0x02, 0x07, 0x1a, 0x30, 0x27, 0x23, 0x32, 0x24, 0x17,
-    0x07, 0xfd, 0xe3, 0x0a, 0x27, 0x5b, 0x8e, 0x5d, 0x64, 0xaf, 0x86, 0x55, 0x0b, 0x0a, 0x28, 0x5c, 0x8d, 0x5d, 0x42,
-    0x7a, 0x6c, 0x59, 0x44, 0x2c, 0x5e, 0x08, 0x32, 0x50, 0x6b, 0x7f, 0x90, 0x4f, 0x4a, 0x7f, 0x66, 0x4d, 0x30, 0x12,
-    0x07, 0x08, 0x32, 0x50, 0x6a, 0x7f, 0x91, 0x4f, 0x70, 0xad, 0x72, 0x33, 0x01, 0xbb, 0x6f, 0x7f, 0x03, 0x01, 0x32,
-    0x50, 0x68, 0x37, 0x57, 0x3a, 0x6b, 0x51, 0x2f, 0x01, 0x02, 0x7e, 0x6d, 0x01, 0x3f, 0x4c, 0x22, 0x36, 0x45, 0x24,
-    0x5a, 0x20, 0x43, 0x38, 0x24, 0x01, 0x01, 0x14, 0x24, 0x33, 0x1f, 0x5c, 0x56, 0xa6, 0x82, 0x52, 0x02, 0x03, 0x4f,
-    0x87, 0xb0, 0x5f, 0x56, 0xa4, 0x81, 0x50, 0x02, 0x02, 0x22, 0x40, 0x5a, 0x6b, 0x79, 0x3e, 0x4b, 0x90, 0x7f, 0x6a,
-    0x4c, 0x29, 0x02, 0x01, 0x2d, 0x4c, 0x68, 0x7a, 0x87, 0x45, 0x4c, 0x90, 0x80, 0x6b, 0x4c, 0x2a, 0x02, 0x02, 0x60,
-    0x9b, 0xc6, 0x00, 0x00, 0x02, 0x01, 0x47, 0x02, 0xb3, 0x03, 0xe6, 0x05, 0xc5, 0x00, 0x28, 0x00, 0x37, 0x00, 0xba,
-    0x4b, 0xb0, 0x26, 0x50, 0x58, 0xb5, 0x02, 0x01, 0x00, 0x06, 0x01, 0x4a, 0x1b, 0xb5, 0x02, 0x01, 0x05, 0x06, 0x01,
-    0x4a, 0x59, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x27, 0x00, 0x03, 0x02, 0x01, 0x02, 0x03, 0x01, 0x70, 0x09, 0x01,
-    0x06, 0x08, 0x05, 0x02, 0x00, 0x06, 0x00, 0x5f, 0x00, 0x02, 0x02, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x44, 0x4b, 0x00,
-    0x07, 0x07, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x47, 0x07, 0x4c, 0x1b, 0x4b, 0xb0, 0x26, 0x50, 0x58, 0x40, 0x25, 0x00,
-    0x03, 0x02, 0x01, 0x02, 0x03, 0x01, 0x70, 0x00, 0x01, 0x00, 0x07, 0x06, 0x01, 0x07, 0x63, 0x09, 0x01, 0x06, 0x08,
-    0x05, 0x02, 0x00, 0x06, 0x00, 0x5f, 0x00, 0x02, 0x02, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x44, 0x02, 0x4c, 0x1b, 0x40,
-    0x2c, 0x00, 0x03, 0x02, 0x01, 0x02, 0x03, 0x01, 0x70, 0x08, 0x01, 0x05, 0x06, 0x00, 0x06, 0x05, 0x00, 0x70, 0x00,
-    0x01, 0x00, 0x07, 0x06, 0x01, 0x07, 0x63, 0x09, 0x01, 0x06, 0x00, 0x00, 0x06, 0x00, 0x5f, 0x00, 0x02, 0x02, 0x04,
-    0x5b, 0x00, 0x04, 0x04, 0x44, 0x02, 0x4c, 0x59, 0x59, 0x40, 0x16, 0x2a, 0x29, 0x00, 0x00, 0x2f, 0x2d, 0x29, 0x37,
-    0x2a, 0x37, 0x00, 0x28, 0x00, 0x28, 0x24, 0x12, 0x25, 0x28, 0x24, 0x0a, 0x08, 0x19, 0x2b, 0x01, 0x26, 0x37, 0x06,
-    0x06, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x3e, 0x03, 0x33, 0x17, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x06, 0x07, 0x27,
-    0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x03, 0x06, 0x06, 0x17, 0x25, 0x32, 0x36, 0x37, 0x37, 0x23, 0x0e, 0x03, 0x07,
-    0x06, 0x1e, 0x02, 0x03, 0x0d, 0x06, 0x03, 0x2d, 0x74, 0x46, 0x32, 0x52, 0x3a, 0x1e, 0x03, 0x03, 0x44, 0x66, 0x7b,
-    0x3b, 0x8a, 0x08, 0x03, 0x07, 0x16, 0x29, 0x1e, 0x39, 0x53, 0x10, 0x9c, 0x09, 0x3d, 0x59, 0x6e, 0x39, 0x3e, 0x60,
-    0x3f, 0x1d, 0x06, 0x31, 0x08, 0x03, 0x07, 0xfe, 0xaa, 0x38, 0x68, 0x21, 0x13, 0x81, 0x1d, 0x3e, 0x36, 0x26, 0x04,
-    0x03, 0x10, 0x1e, 0x28, 0x02, 0xc0, 0x31, 0x30, 0x34, 0x3a, 0x1f, 0x39, 0x51, 0x33, 0x46, 0x5c, 0x37, 0x16, 0x01,
-    0x35, 0x1b, 0x31, 0x24, 0x15, 0x01, 0x02, 0x32, 0x38, 0x0b, 0x3d, 0x59, 0x3a, 0x1a, 0x01, 0x01, 0x29, 0x48, 0x65,
-    0x3d, 0xfe, 0xc6, 0x2e, 0x59, 0x2e, 0x79, 0x38, 0x2d, 0x6e, 0x01, 0x0d, 0x1c, 0x2e, 0x22, 0x18, 0x22, 0x15, 0x0a,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0xbd, 0x00, 0x76, 0x03, 0xf7, 0x03, 0x92, 0x02, 0x27, 0x01, 0x74, 0xff, 0x47, 0xff,
-    0xdd, 0x01, 0x07, 0x01, 0x74, 0x00, 0x8c, 0xff, 0xdd, 0x00, 0x12, 0xb1, 0x00, 0x01, 0xb8, 0xff, 0xdd, 0xb0, 0x33,
-    0x2b, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xdd, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0x01, 0x00, 0xbd, 0x01, 0x77, 0x04,
-    0x00, 0x03, 0x20, 0x00, 0x05, 0x00, 0x3e, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x16, 0x00, 0x00, 0x01, 0x01, 0x00,
-    0x67, 0x00, 0x02, 0x01, 0x01, 0x02, 0x55, 0x00, 0x02, 0x02, 0x01, 0x59, 0x00, 0x01, 0x02, 0x01, 0x4d, 0x1b, 0x40,
-    0x15, 0x00, 0x00, 0x01, 0x00, 0x73, 0x00, 0x02, 0x01, 0x01, 0x02, 0x55, 0x00, 0x02, 0x02, 0x01, 0x59, 0x00, 0x01,
-    0x02, 0x01, 0x4d, 0x59, 0xb5, 0x11, 0x11, 0x10, 0x03, 0x08, 0x17, 0x2b, 0x01, 0x23, 0x13, 0x21, 0x37, 0x21, 0x03,
-    0xb6, 0xb5, 0x2f, 0xfd, 0x8d, 0x1d, 0x03, 0x26, 0x01, 0x77, 0x01, 0x08, 0xa1, 0x00, 0x04, 0x00, 0x40, 0xff, 0xe9,
-    0x04, 0x5f, 0x04, 0x4f, 0x00, 0x17, 0x00, 0x2d, 0x00, 0x3f, 0x00, 0x4c, 0x00, 0x50, 0x40, 0x4d, 0x37, 0x01, 0x08,
-    0x09, 0x3c, 0x01, 0x07, 0x08, 0x02, 0x4a, 0x06, 0x01, 0x04, 0x07, 0x02, 0x07, 0x04, 0x02, 0x70, 0x00, 0x05, 0x00,
-    0x09, 0x08, 0x05, 0x09, 0x63, 0x00, 0x08, 0x0a, 0x01, 0x07, 0x04, 0x08, 0x07, 0x61, 0x00, 0x03, 0x03, 0x00, 0x5b,
-    0x00, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x45, 0x01, 0x4c, 0x2e, 0x2e, 0x4c,
-    0x4a, 0x42, 0x40, 0x2e, 0x3f, 0x2e, 0x3f, 0x1a, 0x21, 0x15, 0x2a, 0x28, 0x2a, 0x26, 0x0b, 0x08, 0x1b, 0x2b, 0x13,
-    0x3e, 0x05, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x05, 0x27, 0x2e, 0x03, 0x37, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x04,
-    0x37, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x05, 0x07, 0x23, 0x13, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07,
-    0x13, 0x23, 0x27, 0x27, 0x33, 0x3e, 0x03, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x4b, 0x07, 0x33, 0x4f, 0x6b, 0x7f,
-    0x91, 0x4f, 0x70, 0xad, 0x72, 0x32, 0x0a, 0x08, 0x32, 0x50, 0x6a, 0x7f, 0x91, 0x4f, 0x6f, 0xad, 0x72, 0x34, 0x62,
-    0x0a, 0x28, 0x5c, 0x8d, 0x5d, 0x42, 0x7a, 0x6c, 0x59, 0x44, 0x2c, 0x07, 0x0a, 0x27, 0x5c, 0x8e, 0x5d, 0x64, 0xae,
-    0x86, 0x56, 0x01, 0x31, 0x29, 0x6a, 0x64, 0xc7, 0x2b, 0x4e, 0x3b, 0x20, 0x03, 0x03, 0x1b, 0x2b, 0x36, 0x1c, 0x5f,
-    0x67, 0x4d, 0x6b, 0x6f, 0x16, 0x2c, 0x24, 0x1a, 0x04, 0x05, 0x0f, 0x1e, 0x2b, 0x18, 0x6a, 0x02, 0x15, 0x4b, 0x90,
-    0x80, 0x6a, 0x4c, 0x29, 0x02, 0x03, 0x5f, 0x9a, 0xc5, 0x69, 0x4b, 0x90, 0x7f, 0x6b, 0x4c, 0x29, 0x02, 0x03, 0x5f,
-    0x9a, 0xc5, 0x68, 0x56, 0xa5, 0x81, 0x51, 0x02, 0x02, 0x23, 0x40, 0x5a, 0x6c, 0x79, 0x3f, 0x56, 0xa4, 0x81, 0x51,
-    0x02, 0x03, 0x4e, 0x85, 0xaf, 0x8e, 0xfd, 0x02, 0x7b, 0x01, 0x01, 0x16, 0x2c, 0x45, 0x31, 0x21, 0x34, 0x27, 0x1c,
-    0x0b, 0xfe, 0xe2, 0xfd, 0x61, 0x01, 0x0c, 0x16, 0x23, 0x18, 0x1c, 0x24, 0x14, 0x08, 0x01, 0x01, 0x00, 0x00, 0x01,
-    0x01, 0x68, 0x05, 0x21, 0x04, 0x35, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x13, 0x40, 0x10, 0x00, 0x00, 0x00, 0x01, 0x59,
-    0x00, 0x01, 0x01, 0x3c, 0x00, 0x4c, 0x11, 0x10, 0x02, 0x08, 0x16, 0x2b, 0x01, 0x21, 0x37, 0x21, 0x04, 0x1e, 0xfd,
-    0x4a, 0x17, 0x02, 0xb6, 0x05, 0x21, 0x8f, 0x00, 0x00, 0x02, 0x01, 0xc6, 0x03, 0xbe, 0x03, 0xb6, 0x05, 0xc6, 0x00,
-    0x13, 0x00, 0x27, 0x00, 0x1f, 0x40, 0x1c, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x44, 0x4b, 0x00, 0x01,
-    0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x3f, 0x01, 0x4c, 0x28, 0x28, 0x28, 0x24, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x3e,
-    0x03, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x06, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37,
-    0x36, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x01, 0xc9, 0x03, 0x2d, 0x4a, 0x62, 0x37, 0x32, 0x51, 0x39, 0x1e, 0x03,
-    0x03, 0x2c, 0x48, 0x60, 0x36, 0x32, 0x54, 0x3b, 0x1f, 0x7d, 0x02, 0x0e, 0x1d, 0x2a, 0x1a, 0x1b, 0x31, 0x25, 0x17,
-    0x02, 0x02, 0x0c, 0x1b, 0x29, 0x1a, 0x1c, 0x32, 0x27, 0x18, 0x04, 0xb7, 0x35, 0x63, 0x4b, 0x2c, 0x01, 0x01, 0x2b,
-    0x46, 0x5a, 0x30, 0x35, 0x61, 0x49, 0x2c, 0x01, 0x01, 0x29, 0x44, 0x59, 0x34, 0x19, 0x2c, 0x22, 0x14, 0x17, 0x25,
-    0x30, 0x1b, 0x18, 0x2e, 0x24, 0x16, 0x18, 0x27, 0x32, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x60, 0x00, 0x01, 0x04,
-    0x39, 0x04, 0xf3, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x30, 0x40, 0x2d, 0x00, 0x05, 0x00, 0x05, 0x72, 0x00, 0x02, 0x01,
-    0x07, 0x01, 0x02, 0x07, 0x70, 0x04, 0x01, 0x00, 0x03, 0x01, 0x01, 0x02, 0x00, 0x01, 0x62, 0x00, 0x07, 0x07, 0x06,
-    0x59, 0x00, 0x06, 0x06, 0x3d, 0x06, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x08, 0x08, 0x1c, 0x2b,
-    0x01, 0x21, 0x07, 0x21, 0x03, 0x23, 0x13, 0x21, 0x37, 0x21, 0x13, 0x33, 0x13, 0x21, 0x37, 0x21, 0x02, 0xd8, 0x01,
-    0x61, 0x18, 0xfe, 0xa0, 0x41, 0xa5, 0x42, 0xfe, 0x8a, 0x18, 0x01, 0x75, 0x41, 0xa4, 0x72, 0xfc, 0xd5, 0x1b, 0x03,
-    0x2b, 0x03, 0x57, 0x98, 0xfe, 0x62, 0x01, 0x9e, 0x98, 0x01, 0x9c, 0xfb, 0x0e, 0x97, 0x00, 0x01, 0x01, 0x4f, 0x02,
-    0x9b, 0x03, 0xd8, 0x05, 0xbe, 0x00, 0x20, 0x00, 0x25, 0x40, 0x22, 0x00, 0x02, 0x01, 0x04, 0x01, 0x02, 0x04, 0x70,
-    0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x5d, 0x00, 0x01, 0x01, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x44, 0x01, 0x4c, 0x1a,
-    0x24, 0x12, 0x29, 0x10, 0x05, 0x08, 0x19, 0x2b, 0x01, 0x21, 0x37, 0x01, 0x3e, 0x03, 0x37, 0x36, 0x26, 0x27, 0x26,
-    0x06, 0x07, 0x07, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x07, 0x21, 0x03, 0x96, 0xfd, 0xb9, 0x15,
-    0x01, 0x3c, 0x15, 0x30, 0x2c, 0x20, 0x04, 0x07, 0x36, 0x2f, 0x42, 0x4f, 0x0e, 0x9b, 0x07, 0x35, 0x54, 0x6c, 0x3e,
-    0x34, 0x5f, 0x46, 0x28, 0x03, 0x03, 0x2c, 0x41, 0x4d, 0x23, 0xc3, 0x01, 0x7b, 0x02, 0x9b, 0x74, 0x01, 0x09, 0x12,
-    0x2a, 0x30, 0x36, 0x1d, 0x30, 0x36, 0x01, 0x01, 0x4c, 0x3d, 0x01, 0x3e, 0x62, 0x45, 0x24, 0x01, 0x01, 0x1d, 0x39,
-    0x56, 0x39, 0x31, 0x55, 0x4a, 0x40, 0x1b, 0x91, 0x00, 0x00, 0x00, 0x01, 0x01, 0x6b, 0x02, 0x8e, 0x03, 0xe5, 0x05,
-    0xbc, 0x00, 0x3a, 0x00, 0x44, 0x40, 0x41, 0x1e, 0x01, 0x07, 0x00, 0x01, 0x4a, 0x00, 0x02, 0x01, 0x00, 0x01, 0x02,
-    0x00, 0x70, 0x00, 0x05, 0x07, 0x06, 0x07, 0x05, 0x06, 0x70, 0x00, 0x06, 0x00, 0x04, 0x06, 0x04, 0x5f, 0x00, 0x01,
-    0x01, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x3c, 0x4b, 0x00, 0x07, 0x07, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x47, 0x07, 0x4c,
-    0x3a, 0x38, 0x30, 0x2e, 0x2c, 0x2b, 0x27, 0x25, 0x24, 0x12, 0x28, 0x20, 0x08, 0x08, 0x18, 0x2b, 0x01, 0x17, 0x3e,
-    0x03, 0x37, 0x36, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x07, 0x23, 0x3e, 0x03, 0x17, 0x32, 0x1e, 0x02, 0x07, 0x0e, 0x03,
-    0x07, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x35, 0x33, 0x14, 0x16, 0x17, 0x32, 0x3e, 0x02, 0x37, 0x36,
-    0x2e, 0x02, 0x27, 0x27, 0x02, 0x54, 0x50, 0x1b, 0x38, 0x2e, 0x20, 0x04, 0x03, 0x0f, 0x1e, 0x29, 0x17, 0x32, 0x4c,
-    0x10, 0x9c, 0x06, 0x36, 0x51, 0x64, 0x36, 0x31, 0x61, 0x4b, 0x2c, 0x03, 0x02, 0x1c, 0x2c, 0x37, 0x1e, 0x3a, 0x3b,
-    0x02, 0x02, 0x3b, 0x5b, 0x70, 0x37, 0x36, 0x62, 0x49, 0x2b, 0x98, 0x46, 0x35, 0x1c, 0x36, 0x2d, 0x1f, 0x04, 0x04,
-    0x13, 0x25, 0x31, 0x1b, 0x57, 0x04, 0x65, 0x01, 0x01, 0x0e, 0x1c, 0x2b, 0x1f, 0x19, 0x25, 0x18, 0x0c, 0x2d, 0x30,
-    0x39, 0x53, 0x37, 0x1b, 0x01, 0x1a, 0x35, 0x52, 0x39, 0x24, 0x38, 0x2c, 0x23, 0x0d, 0x15, 0x58, 0x3e, 0x3f, 0x5b,
-    0x3b, 0x1b, 0x01, 0x01, 0x1e, 0x3a, 0x57, 0x3a, 0x37, 0x31, 0x01, 0x0e, 0x1d, 0x2c, 0x1e, 0x1f, 0x29, 0x18, 0x0a,
-    0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0xe7, 0x04, 0xbf, 0x03, 0xab, 0x05, 0xc9, 0x00, 0x03, 0x00, 0x26, 0x4b, 0xb0,
-    0x28, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x01, 0x00, 0x01, 0x73, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x4c, 0x1b, 0x40, 0x09,
-    0x00, 0x00, 0x01, 0x00, 0x72, 0x00, 0x01, 0x01, 0x69, 0x59, 0xb4, 0x11, 0x10, 0x02, 0x08, 0x16, 0x2b, 0x01, 0x33,
-    0x01, 0x23, 0x02, 0xc4, 0xe7, 0xfe, 0xd2, 0x96, 0x05, 0xc9, 0xfe, 0xf6, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0xfe,
-    0x60, 0x04, 0x46, 0x04, 0x3a, 0x00, 0x19, 0x00, 0x58, 0xb6, 0x16, 0x10, 0x02, 0x02, 0x00, 0x01, 0x4a, 0x4b, 0xb0,
-    0x17, 0x50, 0x58, 0x40, 0x18, 0x06, 0x05, 0x02, 0x01, 0x01, 0x3f, 0x4b, 0x00, 0x00, 0x00, 0x02, 0x5c, 0x03, 0x01,
-    0x02, 0x02, 0x3d, 0x4b, 0x00, 0x04, 0x04, 0x41, 0x04, 0x4c, 0x1b, 0x40, 0x1c, 0x06, 0x05, 0x02, 0x01, 0x01, 0x3f,
-    0x4b, 0x00, 0x02, 0x02, 0x3d, 0x4b, 0x00, 0x00, 0x00, 0x03, 0x5c, 0x00, 0x03, 0x03, 0x45, 0x4b, 0x00, 0x04, 0x04,
-    0x41, 0x04, 0x4c, 0x59, 0x40, 0x0e, 0x00, 0x00, 0x00, 0x19, 0x00, 0x19, 0x13, 0x23, 0x11, 0x13, 0x27, 0x07, 0x08,
-    0x19, 0x2b, 0x01, 0x03, 0x06, 0x06, 0x1e, 0x03, 0x17, 0x16, 0x36, 0x37, 0x13, 0x33, 0x03, 0x23, 0x37, 0x06, 0x06,
-    0x27, 0x26, 0x26, 0x27, 0x03, 0x23, 0x01, 0x01, 0xbe, 0x66, 0x04, 0x05, 0x04, 0x10, 0x23, 0x3a, 0x2c, 0x5c, 0x8d,
-    0x30, 0x8b, 0xb6, 0xbc, 0xa2, 0x13, 0x35, 0x85, 0x57, 0x3c, 0x6e, 0x2d, 0x59, 0xb4, 0x01, 0x04, 0x04, 0x3a, 0xfd,
-    0x8f, 0x20, 0x49, 0x48, 0x41, 0x33, 0x20, 0x01, 0x04, 0x4d, 0x4e, 0x03, 0x20, 0xfb, 0xc6, 0x74, 0x42, 0x48, 0x01,
-    0x01, 0x21, 0x29, 0xfe, 0x2a, 0x05, 0xda, 0x00, 0x00, 0x01, 0x01, 0x07, 0x00, 0x00, 0x04, 0x48, 0x05, 0xb1, 0x00,
-    0x0e, 0x00, 0x1f, 0x40, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x3c, 0x4b, 0x03, 0x01, 0x02, 0x02,
-    0x3d, 0x02, 0x4c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x28, 0x21, 0x04, 0x08, 0x16, 0x2b, 0x21, 0x13, 0x27, 0x2e,
-    0x03, 0x37, 0x3e, 0x03, 0x33, 0x05, 0x03, 0x02, 0x96, 0x5a, 0x48, 0x65, 0xa0, 0x6b, 0x31, 0x09, 0x0a, 0x5d, 0x92,
-    0xbe, 0x6c, 0x01, 0x15, 0xfd, 0x02, 0x08, 0x01, 0x03, 0x45, 0x79, 0xa7, 0x65, 0x6e, 0xaf, 0x7b, 0x43, 0x01, 0xfa,
-    0x50, 0x00, 0x01, 0x01, 0xff, 0x02, 0x69, 0x02, 0xdf, 0x03, 0x4b, 0x00, 0x0f, 0x00, 0x18, 0x40, 0x15, 0x00, 0x00,
-    0x01, 0x01, 0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x5b, 0x00, 0x01, 0x00, 0x01, 0x4f, 0x26, 0x22, 0x02, 0x08, 0x16,
-    0x2b, 0x01, 0x36, 0x36, 0x37, 0x36, 0x1e, 0x02, 0x15, 0x06, 0x06, 0x07, 0x06, 0x2e, 0x02, 0x01, 0xff, 0x01, 0x3e,
-    0x32, 0x18, 0x29, 0x1e, 0x10, 0x01, 0x3f, 0x30, 0x18, 0x2a, 0x1e, 0x10, 0x02, 0xd6, 0x31, 0x41, 0x02, 0x01, 0x10,
-    0x1e, 0x29, 0x18, 0x31, 0x3f, 0x02, 0x01, 0x10, 0x1c, 0x29, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x17, 0xfe, 0x4b,
-    0x02, 0x60, 0x00, 0x00, 0x00, 0x15, 0x00, 0x26, 0x40, 0x23, 0x14, 0x01, 0x02, 0x01, 0x02, 0x01, 0x4a, 0x03, 0x01,
-    0x02, 0x01, 0x02, 0x72, 0x00, 0x01, 0x01, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x49, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x15, 0x11, 0x18, 0x04, 0x08, 0x16, 0x2b, 0x21, 0x07, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x07, 0x37, 0x3e, 0x03,
-    0x37, 0x36, 0x2e, 0x02, 0x27, 0x37, 0x01, 0xf7, 0x15, 0x3e, 0x40, 0x02, 0x02, 0x3f, 0x60, 0x72, 0x34, 0x04, 0x1b,
-    0x3b, 0x34, 0x26, 0x05, 0x05, 0x1a, 0x2b, 0x34, 0x15, 0x2d, 0x37, 0x0f, 0x54, 0x40, 0x41, 0x53, 0x31, 0x14, 0x02,
-    0x6c, 0x01, 0x0a, 0x17, 0x29, 0x20, 0x1e, 0x21, 0x11, 0x06, 0x03, 0x85, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0xdf,
-    0x02, 0x99, 0x03, 0x6f, 0x05, 0xae, 0x00, 0x06, 0x00, 0x1a, 0x40, 0x17, 0x03, 0x02, 0x02, 0x00, 0x01, 0x01, 0x4a,
-    0x00, 0x00, 0x01, 0x00, 0x73, 0x00, 0x01, 0x01, 0x3c, 0x01, 0x4c, 0x14, 0x10, 0x02, 0x08, 0x16, 0x2b, 0x01, 0x23,
-    0x13, 0x07, 0x37, 0x25, 0x33, 0x02, 0xeb, 0x99, 0x68, 0xdb, 0x17, 0x01, 0x63, 0x16, 0x02, 0x99, 0x02, 0x55, 0x38,
-    0x87, 0x71, 0x00, 0x00, 0x02, 0x01, 0x4d, 0x02, 0xb0, 0x04, 0x02, 0x05, 0xc6, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x1c,
-    0x40, 0x19, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01, 0x5f, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x44, 0x03,
-    0x4c, 0x29, 0x29, 0x29, 0x24, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x07, 0x0e, 0x03,
-    0x27, 0x2e, 0x03, 0x37, 0x17, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x26,
-    0x0e, 0x02, 0x07, 0x01, 0x60, 0x09, 0x41, 0x64, 0x83, 0x4c, 0x48, 0x70, 0x4b, 0x22, 0x07, 0x0d, 0x09, 0x40, 0x63,
-    0x82, 0x4c, 0x48, 0x71, 0x4b, 0x23, 0x06, 0xa3, 0x03, 0x0d, 0x22, 0x3b, 0x2a, 0x2b, 0x45, 0x32, 0x1f, 0x06, 0x0d,
-    0x03, 0x0d, 0x23, 0x3a, 0x2a, 0x2c, 0x45, 0x32, 0x1f, 0x06, 0x04, 0x74, 0x4a, 0x7d, 0x5a, 0x31, 0x02, 0x02, 0x34,
-    0x5a, 0x79, 0x46, 0x75, 0x4a, 0x7c, 0x5a, 0x30, 0x02, 0x02, 0x34, 0x59, 0x79, 0x46, 0x02, 0x26, 0x45, 0x36, 0x21,
-    0x01, 0x01, 0x1f, 0x36, 0x48, 0x28, 0x77, 0x25, 0x46, 0x36, 0x21, 0x01, 0x01, 0x1e, 0x36, 0x48, 0x28, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x96, 0x00, 0x98, 0x03, 0xd8, 0x03, 0xb5, 0x02, 0x27, 0x01, 0x75, 0xff, 0x6a, 0x00, 0x00, 0x00,
-    0x07, 0x01, 0x75, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xa7, 0x00, 0x00, 0x04, 0x3c, 0x05, 0xb6,
-    0x00, 0x2f, 0x01, 0xc1, 0xff, 0x82, 0x02, 0xef, 0x39, 0x9a, 0x00, 0x26, 0x01, 0x76, 0xf8, 0x08, 0x01, 0x0f, 0x01,
-    0xc4, 0x01, 0x38, 0x00, 0x00, 0x39, 0x9a, 0x00, 0x11, 0xb1, 0x00, 0x01, 0xb8, 0x02, 0xef, 0xb0, 0x33, 0x2b, 0xb1,
-    0x01, 0x01, 0xb0, 0x08, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x9a, 0x00, 0x00, 0x04, 0x52, 0x05, 0xb2, 0x02,
-    0x26, 0x01, 0x76, 0xbe, 0x08, 0x00, 0x2f, 0x01, 0xc1, 0xff, 0x75, 0x02, 0xeb, 0x39, 0x9a, 0x01, 0x0f, 0x01, 0x96,
-    0x01, 0x45, 0x00, 0x00, 0x39, 0x9a, 0x00, 0x11, 0xb1, 0x00, 0x01, 0xb0, 0x08, 0xb0, 0x33, 0x2b, 0xb1, 0x01, 0x01,
-    0xb8, 0x02, 0xeb, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x6a, 0x00, 0x00, 0x04, 0x5c, 0x05, 0xba, 0x02, 0x26,
-    0x01, 0x76, 0x38, 0x07, 0x00, 0x2f, 0x01, 0xc4, 0x01, 0x58, 0x00, 0x00, 0x39, 0x9a, 0x01, 0x0f, 0x01, 0xc3, 0xff,
-    0x95, 0x02, 0xe8, 0x39, 0x9a, 0x00, 0x11, 0xb1, 0x00, 0x01, 0xb0, 0x07, 0xb0, 0x33, 0x2b, 0xb1, 0x03, 0x01, 0xb8,
-    0x02, 0xe8, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x02, 0x00, 0x56, 0xfe, 0x75, 0x03, 0x71, 0x04, 0x4f, 0x00, 0x27, 0x00,
-    0x35, 0x00, 0x65, 0x4b, 0xb0, 0x2c, 0x50, 0x58, 0x40, 0x25, 0x06, 0x01, 0x03, 0x05, 0x01, 0x05, 0x03, 0x01, 0x70,
-    0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x6e, 0x00, 0x05, 0x05, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x47, 0x4b, 0x00, 0x00,
-    0x00, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x41, 0x02, 0x4c, 0x1b, 0x40, 0x22, 0x06, 0x01, 0x03, 0x05, 0x01, 0x05, 0x03,
-    0x01, 0x70, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x5f, 0x00, 0x05, 0x05,
-    0x04, 0x5b, 0x00, 0x04, 0x04, 0x47, 0x05, 0x4c, 0x59, 0x40, 0x10, 0x00, 0x00, 0x32, 0x30, 0x2c, 0x2a, 0x00, 0x27,
-    0x00, 0x27, 0x24, 0x12, 0x2e, 0x07, 0x08, 0x17, 0x2b, 0x01, 0x0e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x06, 0x1e, 0x02,
-    0x17, 0x16, 0x36, 0x37, 0x37, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x3e, 0x03, 0x37, 0x3e, 0x03, 0x37, 0x13, 0x36,
-    0x36, 0x37, 0x36, 0x16, 0x07, 0x06, 0x06, 0x07, 0x06, 0x2e, 0x02, 0x02, 0xc4, 0x06, 0x1a, 0x2c, 0x42, 0x2e, 0x26,
-    0x50, 0x44, 0x31, 0x07, 0x06, 0x10, 0x2c, 0x47, 0x31, 0x61, 0x85, 0x13, 0xb4, 0x0a, 0x4d, 0x75, 0x97, 0x55, 0x53,
-    0x87, 0x5d, 0x2c, 0x08, 0x07, 0x3c, 0x59, 0x6c, 0x36, 0x1d, 0x29, 0x1b, 0x11, 0x05, 0x1e, 0x01, 0x3e, 0x32, 0x31,
-    0x3f, 0x01, 0x01, 0x3f, 0x31, 0x18, 0x29, 0x1e, 0x10, 0x02, 0xa2, 0x3f, 0x5d, 0x4f, 0x48, 0x29, 0x21, 0x4c, 0x56,
-    0x5f, 0x35, 0x2f, 0x4e, 0x39, 0x21, 0x01, 0x02, 0x6c, 0x5e, 0x01, 0x56, 0x88, 0x5d, 0x30, 0x02, 0x02, 0x34, 0x60,
-    0x88, 0x55, 0x4c, 0x82, 0x70, 0x64, 0x2e, 0x19, 0x33, 0x37, 0x3f, 0x25, 0x01, 0x38, 0x31, 0x42, 0x02, 0x01, 0x3f,
-    0x31, 0x31, 0x3e, 0x02, 0x01, 0x0f, 0x1d, 0x28, 0x00, 0x02, 0xff, 0xb2, 0x00, 0x00, 0x05, 0x06, 0x05, 0xb0, 0x00,
-    0x0f, 0x00, 0x12, 0x00, 0x3b, 0x40, 0x38, 0x12, 0x01, 0x05, 0x04, 0x01, 0x4a, 0x00, 0x05, 0x00, 0x06, 0x08, 0x05,
-    0x06, 0x61, 0x00, 0x08, 0x00, 0x01, 0x07, 0x08, 0x01, 0x61, 0x00, 0x04, 0x04, 0x03, 0x59, 0x00, 0x03, 0x03, 0x3c,
-    0x4b, 0x00, 0x07, 0x07, 0x00, 0x59, 0x02, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x09, 0x08, 0x1d, 0x2b, 0x21, 0x21, 0x13, 0x21, 0x03, 0x23, 0x01, 0x21, 0x07, 0x21, 0x03, 0x21,
-    0x07, 0x21, 0x03, 0x21, 0x01, 0x33, 0x13, 0x04, 0x20, 0xfd, 0xfc, 0x3c, 0xfe, 0xd9, 0xb6, 0xc9, 0x03, 0x1c, 0x02,
-    0x38, 0x1b, 0xfe, 0xb9, 0x4e, 0x01, 0x24, 0x1a, 0xfe, 0xdb, 0x5b, 0x01, 0x5b, 0xfd, 0x4e, 0xed, 0x77, 0x01, 0x61,
-    0xfe, 0x9f, 0x05, 0xb0, 0x98, 0xfe, 0x29, 0x97, 0xfd, 0xed, 0x01, 0x78, 0x02, 0xb3, 0x00, 0x00, 0x01, 0x00, 0x81,
-    0x00, 0xce, 0x04, 0x5c, 0x04, 0x63, 0x00, 0x0b, 0x00, 0x06, 0xb3, 0x09, 0x03, 0x01, 0x30, 0x2b, 0x13, 0x01, 0x01,
-    0x37, 0x01, 0x01, 0x17, 0x01, 0x01, 0x07, 0x01, 0x01, 0x81, 0x01, 0x7c, 0xfe, 0xfb, 0x81, 0x01, 0x04, 0x01, 0x79,
-    0x66, 0xfe, 0x87, 0x01, 0x07, 0x80, 0xfe, 0xf8, 0xfe, 0x85, 0x01, 0x52, 0x01, 0x50, 0x01, 0x4e, 0x73, 0xfe, 0xb2,
-    0x01, 0x4e, 0x84, 0xfe, 0xb3, 0xfe, 0xae, 0x72, 0x01, 0x50, 0xfe, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xc6,
-    0xff, 0xa3, 0x05, 0x0f, 0x05, 0xec, 0x00, 0x25, 0x00, 0x34, 0x00, 0x43, 0x00, 0x3e, 0x40, 0x3b, 0x1d, 0x01, 0x04,
-    0x02, 0x39, 0x38, 0x2a, 0x29, 0x20, 0x0d, 0x06, 0x05, 0x04, 0x0a, 0x01, 0x00, 0x05, 0x03, 0x4a, 0x00, 0x01, 0x00,
-    0x01, 0x73, 0x00, 0x03, 0x03, 0x3e, 0x4b, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x44, 0x4b, 0x00, 0x05,
-    0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x2d, 0x2d, 0x13, 0x2d, 0x13, 0x26, 0x06, 0x08, 0x1a, 0x2b,
-    0x01, 0x0e, 0x05, 0x27, 0x26, 0x26, 0x27, 0x07, 0x23, 0x13, 0x2e, 0x02, 0x36, 0x37, 0x37, 0x3e, 0x05, 0x17, 0x16,
-    0x16, 0x17, 0x37, 0x33, 0x03, 0x1e, 0x02, 0x06, 0x07, 0x05, 0x06, 0x06, 0x17, 0x01, 0x26, 0x26, 0x27, 0x26, 0x0e,
-    0x04, 0x07, 0x25, 0x36, 0x36, 0x27, 0x01, 0x16, 0x16, 0x17, 0x16, 0x3e, 0x04, 0x37, 0x04, 0x41, 0x0d, 0x2f, 0x47,
-    0x60, 0x7b, 0x97, 0x5a, 0x58, 0x81, 0x30, 0x8c, 0x97, 0xdb, 0x18, 0x1d, 0x0e, 0x02, 0x08, 0x1a, 0x0c, 0x30, 0x47,
-    0x61, 0x7b, 0x97, 0x5a, 0x63, 0x8d, 0x30, 0x86, 0x97, 0xdd, 0x13, 0x16, 0x0a, 0x03, 0x07, 0xfc, 0xbe, 0x09, 0x03,
-    0x0f, 0x02, 0x69, 0x1a, 0x5d, 0x48, 0x41, 0x69, 0x53, 0x3f, 0x2e, 0x1e, 0x09, 0x02, 0x73, 0x07, 0x06, 0x07, 0xfd,
-    0xa2, 0x1c, 0x54, 0x3e, 0x41, 0x6a, 0x52, 0x3e, 0x2d, 0x1e, 0x09, 0x02, 0x85, 0x4d, 0x9f, 0x95, 0x84, 0x60, 0x36,
-    0x02, 0x02, 0x3d, 0x33, 0xbb, 0x01, 0x25, 0x31, 0x6e, 0x73, 0x74, 0x36, 0xa6, 0x4d, 0x9f, 0x95, 0x84, 0x61, 0x36,
-    0x02, 0x02, 0x4c, 0x3e, 0xb4, 0xfe, 0xd9, 0x2f, 0x67, 0x6a, 0x69, 0x32, 0xa7, 0x3c, 0x94, 0x47, 0x03, 0x3b, 0x34,
-    0x43, 0x02, 0x02, 0x2b, 0x4d, 0x65, 0x71, 0x74, 0x34, 0x02, 0x32, 0x77, 0x3c, 0xfc, 0xd6, 0x28, 0x31, 0x02, 0x02,
-    0x2b, 0x4d, 0x66, 0x71, 0x74, 0x35, 0x00, 0x02, 0x00, 0x3a, 0x00, 0x00, 0x04, 0x5c, 0x05, 0xb0, 0x00, 0x10, 0x00,
-    0x1d, 0x00, 0x34, 0x40, 0x31, 0x00, 0x00, 0x07, 0x01, 0x05, 0x04, 0x00, 0x05, 0x64, 0x00, 0x04, 0x00, 0x01, 0x02,
-    0x04, 0x01, 0x63, 0x06, 0x01, 0x03, 0x03, 0x3c, 0x4b, 0x00, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x11, 0x11, 0x00, 0x00,
-    0x11, 0x1d, 0x11, 0x1c, 0x14, 0x12, 0x00, 0x10, 0x00, 0x10, 0x11, 0x28, 0x21, 0x08, 0x08, 0x17, 0x2b, 0x01, 0x03,
-    0x05, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x23, 0x25, 0x03, 0x23, 0x13, 0x13, 0x03, 0x05, 0x32, 0x3e, 0x02, 0x37, 0x36,
-    0x2e, 0x02, 0x27, 0x01, 0xec, 0x33, 0x01, 0x00, 0x5d, 0x9d, 0x70, 0x39, 0x08, 0x09, 0x5e, 0x91, 0xba, 0x65, 0xfe,
-    0xe9, 0x37, 0xb5, 0xfd, 0x68, 0x5f, 0x01, 0x01, 0x41, 0x78, 0x5e, 0x3f, 0x09, 0x07, 0x1b, 0x3e, 0x5e, 0x3a, 0x05,
-    0xb0, 0xfe, 0xdb, 0x01, 0x03, 0x39, 0x6a, 0x99, 0x62, 0x6b, 0xa2, 0x6d, 0x37, 0x01, 0xfe, 0xc7, 0x05, 0xb0, 0xfe,
-    0x43, 0xfd, 0xde, 0x02, 0x25, 0x48, 0x68, 0x44, 0x3b, 0x60, 0x45, 0x28, 0x02, 0x00, 0x00, 0x01, 0x00, 0x3b, 0xff,
-    0xe8, 0x03, 0xfd, 0x06, 0x19, 0x00, 0x43, 0x00, 0x51, 0x40, 0x0a, 0x23, 0x01, 0x03, 0x04, 0x22, 0x01, 0x00, 0x03,
-    0x02, 0x4a, 0x4b, 0xb0, 0x16, 0x50, 0x58, 0x40, 0x14, 0x00, 0x01, 0x00, 0x04, 0x03, 0x01, 0x04, 0x63, 0x00, 0x03,
-    0x03, 0x00, 0x5b, 0x02, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x1b, 0x40, 0x18, 0x00, 0x01, 0x00, 0x04, 0x03, 0x01,
-    0x04, 0x63, 0x00, 0x00, 0x00, 0x3d, 0x4b, 0x00, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x45, 0x02, 0x4c, 0x59,
-    0x40, 0x0b, 0x3f, 0x3d, 0x27, 0x25, 0x1e, 0x1c, 0x25, 0x10, 0x05, 0x08, 0x16, 0x2b, 0x33, 0x23, 0x13, 0x3e, 0x03,
-    0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x06, 0x1e, 0x04, 0x07, 0x0e, 0x03, 0x27, 0x22, 0x2e, 0x02, 0x27, 0x37,
-    0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x04, 0x37, 0x3e, 0x05, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x26,
-    0x0e, 0x02, 0x07, 0xef, 0xb4, 0xba, 0x0d, 0x43, 0x6f, 0x9b, 0x66, 0x49, 0x75, 0x50, 0x27, 0x06, 0x05, 0x34, 0x3d,
-    0x38, 0x09, 0x08, 0x1a, 0x30, 0x3b, 0x33, 0x20, 0x03, 0x05, 0x3b, 0x63, 0x87, 0x4f, 0x24, 0x4d, 0x4a, 0x47, 0x1e,
-    0x36, 0x30, 0x72, 0x3b, 0x2b, 0x48, 0x37, 0x23, 0x06, 0x07, 0x1d, 0x31, 0x3c, 0x33, 0x1f, 0x05, 0x03, 0x1d, 0x27,
-    0x2c, 0x28, 0x1e, 0x05, 0x04, 0x0b, 0x1f, 0x36, 0x27, 0x41, 0x5d, 0x40, 0x24, 0x08, 0x04, 0x3f, 0x5a, 0xac, 0x85,
-    0x4f, 0x03, 0x02, 0x30, 0x56, 0x78, 0x49, 0x3e, 0x66, 0x60, 0x62, 0x3a, 0x2d, 0x50, 0x4b, 0x4a, 0x4e, 0x56, 0x32,
-    0x50, 0x81, 0x5c, 0x30, 0x01, 0x08, 0x11, 0x1c, 0x14, 0x9c, 0x21, 0x2c, 0x1a, 0x31, 0x45, 0x2a, 0x30, 0x52, 0x4c,
-    0x4b, 0x4f, 0x59, 0x34, 0x27, 0x44, 0x3f, 0x3c, 0x3f, 0x43, 0x26, 0x22, 0x44, 0x37, 0x23, 0x02, 0x03, 0x3c, 0x5f,
-    0x74, 0x34, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf1, 0xff, 0xeb, 0x04, 0xa0, 0x04, 0x50, 0x00, 0x43, 0x00, 0x50,
-    0x00, 0x61, 0x00, 0x69, 0x40, 0x66, 0x2b, 0x01, 0x03, 0x05, 0x3e, 0x01, 0x08, 0x07, 0x3f, 0x05, 0x02, 0x00, 0x08,
-    0x03, 0x4a, 0x00, 0x04, 0x03, 0x02, 0x03, 0x04, 0x02, 0x70, 0x0a, 0x01, 0x02, 0x0c, 0x01, 0x07, 0x08, 0x02, 0x07,
-    0x63, 0x0e, 0x09, 0x02, 0x03, 0x03, 0x05, 0x5b, 0x06, 0x01, 0x05, 0x05, 0x47, 0x4b, 0x0f, 0x0b, 0x02, 0x08, 0x08,
-    0x00, 0x5b, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x52, 0x51, 0x45, 0x44, 0x01, 0x00, 0x59, 0x57, 0x51,
-    0x61, 0x52, 0x61, 0x4b, 0x4a, 0x44, 0x50, 0x45, 0x50, 0x3c, 0x3a, 0x35, 0x34, 0x2f, 0x2d, 0x27, 0x25, 0x21, 0x20,
-    0x1c, 0x1a, 0x15, 0x13, 0x0b, 0x09, 0x00, 0x43, 0x01, 0x43, 0x10, 0x08, 0x14, 0x2b, 0x05, 0x22, 0x2e, 0x02, 0x27,
-    0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x3e, 0x03, 0x33, 0x17, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07,
-    0x27, 0x3e, 0x03, 0x17, 0x32, 0x1e, 0x02, 0x17, 0x36, 0x36, 0x17, 0x1e, 0x03, 0x07, 0x07, 0x21, 0x07, 0x06, 0x1e,
-    0x02, 0x33, 0x16, 0x36, 0x37, 0x17, 0x0e, 0x03, 0x13, 0x26, 0x0e, 0x02, 0x07, 0x07, 0x21, 0x37, 0x36, 0x2e, 0x02,
-    0x01, 0x32, 0x3e, 0x02, 0x37, 0x13, 0x23, 0x0e, 0x03, 0x07, 0x06, 0x1e, 0x02, 0x03, 0x08, 0x29, 0x4f, 0x45, 0x39,
-    0x13, 0x1b, 0x3c, 0x43, 0x4d, 0x2b, 0x41, 0x60, 0x3f, 0x1c, 0x03, 0x06, 0x4b, 0x78, 0x9b, 0x56, 0x42, 0x1a, 0x03,
-    0x03, 0x13, 0x29, 0x23, 0x24, 0x35, 0x25, 0x17, 0x06, 0xaf, 0x07, 0x37, 0x59, 0x77, 0x47, 0x21, 0x42, 0x3a, 0x33,
-    0x12, 0x33, 0x77, 0x48, 0x4f, 0x6e, 0x42, 0x17, 0x07, 0x25, 0xfe, 0x17, 0x0c, 0x06, 0x08, 0x27, 0x4d, 0x3e, 0x39,
-    0x5f, 0x2e, 0x23, 0x1c, 0x43, 0x48, 0x4a, 0x4f, 0x32, 0x48, 0x31, 0x1f, 0x07, 0x0c, 0x01, 0x44, 0x12, 0x03, 0x0a,
-    0x1c, 0x31, 0xfd, 0x78, 0x16, 0x28, 0x26, 0x22, 0x10, 0x34, 0x36, 0x31, 0x59, 0x47, 0x2e, 0x06, 0x03, 0x0b, 0x1d,
-    0x2d, 0x13, 0x11, 0x23, 0x36, 0x26, 0x20, 0x36, 0x27, 0x15, 0x01, 0x01, 0x2f, 0x50, 0x6c, 0x3d, 0x5d, 0x87, 0x59,
-    0x2a, 0x01, 0x95, 0x1c, 0x3b, 0x30, 0x1f, 0x01, 0x01, 0x1a, 0x2d, 0x3a, 0x1f, 0x08, 0x46, 0x71, 0x4f, 0x2a, 0x01,
-    0x0c, 0x19, 0x29, 0x1d, 0x31, 0x3a, 0x01, 0x02, 0x3f, 0x67, 0x84, 0x47, 0xea, 0x57, 0x35, 0x64, 0x4d, 0x30, 0x01,
-    0x28, 0x1d, 0x8a, 0x17, 0x20, 0x13, 0x07, 0x03, 0xcb, 0x01, 0x2c, 0x47, 0x57, 0x29, 0x46, 0x81, 0x1f, 0x40, 0x35,
-    0x21, 0xfc, 0xcb, 0x0c, 0x15, 0x1b, 0x0d, 0x01, 0x27, 0x01, 0x21, 0x3a, 0x52, 0x32, 0x1d, 0x34, 0x28, 0x17, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x28, 0xff, 0xe9, 0x04, 0x8a, 0x05, 0xf0, 0x00, 0x25, 0x00, 0x3b, 0x00, 0x31, 0x40,
-    0x2e, 0x16, 0x01, 0x02, 0x01, 0x01, 0x4a, 0x25, 0x24, 0x23, 0x20, 0x1f, 0x1c, 0x1b, 0x1a, 0x19, 0x09, 0x01, 0x48,
-    0x00, 0x01, 0x00, 0x02, 0x03, 0x01, 0x02, 0x63, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c,
-    0x36, 0x34, 0x2c, 0x2a, 0x28, 0x28, 0x04, 0x08, 0x16, 0x2b, 0x01, 0x16, 0x12, 0x07, 0x07, 0x0e, 0x03, 0x27, 0x2e,
-    0x03, 0x37, 0x3e, 0x03, 0x17, 0x16, 0x16, 0x17, 0x36, 0x26, 0x27, 0x05, 0x27, 0x37, 0x26, 0x26, 0x27, 0x37, 0x16,
-    0x16, 0x17, 0x37, 0x17, 0x01, 0x2e, 0x03, 0x23, 0x26, 0x0e, 0x02, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02,
-    0x37, 0x37, 0x03, 0xaa, 0x50, 0x2b, 0x16, 0x08, 0x0f, 0x59, 0x91, 0xc8, 0x7e, 0x63, 0x9f, 0x6c, 0x32, 0x09, 0x0a,
-    0x59, 0x90, 0xbf, 0x70, 0x51, 0x8c, 0x36, 0x02, 0x2e, 0x32, 0xfe, 0xe1, 0x3a, 0xfd, 0x23, 0x4c, 0x2a, 0x47, 0x48,
-    0x7e, 0x36, 0xfa, 0x3a, 0xfe, 0xda, 0x13, 0x3e, 0x4c, 0x54, 0x28, 0x4c, 0x7c, 0x5c, 0x38, 0x08, 0x08, 0x17, 0x3c,
-    0x61, 0x42, 0x59, 0x85, 0x5d, 0x37, 0x0c, 0x0a, 0x05, 0x04, 0x9a, 0xfe, 0xbc, 0xab, 0x3f, 0x72, 0xd7, 0xa7, 0x63,
-    0x03, 0x03, 0x4d, 0x82, 0xac, 0x61, 0x6c, 0xbf, 0x8e, 0x50, 0x03, 0x02, 0x41, 0x39, 0x5b, 0xac, 0x4d, 0x98, 0x6b,
-    0x85, 0x1c, 0x26, 0x10, 0x9d, 0x17, 0x47, 0x33, 0x85, 0x6d, 0xfd, 0x38, 0x27, 0x35, 0x21, 0x0f, 0x01, 0x3f, 0x68,
-    0x85, 0x45, 0x3c, 0x74, 0x5c, 0x3b, 0x02, 0x03, 0x51, 0x82, 0x9e, 0x4b, 0x40, 0x00, 0x00, 0x03, 0x00, 0x6f, 0x00,
-    0xaf, 0x04, 0x59, 0x04, 0xb6, 0x00, 0x03, 0x00, 0x11, 0x00, 0x21, 0x00, 0x2c, 0x40, 0x29, 0x00, 0x02, 0x00, 0x03,
-    0x01, 0x02, 0x03, 0x63, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x61, 0x00, 0x04, 0x05, 0x05, 0x04, 0x57, 0x00,
-    0x04, 0x04, 0x05, 0x5b, 0x00, 0x05, 0x04, 0x05, 0x4f, 0x26, 0x24, 0x26, 0x23, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b,
-    0x01, 0x21, 0x37, 0x21, 0x01, 0x36, 0x36, 0x37, 0x36, 0x1e, 0x02, 0x15, 0x06, 0x06, 0x07, 0x06, 0x26, 0x03, 0x34,
-    0x36, 0x37, 0x36, 0x1e, 0x02, 0x15, 0x06, 0x06, 0x07, 0x06, 0x2e, 0x02, 0x04, 0x38, 0xfc, 0x37, 0x20, 0x03, 0xca,
-    0xfd, 0xe9, 0x01, 0x3a, 0x2f, 0x17, 0x28, 0x1c, 0x10, 0x01, 0x3c, 0x2e, 0x2f, 0x3c, 0x8e, 0x3b, 0x2f, 0x17, 0x28,
-    0x1c, 0x10, 0x01, 0x3c, 0x2e, 0x17, 0x27, 0x1d, 0x0f, 0x02, 0x58, 0xb8, 0x01, 0x36, 0x2f, 0x3e, 0x02, 0x01, 0x0f,
-    0x1d, 0x27, 0x17, 0x2f, 0x3c, 0x02, 0x02, 0x3a, 0xfd, 0x00, 0x2f, 0x3e, 0x02, 0x01, 0x0f, 0x1d, 0x27, 0x17, 0x2f,
-    0x3c, 0x02, 0x01, 0x0f, 0x1c, 0x26, 0x00, 0x00, 0x03, 0x00, 0x56, 0xff, 0x79, 0x04, 0x46, 0x04, 0xb9, 0x00, 0x23,
-    0x00, 0x31, 0x00, 0x3f, 0x00, 0x3e, 0x40, 0x3b, 0x0d, 0x0a, 0x02, 0x04, 0x00, 0x38, 0x37, 0x2a, 0x29, 0x04, 0x05,
-    0x04, 0x1e, 0x1b, 0x02, 0x02, 0x05, 0x03, 0x4a, 0x00, 0x01, 0x00, 0x01, 0x72, 0x00, 0x03, 0x02, 0x03, 0x73, 0x00,
-    0x04, 0x04, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x05, 0x05, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x45, 0x02,
-    0x4c, 0x2c, 0x2e, 0x13, 0x2b, 0x13, 0x26, 0x06, 0x08, 0x1a, 0x2b, 0x13, 0x3e, 0x05, 0x17, 0x16, 0x16, 0x17, 0x37,
-    0x33, 0x07, 0x1e, 0x03, 0x07, 0x07, 0x0e, 0x03, 0x27, 0x26, 0x26, 0x27, 0x07, 0x23, 0x37, 0x2e, 0x03, 0x37, 0x33,
-    0x06, 0x06, 0x16, 0x16, 0x17, 0x01, 0x26, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x25, 0x36, 0x36, 0x26, 0x26, 0x27, 0x01,
-    0x16, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x6e, 0x09, 0x2d, 0x46, 0x5f, 0x75, 0x8b, 0x50, 0x39, 0x61, 0x29, 0x67, 0x83,
-    0x94, 0x25, 0x33, 0x1d, 0x07, 0x06, 0x02, 0x0e, 0x59, 0x8e, 0xc1, 0x76, 0x36, 0x5c, 0x27, 0x68, 0x83, 0x93, 0x27,
-    0x35, 0x20, 0x08, 0x06, 0xb5, 0x05, 0x01, 0x09, 0x15, 0x11, 0x01, 0xbb, 0x30, 0x43, 0x54, 0x80, 0x5a, 0x36, 0x0a,
-    0x02, 0x50, 0x04, 0x01, 0x08, 0x12, 0x0f, 0xfe, 0x48, 0x2d, 0x3e, 0x53, 0x80, 0x5b, 0x36, 0x0b, 0x02, 0x20, 0x49,
-    0x8d, 0x7d, 0x69, 0x4b, 0x29, 0x02, 0x02, 0x1a, 0x17, 0x9e, 0xe2, 0x27, 0x63, 0x6f, 0x77, 0x3d, 0x17, 0x6d, 0xca,
-    0x99, 0x5a, 0x03, 0x02, 0x17, 0x14, 0xa0, 0xe1, 0x27, 0x62, 0x6f, 0x7a, 0x3e, 0x24, 0x4b, 0x4a, 0x46, 0x1e, 0x02,
-    0xa8, 0x1f, 0x03, 0x03, 0x49, 0x76, 0x93, 0x48, 0x09, 0x22, 0x48, 0x48, 0x45, 0x1e, 0xfd, 0x5f, 0x1b, 0x01, 0x03,
-    0x48, 0x74, 0x91, 0x48, 0x00, 0x00, 0x02, 0xff, 0xf7, 0xfe, 0x60, 0x04, 0x1c, 0x06, 0x16, 0x00, 0x19, 0x00, 0x2d,
-    0x00, 0x39, 0x40, 0x36, 0x0f, 0x01, 0x04, 0x03, 0x25, 0x01, 0x05, 0x04, 0x0a, 0x01, 0x00, 0x05, 0x03, 0x4a, 0x00,
-    0x02, 0x03, 0x02, 0x72, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x47, 0x4b, 0x00, 0x05, 0x05, 0x00, 0x5b,
-    0x00, 0x00, 0x00, 0x45, 0x4b, 0x00, 0x01, 0x01, 0x41, 0x01, 0x4c, 0x25, 0x2d, 0x23, 0x11, 0x13, 0x26, 0x06, 0x08,
-    0x1a, 0x2b, 0x01, 0x0e, 0x05, 0x27, 0x26, 0x26, 0x27, 0x03, 0x23, 0x01, 0x33, 0x03, 0x36, 0x36, 0x17, 0x1e, 0x05,
-    0x07, 0x27, 0x36, 0x36, 0x2e, 0x03, 0x27, 0x26, 0x06, 0x07, 0x03, 0x16, 0x16, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x04,
-    0x13, 0x08, 0x24, 0x3a, 0x4f, 0x66, 0x80, 0x4c, 0x55, 0x94, 0x36, 0x61, 0xb5, 0x01, 0x57, 0xb4, 0x6e, 0x3f, 0x9c,
-    0x5e, 0x49, 0x6e, 0x4d, 0x31, 0x18, 0x02, 0x06, 0xb6, 0x05, 0x01, 0x0c, 0x1d, 0x32, 0x4a, 0x33, 0x56, 0x87, 0x32,
-    0x5b, 0x1f, 0x6e, 0x4e, 0x54, 0x7b, 0x55, 0x31, 0x0a, 0x02, 0x17, 0x42, 0x87, 0x7c, 0x6c, 0x50, 0x2d, 0x02, 0x02,
-    0x3d, 0x42, 0xfd, 0xf4, 0x07, 0xb6, 0xfd, 0xb3, 0x42, 0x45, 0x02, 0x02, 0x31, 0x51, 0x6b, 0x78, 0x7f, 0x3c, 0x01,
-    0x28, 0x58, 0x55, 0x4e, 0x3b, 0x24, 0x02, 0x03, 0x55, 0x42, 0xfd, 0xf8, 0x46, 0x4b, 0x02, 0x02, 0x49, 0x76, 0x92,
-    0x47, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1d, 0x00, 0x00, 0x04, 0xfb, 0x05, 0xb0, 0x00, 0x13, 0x00, 0x17, 0x00,
-    0x3b, 0x40, 0x38, 0x08, 0x06, 0x02, 0x00, 0x0a, 0x05, 0x02, 0x01, 0x0b, 0x00, 0x01, 0x62, 0x0c, 0x01, 0x0b, 0x00,
-    0x03, 0x02, 0x0b, 0x03, 0x61, 0x09, 0x01, 0x07, 0x07, 0x3c, 0x4b, 0x04, 0x01, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x14,
-    0x14, 0x14, 0x17, 0x14, 0x17, 0x16, 0x15, 0x13, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0d,
-    0x08, 0x1d, 0x2b, 0x01, 0x33, 0x07, 0x23, 0x03, 0x23, 0x13, 0x21, 0x03, 0x23, 0x13, 0x23, 0x37, 0x33, 0x13, 0x33,
-    0x03, 0x21, 0x13, 0x33, 0x01, 0x37, 0x21, 0x07, 0x04, 0x7f, 0x7c, 0x19, 0x7c, 0xb2, 0xab, 0x75, 0xfd, 0xbe, 0x75,
-    0xaa, 0xb2, 0x6f, 0x19, 0x6f, 0x32, 0xaa, 0x32, 0x02, 0x42, 0x32, 0xab, 0xfe, 0xe8, 0x22, 0xfd, 0xbe, 0x22, 0x04,
-    0x8f, 0x8f, 0xfc, 0x00, 0x02, 0xa1, 0xfd, 0x5f, 0x04, 0x00, 0x8f, 0x01, 0x21, 0xfe, 0xdf, 0x01, 0x21, 0xfd, 0x8e,
-    0xc2, 0xc2, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5c, 0x00, 0x00, 0x03, 0xe9, 0x04, 0x3a, 0x00, 0x09, 0x00, 0x21, 0x40,
-    0x1e, 0x00, 0x04, 0x04, 0x00, 0x59, 0x00, 0x00, 0x00, 0x3f, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x02, 0x59, 0x00, 0x02,
-    0x02, 0x3d, 0x02, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x10, 0x05, 0x08, 0x19, 0x2b, 0x01, 0x21, 0x03, 0x21, 0x07, 0x21,
-    0x37, 0x21, 0x13, 0x21, 0x01, 0x18, 0x02, 0x1a, 0xa0, 0x01, 0x57, 0x1d, 0xfc, 0x90, 0x1d, 0x01, 0x64, 0x84, 0xfe,
-    0x9b, 0x04, 0x3a, 0xfc, 0x66, 0xa0, 0xa0, 0x02, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x14, 0xff, 0xeb, 0x04,
-    0xc1, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x4f, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x1a, 0x00, 0x04, 0x01,
-    0x05, 0x01, 0x04, 0x05, 0x70, 0x02, 0x01, 0x01, 0x01, 0x3c, 0x4b, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x03, 0x01, 0x00,
-    0x00, 0x3d, 0x00, 0x4c, 0x1b, 0x40, 0x1e, 0x00, 0x04, 0x01, 0x05, 0x01, 0x04, 0x05, 0x70, 0x02, 0x01, 0x01, 0x01,
-    0x3c, 0x4b, 0x00, 0x00, 0x00, 0x3d, 0x4b, 0x00, 0x05, 0x05, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x45, 0x03, 0x4c, 0x59,
-    0x40, 0x09, 0x24, 0x14, 0x25, 0x11, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x33, 0x23, 0x13, 0x33, 0x21, 0x33, 0x03,
-    0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x17, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0xc8, 0xb4, 0xfc, 0xb5,
-    0x02, 0x47, 0xb5, 0xc1, 0x0b, 0x3b, 0x5e, 0x83, 0x52, 0x4c, 0x6f, 0x47, 0x1f, 0x04, 0xb7, 0x02, 0x05, 0x18, 0x30,
-    0x29, 0x2d, 0x40, 0x2c, 0x18, 0x06, 0x05, 0xb0, 0xfb, 0x93, 0x4f, 0x80, 0x5a, 0x2f, 0x02, 0x01, 0x35, 0x5c, 0x7b,
-    0x48, 0x01, 0x21, 0x43, 0x36, 0x23, 0x01, 0x01, 0x1d, 0x35, 0x46, 0x28, 0x00, 0x00, 0x04, 0xff, 0xe5, 0xfe, 0x4d,
-    0x04, 0xb3, 0x05, 0xc1, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x2d, 0x00, 0x3b, 0x00, 0x4f, 0x40, 0x4c, 0x0b, 0x01, 0x02,
-    0x06, 0x0a, 0x01, 0x01, 0x02, 0x02, 0x4a, 0x0c, 0x01, 0x0a, 0x0a, 0x09, 0x5b, 0x0b, 0x01, 0x09, 0x09, 0x44, 0x4b,
-    0x08, 0x01, 0x03, 0x03, 0x00, 0x59, 0x04, 0x01, 0x00, 0x00, 0x3f, 0x4b, 0x07, 0x01, 0x05, 0x05, 0x06, 0x59, 0x00,
-    0x06, 0x06, 0x3d, 0x4b, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x49, 0x01, 0x4c, 0x3a, 0x38, 0x32, 0x30,
-    0x2c, 0x2a, 0x24, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x34, 0x25, 0x10, 0x0d, 0x08, 0x1d, 0x2b, 0x01, 0x21,
-    0x03, 0x0e, 0x03, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x13, 0x23, 0x25, 0x21,
-    0x03, 0x33, 0x07, 0x21, 0x37, 0x33, 0x13, 0x23, 0x01, 0x34, 0x36, 0x37, 0x36, 0x1e, 0x02, 0x15, 0x06, 0x06, 0x07,
-    0x06, 0x26, 0x25, 0x36, 0x36, 0x37, 0x36, 0x1e, 0x02, 0x15, 0x06, 0x06, 0x07, 0x06, 0x26, 0x02, 0xed, 0x01, 0x8c,
-    0xba, 0x0e, 0x4c, 0x78, 0xa3, 0x66, 0x36, 0x68, 0x35, 0x1e, 0x2c, 0x59, 0x2d, 0x40, 0x66, 0x4b, 0x2f, 0x0a, 0x9d,
-    0xd8, 0xfd, 0xd6, 0x01, 0x98, 0xa0, 0xd9, 0x1c, 0xfd, 0x8a, 0x1c, 0xe8, 0x84, 0xe4, 0x03, 0x52, 0x3b, 0x30, 0x18,
-    0x28, 0x1d, 0x10, 0x01, 0x3c, 0x30, 0x30, 0x3c, 0xfd, 0xd0, 0x01, 0x3b, 0x30, 0x18, 0x28, 0x1c, 0x10, 0x01, 0x3b,
-    0x30, 0x30, 0x3d, 0x04, 0x3a, 0xfb, 0xc1, 0x62, 0x9f, 0x71, 0x3c, 0x0a, 0x08, 0x9e, 0x08, 0x06, 0x01, 0x01, 0x25,
-    0x46, 0x64, 0x3e, 0x03, 0x9f, 0xa1, 0xfc, 0x66, 0xa0, 0xa0, 0x02, 0xf9, 0x01, 0xb7, 0x30, 0x3e, 0x02, 0x01, 0x0f,
-    0x1d, 0x27, 0x18, 0x30, 0x3c, 0x02, 0x02, 0x3a, 0x2f, 0x30, 0x3e, 0x02, 0x01, 0x0f, 0x1d, 0x27, 0x18, 0x30, 0x3c,
-    0x02, 0x02, 0x3a, 0x00, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x00, 0x04, 0x89, 0x04, 0x3a, 0x00, 0x0c, 0x00, 0x1e, 0x40,
-    0x1b, 0x0a, 0x06, 0x02, 0x00, 0x01, 0x01, 0x4a, 0x02, 0x01, 0x01, 0x01, 0x3f, 0x4b, 0x03, 0x01, 0x00, 0x00, 0x3d,
-    0x00, 0x4c, 0x12, 0x13, 0x11, 0x12, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x07, 0x03, 0x23, 0x13, 0x33, 0x03, 0x37, 0x01,
-    0x33, 0x01, 0x01, 0x23, 0x01, 0xec, 0xb1, 0x3a, 0xb5, 0xbc, 0xb5, 0x5c, 0x79, 0x01, 0xc6, 0xe9, 0xfd, 0xe9, 0x01,
-    0x70, 0xd6, 0x01, 0xdb, 0x8b, 0xfe, 0xb0, 0x04, 0x3a, 0xfd, 0xf7, 0x70, 0x01, 0x99, 0xfe, 0x18, 0xfd, 0xae, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x33, 0x00, 0x00, 0x03, 0xdf, 0x05, 0xb0, 0x00, 0x0d, 0x00, 0x21, 0x40, 0x1e, 0x09, 0x08,
-    0x01, 0x03, 0x00, 0x02, 0x01, 0x4a, 0x00, 0x02, 0x02, 0x3c, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x5a, 0x00, 0x01, 0x01,
-    0x3d, 0x01, 0x4c, 0x15, 0x11, 0x14, 0x03, 0x08, 0x17, 0x2b, 0x01, 0x25, 0x07, 0x05, 0x03, 0x21, 0x07, 0x21, 0x13,
-    0x07, 0x37, 0x37, 0x13, 0x33, 0x01, 0xa4, 0x01, 0x0c, 0x1e, 0xfe, 0xf4, 0x5a, 0x02, 0xb3, 0x1c, 0xfc, 0x99, 0x6b,
-    0x94, 0x1e, 0x93, 0x74, 0xb5, 0x03, 0x51, 0x53, 0xa9, 0x53, 0xfd, 0xf5, 0x9d, 0x02, 0x6d, 0x2e, 0xa9, 0x2d, 0x02,
-    0x9b, 0x00, 0x00, 0x01, 0x00, 0x5c, 0x00, 0x00, 0x04, 0x4f, 0x06, 0x00, 0x00, 0x11, 0x00, 0x4a, 0x40, 0x09, 0x0d,
-    0x0c, 0x03, 0x02, 0x04, 0x01, 0x04, 0x01, 0x4a, 0x4b, 0xb0, 0x23, 0x50, 0x58, 0x40, 0x16, 0x00, 0x04, 0x04, 0x00,
-    0x59, 0x00, 0x00, 0x00, 0x3e, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x02, 0x59, 0x00, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x1b,
-    0x40, 0x14, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x04, 0x61, 0x03, 0x01, 0x01, 0x01, 0x02, 0x59, 0x00, 0x02, 0x02,
-    0x3d, 0x02, 0x4c, 0x59, 0xb7, 0x15, 0x11, 0x11, 0x15, 0x10, 0x05, 0x08, 0x19, 0x2b, 0x01, 0x21, 0x03, 0x25, 0x07,
-    0x05, 0x03, 0x21, 0x07, 0x21, 0x37, 0x21, 0x13, 0x05, 0x37, 0x25, 0x13, 0x21, 0x01, 0x67, 0x02, 0x1a, 0x61, 0x01,
-    0x2f, 0x1b, 0xfe, 0xce, 0x70, 0x01, 0x57, 0x1d, 0xfc, 0x90, 0x1d, 0x01, 0x64, 0x61, 0xfe, 0x9d, 0x1e, 0x01, 0x63,
-    0x54, 0xfe, 0x9a, 0x06, 0x00, 0xfd, 0xd2, 0x83, 0xaa, 0x85, 0xfd, 0x7a, 0xa0, 0xa0, 0x02, 0x32, 0x9a, 0xab, 0x9a,
-    0x01, 0xe2, 0x00, 0x01, 0x00, 0x41, 0xfe, 0x49, 0x04, 0x92, 0x05, 0xb0, 0x00, 0x1a, 0x00, 0x37, 0x40, 0x34, 0x19,
-    0x14, 0x13, 0x03, 0x02, 0x03, 0x0a, 0x01, 0x01, 0x02, 0x09, 0x01, 0x00, 0x01, 0x03, 0x4a, 0x05, 0x04, 0x02, 0x03,
-    0x03, 0x3c, 0x4b, 0x00, 0x02, 0x02, 0x3d, 0x4b, 0x00, 0x01, 0x01, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x49, 0x00, 0x4c,
-    0x00, 0x00, 0x00, 0x1a, 0x00, 0x1a, 0x11, 0x17, 0x25, 0x25, 0x06, 0x08, 0x18, 0x2b, 0x01, 0x01, 0x0e, 0x03, 0x23,
-    0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x37, 0x01, 0x03, 0x23, 0x13, 0x33, 0x01, 0x13,
-    0x04, 0x92, 0xfe, 0xf9, 0x0a, 0x36, 0x59, 0x7c, 0x50, 0x1d, 0x38, 0x1c, 0x1a, 0x17, 0x31, 0x18, 0x28, 0x3a, 0x27,
-    0x17, 0x05, 0x10, 0xfe, 0xcd, 0xbb, 0xb5, 0xfd, 0xaf, 0x01, 0x35, 0xbb, 0x05, 0xb0, 0xf9, 0xf9, 0x4b, 0x81, 0x5e,
-    0x36, 0x0a, 0x08, 0x94, 0x07, 0x09, 0x25, 0x3a, 0x47, 0x22, 0x67, 0x04, 0x27, 0xfb, 0xcb, 0x05, 0xb0, 0xfb, 0xcd,
-    0x04, 0x33, 0x00, 0x01, 0x00, 0x4a, 0xfe, 0x48, 0x04, 0x0c, 0x04, 0x50, 0x00, 0x27, 0x00, 0x68, 0x40, 0x0e, 0x01,
-    0x01, 0x04, 0x03, 0x13, 0x01, 0x02, 0x04, 0x12, 0x01, 0x01, 0x02, 0x03, 0x4a, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40,
-    0x1c, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x06, 0x05, 0x02, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x04, 0x04, 0x3d, 0x4b, 0x00,
-    0x02, 0x02, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x49, 0x01, 0x4c, 0x1b, 0x40, 0x20, 0x06, 0x01, 0x05, 0x05, 0x3f, 0x4b,
-    0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x04, 0x04, 0x3d, 0x4b, 0x00, 0x02, 0x02, 0x01,
-    0x5b, 0x00, 0x01, 0x01, 0x49, 0x01, 0x4c, 0x59, 0x40, 0x0e, 0x00, 0x00, 0x00, 0x27, 0x00, 0x27, 0x13, 0x29, 0x25,
-    0x29, 0x23, 0x07, 0x08, 0x19, 0x2b, 0x01, 0x07, 0x36, 0x36, 0x17, 0x1e, 0x03, 0x07, 0x03, 0x0e, 0x03, 0x27, 0x22,
-    0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x13, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x06, 0x07, 0x03,
-    0x23, 0x13, 0x01, 0xa7, 0x17, 0x3f, 0xa3, 0x6a, 0x5b, 0x7a, 0x46, 0x15, 0x09, 0x7e, 0x0a, 0x37, 0x5b, 0x7e, 0x51,
-    0x1f, 0x3b, 0x1d, 0x1e, 0x18, 0x32, 0x19, 0x29, 0x3c, 0x29, 0x18, 0x06, 0x7e, 0x06, 0x07, 0x27, 0x4b, 0x3d, 0x55,
-    0x88, 0x35, 0x8d, 0xb5, 0xbc, 0x04, 0x3b, 0x9b, 0x50, 0x60, 0x02, 0x02, 0x46, 0x74, 0x96, 0x52, 0xfc, 0xfd, 0x4c,
-    0x81, 0x5e, 0x34, 0x01, 0x0b, 0x09, 0x9c, 0x08, 0x08, 0x20, 0x35, 0x45, 0x24, 0x03, 0x00, 0x35, 0x60, 0x48, 0x2b,
-    0x02, 0x02, 0x47, 0x41, 0xfc, 0xd5, 0x04, 0x3a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x34, 0xff, 0xec, 0x05, 0x0e, 0x05,
-    0xc6, 0x00, 0x1b, 0x00, 0x2f, 0x00, 0xfc, 0x4b, 0xb0, 0x16, 0x50, 0x58, 0xb5, 0x20, 0x01, 0x04, 0x02, 0x01, 0x4a,
-    0x1b, 0xb5, 0x20, 0x01, 0x04, 0x09, 0x01, 0x4a, 0x59, 0x4b, 0xb0, 0x16, 0x50, 0x58, 0x40, 0x22, 0x00, 0x05, 0x00,
-    0x06, 0x07, 0x05, 0x06, 0x61, 0x09, 0x01, 0x04, 0x04, 0x02, 0x5b, 0x03, 0x01, 0x02, 0x02, 0x44, 0x4b, 0x0a, 0x08,
-    0x02, 0x07, 0x07, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40,
-    0x2c, 0x00, 0x05, 0x00, 0x06, 0x07, 0x05, 0x06, 0x61, 0x00, 0x09, 0x09, 0x02, 0x5b, 0x03, 0x01, 0x02, 0x02, 0x44,
-    0x4b, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x03, 0x01, 0x02, 0x02, 0x44, 0x4b, 0x0a, 0x08, 0x02, 0x07, 0x07, 0x00, 0x5b,
-    0x01, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x1f, 0x50, 0x58, 0x40, 0x34, 0x00, 0x05, 0x00, 0x06,
-    0x07, 0x05, 0x06, 0x61, 0x00, 0x09, 0x09, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x44, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b,
-    0x00, 0x03, 0x03, 0x3c, 0x4b, 0x00, 0x07, 0x07, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x3d, 0x4b, 0x0a, 0x01, 0x08,
-    0x08, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x1b, 0x40, 0x32, 0x00, 0x05, 0x00, 0x06, 0x07, 0x05,
-    0x06, 0x61, 0x00, 0x09, 0x09, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x44, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03,
-    0x03, 0x3c, 0x4b, 0x00, 0x07, 0x07, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x3d, 0x4b, 0x0a, 0x01, 0x08, 0x08, 0x01, 0x5b,
-    0x00, 0x01, 0x01, 0x45, 0x01, 0x4c, 0x59, 0x59, 0x59, 0x40, 0x13, 0x1f, 0x1c, 0x24, 0x22, 0x1c, 0x2f, 0x1f, 0x2f,
-    0x11, 0x11, 0x11, 0x11, 0x21, 0x29, 0x21, 0x20, 0x0b, 0x08, 0x1c, 0x2b, 0x21, 0x21, 0x06, 0x06, 0x27, 0x2e, 0x03,
-    0x37, 0x13, 0x3e, 0x03, 0x33, 0x16, 0x16, 0x17, 0x21, 0x07, 0x21, 0x03, 0x21, 0x07, 0x21, 0x03, 0x21, 0x05, 0x16,
-    0x36, 0x33, 0x13, 0x26, 0x26, 0x23, 0x26, 0x0e, 0x02, 0x07, 0x03, 0x06, 0x06, 0x1e, 0x03, 0x04, 0x1b, 0xfe, 0x6c,
-    0x41, 0x7f, 0x41, 0x6c, 0x8a, 0x4a, 0x12, 0x0b, 0x48, 0x0f, 0x46, 0x75, 0xaa, 0x72, 0x41, 0x7e, 0x40, 0x01, 0xa2,
-    0x1b, 0xfe, 0x80, 0x53, 0x01, 0x4e, 0x1b, 0xfe, 0xb3, 0x5c, 0x01, 0x8c, 0xfd, 0x57, 0x18, 0x31, 0x18, 0xd5, 0x17,
-    0x30, 0x18, 0x50, 0x6a, 0x42, 0x24, 0x09, 0x47, 0x04, 0x07, 0x02, 0x0f, 0x25, 0x3e, 0x04, 0x10, 0x02, 0x03, 0x5e,
-    0x94, 0xb7, 0x5c, 0x01, 0xc3, 0x66, 0xbd, 0x93, 0x57, 0x01, 0x11, 0x04, 0x98, 0xfe, 0x24, 0x98, 0xfd, 0xf3, 0x12,
-    0x01, 0x01, 0x04, 0xa4, 0x02, 0x04, 0x01, 0x41, 0x6a, 0x86, 0x43, 0xfe, 0x39, 0x23, 0x51, 0x50, 0x4b, 0x3a, 0x25,
-    0x00, 0x03, 0x00, 0x0e, 0xff, 0xea, 0x04, 0x9c, 0x04, 0x51, 0x00, 0x30, 0x00, 0x4e, 0x00, 0x5d, 0x00, 0x47, 0x40,
-    0x44, 0x08, 0x01, 0x07, 0x00, 0x1f, 0x01, 0x03, 0x02, 0x26, 0x20, 0x02, 0x04, 0x03, 0x03, 0x4a, 0x0a, 0x01, 0x08,
-    0x00, 0x02, 0x03, 0x08, 0x02, 0x61, 0x09, 0x01, 0x07, 0x07, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x47, 0x4b, 0x06,
-    0x01, 0x03, 0x03, 0x04, 0x5b, 0x05, 0x01, 0x04, 0x04, 0x45, 0x04, 0x4c, 0x50, 0x4f, 0x57, 0x55, 0x4f, 0x5d, 0x50,
-    0x5d, 0x2d, 0x2d, 0x24, 0x25, 0x27, 0x17, 0x24, 0x24, 0x0b, 0x08, 0x1c, 0x2b, 0x13, 0x3e, 0x03, 0x17, 0x16, 0x16,
-    0x17, 0x36, 0x36, 0x17, 0x1e, 0x05, 0x07, 0x07, 0x25, 0x07, 0x06, 0x06, 0x14, 0x1e, 0x02, 0x17, 0x16, 0x36, 0x37,
-    0x17, 0x06, 0x06, 0x27, 0x26, 0x26, 0x27, 0x06, 0x06, 0x27, 0x2e, 0x05, 0x37, 0x17, 0x06, 0x06, 0x14, 0x1e, 0x02,
-    0x17, 0x16, 0x3e, 0x04, 0x37, 0x37, 0x36, 0x36, 0x34, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x04, 0x07, 0x25, 0x25, 0x37,
-    0x36, 0x34, 0x26, 0x26, 0x27, 0x26, 0x0e, 0x04, 0x07, 0x30, 0x0b, 0x37, 0x5f, 0x8d, 0x61, 0x48, 0x7a, 0x24, 0x31,
-    0x77, 0x4c, 0x39, 0x56, 0x3c, 0x25, 0x12, 0x01, 0x05, 0x1c, 0xfe, 0x48, 0x0a, 0x03, 0x06, 0x09, 0x19, 0x2a, 0x22,
-    0x36, 0x5f, 0x2a, 0x2c, 0x31, 0x7f, 0x45, 0x49, 0x7e, 0x26, 0x35, 0x81, 0x51, 0x3d, 0x5b, 0x3f, 0x27, 0x13, 0x01,
-    0x06, 0xb7, 0x02, 0x06, 0x09, 0x19, 0x2b, 0x23, 0x25, 0x39, 0x2a, 0x1d, 0x13, 0x0b, 0x04, 0x1b, 0x03, 0x05, 0x0a,
-    0x19, 0x2c, 0x22, 0x25, 0x39, 0x2a, 0x1d, 0x13, 0x0c, 0x03, 0x01, 0xec, 0x01, 0x0e, 0x0c, 0x03, 0x12, 0x2b, 0x28,
-    0x20, 0x32, 0x25, 0x1b, 0x13, 0x0c, 0x05, 0x02, 0x7e, 0x52, 0xa7, 0x87, 0x53, 0x02, 0x02, 0x3f, 0x40, 0x37, 0x4a,
-    0x01, 0x01, 0x26, 0x3f, 0x54, 0x5e, 0x63, 0x2e, 0xb5, 0x01, 0x43, 0x16, 0x3c, 0x42, 0x40, 0x34, 0x21, 0x01, 0x02,
-    0x27, 0x1e, 0x7f, 0x31, 0x2c, 0x02, 0x01, 0x3b, 0x41, 0x3b, 0x45, 0x02, 0x01, 0x2a, 0x45, 0x5c, 0x65, 0x6a, 0x32,
-    0x02, 0x16, 0x3f, 0x44, 0x44, 0x36, 0x23, 0x01, 0x02, 0x1f, 0x33, 0x43, 0x46, 0x44, 0x1b, 0xc8, 0x16, 0x3f, 0x45,
-    0x43, 0x37, 0x23, 0x01, 0x01, 0x1e, 0x33, 0x43, 0x47, 0x44, 0x1b, 0x03, 0x06, 0x55, 0x1c, 0x4b, 0x42, 0x2f, 0x02,
-    0x01, 0x1e, 0x34, 0x41, 0x43, 0x3e, 0x16, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x52, 0x00, 0x00, 0x04, 0x8c, 0x06,
-    0x2e, 0x00, 0x12, 0x00, 0x27, 0x40, 0x24, 0x09, 0x01, 0x01, 0x00, 0x0a, 0x01, 0x02, 0x01, 0x02, 0x4a, 0x00, 0x00,
-    0x00, 0x01, 0x02, 0x00, 0x01, 0x63, 0x03, 0x01, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x00, 0x00, 0x00, 0x12, 0x00, 0x12,
-    0x24, 0x25, 0x04, 0x08, 0x16, 0x2b, 0x21, 0x13, 0x3e, 0x03, 0x17, 0x16, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x0e,
-    0x02, 0x07, 0x03, 0x01, 0x52, 0xc0, 0x0e, 0x4e, 0x7b, 0xa8, 0x69, 0x26, 0x48, 0x24, 0x22, 0x2b, 0x2e, 0x46, 0x70,
-    0x53, 0x36, 0x0a, 0xc1, 0x04, 0x65, 0x63, 0xa9, 0x7a, 0x43, 0x01, 0x01, 0x0c, 0x08, 0x8f, 0x0b, 0x02, 0x01, 0x2d,
-    0x52, 0x71, 0x41, 0xfb, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xfe, 0x48, 0x04, 0xb6, 0x06, 0x2e, 0x00,
-    0x2a, 0x00, 0x3f, 0x40, 0x3c, 0x20, 0x01, 0x06, 0x05, 0x21, 0x01, 0x04, 0x06, 0x0b, 0x01, 0x02, 0x00, 0x0a, 0x01,
-    0x01, 0x02, 0x04, 0x4a, 0x00, 0x05, 0x00, 0x06, 0x04, 0x05, 0x06, 0x63, 0x03, 0x01, 0x00, 0x00, 0x04, 0x59, 0x07,
-    0x01, 0x04, 0x04, 0x3f, 0x4b, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x49, 0x01, 0x4c, 0x15, 0x24, 0x25,
-    0x11, 0x15, 0x25, 0x25, 0x10, 0x08, 0x08, 0x1c, 0x2b, 0x01, 0x23, 0x03, 0x0e, 0x03, 0x27, 0x26, 0x26, 0x27, 0x37,
-    0x16, 0x16, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x13, 0x23, 0x37, 0x33, 0x37, 0x3e, 0x03, 0x17, 0x16, 0x16, 0x17, 0x07,
-    0x26, 0x23, 0x26, 0x0e, 0x02, 0x07, 0x07, 0x33, 0x03, 0x9a, 0xce, 0x97, 0x0b, 0x3d, 0x66, 0x8c, 0x5a, 0x2a, 0x4f,
-    0x26, 0x1c, 0x20, 0x49, 0x24, 0x32, 0x4a, 0x34, 0x1f, 0x06, 0x98, 0xac, 0x16, 0xac, 0x0c, 0x0c, 0x4a, 0x77, 0x9d,
-    0x5f, 0x2f, 0x58, 0x2c, 0x21, 0x3d, 0x45, 0x3b, 0x64, 0x4b, 0x30, 0x09, 0x0e, 0xce, 0x03, 0xab, 0xfc, 0x21, 0x54,
-    0x8f, 0x68, 0x39, 0x02, 0x01, 0x13, 0x12, 0x93, 0x11, 0x12, 0x01, 0x01, 0x29, 0x44, 0x55, 0x2c, 0x03, 0xdf, 0x8f,
-    0x63, 0x5d, 0x95, 0x68, 0x37, 0x02, 0x01, 0x17, 0x0f, 0x94, 0x1f, 0x01, 0x1f, 0x3f, 0x5b, 0x3b, 0x63, 0x00, 0x00,
-    0x02, 0x00, 0x5f, 0xff, 0xea, 0x05, 0x3c, 0x05, 0xfb, 0x00, 0x25, 0x00, 0x43, 0x00, 0x55, 0x40, 0x0a, 0x19, 0x01,
-    0x03, 0x01, 0x22, 0x01, 0x04, 0x03, 0x02, 0x4a, 0x4b, 0xb0, 0x2a, 0x50, 0x58, 0x40, 0x1a, 0x00, 0x02, 0x02, 0x3e,
-    0x4b, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x44, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x00, 0x00, 0x00,
-    0x45, 0x00, 0x4c, 0x1b, 0x40, 0x1a, 0x00, 0x02, 0x01, 0x02, 0x72, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01,
-    0x44, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x59, 0xb7, 0x2d, 0x2d, 0x17, 0x2d,
-    0x26, 0x05, 0x08, 0x19, 0x2b, 0x01, 0x0e, 0x05, 0x27, 0x2e, 0x05, 0x37, 0x37, 0x3e, 0x05, 0x17, 0x16, 0x16, 0x17,
-    0x3e, 0x03, 0x37, 0x37, 0x06, 0x06, 0x07, 0x16, 0x16, 0x07, 0x27, 0x36, 0x36, 0x2e, 0x03, 0x27, 0x26, 0x0e, 0x04,
-    0x07, 0x07, 0x06, 0x06, 0x1e, 0x03, 0x17, 0x16, 0x3e, 0x04, 0x37, 0x04, 0x42, 0x0d, 0x2f, 0x47, 0x60, 0x7b, 0x97,
-    0x5a, 0x56, 0x83, 0x5e, 0x3c, 0x1e, 0x03, 0x0a, 0x1a, 0x0d, 0x2f, 0x47, 0x61, 0x7b, 0x97, 0x5a, 0x69, 0x95, 0x30,
-    0x25, 0x35, 0x24, 0x17, 0x07, 0x9f, 0x0d, 0x7f, 0x72, 0x1e, 0x0d, 0x0d, 0xb3, 0x06, 0x07, 0x09, 0x1c, 0x37, 0x55,
-    0x3e, 0x41, 0x69, 0x53, 0x3f, 0x2e, 0x1e, 0x09, 0x1c, 0x07, 0x05, 0x0a, 0x1c, 0x38, 0x55, 0x3e, 0x41, 0x6a, 0x52,
-    0x3e, 0x2d, 0x1e, 0x09, 0x02, 0x85, 0x4d, 0x9f, 0x95, 0x84, 0x60, 0x36, 0x02, 0x02, 0x3d, 0x64, 0x84, 0x92, 0x98,
-    0x47, 0xa6, 0x4d, 0x9f, 0x95, 0x84, 0x61, 0x36, 0x02, 0x02, 0x58, 0x45, 0x08, 0x28, 0x39, 0x46, 0x26, 0x01, 0x86,
-    0xad, 0x1f, 0x5b, 0xc7, 0x5d, 0x04, 0x2e, 0x6c, 0x6d, 0x67, 0x50, 0x32, 0x02, 0x02, 0x2b, 0x4d, 0x65, 0x71, 0x74,
-    0x34, 0xa9, 0x2d, 0x6c, 0x6e, 0x68, 0x51, 0x33, 0x02, 0x02, 0x2b, 0x4d, 0x66, 0x71, 0x74, 0x35, 0x00, 0x00, 0x02,
-    0x00, 0x5d, 0xff, 0xe9, 0x04, 0xe9, 0x04, 0xac, 0x00, 0x21, 0x00, 0x39, 0x00, 0x2f, 0x40, 0x2c, 0x0a, 0x01, 0x04,
-    0x00, 0x13, 0x01, 0x03, 0x04, 0x02, 0x4a, 0x00, 0x01, 0x00, 0x01, 0x72, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x00, 0x00,
-    0x00, 0x47, 0x4b, 0x00, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x45, 0x02, 0x4c, 0x29, 0x2b, 0x2b, 0x17, 0x26,
-    0x05, 0x08, 0x19, 0x2b, 0x13, 0x3e, 0x05, 0x17, 0x16, 0x16, 0x17, 0x3e, 0x03, 0x37, 0x37, 0x06, 0x06, 0x07, 0x16,
-    0x16, 0x07, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x33, 0x06, 0x1e, 0x04, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x37,
-    0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x6b, 0x09, 0x2d, 0x46, 0x5f, 0x75, 0x8b, 0x50, 0x5b, 0x8b, 0x31,
-    0x26, 0x36, 0x25, 0x16, 0x07, 0x9e, 0x0d, 0x76, 0x6b, 0x1e, 0x14, 0x08, 0x02, 0x0e, 0x59, 0x8e, 0xc1, 0x76, 0x71,
-    0xa1, 0x62, 0x26, 0x0b, 0xb5, 0x05, 0x01, 0x0f, 0x20, 0x36, 0x4d, 0x34, 0x53, 0x80, 0x5b, 0x36, 0x0b, 0x02, 0x07,
-    0x09, 0x32, 0x60, 0x4e, 0x54, 0x80, 0x5a, 0x36, 0x0a, 0x02, 0x20, 0x49, 0x8d, 0x7d, 0x69, 0x4b, 0x29, 0x02, 0x02,
-    0x3e, 0x35, 0x07, 0x27, 0x37, 0x46, 0x26, 0x02, 0x82, 0xa9, 0x20, 0x45, 0x9f, 0x53, 0x17, 0x6d, 0xca, 0x99, 0x5a,
-    0x03, 0x03, 0x5d, 0x98, 0xc0, 0x66, 0x2a, 0x5a, 0x56, 0x4e, 0x3b, 0x24, 0x02, 0x03, 0x48, 0x74, 0x91, 0x48, 0x16,
-    0x3f, 0x8a, 0x75, 0x4d, 0x03, 0x03, 0x49, 0x76, 0x93, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x68, 0xff, 0xea,
-    0x05, 0xf1, 0x05, 0xe9, 0x00, 0x23, 0x00, 0x2d, 0x40, 0x2a, 0x01, 0x01, 0x03, 0x02, 0x01, 0x4a, 0x00, 0x00, 0x00,
-    0x3e, 0x4b, 0x05, 0x04, 0x02, 0x02, 0x02, 0x3c, 0x4b, 0x00, 0x03, 0x03, 0x01, 0x5c, 0x00, 0x01, 0x01, 0x45, 0x01,
-    0x4c, 0x00, 0x00, 0x00, 0x23, 0x00, 0x23, 0x25, 0x15, 0x28, 0x16, 0x06, 0x08, 0x18, 0x2b, 0x01, 0x07, 0x3e, 0x03,
-    0x37, 0x37, 0x06, 0x06, 0x07, 0x03, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x13, 0x33, 0x03, 0x06, 0x1e, 0x02, 0x17,
-    0x16, 0x3e, 0x02, 0x37, 0x13, 0x04, 0xb5, 0x1f, 0x2e, 0x40, 0x2c, 0x1a, 0x08, 0x9f, 0x12, 0xb6, 0xab, 0x70, 0x0f,
-    0x5c, 0x8c, 0xb6, 0x6a, 0x64, 0x9a, 0x65, 0x2c, 0x0b, 0xaa, 0xac, 0xa5, 0x07, 0x12, 0x36, 0x5b, 0x43, 0x47, 0x75,
-    0x57, 0x38, 0x0c, 0xac, 0x05, 0xb0, 0xb8, 0x08, 0x27, 0x3e, 0x51, 0x32, 0x01, 0xb4, 0xb9, 0x0e, 0xfd, 0x69, 0x64,
-    0xb4, 0x87, 0x4e, 0x02, 0x02, 0x53, 0x87, 0xaf, 0x5e, 0x03, 0xdb, 0xfc, 0x25, 0x3b, 0x74, 0x5e, 0x3d, 0x02, 0x02,
-    0x37, 0x5e, 0x7a, 0x40, 0x03, 0xda, 0x00, 0x01, 0x00, 0x8d, 0xff, 0xea, 0x05, 0x74, 0x04, 0x94, 0x00, 0x1f, 0x00,
-    0x50, 0xb5, 0x16, 0x01, 0x02, 0x01, 0x01, 0x4a, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x17, 0x00, 0x04, 0x01, 0x04,
-    0x72, 0x03, 0x01, 0x01, 0x01, 0x3f, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5c, 0x05, 0x01, 0x00, 0x00, 0x45, 0x00, 0x4c,
-    0x1b, 0x40, 0x1b, 0x00, 0x04, 0x01, 0x04, 0x72, 0x03, 0x01, 0x01, 0x01, 0x3f, 0x4b, 0x00, 0x05, 0x05, 0x3d, 0x4b,
-    0x00, 0x02, 0x02, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x59, 0x40, 0x09, 0x14, 0x14, 0x13, 0x25, 0x15,
-    0x22, 0x06, 0x08, 0x1a, 0x2b, 0x25, 0x06, 0x06, 0x27, 0x2e, 0x03, 0x37, 0x13, 0x33, 0x03, 0x06, 0x06, 0x16, 0x16,
-    0x17, 0x16, 0x36, 0x37, 0x13, 0x33, 0x07, 0x36, 0x36, 0x37, 0x37, 0x06, 0x06, 0x07, 0x03, 0x23, 0x03, 0x0c, 0x40,
-    0xa6, 0x69, 0x61, 0x7b, 0x43, 0x11, 0x09, 0x6c, 0xb5, 0x6b, 0x06, 0x02, 0x1d, 0x44, 0x3f, 0x64, 0x9a, 0x35, 0x87,
-    0xb6, 0x18, 0x47, 0x43, 0x0e, 0xa0, 0x11, 0xa8, 0x98, 0x8b, 0xa3, 0x95, 0x4f, 0x5c, 0x02, 0x02, 0x51, 0x82, 0xa3,
-    0x53, 0x02, 0x83, 0xfd, 0x7a, 0x32, 0x69, 0x56, 0x38, 0x02, 0x03, 0x59, 0x52, 0x03, 0x09, 0x8b, 0x16, 0x75, 0x59,
-    0x01, 0xaa, 0xb6, 0x14, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xfe, 0x49, 0x03, 0x66, 0x04, 0x3a, 0x00,
-    0x15, 0x00, 0x29, 0x40, 0x26, 0x0b, 0x01, 0x02, 0x03, 0x0a, 0x01, 0x01, 0x02, 0x02, 0x4a, 0x00, 0x03, 0x03, 0x00,
-    0x59, 0x00, 0x00, 0x00, 0x3f, 0x4b, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x49, 0x01, 0x4c, 0x15, 0x25,
-    0x25, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x21, 0x03, 0x0e, 0x03, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x17,
-    0x16, 0x3e, 0x02, 0x37, 0x13, 0x21, 0x01, 0x50, 0x02, 0x16, 0xb9, 0x0e, 0x4b, 0x78, 0xa3, 0x66, 0x36, 0x67, 0x35,
-    0x1a, 0x2d, 0x59, 0x2d, 0x41, 0x67, 0x4a, 0x2e, 0x09, 0x9e, 0xfe, 0x9e, 0x04, 0x3a, 0xfb, 0xbf, 0x62, 0xa0, 0x71,
-    0x3d, 0x09, 0x08, 0x9a, 0x08, 0x07, 0x01, 0x01, 0x28, 0x49, 0x66, 0x3e, 0x03, 0xa1, 0x00, 0x02, 0x00, 0x8a, 0xff,
-    0xeb, 0x04, 0x3f, 0x04, 0x4f, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x43, 0x40, 0x40, 0x1d, 0x01, 0x03, 0x00, 0x1c, 0x01,
-    0x02, 0x03, 0x02, 0x4a, 0x00, 0x02, 0x00, 0x05, 0x04, 0x02, 0x05, 0x61, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x06, 0x01,
-    0x00, 0x00, 0x47, 0x4b, 0x07, 0x01, 0x04, 0x04, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x45, 0x01, 0x4c, 0x23, 0x22, 0x01,
-    0x00, 0x28, 0x27, 0x22, 0x2d, 0x23, 0x2d, 0x1a, 0x18, 0x14, 0x13, 0x0e, 0x0c, 0x00, 0x21, 0x01, 0x21, 0x08, 0x08,
-    0x14, 0x2b, 0x01, 0x1e, 0x03, 0x07, 0x07, 0x0e, 0x05, 0x27, 0x2e, 0x03, 0x37, 0x37, 0x21, 0x36, 0x2e, 0x02, 0x27,
-    0x26, 0x06, 0x07, 0x27, 0x3e, 0x03, 0x03, 0x16, 0x3e, 0x02, 0x37, 0x25, 0x07, 0x06, 0x1e, 0x02, 0x02, 0x98, 0x72,
-    0xa5, 0x67, 0x29, 0x0a, 0x05, 0x08, 0x2e, 0x47, 0x60, 0x74, 0x86, 0x4a, 0x69, 0x99, 0x5f, 0x24, 0x0c, 0x13, 0x02,
-    0xd8, 0x08, 0x10, 0x37, 0x64, 0x4c, 0x5b, 0xa9, 0x49, 0x3e, 0x28, 0x5f, 0x68, 0x6d, 0x4a, 0x42, 0x6b, 0x53, 0x3e,
-    0x15, 0xfd, 0xdc, 0x05, 0x09, 0x14, 0x37, 0x59, 0x04, 0x4e, 0x02, 0x5a, 0x94, 0xc0, 0x69, 0x2d, 0x45, 0x86, 0x79,
-    0x67, 0x4a, 0x28, 0x02, 0x03, 0x4c, 0x82, 0xae, 0x63, 0x79, 0x41, 0x81, 0x67, 0x43, 0x02, 0x03, 0x36, 0x36, 0x7f,
-    0x24, 0x33, 0x1f, 0x0d, 0xfc, 0x34, 0x02, 0x35, 0x57, 0x6d, 0x37, 0x01, 0x1c, 0x39, 0x63, 0x4a, 0x2c, 0x00, 0x01,
-    0x01, 0x2e, 0x04, 0xe3, 0x03, 0x7d, 0x05, 0xed, 0x00, 0x08, 0x00, 0x1b, 0x40, 0x18, 0x03, 0x01, 0x00, 0x02, 0x01,
-    0x4a, 0x01, 0x01, 0x00, 0x02, 0x00, 0x73, 0x00, 0x02, 0x02, 0x3e, 0x02, 0x4c, 0x12, 0x12, 0x11, 0x03, 0x08, 0x17,
-    0x2b, 0x01, 0x07, 0x27, 0x27, 0x07, 0x07, 0x37, 0x25, 0x33, 0x03, 0x7d, 0x02, 0x92, 0x76, 0xac, 0x99, 0x02, 0x01,
-    0x10, 0x6a, 0x04, 0xfe, 0x1b, 0x01, 0x96, 0x95, 0x01, 0x1b, 0xee, 0x00, 0x00, 0x00, 0x01, 0x01, 0xc1, 0x04, 0xe3,
-    0x04, 0x1d, 0x05, 0xee, 0x00, 0x08, 0x00, 0x1b, 0x40, 0x18, 0x03, 0x01, 0x01, 0x00, 0x01, 0x4a, 0x00, 0x01, 0x00,
-    0x01, 0x73, 0x02, 0x01, 0x00, 0x00, 0x3e, 0x00, 0x4c, 0x12, 0x12, 0x11, 0x03, 0x08, 0x17, 0x2b, 0x01, 0x37, 0x37,
-    0x07, 0x05, 0x23, 0x27, 0x37, 0x17, 0x02, 0xce, 0xae, 0xa1, 0x01, 0xfe, 0xe7, 0x70, 0xd2, 0x02, 0x95, 0x05, 0x56,
-    0x96, 0x02, 0x14, 0xf7, 0xf4, 0x17, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0xb6, 0x04, 0xa6, 0x03, 0xf8, 0x05, 0xb3,
-    0x00, 0x15, 0x00, 0x1e, 0x40, 0x1b, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x5f, 0x04, 0x03, 0x02, 0x01, 0x01, 0x3c,
-    0x01, 0x4c, 0x00, 0x00, 0x00, 0x15, 0x00, 0x15, 0x24, 0x14, 0x24, 0x05, 0x08, 0x17, 0x2b, 0x01, 0x0e, 0x03, 0x27,
-    0x2e, 0x03, 0x37, 0x17, 0x06, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x03, 0xf8, 0x06, 0x33, 0x52, 0x6b, 0x3f,
-    0x3d, 0x63, 0x47, 0x26, 0x01, 0x92, 0x01, 0x0c, 0x1e, 0x2f, 0x23, 0x23, 0x37, 0x29, 0x1a, 0x06, 0x05, 0xb2, 0x3f,
-    0x64, 0x45, 0x24, 0x01, 0x01, 0x27, 0x45, 0x62, 0x3d, 0x01, 0x20, 0x36, 0x28, 0x17, 0x16, 0x28, 0x36, 0x20, 0x00,
-    0x01, 0x02, 0x66, 0x04, 0xdf, 0x03, 0x47, 0x05, 0xc0, 0x00, 0x0d, 0x00, 0x13, 0x40, 0x10, 0x00, 0x01, 0x01, 0x00,
-    0x5b, 0x00, 0x00, 0x00, 0x44, 0x01, 0x4c, 0x24, 0x22, 0x02, 0x08, 0x16, 0x2b, 0x01, 0x36, 0x36, 0x37, 0x36, 0x16,
-    0x07, 0x06, 0x06, 0x07, 0x06, 0x2e, 0x02, 0x02, 0x66, 0x01, 0x3e, 0x32, 0x31, 0x3f, 0x01, 0x01, 0x3f, 0x30, 0x18,
-    0x29, 0x1e, 0x11, 0x05, 0x4b, 0x32, 0x40, 0x02, 0x01, 0x3e, 0x31, 0x31, 0x3e, 0x02, 0x01, 0x0f, 0x1d, 0x28, 0x00,
-    0x02, 0x02, 0x08, 0x04, 0x5d, 0x03, 0x96, 0x05, 0xe8, 0x00, 0x13, 0x00, 0x25, 0x00, 0x1c, 0x40, 0x19, 0x00, 0x02,
-    0x00, 0x01, 0x02, 0x01, 0x5f, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x3e, 0x03, 0x4c, 0x28, 0x26, 0x28,
-    0x24, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x07, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02,
-    0x37, 0x06, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x02, 0x09, 0x01, 0x24,
-    0x3a, 0x4d, 0x2b, 0x28, 0x44, 0x30, 0x1a, 0x01, 0x02, 0x22, 0x39, 0x4c, 0x2b, 0x28, 0x44, 0x32, 0x1b, 0x63, 0x03,
-    0x30, 0x2a, 0x16, 0x27, 0x1f, 0x13, 0x03, 0x02, 0x0a, 0x16, 0x21, 0x15, 0x17, 0x29, 0x1f, 0x14, 0x05, 0x18, 0x2b,
-    0x4c, 0x39, 0x20, 0x1f, 0x34, 0x46, 0x27, 0x2b, 0x4a, 0x37, 0x1f, 0x1d, 0x32, 0x44, 0x2b, 0x28, 0x3c, 0x12, 0x1f,
-    0x28, 0x15, 0x14, 0x25, 0x1d, 0x12, 0x13, 0x20, 0x29, 0x00, 0x00, 0x01, 0x01, 0x00, 0xfe, 0x4f, 0x02, 0x68, 0x00,
-    0x39, 0x00, 0x16, 0x00, 0x1e, 0x40, 0x1b, 0x0b, 0x01, 0x01, 0x00, 0x01, 0x4a, 0x16, 0x0a, 0x02, 0x00, 0x48, 0x00,
-    0x00, 0x00, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x49, 0x01, 0x4c, 0x26, 0x16, 0x02, 0x08, 0x16, 0x2b, 0x05, 0x0e, 0x03,
-    0x07, 0x06, 0x17, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x26, 0x26, 0x37, 0x3e, 0x03, 0x37, 0x02, 0x68, 0x20,
-    0x42, 0x38, 0x27, 0x04, 0x06, 0x3f, 0x1a, 0x32, 0x17, 0x15, 0x26, 0x55, 0x2c, 0x51, 0x5c, 0x02, 0x01, 0x34, 0x4f,
-    0x5f, 0x2d, 0x03, 0x11, 0x2d, 0x37, 0x43, 0x27, 0x42, 0x01, 0x02, 0x10, 0x0b, 0x7b, 0x16, 0x14, 0x01, 0x01, 0x64,
-    0x51, 0x37, 0x5e, 0x4c, 0x3c, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf0, 0x04, 0xe4, 0x03, 0xab, 0x05, 0xf0, 0x00,
-    0x1d, 0x00, 0x4b, 0x40, 0x0e, 0x10, 0x01, 0x00, 0x01, 0x01, 0x4a, 0x1d, 0x01, 0x02, 0x48, 0x0f, 0x01, 0x00, 0x47,
-    0x4b, 0xb0, 0x16, 0x50, 0x58, 0x40, 0x15, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x3e, 0x4b, 0x00, 0x00,
-    0x00, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x3c, 0x00, 0x4c, 0x1b, 0x40, 0x12, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x5f,
-    0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x3e, 0x01, 0x4c, 0x59, 0xb6, 0x23, 0x29, 0x23, 0x24, 0x04, 0x08,
-    0x18, 0x2b, 0x01, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x07, 0x0e, 0x03, 0x07, 0x27, 0x3e, 0x03, 0x33, 0x32, 0x1e,
-    0x02, 0x37, 0x36, 0x36, 0x37, 0x03, 0xab, 0x05, 0x21, 0x37, 0x4d, 0x30, 0x26, 0x40, 0x3d, 0x3f, 0x25, 0x18, 0x27,
-    0x1d, 0x14, 0x06, 0x64, 0x05, 0x22, 0x37, 0x4d, 0x30, 0x25, 0x40, 0x3e, 0x3f, 0x25, 0x32, 0x3a, 0x0c, 0x05, 0xd3,
-    0x2c, 0x51, 0x3f, 0x26, 0x1f, 0x26, 0x1f, 0x01, 0x01, 0x13, 0x1f, 0x28, 0x15, 0x17, 0x2b, 0x54, 0x41, 0x27, 0x20,
-    0x25, 0x1f, 0x01, 0x02, 0x43, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x58, 0x04, 0xe2, 0x04, 0x61, 0x05, 0xef,
-    0x00, 0x03, 0x00, 0x07, 0x00, 0x17, 0x40, 0x14, 0x03, 0x01, 0x01, 0x01, 0x00, 0x59, 0x02, 0x01, 0x00, 0x00, 0x3e,
-    0x01, 0x4c, 0x11, 0x11, 0x11, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x33, 0x01, 0x23, 0x03, 0x33, 0x01, 0x23, 0x03,
-    0x76, 0xeb, 0xfe, 0xa9, 0xb5, 0x17, 0xd8, 0xfe, 0xe3, 0xa1, 0x05, 0xef, 0xfe, 0xf3, 0x01, 0x0d, 0xfe, 0xf3, 0x00,
-    0x00, 0x00, 0x02, 0x01, 0x0f, 0xfe, 0x85, 0x02, 0x39, 0xff, 0xac, 0x00, 0x13, 0x00, 0x23, 0x00, 0x3f, 0x4b, 0xb0,
-    0x1b, 0x50, 0x58, 0x40, 0x13, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x03, 0x63, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x00,
-    0x01, 0x01, 0x41, 0x01, 0x4c, 0x1b, 0x40, 0x18, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x03, 0x63, 0x00, 0x02, 0x01,
-    0x01, 0x02, 0x57, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x00, 0x01, 0x02, 0x01, 0x4f, 0x59, 0xb6, 0x17, 0x16, 0x28, 0x24,
-    0x04, 0x08, 0x18, 0x2b, 0x05, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x07, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x37,
-    0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x01, 0x10, 0x01, 0x19, 0x2b, 0x38,
-    0x20, 0x1e, 0x33, 0x26, 0x15, 0x01, 0x01, 0x19, 0x29, 0x38, 0x1f, 0x1e, 0x35, 0x27, 0x15, 0x55, 0x04, 0x14, 0x1d,
-    0x0d, 0x19, 0x14, 0x0e, 0x02, 0x03, 0x1b, 0x19, 0x10, 0x19, 0x12, 0x0e, 0xef, 0x20, 0x38, 0x2a, 0x19, 0x16, 0x27,
-    0x34, 0x1e, 0x20, 0x37, 0x29, 0x18, 0x14, 0x26, 0x34, 0x21, 0x17, 0x26, 0x0b, 0x13, 0x18, 0x0d, 0x17, 0x29, 0x0c,
-    0x14, 0x1a, 0x00, 0x01, 0xfd, 0x8d, 0x04, 0xbc, 0xfe, 0x72, 0x06, 0x16, 0x00, 0x03, 0x00, 0x18, 0x40, 0x15, 0x00,
-    0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x01, 0x00, 0x4d, 0x11, 0x10, 0x02, 0x08,
-    0x16, 0x2b, 0x01, 0x23, 0x03, 0x33, 0xfe, 0x72, 0x72, 0x73, 0xa5, 0x04, 0xbc, 0x01, 0x5a, 0x00, 0x00, 0x01, 0xfd,
-    0xe1, 0x04, 0xbc, 0xff, 0x4e, 0x06, 0x17, 0x00, 0x03, 0x00, 0x11, 0x40, 0x0e, 0x00, 0x00, 0x01, 0x00, 0x72, 0x00,
-    0x01, 0x01, 0x69, 0x11, 0x10, 0x02, 0x08, 0x16, 0x2b, 0x01, 0x33, 0x03, 0x23, 0xfe, 0x9c, 0xb2, 0xf2, 0x7b, 0x06,
-    0x17, 0xfe, 0xa5, 0xff, 0xff, 0xfd, 0x0d, 0x04, 0xe4, 0xff, 0xc8, 0x05, 0xf0, 0x00, 0x07, 0x00, 0xa2, 0xfc, 0x1d,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfd, 0xf0, 0x04, 0xd8, 0xff, 0x30, 0x06, 0x73, 0x00, 0x17, 0x00, 0x24, 0x40,
-    0x21, 0x03, 0x01, 0x02, 0x00, 0x02, 0x73, 0x00, 0x01, 0x00, 0x00, 0x01, 0x57, 0x00, 0x01, 0x01, 0x00, 0x5b, 0x00,
-    0x00, 0x01, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x17, 0x00, 0x17, 0x12, 0x19, 0x04, 0x08, 0x16, 0x2b, 0x01, 0x37, 0x3e,
-    0x03, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x37, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x07, 0xfd, 0xf0, 0x16, 0x15, 0x33,
-    0x2f, 0x23, 0x04, 0x04, 0x20, 0x30, 0x34, 0x10, 0x0e, 0x29, 0x60, 0x51, 0x34, 0x02, 0x02, 0x1c, 0x2e, 0x3c, 0x21,
-    0x0b, 0x04, 0xd9, 0x99, 0x02, 0x05, 0x10, 0x1e, 0x1b, 0x1b, 0x1c, 0x0e, 0x02, 0x01, 0x69, 0x02, 0x10, 0x29, 0x44,
-    0x36, 0x25, 0x36, 0x26, 0x17, 0x06, 0x48, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfc, 0xbb, 0x04, 0xe4, 0xff, 0x65, 0x05,
-    0xee, 0x00, 0x03, 0x00, 0x07, 0x00, 0x17, 0x40, 0x14, 0x02, 0x01, 0x00, 0x00, 0x01, 0x59, 0x03, 0x01, 0x01, 0x01,
-    0x3e, 0x00, 0x4c, 0x11, 0x11, 0x11, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x23, 0x03, 0x33, 0x01, 0x23, 0x03, 0x33,
-    0xfe, 0x69, 0xb3, 0xfb, 0xe9, 0x01, 0xc1, 0x9f, 0xc1, 0xd7, 0x04, 0xe4, 0x01, 0x0a, 0xfe, 0xf6, 0x01, 0x0a, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xfc, 0xac, 0xfe, 0xa6, 0xfd, 0x8c, 0xff, 0x87, 0x00, 0x0f, 0x00, 0x18, 0x40, 0x15, 0x00,
-    0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x5b, 0x00, 0x01, 0x00, 0x01, 0x4f, 0x26, 0x22, 0x02, 0x08,
-    0x16, 0x2b, 0x05, 0x36, 0x36, 0x37, 0x36, 0x1e, 0x02, 0x15, 0x06, 0x06, 0x07, 0x06, 0x2e, 0x02, 0xfc, 0xac, 0x01,
-    0x3e, 0x32, 0x18, 0x29, 0x1e, 0x10, 0x01, 0x3f, 0x30, 0x18, 0x29, 0x1e, 0x11, 0xee, 0x31, 0x41, 0x02, 0x01, 0x10,
-    0x1e, 0x29, 0x18, 0x31, 0x3e, 0x02, 0x01, 0x0f, 0x1d, 0x28, 0x00, 0x01, 0x02, 0x8a, 0x04, 0xf7, 0x03, 0xd2, 0x06,
-    0x7a, 0x00, 0x03, 0x00, 0x11, 0x40, 0x0e, 0x00, 0x00, 0x01, 0x00, 0x72, 0x00, 0x01, 0x01, 0x69, 0x11, 0x10, 0x02,
-    0x07, 0x16, 0x2b, 0x01, 0x33, 0x03, 0x23, 0x03, 0x0d, 0xc5, 0xe9, 0x5f, 0x06, 0x7a, 0xfe, 0x7d, 0x00, 0x03, 0x01,
-    0x8e, 0x04, 0xe0, 0x04, 0x59, 0x06, 0xbf, 0x00, 0x03, 0x00, 0x11, 0x00, 0x21, 0x00, 0x21, 0x40, 0x1e, 0x00, 0x00,
-    0x00, 0x01, 0x03, 0x00, 0x01, 0x61, 0x05, 0x01, 0x03, 0x03, 0x02, 0x5b, 0x04, 0x01, 0x02, 0x02, 0x30, 0x03, 0x4c,
-    0x26, 0x26, 0x24, 0x23, 0x11, 0x10, 0x06, 0x07, 0x1a, 0x2b, 0x01, 0x33, 0x03, 0x23, 0x05, 0x36, 0x36, 0x37, 0x36,
-    0x16, 0x07, 0x06, 0x06, 0x07, 0x06, 0x2e, 0x02, 0x25, 0x36, 0x36, 0x37, 0x36, 0x1e, 0x02, 0x15, 0x06, 0x06, 0x07,
-    0x06, 0x2e, 0x02, 0x03, 0x22, 0xcf, 0xa1, 0x8b, 0xfe, 0xc9, 0x01, 0x3d, 0x32, 0x31, 0x3f, 0x01, 0x01, 0x3e, 0x31,
-    0x18, 0x29, 0x1e, 0x10, 0x01, 0xec, 0x01, 0x3d, 0x32, 0x18, 0x29, 0x1e, 0x10, 0x01, 0x3f, 0x31, 0x18, 0x28, 0x1e,
-    0x10, 0x06, 0xbf, 0xfe, 0xf8, 0x6a, 0x31, 0x41, 0x02, 0x01, 0x3e, 0x31, 0x31, 0x3f, 0x02, 0x01, 0x10, 0x1d, 0x28,
-    0x18, 0x31, 0x41, 0x02, 0x01, 0x10, 0x1e, 0x29, 0x18, 0x31, 0x3f, 0x02, 0x01, 0x10, 0x1d, 0x28, 0xff, 0xff, 0x02,
-    0x35, 0x02, 0x69, 0x03, 0x15, 0x03, 0x4b, 0x02, 0x06, 0x00, 0x76, 0x36, 0x00, 0x00, 0x01, 0x00, 0x47, 0x00, 0x00,
-    0x04, 0xa5, 0x05, 0xb0, 0x00, 0x05, 0x00, 0x19, 0x40, 0x16, 0x00, 0x00, 0x00, 0x02, 0x59, 0x00, 0x02, 0x02, 0x28,
-    0x4b, 0x00, 0x01, 0x01, 0x29, 0x01, 0x4c, 0x11, 0x11, 0x10, 0x03, 0x07, 0x17, 0x2b, 0x01, 0x21, 0x03, 0x23, 0x13,
-    0x21, 0x04, 0x8a, 0xfd, 0x55, 0xe2, 0xb6, 0xfd, 0x03, 0x61, 0x05, 0x18, 0xfa, 0xe8, 0x05, 0xb0, 0x00, 0x02, 0xff,
-    0xc0, 0x00, 0x00, 0x04, 0x25, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x06, 0x00, 0x1f, 0x40, 0x1c, 0x06, 0x01, 0x02, 0x00,
-    0x01, 0x4a, 0x00, 0x00, 0x00, 0x28, 0x4b, 0x00, 0x02, 0x02, 0x01, 0x5a, 0x00, 0x01, 0x01, 0x29, 0x01, 0x4c, 0x11,
-    0x11, 0x10, 0x03, 0x07, 0x17, 0x2b, 0x01, 0x33, 0x13, 0x21, 0x25, 0x21, 0x03, 0x02, 0xb3, 0x9d, 0xd5, 0xfb, 0x9b,
-    0x01, 0x0c, 0x02, 0x93, 0x85, 0x05, 0xb0, 0xfa, 0x50, 0x97, 0x04, 0x19, 0x00, 0x03, 0x00, 0x66, 0xff, 0xea, 0x04,
-    0x6d, 0x05, 0xc6, 0x00, 0x03, 0x00, 0x21, 0x00, 0x3f, 0x00, 0x29, 0x40, 0x26, 0x00, 0x01, 0x00, 0x00, 0x05, 0x01,
-    0x00, 0x61, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x30, 0x4b, 0x00, 0x05, 0x05, 0x02, 0x5b, 0x00, 0x02,
-    0x02, 0x31, 0x02, 0x4c, 0x2d, 0x2d, 0x2d, 0x27, 0x11, 0x10, 0x06, 0x07, 0x1a, 0x2b, 0x01, 0x21, 0x37, 0x21, 0x17,
-    0x0e, 0x05, 0x27, 0x2e, 0x05, 0x37, 0x37, 0x3e, 0x05, 0x17, 0x1e, 0x05, 0x07, 0x27, 0x36, 0x36, 0x2e, 0x03, 0x27,
-    0x26, 0x0e, 0x04, 0x07, 0x07, 0x06, 0x06, 0x1e, 0x03, 0x17, 0x16, 0x3e, 0x04, 0x37, 0x03, 0x3f, 0xfe, 0x3c, 0x1b,
-    0x01, 0xc3, 0xf0, 0x0d, 0x2f, 0x47, 0x60, 0x7b, 0x97, 0x5a, 0x56, 0x83, 0x5e, 0x3c, 0x1e, 0x03, 0x0a, 0x1a, 0x0d,
-    0x2f, 0x47, 0x61, 0x7b, 0x97, 0x5a, 0x57, 0x83, 0x5e, 0x3b, 0x1d, 0x03, 0x0a, 0xb3, 0x06, 0x07, 0x09, 0x1c, 0x37,
-    0x55, 0x3e, 0x41, 0x69, 0x53, 0x3f, 0x2e, 0x1e, 0x09, 0x1c, 0x06, 0x06, 0x0a, 0x1c, 0x38, 0x55, 0x3e, 0x41, 0x6a,
-    0x52, 0x3e, 0x2d, 0x1e, 0x09, 0x02, 0x94, 0x97, 0xa6, 0x4d, 0x9f, 0x95, 0x84, 0x60, 0x36, 0x02, 0x02, 0x3d, 0x64,
-    0x84, 0x92, 0x98, 0x47, 0xa6, 0x4d, 0x9f, 0x95, 0x84, 0x61, 0x36, 0x02, 0x02, 0x3d, 0x64, 0x84, 0x93, 0x99, 0x47,
-    0x04, 0x2e, 0x6c, 0x6d, 0x67, 0x50, 0x32, 0x02, 0x02, 0x2b, 0x4d, 0x65, 0x71, 0x74, 0x34, 0xa9, 0x2d, 0x6c, 0x6e,
-    0x68, 0x51, 0x33, 0x02, 0x02, 0x2b, 0x4d, 0x66, 0x71, 0x74, 0x35, 0x00, 0x00, 0x01, 0xff, 0xc8, 0x00, 0x00, 0x04,
-    0x12, 0x05, 0xb0, 0x00, 0x06, 0x00, 0x15, 0x40, 0x12, 0x00, 0x01, 0x01, 0x28, 0x4b, 0x02, 0x01, 0x00, 0x00, 0x29,
-    0x00, 0x4c, 0x11, 0x11, 0x11, 0x03, 0x07, 0x17, 0x2b, 0x01, 0x01, 0x23, 0x01, 0x33, 0x13, 0x23, 0x02, 0xc0, 0xfd,
-    0xc8, 0xc0, 0x02, 0xd2, 0x9e, 0xda, 0xb2, 0x04, 0x9a, 0xfb, 0x66, 0x05, 0xb0, 0xfa, 0x50, 0x00, 0x03, 0x00, 0x24,
-    0x00, 0x00, 0x04, 0x9f, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x29, 0x40, 0x26, 0x00, 0x02, 0x00,
-    0x03, 0x00, 0x02, 0x03, 0x61, 0x00, 0x05, 0x05, 0x04, 0x59, 0x00, 0x04, 0x04, 0x28, 0x4b, 0x00, 0x00, 0x00, 0x01,
-    0x59, 0x00, 0x01, 0x01, 0x29, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x07, 0x1a, 0x2b, 0x37, 0x21,
-    0x07, 0x21, 0x13, 0x21, 0x07, 0x21, 0x13, 0x21, 0x07, 0x21, 0x3f, 0x03, 0x8b, 0x1b, 0xfc, 0x75, 0xe3, 0x02, 0xdd,
-    0x1b, 0xfd, 0x23, 0x37, 0x03, 0x7c, 0x1b, 0xfc, 0x84, 0x97, 0x97, 0x03, 0x3e, 0x98, 0x03, 0x0a, 0x98, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x35, 0x00, 0x00, 0x04, 0x9f, 0x05, 0xb0, 0x00, 0x07, 0x00, 0x1b, 0x40, 0x18, 0x00, 0x01,
-    0x01, 0x03, 0x59, 0x00, 0x03, 0x03, 0x28, 0x4b, 0x02, 0x01, 0x00, 0x00, 0x29, 0x00, 0x4c, 0x11, 0x11, 0x11, 0x10,
-    0x04, 0x07, 0x18, 0x2b, 0x21, 0x23, 0x13, 0x21, 0x03, 0x23, 0x13, 0x21, 0x03, 0xa3, 0xb5, 0xe2, 0xfd, 0xfc, 0xe3,
-    0xb4, 0xfc, 0x03, 0x6e, 0x05, 0x18, 0xfa, 0xe8, 0x05, 0xb0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x04,
-    0xb2, 0x05, 0xb0, 0x00, 0x0c, 0x00, 0x25, 0x40, 0x22, 0x06, 0x01, 0x00, 0x03, 0x01, 0x4a, 0x00, 0x03, 0x03, 0x02,
-    0x59, 0x00, 0x02, 0x02, 0x28, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x29, 0x01, 0x4c, 0x11, 0x14,
-    0x11, 0x11, 0x04, 0x07, 0x18, 0x2b, 0x01, 0x01, 0x21, 0x07, 0x21, 0x37, 0x01, 0x01, 0x37, 0x21, 0x07, 0x21, 0x01,
-    0x03, 0x17, 0xfd, 0xee, 0x02, 0xfc, 0x1b, 0xfc, 0x1e, 0x1b, 0x02, 0x3c, 0xfe, 0x8e, 0x18, 0x03, 0xb1, 0x1b, 0xfd,
-    0x28, 0x01, 0x5b, 0x02, 0xcd, 0xfd, 0xcb, 0x98, 0x99, 0x02, 0x49, 0x02, 0x47, 0x87, 0x98, 0xfd, 0xcf, 0x00, 0x03,
-    0x00, 0x50, 0x00, 0x00, 0x04, 0x83, 0x05, 0xb0, 0x00, 0x19, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x1d, 0x40, 0x1a, 0x2b,
-    0x2a, 0x20, 0x1f, 0x0d, 0x05, 0x00, 0x01, 0x01, 0x4a, 0x00, 0x01, 0x01, 0x28, 0x4b, 0x00, 0x00, 0x00, 0x29, 0x00,
-    0x4c, 0x1c, 0x1b, 0x02, 0x07, 0x16, 0x2b, 0x01, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x07, 0x23, 0x37, 0x2e, 0x03,
-    0x37, 0x3e, 0x03, 0x37, 0x37, 0x33, 0x01, 0x06, 0x1e, 0x02, 0x17, 0x13, 0x0e, 0x03, 0x05, 0x36, 0x2e, 0x02, 0x27,
-    0x03, 0x3e, 0x03, 0x03, 0x1a, 0x61, 0x8d, 0x58, 0x23, 0x09, 0x0b, 0x55, 0x88, 0xb7, 0x6d, 0x28, 0xb4, 0x27, 0x62,
-    0x8d, 0x58, 0x22, 0x09, 0x0b, 0x54, 0x89, 0xb7, 0x6d, 0x2a, 0xb4, 0xfd, 0xc8, 0x07, 0x07, 0x2a, 0x51, 0x44, 0x89,
-    0x4b, 0x73, 0x51, 0x30, 0x02, 0xb2, 0x07, 0x07, 0x29, 0x51, 0x42, 0x89, 0x4b, 0x72, 0x50, 0x2f, 0x04, 0xe0, 0x0d,
-    0x60, 0x8d, 0xae, 0x5b, 0x6c, 0xbc, 0x8f, 0x59, 0x09, 0xc4, 0xc6, 0x0c, 0x60, 0x8e, 0xaf, 0x5c, 0x6c, 0xbc, 0x8e,
-    0x59, 0x08, 0xce, 0xfd, 0x1b, 0x3b, 0x78, 0x66, 0x4a, 0x0c, 0x02, 0xf1, 0x0a, 0x46, 0x68, 0x83, 0x35, 0x3a, 0x77,
-    0x65, 0x4a, 0x0d, 0xfd, 0x0f, 0x0a, 0x47, 0x69, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x84, 0x00, 0x00, 0x04, 0xe5,
-    0x05, 0xb0, 0x00, 0x1f, 0x00, 0x1e, 0x40, 0x1b, 0x1d, 0x10, 0x02, 0x01, 0x00, 0x01, 0x4a, 0x03, 0x02, 0x02, 0x00,
-    0x00, 0x28, 0x4b, 0x00, 0x01, 0x01, 0x29, 0x01, 0x4c, 0x17, 0x17, 0x17, 0x16, 0x04, 0x07, 0x18, 0x2b, 0x01, 0x3e,
-    0x03, 0x37, 0x13, 0x33, 0x03, 0x0e, 0x03, 0x07, 0x03, 0x23, 0x13, 0x2e, 0x03, 0x37, 0x13, 0x33, 0x03, 0x06, 0x1e,
-    0x02, 0x17, 0x13, 0x33, 0x02, 0x98, 0x45, 0x68, 0x4a, 0x2e, 0x0b, 0x69, 0xb4, 0x68, 0x0f, 0x4f, 0x7e, 0xac, 0x6d,
-    0x3e, 0xb5, 0x3e, 0x62, 0x86, 0x4e, 0x19, 0x0b, 0x67, 0xb5, 0x68, 0x07, 0x04, 0x22, 0x46, 0x3c, 0xae, 0xb5, 0x01,
-    0xdc, 0x10, 0x44, 0x60, 0x77, 0x43, 0x02, 0x66, 0xfd, 0x9a, 0x6a, 0xb2, 0x87, 0x56, 0x0d, 0xfe, 0xbc, 0x01, 0x46,
-    0x10, 0x61, 0x8c, 0xab, 0x5c, 0x02, 0x66, 0xfd, 0x99, 0x38, 0x70, 0x62, 0x4c, 0x13, 0x03, 0xd0, 0x00, 0x00, 0x00,
-    0x01, 0xff, 0xf9, 0x00, 0x00, 0x04, 0x78, 0x05, 0xc6, 0x00, 0x3f, 0x00, 0x29, 0x40, 0x26, 0x1e, 0x01, 0x02, 0x00,
-    0x01, 0x4a, 0x00, 0x00, 0x00, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x30, 0x4b, 0x04, 0x01, 0x02, 0x02, 0x01, 0x59, 0x05,
-    0x01, 0x01, 0x01, 0x29, 0x01, 0x4c, 0x11, 0x1c, 0x2c, 0x11, 0x1f, 0x2e, 0x06, 0x07, 0x1a, 0x2b, 0x25, 0x3e, 0x05,
-    0x37, 0x37, 0x36, 0x36, 0x2e, 0x03, 0x27, 0x26, 0x0e, 0x04, 0x07, 0x07, 0x0e, 0x02, 0x1e, 0x02, 0x17, 0x07, 0x21,
-    0x37, 0x37, 0x2e, 0x03, 0x37, 0x37, 0x3e, 0x05, 0x17, 0x1e, 0x05, 0x07, 0x07, 0x0e, 0x03, 0x07, 0x25, 0x07, 0x21,
-    0x02, 0x49, 0x3e, 0x61, 0x4b, 0x36, 0x26, 0x19, 0x08, 0x0b, 0x06, 0x05, 0x0a, 0x1c, 0x38, 0x56, 0x3f, 0x42, 0x6b,
-    0x56, 0x40, 0x2f, 0x1e, 0x08, 0x0c, 0x06, 0x0a, 0x01, 0x0e, 0x27, 0x45, 0x37, 0x1e, 0xfe, 0x48, 0x1c, 0xfd, 0x34,
-    0x44, 0x24, 0x07, 0x0b, 0x0c, 0x0b, 0x31, 0x49, 0x63, 0x7d, 0x97, 0x58, 0x55, 0x83, 0x60, 0x3f, 0x21, 0x06, 0x09,
-    0x0b, 0x0e, 0x3a, 0x5a, 0x7b, 0x4e, 0x01, 0x05, 0x1b, 0xfe, 0x48, 0xc0, 0x0f, 0x40, 0x5a, 0x6c, 0x74, 0x77, 0x37,
-    0x52, 0x2f, 0x6b, 0x6a, 0x62, 0x4d, 0x2f, 0x03, 0x02, 0x28, 0x47, 0x61, 0x6d, 0x74, 0x37, 0x52, 0x2b, 0x6c, 0x72,
-    0x72, 0x61, 0x49, 0x10, 0xc1, 0x97, 0x03, 0x3f, 0x91, 0x9b, 0xa2, 0x50, 0x4f, 0x4e, 0x9c, 0x8f, 0x7b, 0x5b, 0x31,
-    0x02, 0x02, 0x39, 0x5e, 0x7c, 0x8c, 0x95, 0x48, 0x4e, 0x5b, 0xb0, 0x9f, 0x87, 0x33, 0x03, 0x97, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x67, 0xff, 0xe9, 0x04, 0x25, 0x04, 0x51, 0x00, 0x26, 0x00, 0x3e, 0x00, 0xc3, 0x4b, 0xb0, 0x17, 0x50,
-    0x58, 0x40, 0x0f, 0x25, 0x01, 0x06, 0x03, 0x34, 0x01, 0x00, 0x06, 0x10, 0x0a, 0x02, 0x01, 0x00, 0x03, 0x4a, 0x1b,
-    0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x0f, 0x25, 0x01, 0x06, 0x04, 0x34, 0x01, 0x00, 0x06, 0x10, 0x0a, 0x02, 0x01,
-    0x00, 0x03, 0x4a, 0x1b, 0x40, 0x0f, 0x25, 0x01, 0x06, 0x04, 0x34, 0x01, 0x00, 0x06, 0x10, 0x0a, 0x02, 0x01, 0x05,
-    0x03, 0x4a, 0x59, 0x59, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x19, 0x00, 0x06, 0x06, 0x03, 0x5b, 0x07, 0x04, 0x02,
-    0x03, 0x03, 0x33, 0x4b, 0x05, 0x01, 0x00, 0x00, 0x01, 0x5b, 0x02, 0x01, 0x01, 0x01, 0x31, 0x01, 0x4c, 0x1b, 0x4b,
-    0xb0, 0x1b, 0x50, 0x58, 0x40, 0x1d, 0x07, 0x01, 0x04, 0x04, 0x2b, 0x4b, 0x00, 0x06, 0x06, 0x03, 0x5b, 0x00, 0x03,
-    0x03, 0x33, 0x4b, 0x05, 0x01, 0x00, 0x00, 0x01, 0x5b, 0x02, 0x01, 0x01, 0x01, 0x31, 0x01, 0x4c, 0x1b, 0x40, 0x24,
-    0x00, 0x00, 0x06, 0x05, 0x06, 0x00, 0x05, 0x70, 0x07, 0x01, 0x04, 0x04, 0x2b, 0x4b, 0x00, 0x06, 0x06, 0x03, 0x5b,
-    0x00, 0x03, 0x03, 0x33, 0x4b, 0x00, 0x05, 0x05, 0x01, 0x5b, 0x02, 0x01, 0x01, 0x01, 0x31, 0x01, 0x4c, 0x59, 0x59,
-    0x40, 0x11, 0x00, 0x00, 0x38, 0x36, 0x2f, 0x2d, 0x00, 0x26, 0x00, 0x26, 0x2d, 0x24, 0x24, 0x35, 0x08, 0x07, 0x18,
-    0x2b, 0x01, 0x03, 0x06, 0x06, 0x16, 0x16, 0x17, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x26, 0x26, 0x27, 0x06,
-    0x06, 0x27, 0x2e, 0x05, 0x37, 0x37, 0x3e, 0x05, 0x17, 0x16, 0x16, 0x17, 0x37, 0x01, 0x06, 0x06, 0x1e, 0x03, 0x17,
-    0x16, 0x3e, 0x02, 0x37, 0x13, 0x26, 0x26, 0x27, 0x26, 0x0e, 0x04, 0x07, 0x04, 0x25, 0x88, 0x02, 0x03, 0x07, 0x15,
-    0x17, 0x0d, 0x1a, 0x0c, 0x0a, 0x1b, 0x37, 0x20, 0x46, 0x59, 0x0e, 0x42, 0x9e, 0x61, 0x45, 0x68, 0x4a, 0x2f, 0x18,
-    0x03, 0x06, 0x02, 0x08, 0x22, 0x37, 0x4c, 0x64, 0x7e, 0x4e, 0x58, 0x95, 0x30, 0x4b, 0xfd, 0x6f, 0x04, 0x03, 0x09,
-    0x18, 0x2b, 0x43, 0x30, 0x2b, 0x4b, 0x41, 0x39, 0x19, 0x5e, 0x1f, 0x6a, 0x49, 0x39, 0x59, 0x46, 0x32, 0x24, 0x16,
-    0x06, 0x04, 0x3a, 0xfc, 0xd8, 0x10, 0x2a, 0x27, 0x1c, 0x01, 0x02, 0x04, 0x02, 0x8c, 0x10, 0x10, 0x01, 0x01, 0x45,
-    0x45, 0x45, 0x4a, 0x02, 0x02, 0x2e, 0x4e, 0x65, 0x72, 0x78, 0x39, 0x16, 0x41, 0x8a, 0x83, 0x74, 0x57, 0x31, 0x02,
-    0x02, 0x48, 0x4b, 0x80, 0xfd, 0xb3, 0x24, 0x52, 0x4f, 0x4a, 0x38, 0x23, 0x01, 0x02, 0x16, 0x27, 0x37, 0x20, 0x02,
-    0x15, 0x42, 0x4a, 0x02, 0x02, 0x26, 0x43, 0x59, 0x62, 0x65, 0x2d, 0x00, 0x02, 0xff, 0xfe, 0xfe, 0x80, 0x04, 0x53,
-    0x05, 0xc6, 0x00, 0x1e, 0x00, 0x3e, 0x00, 0x7f, 0x40, 0x0e, 0x0a, 0x01, 0x06, 0x03, 0x2f, 0x01, 0x05, 0x06, 0x17,
-    0x01, 0x01, 0x05, 0x03, 0x4a, 0x4b, 0xb0, 0x1f, 0x50, 0x58, 0x40, 0x24, 0x08, 0x01, 0x03, 0x00, 0x06, 0x05, 0x03,
-    0x06, 0x63, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x07, 0x01, 0x00, 0x00, 0x30, 0x4b, 0x00, 0x05, 0x05, 0x01, 0x5b, 0x00,
-    0x01, 0x01, 0x31, 0x4b, 0x00, 0x02, 0x02, 0x2d, 0x02, 0x4c, 0x1b, 0x40, 0x24, 0x00, 0x02, 0x01, 0x02, 0x73, 0x08,
-    0x01, 0x03, 0x00, 0x06, 0x05, 0x03, 0x06, 0x63, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x07, 0x01, 0x00, 0x00, 0x30, 0x4b,
-    0x00, 0x05, 0x05, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x31, 0x01, 0x4c, 0x59, 0x40, 0x19, 0x20, 0x1f, 0x01, 0x00, 0x3d,
-    0x3b, 0x33, 0x31, 0x2a, 0x28, 0x1f, 0x3e, 0x20, 0x3e, 0x19, 0x18, 0x15, 0x13, 0x00, 0x1e, 0x01, 0x1e, 0x09, 0x07,
-    0x14, 0x2b, 0x01, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x27, 0x26, 0x26, 0x27, 0x03,
-    0x23, 0x13, 0x3e, 0x03, 0x03, 0x3e, 0x03, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x03, 0x16, 0x16,
-    0x17, 0x16, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x37, 0x02, 0xe0, 0x53, 0x8c, 0x62, 0x32, 0x07, 0x05,
-    0x28, 0x3d, 0x51, 0x2d, 0x33, 0x49, 0x2d, 0x11, 0x04, 0x08, 0x52, 0x85, 0xb1, 0x66, 0x4d, 0x91, 0x3c, 0x57, 0xb5,
-    0xf9, 0x0d, 0x5a, 0x84, 0xa5, 0x0f, 0x39, 0x63, 0x4c, 0x31, 0x06, 0x05, 0x16, 0x33, 0x4c, 0x31, 0x38, 0x64, 0x4e,
-    0x35, 0x09, 0x8f, 0x2b, 0x87, 0x48, 0x43, 0x73, 0x57, 0x38, 0x08, 0x06, 0x10, 0x2e, 0x4d, 0x36, 0x96, 0x1b, 0x05,
-    0xc4, 0x02, 0x38, 0x65, 0x8c, 0x55, 0x36, 0x5b, 0x4b, 0x3c, 0x18, 0x19, 0x4c, 0x5d, 0x6a, 0x37, 0x66, 0xa9, 0x79,
-    0x41, 0x02, 0x02, 0x2e, 0x32, 0xfe, 0x34, 0x05, 0xb1, 0x58, 0x96, 0x6c, 0x3b, 0xfd, 0x92, 0x01, 0x1f, 0x3c, 0x58,
-    0x3b, 0x2f, 0x53, 0x3f, 0x25, 0x01, 0x01, 0x26, 0x44, 0x5d, 0x36, 0xfc, 0xc3, 0x3d, 0x37, 0x01, 0x01, 0x2d, 0x50,
-    0x6f, 0x41, 0x31, 0x60, 0x4e, 0x33, 0x03, 0x01, 0x97, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x9d, 0xfe, 0x60, 0x04,
-    0xcc, 0x04, 0x3a, 0x00, 0x0a, 0x00, 0x1d, 0x40, 0x1a, 0x09, 0x08, 0x05, 0x03, 0x01, 0x00, 0x01, 0x4a, 0x02, 0x01,
-    0x00, 0x00, 0x2b, 0x4b, 0x00, 0x01, 0x01, 0x2d, 0x01, 0x4c, 0x12, 0x12, 0x10, 0x03, 0x07, 0x17, 0x2b, 0x01, 0x33,
-    0x01, 0x03, 0x23, 0x13, 0x01, 0x33, 0x13, 0x17, 0x37, 0x04, 0x0a, 0xc2, 0xfd, 0x8a, 0x4f, 0xb6, 0x54, 0xfe, 0xf8,
-    0xb0, 0xc4, 0x05, 0x2e, 0x04, 0x3a, 0xfb, 0xea, 0xfe, 0x3c, 0x01, 0xe1, 0x03, 0xf9, 0xfc, 0xe7, 0x55, 0x67, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x5b, 0xff, 0xe9, 0x04, 0x42, 0x06, 0x1f, 0x00, 0x31, 0x00, 0x49, 0x00, 0x2a, 0x40, 0x27,
-    0x08, 0x01, 0x01, 0x00, 0x2d, 0x09, 0x02, 0x03, 0x01, 0x02, 0x4a, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x01, 0x63,
-    0x00, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x31, 0x02, 0x4c, 0x38, 0x36, 0x22, 0x20, 0x25, 0x24, 0x04, 0x07,
-    0x16, 0x2b, 0x01, 0x3e, 0x03, 0x17, 0x16, 0x16, 0x17, 0x07, 0x26, 0x26, 0x07, 0x22, 0x0e, 0x02, 0x07, 0x06, 0x1e,
-    0x02, 0x17, 0x1e, 0x03, 0x07, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x37, 0x3e, 0x03, 0x37, 0x37, 0x2e, 0x03,
-    0x03, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x04, 0x07, 0x01,
-    0x73, 0x04, 0x49, 0x72, 0x8d, 0x48, 0x51, 0x96, 0x48, 0x34, 0x3e, 0x82, 0x43, 0x23, 0x47, 0x3c, 0x2a, 0x06, 0x06,
-    0x24, 0x3a, 0x44, 0x1b, 0x5b, 0x8a, 0x59, 0x24, 0x0a, 0x03, 0x0e, 0x5b, 0x92, 0xc2, 0x75, 0x71, 0xa5, 0x68, 0x2a,
-    0x0a, 0x02, 0x0a, 0x44, 0x6a, 0x8f, 0x55, 0x0c, 0x25, 0x3c, 0x29, 0x14, 0x56, 0x08, 0x0f, 0x38, 0x64, 0x4e, 0x52,
-    0x81, 0x5d, 0x39, 0x0b, 0x02, 0x07, 0x17, 0x3a, 0x5f, 0x42, 0x37, 0x5f, 0x4f, 0x40, 0x2f, 0x1f, 0x06, 0x04, 0xed,
-    0x50, 0x74, 0x4b, 0x23, 0x01, 0x02, 0x34, 0x23, 0x80, 0x1a, 0x27, 0x01, 0x12, 0x24, 0x37, 0x26, 0x25, 0x39, 0x2c,
-    0x20, 0x0b, 0x26, 0x6b, 0x8a, 0xa9, 0x64, 0x16, 0x6f, 0xc3, 0x91, 0x53, 0x03, 0x03, 0x56, 0x90, 0xbd, 0x68, 0x16,
-    0x55, 0x98, 0x79, 0x53, 0x12, 0x12, 0x12, 0x35, 0x42, 0x4d, 0xfd, 0x33, 0x42, 0x84, 0x69, 0x44, 0x02, 0x02, 0x3f,
-    0x6c, 0x8c, 0x4a, 0x14, 0x39, 0x7f, 0x6d, 0x4d, 0x08, 0x07, 0x1a, 0x38, 0x4f, 0x5a, 0x61, 0x2e, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x50, 0xff, 0xea, 0x04, 0x4f, 0x04, 0x4e, 0x00, 0x46, 0x00, 0x4e, 0x40, 0x4b, 0x23, 0x01, 0x00, 0x07,
-    0x01, 0x4a, 0x00, 0x05, 0x06, 0x07, 0x06, 0x05, 0x07, 0x70, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x70, 0x00,
-    0x07, 0x08, 0x01, 0x00, 0x02, 0x07, 0x00, 0x63, 0x00, 0x06, 0x06, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x33, 0x4b, 0x00,
-    0x01, 0x01, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x31, 0x03, 0x4c, 0x01, 0x00, 0x45, 0x43, 0x3b, 0x39, 0x35, 0x34, 0x30,
-    0x2e, 0x18, 0x16, 0x12, 0x11, 0x0d, 0x0b, 0x00, 0x46, 0x01, 0x46, 0x09, 0x07, 0x14, 0x2b, 0x01, 0x22, 0x0e, 0x02,
-    0x07, 0x06, 0x1e, 0x04, 0x33, 0x16, 0x3e, 0x02, 0x37, 0x37, 0x0e, 0x03, 0x27, 0x2e, 0x05, 0x37, 0x3e, 0x03, 0x37,
-    0x2e, 0x03, 0x37, 0x3e, 0x05, 0x17, 0x1e, 0x03, 0x07, 0x27, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x06,
-    0x1e, 0x02, 0x17, 0x17, 0x07, 0x02, 0x4d, 0x31, 0x6c, 0x5d, 0x42, 0x07, 0x04, 0x15, 0x29, 0x37, 0x3c, 0x3d, 0x19,
-    0x30, 0x6a, 0x5e, 0x46, 0x0b, 0xb5, 0x0b, 0x64, 0x93, 0xae, 0x54, 0x30, 0x68, 0x63, 0x58, 0x41, 0x23, 0x04, 0x03,
-    0x2c, 0x46, 0x5a, 0x31, 0x21, 0x38, 0x2a, 0x17, 0x02, 0x02, 0x2e, 0x4b, 0x62, 0x6c, 0x71, 0x35, 0x4a, 0x96, 0x78,
-    0x4c, 0x01, 0xb2, 0x01, 0x2f, 0x4a, 0x57, 0x28, 0x2c, 0x66, 0x5a, 0x43, 0x07, 0x07, 0x29, 0x45, 0x55, 0x26, 0xf8,
-    0x1a, 0x01, 0xdf, 0x0c, 0x27, 0x47, 0x3c, 0x22, 0x34, 0x25, 0x19, 0x0f, 0x06, 0x01, 0x14, 0x2d, 0x4a, 0x35, 0x01,
-    0x5f, 0x83, 0x51, 0x23, 0x02, 0x01, 0x0e, 0x1e, 0x31, 0x45, 0x5d, 0x3c, 0x38, 0x55, 0x40, 0x2c, 0x10, 0x10, 0x2b,
-    0x36, 0x42, 0x27, 0x3f, 0x62, 0x48, 0x31, 0x1d, 0x0c, 0x01, 0x02, 0x25, 0x4e, 0x78, 0x55, 0x01, 0x30, 0x40, 0x28,
-    0x12, 0x01, 0x01, 0x0e, 0x27, 0x43, 0x35, 0x32, 0x3b, 0x20, 0x0a, 0x01, 0x01, 0x94, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x82, 0xfe, 0x80, 0x04, 0xa4, 0x05, 0xb0, 0x00, 0x30, 0x00, 0x20, 0x40, 0x1d, 0x16, 0x15, 0x10, 0x03, 0x00,
-    0x47, 0x00, 0x00, 0x00, 0x01, 0x59, 0x02, 0x01, 0x01, 0x01, 0x28, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30,
-    0x2f, 0x2e, 0x03, 0x07, 0x14, 0x2b, 0x01, 0x07, 0x01, 0x0e, 0x03, 0x07, 0x06, 0x16, 0x17, 0x17, 0x1e, 0x03, 0x07,
-    0x0e, 0x03, 0x07, 0x27, 0x3e, 0x03, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x2e, 0x03, 0x37, 0x3e, 0x05, 0x37, 0x01,
-    0x21, 0x37, 0x04, 0xa4, 0x16, 0xfe, 0x32, 0x3e, 0x7d, 0x6a, 0x4c, 0x0b, 0x0b, 0x38, 0x4f, 0xcd, 0x2d, 0x53, 0x3f,
-    0x23, 0x04, 0x03, 0x28, 0x3c, 0x48, 0x23, 0x5c, 0x12, 0x28, 0x23, 0x1a, 0x04, 0x03, 0x15, 0x24, 0x2b, 0x12, 0xa9,
-    0x48, 0x6d, 0x47, 0x1e, 0x08, 0x06, 0x2f, 0x45, 0x57, 0x5d, 0x5f, 0x2b, 0x01, 0x60, 0xfd, 0x49, 0x1b, 0x05, 0xb0,
-    0x80, 0xfe, 0x5d, 0x36, 0x6e, 0x7d, 0x8f, 0x57, 0x50, 0x68, 0x16, 0x34, 0x0b, 0x1b, 0x2f, 0x47, 0x37, 0x2f, 0x57,
-    0x4e, 0x43, 0x1a, 0x59, 0x13, 0x2b, 0x2f, 0x34, 0x1c, 0x18, 0x21, 0x16, 0x0d, 0x05, 0x24, 0x10, 0x3c, 0x59, 0x77,
-    0x4c, 0x3d, 0x74, 0x6d, 0x65, 0x5d, 0x54, 0x25, 0x01, 0x3c, 0x98, 0x00, 0x01, 0x00, 0x36, 0xfe, 0x61, 0x04, 0x1f,
-    0x04, 0x50, 0x00, 0x17, 0x00, 0x54, 0xb5, 0x01, 0x01, 0x03, 0x02, 0x01, 0x4a, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40,
-    0x17, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x05, 0x04, 0x02, 0x00, 0x00, 0x33, 0x4b, 0x00, 0x03, 0x03, 0x29, 0x4b, 0x00,
-    0x01, 0x01, 0x2d, 0x01, 0x4c, 0x1b, 0x40, 0x1b, 0x05, 0x01, 0x04, 0x04, 0x2b, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5b,
-    0x00, 0x00, 0x00, 0x33, 0x4b, 0x00, 0x03, 0x03, 0x29, 0x4b, 0x00, 0x01, 0x01, 0x2d, 0x01, 0x4c, 0x59, 0x40, 0x0d,
-    0x00, 0x00, 0x00, 0x17, 0x00, 0x17, 0x13, 0x25, 0x15, 0x23, 0x06, 0x07, 0x18, 0x2b, 0x01, 0x07, 0x36, 0x36, 0x17,
-    0x1e, 0x03, 0x07, 0x03, 0x23, 0x13, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x06, 0x07, 0x03, 0x23, 0x13, 0x01, 0x95, 0x17,
-    0x42, 0xaf, 0x6e, 0x5e, 0x81, 0x4a, 0x19, 0x09, 0xba, 0xb6, 0xba, 0x07, 0x0c, 0x2c, 0x51, 0x3f, 0x5b, 0x91, 0x39,
-    0x8e, 0xb6, 0xbc, 0x04, 0x3a, 0xa1, 0x55, 0x62, 0x02, 0x02, 0x41, 0x70, 0x97, 0x57, 0xfb, 0xb4, 0x04, 0x49, 0x39,
-    0x61, 0x46, 0x29, 0x02, 0x02, 0x49, 0x45, 0xfc, 0xd7, 0x04, 0x3a, 0x00, 0x00, 0x03, 0x00, 0xa6, 0xff, 0xea, 0x04,
-    0x33, 0x05, 0xc7, 0x00, 0x1d, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x29, 0x40, 0x26, 0x00, 0x04, 0x00, 0x02, 0x03, 0x04,
-    0x02, 0x61, 0x00, 0x05, 0x05, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x30, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00,
-    0x00, 0x31, 0x00, 0x4c, 0x27, 0x17, 0x27, 0x17, 0x2d, 0x26, 0x06, 0x07, 0x1a, 0x2b, 0x01, 0x0e, 0x05, 0x27, 0x2e,
-    0x04, 0x36, 0x37, 0x13, 0x3e, 0x05, 0x17, 0x1e, 0x04, 0x06, 0x07, 0x07, 0x21, 0x07, 0x06, 0x06, 0x1e, 0x03, 0x17,
-    0x16, 0x3e, 0x04, 0x37, 0x01, 0x21, 0x37, 0x36, 0x36, 0x2e, 0x03, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x03, 0xf4, 0x0b,
-    0x25, 0x39, 0x4f, 0x69, 0x84, 0x52, 0x4e, 0x73, 0x4f, 0x30, 0x17, 0x01, 0x08, 0x35, 0x0a, 0x26, 0x3a, 0x4f, 0x6a,
-    0x84, 0x52, 0x4e, 0x73, 0x50, 0x2f, 0x16, 0x01, 0x08, 0xdb, 0xfe, 0x23, 0x15, 0x05, 0x06, 0x05, 0x14, 0x29, 0x42,
-    0x32, 0x35, 0x53, 0x40, 0x2e, 0x20, 0x15, 0x06, 0xfe, 0x53, 0x01, 0xdd, 0x13, 0x05, 0x06, 0x05, 0x13, 0x29, 0x42,
-    0x32, 0x50, 0x6c, 0x46, 0x27, 0x09, 0x02, 0x2e, 0x46, 0x8c, 0x82, 0x71, 0x52, 0x2d, 0x02, 0x02, 0x34, 0x56, 0x71,
-    0x7f, 0x85, 0x40, 0x01, 0x55, 0x45, 0x8d, 0x82, 0x71, 0x53, 0x2d, 0x02, 0x02, 0x34, 0x56, 0x72, 0x7f, 0x87, 0x3f,
-    0xef, 0x8e, 0x24, 0x54, 0x55, 0x50, 0x3e, 0x27, 0x02, 0x02, 0x20, 0x3a, 0x4e, 0x58, 0x5c, 0x2b, 0x01, 0x24, 0x82,
-    0x24, 0x55, 0x54, 0x4f, 0x3d, 0x27, 0x02, 0x03, 0x48, 0x73, 0x8b, 0x40, 0x00, 0x01, 0x00, 0xe9, 0xff, 0xeb, 0x03,
-    0xbf, 0x04, 0x3a, 0x00, 0x15, 0x00, 0x29, 0x40, 0x26, 0x0a, 0x01, 0x01, 0x03, 0x0b, 0x01, 0x02, 0x01, 0x02, 0x4a,
-    0x00, 0x03, 0x03, 0x00, 0x59, 0x00, 0x00, 0x00, 0x2b, 0x4b, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x31,
-    0x02, 0x4c, 0x15, 0x25, 0x25, 0x10, 0x04, 0x07, 0x18, 0x2b, 0x01, 0x21, 0x03, 0x06, 0x1e, 0x02, 0x33, 0x32, 0x36,
-    0x37, 0x17, 0x06, 0x06, 0x27, 0x2e, 0x03, 0x37, 0x13, 0x21, 0x01, 0x06, 0x02, 0x0a, 0x7e, 0x04, 0x04, 0x19, 0x33,
-    0x2c, 0x2a, 0x4a, 0x25, 0x1c, 0x36, 0x72, 0x41, 0x50, 0x66, 0x39, 0x10, 0x07, 0x61, 0xfe, 0xaa, 0x04, 0x3a, 0xfd,
-    0x06, 0x27, 0x43, 0x31, 0x1c, 0x19, 0x12, 0x85, 0x23, 0x21, 0x02, 0x02, 0x38, 0x5f, 0x7e, 0x48, 0x02, 0x4d, 0x00,
-    0x01, 0xff, 0xcb, 0xff, 0xed, 0x03, 0xe7, 0x05, 0xec, 0x00, 0x28, 0x00, 0xb6, 0x4b, 0xb0, 0x1d, 0x50, 0x58, 0x40,
-    0x0f, 0x0c, 0x01, 0x01, 0x02, 0x27, 0x02, 0x02, 0x03, 0x01, 0x02, 0x4a, 0x1e, 0x01, 0x00, 0x47, 0x1b, 0x40, 0x0f,
-    0x0c, 0x01, 0x01, 0x02, 0x27, 0x02, 0x02, 0x03, 0x01, 0x1e, 0x01, 0x04, 0x00, 0x03, 0x4a, 0x59, 0x4b, 0xb0, 0x0a,
-    0x50, 0x58, 0x40, 0x19, 0x00, 0x03, 0x01, 0x00, 0x01, 0x03, 0x00, 0x70, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02,
-    0x02, 0x32, 0x4b, 0x04, 0x01, 0x00, 0x00, 0x29, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x14, 0x50, 0x58, 0x40, 0x19, 0x00,
-    0x03, 0x01, 0x00, 0x01, 0x03, 0x00, 0x70, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x30, 0x4b, 0x04, 0x01,
-    0x00, 0x00, 0x29, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x1d, 0x50, 0x58, 0x40, 0x19, 0x00, 0x03, 0x01, 0x00, 0x01, 0x03,
-    0x00, 0x70, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x32, 0x4b, 0x04, 0x01, 0x00, 0x00, 0x29, 0x00, 0x4c,
-    0x1b, 0x40, 0x1b, 0x00, 0x03, 0x01, 0x00, 0x01, 0x03, 0x00, 0x70, 0x00, 0x02, 0x00, 0x01, 0x03, 0x02, 0x01, 0x63,
-    0x00, 0x00, 0x00, 0x29, 0x4b, 0x00, 0x04, 0x04, 0x31, 0x04, 0x4c, 0x59, 0x59, 0x59, 0xb7, 0x24, 0x2a, 0x24, 0x36,
-    0x10, 0x05, 0x07, 0x19, 0x2b, 0x33, 0x23, 0x01, 0x27, 0x2e, 0x03, 0x27, 0x26, 0x06, 0x07, 0x37, 0x36, 0x36, 0x33,
-    0x1e, 0x03, 0x17, 0x13, 0x1e, 0x03, 0x17, 0x16, 0x36, 0x37, 0x07, 0x06, 0x06, 0x07, 0x06, 0x2e, 0x02, 0x27, 0x03,
-    0x07, 0x9c, 0xd1, 0x02, 0x38, 0x1d, 0x06, 0x13, 0x20, 0x2e, 0x22, 0x11, 0x22, 0x11, 0x0c, 0x17, 0x30, 0x18, 0x3a,
-    0x5a, 0x42, 0x2d, 0x0c, 0xbe, 0x05, 0x0d, 0x17, 0x24, 0x1b, 0x0b, 0x18, 0x0b, 0x0f, 0x0e, 0x19, 0x0e, 0x3b, 0x55,
-    0x3e, 0x27, 0x0c, 0x70, 0x35, 0x04, 0x13, 0x84, 0x1b, 0x40, 0x38, 0x27, 0x02, 0x01, 0x03, 0x01, 0x8f, 0x05, 0x08,
-    0x01, 0x2d, 0x4b, 0x61, 0x33, 0xfc, 0x4b, 0x16, 0x33, 0x2c, 0x20, 0x02, 0x01, 0x03, 0x02, 0x99, 0x05, 0x08, 0x01,
-    0x03, 0x2f, 0x4d, 0x62, 0x30, 0x02, 0x2a, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x86, 0xfe, 0x77, 0x04, 0x7d,
-    0x05, 0xc6, 0x00, 0x4e, 0x00, 0x2d, 0x40, 0x2a, 0x4e, 0x01, 0x00, 0x03, 0x3f, 0x01, 0x02, 0x01, 0x02, 0x4a, 0x2a,
-    0x29, 0x24, 0x03, 0x02, 0x47, 0x00, 0x01, 0x00, 0x02, 0x01, 0x02, 0x5f, 0x00, 0x00, 0x00, 0x03, 0x5b, 0x00, 0x03,
-    0x03, 0x30, 0x00, 0x4c, 0x4c, 0x4a, 0x21, 0x2b, 0x32, 0x04, 0x07, 0x17, 0x2b, 0x01, 0x26, 0x26, 0x23, 0x22, 0x0e,
-    0x04, 0x07, 0x06, 0x1e, 0x04, 0x33, 0x17, 0x07, 0x27, 0x22, 0x0e, 0x02, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x17, 0x1e,
-    0x03, 0x07, 0x0e, 0x03, 0x07, 0x27, 0x3e, 0x03, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x2e, 0x03, 0x37, 0x3e, 0x03,
-    0x37, 0x2e, 0x03, 0x37, 0x3e, 0x05, 0x17, 0x32, 0x16, 0x17, 0x04, 0x57, 0x35, 0x6b, 0x38, 0x22, 0x50, 0x52, 0x4e,
-    0x40, 0x2c, 0x06, 0x07, 0x17, 0x31, 0x44, 0x4c, 0x4e, 0x22, 0x96, 0x1b, 0x7f, 0x56, 0xa8, 0x8b, 0x5f, 0x0b, 0x08,
-    0x26, 0x4a, 0x66, 0x38, 0x67, 0x2c, 0x53, 0x3f, 0x24, 0x04, 0x03, 0x28, 0x3b, 0x48, 0x22, 0x5b, 0x13, 0x29, 0x22,
-    0x19, 0x03, 0x03, 0x15, 0x24, 0x2c, 0x13, 0x35, 0x5c, 0xa1, 0x75, 0x3d, 0x09, 0x07, 0x45, 0x6c, 0x8a, 0x4d, 0x2c,
-    0x50, 0x3c, 0x22, 0x03, 0x04, 0x37, 0x58, 0x72, 0x7c, 0x7f, 0x3a, 0x40, 0x7e, 0x3e, 0x05, 0x08, 0x10, 0x15, 0x04,
-    0x0f, 0x1c, 0x2b, 0x3f, 0x2a, 0x2f, 0x43, 0x2f, 0x1c, 0x11, 0x06, 0x01, 0x98, 0x01, 0x1e, 0x4b, 0x80, 0x61, 0x41,
-    0x62, 0x47, 0x2f, 0x0d, 0x1a, 0x0b, 0x1b, 0x2d, 0x47, 0x36, 0x2e, 0x56, 0x4d, 0x42, 0x1a, 0x58, 0x14, 0x2a, 0x2e,
-    0x33, 0x1e, 0x19, 0x20, 0x15, 0x0c, 0x05, 0x0d, 0x16, 0x42, 0x67, 0x96, 0x6b, 0x56, 0x84, 0x62, 0x44, 0x17, 0x12,
-    0x35, 0x45, 0x56, 0x33, 0x47, 0x6c, 0x4f, 0x34, 0x1f, 0x0d, 0x01, 0x14, 0x12, 0x00, 0x01, 0x00, 0x6e, 0xff, 0xec,
-    0x04, 0x80, 0x04, 0x3a, 0x00, 0x1b, 0x00, 0x6b, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x0a, 0x0a, 0x01, 0x01, 0x00,
-    0x0b, 0x01, 0x02, 0x01, 0x02, 0x4a, 0x1b, 0x40, 0x0a, 0x0a, 0x01, 0x01, 0x00, 0x0b, 0x01, 0x04, 0x01, 0x02, 0x4a,
-    0x59, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x18, 0x05, 0x03, 0x02, 0x00, 0x00, 0x06, 0x59, 0x00, 0x06, 0x06, 0x2b,
-    0x4b, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x04, 0x01, 0x02, 0x02, 0x31, 0x02, 0x4c, 0x1b, 0x40, 0x1c, 0x05, 0x03, 0x02,
-    0x00, 0x00, 0x06, 0x59, 0x00, 0x06, 0x06, 0x2b, 0x4b, 0x00, 0x04, 0x04, 0x29, 0x4b, 0x00, 0x01, 0x01, 0x02, 0x5b,
-    0x00, 0x02, 0x02, 0x31, 0x02, 0x4c, 0x59, 0x40, 0x0a, 0x11, 0x11, 0x11, 0x15, 0x25, 0x25, 0x10, 0x07, 0x07, 0x1b,
-    0x2b, 0x01, 0x23, 0x03, 0x06, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x2e, 0x03, 0x37,
-    0x13, 0x21, 0x03, 0x23, 0x13, 0x23, 0x37, 0x21, 0x04, 0x65, 0x8b, 0x6f, 0x02, 0x0d, 0x1e, 0x1c, 0x18, 0x2d, 0x16,
-    0x1d, 0x29, 0x53, 0x30, 0x41, 0x51, 0x2b, 0x0a, 0x05, 0x6c, 0xfe, 0x9e, 0xa1, 0xb5, 0xa1, 0x80, 0x1b, 0x03, 0xd6,
-    0x03, 0xa1, 0xfd, 0x69, 0x17, 0x2d, 0x24, 0x16, 0x0e, 0x08, 0x84, 0x1a, 0x18, 0x02, 0x01, 0x33, 0x52, 0x69, 0x39,
-    0x02, 0x8b, 0xfc, 0x5f, 0x03, 0xa1, 0x99, 0x00, 0x00, 0x02, 0xff, 0xef, 0xfe, 0x60, 0x04, 0x1f, 0x04, 0x50, 0x00,
-    0x1a, 0x00, 0x30, 0x00, 0x30, 0x40, 0x2d, 0x28, 0x0b, 0x02, 0x04, 0x03, 0x08, 0x01, 0x00, 0x04, 0x02, 0x4a, 0x00,
-    0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x33, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x31, 0x4b,
-    0x00, 0x01, 0x01, 0x2d, 0x01, 0x4c, 0x27, 0x2d, 0x28, 0x13, 0x24, 0x05, 0x07, 0x19, 0x2b, 0x01, 0x0e, 0x03, 0x27,
-    0x26, 0x26, 0x27, 0x03, 0x23, 0x13, 0x35, 0x3e, 0x05, 0x17, 0x1e, 0x05, 0x07, 0x07, 0x36, 0x36, 0x2e, 0x03, 0x27,
-    0x26, 0x0e, 0x02, 0x07, 0x03, 0x16, 0x16, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x04, 0x15, 0x0c, 0x45, 0x75, 0xa9, 0x70,
-    0x58, 0x9f, 0x39, 0x62, 0xb5, 0xab, 0x02, 0x28, 0x48, 0x61, 0x75, 0x83, 0x45, 0x4f, 0x79, 0x56, 0x37, 0x1c, 0x04,
-    0x07, 0xb4, 0x04, 0x05, 0x08, 0x18, 0x2e, 0x4a, 0x36, 0x4b, 0x73, 0x53, 0x34, 0x0b, 0x32, 0x21, 0x79, 0x52, 0x50,
-    0x79, 0x54, 0x32, 0x09, 0x01, 0xfa, 0x62, 0xbf, 0x96, 0x5a, 0x02, 0x02, 0x3f, 0x45, 0xfd, 0xef, 0x03, 0xe0, 0x03,
-    0x46, 0x84, 0x76, 0x62, 0x46, 0x25, 0x02, 0x02, 0x32, 0x53, 0x6e, 0x7e, 0x88, 0x43, 0x01, 0x27, 0x5d, 0x5d, 0x58,
-    0x43, 0x2a, 0x02, 0x02, 0x44, 0x6e, 0x86, 0x40, 0xfe, 0xda, 0x4b, 0x4d, 0x02, 0x02, 0x41, 0x6b, 0x89, 0x46, 0x00,
-    0x01, 0x00, 0x5f, 0xfe, 0x57, 0x04, 0x29, 0x04, 0x51, 0x00, 0x37, 0x00, 0x26, 0x40, 0x23, 0x23, 0x22, 0x02, 0x01,
-    0x47, 0x00, 0x01, 0x02, 0x01, 0x73, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x03, 0x01, 0x00, 0x00, 0x33, 0x02, 0x4c, 0x01,
-    0x00, 0x0c, 0x0a, 0x06, 0x05, 0x00, 0x37, 0x01, 0x37, 0x04, 0x07, 0x14, 0x2b, 0x01, 0x1e, 0x03, 0x07, 0x27, 0x36,
-    0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x1e, 0x05, 0x07, 0x0e, 0x03, 0x07, 0x27,
-    0x3e, 0x03, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x37, 0x37, 0x3e, 0x03, 0x02, 0x9b, 0x59, 0x95, 0x69, 0x37,
-    0x04, 0xaa, 0x03, 0x1e, 0x3d, 0x5a, 0x38, 0x51, 0x7f, 0x5c, 0x39, 0x0a, 0x06, 0x08, 0x1d, 0x46, 0x6e, 0x48, 0x24,
-    0x4e, 0x4b, 0x42, 0x31, 0x1a, 0x03, 0x03, 0x35, 0x51, 0x65, 0x34, 0x40, 0x1e, 0x3c, 0x32, 0x23, 0x05, 0x04, 0x25,
-    0x3a, 0x40, 0x16, 0x68, 0xa8, 0x71, 0x35, 0x0b, 0x05, 0x0d, 0x5a, 0x90, 0xc1, 0x04, 0x4f, 0x02, 0x37, 0x65, 0x91,
-    0x5c, 0x01, 0x39, 0x59, 0x3d, 0x22, 0x01, 0x02, 0x44, 0x70, 0x8e, 0x47, 0x2a, 0x49, 0x7b, 0x5f, 0x3f, 0x0e, 0x07,
-    0x10, 0x17, 0x22, 0x32, 0x46, 0x2f, 0x3e, 0x65, 0x51, 0x3e, 0x16, 0x7f, 0x0e, 0x25, 0x2f, 0x3b, 0x24, 0x21, 0x26,
-    0x16, 0x09, 0x04, 0x12, 0x54, 0x82, 0xaf, 0x6d, 0x2b, 0x6d, 0xc6, 0x97, 0x57, 0x00, 0x02, 0x00, 0x53, 0xff, 0xea,
-    0x04, 0xb8, 0x04, 0x3b, 0x00, 0x18, 0x00, 0x2e, 0x00, 0x21, 0x40, 0x1e, 0x04, 0x01, 0x00, 0x00, 0x02, 0x5b, 0x00,
-    0x02, 0x02, 0x2b, 0x4b, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x31, 0x01, 0x4c, 0x29, 0x25, 0x29, 0x2a,
-    0x10, 0x05, 0x07, 0x19, 0x2b, 0x01, 0x05, 0x16, 0x16, 0x07, 0x07, 0x0e, 0x05, 0x27, 0x2e, 0x03, 0x37, 0x37, 0x3e,
-    0x03, 0x33, 0x05, 0x01, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e,
-    0x02, 0x07, 0x04, 0x9d, 0xfe, 0xed, 0x4b, 0x39, 0x0b, 0x03, 0x08, 0x2e, 0x47, 0x5f, 0x73, 0x84, 0x49, 0x72, 0x9e,
-    0x5e, 0x23, 0x0b, 0x03, 0x0d, 0x58, 0x8d, 0xbe, 0x74, 0x02, 0x33, 0xfc, 0x5a, 0x07, 0x09, 0x2f, 0x5d, 0x4e, 0x53,
-    0x7d, 0x57, 0x33, 0x0a, 0x03, 0x07, 0x0a, 0x31, 0x5e, 0x4c, 0x51, 0x7b, 0x58, 0x34, 0x0a, 0x03, 0xa1, 0x03, 0x58,
-    0xce, 0x73, 0x18, 0x45, 0x83, 0x73, 0x60, 0x44, 0x24, 0x02, 0x03, 0x5f, 0x99, 0xc2, 0x65, 0x17, 0x6e, 0xc3, 0x91,
-    0x54, 0x01, 0xfd, 0xd0, 0x3e, 0x89, 0x73, 0x4c, 0x03, 0x03, 0x48, 0x75, 0x91, 0x47, 0x16, 0x3e, 0x84, 0x6d, 0x47,
-    0x03, 0x03, 0x43, 0x6f, 0x8d, 0x46, 0x00, 0x00, 0x01, 0x00, 0xdf, 0xff, 0xe9, 0x04, 0x67, 0x04, 0x3a, 0x00, 0x16,
-    0x00, 0x2b, 0x40, 0x28, 0x0a, 0x01, 0x01, 0x00, 0x0b, 0x01, 0x02, 0x01, 0x02, 0x4a, 0x03, 0x01, 0x00, 0x00, 0x04,
-    0x59, 0x00, 0x04, 0x04, 0x2b, 0x4b, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x31, 0x02, 0x4c, 0x11, 0x15,
-    0x24, 0x25, 0x10, 0x05, 0x07, 0x19, 0x2b, 0x01, 0x21, 0x03, 0x06, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06,
-    0x27, 0x2e, 0x03, 0x37, 0x13, 0x21, 0x37, 0x21, 0x04, 0x4b, 0xfe, 0xa7, 0x63, 0x04, 0x03, 0x18, 0x32, 0x2b, 0x27,
-    0x49, 0x23, 0x1d, 0x68, 0x7d, 0x50, 0x65, 0x36, 0x0f, 0x08, 0x61, 0xfe, 0xa2, 0x1c, 0x03, 0x6c, 0x03, 0x9c, 0xfd,
-    0xa7, 0x26, 0x43, 0x32, 0x1e, 0x19, 0x11, 0x85, 0x46, 0x03, 0x02, 0x3a, 0x60, 0x7f, 0x47, 0x02, 0x4e, 0x9e, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x79, 0xff, 0xe9, 0x04, 0x2a, 0x04, 0x3c, 0x00, 0x21, 0x00, 0x21, 0x40, 0x1e, 0x04,
-    0x03, 0x02, 0x01, 0x01, 0x2b, 0x4b, 0x00, 0x00, 0x00, 0x02, 0x5c, 0x00, 0x02, 0x02, 0x31, 0x02, 0x4c, 0x00, 0x00,
-    0x00, 0x21, 0x00, 0x21, 0x29, 0x19, 0x25, 0x05, 0x07, 0x17, 0x2b, 0x01, 0x03, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e,
-    0x04, 0x37, 0x36, 0x02, 0x27, 0x17, 0x16, 0x12, 0x07, 0x0e, 0x05, 0x27, 0x2e, 0x03, 0x37, 0x13, 0x01, 0xa1, 0x67,
-    0x07, 0x07, 0x2a, 0x54, 0x47, 0x39, 0x5d, 0x4a, 0x3a, 0x2a, 0x1b, 0x07, 0x13, 0x12, 0x23, 0xb6, 0x26, 0x0b, 0x11,
-    0x0a, 0x29, 0x40, 0x57, 0x72, 0x8b, 0x54, 0x6e, 0x9a, 0x5c, 0x21, 0x0c, 0x68, 0x04, 0x3a, 0xfd, 0x93, 0x3a, 0x75,
-    0x5f, 0x3d, 0x02, 0x01, 0x26, 0x43, 0x58, 0x63, 0x66, 0x2f, 0x81, 0x01, 0x06, 0x7d, 0x02, 0x7d, 0xfe, 0xfb, 0x81,
-    0x4a, 0x91, 0x84, 0x70, 0x52, 0x2d, 0x02, 0x02, 0x4b, 0x82, 0xb0, 0x67, 0x02, 0x69, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x57, 0xfe, 0x22, 0x04, 0x51, 0x04, 0x3c, 0x00, 0x25, 0x00, 0x37, 0x00, 0x2a, 0x40, 0x27, 0x09, 0x01, 0x02,
-    0x00, 0x11, 0x01, 0x01, 0x02, 0x02, 0x4a, 0x08, 0x01, 0x00, 0x48, 0x00, 0x01, 0x02, 0x01, 0x73, 0x00, 0x02, 0x02,
-    0x00, 0x5b, 0x00, 0x00, 0x00, 0x2b, 0x02, 0x4c, 0x32, 0x31, 0x25, 0x24, 0x18, 0x16, 0x03, 0x07, 0x14, 0x2b, 0x05,
-    0x2e, 0x03, 0x37, 0x36, 0x12, 0x37, 0x17, 0x06, 0x06, 0x07, 0x06, 0x14, 0x16, 0x16, 0x17, 0x13, 0x3e, 0x03, 0x17,
-    0x1e, 0x05, 0x07, 0x0e, 0x03, 0x07, 0x03, 0x23, 0x01, 0x3e, 0x03, 0x37, 0x36, 0x36, 0x2e, 0x03, 0x07, 0x0e, 0x03,
-    0x07, 0x01, 0x98, 0x65, 0x82, 0x47, 0x13, 0x0b, 0x13, 0xa4, 0x8e, 0x56, 0x5b, 0x77, 0x14, 0x09, 0x1f, 0x43, 0x39,
-    0x78, 0x07, 0x2b, 0x45, 0x5d, 0x39, 0x40, 0x5f, 0x43, 0x2a, 0x15, 0x02, 0x05, 0x0c, 0x4e, 0x81, 0xb4, 0x71, 0x55,
-    0xb5, 0x01, 0x1b, 0x45, 0x6d, 0x4f, 0x31, 0x08, 0x02, 0x05, 0x02, 0x0b, 0x1b, 0x2e, 0x24, 0x12, 0x1a, 0x12, 0x0b,
-    0x03, 0x0c, 0x14, 0x6d, 0x97, 0xb5, 0x5b, 0xa8, 0x01, 0x19, 0x5e, 0x88, 0x4f, 0xd3, 0x77, 0x36, 0x78, 0x6d, 0x59,
-    0x17, 0x02, 0xb4, 0x36, 0x5c, 0x43, 0x24, 0x01, 0x01, 0x35, 0x56, 0x6e, 0x76, 0x74, 0x30, 0x6f, 0xc1, 0x95, 0x62,
-    0x0f, 0xfe, 0x31, 0x02, 0x68, 0x15, 0x52, 0x6d, 0x83, 0x46, 0x15, 0x48, 0x56, 0x57, 0x47, 0x2b, 0x01, 0x01, 0x0f,
-    0x19, 0x1f, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x53, 0xfe, 0x28, 0x04, 0x71, 0x04, 0x3b, 0x00, 0x25, 0x00, 0x25,
-    0x40, 0x22, 0x24, 0x15, 0x01, 0x03, 0x01, 0x00, 0x01, 0x4a, 0x00, 0x01, 0x01, 0x00, 0x59, 0x04, 0x03, 0x02, 0x03,
-    0x00, 0x00, 0x2b, 0x01, 0x4c, 0x00, 0x00, 0x00, 0x25, 0x00, 0x25, 0x17, 0x19, 0x19, 0x05, 0x07, 0x17, 0x2b, 0x01,
-    0x03, 0x3e, 0x03, 0x37, 0x36, 0x10, 0x27, 0x17, 0x16, 0x02, 0x07, 0x0e, 0x03, 0x07, 0x03, 0x23, 0x13, 0x2e, 0x03,
-    0x37, 0x13, 0x33, 0x03, 0x06, 0x06, 0x1e, 0x03, 0x17, 0x13, 0x02, 0xfc, 0xa9, 0x4c, 0x74, 0x53, 0x34, 0x0c, 0x14,
-    0x17, 0xb7, 0x17, 0x06, 0x11, 0x10, 0x50, 0x85, 0xba, 0x79, 0x54, 0xb5, 0x55, 0x6d, 0x83, 0x41, 0x0a, 0x0d, 0x51,
-    0xb5, 0x52, 0x05, 0x07, 0x01, 0x0f, 0x22, 0x39, 0x2c, 0xa8, 0x04, 0x3a, 0xfc, 0x50, 0x15, 0x55, 0x73, 0x8b, 0x4a,
-    0x7f, 0x01, 0x02, 0x7e, 0x01, 0x7e, 0xfe, 0xfe, 0x7f, 0x73, 0xca, 0x9b, 0x65, 0x0d, 0xfe, 0x37, 0x01, 0xcd, 0x16,
-    0x7b, 0xa9, 0xc5, 0x60, 0x01, 0xe6, 0xfe, 0x17, 0x26, 0x57, 0x59, 0x56, 0x4b, 0x3b, 0x11, 0x03, 0xac, 0x00, 0x01,
-    0x00, 0x36, 0xff, 0xe9, 0x04, 0x71, 0x04, 0x3c, 0x00, 0x48, 0x00, 0x34, 0x40, 0x31, 0x39, 0x01, 0x00, 0x01, 0x01,
-    0x4a, 0x00, 0x01, 0x03, 0x00, 0x03, 0x01, 0x00, 0x70, 0x07, 0x06, 0x02, 0x03, 0x03, 0x2b, 0x4b, 0x02, 0x01, 0x00,
-    0x00, 0x04, 0x5c, 0x05, 0x01, 0x04, 0x04, 0x31, 0x04, 0x4c, 0x00, 0x00, 0x00, 0x48, 0x00, 0x48, 0x28, 0x2b, 0x19,
-    0x27, 0x18, 0x1b, 0x08, 0x07, 0x1a, 0x2b, 0x01, 0x0e, 0x03, 0x07, 0x0e, 0x03, 0x16, 0x16, 0x17, 0x16, 0x3e, 0x04,
-    0x37, 0x13, 0x33, 0x03, 0x0e, 0x02, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x04, 0x37, 0x36, 0x02, 0x27, 0x17, 0x1e, 0x02,
-    0x06, 0x07, 0x0e, 0x05, 0x27, 0x2e, 0x03, 0x27, 0x0e, 0x03, 0x27, 0x2e, 0x04, 0x36, 0x37, 0x36, 0x12, 0x37, 0x01,
-    0xb7, 0x1d, 0x3a, 0x33, 0x29, 0x0a, 0x02, 0x0b, 0x08, 0x01, 0x0d, 0x1f, 0x1e, 0x25, 0x38, 0x28, 0x1b, 0x12, 0x0a,
-    0x03, 0x2f, 0xb6, 0x2f, 0x02, 0x08, 0x03, 0x04, 0x14, 0x26, 0x21, 0x25, 0x36, 0x26, 0x19, 0x10, 0x08, 0x03, 0x11,
-    0x02, 0x1c, 0xb5, 0x10, 0x0e, 0x01, 0x0a, 0x08, 0x07, 0x16, 0x24, 0x35, 0x4d, 0x68, 0x44, 0x2e, 0x48, 0x34, 0x20,
-    0x06, 0x15, 0x31, 0x40, 0x4f, 0x33, 0x41, 0x56, 0x33, 0x15, 0x03, 0x09, 0x06, 0x12, 0x59, 0x45, 0x04, 0x39, 0x3f,
-    0x80, 0x83, 0x86, 0x45, 0x10, 0x4b, 0x5d, 0x65, 0x54, 0x39, 0x02, 0x03, 0x23, 0x3c, 0x4d, 0x4e, 0x47, 0x18, 0x01,
-    0x2c, 0xfe, 0xd4, 0x12, 0x40, 0x4b, 0x4f, 0x40, 0x29, 0x01, 0x01, 0x33, 0x52, 0x65, 0x62, 0x53, 0x17, 0x82, 0x01,
-    0x04, 0x81, 0x02, 0x3f, 0x82, 0x82, 0x82, 0x40, 0x32, 0x7e, 0x84, 0x7d, 0x61, 0x39, 0x02, 0x01, 0x22, 0x39, 0x4c,
-    0x2b, 0x29, 0x4e, 0x3c, 0x23, 0x01, 0x02, 0x3f, 0x64, 0x7d, 0x7f, 0x76, 0x2b, 0x8c, 0x01, 0x06, 0x7b, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x6f, 0xff, 0xe9, 0x04, 0x88, 0x05, 0xc8, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x36, 0x40, 0x33, 0x30,
-    0x01, 0x01, 0x04, 0x34, 0x2d, 0x1c, 0x00, 0x04, 0x02, 0x01, 0x02, 0x4a, 0x00, 0x01, 0x04, 0x02, 0x04, 0x01, 0x02,
-    0x70, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x30, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00,
-    0x31, 0x00, 0x4c, 0x3b, 0x39, 0x2f, 0x25, 0x15, 0x28, 0x05, 0x07, 0x18, 0x2b, 0x01, 0x06, 0x06, 0x07, 0x07, 0x0e,
-    0x03, 0x27, 0x2e, 0x03, 0x37, 0x13, 0x37, 0x03, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x37, 0x2e, 0x03,
-    0x37, 0x37, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x03, 0x36, 0x36, 0x37, 0x01, 0x06, 0x16, 0x17, 0x13, 0x36, 0x2e,
-    0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x04, 0x87, 0x26, 0x4d, 0x28, 0x1a, 0x0f, 0x4d, 0x7a, 0xa7, 0x68, 0x61, 0x94,
-    0x60, 0x29, 0x0b, 0x36, 0xb7, 0x38, 0x06, 0x0e, 0x2f, 0x54, 0x3f, 0x44, 0x65, 0x47, 0x2b, 0x09, 0x1e, 0x5f, 0x97,
-    0x65, 0x30, 0x07, 0x02, 0x08, 0x3a, 0x5f, 0x80, 0x4e, 0x50, 0x71, 0x44, 0x19, 0x08, 0x3b, 0x22, 0x42, 0x21, 0xfd,
-    0xe3, 0x0a, 0x6f, 0x7d, 0x3c, 0x03, 0x01, 0x15, 0x31, 0x2c, 0x2a, 0x3d, 0x2a, 0x18, 0x04, 0x02, 0x73, 0x0d, 0x0e,
-    0x05, 0xa0, 0x62, 0xa8, 0x7b, 0x45, 0x03, 0x03, 0x48, 0x7b, 0xa4, 0x5d, 0x01, 0x4e, 0x02, 0xfe, 0xaf, 0x38, 0x69,
-    0x52, 0x34, 0x02, 0x03, 0x30, 0x52, 0x6e, 0x3c, 0xa9, 0x13, 0x5c, 0x85, 0xa9, 0x61, 0x11, 0x4a, 0x81, 0x5f, 0x34,
-    0x02, 0x02, 0x3e, 0x66, 0x86, 0x49, 0xfe, 0x9e, 0x05, 0x0c, 0x08, 0x01, 0x50, 0x7f, 0xb9, 0x25, 0x01, 0x57, 0x22,
-    0x4b, 0x3f, 0x2a, 0x01, 0x01, 0x20, 0x37, 0x46, 0x24, 0x00, 0x01, 0x00, 0xc1, 0x00, 0x00, 0x05, 0x10, 0x05, 0xbf,
-    0x00, 0x25, 0x00, 0x2a, 0x40, 0x27, 0x1a, 0x08, 0x02, 0x01, 0x00, 0x24, 0x12, 0x09, 0x03, 0x02, 0x01, 0x02, 0x4a,
-    0x03, 0x01, 0x01, 0x01, 0x00, 0x5b, 0x04, 0x01, 0x00, 0x00, 0x30, 0x4b, 0x00, 0x02, 0x02, 0x29, 0x02, 0x4c, 0x26,
-    0x14, 0x14, 0x24, 0x24, 0x05, 0x07, 0x19, 0x2b, 0x01, 0x3e, 0x03, 0x17, 0x16, 0x16, 0x17, 0x07, 0x26, 0x23, 0x22,
-    0x06, 0x07, 0x01, 0x03, 0x23, 0x13, 0x03, 0x26, 0x26, 0x27, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x17, 0x1e, 0x03,
-    0x17, 0x13, 0x17, 0x37, 0x03, 0x86, 0x17, 0x35, 0x43, 0x54, 0x36, 0x20, 0x35, 0x1c, 0x25, 0x14, 0x16, 0x2a, 0x3e,
-    0x15, 0xfe, 0x6c, 0x63, 0xb3, 0x66, 0xaf, 0x0b, 0x2d, 0x23, 0x0b, 0x15, 0x0b, 0x0a, 0x19, 0x30, 0x1b, 0x30, 0x46,
-    0x32, 0x23, 0x0c, 0x6e, 0x06, 0x2a, 0x04, 0xd9, 0x2b, 0x53, 0x41, 0x27, 0x01, 0x01, 0x0c, 0x0e, 0x94, 0x0b, 0x30,
-    0x21, 0xfd, 0x70, 0xfd, 0xc7, 0x02, 0x4b, 0x02, 0x7f, 0x1f, 0x2a, 0x01, 0x05, 0x03, 0x98, 0x0c, 0x0a, 0x01, 0x02,
-    0x29, 0x40, 0x50, 0x28, 0xfe, 0x60, 0x4c, 0x5e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x27, 0xff, 0xe9, 0x04, 0xc8, 0x04,
-    0x3a, 0x00, 0x22, 0x00, 0x48, 0x00, 0x36, 0x40, 0x33, 0x10, 0x01, 0x07, 0x06, 0x01, 0x4a, 0x00, 0x06, 0x00, 0x07,
-    0x00, 0x06, 0x07, 0x70, 0x05, 0x03, 0x02, 0x00, 0x00, 0x04, 0x59, 0x00, 0x04, 0x04, 0x2b, 0x4b, 0x00, 0x07, 0x07,
-    0x01, 0x5c, 0x02, 0x01, 0x01, 0x01, 0x31, 0x01, 0x4c, 0x43, 0x41, 0x3a, 0x39, 0x14, 0x11, 0x19, 0x28, 0x29, 0x10,
-    0x08, 0x07, 0x1a, 0x2b, 0x01, 0x27, 0x16, 0x06, 0x07, 0x0e, 0x05, 0x27, 0x2e, 0x03, 0x27, 0x0e, 0x03, 0x27, 0x2e,
-    0x04, 0x36, 0x37, 0x36, 0x12, 0x37, 0x07, 0x37, 0x21, 0x01, 0x36, 0x26, 0x27, 0x25, 0x06, 0x06, 0x07, 0x0e, 0x02,
-    0x1e, 0x02, 0x17, 0x16, 0x3e, 0x04, 0x37, 0x37, 0x33, 0x07, 0x0e, 0x02, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x04, 0x04,
-    0xab, 0x76, 0x03, 0x03, 0x10, 0x06, 0x14, 0x22, 0x31, 0x45, 0x5b, 0x3b, 0x2f, 0x48, 0x35, 0x20, 0x06, 0x14, 0x31,
-    0x3f, 0x4f, 0x33, 0x38, 0x4e, 0x33, 0x1b, 0x0a, 0x03, 0x05, 0x10, 0x50, 0x40, 0x6b, 0x1c, 0x04, 0x48, 0xfe, 0xaa,
-    0x0e, 0x01, 0x08, 0xfe, 0x1b, 0x3d, 0x5d, 0x11, 0x02, 0x07, 0x04, 0x01, 0x0e, 0x1c, 0x19, 0x25, 0x36, 0x28, 0x1b,
-    0x11, 0x0a, 0x03, 0x27, 0xb5, 0x26, 0x02, 0x08, 0x03, 0x04, 0x14, 0x27, 0x21, 0x1d, 0x2a, 0x1f, 0x13, 0x0d, 0x07,
-    0x03, 0xa1, 0x01, 0x7d, 0xf4, 0x7c, 0x2e, 0x69, 0x67, 0x5d, 0x47, 0x29, 0x02, 0x01, 0x22, 0x3a, 0x4c, 0x2b, 0x29,
-    0x4e, 0x3c, 0x24, 0x02, 0x01, 0x2d, 0x48, 0x5c, 0x63, 0x62, 0x29, 0x84, 0x01, 0x00, 0x74, 0x02, 0x99, 0xfd, 0x79,
-    0x7d, 0xf4, 0x7d, 0x01, 0x75, 0xff, 0x84, 0x0e, 0x36, 0x41, 0x44, 0x39, 0x26, 0x02, 0x03, 0x23, 0x3c, 0x4e, 0x4e,
-    0x46, 0x18, 0xfc, 0xfc, 0x12, 0x40, 0x4c, 0x4f, 0x40, 0x29, 0x22, 0x38, 0x45, 0x45, 0x3c, 0x00, 0x00, 0x01, 0x00,
-    0xa2, 0xff, 0xf3, 0x04, 0xb2, 0x05, 0xb0, 0x00, 0x23, 0x00, 0xd9, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x20, 0x02,
-    0x01, 0x01, 0x00, 0x05, 0x04, 0x01, 0x05, 0x63, 0x07, 0x01, 0x00, 0x00, 0x08, 0x59, 0x00, 0x08, 0x08, 0x16, 0x4b,
-    0x00, 0x04, 0x04, 0x03, 0x5b, 0x06, 0x01, 0x03, 0x03, 0x17, 0x03, 0x4c, 0x1b, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40,
-    0x20, 0x02, 0x01, 0x01, 0x00, 0x05, 0x04, 0x01, 0x05, 0x63, 0x07, 0x01, 0x00, 0x00, 0x08, 0x59, 0x00, 0x08, 0x08,
-    0x16, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x06, 0x01, 0x03, 0x03, 0x20, 0x03, 0x4c, 0x1b, 0x4b, 0xb0, 0x0e, 0x50,
-    0x58, 0x40, 0x20, 0x02, 0x01, 0x01, 0x00, 0x05, 0x04, 0x01, 0x05, 0x63, 0x07, 0x01, 0x00, 0x00, 0x08, 0x59, 0x00,
-    0x08, 0x08, 0x16, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x06, 0x01, 0x03, 0x03, 0x1e, 0x03, 0x4c, 0x1b, 0x4b, 0xb0,
-    0x2a, 0x50, 0x58, 0x40, 0x20, 0x02, 0x01, 0x01, 0x00, 0x05, 0x04, 0x01, 0x05, 0x63, 0x07, 0x01, 0x00, 0x00, 0x08,
-    0x59, 0x00, 0x08, 0x08, 0x16, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x06, 0x01, 0x03, 0x03, 0x20, 0x03, 0x4c, 0x1b,
-    0x40, 0x24, 0x02, 0x01, 0x01, 0x00, 0x05, 0x04, 0x01, 0x05, 0x63, 0x07, 0x01, 0x00, 0x00, 0x08, 0x59, 0x00, 0x08,
-    0x08, 0x16, 0x4b, 0x00, 0x06, 0x06, 0x17, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x20, 0x03, 0x4c,
-    0x59, 0x59, 0x59, 0x59, 0x40, 0x0c, 0x11, 0x11, 0x11, 0x48, 0x11, 0x18, 0x21, 0x11, 0x10, 0x09, 0x06, 0x1d, 0x2b,
-    0x01, 0x21, 0x03, 0x36, 0x36, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x37, 0x3e, 0x03, 0x37, 0x36, 0x2e, 0x02,
-    0x27, 0x26, 0x06, 0x07, 0x03, 0x23, 0x13, 0x21, 0x37, 0x21, 0x04, 0x97, 0xfe, 0x10, 0x55, 0x1d, 0x37, 0x1d, 0x64,
-    0x93, 0x5e, 0x27, 0x08, 0x09, 0x45, 0x73, 0x9e, 0x61, 0x0d, 0x3d, 0x5a, 0x3d, 0x23, 0x06, 0x06, 0x0e, 0x2e, 0x53,
-    0x40, 0x1e, 0x3c, 0x1d, 0x7c, 0xb4, 0xe2, 0xfe, 0xaf, 0x1b, 0x03, 0xf5, 0x05, 0x18, 0xfe, 0x38, 0x02, 0x04, 0x01,
-    0x01, 0x46, 0x79, 0xa4, 0x5f, 0x63, 0x99, 0x69, 0x38, 0x02, 0x91, 0x02, 0x2b, 0x48, 0x62, 0x39, 0x39, 0x66, 0x4e,
-    0x2f, 0x02, 0x02, 0x03, 0x02, 0xfd, 0x51, 0x05, 0x18, 0x98, 0x00, 0x01, 0x00, 0x72, 0xff, 0xe9, 0x04, 0x93, 0x05,
-    0xc7, 0x00, 0x35, 0x00, 0x41, 0x40, 0x3e, 0x00, 0x02, 0x03, 0x04, 0x03, 0x02, 0x04, 0x70, 0x08, 0x01, 0x07, 0x05,
-    0x06, 0x05, 0x07, 0x06, 0x70, 0x00, 0x04, 0x00, 0x05, 0x07, 0x04, 0x05, 0x61, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00,
-    0x01, 0x01, 0x1d, 0x4b, 0x00, 0x06, 0x06, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x35,
-    0x00, 0x35, 0x27, 0x11, 0x15, 0x24, 0x14, 0x2d, 0x24, 0x09, 0x06, 0x1b, 0x2b, 0x01, 0x0e, 0x03, 0x27, 0x2e, 0x05,
-    0x37, 0x13, 0x3e, 0x05, 0x17, 0x1e, 0x03, 0x17, 0x23, 0x2e, 0x03, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x07, 0x21, 0x07,
-    0x21, 0x07, 0x06, 0x06, 0x1e, 0x03, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x04, 0x24, 0x13, 0x5b, 0x8a, 0xb5, 0x6c, 0x51,
-    0x7f, 0x5f, 0x40, 0x23, 0x07, 0x09, 0x31, 0x0c, 0x30, 0x48, 0x60, 0x79, 0x92, 0x55, 0x6a, 0x9d, 0x67, 0x33, 0x02,
-    0xb4, 0x02, 0x18, 0x39, 0x5e, 0x47, 0x5b, 0x87, 0x5f, 0x38, 0x0c, 0x0c, 0x02, 0x2a, 0x1b, 0xfd, 0xd8, 0x0e, 0x06,
-    0x02, 0x0c, 0x20, 0x36, 0x52, 0x39, 0x4c, 0x74, 0x56, 0x3a, 0x12, 0x01, 0xb9, 0x67, 0xac, 0x7b, 0x42, 0x03, 0x02,
-    0x32, 0x54, 0x71, 0x83, 0x8d, 0x47, 0x01, 0x39, 0x4c, 0x94, 0x85, 0x70, 0x51, 0x2c, 0x02, 0x02, 0x47, 0x7c, 0xaa,
-    0x64, 0x40, 0x71, 0x56, 0x34, 0x02, 0x02, 0x4f, 0x80, 0x9e, 0x4d, 0x4b, 0x98, 0x59, 0x2c, 0x63, 0x60, 0x58, 0x45,
-    0x2a, 0x02, 0x03, 0x2c, 0x53, 0x73, 0x44, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xba, 0xff, 0xfe, 0x04, 0x66, 0x05,
-    0xb0, 0x00, 0x26, 0x00, 0x35, 0x00, 0x3a, 0x40, 0x37, 0x00, 0x00, 0x09, 0x01, 0x07, 0x04, 0x00, 0x07, 0x61, 0x00,
-    0x02, 0x02, 0x05, 0x59, 0x08, 0x01, 0x05, 0x05, 0x16, 0x4b, 0x06, 0x01, 0x04, 0x04, 0x01, 0x5b, 0x03, 0x01, 0x01,
-    0x01, 0x17, 0x01, 0x4c, 0x27, 0x27, 0x00, 0x00, 0x27, 0x35, 0x27, 0x35, 0x2a, 0x28, 0x00, 0x26, 0x00, 0x26, 0x21,
-    0x27, 0x11, 0x2a, 0x21, 0x0a, 0x06, 0x19, 0x2b, 0x01, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x05, 0x27, 0x21, 0x13,
-    0x23, 0x03, 0x0e, 0x05, 0x27, 0x23, 0x37, 0x17, 0x32, 0x3e, 0x06, 0x37, 0x13, 0x01, 0x03, 0x17, 0x3e, 0x03, 0x37,
-    0x36, 0x36, 0x34, 0x2e, 0x02, 0x27, 0x03, 0x6a, 0x63, 0x4b, 0x56, 0x6f, 0x3d, 0x12, 0x07, 0x05, 0x1c, 0x2f, 0x41,
-    0x55, 0x69, 0x3f, 0xfe, 0xe8, 0xe2, 0xbd, 0x5e, 0x09, 0x17, 0x25, 0x39, 0x56, 0x7a, 0x53, 0x25, 0x11, 0x13, 0x25,
-    0x3a, 0x2d, 0x22, 0x19, 0x11, 0x0c, 0x09, 0x03, 0x77, 0x01, 0xa8, 0x65, 0x4e, 0x39, 0x4c, 0x31, 0x1a, 0x05, 0x02,
-    0x05, 0x09, 0x16, 0x26, 0x1e, 0x05, 0xb0, 0xfd, 0xc7, 0x02, 0x04, 0x52, 0x7d, 0x98, 0x48, 0x38, 0x6f, 0x65, 0x56,
-    0x3e, 0x23, 0x01, 0x05, 0x18, 0xfd, 0xec, 0x39, 0xa0, 0xad, 0xa9, 0x86, 0x51, 0x02, 0x96, 0x01, 0x2b, 0x4a, 0x61,
-    0x69, 0x6d, 0x60, 0x4d, 0x16, 0x02, 0xac, 0xfd, 0x2f, 0xfd, 0xb7, 0x01, 0x01, 0x3d, 0x5a, 0x69, 0x2e, 0x14, 0x38,
-    0x3d, 0x3c, 0x31, 0x20, 0x03, 0x00, 0x00, 0x02, 0x00, 0x16, 0xff, 0xfe, 0x04, 0x50, 0x05, 0xb0, 0x00, 0x16, 0x00,
-    0x23, 0x00, 0xe1, 0x4b, 0xb0, 0x2a, 0x50, 0x58, 0x40, 0x1d, 0x02, 0x01, 0x00, 0x09, 0x08, 0x02, 0x04, 0x07, 0x00,
-    0x04, 0x64, 0x06, 0x01, 0x01, 0x01, 0x16, 0x4b, 0x00, 0x07, 0x07, 0x03, 0x5b, 0x05, 0x01, 0x03, 0x03, 0x17, 0x03,
-    0x4c, 0x1b, 0x4b, 0xb0, 0x2c, 0x50, 0x58, 0x40, 0x22, 0x09, 0x01, 0x08, 0x04, 0x00, 0x08, 0x58, 0x02, 0x01, 0x00,
-    0x00, 0x04, 0x07, 0x00, 0x04, 0x62, 0x06, 0x01, 0x01, 0x01, 0x16, 0x4b, 0x00, 0x07, 0x07, 0x03, 0x5b, 0x05, 0x01,
-    0x03, 0x03, 0x17, 0x03, 0x4c, 0x1b, 0x4b, 0xb0, 0x2d, 0x50, 0x58, 0x40, 0x23, 0x00, 0x02, 0x09, 0x01, 0x08, 0x04,
-    0x02, 0x08, 0x64, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x04, 0x61, 0x06, 0x01, 0x01, 0x01, 0x16, 0x4b, 0x00, 0x07,
-    0x07, 0x03, 0x5b, 0x05, 0x01, 0x03, 0x03, 0x17, 0x03, 0x4c, 0x1b, 0x4b, 0xb0, 0x2e, 0x50, 0x58, 0x40, 0x22, 0x09,
-    0x01, 0x08, 0x04, 0x00, 0x08, 0x58, 0x02, 0x01, 0x00, 0x00, 0x04, 0x07, 0x00, 0x04, 0x62, 0x06, 0x01, 0x01, 0x01,
-    0x16, 0x4b, 0x00, 0x07, 0x07, 0x03, 0x5b, 0x05, 0x01, 0x03, 0x03, 0x17, 0x03, 0x4c, 0x1b, 0x40, 0x23, 0x00, 0x02,
-    0x09, 0x01, 0x08, 0x04, 0x02, 0x08, 0x64, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x04, 0x61, 0x06, 0x01, 0x01, 0x01,
-    0x16, 0x4b, 0x00, 0x07, 0x07, 0x03, 0x5b, 0x05, 0x01, 0x03, 0x03, 0x17, 0x03, 0x4c, 0x59, 0x59, 0x59, 0x59, 0x40,
-    0x11, 0x17, 0x17, 0x17, 0x23, 0x17, 0x22, 0x22, 0x11, 0x11, 0x11, 0x28, 0x21, 0x11, 0x10, 0x0a, 0x06, 0x1c, 0x2b,
-    0x01, 0x33, 0x13, 0x33, 0x03, 0x33, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x27, 0x23, 0x13, 0x23, 0x03, 0x23, 0x13, 0x33,
-    0x01, 0x03, 0x17, 0x3e, 0x03, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x01, 0x59, 0xf1, 0x6e, 0xb4, 0x71, 0x2a, 0x56, 0x76,
-    0x46, 0x19, 0x07, 0x08, 0x3d, 0x69, 0x93, 0x5e, 0xee, 0x75, 0xf2, 0x75, 0xb4, 0xfd, 0xb4, 0x01, 0x24, 0x62, 0x2a,
-    0x39, 0x51, 0x36, 0x1e, 0x06, 0x04, 0x01, 0x19, 0x36, 0x30, 0x03, 0x39, 0x02, 0x77, 0xfd, 0x95, 0x02, 0x46, 0x71,
-    0x90, 0x4d, 0x58, 0x9e, 0x76, 0x45, 0x02, 0x02, 0xa1, 0xfd, 0x5f, 0x05, 0xb0, 0xfc, 0xff, 0xfd, 0xf0, 0x01, 0x01,
-    0x32, 0x4d, 0x61, 0x32, 0x26, 0x56, 0x4a, 0x34, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xba, 0x00, 0x00, 0x04,
-    0xb5, 0x05, 0xb0, 0x00, 0x1b, 0x00, 0x2d, 0x40, 0x2a, 0x02, 0x01, 0x03, 0x01, 0x01, 0x4a, 0x00, 0x01, 0x00, 0x03,
-    0x02, 0x01, 0x03, 0x63, 0x05, 0x01, 0x00, 0x00, 0x06, 0x59, 0x00, 0x06, 0x06, 0x16, 0x4b, 0x04, 0x01, 0x02, 0x02,
-    0x17, 0x02, 0x4c, 0x11, 0x11, 0x12, 0x35, 0x15, 0x23, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x01, 0x21, 0x03, 0x36, 0x36,
-    0x17, 0x1e, 0x03, 0x07, 0x03, 0x23, 0x13, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x06, 0x07, 0x03, 0x23, 0x13, 0x21, 0x37,
-    0x21, 0x04, 0x9a, 0xfe, 0x25, 0x54, 0x19, 0x31, 0x19, 0x5d, 0x8c, 0x59, 0x24, 0x0a, 0x4b, 0xb5, 0x4b, 0x06, 0x09,
-    0x28, 0x4a, 0x3b, 0x1b, 0x35, 0x1a, 0x7e, 0xb5, 0xe2, 0xfe, 0xb0, 0x1b, 0x03, 0xe0, 0x05, 0x18, 0xfe, 0x3b, 0x04,
-    0x04, 0x01, 0x01, 0x39, 0x67, 0x94, 0x5c, 0xfe, 0x37, 0x01, 0xca, 0x36, 0x5a, 0x40, 0x26, 0x02, 0x01, 0x03, 0x02,
-    0xfd, 0x42, 0x05, 0x18, 0x98, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x35, 0xfe, 0x99, 0x04, 0xa0, 0x05, 0xb0, 0x00,
-    0x0b, 0x00, 0x23, 0x40, 0x20, 0x00, 0x04, 0x03, 0x04, 0x73, 0x02, 0x01, 0x00, 0x00, 0x16, 0x4b, 0x00, 0x01, 0x01,
-    0x03, 0x5a, 0x05, 0x01, 0x03, 0x03, 0x17, 0x03, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x06, 0x1a, 0x2b,
-    0x01, 0x33, 0x03, 0x21, 0x13, 0x33, 0x03, 0x21, 0x03, 0x23, 0x13, 0x21, 0x01, 0x31, 0xb5, 0xe2, 0x02, 0x04, 0xe3,
-    0xb5, 0xfd, 0xfe, 0xa8, 0x3f, 0xb5, 0x3f, 0xfe, 0x9f, 0x05, 0xb0, 0xfa, 0xe7, 0x05, 0x19, 0xfa, 0x50, 0xfe, 0x99,
-    0x01, 0x67, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x35, 0xff, 0xff, 0x04, 0x93, 0x05, 0xb0, 0x00, 0x10, 0x00, 0x1d,
-    0x00, 0x2f, 0x40, 0x2c, 0x00, 0x01, 0x06, 0x01, 0x05, 0x04, 0x01, 0x05, 0x63, 0x00, 0x00, 0x00, 0x03, 0x59, 0x00,
-    0x03, 0x03, 0x16, 0x4b, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x11, 0x11, 0x11, 0x1d,
-    0x11, 0x1c, 0x22, 0x11, 0x28, 0x21, 0x10, 0x07, 0x06, 0x19, 0x2b, 0x01, 0x21, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x0e,
-    0x03, 0x27, 0x21, 0x13, 0x21, 0x01, 0x03, 0x17, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x04, 0x78, 0xfd,
-    0x55, 0x4e, 0xf5, 0x5e, 0x9e, 0x6f, 0x37, 0x08, 0x09, 0x5d, 0x90, 0xba, 0x67, 0xfe, 0x3e, 0xfd, 0x03, 0x61, 0xfc,
-    0xd2, 0x60, 0xf6, 0x44, 0x78, 0x5c, 0x3c, 0x09, 0x07, 0x19, 0x3d, 0x5d, 0x3b, 0x05, 0x18, 0xfe, 0x41, 0x01, 0x03,
-    0x38, 0x69, 0x99, 0x63, 0x6c, 0xa5, 0x70, 0x38, 0x01, 0x05, 0xb0, 0xfd, 0x12, 0xfd, 0xd5, 0x02, 0x28, 0x4c, 0x6d,
-    0x45, 0x3c, 0x5f, 0x43, 0x26, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xb8, 0xfe, 0x99, 0x04, 0x70, 0x05, 0xb0,
-    0x00, 0x12, 0x00, 0x1b, 0x00, 0x2b, 0x40, 0x28, 0x02, 0x01, 0x00, 0x03, 0x00, 0x51, 0x00, 0x07, 0x07, 0x04, 0x59,
-    0x00, 0x04, 0x04, 0x16, 0x4b, 0x06, 0x05, 0x02, 0x03, 0x03, 0x01, 0x59, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x11,
-    0x16, 0x11, 0x18, 0x11, 0x11, 0x11, 0x10, 0x08, 0x06, 0x1c, 0x2b, 0x01, 0x23, 0x13, 0x21, 0x03, 0x23, 0x13, 0x17,
-    0x3e, 0x05, 0x37, 0x13, 0x21, 0x03, 0x33, 0x01, 0x0e, 0x03, 0x07, 0x25, 0x13, 0x21, 0x03, 0xa0, 0xa4, 0x3e, 0xfd,
-    0x56, 0x3f, 0x99, 0x38, 0x3e, 0x3a, 0x58, 0x40, 0x2e, 0x21, 0x1a, 0x0c, 0x84, 0x02, 0x77, 0xe2, 0x7b, 0xfe, 0x23,
-    0x13, 0x29, 0x3b, 0x54, 0x3d, 0x01, 0xb5, 0xc8, 0xfe, 0xeb, 0xfe, 0x9b, 0x01, 0x65, 0xfe, 0x99, 0x01, 0xfe, 0x01,
-    0x24, 0x65, 0x77, 0x86, 0x88, 0x86, 0x3d, 0x02, 0x49, 0xfa, 0xe7, 0x02, 0xd0, 0x5c, 0xc1, 0xbc, 0xaf, 0x4b, 0x03,
-    0x04, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xb0, 0x00, 0x00, 0x04, 0xfe, 0x05, 0xb0, 0x00, 0x15, 0x00, 0x31,
-    0x40, 0x2e, 0x13, 0x08, 0x02, 0x00, 0x05, 0x01, 0x4a, 0x07, 0x01, 0x05, 0x02, 0x01, 0x00, 0x01, 0x05, 0x00, 0x62,
-    0x08, 0x06, 0x02, 0x04, 0x04, 0x16, 0x4b, 0x09, 0x03, 0x02, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x15, 0x14, 0x11, 0x11,
-    0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x10, 0x0a, 0x06, 0x1d, 0x2b, 0x01, 0x27, 0x03, 0x23, 0x13, 0x23, 0x01, 0x23,
-    0x01, 0x03, 0x33, 0x13, 0x17, 0x13, 0x33, 0x03, 0x33, 0x01, 0x33, 0x01, 0x13, 0x23, 0x02, 0xf2, 0x35, 0x75, 0xb2,
-    0x75, 0x39, 0xfe, 0xc5, 0xe7, 0x01, 0x89, 0x60, 0xcc, 0x35, 0x43, 0x75, 0xb3, 0x76, 0x3a, 0x01, 0x1c, 0xd9, 0xfe,
-    0x9b, 0x86, 0xd4, 0x02, 0x8b, 0x01, 0xfd, 0x74, 0x02, 0x8c, 0xfd, 0x74, 0x02, 0xe2, 0x02, 0xce, 0xfd, 0x73, 0x01,
-    0x02, 0x8e, 0xfd, 0x72, 0x02, 0x8e, 0xfd, 0x1e, 0xfd, 0x32, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2e, 0xff, 0xe9, 0x04,
-    0x93, 0x05, 0xc5, 0x00, 0x3e, 0x00, 0x4e, 0x40, 0x4b, 0x1f, 0x01, 0x07, 0x00, 0x01, 0x4a, 0x00, 0x02, 0x01, 0x00,
-    0x01, 0x02, 0x00, 0x70, 0x00, 0x05, 0x07, 0x06, 0x07, 0x05, 0x06, 0x70, 0x08, 0x01, 0x00, 0x00, 0x07, 0x05, 0x00,
-    0x07, 0x63, 0x00, 0x01, 0x01, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x1d, 0x4b, 0x00, 0x06, 0x06, 0x04, 0x5b, 0x00, 0x04,
-    0x04, 0x20, 0x04, 0x4c, 0x01, 0x00, 0x3d, 0x3b, 0x33, 0x31, 0x2d, 0x2c, 0x28, 0x26, 0x16, 0x14, 0x10, 0x0f, 0x0b,
-    0x09, 0x00, 0x3e, 0x01, 0x3e, 0x09, 0x06, 0x14, 0x2b, 0x01, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x26,
-    0x0e, 0x02, 0x07, 0x07, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x27,
-    0x2e, 0x03, 0x37, 0x17, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x37, 0x02,
-    0x71, 0x3f, 0x78, 0x62, 0x42, 0x08, 0x07, 0x26, 0x4b, 0x68, 0x3a, 0x3b, 0x70, 0x5c, 0x40, 0x0c, 0xb4, 0x0a, 0x62,
-    0x91, 0xb5, 0x5d, 0x5d, 0xa8, 0x7c, 0x42, 0x09, 0x05, 0x33, 0x4f, 0x63, 0x35, 0x67, 0x61, 0x08, 0x08, 0x6a, 0xa1,
-    0xc8, 0x66, 0x60, 0xa5, 0x77, 0x40, 0x05, 0xb4, 0x04, 0x25, 0x48, 0x65, 0x3d, 0x42, 0x84, 0x6c, 0x49, 0x09, 0x09,
-    0x23, 0x4a, 0x69, 0x3d, 0xbe, 0x1b, 0x03, 0x31, 0x1d, 0x3d, 0x62, 0x45, 0x3f, 0x5e, 0x3f, 0x1f, 0x01, 0x01, 0x21,
-    0x40, 0x5e, 0x3c, 0x01, 0x63, 0x97, 0x66, 0x32, 0x01, 0x02, 0x32, 0x64, 0x97, 0x67, 0x3e, 0x64, 0x51, 0x3e, 0x17,
-    0x2d, 0xab, 0x70, 0x70, 0xa5, 0x6d, 0x33, 0x02, 0x02, 0x3a, 0x6c, 0x9d, 0x65, 0x01, 0x3e, 0x63, 0x48, 0x28, 0x01,
-    0x02, 0x21, 0x47, 0x6a, 0x48, 0x44, 0x5f, 0x3d, 0x1d, 0x02, 0x01, 0x98, 0x00, 0x00, 0x00, 0x01, 0x00, 0x35, 0x00,
-    0x00, 0x04, 0xa0, 0x05, 0xb0, 0x00, 0x09, 0x00, 0x1e, 0x40, 0x1b, 0x09, 0x04, 0x02, 0x01, 0x00, 0x01, 0x4a, 0x03,
-    0x01, 0x00, 0x00, 0x16, 0x4b, 0x02, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x11, 0x12, 0x11, 0x10, 0x04, 0x06, 0x18,
-    0x2b, 0x01, 0x33, 0x03, 0x23, 0x13, 0x01, 0x23, 0x13, 0x33, 0x03, 0x03, 0xe6, 0xba, 0xfd, 0xb5, 0xba, 0xfd, 0x46,
-    0xb9, 0xfc, 0xb5, 0xb9, 0x05, 0xb0, 0xfa, 0x50, 0x04, 0x23, 0xfb, 0xdd, 0x05, 0xb0, 0xfb, 0xdd, 0x00, 0x00, 0x00,
-    0x01, 0xff, 0xca, 0xff, 0xff, 0x04, 0xa0, 0x05, 0xb0, 0x00, 0x17, 0x00, 0x27, 0x40, 0x24, 0x00, 0x01, 0x01, 0x04,
-    0x59, 0x05, 0x01, 0x04, 0x04, 0x16, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x02, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c,
-    0x00, 0x00, 0x00, 0x17, 0x00, 0x17, 0x21, 0x27, 0x11, 0x11, 0x06, 0x06, 0x18, 0x2b, 0x01, 0x03, 0x23, 0x13, 0x21,
-    0x03, 0x0e, 0x05, 0x27, 0x23, 0x37, 0x17, 0x32, 0x3e, 0x04, 0x37, 0x13, 0x04, 0xa0, 0xfc, 0xb5, 0xe2, 0xfe, 0x6a,
-    0x6e, 0x0b, 0x1c, 0x2c, 0x41, 0x5f, 0x82, 0x57, 0x37, 0x11, 0x24, 0x39, 0x53, 0x3b, 0x25, 0x19, 0x0e, 0x06, 0x8a,
-    0x05, 0xb0, 0xfa, 0x50, 0x05, 0x18, 0xfd, 0x91, 0x43, 0x99, 0x98, 0x8c, 0x6b, 0x3f, 0x01, 0x96, 0x01, 0x39, 0x5c,
-    0x74, 0x77, 0x6d, 0x27, 0x03, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xff, 0xe9, 0x05, 0x2b, 0x05, 0xb0,
-    0x00, 0x18, 0x00, 0x27, 0x40, 0x24, 0x16, 0x0d, 0x01, 0x03, 0x02, 0x00, 0x0c, 0x01, 0x01, 0x02, 0x02, 0x4a, 0x03,
-    0x01, 0x00, 0x00, 0x16, 0x4b, 0x00, 0x02, 0x02, 0x01, 0x5c, 0x00, 0x01, 0x01, 0x1e, 0x01, 0x4c, 0x16, 0x25, 0x25,
-    0x12, 0x04, 0x06, 0x18, 0x2b, 0x01, 0x17, 0x01, 0x33, 0x01, 0x0e, 0x03, 0x27, 0x26, 0x26, 0x27, 0x37, 0x16, 0x16,
-    0x17, 0x32, 0x3e, 0x02, 0x37, 0x37, 0x01, 0x33, 0x02, 0x38, 0x21, 0x01, 0xf7, 0xdb, 0xfd, 0x28, 0x21, 0x4f, 0x60,
-    0x75, 0x47, 0x33, 0x63, 0x30, 0x26, 0x23, 0x4b, 0x25, 0x2a, 0x46, 0x3a, 0x30, 0x15, 0x3e, 0xfe, 0xdc, 0xc1, 0x02,
-    0xef, 0xb5, 0x03, 0x76, 0xfb, 0x3f, 0x3b, 0x61, 0x45, 0x25, 0x01, 0x01, 0x13, 0x11, 0x8b, 0x0a, 0x10, 0x01, 0x18,
-    0x2a, 0x3a, 0x21, 0x60, 0x04, 0x34, 0x00, 0x00, 0x00, 0x01, 0x00, 0x39, 0xfe, 0xa1, 0x04, 0x97, 0x05, 0xb0, 0x00,
-    0x0b, 0x00, 0x23, 0x40, 0x20, 0x00, 0x04, 0x01, 0x04, 0x52, 0x02, 0x01, 0x00, 0x00, 0x16, 0x4b, 0x03, 0x01, 0x01,
-    0x01, 0x05, 0x5a, 0x00, 0x05, 0x05, 0x17, 0x05, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x06, 0x1a, 0x2b,
-    0x01, 0x33, 0x03, 0x21, 0x13, 0x33, 0x03, 0x33, 0x03, 0x23, 0x13, 0x21, 0x01, 0x35, 0xb5, 0xe3, 0x01, 0xf8, 0xe3,
-    0xb5, 0xe2, 0x8f, 0x69, 0xa3, 0x3d, 0xfc, 0xc4, 0x05, 0xb0, 0xfa, 0xe7, 0x05, 0x19, 0xfa, 0xec, 0xfe, 0x05, 0x01,
-    0x5f, 0x00, 0x01, 0x00, 0xe4, 0x00, 0x00, 0x04, 0x9d, 0x05, 0xb0, 0x00, 0x17, 0x00, 0x2b, 0x40, 0x28, 0x03, 0x01,
-    0x01, 0x03, 0x01, 0x4a, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x01, 0x64, 0x05, 0x04, 0x02, 0x02, 0x02, 0x16, 0x4b,
-    0x00, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x17, 0x25, 0x15, 0x23, 0x11, 0x06, 0x06, 0x18,
-    0x2b, 0x01, 0x03, 0x23, 0x13, 0x06, 0x06, 0x27, 0x2e, 0x03, 0x37, 0x13, 0x33, 0x03, 0x06, 0x06, 0x16, 0x16, 0x17,
-    0x16, 0x36, 0x37, 0x13, 0x04, 0x9d, 0xfd, 0xb5, 0x6f, 0x47, 0x91, 0x4c, 0x65, 0x87, 0x4e, 0x18, 0x0b, 0x4b, 0xb5,
-    0x4b, 0x06, 0x01, 0x1e, 0x45, 0x40, 0x4d, 0x94, 0x49, 0x7e, 0x05, 0xb0, 0xfa, 0x50, 0x02, 0x5c, 0x1a, 0x1b, 0x01,
-    0x01, 0x47, 0x79, 0xa2, 0x5d, 0x01, 0xc8, 0xfe, 0x37, 0x34, 0x67, 0x53, 0x35, 0x02, 0x03, 0x20, 0x15, 0x02, 0xbc,
-    0x00, 0x01, 0x00, 0x11, 0x00, 0x00, 0x04, 0xc4, 0x05, 0xb0, 0x00, 0x0b, 0x00, 0x25, 0x40, 0x22, 0x06, 0x05, 0x03,
-    0x03, 0x01, 0x01, 0x16, 0x4b, 0x02, 0x01, 0x00, 0x00, 0x04, 0x5a, 0x00, 0x04, 0x04, 0x17, 0x04, 0x4c, 0x00, 0x00,
-    0x00, 0x0b, 0x00, 0x0b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x07, 0x06, 0x19, 0x2b, 0x01, 0x03, 0x33, 0x13, 0x33, 0x03,
-    0x33, 0x13, 0x33, 0x03, 0x21, 0x13, 0x01, 0xc2, 0xe2, 0xcd, 0xe3, 0xb3, 0xe2, 0xcd, 0xe3, 0xb3, 0xfc, 0xfc, 0x49,
-    0xfc, 0x05, 0xb0, 0xfa, 0xe7, 0x05, 0x19, 0xfa, 0xe7, 0x05, 0x19, 0xfa, 0x50, 0x05, 0xb0, 0x00, 0x00, 0x01, 0x00,
-    0x11, 0xfe, 0xa1, 0x04, 0xc4, 0x05, 0xb0, 0x00, 0x11, 0x00, 0x2d, 0x40, 0x2a, 0x00, 0x05, 0x06, 0x05, 0x73, 0x08,
-    0x07, 0x03, 0x03, 0x01, 0x01, 0x16, 0x4b, 0x04, 0x02, 0x02, 0x00, 0x00, 0x06, 0x5a, 0x00, 0x06, 0x06, 0x17, 0x06,
-    0x4c, 0x00, 0x00, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x31, 0x11, 0x11, 0x09, 0x06, 0x1b, 0x2b, 0x01,
-    0x03, 0x33, 0x13, 0x33, 0x03, 0x33, 0x35, 0x33, 0x13, 0x33, 0x03, 0x33, 0x03, 0x23, 0x13, 0x21, 0x13, 0x01, 0xc2,
-    0xe2, 0xcd, 0xe3, 0xb3, 0xe2, 0x90, 0x3d, 0xe3, 0xb3, 0xe2, 0x58, 0x69, 0xa2, 0x3d, 0xfc, 0xa5, 0xfc, 0x05, 0xb0,
-    0xfa, 0xe7, 0x05, 0x19, 0xfa, 0xe7, 0x01, 0x05, 0x18, 0xfa, 0xe8, 0xfe, 0x09, 0x01, 0x5f, 0x05, 0xb0, 0x00, 0x00,
-    0x02, 0x00, 0xaa, 0xff, 0xff, 0x04, 0x42, 0x05, 0xb0, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x2f, 0x40, 0x2c, 0x00, 0x01,
-    0x06, 0x01, 0x05, 0x04, 0x01, 0x05, 0x63, 0x00, 0x03, 0x03, 0x00, 0x59, 0x00, 0x00, 0x00, 0x16, 0x4b, 0x00, 0x04,
-    0x04, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x11, 0x11, 0x11, 0x1d, 0x11, 0x1c, 0x22, 0x11, 0x28, 0x21,
-    0x10, 0x07, 0x06, 0x19, 0x2b, 0x13, 0x21, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x27, 0x21, 0x13, 0x21, 0x01,
-    0x03, 0x17, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0xc5, 0x01, 0xdc, 0x68, 0x7f, 0x5d, 0x97, 0x66, 0x30,
-    0x08, 0x09, 0x56, 0x88, 0xb2, 0x65, 0xfe, 0xb4, 0xe2, 0xfe, 0xd8, 0x01, 0x75, 0x60, 0x81, 0x43, 0x70, 0x54, 0x35,
-    0x08, 0x07, 0x14, 0x34, 0x54, 0x3a, 0x05, 0xb0, 0xfd, 0xa9, 0x01, 0x03, 0x3b, 0x6b, 0x98, 0x5f, 0x68, 0xa4, 0x72,
-    0x3b, 0x01, 0x05, 0x18, 0xfd, 0xaa, 0xfd, 0xd5, 0x02, 0x2b, 0x4d, 0x6c, 0x42, 0x37, 0x5f, 0x45, 0x29, 0x02, 0x00,
-    0x03, 0x00, 0x23, 0xff, 0xfe, 0x04, 0xc0, 0x05, 0xb0, 0x00, 0x0e, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x2d, 0x40, 0x2a,
-    0x00, 0x00, 0x07, 0x01, 0x06, 0x05, 0x00, 0x06, 0x64, 0x04, 0x01, 0x02, 0x02, 0x16, 0x4b, 0x00, 0x05, 0x05, 0x01,
-    0x5b, 0x03, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x13, 0x13, 0x13, 0x1f, 0x13, 0x1e, 0x22, 0x11, 0x11, 0x11, 0x28,
-    0x20, 0x08, 0x06, 0x1a, 0x2b, 0x01, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x27, 0x21, 0x13, 0x33, 0x01, 0x23, 0x13,
-    0x33, 0x01, 0x03, 0x17, 0x3e, 0x03, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x01, 0x67, 0x52, 0x59, 0x7f, 0x4e, 0x1d, 0x07,
-    0x09, 0x42, 0x70, 0x9c, 0x62, 0xfe, 0xe7, 0xfd, 0xaf, 0x01, 0xf4, 0xb5, 0xfd, 0xb5, 0xfc, 0x92, 0x60, 0x4f, 0x3d,
-    0x5a, 0x3e, 0x23, 0x06, 0x05, 0x03, 0x1c, 0x3c, 0x33, 0x03, 0x58, 0x01, 0x03, 0x44, 0x71, 0x95, 0x52, 0x5d, 0xa1,
-    0x78, 0x44, 0x02, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0xfd, 0x12, 0xfd, 0xd4, 0x01, 0x01, 0x33, 0x52, 0x69, 0x36,
-    0x2a, 0x5a, 0x4c, 0x33, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3a, 0xff, 0xff, 0x04, 0x1b, 0x05, 0xb0, 0x00, 0x0e,
-    0x00, 0x1b, 0x00, 0x29, 0x40, 0x26, 0x00, 0x00, 0x05, 0x01, 0x04, 0x03, 0x00, 0x04, 0x64, 0x00, 0x02, 0x02, 0x16,
-    0x4b, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x0f, 0x0f, 0x0f, 0x1b, 0x0f, 0x1a, 0x22,
-    0x11, 0x28, 0x20, 0x06, 0x06, 0x18, 0x2b, 0x01, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x27, 0x21, 0x13, 0x33, 0x03,
-    0x03, 0x17, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x01, 0x84, 0xf5, 0x5e, 0x9e, 0x6f, 0x37, 0x08, 0x09,
-    0x5d, 0x90, 0xba, 0x67, 0xfe, 0x3e, 0xfd, 0xb5, 0x82, 0x61, 0xf7, 0x44, 0x78, 0x5c, 0x3c, 0x09, 0x07, 0x19, 0x3d,
-    0x5d, 0x3b, 0x03, 0x59, 0x01, 0x03, 0x38, 0x69, 0x99, 0x63, 0x6c, 0xa5, 0x70, 0x38, 0x01, 0x05, 0xb0, 0xfd, 0x12,
-    0xfd, 0xd5, 0x02, 0x28, 0x4c, 0x6d, 0x45, 0x3c, 0x5f, 0x43, 0x26, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x4e, 0xff,
-    0xe9, 0x04, 0x71, 0x05, 0xc8, 0x00, 0x2f, 0x00, 0x41, 0x40, 0x3e, 0x00, 0x04, 0x03, 0x02, 0x03, 0x04, 0x02, 0x70,
-    0x08, 0x01, 0x07, 0x01, 0x00, 0x01, 0x07, 0x00, 0x70, 0x00, 0x02, 0x00, 0x01, 0x07, 0x02, 0x01, 0x61, 0x00, 0x03,
-    0x03, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x1d, 0x4b, 0x00, 0x00, 0x00, 0x06, 0x5b, 0x00, 0x06, 0x06, 0x20, 0x06, 0x4c,
-    0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x29, 0x24, 0x14, 0x25, 0x11, 0x15, 0x24, 0x09, 0x06, 0x1b, 0x2b, 0x01, 0x06,
-    0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x37, 0x21, 0x37, 0x21, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02,
-    0x07, 0x07, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x03, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x01, 0x0a, 0x05, 0x10,
-    0x34, 0x5c, 0x48, 0x5a, 0x89, 0x61, 0x3c, 0x0c, 0x0e, 0xfe, 0x2a, 0x1b, 0x01, 0xd4, 0x0e, 0x09, 0x09, 0x33, 0x67,
-    0x55, 0x4d, 0x75, 0x54, 0x34, 0x0b, 0xb2, 0x0c, 0x57, 0x8b, 0xb7, 0x6b, 0x79, 0xa9, 0x64, 0x23, 0x0e, 0x35, 0x12,
-    0x5c, 0x94, 0xca, 0x7f, 0x6a, 0x9c, 0x63, 0x2c, 0x07, 0x01, 0xd1, 0x3e, 0x76, 0x5d, 0x3b, 0x02, 0x03, 0x4c, 0x7c,
-    0x9c, 0x4d, 0x5a, 0x97, 0x5e, 0x44, 0x96, 0x7e, 0x54, 0x03, 0x03, 0x36, 0x5d, 0x7c, 0x44, 0x02, 0x67, 0xb4, 0x85,
-    0x4b, 0x03, 0x03, 0x66, 0xa3, 0xcf, 0x6c, 0xfe, 0xb4, 0x73, 0xd5, 0xa2, 0x5f, 0x03, 0x02, 0x4e, 0x83, 0xaf, 0x63,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x0b, 0xff, 0xea, 0x04, 0x8b, 0x05, 0xc6, 0x00, 0x25, 0x00, 0x43, 0x00, 0x5f, 0x4b,
-    0xb0, 0x19, 0x50, 0x58, 0x40, 0x1f, 0x00, 0x04, 0x00, 0x01, 0x07, 0x04, 0x01, 0x62, 0x00, 0x06, 0x06, 0x03, 0x5b,
-    0x05, 0x01, 0x03, 0x03, 0x16, 0x4b, 0x00, 0x07, 0x07, 0x00, 0x5b, 0x02, 0x01, 0x00, 0x00, 0x20, 0x00, 0x4c, 0x1b,
-    0x40, 0x27, 0x00, 0x04, 0x00, 0x01, 0x07, 0x04, 0x01, 0x62, 0x00, 0x03, 0x03, 0x16, 0x4b, 0x00, 0x06, 0x06, 0x05,
-    0x5b, 0x00, 0x05, 0x05, 0x1d, 0x4b, 0x00, 0x02, 0x02, 0x17, 0x4b, 0x00, 0x07, 0x07, 0x00, 0x5b, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x4c, 0x59, 0x40, 0x0b, 0x2d, 0x2d, 0x27, 0x11, 0x11, 0x11, 0x17, 0x26, 0x08, 0x06, 0x1c, 0x2b, 0x01,
-    0x0e, 0x05, 0x27, 0x2e, 0x04, 0x36, 0x37, 0x37, 0x23, 0x03, 0x23, 0x13, 0x33, 0x03, 0x33, 0x37, 0x3e, 0x05, 0x17,
-    0x1e, 0x04, 0x06, 0x07, 0x27, 0x3e, 0x02, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x04, 0x07, 0x03, 0x0e, 0x02, 0x1e, 0x02,
-    0x17, 0x16, 0x3e, 0x04, 0x37, 0x04, 0x3c, 0x09, 0x1d, 0x2f, 0x42, 0x59, 0x75, 0x4a, 0x45, 0x5f, 0x3e, 0x21, 0x0c,
-    0x04, 0x07, 0x13, 0x6d, 0x6f, 0xb5, 0xfd, 0xb4, 0x74, 0x6d, 0x19, 0x08, 0x1c, 0x2c, 0x3e, 0x56, 0x71, 0x48, 0x46,
-    0x64, 0x43, 0x24, 0x0f, 0x03, 0x07, 0xb5, 0x03, 0x0a, 0x03, 0x07, 0x1b, 0x34, 0x2a, 0x2d, 0x40, 0x2e, 0x1e, 0x13,
-    0x0b, 0x04, 0x42, 0x03, 0x0a, 0x05, 0x04, 0x16, 0x2e, 0x28, 0x2f, 0x45, 0x31, 0x21, 0x15, 0x0c, 0x05, 0x02, 0x04,
-    0x3c, 0x7f, 0x79, 0x6b, 0x4f, 0x2c, 0x02, 0x02, 0x35, 0x54, 0x6d, 0x75, 0x76, 0x34, 0x7a, 0xfd, 0x83, 0x05, 0xb0,
-    0xfd, 0x64, 0x98, 0x3a, 0x7d, 0x78, 0x6d, 0x51, 0x2d, 0x02, 0x02, 0x33, 0x52, 0x6c, 0x75, 0x79, 0x37, 0x03, 0x1b,
-    0x4b, 0x52, 0x52, 0x42, 0x2a, 0x02, 0x02, 0x25, 0x3f, 0x52, 0x55, 0x51, 0x1f, 0xfe, 0x54, 0x18, 0x49, 0x52, 0x54,
-    0x45, 0x2c, 0x02, 0x02, 0x23, 0x3e, 0x51, 0x56, 0x53, 0x22, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xd1, 0x00, 0x00,
-    0x04, 0x9c, 0x05, 0xb1, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x33, 0x40, 0x30, 0x05, 0x01, 0x00, 0x04, 0x01, 0x4a, 0x00,
-    0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x61, 0x00, 0x05, 0x05, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x16, 0x4b, 0x06, 0x03,
-    0x02, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x00, 0x00, 0x19, 0x17, 0x16, 0x14, 0x00, 0x0f, 0x00, 0x0f, 0x28, 0x11, 0x11,
-    0x07, 0x06, 0x17, 0x2b, 0x21, 0x13, 0x21, 0x01, 0x23, 0x01, 0x26, 0x26, 0x37, 0x3e, 0x03, 0x33, 0x05, 0x03, 0x01,
-    0x06, 0x1e, 0x02, 0x17, 0x05, 0x13, 0x27, 0x22, 0x0e, 0x02, 0x02, 0xea, 0x6a, 0xfe, 0xd9, 0xfe, 0x6f, 0xcb, 0x01,
-    0xc6, 0x71, 0x71, 0x0a, 0x09, 0x63, 0x99, 0xc0, 0x66, 0x01, 0xb2, 0xfd, 0xfd, 0xd4, 0x08, 0x1f, 0x44, 0x62, 0x3c,
-    0x01, 0x02, 0x5e, 0xe6, 0x43, 0x7e, 0x66, 0x43, 0x02, 0x5f, 0xfd, 0xa1, 0x02, 0x96, 0x35, 0xbc, 0x7d, 0x6f, 0xa2,
-    0x69, 0x33, 0x01, 0xfa, 0x50, 0x04, 0x06, 0x3e, 0x62, 0x45, 0x26, 0x02, 0x01, 0x02, 0x20, 0x02, 0x20, 0x43, 0x68,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x65, 0xff, 0xe9, 0x04, 0x6f, 0x06, 0x11, 0x00, 0x2c, 0x00, 0x42, 0x00, 0x38, 0x40,
-    0x35, 0x2a, 0x01, 0x04, 0x03, 0x01, 0x4a, 0x00, 0x02, 0x00, 0x02, 0x72, 0x05, 0x01, 0x00, 0x06, 0x01, 0x03, 0x04,
-    0x00, 0x03, 0x63, 0x00, 0x04, 0x04, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x20, 0x01, 0x4c, 0x2e, 0x2d, 0x01, 0x00, 0x39,
-    0x37, 0x2d, 0x42, 0x2e, 0x42, 0x20, 0x1f, 0x0c, 0x0a, 0x00, 0x2c, 0x01, 0x2c, 0x07, 0x06, 0x14, 0x2b, 0x01, 0x1e,
-    0x03, 0x07, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x3f, 0x03, 0x3e, 0x05, 0x37, 0x3e, 0x03, 0x37, 0x37, 0x0e, 0x03,
-    0x07, 0x0e, 0x03, 0x07, 0x36, 0x36, 0x17, 0x26, 0x0e, 0x02, 0x07, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02,
-    0x37, 0x37, 0x36, 0x2e, 0x02, 0x02, 0xa6, 0x66, 0x94, 0x5d, 0x26, 0x08, 0x03, 0x0c, 0x54, 0x8a, 0xbb, 0x72, 0x6e,
-    0xa1, 0x65, 0x28, 0x0b, 0x03, 0x01, 0x09, 0x0b, 0x2b, 0x42, 0x5d, 0x7a, 0x9c, 0x60, 0x29, 0x57, 0x4c, 0x3a, 0x0b,
-    0x96, 0x09, 0x42, 0x67, 0x86, 0x4e, 0x54, 0x86, 0x69, 0x50, 0x1f, 0x4b, 0xb7, 0x42, 0x4a, 0x77, 0x56, 0x35, 0x09,
-    0x03, 0x06, 0x0d, 0x33, 0x5f, 0x4d, 0x4f, 0x7a, 0x56, 0x33, 0x09, 0x02, 0x06, 0x12, 0x38, 0x60, 0x03, 0xfc, 0x02,
-    0x53, 0x87, 0xae, 0x5d, 0x18, 0x6b, 0xc2, 0x92, 0x55, 0x03, 0x02, 0x5a, 0x91, 0xbd, 0x65, 0x17, 0x07, 0x45, 0x58,
-    0xaf, 0xa3, 0x91, 0x73, 0x51, 0x12, 0x07, 0x11, 0x21, 0x39, 0x2f, 0x01, 0x59, 0x70, 0x44, 0x25, 0x0f, 0x10, 0x41,
-    0x60, 0x7f, 0x4e, 0x4c, 0x60, 0x99, 0x02, 0x37, 0x5f, 0x7d, 0x44, 0x17, 0x3f, 0x83, 0x6c, 0x47, 0x02, 0x03, 0x42,
-    0x6c, 0x8a, 0x46, 0x17, 0x3e, 0x78, 0x5e, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x37, 0xff, 0xff, 0x04, 0x0e,
-    0x04, 0x3a, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x34, 0x00, 0x42, 0x40, 0x3f, 0x09, 0x01, 0x04, 0x05, 0x0e, 0x01, 0x03,
-    0x04, 0x02, 0x4a, 0x00, 0x04, 0x07, 0x01, 0x03, 0x02, 0x04, 0x03, 0x63, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00,
-    0x00, 0x18, 0x4b, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x06, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x1b, 0x1b, 0x00, 0x00,
-    0x34, 0x32, 0x2a, 0x28, 0x1b, 0x27, 0x1b, 0x26, 0x1e, 0x1c, 0x00, 0x1a, 0x00, 0x19, 0x21, 0x08, 0x06, 0x15, 0x2b,
-    0x33, 0x13, 0x05, 0x1e, 0x05, 0x07, 0x0e, 0x03, 0x07, 0x1e, 0x03, 0x07, 0x0e, 0x05, 0x27, 0x03, 0x03, 0x05, 0x32,
-    0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x25, 0x17, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x37,
-    0xbb, 0x01, 0x91, 0x2e, 0x5f, 0x5a, 0x4e, 0x38, 0x1e, 0x04, 0x03, 0x24, 0x39, 0x4a, 0x28, 0x28, 0x3e, 0x2b, 0x15,
-    0x02, 0x03, 0x27, 0x40, 0x54, 0x60, 0x68, 0x34, 0xe3, 0x39, 0x01, 0x20, 0x2b, 0x57, 0x48, 0x33, 0x06, 0x06, 0x1c,
-    0x34, 0x46, 0x25, 0xfe, 0xe4, 0xe0, 0x2a, 0x5e, 0x53, 0x3b, 0x07, 0x06, 0x25, 0x41, 0x51, 0x24, 0xf2, 0x04, 0x3a,
-    0x01, 0x01, 0x0c, 0x1b, 0x2b, 0x3f, 0x56, 0x38, 0x2f, 0x4b, 0x3a, 0x2c, 0x10, 0x0d, 0x2f, 0x3d, 0x4b, 0x2a, 0x3c,
-    0x5d, 0x47, 0x31, 0x1e, 0x0d, 0x01, 0x01, 0xdb, 0xfe, 0xba, 0x01, 0x11, 0x28, 0x42, 0x31, 0x2b, 0x3b, 0x23, 0x10,
-    0x01, 0x95, 0x01, 0x0c, 0x22, 0x3e, 0x33, 0x30, 0x3a, 0x20, 0x0b, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x49,
-    0x00, 0x00, 0x04, 0x5f, 0x04, 0x3a, 0x00, 0x05, 0x00, 0x19, 0x40, 0x16, 0x00, 0x00, 0x00, 0x02, 0x59, 0x00, 0x02,
-    0x02, 0x18, 0x4b, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x11, 0x11, 0x10, 0x03, 0x06, 0x17, 0x2b, 0x01, 0x21, 0x03,
-    0x23, 0x13, 0x21, 0x04, 0x44, 0xfd, 0x5c, 0xa1, 0xb6, 0xbc, 0x03, 0x5a, 0x03, 0xa1, 0xfc, 0x5f, 0x04, 0x3a, 0x00,
-    0x02, 0xff, 0xa7, 0xfe, 0xc2, 0x04, 0x44, 0x04, 0x3a, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x38, 0x40, 0x35, 0x05, 0x01,
-    0x03, 0x00, 0x03, 0x51, 0x00, 0x07, 0x07, 0x01, 0x59, 0x00, 0x01, 0x01, 0x18, 0x4b, 0x06, 0x02, 0x08, 0x03, 0x00,
-    0x00, 0x04, 0x59, 0x00, 0x04, 0x04, 0x17, 0x04, 0x4c, 0x01, 0x00, 0x1b, 0x1a, 0x19, 0x18, 0x11, 0x10, 0x0f, 0x0e,
-    0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x00, 0x12, 0x01, 0x12, 0x09, 0x06, 0x14, 0x2b, 0x37, 0x3e, 0x05, 0x37, 0x13,
-    0x21, 0x03, 0x33, 0x03, 0x23, 0x13, 0x21, 0x03, 0x23, 0x13, 0x01, 0x0e, 0x03, 0x07, 0x25, 0x13, 0x21, 0x42, 0x30,
-    0x49, 0x37, 0x26, 0x1a, 0x11, 0x07, 0x55, 0x02, 0xa5, 0xa1, 0x87, 0x63, 0xa4, 0x38, 0xfd, 0x25, 0x38, 0xa1, 0x40,
-    0x02, 0x18, 0x0e, 0x1e, 0x2c, 0x3c, 0x2c, 0x01, 0xaf, 0x84, 0xfe, 0xbe, 0x95, 0x03, 0x3e, 0x5e, 0x74, 0x74, 0x66,
-    0x22, 0x01, 0x96, 0xfc, 0x5d, 0xfe, 0x2b, 0x01, 0x3e, 0xfe, 0xc2, 0x01, 0xd5, 0x02, 0x0d, 0x44, 0x8c, 0x88, 0x80,
-    0x38, 0x03, 0x02, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xa3, 0x00, 0x00, 0x04, 0xc1, 0x04, 0x3a, 0x00, 0x15,
-    0x00, 0x31, 0x40, 0x2e, 0x13, 0x08, 0x02, 0x00, 0x05, 0x01, 0x4a, 0x07, 0x01, 0x05, 0x02, 0x01, 0x00, 0x01, 0x05,
-    0x00, 0x62, 0x08, 0x06, 0x02, 0x04, 0x04, 0x18, 0x4b, 0x09, 0x03, 0x02, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x15, 0x14,
-    0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x10, 0x0a, 0x06, 0x1d, 0x2b, 0x01, 0x27, 0x03, 0x23, 0x13, 0x23,
-    0x01, 0x23, 0x01, 0x03, 0x33, 0x13, 0x17, 0x13, 0x33, 0x03, 0x33, 0x01, 0x33, 0x01, 0x13, 0x23, 0x02, 0xce, 0x3a,
-    0x55, 0xb5, 0x57, 0x36, 0xfe, 0xdb, 0xe3, 0x01, 0x89, 0xa1, 0xc7, 0x68, 0x3a, 0x52, 0xb5, 0x53, 0x36, 0x01, 0x09,
-    0xda, 0xfe, 0x9e, 0xbc, 0xcc, 0x01, 0xd6, 0x01, 0xfe, 0x29, 0x01, 0xd7, 0xfe, 0x29, 0x02, 0x3d, 0x01, 0xfd, 0xfe,
-    0x40, 0x01, 0x01, 0xc1, 0xfe, 0x3f, 0x01, 0xc1, 0xfd, 0xef, 0xfd, 0xd7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x4f, 0xff,
-    0xec, 0x04, 0x3a, 0x04, 0x4e, 0x00, 0x42, 0x00, 0x88, 0xb5, 0x21, 0x01, 0x07, 0x00, 0x01, 0x4a, 0x4b, 0xb0, 0x0c,
-    0x50, 0x58, 0x40, 0x2e, 0x00, 0x02, 0x01, 0x00, 0x01, 0x02, 0x00, 0x70, 0x00, 0x05, 0x07, 0x06, 0x07, 0x05, 0x06,
-    0x70, 0x08, 0x01, 0x00, 0x00, 0x07, 0x05, 0x00, 0x07, 0x63, 0x00, 0x01, 0x01, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x1f,
-    0x4b, 0x00, 0x06, 0x06, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x1e, 0x04, 0x4c, 0x1b, 0x40, 0x2e, 0x00, 0x02, 0x01, 0x00,
-    0x01, 0x02, 0x00, 0x70, 0x00, 0x05, 0x07, 0x06, 0x07, 0x05, 0x06, 0x70, 0x08, 0x01, 0x00, 0x00, 0x07, 0x05, 0x00,
-    0x07, 0x63, 0x00, 0x01, 0x01, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x1f, 0x4b, 0x00, 0x06, 0x06, 0x04, 0x5b, 0x00, 0x04,
-    0x04, 0x20, 0x04, 0x4c, 0x59, 0x40, 0x17, 0x01, 0x00, 0x41, 0x3f, 0x37, 0x35, 0x31, 0x30, 0x2c, 0x2a, 0x16, 0x14,
-    0x10, 0x0f, 0x0b, 0x09, 0x00, 0x42, 0x01, 0x42, 0x09, 0x06, 0x14, 0x2b, 0x01, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e,
-    0x02, 0x23, 0x26, 0x0e, 0x02, 0x07, 0x07, 0x3e, 0x03, 0x17, 0x1e, 0x05, 0x07, 0x0e, 0x03, 0x07, 0x16, 0x16, 0x07,
-    0x0e, 0x05, 0x27, 0x2e, 0x03, 0x37, 0x17, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27,
-    0x27, 0x37, 0x02, 0x64, 0x2a, 0x5f, 0x52, 0x3a, 0x07, 0x06, 0x2a, 0x45, 0x54, 0x23, 0x2c, 0x63, 0x58, 0x42, 0x0c,
-    0xb5, 0x0a, 0x63, 0x8e, 0xa7, 0x4e, 0x2f, 0x62, 0x5b, 0x50, 0x3a, 0x1e, 0x04, 0x03, 0x2b, 0x41, 0x51, 0x28, 0x4f,
-    0x5c, 0x04, 0x03, 0x2f, 0x4c, 0x62, 0x6d, 0x71, 0x34, 0x4f, 0x9d, 0x7c, 0x4c, 0x02, 0xb2, 0x02, 0x31, 0x4d, 0x5d,
-    0x2c, 0x2c, 0x67, 0x5b, 0x43, 0x07, 0x07, 0x27, 0x44, 0x55, 0x28, 0xf6, 0x1b, 0x02, 0x75, 0x0d, 0x24, 0x40, 0x33,
-    0x2e, 0x3d, 0x24, 0x10, 0x01, 0x11, 0x29, 0x42, 0x30, 0x01, 0x59, 0x7c, 0x4c, 0x21, 0x01, 0x01, 0x0e, 0x1e, 0x30,
-    0x43, 0x59, 0x39, 0x30, 0x4c, 0x3b, 0x2c, 0x11, 0x1e, 0x7a, 0x57, 0x3e, 0x62, 0x4a, 0x34, 0x20, 0x0e, 0x01, 0x01,
-    0x27, 0x52, 0x80, 0x5a, 0x01, 0x34, 0x48, 0x2d, 0x16, 0x01, 0x01, 0x12, 0x2b, 0x47, 0x34, 0x34, 0x3f, 0x22, 0x0c,
-    0x01, 0x01, 0x9c, 0x00, 0x00, 0x01, 0x00, 0x37, 0x00, 0x00, 0x04, 0x5c, 0x04, 0x3a, 0x00, 0x09, 0x00, 0x1e, 0x40,
-    0x1b, 0x09, 0x04, 0x02, 0x01, 0x00, 0x01, 0x4a, 0x03, 0x01, 0x00, 0x00, 0x18, 0x4b, 0x02, 0x01, 0x01, 0x01, 0x17,
-    0x01, 0x4c, 0x11, 0x12, 0x11, 0x10, 0x04, 0x06, 0x18, 0x2b, 0x01, 0x33, 0x03, 0x23, 0x13, 0x01, 0x23, 0x13, 0x33,
-    0x03, 0x03, 0xa1, 0xbb, 0xbc, 0xb5, 0x89, 0xfd, 0x7e, 0xbb, 0xbc, 0xb4, 0x89, 0x04, 0x3a, 0xfb, 0xc6, 0x03, 0x12,
-    0xfc, 0xee, 0x04, 0x3a, 0xfc, 0xed, 0x00, 0x00, 0x00, 0x01, 0x00, 0x36, 0x00, 0x00, 0x04, 0xab, 0x04, 0x3a, 0x00,
-    0x0c, 0x00, 0x27, 0x40, 0x24, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x4a, 0x00, 0x03, 0x00, 0x00, 0x01, 0x03, 0x00, 0x62,
-    0x04, 0x01, 0x02, 0x02, 0x18, 0x4b, 0x05, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x12, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x06, 0x06, 0x1a, 0x2b, 0x01, 0x23, 0x03, 0x23, 0x13, 0x33, 0x03, 0x33, 0x01, 0x33, 0x01, 0x01, 0x23, 0x01, 0xed,
-    0xb1, 0x51, 0xb5, 0xbc, 0xb5, 0x50, 0x93, 0x01, 0xd6, 0xeb, 0xfd, 0xda, 0x01, 0x7e, 0xd5, 0x01, 0xcd, 0xfe, 0x33,
-    0x04, 0x3a, 0xfe, 0x36, 0x01, 0xca, 0xfd, 0xee, 0xfd, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xd2, 0xff, 0xff,
-    0x04, 0x5b, 0x04, 0x3a, 0x00, 0x17, 0x00, 0x27, 0x40, 0x24, 0x00, 0x01, 0x01, 0x04, 0x59, 0x05, 0x01, 0x04, 0x04,
-    0x18, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x02, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x17, 0x00,
-    0x17, 0x21, 0x27, 0x11, 0x11, 0x06, 0x06, 0x18, 0x2b, 0x01, 0x03, 0x23, 0x13, 0x21, 0x03, 0x0e, 0x05, 0x27, 0x23,
-    0x37, 0x33, 0x32, 0x3e, 0x04, 0x37, 0x13, 0x04, 0x5b, 0xbc, 0xb6, 0xa2, 0xfe, 0x7f, 0x36, 0x0b, 0x1c, 0x2d, 0x41,
-    0x5e, 0x80, 0x55, 0x3a, 0x16, 0x26, 0x38, 0x51, 0x39, 0x24, 0x18, 0x0e, 0x06, 0x4f, 0x04, 0x3a, 0xfb, 0xc6, 0x03,
-    0xa1, 0xfe, 0xca, 0x44, 0x92, 0x8a, 0x7a, 0x5c, 0x36, 0x01, 0xa4, 0x2d, 0x49, 0x5e, 0x65, 0x64, 0x2a, 0x01, 0xcf,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x04, 0x5e, 0x04, 0x3a, 0x00, 0x0c, 0x00, 0x20, 0x40, 0x1d, 0x08, 0x05, 0x02,
-    0x01, 0x00, 0x01, 0x4a, 0x04, 0x01, 0x00, 0x00, 0x18, 0x4b, 0x03, 0x02, 0x02, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x11,
-    0x12, 0x12, 0x11, 0x11, 0x05, 0x06, 0x19, 0x2b, 0x25, 0x01, 0x33, 0x03, 0x23, 0x13, 0x01, 0x23, 0x03, 0x03, 0x23,
-    0x13, 0x33, 0x02, 0x09, 0x01, 0x70, 0xe5, 0xbc, 0xb5, 0x72, 0xfe, 0xc5, 0x7d, 0x5c, 0x7a, 0xb5, 0xbc, 0xe6, 0xf8,
-    0x03, 0x42, 0xfb, 0xc6, 0x02, 0x8b, 0xfd, 0x75, 0x02, 0xba, 0xfd, 0x46, 0x04, 0x3a, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x37, 0x00, 0x00, 0x04, 0x5c, 0x04, 0x3a, 0x00, 0x0b, 0x00, 0x21, 0x40, 0x1e, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04,
-    0x01, 0x62, 0x05, 0x01, 0x03, 0x03, 0x18, 0x4b, 0x02, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x10, 0x06, 0x06, 0x1a, 0x2b, 0x21, 0x23, 0x13, 0x21, 0x03, 0x23, 0x13, 0x33, 0x03, 0x21, 0x13, 0x33, 0x03,
-    0xa0, 0xb5, 0x51, 0xfe, 0x01, 0x51, 0xb5, 0xbc, 0xb5, 0x52, 0x01, 0xff, 0x52, 0xb5, 0x01, 0xce, 0xfe, 0x32, 0x04,
-    0x3a, 0xfe, 0x2b, 0x01, 0xd5, 0x00, 0x01, 0x00, 0x37, 0x00, 0x00, 0x04, 0x5c, 0x04, 0x3a, 0x00, 0x07, 0x00, 0x1b,
-    0x40, 0x18, 0x00, 0x01, 0x01, 0x03, 0x59, 0x00, 0x03, 0x03, 0x18, 0x4b, 0x02, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c,
-    0x11, 0x11, 0x11, 0x10, 0x04, 0x06, 0x18, 0x2b, 0x21, 0x23, 0x13, 0x21, 0x03, 0x23, 0x13, 0x21, 0x03, 0xa0, 0xb5,
-    0xa1, 0xfe, 0x02, 0xa2, 0xb5, 0xbc, 0x03, 0x69, 0x03, 0xa1, 0xfc, 0x5f, 0x04, 0x3a, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x9e, 0x00, 0x00, 0x04, 0xad, 0x04, 0x3a, 0x00, 0x07, 0x00, 0x1b, 0x40, 0x18, 0x02, 0x01, 0x00, 0x00, 0x03, 0x59,
-    0x00, 0x03, 0x03, 0x18, 0x4b, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x10, 0x04, 0x06, 0x18, 0x2b,
-    0x01, 0x21, 0x03, 0x23, 0x13, 0x21, 0x37, 0x21, 0x04, 0x93, 0xfe, 0x5d, 0xa2, 0xb5, 0xa1, 0xfe, 0x64, 0x1a, 0x03,
-    0xf5, 0x03, 0xa4, 0xfc, 0x5c, 0x03, 0xa4, 0x96, 0x00, 0x03, 0x00, 0x62, 0xfe, 0x60, 0x04, 0x31, 0x06, 0x00, 0x00,
-    0x1b, 0x00, 0x27, 0x00, 0x33, 0x00, 0x1e, 0x40, 0x1b, 0x2e, 0x2d, 0x22, 0x21, 0x16, 0x08, 0x06, 0x01, 0x00, 0x01,
-    0x4a, 0x00, 0x00, 0x01, 0x00, 0x72, 0x00, 0x01, 0x01, 0x1a, 0x01, 0x4c, 0x1d, 0x16, 0x02, 0x06, 0x16, 0x2b, 0x13,
-    0x3e, 0x03, 0x37, 0x13, 0x33, 0x03, 0x1e, 0x03, 0x07, 0x07, 0x0e, 0x03, 0x07, 0x03, 0x23, 0x13, 0x2e, 0x03, 0x37,
-    0x25, 0x36, 0x2e, 0x02, 0x27, 0x03, 0x3e, 0x03, 0x37, 0x05, 0x06, 0x14, 0x16, 0x16, 0x17, 0x13, 0x0e, 0x03, 0x07,
-    0x6e, 0x0d, 0x49, 0x77, 0xa5, 0x69, 0x52, 0xb4, 0x52, 0x5d, 0x7b, 0x47, 0x15, 0x09, 0x02, 0x0d, 0x4a, 0x79, 0xa5,
-    0x69, 0x4c, 0xb4, 0x4c, 0x5b, 0x7a, 0x47, 0x16, 0x09, 0x03, 0x08, 0x07, 0x01, 0x1b, 0x3c, 0x36, 0x94, 0x40, 0x60,
-    0x45, 0x2a, 0x09, 0xfd, 0xb0, 0x06, 0x1a, 0x3b, 0x35, 0x94, 0x40, 0x60, 0x43, 0x29, 0x09, 0x02, 0x21, 0x66, 0xb7,
-    0x92, 0x64, 0x12, 0x01, 0xba, 0xfe, 0x44, 0x17, 0x6d, 0x93, 0xad, 0x56, 0x17, 0x66, 0xb6, 0x90, 0x62, 0x11, 0xfe,
-    0x6c, 0x01, 0x97, 0x17, 0x6c, 0x91, 0xaa, 0x55, 0x1f, 0x34, 0x72, 0x69, 0x57, 0x18, 0xfc, 0xe5, 0x17, 0x50, 0x67,
-    0x7a, 0x40, 0x0a, 0x33, 0x70, 0x68, 0x55, 0x19, 0x03, 0x19, 0x18, 0x51, 0x67, 0x7a, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x3c, 0xfe, 0xbf, 0x04, 0x45, 0x04, 0x3a, 0x00, 0x0b, 0x00, 0x23, 0x40, 0x20, 0x00, 0x04, 0x01, 0x04,
-    0x52, 0x02, 0x01, 0x00, 0x00, 0x18, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x05, 0x5a, 0x00, 0x05, 0x05, 0x17, 0x05, 0x4c,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x06, 0x1a, 0x2b, 0x13, 0x33, 0x03, 0x21, 0x13, 0x33, 0x03, 0x33, 0x03,
-    0x23, 0x13, 0x21, 0xf8, 0xb5, 0xa2, 0x01, 0xe2, 0xa2, 0xb6, 0xa2, 0x7e, 0x64, 0xa3, 0x38, 0xfc, 0xea, 0x04, 0x3a,
-    0xfc, 0x5d, 0x03, 0xa3, 0xfc, 0x5d, 0xfe, 0x28, 0x01, 0x41, 0x00, 0x00, 0x01, 0x00, 0x9f, 0x00, 0x00, 0x04, 0x5c,
-    0x04, 0x3a, 0x00, 0x16, 0x00, 0x25, 0x40, 0x22, 0x02, 0x01, 0x01, 0x03, 0x01, 0x4a, 0x00, 0x03, 0x00, 0x01, 0x00,
-    0x03, 0x01, 0x63, 0x04, 0x01, 0x02, 0x02, 0x18, 0x4b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x13, 0x25, 0x15, 0x22,
-    0x10, 0x05, 0x06, 0x19, 0x2b, 0x21, 0x23, 0x13, 0x06, 0x27, 0x2e, 0x03, 0x37, 0x13, 0x33, 0x03, 0x06, 0x1e, 0x02,
-    0x17, 0x16, 0x36, 0x37, 0x13, 0x33, 0x03, 0xa0, 0xb5, 0x4b, 0x8f, 0x91, 0x5c, 0x91, 0x5f, 0x2b, 0x0a, 0x33, 0xb5,
-    0x34, 0x06, 0x0e, 0x2f, 0x4f, 0x3a, 0x4b, 0x94, 0x4a, 0x61, 0xb5, 0x01, 0x8c, 0x26, 0x03, 0x01, 0x3a, 0x69, 0x95,
-    0x5d, 0x01, 0x3b, 0xfe, 0xc4, 0x37, 0x5b, 0x42, 0x26, 0x02, 0x02, 0x13, 0x0f, 0x02, 0x18, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x15, 0x00, 0x00, 0x04, 0x80, 0x04, 0x3a, 0x00, 0x0b, 0x00, 0x25, 0x40, 0x22, 0x06, 0x05, 0x03, 0x03, 0x01,
-    0x01, 0x18, 0x4b, 0x02, 0x01, 0x00, 0x00, 0x04, 0x5a, 0x00, 0x04, 0x04, 0x17, 0x04, 0x4c, 0x00, 0x00, 0x00, 0x0b,
-    0x00, 0x0b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x07, 0x06, 0x19, 0x2b, 0x01, 0x03, 0x33, 0x13, 0x33, 0x03, 0x33, 0x13,
-    0x33, 0x03, 0x21, 0x13, 0x01, 0x85, 0xa2, 0xc9, 0xa2, 0xb5, 0xa2, 0xc8, 0xa2, 0xb5, 0xbc, 0xfc, 0x51, 0xbc, 0x04,
-    0x3a, 0xfc, 0x5d, 0x03, 0xa3, 0xfc, 0x5d, 0x03, 0xa3, 0xfb, 0xc6, 0x04, 0x3a, 0x00, 0x00, 0x01, 0x00, 0x0a, 0xfe,
-    0xbf, 0x04, 0x75, 0x04, 0x3a, 0x00, 0x11, 0x00, 0x2d, 0x40, 0x2a, 0x00, 0x05, 0x06, 0x05, 0x73, 0x08, 0x07, 0x03,
-    0x03, 0x01, 0x01, 0x18, 0x4b, 0x04, 0x02, 0x02, 0x00, 0x00, 0x06, 0x5a, 0x00, 0x06, 0x06, 0x17, 0x06, 0x4c, 0x00,
-    0x00, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x31, 0x11, 0x11, 0x09, 0x06, 0x1b, 0x2b, 0x01, 0x03, 0x33,
-    0x13, 0x33, 0x03, 0x33, 0x35, 0x33, 0x13, 0x33, 0x03, 0x33, 0x03, 0x23, 0x13, 0x21, 0x13, 0x01, 0x7a, 0xa2, 0xc9,
-    0xa2, 0xb5, 0xa2, 0x95, 0x33, 0xa2, 0xb5, 0xa2, 0x56, 0x64, 0xa2, 0x38, 0xfc, 0xaf, 0xbc, 0x04, 0x3a, 0xfc, 0x5d,
-    0x03, 0xa3, 0xfc, 0x5d, 0x01, 0x03, 0xa2, 0xfc, 0x5e, 0xfe, 0x27, 0x01, 0x41, 0x04, 0x3a, 0x00, 0x00, 0x02, 0x00,
-    0x70, 0xff, 0xff, 0x04, 0x2d, 0x04, 0x3a, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x2f, 0x40, 0x2c, 0x00, 0x01, 0x06, 0x01,
-    0x05, 0x04, 0x01, 0x05, 0x63, 0x00, 0x03, 0x03, 0x00, 0x59, 0x00, 0x00, 0x00, 0x18, 0x4b, 0x00, 0x04, 0x04, 0x02,
-    0x5b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x11, 0x11, 0x11, 0x1d, 0x11, 0x1c, 0x22, 0x11, 0x28, 0x21, 0x10, 0x07,
-    0x06, 0x19, 0x2b, 0x13, 0x21, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x27, 0x21, 0x13, 0x21, 0x01, 0x03, 0x17,
-    0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x8b, 0x01, 0xd7, 0x47, 0xb5, 0x49, 0x81, 0x5f, 0x34, 0x05, 0x06,
-    0x4d, 0x79, 0x98, 0x50, 0xfe, 0x7e, 0xa1, 0xfe, 0xdd, 0x01, 0x91, 0x40, 0xb7, 0x2d, 0x55, 0x44, 0x2e, 0x06, 0x05,
-    0x14, 0x2d, 0x41, 0x28, 0x04, 0x3a, 0xfe, 0x66, 0x01, 0x02, 0x2b, 0x51, 0x77, 0x4f, 0x57, 0x83, 0x57, 0x2b, 0x01,
-    0x03, 0xa2, 0xfe, 0x67, 0xfe, 0x8e, 0x01, 0x18, 0x2e, 0x48, 0x30, 0x29, 0x41, 0x2e, 0x1a, 0x02, 0x00, 0x03, 0x00,
-    0x23, 0xff, 0xff, 0x04, 0x73, 0x04, 0x3a, 0x00, 0x0e, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x2d, 0x40, 0x2a, 0x00, 0x00,
-    0x07, 0x01, 0x06, 0x05, 0x00, 0x06, 0x64, 0x04, 0x01, 0x02, 0x02, 0x18, 0x4b, 0x00, 0x05, 0x05, 0x01, 0x5b, 0x03,
-    0x01, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x13, 0x13, 0x13, 0x1d, 0x13, 0x1c, 0x22, 0x11, 0x11, 0x11, 0x28, 0x20, 0x08,
-    0x06, 0x1a, 0x2b, 0x01, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x27, 0x21, 0x13, 0x33, 0x01, 0x23, 0x13, 0x33, 0x01,
-    0x03, 0x17, 0x36, 0x36, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x01, 0x47, 0x59, 0x47, 0x74, 0x51, 0x28, 0x05, 0x05, 0x42,
-    0x6a, 0x8c, 0x4f, 0xfe, 0xe0, 0xbd, 0xae, 0x02, 0x29, 0xb5, 0xbc, 0xb5, 0xfc, 0xc0, 0x41, 0x55, 0x57, 0x6f, 0x0b,
-    0x04, 0x09, 0x1d, 0x34, 0x25, 0x02, 0x9f, 0x01, 0x02, 0x2f, 0x54, 0x75, 0x49, 0x51, 0x82, 0x5a, 0x2f, 0x01, 0x04,
-    0x3a, 0xfb, 0xc6, 0x04, 0x3a, 0xfd, 0xcf, 0xfe, 0x8e, 0x01, 0x02, 0x67, 0x55, 0x22, 0x3f, 0x32, 0x1f, 0x02, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x38, 0xff, 0xff, 0x03, 0xf7, 0x04, 0x3a, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x29, 0x40, 0x26,
-    0x00, 0x00, 0x05, 0x01, 0x04, 0x03, 0x00, 0x04, 0x64, 0x00, 0x02, 0x02, 0x18, 0x4b, 0x00, 0x03, 0x03, 0x01, 0x5b,
-    0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x0f, 0x0f, 0x0f, 0x1b, 0x0f, 0x1a, 0x22, 0x11, 0x28, 0x20, 0x06, 0x06, 0x18,
-    0x2b, 0x01, 0x05, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x27, 0x21, 0x13, 0x33, 0x03, 0x03, 0x05, 0x32, 0x3e, 0x02, 0x37,
-    0x36, 0x2e, 0x02, 0x27, 0x01, 0x61, 0x01, 0x34, 0x49, 0x83, 0x61, 0x35, 0x05, 0x06, 0x4e, 0x7b, 0x99, 0x51, 0xfd,
-    0xff, 0xbb, 0xb5, 0x61, 0x41, 0x01, 0x37, 0x2d, 0x56, 0x46, 0x30, 0x06, 0x06, 0x16, 0x2f, 0x43, 0x28, 0x02, 0xa0,
-    0x02, 0x02, 0x29, 0x51, 0x77, 0x50, 0x58, 0x83, 0x56, 0x2b, 0x01, 0x04, 0x3a, 0xfd, 0xcf, 0xfe, 0x8e, 0x01, 0x17,
-    0x2f, 0x47, 0x31, 0x2a, 0x42, 0x2d, 0x19, 0x02, 0x00, 0x01, 0x00, 0x50, 0xff, 0xe9, 0x04, 0x1b, 0x04, 0x50, 0x00,
-    0x2d, 0x00, 0x48, 0x40, 0x45, 0x00, 0x01, 0x00, 0x07, 0x00, 0x01, 0x07, 0x70, 0x00, 0x04, 0x06, 0x05, 0x06, 0x04,
-    0x05, 0x70, 0x00, 0x07, 0x00, 0x06, 0x04, 0x07, 0x06, 0x61, 0x08, 0x01, 0x00, 0x00, 0x02, 0x5b, 0x00, 0x02, 0x02,
-    0x1f, 0x4b, 0x00, 0x05, 0x05, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x20, 0x03, 0x4c, 0x01, 0x00, 0x29, 0x28, 0x27, 0x26,
-    0x22, 0x20, 0x1c, 0x1b, 0x17, 0x15, 0x0c, 0x0a, 0x06, 0x05, 0x00, 0x2d, 0x01, 0x2d, 0x09, 0x06, 0x14, 0x2b, 0x01,
-    0x26, 0x0e, 0x02, 0x07, 0x07, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x17,
-    0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x05, 0x37, 0x21, 0x36, 0x2e, 0x02, 0x02, 0x6b, 0x32, 0x60, 0x51,
-    0x39, 0x0b, 0xab, 0x09, 0x5b, 0x85, 0xa0, 0x50, 0x73, 0xa6, 0x68, 0x28, 0x0a, 0x05, 0x0e, 0x5c, 0x95, 0xc6, 0x77,
-    0x55, 0x8f, 0x66, 0x36, 0x04, 0xaa, 0x03, 0x1d, 0x3a, 0x53, 0x34, 0x4f, 0x7c, 0x5c, 0x40, 0x14, 0xfe, 0x5a, 0x1b,
-    0x01, 0x9a, 0x04, 0x18, 0x3c, 0x63, 0x03, 0xb7, 0x01, 0x1c, 0x38, 0x4f, 0x32, 0x01, 0x54, 0x88, 0x5f, 0x33, 0x02,
-    0x02, 0x59, 0x94, 0xc0, 0x6a, 0x2b, 0x71, 0xc8, 0x94, 0x54, 0x03, 0x02, 0x3b, 0x67, 0x8e, 0x56, 0x01, 0x32, 0x57,
-    0x41, 0x26, 0x01, 0x03, 0x38, 0x60, 0x80, 0x45, 0x01, 0x98, 0x3f, 0x74, 0x59, 0x36, 0x00, 0x00, 0x02, 0x00, 0x05,
-    0xff, 0xea, 0x04, 0x5e, 0x04, 0x51, 0x00, 0x21, 0x00, 0x3f, 0x00, 0x8b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x1f,
-    0x00, 0x00, 0x00, 0x03, 0x06, 0x00, 0x03, 0x62, 0x00, 0x07, 0x07, 0x01, 0x5b, 0x05, 0x01, 0x01, 0x01, 0x1f, 0x4b,
-    0x00, 0x06, 0x06, 0x02, 0x5b, 0x04, 0x01, 0x02, 0x02, 0x20, 0x02, 0x4c, 0x1b, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40,
-    0x23, 0x00, 0x00, 0x00, 0x03, 0x06, 0x00, 0x03, 0x62, 0x00, 0x05, 0x05, 0x18, 0x4b, 0x00, 0x07, 0x07, 0x01, 0x5b,
-    0x00, 0x01, 0x01, 0x1f, 0x4b, 0x00, 0x06, 0x06, 0x02, 0x5b, 0x04, 0x01, 0x02, 0x02, 0x20, 0x02, 0x4c, 0x1b, 0x40,
-    0x27, 0x00, 0x00, 0x00, 0x03, 0x06, 0x00, 0x03, 0x62, 0x00, 0x05, 0x05, 0x18, 0x4b, 0x00, 0x07, 0x07, 0x01, 0x5b,
-    0x00, 0x01, 0x01, 0x1f, 0x4b, 0x00, 0x04, 0x04, 0x17, 0x4b, 0x00, 0x06, 0x06, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x20,
-    0x02, 0x4c, 0x59, 0x59, 0x40, 0x0b, 0x2d, 0x27, 0x11, 0x11, 0x14, 0x2d, 0x26, 0x10, 0x08, 0x06, 0x1c, 0x2b, 0x01,
-    0x33, 0x3e, 0x05, 0x17, 0x1e, 0x04, 0x06, 0x07, 0x07, 0x0e, 0x05, 0x27, 0x2e, 0x03, 0x37, 0x07, 0x03, 0x23, 0x13,
-    0x33, 0x13, 0x0e, 0x02, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x04, 0x37, 0x37, 0x3e, 0x02, 0x2e, 0x02, 0x27, 0x26, 0x0e,
-    0x04, 0x07, 0x01, 0x26, 0x75, 0x0d, 0x25, 0x31, 0x41, 0x55, 0x6a, 0x42, 0x46, 0x63, 0x41, 0x25, 0x0f, 0x02, 0x06,
-    0x03, 0x08, 0x1d, 0x2f, 0x43, 0x5a, 0x73, 0x48, 0x5f, 0x76, 0x3d, 0x0f, 0x09, 0x83, 0x52, 0xb5, 0xbc, 0xb5, 0xd2,
-    0x03, 0x09, 0x03, 0x07, 0x1a, 0x31, 0x29, 0x2d, 0x44, 0x31, 0x22, 0x15, 0x0d, 0x04, 0x03, 0x03, 0x08, 0x03, 0x08,
-    0x1a, 0x32, 0x29, 0x2d, 0x44, 0x30, 0x21, 0x16, 0x0c, 0x04, 0x02, 0x6f, 0x35, 0x71, 0x6c, 0x60, 0x47, 0x29, 0x02,
-    0x02, 0x36, 0x57, 0x70, 0x79, 0x79, 0x35, 0x16, 0x3a, 0x80, 0x7c, 0x70, 0x54, 0x2f, 0x02, 0x03, 0x61, 0x92, 0xaa,
-    0x4c, 0x01, 0xfe, 0x29, 0x04, 0x3a, 0xfd, 0xd2, 0x19, 0x4d, 0x57, 0x57, 0x48, 0x2e, 0x02, 0x02, 0x29, 0x44, 0x58,
-    0x5b, 0x55, 0x20, 0x15, 0x19, 0x4e, 0x57, 0x59, 0x49, 0x2e, 0x02, 0x02, 0x2a, 0x45, 0x58, 0x5c, 0x56, 0x1f, 0x00,
-    0x00, 0x00, 0x02, 0xff, 0xde, 0x00, 0x00, 0x04, 0x56, 0x04, 0x3b, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x33, 0x40, 0x30,
-    0x07, 0x01, 0x01, 0x04, 0x01, 0x4a, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x61, 0x00, 0x05, 0x05, 0x03, 0x5b,
-    0x06, 0x01, 0x03, 0x03, 0x18, 0x4b, 0x02, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x00, 0x00, 0x19, 0x17, 0x16, 0x14,
-    0x00, 0x0f, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x07, 0x06, 0x17, 0x2b, 0x01, 0x03, 0x23, 0x13, 0x21, 0x01, 0x23, 0x01,
-    0x26, 0x26, 0x37, 0x3e, 0x03, 0x33, 0x01, 0x06, 0x1e, 0x02, 0x17, 0x05, 0x13, 0x25, 0x0e, 0x03, 0x04, 0x56, 0xbc,
-    0xb5, 0x4a, 0xfe, 0xc1, 0xfe, 0xbd, 0xcf, 0x01, 0x60, 0x56, 0x50, 0x06, 0x06, 0x52, 0x7d, 0x9b, 0x4f, 0xfe, 0xf6,
-    0x05, 0x13, 0x2b, 0x3e, 0x25, 0x01, 0x5a, 0x3e, 0xfe, 0xd1, 0x2c, 0x58, 0x48, 0x32, 0x04, 0x3a, 0xfb, 0xc6, 0x01,
-    0xa5, 0xfe, 0x5b, 0x01, 0xc5, 0x2a, 0x9c, 0x5d, 0x58, 0x80, 0x53, 0x28, 0xfe, 0xab, 0x27, 0x3d, 0x2a, 0x18, 0x02,
-    0x01, 0x01, 0x67, 0x01, 0x01, 0x17, 0x2f, 0x47, 0x00, 0x00, 0x01, 0x00, 0x38, 0xfe, 0x47, 0x04, 0x18, 0x06, 0x00,
-    0x00, 0x37, 0x00, 0x7f, 0x40, 0x0e, 0x02, 0x01, 0x05, 0x04, 0x18, 0x01, 0x03, 0x05, 0x17, 0x01, 0x02, 0x03, 0x03,
-    0x4a, 0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40, 0x2a, 0x00, 0x08, 0x07, 0x07, 0x08, 0x66, 0x09, 0x01, 0x07, 0x06, 0x01,
-    0x00, 0x01, 0x07, 0x00, 0x62, 0x00, 0x04, 0x04, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x1f, 0x4b, 0x00, 0x05, 0x05, 0x17,
-    0x4b, 0x00, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x21, 0x02, 0x4c, 0x1b, 0x40, 0x29, 0x00, 0x08, 0x07, 0x08,
-    0x72, 0x09, 0x01, 0x07, 0x06, 0x01, 0x00, 0x01, 0x07, 0x00, 0x62, 0x00, 0x04, 0x04, 0x01, 0x5b, 0x00, 0x01, 0x01,
-    0x1f, 0x4b, 0x00, 0x05, 0x05, 0x17, 0x4b, 0x00, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x21, 0x02, 0x4c, 0x59,
-    0x40, 0x0e, 0x37, 0x36, 0x11, 0x11, 0x11, 0x15, 0x2b, 0x25, 0x2b, 0x25, 0x10, 0x0a, 0x06, 0x1d, 0x2b, 0x01, 0x21,
-    0x03, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x07, 0x33, 0x03, 0x0e, 0x03, 0x27, 0x26, 0x26, 0x27, 0x37, 0x16, 0x16,
-    0x33, 0x32, 0x3e, 0x02, 0x37, 0x37, 0x23, 0x13, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x03, 0x23, 0x13,
-    0x23, 0x37, 0x33, 0x37, 0x33, 0x07, 0x21, 0x02, 0xbd, 0xfe, 0xfd, 0x36, 0x21, 0x4d, 0x57, 0x61, 0x36, 0x5c, 0x7c,
-    0x48, 0x18, 0x09, 0x26, 0x04, 0x5a, 0x0a, 0x37, 0x5b, 0x7f, 0x51, 0x20, 0x3b, 0x1e, 0x1e, 0x18, 0x33, 0x1a, 0x29,
-    0x3c, 0x29, 0x18, 0x06, 0x0f, 0x04, 0x73, 0x06, 0x0c, 0x2c, 0x4d, 0x3b, 0x2e, 0x53, 0x4b, 0x43, 0x1c, 0x89, 0xb5,
-    0xd2, 0xb8, 0x1b, 0xb7, 0x1f, 0xb5, 0x21, 0x01, 0x01, 0x04, 0xb9, 0xfe, 0xdf, 0x28, 0x44, 0x30, 0x1b, 0x01, 0x02,
-    0x46, 0x74, 0x97, 0x52, 0xe3, 0xfd, 0xe1, 0x4c, 0x81, 0x5e, 0x35, 0x01, 0x01, 0x0a, 0x09, 0x93, 0x08, 0x08, 0x24,
-    0x39, 0x47, 0x24, 0x59, 0x02, 0xac, 0x35, 0x5d, 0x47, 0x29, 0x02, 0x01, 0x17, 0x2b, 0x3a, 0x22, 0xfc, 0xed, 0x04,
-    0xb9, 0x97, 0xb0, 0xb0, 0x00, 0x00, 0x01, 0x00, 0x75, 0xff, 0xe9, 0x04, 0x2c, 0x04, 0x50, 0x00, 0x2f, 0x00, 0x48,
-    0x40, 0x45, 0x00, 0x04, 0x05, 0x06, 0x05, 0x04, 0x06, 0x70, 0x00, 0x01, 0x07, 0x00, 0x07, 0x01, 0x00, 0x70, 0x00,
-    0x06, 0x00, 0x07, 0x01, 0x06, 0x07, 0x61, 0x00, 0x05, 0x05, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x1f, 0x4b, 0x08, 0x01,
-    0x00, 0x00, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x20, 0x02, 0x4c, 0x01, 0x00, 0x2b, 0x2a, 0x29, 0x28, 0x24, 0x22, 0x1e,
-    0x1d, 0x19, 0x17, 0x0c, 0x0a, 0x06, 0x05, 0x00, 0x2f, 0x01, 0x2f, 0x09, 0x06, 0x14, 0x2b, 0x25, 0x16, 0x3e, 0x02,
-    0x37, 0x37, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x37, 0x3e, 0x05, 0x17, 0x1e, 0x03, 0x07, 0x27, 0x36, 0x2e, 0x02,
-    0x27, 0x26, 0x0e, 0x02, 0x07, 0x21, 0x07, 0x21, 0x06, 0x1e, 0x02, 0x02, 0x15, 0x31, 0x60, 0x4f, 0x38, 0x0b, 0xab,
-    0x09, 0x5a, 0x84, 0xa0, 0x4f, 0x72, 0xa0, 0x62, 0x24, 0x0a, 0x05, 0x09, 0x2e, 0x47, 0x5f, 0x76, 0x8a, 0x4e, 0x54,
-    0x8e, 0x65, 0x36, 0x04, 0xaa, 0x02, 0x1c, 0x39, 0x52, 0x34, 0x4b, 0x76, 0x59, 0x3a, 0x0f, 0x01, 0x91, 0x1b, 0xfe,
-    0x76, 0x03, 0x12, 0x35, 0x5c, 0x81, 0x01, 0x1d, 0x37, 0x4f, 0x31, 0x01, 0x53, 0x87, 0x5f, 0x33, 0x02, 0x03, 0x5c,
-    0x95, 0xc0, 0x66, 0x2b, 0x49, 0x8a, 0x7a, 0x65, 0x48, 0x26, 0x02, 0x02, 0x3c, 0x67, 0x8f, 0x55, 0x01, 0x32, 0x56,
-    0x41, 0x26, 0x02, 0x02, 0x37, 0x5e, 0x7a, 0x42, 0x98, 0x3c, 0x76, 0x5f, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff,
-    0xc4, 0xff, 0xfd, 0x04, 0x63, 0x04, 0x3a, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x3a, 0x40, 0x37, 0x00, 0x00, 0x09, 0x01,
-    0x07, 0x04, 0x00, 0x07, 0x63, 0x00, 0x02, 0x02, 0x05, 0x59, 0x08, 0x01, 0x05, 0x05, 0x18, 0x4b, 0x06, 0x01, 0x04,
-    0x04, 0x01, 0x5b, 0x03, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x23, 0x23, 0x00, 0x00, 0x23, 0x2d, 0x23, 0x2c, 0x26,
-    0x24, 0x00, 0x22, 0x00, 0x22, 0x21, 0x27, 0x11, 0x28, 0x21, 0x0a, 0x06, 0x19, 0x2b, 0x01, 0x03, 0x17, 0x1e, 0x03,
-    0x07, 0x0e, 0x03, 0x27, 0x21, 0x13, 0x23, 0x03, 0x0e, 0x05, 0x27, 0x23, 0x37, 0x33, 0x32, 0x3e, 0x04, 0x37, 0x13,
-    0x01, 0x03, 0x33, 0x3e, 0x03, 0x37, 0x36, 0x26, 0x27, 0x03, 0x45, 0x4a, 0x37, 0x47, 0x73, 0x50, 0x27, 0x04, 0x05,
-    0x42, 0x6a, 0x8b, 0x4e, 0xff, 0x00, 0xa1, 0xbb, 0x35, 0x09, 0x17, 0x25, 0x38, 0x53, 0x73, 0x4e, 0x31, 0x13, 0x1b,
-    0x2f, 0x44, 0x2f, 0x1d, 0x13, 0x0a, 0x05, 0x4e, 0x01, 0xc8, 0x47, 0x39, 0x2b, 0x48, 0x35, 0x21, 0x05, 0x09, 0x3b,
-    0x4a, 0x04, 0x3a, 0xfe, 0x63, 0x01, 0x02, 0x30, 0x54, 0x75, 0x48, 0x51, 0x81, 0x59, 0x2f, 0x01, 0x03, 0xa1, 0xfe,
-    0xca, 0x3a, 0x8a, 0x8b, 0x82, 0x63, 0x3a, 0x03, 0x9a, 0x34, 0x52, 0x66, 0x67, 0x5e, 0x20, 0x01, 0xcf, 0xfd, 0xcd,
-    0xfe, 0x8c, 0x01, 0x20, 0x36, 0x47, 0x2a, 0x46, 0x5f, 0x05, 0x00, 0x00, 0x02, 0x00, 0x15, 0xff, 0xff, 0x04, 0x46,
-    0x04, 0x3a, 0x00, 0x16, 0x00, 0x23, 0x00, 0x31, 0x40, 0x2e, 0x02, 0x01, 0x00, 0x09, 0x08, 0x02, 0x04, 0x07, 0x00,
-    0x04, 0x64, 0x06, 0x01, 0x01, 0x01, 0x18, 0x4b, 0x00, 0x07, 0x07, 0x03, 0x5b, 0x05, 0x01, 0x03, 0x03, 0x17, 0x03,
-    0x4c, 0x17, 0x17, 0x17, 0x23, 0x17, 0x22, 0x22, 0x11, 0x11, 0x11, 0x28, 0x21, 0x11, 0x10, 0x0a, 0x06, 0x1c, 0x2b,
-    0x01, 0x33, 0x13, 0x33, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x27, 0x21, 0x13, 0x23, 0x03, 0x23, 0x13, 0x33,
-    0x01, 0x03, 0x17, 0x3e, 0x03, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x01, 0x3f, 0xf0, 0x48, 0xb4, 0x48, 0x44, 0x46, 0x6d,
-    0x49, 0x23, 0x04, 0x05, 0x3d, 0x63, 0x84, 0x4e, 0xfe, 0xf0, 0x5a, 0xf0, 0x5b, 0xb5, 0xbc, 0xb5, 0x01, 0x43, 0x40,
-    0x46, 0x2a, 0x41, 0x30, 0x1e, 0x05, 0x04, 0x06, 0x18, 0x2c, 0x23, 0x02, 0xa1, 0x01, 0x99, 0xfe, 0x63, 0x02, 0x03,
-    0x31, 0x55, 0x74, 0x45, 0x4e, 0x80, 0x5b, 0x31, 0x01, 0x02, 0x0a, 0xfd, 0xf6, 0x04, 0x3a, 0xfd, 0xcc, 0xfe, 0x8f,
-    0x02, 0x02, 0x22, 0x36, 0x47, 0x27, 0x1e, 0x3b, 0x30, 0x1f, 0x02, 0x00, 0x00, 0x01, 0x00, 0x3f, 0x00, 0x00, 0x04,
-    0x1f, 0x06, 0x00, 0x00, 0x23, 0x00, 0x62, 0xb5, 0x02, 0x01, 0x02, 0x03, 0x01, 0x4a, 0x4b, 0xb0, 0x0f, 0x50, 0x58,
-    0x40, 0x21, 0x00, 0x07, 0x06, 0x06, 0x07, 0x66, 0x08, 0x01, 0x06, 0x05, 0x01, 0x00, 0x01, 0x06, 0x00, 0x62, 0x00,
-    0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x1f, 0x4b, 0x04, 0x01, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x1b, 0x40, 0x20,
-    0x00, 0x07, 0x06, 0x07, 0x72, 0x08, 0x01, 0x06, 0x05, 0x01, 0x00, 0x01, 0x06, 0x00, 0x62, 0x00, 0x03, 0x03, 0x01,
-    0x5b, 0x00, 0x01, 0x01, 0x1f, 0x4b, 0x04, 0x01, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x59, 0x40, 0x0c, 0x11, 0x11, 0x11,
-    0x11, 0x15, 0x25, 0x15, 0x25, 0x10, 0x09, 0x06, 0x1d, 0x2b, 0x01, 0x21, 0x03, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07,
-    0x03, 0x23, 0x13, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x03, 0x23, 0x13, 0x23, 0x37, 0x33, 0x37, 0x33,
-    0x07, 0x21, 0x02, 0xf0, 0xfe, 0xd2, 0x37, 0x21, 0x4d, 0x57, 0x61, 0x36, 0x5c, 0x7c, 0x48, 0x18, 0x09, 0x72, 0xb5,
-    0x73, 0x06, 0x0c, 0x2c, 0x4d, 0x3b, 0x2e, 0x53, 0x4b, 0x43, 0x1c, 0x89, 0xb5, 0xd3, 0x8d, 0x1b, 0x8c, 0x1e, 0xb5,
-    0x20, 0x01, 0x2c, 0x04, 0xbe, 0xfe, 0xda, 0x28, 0x44, 0x30, 0x1b, 0x01, 0x02, 0x46, 0x74, 0x97, 0x52, 0xfd, 0x57,
-    0x02, 0xac, 0x35, 0x5d, 0x47, 0x29, 0x02, 0x01, 0x17, 0x2b, 0x3a, 0x22, 0xfc, 0xed, 0x04, 0xbe, 0x97, 0xab, 0xab,
-    0x00, 0x01, 0x00, 0x38, 0xfe, 0x9c, 0x04, 0x5c, 0x04, 0x3a, 0x00, 0x0b, 0x00, 0x29, 0x40, 0x26, 0x00, 0x03, 0x02,
-    0x03, 0x73, 0x06, 0x05, 0x02, 0x01, 0x01, 0x18, 0x4b, 0x00, 0x00, 0x00, 0x02, 0x59, 0x04, 0x01, 0x02, 0x02, 0x17,
-    0x02, 0x4c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x07, 0x06, 0x19, 0x2b, 0x01, 0x03,
-    0x21, 0x13, 0x33, 0x03, 0x21, 0x03, 0x23, 0x13, 0x21, 0x13, 0x01, 0xa8, 0xa2, 0x01, 0xff, 0xa2, 0xb5, 0xbc, 0xfe,
-    0xa9, 0x3e, 0xb5, 0x3e, 0xfe, 0xa4, 0xbb, 0x04, 0x3a, 0xfc, 0x5d, 0x03, 0xa3, 0xfb, 0xc6, 0xfe, 0x9c, 0x01, 0x64,
-    0x04, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x35, 0xff, 0xea, 0x04, 0xf1, 0x05, 0xb0, 0x00, 0x2e, 0x00, 0x2d,
-    0x40, 0x2a, 0x09, 0x01, 0x00, 0x03, 0x01, 0x4a, 0x07, 0x06, 0x04, 0x03, 0x02, 0x02, 0x16, 0x4b, 0x05, 0x01, 0x03,
-    0x03, 0x00, 0x5c, 0x01, 0x01, 0x00, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x2e, 0x25, 0x15, 0x25,
-    0x15, 0x26, 0x25, 0x08, 0x06, 0x1a, 0x2b, 0x01, 0x03, 0x0e, 0x03, 0x27, 0x26, 0x26, 0x27, 0x0e, 0x03, 0x27, 0x2e,
-    0x03, 0x37, 0x13, 0x33, 0x03, 0x06, 0x06, 0x16, 0x16, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x13, 0x33, 0x03, 0x06, 0x1e,
-    0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x13, 0x04, 0xf1, 0xc0, 0x09, 0x31, 0x52, 0x74, 0x4c, 0x4a, 0x69, 0x15, 0x15,
-    0x31, 0x3a, 0x45, 0x28, 0x47, 0x63, 0x3b, 0x16, 0x06, 0xc2, 0xb3, 0xbe, 0x02, 0x01, 0x0d, 0x23, 0x21, 0x26, 0x36,
-    0x24, 0x15, 0x04, 0xc1, 0xbb, 0xc1, 0x03, 0x03, 0x13, 0x2a, 0x25, 0x24, 0x30, 0x1f, 0x10, 0x04, 0xc0, 0x05, 0xb0,
-    0xfb, 0x90, 0x45, 0x7c, 0x5f, 0x36, 0x02, 0x02, 0x49, 0x47, 0x20, 0x37, 0x27, 0x15, 0x01, 0x01, 0x3a, 0x5f, 0x79,
-    0x3f, 0x04, 0x72, 0xfb, 0x8d, 0x17, 0x3f, 0x3a, 0x2a, 0x01, 0x02, 0x24, 0x39, 0x44, 0x1e, 0x04, 0x71, 0xfb, 0x8d,
-    0x1b, 0x41, 0x39, 0x27, 0x26, 0x3a, 0x42, 0x1c, 0x04, 0x71, 0x00, 0x00, 0x01, 0x00, 0x29, 0xff, 0xe9, 0x04, 0xad,
-    0x04, 0x3b, 0x00, 0x2e, 0x00, 0x2d, 0x40, 0x2a, 0x09, 0x01, 0x00, 0x03, 0x01, 0x4a, 0x07, 0x06, 0x04, 0x03, 0x02,
-    0x02, 0x18, 0x4b, 0x05, 0x01, 0x03, 0x03, 0x00, 0x5c, 0x01, 0x01, 0x00, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x00, 0x00,
-    0x2e, 0x00, 0x2e, 0x25, 0x15, 0x25, 0x15, 0x26, 0x25, 0x08, 0x06, 0x1a, 0x2b, 0x01, 0x03, 0x0e, 0x03, 0x27, 0x26,
-    0x26, 0x27, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x13, 0x33, 0x03, 0x06, 0x06, 0x16, 0x16, 0x17, 0x16, 0x3e, 0x02,
-    0x37, 0x13, 0x33, 0x03, 0x06, 0x1e, 0x02, 0x33, 0x16, 0x3e, 0x02, 0x37, 0x13, 0x04, 0xad, 0x81, 0x09, 0x32, 0x53,
-    0x74, 0x4c, 0x49, 0x6b, 0x16, 0x15, 0x31, 0x3b, 0x45, 0x28, 0x47, 0x64, 0x3c, 0x16, 0x06, 0x82, 0xb4, 0x7f, 0x02,
-    0x01, 0x0e, 0x23, 0x22, 0x25, 0x37, 0x24, 0x15, 0x05, 0x81, 0xba, 0x7e, 0x03, 0x03, 0x13, 0x2a, 0x24, 0x24, 0x31,
-    0x1f, 0x12, 0x04, 0x80, 0x04, 0x3b, 0xfd, 0x02, 0x45, 0x7d, 0x5d, 0x35, 0x02, 0x02, 0x4a, 0x46, 0x21, 0x36, 0x27,
-    0x15, 0x01, 0x01, 0x3a, 0x5d, 0x78, 0x3f, 0x03, 0x01, 0xfd, 0x00, 0x18, 0x3f, 0x39, 0x29, 0x01, 0x02, 0x23, 0x37,
-    0x43, 0x1f, 0x03, 0x00, 0xfd, 0x00, 0x1b, 0x41, 0x38, 0x26, 0x01, 0x25, 0x39, 0x41, 0x1c, 0x03, 0x00, 0x00, 0x02,
-    0x00, 0x6d, 0xff, 0xff, 0x03, 0xf3, 0x06, 0x18, 0x00, 0x16, 0x00, 0x23, 0x00, 0x37, 0x40, 0x34, 0x00, 0x05, 0x04,
-    0x05, 0x72, 0x06, 0x01, 0x04, 0x03, 0x01, 0x00, 0x01, 0x04, 0x00, 0x62, 0x00, 0x01, 0x09, 0x01, 0x08, 0x07, 0x01,
-    0x08, 0x63, 0x00, 0x07, 0x07, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x17, 0x17, 0x17, 0x23, 0x17, 0x22,
-    0x22, 0x11, 0x11, 0x11, 0x11, 0x28, 0x21, 0x10, 0x0a, 0x06, 0x1c, 0x2b, 0x01, 0x21, 0x03, 0x17, 0x1e, 0x03, 0x07,
-    0x0e, 0x03, 0x27, 0x21, 0x13, 0x23, 0x37, 0x33, 0x13, 0x33, 0x03, 0x21, 0x01, 0x03, 0x05, 0x3e, 0x03, 0x37, 0x36,
-    0x2e, 0x02, 0x27, 0x03, 0x14, 0xfe, 0xc8, 0x46, 0xfe, 0x49, 0x82, 0x60, 0x34, 0x05, 0x06, 0x4e, 0x79, 0x99, 0x50,
-    0xfe, 0x35, 0xbb, 0xbb, 0x1b, 0xba, 0x3a, 0xb4, 0x3a, 0x01, 0x39, 0xfe, 0x4d, 0x40, 0x01, 0x00, 0x2d, 0x55, 0x45,
-    0x2f, 0x06, 0x06, 0x15, 0x2e, 0x42, 0x28, 0x04, 0x34, 0xfe, 0x6c, 0x01, 0x02, 0x2b, 0x51, 0x77, 0x4f, 0x57, 0x83,
-    0x57, 0x2b, 0x01, 0x04, 0x34, 0x98, 0x01, 0x4c, 0xfe, 0xb4, 0xfd, 0x3d, 0xfe, 0x8e, 0x02, 0x01, 0x17, 0x2f, 0x48,
-    0x30, 0x2a, 0x41, 0x2e, 0x19, 0x02, 0x00, 0x00, 0x01, 0x00, 0x11, 0xff, 0xe9, 0x04, 0xc1, 0x05, 0xc7, 0x00, 0x41,
-    0x00, 0x8a, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x31, 0x00, 0x02, 0x03, 0x00, 0x03, 0x02, 0x00, 0x70, 0x00, 0x07,
-    0x05, 0x06, 0x05, 0x07, 0x06, 0x70, 0x04, 0x01, 0x00, 0x09, 0x01, 0x05, 0x07, 0x00, 0x05, 0x62, 0x00, 0x03, 0x03,
-    0x01, 0x5b, 0x0b, 0x01, 0x01, 0x01, 0x1d, 0x4b, 0x00, 0x06, 0x06, 0x08, 0x5b, 0x0a, 0x01, 0x08, 0x08, 0x20, 0x08,
-    0x4c, 0x1b, 0x40, 0x39, 0x00, 0x02, 0x03, 0x00, 0x03, 0x02, 0x00, 0x70, 0x00, 0x07, 0x05, 0x06, 0x05, 0x07, 0x06,
-    0x70, 0x04, 0x01, 0x00, 0x09, 0x01, 0x05, 0x07, 0x00, 0x05, 0x62, 0x00, 0x0b, 0x0b, 0x16, 0x4b, 0x00, 0x03, 0x03,
-    0x01, 0x5b, 0x00, 0x01, 0x01, 0x1d, 0x4b, 0x00, 0x0a, 0x0a, 0x17, 0x4b, 0x00, 0x06, 0x06, 0x08, 0x5b, 0x00, 0x08,
-    0x08, 0x20, 0x08, 0x4c, 0x59, 0x40, 0x12, 0x41, 0x40, 0x3f, 0x3e, 0x3d, 0x3c, 0x24, 0x14, 0x27, 0x11, 0x17, 0x24,
-    0x16, 0x27, 0x10, 0x0c, 0x06, 0x1d, 0x2b, 0x01, 0x33, 0x37, 0x3e, 0x05, 0x17, 0x1e, 0x05, 0x15, 0x27, 0x36, 0x2e,
-    0x02, 0x27, 0x26, 0x0e, 0x04, 0x07, 0x07, 0x21, 0x07, 0x21, 0x07, 0x0e, 0x02, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02,
-    0x37, 0x37, 0x0e, 0x03, 0x27, 0x2e, 0x04, 0x36, 0x37, 0x37, 0x23, 0x03, 0x23, 0x13, 0x33, 0x01, 0x54, 0x91, 0x0f,
-    0x09, 0x1e, 0x31, 0x43, 0x5b, 0x75, 0x4a, 0x39, 0x57, 0x3f, 0x28, 0x18, 0x09, 0xa3, 0x01, 0x04, 0x18, 0x36, 0x32,
-    0x2e, 0x45, 0x33, 0x22, 0x18, 0x0e, 0x05, 0x0f, 0x01, 0x13, 0x1b, 0xfe, 0xef, 0x18, 0x03, 0x09, 0x02, 0x08, 0x1a,
-    0x32, 0x29, 0x36, 0x48, 0x2f, 0x1b, 0x0a, 0xa1, 0x0e, 0x39, 0x5d, 0x83, 0x58, 0x46, 0x64, 0x43, 0x25, 0x10, 0x03,
-    0x07, 0x18, 0x90, 0x77, 0xb3, 0xfc, 0xb4, 0x03, 0x40, 0x63, 0x3b, 0x81, 0x7a, 0x6e, 0x52, 0x2e, 0x02, 0x02, 0x25,
-    0x3d, 0x51, 0x5d, 0x63, 0x30, 0x01, 0x25, 0x5b, 0x52, 0x39, 0x02, 0x02, 0x26, 0x42, 0x55, 0x59, 0x55, 0x20, 0x65,
-    0x97, 0x9c, 0x19, 0x4d, 0x56, 0x58, 0x47, 0x2e, 0x02, 0x03, 0x32, 0x4f, 0x5e, 0x2a, 0x01, 0x4b, 0x96, 0x77, 0x48,
-    0x03, 0x02, 0x35, 0x56, 0x6e, 0x78, 0x79, 0x36, 0x9b, 0xfd, 0x57, 0x05, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x2e, 0xff, 0xe9, 0x04, 0x84, 0x04, 0x50, 0x00, 0x3b, 0x00, 0xc8, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x31, 0x00,
-    0x09, 0x0a, 0x07, 0x0a, 0x09, 0x07, 0x70, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x70, 0x0b, 0x01, 0x07, 0x04,
-    0x01, 0x00, 0x02, 0x07, 0x00, 0x62, 0x00, 0x0a, 0x0a, 0x06, 0x5b, 0x08, 0x01, 0x06, 0x06, 0x18, 0x4b, 0x00, 0x01,
-    0x01, 0x03, 0x5b, 0x05, 0x01, 0x03, 0x03, 0x1e, 0x03, 0x4c, 0x1b, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x35, 0x00,
-    0x09, 0x0a, 0x07, 0x0a, 0x09, 0x07, 0x70, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x70, 0x0b, 0x01, 0x07, 0x04,
-    0x01, 0x00, 0x02, 0x07, 0x00, 0x62, 0x00, 0x0a, 0x0a, 0x06, 0x5b, 0x08, 0x01, 0x06, 0x06, 0x18, 0x4b, 0x00, 0x05,
-    0x05, 0x17, 0x4b, 0x00, 0x01, 0x01, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x1e, 0x03, 0x4c, 0x1b, 0x40, 0x39, 0x00, 0x09,
-    0x0a, 0x07, 0x0a, 0x09, 0x07, 0x70, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x70, 0x0b, 0x01, 0x07, 0x04, 0x01,
-    0x00, 0x02, 0x07, 0x00, 0x62, 0x00, 0x06, 0x06, 0x18, 0x4b, 0x00, 0x0a, 0x0a, 0x08, 0x5b, 0x00, 0x08, 0x08, 0x1f,
-    0x4b, 0x00, 0x05, 0x05, 0x17, 0x4b, 0x00, 0x01, 0x01, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x1e, 0x03, 0x4c, 0x59, 0x59,
-    0x40, 0x12, 0x3b, 0x3a, 0x34, 0x32, 0x2e, 0x2d, 0x26, 0x11, 0x11, 0x11, 0x16, 0x24, 0x14, 0x26, 0x10, 0x0c, 0x06,
-    0x1d, 0x2b, 0x01, 0x21, 0x06, 0x06, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x37, 0x0e, 0x03, 0x27, 0x2e, 0x05,
-    0x37, 0x07, 0x03, 0x23, 0x13, 0x33, 0x03, 0x33, 0x3e, 0x05, 0x17, 0x1e, 0x03, 0x07, 0x27, 0x36, 0x2e, 0x02, 0x27,
-    0x26, 0x0e, 0x04, 0x07, 0x21, 0x03, 0x93, 0xfe, 0xe1, 0x03, 0x05, 0x01, 0x0c, 0x1b, 0x2f, 0x25, 0x24, 0x35, 0x26,
-    0x19, 0x06, 0xa9, 0x06, 0x38, 0x5a, 0x75, 0x44, 0x3f, 0x5f, 0x44, 0x2a, 0x14, 0x01, 0x07, 0x91, 0x50, 0xb5, 0xbc,
-    0xb5, 0x52, 0x83, 0x0c, 0x23, 0x31, 0x42, 0x57, 0x6c, 0x44, 0x48, 0x67, 0x41, 0x1b, 0x03, 0xab, 0x01, 0x04, 0x16,
-    0x2c, 0x26, 0x28, 0x3d, 0x30, 0x22, 0x19, 0x11, 0x06, 0x01, 0x2a, 0x01, 0xd0, 0x17, 0x43, 0x4a, 0x4a, 0x3c, 0x26,
-    0x20, 0x33, 0x3e, 0x1e, 0x01, 0x40, 0x77, 0x5a, 0x36, 0x02, 0x01, 0x2d, 0x4a, 0x61, 0x6b, 0x6f, 0x33, 0x01, 0xfe,
-    0x30, 0x04, 0x3a, 0xfe, 0x2d, 0x37, 0x74, 0x6d, 0x62, 0x47, 0x28, 0x02, 0x03, 0x3f, 0x64, 0x7e, 0x40, 0x01, 0x1c,
-    0x46, 0x3d, 0x2b, 0x02, 0x02, 0x20, 0x38, 0x48, 0x4c, 0x4a, 0x1c, 0x00, 0x00, 0x02, 0xff, 0xb9, 0x00, 0x00, 0x04,
-    0x23, 0x05, 0xb0, 0x00, 0x0b, 0x00, 0x0e, 0x00, 0x29, 0x40, 0x26, 0x0e, 0x01, 0x06, 0x04, 0x01, 0x4a, 0x00, 0x06,
-    0x02, 0x01, 0x00, 0x01, 0x06, 0x00, 0x62, 0x00, 0x04, 0x04, 0x16, 0x4b, 0x05, 0x03, 0x02, 0x01, 0x01, 0x17, 0x01,
-    0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x01, 0x23, 0x03, 0x23, 0x13, 0x23, 0x03,
-    0x23, 0x01, 0x33, 0x13, 0x23, 0x01, 0x21, 0x03, 0x03, 0x33, 0x9f, 0x4d, 0xb4, 0x4d, 0x8b, 0xdc, 0xc0, 0x02, 0xe8,
-    0x9c, 0xe6, 0xb1, 0xfe, 0x32, 0x01, 0x77, 0x54, 0x01, 0xb8, 0xfe, 0x48, 0x01, 0xb8, 0xfe, 0x48, 0x05, 0xb0, 0xfa,
-    0x50, 0x02, 0x59, 0x02, 0x49, 0x00, 0x00, 0x02, 0xff, 0xe7, 0x00, 0x00, 0x03, 0xf3, 0x04, 0x3a, 0x00, 0x0b, 0x00,
-    0x10, 0x00, 0x29, 0x40, 0x26, 0x0f, 0x01, 0x06, 0x04, 0x01, 0x4a, 0x00, 0x06, 0x02, 0x01, 0x00, 0x01, 0x06, 0x00,
-    0x62, 0x00, 0x04, 0x04, 0x18, 0x4b, 0x05, 0x03, 0x02, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x01, 0x23, 0x03, 0x23, 0x13, 0x23, 0x03, 0x23, 0x01, 0x33, 0x13, 0x23, 0x01,
-    0x21, 0x03, 0x27, 0x07, 0x03, 0x00, 0x7f, 0x34, 0xb5, 0x35, 0x7e, 0xa7, 0xc1, 0x02, 0x73, 0x9b, 0xfe, 0xb1, 0xfe,
-    0x62, 0x01, 0x3a, 0x4d, 0x07, 0x2a, 0x01, 0x29, 0xfe, 0xd7, 0x01, 0x29, 0xfe, 0xd7, 0x04, 0x3a, 0xfb, 0xc6, 0x01,
-    0xc1, 0x01, 0x61, 0x45, 0x57, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x00, 0x00, 0x04, 0x2d, 0x05, 0xb0, 0x00,
-    0x13, 0x00, 0x16, 0x00, 0x33, 0x40, 0x30, 0x16, 0x01, 0x07, 0x06, 0x01, 0x4a, 0x0a, 0x01, 0x07, 0x04, 0x02, 0x02,
-    0x00, 0x01, 0x07, 0x00, 0x62, 0x08, 0x01, 0x06, 0x06, 0x16, 0x4b, 0x09, 0x05, 0x03, 0x03, 0x01, 0x01, 0x17, 0x01,
-    0x4c, 0x15, 0x14, 0x13, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0b, 0x06, 0x1d, 0x2b, 0x01,
-    0x23, 0x03, 0x23, 0x13, 0x23, 0x03, 0x23, 0x13, 0x23, 0x03, 0x23, 0x13, 0x33, 0x03, 0x33, 0x01, 0x33, 0x13, 0x23,
-    0x03, 0x33, 0x03, 0x03, 0x73, 0x44, 0x55, 0x91, 0x56, 0x42, 0xb8, 0xbe, 0xc3, 0x9f, 0x51, 0xb5, 0xfd, 0xb5, 0x90,
-    0xc6, 0x01, 0x5a, 0x9c, 0x4a, 0xad, 0xe7, 0xd3, 0x0b, 0x01, 0xd5, 0xfe, 0x2b, 0x01, 0xd5, 0xfe, 0x2b, 0x01, 0xd4,
-    0xfe, 0x2c, 0x05, 0xb0, 0xfc, 0xc5, 0x03, 0x3b, 0xfa, 0x50, 0x02, 0x75, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04,
-    0x00, 0x00, 0x04, 0x2d, 0x04, 0x3a, 0x00, 0x13, 0x00, 0x16, 0x00, 0x33, 0x40, 0x30, 0x16, 0x01, 0x07, 0x06, 0x01,
-    0x4a, 0x0a, 0x01, 0x07, 0x04, 0x02, 0x02, 0x00, 0x01, 0x07, 0x00, 0x62, 0x08, 0x01, 0x06, 0x06, 0x18, 0x4b, 0x09,
-    0x05, 0x03, 0x03, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x15, 0x14, 0x13, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x10, 0x0b, 0x06, 0x1d, 0x2b, 0x01, 0x27, 0x03, 0x23, 0x13, 0x23, 0x03, 0x23, 0x13, 0x23, 0x03, 0x23, 0x13,
-    0x33, 0x03, 0x33, 0x01, 0x33, 0x13, 0x23, 0x01, 0x33, 0x03, 0x03, 0x5f, 0x46, 0x38, 0x99, 0x34, 0x48, 0x8e, 0xc0,
-    0x94, 0x8e, 0x33, 0xb5, 0xbc, 0xb5, 0x6e, 0xc2, 0x01, 0x3c, 0x9c, 0x8c, 0xac, 0xfe, 0xff, 0xcc, 0x25, 0x01, 0x25,
-    0x01, 0xfe, 0xda, 0x01, 0x25, 0xfe, 0xdb, 0x01, 0x25, 0xfe, 0xdb, 0x04, 0x3a, 0xfd, 0x8c, 0x02, 0x74, 0xfb, 0xc6,
-    0x01, 0xc6, 0x01, 0x59, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xeb, 0x00, 0x00, 0x04, 0xca, 0x05, 0xb0, 0x00, 0x22,
-    0x00, 0x25, 0x00, 0x38, 0x40, 0x35, 0x1a, 0x01, 0x03, 0x04, 0x01, 0x4a, 0x02, 0x01, 0x00, 0x06, 0x01, 0x04, 0x03,
-    0x00, 0x04, 0x63, 0x00, 0x08, 0x08, 0x01, 0x59, 0x00, 0x01, 0x01, 0x16, 0x4b, 0x09, 0x07, 0x05, 0x03, 0x03, 0x03,
-    0x17, 0x03, 0x4c, 0x00, 0x00, 0x25, 0x24, 0x00, 0x22, 0x00, 0x22, 0x13, 0x12, 0x25, 0x15, 0x11, 0x12, 0x13, 0x0a,
-    0x06, 0x1b, 0x2b, 0x23, 0x13, 0x36, 0x36, 0x37, 0x33, 0x03, 0x21, 0x01, 0x1e, 0x03, 0x07, 0x03, 0x23, 0x13, 0x36,
-    0x2e, 0x02, 0x27, 0x27, 0x07, 0x03, 0x23, 0x13, 0x27, 0x27, 0x22, 0x0e, 0x02, 0x07, 0x03, 0x01, 0x01, 0x21, 0x15,
-    0x45, 0x17, 0xcd, 0xb7, 0x0a, 0xcd, 0x03, 0xc2, 0xfe, 0x59, 0x52, 0x75, 0x46, 0x19, 0x08, 0x46, 0xb5, 0x47, 0x05,
-    0x02, 0x18, 0x36, 0x2f, 0x46, 0x0f, 0x6f, 0xb5, 0x76, 0x01, 0x4c, 0x35, 0x4d, 0x34, 0x1f, 0x07, 0x47, 0x01, 0xe0,
-    0x01, 0x18, 0xfe, 0x60, 0x01, 0xaa, 0xb3, 0xbd, 0x01, 0x02, 0x95, 0xfd, 0x67, 0x02, 0x38, 0x60, 0x83, 0x4f, 0xfe,
-    0x55, 0x01, 0xac, 0x29, 0x4b, 0x3a, 0x24, 0x03, 0x02, 0x16, 0xfd, 0x93, 0x02, 0x7d, 0x07, 0x01, 0x1f, 0x39, 0x51,
-    0x31, 0xfe, 0x55, 0x03, 0x3f, 0x01, 0xd9, 0x00, 0x00, 0x00, 0x02, 0xff, 0xfe, 0x00, 0x00, 0x04, 0x79, 0x04, 0x3a,
-    0x00, 0x23, 0x00, 0x27, 0x00, 0x3a, 0x40, 0x37, 0x09, 0x01, 0x03, 0x00, 0x1b, 0x01, 0x02, 0x03, 0x02, 0x4a, 0x00,
-    0x00, 0x05, 0x01, 0x03, 0x02, 0x00, 0x03, 0x63, 0x00, 0x07, 0x07, 0x01, 0x59, 0x00, 0x01, 0x01, 0x18, 0x4b, 0x08,
-    0x06, 0x04, 0x03, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x00, 0x00, 0x27, 0x26, 0x00, 0x23, 0x00, 0x23, 0x13, 0x12, 0x25,
-    0x17, 0x11, 0x15, 0x09, 0x06, 0x1a, 0x2b, 0x23, 0x37, 0x3e, 0x03, 0x37, 0x03, 0x21, 0x01, 0x1e, 0x03, 0x07, 0x07,
-    0x23, 0x37, 0x36, 0x36, 0x26, 0x26, 0x27, 0x27, 0x07, 0x03, 0x23, 0x13, 0x27, 0x27, 0x22, 0x0e, 0x02, 0x07, 0x07,
-    0x01, 0x17, 0x13, 0x21, 0x02, 0x21, 0x0c, 0x36, 0x5c, 0x84, 0x5a, 0xb7, 0x03, 0x95, 0xfe, 0x91, 0x4c, 0x61, 0x35,
-    0x0d, 0x07, 0x21, 0xb5, 0x20, 0x04, 0x04, 0x13, 0x30, 0x30, 0x2f, 0x0f, 0x4f, 0xb5, 0x53, 0x02, 0x3a, 0x36, 0x4a,
-    0x30, 0x1a, 0x07, 0x23, 0x01, 0x98, 0x07, 0xe6, 0xfe, 0xa9, 0xda, 0x56, 0x8b, 0x63, 0x39, 0x06, 0x01, 0xdd, 0xfe,
-    0x1c, 0x08, 0x46, 0x68, 0x81, 0x44, 0xdb, 0xdc, 0x26, 0x4f, 0x42, 0x2d, 0x03, 0x02, 0x13, 0xfe, 0x4e, 0x01, 0xbc,
-    0x09, 0x02, 0x25, 0x41, 0x56, 0x30, 0xdb, 0x02, 0x5c, 0x01, 0x01, 0x47, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xe5,
-    0x00, 0x00, 0x04, 0xf1, 0x05, 0xb0, 0x00, 0x2a, 0x00, 0x2d, 0x00, 0x31, 0x40, 0x2e, 0x00, 0x08, 0x05, 0x03, 0x02,
-    0x01, 0x00, 0x08, 0x01, 0x64, 0x00, 0x0a, 0x0a, 0x07, 0x59, 0x09, 0x01, 0x07, 0x07, 0x16, 0x4b, 0x06, 0x04, 0x02,
-    0x03, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x2d, 0x2c, 0x2a, 0x29, 0x11, 0x11, 0x11, 0x14, 0x15, 0x42, 0x12, 0x25, 0x16,
-    0x0b, 0x06, 0x1d, 0x2b, 0x01, 0x1e, 0x03, 0x07, 0x03, 0x23, 0x13, 0x36, 0x34, 0x26, 0x26, 0x27, 0x27, 0x07, 0x03,
-    0x23, 0x13, 0x27, 0x27, 0x23, 0x27, 0x22, 0x0e, 0x02, 0x07, 0x03, 0x23, 0x13, 0x36, 0x36, 0x37, 0x07, 0x03, 0x23,
-    0x13, 0x33, 0x03, 0x21, 0x03, 0x21, 0x01, 0x13, 0x23, 0x03, 0x92, 0x3c, 0x4e, 0x2c, 0x0d, 0x06, 0x52, 0x96, 0x53,
-    0x03, 0x0f, 0x22, 0x1f, 0x21, 0x0c, 0x6e, 0x96, 0x70, 0x02, 0x21, 0x01, 0x05, 0x21, 0x30, 0x21, 0x13, 0x05, 0x54,
-    0x96, 0x56, 0x07, 0x18, 0x11, 0x9a, 0x6f, 0xa7, 0xfd, 0xa7, 0x74, 0x01, 0x79, 0x71, 0x02, 0xd4, 0xfe, 0x2d, 0xc4,
-    0xf9, 0x03, 0x15, 0x06, 0x33, 0x4e, 0x64, 0x36, 0xfe, 0x0c, 0x01, 0xf5, 0x1a, 0x30, 0x26, 0x18, 0x02, 0x01, 0x15,
-    0xfd, 0x95, 0x02, 0x6a, 0x16, 0x01, 0x01, 0x16, 0x27, 0x34, 0x1d, 0xfe, 0x0c, 0x01, 0xf3, 0x26, 0x46, 0x23, 0x02,
-    0xfd, 0x80, 0x05, 0xb0, 0xfd, 0x68, 0x02, 0x98, 0xfd, 0xcf, 0x01, 0x99, 0x00, 0x00, 0x00, 0x02, 0xff, 0xe6, 0x00,
-    0x00, 0x04, 0xb1, 0x04, 0x3a, 0x00, 0x2b, 0x00, 0x2e, 0x00, 0x31, 0x40, 0x2e, 0x00, 0x08, 0x05, 0x03, 0x02, 0x01,
-    0x00, 0x08, 0x01, 0x64, 0x00, 0x0a, 0x0a, 0x07, 0x59, 0x09, 0x01, 0x07, 0x07, 0x18, 0x4b, 0x06, 0x04, 0x02, 0x03,
-    0x00, 0x00, 0x17, 0x00, 0x4c, 0x2e, 0x2d, 0x2b, 0x2a, 0x11, 0x11, 0x11, 0x14, 0x15, 0x42, 0x14, 0x15, 0x16, 0x0b,
-    0x06, 0x1d, 0x2b, 0x01, 0x1e, 0x03, 0x07, 0x03, 0x23, 0x13, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x07, 0x27, 0x03, 0x23,
-    0x13, 0x27, 0x27, 0x23, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x03, 0x23, 0x13, 0x36, 0x36, 0x37, 0x07, 0x03, 0x23, 0x13,
-    0x33, 0x03, 0x21, 0x03, 0x21, 0x01, 0x13, 0x23, 0x03, 0x87, 0x37, 0x45, 0x25, 0x09, 0x05, 0x30, 0x95, 0x30, 0x03,
-    0x01, 0x0f, 0x22, 0x1e, 0x10, 0x12, 0x09, 0x4c, 0x97, 0x4f, 0x04, 0x1c, 0x04, 0x03, 0x21, 0x30, 0x22, 0x14, 0x05,
-    0x32, 0x96, 0x33, 0x08, 0x17, 0x13, 0x9b, 0x4d, 0xa7, 0xbc, 0xa7, 0x55, 0x01, 0x6b, 0x78, 0x02, 0xca, 0xfe, 0x42,
-    0xaf, 0xef, 0x02, 0x4c, 0x09, 0x36, 0x4e, 0x5f, 0x31, 0xfe, 0xd1, 0x01, 0x31, 0x1b, 0x2f, 0x25, 0x17, 0x02, 0x01,
-    0x1c, 0x01, 0xfe, 0x61, 0x01, 0xa6, 0x15, 0x01, 0x01, 0x01, 0x16, 0x28, 0x34, 0x1d, 0xfe, 0xd1, 0x01, 0x2e, 0x26,
-    0x46, 0x23, 0x02, 0xfe, 0x45, 0x04, 0x3a, 0xfe, 0x19, 0x01, 0xe7, 0xfe, 0x34, 0x01, 0x3d, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x44, 0xfe, 0x47, 0x04, 0x47, 0x07, 0x75, 0x00, 0x42, 0x00, 0x4b, 0x00, 0x58, 0x40, 0x55, 0x46, 0x01, 0x07,
-    0x06, 0x17, 0x01, 0x05, 0x00, 0x1a, 0x01, 0x04, 0x05, 0x03, 0x4a, 0x2b, 0x2a, 0x02, 0x03, 0x47, 0x08, 0x01, 0x06,
-    0x07, 0x06, 0x72, 0x00, 0x07, 0x02, 0x07, 0x72, 0x09, 0x01, 0x00, 0x00, 0x05, 0x04, 0x00, 0x05, 0x63, 0x00, 0x01,
-    0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x16, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x20, 0x03, 0x4c,
-    0x01, 0x00, 0x4b, 0x4a, 0x48, 0x47, 0x45, 0x44, 0x41, 0x3f, 0x37, 0x34, 0x21, 0x1e, 0x0e, 0x0c, 0x0b, 0x09, 0x00,
-    0x42, 0x01, 0x42, 0x0a, 0x06, 0x14, 0x2b, 0x01, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x25, 0x37, 0x05,
-    0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x23, 0x27, 0x0e, 0x03, 0x07, 0x06, 0x1e, 0x02,
-    0x17, 0x07, 0x2e, 0x03, 0x37, 0x3e, 0x03, 0x33, 0x17, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x37,
-    0x01, 0x37, 0x37, 0x07, 0x05, 0x23, 0x27, 0x37, 0x17, 0x02, 0x2a, 0x3f, 0x77, 0x61, 0x41, 0x08, 0x07, 0x1f, 0x40,
-    0x59, 0x34, 0xfe, 0xcb, 0x1b, 0x01, 0x1d, 0x54, 0x9a, 0x73, 0x3e, 0x07, 0x05, 0x35, 0x51, 0x66, 0x36, 0x6a, 0x66,
-    0x08, 0x08, 0x5b, 0x8f, 0xb7, 0x64, 0x35, 0x1e, 0x3b, 0x31, 0x22, 0x04, 0x05, 0x11, 0x24, 0x31, 0x1b, 0x50, 0x2d,
-    0x4f, 0x3b, 0x20, 0x02, 0x03, 0x3f, 0x63, 0x7e, 0x41, 0x2d, 0x40, 0x74, 0x5c, 0x3d, 0x08, 0x09, 0x22, 0x48, 0x69,
-    0x3e, 0x95, 0x1b, 0x01, 0x41, 0xae, 0xa1, 0x01, 0xfe, 0xe7, 0x70, 0xd2, 0x02, 0x95, 0x03, 0x35, 0x1c, 0x3d, 0x60,
-    0x45, 0x38, 0x54, 0x39, 0x1d, 0x02, 0x01, 0x98, 0x01, 0x02, 0x33, 0x61, 0x8d, 0x5d, 0x3f, 0x66, 0x4f, 0x3c, 0x16,
-    0x2b, 0xad, 0x73, 0x69, 0xa2, 0x6f, 0x38, 0x01, 0x01, 0x0d, 0x1d, 0x2e, 0x21, 0x21, 0x36, 0x2b, 0x22, 0x0d, 0x7b,
-    0x17, 0x3f, 0x4e, 0x5d, 0x35, 0x4a, 0x65, 0x3e, 0x1a, 0x01, 0x26, 0x48, 0x67, 0x42, 0x44, 0x61, 0x3f, 0x1f, 0x02,
-    0x01, 0x97, 0x03, 0xa6, 0x96, 0x02, 0x14, 0xf7, 0xf4, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x58, 0xfe,
-    0x48, 0x04, 0x06, 0x06, 0x1f, 0x00, 0x48, 0x00, 0x51, 0x00, 0x54, 0x40, 0x51, 0x4c, 0x01, 0x07, 0x06, 0x17, 0x01,
-    0x05, 0x00, 0x02, 0x4a, 0x2f, 0x2e, 0x02, 0x03, 0x47, 0x08, 0x01, 0x06, 0x07, 0x06, 0x72, 0x00, 0x07, 0x02, 0x07,
-    0x72, 0x09, 0x01, 0x00, 0x00, 0x05, 0x04, 0x00, 0x05, 0x63, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x18,
-    0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x20, 0x03, 0x4c, 0x01, 0x00, 0x51, 0x50, 0x4e, 0x4d, 0x4b,
-    0x4a, 0x47, 0x44, 0x3b, 0x38, 0x25, 0x22, 0x0e, 0x0c, 0x0b, 0x09, 0x00, 0x48, 0x01, 0x48, 0x0a, 0x06, 0x14, 0x2b,
-    0x01, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x25, 0x37, 0x05, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x1e,
-    0x03, 0x07, 0x0e, 0x05, 0x23, 0x27, 0x0e, 0x03, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x07, 0x2e, 0x03, 0x37, 0x3e, 0x03,
-    0x33, 0x17, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x04, 0x27, 0x27, 0x37, 0x01, 0x37, 0x37, 0x07, 0x05, 0x23, 0x27,
-    0x37, 0x17, 0x02, 0x14, 0x2b, 0x63, 0x57, 0x3e, 0x07, 0x06, 0x26, 0x3e, 0x4c, 0x21, 0xfe, 0xd1, 0x1b, 0x01, 0x18,
-    0x42, 0x8c, 0x70, 0x44, 0x05, 0x03, 0x2b, 0x40, 0x50, 0x28, 0x26, 0x3f, 0x2d, 0x17, 0x02, 0x03, 0x2a, 0x45, 0x5b,
-    0x65, 0x6c, 0x34, 0x30, 0x1e, 0x3b, 0x31, 0x22, 0x04, 0x05, 0x12, 0x24, 0x32, 0x1b, 0x53, 0x2c, 0x4f, 0x3b, 0x20,
-    0x02, 0x03, 0x3f, 0x64, 0x7d, 0x41, 0x28, 0x2b, 0x5e, 0x51, 0x3a, 0x08, 0x05, 0x13, 0x25, 0x33, 0x39, 0x3a, 0x19,
-    0x95, 0x1a, 0x01, 0x22, 0xae, 0xa1, 0x01, 0xfe, 0xe7, 0x70, 0xd2, 0x02, 0x95, 0x02, 0x68, 0x0d, 0x25, 0x41, 0x35,
-    0x2b, 0x37, 0x20, 0x0d, 0x01, 0x01, 0x99, 0x01, 0x02, 0x22, 0x48, 0x70, 0x50, 0x30, 0x4b, 0x3a, 0x2c, 0x10, 0x0f,
-    0x2a, 0x39, 0x47, 0x2a, 0x3c, 0x61, 0x4a, 0x35, 0x21, 0x10, 0x01, 0x01, 0x0d, 0x1c, 0x2e, 0x22, 0x22, 0x36, 0x2b,
-    0x22, 0x0e, 0x78, 0x16, 0x3f, 0x4e, 0x5d, 0x35, 0x4a, 0x65, 0x3e, 0x1b, 0x01, 0x12, 0x29, 0x42, 0x32, 0x22, 0x32,
-    0x23, 0x15, 0x0d, 0x04, 0x01, 0x01, 0x97, 0x03, 0x1e, 0x96, 0x02, 0x14, 0xf7, 0xf4, 0x17, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x5f, 0xff, 0xea, 0x04, 0x66, 0x05, 0xc6, 0x00, 0x1d, 0x00, 0x2e, 0x00, 0x3f, 0x00, 0x37, 0x40,
-    0x34, 0x06, 0x01, 0x02, 0x07, 0x01, 0x04, 0x05, 0x02, 0x04, 0x61, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01,
-    0x1d, 0x4b, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x4c, 0x30, 0x2f, 0x1f, 0x1e, 0x39, 0x37,
-    0x2f, 0x3f, 0x30, 0x3f, 0x28, 0x26, 0x1e, 0x2e, 0x1f, 0x2e, 0x2d, 0x26, 0x08, 0x06, 0x16, 0x2b, 0x01, 0x0e, 0x05,
-    0x27, 0x2e, 0x05, 0x37, 0x37, 0x3e, 0x05, 0x17, 0x1e, 0x05, 0x07, 0x05, 0x21, 0x37, 0x36, 0x36, 0x2e, 0x03, 0x27,
-    0x26, 0x0e, 0x04, 0x07, 0x05, 0x21, 0x07, 0x06, 0x06, 0x1e, 0x03, 0x17, 0x16, 0x3e, 0x04, 0x37, 0x04, 0x42, 0x0d,
-    0x2f, 0x47, 0x60, 0x7b, 0x97, 0x5a, 0x56, 0x83, 0x5e, 0x3c, 0x1e, 0x03, 0x0a, 0x1a, 0x0d, 0x2f, 0x47, 0x61, 0x7b,
-    0x97, 0x5a, 0x57, 0x83, 0x5e, 0x3b, 0x1d, 0x03, 0x0a, 0xfc, 0xd8, 0x02, 0x73, 0x02, 0x06, 0x07, 0x09, 0x1c, 0x37,
-    0x55, 0x3e, 0x41, 0x69, 0x53, 0x3f, 0x2e, 0x1e, 0x09, 0x02, 0x59, 0xfd, 0x8c, 0x01, 0x07, 0x05, 0x0a, 0x1c, 0x38,
-    0x55, 0x3e, 0x41, 0x6a, 0x52, 0x3e, 0x2d, 0x1e, 0x09, 0x02, 0x85, 0x4d, 0x9f, 0x95, 0x84, 0x60, 0x36, 0x02, 0x02,
-    0x3d, 0x64, 0x84, 0x92, 0x98, 0x47, 0xa6, 0x4d, 0x9f, 0x95, 0x84, 0x61, 0x36, 0x02, 0x02, 0x3d, 0x64, 0x84, 0x93,
-    0x99, 0x47, 0x09, 0x0d, 0x2e, 0x6c, 0x6d, 0x67, 0x50, 0x32, 0x02, 0x02, 0x2b, 0x4d, 0x65, 0x71, 0x74, 0x34, 0xa3,
-    0x06, 0x2d, 0x6c, 0x6e, 0x68, 0x51, 0x33, 0x02, 0x02, 0x2b, 0x4d, 0x66, 0x71, 0x74, 0x35, 0x00, 0x00, 0x03, 0x00,
-    0x44, 0xff, 0xe9, 0x04, 0x17, 0x04, 0x50, 0x00, 0x17, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x37, 0x40, 0x34, 0x00, 0x05,
-    0x00, 0x03, 0x02, 0x05, 0x03, 0x61, 0x07, 0x01, 0x04, 0x04, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x1f, 0x4b, 0x06, 0x01,
-    0x02, 0x02, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x20, 0x01, 0x4c, 0x24, 0x23, 0x19, 0x18, 0x29, 0x28, 0x23, 0x2d, 0x24,
-    0x2d, 0x1e, 0x1d, 0x18, 0x22, 0x19, 0x22, 0x29, 0x26, 0x08, 0x06, 0x16, 0x2b, 0x13, 0x3e, 0x05, 0x17, 0x1e, 0x03,
-    0x07, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x01, 0x16, 0x3e, 0x02, 0x37, 0x21, 0x06, 0x1e, 0x02, 0x13, 0x26,
-    0x0e, 0x02, 0x07, 0x21, 0x36, 0x2e, 0x02, 0x52, 0x09, 0x2d, 0x46, 0x5f, 0x75, 0x8b, 0x50, 0x72, 0xa1, 0x62, 0x25,
-    0x0b, 0x02, 0x0e, 0x59, 0x8e, 0xc1, 0x76, 0x71, 0xa1, 0x62, 0x26, 0x0b, 0x01, 0x97, 0x4a, 0x76, 0x58, 0x3b, 0x10,
-    0xfd, 0xb7, 0x02, 0x12, 0x35, 0x5b, 0xd5, 0x49, 0x74, 0x58, 0x3b, 0x10, 0x02, 0x46, 0x01, 0x14, 0x35, 0x5a, 0x02,
-    0x20, 0x49, 0x8d, 0x7d, 0x69, 0x4b, 0x29, 0x02, 0x03, 0x5f, 0x99, 0xc3, 0x66, 0x17, 0x6d, 0xca, 0x99, 0x5a, 0x03,
-    0x03, 0x5d, 0x98, 0xc0, 0x66, 0xfe, 0x77, 0x02, 0x38, 0x60, 0x7c, 0x41, 0x3b, 0x77, 0x60, 0x3f, 0x03, 0x34, 0x02,
-    0x37, 0x5e, 0x79, 0x40, 0x3a, 0x75, 0x5e, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb1, 0x00, 0x00, 0x05, 0x4f,
-    0x05, 0xc5, 0x00, 0x14, 0x00, 0x41, 0xb5, 0x01, 0x01, 0x02, 0x01, 0x01, 0x4a, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40,
-    0x11, 0x00, 0x01, 0x01, 0x00, 0x5b, 0x03, 0x01, 0x00, 0x00, 0x1d, 0x4b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x1b,
-    0x40, 0x15, 0x00, 0x03, 0x03, 0x16, 0x4b, 0x00, 0x01, 0x01, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x1d, 0x4b, 0x00, 0x02,
-    0x02, 0x17, 0x02, 0x4c, 0x59, 0xb6, 0x11, 0x15, 0x21, 0x27, 0x04, 0x06, 0x18, 0x2b, 0x01, 0x17, 0x37, 0x01, 0x3e,
-    0x03, 0x33, 0x17, 0x07, 0x27, 0x22, 0x0e, 0x02, 0x07, 0x01, 0x23, 0x03, 0x33, 0x02, 0x0d, 0x09, 0x3a, 0x01, 0x7f,
-    0x19, 0x3a, 0x4e, 0x67, 0x45, 0x33, 0x15, 0x0a, 0x23, 0x34, 0x2a, 0x20, 0x0d, 0xfd, 0xc3, 0xa6, 0xee, 0xc5, 0x01,
-    0x6e, 0x77, 0x86, 0x03, 0x22, 0x39, 0x6a, 0x51, 0x32, 0x01, 0xab, 0x01, 0x18, 0x29, 0x35, 0x1c, 0xfb, 0x78, 0x05,
-    0xb0, 0x00, 0x00, 0x00, 0x01, 0x00, 0xa6, 0x00, 0x00, 0x04, 0x8f, 0x04, 0x50, 0x00, 0x18, 0x00, 0x5d, 0x4b, 0xb0,
-    0x17, 0x50, 0x58, 0x40, 0x0c, 0x0b, 0x01, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x03, 0x02, 0x01, 0x02, 0x4a, 0x1b, 0x40,
-    0x0c, 0x0b, 0x01, 0x01, 0x03, 0x0c, 0x01, 0x00, 0x03, 0x02, 0x01, 0x02, 0x4a, 0x59, 0x4b, 0xb0, 0x17, 0x50, 0x58,
-    0x40, 0x11, 0x00, 0x01, 0x01, 0x00, 0x5b, 0x03, 0x01, 0x00, 0x00, 0x1f, 0x4b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c,
-    0x1b, 0x40, 0x15, 0x00, 0x03, 0x03, 0x18, 0x4b, 0x00, 0x01, 0x01, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x1f, 0x4b, 0x00,
-    0x02, 0x02, 0x17, 0x02, 0x4c, 0x59, 0xb6, 0x11, 0x15, 0x25, 0x27, 0x04, 0x06, 0x18, 0x2b, 0x01, 0x17, 0x37, 0x01,
-    0x3e, 0x03, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x07, 0x22, 0x0e, 0x02, 0x07, 0x01, 0x23, 0x03, 0x33, 0x01,
-    0xd8, 0x05, 0x2b, 0x01, 0x01, 0x13, 0x33, 0x44, 0x56, 0x37, 0x1f, 0x34, 0x1c, 0x24, 0x0b, 0x14, 0x0b, 0x15, 0x25,
-    0x1f, 0x19, 0x09, 0xfe, 0x3c, 0x8a, 0xd2, 0xb2, 0x01, 0x32, 0x58, 0x68, 0x02, 0x1b, 0x2d, 0x57, 0x45, 0x2a, 0x0d,
-    0x0e, 0x92, 0x04, 0x06, 0x01, 0x12, 0x1b, 0x22, 0x11, 0xfc, 0xb4, 0x04, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
-    0x26, 0xfe, 0x4d, 0x04, 0xed, 0x05, 0xc6, 0x00, 0x1d, 0x00, 0x36, 0x00, 0x54, 0x00, 0x46, 0x40, 0x43, 0x1f, 0x1e,
-    0x02, 0x07, 0x02, 0x34, 0x01, 0x00, 0x07, 0x2b, 0x01, 0x04, 0x00, 0x2a, 0x01, 0x03, 0x04, 0x04, 0x4a, 0x00, 0x06,
-    0x06, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x1d, 0x4b, 0x05, 0x01, 0x02, 0x02, 0x18, 0x4b, 0x00, 0x07, 0x07, 0x00, 0x5b,
-    0x00, 0x00, 0x00, 0x20, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x21, 0x03, 0x4c, 0x2d, 0x27, 0x16,
-    0x25, 0x25, 0x19, 0x2d, 0x26, 0x08, 0x06, 0x1c, 0x2b, 0x01, 0x0e, 0x05, 0x27, 0x2e, 0x04, 0x36, 0x37, 0x13, 0x3e,
-    0x05, 0x17, 0x1e, 0x04, 0x06, 0x07, 0x13, 0x07, 0x13, 0x33, 0x01, 0x0e, 0x03, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16,
-    0x16, 0x37, 0x3e, 0x03, 0x37, 0x37, 0x13, 0x33, 0x05, 0x3e, 0x02, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x04, 0x07, 0x03,
-    0x0e, 0x02, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x04, 0x37, 0x02, 0x66, 0x07, 0x18, 0x25, 0x37, 0x4b, 0x64, 0x40, 0x3b,
-    0x50, 0x30, 0x16, 0x05, 0x07, 0x05, 0x4e, 0x07, 0x15, 0x23, 0x32, 0x48, 0x5f, 0x3e, 0x3d, 0x54, 0x35, 0x1a, 0x09,
-    0x06, 0x05, 0xd2, 0x0d, 0xcf, 0xa5, 0xfe, 0x41, 0x0f, 0x2c, 0x3f, 0x54, 0x37, 0x19, 0x31, 0x18, 0x10, 0x11, 0x23,
-    0x11, 0x21, 0x2e, 0x23, 0x18, 0x0a, 0x2b, 0x21, 0x9d, 0xfe, 0x6c, 0x02, 0x07, 0x05, 0x03, 0x0f, 0x21, 0x1c, 0x20,
-    0x2f, 0x21, 0x15, 0x0d, 0x07, 0x03, 0x58, 0x02, 0x07, 0x05, 0x02, 0x0f, 0x1f, 0x1c, 0x21, 0x30, 0x21, 0x16, 0x0d,
-    0x07, 0x03, 0x01, 0xe8, 0x31, 0x73, 0x72, 0x6a, 0x50, 0x2f, 0x03, 0x02, 0x36, 0x56, 0x6b, 0x70, 0x69, 0x29, 0x01,
-    0xe1, 0x2e, 0x71, 0x72, 0x6b, 0x52, 0x30, 0x02, 0x02, 0x35, 0x54, 0x6a, 0x70, 0x6c, 0x2b, 0xfe, 0x9e, 0x8d, 0x02,
-    0x61, 0xfb, 0x1d, 0x2d, 0x5e, 0x4e, 0x31, 0x0b, 0x05, 0x92, 0x02, 0x07, 0x01, 0x01, 0x28, 0x39, 0x3f, 0x19, 0x6a,
-    0x04, 0x2f, 0x49, 0x10, 0x39, 0x44, 0x47, 0x3b, 0x26, 0x01, 0x02, 0x21, 0x38, 0x46, 0x46, 0x3f, 0x15, 0xfd, 0xd1,
-    0x0f, 0x3a, 0x45, 0x48, 0x3b, 0x28, 0x01, 0x02, 0x22, 0x38, 0x47, 0x46, 0x40, 0x15, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x1e, 0xfe, 0x4c, 0x04, 0xee, 0x04, 0x51, 0x00, 0x1d, 0x00, 0x36, 0x00, 0x54, 0x00, 0x74, 0x40, 0x13, 0x1f,
-    0x1e, 0x02, 0x06, 0x07, 0x34, 0x01, 0x01, 0x06, 0x2b, 0x01, 0x04, 0x01, 0x2a, 0x01, 0x03, 0x04, 0x04, 0x4a, 0x4b,
-    0xb0, 0x17, 0x50, 0x58, 0x40, 0x21, 0x00, 0x07, 0x07, 0x00, 0x59, 0x05, 0x02, 0x02, 0x00, 0x00, 0x18, 0x4b, 0x00,
-    0x06, 0x06, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x20, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x21, 0x03,
-    0x4c, 0x1b, 0x40, 0x25, 0x05, 0x01, 0x02, 0x02, 0x18, 0x4b, 0x00, 0x07, 0x07, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x1f,
-    0x4b, 0x00, 0x06, 0x06, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x20, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03,
-    0x21, 0x03, 0x4c, 0x59, 0x40, 0x0b, 0x2d, 0x27, 0x16, 0x25, 0x25, 0x19, 0x2d, 0x26, 0x08, 0x06, 0x1c, 0x2b, 0x13,
-    0x3e, 0x05, 0x17, 0x1e, 0x04, 0x06, 0x07, 0x07, 0x0e, 0x05, 0x27, 0x2e, 0x04, 0x36, 0x37, 0x25, 0x07, 0x13, 0x33,
-    0x01, 0x0e, 0x03, 0x27, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x37, 0x3e, 0x03, 0x37, 0x37, 0x13, 0x33, 0x01, 0x0e,
-    0x03, 0x16, 0x16, 0x17, 0x16, 0x3e, 0x04, 0x37, 0x37, 0x3e, 0x02, 0x34, 0x26, 0x26, 0x27, 0x26, 0x0e, 0x04, 0x07,
-    0x2d, 0x07, 0x17, 0x27, 0x39, 0x50, 0x6b, 0x46, 0x43, 0x5b, 0x38, 0x1b, 0x07, 0x07, 0x05, 0x03, 0x07, 0x18, 0x27,
-    0x3a, 0x51, 0x6c, 0x45, 0x42, 0x5a, 0x37, 0x1b, 0x07, 0x06, 0x06, 0x03, 0x5c, 0x11, 0xd4, 0xa5, 0xfe, 0x41, 0x0f,
-    0x2c, 0x3f, 0x54, 0x37, 0x19, 0x31, 0x18, 0x10, 0x11, 0x23, 0x11, 0x21, 0x2e, 0x23, 0x18, 0x0a, 0x2b, 0x21, 0x9d,
-    0xfd, 0x45, 0x02, 0x0b, 0x08, 0x01, 0x11, 0x27, 0x23, 0x29, 0x39, 0x28, 0x18, 0x0f, 0x07, 0x03, 0x02, 0x02, 0x0b,
-    0x08, 0x11, 0x27, 0x23, 0x28, 0x39, 0x28, 0x18, 0x0e, 0x08, 0x03, 0x02, 0x23, 0x35, 0x7d, 0x7d, 0x74, 0x58, 0x33,
-    0x02, 0x02, 0x39, 0x5a, 0x73, 0x78, 0x76, 0x2f, 0x18, 0x35, 0x7c, 0x7c, 0x73, 0x57, 0x32, 0x02, 0x02, 0x38, 0x5a,
-    0x72, 0x78, 0x74, 0x2f, 0x5c, 0x9d, 0x02, 0x6f, 0xfb, 0x1d, 0x2d, 0x5f, 0x4e, 0x31, 0x01, 0x0b, 0x05, 0x92, 0x02,
-    0x07, 0x01, 0x01, 0x28, 0x39, 0x3f, 0x19, 0x6a, 0x04, 0x2f, 0xfd, 0xd3, 0x14, 0x49, 0x57, 0x5b, 0x4b, 0x32, 0x01,
-    0x02, 0x2c, 0x48, 0x5b, 0x5a, 0x51, 0x1a, 0x17, 0x14, 0x49, 0x58, 0x5c, 0x4b, 0x31, 0x02, 0x02, 0x2c, 0x49, 0x5b,
-    0x5b, 0x51, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x66, 0xff, 0x73, 0x04, 0x6d, 0x06, 0x35, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x25, 0x00, 0x43, 0x00, 0xab, 0x4b, 0xb0, 0x16, 0x50, 0x58, 0x40, 0x2e, 0x00, 0x01, 0x05, 0x05, 0x01, 0x66,
-    0x00, 0x00, 0x06, 0x03, 0x06, 0x00, 0x68, 0x00, 0x03, 0x07, 0x07, 0x03, 0x66, 0x00, 0x02, 0x04, 0x04, 0x02, 0x67,
-    0x00, 0x06, 0x06, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x1d, 0x4b, 0x00, 0x07, 0x07, 0x04, 0x5c, 0x00, 0x04, 0x04, 0x20,
-    0x04, 0x4c, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x2d, 0x00, 0x01, 0x05, 0x05, 0x01, 0x66, 0x00, 0x00, 0x06,
-    0x03, 0x06, 0x00, 0x68, 0x00, 0x03, 0x07, 0x07, 0x03, 0x66, 0x00, 0x02, 0x04, 0x02, 0x73, 0x00, 0x06, 0x06, 0x05,
-    0x5b, 0x00, 0x05, 0x05, 0x1d, 0x4b, 0x00, 0x07, 0x07, 0x04, 0x5c, 0x00, 0x04, 0x04, 0x20, 0x04, 0x4c, 0x1b, 0x40,
-    0x2e, 0x00, 0x01, 0x05, 0x01, 0x72, 0x00, 0x00, 0x06, 0x03, 0x06, 0x00, 0x03, 0x70, 0x00, 0x03, 0x07, 0x06, 0x03,
-    0x07, 0x6e, 0x00, 0x02, 0x04, 0x02, 0x73, 0x00, 0x06, 0x06, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x1d, 0x4b, 0x00, 0x07,
-    0x07, 0x04, 0x5c, 0x00, 0x04, 0x04, 0x20, 0x04, 0x4c, 0x59, 0x59, 0x40, 0x0b, 0x2d, 0x2d, 0x2d, 0x27, 0x11, 0x11,
-    0x11, 0x10, 0x08, 0x06, 0x1c, 0x2b, 0x01, 0x23, 0x13, 0x33, 0x01, 0x23, 0x13, 0x33, 0x01, 0x0e, 0x05, 0x27, 0x2e,
-    0x05, 0x37, 0x37, 0x3e, 0x05, 0x17, 0x1e, 0x05, 0x07, 0x27, 0x36, 0x36, 0x2e, 0x03, 0x27, 0x26, 0x0e, 0x04, 0x07,
-    0x07, 0x06, 0x06, 0x1e, 0x03, 0x17, 0x16, 0x3e, 0x04, 0x37, 0x03, 0x16, 0xb5, 0x44, 0xb4, 0xfe, 0xd4, 0xb5, 0x45,
-    0xb5, 0x01, 0xd7, 0x0d, 0x2f, 0x47, 0x60, 0x7b, 0x97, 0x5a, 0x56, 0x83, 0x5e, 0x3c, 0x1e, 0x03, 0x0a, 0x1a, 0x0d,
-    0x2f, 0x47, 0x61, 0x7b, 0x97, 0x5a, 0x57, 0x83, 0x5e, 0x3b, 0x1d, 0x03, 0x0a, 0xb3, 0x06, 0x07, 0x09, 0x1c, 0x37,
-    0x55, 0x3e, 0x41, 0x69, 0x53, 0x3f, 0x2e, 0x1e, 0x09, 0x1c, 0x06, 0x06, 0x0a, 0x1c, 0x38, 0x55, 0x3e, 0x41, 0x6a,
-    0x52, 0x3e, 0x2d, 0x1e, 0x09, 0x04, 0xb3, 0x01, 0x82, 0xf9, 0x3e, 0x01, 0x8b, 0x01, 0x87, 0x4d, 0x9f, 0x95, 0x84,
-    0x60, 0x36, 0x02, 0x02, 0x3d, 0x64, 0x84, 0x92, 0x98, 0x47, 0xa6, 0x4d, 0x9f, 0x95, 0x84, 0x61, 0x36, 0x02, 0x02,
-    0x3d, 0x64, 0x84, 0x93, 0x99, 0x47, 0x04, 0x2e, 0x6c, 0x6d, 0x67, 0x50, 0x32, 0x02, 0x02, 0x2b, 0x4d, 0x65, 0x71,
-    0x74, 0x34, 0xa9, 0x2d, 0x6c, 0x6e, 0x68, 0x51, 0x33, 0x02, 0x02, 0x2b, 0x4d, 0x66, 0x71, 0x74, 0x35, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x60, 0xff, 0x61, 0x04, 0x33, 0x04, 0xcb, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1f, 0x00, 0x37,
-    0x01, 0x16, 0x4b, 0xb0, 0x12, 0x50, 0x58, 0x40, 0x2e, 0x00, 0x01, 0x04, 0x04, 0x01, 0x66, 0x00, 0x00, 0x07, 0x03,
-    0x07, 0x00, 0x68, 0x00, 0x03, 0x06, 0x06, 0x03, 0x66, 0x00, 0x02, 0x05, 0x05, 0x02, 0x67, 0x00, 0x07, 0x07, 0x04,
-    0x5b, 0x00, 0x04, 0x04, 0x1f, 0x4b, 0x00, 0x06, 0x06, 0x05, 0x5c, 0x00, 0x05, 0x05, 0x20, 0x05, 0x4c, 0x1b, 0x4b,
-    0xb0, 0x14, 0x50, 0x58, 0x40, 0x2d, 0x00, 0x01, 0x04, 0x04, 0x01, 0x66, 0x00, 0x00, 0x07, 0x03, 0x07, 0x00, 0x68,
-    0x00, 0x03, 0x06, 0x06, 0x03, 0x66, 0x00, 0x02, 0x05, 0x02, 0x73, 0x00, 0x07, 0x07, 0x04, 0x5b, 0x00, 0x04, 0x04,
-    0x1f, 0x4b, 0x00, 0x06, 0x06, 0x05, 0x5c, 0x00, 0x05, 0x05, 0x20, 0x05, 0x4c, 0x1b, 0x4b, 0xb0, 0x16, 0x50, 0x58,
-    0x40, 0x2c, 0x00, 0x01, 0x04, 0x01, 0x72, 0x00, 0x00, 0x07, 0x03, 0x07, 0x00, 0x68, 0x00, 0x03, 0x06, 0x06, 0x03,
-    0x66, 0x00, 0x02, 0x05, 0x02, 0x73, 0x00, 0x07, 0x07, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x1f, 0x4b, 0x00, 0x06, 0x06,
-    0x05, 0x5c, 0x00, 0x05, 0x05, 0x20, 0x05, 0x4c, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x2d, 0x00, 0x01, 0x04,
-    0x01, 0x72, 0x00, 0x00, 0x07, 0x03, 0x07, 0x00, 0x68, 0x00, 0x03, 0x06, 0x07, 0x03, 0x06, 0x6e, 0x00, 0x02, 0x05,
-    0x02, 0x73, 0x00, 0x07, 0x07, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x1f, 0x4b, 0x00, 0x06, 0x06, 0x05, 0x5c, 0x00, 0x05,
-    0x05, 0x20, 0x05, 0x4c, 0x1b, 0x40, 0x2e, 0x00, 0x01, 0x04, 0x01, 0x72, 0x00, 0x00, 0x07, 0x03, 0x07, 0x00, 0x03,
-    0x70, 0x00, 0x03, 0x06, 0x07, 0x03, 0x06, 0x6e, 0x00, 0x02, 0x05, 0x02, 0x73, 0x00, 0x07, 0x07, 0x04, 0x5b, 0x00,
-    0x04, 0x04, 0x1f, 0x4b, 0x00, 0x06, 0x06, 0x05, 0x5c, 0x00, 0x05, 0x05, 0x20, 0x05, 0x4c, 0x59, 0x59, 0x59, 0x59,
-    0x40, 0x0b, 0x29, 0x2b, 0x29, 0x27, 0x11, 0x11, 0x11, 0x10, 0x08, 0x06, 0x1c, 0x2b, 0x01, 0x23, 0x13, 0x33, 0x03,
-    0x23, 0x13, 0x33, 0x01, 0x3e, 0x05, 0x17, 0x1e, 0x03, 0x07, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x33, 0x06,
-    0x1e, 0x04, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x02, 0xd9, 0xb6,
-    0x44, 0xb6, 0xf1, 0xb6, 0x47, 0xb6, 0xfd, 0xfb, 0x09, 0x2d, 0x46, 0x5f, 0x75, 0x8b, 0x50, 0x72, 0xa1, 0x62, 0x25,
-    0x0b, 0x02, 0x0e, 0x59, 0x8e, 0xc1, 0x76, 0x71, 0xa1, 0x62, 0x26, 0x0b, 0xb5, 0x05, 0x01, 0x0f, 0x20, 0x36, 0x4d,
-    0x34, 0x53, 0x80, 0x5b, 0x36, 0x0b, 0x02, 0x07, 0x09, 0x32, 0x60, 0x4e, 0x54, 0x80, 0x5a, 0x36, 0x0a, 0x03, 0x46,
-    0x01, 0x85, 0xfa, 0x96, 0x01, 0x97, 0x01, 0x28, 0x49, 0x8d, 0x7d, 0x69, 0x4b, 0x29, 0x02, 0x03, 0x5f, 0x99, 0xc3,
-    0x66, 0x17, 0x6d, 0xca, 0x99, 0x5a, 0x03, 0x03, 0x5d, 0x98, 0xc0, 0x66, 0x2a, 0x5a, 0x56, 0x4e, 0x3b, 0x24, 0x02,
-    0x03, 0x48, 0x74, 0x91, 0x48, 0x16, 0x3f, 0x8a, 0x75, 0x4d, 0x03, 0x03, 0x49, 0x76, 0x93, 0x48, 0x00, 0x03, 0x00,
-    0x1a, 0xff, 0xe9, 0x04, 0xb5, 0x07, 0x55, 0x00, 0x40, 0x00, 0x56, 0x00, 0x60, 0x00, 0x65, 0x40, 0x62, 0x60, 0x01,
-    0x04, 0x00, 0x40, 0x01, 0x06, 0x04, 0x0e, 0x01, 0x01, 0x05, 0x03, 0x4a, 0x00, 0x0d, 0x0c, 0x08, 0x0c, 0x0d, 0x08,
-    0x70, 0x00, 0x06, 0x04, 0x05, 0x04, 0x06, 0x05, 0x70, 0x00, 0x0b, 0x00, 0x09, 0x0c, 0x0b, 0x09, 0x63, 0x0e, 0x01,
-    0x0c, 0x0a, 0x01, 0x08, 0x00, 0x0c, 0x08, 0x63, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x03, 0x01, 0x00, 0x00, 0x16, 0x4b,
-    0x07, 0x01, 0x05, 0x05, 0x01, 0x5c, 0x02, 0x01, 0x01, 0x01, 0x20, 0x01, 0x4c, 0x41, 0x41, 0x5c, 0x5b, 0x41, 0x56,
-    0x41, 0x55, 0x52, 0x50, 0x4d, 0x4c, 0x49, 0x47, 0x2c, 0x25, 0x15, 0x29, 0x11, 0x19, 0x24, 0x29, 0x10, 0x0f, 0x06,
-    0x1d, 0x2b, 0x01, 0x1e, 0x03, 0x07, 0x03, 0x0e, 0x03, 0x27, 0x26, 0x26, 0x27, 0x06, 0x06, 0x27, 0x2e, 0x03, 0x37,
-    0x13, 0x3e, 0x03, 0x37, 0x07, 0x0e, 0x03, 0x07, 0x03, 0x06, 0x14, 0x16, 0x16, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x13,
-    0x33, 0x03, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x13, 0x36, 0x34, 0x26, 0x26, 0x27, 0x13, 0x07, 0x27,
-    0x2e, 0x03, 0x23, 0x22, 0x06, 0x07, 0x07, 0x27, 0x37, 0x36, 0x36, 0x17, 0x1e, 0x03, 0x17, 0x01, 0x36, 0x36, 0x37,
-    0x37, 0x17, 0x07, 0x06, 0x06, 0x07, 0x03, 0x91, 0x52, 0x74, 0x45, 0x19, 0x08, 0x76, 0x0a, 0x35, 0x58, 0x7c, 0x50,
-    0x47, 0x68, 0x16, 0x2a, 0x72, 0x4f, 0x4b, 0x6a, 0x3f, 0x16, 0x07, 0x76, 0x0c, 0x3f, 0x66, 0x8e, 0x5b, 0x11, 0x33,
-    0x49, 0x32, 0x1e, 0x07, 0x75, 0x03, 0x12, 0x28, 0x26, 0x26, 0x36, 0x25, 0x14, 0x05, 0x53, 0xb6, 0x53, 0x03, 0x03,
-    0x13, 0x29, 0x24, 0x28, 0x38, 0x25, 0x15, 0x05, 0x76, 0x04, 0x17, 0x32, 0x2e, 0xfc, 0x0b, 0x27, 0x34, 0x5e, 0x5a,
-    0x5b, 0x31, 0x36, 0x3d, 0x0a, 0x03, 0x7c, 0x03, 0x0a, 0x81, 0x6b, 0x34, 0x5d, 0x5c, 0x5e, 0x36, 0xfe, 0x1e, 0x1e,
-    0x32, 0x0a, 0x11, 0x88, 0x0e, 0x0b, 0x57, 0x39, 0x05, 0xaf, 0x05, 0x43, 0x6c, 0x8a, 0x4c, 0xfd, 0x2b, 0x49, 0x83,
-    0x63, 0x38, 0x02, 0x02, 0x47, 0x44, 0x3f, 0x50, 0x01, 0x01, 0x3e, 0x64, 0x7f, 0x44, 0x02, 0xd5, 0x57, 0x90, 0x68,
-    0x3b, 0x02, 0x97, 0x03, 0x2b, 0x44, 0x56, 0x2d, 0xfd, 0x2a, 0x1b, 0x46, 0x3f, 0x2d, 0x01, 0x02, 0x24, 0x38, 0x43,
-    0x1f, 0x01, 0xfd, 0xfe, 0x03, 0x1b, 0x41, 0x39, 0x27, 0x01, 0x01, 0x29, 0x3e, 0x49, 0x20, 0x02, 0xd8, 0x26, 0x50,
-    0x44, 0x30, 0x05, 0x01, 0xbe, 0x81, 0x01, 0x01, 0x29, 0x2f, 0x28, 0x3d, 0x33, 0x12, 0x01, 0x24, 0x6a, 0x73, 0x02,
-    0x01, 0x27, 0x2e, 0x28, 0x01, 0xfe, 0x92, 0x20, 0x46, 0x2c, 0x60, 0x01, 0x65, 0x42, 0x66, 0x20, 0x00, 0x00, 0x03,
-    0x00, 0x33, 0xff, 0xe9, 0x04, 0x70, 0x05, 0xe2, 0x00, 0x42, 0x00, 0x58, 0x00, 0x62, 0x00, 0xa7, 0x40, 0x0b, 0x62,
-    0x42, 0x02, 0x05, 0x03, 0x0e, 0x01, 0x00, 0x04, 0x02, 0x4a, 0x4b, 0xb0, 0x26, 0x50, 0x58, 0x40, 0x3b, 0x00, 0x0c,
-    0x0b, 0x07, 0x0b, 0x0c, 0x07, 0x70, 0x00, 0x05, 0x03, 0x04, 0x03, 0x05, 0x04, 0x70, 0x0d, 0x01, 0x0b, 0x09, 0x01,
-    0x07, 0x02, 0x0b, 0x07, 0x63, 0x00, 0x08, 0x08, 0x0a, 0x5b, 0x00, 0x0a, 0x0a, 0x1d, 0x4b, 0x00, 0x03, 0x03, 0x02,
-    0x5b, 0x00, 0x02, 0x02, 0x1f, 0x4b, 0x06, 0x01, 0x04, 0x04, 0x00, 0x5c, 0x01, 0x01, 0x00, 0x00, 0x20, 0x00, 0x4c,
-    0x1b, 0x40, 0x39, 0x00, 0x0c, 0x0b, 0x07, 0x0b, 0x0c, 0x07, 0x70, 0x00, 0x05, 0x03, 0x04, 0x03, 0x05, 0x04, 0x70,
-    0x00, 0x0a, 0x00, 0x08, 0x0b, 0x0a, 0x08, 0x63, 0x0d, 0x01, 0x0b, 0x09, 0x01, 0x07, 0x02, 0x0b, 0x07, 0x63, 0x00,
-    0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x1f, 0x4b, 0x06, 0x01, 0x04, 0x04, 0x00, 0x5c, 0x01, 0x01, 0x00, 0x00,
-    0x20, 0x00, 0x4c, 0x59, 0x40, 0x18, 0x43, 0x43, 0x5e, 0x5d, 0x43, 0x58, 0x43, 0x57, 0x54, 0x52, 0x4f, 0x4e, 0x23,
-    0x2c, 0x25, 0x15, 0x29, 0x11, 0x19, 0x26, 0x2a, 0x0e, 0x06, 0x1d, 0x2b, 0x01, 0x1e, 0x03, 0x07, 0x03, 0x0e, 0x03,
-    0x27, 0x26, 0x26, 0x27, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x13, 0x3e, 0x03, 0x37, 0x07, 0x0e, 0x03, 0x07, 0x03,
-    0x06, 0x06, 0x16, 0x16, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x13, 0x33, 0x03, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02,
-    0x37, 0x13, 0x36, 0x36, 0x26, 0x26, 0x27, 0x01, 0x07, 0x27, 0x2e, 0x03, 0x23, 0x22, 0x06, 0x07, 0x07, 0x27, 0x37,
-    0x36, 0x36, 0x17, 0x1e, 0x03, 0x17, 0x01, 0x36, 0x36, 0x37, 0x37, 0x17, 0x07, 0x06, 0x06, 0x07, 0x03, 0x62, 0x4f,
-    0x6c, 0x3f, 0x14, 0x07, 0x39, 0x09, 0x31, 0x52, 0x77, 0x4e, 0x48, 0x68, 0x16, 0x15, 0x31, 0x3a, 0x44, 0x27, 0x4a,
-    0x64, 0x3a, 0x13, 0x07, 0x39, 0x0b, 0x3b, 0x60, 0x89, 0x59, 0x11, 0x30, 0x43, 0x2d, 0x1a, 0x07, 0x39, 0x02, 0x03,
-    0x0d, 0x22, 0x23, 0x26, 0x36, 0x25, 0x14, 0x05, 0x2b, 0xb5, 0x29, 0x03, 0x03, 0x14, 0x29, 0x24, 0x26, 0x33, 0x20,
-    0x10, 0x04, 0x3a, 0x04, 0x04, 0x12, 0x2d, 0x2b, 0x01, 0x00, 0x0b, 0x27, 0x35, 0x5f, 0x5b, 0x5b, 0x31, 0x36, 0x3f,
-    0x0a, 0x03, 0x7c, 0x03, 0x0a, 0x82, 0x6b, 0x35, 0x5e, 0x5d, 0x5f, 0x36, 0xfe, 0x1a, 0x1d, 0x32, 0x0a, 0x12, 0x88,
-    0x0e, 0x0b, 0x55, 0x38, 0x04, 0x4d, 0x06, 0x45, 0x6c, 0x88, 0x48, 0xfe, 0x86, 0x46, 0x82, 0x62, 0x39, 0x02, 0x02,
-    0x45, 0x44, 0x20, 0x34, 0x25, 0x14, 0x01, 0x01, 0x3f, 0x64, 0x7d, 0x41, 0x01, 0x7a, 0x55, 0x8e, 0x68, 0x3b, 0x03,
-    0x97, 0x03, 0x2d, 0x44, 0x54, 0x2a, 0xfe, 0x85, 0x18, 0x44, 0x3f, 0x2e, 0x02, 0x02, 0x23, 0x37, 0x43, 0x1e, 0x01,
-    0x0e, 0xfe, 0xf2, 0x1b, 0x40, 0x38, 0x25, 0x01, 0x01, 0x2a, 0x3e, 0x47, 0x1d, 0x01, 0x7d, 0x22, 0x4e, 0x45, 0x32,
-    0x05, 0x01, 0xad, 0x81, 0x01, 0x01, 0x29, 0x2f, 0x28, 0x3d, 0x33, 0x12, 0x01, 0x25, 0x6a, 0x72, 0x02, 0x01, 0x27,
-    0x2e, 0x28, 0x01, 0xfe, 0x91, 0x20, 0x46, 0x2c, 0x60, 0x01, 0x65, 0x42, 0x66, 0x21, 0x00, 0x02, 0x00, 0x3b, 0xff,
-    0xea, 0x04, 0xf7, 0x07, 0x04, 0x00, 0x07, 0x00, 0x36, 0x00, 0x74, 0xb5, 0x11, 0x01, 0x04, 0x07, 0x01, 0x4a, 0x4b,
-    0xb0, 0x15, 0x50, 0x58, 0x40, 0x25, 0x00, 0x02, 0x01, 0x06, 0x01, 0x02, 0x68, 0x00, 0x00, 0x03, 0x01, 0x01, 0x02,
-    0x00, 0x01, 0x61, 0x0b, 0x0a, 0x08, 0x03, 0x06, 0x06, 0x16, 0x4b, 0x09, 0x01, 0x07, 0x07, 0x04, 0x5c, 0x05, 0x01,
-    0x04, 0x04, 0x20, 0x04, 0x4c, 0x1b, 0x40, 0x26, 0x00, 0x02, 0x01, 0x06, 0x01, 0x02, 0x06, 0x70, 0x00, 0x00, 0x03,
-    0x01, 0x01, 0x02, 0x00, 0x01, 0x61, 0x0b, 0x0a, 0x08, 0x03, 0x06, 0x06, 0x16, 0x4b, 0x09, 0x01, 0x07, 0x07, 0x04,
-    0x5c, 0x05, 0x01, 0x04, 0x04, 0x20, 0x04, 0x4c, 0x59, 0x40, 0x14, 0x08, 0x08, 0x08, 0x36, 0x08, 0x36, 0x31, 0x2f,
-    0x15, 0x25, 0x15, 0x26, 0x26, 0x11, 0x11, 0x11, 0x10, 0x0c, 0x06, 0x1d, 0x2b, 0x01, 0x21, 0x07, 0x21, 0x07, 0x23,
-    0x37, 0x21, 0x05, 0x03, 0x0e, 0x03, 0x27, 0x26, 0x26, 0x27, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x13, 0x33, 0x03,
-    0x06, 0x06, 0x16, 0x16, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x13, 0x33, 0x03, 0x06, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02,
-    0x37, 0x13, 0x01, 0xe2, 0x02, 0xbb, 0x12, 0xfe, 0xec, 0x16, 0xa5, 0x17, 0xfe, 0xfb, 0x03, 0x29, 0xc0, 0x09, 0x31,
-    0x52, 0x74, 0x4c, 0x4a, 0x69, 0x15, 0x15, 0x31, 0x3a, 0x45, 0x28, 0x47, 0x63, 0x3b, 0x16, 0x06, 0xc2, 0xb3, 0xbe,
-    0x02, 0x01, 0x0d, 0x23, 0x21, 0x26, 0x36, 0x24, 0x15, 0x04, 0xc1, 0xbb, 0xc1, 0x03, 0x03, 0x13, 0x2a, 0x25, 0x24,
-    0x30, 0x1f, 0x10, 0x04, 0xc0, 0x07, 0x04, 0x6c, 0x7d, 0x7d, 0xe8, 0xfb, 0x90, 0x45, 0x7c, 0x5f, 0x36, 0x02, 0x02,
-    0x49, 0x47, 0x20, 0x37, 0x27, 0x15, 0x01, 0x01, 0x3a, 0x5f, 0x79, 0x3f, 0x04, 0x72, 0xfb, 0x8d, 0x17, 0x3f, 0x3a,
-    0x2a, 0x01, 0x02, 0x24, 0x39, 0x44, 0x1e, 0x04, 0x71, 0xfb, 0x8d, 0x1b, 0x41, 0x39, 0x27, 0x26, 0x3a, 0x42, 0x1c,
-    0x04, 0x71, 0x00, 0x02, 0x00, 0x29, 0xff, 0xe9, 0x04, 0xad, 0x05, 0xb0, 0x00, 0x07, 0x00, 0x36, 0x00, 0x78, 0xb5,
-    0x11, 0x01, 0x04, 0x07, 0x01, 0x4a, 0x4b, 0xb0, 0x14, 0x50, 0x58, 0x40, 0x27, 0x00, 0x02, 0x01, 0x06, 0x01, 0x02,
-    0x68, 0x03, 0x01, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x00, 0x16, 0x4b, 0x0b, 0x0a, 0x08, 0x03, 0x06, 0x06, 0x18,
-    0x4b, 0x09, 0x01, 0x07, 0x07, 0x04, 0x5c, 0x05, 0x01, 0x04, 0x04, 0x20, 0x04, 0x4c, 0x1b, 0x40, 0x28, 0x00, 0x02,
-    0x01, 0x06, 0x01, 0x02, 0x06, 0x70, 0x03, 0x01, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x00, 0x16, 0x4b, 0x0b, 0x0a,
-    0x08, 0x03, 0x06, 0x06, 0x18, 0x4b, 0x09, 0x01, 0x07, 0x07, 0x04, 0x5c, 0x05, 0x01, 0x04, 0x04, 0x20, 0x04, 0x4c,
-    0x59, 0x40, 0x14, 0x08, 0x08, 0x08, 0x36, 0x08, 0x36, 0x31, 0x2f, 0x15, 0x25, 0x15, 0x26, 0x26, 0x11, 0x11, 0x11,
-    0x10, 0x0c, 0x06, 0x1d, 0x2b, 0x01, 0x21, 0x07, 0x21, 0x07, 0x23, 0x37, 0x21, 0x01, 0x03, 0x0e, 0x03, 0x27, 0x26,
-    0x26, 0x27, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x13, 0x33, 0x03, 0x06, 0x06, 0x16, 0x16, 0x17, 0x16, 0x3e, 0x02,
-    0x37, 0x13, 0x33, 0x03, 0x06, 0x1e, 0x02, 0x33, 0x16, 0x3e, 0x02, 0x37, 0x13, 0x01, 0x90, 0x02, 0xc2, 0x12, 0xfe,
-    0xe9, 0x17, 0xa4, 0x17, 0xfe, 0xf8, 0x03, 0x30, 0x81, 0x09, 0x32, 0x53, 0x74, 0x4c, 0x49, 0x6b, 0x16, 0x15, 0x31,
-    0x3b, 0x45, 0x28, 0x47, 0x64, 0x3c, 0x16, 0x06, 0x82, 0xb4, 0x7f, 0x02, 0x01, 0x0e, 0x23, 0x22, 0x25, 0x37, 0x24,
-    0x15, 0x05, 0x81, 0xba, 0x7e, 0x03, 0x03, 0x13, 0x2a, 0x24, 0x24, 0x31, 0x1f, 0x12, 0x04, 0x80, 0x05, 0xb0, 0x6c,
-    0x7f, 0x7f, 0xfe, 0xf7, 0xfd, 0x02, 0x45, 0x7d, 0x5d, 0x35, 0x02, 0x02, 0x4a, 0x46, 0x21, 0x36, 0x27, 0x15, 0x01,
-    0x01, 0x3a, 0x5d, 0x78, 0x3f, 0x03, 0x01, 0xfd, 0x00, 0x18, 0x3f, 0x39, 0x29, 0x01, 0x02, 0x23, 0x37, 0x43, 0x1f,
-    0x03, 0x00, 0xfd, 0x00, 0x1b, 0x41, 0x38, 0x26, 0x01, 0x25, 0x39, 0x41, 0x1c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x88, 0xfe, 0x82, 0x04, 0x91, 0x05, 0xc7, 0x00, 0x2a, 0x00, 0x53, 0xb5, 0x02, 0x01, 0x00, 0x04, 0x01, 0x4a,
-    0x4b, 0xb0, 0x1d, 0x50, 0x58, 0x40, 0x1d, 0x00, 0x02, 0x03, 0x04, 0x03, 0x02, 0x04, 0x70, 0x00, 0x03, 0x03, 0x01,
-    0x5b, 0x00, 0x01, 0x01, 0x1d, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x59, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x4c, 0x1b, 0x40,
-    0x1a, 0x00, 0x02, 0x03, 0x04, 0x03, 0x02, 0x04, 0x70, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x5d, 0x00, 0x03, 0x03,
-    0x01, 0x5b, 0x00, 0x01, 0x01, 0x1d, 0x03, 0x4c, 0x59, 0xb7, 0x2d, 0x24, 0x14, 0x2d, 0x10, 0x05, 0x06, 0x19, 0x2b,
-    0x01, 0x23, 0x13, 0x2e, 0x03, 0x37, 0x37, 0x3e, 0x05, 0x17, 0x1e, 0x03, 0x07, 0x23, 0x36, 0x2e, 0x02, 0x27, 0x26,
-    0x0e, 0x04, 0x07, 0x07, 0x06, 0x14, 0x1e, 0x03, 0x17, 0x17, 0x02, 0x68, 0xb5, 0x46, 0x6d, 0x95, 0x55, 0x1a, 0x0d,
-    0x27, 0x0b, 0x30, 0x47, 0x60, 0x79, 0x91, 0x56, 0x6a, 0x9b, 0x63, 0x2b, 0x07, 0xb5, 0x05, 0x10, 0x33, 0x5b, 0x48,
-    0x3c, 0x64, 0x51, 0x3e, 0x2e, 0x1e, 0x08, 0x27, 0x07, 0x11, 0x25, 0x3e, 0x59, 0x3c, 0x76, 0xfe, 0x82, 0x01, 0x71,
-    0x15, 0x7b, 0xac, 0xca, 0x64, 0xf7, 0x4a, 0x98, 0x8c, 0x79, 0x5a, 0x32, 0x02, 0x02, 0x4f, 0x84, 0xae, 0x63, 0x3d,
-    0x76, 0x5e, 0x3c, 0x02, 0x02, 0x29, 0x49, 0x5f, 0x6b, 0x6d, 0x31, 0xfa, 0x30, 0x6a, 0x67, 0x5e, 0x49, 0x2e, 0x03,
-    0x01, 0x00, 0x01, 0x00, 0xa5, 0xfe, 0x82, 0x04, 0x34, 0x04, 0x51, 0x00, 0x24, 0x00, 0x53, 0xb5, 0x02, 0x01, 0x00,
-    0x04, 0x01, 0x4a, 0x4b, 0xb0, 0x1d, 0x50, 0x58, 0x40, 0x1d, 0x00, 0x02, 0x03, 0x04, 0x03, 0x02, 0x04, 0x70, 0x00,
-    0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x1f, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x59, 0x00, 0x00, 0x00, 0x1a, 0x00,
-    0x4c, 0x1b, 0x40, 0x1a, 0x00, 0x02, 0x03, 0x04, 0x03, 0x02, 0x04, 0x70, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x5d,
-    0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x1f, 0x03, 0x4c, 0x59, 0xb7, 0x29, 0x24, 0x14, 0x2b, 0x10, 0x05,
-    0x06, 0x19, 0x2b, 0x01, 0x23, 0x13, 0x2e, 0x03, 0x37, 0x37, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x27, 0x36, 0x2e,
-    0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x17, 0x02, 0x3d, 0xb5, 0x45, 0x5b, 0x77, 0x42,
-    0x14, 0x09, 0x05, 0x0d, 0x54, 0x89, 0xbb, 0x72, 0x54, 0x87, 0x5f, 0x30, 0x04, 0xaa, 0x02, 0x17, 0x32, 0x4d, 0x33,
-    0x4e, 0x79, 0x55, 0x34, 0x09, 0x06, 0x07, 0x06, 0x29, 0x55, 0x4a, 0x6f, 0xfe, 0x82, 0x01, 0x72, 0x16, 0x6d, 0x92,
-    0xa9, 0x53, 0x2b, 0x69, 0xc5, 0x99, 0x5a, 0x03, 0x02, 0x3e, 0x69, 0x8f, 0x52, 0x01, 0x2f, 0x56, 0x42, 0x29, 0x02,
-    0x03, 0x48, 0x72, 0x8d, 0x43, 0x2a, 0x39, 0x85, 0x72, 0x4e, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x42,
-    0x00, 0x00, 0x04, 0xba, 0x05, 0x3e, 0x00, 0x13, 0x00, 0x27, 0x40, 0x24, 0x13, 0x12, 0x11, 0x10, 0x0d, 0x0c, 0x0b,
-    0x0a, 0x09, 0x08, 0x07, 0x06, 0x03, 0x02, 0x01, 0x0f, 0x00, 0x01, 0x01, 0x4a, 0x00, 0x01, 0x00, 0x01, 0x72, 0x00,
-    0x00, 0x00, 0x17, 0x00, 0x4c, 0x19, 0x14, 0x02, 0x06, 0x16, 0x2b, 0x01, 0x17, 0x07, 0x27, 0x03, 0x23, 0x01, 0x27,
-    0x37, 0x17, 0x01, 0x27, 0x37, 0x17, 0x13, 0x33, 0x01, 0x17, 0x07, 0x27, 0x02, 0x2e, 0xfc, 0x52, 0xfc, 0xea, 0xb0,
-    0x01, 0x25, 0xfb, 0x52, 0xfe, 0x01, 0x0d, 0xfd, 0x54, 0xfc, 0xf2, 0xac, 0xfe, 0xd4, 0xff, 0x55, 0xfa, 0x01, 0xb7,
-    0xac, 0x72, 0xa9, 0xfe, 0xbe, 0x01, 0x95, 0xab, 0x72, 0xaa, 0x01, 0x75, 0xab, 0x74, 0xaa, 0x01, 0x4c, 0xfe, 0x61,
-    0xab, 0x71, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x30, 0x04, 0xa6, 0x04, 0x18, 0x05, 0xfc, 0x00, 0x07, 0x00,
-    0x8c, 0x4b, 0xb0, 0x14, 0x50, 0x58, 0x40, 0x18, 0x00, 0x02, 0x01, 0x01, 0x02, 0x66, 0x00, 0x00, 0x03, 0x03, 0x00,
-    0x67, 0x04, 0x01, 0x03, 0x03, 0x01, 0x59, 0x00, 0x01, 0x01, 0x16, 0x03, 0x4c, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58,
-    0x40, 0x17, 0x00, 0x02, 0x01, 0x01, 0x02, 0x66, 0x00, 0x00, 0x03, 0x00, 0x73, 0x04, 0x01, 0x03, 0x03, 0x01, 0x59,
-    0x00, 0x01, 0x01, 0x16, 0x03, 0x4c, 0x1b, 0x4b, 0xb0, 0x1f, 0x50, 0x58, 0x40, 0x16, 0x00, 0x02, 0x01, 0x02, 0x72,
-    0x00, 0x00, 0x03, 0x00, 0x73, 0x04, 0x01, 0x03, 0x03, 0x01, 0x59, 0x00, 0x01, 0x01, 0x16, 0x03, 0x4c, 0x1b, 0x40,
-    0x1b, 0x00, 0x02, 0x01, 0x02, 0x72, 0x00, 0x00, 0x03, 0x00, 0x73, 0x00, 0x01, 0x03, 0x03, 0x01, 0x55, 0x00, 0x01,
-    0x01, 0x03, 0x5a, 0x04, 0x01, 0x03, 0x01, 0x03, 0x4e, 0x59, 0x59, 0x59, 0x40, 0x0c, 0x00, 0x00, 0x00, 0x07, 0x00,
-    0x07, 0x11, 0x11, 0x11, 0x05, 0x06, 0x17, 0x2b, 0x01, 0x07, 0x27, 0x37, 0x21, 0x37, 0x17, 0x07, 0x01, 0xe9, 0x17,
-    0xa2, 0x2a, 0x02, 0x0b, 0x12, 0xa1, 0x26, 0x05, 0x23, 0x7d, 0x01, 0xe9, 0x6c, 0x01, 0xd8, 0x00, 0x01, 0x01, 0x73,
-    0x05, 0x16, 0x04, 0x53, 0x06, 0x14, 0x00, 0x15, 0x00, 0x57, 0xb6, 0x0b, 0x08, 0x02, 0x02, 0x03, 0x01, 0x4a, 0x4b,
-    0xb0, 0x26, 0x50, 0x58, 0x40, 0x15, 0x00, 0x01, 0x00, 0x03, 0x02, 0x01, 0x03, 0x63, 0x04, 0x01, 0x02, 0x02, 0x00,
-    0x5b, 0x05, 0x01, 0x00, 0x00, 0x16, 0x02, 0x4c, 0x1b, 0x40, 0x1b, 0x05, 0x01, 0x00, 0x03, 0x02, 0x00, 0x57, 0x00,
-    0x01, 0x00, 0x03, 0x02, 0x01, 0x03, 0x63, 0x05, 0x01, 0x00, 0x00, 0x02, 0x5b, 0x04, 0x01, 0x02, 0x00, 0x02, 0x4f,
-    0x59, 0x40, 0x11, 0x01, 0x00, 0x14, 0x12, 0x0f, 0x0d, 0x0a, 0x09, 0x06, 0x04, 0x00, 0x15, 0x01, 0x15, 0x06, 0x06,
-    0x14, 0x2b, 0x01, 0x3e, 0x03, 0x17, 0x16, 0x16, 0x07, 0x07, 0x27, 0x37, 0x36, 0x26, 0x27, 0x26, 0x0e, 0x02, 0x07,
-    0x07, 0x37, 0x01, 0xa4, 0x40, 0x75, 0x74, 0x74, 0x3e, 0x64, 0x70, 0x05, 0x03, 0x7a, 0x02, 0x03, 0x29, 0x32, 0x3b,
-    0x74, 0x74, 0x77, 0x3e, 0x30, 0x0c, 0x05, 0x96, 0x01, 0x28, 0x2f, 0x26, 0x01, 0x01, 0x6f, 0x66, 0x27, 0x01, 0x14,
-    0x30, 0x36, 0x02, 0x02, 0x26, 0x2e, 0x28, 0x01, 0x01, 0x7f, 0x00, 0x00, 0x00, 0x01, 0x02, 0x52, 0x05, 0x15, 0x03,
-    0x21, 0x06, 0x57, 0x00, 0x05, 0x00, 0x11, 0x40, 0x0e, 0x05, 0x04, 0x03, 0x03, 0x00, 0x47, 0x00, 0x00, 0x00, 0x69,
-    0x11, 0x01, 0x06, 0x15, 0x2b, 0x01, 0x37, 0x33, 0x07, 0x17, 0x07, 0x02, 0x52, 0x15, 0xb0, 0x1c, 0x26, 0x4e, 0x05,
-    0xe5, 0x72, 0x97, 0x72, 0x39, 0x00, 0x00, 0x00, 0x01, 0x02, 0xaf, 0x05, 0x17, 0x03, 0xc4, 0x06, 0x57, 0x00, 0x05,
-    0x00, 0x0f, 0x40, 0x0c, 0x01, 0x01, 0x00, 0x47, 0x00, 0x00, 0x00, 0x69, 0x13, 0x01, 0x06, 0x15, 0x2b, 0x01, 0x27,
-    0x37, 0x37, 0x33, 0x07, 0x02, 0xf6, 0x47, 0x4f, 0x16, 0xb0, 0x17, 0x05, 0x17, 0x49, 0x75, 0x82, 0x84, 0x00, 0x08,
-    0xfe, 0xdd, 0xfe, 0xc3, 0x06, 0x3d, 0x05, 0xb0, 0x00, 0x13, 0x00, 0x23, 0x00, 0x35, 0x00, 0x47, 0x00, 0x5b, 0x00,
-    0x6d, 0x00, 0x81, 0x00, 0x95, 0x01, 0xaa, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x64, 0x20, 0x03, 0x02, 0x01, 0x02,
-    0x04, 0x02, 0x01, 0x04, 0x70, 0x25, 0x17, 0x15, 0x21, 0x07, 0x05, 0x05, 0x06, 0x08, 0x06, 0x05, 0x68, 0x26, 0x1b,
-    0x19, 0x22, 0x0b, 0x05, 0x09, 0x0a, 0x0c, 0x0a, 0x09, 0x68, 0x24, 0x13, 0x02, 0x11, 0x12, 0x11, 0x73, 0x14, 0x01,
-    0x04, 0x16, 0x01, 0x06, 0x05, 0x04, 0x06, 0x63, 0x18, 0x01, 0x08, 0x1a, 0x01, 0x0a, 0x09, 0x08, 0x0a, 0x63, 0x1c,
-    0x01, 0x0c, 0x1e, 0x01, 0x0e, 0x0d, 0x0c, 0x0e, 0x63, 0x00, 0x10, 0x00, 0x12, 0x11, 0x10, 0x12, 0x63, 0x00, 0x02,
-    0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x16, 0x4b, 0x27, 0x1f, 0x1d, 0x23, 0x0f, 0x05, 0x0d, 0x0d, 0x17, 0x0d, 0x4c,
-    0x1b, 0x4b, 0xb0, 0x1f, 0x50, 0x58, 0x40, 0x66, 0x20, 0x03, 0x02, 0x01, 0x02, 0x04, 0x02, 0x01, 0x04, 0x70, 0x25,
-    0x17, 0x15, 0x21, 0x07, 0x05, 0x05, 0x06, 0x08, 0x06, 0x05, 0x08, 0x70, 0x26, 0x1b, 0x19, 0x22, 0x0b, 0x05, 0x09,
-    0x0a, 0x0c, 0x0a, 0x09, 0x0c, 0x70, 0x24, 0x13, 0x02, 0x11, 0x12, 0x11, 0x73, 0x14, 0x01, 0x04, 0x16, 0x01, 0x06,
-    0x05, 0x04, 0x06, 0x63, 0x18, 0x01, 0x08, 0x1a, 0x01, 0x0a, 0x09, 0x08, 0x0a, 0x63, 0x1c, 0x01, 0x0c, 0x1e, 0x01,
-    0x0e, 0x0d, 0x0c, 0x0e, 0x63, 0x00, 0x10, 0x00, 0x12, 0x11, 0x10, 0x12, 0x63, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00,
-    0x00, 0x00, 0x16, 0x4b, 0x27, 0x1f, 0x1d, 0x23, 0x0f, 0x05, 0x0d, 0x0d, 0x17, 0x0d, 0x4c, 0x1b, 0x40, 0x69, 0x20,
-    0x03, 0x02, 0x01, 0x02, 0x04, 0x02, 0x01, 0x04, 0x70, 0x25, 0x17, 0x15, 0x21, 0x07, 0x05, 0x05, 0x06, 0x08, 0x06,
-    0x05, 0x08, 0x70, 0x26, 0x1b, 0x19, 0x22, 0x0b, 0x05, 0x09, 0x0a, 0x0c, 0x0a, 0x09, 0x0c, 0x70, 0x27, 0x1f, 0x1d,
-    0x23, 0x0f, 0x05, 0x0d, 0x0e, 0x10, 0x0e, 0x0d, 0x10, 0x70, 0x24, 0x13, 0x02, 0x11, 0x12, 0x11, 0x73, 0x14, 0x01,
-    0x04, 0x16, 0x01, 0x06, 0x05, 0x04, 0x06, 0x63, 0x18, 0x01, 0x08, 0x1a, 0x01, 0x0a, 0x09, 0x08, 0x0a, 0x63, 0x1c,
-    0x01, 0x0c, 0x1e, 0x01, 0x0e, 0x0d, 0x0c, 0x0e, 0x63, 0x00, 0x10, 0x00, 0x12, 0x11, 0x10, 0x12, 0x63, 0x00, 0x02,
-    0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x16, 0x02, 0x4c, 0x59, 0x59, 0x40, 0x60, 0x82, 0x82, 0x6e, 0x6e, 0x5c, 0x5c,
-    0x48, 0x48, 0x36, 0x36, 0x24, 0x24, 0x14, 0x14, 0x00, 0x00, 0x82, 0x95, 0x82, 0x95, 0x91, 0x8f, 0x8b, 0x8a, 0x88,
-    0x86, 0x6e, 0x81, 0x6e, 0x81, 0x7d, 0x7b, 0x77, 0x76, 0x74, 0x72, 0x5c, 0x6d, 0x5c, 0x6d, 0x6b, 0x69, 0x65, 0x64,
-    0x62, 0x60, 0x48, 0x5b, 0x48, 0x5b, 0x59, 0x57, 0x53, 0x52, 0x4e, 0x4c, 0x36, 0x47, 0x36, 0x47, 0x45, 0x43, 0x3f,
-    0x3e, 0x3c, 0x3a, 0x24, 0x35, 0x24, 0x35, 0x33, 0x31, 0x2d, 0x2c, 0x2a, 0x28, 0x14, 0x23, 0x14, 0x23, 0x21, 0x1f,
-    0x1b, 0x1a, 0x18, 0x16, 0x00, 0x13, 0x00, 0x13, 0x24, 0x14, 0x24, 0x28, 0x06, 0x17, 0x2b, 0x01, 0x3e, 0x03, 0x17,
-    0x32, 0x1e, 0x02, 0x07, 0x23, 0x36, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x07, 0x01, 0x36, 0x36, 0x17, 0x16, 0x16, 0x07,
-    0x23, 0x36, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x07, 0x03, 0x3e, 0x03, 0x17, 0x16, 0x16, 0x07, 0x23, 0x36, 0x2e, 0x02,
-    0x23, 0x22, 0x06, 0x07, 0x01, 0x3e, 0x03, 0x17, 0x16, 0x16, 0x07, 0x23, 0x36, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x07,
-    0x01, 0x3e, 0x03, 0x17, 0x32, 0x1e, 0x02, 0x07, 0x23, 0x36, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x07, 0x01, 0x3e, 0x03,
-    0x17, 0x16, 0x16, 0x07, 0x23, 0x36, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x07, 0x01, 0x3e, 0x03, 0x17, 0x16, 0x16, 0x07,
-    0x23, 0x36, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x03, 0x3e, 0x03, 0x17, 0x16, 0x16, 0x07, 0x23, 0x36, 0x2e,
-    0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x02, 0x39, 0x06, 0x25, 0x39, 0x4b, 0x2d, 0x2b, 0x46, 0x31, 0x1a, 0x01, 0x6d,
-    0x01, 0x06, 0x12, 0x20, 0x18, 0x2f, 0x32, 0x0b, 0x01, 0x9e, 0x0d, 0x76, 0x59, 0x58, 0x66, 0x02, 0x6e, 0x01, 0x06,
-    0x12, 0x1f, 0x18, 0x2f, 0x32, 0x0b, 0x0f, 0x06, 0x24, 0x38, 0x4b, 0x2d, 0x57, 0x65, 0x02, 0x6d, 0x01, 0x06, 0x12,
-    0x1f, 0x18, 0x2f, 0x33, 0x0b, 0xfe, 0x7b, 0x06, 0x24, 0x38, 0x4b, 0x2d, 0x57, 0x65, 0x02, 0x6d, 0x01, 0x06, 0x12,
-    0x1f, 0x18, 0x2f, 0x33, 0x0b, 0xfd, 0x34, 0x06, 0x23, 0x39, 0x4b, 0x2d, 0x2b, 0x46, 0x31, 0x1a, 0x01, 0x6e, 0x01,
-    0x06, 0x12, 0x1f, 0x18, 0x2f, 0x33, 0x0b, 0xfe, 0x43, 0x07, 0x25, 0x39, 0x4b, 0x2d, 0x57, 0x66, 0x02, 0x6d, 0x01,
-    0x06, 0x12, 0x1f, 0x18, 0x30, 0x32, 0x0b, 0xfe, 0x90, 0x06, 0x25, 0x39, 0x4a, 0x2d, 0x57, 0x65, 0x02, 0x6d, 0x01,
-    0x06, 0x12, 0x1f, 0x18, 0x18, 0x23, 0x1a, 0x12, 0x06, 0x25, 0x06, 0x24, 0x39, 0x4a, 0x2d, 0x57, 0x66, 0x02, 0x6e,
-    0x01, 0x06, 0x12, 0x1f, 0x18, 0x18, 0x23, 0x19, 0x12, 0x06, 0x04, 0xf4, 0x2b, 0x46, 0x31, 0x1a, 0x01, 0x1b, 0x32,
-    0x45, 0x2b, 0x15, 0x25, 0x1c, 0x10, 0x3b, 0x29, 0xfe, 0xeb, 0x57, 0x65, 0x01, 0x01, 0x65, 0x57, 0x15, 0x25, 0x1c,
-    0x10, 0x3b, 0x29, 0xfe, 0x08, 0x2b, 0x47, 0x31, 0x1a, 0x01, 0x01, 0x66, 0x56, 0x15, 0x25, 0x1c, 0x10, 0x3b, 0x29,
-    0xfd, 0xf8, 0x2b, 0x47, 0x31, 0x1a, 0x01, 0x01, 0x66, 0x56, 0x15, 0x25, 0x1c, 0x10, 0x3b, 0x29, 0xfe, 0xe3, 0x2b,
-    0x47, 0x31, 0x1a, 0x01, 0x1b, 0x32, 0x45, 0x2b, 0x15, 0x25, 0x1c, 0x10, 0x3b, 0x29, 0x05, 0x1a, 0x2b, 0x46, 0x31,
-    0x1a, 0x01, 0x01, 0x66, 0x56, 0x15, 0x25, 0x1c, 0x10, 0x3b, 0x29, 0xfe, 0x08, 0x2b, 0x46, 0x32, 0x1a, 0x01, 0x01,
-    0x66, 0x56, 0x15, 0x25, 0x1c, 0x10, 0x10, 0x1b, 0x25, 0x14, 0xfd, 0xf8, 0x2b, 0x46, 0x32, 0x1a, 0x01, 0x01, 0x66,
-    0x56, 0x15, 0x25, 0x1c, 0x10, 0x10, 0x1b, 0x25, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x42, 0xfe, 0x63, 0x07, 0x47,
-    0x05, 0xc6, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0e, 0x00, 0x13, 0x00, 0x18, 0x00, 0x1d, 0x00, 0x22, 0x00, 0x27, 0x00,
-    0x71, 0x40, 0x1c, 0x21, 0x20, 0x16, 0x03, 0x03, 0x02, 0x27, 0x22, 0x1d, 0x18, 0x17, 0x13, 0x12, 0x11, 0x0d, 0x0c,
-    0x0a, 0x01, 0x03, 0x26, 0x25, 0x1c, 0x1b, 0x04, 0x00, 0x01, 0x03, 0x4a, 0x4b, 0xb0, 0x2e, 0x50, 0x58, 0x40, 0x1c,
-    0x05, 0x01, 0x03, 0x02, 0x01, 0x02, 0x03, 0x01, 0x70, 0x04, 0x01, 0x01, 0x00, 0x02, 0x01, 0x00, 0x6e, 0x00, 0x02,
-    0x02, 0x16, 0x4b, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x4c, 0x1b, 0x40, 0x17, 0x00, 0x02, 0x03, 0x02, 0x72, 0x05, 0x01,
-    0x03, 0x01, 0x03, 0x72, 0x04, 0x01, 0x01, 0x00, 0x01, 0x72, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x4c, 0x59, 0x40, 0x12,
-    0x05, 0x05, 0x00, 0x00, 0x05, 0x09, 0x05, 0x09, 0x08, 0x07, 0x00, 0x04, 0x00, 0x04, 0x12, 0x06, 0x06, 0x15, 0x2b,
-    0x05, 0x17, 0x03, 0x23, 0x13, 0x13, 0x27, 0x13, 0x33, 0x03, 0x01, 0x37, 0x05, 0x07, 0x25, 0x05, 0x07, 0x25, 0x37,
-    0x05, 0x01, 0x37, 0x25, 0x17, 0x05, 0x01, 0x07, 0x05, 0x27, 0x25, 0x13, 0x27, 0x03, 0x37, 0x13, 0x01, 0x17, 0x13,
-    0x07, 0x03, 0x03, 0xb8, 0x0d, 0xac, 0x65, 0x7f, 0xa1, 0x0d, 0xab, 0x64, 0x7e, 0x01, 0xad, 0x0b, 0x01, 0x37, 0x11,
-    0xfe, 0xc0, 0xfb, 0x8d, 0x0a, 0xfe, 0xc9, 0x11, 0x01, 0x40, 0x03, 0xcd, 0x03, 0x01, 0x4d, 0x3d, 0xfe, 0xcc, 0xfc,
-    0x68, 0x03, 0xfe, 0xb5, 0x3e, 0x01, 0x34, 0x69, 0x11, 0x5d, 0x43, 0x94, 0x02, 0xb2, 0x13, 0x5d, 0x45, 0x93, 0x3a,
-    0x12, 0xfe, 0xaf, 0x01, 0x60, 0x04, 0xa2, 0x10, 0x01, 0x51, 0xfe, 0xa1, 0xfe, 0x11, 0x0a, 0x7f, 0x5c, 0x45, 0x3c,
-    0x0a, 0x7f, 0x5b, 0x44, 0x01, 0xae, 0x11, 0x99, 0x4d, 0xbf, 0xfc, 0x8d, 0x12, 0x99, 0x4e, 0xbf, 0x02, 0xe5, 0x02,
-    0x01, 0x4f, 0x3d, 0xfe, 0xd1, 0xfc, 0xe6, 0x02, 0xfe, 0xb1, 0x3e, 0x01, 0x2f, 0x00, 0x00, 0x03, 0x00, 0x51, 0x00,
-    0x00, 0x04, 0xa7, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x36, 0x40, 0x33, 0x03, 0x02, 0x02, 0x03,
-    0x04, 0x01, 0x01, 0x00, 0x02, 0x02, 0x4a, 0x00, 0x03, 0x05, 0x01, 0x02, 0x00, 0x03, 0x02, 0x63, 0x00, 0x04, 0x04,
-    0x01, 0x5b, 0x00, 0x01, 0x01, 0x16, 0x4b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x04, 0x04, 0x1f, 0x1d, 0x15, 0x13,
-    0x04, 0x12, 0x04, 0x11, 0x21, 0x15, 0x06, 0x06, 0x16, 0x2b, 0x01, 0x07, 0x01, 0x37, 0x01, 0x03, 0x23, 0x13, 0x05,
-    0x1e, 0x03, 0x07, 0x0e, 0x03, 0x23, 0x25, 0x05, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x25, 0x03, 0xf8,
-    0x83, 0xfe, 0xf1, 0x81, 0xfe, 0x84, 0x66, 0xb4, 0xfc, 0x01, 0xbf, 0x5c, 0x9b, 0x6d, 0x37, 0x08, 0x09, 0x5c, 0x91,
-    0xb9, 0x64, 0xfe, 0xf9, 0x01, 0x0c, 0x42, 0x76, 0x5d, 0x3d, 0x08, 0x07, 0x19, 0x3b, 0x5b, 0x3b, 0xfe, 0xe0, 0x01,
-    0xcc, 0x40, 0x01, 0xf4, 0x41, 0xfe, 0x87, 0xfd, 0xb8, 0x05, 0xb0, 0x01, 0x03, 0x3f, 0x70, 0x9b, 0x5f, 0x69, 0xa5,
-    0x72, 0x3c, 0x99, 0x02, 0x29, 0x4b, 0x6c, 0x43, 0x39, 0x63, 0x4a, 0x2d, 0x03, 0x01, 0x00, 0x00, 0x03, 0xff, 0xf7,
-    0xfe, 0x60, 0x04, 0x1c, 0x04, 0x50, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x2c, 0x00, 0x67, 0x40, 0x14, 0x11, 0x01, 0x04,
-    0x02, 0x25, 0x03, 0x02, 0x03, 0x05, 0x04, 0x0c, 0x01, 0x00, 0x05, 0x01, 0x01, 0x01, 0x00, 0x04, 0x4a, 0x4b, 0xb0,
-    0x19, 0x50, 0x58, 0x40, 0x1b, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x03, 0x01, 0x02, 0x02, 0x18, 0x4b, 0x00, 0x05, 0x05,
-    0x00, 0x5b, 0x00, 0x00, 0x00, 0x20, 0x4b, 0x00, 0x01, 0x01, 0x1a, 0x01, 0x4c, 0x1b, 0x40, 0x1f, 0x00, 0x02, 0x02,
-    0x18, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x1f, 0x4b, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00,
-    0x00, 0x20, 0x4b, 0x00, 0x01, 0x01, 0x1a, 0x01, 0x4c, 0x59, 0x40, 0x09, 0x24, 0x2b, 0x23, 0x11, 0x13, 0x28, 0x06,
-    0x06, 0x1a, 0x2b, 0x05, 0x07, 0x01, 0x37, 0x25, 0x0e, 0x03, 0x27, 0x26, 0x26, 0x27, 0x03, 0x23, 0x01, 0x37, 0x07,
-    0x36, 0x36, 0x17, 0x1e, 0x05, 0x07, 0x23, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x06, 0x07, 0x03, 0x16, 0x17, 0x16, 0x3e,
-    0x02, 0x37, 0x03, 0xad, 0x73, 0xfe, 0xd9, 0x75, 0x01, 0x8b, 0x0c, 0x47, 0x79, 0xae, 0x73, 0x52, 0x92, 0x35, 0x61,
-    0xb5, 0x01, 0x04, 0xa4, 0x13, 0x3f, 0x9d, 0x5f, 0x4a, 0x6e, 0x4f, 0x31, 0x19, 0x04, 0x07, 0xb5, 0x07, 0x07, 0x2e,
-    0x5c, 0x4e, 0x55, 0x82, 0x32, 0x5b, 0x3c, 0x99, 0x54, 0x7d, 0x57, 0x33, 0x0a, 0x06, 0x56, 0x01, 0x7e, 0x56, 0xa0,
-    0x64, 0xc9, 0xa0, 0x62, 0x02, 0x02, 0x3b, 0x41, 0xfd, 0xf7, 0x05, 0xda, 0x01, 0x77, 0x45, 0x47, 0x02, 0x02, 0x30,
-    0x51, 0x6a, 0x78, 0x7f, 0x3d, 0x3d, 0x87, 0x72, 0x4c, 0x02, 0x02, 0x53, 0x42, 0xfd, 0xf5, 0x8c, 0x05, 0x02, 0x48,
-    0x76, 0x92, 0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x48, 0x00, 0x00, 0x04, 0xf6, 0x06, 0xff, 0x00, 0x07, 0x00, 0x1f,
-    0x40, 0x1c, 0x00, 0x03, 0x02, 0x03, 0x72, 0x00, 0x00, 0x00, 0x02, 0x59, 0x00, 0x02, 0x02, 0x16, 0x4b, 0x00, 0x01,
-    0x01, 0x17, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x10, 0x04, 0x06, 0x18, 0x2b, 0x01, 0x21, 0x03, 0x23, 0x13, 0x21, 0x13,
-    0x33, 0x04, 0xa1, 0xfd, 0x3f, 0xe2, 0xb6, 0xfd, 0x02, 0xc1, 0x3b, 0xb5, 0x05, 0x18, 0xfa, 0xe8, 0x05, 0xb0, 0x01,
-    0x4f, 0x00, 0x01, 0x00, 0x48, 0x00, 0x00, 0x04, 0x9c, 0x05, 0x77, 0x00, 0x07, 0x00, 0x1f, 0x40, 0x1c, 0x00, 0x03,
-    0x02, 0x03, 0x72, 0x00, 0x00, 0x00, 0x02, 0x59, 0x00, 0x02, 0x02, 0x18, 0x4b, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c,
-    0x11, 0x11, 0x11, 0x10, 0x04, 0x06, 0x18, 0x2b, 0x01, 0x21, 0x03, 0x23, 0x13, 0x21, 0x13, 0x33, 0x04, 0x4a, 0xfd,
-    0x55, 0xa1, 0xb6, 0xbc, 0x02, 0xab, 0x38, 0xb5, 0x03, 0xa1, 0xfc, 0x5f, 0x04, 0x3a, 0x01, 0x3d, 0x00, 0x01, 0x00,
-    0x4b, 0xfe, 0xde, 0x04, 0xa9, 0x05, 0xb0, 0x00, 0x1d, 0x00, 0x2c, 0x40, 0x29, 0x00, 0x01, 0x00, 0x04, 0x05, 0x01,
-    0x04, 0x63, 0x00, 0x03, 0x00, 0x02, 0x03, 0x02, 0x5f, 0x00, 0x00, 0x00, 0x06, 0x59, 0x00, 0x06, 0x06, 0x16, 0x4b,
-    0x00, 0x05, 0x05, 0x17, 0x05, 0x4c, 0x11, 0x11, 0x28, 0x11, 0x18, 0x21, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x01, 0x21,
-    0x03, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x37, 0x3e, 0x03, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x03, 0x23,
-    0x13, 0x21, 0x04, 0x8e, 0xfd, 0x55, 0x52, 0xa6, 0x80, 0xc2, 0x7e, 0x36, 0x0d, 0x0d, 0x50, 0x88, 0xc1, 0x7e, 0x0f,
-    0x58, 0x7d, 0x54, 0x2e, 0x09, 0x0a, 0x19, 0x4c, 0x81, 0x5d, 0xbd, 0x74, 0xb6, 0xfd, 0x03, 0x61, 0x05, 0x18, 0xfe,
-    0x2a, 0x01, 0x03, 0x54, 0x95, 0xcf, 0x7e, 0x78, 0xc9, 0x93, 0x53, 0x03, 0x93, 0x02, 0x44, 0x71, 0x91, 0x4f, 0x57,
-    0x94, 0x6c, 0x3e, 0x02, 0x01, 0xfd, 0x60, 0x05, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x4a, 0xfe, 0xe0, 0x04,
-    0x60, 0x04, 0x3a, 0x00, 0x1d, 0x00, 0x2b, 0x40, 0x28, 0x0e, 0x0d, 0x02, 0x03, 0x47, 0x00, 0x01, 0x00, 0x02, 0x03,
-    0x01, 0x02, 0x63, 0x00, 0x00, 0x00, 0x04, 0x59, 0x00, 0x04, 0x04, 0x18, 0x4b, 0x00, 0x03, 0x03, 0x17, 0x03, 0x4c,
-    0x1d, 0x1c, 0x1b, 0x1a, 0x19, 0x17, 0x21, 0x10, 0x05, 0x06, 0x16, 0x2b, 0x01, 0x21, 0x03, 0x17, 0x1e, 0x03, 0x07,
-    0x0e, 0x03, 0x07, 0x27, 0x3e, 0x03, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x03, 0x23, 0x13, 0x21, 0x04, 0x45, 0xfd,
-    0x5c, 0x31, 0xc7, 0x65, 0xa8, 0x75, 0x39, 0x0a, 0x09, 0x4f, 0x78, 0x99, 0x54, 0x24, 0x3c, 0x66, 0x4e, 0x32, 0x08,
-    0x08, 0x1c, 0x42, 0x67, 0x42, 0xde, 0x54, 0xb6, 0xbc, 0x03, 0x5a, 0x03, 0xa1, 0xfe, 0xe5, 0x01, 0x03, 0x44, 0x7a,
-    0xaa, 0x68, 0x5a, 0x9a, 0x79, 0x53, 0x12, 0x96, 0x10, 0x37, 0x4f, 0x67, 0x40, 0x42, 0x6d, 0x50, 0x2f, 0x02, 0x01,
-    0xfe, 0x1c, 0x04, 0x3a, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x05, 0x0f, 0x05, 0xb0, 0x00, 0x14, 0x00, 0x70, 0xb5,
-    0x01, 0x01, 0x01, 0x06, 0x01, 0x4a, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x24, 0x00, 0x02, 0x01, 0x00, 0x01, 0x02,
-    0x68, 0x08, 0x01, 0x06, 0x03, 0x01, 0x01, 0x02, 0x06, 0x01, 0x62, 0x0a, 0x09, 0x02, 0x05, 0x05, 0x16, 0x4b, 0x00,
-    0x07, 0x07, 0x18, 0x4b, 0x04, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x1b, 0x40, 0x25, 0x00, 0x02, 0x01, 0x00, 0x01,
-    0x02, 0x00, 0x70, 0x08, 0x01, 0x06, 0x03, 0x01, 0x01, 0x02, 0x06, 0x01, 0x62, 0x0a, 0x09, 0x02, 0x05, 0x05, 0x16,
-    0x4b, 0x00, 0x07, 0x07, 0x18, 0x4b, 0x04, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x59, 0x40, 0x12, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x0b, 0x06, 0x1d, 0x2b, 0x01, 0x01, 0x13,
-    0x23, 0x03, 0x27, 0x07, 0x23, 0x37, 0x23, 0x03, 0x23, 0x13, 0x33, 0x03, 0x33, 0x13, 0x33, 0x03, 0x33, 0x01, 0x05,
-    0x0f, 0xfe, 0x3d, 0xe7, 0xd7, 0xc8, 0x36, 0x2f, 0x92, 0x2c, 0x61, 0x73, 0xb5, 0xfd, 0xb5, 0x71, 0x61, 0x2d, 0x92,
-    0x32, 0x31, 0x01, 0x93, 0x05, 0xb0, 0xfd, 0x46, 0xfd, 0x0a, 0x02, 0x94, 0x01, 0xf6, 0xf5, 0xfd, 0x6c, 0x05, 0xb0,
-    0xfd, 0x7b, 0x01, 0x01, 0xfe, 0xfe, 0x02, 0x86, 0x00, 0x00, 0x00, 0x01, 0x00, 0x36, 0x00, 0x00, 0x04, 0x93, 0x04,
-    0x3a, 0x00, 0x14, 0x00, 0xa5, 0xb5, 0x01, 0x01, 0x01, 0x06, 0x01, 0x4a, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40, 0x26,
-    0x00, 0x07, 0x05, 0x06, 0x06, 0x07, 0x68, 0x00, 0x02, 0x01, 0x00, 0x01, 0x02, 0x68, 0x08, 0x01, 0x06, 0x03, 0x01,
-    0x01, 0x02, 0x06, 0x01, 0x62, 0x0a, 0x09, 0x02, 0x05, 0x05, 0x18, 0x4b, 0x04, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c,
-    0x1b, 0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40, 0x27, 0x00, 0x07, 0x05, 0x06, 0x05, 0x07, 0x06, 0x70, 0x00, 0x02, 0x01,
-    0x00, 0x01, 0x02, 0x68, 0x08, 0x01, 0x06, 0x03, 0x01, 0x01, 0x02, 0x06, 0x01, 0x62, 0x0a, 0x09, 0x02, 0x05, 0x05,
-    0x18, 0x4b, 0x04, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x1b, 0x40, 0x28, 0x00, 0x07, 0x05, 0x06, 0x05, 0x07, 0x06,
-    0x70, 0x00, 0x02, 0x01, 0x00, 0x01, 0x02, 0x00, 0x70, 0x08, 0x01, 0x06, 0x03, 0x01, 0x01, 0x02, 0x06, 0x01, 0x62,
-    0x0a, 0x09, 0x02, 0x05, 0x05, 0x18, 0x4b, 0x04, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x59, 0x59, 0x40, 0x12, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x0b, 0x06, 0x1d, 0x2b, 0x09,
-    0x02, 0x23, 0x03, 0x27, 0x07, 0x23, 0x37, 0x23, 0x03, 0x23, 0x13, 0x33, 0x03, 0x33, 0x37, 0x33, 0x07, 0x37, 0x01,
-    0x04, 0x93, 0xfe, 0x56, 0x01, 0x05, 0xd8, 0xbc, 0x33, 0x27, 0x91, 0x23, 0x56, 0x51, 0xb5, 0xbc, 0xb5, 0x50, 0x56,
-    0x26, 0x91, 0x2b, 0x29, 0x01, 0x4b, 0x04, 0x3a, 0xfd, 0xf4, 0xfd, 0xd2, 0x01, 0xcd, 0x01, 0xc3, 0xc2, 0xfe, 0x33,
-    0x04, 0x3a, 0xfe, 0x36, 0xd5, 0xd7, 0x01, 0x01, 0xcb, 0x00, 0x00, 0x00, 0x01, 0x00, 0xa5, 0x00, 0x00, 0x04, 0xf6,
-    0x05, 0xb0, 0x00, 0x0e, 0x00, 0x2d, 0x40, 0x2a, 0x0c, 0x01, 0x00, 0x04, 0x01, 0x4a, 0x00, 0x04, 0x00, 0x00, 0x01,
-    0x04, 0x00, 0x61, 0x00, 0x02, 0x02, 0x03, 0x59, 0x05, 0x01, 0x03, 0x03, 0x16, 0x4b, 0x06, 0x01, 0x01, 0x01, 0x17,
-    0x01, 0x4c, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x01, 0x23, 0x03, 0x23, 0x13, 0x21,
-    0x37, 0x21, 0x03, 0x33, 0x01, 0x33, 0x01, 0x13, 0x23, 0x02, 0x90, 0x6a, 0x73, 0xb4, 0xe3, 0xfe, 0xc3, 0x1b, 0x01,
-    0xf0, 0x71, 0x59, 0x01, 0x86, 0xd8, 0xfe, 0x43, 0xdd, 0xd2, 0x02, 0x93, 0xfd, 0x6d, 0x05, 0x18, 0x98, 0xfd, 0x7a,
-    0x02, 0x86, 0xfd, 0x34, 0xfd, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x6f, 0x00, 0x00, 0x04, 0xc6, 0x04, 0x3a,
-    0x00, 0x0e, 0x00, 0x2d, 0x40, 0x2a, 0x0c, 0x01, 0x00, 0x04, 0x01, 0x4a, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00,
-    0x61, 0x00, 0x02, 0x02, 0x03, 0x59, 0x05, 0x01, 0x03, 0x03, 0x18, 0x4b, 0x06, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4c,
-    0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x01, 0x23, 0x03, 0x23, 0x13, 0x21, 0x37, 0x21,
-    0x03, 0x33, 0x01, 0x33, 0x01, 0x13, 0x23, 0x02, 0x94, 0x86, 0x50, 0xb5, 0xa1, 0xfe, 0xc5, 0x1b, 0x01, 0xf0, 0x50,
-    0x74, 0x01, 0x42, 0xe6, 0xfe, 0x5f, 0xfb, 0xd8, 0x01, 0xcd, 0xfe, 0x33, 0x03, 0xa1, 0x99, 0xfe, 0x36, 0x01, 0xca,
-    0xfd, 0xf4, 0xfd, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x05, 0x0c, 0x05, 0xb0, 0x00, 0x0d,
-    0x00, 0x27, 0x40, 0x24, 0x00, 0x00, 0x00, 0x04, 0x03, 0x00, 0x04, 0x62, 0x00, 0x02, 0x02, 0x01, 0x59, 0x06, 0x01,
-    0x01, 0x01, 0x16, 0x4b, 0x05, 0x01, 0x03, 0x03, 0x17, 0x03, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x07,
-    0x06, 0x1b, 0x2b, 0x01, 0x21, 0x13, 0x21, 0x07, 0x21, 0x03, 0x23, 0x13, 0x21, 0x03, 0x23, 0x13, 0x33, 0x01, 0x45,
-    0x01, 0x67, 0x72, 0x01, 0xee, 0x1b, 0xfe, 0xc6, 0xe2, 0xb4, 0x71, 0xfe, 0x99, 0x70, 0xb5, 0xfd, 0xb5, 0x03, 0x1f,
-    0x02, 0x91, 0x98, 0xfa, 0xe8, 0x02, 0x87, 0xfd, 0x79, 0x05, 0xb0, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x04,
-    0xcd, 0x04, 0x3a, 0x00, 0x0d, 0x00, 0x27, 0x40, 0x24, 0x00, 0x00, 0x00, 0x04, 0x03, 0x00, 0x04, 0x62, 0x00, 0x02,
-    0x02, 0x01, 0x59, 0x06, 0x01, 0x01, 0x01, 0x18, 0x4b, 0x05, 0x01, 0x03, 0x03, 0x17, 0x03, 0x4c, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x01, 0x21, 0x13, 0x21, 0x07, 0x21, 0x03, 0x23, 0x13, 0x21, 0x03,
-    0x23, 0x13, 0x33, 0x01, 0x21, 0x01, 0x6f, 0x52, 0x01, 0xeb, 0x1b, 0xfe, 0xca, 0xa1, 0xb5, 0x51, 0xfe, 0x90, 0x50,
-    0xb5, 0xbc, 0xb5, 0x02, 0x65, 0x01, 0xd5, 0x99, 0xfc, 0x5f, 0x01, 0xce, 0xfe, 0x32, 0x04, 0x3a, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0xfe, 0xdd, 0x04, 0x42, 0x05, 0xb0, 0x00, 0x23, 0x00, 0x33, 0x40, 0x30, 0x1b, 0x01, 0x03, 0x00, 0x01,
-    0x4a, 0x00, 0x00, 0x04, 0x03, 0x04, 0x00, 0x03, 0x70, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01, 0x5f, 0x00, 0x04, 0x04,
-    0x06, 0x59, 0x00, 0x06, 0x06, 0x16, 0x4b, 0x05, 0x01, 0x03, 0x03, 0x17, 0x03, 0x4c, 0x11, 0x11, 0x11, 0x1e, 0x11,
-    0x1a, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x01, 0x1e, 0x05, 0x07, 0x0e, 0x03, 0x07, 0x37, 0x3e, 0x05, 0x37, 0x36, 0x36,
-    0x2e, 0x03, 0x27, 0x03, 0x23, 0x13, 0x23, 0x03, 0x23, 0x13, 0x21, 0x02, 0xef, 0x4b, 0x70, 0x4f, 0x30, 0x17, 0x02,
-    0x07, 0x0c, 0x3b, 0x6e, 0xa5, 0x75, 0x0f, 0x33, 0x4d, 0x38, 0x27, 0x19, 0x0f, 0x04, 0x04, 0x06, 0x05, 0x13, 0x28,
-    0x43, 0x31, 0x78, 0xb5, 0xe2, 0xfa, 0xe2, 0xb4, 0xfd, 0x02, 0x62, 0x03, 0x3f, 0x04, 0x35, 0x55, 0x6e, 0x7c, 0x82,
-    0x3f, 0x68, 0xc5, 0x9a, 0x5f, 0x03, 0x93, 0x01, 0x27, 0x3f, 0x52, 0x59, 0x5b, 0x29, 0x26, 0x57, 0x57, 0x51, 0x42,
-    0x2b, 0x06, 0xfd, 0x62, 0x05, 0x18, 0xfa, 0xe8, 0x05, 0xb0, 0x00, 0x01, 0x00, 0x08, 0xfe, 0xe1, 0x04, 0x1a, 0x04,
-    0x3a, 0x00, 0x1d, 0x00, 0x33, 0x40, 0x30, 0x14, 0x01, 0x01, 0x00, 0x01, 0x4a, 0x0c, 0x0b, 0x02, 0x01, 0x47, 0x00,
-    0x00, 0x02, 0x01, 0x02, 0x00, 0x01, 0x70, 0x00, 0x02, 0x02, 0x04, 0x59, 0x00, 0x04, 0x04, 0x18, 0x4b, 0x03, 0x01,
-    0x01, 0x01, 0x17, 0x01, 0x4c, 0x1d, 0x1c, 0x1b, 0x1a, 0x19, 0x18, 0x17, 0x16, 0x20, 0x05, 0x06, 0x15, 0x2b, 0x01,
-    0x33, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x27, 0x36, 0x36, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x03, 0x23, 0x13,
-    0x23, 0x03, 0x23, 0x13, 0x21, 0x02, 0xbb, 0x02, 0x5f, 0x89, 0x55, 0x20, 0x09, 0x09, 0x41, 0x68, 0x89, 0x51, 0x23,
-    0x6f, 0x7c, 0x0e, 0x06, 0x08, 0x24, 0x48, 0x3b, 0x09, 0x59, 0xb5, 0xa2, 0xdf, 0xa1, 0xb5, 0xbc, 0x02, 0x42, 0x02,
-    0x83, 0x03, 0x52, 0x81, 0xa5, 0x57, 0x53, 0x97, 0x7a, 0x58, 0x14, 0x96, 0x24, 0xa4, 0x73, 0x31, 0x68, 0x57, 0x3b,
-    0x05, 0x01, 0xfe, 0x1d, 0x03, 0xa1, 0xfc, 0x5f, 0x04, 0x3a, 0x00, 0x02, 0x00, 0x61, 0xff, 0xe1, 0x04, 0x6c, 0x05,
-    0xc9, 0x00, 0x41, 0x00, 0x5b, 0x00, 0xb4, 0x4b, 0xb0, 0x2a, 0x50, 0x58, 0x40, 0x0c, 0x47, 0x3e, 0x28, 0x03, 0x03,
-    0x06, 0x03, 0x01, 0x00, 0x03, 0x02, 0x4a, 0x1b, 0x4b, 0xb0, 0x31, 0x50, 0x58, 0x40, 0x0c, 0x47, 0x3e, 0x28, 0x03,
-    0x03, 0x06, 0x03, 0x01, 0x00, 0x05, 0x02, 0x4a, 0x1b, 0x40, 0x0c, 0x47, 0x3e, 0x28, 0x03, 0x03, 0x06, 0x03, 0x01,
-    0x01, 0x05, 0x02, 0x4a, 0x59, 0x59, 0x4b, 0xb0, 0x2a, 0x50, 0x58, 0x40, 0x18, 0x00, 0x06, 0x06, 0x02, 0x5b, 0x04,
-    0x01, 0x02, 0x02, 0x1d, 0x4b, 0x05, 0x01, 0x03, 0x03, 0x00, 0x5c, 0x01, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x4c, 0x1b,
-    0x4b, 0xb0, 0x31, 0x50, 0x58, 0x40, 0x22, 0x00, 0x06, 0x06, 0x02, 0x5b, 0x04, 0x01, 0x02, 0x02, 0x1d, 0x4b, 0x00,
-    0x03, 0x03, 0x00, 0x5c, 0x01, 0x01, 0x00, 0x00, 0x1e, 0x4b, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00,
-    0x1e, 0x00, 0x4c, 0x1b, 0x40, 0x20, 0x00, 0x06, 0x06, 0x02, 0x5b, 0x04, 0x01, 0x02, 0x02, 0x1d, 0x4b, 0x00, 0x03,
-    0x03, 0x01, 0x5c, 0x00, 0x01, 0x01, 0x20, 0x4b, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x4c,
-    0x59, 0x59, 0x40, 0x0b, 0x55, 0x53, 0x1c, 0x2d, 0x1f, 0x1d, 0x24, 0x10, 0x07, 0x06, 0x1a, 0x2b, 0x05, 0x26, 0x26,
-    0x27, 0x06, 0x06, 0x27, 0x2e, 0x05, 0x37, 0x13, 0x3e, 0x05, 0x37, 0x07, 0x0e, 0x05, 0x07, 0x03, 0x06, 0x06, 0x1e,
-    0x03, 0x17, 0x16, 0x36, 0x37, 0x26, 0x26, 0x37, 0x13, 0x3e, 0x05, 0x17, 0x1e, 0x04, 0x06, 0x07, 0x03, 0x06, 0x06,
-    0x07, 0x16, 0x16, 0x17, 0x01, 0x06, 0x06, 0x16, 0x16, 0x17, 0x3e, 0x03, 0x37, 0x13, 0x3e, 0x02, 0x2e, 0x02, 0x27,
-    0x26, 0x0e, 0x04, 0x07, 0x03, 0xcf, 0x48, 0x88, 0x40, 0x34, 0x6c, 0x3a, 0x52, 0x7e, 0x5a, 0x39, 0x1e, 0x03, 0x09,
-    0x2d, 0x09, 0x1e, 0x2d, 0x41, 0x57, 0x70, 0x47, 0x0e, 0x2a, 0x3f, 0x2f, 0x21, 0x16, 0x0d, 0x05, 0x2c, 0x06, 0x05,
-    0x07, 0x18, 0x31, 0x4e, 0x39, 0x12, 0x24, 0x12, 0x45, 0x2c, 0x12, 0x36, 0x07, 0x1b, 0x29, 0x39, 0x4d, 0x62, 0x3d,
-    0x3b, 0x54, 0x37, 0x1f, 0x0d, 0x03, 0x05, 0x3a, 0x16, 0x6b, 0x60, 0x24, 0x47, 0x26, 0xfe, 0xaf, 0x07, 0x01, 0x11,
-    0x27, 0x21, 0x22, 0x33, 0x25, 0x19, 0x08, 0x39, 0x02, 0x07, 0x04, 0x04, 0x10, 0x22, 0x1c, 0x20, 0x31, 0x24, 0x19,
-    0x10, 0x0a, 0x03, 0x1f, 0x02, 0x1f, 0x20, 0x1a, 0x1d, 0x01, 0x01, 0x3b, 0x62, 0x81, 0x8e, 0x91, 0x43, 0x01, 0x17,
-    0x3b, 0x81, 0x7e, 0x74, 0x5a, 0x39, 0x04, 0xa0, 0x03, 0x2e, 0x49, 0x5a, 0x5c, 0x54, 0x1f, 0xfe, 0xe6, 0x27, 0x66,
-    0x6a, 0x66, 0x51, 0x32, 0x01, 0x01, 0x06, 0x03, 0x70, 0xfc, 0x83, 0x01, 0x53, 0x30, 0x6f, 0x6f, 0x67, 0x4e, 0x2d,
-    0x02, 0x02, 0x33, 0x51, 0x67, 0x6c, 0x6a, 0x2b, 0xfe, 0x98, 0x87, 0xef, 0x63, 0x0b, 0x09, 0x01, 0x02, 0x00, 0x34,
-    0x6a, 0x66, 0x61, 0x2b, 0x28, 0x5b, 0x61, 0x67, 0x33, 0x01, 0x6c, 0x0f, 0x3d, 0x49, 0x4d, 0x40, 0x2a, 0x01, 0x01,
-    0x24, 0x3c, 0x4c, 0x4b, 0x43, 0x15, 0x00, 0x02, 0x00, 0x4e, 0xff, 0xea, 0x04, 0x46, 0x04, 0x51, 0x00, 0x3e, 0x00,
-    0x56, 0x00, 0x9e, 0x40, 0x0c, 0x44, 0x3b, 0x26, 0x03, 0x04, 0x03, 0x03, 0x01, 0x00, 0x04, 0x02, 0x4a, 0x4b, 0xb0,
-    0x0a, 0x50, 0x58, 0x40, 0x19, 0x07, 0x01, 0x03, 0x03, 0x02, 0x5b, 0x05, 0x01, 0x02, 0x02, 0x1f, 0x4b, 0x06, 0x01,
-    0x04, 0x04, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40, 0x19,
-    0x07, 0x01, 0x03, 0x03, 0x02, 0x5b, 0x05, 0x01, 0x02, 0x02, 0x1f, 0x4b, 0x06, 0x01, 0x04, 0x04, 0x00, 0x5b, 0x01,
-    0x01, 0x00, 0x00, 0x20, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40, 0x19, 0x07, 0x01, 0x03, 0x03, 0x02,
-    0x5b, 0x05, 0x01, 0x02, 0x02, 0x1f, 0x4b, 0x06, 0x01, 0x04, 0x04, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x1e, 0x00,
-    0x4c, 0x1b, 0x40, 0x19, 0x07, 0x01, 0x03, 0x03, 0x02, 0x5b, 0x05, 0x01, 0x02, 0x02, 0x1f, 0x4b, 0x06, 0x01, 0x04,
-    0x04, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x20, 0x00, 0x4c, 0x59, 0x59, 0x59, 0x40, 0x0c, 0x50, 0x4e, 0x1b, 0x2c,
-    0x2d, 0x11, 0x1b, 0x24, 0x10, 0x08, 0x06, 0x1b, 0x2b, 0x05, 0x26, 0x26, 0x27, 0x06, 0x06, 0x27, 0x2e, 0x05, 0x37,
-    0x37, 0x3e, 0x03, 0x37, 0x07, 0x0e, 0x05, 0x07, 0x07, 0x06, 0x06, 0x1e, 0x03, 0x17, 0x16, 0x36, 0x37, 0x26, 0x26,
-    0x37, 0x37, 0x3e, 0x05, 0x17, 0x1e, 0x05, 0x07, 0x07, 0x06, 0x07, 0x16, 0x16, 0x17, 0x01, 0x06, 0x1e, 0x02, 0x17,
-    0x36, 0x36, 0x37, 0x37, 0x36, 0x36, 0x34, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x04, 0x07, 0x04, 0x08, 0x4d, 0x93, 0x47,
-    0x3f, 0x83, 0x46, 0x4e, 0x7b, 0x5b, 0x3d, 0x22, 0x08, 0x07, 0x07, 0x0c, 0x3d, 0x67, 0x93, 0x62, 0x12, 0x26, 0x3b,
-    0x2e, 0x22, 0x18, 0x0f, 0x04, 0x08, 0x05, 0x02, 0x0b, 0x1c, 0x32, 0x4c, 0x36, 0x1a, 0x30, 0x18, 0x48, 0x38, 0x0d,
-    0x0e, 0x06, 0x1b, 0x2a, 0x3b, 0x4c, 0x5f, 0x3a, 0x38, 0x54, 0x3b, 0x24, 0x12, 0x02, 0x05, 0x0e, 0x21, 0xa0, 0x29,
-    0x51, 0x2a, 0xfe, 0x6e, 0x05, 0x05, 0x1a, 0x2e, 0x23, 0x3f, 0x43, 0x0d, 0x0d, 0x02, 0x05, 0x08, 0x14, 0x24, 0x1c,
-    0x1f, 0x2f, 0x23, 0x18, 0x10, 0x0a, 0x02, 0x0d, 0x02, 0x1b, 0x1d, 0x20, 0x23, 0x02, 0x01, 0x34, 0x57, 0x72, 0x82,
-    0x8a, 0x43, 0x3a, 0x58, 0xa9, 0x85, 0x54, 0x03, 0x9e, 0x02, 0x20, 0x32, 0x3f, 0x45, 0x46, 0x1f, 0x3d, 0x28, 0x5e,
-    0x5e, 0x59, 0x45, 0x2a, 0x01, 0x01, 0x08, 0x05, 0x5c, 0xd6, 0x73, 0x68, 0x30, 0x67, 0x60, 0x55, 0x3e, 0x23, 0x02,
-    0x02, 0x2b, 0x46, 0x5a, 0x62, 0x65, 0x2c, 0x69, 0xe3, 0xa1, 0x09, 0x07, 0x01, 0x01, 0xa8, 0x2f, 0x5a, 0x54, 0x4c,
-    0x21, 0x40, 0x9f, 0x58, 0x6d, 0x11, 0x38, 0x40, 0x40, 0x35, 0x22, 0x01, 0x01, 0x1a, 0x2d, 0x3b, 0x3d, 0x39, 0x16,
-    0x00, 0x01, 0x00, 0xb1, 0xfe, 0xa1, 0x04, 0x9b, 0x05, 0xb0, 0x00, 0x13, 0x00, 0x2b, 0x40, 0x28, 0x00, 0x06, 0x03,
-    0x06, 0x51, 0x02, 0x01, 0x00, 0x00, 0x01, 0x59, 0x04, 0x01, 0x01, 0x01, 0x16, 0x4b, 0x05, 0x01, 0x03, 0x03, 0x07,
-    0x59, 0x00, 0x07, 0x07, 0x17, 0x07, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x51, 0x10, 0x08, 0x06, 0x1c, 0x2b,
-    0x01, 0x21, 0x37, 0x33, 0x35, 0x33, 0x07, 0x33, 0x07, 0x23, 0x03, 0x21, 0x13, 0x33, 0x03, 0x33, 0x03, 0x23, 0x13,
-    0x21, 0x01, 0xb6, 0xfe, 0xfb, 0x1a, 0xfd, 0xb5, 0x01, 0xf0, 0x1b, 0xe6, 0xc8, 0x01, 0x60, 0xe3, 0xb5, 0xe2, 0x8d,
-    0x69, 0xa2, 0x3d, 0xfd, 0x5c, 0x05, 0x18, 0x97, 0x01, 0x01, 0x97, 0xfb, 0x7f, 0x05, 0x19, 0xfa, 0xec, 0xfe, 0x05,
-    0x01, 0x5f, 0x00, 0x01, 0x00, 0x6b, 0xfe, 0xbf, 0x04, 0x41, 0x04, 0x3a, 0x00, 0x0f, 0x00, 0x2b, 0x40, 0x28, 0x00,
-    0x06, 0x03, 0x06, 0x52, 0x02, 0x01, 0x00, 0x00, 0x01, 0x59, 0x04, 0x01, 0x01, 0x01, 0x18, 0x4b, 0x05, 0x01, 0x03,
-    0x03, 0x07, 0x5a, 0x00, 0x07, 0x07, 0x17, 0x07, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x08, 0x06,
-    0x1c, 0x2b, 0x01, 0x23, 0x37, 0x21, 0x07, 0x23, 0x03, 0x21, 0x13, 0x33, 0x03, 0x33, 0x03, 0x23, 0x13, 0x21, 0x01,
-    0x4d, 0xe2, 0x1b, 0x02, 0x73, 0x1b, 0xdd, 0x87, 0x01, 0x70, 0xa2, 0xb5, 0xa2, 0x7d, 0x64, 0xa3, 0x39, 0xfd, 0x5d,
-    0x03, 0xa3, 0x97, 0x97, 0xfc, 0xf4, 0x03, 0xa3, 0xfc, 0x5d, 0xfe, 0x28, 0x01, 0x41, 0x00, 0x00, 0x02, 0x00, 0xe4,
-    0x00, 0x00, 0x04, 0x9d, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x6d, 0xb5, 0x07, 0x01, 0x03, 0x05, 0x01, 0x4a,
-    0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x24, 0x00, 0x01, 0x04, 0x05, 0x04, 0x01, 0x05, 0x70, 0x00, 0x00, 0x03, 0x02,
-    0x03, 0x00, 0x68, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x03, 0x64, 0x07, 0x06, 0x02, 0x04, 0x04, 0x16, 0x4b, 0x00,
-    0x02, 0x02, 0x17, 0x02, 0x4c, 0x1b, 0x40, 0x25, 0x00, 0x01, 0x04, 0x05, 0x04, 0x01, 0x05, 0x70, 0x00, 0x00, 0x03,
-    0x02, 0x03, 0x00, 0x02, 0x70, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x03, 0x64, 0x07, 0x06, 0x02, 0x04, 0x04, 0x16,
-    0x4b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x59, 0x40, 0x0f, 0x04, 0x04, 0x04, 0x1b, 0x04, 0x1b, 0x25, 0x15, 0x23,
-    0x12, 0x11, 0x10, 0x08, 0x06, 0x1a, 0x2b, 0x01, 0x23, 0x13, 0x33, 0x01, 0x03, 0x23, 0x13, 0x06, 0x06, 0x27, 0x2e,
-    0x03, 0x37, 0x13, 0x33, 0x03, 0x06, 0x06, 0x16, 0x16, 0x17, 0x16, 0x36, 0x37, 0x13, 0x02, 0x60, 0x92, 0x7a, 0x92,
-    0x01, 0xc3, 0xfd, 0xb5, 0x6f, 0x47, 0x91, 0x4c, 0x65, 0x87, 0x4e, 0x18, 0x0b, 0x4b, 0xb5, 0x4b, 0x06, 0x01, 0x1e,
-    0x45, 0x40, 0x4d, 0x94, 0x49, 0x7e, 0x01, 0x35, 0x02, 0xbc, 0x01, 0xbf, 0xfa, 0x50, 0x02, 0x5c, 0x1a, 0x1b, 0x01,
-    0x01, 0x47, 0x79, 0xa2, 0x5d, 0x01, 0xc8, 0xfe, 0x37, 0x34, 0x67, 0x53, 0x35, 0x02, 0x03, 0x20, 0x15, 0x02, 0xbc,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xa4, 0x00, 0x00, 0x04, 0x61, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x1a, 0x00, 0x91,
-    0xb5, 0x06, 0x01, 0x03, 0x05, 0x01, 0x4a, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x22, 0x00, 0x01, 0x04, 0x05, 0x05,
-    0x01, 0x68, 0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 0x68, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x03, 0x64, 0x06, 0x01,
-    0x04, 0x04, 0x18, 0x4b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x1b, 0x4b, 0xb0, 0x12, 0x50, 0x58, 0x40, 0x23, 0x00,
-    0x01, 0x04, 0x05, 0x04, 0x01, 0x05, 0x70, 0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 0x68, 0x00, 0x05, 0x00, 0x03, 0x00,
-    0x05, 0x03, 0x64, 0x06, 0x01, 0x04, 0x04, 0x18, 0x4b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x1b, 0x40, 0x24, 0x00,
-    0x01, 0x04, 0x05, 0x04, 0x01, 0x05, 0x70, 0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 0x02, 0x70, 0x00, 0x05, 0x00, 0x03,
-    0x00, 0x05, 0x03, 0x64, 0x06, 0x01, 0x04, 0x04, 0x18, 0x4b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x59, 0x59, 0x40,
-    0x0a, 0x13, 0x25, 0x15, 0x22, 0x11, 0x11, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x25, 0x23, 0x13, 0x33, 0x13, 0x23, 0x13,
-    0x06, 0x27, 0x2e, 0x03, 0x37, 0x13, 0x33, 0x03, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x36, 0x37, 0x13, 0x33, 0x02, 0x58,
-    0x93, 0x62, 0x93, 0xeb, 0xb5, 0x4b, 0x8f, 0x91, 0x5c, 0x91, 0x5f, 0x2b, 0x0a, 0x33, 0xb5, 0x34, 0x06, 0x0e, 0x2f,
-    0x4f, 0x3a, 0x4b, 0x94, 0x4a, 0x61, 0xb5, 0xd3, 0x02, 0x36, 0xfc, 0xf7, 0x01, 0x8c, 0x26, 0x03, 0x01, 0x3a, 0x69,
-    0x95, 0x5d, 0x01, 0x3b, 0xfe, 0xc4, 0x37, 0x5b, 0x42, 0x26, 0x02, 0x02, 0x13, 0x0f, 0x02, 0x18, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x74, 0x00, 0x00, 0x04, 0x2b, 0x05, 0xb0, 0x00, 0x16, 0x00, 0x2b, 0x40, 0x28, 0x03, 0x01, 0x03,
-    0x01, 0x01, 0x4a, 0x00, 0x01, 0x00, 0x03, 0x02, 0x01, 0x03, 0x63, 0x00, 0x00, 0x00, 0x16, 0x4b, 0x05, 0x04, 0x02,
-    0x02, 0x02, 0x17, 0x02, 0x4c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x16, 0x25, 0x15, 0x22, 0x11, 0x06, 0x06, 0x18, 0x2b,
-    0x33, 0x13, 0x33, 0x03, 0x36, 0x17, 0x1e, 0x03, 0x07, 0x03, 0x23, 0x13, 0x36, 0x36, 0x26, 0x26, 0x27, 0x26, 0x06,
-    0x07, 0x03, 0x74, 0xfc, 0xb5, 0x70, 0x8c, 0x97, 0x65, 0x88, 0x4e, 0x18, 0x0a, 0x4c, 0xb5, 0x4b, 0x06, 0x01, 0x1d,
-    0x46, 0x40, 0x4d, 0x93, 0x49, 0x7e, 0x05, 0xb0, 0xfd, 0xa2, 0x37, 0x03, 0x02, 0x46, 0x79, 0xa1, 0x5d, 0xfe, 0x39,
-    0x01, 0xc8, 0x34, 0x67, 0x53, 0x35, 0x02, 0x02, 0x1e, 0x16, 0xfd, 0x45, 0x00, 0x00, 0x00, 0x02, 0x00, 0x73, 0xff,
-    0xea, 0x04, 0xa4, 0x05, 0xc5, 0x00, 0x33, 0x00, 0x44, 0x00, 0x4d, 0x40, 0x4a, 0x13, 0x01, 0x05, 0x01, 0x08, 0x01,
-    0x03, 0x05, 0x2e, 0x01, 0x04, 0x03, 0x2f, 0x01, 0x00, 0x04, 0x04, 0x4a, 0x00, 0x05, 0x00, 0x03, 0x04, 0x05, 0x03,
-    0x61, 0x00, 0x06, 0x06, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x1d, 0x4b, 0x00, 0x01, 0x01, 0x18, 0x4b, 0x00, 0x04, 0x04,
-    0x00, 0x5b, 0x07, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x4c, 0x01, 0x00, 0x3e, 0x3c, 0x35, 0x34, 0x2c, 0x2a, 0x23, 0x22,
-    0x1b, 0x19, 0x0e, 0x0d, 0x00, 0x33, 0x01, 0x33, 0x08, 0x06, 0x14, 0x2b, 0x05, 0x2e, 0x05, 0x37, 0x37, 0x2e, 0x03,
-    0x37, 0x17, 0x06, 0x06, 0x16, 0x16, 0x17, 0x3e, 0x05, 0x17, 0x1e, 0x04, 0x06, 0x07, 0x07, 0x21, 0x07, 0x06, 0x06,
-    0x1e, 0x03, 0x17, 0x16, 0x36, 0x37, 0x17, 0x0e, 0x03, 0x03, 0x25, 0x37, 0x36, 0x36, 0x2e, 0x03, 0x27, 0x26, 0x0e,
-    0x04, 0x07, 0x02, 0xb5, 0x52, 0x81, 0x61, 0x42, 0x24, 0x07, 0x0a, 0x1b, 0x3f, 0x50, 0x2b, 0x0c, 0x04, 0x91, 0x03,
-    0x04, 0x0b, 0x1d, 0x1d, 0x0d, 0x2b, 0x40, 0x56, 0x6f, 0x89, 0x53, 0x50, 0x71, 0x4b, 0x29, 0x10, 0x05, 0x08, 0x1e,
-    0xfd, 0x6e, 0x15, 0x06, 0x03, 0x0d, 0x1f, 0x38, 0x53, 0x3a, 0x4a, 0x84, 0x3e, 0x25, 0x1f, 0x4b, 0x50, 0x54, 0xe5,
-    0x01, 0xe2, 0x11, 0x04, 0x08, 0x03, 0x10, 0x24, 0x3e, 0x2f, 0x3c, 0x5c, 0x46, 0x32, 0x25, 0x19, 0x09, 0x16, 0x01,
-    0x30, 0x53, 0x70, 0x82, 0x8e, 0x48, 0x93, 0x11, 0x4c, 0x64, 0x75, 0x3b, 0x01, 0x1f, 0x41, 0x3e, 0x35, 0x12, 0x44,
-    0x93, 0x8c, 0x7d, 0x5d, 0x34, 0x02, 0x02, 0x36, 0x57, 0x74, 0x80, 0x87, 0x3f, 0xbc, 0x89, 0x2e, 0x63, 0x5f, 0x57,
-    0x43, 0x28, 0x01, 0x02, 0x32, 0x24, 0x89, 0x1b, 0x26, 0x18, 0x0a, 0x03, 0x56, 0x02, 0x71, 0x21, 0x51, 0x52, 0x4e,
-    0x3d, 0x27, 0x02, 0x03, 0x2b, 0x4c, 0x63, 0x6a, 0x6b, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x4f, 0xff, 0xec,
-    0x04, 0x6f, 0x04, 0x51, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x89, 0x40, 0x12, 0x11, 0x01, 0x06, 0x01, 0x05, 0x01, 0x03,
-    0x06, 0x25, 0x01, 0x04, 0x03, 0x26, 0x01, 0x00, 0x04, 0x04, 0x4a, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40, 0x27, 0x00,
-    0x01, 0x05, 0x06, 0x05, 0x01, 0x06, 0x70, 0x00, 0x06, 0x00, 0x03, 0x04, 0x06, 0x03, 0x61, 0x08, 0x01, 0x05, 0x05,
-    0x02, 0x5b, 0x00, 0x02, 0x02, 0x1f, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x07, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x4c,
-    0x1b, 0x40, 0x27, 0x00, 0x01, 0x05, 0x06, 0x05, 0x01, 0x06, 0x70, 0x00, 0x06, 0x00, 0x03, 0x04, 0x06, 0x03, 0x61,
-    0x08, 0x01, 0x05, 0x05, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x1f, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x07, 0x01, 0x00,
-    0x00, 0x20, 0x00, 0x4c, 0x59, 0x40, 0x19, 0x2c, 0x2b, 0x01, 0x00, 0x31, 0x30, 0x2b, 0x36, 0x2c, 0x36, 0x23, 0x21,
-    0x1d, 0x1c, 0x17, 0x15, 0x0c, 0x0b, 0x00, 0x2a, 0x01, 0x2a, 0x09, 0x06, 0x14, 0x2b, 0x05, 0x2e, 0x03, 0x37, 0x37,
-    0x2e, 0x03, 0x37, 0x17, 0x06, 0x06, 0x16, 0x16, 0x17, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x07, 0x21, 0x06, 0x1e,
-    0x02, 0x17, 0x16, 0x36, 0x37, 0x17, 0x0e, 0x03, 0x13, 0x26, 0x0e, 0x02, 0x07, 0x05, 0x37, 0x36, 0x2e, 0x02, 0x02,
-    0x8b, 0x6c, 0x9e, 0x60, 0x1f, 0x13, 0x02, 0x3e, 0x50, 0x2c, 0x0e, 0x03, 0x90, 0x03, 0x02, 0x0d, 0x1e, 0x1d, 0x1b,
-    0x59, 0x7a, 0x9d, 0x60, 0x67, 0x8c, 0x52, 0x1a, 0x0c, 0x12, 0xfd, 0x73, 0x07, 0x08, 0x2d, 0x57, 0x48, 0x54, 0x92,
-    0x40, 0x3e, 0x23, 0x55, 0x5e, 0x63, 0x49, 0x3e, 0x60, 0x49, 0x33, 0x12, 0x01, 0xd9, 0x04, 0x08, 0x0b, 0x2a, 0x4b,
-    0x13, 0x02, 0x5f, 0x99, 0xbf, 0x62, 0x07, 0x0d, 0x43, 0x5d, 0x6f, 0x38, 0x01, 0x1d, 0x3c, 0x36, 0x2e, 0x0f, 0x51,
-    0xa0, 0x7e, 0x4c, 0x03, 0x03, 0x53, 0x87, 0xac, 0x5c, 0x78, 0x39, 0x7f, 0x6b, 0x48, 0x02, 0x03, 0x3a, 0x33, 0x7d,
-    0x24, 0x33, 0x20, 0x0e, 0x03, 0xcb, 0x02, 0x39, 0x5a, 0x6c, 0x31, 0x01, 0x1a, 0x31, 0x62, 0x4e, 0x32, 0x00, 0x01,
-    0x00, 0x59, 0xfe, 0xd7, 0x04, 0xfa, 0x05, 0xb0, 0x00, 0x1e, 0x00, 0x28, 0x40, 0x25, 0x00, 0x05, 0x00, 0x02, 0x03,
-    0x05, 0x02, 0x64, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x5f, 0x06, 0x01, 0x04, 0x04, 0x16, 0x4b, 0x00, 0x03, 0x03,
-    0x17, 0x03, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x28, 0x11, 0x19, 0x07, 0x06, 0x1b, 0x2b, 0x01, 0x1e, 0x03, 0x07, 0x0e,
-    0x03, 0x07, 0x37, 0x3e, 0x03, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x03, 0x23, 0x13, 0x33, 0x03, 0x33, 0x01, 0x33,
-    0x02, 0xd9, 0x69, 0x8c, 0x50, 0x18, 0x0a, 0x0d, 0x4f, 0x85, 0xbe, 0x7c, 0x0a, 0x58, 0x7c, 0x53, 0x2d, 0x09, 0x09,
-    0x11, 0x3e, 0x73, 0x59, 0xe4, 0x74, 0xb5, 0xfd, 0xb5, 0x6d, 0x82, 0x01, 0xfc, 0xde, 0x03, 0x31, 0x13, 0x6c, 0x98,
-    0xb9, 0x60, 0x77, 0xc8, 0x92, 0x55, 0x04, 0x93, 0x01, 0x46, 0x71, 0x92, 0x4e, 0x4f, 0x91, 0x6f, 0x45, 0x03, 0x01,
-    0xfd, 0x66, 0x05, 0xb0, 0xfd, 0x8c, 0x02, 0x74, 0x00, 0x00, 0x01, 0x00, 0x46, 0xfe, 0xfb, 0x04, 0x77, 0x04, 0x3a,
-    0x00, 0x1e, 0x00, 0x29, 0x40, 0x26, 0x0b, 0x0a, 0x02, 0x01, 0x47, 0x00, 0x03, 0x00, 0x00, 0x01, 0x03, 0x00, 0x64,
-    0x04, 0x01, 0x02, 0x02, 0x18, 0x4b, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x1e, 0x1d, 0x1c, 0x1b, 0x1a, 0x19, 0x18,
-    0x17, 0x16, 0x14, 0x05, 0x06, 0x14, 0x2b, 0x01, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x27, 0x3e, 0x03, 0x37, 0x36,
-    0x2e, 0x02, 0x27, 0x27, 0x03, 0x23, 0x13, 0x33, 0x03, 0x37, 0x01, 0x33, 0x02, 0x9b, 0x4f, 0x79, 0x4e, 0x21, 0x08,
-    0x09, 0x49, 0x72, 0x92, 0x51, 0x20, 0x37, 0x5f, 0x48, 0x2d, 0x07, 0x08, 0x1d, 0x44, 0x65, 0x40, 0xcc, 0x50, 0xb5,
-    0xbc, 0xb5, 0x50, 0x6b, 0x01, 0xbc, 0xe9, 0x02, 0x60, 0x11, 0x4d, 0x6f, 0x8d, 0x50, 0x55, 0x93, 0x73, 0x4f, 0x11,
-    0x95, 0x0f, 0x34, 0x49, 0x60, 0x3b, 0x42, 0x66, 0x46, 0x25, 0x02, 0x01, 0xfe, 0x33, 0x04, 0x3a, 0xfe, 0x36, 0x01,
-    0x01, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x48, 0xfe, 0x49, 0x04, 0x8f, 0x05, 0xb0, 0x00, 0x1b, 0x00, 0x3b,
-    0x40, 0x38, 0x0e, 0x01, 0x03, 0x05, 0x0d, 0x01, 0x02, 0x03, 0x02, 0x4a, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x04,
-    0x62, 0x07, 0x06, 0x02, 0x01, 0x01, 0x16, 0x4b, 0x00, 0x05, 0x05, 0x17, 0x4b, 0x00, 0x03, 0x03, 0x02, 0x5b, 0x00,
-    0x02, 0x02, 0x21, 0x02, 0x4c, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x1b, 0x11, 0x15, 0x25, 0x25, 0x11, 0x11, 0x08, 0x06,
-    0x1a, 0x2b, 0x01, 0x03, 0x21, 0x13, 0x33, 0x01, 0x0e, 0x03, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32,
-    0x3e, 0x02, 0x37, 0x13, 0x21, 0x03, 0x23, 0x13, 0x01, 0xfa, 0x73, 0x01, 0xe0, 0x73, 0xb5, 0xfe, 0xf8, 0x0a, 0x36,
-    0x59, 0x7b, 0x50, 0x1d, 0x37, 0x1d, 0x1a, 0x17, 0x31, 0x18, 0x28, 0x3a, 0x27, 0x17, 0x05, 0x7d, 0xfe, 0x1f, 0x70,
-    0xb5, 0xfd, 0x05, 0xb0, 0xfd, 0x6c, 0x02, 0x94, 0xf9, 0xf7, 0x4a, 0x80, 0x5f, 0x35, 0x0a, 0x08, 0x94, 0x07, 0x09,
-    0x25, 0x3a, 0x47, 0x22, 0x02, 0xde, 0xfd, 0x7b, 0x05, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x45, 0xfe, 0x47,
-    0x04, 0x4b, 0x04, 0x3a, 0x00, 0x1b, 0x00, 0x3b, 0x40, 0x38, 0x0e, 0x01, 0x03, 0x05, 0x0d, 0x01, 0x02, 0x03, 0x02,
-    0x4a, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x04, 0x62, 0x07, 0x06, 0x02, 0x01, 0x01, 0x18, 0x4b, 0x00, 0x05, 0x05,
-    0x17, 0x4b, 0x00, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x21, 0x02, 0x4c, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x1b,
-    0x11, 0x15, 0x25, 0x25, 0x11, 0x11, 0x08, 0x06, 0x1a, 0x2b, 0x01, 0x03, 0x21, 0x13, 0x33, 0x03, 0x0e, 0x03, 0x27,
-    0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x13, 0x21, 0x03, 0x23, 0x13, 0x01, 0xb6, 0x52,
-    0x01, 0xe1, 0x52, 0xb4, 0xc7, 0x0a, 0x36, 0x5a, 0x7d, 0x51, 0x1e, 0x38, 0x1d, 0x1a, 0x17, 0x30, 0x19, 0x29, 0x3c,
-    0x29, 0x18, 0x06, 0x5c, 0xfe, 0x1f, 0x50, 0xb5, 0xbc, 0x04, 0x3a, 0xfe, 0x2b, 0x01, 0xd5, 0xfb, 0x6d, 0x4b, 0x81,
-    0x5f, 0x35, 0x01, 0x0a, 0x08, 0x95, 0x07, 0x09, 0x24, 0x39, 0x48, 0x23, 0x02, 0x27, 0xfe, 0x32, 0x04, 0x3a, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x4d, 0xff, 0xea, 0x04, 0x69, 0x05, 0xc4, 0x00, 0x28, 0x00, 0x36, 0x00, 0x43, 0x40,
-    0x40, 0x24, 0x01, 0x03, 0x00, 0x23, 0x01, 0x02, 0x03, 0x02, 0x4a, 0x00, 0x02, 0x00, 0x05, 0x04, 0x02, 0x05, 0x61,
-    0x00, 0x03, 0x03, 0x00, 0x5b, 0x06, 0x01, 0x00, 0x00, 0x1d, 0x4b, 0x07, 0x01, 0x04, 0x04, 0x01, 0x5b, 0x00, 0x01,
-    0x01, 0x20, 0x01, 0x4c, 0x2a, 0x29, 0x01, 0x00, 0x31, 0x30, 0x29, 0x36, 0x2a, 0x36, 0x21, 0x1f, 0x18, 0x17, 0x10,
-    0x0e, 0x00, 0x28, 0x01, 0x28, 0x08, 0x06, 0x14, 0x2b, 0x01, 0x1e, 0x05, 0x07, 0x07, 0x0e, 0x05, 0x27, 0x2e, 0x05,
-    0x37, 0x37, 0x21, 0x37, 0x36, 0x36, 0x2e, 0x03, 0x27, 0x26, 0x06, 0x07, 0x27, 0x3e, 0x03, 0x03, 0x16, 0x3e, 0x04,
-    0x37, 0x21, 0x07, 0x06, 0x1e, 0x02, 0x02, 0xb7, 0x57, 0x88, 0x65, 0x43, 0x24, 0x07, 0x0a, 0x22, 0x0c, 0x31, 0x4c,
-    0x64, 0x7e, 0x97, 0x58, 0x55, 0x83, 0x5f, 0x3c, 0x1f, 0x04, 0x0a, 0x1a, 0x03, 0x2b, 0x0e, 0x07, 0x04, 0x0d, 0x21,
-    0x3c, 0x5b, 0x3f, 0x54, 0x95, 0x4a, 0x22, 0x24, 0x54, 0x5a, 0x5d, 0x9f, 0x41, 0x69, 0x55, 0x42, 0x31, 0x22, 0x0c,
-    0xfd, 0x84, 0x0e, 0x09, 0x07, 0x32, 0x66, 0x05, 0xc3, 0x01, 0x34, 0x59, 0x79, 0x8b, 0x98, 0x4b, 0xda, 0x4c, 0x9d,
-    0x91, 0x7f, 0x5d, 0x34, 0x02, 0x02, 0x33, 0x55, 0x74, 0x85, 0x92, 0x4a, 0xa6, 0x5e, 0x31, 0x6c, 0x69, 0x5f, 0x49,
-    0x2c, 0x02, 0x02, 0x31, 0x25, 0x8a, 0x1c, 0x26, 0x17, 0x0a, 0xfa, 0xbd, 0x02, 0x2b, 0x4b, 0x64, 0x6e, 0x72, 0x34,
-    0x5b, 0x45, 0x8d, 0x72, 0x4a, 0x00, 0x00, 0x01, 0x00, 0x67, 0xff, 0xe9, 0x04, 0x99, 0x05, 0xb0, 0x00, 0x24, 0x00,
-    0x36, 0x40, 0x33, 0x05, 0x01, 0x05, 0x00, 0x01, 0x4a, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x03, 0x70, 0x00, 0x03,
-    0x04, 0x00, 0x03, 0x04, 0x6e, 0x00, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x16, 0x4b, 0x00, 0x04, 0x04, 0x02,
-    0x5b, 0x00, 0x02, 0x02, 0x20, 0x02, 0x4c, 0x26, 0x24, 0x14, 0x2b, 0x11, 0x10, 0x06, 0x06, 0x1a, 0x2b, 0x01, 0x21,
-    0x37, 0x21, 0x07, 0x01, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x17, 0x06, 0x1e, 0x02, 0x17, 0x16,
-    0x3e, 0x02, 0x37, 0x36, 0x26, 0x27, 0x27, 0x37, 0x03, 0xa3, 0xfd, 0x8f, 0x1b, 0x03, 0x4c, 0x16, 0xfe, 0x1b, 0x5c,
-    0x90, 0x61, 0x2d, 0x08, 0x09, 0x5e, 0x91, 0xba, 0x64, 0x5e, 0x98, 0x68, 0x35, 0x05, 0xb3, 0x03, 0x1a, 0x3a, 0x58,
-    0x3b, 0x40, 0x76, 0x5d, 0x3d, 0x08, 0x10, 0x85, 0x88, 0x97, 0x1c, 0x05, 0x18, 0x98, 0x7f, 0xfe, 0x19, 0x07, 0x43,
-    0x6f, 0x97, 0x5d, 0x69, 0xa4, 0x6f, 0x38, 0x02, 0x02, 0x3f, 0x70, 0x9b, 0x5e, 0x01, 0x38, 0x61, 0x4a, 0x2d, 0x02,
-    0x02, 0x25, 0x49, 0x69, 0x42, 0x8b, 0x92, 0x05, 0x01, 0xa0, 0x00, 0x00, 0x01, 0x00, 0x1c, 0xfe, 0x72, 0x04, 0x4e,
-    0x04, 0x3a, 0x00, 0x24, 0x00, 0x36, 0x40, 0x33, 0x05, 0x01, 0x05, 0x00, 0x01, 0x4a, 0x00, 0x05, 0x00, 0x03, 0x00,
-    0x05, 0x03, 0x70, 0x00, 0x03, 0x04, 0x00, 0x03, 0x04, 0x6e, 0x00, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x18,
-    0x4b, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x1a, 0x02, 0x4c, 0x26, 0x24, 0x14, 0x2b, 0x11, 0x10, 0x06,
-    0x06, 0x1a, 0x2b, 0x01, 0x21, 0x37, 0x21, 0x07, 0x01, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x17,
-    0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x36, 0x26, 0x27, 0x27, 0x37, 0x03, 0x45, 0xfd, 0xa2, 0x1b, 0x03,
-    0x4c, 0x15, 0xfe, 0x27, 0x59, 0x8c, 0x5d, 0x2a, 0x07, 0x09, 0x5e, 0x92, 0xba, 0x64, 0x5d, 0x98, 0x69, 0x34, 0x05,
-    0xb4, 0x04, 0x1b, 0x3a, 0x58, 0x3a, 0x40, 0x76, 0x5d, 0x3d, 0x08, 0x11, 0x88, 0x8a, 0x94, 0x1b, 0x03, 0xa1, 0x99,
-    0x7f, 0xfe, 0x16, 0x09, 0x44, 0x6f, 0x95, 0x5a, 0x69, 0xa4, 0x6f, 0x38, 0x03, 0x02, 0x3f, 0x70, 0x9a, 0x5e, 0x01,
-    0x37, 0x62, 0x49, 0x2c, 0x02, 0x02, 0x25, 0x48, 0x69, 0x41, 0x8d, 0x90, 0x05, 0x01, 0xa0, 0x00, 0xff, 0xff, 0x00,
-    0x01, 0xfe, 0x47, 0x04, 0xee, 0x05, 0xb0, 0x02, 0x26, 0x00, 0xae, 0x49, 0x00, 0x00, 0x27, 0x01, 0xca, 0xff, 0x1f,
-    0x00, 0x3f, 0x01, 0x07, 0x01, 0xd0, 0xff, 0x54, 0x00, 0x00, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x3f, 0xb0, 0x33,
-    0x2b, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0x47, 0x04, 0xaf, 0x04, 0x3a, 0x02, 0x26, 0x00, 0xe8, 0x50, 0x00,
-    0x00, 0x27, 0x01, 0xca, 0xff, 0x2a, 0xff, 0x64, 0x01, 0x07, 0x01, 0xd0, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x09, 0xb1,
-    0x01, 0x01, 0xb8, 0xff, 0x64, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x02, 0x00, 0x3a, 0x00, 0x00, 0x04, 0xa5, 0x05, 0xb0,
-    0x00, 0x0e, 0x00, 0x1b, 0x00, 0x30, 0x40, 0x2d, 0x05, 0x01, 0x02, 0x00, 0x03, 0x04, 0x02, 0x03, 0x63, 0x00, 0x00,
-    0x00, 0x16, 0x4b, 0x06, 0x01, 0x04, 0x04, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x0f, 0x0f, 0x00, 0x00,
-    0x0f, 0x1b, 0x0f, 0x1a, 0x12, 0x10, 0x00, 0x0e, 0x00, 0x0d, 0x21, 0x11, 0x07, 0x06, 0x16, 0x2b, 0x01, 0x13, 0x33,
-    0x03, 0x25, 0x2e, 0x03, 0x37, 0x3e, 0x03, 0x33, 0x13, 0x13, 0x25, 0x22, 0x0e, 0x02, 0x07, 0x06, 0x1e, 0x02, 0x17,
-    0x03, 0x8c, 0x65, 0xb4, 0xfc, 0xfe, 0x32, 0x60, 0x9e, 0x6e, 0x35, 0x09, 0x0a, 0x5d, 0x90, 0xba, 0x67, 0xb3, 0x64,
-    0xfe, 0xe5, 0x44, 0x78, 0x5d, 0x3d, 0x08, 0x08, 0x18, 0x3b, 0x5c, 0x3e, 0x03, 0x6d, 0x02, 0x43, 0xfa, 0x50, 0x01,
-    0x04, 0x3e, 0x6f, 0x9e, 0x64, 0x6c, 0xa5, 0x70, 0x39, 0xfd, 0x29, 0x02, 0x3f, 0x02, 0x27, 0x4b, 0x6c, 0x45, 0x3c,
-    0x66, 0x4b, 0x2d, 0x03, 0x00, 0x00, 0x02, 0x00, 0x28, 0xff, 0xfe, 0x04, 0x60, 0x05, 0xb0, 0x00, 0x22, 0x00, 0x2f,
-    0x00, 0x66, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x1c, 0x04, 0x01, 0x01, 0x00, 0x05, 0x03, 0x01, 0x05, 0x63, 0x00,
-    0x02, 0x02, 0x16, 0x4b, 0x08, 0x06, 0x02, 0x03, 0x03, 0x00, 0x5c, 0x07, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x1b,
-    0x40, 0x23, 0x00, 0x04, 0x01, 0x05, 0x01, 0x04, 0x05, 0x70, 0x00, 0x01, 0x00, 0x05, 0x03, 0x01, 0x05, 0x63, 0x00,
-    0x02, 0x02, 0x16, 0x4b, 0x08, 0x06, 0x02, 0x03, 0x03, 0x00, 0x5c, 0x07, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x59,
-    0x40, 0x19, 0x23, 0x23, 0x01, 0x00, 0x23, 0x2f, 0x23, 0x2e, 0x26, 0x24, 0x18, 0x17, 0x10, 0x0e, 0x0d, 0x0c, 0x0b,
-    0x09, 0x00, 0x22, 0x01, 0x21, 0x09, 0x06, 0x14, 0x2b, 0x25, 0x2e, 0x03, 0x37, 0x3e, 0x03, 0x33, 0x17, 0x13, 0x33,
-    0x03, 0x33, 0x3e, 0x03, 0x37, 0x36, 0x36, 0x27, 0x17, 0x16, 0x16, 0x07, 0x0e, 0x05, 0x27, 0x27, 0x13, 0x27, 0x0e,
-    0x03, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x01, 0x67, 0x5a, 0x7e, 0x4b, 0x1c, 0x08, 0x08, 0x42, 0x6f, 0x9b, 0x62, 0x79,
-    0x65, 0xb5, 0xe6, 0x2b, 0x3c, 0x51, 0x33, 0x1b, 0x08, 0x0e, 0x05, 0x10, 0xa7, 0x0e, 0x07, 0x0d, 0x08, 0x1e, 0x30,
-    0x42, 0x56, 0x6c, 0x42, 0xd5, 0x63, 0x64, 0x3d, 0x59, 0x3d, 0x23, 0x06, 0x05, 0x01, 0x19, 0x3a, 0x35, 0x02, 0x06,
-    0x4a, 0x76, 0x98, 0x54, 0x5d, 0xa1, 0x77, 0x45, 0x01, 0x02, 0x43, 0xfa, 0xe4, 0x02, 0x45, 0x64, 0x72, 0x30, 0x5e,
-    0xbb, 0x5e, 0x01, 0x5d, 0xba, 0x5e, 0x38, 0x74, 0x6c, 0x5f, 0x46, 0x27, 0x02, 0x97, 0x02, 0x3f, 0x02, 0x01, 0x32,
-    0x52, 0x67, 0x36, 0x28, 0x61, 0x55, 0x3c, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x43, 0xff, 0xea, 0x04, 0x6f, 0x06,
-    0x18, 0x00, 0x35, 0x00, 0x50, 0x00, 0x40, 0x40, 0x3d, 0x09, 0x01, 0x06, 0x00, 0x4d, 0x01, 0x02, 0x03, 0x29, 0x01,
-    0x04, 0x02, 0x03, 0x4a, 0x00, 0x01, 0x00, 0x01, 0x72, 0x00, 0x03, 0x06, 0x02, 0x06, 0x03, 0x02, 0x70, 0x00, 0x06,
-    0x06, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x1f, 0x4b, 0x07, 0x01, 0x02, 0x02, 0x04, 0x5b, 0x05, 0x01, 0x04, 0x04, 0x20,
-    0x04, 0x4c, 0x2d, 0x29, 0x26, 0x29, 0x19, 0x25, 0x12, 0x26, 0x08, 0x06, 0x1c, 0x2b, 0x13, 0x3e, 0x05, 0x17, 0x16,
-    0x17, 0x13, 0x33, 0x03, 0x06, 0x06, 0x16, 0x16, 0x17, 0x16, 0x3e, 0x04, 0x37, 0x36, 0x36, 0x27, 0x37, 0x16, 0x16,
-    0x07, 0x0e, 0x05, 0x27, 0x26, 0x26, 0x27, 0x0e, 0x03, 0x27, 0x2e, 0x04, 0x36, 0x37, 0x01, 0x26, 0x26, 0x27, 0x26,
-    0x0e, 0x04, 0x07, 0x07, 0x06, 0x06, 0x14, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x36, 0x36, 0x37, 0x5c, 0x07,
-    0x19, 0x26, 0x38, 0x4d, 0x65, 0x41, 0x60, 0x41, 0x63, 0xb5, 0xd4, 0x02, 0x03, 0x09, 0x1d, 0x1d, 0x25, 0x37, 0x28,
-    0x1b, 0x12, 0x0a, 0x03, 0x0f, 0x09, 0x0e, 0xa7, 0x0e, 0x02, 0x0e, 0x07, 0x1a, 0x28, 0x3b, 0x51, 0x6a, 0x44, 0x48,
-    0x71, 0x1a, 0x15, 0x2f, 0x36, 0x3f, 0x25, 0x39, 0x51, 0x36, 0x1e, 0x0c, 0x02, 0x05, 0x02, 0x0b, 0x13, 0x31, 0x26,
-    0x29, 0x3f, 0x2e, 0x1f, 0x15, 0x0d, 0x04, 0x11, 0x03, 0x05, 0x09, 0x18, 0x2a, 0x22, 0x18, 0x28, 0x22, 0x1e, 0x0e,
-    0x01, 0x02, 0x03, 0x02, 0x3f, 0x32, 0x76, 0x76, 0x6e, 0x55, 0x31, 0x02, 0x03, 0x48, 0x02, 0x14, 0xfb, 0x1b, 0x13,
-    0x3b, 0x39, 0x2a, 0x02, 0x02, 0x2d, 0x4b, 0x5e, 0x5b, 0x4f, 0x17, 0x64, 0xc7, 0x64, 0x01, 0x64, 0xc7, 0x64, 0x34,
-    0x7b, 0x7c, 0x74, 0x58, 0x35, 0x01, 0x01, 0x3b, 0x46, 0x1c, 0x30, 0x24, 0x13, 0x01, 0x01, 0x2f, 0x4c, 0x60, 0x67,
-    0x65, 0x2a, 0x01, 0xaf, 0x1f, 0x26, 0x02, 0x02, 0x26, 0x3f, 0x51, 0x54, 0x4e, 0x1d, 0x84, 0x15, 0x3e, 0x44, 0x43,
-    0x37, 0x22, 0x01, 0x01, 0x0e, 0x18, 0x20, 0x11, 0x16, 0x2a, 0x16, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xaf, 0xff,
-    0xea, 0x04, 0x66, 0x05, 0xb0, 0x00, 0x40, 0x00, 0x3f, 0x40, 0x3c, 0x1b, 0x01, 0x00, 0x01, 0x40, 0x01, 0x04, 0x00,
-    0x02, 0x4a, 0x00, 0x05, 0x02, 0x01, 0x02, 0x05, 0x01, 0x70, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x63, 0x00,
-    0x02, 0x02, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x16, 0x4b, 0x00, 0x04, 0x04, 0x06, 0x5b, 0x00, 0x06, 0x06, 0x20, 0x06,
-    0x4c, 0x3c, 0x3a, 0x31, 0x30, 0x27, 0x25, 0x21, 0x26, 0x21, 0x24, 0x07, 0x06, 0x18, 0x2b, 0x01, 0x36, 0x2e, 0x02,
-    0x27, 0x27, 0x37, 0x17, 0x36, 0x36, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x37, 0x17, 0x1e, 0x03, 0x07, 0x06, 0x06,
-    0x07, 0x1e, 0x03, 0x07, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x04, 0x37, 0x36, 0x36, 0x27, 0x33, 0x16, 0x16,
-    0x07, 0x0e, 0x05, 0x27, 0x2e, 0x03, 0x37, 0x01, 0xbe, 0x03, 0x02, 0x18, 0x35, 0x2f, 0x8c, 0x1b, 0x46, 0x81, 0x97,
-    0x0f, 0x05, 0x0b, 0x28, 0x46, 0x36, 0xe6, 0x1b, 0xce, 0x5a, 0x88, 0x5a, 0x27, 0x08, 0x0b, 0x80, 0x69, 0x2b, 0x33,
-    0x18, 0x02, 0x04, 0x0d, 0x02, 0x05, 0x13, 0x23, 0x1c, 0x2b, 0x42, 0x31, 0x23, 0x17, 0x0e, 0x05, 0x0f, 0x07, 0x0f,
-    0xa9, 0x0c, 0x04, 0x0e, 0x08, 0x1e, 0x2f, 0x42, 0x59, 0x72, 0x47, 0x42, 0x62, 0x40, 0x1d, 0x04, 0x01, 0x75, 0x24,
-    0x57, 0x4e, 0x38, 0x03, 0x02, 0x97, 0x01, 0x01, 0x8d, 0x80, 0x30, 0x58, 0x43, 0x2a, 0x03, 0x01, 0x98, 0x01, 0x03,
-    0x3c, 0x69, 0x92, 0x58, 0x79, 0xaa, 0x36, 0x1a, 0x4d, 0x5a, 0x61, 0x2e, 0x6a, 0x17, 0x30, 0x27, 0x1b, 0x01, 0x02,
-    0x2a, 0x47, 0x5a, 0x5c, 0x54, 0x1d, 0x64, 0xc7, 0x64, 0x64, 0xc6, 0x64, 0x39, 0x80, 0x7c, 0x71, 0x56, 0x31, 0x01,
-    0x01, 0x2a, 0x4b, 0x69, 0x41, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x85, 0xff, 0xe4, 0x04, 0x44, 0x04, 0x3a, 0x00,
-    0x41, 0x00, 0x40, 0x40, 0x3d, 0x38, 0x01, 0x01, 0x05, 0x3d, 0x01, 0x03, 0x04, 0x1d, 0x01, 0x00, 0x03, 0x03, 0x4a,
-    0x00, 0x01, 0x05, 0x04, 0x05, 0x01, 0x04, 0x70, 0x00, 0x04, 0x00, 0x03, 0x00, 0x04, 0x03, 0x63, 0x00, 0x05, 0x05,
-    0x06, 0x5b, 0x00, 0x06, 0x06, 0x18, 0x4b, 0x00, 0x00, 0x00, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x1e, 0x02, 0x4c, 0x21,
-    0x28, 0x21, 0x29, 0x29, 0x19, 0x22, 0x07, 0x06, 0x1b, 0x2b, 0x25, 0x06, 0x16, 0x17, 0x16, 0x3e, 0x04, 0x37, 0x36,
-    0x26, 0x27, 0x17, 0x16, 0x16, 0x07, 0x0e, 0x05, 0x27, 0x2e, 0x03, 0x37, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x37,
-    0x17, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x37, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x16,
-    0x16, 0x07, 0x07, 0x02, 0x86, 0x03, 0x21, 0x2d, 0x22, 0x34, 0x26, 0x1b, 0x12, 0x0b, 0x04, 0x0c, 0x05, 0x13, 0xa9,
-    0x0e, 0x10, 0x0a, 0x07, 0x1a, 0x2b, 0x3b, 0x4e, 0x63, 0x3c, 0x3b, 0x5c, 0x40, 0x1f, 0x03, 0x09, 0x03, 0x17, 0x2d,
-    0x3e, 0x24, 0xb4, 0x19, 0x86, 0x2b, 0x59, 0x4b, 0x34, 0x06, 0x06, 0x1b, 0x36, 0x49, 0x28, 0xe4, 0x14, 0xd3, 0x48,
-    0x89, 0x69, 0x3b, 0x06, 0x03, 0x27, 0x3d, 0x4e, 0x2a, 0x4f, 0x41, 0x06, 0x08, 0xd3, 0x2a, 0x2c, 0x02, 0x01, 0x1e,
-    0x33, 0x42, 0x43, 0x40, 0x18, 0x50, 0x9e, 0x4e, 0x01, 0x4e, 0x9c, 0x50, 0x33, 0x6a, 0x65, 0x5a, 0x42, 0x27, 0x01,
-    0x01, 0x1e, 0x3b, 0x5a, 0x3d, 0x4d, 0x28, 0x37, 0x24, 0x11, 0x02, 0x01, 0x96, 0x01, 0x10, 0x27, 0x41, 0x32, 0x2e,
-    0x40, 0x28, 0x13, 0x01, 0x01, 0x96, 0x01, 0x02, 0x24, 0x4b, 0x75, 0x53, 0x32, 0x4b, 0x3a, 0x2b, 0x12, 0x1d, 0x7c,
-    0x51, 0x4f, 0x00, 0x02, 0x01, 0x0d, 0xfe, 0xa5, 0x03, 0xee, 0x05, 0xb0, 0x00, 0x31, 0x00, 0x3b, 0x00, 0x3c, 0x40,
-    0x39, 0x19, 0x01, 0x04, 0x00, 0x01, 0x4a, 0x36, 0x35, 0x02, 0x03, 0x47, 0x00, 0x00, 0x06, 0x01, 0x04, 0x05, 0x00,
-    0x04, 0x63, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x16, 0x4b, 0x00, 0x05, 0x05, 0x03, 0x59, 0x00, 0x03,
-    0x03, 0x17, 0x03, 0x4c, 0x00, 0x00, 0x3b, 0x3a, 0x00, 0x31, 0x00, 0x30, 0x26, 0x25, 0x21, 0x28, 0x21, 0x07, 0x06,
-    0x17, 0x2b, 0x01, 0x37, 0x17, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x25, 0x37, 0x05, 0x1e, 0x03, 0x07,
-    0x0e, 0x03, 0x07, 0x1e, 0x03, 0x07, 0x07, 0x06, 0x06, 0x16, 0x16, 0x17, 0x07, 0x23, 0x2e, 0x02, 0x36, 0x37, 0x37,
-    0x36, 0x2e, 0x02, 0x27, 0x01, 0x06, 0x06, 0x07, 0x27, 0x36, 0x36, 0x37, 0x37, 0x33, 0x01, 0x0d, 0x1b, 0x94, 0x45,
-    0x7e, 0x63, 0x41, 0x09, 0x07, 0x1b, 0x3f, 0x5e, 0x3c, 0xfe, 0xe8, 0x1b, 0x01, 0x00, 0x5e, 0xa1, 0x71, 0x39, 0x09,
-    0x05, 0x30, 0x4b, 0x62, 0x39, 0x34, 0x43, 0x24, 0x0a, 0x06, 0x14, 0x04, 0x04, 0x05, 0x12, 0x12, 0x03, 0xb3, 0x12,
-    0x12, 0x04, 0x05, 0x04, 0x13, 0x06, 0x12, 0x30, 0x50, 0x38, 0x01, 0xe4, 0x13, 0x76, 0x59, 0x6e, 0x35, 0x45, 0x0f,
-    0x20, 0xc4, 0x02, 0x79, 0x98, 0x01, 0x1b, 0x3f, 0x66, 0x4b, 0x3e, 0x5d, 0x3f, 0x20, 0x02, 0x01, 0x98, 0x01, 0x02,
-    0x34, 0x64, 0x97, 0x65, 0x41, 0x68, 0x53, 0x40, 0x18, 0x17, 0x47, 0x5a, 0x66, 0x34, 0x89, 0x1b, 0x37, 0x35, 0x32,
-    0x17, 0x1a, 0x19, 0x3a, 0x3e, 0x3e, 0x1e, 0x85, 0x34, 0x5e, 0x46, 0x2b, 0x03, 0xfd, 0xa9, 0x71, 0xc3, 0x48, 0x41,
-    0x46, 0x9a, 0x57, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xf4, 0xfe, 0x92, 0x03, 0xca, 0x04, 0x3a, 0x00, 0x2f,
-    0x00, 0x39, 0x00, 0x40, 0x40, 0x3d, 0x14, 0x01, 0x00, 0x01, 0x19, 0x01, 0x04, 0x00, 0x02, 0x4a, 0x34, 0x33, 0x02,
-    0x03, 0x47, 0x00, 0x00, 0x06, 0x01, 0x04, 0x05, 0x00, 0x04, 0x63, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02,
-    0x18, 0x4b, 0x00, 0x05, 0x05, 0x03, 0x59, 0x00, 0x03, 0x03, 0x17, 0x03, 0x4c, 0x00, 0x00, 0x39, 0x38, 0x00, 0x2f,
-    0x00, 0x2e, 0x24, 0x23, 0x21, 0x28, 0x21, 0x07, 0x06, 0x17, 0x2b, 0x13, 0x37, 0x17, 0x32, 0x3e, 0x02, 0x37, 0x36,
-    0x2e, 0x02, 0x27, 0x25, 0x37, 0x05, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x1e, 0x03, 0x07, 0x07, 0x06, 0x16, 0x17,
-    0x07, 0x07, 0x2e, 0x02, 0x36, 0x37, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x01, 0x06, 0x06, 0x07, 0x27, 0x36, 0x36, 0x37,
-    0x37, 0x33, 0xf4, 0x1b, 0xc3, 0x2d, 0x5b, 0x4c, 0x35, 0x07, 0x06, 0x1c, 0x37, 0x4a, 0x28, 0xfe, 0xe0, 0x1b, 0x01,
-    0x08, 0x48, 0x8b, 0x69, 0x3d, 0x06, 0x03, 0x28, 0x3f, 0x4f, 0x2b, 0x29, 0x38, 0x21, 0x0b, 0x04, 0x0d, 0x05, 0x09,
-    0x1f, 0x02, 0xb4, 0x10, 0x10, 0x06, 0x03, 0x03, 0x0d, 0x04, 0x13, 0x2b, 0x3f, 0x28, 0x01, 0xc3, 0x13, 0x76, 0x59,
-    0x6e, 0x35, 0x45, 0x0f, 0x20, 0xc4, 0x01, 0xb9, 0x96, 0x01, 0x10, 0x27, 0x42, 0x33, 0x2e, 0x40, 0x28, 0x12, 0x01,
-    0x01, 0x96, 0x01, 0x02, 0x23, 0x4b, 0x75, 0x53, 0x33, 0x4d, 0x3a, 0x2c, 0x11, 0x10, 0x33, 0x42, 0x4e, 0x2a, 0x62,
-    0x2b, 0x4c, 0x20, 0x14, 0x01, 0x12, 0x2a, 0x2d, 0x2e, 0x17, 0x61, 0x2a, 0x3d, 0x2a, 0x16, 0x02, 0xfe, 0x57, 0x71,
-    0xc3, 0x48, 0x41, 0x46, 0x9a, 0x57, 0xb3, 0x00, 0x00, 0x01, 0xff, 0xb0, 0xff, 0xea, 0x04, 0x8e, 0x05, 0xb0, 0x00,
-    0x34, 0x00, 0x65, 0x40, 0x0a, 0x34, 0x01, 0x02, 0x04, 0x1b, 0x01, 0x01, 0x02, 0x02, 0x4a, 0x4b, 0xb0, 0x19, 0x50,
-    0x58, 0x40, 0x1e, 0x00, 0x04, 0x00, 0x02, 0x00, 0x04, 0x02, 0x70, 0x00, 0x00, 0x00, 0x03, 0x59, 0x00, 0x03, 0x03,
-    0x16, 0x4b, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x05, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x1b, 0x40, 0x22, 0x00, 0x04,
-    0x00, 0x02, 0x00, 0x04, 0x02, 0x70, 0x00, 0x00, 0x00, 0x03, 0x59, 0x00, 0x03, 0x03, 0x16, 0x4b, 0x00, 0x02, 0x02,
-    0x01, 0x5b, 0x00, 0x01, 0x01, 0x17, 0x4b, 0x00, 0x05, 0x05, 0x20, 0x05, 0x4c, 0x59, 0x40, 0x0b, 0x30, 0x2e, 0x26,
-    0x25, 0x17, 0x21, 0x27, 0x10, 0x06, 0x06, 0x18, 0x2b, 0x01, 0x23, 0x03, 0x0e, 0x05, 0x27, 0x23, 0x37, 0x17, 0x32,
-    0x3e, 0x04, 0x37, 0x13, 0x21, 0x03, 0x06, 0x06, 0x16, 0x16, 0x17, 0x3e, 0x05, 0x37, 0x36, 0x36, 0x27, 0x37, 0x16,
-    0x07, 0x0e, 0x05, 0x27, 0x2e, 0x03, 0x37, 0x02, 0xca, 0xc3, 0x5a, 0x0b, 0x1a, 0x2b, 0x41, 0x62, 0x87, 0x5c, 0x27,
-    0x11, 0x14, 0x3c, 0x58, 0x3d, 0x27, 0x18, 0x0e, 0x06, 0x76, 0x02, 0x2a, 0xc7, 0x02, 0x02, 0x08, 0x16, 0x17, 0x26,
-    0x37, 0x27, 0x1a, 0x10, 0x09, 0x04, 0x0f, 0x11, 0x05, 0xa9, 0x0c, 0x1c, 0x07, 0x19, 0x29, 0x3a, 0x50, 0x68, 0x43,
-    0x3f, 0x57, 0x33, 0x13, 0x04, 0x05, 0x18, 0xfd, 0xe8, 0x43, 0xa7, 0xac, 0xa3, 0x7e, 0x4b, 0x02, 0x96, 0x01, 0x45,
-    0x6f, 0x8b, 0x8a, 0x7a, 0x28, 0x02, 0xb0, 0xfb, 0x5e, 0x13, 0x2d, 0x28, 0x20, 0x06, 0x03, 0x30, 0x48, 0x57, 0x58,
-    0x4f, 0x1b, 0x64, 0xc7, 0x65, 0x01, 0xcb, 0xc4, 0x33, 0x7a, 0x7c, 0x75, 0x59, 0x35, 0x01, 0x01, 0x30, 0x4f, 0x68,
-    0x39, 0x00, 0x00, 0x01, 0xff, 0xca, 0xff, 0xea, 0x04, 0x59, 0x04, 0x3a, 0x00, 0x35, 0x00, 0x78, 0x4b, 0xb0, 0x19,
-    0x50, 0x58, 0xb5, 0x06, 0x01, 0x01, 0x04, 0x01, 0x4a, 0x1b, 0xb5, 0x06, 0x01, 0x03, 0x04, 0x01, 0x4a, 0x59, 0x4b,
-    0xb0, 0x19, 0x50, 0x58, 0x40, 0x1f, 0x00, 0x00, 0x02, 0x04, 0x02, 0x00, 0x04, 0x70, 0x00, 0x02, 0x02, 0x05, 0x59,
-    0x06, 0x01, 0x05, 0x05, 0x18, 0x4b, 0x00, 0x04, 0x04, 0x01, 0x5b, 0x03, 0x01, 0x01, 0x01, 0x20, 0x01, 0x4c, 0x1b,
-    0x40, 0x23, 0x00, 0x00, 0x02, 0x04, 0x02, 0x00, 0x04, 0x70, 0x00, 0x02, 0x02, 0x05, 0x59, 0x06, 0x01, 0x05, 0x05,
-    0x18, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x17, 0x4b, 0x00, 0x01, 0x01, 0x20, 0x01, 0x4c, 0x59,
-    0x40, 0x13, 0x00, 0x00, 0x00, 0x35, 0x00, 0x35, 0x2e, 0x2c, 0x2b, 0x29, 0x22, 0x21, 0x1c, 0x1a, 0x11, 0x10, 0x07,
-    0x06, 0x14, 0x2b, 0x01, 0x03, 0x06, 0x06, 0x16, 0x16, 0x17, 0x3e, 0x05, 0x37, 0x36, 0x36, 0x27, 0x33, 0x16, 0x16,
-    0x07, 0x0e, 0x05, 0x27, 0x2e, 0x03, 0x37, 0x13, 0x23, 0x03, 0x0e, 0x05, 0x27, 0x23, 0x37, 0x33, 0x3e, 0x05, 0x37,
-    0x13, 0x03, 0x37, 0x81, 0x02, 0x02, 0x07, 0x15, 0x17, 0x24, 0x34, 0x26, 0x1a, 0x10, 0x0a, 0x04, 0x0d, 0x05, 0x0f,
-    0xa8, 0x0e, 0x05, 0x0d, 0x07, 0x19, 0x29, 0x39, 0x4f, 0x66, 0x41, 0x42, 0x57, 0x31, 0x11, 0x05, 0x6b, 0xbe, 0x34,
-    0x09, 0x15, 0x23, 0x35, 0x50, 0x6f, 0x4c, 0x2c, 0x17, 0x14, 0x2c, 0x3f, 0x2c, 0x1a, 0x11, 0x09, 0x04, 0x4c, 0x04,
-    0x3a, 0xfc, 0xe4, 0x13, 0x31, 0x2e, 0x25, 0x07, 0x03, 0x2a, 0x3e, 0x4d, 0x4e, 0x48, 0x1a, 0x5f, 0xbd, 0x5e, 0x5f,
-    0xbb, 0x5e, 0x33, 0x74, 0x72, 0x69, 0x50, 0x2e, 0x01, 0x01, 0x36, 0x56, 0x6f, 0x3a, 0x02, 0x80, 0xfe, 0xcd, 0x38,
-    0x88, 0x8c, 0x83, 0x65, 0x3c, 0x02, 0xa3, 0x01, 0x34, 0x53, 0x66, 0x65, 0x5a, 0x1e, 0x01, 0xcc, 0x00, 0x01, 0x00,
-    0x03, 0xff, 0xe9, 0x04, 0x70, 0x05, 0xb0, 0x00, 0x29, 0x00, 0x78, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0xb5, 0x06, 0x01,
-    0x01, 0x02, 0x01, 0x4a, 0x1b, 0xb5, 0x06, 0x01, 0x03, 0x02, 0x01, 0x4a, 0x59, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40,
-    0x1e, 0x00, 0x00, 0x04, 0x05, 0x04, 0x00, 0x05, 0x70, 0x00, 0x05, 0x00, 0x02, 0x01, 0x05, 0x02, 0x62, 0x07, 0x06,
-    0x02, 0x04, 0x04, 0x16, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x1e, 0x01, 0x4c, 0x1b, 0x40, 0x22, 0x00, 0x00, 0x04, 0x05,
-    0x04, 0x00, 0x05, 0x70, 0x00, 0x05, 0x00, 0x02, 0x03, 0x05, 0x02, 0x62, 0x07, 0x06, 0x02, 0x04, 0x04, 0x16, 0x4b,
-    0x00, 0x03, 0x03, 0x17, 0x4b, 0x00, 0x01, 0x01, 0x1e, 0x01, 0x4c, 0x59, 0x40, 0x15, 0x00, 0x00, 0x00, 0x29, 0x00,
-    0x29, 0x28, 0x27, 0x26, 0x25, 0x24, 0x23, 0x22, 0x21, 0x1c, 0x1a, 0x11, 0x10, 0x08, 0x06, 0x14, 0x2b, 0x01, 0x03,
-    0x06, 0x06, 0x16, 0x16, 0x17, 0x3e, 0x05, 0x37, 0x36, 0x36, 0x27, 0x33, 0x16, 0x16, 0x07, 0x0e, 0x05, 0x27, 0x2e,
-    0x03, 0x37, 0x13, 0x21, 0x03, 0x23, 0x13, 0x33, 0x03, 0x21, 0x13, 0x03, 0x8a, 0xc0, 0x02, 0x05, 0x05, 0x16, 0x18,
-    0x25, 0x37, 0x26, 0x19, 0x10, 0x0a, 0x04, 0x0e, 0x0a, 0x0e, 0xa7, 0x0c, 0x04, 0x0e, 0x07, 0x19, 0x28, 0x3a, 0x50,
-    0x68, 0x43, 0x45, 0x56, 0x2f, 0x0d, 0x05, 0x36, 0xfe, 0xdf, 0x70, 0xb5, 0xfd, 0xb5, 0x73, 0x01, 0x21, 0x72, 0x05,
-    0xb0, 0xfb, 0x82, 0x13, 0x37, 0x36, 0x2b, 0x07, 0x03, 0x30, 0x49, 0x58, 0x57, 0x4f, 0x1b, 0x64, 0xc7, 0x64, 0x64,
-    0xc6, 0x64, 0x32, 0x7b, 0x7c, 0x75, 0x5a, 0x35, 0x02, 0x01, 0x3c, 0x5e, 0x74, 0x3a, 0x01, 0x51, 0xfd, 0x7b, 0x05,
-    0xb0, 0xfd, 0x6c, 0x02, 0x94, 0x00, 0x00, 0x01, 0x00, 0x09, 0xff, 0xea, 0x04, 0x57, 0x04, 0x3a, 0x00, 0x29, 0x00,
-    0x5f, 0xb5, 0x0f, 0x01, 0x01, 0x00, 0x01, 0x4a, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x1d, 0x00, 0x05, 0x02, 0x03,
-    0x02, 0x05, 0x03, 0x70, 0x00, 0x03, 0x00, 0x00, 0x01, 0x03, 0x00, 0x62, 0x04, 0x01, 0x02, 0x02, 0x18, 0x4b, 0x06,
-    0x01, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x1b, 0x40, 0x21, 0x00, 0x05, 0x02, 0x03, 0x02, 0x05, 0x03, 0x70, 0x00, 0x03,
-    0x00, 0x00, 0x01, 0x03, 0x00, 0x62, 0x04, 0x01, 0x02, 0x02, 0x18, 0x4b, 0x00, 0x01, 0x01, 0x17, 0x4b, 0x00, 0x06,
-    0x06, 0x20, 0x06, 0x4c, 0x59, 0x40, 0x0c, 0x25, 0x23, 0x1a, 0x19, 0x11, 0x11, 0x11, 0x11, 0x10, 0x07, 0x06, 0x19,
-    0x2b, 0x01, 0x21, 0x03, 0x23, 0x13, 0x33, 0x03, 0x21, 0x13, 0x33, 0x03, 0x06, 0x14, 0x16, 0x16, 0x17, 0x3e, 0x05,
-    0x37, 0x36, 0x36, 0x27, 0x33, 0x16, 0x06, 0x07, 0x0e, 0x05, 0x27, 0x2e, 0x03, 0x37, 0x02, 0x11, 0xfe, 0xfd, 0x50,
-    0xb5, 0xbc, 0xb5, 0x52, 0x01, 0x03, 0x52, 0xb5, 0x84, 0x02, 0x0c, 0x1c, 0x1b, 0x21, 0x31, 0x22, 0x17, 0x0e, 0x08,
-    0x04, 0x0d, 0x0e, 0x07, 0xa8, 0x07, 0x05, 0x0d, 0x07, 0x17, 0x26, 0x36, 0x4b, 0x62, 0x3f, 0x44, 0x5c, 0x37, 0x14,
-    0x05, 0x01, 0xcd, 0xfe, 0x33, 0x04, 0x3a, 0xfe, 0x2a, 0x01, 0xd6, 0xfc, 0xe6, 0x17, 0x33, 0x2e, 0x22, 0x06, 0x04,
-    0x2a, 0x40, 0x4d, 0x4e, 0x46, 0x19, 0x5e, 0xbd, 0x5f, 0x5f, 0xbc, 0x5e, 0x30, 0x72, 0x72, 0x6a, 0x51, 0x30, 0x01,
-    0x01, 0x33, 0x55, 0x6f, 0x3e, 0x00, 0x00, 0x01, 0x00, 0x82, 0xff, 0xe8, 0x04, 0x5c, 0x05, 0xc7, 0x00, 0x35, 0x00,
-    0x3c, 0x40, 0x39, 0x12, 0x01, 0x02, 0x01, 0x13, 0x01, 0x04, 0x02, 0x02, 0x4a, 0x00, 0x04, 0x02, 0x03, 0x02, 0x04,
-    0x03, 0x70, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x1d, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x05, 0x01,
-    0x00, 0x00, 0x1e, 0x00, 0x4c, 0x01, 0x00, 0x2e, 0x2d, 0x26, 0x24, 0x17, 0x15, 0x10, 0x0e, 0x00, 0x35, 0x01, 0x35,
-    0x06, 0x06, 0x14, 0x2b, 0x05, 0x2e, 0x05, 0x37, 0x13, 0x3e, 0x05, 0x33, 0x16, 0x16, 0x17, 0x07, 0x26, 0x26, 0x27,
-    0x22, 0x0e, 0x04, 0x07, 0x03, 0x06, 0x06, 0x1e, 0x03, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x36, 0x36, 0x27, 0x33, 0x16,
-    0x16, 0x07, 0x0e, 0x03, 0x02, 0x24, 0x52, 0x82, 0x61, 0x41, 0x24, 0x08, 0x09, 0x29, 0x0c, 0x32, 0x4c, 0x64, 0x7d,
-    0x95, 0x56, 0x5b, 0xa9, 0x4e, 0x45, 0x3f, 0x8c, 0x48, 0x3e, 0x68, 0x56, 0x43, 0x32, 0x21, 0x08, 0x2a, 0x06, 0x02,
-    0x0e, 0x20, 0x39, 0x54, 0x3b, 0x45, 0x74, 0x59, 0x3a, 0x0b, 0x0f, 0x01, 0x0b, 0xac, 0x07, 0x07, 0x0c, 0x0e, 0x5c,
-    0x8c, 0xb5, 0x15, 0x02, 0x36, 0x5a, 0x78, 0x87, 0x92, 0x47, 0x01, 0x06, 0x4d, 0x98, 0x8a, 0x76, 0x57, 0x30, 0x01,
-    0x29, 0x30, 0x84, 0x23, 0x23, 0x01, 0x27, 0x44, 0x5c, 0x68, 0x6f, 0x35, 0xfe, 0xf7, 0x2d, 0x66, 0x67, 0x5f, 0x4a,
-    0x2d, 0x02, 0x02, 0x2b, 0x51, 0x70, 0x42, 0x58, 0xb4, 0x59, 0x59, 0xb2, 0x59, 0x67, 0xa9, 0x78, 0x3f, 0x00, 0x01,
-    0x00, 0x85, 0xff, 0xe9, 0x04, 0x0b, 0x04, 0x51, 0x00, 0x2d, 0x00, 0x3c, 0x40, 0x39, 0x1f, 0x01, 0x04, 0x03, 0x20,
-    0x01, 0x01, 0x04, 0x02, 0x4a, 0x00, 0x01, 0x04, 0x00, 0x04, 0x01, 0x00, 0x70, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00,
-    0x03, 0x03, 0x1f, 0x4b, 0x05, 0x01, 0x00, 0x00, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x20, 0x02, 0x4c, 0x01, 0x00, 0x24,
-    0x22, 0x1d, 0x1b, 0x12, 0x10, 0x09, 0x08, 0x00, 0x2d, 0x01, 0x2d, 0x06, 0x06, 0x14, 0x2b, 0x25, 0x16, 0x3e, 0x02,
-    0x37, 0x36, 0x36, 0x27, 0x33, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x37, 0x3e, 0x03, 0x17, 0x16,
-    0x16, 0x17, 0x07, 0x26, 0x26, 0x27, 0x22, 0x0e, 0x02, 0x07, 0x07, 0x06, 0x1e, 0x02, 0x02, 0x4f, 0x31, 0x57, 0x45,
-    0x2f, 0x08, 0x08, 0x05, 0x06, 0xa8, 0x05, 0x04, 0x06, 0x0a, 0x51, 0x7a, 0x99, 0x53, 0x72, 0xad, 0x70, 0x30, 0x0b,
-    0x05, 0x0d, 0x60, 0x96, 0xc7, 0x75, 0x51, 0x9e, 0x47, 0x39, 0x3c, 0x84, 0x43, 0x53, 0x86, 0x64, 0x3e, 0x0b, 0x05,
-    0x08, 0x14, 0x40, 0x6f, 0x82, 0x01, 0x15, 0x2f, 0x4a, 0x33, 0x36, 0x6c, 0x36, 0x36, 0x6a, 0x36, 0x58, 0x83, 0x57,
-    0x29, 0x02, 0x03, 0x57, 0x93, 0xc1, 0x6c, 0x2b, 0x70, 0xc7, 0x94, 0x56, 0x01, 0x01, 0x1d, 0x28, 0x8e, 0x20, 0x1c,
-    0x01, 0x42, 0x6d, 0x8e, 0x4c, 0x2a, 0x47, 0x8a, 0x6d, 0x45, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc3, 0xff, 0xe9, 0x04,
-    0x71, 0x05, 0xb0, 0x00, 0x25, 0x00, 0x2a, 0x40, 0x27, 0x00, 0x04, 0x00, 0x03, 0x00, 0x04, 0x03, 0x70, 0x02, 0x01,
-    0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x16, 0x4b, 0x00, 0x03, 0x03, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x20, 0x05,
-    0x4c, 0x29, 0x19, 0x25, 0x11, 0x11, 0x10, 0x06, 0x06, 0x1a, 0x2b, 0x01, 0x21, 0x37, 0x21, 0x07, 0x21, 0x03, 0x06,
-    0x1e, 0x02, 0x17, 0x16, 0x3e, 0x04, 0x37, 0x36, 0x36, 0x27, 0x33, 0x16, 0x16, 0x07, 0x0e, 0x05, 0x27, 0x2e, 0x03,
-    0x37, 0x02, 0x22, 0xfe, 0xa1, 0x1b, 0x03, 0x8d, 0x1b, 0xfe, 0x86, 0xa2, 0x03, 0x02, 0x16, 0x2f, 0x29, 0x30, 0x4a,
-    0x39, 0x28, 0x1c, 0x11, 0x06, 0x11, 0x06, 0x0f, 0xa8, 0x0d, 0x05, 0x0f, 0x09, 0x22, 0x35, 0x4a, 0x61, 0x7a, 0x4a,
-    0x50, 0x6e, 0x42, 0x19, 0x06, 0x05, 0x18, 0x98, 0x98, 0xfc, 0x40, 0x1f, 0x49, 0x40, 0x2d, 0x02, 0x02, 0x27, 0x42,
-    0x57, 0x5b, 0x58, 0x23, 0x64, 0xc7, 0x64, 0x64, 0xc6, 0x64, 0x3e, 0x83, 0x7d, 0x6e, 0x52, 0x2f, 0x02, 0x02, 0x3b,
-    0x64, 0x83, 0x4a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xff, 0xe9, 0x04, 0x35, 0x04, 0x3a, 0x00, 0x21, 0x00, 0x2a,
-    0x40, 0x27, 0x00, 0x04, 0x00, 0x03, 0x00, 0x04, 0x03, 0x70, 0x02, 0x01, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01,
-    0x18, 0x4b, 0x00, 0x03, 0x03, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x1e, 0x05, 0x4c, 0x27, 0x17, 0x25, 0x11, 0x11, 0x10,
-    0x06, 0x06, 0x1a, 0x2b, 0x01, 0x21, 0x37, 0x21, 0x07, 0x21, 0x03, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37,
-    0x36, 0x26, 0x27, 0x17, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x01, 0xc7, 0xfe, 0xb9, 0x1a, 0x03,
-    0x6c, 0x1b, 0xfe, 0x92, 0x62, 0x03, 0x03, 0x16, 0x30, 0x29, 0x3b, 0x54, 0x39, 0x20, 0x07, 0x0d, 0x04, 0x12, 0xa7,
-    0x0f, 0x0f, 0x0b, 0x0b, 0x41, 0x6b, 0x96, 0x61, 0x50, 0x70, 0x43, 0x19, 0x06, 0x03, 0xa4, 0x96, 0x96, 0xfd, 0xb4,
-    0x20, 0x49, 0x40, 0x2c, 0x02, 0x02, 0x3a, 0x5b, 0x6c, 0x2f, 0x51, 0xa1, 0x50, 0x01, 0x50, 0x9f, 0x51, 0x57, 0xa5,
-    0x7f, 0x4c, 0x02, 0x01, 0x3c, 0x63, 0x84, 0x4a, 0x00, 0x00, 0x01, 0x00, 0x40, 0xff, 0xea, 0x04, 0x92, 0x05, 0xc8,
-    0x00, 0x40, 0x00, 0x4e, 0x40, 0x4b, 0x1f, 0x01, 0x00, 0x07, 0x01, 0x4a, 0x00, 0x05, 0x06, 0x07, 0x06, 0x05, 0x07,
-    0x70, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x70, 0x00, 0x07, 0x08, 0x01, 0x00, 0x02, 0x07, 0x00, 0x63, 0x00,
-    0x06, 0x06, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x1d, 0x4b, 0x00, 0x01, 0x01, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x20, 0x03,
-    0x4c, 0x01, 0x00, 0x3f, 0x3d, 0x35, 0x33, 0x2f, 0x2e, 0x2a, 0x28, 0x16, 0x14, 0x10, 0x0f, 0x0b, 0x09, 0x00, 0x40,
-    0x01, 0x40, 0x09, 0x06, 0x14, 0x2b, 0x01, 0x22, 0x0e, 0x02, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37,
-    0x37, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x3e, 0x03, 0x37, 0x2e, 0x03, 0x37, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07,
-    0x27, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x17, 0x07, 0x02, 0x78, 0x45, 0x81,
-    0x67, 0x45, 0x09, 0x08, 0x2b, 0x51, 0x6e, 0x3c, 0x40, 0x73, 0x5b, 0x3f, 0x0c, 0xb4, 0x0c, 0x5e, 0x90, 0xb7, 0x64,
-    0x5e, 0xad, 0x81, 0x47, 0x08, 0x05, 0x33, 0x52, 0x6d, 0x3f, 0x2a, 0x43, 0x2d, 0x16, 0x03, 0x07, 0x62, 0x99, 0xc1,
-    0x65, 0x58, 0x98, 0x6e, 0x3b, 0x04, 0xb3, 0x03, 0x20, 0x3e, 0x59, 0x37, 0x40, 0x7b, 0x64, 0x44, 0x08, 0x08, 0x22,
-    0x45, 0x61, 0x38, 0xbd, 0x1b, 0x02, 0x9b, 0x1c, 0x41, 0x68, 0x4c, 0x42, 0x63, 0x42, 0x22, 0x01, 0x01, 0x27, 0x48,
-    0x66, 0x3f, 0x01, 0x68, 0xa0, 0x6c, 0x36, 0x02, 0x02, 0x35, 0x67, 0x9c, 0x68, 0x46, 0x70, 0x57, 0x3f, 0x16, 0x18,
-    0x3f, 0x4d, 0x58, 0x31, 0x6e, 0xa2, 0x69, 0x32, 0x03, 0x03, 0x3a, 0x68, 0x93, 0x5b, 0x01, 0x36, 0x5a, 0x42, 0x26,
-    0x02, 0x02, 0x20, 0x43, 0x66, 0x44, 0x3e, 0x59, 0x39, 0x1d, 0x02, 0x01, 0x98, 0x00, 0x00, 0xff, 0xff, 0x00, 0x51,
-    0x02, 0x8b, 0x04, 0x93, 0x03, 0x22, 0x00, 0x47, 0x01, 0x88, 0xff, 0x72, 0x00, 0x00, 0x53, 0x33, 0x40, 0x00, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0x56, 0x02, 0x8b, 0x04, 0x98, 0x03, 0x22, 0x00, 0x47, 0x01, 0x88, 0xff, 0x77, 0x00, 0x00,
-    0x53, 0x33, 0x40, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf3, 0xfe, 0x6a, 0x03, 0xb4, 0x00, 0x00, 0x02, 0x27, 0x00,
-    0x41, 0xff, 0xdf, 0xff, 0x01, 0x01, 0x06, 0x00, 0x41, 0x0b, 0x00, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0xff, 0x01,
-    0xb0, 0x33, 0x2b, 0x00, 0x00, 0x01, 0x02, 0x29, 0x04, 0x0f, 0x03, 0x82, 0x06, 0x1d, 0x00, 0x09, 0x00, 0x10, 0x40,
-    0x0d, 0x04, 0x03, 0x02, 0x00, 0x48, 0x00, 0x00, 0x00, 0x69, 0x18, 0x01, 0x08, 0x15, 0x2b, 0x01, 0x36, 0x36, 0x37,
-    0x17, 0x06, 0x06, 0x07, 0x07, 0x23, 0x02, 0x40, 0x13, 0x76, 0x5a, 0x5f, 0x34, 0x4b, 0x0f, 0x1b, 0xb0, 0x04, 0xa0,
-    0x72, 0xc3, 0x48, 0x4a, 0x45, 0x94, 0x56, 0x95, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x18, 0x04, 0x07, 0x03, 0x71,
-    0x06, 0x16, 0x00, 0x09, 0x00, 0x10, 0x40, 0x0d, 0x04, 0x03, 0x02, 0x00, 0x47, 0x00, 0x00, 0x00, 0x69, 0x18, 0x01,
-    0x08, 0x15, 0x2b, 0x01, 0x06, 0x06, 0x07, 0x27, 0x36, 0x36, 0x37, 0x37, 0x33, 0x03, 0x59, 0x12, 0x77, 0x59, 0x5f,
-    0x34, 0x4a, 0x10, 0x1a, 0xb1, 0x05, 0x84, 0x72, 0xc4, 0x47, 0x4a, 0x45, 0x94, 0x56, 0x96, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x20, 0xfe, 0xd1, 0x02, 0x7d, 0x00, 0xe1, 0x00, 0x09, 0x00, 0x10, 0x40, 0x0d, 0x04, 0x03, 0x02, 0x00,
-    0x47, 0x00, 0x00, 0x00, 0x69, 0x18, 0x01, 0x08, 0x15, 0x2b, 0x25, 0x06, 0x06, 0x07, 0x27, 0x36, 0x36, 0x37, 0x37,
-    0x33, 0x02, 0x66, 0x13, 0x78, 0x58, 0x63, 0x35, 0x4a, 0x0f, 0x1b, 0xb4, 0x4d, 0x71, 0xc3, 0x48, 0x4b, 0x45, 0x93,
-    0x56, 0x97, 0xff, 0xff, 0x01, 0x1a, 0x04, 0x07, 0x02, 0x74, 0x06, 0x16, 0x00, 0x47, 0x01, 0x68, 0x04, 0x8b, 0x00,
-    0x00, 0xc0, 0x00, 0x40, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x8b, 0x04, 0x0f, 0x04, 0x1f, 0x06, 0x1d, 0x02, 0x27,
-    0x01, 0x67, 0xff, 0x62, 0x00, 0x00, 0x00, 0x07, 0x01, 0x67, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01,
-    0x7d, 0x04, 0x07, 0x04, 0x18, 0x06, 0x16, 0x02, 0x27, 0x01, 0x68, 0xff, 0x65, 0x00, 0x00, 0x00, 0x07, 0x01, 0x68,
-    0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x97, 0xfe, 0xcf, 0x03, 0x0e, 0x00, 0xdf, 0x00, 0x09, 0x00,
-    0x13, 0x00, 0x14, 0x40, 0x11, 0x0e, 0x0d, 0x04, 0x03, 0x04, 0x00, 0x47, 0x01, 0x01, 0x00, 0x00, 0x69, 0x19, 0x18,
-    0x02, 0x08, 0x16, 0x2b, 0x25, 0x06, 0x06, 0x07, 0x27, 0x36, 0x36, 0x37, 0x37, 0x33, 0x05, 0x06, 0x06, 0x07, 0x27,
-    0x36, 0x36, 0x37, 0x37, 0x33, 0x01, 0xdd, 0x13, 0x78, 0x58, 0x63, 0x34, 0x4b, 0x0f, 0x1b, 0xb4, 0x01, 0x02, 0x12,
-    0x78, 0x59, 0x63, 0x35, 0x4a, 0x10, 0x1a, 0xb5, 0x4c, 0x72, 0xc3, 0x48, 0x4b, 0x45, 0x93, 0x56, 0x97, 0x93, 0x72,
-    0xc3, 0x48, 0x4b, 0x45, 0x93, 0x56, 0x97, 0x00, 0x01, 0x00, 0xa6, 0x00, 0x00, 0x04, 0x80, 0x05, 0xb0, 0x00, 0x0b,
-    0x00, 0x23, 0x40, 0x20, 0x00, 0x04, 0x04, 0x3c, 0x4b, 0x02, 0x01, 0x00, 0x00, 0x03, 0x59, 0x05, 0x01, 0x03, 0x03,
-    0x3f, 0x4b, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x01,
-    0x21, 0x03, 0x23, 0x13, 0x21, 0x37, 0x21, 0x13, 0x33, 0x03, 0x21, 0x04, 0x68, 0xfe, 0x77, 0x91, 0xb5, 0x92, 0xfe,
-    0x7b, 0x19, 0x01, 0x83, 0x3b, 0xb5, 0x3b, 0x01, 0x89, 0x03, 0xa1, 0xfc, 0x5f, 0x03, 0xa1, 0x99, 0x01, 0x76, 0xfe,
-    0x8a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x17, 0xfe, 0x60, 0x04, 0x81, 0x05, 0xb0, 0x00, 0x13, 0x00, 0x34, 0x40,
-    0x31, 0x00, 0x06, 0x06, 0x3c, 0x4b, 0x08, 0x01, 0x04, 0x04, 0x05, 0x59, 0x07, 0x01, 0x05, 0x05, 0x3f, 0x4b, 0x09,
-    0x01, 0x03, 0x03, 0x00, 0x59, 0x02, 0x01, 0x00, 0x00, 0x3d, 0x4b, 0x00, 0x01, 0x01, 0x41, 0x01, 0x4c, 0x13, 0x12,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0a, 0x08, 0x1d, 0x2b, 0x21, 0x21, 0x03, 0x23, 0x13, 0x21,
-    0x37, 0x21, 0x13, 0x21, 0x37, 0x21, 0x13, 0x33, 0x03, 0x21, 0x07, 0x21, 0x03, 0x21, 0x03, 0xd8, 0xfe, 0x75, 0x41,
-    0xb5, 0x42, 0xfe, 0x7e, 0x18, 0x01, 0x81, 0x7a, 0xfe, 0x7e, 0x18, 0x01, 0x81, 0x3b, 0xb5, 0x3b, 0x01, 0x8b, 0x18,
-    0xfe, 0x75, 0x79, 0x01, 0x8b, 0xfe, 0x60, 0x01, 0xa0, 0x97, 0x03, 0x0a, 0x99, 0x01, 0x76, 0xfe, 0x8a, 0x99, 0xfc,
-    0xf6, 0x00, 0x00, 0x00, 0x01, 0x01, 0xa9, 0x02, 0x14, 0x03, 0x38, 0x03, 0xdc, 0x00, 0x15, 0x00, 0x18, 0x40, 0x15,
-    0x00, 0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x5b, 0x00, 0x01, 0x00, 0x01, 0x4f, 0x29, 0x24, 0x02,
-    0x08, 0x16, 0x2b, 0x01, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x07, 0x07, 0x0e, 0x03, 0x27, 0x22, 0x2e, 0x02, 0x35,
-    0x01, 0xab, 0x03, 0x20, 0x37, 0x4c, 0x2d, 0x2b, 0x46, 0x30, 0x19, 0x01, 0x03, 0x03, 0x21, 0x37, 0x4b, 0x2d, 0x2a,
-    0x44, 0x30, 0x1a, 0x03, 0x10, 0x2c, 0x4b, 0x37, 0x1e, 0x1f, 0x35, 0x48, 0x2b, 0x3a, 0x2c, 0x49, 0x35, 0x1d, 0x01,
-    0x1d, 0x33, 0x46, 0x2a, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xec, 0x03, 0xc7, 0x01, 0x09, 0x02, 0x27, 0x00, 0x10, 0xff,
-    0x70, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x01, 0x1d, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xae, 0xff, 0xec,
-    0x04, 0xac, 0x01, 0x09, 0x02, 0x27, 0x00, 0x10, 0xff, 0x20, 0x00, 0x00, 0x00, 0x27, 0x00, 0x10, 0x00, 0x97, 0x00,
-    0x00, 0x00, 0x07, 0x00, 0x10, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x5c, 0xff, 0xe7, 0x04, 0x49,
-    0x05, 0xc7, 0x00, 0x21, 0x00, 0x37, 0x00, 0x3b, 0x00, 0x51, 0x00, 0x67, 0x00, 0x7d, 0x00, 0x5b, 0x40, 0x58, 0x7d,
-    0x72, 0x3b, 0x3a, 0x37, 0x2d, 0x06, 0x0a, 0x0b, 0x39, 0x08, 0x02, 0x07, 0x00, 0x67, 0x5c, 0x51, 0x46, 0x11, 0x00,
-    0x06, 0x06, 0x07, 0x19, 0x01, 0x02, 0x06, 0x04, 0x4a, 0x00, 0x0a, 0x00, 0x05, 0x00, 0x0a, 0x05, 0x63, 0x01, 0x01,
-    0x00, 0x09, 0x01, 0x07, 0x06, 0x00, 0x07, 0x63, 0x00, 0x0b, 0x0b, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x44, 0x4b, 0x08,
-    0x01, 0x06, 0x06, 0x02, 0x5b, 0x03, 0x01, 0x02, 0x02, 0x45, 0x02, 0x4c, 0x79, 0x77, 0x6e, 0x6c, 0x63, 0x61, 0x29,
-    0x29, 0x2d, 0x29, 0x29, 0x24, 0x29, 0x24, 0x24, 0x0c, 0x08, 0x1d, 0x2b, 0x01, 0x3e, 0x03, 0x33, 0x16, 0x16, 0x17,
-    0x36, 0x36, 0x17, 0x1e, 0x03, 0x07, 0x07, 0x0e, 0x03, 0x27, 0x26, 0x26, 0x27, 0x06, 0x06, 0x27, 0x22, 0x2e, 0x02,
-    0x37, 0x03, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x03, 0x27, 0x01, 0x17,
-    0x01, 0x06, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x37, 0x36, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x05,
-    0x06, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x37, 0x36, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x03, 0x06,
-    0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x37, 0x36, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x01, 0x16, 0x05,
-    0x28, 0x45, 0x61, 0x3e, 0x32, 0x55, 0x1e, 0x26, 0x56, 0x35, 0x39, 0x50, 0x30, 0x13, 0x03, 0x03, 0x05, 0x28, 0x45,
-    0x60, 0x3d, 0x32, 0x55, 0x1f, 0x26, 0x56, 0x34, 0x39, 0x50, 0x31, 0x14, 0x03, 0x79, 0x04, 0x27, 0x43, 0x5f, 0x3e,
-    0x3a, 0x51, 0x31, 0x15, 0x03, 0x03, 0x05, 0x27, 0x43, 0x5e, 0x3c, 0x39, 0x51, 0x33, 0x16, 0x02, 0x03, 0x37, 0x03,
-    0x64, 0x37, 0xfe, 0xfb, 0x01, 0x04, 0x12, 0x24, 0x1e, 0x20, 0x2b, 0x1b, 0x0d, 0x02, 0x03, 0x01, 0x04, 0x11, 0x24,
-    0x1e, 0x20, 0x2c, 0x1b, 0x0d, 0x02, 0xfe, 0xa7, 0x01, 0x04, 0x12, 0x24, 0x1e, 0x20, 0x2b, 0x1b, 0x0d, 0x02, 0x03,
-    0x01, 0x04, 0x12, 0x23, 0x1e, 0x21, 0x2b, 0x1b, 0x0d, 0x02, 0x7f, 0x01, 0x04, 0x12, 0x23, 0x1e, 0x1f, 0x2b, 0x1b,
-    0x0e, 0x02, 0x03, 0x01, 0x04, 0x11, 0x24, 0x1e, 0x20, 0x2b, 0x1b, 0x0d, 0x02, 0x01, 0x28, 0x38, 0x69, 0x51, 0x30,
-    0x01, 0x26, 0x27, 0x23, 0x28, 0x01, 0x01, 0x31, 0x4e, 0x62, 0x32, 0x2d, 0x38, 0x68, 0x4f, 0x2f, 0x01, 0x01, 0x25,
-    0x27, 0x22, 0x28, 0x01, 0x2f, 0x4d, 0x61, 0x32, 0x03, 0xaa, 0x37, 0x6a, 0x51, 0x30, 0x01, 0x01, 0x31, 0x4e, 0x64,
-    0x33, 0x2d, 0x37, 0x66, 0x4f, 0x2f, 0x01, 0x01, 0x2f, 0x4c, 0x61, 0x33, 0xfd, 0x46, 0x5a, 0x02, 0x7d, 0x5a, 0xfc,
-    0xc1, 0x17, 0x37, 0x2f, 0x1f, 0x20, 0x31, 0x39, 0x1a, 0x2c, 0x17, 0x37, 0x30, 0x21, 0x20, 0x32, 0x3b, 0x19, 0x2d,
-    0x17, 0x36, 0x2f, 0x20, 0x20, 0x31, 0x39, 0x1a, 0x2c, 0x17, 0x37, 0x30, 0x21, 0x21, 0x31, 0x3b, 0x19, 0x03, 0x50,
-    0x17, 0x36, 0x2f, 0x1f, 0x20, 0x31, 0x39, 0x19, 0x2c, 0x17, 0x37, 0x30, 0x21, 0x21, 0x31, 0x3b, 0x19, 0x00, 0x00,
-    0x00, 0x01, 0x01, 0x76, 0x00, 0x99, 0x03, 0x6b, 0x03, 0xb5, 0x00, 0x06, 0x00, 0x17, 0x40, 0x14, 0x03, 0x01, 0x00,
-    0x01, 0x01, 0x4a, 0x00, 0x01, 0x00, 0x01, 0x72, 0x00, 0x00, 0x00, 0x69, 0x13, 0x11, 0x02, 0x08, 0x16, 0x2b, 0x01,
-    0x13, 0x23, 0x03, 0x37, 0x01, 0x33, 0x02, 0x23, 0xb1, 0x7c, 0xe2, 0x02, 0x01, 0x5c, 0x97, 0x02, 0x1c, 0xfe, 0x7d,
-    0x01, 0x83, 0x14, 0x01, 0x85, 0x00, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x00, 0x98, 0x03, 0x20, 0x03, 0xb5, 0x00, 0x06,
-    0x00, 0x1f, 0x40, 0x1c, 0x05, 0x02, 0x01, 0x03, 0x00, 0x01, 0x01, 0x4a, 0x02, 0x01, 0x01, 0x00, 0x01, 0x72, 0x00,
-    0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x13, 0x03, 0x08, 0x15, 0x2b, 0x01, 0x13, 0x07, 0x01, 0x23,
-    0x01, 0x03, 0x02, 0x40, 0xe0, 0x01, 0xfe, 0xa5, 0x98, 0x01, 0x48, 0xb2, 0x03, 0xb5, 0xfe, 0x7d, 0x14, 0xfe, 0x7a,
-    0x01, 0x98, 0x01, 0x85, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xe9, 0x00, 0xd7, 0x03, 0xe6, 0x04, 0xcf, 0x00, 0x03,
-    0x00, 0x06, 0xb3, 0x02, 0x00, 0x01, 0x30, 0x2b, 0x25, 0x27, 0x01, 0x17, 0x01, 0x54, 0x6b, 0x02, 0x92, 0x6b, 0xd7,
-    0x47, 0x03, 0xb1, 0x47, 0x00, 0x00, 0x02, 0x01, 0x24, 0x02, 0x38, 0x04, 0x2a, 0x05, 0xc3, 0x00, 0x0a, 0x00, 0x0e,
-    0x00, 0x49, 0xb5, 0x0d, 0x01, 0x00, 0x04, 0x01, 0x4a, 0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40, 0x16, 0x00, 0x02, 0x01,
-    0x01, 0x02, 0x67, 0x05, 0x01, 0x00, 0x03, 0x01, 0x01, 0x02, 0x00, 0x01, 0x62, 0x00, 0x04, 0x04, 0x3c, 0x04, 0x4c,
-    0x1b, 0x40, 0x15, 0x00, 0x02, 0x01, 0x02, 0x73, 0x05, 0x01, 0x00, 0x03, 0x01, 0x01, 0x02, 0x00, 0x01, 0x62, 0x00,
-    0x04, 0x04, 0x3c, 0x04, 0x4c, 0x59, 0x40, 0x09, 0x11, 0x12, 0x11, 0x11, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x01,
-    0x33, 0x07, 0x23, 0x07, 0x23, 0x37, 0x21, 0x37, 0x01, 0x33, 0x01, 0x21, 0x13, 0x07, 0x03, 0x97, 0x93, 0x16, 0x92,
-    0x21, 0x9f, 0x20, 0xfe, 0x42, 0x0f, 0x02, 0x20, 0xac, 0xfd, 0xef, 0x01, 0x0a, 0x4b, 0x1d, 0x03, 0x6f, 0x7e, 0xb9,
-    0xb9, 0x67, 0x02, 0x6b, 0xfd, 0xac, 0x01, 0x8a, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x49, 0x02, 0x8b, 0x04,
-    0x0e, 0x05, 0xba, 0x00, 0x19, 0x00, 0x61, 0x4b, 0xb0, 0x24, 0x50, 0x58, 0xb5, 0x01, 0x01, 0x02, 0x00, 0x01, 0x4a,
-    0x1b, 0xb5, 0x01, 0x01, 0x02, 0x04, 0x01, 0x4a, 0x59, 0x4b, 0xb0, 0x24, 0x50, 0x58, 0x40, 0x1a, 0x00, 0x02, 0x02,
-    0x00, 0x5b, 0x05, 0x04, 0x02, 0x00, 0x00, 0x3c, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x00, 0x5b, 0x05, 0x04, 0x02, 0x00,
-    0x00, 0x3c, 0x01, 0x4c, 0x1b, 0x40, 0x17, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x3c, 0x4b, 0x03, 0x01,
-    0x01, 0x01, 0x04, 0x59, 0x05, 0x01, 0x04, 0x04, 0x3c, 0x01, 0x4c, 0x59, 0x40, 0x0d, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x19, 0x13, 0x25, 0x15, 0x25, 0x06, 0x08, 0x18, 0x2b, 0x01, 0x17, 0x3e, 0x03, 0x33, 0x1e, 0x03, 0x07, 0x03, 0x23,
-    0x13, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x06, 0x07, 0x03, 0x23, 0x13, 0x02, 0x4e, 0x01, 0x15, 0x30, 0x39, 0x41, 0x26,
-    0x42, 0x57, 0x32, 0x0f, 0x05, 0x54, 0xa6, 0x4e, 0x03, 0x01, 0x14, 0x2d, 0x28, 0x3a, 0x50, 0x1c, 0x61, 0xa6, 0x8b,
-    0x05, 0xac, 0x7c, 0x1d, 0x33, 0x25, 0x15, 0x01, 0x35, 0x56, 0x6e, 0x39, 0xfe, 0x04, 0x01, 0xdd, 0x1f, 0x44, 0x39,
-    0x25, 0x01, 0x01, 0x3f, 0x2e, 0xfd, 0xcd, 0x03, 0x20, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x04, 0x91, 0x05,
-    0xc6, 0x00, 0x33, 0x00, 0x4b, 0x40, 0x48, 0x00, 0x09, 0x0a, 0x07, 0x0a, 0x09, 0x07, 0x70, 0x0b, 0x01, 0x07, 0x0c,
-    0x01, 0x06, 0x05, 0x07, 0x06, 0x61, 0x0d, 0x01, 0x05, 0x04, 0x01, 0x00, 0x01, 0x05, 0x00, 0x61, 0x00, 0x0a, 0x0a,
-    0x08, 0x5b, 0x00, 0x08, 0x08, 0x44, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x02, 0x59, 0x00, 0x02, 0x02, 0x3d, 0x02, 0x4c,
-    0x33, 0x32, 0x31, 0x30, 0x2f, 0x2e, 0x29, 0x27, 0x23, 0x22, 0x25, 0x11, 0x11, 0x11, 0x16, 0x11, 0x11, 0x14, 0x10,
-    0x0e, 0x08, 0x1d, 0x2b, 0x01, 0x25, 0x07, 0x06, 0x06, 0x07, 0x25, 0x07, 0x21, 0x37, 0x17, 0x3e, 0x03, 0x37, 0x37,
-    0x07, 0x37, 0x33, 0x37, 0x23, 0x37, 0x33, 0x37, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x27, 0x36, 0x2e, 0x02, 0x27,
-    0x26, 0x0e, 0x02, 0x07, 0x07, 0x21, 0x07, 0x21, 0x07, 0x21, 0x02, 0xf4, 0xfe, 0xbb, 0x0b, 0x0c, 0x34, 0x2d, 0x02,
-    0xd0, 0x1b, 0xfc, 0x17, 0x1b, 0x41, 0x24, 0x32, 0x21, 0x14, 0x06, 0x0c, 0xae, 0x16, 0xa3, 0x14, 0x9f, 0x16, 0x9b,
-    0x16, 0x0c, 0x53, 0x82, 0xaa, 0x63, 0x57, 0x85, 0x5a, 0x2a, 0x05, 0xb4, 0x03, 0x14, 0x30, 0x4d, 0x36, 0x3d, 0x63,
-    0x48, 0x2e, 0x07, 0x17, 0x01, 0x57, 0x16, 0xfe, 0xae, 0x15, 0x01, 0x50, 0x01, 0xd7, 0x01, 0x48, 0x46, 0x7e, 0x37,
-    0x02, 0x97, 0x96, 0x01, 0x0e, 0x37, 0x46, 0x4c, 0x23, 0x49, 0x01, 0x7a, 0x8a, 0x7b, 0xb8, 0x61, 0xa2, 0x75, 0x40,
-    0x02, 0x02, 0x3b, 0x66, 0x8d, 0x54, 0x01, 0x32, 0x56, 0x3f, 0x24, 0x02, 0x01, 0x30, 0x51, 0x69, 0x37, 0xb8, 0x7b,
-    0x8a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x13, 0xff, 0xed, 0x04, 0xcf, 0x05, 0xb0, 0x00, 0x29, 0x00, 0x38, 0x00, 0xe1,
-    0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x0a, 0x0a, 0x01, 0x01, 0x04, 0x0b, 0x01, 0x02, 0x01, 0x02, 0x4a, 0x1b, 0x40,
-    0x0a, 0x0a, 0x01, 0x01, 0x04, 0x0b, 0x01, 0x05, 0x01, 0x02, 0x4a, 0x59, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x31,
-    0x00, 0x08, 0x06, 0x0b, 0x07, 0x08, 0x68, 0x00, 0x0a, 0x00, 0x04, 0x01, 0x0a, 0x04, 0x63, 0x00, 0x0b, 0x0b, 0x06,
-    0x5b, 0x00, 0x06, 0x06, 0x3c, 0x4b, 0x03, 0x01, 0x00, 0x00, 0x07, 0x59, 0x09, 0x01, 0x07, 0x07, 0x3f, 0x4b, 0x00,
-    0x01, 0x01, 0x02, 0x5b, 0x05, 0x01, 0x02, 0x02, 0x45, 0x02, 0x4c, 0x1b, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x32,
-    0x00, 0x08, 0x06, 0x0b, 0x06, 0x08, 0x0b, 0x70, 0x00, 0x0a, 0x00, 0x04, 0x01, 0x0a, 0x04, 0x63, 0x00, 0x0b, 0x0b,
-    0x06, 0x5b, 0x00, 0x06, 0x06, 0x3c, 0x4b, 0x03, 0x01, 0x00, 0x00, 0x07, 0x59, 0x09, 0x01, 0x07, 0x07, 0x3f, 0x4b,
-    0x00, 0x01, 0x01, 0x02, 0x5b, 0x05, 0x01, 0x02, 0x02, 0x45, 0x02, 0x4c, 0x1b, 0x40, 0x36, 0x00, 0x08, 0x06, 0x0b,
-    0x06, 0x08, 0x0b, 0x70, 0x00, 0x0a, 0x00, 0x04, 0x01, 0x0a, 0x04, 0x63, 0x00, 0x0b, 0x0b, 0x06, 0x5b, 0x00, 0x06,
-    0x06, 0x3c, 0x4b, 0x03, 0x01, 0x00, 0x00, 0x07, 0x59, 0x09, 0x01, 0x07, 0x07, 0x3f, 0x4b, 0x00, 0x05, 0x05, 0x3d,
-    0x4b, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x45, 0x02, 0x4c, 0x59, 0x59, 0x40, 0x12, 0x38, 0x37, 0x2c,
-    0x2a, 0x29, 0x28, 0x11, 0x14, 0x21, 0x11, 0x24, 0x15, 0x26, 0x15, 0x10, 0x0c, 0x08, 0x1d, 0x2b, 0x01, 0x23, 0x03,
-    0x06, 0x06, 0x16, 0x16, 0x17, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x2e, 0x03, 0x37, 0x13, 0x23, 0x0e, 0x03,
-    0x23, 0x27, 0x03, 0x23, 0x13, 0x17, 0x1e, 0x03, 0x07, 0x37, 0x13, 0x33, 0x03, 0x33, 0x01, 0x17, 0x3e, 0x03, 0x37,
-    0x36, 0x36, 0x2e, 0x03, 0x27, 0x27, 0x04, 0xb6, 0xab, 0x6b, 0x02, 0x03, 0x09, 0x1b, 0x1c, 0x12, 0x25, 0x12, 0x0d,
-    0x1e, 0x48, 0x23, 0x40, 0x4e, 0x29, 0x09, 0x05, 0x6a, 0x4d, 0x16, 0x43, 0x61, 0x84, 0x56, 0x47, 0x68, 0xb4, 0xfc,
-    0xeb, 0x4c, 0x6e, 0x45, 0x1d, 0x04, 0x5d, 0x2e, 0xb5, 0x2e, 0xab, 0xfc, 0x6f, 0x41, 0x39, 0x4f, 0x33, 0x1c, 0x05,
-    0x03, 0x04, 0x02, 0x0a, 0x19, 0x29, 0x1f, 0x47, 0x03, 0xab, 0xfd, 0x7a, 0x13, 0x34, 0x2f, 0x22, 0x01, 0x01, 0x08,
-    0x05, 0x86, 0x14, 0x11, 0x01, 0x01, 0x3b, 0x5c, 0x6e, 0x34, 0x02, 0x83, 0x4b, 0x88, 0x67, 0x3d, 0x01, 0xfd, 0xcb,
-    0x05, 0xb0, 0x02, 0x03, 0x41, 0x68, 0x84, 0x45, 0x01, 0x01, 0x06, 0xfe, 0xfa, 0xfe, 0x90, 0x01, 0x01, 0x3c, 0x59,
-    0x69, 0x2f, 0x16, 0x3a, 0x3e, 0x3c, 0x32, 0x20, 0x03, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x71, 0xff, 0xeb, 0x04,
-    0xa8, 0x05, 0xc6, 0x00, 0x2e, 0x00, 0x50, 0x40, 0x4d, 0x20, 0x01, 0x08, 0x07, 0x21, 0x01, 0x06, 0x08, 0x09, 0x01,
-    0x01, 0x00, 0x0a, 0x01, 0x02, 0x01, 0x04, 0x4a, 0x09, 0x01, 0x06, 0x0a, 0x01, 0x05, 0x04, 0x06, 0x05, 0x61, 0x0b,
-    0x01, 0x04, 0x03, 0x01, 0x00, 0x01, 0x04, 0x00, 0x61, 0x00, 0x08, 0x08, 0x07, 0x5b, 0x00, 0x07, 0x07, 0x44, 0x4b,
-    0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x45, 0x02, 0x4c, 0x2e, 0x2d, 0x2c, 0x2b, 0x2a, 0x29, 0x25, 0x24,
-    0x11, 0x11, 0x11, 0x14, 0x24, 0x24, 0x10, 0x0c, 0x08, 0x1d, 0x2b, 0x01, 0x21, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x36,
-    0x37, 0x17, 0x06, 0x27, 0x2e, 0x03, 0x37, 0x07, 0x37, 0x33, 0x37, 0x23, 0x37, 0x33, 0x3e, 0x03, 0x17, 0x16, 0x16,
-    0x17, 0x07, 0x26, 0x26, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x21, 0x07, 0x21, 0x07, 0x21, 0x03, 0x4a, 0xfe, 0x8d, 0x09,
-    0x0c, 0x3a, 0x6d, 0x57, 0x39, 0x6e, 0x37, 0x04, 0x74, 0x73, 0x79, 0xb0, 0x6d, 0x27, 0x0f, 0xb4, 0x15, 0xad, 0x19,
-    0xae, 0x16, 0xa6, 0x1b, 0x64, 0x96, 0xca, 0x81, 0x3d, 0x76, 0x3b, 0x22, 0x33, 0x69, 0x36, 0x5c, 0x8c, 0x66, 0x43,
-    0x13, 0x01, 0x7d, 0x16, 0xfe, 0x8b, 0x19, 0x01, 0x77, 0x02, 0x1f, 0x4a, 0x91, 0x74, 0x4a, 0x02, 0x01, 0x13, 0x0e,
-    0x9b, 0x1e, 0x01, 0x02, 0x5c, 0x9a, 0xcb, 0x71, 0x01, 0x7a, 0x8a, 0x7b, 0x76, 0xca, 0x95, 0x53, 0x01, 0x01, 0x12,
-    0x0d, 0x9b, 0x11, 0x13, 0x01, 0x01, 0x3f, 0x6e, 0x93, 0x52, 0x7b, 0x8a, 0x00, 0x04, 0x00, 0x9d, 0xff, 0xe8, 0x04,
-    0x48, 0x05, 0xc7, 0x00, 0x2b, 0x00, 0x41, 0x00, 0x57, 0x00, 0x5b, 0x00, 0x0d, 0x40, 0x0a, 0x5a, 0x58, 0x53, 0x48,
-    0x3b, 0x30, 0x0f, 0x04, 0x04, 0x30, 0x2b, 0x01, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x37, 0x3e, 0x03, 0x17, 0x1e,
-    0x03, 0x07, 0x23, 0x36, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x32, 0x3e, 0x02,
-    0x37, 0x13, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x17, 0x06, 0x1e, 0x02,
-    0x17, 0x16, 0x3e, 0x02, 0x37, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x05, 0x27, 0x01, 0x17, 0x02,
-    0x86, 0x05, 0x2a, 0x44, 0x5d, 0x39, 0x3d, 0x57, 0x36, 0x16, 0x03, 0x07, 0x06, 0x2a, 0x47, 0x64, 0x40, 0x37, 0x57,
-    0x3a, 0x1d, 0x01, 0x87, 0x01, 0x07, 0x15, 0x27, 0x1e, 0x23, 0x32, 0x23, 0x13, 0x04, 0x08, 0x02, 0x02, 0x11, 0x25,
-    0x21, 0x1c, 0x2c, 0x20, 0x15, 0x05, 0x4b, 0x06, 0x2a, 0x48, 0x64, 0x3f, 0x3d, 0x57, 0x36, 0x17, 0x04, 0x07, 0x06,
-    0x29, 0x47, 0x64, 0x3f, 0x3d, 0x58, 0x36, 0x17, 0x04, 0x89, 0x02, 0x03, 0x12, 0x26, 0x22, 0x22, 0x32, 0x21, 0x13,
-    0x03, 0x07, 0x02, 0x03, 0x12, 0x26, 0x21, 0x23, 0x32, 0x21, 0x13, 0x03, 0xfe, 0x96, 0x6b, 0x02, 0x92, 0x6b, 0x04,
-    0x1e, 0x36, 0x5e, 0x45, 0x27, 0x02, 0x01, 0x36, 0x54, 0x6a, 0x36, 0x4d, 0x39, 0x6e, 0x55, 0x33, 0x01, 0x01, 0x2a,
-    0x46, 0x5e, 0x34, 0x19, 0x32, 0x28, 0x19, 0x23, 0x36, 0x41, 0x1c, 0x4f, 0x18, 0x3d, 0x37, 0x26, 0x01, 0x17, 0x26,
-    0x31, 0x18, 0xfd, 0x47, 0x39, 0x6e, 0x56, 0x32, 0x01, 0x02, 0x35, 0x56, 0x6a, 0x36, 0x4e, 0x39, 0x6d, 0x56, 0x33,
-    0x02, 0x01, 0x36, 0x56, 0x6a, 0x36, 0x02, 0x18, 0x3e, 0x37, 0x26, 0x01, 0x01, 0x24, 0x36, 0x40, 0x1c, 0x50, 0x18,
-    0x3e, 0x38, 0x26, 0x01, 0x01, 0x24, 0x36, 0x40, 0x1c, 0x8f, 0x47, 0x03, 0xb1, 0x47, 0x00, 0x00, 0x02, 0x00, 0xbc,
-    0xff, 0xeb, 0x04, 0x36, 0x05, 0xcc, 0x00, 0x24, 0x00, 0x35, 0x00, 0x08, 0xb5, 0x31, 0x25, 0x12, 0x00, 0x02, 0x30,
-    0x2b, 0x05, 0x2e, 0x03, 0x37, 0x37, 0x06, 0x06, 0x07, 0x37, 0x36, 0x36, 0x37, 0x13, 0x3e, 0x03, 0x17, 0x1e, 0x03,
-    0x07, 0x07, 0x0e, 0x03, 0x07, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x03, 0x3e, 0x03, 0x37, 0x37, 0x36, 0x36, 0x26, 0x26,
-    0x27, 0x26, 0x0e, 0x02, 0x07, 0x02, 0xdd, 0x5f, 0x8e, 0x57, 0x1e, 0x0f, 0x03, 0x34, 0x67, 0x36, 0x14, 0x36, 0x67,
-    0x34, 0x53, 0x0a, 0x31, 0x55, 0x7a, 0x53, 0x40, 0x5a, 0x36, 0x15, 0x04, 0x05, 0x0b, 0x58, 0x84, 0xa3, 0x57, 0x0f,
-    0x09, 0x03, 0x23, 0x4c, 0x41, 0x84, 0x35, 0x5d, 0x4a, 0x31, 0x08, 0x05, 0x02, 0x02, 0x09, 0x1b, 0x1b, 0x2b, 0x38,
-    0x22, 0x11, 0x04, 0x15, 0x04, 0x49, 0x79, 0xa0, 0x5c, 0x11, 0x0d, 0x0c, 0x01, 0xb0, 0x01, 0x0d, 0x0c, 0x01, 0xe0,
-    0x48, 0x8a, 0x6c, 0x40, 0x03, 0x02, 0x37, 0x58, 0x6f, 0x39, 0x2a, 0x65, 0xb7, 0x9c, 0x7e, 0x2b, 0x58, 0x39, 0x66,
-    0x4f, 0x32, 0x04, 0x02, 0x3c, 0x25, 0x59, 0x69, 0x77, 0x42, 0x2a, 0x13, 0x35, 0x31, 0x23, 0x02, 0x03, 0x2d, 0x45,
-    0x50, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x04, 0xc7, 0x05, 0xc0, 0x00, 0x09, 0x00, 0x1f,
-    0x00, 0x35, 0x00, 0x39, 0x00, 0x0d, 0x40, 0x0a, 0x38, 0x36, 0x2f, 0x24, 0x19, 0x0e, 0x05, 0x00, 0x04, 0x30, 0x2b,
-    0x21, 0x23, 0x03, 0x03, 0x23, 0x13, 0x33, 0x13, 0x13, 0x33, 0x17, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x07, 0x07,
-    0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x37, 0x06, 0x06, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x37, 0x36,
-    0x36, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x13, 0x21, 0x37, 0x21, 0x02, 0x66, 0xab, 0x64, 0x9e, 0xad, 0xfd,
-    0xaa, 0x65, 0x9e, 0xad, 0x28, 0x04, 0x19, 0x2a, 0x3e, 0x29, 0x28, 0x38, 0x21, 0x0d, 0x03, 0x18, 0x04, 0x19, 0x2a,
-    0x3e, 0x29, 0x28, 0x37, 0x21, 0x0d, 0x02, 0x67, 0x01, 0x02, 0x05, 0x13, 0x14, 0x15, 0x19, 0x0f, 0x07, 0x02, 0x16,
-    0x01, 0x02, 0x06, 0x13, 0x14, 0x14, 0x1a, 0x0f, 0x07, 0x02, 0x77, 0xfe, 0xd4, 0x11, 0x01, 0x2c, 0x03, 0x90, 0xfc,
-    0x70, 0x05, 0xb0, 0xfc, 0x73, 0x03, 0x8d, 0xb5, 0x24, 0x46, 0x39, 0x22, 0x23, 0x39, 0x46, 0x23, 0xce, 0x24, 0x46,
-    0x38, 0x21, 0x24, 0x37, 0x45, 0x23, 0x08, 0x0d, 0x25, 0x22, 0x19, 0x17, 0x21, 0x26, 0x0f, 0xbe, 0x0d, 0x25, 0x22,
-    0x18, 0x16, 0x21, 0x26, 0x0f, 0xfd, 0xd4, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xe9, 0x03, 0x97, 0x04, 0xad,
-    0x05, 0xb0, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x08, 0xb5, 0x13, 0x0f, 0x06, 0x02, 0x02, 0x30, 0x2b, 0x01, 0x03, 0x07,
-    0x03, 0x03, 0x23, 0x13, 0x33, 0x13, 0x13, 0x33, 0x03, 0x23, 0x01, 0x23, 0x03, 0x23, 0x13, 0x23, 0x37, 0x21, 0x04,
-    0x38, 0xc5, 0x34, 0x43, 0x45, 0x5a, 0x5e, 0x6c, 0x45, 0xd0, 0x71, 0x5e, 0x5a, 0xfe, 0x6d, 0x8f, 0x50, 0x5b, 0x50,
-    0x8f, 0x0e, 0x01, 0x79, 0x05, 0x13, 0xfe, 0x85, 0x01, 0x01, 0x88, 0xfe, 0x78, 0x02, 0x19, 0xfe, 0x75, 0x01, 0x8b,
-    0xfd, 0xe7, 0x01, 0xc8, 0xfe, 0x38, 0x01, 0xc8, 0x51, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x83, 0xff, 0xeb, 0x04,
-    0x6f, 0x04, 0x50, 0x00, 0x23, 0x00, 0x2e, 0x00, 0x08, 0xb5, 0x2a, 0x25, 0x10, 0x02, 0x02, 0x30, 0x2b, 0x25, 0x06,
-    0x06, 0x27, 0x2e, 0x05, 0x37, 0x3e, 0x05, 0x17, 0x1e, 0x05, 0x07, 0x07, 0x21, 0x03, 0x16, 0x16, 0x17, 0x16, 0x3e,
-    0x02, 0x37, 0x03, 0x26, 0x0e, 0x02, 0x07, 0x03, 0x21, 0x13, 0x26, 0x26, 0x03, 0xaa, 0x54, 0xbe, 0x64, 0x49, 0x7b,
-    0x64, 0x4a, 0x2e, 0x11, 0x07, 0x08, 0x33, 0x51, 0x6b, 0x7e, 0x8e, 0x4c, 0x48, 0x77, 0x5d, 0x43, 0x29, 0x0e, 0x05,
-    0x05, 0xfd, 0x15, 0x3b, 0x30, 0x79, 0x45, 0x34, 0x64, 0x60, 0x5c, 0x2c, 0xce, 0x29, 0x4e, 0x48, 0x44, 0x1f, 0x33,
-    0x02, 0x0b, 0x33, 0x2d, 0x77, 0x5d, 0x35, 0x3d, 0x02, 0x02, 0x2d, 0x4e, 0x69, 0x79, 0x85, 0x44, 0x47, 0x8d, 0x80,
-    0x6d, 0x4f, 0x2b, 0x02, 0x02, 0x2d, 0x4c, 0x67, 0x77, 0x81, 0x41, 0x31, 0xfe, 0xb6, 0x33, 0x36, 0x02, 0x02, 0x12,
-    0x21, 0x2d, 0x1a, 0x03, 0x2b, 0x01, 0x13, 0x21, 0x2d, 0x19, 0xfe, 0xea, 0x01, 0x20, 0x33, 0x3b, 0xff, 0xff, 0x00,
-    0xc5, 0xff, 0xf4, 0x04, 0x80, 0x05, 0xaf, 0x00, 0x2f, 0x01, 0xc1, 0xff, 0xa0, 0x02, 0xe8, 0x39, 0x9a, 0x00, 0x26,
-    0x01, 0x76, 0xf8, 0x00, 0x01, 0x0f, 0x01, 0xc8, 0x01, 0x7a, 0x00, 0x00, 0x39, 0x9a, 0x00, 0x09, 0xb1, 0x00, 0x01,
-    0xb8, 0x02, 0xe8, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x77, 0xff, 0xf4, 0x04, 0x88, 0x05, 0xbc, 0x00, 0x2f,
-    0x01, 0xc3, 0xff, 0xa2, 0x02, 0xea, 0x39, 0x9a, 0x00, 0x26, 0x01, 0x76, 0x1c, 0xf7, 0x01, 0x0f, 0x01, 0xc8, 0x01,
-    0x82, 0x00, 0x00, 0x39, 0x9a, 0x00, 0x12, 0xb1, 0x00, 0x01, 0xb8, 0x02, 0xea, 0xb0, 0x33, 0x2b, 0xb1, 0x01, 0x01,
-    0xb8, 0xff, 0xf7, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x68, 0xff, 0xf8, 0x04, 0x75, 0x05, 0xb2, 0x00, 0x2f, 0x01,
-    0xc5, 0xff, 0x8d, 0x02, 0xeb, 0x39, 0x9a, 0x00, 0x26, 0x01, 0x76, 0x08, 0x00, 0x01, 0x0f, 0x01, 0xc8, 0x01, 0x6f,
-    0x00, 0x04, 0x39, 0x9a, 0x00, 0x11, 0xb1, 0x00, 0x01, 0xb8, 0x02, 0xeb, 0xb0, 0x33, 0x2b, 0xb1, 0x02, 0x03, 0xb0,
-    0x04, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xf4, 0x04, 0x6f, 0x05, 0xb2, 0x00, 0x2f, 0x01, 0xc7,
-    0xff, 0xb6, 0x02, 0xeb, 0x39, 0x9a, 0x00, 0x26, 0x01, 0x76, 0xd4, 0x00, 0x01, 0x0f, 0x01, 0xc8, 0x01, 0x69, 0x00,
-    0x00, 0x39, 0x9a, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x02, 0xeb, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x02, 0x00, 0x61,
-    0xff, 0xe9, 0x04, 0x48, 0x05, 0xed, 0x00, 0x2a, 0x00, 0x42, 0x00, 0x08, 0xb5, 0x37, 0x2c, 0x1f, 0x10, 0x02, 0x30,
-    0x2b, 0x01, 0x16, 0x16, 0x17, 0x36, 0x2e, 0x04, 0x27, 0x26, 0x06, 0x07, 0x27, 0x36, 0x36, 0x17, 0x1e, 0x04, 0x06,
-    0x07, 0x07, 0x0e, 0x05, 0x27, 0x2e, 0x03, 0x37, 0x37, 0x3e, 0x03, 0x17, 0x26, 0x0e, 0x02, 0x07, 0x07, 0x06, 0x1e,
-    0x02, 0x17, 0x16, 0x3e, 0x04, 0x37, 0x37, 0x36, 0x2e, 0x02, 0x02, 0x78, 0x57, 0x96, 0x35, 0x04, 0x04, 0x15, 0x28,
-    0x3f, 0x59, 0x3a, 0x4b, 0x8f, 0x46, 0x02, 0x4b, 0x9b, 0x52, 0x6c, 0x96, 0x61, 0x32, 0x12, 0x08, 0x0b, 0x09, 0x0b,
-    0x2c, 0x44, 0x5d, 0x77, 0x93, 0x57, 0x6e, 0x9e, 0x61, 0x25, 0x0a, 0x02, 0x0d, 0x55, 0x87, 0xb5, 0x76, 0x4b, 0x79,
-    0x59, 0x38, 0x0a, 0x03, 0x07, 0x0a, 0x30, 0x5e, 0x4c, 0x3d, 0x63, 0x4e, 0x3a, 0x2a, 0x1b, 0x08, 0x09, 0x01, 0x2e,
-    0x49, 0x59, 0x03, 0xfe, 0x02, 0x4b, 0x45, 0x2e, 0x6a, 0x68, 0x61, 0x4b, 0x2f, 0x02, 0x02, 0x23, 0x18, 0x98, 0x24,
-    0x21, 0x02, 0x02, 0x4f, 0x82, 0xa9, 0xb6, 0xb8, 0x50, 0x3b, 0x4a, 0x9c, 0x92, 0x81, 0x5f, 0x35, 0x02, 0x03, 0x59,
-    0x92, 0xbb, 0x64, 0x18, 0x67, 0xb7, 0x87, 0x4c, 0x9a, 0x02, 0x37, 0x60, 0x7d, 0x45, 0x17, 0x3e, 0x83, 0x6d, 0x47,
-    0x03, 0x02, 0x28, 0x47, 0x5e, 0x69, 0x6d, 0x32, 0x41, 0x31, 0x4d, 0x35, 0x1d, 0x00, 0x00, 0x01, 0x00, 0x22, 0xff,
-    0x2b, 0x04, 0x8c, 0x05, 0xb0, 0x00, 0x07, 0x00, 0x06, 0xb3, 0x06, 0x00, 0x01, 0x30, 0x2b, 0x05, 0x23, 0x13, 0x21,
-    0x03, 0x23, 0x01, 0x21, 0x03, 0x87, 0xb5, 0xed, 0xfe, 0x05, 0xed, 0xb5, 0x01, 0x05, 0x03, 0x65, 0xd5, 0x05, 0xed,
-    0xfa, 0x13, 0x06, 0x85, 0x00, 0x00, 0x01, 0xff, 0x9a, 0xfe, 0xf3, 0x04, 0xc1, 0x05, 0xb0, 0x00, 0x0c, 0x00, 0x06,
-    0xb3, 0x08, 0x03, 0x01, 0x30, 0x2b, 0x01, 0x01, 0x21, 0x07, 0x21, 0x37, 0x01, 0x01, 0x37, 0x21, 0x07, 0x21, 0x01,
-    0x03, 0x3d, 0xfd, 0x5a, 0x03, 0x63, 0x1b, 0xfb, 0xbb, 0x1a, 0x02, 0xcb, 0xfe, 0x2e, 0x19, 0x03, 0xfb, 0x1b, 0xfc,
-    0xd8, 0x01, 0xc1, 0x02, 0x42, 0xfd, 0x49, 0x98, 0x97, 0x02, 0xcd, 0x02, 0xd2, 0x87, 0x98, 0xfd, 0x44, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0xac, 0x02, 0x8b, 0x03, 0xf2, 0x03, 0x22, 0x00, 0x03, 0x00, 0x18, 0x40, 0x15, 0x00, 0x01,
-    0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x01, 0x00, 0x4d, 0x11, 0x10, 0x02, 0x08, 0x16,
-    0x2b, 0x01, 0x21, 0x37, 0x21, 0x03, 0xd7, 0xfc, 0xd5, 0x1b, 0x03, 0x2b, 0x02, 0x8b, 0x97, 0x00, 0x01, 0x00, 0x3b,
-    0x00, 0x00, 0x05, 0x08, 0x05, 0xb0, 0x00, 0x0a, 0x00, 0x06, 0xb3, 0x05, 0x03, 0x01, 0x30, 0x2b, 0x01, 0x17, 0x37,
-    0x01, 0x33, 0x01, 0x23, 0x03, 0x23, 0x37, 0x21, 0x01, 0xd9, 0x02, 0x2e, 0x02, 0x3f, 0xc0, 0xfc, 0xf6, 0x8a, 0x81,
-    0xb8, 0x1c, 0x01, 0x2e, 0x01, 0x47, 0x5b, 0x6e, 0x04, 0x56, 0xfa, 0x50, 0x02, 0x74, 0x9a, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x00, 0x30, 0x00, 0xde, 0x04, 0x7e, 0x03, 0xe0, 0x00, 0x29, 0x00, 0x3f, 0x00, 0x55, 0x00, 0x0a, 0xb7, 0x51,
-    0x44, 0x3b, 0x2e, 0x19, 0x04, 0x03, 0x30, 0x2b, 0x01, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x27, 0x0e, 0x03, 0x27, 0x2e,
-    0x03, 0x37, 0x37, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x17, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x23, 0x36, 0x2e, 0x02,
-    0x23, 0x22, 0x0e, 0x02, 0x07, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x05, 0x06, 0x1e, 0x02, 0x33,
-    0x32, 0x3e, 0x02, 0x37, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x04, 0x76, 0x06, 0x2d, 0x4e, 0x72,
-    0x4b, 0x32, 0x4e, 0x3b, 0x29, 0x0c, 0x19, 0x3b, 0x49, 0x59, 0x36, 0x48, 0x5d, 0x35, 0x12, 0x04, 0x04, 0x06, 0x2c,
-    0x4e, 0x71, 0x4b, 0x31, 0x4f, 0x3b, 0x29, 0x0b, 0x19, 0x3c, 0x4a, 0x59, 0x37, 0x46, 0x5d, 0x36, 0x13, 0x04, 0x7a,
-    0x03, 0x02, 0x15, 0x32, 0x2d, 0x2b, 0x50, 0x41, 0x2f, 0x0a, 0x04, 0x01, 0x18, 0x2d, 0x3f, 0x26, 0x33, 0x45, 0x2c,
-    0x17, 0x04, 0xfc, 0xb1, 0x03, 0x01, 0x16, 0x32, 0x2e, 0x2a, 0x50, 0x41, 0x2f, 0x09, 0x04, 0x01, 0x18, 0x2d, 0x3f,
-    0x26, 0x32, 0x45, 0x2c, 0x17, 0x04, 0x02, 0x51, 0x41, 0x85, 0x6b, 0x42, 0x02, 0x01, 0x2c, 0x45, 0x55, 0x2b, 0x29,
-    0x57, 0x47, 0x2d, 0x01, 0x01, 0x44, 0x69, 0x7f, 0x3b, 0x2b, 0x40, 0x84, 0x69, 0x41, 0x03, 0x02, 0x2b, 0x45, 0x55,
-    0x2b, 0x29, 0x57, 0x48, 0x2d, 0x01, 0x01, 0x44, 0x67, 0x7d, 0x3a, 0x21, 0x52, 0x48, 0x32, 0x34, 0x4d, 0x59, 0x25,
-    0x1c, 0x22, 0x54, 0x4b, 0x35, 0x01, 0x02, 0x2f, 0x4b, 0x59, 0x29, 0x0f, 0x21, 0x53, 0x48, 0x32, 0x34, 0x4d, 0x59,
-    0x25, 0x1c, 0x22, 0x54, 0x4b, 0x34, 0x02, 0x02, 0x2f, 0x4b, 0x59, 0x28, 0x00, 0x01, 0x00, 0x54, 0xfe, 0x48, 0x04,
-    0x45, 0x06, 0x2f, 0x00, 0x24, 0x00, 0x06, 0xb3, 0x16, 0x04, 0x01, 0x30, 0x2b, 0x05, 0x0e, 0x03, 0x27, 0x22, 0x26,
-    0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x13, 0x3e, 0x03, 0x17, 0x16, 0x16, 0x17, 0x07, 0x26, 0x26,
-    0x23, 0x22, 0x0e, 0x02, 0x07, 0x03, 0x02, 0x2f, 0x09, 0x36, 0x59, 0x7d, 0x51, 0x1f, 0x39, 0x1d, 0x1c, 0x17, 0x31,
-    0x18, 0x29, 0x3c, 0x28, 0x17, 0x05, 0xc6, 0x09, 0x39, 0x5d, 0x83, 0x53, 0x25, 0x49, 0x23, 0x21, 0x16, 0x2c, 0x17,
-    0x30, 0x4a, 0x35, 0x21, 0x06, 0xc6, 0x59, 0x4b, 0x81, 0x5f, 0x34, 0x01, 0x0b, 0x09, 0x92, 0x06, 0x0a, 0x24, 0x3a,
-    0x47, 0x23, 0x05, 0x1b, 0x4e, 0x86, 0x62, 0x37, 0x01, 0x01, 0x0d, 0x08, 0x8f, 0x06, 0x07, 0x21, 0x39, 0x4e, 0x2c,
-    0xfa, 0xe5, 0x00, 0x00, 0x02, 0x00, 0x5e, 0x01, 0x16, 0x04, 0x59, 0x03, 0xfe, 0x00, 0x23, 0x00, 0x49, 0x00, 0x08,
-    0xb5, 0x3b, 0x28, 0x15, 0x06, 0x02, 0x30, 0x2b, 0x13, 0x3e, 0x03, 0x33, 0x36, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32,
-    0x3e, 0x02, 0x37, 0x07, 0x0e, 0x03, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x03, 0x3e,
-    0x03, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x07, 0x0e, 0x03, 0x23, 0x22, 0x26,
-    0x27, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x07, 0xb8, 0x17, 0x36, 0x3e, 0x47, 0x27, 0x40, 0x67, 0x36, 0x30, 0x5f,
-    0x3a, 0x28, 0x47, 0x40, 0x39, 0x1a, 0x09, 0x17, 0x35, 0x3d, 0x46, 0x27, 0x3b, 0x60, 0x32, 0x1b, 0x32, 0x34, 0x38,
-    0x1f, 0x28, 0x48, 0x40, 0x39, 0x1a, 0x4e, 0x17, 0x37, 0x3e, 0x47, 0x27, 0x1f, 0x39, 0x36, 0x33, 0x1b, 0x31, 0x5e,
-    0x3a, 0x28, 0x48, 0x40, 0x39, 0x1a, 0x09, 0x17, 0x36, 0x3d, 0x45, 0x27, 0x3b, 0x62, 0x31, 0x1a, 0x33, 0x34, 0x38,
-    0x1f, 0x28, 0x47, 0x40, 0x3a, 0x1a, 0x03, 0x69, 0x1e, 0x35, 0x29, 0x18, 0x01, 0x2d, 0x1f, 0x1c, 0x2a, 0x18, 0x29,
-    0x34, 0x1c, 0xab, 0x1d, 0x35, 0x29, 0x17, 0x2a, 0x1d, 0x0f, 0x1b, 0x15, 0x0c, 0x19, 0x29, 0x34, 0x1c, 0xfe, 0xff,
-    0x1e, 0x35, 0x28, 0x19, 0x0c, 0x15, 0x1b, 0x0f, 0x1c, 0x2b, 0x18, 0x29, 0x35, 0x1c, 0xab, 0x1d, 0x35, 0x29, 0x17,
-    0x2a, 0x1d, 0x0f, 0x1c, 0x14, 0x0b, 0x19, 0x28, 0x34, 0x1c, 0x00, 0x01, 0x00, 0x7a, 0x00, 0xb6, 0x04, 0x42, 0x04,
-    0x3f, 0x00, 0x13, 0x00, 0x06, 0xb3, 0x0c, 0x02, 0x01, 0x30, 0x2b, 0x01, 0x21, 0x07, 0x27, 0x37, 0x21, 0x37, 0x21,
-    0x37, 0x21, 0x37, 0x21, 0x37, 0x17, 0x07, 0x33, 0x07, 0x21, 0x07, 0x21, 0x03, 0xde, 0xfe, 0x11, 0x76, 0x4e, 0x53,
-    0xfe, 0xfc, 0x1d, 0x01, 0x51, 0xaa, 0xfe, 0x30, 0x1d, 0x02, 0x1e, 0x61, 0x46, 0x3f, 0xdd, 0x1c, 0xfe, 0xd7, 0xa6,
-    0x01, 0xa3, 0x01, 0x6d, 0xb7, 0x3a, 0x7d, 0xa0, 0xff, 0xa1, 0x92, 0x32, 0x60, 0xa1, 0xff, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x4f, 0x00, 0x09, 0x04, 0x67, 0x04, 0x9e, 0x00, 0x67, 0x00, 0x1e, 0x00, 0x33, 0x00, 0xbc, 0x40, 0x00,
-    0x39, 0x9a, 0x01, 0x07, 0x01, 0x88, 0xff, 0xa3, 0xfd, 0x7e, 0x00, 0x11, 0xb1, 0x00, 0x01, 0xb0, 0xbc, 0xb0, 0x33,
-    0x2b, 0xb1, 0x01, 0x01, 0xb8, 0xfd, 0x7e, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x57, 0x00, 0x07,
-    0x04, 0x4e, 0x04, 0xaa, 0x00, 0x67, 0x00, 0x20, 0x00, 0x33, 0x00, 0xcf, 0x40, 0x00, 0x39, 0x9a, 0x01, 0x07, 0x01,
-    0x88, 0xff, 0xab, 0xfd, 0x7c, 0x00, 0x11, 0xb1, 0x00, 0x01, 0xb0, 0xcf, 0xb0, 0x33, 0x2b, 0xb1, 0x01, 0x01, 0xb8,
-    0xfd, 0x7c, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xa1, 0x00, 0x00, 0x04, 0x34, 0x05, 0xb0, 0x00,
-    0x05, 0x00, 0x0d, 0x00, 0x08, 0xb5, 0x0c, 0x08, 0x03, 0x00, 0x02, 0x30, 0x2b, 0x01, 0x33, 0x01, 0x01, 0x23, 0x01,
-    0x21, 0x03, 0x27, 0x07, 0x01, 0x13, 0x17, 0x37, 0x02, 0x9c, 0x8a, 0x01, 0x0e, 0xfe, 0x04, 0x8a, 0xfe, 0xf3, 0x02,
-    0xdc, 0xa6, 0x06, 0x1b, 0xfe, 0xa1, 0xa6, 0x05, 0x1c, 0x05, 0xb0, 0xfd, 0x1d, 0xfd, 0x33, 0x02, 0xe1, 0x02, 0x01,
-    0x33, 0x35, 0xfd, 0xed, 0xfe, 0x00, 0x33, 0x35, 0x00, 0x01, 0x00, 0xad, 0xff, 0x56, 0x01, 0xd6, 0x00, 0xef, 0x00,
-    0x09, 0x00, 0x06, 0xb3, 0x08, 0x03, 0x01, 0x30, 0x2b, 0x25, 0x06, 0x06, 0x07, 0x27, 0x36, 0x36, 0x37, 0x37, 0x33,
-    0x01, 0xce, 0x0d, 0x62, 0x4e, 0x64, 0x2a, 0x3c, 0x0c, 0x0a, 0xad, 0xaa, 0x65, 0xaf, 0x40, 0x4a, 0x3d, 0x80, 0x49,
-    0x49, 0x00, 0x00, 0x00, 0x16, 0xff, 0xf0, 0x00, 0x08, 0x04, 0xae, 0x04, 0x07, 0x00, 0x0d, 0x00, 0x20, 0x00, 0x2e,
-    0x00, 0x3e, 0x00, 0x44, 0x00, 0x4a, 0x00, 0x50, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x63, 0x00, 0x67, 0x00, 0x6b, 0x00,
-    0x6f, 0x00, 0x73, 0x00, 0x77, 0x00, 0x84, 0x00, 0x88, 0x00, 0x8c, 0x00, 0x90, 0x00, 0x94, 0x00, 0x98, 0x00, 0x9c,
-    0x00, 0x31, 0x40, 0x2e, 0x9c, 0x9a, 0x98, 0x96, 0x93, 0x91, 0x90, 0x8e, 0x8c, 0x8a, 0x87, 0x85, 0x84, 0x78, 0x75,
-    0x74, 0x71, 0x70, 0x6d, 0x6c, 0x69, 0x68, 0x65, 0x64, 0x61, 0x60, 0x5f, 0x5e, 0x54, 0x52, 0x4d, 0x4b, 0x48, 0x45,
-    0x44, 0x40, 0x3d, 0x38, 0x2a, 0x23, 0x1e, 0x0e, 0x09, 0x02, 0x16, 0x30, 0x2b, 0x01, 0x26, 0x26, 0x23, 0x06, 0x06,
-    0x07, 0x07, 0x16, 0x16, 0x37, 0x36, 0x36, 0x37, 0x17, 0x3e, 0x03, 0x35, 0x26, 0x26, 0x27, 0x36, 0x36, 0x37, 0x36,
-    0x2e, 0x02, 0x27, 0x23, 0x03, 0x27, 0x06, 0x06, 0x23, 0x26, 0x26, 0x37, 0x37, 0x36, 0x36, 0x33, 0x16, 0x16, 0x07,
-    0x05, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x27, 0x16, 0x16, 0x37, 0x36, 0x36, 0x37, 0x37, 0x23, 0x01, 0x37, 0x33,
-    0x07, 0x37, 0x07, 0x25, 0x37, 0x17, 0x37, 0x33, 0x07, 0x01, 0x37, 0x37, 0x07, 0x27, 0x07, 0x25, 0x37, 0x17, 0x07,
-    0x23, 0x37, 0x01, 0x16, 0x16, 0x07, 0x06, 0x06, 0x07, 0x07, 0x37, 0x13, 0x37, 0x33, 0x07, 0x33, 0x37, 0x33, 0x07,
-    0x21, 0x37, 0x33, 0x07, 0x03, 0x37, 0x33, 0x07, 0x33, 0x37, 0x33, 0x07, 0x21, 0x37, 0x33, 0x07, 0x13, 0x17, 0x1e,
-    0x03, 0x07, 0x0e, 0x03, 0x07, 0x07, 0x05, 0x23, 0x37, 0x33, 0x03, 0x07, 0x37, 0x37, 0x13, 0x07, 0x37, 0x37, 0x01,
-    0x23, 0x37, 0x33, 0x03, 0x07, 0x37, 0x37, 0x13, 0x07, 0x37, 0x37, 0x01, 0xd6, 0x01, 0x41, 0x38, 0x36, 0x45, 0x05,
-    0x03, 0x01, 0x44, 0x37, 0x36, 0x44, 0x05, 0x89, 0x14, 0x28, 0x20, 0x14, 0x01, 0x17, 0x14, 0x14, 0x1f, 0x02, 0x01,
-    0x13, 0x1f, 0x27, 0x13, 0x58, 0x38, 0x3f, 0x07, 0x2a, 0x25, 0x24, 0x19, 0x02, 0x08, 0x08, 0x2a, 0x25, 0x23, 0x19,
-    0x02, 0x01, 0xf2, 0x07, 0x20, 0x19, 0x1c, 0x0e, 0x02, 0x2f, 0x02, 0x35, 0x32, 0x2d, 0x37, 0x07, 0x1a, 0x31, 0xfc,
-    0x38, 0x25, 0x3c, 0x19, 0x6e, 0x11, 0x02, 0xc2, 0x11, 0x65, 0x19, 0x39, 0x20, 0xfc, 0x87, 0x1e, 0xa8, 0x12, 0x65,
-    0x14, 0x03, 0x3c, 0x11, 0xa0, 0x1f, 0x3b, 0x11, 0xfe, 0x0e, 0x11, 0x19, 0x03, 0x05, 0x2a, 0x17, 0x40, 0x17, 0x27,
-    0x10, 0x94, 0x10, 0x42, 0x10, 0x93, 0x10, 0xfd, 0xc3, 0x10, 0x92, 0x10, 0x63, 0x0f, 0x94, 0x10, 0x42, 0x10, 0x93,
-    0x0f, 0xfd, 0xc2, 0x10, 0x92, 0x0f, 0xd6, 0x36, 0x09, 0x14, 0x0f, 0x08, 0x02, 0x02, 0x10, 0x15, 0x19, 0x0c, 0x2e,
-    0xfe, 0x4b, 0x3b, 0x1d, 0x3c, 0x42, 0x3b, 0x1d, 0x3c, 0x2a, 0x3b, 0x1d, 0x3b, 0x03, 0x8e, 0x3b, 0x1e, 0x3a, 0x41,
-    0x3a, 0x1d, 0x3a, 0x2b, 0x3b, 0x1e, 0x3a, 0x02, 0x23, 0x36, 0x45, 0x01, 0x42, 0x34, 0x3e, 0x36, 0x46, 0x01, 0x01,
-    0x42, 0x35, 0x76, 0x01, 0x0b, 0x15, 0x21, 0x18, 0x17, 0x1e, 0x0a, 0x0e, 0x1d, 0x1c, 0x17, 0x1e, 0x12, 0x07, 0x01,
-    0xfe, 0xd1, 0x77, 0x21, 0x31, 0x01, 0x30, 0x20, 0x3f, 0x21, 0x31, 0x01, 0x30, 0x1f, 0x57, 0x17, 0x20, 0x1d, 0x17,
-    0x02, 0x30, 0x31, 0x02, 0x02, 0x32, 0x2b, 0xd1, 0xfd, 0x69, 0xb0, 0x70, 0x01, 0x42, 0x01, 0x41, 0x01, 0x70, 0xaf,
-    0x03, 0x5e, 0x9e, 0x01, 0x42, 0x01, 0x5e, 0x5d, 0x42, 0x01, 0x9e, 0x5e, 0xfe, 0x31, 0x03, 0x13, 0x15, 0x1a, 0x15,
-    0x04, 0x01, 0x60, 0x01, 0xcd, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0xfc, 0x44, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-    0x02, 0x68, 0x01, 0x01, 0x02, 0x07, 0x0e, 0x0c, 0x0e, 0x11, 0x0b, 0x05, 0x01, 0x01, 0x51, 0x8c, 0xfe, 0xa5, 0x01,
-    0x8c, 0x01, 0x01, 0x13, 0x01, 0x8c, 0x01, 0xfe, 0xa4, 0x8c, 0xfe, 0xa5, 0x01, 0x8c, 0x01, 0x01, 0x13, 0x01, 0x8c,
-    0x01, 0x00, 0x05, 0x00, 0x0f, 0xfd, 0xd5, 0x04, 0xaf, 0x08, 0x73, 0x00, 0x03, 0x00, 0x29, 0x00, 0x2d, 0x00, 0x31,
-    0x00, 0x35, 0x00, 0x0f, 0x40, 0x0c, 0x34, 0x32, 0x30, 0x2e, 0x2c, 0x2a, 0x12, 0x04, 0x02, 0x00, 0x05, 0x30, 0x2b,
-    0x09, 0x03, 0x05, 0x34, 0x3e, 0x02, 0x37, 0x3e, 0x03, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x33,
-    0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x0e, 0x03, 0x15, 0x17, 0x23, 0x15, 0x33, 0x03, 0x33,
-    0x15, 0x23, 0x03, 0x33, 0x15, 0x23, 0x02, 0x62, 0x02, 0x4d, 0xfd, 0xb3, 0xfd, 0xad, 0x02, 0xba, 0x06, 0x0c, 0x11,
-    0x0b, 0x16, 0x2d, 0x24, 0x17, 0x25, 0x45, 0x66, 0x40, 0x38, 0x61, 0x49, 0x2b, 0x01, 0xcb, 0x02, 0x29, 0x18, 0x25,
-    0x20, 0x11, 0x18, 0x1b, 0x0a, 0x1d, 0x23, 0x15, 0x08, 0xca, 0xca, 0xca, 0x6c, 0x04, 0x04, 0x02, 0x04, 0x04, 0x06,
-    0x52, 0xfc, 0x31, 0xfc, 0x31, 0x03, 0xcf, 0xfb, 0x19, 0x27, 0x1f, 0x1d, 0x10, 0x1f, 0x37, 0x39, 0x40, 0x29, 0x40,
-    0x67, 0x49, 0x27, 0x1e, 0x41, 0x65, 0x46, 0x37, 0x30, 0x40, 0x34, 0x1a, 0x33, 0x2f, 0x27, 0x0d, 0x24, 0x28, 0x26,
-    0x32, 0x30, 0x5b, 0xaa, 0xfd, 0x56, 0x04, 0x0a, 0x9e, 0x04, 0x00, 0x02, 0x00, 0x9b, 0xff, 0xed, 0x03, 0xf3, 0x04,
-    0x9f, 0x00, 0x1b, 0x00, 0x33, 0x00, 0x08, 0xb5, 0x2f, 0x22, 0x13, 0x04, 0x02, 0x30, 0x2b, 0x01, 0x0e, 0x03, 0x27,
-    0x2e, 0x05, 0x37, 0x37, 0x3e, 0x05, 0x17, 0x1e, 0x05, 0x07, 0x27, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07,
-    0x07, 0x06, 0x06, 0x1e, 0x03, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x03, 0xd3, 0x0f, 0x47, 0x75, 0xa7, 0x6e, 0x46, 0x6d,
-    0x50, 0x34, 0x1c, 0x05, 0x08, 0x19, 0x0a, 0x26, 0x3a, 0x4e, 0x64, 0x7b, 0x49, 0x46, 0x6c, 0x50, 0x34, 0x1c, 0x05,
-    0x07, 0xb2, 0x06, 0x03, 0x22, 0x4a, 0x41, 0x44, 0x63, 0x43, 0x27, 0x09, 0x23, 0x04, 0x02, 0x09, 0x17, 0x29, 0x3d,
-    0x2c, 0x45, 0x62, 0x42, 0x26, 0x09, 0x01, 0xf2, 0x61, 0xbb, 0x92, 0x57, 0x03, 0x02, 0x2c, 0x49, 0x63, 0x71, 0x7a,
-    0x3c, 0xae, 0x40, 0x7f, 0x73, 0x61, 0x47, 0x26, 0x02, 0x02, 0x2b, 0x49, 0x62, 0x70, 0x7a, 0x3c, 0x1d, 0x32, 0x72,
-    0x62, 0x41, 0x02, 0x02, 0x3c, 0x60, 0x77, 0x39, 0xe6, 0x21, 0x4b, 0x4a, 0x43, 0x35, 0x20, 0x01, 0x02, 0x3d, 0x63,
-    0x79, 0x39, 0x00, 0x00, 0x01, 0x00, 0xda, 0x00, 0x00, 0x03, 0x63, 0x03, 0x23, 0x00, 0x20, 0x00, 0x26, 0x40, 0x23,
-    0x00, 0x02, 0x01, 0x04, 0x01, 0x02, 0x04, 0x70, 0x00, 0x03, 0x00, 0x01, 0x02, 0x03, 0x01, 0x63, 0x00, 0x04, 0x04,
-    0x00, 0x59, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x1a, 0x24, 0x12, 0x29, 0x10, 0x05, 0x08, 0x19, 0x2b, 0x21, 0x21,
-    0x37, 0x01, 0x3e, 0x03, 0x37, 0x36, 0x26, 0x27, 0x26, 0x06, 0x07, 0x07, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x0e,
-    0x03, 0x07, 0x07, 0x21, 0x03, 0x21, 0xfd, 0xb9, 0x15, 0x01, 0x3c, 0x15, 0x30, 0x2c, 0x20, 0x04, 0x07, 0x36, 0x2f,
-    0x42, 0x4f, 0x0e, 0x9b, 0x07, 0x35, 0x54, 0x6c, 0x3e, 0x34, 0x5f, 0x46, 0x28, 0x03, 0x03, 0x2c, 0x41, 0x4d, 0x23,
-    0xc3, 0x01, 0x7b, 0x74, 0x01, 0x09, 0x12, 0x2a, 0x30, 0x36, 0x1d, 0x30, 0x36, 0x01, 0x01, 0x4c, 0x3d, 0x01, 0x3e,
-    0x62, 0x45, 0x24, 0x01, 0x01, 0x1d, 0x39, 0x56, 0x39, 0x31, 0x55, 0x4a, 0x40, 0x1b, 0x91, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x01, 0x74, 0x04, 0xe4, 0x04, 0x3e, 0x06, 0xf8, 0x00, 0x06, 0x00, 0x24, 0x00, 0x08, 0xb5, 0x24, 0x16, 0x05,
-    0x00, 0x02, 0x30, 0x2b, 0x01, 0x23, 0x27, 0x07, 0x23, 0x01, 0x33, 0x37, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x07,
-    0x0e, 0x03, 0x07, 0x27, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x37, 0x36, 0x36, 0x37, 0x04, 0x3e, 0x9d, 0xa1, 0xdb,
-    0xb1, 0x01, 0x49, 0x92, 0xe2, 0x05, 0x1c, 0x2b, 0x3c, 0x25, 0x1c, 0x2f, 0x2d, 0x2f, 0x1b, 0x13, 0x1f, 0x17, 0x11,
-    0x05, 0x4d, 0x06, 0x1c, 0x2d, 0x3b, 0x26, 0x1b, 0x30, 0x2e, 0x2f, 0x1b, 0x27, 0x2e, 0x0d, 0x04, 0xe4, 0xaf, 0xaf,
-    0x01, 0x06, 0xf9, 0x21, 0x3f, 0x32, 0x20, 0x19, 0x1c, 0x17, 0x01, 0x01, 0x12, 0x1b, 0x21, 0x10, 0x13, 0x21, 0x40,
-    0x33, 0x20, 0x17, 0x1d, 0x16, 0x02, 0x03, 0x38, 0x21, 0x00, 0x02, 0x01, 0x60, 0x04, 0xe4, 0x05, 0x42, 0x06, 0xce,
-    0x00, 0x06, 0x00, 0x1e, 0x00, 0x08, 0xb5, 0x13, 0x07, 0x05, 0x00, 0x02, 0x30, 0x2b, 0x01, 0x23, 0x27, 0x07, 0x07,
-    0x01, 0x33, 0x17, 0x37, 0x3e, 0x03, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x37, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x07,
-    0x04, 0x2d, 0x9e, 0xa0, 0xdf, 0xb0, 0x01, 0x37, 0xb8, 0xdb, 0x14, 0x11, 0x2c, 0x29, 0x1e, 0x03, 0x02, 0x1b, 0x29,
-    0x2c, 0x0e, 0x0f, 0x23, 0x53, 0x47, 0x2d, 0x03, 0x02, 0x1a, 0x29, 0x34, 0x1c, 0x0a, 0x04, 0xe4, 0xb8, 0xb7, 0x01,
-    0x01, 0x06, 0x7c, 0x83, 0x02, 0x04, 0x0e, 0x19, 0x17, 0x16, 0x18, 0x0c, 0x02, 0x01, 0x5c, 0x02, 0x0d, 0x22, 0x3b,
-    0x2e, 0x20, 0x30, 0x21, 0x14, 0x05, 0x3c, 0x00, 0x02, 0x00, 0xcf, 0x04, 0xe4, 0x04, 0x48, 0x06, 0x95, 0x00, 0x06,
-    0x00, 0x0a, 0x00, 0x08, 0xb5, 0x09, 0x07, 0x05, 0x00, 0x02, 0x30, 0x2b, 0x01, 0x23, 0x27, 0x07, 0x23, 0x01, 0x33,
-    0x05, 0x23, 0x03, 0x33, 0x04, 0x48, 0xb7, 0x89, 0xc0, 0xc9, 0x01, 0x47, 0x95, 0xfe, 0x8d, 0x83, 0x96, 0xbd, 0x04,
-    0xe4, 0x9d, 0x9d, 0x01, 0x06, 0x58, 0x01, 0x03, 0x00, 0x00, 0x00, 0x02, 0x01, 0x6e, 0x04, 0xe4, 0x05, 0x90, 0x06,
-    0x95, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x08, 0xb5, 0x09, 0x07, 0x02, 0x00, 0x02, 0x30, 0x2b, 0x01, 0x33, 0x13, 0x23,
-    0x27, 0x07, 0x23, 0x01, 0x33, 0x03, 0x23, 0x02, 0xb7, 0x94, 0xed, 0xb7, 0x88, 0xbf, 0xcc, 0x03, 0x57, 0xcb, 0xf0,
-    0x92, 0x05, 0xea, 0xfe, 0xfa, 0x9d, 0x9d, 0x01, 0xb1, 0xfe, 0xfd, 0x00, 0x00, 0x00, 0x02, 0x01, 0xb9, 0x04, 0xa5,
-    0x04, 0x21, 0x06, 0xa7, 0x00, 0x11, 0x00, 0x15, 0x00, 0x08, 0xb5, 0x14, 0x12, 0x0a, 0x04, 0x02, 0x30, 0x2b, 0x01,
-    0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x17, 0x06, 0x16, 0x17, 0x16, 0x36, 0x37, 0x27, 0x23, 0x27, 0x33, 0x04, 0x21,
-    0x07, 0x3a, 0x59, 0x72, 0x40, 0x3d, 0x69, 0x4c, 0x2a, 0x02, 0x91, 0x03, 0x46, 0x48, 0x4a, 0x5e, 0x10, 0x4c, 0x85,
-    0xa8, 0xc3, 0x05, 0xb0, 0x41, 0x65, 0x43, 0x22, 0x01, 0x01, 0x24, 0x44, 0x63, 0x3f, 0x01, 0x45, 0x4e, 0x01, 0x01,
-    0x4e, 0x46, 0x2a, 0xce, 0x00, 0x00, 0x00, 0x01, 0x02, 0x4c, 0x04, 0x8e, 0x03, 0x77, 0x06, 0x3d, 0x00, 0x09, 0x00,
-    0x06, 0xb3, 0x08, 0x03, 0x01, 0x30, 0x2b, 0x01, 0x36, 0x36, 0x37, 0x17, 0x06, 0x06, 0x07, 0x07, 0x23, 0x02, 0x5e,
-    0x0e, 0x5f, 0x44, 0x68, 0x24, 0x32, 0x0c, 0x15, 0xb4, 0x05, 0x0d, 0x5a, 0x9c, 0x3a, 0x57, 0x35, 0x6c, 0x3f, 0x78,
-    0x00, 0x00, 0x02, 0xff, 0xc7, 0x00, 0x00, 0x04, 0x00, 0x04, 0x8d, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x25, 0x40, 0x22,
-    0x0a, 0x01, 0x04, 0x02, 0x01, 0x4a, 0x00, 0x02, 0x04, 0x02, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x62,
-    0x03, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x10, 0x05, 0x08, 0x19, 0x2b, 0x01, 0x21, 0x03,
-    0x23, 0x01, 0x33, 0x13, 0x23, 0x01, 0x21, 0x03, 0x03, 0x18, 0xfe, 0x0b, 0x9c, 0xc0, 0x02, 0x9a, 0xa1, 0xfe, 0xaf,
-    0xfe, 0x26, 0x01, 0x82, 0x68, 0x01, 0x17, 0xfe, 0xe9, 0x04, 0x8d, 0xfb, 0x73, 0x01, 0xae, 0x01, 0xf9, 0x00, 0x03,
-    0x00, 0x61, 0xff, 0xff, 0x04, 0x36, 0x04, 0x8d, 0x00, 0x16, 0x00, 0x23, 0x00, 0x30, 0x00, 0x40, 0x40, 0x3d, 0x07,
-    0x01, 0x04, 0x05, 0x0c, 0x01, 0x03, 0x04, 0x02, 0x4a, 0x00, 0x00, 0x00, 0x05, 0x04, 0x00, 0x05, 0x63, 0x00, 0x04,
-    0x07, 0x01, 0x03, 0x02, 0x04, 0x03, 0x63, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x06, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c,
-    0x17, 0x17, 0x00, 0x00, 0x30, 0x2e, 0x26, 0x24, 0x17, 0x23, 0x17, 0x22, 0x1a, 0x18, 0x00, 0x16, 0x00, 0x15, 0x21,
-    0x08, 0x08, 0x15, 0x2b, 0x33, 0x13, 0x05, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x27,
-    0x03, 0x03, 0x17, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x17, 0x3e, 0x03, 0x37, 0x36, 0x2e, 0x02,
-    0x27, 0x27, 0x61, 0xca, 0x01, 0x86, 0x46, 0x8e, 0x6f, 0x42, 0x06, 0x03, 0x29, 0x3f, 0x51, 0x2d, 0x2b, 0x43, 0x2d,
-    0x16, 0x02, 0x05, 0x54, 0x83, 0xa2, 0x51, 0xb3, 0x42, 0xf9, 0x2e, 0x5e, 0x4e, 0x37, 0x07, 0x06, 0x19, 0x33, 0x48,
-    0x2a, 0xff, 0xe8, 0x2b, 0x57, 0x4a, 0x33, 0x07, 0x06, 0x21, 0x3c, 0x4e, 0x27, 0xe6, 0x04, 0x8d, 0x01, 0x02, 0x22,
-    0x49, 0x74, 0x54, 0x34, 0x4f, 0x3d, 0x2d, 0x11, 0x0e, 0x33, 0x43, 0x53, 0x2d, 0x5c, 0x83, 0x52, 0x25, 0x01, 0x02,
-    0x12, 0xfe, 0x85, 0x01, 0x15, 0x2e, 0x49, 0x34, 0x2d, 0x45, 0x2e, 0x19, 0x02, 0x8e, 0x02, 0x01, 0x13, 0x2a, 0x43,
-    0x30, 0x2f, 0x3f, 0x25, 0x11, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x55, 0xff, 0xed, 0x04, 0x37, 0x04, 0xa0,
-    0x00, 0x2d, 0x00, 0x34, 0x40, 0x31, 0x00, 0x02, 0x03, 0x05, 0x03, 0x02, 0x05, 0x70, 0x06, 0x01, 0x05, 0x04, 0x03,
-    0x05, 0x04, 0x6e, 0x00, 0x01, 0x00, 0x03, 0x02, 0x01, 0x03, 0x63, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x00, 0x00, 0x00,
-    0x45, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x2d, 0x2b, 0x24, 0x14, 0x29, 0x24, 0x07, 0x08, 0x19, 0x2b, 0x01,
-    0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x37, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x17, 0x23, 0x2e, 0x03, 0x27, 0x26, 0x0e,
-    0x02, 0x07, 0x07, 0x06, 0x14, 0x1e, 0x03, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x03, 0xe7, 0x13, 0x5c, 0x85, 0xa8, 0x5f,
-    0x70, 0xa0, 0x62, 0x25, 0x0c, 0x0d, 0x10, 0x5d, 0x92, 0xc3, 0x77, 0x5a, 0x8f, 0x67, 0x3b, 0x05, 0xb2, 0x05, 0x1e,
-    0x38, 0x54, 0x39, 0x54, 0x83, 0x5d, 0x39, 0x0c, 0x0f, 0x06, 0x0e, 0x20, 0x35, 0x4d, 0x35, 0x3f, 0x66, 0x50, 0x3a,
-    0x14, 0x01, 0x7a, 0x5d, 0x94, 0x67, 0x35, 0x03, 0x03, 0x60, 0x99, 0xc2, 0x65, 0x64, 0x6e, 0xc9, 0x99, 0x59, 0x03,
-    0x02, 0x3c, 0x69, 0x91, 0x57, 0x36, 0x59, 0x41, 0x25, 0x02, 0x03, 0x44, 0x70, 0x91, 0x4a, 0x67, 0x2b, 0x5b, 0x56,
-    0x4d, 0x3b, 0x25, 0x02, 0x03, 0x20, 0x3f, 0x5c, 0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0x49, 0x00, 0x00, 0x04, 0x3d,
-    0x04, 0x8d, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x2a, 0x40, 0x27, 0x00, 0x00, 0x05, 0x01, 0x03, 0x02, 0x00, 0x03, 0x63,
-    0x00, 0x02, 0x02, 0x01, 0x5b, 0x04, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x0e, 0x0e, 0x00, 0x00, 0x0e, 0x1b, 0x0e,
-    0x1a, 0x11, 0x0f, 0x00, 0x0d, 0x00, 0x0c, 0x21, 0x06, 0x08, 0x15, 0x2b, 0x33, 0x13, 0x05, 0x1e, 0x03, 0x07, 0x07,
-    0x0e, 0x03, 0x23, 0x13, 0x03, 0x17, 0x32, 0x3e, 0x02, 0x37, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x49, 0xca, 0x01, 0x55,
-    0x73, 0xb5, 0x77, 0x36, 0x0b, 0x07, 0x10, 0x70, 0xab, 0xdb, 0x7b, 0x04, 0x95, 0x95, 0x5b, 0x9c, 0x77, 0x4e, 0x0d,
-    0x08, 0x09, 0x17, 0x44, 0x74, 0x55, 0x04, 0x8d, 0x01, 0x03, 0x58, 0x94, 0xc4, 0x70, 0x41, 0x7b, 0xcc, 0x91, 0x50,
-    0x03, 0xf4, 0xfc, 0xa3, 0x01, 0x3b, 0x6a, 0x94, 0x5a, 0x40, 0x4d, 0x8b, 0x6c, 0x42, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x59, 0x00, 0x00, 0x04, 0x61, 0x04, 0x8d, 0x00, 0x0b, 0x00, 0x27, 0x40, 0x24, 0x00, 0x03, 0x00, 0x04,
-    0x05, 0x03, 0x04, 0x61, 0x00, 0x05, 0x00, 0x00, 0x01, 0x05, 0x00, 0x61, 0x00, 0x01, 0x01, 0x02, 0x59, 0x00, 0x02,
-    0x02, 0x3d, 0x02, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x01, 0x21, 0x03, 0x21, 0x07,
-    0x21, 0x13, 0x21, 0x07, 0x21, 0x03, 0x21, 0x03, 0x9c, 0xfd, 0xd2, 0x42, 0x02, 0x8b, 0x1b, 0xfc, 0xbd, 0xcb, 0x03,
-    0x3d, 0x1c, 0xfd, 0x7d, 0x3a, 0x02, 0x2f, 0x02, 0x0e, 0xfe, 0x89, 0x97, 0x04, 0x8d, 0x99, 0xfe, 0xb2, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x77, 0x00, 0x00, 0x04, 0x80, 0x04, 0x8d, 0x00, 0x09, 0x00, 0x21, 0x40, 0x1e, 0x00, 0x02, 0x00,
-    0x03, 0x04, 0x02, 0x03, 0x61, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x61, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c,
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x05, 0x08, 0x19, 0x2b, 0x01, 0x21, 0x03, 0x23, 0x13, 0x21, 0x07, 0x21, 0x03, 0x21,
-    0x03, 0xb5, 0xfd, 0xd5, 0x57, 0xbc, 0xcb, 0x03, 0x3e, 0x1c, 0xfd, 0x7f, 0x3f, 0x02, 0x2c, 0x01, 0xf3, 0xfe, 0x0d,
-    0x04, 0x8d, 0x99, 0xfe, 0x98, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x64, 0xff, 0xef, 0x04, 0x47, 0x04, 0xa0, 0x00,
-    0x2b, 0x00, 0x30, 0x40, 0x2d, 0x00, 0x02, 0x03, 0x06, 0x03, 0x02, 0x06, 0x70, 0x00, 0x01, 0x00, 0x03, 0x02, 0x01,
-    0x03, 0x63, 0x00, 0x06, 0x00, 0x05, 0x04, 0x06, 0x05, 0x61, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45,
-    0x00, 0x4c, 0x11, 0x13, 0x29, 0x22, 0x14, 0x29, 0x24, 0x07, 0x08, 0x1b, 0x2b, 0x25, 0x0e, 0x03, 0x27, 0x2e, 0x03,
-    0x37, 0x37, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x17, 0x27, 0x26, 0x26, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x07, 0x06, 0x1e,
-    0x02, 0x17, 0x16, 0x36, 0x37, 0x37, 0x21, 0x37, 0x21, 0x03, 0xdd, 0x2b, 0x6a, 0x76, 0x7e, 0x3f, 0x73, 0xa9, 0x6b,
-    0x2a, 0x0c, 0x0b, 0x10, 0x5b, 0x91, 0xc4, 0x7a, 0x55, 0x8d, 0x68, 0x40, 0x08, 0xb0, 0x0e, 0x74, 0x67, 0x57, 0x83,
-    0x5d, 0x39, 0x0c, 0x0c, 0x09, 0x0f, 0x38, 0x69, 0x51, 0x48, 0x85, 0x3c, 0x2d, 0xfe, 0xf3, 0x1a, 0x01, 0xbd, 0x96,
-    0x30, 0x41, 0x27, 0x0f, 0x02, 0x03, 0x5f, 0x99, 0xc5, 0x6b, 0x54, 0x70, 0xcc, 0x9a, 0x5a, 0x03, 0x02, 0x35, 0x60,
-    0x87, 0x55, 0x01, 0x64, 0x74, 0x03, 0x03, 0x45, 0x73, 0x93, 0x4c, 0x57, 0x45, 0x8c, 0x73, 0x4b, 0x03, 0x03, 0x20,
-    0x2a, 0xef, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2e, 0x00, 0x00, 0x04, 0x3e, 0x04, 0x8d, 0x00, 0x0b, 0x00,
-    0x21, 0x40, 0x1e, 0x05, 0x01, 0x03, 0x04, 0x03, 0x72, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x62, 0x02, 0x01,
-    0x00, 0x00, 0x3d, 0x00, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x21, 0x23, 0x13, 0x21,
-    0x03, 0x23, 0x13, 0x33, 0x03, 0x21, 0x13, 0x33, 0x03, 0x73, 0xae, 0x57, 0xfe, 0x16, 0x56, 0xae, 0xca, 0xae, 0x5a,
-    0x01, 0xea, 0x5a, 0xae, 0x01, 0xf2, 0xfe, 0x0e, 0x04, 0x8d, 0xfd, 0xfd, 0x02, 0x03, 0x00, 0x01, 0x00, 0x6a, 0x00,
-    0x00, 0x04, 0x54, 0x04, 0x8c, 0x00, 0x0b, 0x00, 0x21, 0x40, 0x1e, 0x00, 0x00, 0x05, 0x01, 0x01, 0x02, 0x00, 0x01,
-    0x61, 0x04, 0x01, 0x02, 0x02, 0x03, 0x59, 0x00, 0x03, 0x03, 0x3d, 0x03, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x06, 0x08, 0x1a, 0x2b, 0x01, 0x21, 0x07, 0x21, 0x03, 0x21, 0x07, 0x21, 0x37, 0x21, 0x13, 0x21, 0x01, 0x34, 0x03,
-    0x20, 0x1d, 0xfe, 0xc7, 0x92, 0x01, 0x3a, 0x1d, 0xfc, 0xe1, 0x1c, 0x01, 0x31, 0x93, 0xfe, 0xce, 0x04, 0x8c, 0xa1,
-    0xfc, 0xb5, 0xa0, 0xa0, 0x03, 0x4b, 0x00, 0x00, 0x01, 0x00, 0x68, 0xff, 0xee, 0x04, 0x2b, 0x04, 0x8d, 0x00, 0x17,
-    0x00, 0x1f, 0x40, 0x1c, 0x00, 0x00, 0x02, 0x00, 0x72, 0x00, 0x02, 0x03, 0x02, 0x72, 0x00, 0x03, 0x03, 0x01, 0x5b,
-    0x00, 0x01, 0x01, 0x45, 0x01, 0x4c, 0x24, 0x14, 0x25, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x33, 0x03, 0x0e, 0x03,
-    0x27, 0x2e, 0x03, 0x27, 0x17, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x03, 0x71, 0xba, 0x87, 0x0d, 0x4e,
-    0x78, 0x9b, 0x59, 0x59, 0x89, 0x5e, 0x33, 0x02, 0xb9, 0x03, 0x15, 0x32, 0x4d, 0x36, 0x35, 0x59, 0x43, 0x2c, 0x08,
-    0x04, 0x8d, 0xfc, 0xea, 0x57, 0x91, 0x68, 0x39, 0x02, 0x01, 0x38, 0x64, 0x8c, 0x57, 0x01, 0x33, 0x54, 0x3e, 0x23,
-    0x01, 0x01, 0x26, 0x42, 0x59, 0x32, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x04, 0xa7, 0x04, 0x8d,
-    0x00, 0x0c, 0x00, 0x1e, 0x40, 0x1b, 0x0a, 0x06, 0x02, 0x00, 0x01, 0x01, 0x4a, 0x02, 0x01, 0x01, 0x01, 0x00, 0x59,
-    0x03, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x12, 0x13, 0x11, 0x12, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x07, 0x03, 0x23,
-    0x13, 0x33, 0x03, 0x37, 0x01, 0x33, 0x01, 0x01, 0x23, 0x01, 0xea, 0xaf, 0x40, 0xb5, 0xca, 0xb5, 0x5f, 0x91, 0x01,
-    0xc3, 0xed, 0xfd, 0xcc, 0x01, 0x7c, 0xcd, 0x02, 0x06, 0x95, 0xfe, 0x8f, 0x04, 0x8d, 0xfd, 0xe1, 0x87, 0x01, 0x98,
-    0xfd, 0xf0, 0xfd, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x62, 0x00, 0x00, 0x03, 0xe4, 0x04, 0x8d, 0x00, 0x05, 0x00,
-    0x19, 0x40, 0x16, 0x00, 0x02, 0x00, 0x02, 0x72, 0x00, 0x00, 0x00, 0x01, 0x5a, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c,
-    0x11, 0x11, 0x10, 0x03, 0x08, 0x17, 0x2b, 0x25, 0x21, 0x07, 0x21, 0x13, 0x33, 0x01, 0x3c, 0x02, 0xa8, 0x1b, 0xfc,
-    0x99, 0xcb, 0xbf, 0x97, 0x97, 0x04, 0x8d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2e, 0x00, 0x00, 0x04, 0x7d, 0x04, 0x8d,
-    0x00, 0x0c, 0x00, 0x27, 0x40, 0x24, 0x08, 0x05, 0x02, 0x02, 0x00, 0x01, 0x4a, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02,
-    0x01, 0x70, 0x04, 0x01, 0x00, 0x00, 0x01, 0x59, 0x03, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x11, 0x12, 0x12, 0x11,
-    0x11, 0x05, 0x08, 0x19, 0x2b, 0x01, 0x01, 0x33, 0x03, 0x23, 0x13, 0x01, 0x23, 0x03, 0x03, 0x23, 0x13, 0x33, 0x02,
-    0x56, 0x01, 0x37, 0xf0, 0xcb, 0xac, 0xa5, 0xfe, 0xc4, 0x80, 0x6f, 0xa6, 0xac, 0xca, 0xee, 0x02, 0x5a, 0x02, 0x33,
-    0xfb, 0x73, 0x03, 0xb0, 0xfd, 0x8e, 0x02, 0x7a, 0xfc, 0x48, 0x04, 0x8d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x54, 0x00,
-    0x00, 0x04, 0x53, 0x04, 0x8d, 0x00, 0x09, 0x00, 0x1e, 0x40, 0x1b, 0x07, 0x02, 0x02, 0x00, 0x02, 0x01, 0x4a, 0x03,
-    0x01, 0x02, 0x00, 0x02, 0x72, 0x01, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x12, 0x11, 0x12, 0x10, 0x04, 0x08, 0x18,
-    0x2b, 0x21, 0x23, 0x01, 0x03, 0x23, 0x13, 0x33, 0x01, 0x13, 0x33, 0x03, 0x89, 0xa3, 0xfe, 0xb0, 0x95, 0xad, 0xca,
-    0xa4, 0x01, 0x51, 0x94, 0xac, 0x03, 0x74, 0xfc, 0x8c, 0x04, 0x8d, 0xfc, 0x8b, 0x03, 0x75, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x71, 0xff, 0xed, 0x04, 0x32, 0x04, 0xa0, 0x00, 0x19, 0x00, 0x33, 0x00, 0x1d, 0x40, 0x1a, 0x00, 0x01,
-    0x00, 0x02, 0x03, 0x01, 0x02, 0x63, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x2b, 0x2d,
-    0x2b, 0x24, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x0e, 0x03, 0x27, 0x2e, 0x05, 0x37, 0x37, 0x3e, 0x03, 0x17, 0x1e, 0x05,
-    0x07, 0x27, 0x36, 0x36, 0x2e, 0x03, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x07, 0x06, 0x14, 0x1e, 0x03, 0x17, 0x16, 0x3e,
-    0x02, 0x37, 0x04, 0x23, 0x0f, 0x57, 0x8c, 0xbf, 0x77, 0x4c, 0x78, 0x5b, 0x3e, 0x23, 0x0a, 0x07, 0x08, 0x0f, 0x57,
-    0x8c, 0xbf, 0x77, 0x4d, 0x79, 0x5b, 0x3e, 0x23, 0x08, 0x07, 0xb3, 0x05, 0x01, 0x0e, 0x1d, 0x34, 0x4d, 0x35, 0x53,
-    0x7f, 0x59, 0x36, 0x0b, 0x09, 0x05, 0x0e, 0x1e, 0x34, 0x4d, 0x35, 0x55, 0x7f, 0x58, 0x33, 0x0b, 0x02, 0x25, 0x6c,
-    0xcd, 0xa0, 0x5f, 0x03, 0x02, 0x2f, 0x51, 0x6b, 0x7b, 0x86, 0x42, 0x45, 0x6b, 0xcf, 0xa1, 0x60, 0x03, 0x02, 0x30,
-    0x51, 0x6c, 0x7d, 0x87, 0x43, 0x08, 0x2a, 0x5b, 0x59, 0x50, 0x3e, 0x25, 0x02, 0x03, 0x4b, 0x78, 0x95, 0x47, 0x44,
-    0x2a, 0x5b, 0x5a, 0x52, 0x3f, 0x27, 0x02, 0x03, 0x4c, 0x7a, 0x96, 0x48, 0x00, 0x02, 0x00, 0x48, 0xff, 0x36, 0x04,
-    0x4f, 0x04, 0xa0, 0x00, 0x19, 0x00, 0x2f, 0x00, 0x28, 0x40, 0x25, 0x03, 0x01, 0x00, 0x03, 0x01, 0x4a, 0x05, 0x04,
-    0x02, 0x00, 0x47, 0x00, 0x01, 0x00, 0x02, 0x03, 0x01, 0x02, 0x63, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00,
-    0x45, 0x00, 0x4c, 0x29, 0x29, 0x29, 0x28, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x06, 0x06, 0x07, 0x17, 0x07, 0x27, 0x06,
-    0x06, 0x27, 0x2e, 0x03, 0x37, 0x37, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x07, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e,
-    0x02, 0x07, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x04, 0x3c, 0x14, 0x94, 0x82, 0xbc, 0x84, 0xdd,
-    0x1f, 0x3c, 0x1f, 0x74, 0xa7, 0x67, 0x29, 0x0c, 0x08, 0x10, 0x5f, 0x97, 0xc9, 0x79, 0x74, 0xa7, 0x68, 0x28, 0x0b,
-    0xb3, 0x08, 0x0d, 0x36, 0x68, 0x53, 0x56, 0x88, 0x62, 0x3e, 0x0c, 0x0a, 0x08, 0x0d, 0x38, 0x68, 0x53, 0x57, 0x88,
-    0x61, 0x3c, 0x0c, 0x02, 0x2a, 0x98, 0xfa, 0x54, 0xa7, 0x67, 0xc7, 0x05, 0x07, 0x01, 0x02, 0x62, 0x9d, 0xc8, 0x69,
-    0x43, 0x70, 0xcf, 0x9e, 0x5c, 0x03, 0x03, 0x60, 0x9c, 0xc7, 0x69, 0x03, 0x45, 0x8e, 0x75, 0x4c, 0x03, 0x03, 0x46,
-    0x75, 0x95, 0x4c, 0x46, 0x44, 0x8f, 0x77, 0x4d, 0x03, 0x03, 0x46, 0x75, 0x96, 0x4d, 0x00, 0x02, 0x00, 0x23, 0x00,
-    0x00, 0x04, 0x03, 0x04, 0x8d, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x29, 0x40, 0x26, 0x0f, 0x01, 0x00, 0x04, 0x01, 0x4a,
-    0x00, 0x02, 0x00, 0x05, 0x04, 0x02, 0x05, 0x63, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x61, 0x03, 0x01, 0x01,
-    0x01, 0x3d, 0x01, 0x4c, 0x28, 0x21, 0x2a, 0x21, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x01, 0x21, 0x03, 0x23, 0x13,
-    0x05, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x13, 0x15, 0x23, 0x01, 0x17, 0x3e, 0x03, 0x37, 0x36, 0x2e, 0x02, 0x27,
-    0x27, 0x02, 0x3a, 0xfe, 0xec, 0x4e, 0xb5, 0xca, 0x01, 0x92, 0x4e, 0x8f, 0x6c, 0x3b, 0x06, 0x04, 0x30, 0x4c, 0x63,
-    0x38, 0xc7, 0xc2, 0xfe, 0x59, 0xe4, 0x31, 0x62, 0x51, 0x38, 0x07, 0x06, 0x1c, 0x39, 0x4f, 0x2d, 0xf4, 0x01, 0xc1,
-    0xfe, 0x3f, 0x04, 0x8d, 0x01, 0x03, 0x2c, 0x55, 0x80, 0x57, 0x41, 0x64, 0x4d, 0x3b, 0x16, 0xfe, 0x1e, 0x0c, 0x02,
-    0x58, 0x02, 0x01, 0x1a, 0x34, 0x4f, 0x36, 0x31, 0x4a, 0x32, 0x1a, 0x02, 0x01, 0x00, 0x00, 0x01, 0x00, 0x5e, 0xff,
-    0xef, 0x04, 0x3b, 0x04, 0x9e, 0x00, 0x41, 0x00, 0x31, 0x40, 0x2e, 0x00, 0x01, 0x02, 0x04, 0x02, 0x01, 0x04, 0x70,
-    0x00, 0x04, 0x05, 0x02, 0x04, 0x05, 0x6e, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x02, 0x63, 0x00, 0x05, 0x05, 0x03,
-    0x5b, 0x00, 0x03, 0x03, 0x45, 0x03, 0x4c, 0x3e, 0x3c, 0x38, 0x37, 0x33, 0x31, 0x24, 0x14, 0x2e, 0x06, 0x08, 0x17,
-    0x2b, 0x01, 0x36, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x37, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x17, 0x27, 0x36, 0x2e, 0x02,
-    0x27, 0x26, 0x0e, 0x02, 0x07, 0x06, 0x1e, 0x04, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x05, 0x27, 0x2e, 0x03, 0x27, 0x17,
-    0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x03, 0x36, 0x06, 0x2a, 0x48, 0x56, 0x25, 0x40, 0x88, 0x6f, 0x44, 0x04,
-    0x04, 0x59, 0x87, 0xa1, 0x4c, 0x51, 0x91, 0x6d, 0x41, 0x02, 0xb5, 0x01, 0x23, 0x3d, 0x55, 0x31, 0x2a, 0x5e, 0x50,
-    0x38, 0x06, 0x03, 0x15, 0x29, 0x37, 0x3a, 0x3a, 0x17, 0x40, 0x82, 0x67, 0x3d, 0x04, 0x03, 0x2c, 0x48, 0x5c, 0x68,
-    0x6c, 0x33, 0x54, 0x9b, 0x78, 0x49, 0x02, 0xb6, 0x01, 0x29, 0x46, 0x5f, 0x35, 0x2b, 0x60, 0x53, 0x3b, 0x01, 0x31,
-    0x32, 0x43, 0x2c, 0x1b, 0x0b, 0x13, 0x35, 0x51, 0x73, 0x50, 0x57, 0x7e, 0x51, 0x24, 0x01, 0x02, 0x30, 0x5a, 0x84,
-    0x55, 0x01, 0x34, 0x4c, 0x32, 0x19, 0x01, 0x01, 0x11, 0x2a, 0x44, 0x31, 0x21, 0x32, 0x25, 0x1c, 0x14, 0x10, 0x07,
-    0x13, 0x39, 0x55, 0x74, 0x4e, 0x3c, 0x5f, 0x48, 0x34, 0x20, 0x0e, 0x01, 0x01, 0x2f, 0x5b, 0x88, 0x5b, 0x01, 0x3a,
-    0x51, 0x33, 0x18, 0x01, 0x01, 0x10, 0x27, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xa1, 0x00, 0x00, 0x04, 0xaa,
-    0x04, 0x8d, 0x00, 0x07, 0x00, 0x19, 0x40, 0x16, 0x00, 0x03, 0x02, 0x01, 0x00, 0x01, 0x03, 0x00, 0x61, 0x00, 0x01,
-    0x01, 0x3d, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x21, 0x03, 0x23, 0x13, 0x21, 0x37,
-    0x21, 0x04, 0x8f, 0xfe, 0x64, 0xaf, 0xb8, 0xb0, 0xfe, 0x65, 0x1b, 0x03, 0xee, 0x03, 0xf4, 0xfc, 0x0c, 0x03, 0xf4,
-    0x99, 0x00, 0x00, 0x00, 0x01, 0x00, 0x86, 0xff, 0xee, 0x04, 0x6d, 0x04, 0x8d, 0x00, 0x19, 0x00, 0x21, 0x40, 0x1e,
-    0x04, 0x03, 0x02, 0x01, 0x02, 0x01, 0x72, 0x00, 0x02, 0x02, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x00,
-    0x00, 0x00, 0x19, 0x00, 0x19, 0x25, 0x15, 0x25, 0x05, 0x08, 0x17, 0x2b, 0x01, 0x03, 0x0e, 0x03, 0x27, 0x2e, 0x03,
-    0x37, 0x13, 0x33, 0x03, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x13, 0x04, 0x6d, 0x82, 0x0d, 0x57, 0x84,
-    0xa6, 0x5d, 0x56, 0x8f, 0x64, 0x31, 0x08, 0x84, 0xb1, 0x83, 0x06, 0x15, 0x34, 0x52, 0x37, 0x3a, 0x64, 0x4d, 0x33,
-    0x0a, 0x86, 0x04, 0x8d, 0xfc, 0xf6, 0x5d, 0x96, 0x6a, 0x38, 0x02, 0x02, 0x3c, 0x69, 0x92, 0x58, 0x03, 0x0c, 0xfc,
-    0xf3, 0x35, 0x5a, 0x42, 0x27, 0x01, 0x02, 0x23, 0x42, 0x5d, 0x39, 0x03, 0x0d, 0x00, 0x01, 0x00, 0xb9, 0x00, 0x00,
-    0x04, 0xc8, 0x04, 0x8d, 0x00, 0x08, 0x00, 0x1b, 0x40, 0x18, 0x01, 0x01, 0x01, 0x00, 0x01, 0x4a, 0x02, 0x01, 0x00,
-    0x01, 0x00, 0x72, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x11, 0x11, 0x13, 0x03, 0x08, 0x17, 0x2b, 0x01, 0x17, 0x37,
-    0x01, 0x33, 0x01, 0x23, 0x03, 0x33, 0x02, 0x0b, 0x07, 0x32, 0x01, 0xb7, 0xcd, 0xfd, 0x83, 0xaa, 0xe8, 0xbb, 0x01,
-    0x2c, 0x5e, 0x70, 0x03, 0x4f, 0xfb, 0x73, 0x04, 0x8d, 0x00, 0x01, 0x00, 0x91, 0x00, 0x00, 0x04, 0xfc, 0x04, 0x8d,
-    0x00, 0x0c, 0x00, 0x21, 0x40, 0x1e, 0x0a, 0x05, 0x00, 0x03, 0x01, 0x00, 0x01, 0x4a, 0x04, 0x03, 0x02, 0x00, 0x00,
-    0x01, 0x59, 0x02, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x12, 0x11, 0x12, 0x11, 0x11, 0x05, 0x08, 0x19, 0x2b, 0x01,
-    0x01, 0x33, 0x01, 0x23, 0x03, 0x01, 0x23, 0x03, 0x33, 0x13, 0x01, 0x33, 0x03, 0x2e, 0x01, 0x22, 0xac, 0xfe, 0x54,
-    0x9b, 0x26, 0xfe, 0xb5, 0x9c, 0x17, 0xa3, 0x04, 0x01, 0x41, 0x96, 0x01, 0x56, 0x03, 0x37, 0xfb, 0x73, 0x03, 0x3b,
-    0xfc, 0xc5, 0x04, 0x8d, 0xfc, 0xca, 0x03, 0x36, 0x00, 0x00, 0x00, 0x01, 0xff, 0xee, 0x00, 0x00, 0x04, 0x9f, 0x04,
-    0x8d, 0x00, 0x0b, 0x00, 0x1f, 0x40, 0x1c, 0x09, 0x06, 0x03, 0x03, 0x01, 0x00, 0x01, 0x4a, 0x03, 0x01, 0x00, 0x00,
-    0x01, 0x59, 0x02, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x12, 0x12, 0x12, 0x11, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x01,
-    0x17, 0x01, 0x01, 0x23, 0x03, 0x01, 0x23, 0x01, 0x01, 0x33, 0x02, 0x5d, 0x01, 0x60, 0xe2, 0xfe, 0x17, 0x01, 0x21,
-    0xca, 0xd2, 0xfe, 0x97, 0xe4, 0x01, 0xf7, 0xfe, 0xe9, 0xc9, 0x02, 0xdb, 0x01, 0xb2, 0x01, 0xfd, 0xb5, 0xfd, 0xbf,
-    0x01, 0xba, 0xfe, 0x46, 0x02, 0x55, 0x02, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb2, 0x00, 0x00, 0x04, 0xc7,
-    0x04, 0x8d, 0x00, 0x08, 0x00, 0x1b, 0x40, 0x18, 0x06, 0x01, 0x01, 0x00, 0x01, 0x4a, 0x02, 0x01, 0x00, 0x01, 0x00,
-    0x72, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x12, 0x12, 0x11, 0x03, 0x08, 0x17, 0x2b, 0x01, 0x01, 0x33, 0x01, 0x03,
-    0x23, 0x13, 0x01, 0x33, 0x02, 0x4b, 0x01, 0xa2, 0xda, 0xfd, 0xc2, 0x44, 0xb7, 0x4b, 0xfe, 0xd9, 0xc3, 0x02, 0x45,
-    0x02, 0x48, 0xfc, 0xfe, 0xfe, 0x75, 0x01, 0xab, 0x02, 0xe2, 0x00, 0x00, 0x01, 0x00, 0x55, 0x00, 0x00, 0x04, 0x62,
-    0x04, 0x8d, 0x00, 0x09, 0x00, 0x1d, 0x40, 0x1a, 0x00, 0x03, 0x00, 0x02, 0x00, 0x03, 0x02, 0x61, 0x00, 0x00, 0x00,
-    0x01, 0x59, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x11, 0x12, 0x11, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x25, 0x21, 0x07,
-    0x21, 0x37, 0x01, 0x21, 0x37, 0x21, 0x07, 0x01, 0x53, 0x02, 0x89, 0x18, 0xfc, 0x91, 0x15, 0x02, 0xfb, 0xfd, 0x97,
-    0x18, 0x03, 0x4e, 0x13, 0x97, 0x97, 0x84, 0x03, 0x70, 0x99, 0x81, 0x00, 0x02, 0x01, 0xdc, 0x04, 0xdf, 0x04, 0x0f,
-    0x07, 0x02, 0x00, 0x11, 0x00, 0x2b, 0x00, 0x08, 0xb5, 0x2b, 0x1e, 0x0a, 0x04, 0x02, 0x30, 0x2b, 0x01, 0x0e, 0x03,
-    0x27, 0x2e, 0x03, 0x27, 0x17, 0x06, 0x16, 0x33, 0x16, 0x36, 0x37, 0x27, 0x37, 0x3e, 0x03, 0x37, 0x36, 0x2e, 0x02,
-    0x23, 0x37, 0x1e, 0x05, 0x07, 0x0e, 0x03, 0x07, 0x07, 0x04, 0x0f, 0x06, 0x37, 0x52, 0x65, 0x34, 0x32, 0x5f, 0x4b,
-    0x2e, 0x01, 0x8c, 0x02, 0x42, 0x3b, 0x3c, 0x53, 0x10, 0xc8, 0x0e, 0x10, 0x30, 0x2f, 0x24, 0x03, 0x03, 0x24, 0x32,
-    0x32, 0x0c, 0x0c, 0x15, 0x38, 0x3c, 0x3a, 0x2d, 0x1a, 0x01, 0x01, 0x1e, 0x2d, 0x37, 0x1a, 0x06, 0x05, 0xb1, 0x39,
-    0x50, 0x32, 0x17, 0x01, 0x01, 0x18, 0x33, 0x4e, 0x38, 0x02, 0x3b, 0x38, 0x01, 0x3a, 0x39, 0x12, 0x7c, 0x01, 0x03,
-    0x0b, 0x18, 0x17, 0x16, 0x16, 0x09, 0x01, 0x51, 0x01, 0x03, 0x0a, 0x13, 0x1e, 0x2c, 0x1f, 0x20, 0x2a, 0x1b, 0x10,
-    0x04, 0x3f, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x00, 0x00, 0x03, 0x96, 0x04, 0x90, 0x00, 0x06, 0x00, 0x06, 0xb3, 0x05,
-    0x00, 0x01, 0x30, 0x2b, 0x21, 0x23, 0x13, 0x05, 0x37, 0x25, 0x33, 0x02, 0xd1, 0xb6, 0xa4, 0xfe, 0x6d, 0x1d, 0x02,
-    0x30, 0x1d, 0x03, 0xab, 0x74, 0xa5, 0xb4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x62, 0x00, 0x00, 0x04, 0x0a, 0x04, 0x9f,
-    0x00, 0x24, 0x00, 0x06, 0xb3, 0x17, 0x00, 0x01, 0x30, 0x2b, 0x21, 0x21, 0x37, 0x01, 0x3e, 0x03, 0x37, 0x36, 0x2e,
-    0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x07, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x01, 0x21, 0x03,
-    0xaa, 0xfc, 0xb8, 0x19, 0x01, 0xdc, 0x24, 0x51, 0x47, 0x33, 0x06, 0x04, 0x16, 0x2e, 0x41, 0x26, 0x37, 0x5c, 0x47,
-    0x31, 0x0c, 0xb6, 0x0c, 0x55, 0x7f, 0xa0, 0x57, 0x46, 0x80, 0x60, 0x35, 0x06, 0x05, 0x3b, 0x57, 0x68, 0x31, 0xfe,
-    0x8d, 0x02, 0x64, 0x8b, 0x01, 0x95, 0x1e, 0x41, 0x4b, 0x57, 0x33, 0x28, 0x41, 0x2e, 0x1a, 0x02, 0x02, 0x1d, 0x39,
-    0x54, 0x34, 0x01, 0x59, 0x8c, 0x60, 0x30, 0x02, 0x02, 0x2d, 0x53, 0x78, 0x4c, 0x42, 0x79, 0x6b, 0x5d, 0x27, 0xfe,
-    0xea, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x8d, 0xff, 0xee, 0x04, 0x13, 0x04, 0x9f, 0x00, 0x3e, 0x00, 0x06, 0xb3,
-    0x27, 0x15, 0x01, 0x30, 0x2b, 0x01, 0x17, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07,
-    0x23, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x35,
-    0x33, 0x1e, 0x03, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x01, 0xd4, 0x6d, 0x2e, 0x5e, 0x4f,
-    0x36, 0x06, 0x05, 0x19, 0x32, 0x45, 0x27, 0x2c, 0x4e, 0x40, 0x2f, 0x0c, 0xb7, 0x0c, 0x51, 0x76, 0x92, 0x4d, 0x47,
-    0x85, 0x63, 0x38, 0x05, 0x03, 0x2a, 0x42, 0x55, 0x2e, 0x56, 0x59, 0x05, 0x05, 0x53, 0x80, 0x9f, 0x50, 0x4b, 0x87,
-    0x64, 0x3c, 0xb2, 0x01, 0x1f, 0x36, 0x48, 0x2b, 0x2e, 0x5b, 0x4a, 0x32, 0x06, 0x06, 0x21, 0x3e, 0x52, 0x2b, 0x83,
-    0x02, 0x9b, 0x01, 0x16, 0x2e, 0x48, 0x34, 0x2a, 0x40, 0x2b, 0x17, 0x01, 0x01, 0x15, 0x2b, 0x40, 0x2a, 0x50, 0x79,
-    0x51, 0x27, 0x02, 0x02, 0x2a, 0x51, 0x77, 0x4e, 0x36, 0x54, 0x40, 0x2f, 0x12, 0x21, 0x85, 0x5d, 0x58, 0x84, 0x58,
-    0x2b, 0x02, 0x01, 0x2c, 0x53, 0x7a, 0x50, 0x2d, 0x42, 0x2c, 0x16, 0x01, 0x01, 0x18, 0x31, 0x4a, 0x32, 0x33, 0x45,
-    0x2c, 0x14, 0x02, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x4d, 0x00, 0x00, 0x03, 0xfe, 0x04, 0x8d, 0x00, 0x0a, 0x00,
-    0x0e, 0x00, 0x08, 0xb5, 0x0d, 0x0b, 0x09, 0x04, 0x02, 0x30, 0x2b, 0x01, 0x33, 0x07, 0x23, 0x03, 0x23, 0x13, 0x21,
-    0x37, 0x01, 0x33, 0x01, 0x21, 0x13, 0x07, 0x03, 0x53, 0xab, 0x1a, 0xab, 0x2e, 0xac, 0x2e, 0xfd, 0xc0, 0x12, 0x02,
-    0xb3, 0xc4, 0xfd, 0x5f, 0x01, 0x72, 0x5b, 0x2c, 0x01, 0x9d, 0x97, 0xfe, 0xfa, 0x01, 0x06, 0x7c, 0x03, 0x0b, 0xfd,
-    0x10, 0x02, 0x0a, 0x3a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x98, 0xff, 0xee, 0x04, 0x26, 0x04, 0x8d, 0x00, 0x28, 0x00,
-    0x06, 0xb3, 0x11, 0x01, 0x01, 0x30, 0x2b, 0x13, 0x13, 0x21, 0x07, 0x21, 0x03, 0x36, 0x36, 0x17, 0x1e, 0x03, 0x07,
-    0x0e, 0x03, 0x27, 0x2e, 0x03, 0x27, 0x17, 0x16, 0x16, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x26,
-    0x06, 0x07, 0xe9, 0xa7, 0x02, 0x96, 0x1c, 0xfe, 0x07, 0x60, 0x32, 0x68, 0x37, 0x51, 0x80, 0x57, 0x2a, 0x06, 0x06,
-    0x4e, 0x7b, 0xa0, 0x59, 0x4b, 0x80, 0x61, 0x3c, 0x06, 0xab, 0x0b, 0x6a, 0x58, 0x36, 0x5d, 0x46, 0x2c, 0x05, 0x05,
-    0x1a, 0x36, 0x4e, 0x30, 0x3a, 0x67, 0x31, 0x02, 0x46, 0x02, 0x47, 0xa2, 0xfe, 0xde, 0x17, 0x19, 0x01, 0x01, 0x3c,
-    0x67, 0x8a, 0x4e, 0x5b, 0x94, 0x68, 0x37, 0x02, 0x02, 0x2f, 0x55, 0x78, 0x4c, 0x01, 0x55, 0x5c, 0x02, 0x01, 0x27,
-    0x45, 0x5c, 0x35, 0x30, 0x51, 0x3b, 0x22, 0x01, 0x02, 0x27, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0xb8, 0xff, 0xee,
-    0x03, 0xea, 0x04, 0x94, 0x00, 0x1f, 0x00, 0x32, 0x00, 0x08, 0xb5, 0x2a, 0x21, 0x13, 0x00, 0x02, 0x30, 0x2b, 0x01,
-    0x07, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x36, 0x36, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x37,
-    0x3e, 0x03, 0x37, 0x01, 0x26, 0x06, 0x07, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02,
-    0x03, 0xb3, 0x11, 0x0b, 0x5f, 0xa1, 0x84, 0x63, 0x1f, 0x3a, 0x91, 0x51, 0x4f, 0x7a, 0x50, 0x24, 0x06, 0x07, 0x4b,
-    0x79, 0x9e, 0x59, 0x5d, 0x8d, 0x5a, 0x26, 0x09, 0x0a, 0x15, 0x76, 0xba, 0xf7, 0x95, 0xfe, 0xe2, 0x53, 0x89, 0x2c,
-    0x05, 0x05, 0x0e, 0x2a, 0x4c, 0x3a, 0x35, 0x5c, 0x45, 0x2c, 0x06, 0x05, 0x13, 0x2e, 0x48, 0x04, 0x94, 0x9c, 0x2f,
-    0x5d, 0x88, 0x58, 0x37, 0x41, 0x02, 0x01, 0x3f, 0x69, 0x88, 0x4b, 0x59, 0x96, 0x6d, 0x3c, 0x02, 0x02, 0x4d, 0x7e,
-    0xa2, 0x57, 0x54, 0x91, 0xef, 0xab, 0x5e, 0x01, 0xfd, 0xd8, 0x02, 0x53, 0x44, 0x23, 0x30, 0x69, 0x57, 0x3b, 0x01,
-    0x02, 0x28, 0x45, 0x5c, 0x33, 0x2d, 0x53, 0x41, 0x27, 0x00, 0x00, 0x01, 0x00, 0xe7, 0x00, 0x00, 0x04, 0x7c, 0x04,
-    0x8d, 0x00, 0x06, 0x00, 0x06, 0xb3, 0x05, 0x01, 0x01, 0x30, 0x2b, 0x01, 0x01, 0x23, 0x01, 0x21, 0x37, 0x21, 0x04,
-    0x68, 0xfd, 0x47, 0xc8, 0x02, 0xb6, 0xfd, 0x60, 0x1b, 0x03, 0x64, 0x04, 0x19, 0xfb, 0xe7, 0x03, 0xf4, 0x99, 0x00,
-    0x00, 0x00, 0x03, 0x00, 0x96, 0xff, 0xee, 0x04, 0x12, 0x04, 0x9f, 0x00, 0x23, 0x00, 0x37, 0x00, 0x4b, 0x00, 0x0a,
-    0xb7, 0x46, 0x3c, 0x34, 0x2a, 0x1e, 0x0c, 0x03, 0x30, 0x2b, 0x01, 0x0e, 0x03, 0x07, 0x16, 0x16, 0x07, 0x0e, 0x03,
-    0x27, 0x2e, 0x03, 0x37, 0x3e, 0x03, 0x37, 0x26, 0x26, 0x37, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x03, 0x36, 0x2e, 0x02,
-    0x27, 0x26, 0x0e, 0x02, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x13, 0x36, 0x2e, 0x02, 0x23, 0x22, 0x0e,
-    0x02, 0x07, 0x06, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x04, 0x0d, 0x03, 0x27, 0x3d, 0x50, 0x2c, 0x4e, 0x5a, 0x05,
-    0x05, 0x53, 0x80, 0x9d, 0x4e, 0x47, 0x88, 0x69, 0x3c, 0x05, 0x03, 0x2c, 0x46, 0x5a, 0x32, 0x42, 0x49, 0x04, 0x04,
-    0x4b, 0x74, 0x92, 0x4c, 0x44, 0x80, 0x62, 0x36, 0xf8, 0x05, 0x1d, 0x38, 0x4b, 0x28, 0x2e, 0x5a, 0x48, 0x31, 0x06,
-    0x05, 0x1d, 0x37, 0x4a, 0x29, 0x2e, 0x59, 0x4a, 0x31, 0x45, 0x04, 0x19, 0x31, 0x42, 0x24, 0x29, 0x4e, 0x3f, 0x29,
-    0x05, 0x04, 0x18, 0x2e, 0x41, 0x25, 0x29, 0x4f, 0x40, 0x2b, 0x03, 0x63, 0x34, 0x53, 0x43, 0x33, 0x14, 0x29, 0x89,
-    0x5b, 0x57, 0x81, 0x56, 0x29, 0x02, 0x01, 0x2a, 0x51, 0x77, 0x50, 0x3a, 0x5c, 0x48, 0x37, 0x14, 0x29, 0x7d, 0x4f,
-    0x52, 0x7d, 0x55, 0x2a, 0x02, 0x02, 0x29, 0x50, 0x74, 0xfd, 0xa0, 0x2d, 0x45, 0x30, 0x1a, 0x01, 0x01, 0x1c, 0x35,
-    0x4d, 0x30, 0x2d, 0x44, 0x2e, 0x18, 0x01, 0x01, 0x1a, 0x33, 0x4b, 0x02, 0x3e, 0x27, 0x3f, 0x2c, 0x19, 0x1a, 0x31,
-    0x45, 0x2b, 0x27, 0x3f, 0x2c, 0x19, 0x1a, 0x31, 0x45, 0x00, 0x02, 0x00, 0xcd, 0xff, 0xf9, 0x03, 0xfb, 0x04, 0x9f,
-    0x00, 0x1f, 0x00, 0x32, 0x00, 0x08, 0xb5, 0x2a, 0x21, 0x1d, 0x11, 0x02, 0x30, 0x2b, 0x25, 0x32, 0x3e, 0x02, 0x37,
-    0x06, 0x06, 0x27, 0x2e, 0x03, 0x37, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x07, 0x0e, 0x03, 0x07, 0x23, 0x37, 0x01,
-    0x16, 0x36, 0x37, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x06, 0x1e, 0x02, 0x01, 0x25, 0x5c, 0x9f,
-    0x81, 0x62, 0x1e, 0x39, 0x8b, 0x4f, 0x50, 0x7a, 0x52, 0x25, 0x06, 0x07, 0x4c, 0x7a, 0xa0, 0x5a, 0x62, 0x8b, 0x54,
-    0x20, 0x09, 0x09, 0x14, 0x76, 0xb8, 0xf6, 0x94, 0x16, 0x10, 0x01, 0x1f, 0x52, 0x85, 0x2b, 0x09, 0x05, 0x0c, 0x29,
-    0x49, 0x39, 0x36, 0x5c, 0x46, 0x2b, 0x06, 0x05, 0x11, 0x2c, 0x47, 0x91, 0x2b, 0x58, 0x83, 0x57, 0x36, 0x3b, 0x02,
-    0x01, 0x3f, 0x69, 0x8a, 0x4b, 0x59, 0x9a, 0x70, 0x3f, 0x02, 0x02, 0x53, 0x84, 0xa9, 0x58, 0x45, 0x91, 0xed, 0xa9,
-    0x5d, 0x01, 0x98, 0x01, 0x7f, 0x02, 0x54, 0x42, 0x3f, 0x2f, 0x65, 0x54, 0x37, 0x02, 0x01, 0x2a, 0x49, 0x5f, 0x33,
-    0x2c, 0x55, 0x43, 0x2b, 0x00, 0x00, 0x00, 0x02, 0x01, 0x05, 0xff, 0xf2, 0x03, 0x5c, 0x03, 0x23, 0x00, 0x15, 0x00,
-    0x2b, 0x00, 0x08, 0xb5, 0x27, 0x1c, 0x0f, 0x04, 0x02, 0x30, 0x2b, 0x01, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x37,
-    0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x27, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x07, 0x06, 0x1e, 0x02,
-    0x17, 0x16, 0x3e, 0x02, 0x37, 0x03, 0x48, 0x08, 0x2f, 0x50, 0x73, 0x4c, 0x49, 0x63, 0x3c, 0x15, 0x05, 0x0f, 0x08,
-    0x2f, 0x51, 0x73, 0x4c, 0x48, 0x64, 0x3a, 0x16, 0x06, 0x99, 0x03, 0x02, 0x13, 0x2c, 0x27, 0x29, 0x3a, 0x26, 0x15,
-    0x04, 0x14, 0x03, 0x02, 0x15, 0x2c, 0x28, 0x29, 0x39, 0x25, 0x14, 0x05, 0x01, 0x45, 0x45, 0x7c, 0x5d, 0x35, 0x02,
-    0x02, 0x39, 0x5c, 0x78, 0x42, 0x8a, 0x45, 0x7d, 0x5d, 0x35, 0x02, 0x02, 0x3a, 0x5d, 0x78, 0x41, 0x11, 0x1e, 0x43,
-    0x38, 0x26, 0x01, 0x01, 0x22, 0x38, 0x46, 0x22, 0xa9, 0x1f, 0x44, 0x39, 0x26, 0x01, 0x01, 0x23, 0x39, 0x46, 0x22,
-    0x00, 0x00, 0x00, 0x01, 0x01, 0x46, 0x00, 0x00, 0x02, 0xd6, 0x03, 0x15, 0x00, 0x06, 0x00, 0x06, 0xb3, 0x05, 0x00,
-    0x01, 0x30, 0x2b, 0x21, 0x23, 0x13, 0x07, 0x37, 0x25, 0x33, 0x02, 0x52, 0x99, 0x68, 0xdb, 0x17, 0x01, 0x63, 0x16,
-    0x02, 0x55, 0x38, 0x87, 0x71, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0xcd, 0x04, 0xdf, 0x04, 0x14, 0x06, 0x8a, 0x00,
-    0x11, 0x00, 0x15, 0x00, 0x08, 0xb5, 0x15, 0x12, 0x0a, 0x04, 0x02, 0x30, 0x2b, 0x01, 0x0e, 0x03, 0x23, 0x2e, 0x03,
-    0x27, 0x17, 0x06, 0x16, 0x17, 0x16, 0x36, 0x37, 0x27, 0x17, 0x07, 0x07, 0x04, 0x14, 0x06, 0x3a, 0x55, 0x69, 0x34,
-    0x33, 0x62, 0x4e, 0x31, 0x01, 0x92, 0x02, 0x44, 0x3c, 0x3d, 0x56, 0x10, 0x38, 0xa3, 0xc3, 0x71, 0x05, 0xb1, 0x3a,
-    0x51, 0x31, 0x16, 0x01, 0x17, 0x32, 0x50, 0x39, 0x02, 0x3c, 0x37, 0x01, 0x01, 0x39, 0x3b, 0xdb, 0x01, 0xc4, 0x01,
-    0x00, 0x00, 0x01, 0x00, 0xed, 0xff, 0xf4, 0x03, 0x67, 0x03, 0x22, 0x00, 0x3a, 0x00, 0x06, 0xb3, 0x25, 0x13, 0x01,
-    0x30, 0x2b, 0x01, 0x17, 0x3e, 0x03, 0x37, 0x36, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x07, 0x23, 0x3e, 0x03, 0x17, 0x32,
-    0x1e, 0x02, 0x07, 0x0e, 0x03, 0x07, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x35, 0x33, 0x14, 0x16, 0x17,
-    0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x01, 0xd6, 0x50, 0x1b, 0x38, 0x2e, 0x20, 0x04, 0x03, 0x0f,
-    0x1e, 0x29, 0x17, 0x32, 0x4c, 0x10, 0x9c, 0x06, 0x36, 0x51, 0x64, 0x36, 0x31, 0x61, 0x4b, 0x2c, 0x03, 0x02, 0x1c,
-    0x2c, 0x37, 0x1e, 0x3a, 0x3b, 0x02, 0x02, 0x3b, 0x5b, 0x70, 0x37, 0x36, 0x62, 0x49, 0x2b, 0x98, 0x46, 0x35, 0x1c,
-    0x36, 0x2d, 0x1f, 0x04, 0x04, 0x13, 0x25, 0x31, 0x1b, 0x57, 0x01, 0xcb, 0x01, 0x01, 0x0e, 0x1c, 0x2b, 0x1f, 0x19,
-    0x25, 0x18, 0x0c, 0x2d, 0x30, 0x39, 0x53, 0x37, 0x1b, 0x01, 0x1a, 0x35, 0x52, 0x39, 0x24, 0x38, 0x2c, 0x23, 0x0d,
-    0x15, 0x58, 0x3e, 0x3f, 0x5b, 0x3b, 0x1b, 0x01, 0x01, 0x1e, 0x3a, 0x57, 0x3a, 0x37, 0x31, 0x01, 0x0e, 0x1d, 0x2c,
-    0x1e, 0x1f, 0x29, 0x18, 0x0a, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xd6, 0x00, 0x00, 0x03, 0x59, 0x03,
-    0x15, 0x00, 0x0a, 0x00, 0x0e, 0x00, 0x27, 0x40, 0x24, 0x0d, 0x01, 0x00, 0x04, 0x01, 0x4a, 0x00, 0x04, 0x00, 0x04,
-    0x72, 0x05, 0x01, 0x00, 0x03, 0x01, 0x01, 0x02, 0x00, 0x01, 0x62, 0x00, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x11, 0x12,
-    0x11, 0x11, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x01, 0x33, 0x07, 0x23, 0x07, 0x23, 0x37, 0x21, 0x37, 0x01, 0x33,
-    0x01, 0x33, 0x13, 0x07, 0x02, 0xf1, 0x68, 0x17, 0x67, 0x1e, 0x9a, 0x1e, 0xfe, 0x95, 0x0d, 0x01, 0xbf, 0xa4, 0xfe,
-    0x41, 0xd0, 0x39, 0x16, 0x01, 0x2b, 0x82, 0xa9, 0xa9, 0x6f, 0x01, 0xfd, 0xfe, 0x16, 0x01, 0x23, 0x1e, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0xf4, 0xff, 0xf3, 0x03, 0x6d, 0x03, 0x15, 0x00, 0x24, 0x00, 0x06, 0xb3, 0x11, 0x01, 0x01, 0x30,
-    0x2b, 0x01, 0x13, 0x21, 0x07, 0x21, 0x07, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03,
-    0x27, 0x17, 0x16, 0x16, 0x33, 0x36, 0x36, 0x37, 0x36, 0x26, 0x23, 0x26, 0x06, 0x07, 0x01, 0x24, 0x76, 0x01, 0xd3,
-    0x18, 0xfe, 0xb0, 0x3b, 0x1f, 0x41, 0x22, 0x38, 0x59, 0x3c, 0x1f, 0x03, 0x03, 0x32, 0x54, 0x6e, 0x3f, 0x35, 0x5e,
-    0x48, 0x2d, 0x03, 0x94, 0x05, 0x3e, 0x36, 0x42, 0x54, 0x08, 0x06, 0x41, 0x3c, 0x25, 0x3f, 0x1f, 0x01, 0x86, 0x01,
-    0x8f, 0x84, 0xab, 0x0d, 0x0e, 0x24, 0x41, 0x5b, 0x37, 0x41, 0x67, 0x49, 0x26, 0x01, 0x01, 0x1f, 0x3b, 0x54, 0x37,
-    0x01, 0x35, 0x2f, 0x01, 0x54, 0x41, 0x3c, 0x47, 0x01, 0x17, 0x13, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xfe, 0xff,
-    0xf3, 0x03, 0x3d, 0x03, 0x20, 0x00, 0x1d, 0x00, 0x2e, 0x00, 0x08, 0xb5, 0x26, 0x1e, 0x1c, 0x11, 0x02, 0x30, 0x2b,
-    0x01, 0x07, 0x23, 0x26, 0x06, 0x07, 0x36, 0x36, 0x17, 0x32, 0x1e, 0x02, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37,
-    0x37, 0x3e, 0x03, 0x33, 0x03, 0x22, 0x06, 0x07, 0x07, 0x06, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x26,
-    0x03, 0x14, 0x0d, 0x08, 0x7d, 0xac, 0x2e, 0x27, 0x5b, 0x36, 0x37, 0x54, 0x37, 0x1b, 0x03, 0x03, 0x33, 0x53, 0x6e,
-    0x3d, 0x44, 0x65, 0x41, 0x1e, 0x05, 0x05, 0x0a, 0x50, 0x81, 0xae, 0x69, 0xc7, 0x30, 0x4e, 0x1d, 0x04, 0x03, 0x09,
-    0x1a, 0x2e, 0x24, 0x1f, 0x37, 0x29, 0x1a, 0x03, 0x07, 0x3b, 0x03, 0x1f, 0x83, 0x02, 0x6c, 0x74, 0x23, 0x2a, 0x01,
-    0x29, 0x45, 0x5d, 0x34, 0x3f, 0x67, 0x4a, 0x28, 0x01, 0x01, 0x31, 0x54, 0x70, 0x40, 0x39, 0x69, 0xa5, 0x72, 0x3d,
-    0xfe, 0x6e, 0x2c, 0x24, 0x21, 0x1e, 0x3c, 0x30, 0x1d, 0x17, 0x29, 0x36, 0x1e, 0x39, 0x4a, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x1d, 0x00, 0x00, 0x03, 0xa1, 0x03, 0x15, 0x00, 0x06, 0x00, 0x06, 0xb3, 0x05, 0x01, 0x01, 0x30, 0x2b,
-    0x01, 0x01, 0x23, 0x01, 0x21, 0x37, 0x21, 0x03, 0x90, 0xfe, 0x3a, 0xad, 0x01, 0xc6, 0xfe, 0x4d, 0x18, 0x02, 0x59,
-    0x02, 0xb1, 0xfd, 0x4f, 0x02, 0x93, 0x82, 0x00, 0x00, 0x00, 0x03, 0x00, 0xf3, 0xff, 0xf3, 0x03, 0x5c, 0x03, 0x22,
-    0x00, 0x23, 0x00, 0x37, 0x00, 0x49, 0x00, 0x5a, 0xb6, 0x17, 0x05, 0x02, 0x02, 0x05, 0x01, 0x4a, 0x4b, 0xb0, 0x0a,
-    0x50, 0x58, 0x40, 0x1b, 0x00, 0x01, 0x00, 0x04, 0x05, 0x01, 0x04, 0x63, 0x00, 0x05, 0x00, 0x02, 0x03, 0x05, 0x02,
-    0x63, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x1b, 0x40, 0x1b, 0x00, 0x01, 0x00, 0x04,
-    0x05, 0x01, 0x04, 0x63, 0x00, 0x05, 0x00, 0x02, 0x03, 0x05, 0x02, 0x63, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00,
-    0x00, 0x45, 0x00, 0x4c, 0x59, 0x40, 0x0e, 0x46, 0x44, 0x3c, 0x3a, 0x34, 0x32, 0x2a, 0x28, 0x20, 0x1e, 0x2c, 0x06,
-    0x08, 0x15, 0x2b, 0x01, 0x0e, 0x03, 0x07, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x3e, 0x03, 0x37,
-    0x26, 0x26, 0x37, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x03, 0x36, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x06, 0x1e,
-    0x02, 0x33, 0x32, 0x3e, 0x02, 0x13, 0x36, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x06, 0x1e, 0x02, 0x33, 0x32, 0x3e,
-    0x02, 0x03, 0x59, 0x02, 0x18, 0x27, 0x32, 0x1c, 0x33, 0x37, 0x02, 0x02, 0x37, 0x57, 0x6c, 0x37, 0x32, 0x61, 0x4c,
-    0x2d, 0x03, 0x01, 0x1c, 0x2c, 0x3a, 0x21, 0x2c, 0x2d, 0x02, 0x01, 0x33, 0x50, 0x66, 0x35, 0x30, 0x5b, 0x47, 0x28,
-    0xc1, 0x03, 0x11, 0x21, 0x2c, 0x18, 0x1b, 0x34, 0x2b, 0x1d, 0x04, 0x03, 0x11, 0x21, 0x2c, 0x18, 0x1b, 0x34, 0x2b,
-    0x1d, 0x2b, 0x05, 0x3a, 0x2c, 0x18, 0x2d, 0x25, 0x18, 0x03, 0x03, 0x0d, 0x1b, 0x26, 0x16, 0x18, 0x2d, 0x24, 0x19,
-    0x02, 0x4b, 0x22, 0x38, 0x2d, 0x24, 0x0f, 0x1b, 0x5c, 0x3a, 0x3e, 0x59, 0x3a, 0x1c, 0x01, 0x01, 0x19, 0x36, 0x52,
-    0x3a, 0x26, 0x3e, 0x31, 0x27, 0x0f, 0x1a, 0x53, 0x33, 0x3a, 0x58, 0x39, 0x1c, 0x01, 0x01, 0x1a, 0x35, 0x50, 0xfe,
-    0x69, 0x1b, 0x27, 0x19, 0x0d, 0x0e, 0x1e, 0x2c, 0x1c, 0x1b, 0x28, 0x19, 0x0d, 0x0f, 0x1e, 0x2b, 0x01, 0x73, 0x2e,
-    0x31, 0x0e, 0x1c, 0x28, 0x19, 0x17, 0x24, 0x18, 0x0d, 0x0f, 0x1c, 0x28, 0x00, 0x00, 0x02, 0x01, 0x26, 0xff, 0xf7,
-    0x03, 0x5c, 0x03, 0x22, 0x00, 0x1d, 0x00, 0x2e, 0x00, 0x08, 0xb5, 0x26, 0x1f, 0x1a, 0x0f, 0x02, 0x30, 0x2b, 0x25,
-    0x16, 0x36, 0x37, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x07, 0x0e, 0x03,
-    0x23, 0x27, 0x37, 0x37, 0x16, 0x36, 0x37, 0x37, 0x36, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x06, 0x16, 0x01,
-    0x6c, 0x75, 0xa3, 0x2b, 0x25, 0x52, 0x30, 0x38, 0x56, 0x39, 0x1b, 0x03, 0x03, 0x33, 0x54, 0x6e, 0x3f, 0x46, 0x62,
-    0x3c, 0x18, 0x04, 0x05, 0x0b, 0x4c, 0x7e, 0xac, 0x69, 0x13, 0x0c, 0xca, 0x2c, 0x47, 0x1b, 0x09, 0x03, 0x06, 0x18,
-    0x2b, 0x22, 0x21, 0x36, 0x28, 0x19, 0x03, 0x05, 0x35, 0x77, 0x02, 0x5d, 0x6e, 0x1e, 0x22, 0x27, 0x45, 0x5d, 0x36,
-    0x3f, 0x6a, 0x4e, 0x2c, 0x01, 0x01, 0x35, 0x58, 0x73, 0x3f, 0x35, 0x6a, 0xa2, 0x6f, 0x3a, 0x01, 0x7f, 0xff, 0x01,
-    0x29, 0x20, 0x3e, 0x1c, 0x3a, 0x2e, 0x1d, 0x1a, 0x2c, 0x3a, 0x1e, 0x38, 0x4f, 0x00, 0x01, 0x01, 0x34, 0x02, 0x8b,
-    0x03, 0xba, 0x03, 0x22, 0x00, 0x03, 0x00, 0x06, 0xb3, 0x02, 0x00, 0x01, 0x30, 0x2b, 0x01, 0x21, 0x37, 0x21, 0x03,
-    0x9f, 0xfd, 0x95, 0x1b, 0x02, 0x6b, 0x02, 0x8b, 0x97, 0x00, 0x00, 0x00, 0x03, 0x02, 0x34, 0x04, 0x3f, 0x04, 0x4c,
-    0x06, 0x71, 0x00, 0x03, 0x00, 0x17, 0x00, 0x29, 0x00, 0x0a, 0xb7, 0x24, 0x1a, 0x12, 0x08, 0x02, 0x00, 0x03, 0x30,
-    0x2b, 0x01, 0x33, 0x07, 0x23, 0x07, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22,
-    0x2e, 0x02, 0x37, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x03, 0x7a,
-    0xd2, 0xf6, 0x89, 0x99, 0x1c, 0x2f, 0x3e, 0x24, 0x22, 0x3a, 0x2a, 0x17, 0x1b, 0x2d, 0x3d, 0x23, 0x21, 0x3b, 0x2c,
-    0x1a, 0x53, 0x02, 0x1c, 0x25, 0x12, 0x21, 0x1a, 0x12, 0x03, 0x03, 0x07, 0x11, 0x1b, 0x10, 0x15, 0x20, 0x18, 0x12,
-    0x06, 0x71, 0xb6, 0xdf, 0x24, 0x3f, 0x30, 0x1c, 0x19, 0x2c, 0x3c, 0x21, 0x23, 0x3d, 0x2f, 0x1b, 0x17, 0x2a, 0x3a,
-    0x24, 0x1f, 0x31, 0x0f, 0x19, 0x21, 0x11, 0x0f, 0x1e, 0x18, 0x0e, 0x10, 0x1a, 0x22, 0x00, 0x02, 0x02, 0x45, 0x04,
-    0x82, 0x04, 0x30, 0x05, 0xc4, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x08, 0xb5, 0x0e, 0x09, 0x04, 0x01, 0x02, 0x30, 0x2b,
-    0x01, 0x13, 0x33, 0x07, 0x03, 0x23, 0x27, 0x36, 0x36, 0x37, 0x17, 0x06, 0x06, 0x07, 0x07, 0x23, 0x03, 0x01, 0x8c,
-    0xa3, 0x02, 0xe1, 0x4f, 0xa5, 0x0d, 0x44, 0x30, 0x4d, 0x1d, 0x2a, 0x0b, 0x17, 0x79, 0x04, 0x9e, 0x01, 0x26, 0x16,
-    0xfe, 0xd6, 0x89, 0x3a, 0x5c, 0x20, 0x03, 0x2b, 0x5a, 0x33, 0x86, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0xfd, 0x04,
-    0xd8, 0x04, 0x5c, 0x06, 0xcf, 0x00, 0x11, 0x00, 0x2f, 0x00, 0x08, 0xb5, 0x2f, 0x21, 0x0a, 0x04, 0x02, 0x30, 0x2b,
-    0x01, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x35, 0x17, 0x06, 0x16, 0x17, 0x16, 0x36, 0x37, 0x13, 0x0e, 0x03, 0x23, 0x22,
-    0x2e, 0x02, 0x07, 0x0e, 0x03, 0x07, 0x27, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x37, 0x36, 0x36, 0x37, 0x04, 0x35,
-    0x06, 0x37, 0x53, 0x67, 0x35, 0x33, 0x60, 0x4b, 0x2e, 0x90, 0x02, 0x3e, 0x3c, 0x3d, 0x54, 0x10, 0xb6, 0x05, 0x19,
-    0x2b, 0x3c, 0x27, 0x1e, 0x34, 0x31, 0x32, 0x1d, 0x14, 0x1f, 0x18, 0x12, 0x06, 0x53, 0x05, 0x1b, 0x2c, 0x3e, 0x27,
-    0x1e, 0x33, 0x31, 0x33, 0x1e, 0x28, 0x2e, 0x0e, 0x05, 0xaf, 0x3a, 0x52, 0x33, 0x18, 0x01, 0x01, 0x19, 0x34, 0x51,
-    0x38, 0x02, 0x3b, 0x3a, 0x01, 0x01, 0x3c, 0x3a, 0x01, 0x0c, 0x23, 0x41, 0x33, 0x1f, 0x19, 0x1e, 0x18, 0x01, 0x01,
-    0x0f, 0x18, 0x1f, 0x11, 0x14, 0x23, 0x42, 0x33, 0x1f, 0x1a, 0x1e, 0x18, 0x02, 0x02, 0x34, 0x23, 0x00, 0x00, 0x00,
-    0x01, 0x01, 0x50, 0xfe, 0x99, 0x02, 0x5e, 0x00, 0x9a, 0x00, 0x03, 0x00, 0x18, 0x40, 0x15, 0x00, 0x01, 0x00, 0x00,
-    0x01, 0x55, 0x00, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x01, 0x00, 0x4d, 0x11, 0x10, 0x02, 0x06, 0x16, 0x2b, 0x01,
-    0x23, 0x13, 0x33, 0x02, 0x04, 0xb4, 0x59, 0xb5, 0xfe, 0x99, 0x02, 0x01, 0x00, 0x00, 0x01, 0x00, 0xbc, 0xfe, 0x61,
-    0x02, 0x73, 0x00, 0x41, 0x00, 0x19, 0x00, 0x06, 0xb3, 0x0b, 0x00, 0x01, 0x30, 0x2b, 0x25, 0x1e, 0x03, 0x07, 0x0e,
-    0x03, 0x23, 0x06, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x36, 0x36, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x01, 0xc9, 0x23,
-    0x3e, 0x2f, 0x1a, 0x02, 0x03, 0x27, 0x41, 0x55, 0x30, 0x35, 0x60, 0x30, 0x28, 0x1b, 0x38, 0x1e, 0x31, 0x4c, 0x08,
-    0x04, 0x0f, 0x1e, 0x27, 0x13, 0x41, 0x15, 0x36, 0x42, 0x4d, 0x2b, 0x32, 0x50, 0x39, 0x1f, 0x01, 0x19, 0x15, 0x7b,
-    0x0c, 0x10, 0x01, 0x2f, 0x33, 0x1b, 0x32, 0x2d, 0x26, 0x0f, 0x00, 0x01, 0x00, 0xad, 0xfe, 0x47, 0x02, 0xad, 0x00,
-    0x97, 0x00, 0x13, 0x00, 0x29, 0x40, 0x26, 0x0a, 0x01, 0x01, 0x02, 0x09, 0x01, 0x00, 0x01, 0x02, 0x4a, 0x03, 0x01,
-    0x02, 0x01, 0x02, 0x72, 0x00, 0x01, 0x01, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x21, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x13,
-    0x00, 0x13, 0x25, 0x25, 0x04, 0x06, 0x16, 0x2b, 0x25, 0x07, 0x0e, 0x03, 0x23, 0x26, 0x26, 0x27, 0x37, 0x16, 0x16,
-    0x33, 0x32, 0x3e, 0x02, 0x37, 0x37, 0x02, 0xad, 0x24, 0x0a, 0x36, 0x5a, 0x7e, 0x51, 0x1e, 0x38, 0x1d, 0x1b, 0x17,
-    0x30, 0x18, 0x29, 0x3b, 0x29, 0x18, 0x06, 0x27, 0x97, 0xef, 0x4c, 0x81, 0x5f, 0x35, 0x01, 0x0a, 0x08, 0x9f, 0x07,
-    0x09, 0x21, 0x36, 0x44, 0x23, 0xf0, 0x00, 0x00, 0x00, 0x03, 0xff, 0xe8, 0xfe, 0x49, 0x04, 0x91, 0x04, 0x51, 0x00,
-    0x42, 0x00, 0x5a, 0x00, 0x70, 0x00, 0x0a, 0xb7, 0x6c, 0x61, 0x4d, 0x46, 0x3d, 0x21, 0x03, 0x30, 0x2b, 0x01, 0x07,
-    0x16, 0x16, 0x07, 0x07, 0x0e, 0x03, 0x27, 0x22, 0x26, 0x27, 0x06, 0x06, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x17, 0x1e,
-    0x03, 0x07, 0x0e, 0x05, 0x27, 0x2e, 0x05, 0x37, 0x3e, 0x03, 0x37, 0x26, 0x37, 0x3e, 0x03, 0x37, 0x26, 0x26, 0x37,
-    0x37, 0x3e, 0x03, 0x17, 0x32, 0x16, 0x17, 0x21, 0x01, 0x26, 0x26, 0x27, 0x06, 0x06, 0x07, 0x06, 0x1e, 0x02, 0x33,
-    0x32, 0x3e, 0x04, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x03, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x37, 0x36,
-    0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x04, 0x78, 0x8f, 0x11, 0x0b, 0x05, 0x02, 0x0b, 0x56, 0x80, 0x9e, 0x52,
-    0x26, 0x4a, 0x25, 0x1a, 0x2a, 0x05, 0x03, 0x0f, 0x1c, 0x24, 0x12, 0xa6, 0x45, 0x86, 0x68, 0x3c, 0x05, 0x04, 0x3a,
-    0x5c, 0x74, 0x7c, 0x79, 0x33, 0x27, 0x5e, 0x5d, 0x57, 0x41, 0x25, 0x03, 0x03, 0x24, 0x3a, 0x4b, 0x2a, 0x27, 0x06,
-    0x03, 0x1a, 0x28, 0x33, 0x1d, 0x41, 0x3c, 0x05, 0x02, 0x09, 0x54, 0x80, 0xa0, 0x53, 0x26, 0x47, 0x26, 0x01, 0x6f,
-    0xfc, 0xf6, 0x14, 0x26, 0x14, 0x39, 0x52, 0x09, 0x06, 0x2c, 0x49, 0x57, 0x23, 0x1f, 0x4c, 0x50, 0x4d, 0x40, 0x2b,
-    0x06, 0x07, 0x1e, 0x37, 0x47, 0x22, 0xdd, 0x03, 0x1d, 0x37, 0x4b, 0x2a, 0x2f, 0x5b, 0x4a, 0x33, 0x08, 0x03, 0x04,
-    0x1c, 0x36, 0x4d, 0x2d, 0x30, 0x5c, 0x49, 0x32, 0x07, 0x03, 0xa7, 0x01, 0x2f, 0x5c, 0x32, 0x17, 0x56, 0x87, 0x5d,
-    0x30, 0x01, 0x0c, 0x0b, 0x17, 0x36, 0x24, 0x17, 0x1c, 0x10, 0x06, 0x01, 0x02, 0x02, 0x1c, 0x41, 0x6d, 0x51, 0x3f,
-    0x66, 0x4e, 0x37, 0x23, 0x10, 0x01, 0x01, 0x0b, 0x18, 0x28, 0x3c, 0x50, 0x34, 0x32, 0x53, 0x43, 0x37, 0x15, 0x2e,
-    0x3f, 0x25, 0x3f, 0x35, 0x2e, 0x14, 0x36, 0x91, 0x55, 0x17, 0x58, 0x88, 0x5d, 0x2f, 0x01, 0x11, 0x05, 0xfb, 0xf2,
-    0x01, 0x03, 0x03, 0x1b, 0x5b, 0x41, 0x30, 0x3c, 0x23, 0x0d, 0x08, 0x12, 0x1e, 0x2d, 0x3b, 0x26, 0x2b, 0x34, 0x1c,
-    0x0a, 0x01, 0x02, 0x9d, 0x2c, 0x49, 0x34, 0x1d, 0x01, 0x01, 0x1d, 0x38, 0x4e, 0x30, 0x15, 0x2e, 0x4b, 0x35, 0x1e,
-    0x01, 0x01, 0x1e, 0x39, 0x50, 0x31, 0x00, 0x01, 0x00, 0xb8, 0xfe, 0xdd, 0x03, 0x8f, 0x03, 0x41, 0x00, 0x17, 0x00,
-    0x06, 0xb3, 0x0b, 0x00, 0x01, 0x30, 0x2b, 0x13, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x37, 0x3e, 0x03, 0x37,
-    0x36, 0x2e, 0x02, 0x27, 0x27, 0xd5, 0xc4, 0x80, 0xc2, 0x7e, 0x36, 0x0d, 0x0d, 0x50, 0x88, 0xc1, 0x7e, 0x0f, 0x58,
-    0x7d, 0x54, 0x2e, 0x09, 0x0a, 0x19, 0x4c, 0x81, 0x5d, 0xdc, 0x03, 0x41, 0x01, 0x03, 0x54, 0x95, 0xcf, 0x7e, 0x78,
-    0xc9, 0x93, 0x53, 0x03, 0x93, 0x02, 0x44, 0x71, 0x91, 0x4f, 0x57, 0x94, 0x6c, 0x3e, 0x02, 0x01, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0xfc, 0x00, 0x00, 0x03, 0x6f, 0x05, 0xc5, 0x00, 0x05, 0x00, 0x13, 0x00, 0x08, 0xb5, 0x12, 0x0a, 0x02,
-    0x00, 0x02, 0x30, 0x2b, 0x01, 0x21, 0x03, 0x23, 0x13, 0x21, 0x01, 0x36, 0x36, 0x37, 0x36, 0x1e, 0x02, 0x15, 0x14,
-    0x06, 0x07, 0x06, 0x26, 0x01, 0x18, 0x02, 0x1a, 0xbc, 0xb5, 0xa0, 0xfe, 0x9b, 0x01, 0x9b, 0x01, 0x3c, 0x30, 0x18,
-    0x27, 0x1d, 0x0f, 0x3c, 0x30, 0x2f, 0x3d, 0x04, 0x3a, 0xfb, 0xc6, 0x03, 0x99, 0x01, 0xba, 0x30, 0x3f, 0x02, 0x01,
-    0x10, 0x1c, 0x28, 0x18, 0x30, 0x3b, 0x02, 0x02, 0x39, 0x00, 0x00, 0x00, 0x01, 0x01, 0x6a, 0xff, 0xeb, 0x03, 0x82,
-    0x06, 0x18, 0x00, 0x13, 0x00, 0x06, 0xb3, 0x0c, 0x00, 0x01, 0x30, 0x2b, 0x01, 0x03, 0x06, 0x1e, 0x02, 0x33, 0x16,
-    0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x2e, 0x03, 0x37, 0x13, 0x02, 0xee, 0xc8, 0x06, 0x01, 0x1d, 0x40, 0x39, 0x34,
-    0x61, 0x30, 0x06, 0x3f, 0x86, 0x46, 0x5e, 0x6f, 0x38, 0x08, 0x09, 0xc7, 0x06, 0x18, 0xfb, 0x60, 0x31, 0x55, 0x40,
-    0x26, 0x01, 0x1f, 0x11, 0x93, 0x1d, 0x20, 0x02, 0x01, 0x44, 0x6f, 0x93, 0x51, 0x04, 0x93, 0xff, 0xff, 0x01, 0x1a,
-    0x00, 0x00, 0x03, 0x7f, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x13, 0x00, 0x00, 0xff, 0xff, 0x00, 0xa4, 0x00, 0x00, 0x04,
-    0x93, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x19, 0xe5, 0x00, 0x00, 0x02, 0x00, 0x5d, 0x00, 0x00, 0x04, 0x52, 0x04, 0x8d,
-    0x00, 0x0e, 0x00, 0x1b, 0x00, 0x2f, 0x40, 0x2c, 0x09, 0x01, 0x03, 0x04, 0x01, 0x4a, 0x00, 0x01, 0x00, 0x04, 0x03,
-    0x01, 0x04, 0x63, 0x00, 0x03, 0x05, 0x01, 0x02, 0x00, 0x03, 0x02, 0x63, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x00,
-    0x00, 0x1b, 0x19, 0x11, 0x0f, 0x00, 0x0e, 0x00, 0x0d, 0x21, 0x11, 0x06, 0x08, 0x16, 0x2b, 0x01, 0x03, 0x23, 0x13,
-    0x05, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x23, 0x27, 0x05, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x25, 0x01,
-    0x5d, 0x4c, 0xb4, 0xcb, 0x01, 0xb0, 0x4e, 0x8c, 0x67, 0x39, 0x06, 0x06, 0x55, 0x84, 0xa5, 0x56, 0xfb, 0x01, 0x01,
-    0x33, 0x62, 0x50, 0x35, 0x06, 0x06, 0x1a, 0x36, 0x4c, 0x2d, 0xfe, 0xec, 0x01, 0xb6, 0xfe, 0x4a, 0x04, 0x8d, 0x01,
-    0x03, 0x31, 0x5b, 0x83, 0x54, 0x5f, 0x8b, 0x5b, 0x2c, 0x99, 0x02, 0x1a, 0x35, 0x51, 0x38, 0x2f, 0x4b, 0x35, 0x1e,
-    0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xcf, 0xfe, 0x4b, 0x04, 0x85, 0x04, 0x47, 0x00, 0x2b, 0x00, 0x06,
-    0xb3, 0x17, 0x00, 0x01, 0x30, 0x2b, 0x01, 0x1e, 0x03, 0x17, 0x13, 0x01, 0x33, 0x01, 0x13, 0x1e, 0x03, 0x17, 0x16,
-    0x36, 0x37, 0x07, 0x06, 0x06, 0x07, 0x06, 0x2e, 0x02, 0x27, 0x03, 0x01, 0x23, 0x01, 0x03, 0x2e, 0x03, 0x27, 0x26,
-    0x06, 0x07, 0x37, 0x36, 0x36, 0x01, 0x15, 0x3b, 0x59, 0x41, 0x2b, 0x0e, 0x46, 0x01, 0x5a, 0xc2, 0xfe, 0x1c, 0x84,
-    0x06, 0x0f, 0x18, 0x23, 0x1a, 0x0b, 0x18, 0x0b, 0x10, 0x0e, 0x19, 0x0f, 0x3c, 0x54, 0x3a, 0x26, 0x0d, 0x5d, 0xfe,
-    0x7d, 0xcb, 0x02, 0x15, 0x6d, 0x08, 0x13, 0x1f, 0x2f, 0x22, 0x11, 0x23, 0x11, 0x0e, 0x17, 0x31, 0x04, 0x47, 0x01,
-    0x2d, 0x4b, 0x5f, 0x33, 0xfe, 0xff, 0x01, 0xff, 0xfd, 0x2f, 0xfe, 0x22, 0x15, 0x31, 0x2c, 0x1f, 0x02, 0x02, 0x03,
-    0x02, 0xa0, 0x05, 0x08, 0x01, 0x02, 0x30, 0x4f, 0x62, 0x30, 0x01, 0x47, 0xfd, 0xbe, 0x03, 0x14, 0x01, 0x7f, 0x1b,
-    0x3e, 0x35, 0x24, 0x02, 0x01, 0x03, 0x01, 0x95, 0x05, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x36, 0x00, 0x00,
-    0x04, 0x59, 0x05, 0xaf, 0x00, 0x26, 0x00, 0x33, 0x00, 0x08, 0xb5, 0x33, 0x28, 0x03, 0x01, 0x02, 0x30, 0x2b, 0x01,
-    0x03, 0x23, 0x13, 0x05, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x1e, 0x03, 0x07, 0x07, 0x06, 0x06, 0x16, 0x16, 0x17,
-    0x07, 0x23, 0x2e, 0x02, 0x36, 0x37, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x17, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e,
-    0x02, 0x27, 0x27, 0x01, 0x58, 0x6e, 0xb4, 0xfc, 0x01, 0x81, 0x5f, 0x9f, 0x70, 0x38, 0x09, 0x06, 0x2f, 0x4b, 0x61,
-    0x38, 0x33, 0x42, 0x24, 0x09, 0x06, 0x14, 0x04, 0x04, 0x05, 0x11, 0x11, 0x03, 0xb1, 0x12, 0x11, 0x05, 0x05, 0x04,
-    0x14, 0x06, 0x12, 0x30, 0x4f, 0x37, 0xeb, 0xbd, 0x45, 0x7c, 0x61, 0x40, 0x09, 0x07, 0x1b, 0x3d, 0x5d, 0x3c, 0xe3,
-    0x02, 0x79, 0xfd, 0x87, 0x05, 0xaf, 0x01, 0x02, 0x34, 0x64, 0x97, 0x65, 0x40, 0x68, 0x52, 0x40, 0x19, 0x17, 0x48,
-    0x59, 0x66, 0x34, 0x8a, 0x1b, 0x37, 0x35, 0x32, 0x17, 0x19, 0x19, 0x3a, 0x3d, 0x3e, 0x1e, 0x86, 0x34, 0x5d, 0x46,
-    0x2c, 0x03, 0x98, 0x02, 0x1c, 0x3f, 0x67, 0x4a, 0x3d, 0x5e, 0x3f, 0x21, 0x02, 0x01, 0x00, 0x01, 0x00, 0x3b, 0x00,
-    0x00, 0x05, 0x06, 0x05, 0xb0, 0x00, 0x0c, 0x00, 0x27, 0x40, 0x24, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x4a, 0x00, 0x03,
-    0x00, 0x00, 0x01, 0x03, 0x00, 0x62, 0x04, 0x01, 0x02, 0x02, 0x16, 0x4b, 0x05, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4c,
-    0x12, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x06, 0x1a, 0x2b, 0x01, 0x23, 0x03, 0x23, 0x13, 0x33, 0x03, 0x33, 0x01,
-    0x33, 0x01, 0x01, 0x23, 0x02, 0x0e, 0xab, 0x73, 0xb5, 0xfd, 0xb5, 0x71, 0x90, 0x02, 0x1e, 0xdc, 0xfd, 0x9d, 0x01,
-    0x81, 0xd0, 0x02, 0x93, 0xfd, 0x6d, 0x05, 0xb0, 0xfd, 0x7a, 0x02, 0x86, 0xfd, 0x35, 0xfd, 0x1b, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0xac, 0xff, 0xeb, 0x03, 0xe3, 0x05, 0xc4, 0x00, 0x15, 0x00, 0x25, 0x00, 0x08, 0xb5, 0x22, 0x1a,
-    0x0d, 0x00, 0x02, 0x30, 0x2b, 0x13, 0x21, 0x03, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27,
-    0x2e, 0x03, 0x37, 0x13, 0x21, 0x01, 0x36, 0x36, 0x37, 0x36, 0x1e, 0x02, 0x15, 0x06, 0x06, 0x07, 0x06, 0x2e, 0x02,
-    0xc9, 0x02, 0x13, 0x7b, 0x05, 0x0a, 0x22, 0x3f, 0x30, 0x39, 0x6f, 0x36, 0x0e, 0x3f, 0x9b, 0x47, 0x51, 0x70, 0x44,
-    0x19, 0x08, 0x5e, 0xfe, 0xa2, 0x01, 0x96, 0x01, 0x3a, 0x2f, 0x18, 0x27, 0x1d, 0x0f, 0x01, 0x3b, 0x2f, 0x17, 0x27,
-    0x1c, 0x10, 0x04, 0x3a, 0xfd, 0x24, 0x2c, 0x4c, 0x38, 0x21, 0x01, 0x02, 0x15, 0x0c, 0x86, 0x24, 0x16, 0x02, 0x02,
-    0x3c, 0x64, 0x85, 0x4b, 0x02, 0x3a, 0x01, 0xbc, 0x2e, 0x3e, 0x02, 0x01, 0x0f, 0x1d, 0x27, 0x18, 0x2e, 0x3c, 0x02,
-    0x01, 0x0f, 0x1c, 0x27, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x21, 0xff, 0xec, 0x03, 0xec, 0x06, 0x00, 0x00, 0x18,
-    0x00, 0x06, 0xb3, 0x10, 0x02, 0x01, 0x30, 0x2b, 0x01, 0x21, 0x37, 0x03, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x36, 0x37,
-    0x17, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x13, 0x21, 0x01, 0x3d, 0x01, 0x55, 0xbe, 0xe6, 0x06, 0x0a, 0x23, 0x3f,
-    0x30, 0x39, 0x6f, 0x36, 0x0e, 0x20, 0x47, 0x4b, 0x4c, 0x23, 0x50, 0x71, 0x45, 0x19, 0x08, 0xc6, 0xfe, 0xa7, 0x05,
-    0xff, 0x01, 0xfb, 0x5e, 0x2c, 0x4c, 0x38, 0x22, 0x01, 0x02, 0x15, 0x0d, 0x86, 0x12, 0x17, 0x0c, 0x04, 0x01, 0x01,
-    0x3c, 0x65, 0x84, 0x4a, 0x04, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x6b, 0x00, 0x00, 0x03, 0x88, 0x05, 0xb0, 0x00,
-    0x0a, 0x00, 0x06, 0xb3, 0x09, 0x05, 0x01, 0x30, 0x2b, 0x37, 0x21, 0x13, 0x05, 0x37, 0x25, 0x33, 0x03, 0x21, 0x07,
-    0x21, 0x87, 0x01, 0x2d, 0xb8, 0xfe, 0xb2, 0x1f, 0x01, 0xf5, 0x12, 0xdb, 0x01, 0x1f, 0x1d, 0xfd, 0x00, 0xa0, 0x04,
-    0x1f, 0x70, 0xb0, 0xb1, 0xfa, 0xf0, 0xa0, 0x00, 0x02, 0x00, 0x80, 0xff, 0x98, 0x04, 0x50, 0x04, 0xed, 0x00, 0x43,
-    0x00, 0x52, 0x00, 0x08, 0xb5, 0x49, 0x45, 0x38, 0x29, 0x02, 0x30, 0x2b, 0x01, 0x26, 0x26, 0x37, 0x06, 0x06, 0x23,
-    0x22, 0x2e, 0x02, 0x37, 0x3e, 0x03, 0x33, 0x17, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x07, 0x06, 0x14,
-    0x1e, 0x03, 0x33, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x2e, 0x05, 0x37, 0x37, 0x3e, 0x05, 0x17, 0x1e, 0x03,
-    0x07, 0x03, 0x06, 0x06, 0x17, 0x07, 0x25, 0x16, 0x36, 0x37, 0x37, 0x27, 0x0e, 0x03, 0x07, 0x06, 0x1e, 0x02, 0x03,
-    0x72, 0x05, 0x02, 0x02, 0x2b, 0x65, 0x3d, 0x3c, 0x58, 0x3a, 0x1a, 0x03, 0x04, 0x46, 0x6f, 0x8e, 0x4c, 0x64, 0x04,
-    0x17, 0x34, 0x51, 0x37, 0x6c, 0x9e, 0x6c, 0x3d, 0x0c, 0x08, 0x06, 0x12, 0x26, 0x42, 0x60, 0x43, 0x39, 0x6b, 0x30,
-    0x25, 0x37, 0x85, 0x43, 0x5e, 0x8b, 0x63, 0x3d, 0x1f, 0x05, 0x08, 0x04, 0x09, 0x2e, 0x4b, 0x67, 0x83, 0x9e, 0x5d,
-    0x5c, 0x89, 0x55, 0x23, 0x0a, 0x3c, 0x08, 0x01, 0x0c, 0x01, 0xfe, 0xb9, 0x39, 0x5c, 0x1d, 0x2e, 0x40, 0x2f, 0x5b,
-    0x4b, 0x33, 0x06, 0x03, 0x07, 0x19, 0x2e, 0x01, 0x04, 0x17, 0x2a, 0x17, 0x29, 0x34, 0x30, 0x4e, 0x65, 0x37, 0x52,
-    0x7c, 0x53, 0x2a, 0x01, 0x35, 0x59, 0x41, 0x26, 0x02, 0x04, 0x5a, 0x95, 0xba, 0x5c, 0x3d, 0x34, 0x72, 0x6e, 0x63,
-    0x4b, 0x2d, 0x01, 0x1f, 0x1c, 0x86, 0x26, 0x23, 0x01, 0x01, 0x37, 0x5d, 0x7f, 0x91, 0x9d, 0x4e, 0x2e, 0x53, 0xa4,
-    0x95, 0x7e, 0x5b, 0x31, 0x02, 0x02, 0x44, 0x73, 0x99, 0x58, 0xfe, 0x8d, 0x2f, 0x5d, 0x2d, 0x10, 0x80, 0x01, 0x3b,
-    0x2e, 0xf6, 0x01, 0x01, 0x12, 0x2b, 0x47, 0x35, 0x1e, 0x3b, 0x2e, 0x1d, 0x00, 0x02, 0x00, 0x2d, 0xff, 0xea, 0x04,
-    0x9d, 0x05, 0xc7, 0x00, 0x2f, 0x00, 0x3e, 0x00, 0x08, 0xb5, 0x3b, 0x30, 0x19, 0x05, 0x02, 0x30, 0x2b, 0x01, 0x07,
-    0x23, 0x03, 0x06, 0x06, 0x27, 0x2e, 0x03, 0x37, 0x3e, 0x03, 0x37, 0x2e, 0x03, 0x37, 0x3e, 0x03, 0x17, 0x1e, 0x03,
-    0x07, 0x27, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x07, 0x22, 0x0e, 0x02, 0x07,
-    0x06, 0x1e, 0x02, 0x17, 0x16, 0x36, 0x37, 0x13, 0x04, 0x9d, 0x1a, 0xbf, 0x54, 0x5f, 0xe5, 0x7d, 0x59, 0x92, 0x65,
-    0x32, 0x08, 0x06, 0x2e, 0x4d, 0x68, 0x3f, 0x26, 0x37, 0x23, 0x0d, 0x03, 0x07, 0x4d, 0x7c, 0xa3, 0x5e, 0x56, 0x88,
-    0x5d, 0x2d, 0x05, 0xb4, 0x03, 0x11, 0x2c, 0x4a, 0x37, 0x39, 0x5f, 0x47, 0x2d, 0x06, 0x06, 0x11, 0x2d, 0x4b, 0x34,
-    0x08, 0x42, 0x73, 0x57, 0x38, 0x07, 0x07, 0x1d, 0x3f, 0x5e, 0x3b, 0x3f, 0x74, 0x35, 0x52, 0x03, 0x31, 0x97, 0xfd,
-    0xf4, 0x51, 0x53, 0x03, 0x02, 0x3e, 0x6c, 0x96, 0x5a, 0x45, 0x70, 0x59, 0x42, 0x17, 0x19, 0x45, 0x50, 0x57, 0x2d,
-    0x5d, 0x9c, 0x6f, 0x3d, 0x03, 0x02, 0x40, 0x6c, 0x91, 0x54, 0x01, 0x31, 0x59, 0x45, 0x29, 0x02, 0x02, 0x29, 0x49,
-    0x60, 0x36, 0x31, 0x57, 0x42, 0x28, 0x02, 0x96, 0x24, 0x47, 0x68, 0x44, 0x3d, 0x5d, 0x3f, 0x21, 0x01, 0x02, 0x27,
-    0x20, 0x01, 0xcb, 0x00, 0x01, 0x00, 0x22, 0xff, 0xe9, 0x04, 0x63, 0x05, 0xc7, 0x00, 0x33, 0x00, 0x06, 0xb3, 0x16,
-    0x06, 0x01, 0x30, 0x2b, 0x33, 0x23, 0x13, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x17, 0x01, 0x1e, 0x03, 0x07, 0x0e, 0x03,
-    0x27, 0x26, 0x26, 0x27, 0x37, 0x16, 0x16, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x37, 0x01,
-    0x26, 0x26, 0x27, 0x26, 0x0e, 0x02, 0x07, 0xd6, 0xb4, 0xa5, 0x10, 0x49, 0x7b, 0xb2, 0x78, 0x43, 0x73, 0x66, 0x59,
-    0x29, 0xfe, 0x9b, 0x56, 0x7e, 0x4f, 0x22, 0x07, 0x09, 0x53, 0x85, 0xae, 0x64, 0x3f, 0x78, 0x3a, 0x44, 0x2a, 0x59,
-    0x31, 0x3f, 0x6b, 0x51, 0x34, 0x07, 0x07, 0x10, 0x35, 0x5b, 0x42, 0x77, 0x1c, 0x01, 0x43, 0x2a, 0x6e, 0x3f, 0x52,
-    0x71, 0x4b, 0x2a, 0x0a, 0x03, 0xc1, 0x6d, 0xbf, 0x8c, 0x4e, 0x03, 0x02, 0x24, 0x3e, 0x55, 0x32, 0xfe, 0x6f, 0x0b,
-    0x49, 0x70, 0x91, 0x53, 0x65, 0xa3, 0x72, 0x3d, 0x02, 0x01, 0x1b, 0x18, 0x96, 0x1a, 0x1b, 0x01, 0x01, 0x2b, 0x4d,
-    0x69, 0x3d, 0x3f, 0x67, 0x4b, 0x2c, 0x02, 0x01, 0xa0, 0x01, 0x6f, 0x31, 0x31, 0x01, 0x02, 0x3e, 0x68, 0x86, 0x45,
-    0x00, 0x01, 0x00, 0x63, 0xff, 0xe8, 0x04, 0x1a, 0x04, 0xa0, 0x00, 0x33, 0x00, 0x61, 0x40, 0x0c, 0x26, 0x25, 0x10,
-    0x03, 0x01, 0x02, 0x33, 0x01, 0x03, 0x00, 0x02, 0x4a, 0x4b, 0xb0, 0x16, 0x50, 0x58, 0x40, 0x1c, 0x00, 0x01, 0x02,
-    0x00, 0x02, 0x01, 0x00, 0x70, 0x00, 0x04, 0x00, 0x02, 0x01, 0x04, 0x02, 0x63, 0x00, 0x00, 0x00, 0x03, 0x5b, 0x05,
-    0x01, 0x03, 0x03, 0x3d, 0x03, 0x4c, 0x1b, 0x40, 0x20, 0x00, 0x01, 0x02, 0x00, 0x02, 0x01, 0x00, 0x70, 0x00, 0x04,
-    0x00, 0x02, 0x01, 0x04, 0x02, 0x63, 0x00, 0x03, 0x03, 0x3d, 0x4b, 0x00, 0x00, 0x00, 0x05, 0x5b, 0x00, 0x05, 0x05,
-    0x45, 0x05, 0x4c, 0x59, 0x40, 0x09, 0x2e, 0x25, 0x15, 0x24, 0x28, 0x22, 0x06, 0x08, 0x1a, 0x2b, 0x25, 0x16, 0x16,
-    0x33, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x37, 0x01, 0x26, 0x26, 0x27, 0x26, 0x0e, 0x02, 0x07,
-    0x03, 0x23, 0x13, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x17, 0x01, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x27, 0x26, 0x26, 0x27,
-    0x01, 0xab, 0x24, 0x4f, 0x2d, 0x33, 0x55, 0x3f, 0x28, 0x06, 0x06, 0x21, 0x3f, 0x53, 0x2d, 0x5d, 0x19, 0x01, 0x17,
-    0x20, 0x50, 0x2c, 0x3f, 0x5b, 0x3f, 0x25, 0x08, 0x80, 0xb4, 0x80, 0x0d, 0x43, 0x6e, 0x9d, 0x67, 0x39, 0x66, 0x5b,
-    0x54, 0x27, 0xfe, 0xbc, 0x3f, 0x6c, 0x4d, 0x29, 0x04, 0x05, 0x46, 0x73, 0x99, 0x57, 0x3a, 0x6c, 0x35, 0xb5, 0x19,
-    0x1c, 0x23, 0x3f, 0x55, 0x31, 0x35, 0x43, 0x26, 0x0f, 0x01, 0x01, 0x91, 0x01, 0x23, 0x1f, 0x1d, 0x01, 0x01, 0x2e,
-    0x4e, 0x65, 0x37, 0xfd, 0x0f, 0x02, 0xf1, 0x60, 0xa0, 0x72, 0x3d, 0x02, 0x02, 0x1c, 0x31, 0x42, 0x27, 0xfe, 0xb2,
-    0x08, 0x2c, 0x4b, 0x69, 0x44, 0x59, 0x90, 0x65, 0x36, 0x01, 0x01, 0x1b, 0x17, 0xff, 0xff, 0x01, 0xb6, 0x04, 0xa6,
-    0x03, 0xf8, 0x05, 0xb3, 0x02, 0x06, 0x00, 0x9e, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x06, 0x00, 0x03, 0x00, 0x00, 0xff, 0xff, 0x00, 0xcc, 0x02, 0x31, 0x03, 0xce, 0x02, 0xc9, 0x02, 0x06,
-    0x00, 0x0f, 0x00, 0x00, 0x00, 0x02, 0xff, 0xe2, 0x00, 0x00, 0x04, 0x9b, 0x05, 0xb0, 0x00, 0x11, 0x00, 0x23, 0x00,
-    0x37, 0x40, 0x34, 0x07, 0x01, 0x01, 0x04, 0x01, 0x00, 0x05, 0x01, 0x00, 0x61, 0x00, 0x06, 0x06, 0x02, 0x5b, 0x00,
-    0x02, 0x02, 0x3c, 0x4b, 0x00, 0x05, 0x05, 0x03, 0x5b, 0x08, 0x01, 0x03, 0x03, 0x3d, 0x03, 0x4c, 0x00, 0x00, 0x23,
-    0x22, 0x21, 0x1f, 0x16, 0x14, 0x13, 0x12, 0x00, 0x11, 0x00, 0x10, 0x21, 0x11, 0x11, 0x09, 0x08, 0x17, 0x2b, 0x33,
-    0x13, 0x23, 0x37, 0x33, 0x13, 0x05, 0x1e, 0x03, 0x07, 0x07, 0x0e, 0x03, 0x23, 0x13, 0x23, 0x03, 0x17, 0x3e, 0x03,
-    0x37, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x03, 0x33, 0x4c, 0x73, 0xdd, 0x1b, 0xdc, 0x6f, 0x01, 0x3c, 0x90, 0xd3,
-    0x83, 0x31, 0x11, 0x0f, 0x16, 0x79, 0xbc, 0xfa, 0x97, 0xae, 0xd6, 0x59, 0x85, 0x75, 0xba, 0x8a, 0x58, 0x12, 0x10,
-    0x0d, 0x15, 0x50, 0x8f, 0x6e, 0x9b, 0x55, 0xd7, 0x02, 0x9a, 0x97, 0x02, 0x7f, 0x01, 0x03, 0x6f, 0xb7, 0xf2, 0x87,
-    0x6b, 0x90, 0xf6, 0xb5, 0x67, 0x02, 0x9a, 0xfd, 0xfd, 0x01, 0x01, 0x52, 0x8d, 0xbf, 0x6d, 0x6e, 0x60, 0xb7, 0x91,
-    0x5b, 0x04, 0x01, 0xfe, 0x19, 0x00, 0x02, 0xff, 0xe2, 0x00, 0x00, 0x04, 0x9b, 0x05, 0xb0, 0x00, 0x11, 0x00, 0x23,
-    0x00, 0x37, 0x40, 0x34, 0x07, 0x01, 0x01, 0x04, 0x01, 0x00, 0x05, 0x01, 0x00, 0x61, 0x00, 0x06, 0x06, 0x02, 0x5b,
-    0x00, 0x02, 0x02, 0x3c, 0x4b, 0x00, 0x05, 0x05, 0x03, 0x5b, 0x08, 0x01, 0x03, 0x03, 0x3d, 0x03, 0x4c, 0x00, 0x00,
-    0x23, 0x22, 0x21, 0x1f, 0x16, 0x14, 0x13, 0x12, 0x00, 0x11, 0x00, 0x10, 0x21, 0x11, 0x11, 0x09, 0x08, 0x17, 0x2b,
-    0x33, 0x13, 0x23, 0x37, 0x33, 0x13, 0x05, 0x1e, 0x03, 0x07, 0x07, 0x0e, 0x03, 0x23, 0x13, 0x23, 0x03, 0x17, 0x3e,
-    0x03, 0x37, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x27, 0x03, 0x33, 0x4c, 0x73, 0xdd, 0x1b, 0xdc, 0x6f, 0x01, 0x3c, 0x90,
-    0xd3, 0x83, 0x31, 0x11, 0x0f, 0x16, 0x79, 0xbc, 0xfa, 0x97, 0xae, 0xd6, 0x59, 0x85, 0x75, 0xba, 0x8a, 0x58, 0x12,
-    0x10, 0x0d, 0x15, 0x50, 0x8f, 0x6e, 0x9b, 0x55, 0xd7, 0x02, 0x9a, 0x97, 0x02, 0x7f, 0x01, 0x03, 0x6f, 0xb7, 0xf2,
-    0x87, 0x6b, 0x90, 0xf6, 0xb5, 0x67, 0x02, 0x9a, 0xfd, 0xfd, 0x01, 0x01, 0x52, 0x8d, 0xbf, 0x6d, 0x6e, 0x60, 0xb7,
-    0x91, 0x5b, 0x04, 0x01, 0xfe, 0x19, 0x00, 0x01, 0x00, 0x5e, 0x00, 0x00, 0x04, 0x3e, 0x06, 0x00, 0x00, 0x23, 0x00,
-    0x61, 0xb5, 0x02, 0x01, 0x02, 0x03, 0x01, 0x4a, 0x4b, 0xb0, 0x23, 0x50, 0x58, 0x40, 0x20, 0x08, 0x01, 0x06, 0x05,
-    0x01, 0x00, 0x01, 0x06, 0x00, 0x62, 0x00, 0x07, 0x07, 0x3e, 0x4b, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01,
-    0x47, 0x4b, 0x04, 0x01, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x1b, 0x40, 0x20, 0x00, 0x07, 0x06, 0x07, 0x72, 0x08, 0x01,
-    0x06, 0x05, 0x01, 0x00, 0x01, 0x06, 0x00, 0x62, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x47, 0x4b, 0x04,
-    0x01, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x59, 0x40, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x15, 0x25, 0x15, 0x25, 0x10, 0x09,
-    0x08, 0x1d, 0x2b, 0x01, 0x21, 0x03, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x03, 0x23, 0x13, 0x36, 0x2e, 0x02, 0x27,
-    0x26, 0x0e, 0x02, 0x07, 0x03, 0x23, 0x13, 0x23, 0x37, 0x33, 0x37, 0x33, 0x07, 0x21, 0x02, 0xf3, 0xfe, 0xf2, 0x3b,
-    0x21, 0x4d, 0x57, 0x61, 0x36, 0x5c, 0x7c, 0x48, 0x18, 0x09, 0x72, 0xb5, 0x73, 0x06, 0x0c, 0x2c, 0x4d, 0x3b, 0x2e,
-    0x53, 0x4b, 0x43, 0x1c, 0x89, 0xb5, 0xd6, 0xac, 0x1b, 0xab, 0x1b, 0xb5, 0x1d, 0x01, 0x0d, 0x04, 0xd2, 0xfe, 0xc6,
-    0x28, 0x44, 0x30, 0x1b, 0x01, 0x02, 0x46, 0x74, 0x97, 0x52, 0xfd, 0x57, 0x02, 0xac, 0x35, 0x5d, 0x47, 0x29, 0x02,
-    0x01, 0x17, 0x2b, 0x3a, 0x22, 0xfc, 0xed, 0x04, 0xd2, 0x97, 0x97, 0x97, 0x00, 0x00, 0x01, 0x00, 0xc2, 0x00, 0x00,
-    0x04, 0xf7, 0x05, 0xb0, 0x00, 0x0f, 0x00, 0x29, 0x40, 0x26, 0x07, 0x01, 0x03, 0x02, 0x01, 0x00, 0x01, 0x03, 0x00,
-    0x61, 0x06, 0x01, 0x04, 0x04, 0x05, 0x59, 0x00, 0x05, 0x05, 0x3c, 0x4b, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x08, 0x08, 0x1c, 0x2b, 0x01, 0x23, 0x03, 0x23, 0x13, 0x23, 0x37, 0x33,
-    0x13, 0x21, 0x37, 0x21, 0x07, 0x21, 0x03, 0x33, 0x03, 0xb8, 0xe4, 0x8e, 0xb0, 0x8e, 0xd7, 0x1b, 0xd6, 0x39, 0xfe,
-    0x4b, 0x1c, 0x04, 0x19, 0x1c, 0xfe, 0x4c, 0x39, 0xe5, 0x03, 0x37, 0xfc, 0xc9, 0x03, 0x37, 0x97, 0x01, 0x44, 0x9e,
-    0x9e, 0xfe, 0xbc, 0x00, 0x01, 0x00, 0xc4, 0xff, 0xeb, 0x04, 0x36, 0x05, 0x40, 0x00, 0x23, 0x00, 0x77, 0x40, 0x0a,
-    0x0a, 0x01, 0x01, 0x00, 0x0b, 0x01, 0x02, 0x01, 0x02, 0x4a, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x27, 0x00, 0x07,
-    0x06, 0x06, 0x07, 0x66, 0x0a, 0x01, 0x04, 0x03, 0x01, 0x00, 0x01, 0x04, 0x00, 0x61, 0x09, 0x01, 0x05, 0x05, 0x06,
-    0x59, 0x08, 0x01, 0x06, 0x06, 0x3f, 0x4b, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x45, 0x02, 0x4c, 0x1b,
-    0x40, 0x26, 0x00, 0x07, 0x06, 0x07, 0x72, 0x0a, 0x01, 0x04, 0x03, 0x01, 0x00, 0x01, 0x04, 0x00, 0x61, 0x09, 0x01,
-    0x05, 0x05, 0x06, 0x59, 0x08, 0x01, 0x06, 0x06, 0x3f, 0x4b, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x45,
-    0x02, 0x4c, 0x59, 0x40, 0x10, 0x23, 0x22, 0x21, 0x20, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x25, 0x25, 0x10, 0x0b,
-    0x08, 0x1d, 0x2b, 0x01, 0x23, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x2e, 0x03,
-    0x37, 0x37, 0x23, 0x37, 0x33, 0x37, 0x21, 0x37, 0x21, 0x13, 0x33, 0x03, 0x21, 0x07, 0x21, 0x07, 0x33, 0x03, 0x36,
-    0xe1, 0x2a, 0x05, 0x0b, 0x22, 0x3f, 0x30, 0x37, 0x6d, 0x36, 0x11, 0x3f, 0x9a, 0x47, 0x51, 0x70, 0x44, 0x19, 0x07,
-    0x2a, 0xd5, 0x1b, 0xd3, 0x1f, 0xfe, 0xec, 0x19, 0x01, 0x13, 0x2e, 0xb6, 0x2e, 0x01, 0x90, 0x19, 0xfe, 0x70, 0x1f,
-    0xe3, 0x02, 0x5a, 0xfc, 0x2c, 0x4c, 0x38, 0x22, 0x01, 0x02, 0x14, 0x0c, 0x85, 0x23, 0x16, 0x02, 0x01, 0x3d, 0x65,
-    0x85, 0x4a, 0xfb, 0x97, 0xba, 0x8f, 0x01, 0x06, 0xfe, 0xfa, 0x8f, 0xba, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xe2,
-    0x00, 0x00, 0x04, 0x02, 0x07, 0x23, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x00, 0x42, 0xff, 0xe3, 0x01,
-    0x5a, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x5a, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00,
-    0x04, 0x73, 0x07, 0x20, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0xc8, 0x01, 0x57, 0x00,
-    0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x57, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x04, 0x3c,
-    0x07, 0x48, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0xbf, 0x01, 0x5b, 0x00, 0x09, 0xb1,
-    0x02, 0x01, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x04, 0x82, 0x07, 0x51,
-    0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0xd7, 0x01, 0x61, 0x00, 0x09, 0xb1, 0x02, 0x01,
-    0xb8, 0x01, 0x61, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x04, 0x5b, 0x07, 0x22, 0x02, 0x26,
-    0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0x00, 0x56, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01,
-    0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x04, 0x02, 0x07, 0x8c, 0x02, 0x26, 0x00, 0x23,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa0, 0x00, 0x56, 0x01, 0xa4, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0xa4, 0xb0,
-    0x33, 0x2b, 0x00, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x04, 0x90, 0x08, 0x17, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00,
-    0x01, 0x07, 0x01, 0xcb, 0x00, 0x44, 0x01, 0xa6, 0x00, 0x09, 0xb1, 0x02, 0x03, 0xb8, 0x01, 0xa6, 0xb0, 0x33, 0x2b,
-    0x00, 0xff, 0xff, 0x00, 0x64, 0xfe, 0x4b, 0x04, 0x85, 0x05, 0xc6, 0x02, 0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x06,
-    0x00, 0x77, 0x34, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x04, 0xa1, 0x07, 0x23, 0x02, 0x26, 0x00,
-    0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0x42, 0xff, 0xd9, 0x01, 0x5a, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5a,
-    0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x04, 0xa1, 0x07, 0x20, 0x02, 0x26, 0x00, 0x27, 0x00,
-    0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0xbe, 0x01, 0x57, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x57, 0xb0, 0x33,
-    0x2b, 0x00, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x04, 0xa1, 0x07, 0x48, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01,
-    0x07, 0x00, 0x9c, 0x00, 0xb5, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x04, 0xa1, 0x07, 0x22, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00,
-    0x68, 0x00, 0x4c, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff,
-    0x00, 0x40, 0x00, 0x00, 0x04, 0x94, 0x07, 0x23, 0x02, 0x26, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x42, 0xff,
-    0xa7, 0x01, 0x5a, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5a, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x40,
-    0x00, 0x00, 0x04, 0x94, 0x07, 0x20, 0x02, 0x26, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x8c, 0x01,
-    0x57, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x57, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x40, 0x00, 0x00,
-    0x04, 0x94, 0x07, 0x48, 0x02, 0x26, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0x83, 0x01, 0x5b, 0x00,
-    0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x40, 0x00, 0x00, 0x04, 0x94,
-    0x07, 0x22, 0x02, 0x26, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0x00, 0x1a, 0x01, 0x5b, 0x00, 0x09, 0xb1,
-    0x01, 0x02, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x22, 0x00, 0x00, 0x04, 0xb3, 0x07, 0x51,
-    0x02, 0x26, 0x00, 0x30, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0xb1, 0x01, 0x61, 0x00, 0x09, 0xb1, 0x01, 0x01,
-    0xb8, 0x01, 0x61, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x66, 0xff, 0xea, 0x04, 0x6d, 0x07, 0x38, 0x02, 0x26,
-    0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00, 0x42, 0xff, 0xea, 0x01, 0x6f, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01,
-    0x6f, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x66, 0xff, 0xea, 0x04, 0x7a, 0x07, 0x35, 0x02, 0x26, 0x00, 0x31,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0xcf, 0x01, 0x6c, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x6c, 0xb0,
-    0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x66, 0xff, 0xea, 0x04, 0x6d, 0x07, 0x5d, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x9c, 0x00, 0xc6, 0x01, 0x70, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x70, 0xb0, 0x33, 0x2b,
-    0x00, 0xff, 0xff, 0x00, 0x66, 0xff, 0xea, 0x04, 0x89, 0x07, 0x66, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa2, 0x00, 0xde, 0x01, 0x76, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x76, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0x00, 0x66, 0xff, 0xea, 0x04, 0x6d, 0x07, 0x37, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68,
-    0x00, 0x5d, 0x01, 0x70, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x70, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00,
-    0x68, 0xff, 0xea, 0x04, 0xb5, 0x07, 0x17, 0x02, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0x42, 0xff, 0xfe,
-    0x01, 0x4e, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x4e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x68, 0xff,
-    0xea, 0x04, 0xb5, 0x07, 0x14, 0x02, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0xe3, 0x01, 0x4b,
-    0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x4b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x68, 0xff, 0xea, 0x04,
-    0xb5, 0x07, 0x3c, 0x02, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0xda, 0x01, 0x4f, 0x00, 0x09,
-    0xb1, 0x01, 0x01, 0xb8, 0x01, 0x4f, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x68, 0xff, 0xea, 0x04, 0xb5, 0x07,
-    0x16, 0x02, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0x00, 0x71, 0x01, 0x4f, 0x00, 0x09, 0xb1, 0x01,
-    0x02, 0xb8, 0x01, 0x4f, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xd4, 0x00, 0x00, 0x04, 0xf1, 0x07, 0x1f, 0x02,
-    0x26, 0x00, 0x3b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0xb4, 0x01, 0x56, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8,
-    0x01, 0x56, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x61, 0xff, 0xeb, 0x04, 0x0f, 0x05, 0xe1, 0x02, 0x26, 0x00,
-    0x43, 0x00, 0x00, 0x01, 0x06, 0x00, 0x42, 0xa7, 0x18, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x18, 0xb0, 0x33, 0x2b,
-    0xff, 0xff, 0x00, 0x61, 0xff, 0xeb, 0x04, 0x37, 0x05, 0xde, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x07, 0x00,
-    0x73, 0x00, 0x8c, 0x00, 0x15, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x15, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x61, 0xff, 0xeb, 0x04, 0x0f, 0x06, 0x06, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00,
-    0x83, 0x00, 0x19, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x61,
-    0xff, 0xeb, 0x04, 0x46, 0x06, 0x0f, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0x9b, 0x00,
-    0x1f, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x1f, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x61, 0xff, 0xeb,
-    0x04, 0x1f, 0x05, 0xe0, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x1a, 0x19, 0x00, 0x08, 0xb1,
-    0x02, 0x02, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x61, 0xff, 0xeb, 0x04, 0x0f, 0x06, 0x4a, 0x02, 0x26,
-    0x00, 0x43, 0x00, 0x00, 0x01, 0x06, 0x00, 0xa0, 0x1a, 0x62, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x62, 0xb0, 0x33,
-    0x2b, 0xff, 0xff, 0x00, 0x61, 0xff, 0xeb, 0x04, 0x54, 0x06, 0xd5, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x06,
-    0x01, 0xcb, 0x08, 0x64, 0x00, 0x08, 0xb1, 0x02, 0x03, 0xb0, 0x64, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x75, 0xfe,
-    0x4b, 0x04, 0x2c, 0x04, 0x50, 0x02, 0x26, 0x00, 0x45, 0x00, 0x00, 0x00, 0x06, 0x00, 0x77, 0x48, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x6c, 0xff, 0xeb, 0x04, 0x2b, 0x05, 0xe2, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06, 0x00,
-    0x42, 0xa3, 0x19, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xeb,
-    0x04, 0x33, 0x05, 0xdf, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x88, 0x00, 0x16, 0x00,
-    0x08, 0xb1, 0x02, 0x01, 0xb0, 0x16, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xeb, 0x04, 0x2b,
-    0x06, 0x07, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9c, 0x7f, 0x1a, 0x00, 0x08, 0xb1, 0x02, 0x01,
-    0xb0, 0x1a, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xeb, 0x04, 0x2b, 0x05, 0xe1, 0x02, 0x26, 0x00, 0x47,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x16, 0x1a, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x1a, 0xb0, 0x33, 0x2b, 0xff,
-    0xff, 0x00, 0x5c, 0x00, 0x00, 0x03, 0xe9, 0x05, 0xcc, 0x02, 0x26, 0x00, 0x8a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x42,
-    0xcc, 0x03, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x03, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x5c, 0x00, 0x00, 0x04,
-    0x5c, 0x05, 0xc9, 0x02, 0x26, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x73, 0x00, 0xb1, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x5c, 0x00, 0x00, 0x04, 0x25, 0x05, 0xf1, 0x02, 0x26, 0x00, 0x8a, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00,
-    0xa8, 0x00, 0x04, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x04, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5c,
-    0x00, 0x00, 0x04, 0x44, 0x05, 0xcb, 0x02, 0x26, 0x00, 0x8a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x3f, 0x04, 0x00,
-    0x08, 0xb1, 0x01, 0x02, 0xb0, 0x04, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x40, 0x00, 0x00, 0x04, 0x33, 0x06, 0x0f,
-    0x02, 0x26, 0x00, 0x50, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0x88, 0x00, 0x1f, 0x00, 0x08, 0xb1, 0x01, 0x01,
-    0xb0, 0x1f, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x60, 0xff, 0xe9, 0x04, 0x33, 0x05, 0xe1, 0x02, 0x26,
-    0x00, 0x51, 0x00, 0x00, 0x01, 0x06, 0x00, 0x42, 0x9d, 0x18, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x18, 0xb0, 0x33,
-    0x2b, 0xff, 0xff, 0x00, 0x60, 0xff, 0xe9, 0x04, 0x33, 0x05, 0xde, 0x02, 0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x73, 0x00, 0x82, 0x00, 0x15, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x15, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x60, 0xff, 0xe9, 0x04, 0x33, 0x06, 0x06, 0x02, 0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9c,
-    0x79, 0x19, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x60, 0xff, 0xe9, 0x04,
-    0x3c, 0x06, 0x0f, 0x02, 0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0x91, 0x00, 0x1f, 0x00, 0x08,
-    0xb1, 0x02, 0x01, 0xb0, 0x1f, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x60, 0xff, 0xe9, 0x04, 0x33, 0x05,
-    0xe0, 0x02, 0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x10, 0x19, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0,
-    0x19, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xea, 0x04, 0x54, 0x05, 0xcd, 0x02, 0x26, 0x00, 0x57, 0x00,
-    0x00, 0x01, 0x06, 0x00, 0x42, 0x98, 0x04, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x04, 0xb0, 0x33, 0x2b, 0xff, 0xff,
-    0x00, 0x8d, 0xff, 0xea, 0x04, 0x54, 0x05, 0xca, 0x02, 0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x06, 0x00, 0x73, 0x7d,
-    0x01, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x01, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xea, 0x04, 0x54,
-    0x05, 0xf2, 0x02, 0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9c, 0x74, 0x05, 0x00, 0x08, 0xb1, 0x01, 0x01,
-    0xb0, 0x05, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xea, 0x04, 0x54, 0x05, 0xcc, 0x02, 0x26, 0x00, 0x57,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x0b, 0x05, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x05, 0xb0, 0x33, 0x2b, 0xff,
-    0xff, 0xff, 0xe4, 0xfe, 0x48, 0x04, 0xbc, 0x05, 0xca, 0x02, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73,
-    0x00, 0x91, 0x00, 0x01, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x01, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xe4, 0xfe, 0x48, 0x04, 0xbc, 0x05, 0xcc, 0x02, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x1f, 0x05,
-    0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x05, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x04, 0x8c, 0x06,
-    0xfa, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6e, 0x00, 0x57, 0x01, 0x4a, 0x00, 0x09, 0xb1, 0x02,
-    0x01, 0xb8, 0x01, 0x4a, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x61, 0xff, 0xeb, 0x04, 0x50, 0x05, 0xb8, 0x02,
-    0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6e, 0x1b, 0x08, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x08, 0xb0,
-    0x33, 0x2b, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x04, 0x57, 0x07, 0x4b, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01,
-    0x07, 0x00, 0x9e, 0x00, 0x5f, 0x01, 0x98, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x98, 0xb0, 0x33, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x61, 0xff, 0xeb, 0x04, 0x1b, 0x06, 0x09, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x06, 0x00,
-    0x9e, 0x23, 0x56, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x56, 0xb0, 0x33, 0x2b, 0x00, 0x02, 0xff, 0xe2, 0xfe, 0x4f,
-    0x04, 0x02, 0x05, 0xb0, 0x00, 0x1e, 0x00, 0x21, 0x00, 0x44, 0x40, 0x41, 0x21, 0x01, 0x06, 0x04, 0x17, 0x01, 0x03,
-    0x02, 0x0b, 0x01, 0x00, 0x03, 0x0c, 0x01, 0x01, 0x00, 0x04, 0x4a, 0x00, 0x06, 0x00, 0x02, 0x03, 0x06, 0x02, 0x62,
-    0x00, 0x04, 0x04, 0x3c, 0x4b, 0x07, 0x05, 0x02, 0x03, 0x03, 0x3d, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x5b, 0x00, 0x01,
-    0x01, 0x49, 0x01, 0x4c, 0x00, 0x00, 0x20, 0x1f, 0x00, 0x1e, 0x00, 0x1e, 0x11, 0x11, 0x18, 0x26, 0x17, 0x08, 0x08,
-    0x19, 0x2b, 0x21, 0x17, 0x0e, 0x03, 0x07, 0x06, 0x17, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x26, 0x26, 0x37,
-    0x3e, 0x03, 0x37, 0x03, 0x21, 0x03, 0x23, 0x01, 0x33, 0x13, 0x01, 0x21, 0x03, 0x03, 0xd2, 0x05, 0x20, 0x42, 0x38,
-    0x27, 0x04, 0x06, 0x3f, 0x1a, 0x32, 0x17, 0x15, 0x26, 0x55, 0x2c, 0x51, 0x5c, 0x02, 0x01, 0x28, 0x3f, 0x4f, 0x29,
-    0x2a, 0xfe, 0x2b, 0xb4, 0xbc, 0x02, 0xc5, 0x98, 0xc3, 0xfd, 0x9b, 0x01, 0x77, 0x4c, 0x03, 0x11, 0x2d, 0x37, 0x43,
-    0x27, 0x42, 0x01, 0x02, 0x10, 0x0b, 0x7b, 0x16, 0x14, 0x01, 0x01, 0x64, 0x51, 0x30, 0x54, 0x46, 0x39, 0x17, 0x01,
-    0x59, 0xfe, 0x87, 0x05, 0xb0, 0xfa, 0x50, 0x02, 0x1a, 0x02, 0x76, 0x00, 0x02, 0x00, 0x61, 0xfe, 0x4f, 0x04, 0x0f,
-    0x04, 0x50, 0x00, 0x45, 0x00, 0x54, 0x00, 0x54, 0x40, 0x51, 0x44, 0x1a, 0x02, 0x02, 0x07, 0x0b, 0x01, 0x00, 0x02,
-    0x0c, 0x01, 0x01, 0x00, 0x03, 0x4a, 0x00, 0x05, 0x04, 0x03, 0x04, 0x05, 0x03, 0x70, 0x00, 0x03, 0x00, 0x08, 0x07,
-    0x03, 0x08, 0x63, 0x00, 0x04, 0x04, 0x06, 0x5b, 0x00, 0x06, 0x06, 0x47, 0x4b, 0x09, 0x01, 0x07, 0x07, 0x02, 0x5b,
-    0x00, 0x02, 0x02, 0x45, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x49, 0x01, 0x4c, 0x47, 0x46, 0x4c,
-    0x4a, 0x46, 0x54, 0x47, 0x54, 0x24, 0x14, 0x25, 0x2a, 0x2c, 0x26, 0x17, 0x0a, 0x08, 0x1b, 0x2b, 0x21, 0x17, 0x0e,
-    0x03, 0x07, 0x06, 0x17, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x26, 0x26, 0x37, 0x3e, 0x03, 0x37, 0x26, 0x36,
-    0x37, 0x06, 0x06, 0x27, 0x2e, 0x03, 0x37, 0x3e, 0x05, 0x33, 0x17, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02,
-    0x07, 0x07, 0x3e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x03, 0x06, 0x06, 0x17, 0x07, 0x25, 0x16, 0x36, 0x37, 0x37, 0x27,
-    0x22, 0x0e, 0x02, 0x07, 0x06, 0x1e, 0x02, 0x03, 0x84, 0x05, 0x20, 0x42, 0x38, 0x27, 0x04, 0x06, 0x3f, 0x1a, 0x32,
-    0x17, 0x15, 0x26, 0x55, 0x2c, 0x51, 0x5c, 0x02, 0x01, 0x25, 0x3c, 0x4b, 0x27, 0x04, 0x02, 0x02, 0x47, 0xa7, 0x61,
-    0x44, 0x79, 0x59, 0x31, 0x04, 0x04, 0x31, 0x4e, 0x66, 0x73, 0x7b, 0x3c, 0xce, 0x0d, 0x06, 0x1b, 0x38, 0x51, 0x31,
-    0x2b, 0x53, 0x45, 0x32, 0x0a, 0xb5, 0x09, 0x58, 0x81, 0x9a, 0x4a, 0x52, 0x8e, 0x65, 0x34, 0x09, 0x54, 0x09, 0x01,
-    0x0d, 0x02, 0xfe, 0x18, 0x60, 0xa6, 0x38, 0x27, 0x9b, 0x37, 0x7d, 0x6e, 0x4e, 0x08, 0x05, 0x16, 0x30, 0x44, 0x03,
-    0x11, 0x2d, 0x37, 0x43, 0x27, 0x42, 0x01, 0x02, 0x10, 0x0b, 0x7b, 0x16, 0x14, 0x01, 0x01, 0x64, 0x51, 0x2e, 0x51,
-    0x45, 0x38, 0x17, 0x17, 0x2e, 0x18, 0x3f, 0x4c, 0x02, 0x01, 0x2c, 0x50, 0x72, 0x48, 0x46, 0x6c, 0x51, 0x38, 0x23,
-    0x0f, 0x01, 0x56, 0x33, 0x4e, 0x36, 0x1c, 0x01, 0x01, 0x14, 0x2a, 0x41, 0x2d, 0x01, 0x52, 0x79, 0x50, 0x27, 0x01,
-    0x02, 0x30, 0x5d, 0x86, 0x57, 0xfe, 0x09, 0x37, 0x6e, 0x36, 0x11, 0x8c, 0x02, 0x5b, 0x4c, 0xdc, 0x01, 0x0e, 0x2c,
-    0x52, 0x43, 0x2b, 0x42, 0x2d, 0x18, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x64, 0xff, 0xe9, 0x04, 0x9b, 0x07, 0x35,
-    0x02, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0xf0, 0x01, 0x6c, 0x00, 0x09, 0xb1, 0x01, 0x01,
-    0xb8, 0x01, 0x6c, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x75, 0xff, 0xe9, 0x04, 0x49, 0x05, 0xde, 0x02, 0x26,
-    0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x9e, 0x00, 0x15, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x15,
-    0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x64, 0xff, 0xe9, 0x04, 0x85, 0x07, 0x5d, 0x02, 0x26, 0x00, 0x25,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0xe7, 0x01, 0x70, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x70, 0xb0,
-    0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x75, 0xff, 0xe9, 0x04, 0x2c, 0x06, 0x06, 0x02, 0x26, 0x00, 0x45, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x9c, 0x00, 0x95, 0x00, 0x19, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0x64, 0xff, 0xe9, 0x04, 0x85, 0x07, 0x30, 0x02, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x9f, 0x00, 0x73, 0x01, 0x70, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x70, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0x00, 0x75, 0xff, 0xe9, 0x04, 0x2c, 0x05, 0xd9, 0x02, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9f,
-    0x21, 0x19, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x64, 0xff, 0xe9, 0x04,
-    0x91, 0x07, 0x5f, 0x02, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9d, 0x00, 0x74, 0x01, 0x71, 0x00, 0x09,
-    0xb1, 0x01, 0x01, 0xb8, 0x01, 0x71, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x75, 0xff, 0xe9, 0x04, 0x3f, 0x06,
-    0x08, 0x02, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9d, 0x22, 0x1a, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0,
-    0x1a, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x2e, 0x00, 0x00, 0x04, 0x7d, 0x07, 0x4a, 0x02, 0x26, 0x00, 0x26, 0x00,
-    0x00, 0x01, 0x07, 0x00, 0x9d, 0x00, 0x17, 0x01, 0x5c, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x5c, 0xb0, 0x33,
-    0x2b, 0x00, 0xff, 0xff, 0x00, 0x76, 0xff, 0xea, 0x06, 0x5f, 0x06, 0x15, 0x00, 0x26, 0x00, 0x46, 0x00, 0x00, 0x01,
-    0x07, 0x01, 0x68, 0x02, 0xee, 0xff, 0xff, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0xff, 0xff, 0xb0, 0x33, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x04, 0xa1, 0x06, 0xfa, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00,
-    0x6e, 0x00, 0x4d, 0x01, 0x4a, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x4a, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff,
-    0x00, 0x6c, 0xff, 0xeb, 0x04, 0x4c, 0x05, 0xb9, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6e, 0x17,
-    0x09, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x09, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x04, 0xa1,
-    0x07, 0x4b, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x55, 0x01, 0x98, 0x00, 0x09, 0xb1,
-    0x01, 0x01, 0xb8, 0x01, 0x98, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xeb, 0x04, 0x2b, 0x06, 0x0a,
-    0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x1f, 0x57, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x57,
-    0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x04, 0xa1, 0x07, 0x1b, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x9f, 0x00, 0x41, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b,
-    0x00, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xeb, 0x04, 0x2b, 0x05, 0xda, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0x9f, 0x0b, 0x1a, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x1a, 0xb0, 0x33, 0x2b, 0x00, 0x01, 0x00, 0x48, 0xfe,
-    0x4f, 0x04, 0xa1, 0x05, 0xb0, 0x00, 0x23, 0x00, 0x41, 0x40, 0x3e, 0x10, 0x01, 0x03, 0x02, 0x11, 0x01, 0x04, 0x03,
-    0x02, 0x4a, 0x00, 0x08, 0x00, 0x00, 0x01, 0x08, 0x00, 0x61, 0x00, 0x07, 0x07, 0x06, 0x59, 0x00, 0x06, 0x06, 0x3c,
-    0x4b, 0x00, 0x01, 0x01, 0x02, 0x59, 0x05, 0x01, 0x02, 0x02, 0x3d, 0x4b, 0x00, 0x03, 0x03, 0x04, 0x5b, 0x00, 0x04,
-    0x04, 0x49, 0x04, 0x4c, 0x11, 0x11, 0x11, 0x17, 0x26, 0x17, 0x11, 0x11, 0x10, 0x09, 0x08, 0x1d, 0x2b, 0x01, 0x21,
-    0x03, 0x21, 0x07, 0x23, 0x17, 0x0e, 0x03, 0x07, 0x06, 0x17, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x26, 0x26,
-    0x37, 0x3e, 0x03, 0x37, 0x21, 0x13, 0x21, 0x07, 0x21, 0x03, 0x21, 0x03, 0xbf, 0xfd, 0xb3, 0x5a, 0x02, 0xb0, 0x1c,
-    0x56, 0x05, 0x20, 0x42, 0x38, 0x27, 0x04, 0x06, 0x3f, 0x1a, 0x32, 0x17, 0x15, 0x26, 0x55, 0x2c, 0x51, 0x5c, 0x02,
-    0x01, 0x1d, 0x2f, 0x3d, 0x21, 0xfd, 0xa8, 0xfd, 0x03, 0x5c, 0x1c, 0xfd, 0x59, 0x51, 0x02, 0x4e, 0x02, 0xa1, 0xfd,
-    0xfc, 0x9d, 0x03, 0x11, 0x2d, 0x37, 0x43, 0x27, 0x42, 0x01, 0x02, 0x10, 0x0b, 0x7b, 0x16, 0x14, 0x01, 0x01, 0x64,
-    0x51, 0x28, 0x48, 0x3f, 0x35, 0x16, 0x05, 0xb0, 0x9e, 0xfe, 0x2c, 0x00, 0x00, 0x02, 0x00, 0x6c, 0xfe, 0x61, 0x04,
-    0x2b, 0x04, 0x50, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x4b, 0x40, 0x48, 0x33, 0x01, 0x04, 0x03, 0x17, 0x0d, 0x02, 0x00,
-    0x04, 0x0e, 0x01, 0x01, 0x00, 0x03, 0x4a, 0x00, 0x04, 0x03, 0x00, 0x03, 0x04, 0x00, 0x70, 0x00, 0x06, 0x00, 0x03,
-    0x04, 0x06, 0x03, 0x61, 0x07, 0x01, 0x05, 0x05, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x47, 0x4b, 0x00, 0x00, 0x00, 0x01,
-    0x5c, 0x00, 0x01, 0x01, 0x41, 0x01, 0x4c, 0x35, 0x34, 0x3a, 0x39, 0x34, 0x3f, 0x35, 0x3f, 0x31, 0x2f, 0x2b, 0x2a,
-    0x25, 0x23, 0x26, 0x19, 0x08, 0x08, 0x16, 0x2b, 0x25, 0x06, 0x06, 0x07, 0x0e, 0x03, 0x07, 0x06, 0x17, 0x16, 0x36,
-    0x37, 0x17, 0x06, 0x06, 0x27, 0x26, 0x26, 0x37, 0x36, 0x36, 0x37, 0x2e, 0x03, 0x37, 0x37, 0x3e, 0x05, 0x17, 0x1e,
-    0x03, 0x07, 0x07, 0x21, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x36, 0x37, 0x03, 0x26, 0x0e, 0x02, 0x07, 0x05, 0x37, 0x36,
-    0x2e, 0x02, 0x03, 0xd1, 0x30, 0x83, 0x4b, 0x1e, 0x3e, 0x34, 0x23, 0x03, 0x06, 0x3f, 0x1a, 0x32, 0x17, 0x15, 0x26,
-    0x55, 0x2c, 0x51, 0x5c, 0x02, 0x02, 0x46, 0x33, 0x65, 0x99, 0x63, 0x2a, 0x09, 0x05, 0x08, 0x2e, 0x49, 0x61, 0x77,
-    0x8b, 0x4d, 0x70, 0x9a, 0x5a, 0x1e, 0x0d, 0x0d, 0xfd, 0x17, 0x08, 0x19, 0x40, 0x6a, 0x49, 0x5e, 0x9f, 0x40, 0xc9,
-    0x46, 0x70, 0x57, 0x40, 0x15, 0x02, 0x34, 0x04, 0x09, 0x14, 0x38, 0x58, 0xbb, 0x42, 0x5b, 0x18, 0x11, 0x2b, 0x35,
-    0x40, 0x25, 0x42, 0x01, 0x02, 0x10, 0x0b, 0x7b, 0x16, 0x14, 0x01, 0x01, 0x64, 0x51, 0x42, 0x6a, 0x2a, 0x09, 0x5a,
-    0x8c, 0xb4, 0x63, 0x2b, 0x47, 0x8b, 0x7e, 0x6a, 0x4d, 0x2a, 0x02, 0x03, 0x5b, 0x94, 0xbd, 0x64, 0x53, 0x42, 0x7e,
-    0x64, 0x3e, 0x02, 0x03, 0x50, 0x42, 0x02, 0xa3, 0x03, 0x35, 0x58, 0x72, 0x3a, 0x02, 0x12, 0x37, 0x68, 0x52, 0x33,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x04, 0xa1, 0x07, 0x4a, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x9d, 0x00, 0x42, 0x01, 0x5c, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5c, 0xb0, 0x33, 0x2b,
-    0x00, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xeb, 0x04, 0x2b, 0x06, 0x09, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0x9d, 0x0c, 0x1b, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x1b, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x60, 0xff,
-    0xe8, 0x04, 0x85, 0x07, 0x5d, 0x02, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0xcc, 0x01, 0x70,
-    0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x70, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x2d, 0xfe, 0x52, 0x04,
-    0x52, 0x06, 0x06, 0x02, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9c, 0x6e, 0x19, 0x00, 0x08, 0xb1, 0x02,
-    0x01, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x60, 0xff, 0xe8, 0x04, 0x85, 0x07, 0x60, 0x02, 0x26, 0x00,
-    0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x6c, 0x01, 0xad, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0xad,
-    0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x2d, 0xfe, 0x52, 0x04, 0x52, 0x06, 0x09, 0x02, 0x26, 0x00, 0x49, 0x00,
-    0x00, 0x01, 0x06, 0x00, 0x9e, 0x0e, 0x56, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x56, 0xb0, 0x33, 0x2b, 0xff, 0xff,
-    0x00, 0x60, 0xff, 0xe8, 0x04, 0x85, 0x07, 0x30, 0x02, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x00,
-    0x58, 0x01, 0x70, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x70, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x2d,
-    0xfe, 0x52, 0x04, 0x52, 0x05, 0xd9, 0x02, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9f, 0xfb, 0x19, 0x00,
-    0x08, 0xb1, 0x02, 0x01, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x60, 0xfe, 0x25, 0x04, 0x85, 0x05, 0xc6,
-    0x02, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0x77, 0xfe, 0xcf, 0x00, 0x09, 0xb1, 0x01, 0x01,
-    0xb8, 0xfe, 0xcf, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x2d, 0xfe, 0x52, 0x04, 0x52, 0x06, 0x95, 0x02, 0x26,
-    0x00, 0x49, 0x00, 0x00, 0x01, 0x06, 0x01, 0x9c, 0x16, 0x58, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x58, 0xb0, 0x33,
-    0x2b, 0xff, 0xff, 0x00, 0x20, 0x00, 0x00, 0x04, 0xb4, 0x07, 0x48, 0x02, 0x26, 0x00, 0x2a, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x9c, 0x00, 0xaa, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0x00, 0x40, 0x00, 0x00, 0x04, 0x20, 0x07, 0x6f, 0x02, 0x26, 0x00, 0x4a, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c,
-    0x00, 0x66, 0x01, 0x82, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x82, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00,
-    0x40, 0x00, 0x00, 0x04, 0x94, 0x07, 0x51, 0x02, 0x26, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0x9b,
-    0x01, 0x61, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x61, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5c, 0x00,
-    0x00, 0x04, 0x6b, 0x05, 0xfa, 0x02, 0x26, 0x00, 0x8a, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0xc0, 0x00, 0x0a,
-    0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x0a, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x40, 0x00, 0x00, 0x04,
-    0x94, 0x06, 0xfa, 0x02, 0x26, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6e, 0x00, 0x1b, 0x01, 0x4a, 0x00, 0x09,
-    0xb1, 0x01, 0x01, 0xb8, 0x01, 0x4a, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5c, 0x00, 0x00, 0x04, 0x75, 0x05,
-    0xa4, 0x02, 0x26, 0x00, 0x8a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6e, 0x40, 0xf4, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8,
-    0xff, 0xf4, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x40, 0x00, 0x00, 0x04, 0x94, 0x07, 0x4b, 0x02,
-    0x26, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x23, 0x01, 0x98, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8,
-    0x01, 0x98, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5c, 0x00, 0x00, 0x04, 0x40, 0x05, 0xf4, 0x02, 0x26, 0x00,
-    0x8a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x48, 0x41, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x41, 0xb0, 0x33, 0x2b,
-    0x00, 0x01, 0x00, 0x40, 0xfe, 0x4f, 0x04, 0x94, 0x05, 0xb0, 0x00, 0x23, 0x00, 0x3b, 0x40, 0x38, 0x12, 0x01, 0x04,
-    0x03, 0x13, 0x01, 0x05, 0x04, 0x02, 0x4a, 0x08, 0x01, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x00, 0x3c, 0x4b, 0x07,
-    0x01, 0x02, 0x02, 0x03, 0x59, 0x06, 0x01, 0x03, 0x03, 0x3d, 0x4b, 0x00, 0x04, 0x04, 0x05, 0x5b, 0x00, 0x05, 0x05,
-    0x49, 0x05, 0x4c, 0x11, 0x11, 0x17, 0x26, 0x17, 0x11, 0x11, 0x11, 0x10, 0x09, 0x08, 0x1d, 0x2b, 0x01, 0x21, 0x07,
-    0x21, 0x03, 0x21, 0x07, 0x23, 0x17, 0x0e, 0x03, 0x07, 0x06, 0x17, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x26,
-    0x26, 0x37, 0x3e, 0x03, 0x37, 0x21, 0x37, 0x21, 0x13, 0x21, 0x01, 0x3d, 0x03, 0x57, 0x1d, 0xfe, 0xae, 0xc5, 0x01,
-    0x53, 0x1c, 0x8f, 0x05, 0x20, 0x42, 0x38, 0x27, 0x04, 0x06, 0x3f, 0x1a, 0x32, 0x17, 0x15, 0x26, 0x55, 0x2c, 0x51,
-    0x5c, 0x02, 0x01, 0x1d, 0x2f, 0x3d, 0x21, 0xfd, 0xee, 0x1c, 0x01, 0x4b, 0xc5, 0xfe, 0xb4, 0x05, 0xb0, 0xa1, 0xfb,
-    0x91, 0xa0, 0x03, 0x11, 0x2d, 0x37, 0x43, 0x27, 0x42, 0x01, 0x02, 0x10, 0x0b, 0x7b, 0x16, 0x14, 0x01, 0x01, 0x64,
-    0x51, 0x28, 0x48, 0x3f, 0x35, 0x16, 0xa0, 0x04, 0x6f, 0x00, 0x02, 0x00, 0x5c, 0xfe, 0x4f, 0x03, 0xe9, 0x05, 0xc5,
-    0x00, 0x21, 0x00, 0x2f, 0x00, 0x46, 0x40, 0x43, 0x10, 0x01, 0x03, 0x02, 0x11, 0x01, 0x04, 0x03, 0x02, 0x4a, 0x00,
-    0x09, 0x09, 0x08, 0x5b, 0x00, 0x08, 0x08, 0x44, 0x4b, 0x00, 0x07, 0x07, 0x00, 0x59, 0x00, 0x00, 0x00, 0x3f, 0x4b,
-    0x06, 0x01, 0x01, 0x01, 0x02, 0x59, 0x05, 0x01, 0x02, 0x02, 0x3d, 0x4b, 0x00, 0x03, 0x03, 0x04, 0x5b, 0x00, 0x04,
-    0x04, 0x49, 0x04, 0x4c, 0x2e, 0x2c, 0x23, 0x11, 0x11, 0x17, 0x26, 0x17, 0x11, 0x11, 0x10, 0x0a, 0x08, 0x1d, 0x2b,
-    0x01, 0x21, 0x03, 0x21, 0x07, 0x21, 0x17, 0x0e, 0x03, 0x07, 0x06, 0x17, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27,
-    0x26, 0x26, 0x37, 0x3e, 0x03, 0x37, 0x21, 0x37, 0x21, 0x13, 0x21, 0x01, 0x36, 0x36, 0x37, 0x36, 0x1e, 0x02, 0x15,
-    0x14, 0x06, 0x07, 0x06, 0x26, 0x01, 0x18, 0x02, 0x1a, 0xa0, 0x01, 0x57, 0x1d, 0xfe, 0xa5, 0x05, 0x20, 0x42, 0x38,
-    0x27, 0x04, 0x06, 0x3f, 0x1a, 0x32, 0x17, 0x15, 0x26, 0x55, 0x2c, 0x51, 0x5c, 0x02, 0x01, 0x1d, 0x2f, 0x3d, 0x21,
-    0xfe, 0xa1, 0x1d, 0x01, 0x64, 0x84, 0xfe, 0x9b, 0x01, 0x9b, 0x01, 0x3c, 0x30, 0x18, 0x27, 0x1d, 0x0f, 0x3c, 0x30,
-    0x2f, 0x3d, 0x04, 0x3a, 0xfc, 0x66, 0xa0, 0x03, 0x11, 0x2d, 0x37, 0x43, 0x27, 0x42, 0x01, 0x02, 0x10, 0x0b, 0x7b,
-    0x16, 0x14, 0x01, 0x01, 0x64, 0x51, 0x28, 0x48, 0x3f, 0x35, 0x16, 0xa0, 0x02, 0xf9, 0x01, 0xba, 0x30, 0x3f, 0x02,
-    0x01, 0x10, 0x1c, 0x28, 0x18, 0x30, 0x3b, 0x02, 0x02, 0x39, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x40, 0x00, 0x00,
-    0x04, 0x94, 0x07, 0x1b, 0x02, 0x26, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x00, 0x0f, 0x01, 0x5b, 0x00,
-    0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xea, 0x05, 0x6a,
-    0x07, 0x3b, 0x02, 0x26, 0x00, 0x2c, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x01, 0xed, 0x01, 0x4e, 0x00, 0x09, 0xb1,
-    0x01, 0x01, 0xb8, 0x01, 0x4e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x01, 0xfe, 0x49, 0x04, 0x4d, 0x05, 0xe8,
-    0x02, 0x26, 0x00, 0x9a, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0xd0, 0xff, 0xfb, 0x00, 0x09, 0xb1, 0x01, 0x01,
-    0xb8, 0xff, 0xfb, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xfe, 0x3e, 0x04, 0xfc, 0x05, 0xb0, 0x02, 0x26,
-    0x00, 0x2d, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0x80, 0xfe, 0xe8, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe,
-    0xe8, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x42, 0xfe, 0x40, 0x04, 0x64, 0x06, 0x00, 0x02, 0x26, 0x00, 0x4d,
-    0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0x2f, 0xfe, 0xea, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0xea, 0xb0,
-    0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x58, 0x00, 0x00, 0x03, 0xdb, 0x07, 0x00, 0x02, 0x26, 0x00, 0x2e, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x73, 0xff, 0x7e, 0x01, 0x37, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x37, 0xb0, 0x33, 0x2b,
-    0x00, 0xff, 0xff, 0x00, 0x5c, 0x00, 0x00, 0x04, 0x9b, 0x07, 0x66, 0x02, 0x26, 0x00, 0x4e, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x73, 0x00, 0xf0, 0x01, 0x9d, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x9d, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0x00, 0x58, 0xfe, 0x38, 0x03, 0xdb, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x2e, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91,
-    0x00, 0x80, 0xfe, 0xe2, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0xe2, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00,
-    0x5c, 0xfe, 0x39, 0x03, 0xe9, 0x06, 0x00, 0x02, 0x26, 0x00, 0x4e, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0x9a,
-    0xfe, 0xe3, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0xe3, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x58, 0x00,
-    0x00, 0x04, 0x4a, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x2e, 0x00, 0x00, 0x01, 0x07, 0x01, 0x68, 0x00, 0xd9, 0xff, 0x9a,
-    0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0x9a, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5c, 0x00, 0x00, 0x05,
-    0x5f, 0x06, 0x04, 0x00, 0x26, 0x00, 0x4e, 0x00, 0x00, 0x01, 0x07, 0x01, 0x68, 0x01, 0xee, 0xff, 0xee, 0x00, 0x09,
-    0xb1, 0x01, 0x01, 0xb8, 0xff, 0xee, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x58, 0x00, 0x00, 0x03, 0xdb, 0x05,
-    0xb0, 0x02, 0x26, 0x00, 0x2e, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x00, 0x0e, 0xfd, 0xc5, 0x00, 0x09, 0xb1, 0x01,
-    0x01, 0xb8, 0xfd, 0xc5, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5c, 0x00, 0x00, 0x04, 0x5f, 0x06, 0x00, 0x00,
-    0x26, 0x00, 0x4e, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x01, 0x18, 0xfd, 0xe7, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8,
-    0xfd, 0xe7, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x22, 0x00, 0x00, 0x04, 0xb3, 0x07, 0x20, 0x02, 0x26, 0x00,
-    0x30, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0xa2, 0x01, 0x57, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x57,
-    0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x40, 0x00, 0x00, 0x04, 0x24, 0x05, 0xde, 0x02, 0x26, 0x00, 0x50, 0x00,
-    0x00, 0x01, 0x06, 0x00, 0x73, 0x79, 0x15, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x15, 0xb0, 0x33, 0x2b, 0xff, 0xff,
-    0x00, 0x22, 0xfe, 0x38, 0x04, 0xb3, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x30, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00,
-    0x4e, 0xfe, 0xe2, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0xe2, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x40,
-    0xfe, 0x38, 0x04, 0x1e, 0x04, 0x4f, 0x02, 0x26, 0x00, 0x50, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0x5d, 0xfe,
-    0xe2, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0xe2, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x22, 0x00, 0x00,
-    0x04, 0xb3, 0x07, 0x4a, 0x02, 0x26, 0x00, 0x30, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9d, 0x00, 0x26, 0x01, 0x5c, 0x00,
-    0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5c, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x40, 0x00, 0x00, 0x04, 0x1e,
-    0x06, 0x08, 0x02, 0x26, 0x00, 0x50, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9d, 0xfe, 0x1a, 0x00, 0x08, 0xb1, 0x01, 0x01,
-    0xb0, 0x1a, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x15, 0x00, 0x00, 0x04, 0x1e, 0x06, 0x16, 0x02, 0x26, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x07, 0x01, 0x68, 0xfd, 0xfd, 0x00, 0x00, 0xff, 0xff, 0x00, 0x66, 0xff, 0xea, 0x04, 0x93, 0x07,
-    0x0f, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6e, 0x00, 0x5e, 0x01, 0x5f, 0x00, 0x09, 0xb1, 0x02,
-    0x01, 0xb8, 0x01, 0x5f, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x60, 0xff, 0xe9, 0x04, 0x46, 0x05, 0xb8, 0x02,
-    0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6e, 0x11, 0x08, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x08, 0xb0,
-    0x33, 0x2b, 0xff, 0xff, 0x00, 0x66, 0xff, 0xea, 0x04, 0x6d, 0x07, 0x60, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01,
-    0x07, 0x00, 0x9e, 0x00, 0x66, 0x01, 0xad, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0xad, 0xb0, 0x33, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x60, 0xff, 0xe9, 0x04, 0x33, 0x06, 0x09, 0x02, 0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x06, 0x00,
-    0x9e, 0x19, 0x56, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x56, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x66, 0xff, 0xea,
-    0x05, 0x34, 0x07, 0x5f, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa3, 0x00, 0xd3, 0x01, 0x70, 0x00,
-    0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x70, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x60, 0xff, 0xe9, 0x04, 0xe7,
-    0x06, 0x08, 0x02, 0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa3, 0x00, 0x86, 0x00, 0x19, 0x00, 0x08, 0xb1,
-    0x02, 0x02, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x47, 0x00, 0x00, 0x04, 0x7f, 0x07, 0x14,
-    0x02, 0x26, 0x00, 0x34, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0xb9, 0x01, 0x4b, 0x00, 0x09, 0xb1, 0x02, 0x01,
-    0xb8, 0x01, 0x4b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xd7, 0x00, 0x00, 0x04, 0x61, 0x05, 0xde, 0x02, 0x26,
-    0x00, 0x54, 0x00, 0x00, 0x01, 0x06, 0x00, 0x73, 0x65, 0x15, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x15, 0xb0, 0x33,
-    0x2b, 0xff, 0xff, 0x00, 0x47, 0xfe, 0x38, 0x04, 0x7f, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x34, 0x00, 0x00, 0x01, 0x07,
-    0x01, 0x91, 0x00, 0x66, 0xfe, 0xe2, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0xfe, 0xe2, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0x00, 0x5e, 0xfe, 0x38, 0x04, 0x61, 0x04, 0x50, 0x02, 0x26, 0x00, 0x54, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91,
-    0xff, 0xb1, 0xfe, 0xe2, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0xe2, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00,
-    0x47, 0x00, 0x00, 0x04, 0x7f, 0x07, 0x3e, 0x02, 0x26, 0x00, 0x34, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9d, 0x00, 0x3d,
-    0x01, 0x50, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x50, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xd7, 0x00,
-    0x00, 0x04, 0x61, 0x06, 0x08, 0x02, 0x26, 0x00, 0x54, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9d, 0xea, 0x1a, 0x00, 0x08,
-    0xb1, 0x01, 0x01, 0xb0, 0x1a, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x53, 0xff, 0xea, 0x04, 0x8d, 0x07, 0x35, 0x02,
-    0x26, 0x00, 0x35, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0xb7, 0x01, 0x6c, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8,
-    0x01, 0x6c, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xea, 0x04, 0x2f, 0x05, 0xde, 0x02, 0x26, 0x00,
-    0x55, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x84, 0x00, 0x15, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x15, 0xb0,
-    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x53, 0xff, 0xea, 0x04, 0x8d, 0x07, 0x5d, 0x02, 0x26, 0x00, 0x35, 0x00,
-    0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0xae, 0x01, 0x70, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x70, 0xb0, 0x33,
-    0x2b, 0x00, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xea, 0x04, 0x28, 0x06, 0x06, 0x02, 0x26, 0x00, 0x55, 0x00, 0x00, 0x01,
-    0x06, 0x00, 0x9c, 0x7b, 0x19, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x53,
-    0xfe, 0x42, 0x04, 0x8d, 0x05, 0xc6, 0x02, 0x26, 0x00, 0x35, 0x00, 0x00, 0x01, 0x06, 0x00, 0x77, 0x57, 0xf7, 0x00,
-    0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf7, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x7c, 0xfe, 0x43,
-    0x04, 0x28, 0x04, 0x4f, 0x02, 0x26, 0x00, 0x55, 0x00, 0x00, 0x01, 0x06, 0x00, 0x77, 0x4a, 0xf8, 0x00, 0x09, 0xb1,
-    0x01, 0x01, 0xb8, 0xff, 0xf8, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x53, 0xfe, 0x24, 0x04, 0x8d,
-    0x05, 0xc6, 0x02, 0x26, 0x00, 0x35, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0x85, 0xfe, 0xce, 0x00, 0x09, 0xb1,
-    0x01, 0x01, 0xb8, 0xfe, 0xce, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x7c, 0xfe, 0x25, 0x04, 0x28, 0x04, 0x4f,
-    0x02, 0x26, 0x00, 0x55, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0x78, 0xfe, 0xcf, 0x00, 0x09, 0xb1, 0x01, 0x01,
-    0xb8, 0xfe, 0xcf, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x53, 0xff, 0xea, 0x04, 0x8d, 0x07, 0x5f, 0x02, 0x26,
-    0x00, 0x35, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9d, 0x00, 0x3b, 0x01, 0x71, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01,
-    0x71, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xea, 0x04, 0x28, 0x06, 0x08, 0x02, 0x26, 0x00, 0x55,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x9d, 0x08, 0x1a, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x1a, 0xb0, 0x33, 0x2b, 0xff,
-    0xff, 0x00, 0xc2, 0xfe, 0x2e, 0x04, 0xf7, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x36, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91,
-    0x00, 0x6b, 0xfe, 0xd8, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0xd8, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00,
-    0xc4, 0xfe, 0x2e, 0x04, 0x36, 0x05, 0x40, 0x02, 0x26, 0x00, 0x56, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0xca,
-    0xfe, 0xd8, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0xd8, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xc2, 0xfe,
-    0x4b, 0x04, 0xf7, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x36, 0x00, 0x00, 0x00, 0x06, 0x00, 0x77, 0x3d, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0xa1, 0xfe, 0x4d, 0x04, 0xaa, 0x04, 0x8d, 0x02, 0x26, 0x01, 0xaf, 0x00, 0x00, 0x01, 0x06, 0x00,
-    0x77, 0x2e, 0x02, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x02, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xc4, 0xfe, 0x4b,
-    0x04, 0x36, 0x05, 0x40, 0x02, 0x26, 0x00, 0x56, 0x00, 0x00, 0x00, 0x07, 0x00, 0x77, 0x00, 0x9c, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xc2, 0x00, 0x00, 0x04, 0xf7, 0x07, 0x3e, 0x02, 0x26, 0x00, 0x36, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9d,
-    0x00, 0x47, 0x01, 0x50, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x50, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00,
-    0xc4, 0xff, 0xeb, 0x05, 0x1c, 0x06, 0xb3, 0x00, 0x26, 0x00, 0x56, 0x00, 0x00, 0x01, 0x07, 0x01, 0x68, 0x01, 0xab,
-    0x00, 0x9d, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x9d, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x68, 0xff,
-    0xea, 0x04, 0xb5, 0x07, 0x45, 0x02, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0xf2, 0x01, 0x55,
-    0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x55, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xea, 0x04,
-    0x54, 0x05, 0xfb, 0x02, 0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0x8c, 0x00, 0x0b, 0x00, 0x08,
-    0xb1, 0x01, 0x01, 0xb0, 0x0b, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x68, 0xff, 0xea, 0x04, 0xb5, 0x06,
-    0xee, 0x02, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6e, 0x00, 0x72, 0x01, 0x3e, 0x00, 0x09, 0xb1, 0x01,
-    0x01, 0xb8, 0x01, 0x3e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xea, 0x04, 0x54, 0x05, 0xa5, 0x02,
-    0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6e, 0x0c, 0xf5, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf5,
-    0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x68, 0xff, 0xea, 0x04, 0xb5, 0x07, 0x3f, 0x02, 0x26, 0x00,
-    0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x7a, 0x01, 0x8c, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x8c,
-    0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xea, 0x04, 0x54, 0x05, 0xf5, 0x02, 0x26, 0x00, 0x57, 0x00,
-    0x00, 0x01, 0x06, 0x00, 0x9e, 0x14, 0x42, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x42, 0xb0, 0x33, 0x2b, 0xff, 0xff,
-    0x00, 0x68, 0xff, 0xea, 0x04, 0xb5, 0x07, 0x80, 0x02, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa0, 0x00,
-    0x71, 0x01, 0x98, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x98, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8d,
-    0xff, 0xea, 0x04, 0x54, 0x06, 0x36, 0x02, 0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x06, 0x00, 0xa0, 0x0b, 0x4e, 0x00,
-    0x08, 0xb1, 0x01, 0x02, 0xb0, 0x4e, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x68, 0xff, 0xea, 0x05, 0x48, 0x07, 0x3e,
-    0x02, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa3, 0x00, 0xe7, 0x01, 0x4f, 0x00, 0x09, 0xb1, 0x01, 0x02,
-    0xb8, 0x01, 0x4f, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xea, 0x04, 0xe2, 0x05, 0xf4, 0x02, 0x26,
-    0x00, 0x57, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa3, 0x00, 0x81, 0x00, 0x05, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x05,
-    0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x69, 0xfe, 0x7e, 0x04, 0xb5, 0x05, 0xb0, 0x00, 0x2d, 0x00, 0x59,
-    0x40, 0x0b, 0x1a, 0x10, 0x02, 0x00, 0x03, 0x11, 0x01, 0x01, 0x00, 0x02, 0x4a, 0x4b, 0xb0, 0x21, 0x50, 0x58, 0x40,
-    0x1a, 0x00, 0x03, 0x02, 0x00, 0x02, 0x03, 0x00, 0x70, 0x05, 0x04, 0x02, 0x02, 0x02, 0x3c, 0x4b, 0x00, 0x00, 0x00,
-    0x01, 0x5c, 0x00, 0x01, 0x01, 0x41, 0x01, 0x4c, 0x1b, 0x40, 0x17, 0x00, 0x03, 0x02, 0x00, 0x02, 0x03, 0x00, 0x70,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x60, 0x05, 0x04, 0x02, 0x02, 0x02, 0x3c, 0x02, 0x4c, 0x59, 0x40, 0x0d, 0x00,
-    0x00, 0x00, 0x2d, 0x00, 0x2d, 0x25, 0x1b, 0x26, 0x1c, 0x06, 0x08, 0x18, 0x2b, 0x01, 0x03, 0x0e, 0x03, 0x07, 0x0e,
-    0x03, 0x07, 0x06, 0x17, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x26, 0x26, 0x37, 0x36, 0x36, 0x37, 0x2e, 0x03,
-    0x37, 0x13, 0x33, 0x03, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x13, 0x04, 0xb5, 0xa7, 0x0c, 0x3e, 0x5e,
-    0x7b, 0x49, 0x19, 0x2e, 0x25, 0x18, 0x03, 0x06, 0x3f, 0x1a, 0x32, 0x17, 0x15, 0x26, 0x55, 0x2c, 0x51, 0x5c, 0x02,
-    0x02, 0x32, 0x26, 0x5c, 0x8c, 0x5c, 0x27, 0x0a, 0xaa, 0xac, 0xa5, 0x07, 0x12, 0x36, 0x5b, 0x43, 0x47, 0x75, 0x57,
-    0x38, 0x0c, 0xac, 0x05, 0xb0, 0xfc, 0x27, 0x4f, 0x92, 0x7a, 0x5c, 0x19, 0x11, 0x28, 0x2e, 0x35, 0x1e, 0x42, 0x01,
-    0x02, 0x10, 0x0b, 0x7b, 0x16, 0x14, 0x01, 0x01, 0x64, 0x51, 0x37, 0x5c, 0x26, 0x09, 0x56, 0x86, 0xa8, 0x5a, 0x03,
-    0xdb, 0xfc, 0x25, 0x3b, 0x74, 0x5e, 0x3d, 0x02, 0x02, 0x37, 0x5e, 0x7a, 0x40, 0x03, 0xda, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x8d, 0xfe, 0x4f, 0x04, 0x54, 0x04, 0x3a, 0x00, 0x2e, 0x00, 0x35, 0x40, 0x32, 0x18, 0x01, 0x04, 0x03, 0x0b,
-    0x01, 0x00, 0x02, 0x0c, 0x01, 0x01, 0x00, 0x03, 0x4a, 0x05, 0x01, 0x03, 0x03, 0x3f, 0x4b, 0x00, 0x04, 0x04, 0x02,
-    0x5c, 0x00, 0x02, 0x02, 0x45, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x49, 0x01, 0x4c, 0x13, 0x25,
-    0x15, 0x2a, 0x26, 0x17, 0x06, 0x08, 0x1a, 0x2b, 0x21, 0x17, 0x0e, 0x03, 0x07, 0x06, 0x17, 0x16, 0x36, 0x37, 0x17,
-    0x06, 0x06, 0x27, 0x26, 0x26, 0x37, 0x3e, 0x03, 0x37, 0x37, 0x06, 0x06, 0x27, 0x2e, 0x03, 0x37, 0x13, 0x33, 0x03,
-    0x06, 0x06, 0x16, 0x16, 0x17, 0x16, 0x36, 0x37, 0x13, 0x33, 0x03, 0x03, 0x92, 0x05, 0x20, 0x42, 0x38, 0x27, 0x04,
-    0x06, 0x3f, 0x1a, 0x32, 0x17, 0x15, 0x26, 0x55, 0x2c, 0x51, 0x5c, 0x02, 0x01, 0x22, 0x38, 0x46, 0x25, 0x15, 0x40,
-    0xa6, 0x69, 0x61, 0x7b, 0x43, 0x11, 0x09, 0x6c, 0xb5, 0x6b, 0x06, 0x02, 0x1d, 0x44, 0x3f, 0x64, 0x9a, 0x35, 0x87,
-    0xb6, 0xbc, 0x03, 0x11, 0x2d, 0x37, 0x43, 0x27, 0x42, 0x01, 0x02, 0x10, 0x0b, 0x7b, 0x16, 0x14, 0x01, 0x01, 0x64,
-    0x51, 0x2d, 0x4d, 0x43, 0x37, 0x17, 0x84, 0x4f, 0x5c, 0x02, 0x02, 0x51, 0x82, 0xa3, 0x53, 0x02, 0x83, 0xfd, 0x7a,
-    0x32, 0x69, 0x56, 0x38, 0x02, 0x03, 0x59, 0x52, 0x03, 0x09, 0xfb, 0xc6, 0xff, 0xff, 0x00, 0x95, 0x00, 0x00, 0x05,
-    0x03, 0x07, 0x48, 0x02, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0xa6, 0x01, 0x5b, 0x00, 0x09,
-    0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x84, 0x00, 0x00, 0x04, 0xda, 0x05,
-    0xf2, 0x02, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9c, 0x7b, 0x05, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0,
-    0x05, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xd4, 0x00, 0x00, 0x04, 0xf1, 0x07, 0x47, 0x02, 0x26, 0x00, 0x3b, 0x00,
-    0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0xab, 0x01, 0x5a, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5a, 0xb0, 0x33,
-    0x2b, 0x00, 0xff, 0xff, 0xff, 0xe4, 0xfe, 0x48, 0x04, 0xbc, 0x05, 0xf2, 0x02, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01,
-    0x07, 0x00, 0x9c, 0x00, 0x88, 0x00, 0x05, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x05, 0xb0, 0x33, 0x2b, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0xd4, 0x00, 0x00, 0x04, 0xf1, 0x07, 0x21, 0x02, 0x26, 0x00, 0x3b, 0x00, 0x00, 0x01, 0x07, 0x00,
-    0x68, 0x00, 0x42, 0x01, 0x5a, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x5a, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff,
-    0x00, 0x13, 0x00, 0x00, 0x04, 0x81, 0x07, 0x14, 0x02, 0x26, 0x00, 0x3c, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00,
-    0xcc, 0x01, 0x4b, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x4b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x3d,
-    0x00, 0x00, 0x04, 0x46, 0x05, 0xca, 0x02, 0x26, 0x00, 0x5c, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x96, 0x00,
-    0x01, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x01, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x13, 0x00, 0x00,
-    0x04, 0x81, 0x07, 0x0f, 0x02, 0x26, 0x00, 0x3c, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x00, 0x4f, 0x01, 0x4f, 0x00,
-    0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x4f, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x3d, 0x00, 0x00, 0x04, 0x46,
-    0x05, 0xc5, 0x02, 0x26, 0x00, 0x5c, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9f, 0x19, 0x05, 0x00, 0x08, 0xb1, 0x01, 0x01,
-    0xb0, 0x05, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x13, 0x00, 0x00, 0x04, 0x81, 0x07, 0x3e, 0x02, 0x26, 0x00, 0x3c,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x9d, 0x00, 0x50, 0x01, 0x50, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x50, 0xb0,
-    0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x3d, 0x00, 0x00, 0x04, 0x46, 0x05, 0xf4, 0x02, 0x26, 0x00, 0x5c, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x9d, 0x1a, 0x06, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x06, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0xff,
-    0xb2, 0x00, 0x00, 0x05, 0x06, 0x07, 0x20, 0x02, 0x26, 0x00, 0x7f, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x01, 0x18,
-    0x01, 0x57, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x57, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0xff, 0xf1, 0xff,
-    0xeb, 0x04, 0xa0, 0x05, 0xdf, 0x02, 0x26, 0x00, 0x84, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0xa3, 0x00, 0x16,
-    0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x16, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0xff, 0xc6, 0xff, 0xa3, 0x05,
-    0x0f, 0x07, 0x5e, 0x02, 0x26, 0x00, 0x81, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0xc9, 0x01, 0x95, 0x00, 0x09,
-    0xb1, 0x03, 0x01, 0xb8, 0x01, 0x95, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x56, 0xff, 0x79, 0x04, 0x46, 0x05,
-    0xdd, 0x02, 0x26, 0x00, 0x87, 0x00, 0x00, 0x01, 0x06, 0x00, 0x73, 0x5d, 0x14, 0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0,
-    0x14, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0xff, 0xd9, 0x00, 0x00, 0x04, 0x3d, 0x04, 0x8d, 0x02, 0x26, 0x01, 0xa0, 0x00,
-    0x00, 0x01, 0x07, 0x01, 0xca, 0xfe, 0xa5, 0xff, 0x78, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0xff, 0x78, 0xb0, 0x33,
-    0x2b, 0x00, 0xff, 0xff, 0xff, 0xd9, 0x00, 0x00, 0x04, 0x3d, 0x04, 0x8d, 0x02, 0x26, 0x01, 0xa0, 0x00, 0x00, 0x01,
-    0x07, 0x01, 0xca, 0xfe, 0xa5, 0xff, 0x78, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0xff, 0x78, 0xb0, 0x33, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0xa1, 0x00, 0x00, 0x04, 0xaa, 0x04, 0x8d, 0x02, 0x26, 0x01, 0xaf, 0x00, 0x00, 0x01, 0x06, 0x01,
-    0xca, 0xee, 0xe0, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xe0, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xc7, 0x00, 0x00, 0x04, 0x00, 0x05, 0xff, 0x02, 0x26, 0x01, 0x9d, 0x00, 0x00, 0x01, 0x06, 0x00, 0x42, 0xa3,
-    0x36, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x36, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0xff, 0xc7, 0x00, 0x00, 0x04, 0x33,
-    0x05, 0xfc, 0x02, 0x26, 0x01, 0x9d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x88, 0x00, 0x33, 0x00, 0x08, 0xb1,
-    0x02, 0x01, 0xb0, 0x33, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0xff, 0xc7, 0x00, 0x00, 0x04, 0x00, 0x06, 0x24,
-    0x02, 0x26, 0x01, 0x9d, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9c, 0x7f, 0x37, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x37,
-    0xb0, 0x33, 0x2b, 0xff, 0xff, 0xff, 0xc7, 0x00, 0x00, 0x04, 0x42, 0x06, 0x2d, 0x02, 0x26, 0x01, 0x9d, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa2, 0x00, 0x97, 0x00, 0x3d, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x3d, 0xb0, 0x33, 0x2b, 0x00,
-    0x00, 0xff, 0xff, 0xff, 0xc7, 0x00, 0x00, 0x04, 0x1b, 0x05, 0xfe, 0x02, 0x26, 0x01, 0x9d, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0x68, 0x16, 0x37, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0xff, 0xc7, 0x00,
-    0x00, 0x04, 0x00, 0x06, 0x68, 0x02, 0x26, 0x01, 0x9d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa0, 0x00, 0x16, 0x00, 0x80,
-    0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x80, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0xff, 0xc7, 0x00, 0x00, 0x04,
-    0x50, 0x06, 0xf3, 0x02, 0x26, 0x01, 0x9d, 0x00, 0x00, 0x01, 0x07, 0x01, 0xcb, 0x00, 0x04, 0x00, 0x82, 0x00, 0x08,
-    0xb1, 0x02, 0x03, 0xb0, 0x82, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x55, 0xfe, 0x48, 0x04, 0x37, 0x04,
-    0xa0, 0x02, 0x26, 0x01, 0x9f, 0x00, 0x00, 0x01, 0x06, 0x00, 0x77, 0x28, 0xfd, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8,
-    0xff, 0xfd, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x59, 0x00, 0x00, 0x04, 0x61, 0x05, 0xff, 0x02,
-    0x26, 0x01, 0xa1, 0x00, 0x00, 0x01, 0x06, 0x00, 0x42, 0x86, 0x36, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x36, 0xb0,
-    0x33, 0x2b, 0xff, 0xff, 0x00, 0x59, 0x00, 0x00, 0x04, 0x61, 0x05, 0xfc, 0x02, 0x26, 0x01, 0xa1, 0x00, 0x00, 0x01,
-    0x06, 0x00, 0x73, 0x6b, 0x33, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x33, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x59,
-    0x00, 0x00, 0x04, 0x61, 0x06, 0x24, 0x02, 0x26, 0x01, 0xa1, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9c, 0x62, 0x37, 0x00,
-    0x08, 0xb1, 0x01, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x59, 0x00, 0x00, 0x04, 0x61, 0x05, 0xfe,
-    0x02, 0x26, 0x01, 0xa1, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0xfa, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x37,
-    0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x6a, 0x00, 0x00, 0x04, 0x54, 0x05, 0xe3, 0x02, 0x26, 0x01, 0xa5, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x42, 0xb8, 0x1a, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x1a, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00,
-    0x6a, 0x00, 0x00, 0x04, 0x54, 0x05, 0xe0, 0x02, 0x26, 0x01, 0xa5, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x9d,
-    0x00, 0x17, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x17, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x6a, 0x00,
-    0x00, 0x04, 0x54, 0x06, 0x08, 0x02, 0x26, 0x01, 0xa5, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0x94, 0x00, 0x1b,
-    0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x1b, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x6a, 0x00, 0x00, 0x04,
-    0x54, 0x05, 0xe2, 0x02, 0x26, 0x01, 0xa5, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x2b, 0x1b, 0x00, 0x08, 0xb1, 0x01,
-    0x02, 0xb0, 0x1b, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x54, 0x00, 0x00, 0x04, 0x96, 0x06, 0x2d, 0x02, 0x26, 0x01,
-    0xaa, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0xeb, 0x00, 0x3d, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x3d, 0xb0,
-    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x71, 0xff, 0xed, 0x04, 0x32, 0x05, 0xff, 0x02, 0x26, 0x01, 0xab, 0x00,
-    0x00, 0x01, 0x06, 0x00, 0x42, 0xc4, 0x36, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x36, 0xb0, 0x33, 0x2b, 0xff, 0xff,
-    0x00, 0x71, 0xff, 0xed, 0x04, 0x54, 0x05, 0xfc, 0x02, 0x26, 0x01, 0xab, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00,
-    0xa9, 0x00, 0x33, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x33, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x71,
-    0xff, 0xed, 0x04, 0x32, 0x06, 0x24, 0x02, 0x26, 0x01, 0xab, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0xa0, 0x00,
-    0x37, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x71, 0xff, 0xed,
-    0x04, 0x63, 0x06, 0x2d, 0x02, 0x26, 0x01, 0xab, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0xb8, 0x00, 0x3d, 0x00,
-    0x08, 0xb1, 0x02, 0x01, 0xb0, 0x3d, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x71, 0xff, 0xed, 0x04, 0x3c,
-    0x05, 0xfe, 0x02, 0x26, 0x01, 0xab, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x37, 0x37, 0x00, 0x08, 0xb1, 0x02, 0x02,
-    0xb0, 0x37, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x86, 0xff, 0xee, 0x04, 0x6d, 0x05, 0xff, 0x02, 0x26, 0x01, 0xb0,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x42, 0xc0, 0x36, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x36, 0xb0, 0x33, 0x2b, 0xff,
-    0xff, 0x00, 0x86, 0xff, 0xee, 0x04, 0x6d, 0x05, 0xfc, 0x02, 0x26, 0x01, 0xb0, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73,
-    0x00, 0xa5, 0x00, 0x33, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x33, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0x86, 0xff, 0xee, 0x04, 0x6d, 0x06, 0x24, 0x02, 0x26, 0x01, 0xb0, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0x9c,
-    0x00, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x86, 0xff,
-    0xee, 0x04, 0x6d, 0x05, 0xfe, 0x02, 0x26, 0x01, 0xb0, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x33, 0x37, 0x00, 0x08,
-    0xb1, 0x01, 0x02, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xb2, 0x00, 0x00, 0x04, 0xc7, 0x05, 0xfc, 0x02,
-    0x26, 0x01, 0xb4, 0x00, 0x00, 0x01, 0x06, 0x00, 0x73, 0x74, 0x33, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x33, 0xb0,
-    0x33, 0x2b, 0xff, 0xff, 0xff, 0xc7, 0x00, 0x00, 0x04, 0x4c, 0x05, 0xd6, 0x02, 0x26, 0x01, 0x9d, 0x00, 0x00, 0x01,
-    0x06, 0x00, 0x6e, 0x17, 0x26, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x26, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0xff, 0xc7,
-    0x00, 0x00, 0x04, 0x17, 0x06, 0x27, 0x02, 0x26, 0x01, 0x9d, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x1f, 0x74, 0x00,
-    0x08, 0xb1, 0x02, 0x01, 0xb0, 0x74, 0xb0, 0x33, 0x2b, 0x00, 0x02, 0xff, 0xc7, 0xfe, 0x4f, 0x04, 0x00, 0x04, 0x8d,
-    0x00, 0x1e, 0x00, 0x21, 0x00, 0x44, 0x40, 0x41, 0x21, 0x01, 0x06, 0x04, 0x17, 0x01, 0x03, 0x02, 0x0b, 0x01, 0x00,
-    0x03, 0x0c, 0x01, 0x01, 0x00, 0x04, 0x4a, 0x00, 0x04, 0x06, 0x04, 0x72, 0x00, 0x06, 0x00, 0x02, 0x03, 0x06, 0x02,
-    0x62, 0x07, 0x05, 0x02, 0x03, 0x03, 0x3d, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x49, 0x01, 0x4c,
-    0x00, 0x00, 0x20, 0x1f, 0x00, 0x1e, 0x00, 0x1e, 0x11, 0x11, 0x18, 0x26, 0x17, 0x08, 0x08, 0x19, 0x2b, 0x21, 0x17,
-    0x0e, 0x03, 0x07, 0x06, 0x17, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x26, 0x26, 0x37, 0x3e, 0x03, 0x37, 0x03,
-    0x21, 0x03, 0x23, 0x01, 0x33, 0x13, 0x01, 0x21, 0x03, 0x03, 0xdc, 0x05, 0x20, 0x42, 0x38, 0x27, 0x04, 0x06, 0x3f,
-    0x1a, 0x32, 0x17, 0x15, 0x26, 0x55, 0x2c, 0x51, 0x5c, 0x02, 0x01, 0x25, 0x3a, 0x4a, 0x27, 0x34, 0xfe, 0x0b, 0x9c,
-    0xc0, 0x02, 0x9a, 0xa1, 0xfe, 0xfd, 0x77, 0x01, 0x82, 0x68, 0x03, 0x11, 0x2d, 0x37, 0x43, 0x27, 0x42, 0x01, 0x02,
-    0x10, 0x0b, 0x7b, 0x16, 0x14, 0x01, 0x01, 0x64, 0x51, 0x2e, 0x50, 0x44, 0x38, 0x17, 0x01, 0x00, 0xfe, 0xe9, 0x04,
-    0x8d, 0xfb, 0x73, 0x01, 0xae, 0x01, 0xf9, 0xff, 0xff, 0x00, 0x55, 0xff, 0xed, 0x04, 0x37, 0x05, 0xfc, 0x02, 0x26,
-    0x01, 0x9f, 0x00, 0x00, 0x01, 0x06, 0x00, 0x73, 0x79, 0x33, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x33, 0xb0, 0x33,
-    0x2b, 0xff, 0xff, 0x00, 0x55, 0xff, 0xed, 0x04, 0x37, 0x06, 0x24, 0x02, 0x26, 0x01, 0x9f, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0x9c, 0x70, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x55, 0xff,
-    0xed, 0x04, 0x37, 0x05, 0xf7, 0x02, 0x26, 0x01, 0x9f, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9f, 0xfd, 0x37, 0x00, 0x08,
-    0xb1, 0x01, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x55, 0xff, 0xed, 0x04, 0x37, 0x06, 0x26, 0x02,
-    0x26, 0x01, 0x9f, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9d, 0xfe, 0x38, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x38, 0xb0,
-    0x33, 0x2b, 0xff, 0xff, 0x00, 0x49, 0x00, 0x00, 0x04, 0x3d, 0x06, 0x26, 0x02, 0x26, 0x01, 0xa0, 0x00, 0x00, 0x01,
-    0x06, 0x00, 0x9d, 0xc7, 0x38, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x38, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x59,
-    0x00, 0x00, 0x04, 0x61, 0x05, 0xd6, 0x02, 0x26, 0x01, 0xa1, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6e, 0xfb, 0x26, 0x00,
-    0x08, 0xb1, 0x01, 0x01, 0xb0, 0x26, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x59, 0x00, 0x00, 0x04, 0x61, 0x06, 0x27,
-    0x02, 0x26, 0x01, 0xa1, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x02, 0x74, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x74,
-    0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x59, 0x00, 0x00, 0x04, 0x61, 0x05, 0xf7, 0x02, 0x26, 0x01, 0xa1, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x9f, 0xef, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0x00, 0x01, 0x00,
-    0x59, 0xfe, 0x4f, 0x04, 0x61, 0x04, 0x8d, 0x00, 0x23, 0x00, 0x3f, 0x40, 0x3c, 0x10, 0x01, 0x03, 0x02, 0x11, 0x01,
-    0x04, 0x03, 0x02, 0x4a, 0x00, 0x06, 0x00, 0x07, 0x08, 0x06, 0x07, 0x61, 0x00, 0x08, 0x00, 0x00, 0x01, 0x08, 0x00,
-    0x61, 0x00, 0x01, 0x01, 0x02, 0x59, 0x05, 0x01, 0x02, 0x02, 0x3d, 0x4b, 0x00, 0x03, 0x03, 0x04, 0x5b, 0x00, 0x04,
-    0x04, 0x49, 0x04, 0x4c, 0x11, 0x11, 0x11, 0x17, 0x26, 0x17, 0x11, 0x11, 0x10, 0x09, 0x08, 0x1d, 0x2b, 0x01, 0x21,
-    0x03, 0x21, 0x07, 0x23, 0x17, 0x0e, 0x03, 0x07, 0x06, 0x17, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x26, 0x26,
-    0x37, 0x3e, 0x03, 0x37, 0x21, 0x13, 0x21, 0x07, 0x21, 0x03, 0x21, 0x03, 0x9c, 0xfd, 0xd2, 0x42, 0x02, 0x8b, 0x1b,
-    0x88, 0x05, 0x20, 0x42, 0x38, 0x27, 0x04, 0x06, 0x3f, 0x1a, 0x32, 0x17, 0x15, 0x26, 0x55, 0x2c, 0x51, 0x5c, 0x02,
-    0x01, 0x1d, 0x2f, 0x3d, 0x21, 0xfd, 0xfb, 0xcb, 0x03, 0x3d, 0x1c, 0xfd, 0x7d, 0x3a, 0x02, 0x2f, 0x02, 0x0e, 0xfe,
-    0x89, 0x97, 0x03, 0x11, 0x2d, 0x37, 0x43, 0x27, 0x42, 0x01, 0x02, 0x10, 0x0b, 0x7b, 0x16, 0x14, 0x01, 0x01, 0x64,
-    0x51, 0x28, 0x48, 0x3f, 0x35, 0x16, 0x04, 0x8d, 0x99, 0xfe, 0xb2, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x59, 0x00,
-    0x00, 0x04, 0x61, 0x06, 0x26, 0x02, 0x26, 0x01, 0xa1, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9d, 0xf0, 0x38, 0x00, 0x08,
-    0xb1, 0x01, 0x01, 0xb0, 0x38, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x64, 0xff, 0xef, 0x04, 0x47, 0x06, 0x24, 0x02,
-    0x26, 0x01, 0xa3, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9c, 0x7a, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x37, 0xb0,
-    0x33, 0x2b, 0xff, 0xff, 0x00, 0x64, 0xff, 0xef, 0x04, 0x47, 0x06, 0x27, 0x02, 0x26, 0x01, 0xa3, 0x00, 0x00, 0x01,
-    0x06, 0x00, 0x9e, 0x1a, 0x74, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x74, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x64,
-    0xff, 0xef, 0x04, 0x47, 0x05, 0xf7, 0x02, 0x26, 0x01, 0xa3, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9f, 0x06, 0x37, 0x00,
-    0x08, 0xb1, 0x01, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x64, 0xfe, 0x2b, 0x04, 0x47, 0x04, 0xa0,
-    0x02, 0x26, 0x01, 0xa3, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0x64, 0xfe, 0xd5, 0x00, 0x09, 0xb1, 0x01, 0x01,
-    0xb8, 0xfe, 0xd5, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x2e, 0x00, 0x00, 0x04, 0x3e, 0x06, 0x24, 0x02, 0x26,
-    0x01, 0xa4, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0xa3, 0x00, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x37,
-    0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x6a, 0x00, 0x00, 0x04, 0x57, 0x06, 0x11, 0x02, 0x26, 0x01, 0xa5,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0xac, 0x00, 0x21, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x21, 0xb0, 0x33,
-    0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x6a, 0x00, 0x00, 0x04, 0x61, 0x05, 0xba, 0x02, 0x26, 0x01, 0xa5, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x6e, 0x2c, 0x0a, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x0a, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00,
-    0x6a, 0x00, 0x00, 0x04, 0x54, 0x06, 0x0b, 0x02, 0x26, 0x01, 0xa5, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x34, 0x58,
-    0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x58, 0xb0, 0x33, 0x2b, 0x00, 0x01, 0x00, 0x6a, 0xfe, 0x4f, 0x04, 0x54, 0x04,
-    0x8c, 0x00, 0x23, 0x00, 0x39, 0x40, 0x36, 0x12, 0x01, 0x04, 0x03, 0x13, 0x01, 0x05, 0x04, 0x02, 0x4a, 0x00, 0x00,
-    0x08, 0x01, 0x01, 0x02, 0x00, 0x01, 0x61, 0x07, 0x01, 0x02, 0x02, 0x03, 0x59, 0x06, 0x01, 0x03, 0x03, 0x3d, 0x4b,
-    0x00, 0x04, 0x04, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x49, 0x05, 0x4c, 0x11, 0x11, 0x17, 0x26, 0x17, 0x11, 0x11, 0x11,
-    0x10, 0x09, 0x08, 0x1d, 0x2b, 0x01, 0x21, 0x07, 0x21, 0x03, 0x21, 0x07, 0x23, 0x17, 0x0e, 0x03, 0x07, 0x06, 0x17,
-    0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x26, 0x26, 0x37, 0x3e, 0x03, 0x37, 0x21, 0x37, 0x21, 0x13, 0x21, 0x01,
-    0x34, 0x03, 0x20, 0x1d, 0xfe, 0xc7, 0x92, 0x01, 0x3a, 0x1d, 0x81, 0x05, 0x20, 0x42, 0x38, 0x27, 0x04, 0x06, 0x3f,
-    0x1a, 0x32, 0x17, 0x15, 0x26, 0x55, 0x2c, 0x51, 0x5c, 0x02, 0x01, 0x1d, 0x2f, 0x3d, 0x21, 0xfe, 0x18, 0x1c, 0x01,
-    0x31, 0x93, 0xfe, 0xce, 0x04, 0x8c, 0xa1, 0xfc, 0xb5, 0xa0, 0x03, 0x11, 0x2d, 0x37, 0x43, 0x27, 0x42, 0x01, 0x02,
-    0x10, 0x0b, 0x7b, 0x16, 0x14, 0x01, 0x01, 0x64, 0x51, 0x28, 0x48, 0x3f, 0x35, 0x16, 0xa0, 0x03, 0x4b, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x6a, 0x00, 0x00, 0x04, 0x54, 0x05, 0xdb, 0x02, 0x26, 0x01, 0xa5, 0x00, 0x00, 0x01, 0x06, 0x00,
-    0x9f, 0x20, 0x1b, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x1b, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x68, 0xff, 0xee,
-    0x04, 0xd5, 0x06, 0x24, 0x02, 0x26, 0x01, 0xa6, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x01, 0x58, 0x00, 0x37, 0x00,
-    0x08, 0xb1, 0x01, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x46, 0xfe, 0x34, 0x04, 0xa7,
-    0x04, 0x8d, 0x02, 0x26, 0x01, 0xa7, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0x35, 0xfe, 0xde, 0x00, 0x09, 0xb1,
-    0x01, 0x01, 0xb8, 0xfe, 0xde, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x62, 0x00, 0x00, 0x03, 0xe4, 0x05, 0xfc,
-    0x02, 0x26, 0x01, 0xa8, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0xff, 0x37, 0x00, 0x33, 0x00, 0x08, 0xb1, 0x01, 0x01,
-    0xb0, 0x33, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x62, 0xfe, 0x36, 0x03, 0xe4, 0x04, 0x8d, 0x02, 0x26,
-    0x01, 0xa8, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0x33, 0xfe, 0xe0, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe,
-    0xe0, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x62, 0x00, 0x00, 0x03, 0xe4, 0x04, 0x8d, 0x02, 0x26, 0x01, 0xa8,
-    0x00, 0x00, 0x01, 0x07, 0x01, 0x68, 0x00, 0x4b, 0xfe, 0x77, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0x77, 0xb0,
-    0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x62, 0x00, 0x00, 0x03, 0xe4, 0x04, 0x8d, 0x02, 0x26, 0x01, 0xa8, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x9f, 0xff, 0x9e, 0xfd, 0x37, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfd, 0x37, 0xb0, 0x33, 0x2b,
-    0x00, 0xff, 0xff, 0x00, 0x54, 0x00, 0x00, 0x04, 0x87, 0x05, 0xfc, 0x02, 0x26, 0x01, 0xaa, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x73, 0x00, 0xdc, 0x00, 0x33, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x33, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x54, 0xfe, 0x32, 0x04, 0x53, 0x04, 0x8d, 0x02, 0x26, 0x01, 0xaa, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91,
-    0x00, 0xb5, 0xfe, 0xdc, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0xdc, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00,
-    0x54, 0x00, 0x00, 0x04, 0x7d, 0x06, 0x26, 0x02, 0x26, 0x01, 0xaa, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9d, 0x60, 0x38,
-    0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x38, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x71, 0xff, 0xed, 0x04, 0x6d, 0x05,
-    0xd6, 0x02, 0x26, 0x01, 0xab, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6e, 0x38, 0x26, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0,
-    0x26, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x71, 0xff, 0xed, 0x04, 0x38, 0x06, 0x27, 0x02, 0x26, 0x01, 0xab, 0x00,
-    0x00, 0x01, 0x06, 0x00, 0x9e, 0x40, 0x74, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x74, 0xb0, 0x33, 0x2b, 0xff, 0xff,
-    0x00, 0x71, 0xff, 0xed, 0x05, 0x0e, 0x06, 0x26, 0x02, 0x26, 0x01, 0xab, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa3, 0x00,
-    0xad, 0x00, 0x37, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x23,
-    0x00, 0x00, 0x04, 0x03, 0x05, 0xfc, 0x02, 0x26, 0x01, 0xad, 0x00, 0x00, 0x01, 0x06, 0x00, 0x73, 0x32, 0x33, 0x00,
-    0x08, 0xb1, 0x02, 0x01, 0xb0, 0x33, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x23, 0xfe, 0x36, 0x04, 0x03, 0x04, 0x8d,
-    0x02, 0x26, 0x01, 0xad, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0x11, 0xfe, 0xe0, 0x00, 0x09, 0xb1, 0x02, 0x01,
-    0xb8, 0xfe, 0xe0, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x23, 0x00, 0x00, 0x04, 0x03, 0x06, 0x26, 0x02, 0x26,
-    0x01, 0xad, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9d, 0xb7, 0x38, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x38, 0xb0, 0x33,
-    0x2b, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xef, 0x04, 0x3b, 0x05, 0xfc, 0x02, 0x26, 0x01, 0xae, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0x73, 0x76, 0x33, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x33, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x5e, 0xff,
-    0xef, 0x04, 0x3b, 0x06, 0x24, 0x02, 0x26, 0x01, 0xae, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9c, 0x6d, 0x37, 0x00, 0x08,
-    0xb1, 0x01, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x5e, 0xfe, 0x4b, 0x04, 0x3b, 0x04, 0x9e, 0x02,
-    0x26, 0x01, 0xae, 0x00, 0x00, 0x00, 0x06, 0x00, 0x77, 0x45, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xef,
-    0x04, 0x3b, 0x06, 0x26, 0x02, 0x26, 0x01, 0xae, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9d, 0xfb, 0x38, 0x00, 0x08, 0xb1,
-    0x01, 0x01, 0xb0, 0x38, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xa1, 0xfe, 0x30, 0x04, 0xaa, 0x04, 0x8d, 0x02, 0x26,
-    0x01, 0xaf, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0x5c, 0xfe, 0xda, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe,
-    0xda, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xa1, 0x00, 0x00, 0x04, 0xaa, 0x06, 0x26, 0x02, 0x26, 0x01, 0xaf,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x9d, 0x02, 0x38, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x38, 0xb0, 0x33, 0x2b, 0xff,
-    0xff, 0x00, 0x86, 0xff, 0xee, 0x04, 0x6d, 0x06, 0x2d, 0x02, 0x26, 0x01, 0xb0, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2,
-    0x00, 0xb4, 0x00, 0x3d, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x3d, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0x86, 0xff, 0xee, 0x04, 0x6d, 0x05, 0xd6, 0x02, 0x26, 0x01, 0xb0, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6e, 0x34, 0x26,
-    0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x26, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x86, 0xff, 0xee, 0x04, 0x6d, 0x06,
-    0x27, 0x02, 0x26, 0x01, 0xb0, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x3c, 0x74, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0,
-    0x74, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x86, 0xff, 0xee, 0x04, 0x6d, 0x06, 0x68, 0x02, 0x26, 0x01, 0xb0, 0x00,
-    0x00, 0x01, 0x07, 0x00, 0xa0, 0x00, 0x33, 0x00, 0x80, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x80, 0xb0, 0x33, 0x2b,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x86, 0xff, 0xee, 0x05, 0x0a, 0x06, 0x26, 0x02, 0x26, 0x01, 0xb0, 0x00, 0x00, 0x01,
-    0x07, 0x00, 0xa3, 0x00, 0xa9, 0x00, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x86, 0xfe, 0x8c, 0x04, 0x6d, 0x04, 0x8d, 0x00, 0x2d, 0x00, 0x5d, 0x40, 0x0a, 0x10, 0x01, 0x00,
-    0x02, 0x11, 0x01, 0x01, 0x00, 0x02, 0x4a, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x1c, 0x06, 0x05, 0x02, 0x03, 0x04,
-    0x03, 0x72, 0x00, 0x04, 0x04, 0x02, 0x5c, 0x00, 0x02, 0x02, 0x45, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x5b, 0x00, 0x01,
-    0x01, 0x41, 0x01, 0x4c, 0x1b, 0x40, 0x19, 0x06, 0x05, 0x02, 0x03, 0x04, 0x03, 0x72, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x01, 0x5f, 0x00, 0x04, 0x04, 0x02, 0x5c, 0x00, 0x02, 0x02, 0x45, 0x02, 0x4c, 0x59, 0x40, 0x0e, 0x00, 0x00, 0x00,
-    0x2d, 0x00, 0x2d, 0x25, 0x15, 0x15, 0x26, 0x1c, 0x07, 0x08, 0x19, 0x2b, 0x01, 0x03, 0x0e, 0x03, 0x07, 0x0e, 0x03,
-    0x07, 0x06, 0x17, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x26, 0x26, 0x37, 0x36, 0x36, 0x37, 0x2e, 0x03, 0x37,
-    0x13, 0x33, 0x03, 0x06, 0x1e, 0x02, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x13, 0x04, 0x6d, 0x82, 0x0a, 0x35, 0x4f, 0x67,
-    0x3c, 0x17, 0x2b, 0x21, 0x16, 0x03, 0x06, 0x3f, 0x1a, 0x32, 0x17, 0x15, 0x26, 0x55, 0x2c, 0x51, 0x5c, 0x02, 0x02,
-    0x2b, 0x22, 0x52, 0x88, 0x5e, 0x2e, 0x08, 0x84, 0xb1, 0x83, 0x06, 0x15, 0x34, 0x52, 0x37, 0x3a, 0x64, 0x4d, 0x33,
-    0x0a, 0x86, 0x04, 0x8d, 0xfc, 0xf6, 0x44, 0x76, 0x60, 0x47, 0x15, 0x10, 0x26, 0x2d, 0x33, 0x1c, 0x42, 0x01, 0x02,
-    0x10, 0x0b, 0x7b, 0x16, 0x14, 0x01, 0x01, 0x64, 0x51, 0x33, 0x56, 0x25, 0x05, 0x3e, 0x69, 0x8e, 0x56, 0x03, 0x0c,
-    0xfc, 0xf3, 0x35, 0x5a, 0x42, 0x27, 0x01, 0x02, 0x23, 0x42, 0x5d, 0x39, 0x03, 0x0d, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0x91, 0x00, 0x00, 0x04, 0xfc, 0x06, 0x24, 0x02, 0x26, 0x01, 0xb2, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x01, 0x2e,
-    0x00, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb2, 0x00,
-    0x00, 0x04, 0xc7, 0x06, 0x24, 0x02, 0x26, 0x01, 0xb4, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9c, 0x6b, 0x37, 0x00, 0x08,
-    0xb1, 0x01, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xb2, 0x00, 0x00, 0x04, 0xc7, 0x05, 0xfe, 0x02,
-    0x26, 0x01, 0xb4, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x02, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x37, 0xb0,
-    0x33, 0x2b, 0xff, 0xff, 0x00, 0x55, 0x00, 0x00, 0x04, 0x62, 0x05, 0xfc, 0x02, 0x26, 0x01, 0xb5, 0x00, 0x00, 0x01,
-    0x07, 0x00, 0x73, 0x00, 0xa3, 0x00, 0x33, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x33, 0xb0, 0x33, 0x2b, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x55, 0x00, 0x00, 0x04, 0x62, 0x05, 0xf7, 0x02, 0x26, 0x01, 0xb5, 0x00, 0x00, 0x01, 0x06, 0x00,
-    0x9f, 0x26, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x55, 0x00, 0x00,
-    0x04, 0x62, 0x06, 0x26, 0x02, 0x26, 0x01, 0xb5, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9d, 0x27, 0x38, 0x00, 0x08, 0xb1,
-    0x01, 0x01, 0xb0, 0x38, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x04, 0x02, 0x06, 0x7a, 0x02, 0x26,
-    0x00, 0x23, 0x00, 0x00, 0x00, 0x07, 0x00, 0xab, 0xfe, 0xca, 0x00, 0x00, 0xff, 0xff, 0x00, 0x83, 0x00, 0x00, 0x05,
-    0x05, 0x06, 0x7a, 0x00, 0x26, 0x00, 0x27, 0x64, 0x00, 0x00, 0x07, 0x00, 0xab, 0xfd, 0xf9, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x72, 0x00, 0x00, 0x05, 0x18, 0x06, 0x7c, 0x00, 0x26, 0x00, 0x2a, 0x64, 0x00, 0x01, 0x07, 0x00, 0xab, 0xfd,
-    0xe8, 0x00, 0x02, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x02, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x62,
-    0x00, 0x00, 0x04, 0xf8, 0x06, 0x7c, 0x00, 0x26, 0x00, 0x2b, 0x64, 0x00, 0x01, 0x07, 0x00, 0xab, 0xfd, 0xd8, 0x00,
-    0x02, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x02, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xea,
-    0x04, 0x81, 0x06, 0x7a, 0x00, 0x26, 0x00, 0x31, 0x14, 0x00, 0x00, 0x07, 0x00, 0xab, 0xfd, 0xf1, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x29, 0x00, 0x00, 0x05, 0x55, 0x06, 0x7a, 0x00, 0x26, 0x00, 0x3b, 0x64, 0x00, 0x00, 0x07, 0x00, 0xab,
-    0xfd, 0x9f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0d, 0x00, 0x00, 0x04, 0x8c, 0x06, 0x7a, 0x00, 0x26, 0x00, 0xb7, 0x14,
-    0x00, 0x00, 0x07, 0x00, 0xab, 0xfd, 0xed, 0x00, 0x00, 0xff, 0xff, 0x00, 0xe9, 0xff, 0xeb, 0x04, 0x32, 0x06, 0x7a,
-    0x02, 0x26, 0x00, 0xc0, 0x00, 0x00, 0x01, 0x06, 0x00, 0xac, 0xd9, 0xbb, 0x00, 0x09, 0xb1, 0x01, 0x03, 0xb8, 0xff,
-    0xbb, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x04, 0x02, 0x05, 0xb0, 0x02, 0x06,
-    0x00, 0x23, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3e, 0x00, 0x00, 0x04, 0x72, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x24, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x04, 0xa1, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x27, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x13, 0x00, 0x00, 0x04, 0x81, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x3c, 0x00, 0x00, 0xff, 0xff, 0x00, 0x20, 0x00,
-    0x00, 0x04, 0xb4, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x2a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x40, 0x00, 0x00, 0x04, 0x94,
-    0x05, 0xb0, 0x02, 0x06, 0x00, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3e, 0x00, 0x00, 0x04, 0xfc, 0x05, 0xb0, 0x02,
-    0x06, 0x00, 0x2d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x27, 0x00, 0x00, 0x04, 0xc0, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x2f,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x22, 0x00, 0x00, 0x04, 0xb3, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x30, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x66, 0xff, 0xea, 0x04, 0x6d, 0x05, 0xc6, 0x02, 0x06, 0x00, 0x31, 0x00, 0x00, 0xff, 0xff, 0x00, 0x51,
-    0x00, 0x00, 0x04, 0xa7, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x32, 0x00, 0x00, 0xff, 0xff, 0x00, 0xc2, 0x00, 0x00, 0x04,
-    0xf7, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x36, 0x00, 0x00, 0xff, 0xff, 0x00, 0xd4, 0x00, 0x00, 0x04, 0xf1, 0x05, 0xb0,
-    0x02, 0x06, 0x00, 0x3b, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf1, 0x00, 0x00, 0x04, 0xee, 0x05, 0xb0, 0x02, 0x06, 0x00,
-    0x3a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x40, 0x00, 0x00, 0x04, 0x94, 0x07, 0x22, 0x02, 0x26, 0x00, 0x2b, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x68, 0x00, 0x1a, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b,
-    0x00, 0xff, 0xff, 0x00, 0xd4, 0x00, 0x00, 0x04, 0xf1, 0x07, 0x21, 0x02, 0x26, 0x00, 0x3b, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x68, 0x00, 0x42, 0x01, 0x5a, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x5a, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0x00, 0x67, 0xff, 0xe9, 0x04, 0x25, 0x06, 0x7e, 0x02, 0x26, 0x00, 0xb8, 0x00, 0x00, 0x01, 0x06, 0x00, 0xab,
-    0x10, 0x04, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x04, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x50, 0xff, 0xea, 0x04,
-    0x4f, 0x06, 0x7d, 0x02, 0x26, 0x00, 0xbc, 0x00, 0x00, 0x01, 0x06, 0x00, 0xab, 0x14, 0x03, 0x00, 0x08, 0xb1, 0x01,
-    0x01, 0xb0, 0x03, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x36, 0xfe, 0x61, 0x04, 0x1f, 0x06, 0x7e, 0x02, 0x26, 0x00,
-    0xbe, 0x00, 0x00, 0x01, 0x06, 0x00, 0xab, 0x1c, 0x04, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x04, 0xb0, 0x33, 0x2b,
-    0xff, 0xff, 0x00, 0xe9, 0xff, 0xeb, 0x03, 0xdd, 0x06, 0x6a, 0x02, 0x26, 0x00, 0xc0, 0x00, 0x00, 0x01, 0x06, 0x00,
-    0xab, 0x0b, 0xf0, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf0, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x79, 0xff, 0xe9, 0x04, 0x2a, 0x06, 0x7a, 0x02, 0x26, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x06, 0x00, 0xac, 0xb6,
-    0xbb, 0x00, 0x09, 0xb1, 0x01, 0x03, 0xb8, 0xff, 0xbb, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x4c,
-    0x00, 0x00, 0x04, 0x89, 0x04, 0x3a, 0x02, 0x06, 0x00, 0x8d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x60, 0xff, 0xe9, 0x04,
-    0x33, 0x04, 0x50, 0x02, 0x06, 0x00, 0x51, 0x00, 0x00, 0xff, 0xff, 0x00, 0x06, 0xfe, 0x60, 0x04, 0x46, 0x04, 0x3a,
-    0x02, 0x06, 0x00, 0x74, 0x00, 0x00, 0xff, 0xff, 0x00, 0xae, 0x00, 0x00, 0x04, 0x94, 0x04, 0x3b, 0x02, 0x06, 0x00,
-    0x58, 0x00, 0x00, 0xff, 0xff, 0x00, 0x06, 0x00, 0x00, 0x04, 0x98, 0x04, 0x3a, 0x02, 0x06, 0x00, 0x5a, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0xe9, 0xff, 0xeb, 0x04, 0x16, 0x05, 0xcb, 0x02, 0x26, 0x00, 0xc0, 0x00, 0x00, 0x01, 0x06, 0x00,
-    0x68, 0x11, 0x04, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x04, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x79, 0xff, 0xe9,
-    0x04, 0x2a, 0x05, 0xcb, 0x02, 0x26, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0xef, 0x04, 0x00, 0x08, 0xb1,
-    0x01, 0x02, 0xb0, 0x04, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x60, 0xff, 0xe9, 0x04, 0x33, 0x06, 0x7e, 0x02, 0x26,
-    0x00, 0x51, 0x00, 0x00, 0x01, 0x06, 0x00, 0xab, 0x0a, 0x04, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x04, 0xb0, 0x33,
-    0x2b, 0xff, 0xff, 0x00, 0x79, 0xff, 0xe9, 0x04, 0x2a, 0x06, 0x6a, 0x02, 0x26, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0xab, 0xe9, 0xf0, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf0, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x36, 0xff, 0xe9, 0x04, 0x71, 0x06, 0x6a, 0x02, 0x26, 0x00, 0xcb, 0x00, 0x00, 0x01, 0x06, 0x00, 0xab,
-    0x12, 0xf0, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf0, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0x48, 0x00, 0x00, 0x04, 0xa1, 0x07, 0x22, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0x00, 0x4c,
-    0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x47, 0x00,
-    0x00, 0x04, 0xa5, 0x07, 0x20, 0x02, 0x26, 0x00, 0xae, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0xc3, 0x01, 0x57,
-    0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x57, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x01, 0x00, 0x53, 0xff, 0xea, 0x04,
-    0x8d, 0x05, 0xc6, 0x00, 0x3d, 0x00, 0x39, 0x40, 0x36, 0x29, 0x01, 0x05, 0x04, 0x01, 0x4a, 0x00, 0x01, 0x02, 0x04,
-    0x02, 0x01, 0x04, 0x70, 0x00, 0x04, 0x05, 0x02, 0x04, 0x05, 0x6e, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00,
-    0x1d, 0x4b, 0x00, 0x05, 0x05, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x20, 0x03, 0x4c, 0x3a, 0x38, 0x34, 0x33, 0x2f, 0x2d,
-    0x24, 0x14, 0x2e, 0x06, 0x06, 0x17, 0x2b, 0x01, 0x36, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x37, 0x3e, 0x03, 0x17, 0x1e,
-    0x03, 0x07, 0x23, 0x2e, 0x03, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03,
-    0x27, 0x2e, 0x03, 0x37, 0x33, 0x1e, 0x03, 0x17, 0x16, 0x3e, 0x02, 0x03, 0x67, 0x07, 0x2c, 0x4d, 0x63, 0x2f, 0x47,
-    0x8c, 0x6d, 0x40, 0x05, 0x06, 0x5c, 0x8f, 0xb0, 0x59, 0x5e, 0x9e, 0x71, 0x3e, 0x03, 0xb8, 0x03, 0x1f, 0x3d, 0x5b,
-    0x3f, 0x36, 0x6a, 0x56, 0x39, 0x06, 0x06, 0x2d, 0x4d, 0x5f, 0x2d, 0x4a, 0x8f, 0x6e, 0x3f, 0x06, 0x07, 0x60, 0x92,
-    0xb4, 0x5a, 0x60, 0xa7, 0x7d, 0x46, 0x02, 0xb7, 0x03, 0x29, 0x47, 0x65, 0x40, 0x38, 0x6e, 0x5a, 0x3c, 0x01, 0x78,
-    0x3d, 0x57, 0x3f, 0x2c, 0x12, 0x1b, 0x4a, 0x65, 0x85, 0x57, 0x5f, 0x98, 0x6a, 0x36, 0x02, 0x02, 0x44, 0x75, 0x9f,
-    0x5e, 0x3a, 0x65, 0x4c, 0x2d, 0x02, 0x01, 0x21, 0x3f, 0x5b, 0x3a, 0x3a, 0x52, 0x3b, 0x2a, 0x10, 0x1b, 0x4d, 0x6a,
-    0x8b, 0x5a, 0x62, 0x97, 0x65, 0x32, 0x02, 0x01, 0x41, 0x73, 0xa2, 0x62, 0x3f, 0x67, 0x4a, 0x2b, 0x01, 0x01, 0x1d,
-    0x3c, 0x5b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x40, 0x00, 0x00, 0x04, 0x94, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x2b,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x40, 0x00, 0x00, 0x04, 0x94, 0x07, 0x22, 0x02, 0x26, 0x00, 0x2b, 0x00, 0x00, 0x01,
-    0x07, 0x00, 0x68, 0x00, 0x1a, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x3f, 0xff, 0xea, 0x04, 0x8c, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x2c, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0x3b, 0x00, 0x00, 0x05, 0x06, 0x05, 0xb0, 0x02, 0x06, 0x01, 0xda, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3e, 0x00, 0x00,
-    0x04, 0xfc, 0x07, 0x0e, 0x02, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0xbe, 0x01, 0x45, 0x00,
-    0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x45, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x01, 0xff, 0xe9, 0x05, 0x2b,
-    0x07, 0x4b, 0x02, 0x26, 0x00, 0xdb, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x70, 0x01, 0x98, 0x00, 0x09, 0xb1,
-    0x01, 0x01, 0xb8, 0x01, 0x98, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x04, 0x02, 0x05, 0xb0,
-    0x02, 0x06, 0x00, 0x23, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3e, 0x00, 0x00, 0x04, 0x72, 0x05, 0xb0, 0x02, 0x06, 0x00,
-    0x24, 0x00, 0x00, 0xff, 0xff, 0x00, 0x47, 0x00, 0x00, 0x04, 0xa5, 0x05, 0xb0, 0x02, 0x06, 0x00, 0xae, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x04, 0xa1, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x27, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0x35, 0x00, 0x00, 0x04, 0xa0, 0x07, 0x3f, 0x02, 0x26, 0x00, 0xd9, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x47,
-    0x01, 0x8c, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x8c, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x27, 0x00,
-    0x00, 0x04, 0xc0, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x2f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x20, 0x00, 0x00, 0x04, 0xb4,
-    0x05, 0xb0, 0x02, 0x06, 0x00, 0x2a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x66, 0xff, 0xea, 0x04, 0x6d, 0x05, 0xc6, 0x02,
-    0x06, 0x00, 0x31, 0x00, 0x00, 0xff, 0xff, 0x00, 0x35, 0x00, 0x00, 0x04, 0x9f, 0x05, 0xb0, 0x02, 0x06, 0x00, 0xb3,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x04, 0xa7, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x32, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x64, 0xff, 0xe9, 0x04, 0x85, 0x05, 0xc6, 0x02, 0x06, 0x00, 0x25, 0x00, 0x00, 0xff, 0xff, 0x00, 0xc2,
-    0x00, 0x00, 0x04, 0xf7, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x36, 0x00, 0x00, 0xff, 0xff, 0x00, 0x50, 0x00, 0x00, 0x04,
-    0x83, 0x05, 0xb0, 0x02, 0x06, 0x00, 0xb5, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf1, 0x00, 0x00, 0x04, 0xee, 0x05, 0xb0,
-    0x02, 0x06, 0x00, 0x3a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x61, 0xff, 0xeb, 0x04, 0x0f, 0x04, 0x50, 0x02, 0x06, 0x00,
-    0x43, 0x00, 0x00, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xeb, 0x04, 0x2b, 0x04, 0x50, 0x02, 0x06, 0x00, 0x47, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x37, 0x00, 0x00, 0x04, 0x5c, 0x05, 0xf4, 0x02, 0x26, 0x00, 0xec, 0x00, 0x00, 0x01, 0x06, 0x00,
-    0x9e, 0x09, 0x41, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x41, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x60, 0xff, 0xe9,
-    0x04, 0x33, 0x04, 0x50, 0x02, 0x06, 0x00, 0x51, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0x60, 0x04, 0x1c, 0x04,
-    0x50, 0x02, 0x06, 0x00, 0x52, 0x00, 0x00, 0x00, 0x01, 0x00, 0x75, 0xff, 0xe9, 0x04, 0x2c, 0x04, 0x50, 0x00, 0x2f,
-    0x00, 0x3b, 0x40, 0x38, 0x00, 0x04, 0x05, 0x01, 0x05, 0x04, 0x01, 0x70, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x6e,
-    0x00, 0x05, 0x05, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x1f, 0x4b, 0x06, 0x01, 0x00, 0x00, 0x02, 0x5b, 0x00, 0x02, 0x02,
-    0x20, 0x02, 0x4c, 0x01, 0x00, 0x24, 0x22, 0x1e, 0x1d, 0x19, 0x17, 0x0c, 0x0a, 0x06, 0x05, 0x00, 0x2f, 0x01, 0x2f,
-    0x07, 0x06, 0x14, 0x2b, 0x25, 0x16, 0x3e, 0x02, 0x37, 0x37, 0x0e, 0x03, 0x27, 0x2e, 0x03, 0x37, 0x37, 0x3e, 0x05,
-    0x17, 0x1e, 0x03, 0x07, 0x27, 0x36, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x07, 0x06, 0x14, 0x1e, 0x03, 0x02,
-    0x15, 0x31, 0x60, 0x4f, 0x38, 0x0b, 0xab, 0x09, 0x5a, 0x84, 0xa0, 0x4f, 0x72, 0xa0, 0x62, 0x24, 0x0a, 0x05, 0x09,
-    0x2e, 0x47, 0x5f, 0x76, 0x8a, 0x4e, 0x54, 0x8e, 0x65, 0x36, 0x04, 0xaa, 0x02, 0x1c, 0x39, 0x52, 0x34, 0x53, 0x7f,
-    0x5a, 0x37, 0x0a, 0x05, 0x05, 0x0f, 0x20, 0x36, 0x4d, 0x81, 0x01, 0x1d, 0x37, 0x4f, 0x31, 0x01, 0x53, 0x87, 0x5f,
-    0x33, 0x02, 0x03, 0x5c, 0x95, 0xc0, 0x66, 0x2b, 0x49, 0x8a, 0x7a, 0x65, 0x48, 0x26, 0x02, 0x02, 0x3c, 0x67, 0x8f,
-    0x55, 0x01, 0x32, 0x56, 0x41, 0x26, 0x02, 0x03, 0x43, 0x70, 0x8e, 0x49, 0x2a, 0x2b, 0x5a, 0x55, 0x4d, 0x39, 0x24,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xe4, 0xfe, 0x48, 0x04, 0xbc, 0x04, 0x3a, 0x02, 0x06, 0x00, 0x5b, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x06, 0x00, 0x00, 0x04, 0x98, 0x04, 0x3a, 0x02, 0x06, 0x00, 0x5a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x6c,
-    0xff, 0xeb, 0x04, 0x2b, 0x05, 0xe1, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x16, 0x1a, 0x00,
-    0x08, 0xb1, 0x02, 0x02, 0xb0, 0x1a, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x49, 0x00, 0x00, 0x04, 0x5f, 0x05, 0xc9,
-    0x02, 0x26, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x06, 0x00, 0x73, 0x7b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x7c, 0xff,
-    0xea, 0x04, 0x28, 0x04, 0x4f, 0x02, 0x06, 0x00, 0x55, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5c, 0x00, 0x00, 0x03, 0xe9,
-    0x05, 0xc5, 0x02, 0x06, 0x00, 0x4b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5c, 0x00, 0x00, 0x04, 0x44, 0x05, 0xcb, 0x02,
-    0x26, 0x00, 0x8a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x3f, 0x04, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x04, 0xb0,
-    0x33, 0x2b, 0xff, 0xff, 0x00, 0x23, 0xfe, 0x49, 0x03, 0xc4, 0x05, 0xc5, 0x02, 0x06, 0x00, 0x4c, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x36, 0x00, 0x00, 0x04, 0xab, 0x05, 0xc9, 0x02, 0x26, 0x00, 0xed, 0x00, 0x00, 0x00, 0x06, 0x00, 0x73,
-    0x31, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xe4, 0xfe, 0x48, 0x04, 0xbc, 0x05, 0xf5, 0x02, 0x26, 0x00, 0x5b, 0x00,
-    0x00, 0x01, 0x06, 0x00, 0x9e, 0x28, 0x42, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x42, 0xb0, 0x33, 0x2b, 0xff, 0xff,
-    0x00, 0x95, 0x00, 0x00, 0x05, 0x03, 0x07, 0x23, 0x02, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0x42, 0xff,
-    0xca, 0x01, 0x5a, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5a, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x84,
-    0x00, 0x00, 0x04, 0xda, 0x05, 0xcd, 0x02, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x06, 0x00, 0x42, 0x9f, 0x04, 0x00,
-    0x08, 0xb1, 0x01, 0x01, 0xb0, 0x04, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x95, 0x00, 0x00, 0x05, 0x03, 0x07, 0x20,
-    0x02, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0xaf, 0x01, 0x57, 0x00, 0x09, 0xb1, 0x01, 0x01,
-    0xb8, 0x01, 0x57, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x84, 0x00, 0x00, 0x04, 0xda, 0x05, 0xca, 0x02, 0x26,
-    0x00, 0x59, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x84, 0x00, 0x01, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x01,
-    0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x95, 0x00, 0x00, 0x05, 0x03, 0x07, 0x22, 0x02, 0x26, 0x00, 0x39,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0x00, 0x3d, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x5b, 0xb0,
-    0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x84, 0x00, 0x00, 0x04, 0xda, 0x05, 0xcc, 0x02, 0x26, 0x00, 0x59, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x68, 0x12, 0x05, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x05, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00,
-    0xd4, 0x00, 0x00, 0x04, 0xf1, 0x07, 0x22, 0x02, 0x26, 0x00, 0x3b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x42, 0xff, 0xcf,
-    0x01, 0x59, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x59, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0xff, 0xe4, 0xfe,
-    0x48, 0x04, 0xbc, 0x05, 0xcd, 0x02, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x06, 0x00, 0x42, 0xac, 0x04, 0x00, 0x08,
-    0xb1, 0x01, 0x01, 0xb0, 0x04, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x02, 0x26, 0x04, 0x20, 0x03, 0x0d, 0x06, 0x08, 0x02,
-    0x06, 0x00, 0x09, 0x00, 0x00, 0xff, 0xff, 0x01, 0x9e, 0x04, 0x20, 0x03, 0xd9, 0x06, 0x09, 0x02, 0x06, 0x00, 0x04,
-    0x00, 0x00, 0xff, 0xff, 0x01, 0x80, 0xff, 0xf3, 0x07, 0xe5, 0x05, 0xb0, 0x00, 0x26, 0x04, 0x10, 0x00, 0x00, 0x00,
-    0x07, 0x04, 0x10, 0x04, 0xb2, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0xfe, 0x49, 0x04, 0x7a, 0x05, 0xea, 0x02, 0x26,
-    0x00, 0x9a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9d, 0x5d, 0xfc, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xfc, 0xb0,
-    0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x18, 0x04, 0x07, 0x03, 0x71, 0x06, 0x16, 0x02, 0x06, 0x01, 0x68,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x27, 0x00, 0x00, 0x04, 0xc0, 0x07, 0x20, 0x02, 0x26, 0x00, 0x2f, 0x00, 0x00, 0x01,
-    0x07, 0x00, 0x73, 0x00, 0xb8, 0x01, 0x57, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x57, 0xb0, 0x33, 0x2b, 0x00,
-    0xff, 0xff, 0xff, 0xf2, 0x00, 0x00, 0x04, 0x75, 0x05, 0xde, 0x02, 0x26, 0x00, 0x4f, 0x00, 0x00, 0x01, 0x07, 0x00,
-    0x73, 0x00, 0xa7, 0x00, 0x15, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x15, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff,
-    0xff, 0xe2, 0xfe, 0x85, 0x04, 0x02, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x00, 0x06, 0x00, 0xa4, 0x24,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x61, 0xfe, 0x85, 0x04, 0x0f, 0x04, 0x50, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0xa4, 0xeb, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x05, 0xff, 0xea, 0x04, 0x6d, 0x06, 0x56, 0x02,
-    0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x01, 0xcc, 0xfd, 0xc0, 0x00, 0x92, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0,
-    0x92, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x04, 0xa1, 0x07, 0x23, 0x02, 0x26, 0x00,
-    0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0x42, 0xff, 0xd9, 0x01, 0x5a, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5a,
-    0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x35, 0x00, 0x00, 0x04, 0xa0, 0x07, 0x17, 0x02, 0x26, 0x00, 0xd9, 0x00,
-    0x00, 0x01, 0x07, 0x00, 0x42, 0xff, 0xcb, 0x01, 0x4e, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x4e, 0xb0, 0x33,
-    0x2b, 0x00, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xeb, 0x04, 0x2b, 0x05, 0xe2, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01,
-    0x06, 0x00, 0x42, 0xa3, 0x19, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x37,
-    0x00, 0x00, 0x04, 0x5c, 0x05, 0xcc, 0x02, 0x26, 0x00, 0xec, 0x00, 0x00, 0x01, 0x06, 0x00, 0x42, 0x8d, 0x03, 0x00,
-    0x08, 0xb1, 0x01, 0x01, 0xb0, 0x03, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x84, 0x00, 0x00, 0x04, 0xe5, 0x05, 0xb0,
-    0x02, 0x06, 0x00, 0xb6, 0x00, 0x00, 0xff, 0xff, 0x00, 0x53, 0xfe, 0x28, 0x04, 0x71, 0x04, 0x3b, 0x02, 0x06, 0x00,
-    0xca, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb1, 0x00, 0x00, 0x05, 0x4f, 0x07, 0x42, 0x02, 0x26, 0x01, 0x15, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa9, 0x04, 0x73, 0x01, 0x54, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x54, 0xb0, 0x33, 0x2b,
-    0x00, 0xff, 0xff, 0x00, 0xa6, 0x00, 0x00, 0x04, 0x8f, 0x06, 0x1a, 0x02, 0x26, 0x01, 0x16, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa9, 0x04, 0x18, 0x00, 0x2c, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x2c, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x2e, 0xfe, 0x2f, 0x04, 0x93, 0x05, 0xc5, 0x02, 0x26, 0x00, 0xd8, 0x00, 0x00, 0x01, 0x06, 0x01, 0xce,
-    0xdf, 0x96, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0x96, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0x4f, 0xfe, 0x39, 0x04, 0x3a, 0x04, 0x4e, 0x02, 0x26, 0x00, 0xeb, 0x00, 0x00, 0x01, 0x06, 0x01, 0xce, 0xf8, 0xa0,
-    0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xa0, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x64, 0xfe,
-    0x39, 0x04, 0x85, 0x05, 0xc6, 0x02, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x06, 0x01, 0xce, 0xee, 0xa0, 0x00, 0x09,
-    0xb1, 0x01, 0x01, 0xb8, 0xff, 0xa0, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x75, 0xfe, 0x39, 0x04,
-    0x2c, 0x04, 0x50, 0x02, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x06, 0x01, 0xce, 0x01, 0xa0, 0x00, 0x09, 0xb1, 0x01,
-    0x01, 0xb8, 0xff, 0xa0, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xd4, 0x00, 0x00, 0x04, 0xf1, 0x05,
-    0xb0, 0x02, 0x06, 0x00, 0x3b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x9d, 0xfe, 0x60, 0x04, 0xcc, 0x04, 0x3a, 0x02, 0x06,
-    0x00, 0xba, 0x00, 0x00, 0xff, 0xff, 0x00, 0x40, 0x00, 0x00, 0x04, 0x94, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x2b, 0x00,
-    0x00, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x04, 0xfe, 0x07, 0x4b, 0x02, 0x26, 0x00, 0xd7, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x9e, 0x00, 0x5d, 0x01, 0x98, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x98, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0xff, 0xa3, 0x00, 0x00, 0x04, 0xc1, 0x05, 0xf4, 0x02, 0x26, 0x00, 0xea, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e,
-    0x09, 0x41, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x41, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x40, 0x00, 0x00, 0x04,
-    0x94, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x2b, 0x00, 0x00, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x04, 0x57, 0x07, 0x4b,
-    0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x5f, 0x01, 0x98, 0x00, 0x09, 0xb1, 0x02, 0x01,
-    0xb8, 0x01, 0x98, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x61, 0xff, 0xeb, 0x04, 0x1b, 0x06, 0x09, 0x02, 0x26,
-    0x00, 0x43, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x23, 0x56, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x56, 0xb0, 0x33,
-    0x2b, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x04, 0x5b, 0x07, 0x22, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x68, 0x00, 0x56, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0x00, 0x61, 0xff, 0xeb, 0x04, 0x1f, 0x05, 0xe0, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68,
-    0x1a, 0x19, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0xff, 0xb2, 0x00, 0x00, 0x05,
-    0x06, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x7f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xeb, 0x04, 0xa0, 0x04, 0x50,
-    0x02, 0x06, 0x00, 0x84, 0x00, 0x00, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x04, 0xa1, 0x07, 0x4b, 0x02, 0x26, 0x00,
-    0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x55, 0x01, 0x98, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x98,
-    0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xeb, 0x04, 0x2b, 0x06, 0x0a, 0x02, 0x26, 0x00, 0x47, 0x00,
-    0x00, 0x01, 0x06, 0x00, 0x9e, 0x1f, 0x57, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x57, 0xb0, 0x33, 0x2b, 0xff, 0xff,
-    0x00, 0x4d, 0xff, 0xea, 0x04, 0x69, 0x06, 0xf4, 0x02, 0x26, 0x01, 0x43, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0x00,
-    0x3a, 0x01, 0x2d, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x2d, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8a,
-    0xff, 0xeb, 0x04, 0x3f, 0x04, 0x4f, 0x02, 0x06, 0x00, 0x9b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x8a, 0xff, 0xeb, 0x04,
-    0x3f, 0x05, 0xe1, 0x02, 0x26, 0x00, 0x9b, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x37, 0x1a, 0x00, 0x08, 0xb1, 0x02,
-    0x02, 0xb0, 0x1a, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x04, 0xfe, 0x07, 0x22, 0x02, 0x26, 0x00,
-    0xd7, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0x00, 0x54, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x5b,
-    0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0xff, 0xa3, 0x00, 0x00, 0x04, 0xc1, 0x05, 0xcb, 0x02, 0x26, 0x00, 0xea, 0x00,
-    0x00, 0x01, 0x06, 0x00, 0x68, 0x00, 0x04, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x04, 0xb0, 0x33, 0x2b, 0xff, 0xff,
-    0x00, 0x2e, 0xff, 0xe9, 0x04, 0x93, 0x07, 0x37, 0x02, 0x26, 0x00, 0xd8, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0x00,
-    0x46, 0x01, 0x70, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x70, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x4f,
-    0xff, 0xec, 0x04, 0x3a, 0x05, 0xdf, 0x02, 0x26, 0x00, 0xeb, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x19, 0x18, 0x00,
-    0x08, 0xb1, 0x01, 0x02, 0xb0, 0x18, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x35, 0x00, 0x00, 0x04, 0xa0, 0x06, 0xee,
-    0x02, 0x26, 0x00, 0xd9, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6e, 0x00, 0x3f, 0x01, 0x3e, 0x00, 0x09, 0xb1, 0x01, 0x01,
-    0xb8, 0x01, 0x3e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x37, 0x00, 0x00, 0x04, 0x5c, 0x05, 0xa4, 0x02, 0x26,
-    0x00, 0xec, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6e, 0x01, 0xf4, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf4, 0xb0,
-    0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x35, 0x00, 0x00, 0x04, 0xa0, 0x07, 0x16, 0x02, 0x26, 0x00, 0xd9,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0x00, 0x3e, 0x01, 0x4f, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x4f, 0xb0,
-    0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x37, 0x00, 0x00, 0x04, 0x5c, 0x05, 0xcb, 0x02, 0x26, 0x00, 0xec, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x68, 0x00, 0x04, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x04, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00,
-    0x66, 0xff, 0xea, 0x04, 0x6d, 0x07, 0x37, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0x00, 0x5d,
-    0x01, 0x70, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x70, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x60, 0xff,
-    0xe9, 0x04, 0x33, 0x05, 0xe0, 0x02, 0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x10, 0x19, 0x00, 0x08,
-    0xb1, 0x02, 0x02, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x5f, 0xff, 0xea, 0x04, 0x66, 0x05, 0xc6, 0x02,
-    0x06, 0x01, 0x13, 0x00, 0x00, 0xff, 0xff, 0x00, 0x44, 0xff, 0xe9, 0x04, 0x17, 0x04, 0x50, 0x02, 0x06, 0x01, 0x14,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x5f, 0xff, 0xea, 0x04, 0x66, 0x07, 0x1d, 0x02, 0x26, 0x01, 0x13, 0x00, 0x00, 0x01,
-    0x07, 0x00, 0x68, 0x00, 0x5a, 0x01, 0x56, 0x00, 0x09, 0xb1, 0x03, 0x02, 0xb8, 0x01, 0x56, 0xb0, 0x33, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x44, 0xff, 0xe9, 0x04, 0x17, 0x05, 0xfc, 0x02, 0x26, 0x01, 0x14, 0x00, 0x00, 0x01, 0x06, 0x00,
-    0x68, 0xe6, 0x35, 0x00, 0x08, 0xb1, 0x03, 0x02, 0xb0, 0x35, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x4e, 0xff, 0xe9,
-    0x04, 0x71, 0x07, 0x38, 0x02, 0x26, 0x00, 0xe3, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0x00, 0x3c, 0x01, 0x71, 0x00,
-    0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x71, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x50, 0xff, 0xe9, 0x04, 0x1b,
-    0x05, 0xe0, 0x02, 0x26, 0x00, 0xfb, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0xfd, 0x19, 0x00, 0x08, 0xb1, 0x01, 0x02,
-    0xb0, 0x19, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x01, 0xff, 0xe9, 0x05, 0x2b, 0x06, 0xfa, 0x02, 0x26, 0x00, 0xdb,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x6e, 0x00, 0x68, 0x01, 0x4a, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x4a, 0xb0,
-    0x33, 0x2b, 0x00, 0xff, 0xff, 0xff, 0xe4, 0xfe, 0x48, 0x04, 0xbc, 0x05, 0xa5, 0x02, 0x26, 0x00, 0x5b, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x6e, 0x20, 0xf5, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf5, 0xb0, 0x33, 0x2b, 0x00, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0x01, 0xff, 0xe9, 0x05, 0x2b, 0x07, 0x22, 0x02, 0x26, 0x00, 0xdb, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x68, 0x00, 0x67, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0xff, 0xe4, 0xfe, 0x48, 0x04, 0xbc, 0x05, 0xcc, 0x02, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68,
-    0x1f, 0x05, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x05, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x01, 0xff, 0xe9, 0x05,
-    0x3e, 0x07, 0x4a, 0x02, 0x26, 0x00, 0xdb, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa3, 0x00, 0xdd, 0x01, 0x5b, 0x00, 0x09,
-    0xb1, 0x01, 0x02, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0xff, 0xe4, 0xfe, 0x48, 0x04, 0xf6, 0x05,
-    0xf4, 0x02, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa3, 0x00, 0x95, 0x00, 0x05, 0x00, 0x08, 0xb1, 0x01,
-    0x02, 0xb0, 0x05, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0xe4, 0x00, 0x00, 0x04, 0x9d, 0x07, 0x22, 0x02,
-    0x26, 0x00, 0xdd, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0xff, 0xfd, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8,
-    0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x9f, 0x00, 0x00, 0x04, 0x5c, 0x05, 0xcb, 0x02, 0x26, 0x00,
-    0xf5, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x26, 0x04, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x04, 0xb0, 0x33, 0x2b,
-    0xff, 0xff, 0x00, 0x23, 0xff, 0xfe, 0x04, 0xc0, 0x07, 0x22, 0x02, 0x26, 0x00, 0xe1, 0x00, 0x00, 0x01, 0x07, 0x00,
-    0x68, 0x00, 0x28, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x03, 0x02, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff,
-    0x00, 0x23, 0xff, 0xff, 0x04, 0x73, 0x05, 0xcb, 0x02, 0x26, 0x00, 0xf9, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x4d,
-    0x04, 0x00, 0x08, 0xb1, 0x03, 0x02, 0xb0, 0x04, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0xff, 0xf1, 0xfe, 0x47, 0x04, 0xee,
-    0x05, 0xb0, 0x02, 0x26, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x07, 0x01, 0xd0, 0x01, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0x06, 0xfe, 0x47, 0x04, 0x98, 0x04, 0x3a, 0x02, 0x26, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x07, 0x01, 0xd0, 0x01, 0x91,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x76, 0xff, 0xea, 0x04, 0xa0, 0x06, 0x00, 0x02, 0x06, 0x00, 0x46, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xca, 0xfe, 0x47, 0x04, 0xa0, 0x05, 0xb0, 0x02, 0x26, 0x00, 0xda, 0x00, 0x00, 0x00, 0x07, 0x01, 0xd0,
-    0x01, 0xc3, 0x00, 0x00, 0xff, 0xff, 0xff, 0xd2, 0xfe, 0x47, 0x04, 0x6b, 0x04, 0x3a, 0x02, 0x26, 0x00, 0xee, 0x00,
-    0x00, 0x00, 0x07, 0x01, 0xd0, 0x01, 0xbe, 0x00, 0x00, 0xff, 0xff, 0xff, 0xe2, 0xfe, 0xa6, 0x04, 0x02, 0x05, 0xb0,
-    0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x00, 0x07, 0x00, 0xaa, 0x04, 0xb9, 0x00, 0x00, 0xff, 0xff, 0x00, 0x61, 0xfe,
-    0xa6, 0x04, 0x0f, 0x04, 0x50, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x00, 0x07, 0x00, 0xaa, 0x04, 0x7f, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x04, 0x0e, 0x07, 0xc5, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x00,
-    0xa8, 0x04, 0xde, 0x01, 0x52, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x52, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff,
-    0x00, 0x61, 0xff, 0xeb, 0x04, 0x0f, 0x06, 0x83, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa8, 0x04,
-    0xa2, 0x00, 0x10, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x10, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0xff, 0xe2,
-    0x00, 0x00, 0x05, 0xc0, 0x07, 0xee, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x01, 0x9a, 0x00, 0x30, 0x01,
-    0x59, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x59, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x61, 0xff, 0xeb,
-    0x05, 0x85, 0x06, 0xac, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x06, 0x01, 0x9a, 0xf5, 0x17, 0x00, 0x08, 0xb1,
-    0x02, 0x02, 0xb0, 0x17, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x04, 0x6c, 0x07, 0xdd, 0x02, 0x26,
-    0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x01, 0x99, 0x00, 0x24, 0x01, 0x48, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01,
-    0x48, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x61, 0xff, 0xeb, 0x04, 0x31, 0x06, 0x9b, 0x02, 0x26, 0x00, 0x43,
-    0x00, 0x00, 0x01, 0x06, 0x01, 0x99, 0xe9, 0x06, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x06, 0xb0, 0x33, 0x2b, 0xff,
-    0xff, 0xff, 0xe2, 0x00, 0x00, 0x05, 0x78, 0x08, 0x03, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x01, 0x98,
-    0x00, 0x36, 0x01, 0x35, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x35, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00,
-    0x61, 0xff, 0xeb, 0x05, 0x3d, 0x06, 0xc2, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x06, 0x01, 0x98, 0xfb, 0xf4,
-    0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0xff, 0xf4, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xe2, 0x00,
-    0x00, 0x04, 0x66, 0x08, 0x2e, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x01, 0x97, 0x00, 0x28, 0x01, 0x36,
-    0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x36, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x61, 0xff, 0xeb, 0x04,
-    0x2b, 0x06, 0xed, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x06, 0x01, 0x97, 0xed, 0xf5, 0x00, 0x09, 0xb1, 0x02,
-    0x02, 0xb8, 0xff, 0xf5, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xe2, 0xfe, 0xa6, 0x04, 0x3c, 0x07,
-    0x48, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x00, 0x27, 0x00, 0x9c, 0x00, 0xbf, 0x01, 0x5b, 0x01, 0x07, 0x00, 0xaa,
-    0x04, 0xb9, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00,
-    0x61, 0xfe, 0xa6, 0x04, 0x0f, 0x06, 0x06, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x00, 0x27, 0x00, 0x9c, 0x00, 0x83,
-    0x00, 0x19, 0x01, 0x07, 0x00, 0xaa, 0x04, 0x7f, 0x00, 0x00, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x19, 0xb0, 0x33,
-    0x2b, 0x00, 0x00, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x04, 0x4e, 0x07, 0xde, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00,
-    0x01, 0x07, 0x01, 0xc2, 0x00, 0x3a, 0x01, 0x54, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x54, 0xb0, 0x33, 0x2b,
-    0x00, 0xff, 0xff, 0x00, 0x61, 0xff, 0xeb, 0x04, 0x13, 0x06, 0x9c, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x06,
-    0x01, 0xc2, 0xff, 0x12, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x12, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0xff, 0xe2, 0x00,
-    0x00, 0x04, 0x65, 0x08, 0x21, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x01, 0x9b, 0x00, 0x44, 0x01, 0x7a,
-    0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x7a, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x61, 0xff, 0xeb, 0x04,
-    0x29, 0x06, 0xdf, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x06, 0x01, 0x9b, 0x08, 0x38, 0x00, 0x08, 0xb1, 0x02,
-    0x02, 0xb0, 0x38, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x04, 0x3b, 0x08, 0x4b, 0x02, 0x26, 0x00,
-    0x23, 0x00, 0x00, 0x01, 0x07, 0x01, 0xb6, 0x00, 0x2c, 0x01, 0x49, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x49,
-    0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x61, 0xff, 0xeb, 0x04, 0x0f, 0x07, 0x09, 0x02, 0x26, 0x00, 0x43, 0x00,
-    0x00, 0x01, 0x06, 0x01, 0xb6, 0xf1, 0x07, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x07, 0xb0, 0x33, 0x2b, 0xff, 0xff,
-    0xff, 0xe2, 0x00, 0x00, 0x04, 0x6b, 0x08, 0x20, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x01, 0xcd, 0x00,
-    0x0f, 0x01, 0x51, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x51, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x61,
-    0xff, 0xeb, 0x04, 0x30, 0x06, 0xde, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x06, 0x01, 0xcd, 0xd4, 0x0f, 0x00,
-    0x08, 0xb1, 0x02, 0x02, 0xb0, 0x0f, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0xff, 0xe2, 0xfe, 0xa6, 0x04, 0x57, 0x07, 0x4b,
-    0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x00, 0x27, 0x00, 0x9e, 0x00, 0x5f, 0x01, 0x98, 0x01, 0x07, 0x00, 0xaa, 0x04,
-    0xb9, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x98, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x61,
-    0xfe, 0xa6, 0x04, 0x1b, 0x06, 0x09, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x00, 0x26, 0x00, 0x9e, 0x23, 0x56, 0x01,
-    0x07, 0x00, 0xaa, 0x04, 0x7f, 0x00, 0x00, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x56, 0xb0, 0x33, 0x2b, 0xff, 0xff,
-    0x00, 0x48, 0xfe, 0xb0, 0x04, 0xa1, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0xaa, 0x04,
-    0xae, 0x00, 0x0a, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x0a, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x6c,
-    0xfe, 0xa6, 0x04, 0x2b, 0x04, 0x50, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x00, 0x07, 0x00, 0xaa, 0x04, 0xbd, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x04, 0xa1, 0x07, 0xc5, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa8, 0x04, 0xd4, 0x01, 0x52, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x52, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0x00, 0x6c, 0xff, 0xeb, 0x04, 0x2b, 0x06, 0x84, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa8,
-    0x04, 0x9e, 0x00, 0x11, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x11, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0x48, 0x00, 0x00, 0x04, 0xa1, 0x07, 0x51, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0xcd,
-    0x01, 0x61, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x61, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x6c, 0xff,
-    0xeb, 0x04, 0x42, 0x06, 0x10, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0x97, 0x00, 0x20,
-    0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x20, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x05,
-    0xb6, 0x07, 0xee, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x01, 0x9a, 0x00, 0x26, 0x01, 0x59, 0x00, 0x09,
-    0xb1, 0x01, 0x02, 0xb8, 0x01, 0x59, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xeb, 0x05, 0x81, 0x06,
-    0xad, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06, 0x01, 0x9a, 0xf1, 0x18, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0,
-    0x18, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x04, 0xa1, 0x07, 0xdd, 0x02, 0x26, 0x00, 0x27, 0x00,
-    0x00, 0x01, 0x07, 0x01, 0x99, 0x00, 0x1a, 0x01, 0x48, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x48, 0xb0, 0x33,
-    0x2b, 0x00, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xeb, 0x04, 0x2d, 0x06, 0x9c, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01,
-    0x06, 0x01, 0x99, 0xe5, 0x07, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x07, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x48,
-    0x00, 0x00, 0x05, 0x6e, 0x08, 0x03, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x01, 0x98, 0x00, 0x2c, 0x01,
-    0x35, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x35, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xeb,
-    0x05, 0x39, 0x06, 0xc3, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06, 0x01, 0x98, 0xf7, 0xf5, 0x00, 0x09, 0xb1,
-    0x02, 0x02, 0xb8, 0xff, 0xf5, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x04, 0xa1,
-    0x08, 0x2e, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x01, 0x97, 0x00, 0x1e, 0x01, 0x36, 0x00, 0x09, 0xb1,
-    0x01, 0x02, 0xb8, 0x01, 0x36, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xeb, 0x04, 0x2b, 0x06, 0xee,
-    0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06, 0x01, 0x97, 0xe9, 0xf6, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0xff,
-    0xf6, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x48, 0xfe, 0xb0, 0x04, 0xa1, 0x07, 0x48, 0x02, 0x26,
-    0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x9c, 0x00, 0xb5, 0x01, 0x5b, 0x01, 0x07, 0x00, 0xaa, 0x04, 0xae, 0x00,
-    0x0a, 0x00, 0x11, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0xb1, 0x02, 0x01, 0xb0, 0x0a, 0xb0, 0x33,
-    0x2b, 0x00, 0xff, 0xff, 0x00, 0x6c, 0xfe, 0xa6, 0x04, 0x2b, 0x06, 0x07, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x00,
-    0x26, 0x00, 0x9c, 0x7f, 0x1a, 0x01, 0x07, 0x00, 0xaa, 0x04, 0xbd, 0x00, 0x00, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0,
-    0x1a, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x40, 0x00, 0x00, 0x04, 0x94, 0x07, 0xc5, 0x02, 0x26, 0x00, 0x2b, 0x00,
-    0x00, 0x01, 0x07, 0x00, 0xa8, 0x04, 0xa2, 0x01, 0x52, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x52, 0xb0, 0x33,
-    0x2b, 0x00, 0xff, 0xff, 0x00, 0x5c, 0x00, 0x00, 0x03, 0xf7, 0x06, 0x6f, 0x02, 0x26, 0x00, 0x8a, 0x00, 0x00, 0x01,
-    0x07, 0x00, 0xa8, 0x04, 0xc7, 0xff, 0xfc, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xfc, 0xb0, 0x33, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x40, 0xfe, 0xb0, 0x04, 0x94, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x00,
-    0xaa, 0x04, 0x7c, 0x00, 0x0a, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x0a, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x5c, 0xfe, 0xb0, 0x03, 0xe9, 0x05, 0xc5, 0x02, 0x26, 0x00, 0x4b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xaa, 0x04,
-    0xe1, 0x00, 0x0a, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x0a, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x66,
-    0xfe, 0x9e, 0x04, 0x6d, 0x05, 0xc6, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00, 0xaa, 0x04, 0xb8, 0xff,
-    0xf8, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0xff, 0xf8, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x60, 0xfe, 0x9d,
-    0x04, 0x33, 0x04, 0x50, 0x02, 0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x07, 0x00, 0xaa, 0x04, 0xa6, 0xff, 0xf7, 0x00,
-    0x09, 0xb1, 0x02, 0x01, 0xb8, 0xff, 0xf7, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x66, 0xff, 0xea, 0x04, 0x6d,
-    0x07, 0xda, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa8, 0x04, 0xe5, 0x01, 0x67, 0x00, 0x09, 0xb1,
-    0x02, 0x01, 0xb8, 0x01, 0x67, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x60, 0xff, 0xe9, 0x04, 0x33, 0x06, 0x83,
-    0x02, 0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa8, 0x04, 0x98, 0x00, 0x10, 0x00, 0x08, 0xb1, 0x02, 0x01,
-    0xb0, 0x10, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x66, 0xff, 0xea, 0x05, 0xc7, 0x08, 0x03, 0x02, 0x26,
-    0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x01, 0x9a, 0x00, 0x37, 0x01, 0x6e, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01,
-    0x6e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x60, 0xff, 0xe9, 0x05, 0x7b, 0x06, 0xac, 0x02, 0x26, 0x00, 0x51,
-    0x00, 0x00, 0x01, 0x06, 0x01, 0x9a, 0xeb, 0x17, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x17, 0xb0, 0x33, 0x2b, 0xff,
-    0xff, 0x00, 0x66, 0xff, 0xea, 0x04, 0x73, 0x07, 0xf2, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x01, 0x99,
-    0x00, 0x2b, 0x01, 0x5d, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x5d, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00,
-    0x60, 0xff, 0xe9, 0x04, 0x33, 0x06, 0x9b, 0x02, 0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x06, 0x01, 0x99, 0xdf, 0x06,
-    0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x06, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x66, 0xff, 0xea, 0x05, 0x7f, 0x08,
-    0x18, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x01, 0x98, 0x00, 0x3d, 0x01, 0x4a, 0x00, 0x09, 0xb1, 0x02,
-    0x02, 0xb8, 0x01, 0x4a, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x60, 0xff, 0xe9, 0x05, 0x33, 0x06, 0xc2, 0x02,
-    0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x06, 0x01, 0x98, 0xf1, 0xf4, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0xff, 0xf4,
-    0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x66, 0xff, 0xea, 0x04, 0x6d, 0x08, 0x43, 0x02, 0x26, 0x00,
-    0x31, 0x00, 0x00, 0x01, 0x07, 0x01, 0x97, 0x00, 0x2f, 0x01, 0x4b, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x4b,
-    0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x60, 0xff, 0xe9, 0x04, 0x33, 0x06, 0xed, 0x02, 0x26, 0x00, 0x51, 0x00,
-    0x00, 0x01, 0x06, 0x01, 0x97, 0xe3, 0xf5, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0xff, 0xf5, 0xb0, 0x33, 0x2b, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x66, 0xfe, 0x9e, 0x04, 0x6d, 0x07, 0x5d, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x00,
-    0x27, 0x00, 0x9c, 0x00, 0xc6, 0x01, 0x70, 0x01, 0x07, 0x00, 0xaa, 0x04, 0xb8, 0xff, 0xf8, 0x00, 0x12, 0xb1, 0x02,
-    0x01, 0xb8, 0x01, 0x70, 0xb0, 0x33, 0x2b, 0xb1, 0x03, 0x01, 0xb8, 0xff, 0xf8, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00,
-    0x60, 0xfe, 0x9d, 0x04, 0x33, 0x06, 0x06, 0x02, 0x26, 0x00, 0x51, 0x00, 0x00, 0x00, 0x26, 0x00, 0x9c, 0x79, 0x19,
-    0x01, 0x07, 0x00, 0xaa, 0x04, 0xa6, 0xff, 0xf7, 0x00, 0x11, 0xb1, 0x02, 0x01, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0xb1,
-    0x03, 0x01, 0xb8, 0xff, 0xf7, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5f, 0xff, 0xea, 0x05, 0x3c,
-    0x07, 0x20, 0x02, 0x26, 0x00, 0x96, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0xc7, 0x01, 0x57, 0x00, 0x09, 0xb1,
-    0x02, 0x01, 0xb8, 0x01, 0x57, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xe9, 0x04, 0xe9, 0x05, 0xde,
-    0x02, 0x26, 0x00, 0x97, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x88, 0x00, 0x15, 0x00, 0x08, 0xb1, 0x02, 0x01,
-    0xb0, 0x15, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5f, 0xff, 0xea, 0x05, 0x3c, 0x07, 0x23, 0x02, 0x26,
-    0x00, 0x96, 0x00, 0x00, 0x01, 0x07, 0x00, 0x42, 0xff, 0xe2, 0x01, 0x5a, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01,
-    0x5a, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xe9, 0x04, 0xe9, 0x05, 0xe1, 0x02, 0x26, 0x00, 0x97,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x42, 0xa3, 0x18, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x18, 0xb0, 0x33, 0x2b, 0xff,
-    0xff, 0x00, 0x5f, 0xff, 0xea, 0x05, 0x3c, 0x07, 0xc5, 0x02, 0x26, 0x00, 0x96, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa8,
-    0x04, 0xdd, 0x01, 0x52, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x52, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00,
-    0x5d, 0xff, 0xe9, 0x04, 0xe9, 0x06, 0x83, 0x02, 0x26, 0x00, 0x97, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa8, 0x04, 0x9e,
-    0x00, 0x10, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x10, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5f, 0xff,
-    0xea, 0x05, 0x3c, 0x07, 0x51, 0x02, 0x26, 0x00, 0x96, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0xd6, 0x01, 0x61,
-    0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x61, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xe9, 0x04,
-    0xe9, 0x06, 0x0f, 0x02, 0x26, 0x00, 0x97, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0x97, 0x00, 0x1f, 0x00, 0x08,
-    0xb1, 0x02, 0x01, 0xb0, 0x1f, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5f, 0xfe, 0xa6, 0x05, 0x3c, 0x05,
-    0xfb, 0x02, 0x26, 0x00, 0x96, 0x00, 0x00, 0x00, 0x07, 0x00, 0xaa, 0x04, 0xae, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5d,
-    0xfe, 0x9d, 0x04, 0xe9, 0x04, 0xac, 0x02, 0x26, 0x00, 0x97, 0x00, 0x00, 0x01, 0x07, 0x00, 0xaa, 0x04, 0xa4, 0xff,
-    0xf7, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0xff, 0xf7, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x68, 0xfe, 0xa6,
-    0x04, 0xb5, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x37, 0x00, 0x00, 0x00, 0x07, 0x00, 0xaa, 0x04, 0xa3, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x8d, 0xfe, 0xa6, 0x04, 0x54, 0x04, 0x3a, 0x02, 0x26, 0x00, 0x57, 0x00, 0x00, 0x00, 0x07, 0x00, 0xaa,
-    0x04, 0x6e, 0x00, 0x00, 0xff, 0xff, 0x00, 0x68, 0xff, 0xea, 0x04, 0xb5, 0x07, 0xb9, 0x02, 0x26, 0x00, 0x37, 0x00,
-    0x00, 0x01, 0x07, 0x00, 0xa8, 0x04, 0xf9, 0x01, 0x46, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x46, 0xb0, 0x33,
-    0x2b, 0x00, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xea, 0x04, 0x54, 0x06, 0x70, 0x02, 0x26, 0x00, 0x57, 0x00, 0x00, 0x01,
-    0x07, 0x00, 0xa8, 0x04, 0x93, 0xff, 0xfd, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xfd, 0xb0, 0x33, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x68, 0xff, 0xea, 0x05, 0xf1, 0x07, 0x20, 0x02, 0x26, 0x00, 0x98, 0x00, 0x00, 0x01, 0x07, 0x00,
-    0x73, 0x00, 0xb7, 0x01, 0x57, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x57, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff,
-    0x00, 0x8d, 0xff, 0xea, 0x05, 0x74, 0x05, 0xc9, 0x02, 0x26, 0x00, 0x99, 0x00, 0x00, 0x00, 0x06, 0x00, 0x73, 0x7e,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x68, 0xff, 0xea, 0x05, 0xf1, 0x07, 0x23, 0x02, 0x26, 0x00, 0x98, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x42, 0xff, 0xd2, 0x01, 0x5a, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5a, 0xb0, 0x33, 0x2b,
-    0x00, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xea, 0x05, 0x74, 0x05, 0xcc, 0x02, 0x26, 0x00, 0x99, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0x42, 0x99, 0x03, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x03, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x68, 0xff,
-    0xea, 0x05, 0xf1, 0x07, 0xc5, 0x02, 0x26, 0x00, 0x98, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa8, 0x04, 0xcd, 0x01, 0x52,
-    0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x52, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xea, 0x05,
-    0x74, 0x06, 0x6f, 0x02, 0x26, 0x00, 0x99, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa8, 0x04, 0x94, 0xff, 0xfc, 0x00, 0x09,
-    0xb1, 0x01, 0x01, 0xb8, 0xff, 0xfc, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x68, 0xff, 0xea, 0x05, 0xf1, 0x07,
-    0x51, 0x02, 0x26, 0x00, 0x98, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0xc6, 0x01, 0x61, 0x00, 0x09, 0xb1, 0x01,
-    0x01, 0xb8, 0x01, 0x61, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xea, 0x05, 0x74, 0x05, 0xfa, 0x02,
-    0x26, 0x00, 0x99, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0x8d, 0x00, 0x0a, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0,
-    0x0a, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x68, 0xfe, 0x9e, 0x05, 0xf1, 0x05, 0xe9, 0x02, 0x26, 0x00,
-    0x98, 0x00, 0x00, 0x01, 0x07, 0x00, 0xaa, 0x04, 0xa6, 0xff, 0xf8, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf8,
-    0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8d, 0xfe, 0xa6, 0x05, 0x74, 0x04, 0x94, 0x02, 0x26, 0x00, 0x99, 0x00,
-    0x00, 0x00, 0x07, 0x00, 0xaa, 0x04, 0x6d, 0x00, 0x00, 0xff, 0xff, 0x00, 0xd4, 0xfe, 0xb0, 0x04, 0xf1, 0x05, 0xb0,
-    0x02, 0x26, 0x00, 0x3b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xaa, 0x04, 0xa0, 0x00, 0x0a, 0x00, 0x08, 0xb1, 0x01, 0x01,
-    0xb0, 0x0a, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0xff, 0xe4, 0xfe, 0x09, 0x04, 0xbc, 0x04, 0x3a, 0x02, 0x26,
-    0x00, 0x5b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xaa, 0x05, 0x60, 0xff, 0x63, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff,
-    0x63, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xd4, 0x00, 0x00, 0x04, 0xf1, 0x07, 0xc4, 0x02, 0x26, 0x00, 0x3b,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa8, 0x04, 0xca, 0x01, 0x51, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x51, 0xb0,
-    0x33, 0x2b, 0x00, 0xff, 0xff, 0xff, 0xe4, 0xfe, 0x48, 0x04, 0xbc, 0x06, 0x70, 0x02, 0x26, 0x00, 0x5b, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa8, 0x04, 0xa7, 0xff, 0xfd, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xfd, 0xb0, 0x33, 0x2b,
-    0x00, 0xff, 0xff, 0x00, 0xd4, 0x00, 0x00, 0x04, 0xf1, 0x07, 0x50, 0x02, 0x26, 0x00, 0x3b, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa2, 0x00, 0xc3, 0x01, 0x60, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x60, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0xff, 0xe4, 0xfe, 0x48, 0x04, 0xbc, 0x05, 0xfb, 0x02, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2,
-    0x00, 0xa0, 0x00, 0x0b, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x0b, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x76, 0xff, 0xea, 0x05, 0x45, 0x06, 0x00, 0x00, 0x21, 0x00, 0x35, 0x00, 0xac, 0x40, 0x0e, 0x19, 0x01, 0x09, 0x03,
-    0x2d, 0x01, 0x08, 0x09, 0x04, 0x01, 0x01, 0x08, 0x03, 0x4a, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x25, 0x07, 0x01,
-    0x05, 0x04, 0x01, 0x00, 0x03, 0x05, 0x00, 0x62, 0x00, 0x06, 0x06, 0x3e, 0x4b, 0x00, 0x09, 0x09, 0x03, 0x5b, 0x00,
-    0x03, 0x03, 0x47, 0x4b, 0x00, 0x08, 0x08, 0x01, 0x5b, 0x02, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x1b, 0x4b, 0xb0,
-    0x23, 0x50, 0x58, 0x40, 0x29, 0x07, 0x01, 0x05, 0x04, 0x01, 0x00, 0x03, 0x05, 0x00, 0x62, 0x00, 0x06, 0x06, 0x3e,
-    0x4b, 0x00, 0x09, 0x09, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x47, 0x4b, 0x00, 0x01, 0x01, 0x3d, 0x4b, 0x00, 0x08, 0x08,
-    0x02, 0x5b, 0x00, 0x02, 0x02, 0x45, 0x02, 0x4c, 0x1b, 0x40, 0x29, 0x00, 0x06, 0x05, 0x06, 0x72, 0x07, 0x01, 0x05,
-    0x04, 0x01, 0x00, 0x03, 0x05, 0x00, 0x62, 0x00, 0x09, 0x09, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x47, 0x4b, 0x00, 0x01,
-    0x01, 0x3d, 0x4b, 0x00, 0x08, 0x08, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x45, 0x02, 0x4c, 0x59, 0x59, 0x40, 0x0e, 0x31,
-    0x2f, 0x27, 0x11, 0x11, 0x11, 0x13, 0x2d, 0x23, 0x11, 0x10, 0x0a, 0x08, 0x1d, 0x2b, 0x01, 0x23, 0x03, 0x23, 0x37,
-    0x06, 0x06, 0x27, 0x2e, 0x05, 0x37, 0x37, 0x3e, 0x05, 0x17, 0x16, 0x16, 0x17, 0x13, 0x23, 0x37, 0x33, 0x37, 0x33,
-    0x07, 0x33, 0x01, 0x06, 0x14, 0x1e, 0x03, 0x17, 0x16, 0x36, 0x37, 0x13, 0x26, 0x26, 0x27, 0x26, 0x0e, 0x02, 0x07,
-    0x05, 0x2a, 0xbf, 0xd6, 0xa4, 0x13, 0x3f, 0x9b, 0x5d, 0x46, 0x6d, 0x4f, 0x33, 0x1c, 0x06, 0x06, 0x02, 0x08, 0x26,
-    0x3c, 0x53, 0x69, 0x82, 0x4d, 0x51, 0x8c, 0x33, 0x30, 0xf4, 0x1b, 0xf5, 0x1c, 0xb5, 0x1a, 0xbf, 0xfb, 0xeb, 0x05,
-    0x0d, 0x1c, 0x32, 0x4a, 0x33, 0x59, 0x85, 0x32, 0x57, 0x1d, 0x6b, 0x4d, 0x54, 0x7c, 0x56, 0x33, 0x09, 0x04, 0xd2,
-    0xfb, 0x2e, 0x72, 0x43, 0x45, 0x02, 0x02, 0x31, 0x52, 0x6b, 0x77, 0x7c, 0x3b, 0x15, 0x43, 0x88, 0x7e, 0x6c, 0x50,
-    0x2c, 0x02, 0x02, 0x3c, 0x42, 0x01, 0x04, 0x97, 0x97, 0x97, 0xfc, 0xa1, 0x28, 0x58, 0x55, 0x4c, 0x3b, 0x24, 0x01,
-    0x03, 0x58, 0x45, 0x01, 0xf9, 0x45, 0x4f, 0x02, 0x03, 0x48, 0x75, 0x91, 0x48, 0x00, 0xff, 0xff, 0x00, 0x2c, 0xfe,
-    0xed, 0x05, 0x45, 0x06, 0x00, 0x00, 0x26, 0x00, 0x46, 0x00, 0x00, 0x00, 0x27, 0x01, 0xca, 0x01, 0x8b, 0x02, 0x47,
-    0x01, 0x06, 0x00, 0x41, 0x18, 0x84, 0x00, 0x12, 0xb1, 0x02, 0x01, 0xb8, 0x02, 0x47, 0xb0, 0x33, 0x2b, 0xb1, 0x03,
-    0x01, 0xb8, 0xff, 0x84, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3b, 0xfe, 0xa0, 0x05, 0x06, 0x05, 0xb0,
-    0x02, 0x26, 0x01, 0xda, 0x00, 0x00, 0x01, 0x07, 0x01, 0xce, 0x02, 0x11, 0x00, 0x07, 0x00, 0x08, 0xb1, 0x01, 0x01,
-    0xb0, 0x07, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x36, 0xfe, 0x99, 0x04, 0xab, 0x04, 0x3a, 0x02, 0x26,
-    0x00, 0xed, 0x00, 0x00, 0x00, 0x07, 0x01, 0xce, 0x01, 0xec, 0x00, 0x00, 0xff, 0xff, 0x00, 0x20, 0xfe, 0x99, 0x04,
-    0xb4, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x07, 0x01, 0xce, 0x01, 0xdb, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x37, 0xfe, 0x99, 0x04, 0x5c, 0x04, 0x3a, 0x02, 0x26, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x07, 0x01, 0xce, 0x01,
-    0xe2, 0x00, 0x00, 0xff, 0xff, 0x00, 0xc2, 0xfe, 0x99, 0x04, 0xf7, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x36, 0x00, 0x00,
-    0x00, 0x07, 0x01, 0xce, 0x00, 0x88, 0x00, 0x00, 0xff, 0xff, 0x00, 0x9e, 0xfe, 0x99, 0x04, 0xad, 0x04, 0x3a, 0x02,
-    0x26, 0x00, 0xf2, 0x00, 0x00, 0x00, 0x07, 0x01, 0xce, 0x00, 0x91, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf1, 0xfe, 0x99,
-    0x04, 0xee, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x07, 0x01, 0xce, 0x02, 0x22, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x06, 0xfe, 0x99, 0x04, 0x98, 0x04, 0x3a, 0x02, 0x26, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x07, 0x01, 0xce,
-    0x01, 0xb4, 0x00, 0x00, 0xff, 0xff, 0x00, 0xe4, 0xfe, 0x99, 0x04, 0x9d, 0x05, 0xb0, 0x02, 0x26, 0x00, 0xdd, 0x00,
-    0x00, 0x00, 0x07, 0x01, 0xce, 0x01, 0xe2, 0x00, 0x00, 0xff, 0xff, 0x00, 0x9f, 0xfe, 0x99, 0x04, 0x5c, 0x04, 0x3a,
-    0x02, 0x26, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x07, 0x01, 0xce, 0x01, 0xe2, 0x00, 0x00, 0xff, 0xff, 0x00, 0xe4, 0xfe,
-    0x99, 0x04, 0x9d, 0x05, 0xb0, 0x02, 0x26, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x07, 0x01, 0xce, 0x00, 0xd7, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x9f, 0xfe, 0x99, 0x04, 0x5c, 0x04, 0x3a, 0x02, 0x26, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x07, 0x01,
-    0xce, 0x00, 0xd6, 0x00, 0x00, 0xff, 0xff, 0x00, 0x47, 0xfe, 0x99, 0x04, 0xa5, 0x05, 0xb0, 0x02, 0x26, 0x00, 0xae,
-    0x00, 0x00, 0x00, 0x07, 0x01, 0xce, 0xff, 0x40, 0x00, 0x00, 0xff, 0xff, 0x00, 0x49, 0xfe, 0x99, 0x04, 0x5f, 0x04,
-    0x3a, 0x02, 0x26, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x07, 0x01, 0xce, 0xff, 0x13, 0x00, 0x00, 0xff, 0xff, 0xff, 0xb0,
-    0xfe, 0x99, 0x04, 0xfe, 0x05, 0xb0, 0x02, 0x26, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x07, 0x01, 0xce, 0x02, 0x2b, 0x00,
-    0x00, 0xff, 0xff, 0xff, 0xa3, 0xfe, 0x99, 0x04, 0xc1, 0x04, 0x3a, 0x02, 0x26, 0x00, 0xea, 0x00, 0x00, 0x00, 0x07,
-    0x01, 0xce, 0x02, 0x20, 0x00, 0x00, 0xff, 0xff, 0x00, 0x73, 0xfe, 0x3b, 0x04, 0xa4, 0x05, 0xc5, 0x02, 0x26, 0x01,
-    0x3d, 0x00, 0x00, 0x01, 0x07, 0x01, 0xce, 0x00, 0xa9, 0xff, 0xa2, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0xff, 0xa2,
-    0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x4f, 0xfe, 0x3b, 0x04, 0x6f, 0x04, 0x51, 0x02, 0x26, 0x01, 0x3e, 0x00,
-    0x00, 0x01, 0x07, 0x01, 0xce, 0x00, 0x86, 0xff, 0xa2, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0xff, 0xa2, 0xb0, 0x33,
-    0x2b, 0x00, 0xff, 0xff, 0x00, 0x40, 0x00, 0x00, 0x04, 0x20, 0x06, 0x00, 0x02, 0x06, 0x00, 0x4a, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x34, 0xff, 0xff, 0x03, 0xf7, 0x04, 0x3a, 0x00, 0x16, 0x00, 0x23, 0x00, 0x37, 0x40, 0x34, 0x06, 0x01,
-    0x04, 0x03, 0x01, 0x00, 0x01, 0x04, 0x00, 0x62, 0x00, 0x01, 0x09, 0x01, 0x08, 0x07, 0x01, 0x08, 0x63, 0x00, 0x05,
-    0x05, 0x18, 0x4b, 0x00, 0x07, 0x07, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x17, 0x17, 0x17, 0x23, 0x17,
-    0x22, 0x22, 0x11, 0x11, 0x11, 0x11, 0x28, 0x21, 0x10, 0x0a, 0x06, 0x1c, 0x2b, 0x01, 0x21, 0x07, 0x05, 0x1e, 0x03,
-    0x07, 0x0e, 0x03, 0x27, 0x21, 0x13, 0x23, 0x37, 0x33, 0x37, 0x33, 0x07, 0x21, 0x01, 0x03, 0x05, 0x32, 0x3e, 0x02,
-    0x37, 0x36, 0x2e, 0x02, 0x27, 0x02, 0x9f, 0xfe, 0xd8, 0x16, 0x01, 0x34, 0x49, 0x83, 0x61, 0x35, 0x05, 0x06, 0x4e,
-    0x7b, 0x99, 0x51, 0xfd, 0xff, 0x8b, 0x8f, 0x1b, 0x8e, 0x16, 0xb5, 0x17, 0x01, 0x29, 0xfe, 0x8d, 0x41, 0x01, 0x37,
-    0x2d, 0x56, 0x46, 0x30, 0x06, 0x06, 0x16, 0x2f, 0x43, 0x28, 0x03, 0x23, 0x83, 0x02, 0x02, 0x29, 0x51, 0x77, 0x50,
-    0x58, 0x83, 0x56, 0x2b, 0x01, 0x03, 0x23, 0x97, 0x80, 0x80, 0xfe, 0x4f, 0xfe, 0x8e, 0x01, 0x17, 0x2f, 0x47, 0x31,
-    0x2a, 0x42, 0x2d, 0x19, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2c, 0xff, 0xff, 0x04, 0x1b, 0x05, 0xb0, 0x00,
-    0x16, 0x00, 0x23, 0x00, 0x37, 0x40, 0x34, 0x06, 0x01, 0x04, 0x03, 0x01, 0x00, 0x01, 0x04, 0x00, 0x62, 0x00, 0x01,
-    0x09, 0x01, 0x08, 0x07, 0x01, 0x08, 0x63, 0x00, 0x05, 0x05, 0x16, 0x4b, 0x00, 0x07, 0x07, 0x02, 0x5b, 0x00, 0x02,
-    0x02, 0x17, 0x02, 0x4c, 0x17, 0x17, 0x17, 0x23, 0x17, 0x22, 0x22, 0x11, 0x11, 0x11, 0x11, 0x28, 0x21, 0x10, 0x0a,
-    0x06, 0x1c, 0x2b, 0x01, 0x23, 0x07, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x27, 0x21, 0x13, 0x23, 0x37, 0x33, 0x37,
-    0x33, 0x07, 0x33, 0x01, 0x03, 0x17, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x02, 0x97, 0xe8, 0x2b, 0xf5,
-    0x5e, 0x9e, 0x6f, 0x37, 0x08, 0x09, 0x5d, 0x90, 0xba, 0x67, 0xfe, 0x3e, 0xc0, 0xce, 0x1b, 0xcd, 0x23, 0xb5, 0x23,
-    0xe9, 0xfe, 0xb8, 0x61, 0xf7, 0x44, 0x78, 0x5c, 0x3c, 0x09, 0x07, 0x19, 0x3d, 0x5d, 0x3b, 0x04, 0x50, 0xf7, 0x01,
-    0x03, 0x38, 0x69, 0x99, 0x63, 0x6c, 0xa5, 0x70, 0x38, 0x01, 0x04, 0x50, 0x97, 0xc9, 0xc9, 0xfd, 0xdb, 0xfd, 0xd5,
-    0x02, 0x28, 0x4c, 0x6d, 0x45, 0x3c, 0x5f, 0x43, 0x26, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2c, 0xff, 0xff,
-    0x04, 0x1b, 0x05, 0xb0, 0x00, 0x16, 0x00, 0x23, 0x00, 0x37, 0x40, 0x34, 0x06, 0x01, 0x04, 0x03, 0x01, 0x00, 0x01,
-    0x04, 0x00, 0x62, 0x00, 0x01, 0x09, 0x01, 0x08, 0x07, 0x01, 0x08, 0x63, 0x00, 0x05, 0x05, 0x16, 0x4b, 0x00, 0x07,
-    0x07, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x17, 0x17, 0x17, 0x23, 0x17, 0x22, 0x22, 0x11, 0x11, 0x11,
-    0x11, 0x28, 0x21, 0x10, 0x0a, 0x06, 0x1c, 0x2b, 0x01, 0x23, 0x07, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x27, 0x21,
-    0x13, 0x23, 0x37, 0x33, 0x37, 0x33, 0x07, 0x33, 0x01, 0x03, 0x17, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x27,
-    0x02, 0x97, 0xe8, 0x2b, 0xf5, 0x5e, 0x9e, 0x6f, 0x37, 0x08, 0x09, 0x5d, 0x90, 0xba, 0x67, 0xfe, 0x3e, 0xc0, 0xce,
-    0x1b, 0xcd, 0x23, 0xb5, 0x23, 0xe9, 0xfe, 0xb8, 0x61, 0xf7, 0x44, 0x78, 0x5c, 0x3c, 0x09, 0x07, 0x19, 0x3d, 0x5d,
-    0x3b, 0x04, 0x50, 0xf7, 0x01, 0x03, 0x38, 0x69, 0x99, 0x63, 0x6c, 0xa5, 0x70, 0x38, 0x01, 0x04, 0x50, 0x97, 0xc9,
-    0xc9, 0xfd, 0xdb, 0xfd, 0xd5, 0x02, 0x28, 0x4c, 0x6d, 0x45, 0x3c, 0x5f, 0x43, 0x26, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x0c, 0x00, 0x00, 0x04, 0xa5, 0x05, 0xb0, 0x00, 0x0d, 0x00, 0x27, 0x40, 0x24, 0x06, 0x01, 0x03, 0x02,
-    0x01, 0x00, 0x01, 0x03, 0x00, 0x61, 0x00, 0x05, 0x05, 0x04, 0x59, 0x00, 0x04, 0x04, 0x16, 0x4b, 0x00, 0x01, 0x01,
-    0x17, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x01, 0x21, 0x03, 0x23, 0x13,
-    0x23, 0x37, 0x33, 0x13, 0x21, 0x07, 0x21, 0x03, 0x21, 0x02, 0x77, 0xfe, 0xfc, 0x76, 0xb6, 0x77, 0xb2, 0x1b, 0xb1,
-    0x6c, 0x03, 0x61, 0x1b, 0xfd, 0x55, 0x52, 0x01, 0x05, 0x02, 0xac, 0xfd, 0x54, 0x02, 0xac, 0x97, 0x02, 0x6d, 0x98,
-    0xfe, 0x2b, 0x00, 0x00, 0x00, 0x01, 0xff, 0xe6, 0x00, 0x00, 0x04, 0x5f, 0x04, 0x3a, 0x00, 0x0d, 0x00, 0x27, 0x40,
-    0x24, 0x06, 0x01, 0x03, 0x02, 0x01, 0x00, 0x01, 0x03, 0x00, 0x61, 0x00, 0x05, 0x05, 0x04, 0x59, 0x00, 0x04, 0x04,
-    0x18, 0x4b, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x07, 0x06, 0x1b, 0x2b,
-    0x01, 0x23, 0x03, 0x23, 0x13, 0x23, 0x37, 0x33, 0x13, 0x21, 0x07, 0x21, 0x03, 0x21, 0x02, 0x51, 0xff, 0x53, 0xb6,
-    0x53, 0xb6, 0x1b, 0xb5, 0x4f, 0x03, 0x5a, 0x1b, 0xfd, 0x5c, 0x34, 0x01, 0x00, 0x01, 0xdf, 0xfe, 0x21, 0x01, 0xdf,
-    0x97, 0x01, 0xc4, 0x99, 0xfe, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x00, 0x00, 0x05, 0x1a, 0x05, 0xb0,
-    0x00, 0x14, 0x00, 0x36, 0x40, 0x33, 0x06, 0x01, 0x04, 0x01, 0x01, 0x4a, 0x09, 0x01, 0x07, 0x06, 0x01, 0x00, 0x01,
-    0x07, 0x00, 0x62, 0x00, 0x01, 0x00, 0x04, 0x03, 0x01, 0x04, 0x61, 0x08, 0x01, 0x02, 0x02, 0x16, 0x4b, 0x05, 0x01,
-    0x03, 0x03, 0x17, 0x03, 0x4c, 0x14, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x10, 0x0a, 0x06, 0x1d,
-    0x2b, 0x01, 0x21, 0x03, 0x33, 0x01, 0x33, 0x01, 0x01, 0x23, 0x01, 0x23, 0x03, 0x23, 0x13, 0x23, 0x37, 0x33, 0x37,
-    0x33, 0x07, 0x21, 0x02, 0xd0, 0xfe, 0xf8, 0x38, 0x90, 0x02, 0x1e, 0xdc, 0xfd, 0x9d, 0x01, 0x81, 0xd0, 0xfe, 0xba,
-    0xab, 0x73, 0xb5, 0xc4, 0xae, 0x1b, 0xad, 0x1f, 0xb5, 0x1f, 0x01, 0x09, 0x04, 0x69, 0xfe, 0xc1, 0x02, 0x86, 0xfd,
-    0x35, 0xfd, 0x1b, 0x02, 0x93, 0xfd, 0x6d, 0x04, 0x69, 0x97, 0xb0, 0xb0, 0x00, 0x01, 0x00, 0x56, 0x00, 0x00, 0x04,
-    0x78, 0x06, 0x00, 0x00, 0x14, 0x00, 0x59, 0xb7, 0x09, 0x06, 0x02, 0x03, 0x02, 0x01, 0x01, 0x4a, 0x4b, 0xb0, 0x10,
-    0x50, 0x58, 0x40, 0x1c, 0x00, 0x06, 0x05, 0x05, 0x06, 0x66, 0x07, 0x01, 0x05, 0x04, 0x01, 0x00, 0x01, 0x05, 0x00,
-    0x62, 0x00, 0x01, 0x01, 0x18, 0x4b, 0x03, 0x01, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x1b, 0x40, 0x1b, 0x00, 0x06, 0x05,
-    0x06, 0x72, 0x07, 0x01, 0x05, 0x04, 0x01, 0x00, 0x01, 0x05, 0x00, 0x62, 0x00, 0x01, 0x01, 0x18, 0x4b, 0x03, 0x01,
-    0x02, 0x02, 0x17, 0x02, 0x4c, 0x59, 0x40, 0x0b, 0x11, 0x11, 0x11, 0x11, 0x13, 0x12, 0x13, 0x10, 0x08, 0x06, 0x1c,
-    0x2b, 0x01, 0x23, 0x03, 0x37, 0x01, 0x33, 0x01, 0x01, 0x23, 0x01, 0x07, 0x03, 0x23, 0x13, 0x23, 0x37, 0x33, 0x37,
-    0x33, 0x07, 0x33, 0x02, 0xca, 0xeb, 0x6a, 0x85, 0x01, 0x92, 0xec, 0xfd, 0xfe, 0x01, 0x78, 0xd7, 0xfe, 0xd7, 0xa3,
-    0x3f, 0xb6, 0xd3, 0xca, 0x1b, 0xca, 0x1d, 0xb6, 0x1d, 0xeb, 0x04, 0xc1, 0xfd, 0x9d, 0x7b, 0x01, 0x61, 0xfe, 0x34,
-    0xfd, 0x92, 0x01, 0xf7, 0x89, 0xfe, 0x92, 0x04, 0xc1, 0x97, 0xa8, 0xa8, 0x00, 0xff, 0xff, 0x00, 0x35, 0xfe, 0x8a,
-    0x04, 0xa0, 0x07, 0x3f, 0x02, 0x26, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x27, 0x00, 0x9e, 0x00, 0x47, 0x01, 0x8c, 0x01,
-    0x07, 0x00, 0x0e, 0x02, 0x47, 0xff, 0xda, 0x00, 0x12, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x8c, 0xb0, 0x33, 0x2b, 0xb1,
-    0x02, 0x01, 0xb8, 0xff, 0xda, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x37, 0xfe, 0x8a, 0x04, 0x73, 0x05, 0xf4, 0x02,
-    0x26, 0x00, 0xec, 0x00, 0x00, 0x00, 0x26, 0x00, 0x9e, 0x09, 0x41, 0x01, 0x07, 0x00, 0x0e, 0x02, 0x44, 0xff, 0xda,
-    0x00, 0x11, 0xb1, 0x01, 0x01, 0xb0, 0x41, 0xb0, 0x33, 0x2b, 0xb1, 0x02, 0x01, 0xb8, 0xff, 0xda, 0xb0, 0x33, 0x2b,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x20, 0xfe, 0x8a, 0x04, 0xb4, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x2a, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x0e, 0x02, 0x3d, 0xff, 0xda, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xda, 0xb0, 0x33, 0x2b,
-    0x00, 0xff, 0xff, 0x00, 0x37, 0xfe, 0x8a, 0x04, 0x73, 0x04, 0x3a, 0x02, 0x26, 0x00, 0xf0, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x0e, 0x02, 0x44, 0xff, 0xda, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xda, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0x00, 0x27, 0xfe, 0x8a, 0x04, 0xc0, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x07, 0x00, 0x0e,
-    0x02, 0x65, 0xff, 0xda, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xda, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00,
-    0x1c, 0xfe, 0x8a, 0x04, 0x77, 0x04, 0x3a, 0x02, 0x26, 0x00, 0xef, 0x00, 0x00, 0x01, 0x07, 0x00, 0x0e, 0x02, 0x48,
-    0xff, 0xda, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xda, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0xff, 0xca, 0xfe,
-    0x8a, 0x04, 0xa0, 0x05, 0xb0, 0x02, 0x26, 0x00, 0xda, 0x00, 0x00, 0x01, 0x07, 0x00, 0x0e, 0x02, 0x48, 0xff, 0xda,
-    0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xda, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0xff, 0xd2, 0xfe, 0x8a, 0x04,
-    0x72, 0x04, 0x3a, 0x02, 0x26, 0x00, 0xee, 0x00, 0x00, 0x01, 0x07, 0x00, 0x0e, 0x02, 0x43, 0xff, 0xda, 0x00, 0x09,
-    0xb1, 0x01, 0x01, 0xb8, 0xff, 0xda, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x01, 0x00, 0xd4, 0x00, 0x00, 0x04, 0xf1, 0x05,
-    0xb0, 0x00, 0x0e, 0x00, 0x29, 0x40, 0x26, 0x0a, 0x01, 0x03, 0x04, 0x01, 0x4a, 0x06, 0x01, 0x03, 0x02, 0x01, 0x00,
-    0x01, 0x03, 0x00, 0x62, 0x05, 0x01, 0x04, 0x04, 0x16, 0x4b, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x11, 0x12, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x01, 0x23, 0x03, 0x23, 0x13, 0x23, 0x37, 0x33, 0x03, 0x33, 0x13,
-    0x01, 0x33, 0x01, 0x33, 0x03, 0x74, 0xe1, 0x5e, 0xa8, 0x5a, 0xde, 0x1b, 0x9f, 0xef, 0xc4, 0xc2, 0x01, 0xc0, 0xd7,
-    0xfe, 0x04, 0x9a, 0x02, 0x12, 0xfd, 0xee, 0x02, 0x12, 0x97, 0x03, 0x07, 0xfd, 0x26, 0x02, 0xda, 0xfc, 0xf9, 0x00,
-    0x00, 0x01, 0x00, 0x9d, 0xfe, 0x60, 0x04, 0xcc, 0x04, 0x3a, 0x00, 0x10, 0x00, 0x2c, 0x40, 0x29, 0x0b, 0x0a, 0x02,
-    0x03, 0x04, 0x01, 0x4a, 0x05, 0x01, 0x04, 0x04, 0x18, 0x4b, 0x06, 0x01, 0x03, 0x03, 0x00, 0x5a, 0x02, 0x01, 0x00,
-    0x00, 0x17, 0x4b, 0x00, 0x01, 0x01, 0x1a, 0x01, 0x4c, 0x11, 0x14, 0x11, 0x11, 0x11, 0x11, 0x10, 0x07, 0x06, 0x1b,
-    0x2b, 0x05, 0x23, 0x03, 0x23, 0x13, 0x23, 0x37, 0x33, 0x03, 0x33, 0x13, 0x17, 0x37, 0x01, 0x33, 0x01, 0x33, 0x03,
-    0x2c, 0xde, 0x47, 0xb6, 0x46, 0xd6, 0x1b, 0xb5, 0xf4, 0xb0, 0xc4, 0x05, 0x2e, 0x01, 0xc6, 0xc2, 0xfd, 0xc8, 0xb3,
-    0x0b, 0xfe, 0x6b, 0x01, 0x95, 0x97, 0x03, 0xae, 0xfc, 0xe7, 0x55, 0x67, 0x03, 0x07, 0xfc, 0x52, 0x00, 0x00, 0x01,
-    0xff, 0xf1, 0x00, 0x00, 0x04, 0xee, 0x05, 0xb0, 0x00, 0x11, 0x00, 0x2f, 0x40, 0x2c, 0x0d, 0x01, 0x04, 0x05, 0x04,
-    0x01, 0x01, 0x00, 0x02, 0x4a, 0x07, 0x01, 0x04, 0x03, 0x01, 0x00, 0x01, 0x04, 0x00, 0x62, 0x06, 0x01, 0x05, 0x05,
-    0x16, 0x4b, 0x02, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x10, 0x08, 0x06,
-    0x1c, 0x2b, 0x01, 0x23, 0x01, 0x23, 0x03, 0x01, 0x23, 0x01, 0x23, 0x37, 0x33, 0x01, 0x33, 0x13, 0x01, 0x33, 0x01,
-    0x33, 0x03, 0x9c, 0xa9, 0x01, 0x17, 0xc9, 0xdc, 0xfe, 0x6c, 0xe0, 0x01, 0xe9, 0xa9, 0x1b, 0xa4, 0xfe, 0xfa, 0xc9,
-    0xd3, 0x01, 0x89, 0xdf, 0xfe, 0x33, 0x96, 0x02, 0x9e, 0xfd, 0x62, 0x02, 0x45, 0xfd, 0xbb, 0x02, 0x9e, 0x97, 0x02,
-    0x7b, 0xfd, 0xc6, 0x02, 0x3a, 0xfd, 0x85, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x04, 0x98, 0x04, 0x3a, 0x00,
-    0x11, 0x00, 0x2f, 0x40, 0x2c, 0x0d, 0x01, 0x04, 0x05, 0x04, 0x01, 0x01, 0x00, 0x02, 0x4a, 0x07, 0x01, 0x04, 0x03,
-    0x01, 0x00, 0x01, 0x04, 0x00, 0x62, 0x06, 0x01, 0x05, 0x05, 0x18, 0x4b, 0x02, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4c,
-    0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x10, 0x08, 0x06, 0x1c, 0x2b, 0x01, 0x23, 0x01, 0x23, 0x03, 0x01, 0x23,
-    0x01, 0x23, 0x37, 0x33, 0x01, 0x33, 0x13, 0x01, 0x33, 0x01, 0x33, 0x03, 0x73, 0x9d, 0x01, 0x17, 0xc4, 0xe2, 0xfe,
-    0x9e, 0xdf, 0x01, 0xad, 0xab, 0x1b, 0xa5, 0xfe, 0xfe, 0xc5, 0xd6, 0x01, 0x57, 0xe0, 0xfe, 0x6f, 0x87, 0x01, 0xe1,
-    0xfe, 0x1f, 0x01, 0x9b, 0xfe, 0x65, 0x01, 0xe1, 0x97, 0x01, 0xc2, 0xfe, 0x70, 0x01, 0x90, 0xfe, 0x3e, 0x00, 0xff,
-    0xff, 0x00, 0x50, 0xff, 0xea, 0x04, 0x4f, 0x04, 0x4e, 0x02, 0x06, 0x00, 0xbc, 0x00, 0x00, 0xff, 0xff, 0xff, 0xd7,
-    0x00, 0x00, 0x04, 0xb2, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x28, 0x00, 0x00, 0x01, 0x07, 0x01, 0xca, 0xfe, 0xa3, 0xfe,
-    0x7f, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0x7f, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x56, 0x02, 0x8b,
-    0x04, 0x98, 0x03, 0x22, 0x00, 0x47, 0x01, 0x88, 0xff, 0x77, 0x00, 0x00, 0x53, 0x33, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x01, 0x80, 0xff, 0xf3, 0x03, 0x33, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x13, 0x00, 0x3e, 0x4b, 0xb0, 0x0a, 0x50,
-    0x58, 0x40, 0x15, 0x00, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x3c, 0x4b, 0x00, 0x02, 0x02, 0x03, 0x5b, 0x00,
-    0x03, 0x03, 0x3d, 0x03, 0x4c, 0x1b, 0x40, 0x15, 0x00, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x3c, 0x4b, 0x00,
-    0x02, 0x02, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x45, 0x03, 0x4c, 0x59, 0xb6, 0x26, 0x23, 0x11, 0x10, 0x04, 0x08, 0x18,
-    0x2b, 0x01, 0x23, 0x13, 0x33, 0x01, 0x36, 0x36, 0x37, 0x36, 0x1e, 0x02, 0x15, 0x06, 0x06, 0x07, 0x06, 0x2e, 0x02,
-    0x02, 0x88, 0xb6, 0xab, 0xb6, 0xfe, 0x4d, 0x01, 0x3d, 0x32, 0x18, 0x2a, 0x1e, 0x10, 0x01, 0x40, 0x30, 0x18, 0x29,
-    0x1d, 0x11, 0x01, 0xd7, 0x03, 0xd9, 0xfa, 0xae, 0x31, 0x41, 0x02, 0x01, 0x10, 0x1e, 0x29, 0x18, 0x31, 0x3d, 0x02,
-    0x01, 0x0f, 0x1c, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x41, 0x90, 0x25, 0xfe, 0x7c, 0x5f,
-    0x0f, 0x3c, 0xf5, 0x00, 0x0b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf0, 0x11, 0x2e, 0x00, 0x00, 0x00, 0x00,
-    0xd1, 0x82, 0xb3, 0x5b, 0xfc, 0xac, 0xfd, 0xd5, 0x07, 0xe5, 0x08, 0x73, 0x00, 0x02, 0x00, 0x09, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x62, 0xfd, 0xd5, 0x00, 0x00, 0x09, 0x64, 0xfc, 0xac,
-    0xf8, 0xc3, 0x07, 0xe5, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x04, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xb2, 0x00, 0x00, 0x04, 0xb2, 0x00, 0x00,
-    0x04, 0xb2, 0x01, 0x9e, 0x04, 0xb2, 0x00, 0x1a, 0x04, 0xb2, 0x00, 0x7c, 0x04, 0xb2, 0x00, 0x82, 0x04, 0xb2, 0x00,
-    0x3f, 0x04, 0xb2, 0x02, 0x26, 0x04, 0xb2, 0x01, 0x46, 0x04, 0xb2, 0x00, 0xa0, 0x04, 0xb2, 0x00, 0xb5, 0x04, 0xb2,
-    0x00, 0x72, 0x04, 0xb2, 0x00, 0xc2, 0x04, 0xb3, 0x00, 0xcc, 0x04, 0xb2, 0x01, 0x8e, 0x04, 0xb2, 0x00, 0x72, 0x04,
-    0xb2, 0x00, 0x7f, 0x04, 0xb2, 0x01, 0x1a, 0x04, 0xb2, 0x00, 0x0f, 0x04, 0xb2, 0x00, 0x2f, 0x04, 0xb2, 0x00, 0x1b,
-    0x04, 0xb2, 0x00, 0x8f, 0x04, 0xb2, 0x00, 0x75, 0x04, 0xb2, 0x00, 0xbf, 0x04, 0xb2, 0x00, 0x80, 0x04, 0xb2, 0x00,
-    0xc3, 0x04, 0xb2, 0x01, 0xbf, 0x04, 0xb2, 0x01, 0x42, 0x04, 0xb2, 0x00, 0xa1, 0x04, 0xb2, 0x00, 0x7e, 0x04, 0xb2,
-    0x00, 0x65, 0x04, 0xb2, 0x01, 0x17, 0x04, 0xb2, 0x00, 0x43, 0x04, 0xb2, 0xff, 0xe2, 0x04, 0xb2, 0x00, 0x3e, 0x04,
-    0xb2, 0x00, 0x64, 0x04, 0xb2, 0x00, 0x2e, 0x04, 0xb2, 0x00, 0x48, 0x04, 0xb2, 0x00, 0x51, 0x04, 0xb2, 0x00, 0x60,
-    0x04, 0xb2, 0x00, 0x20, 0x04, 0xb2, 0x00, 0x40, 0x04, 0xb2, 0x00, 0x3f, 0x04, 0xb2, 0x00, 0x3e, 0x04, 0xb2, 0x00,
-    0x58, 0x04, 0xb2, 0x00, 0x27, 0x04, 0xb2, 0x00, 0x22, 0x04, 0xb2, 0x00, 0x66, 0x04, 0xb2, 0x00, 0x51, 0x04, 0xb2,
-    0x00, 0x5d, 0x04, 0xb2, 0x00, 0x47, 0x04, 0xb2, 0x00, 0x53, 0x04, 0xb2, 0x00, 0xc2, 0x04, 0xb2, 0x00, 0x68, 0x04,
-    0xb2, 0x00, 0xcd, 0x04, 0xb2, 0x00, 0x95, 0x04, 0xb2, 0xff, 0xf1, 0x04, 0xb2, 0x00, 0xd4, 0x04, 0xb2, 0x00, 0x13,
-    0x04, 0xb2, 0x01, 0x0e, 0x04, 0xb2, 0x01, 0x78, 0x04, 0xb2, 0x00, 0xfa, 0x04, 0xb2, 0x00, 0xe8, 0x04, 0xb2, 0x00,
-    0x14, 0x04, 0xb2, 0x02, 0x23, 0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2, 0x00, 0x41, 0x04, 0xb2, 0x00, 0x75, 0x04, 0xb2,
-    0x00, 0x76, 0x04, 0xb2, 0x00, 0x6c, 0x04, 0xb3, 0x00, 0xcd, 0x04, 0xb2, 0x00, 0x2d, 0x04, 0xb2, 0x00, 0x40, 0x04,
-    0xb2, 0x00, 0x5c, 0x04, 0xb2, 0x00, 0x23, 0x04, 0xb2, 0x00, 0x42, 0x04, 0xb2, 0x00, 0x5c, 0x04, 0xb2, 0xff, 0xf2,
-    0x04, 0xb2, 0x00, 0x40, 0x04, 0xb2, 0x00, 0x60, 0x04, 0xb2, 0xff, 0xf7, 0x04, 0xb2, 0x00, 0x76, 0x04, 0xb2, 0x00,
-    0xd7, 0x04, 0xb2, 0x00, 0x7c, 0x04, 0xb2, 0x00, 0xc4, 0x04, 0xb2, 0x00, 0x8d, 0x04, 0xb2, 0x00, 0xae, 0x04, 0xb2,
-    0x00, 0x84, 0x04, 0xb2, 0x00, 0x06, 0x04, 0xb2, 0xff, 0xe4, 0x04, 0xb2, 0x00, 0x3d, 0x04, 0xb2, 0x01, 0x34, 0x04,
-    0xb2, 0x01, 0x6f, 0x04, 0xb2, 0x00, 0xb2, 0x04, 0xb2, 0x00, 0x1c, 0x04, 0xb2, 0x01, 0x51, 0x04, 0xb2, 0x00, 0x7a,
-    0x04, 0xb2, 0x00, 0x09, 0x04, 0xb2, 0x00, 0x10, 0x04, 0xb2, 0x00, 0x56, 0x04, 0xb2, 0x01, 0x58, 0x04, 0xb2, 0xff,
-    0xd7, 0x04, 0xb2, 0x01, 0x8e, 0x04, 0xb2, 0x00, 0x43, 0x04, 0xb2, 0x01, 0x47, 0x04, 0xb2, 0x00, 0xbd, 0x04, 0xb2,
-    0x00, 0xbd, 0x04, 0xb2, 0x00, 0x40, 0x04, 0xb2, 0x01, 0x68, 0x04, 0xb2, 0x01, 0xc6, 0x04, 0xb2, 0x00, 0x60, 0x04,
-    0xb2, 0x01, 0x4f, 0x04, 0xb2, 0x01, 0x6b, 0x04, 0xb2, 0x01, 0xe7, 0x04, 0xb2, 0x00, 0x06, 0x04, 0xb2, 0x01, 0x07,
-    0x04, 0xb2, 0x01, 0xff, 0x04, 0xb2, 0x01, 0x17, 0x04, 0xb2, 0x01, 0xdf, 0x04, 0xb2, 0x01, 0x4d, 0x04, 0xb2, 0x00,
-    0x96, 0x04, 0xb2, 0x00, 0xa7, 0x04, 0xb2, 0x00, 0x9a, 0x04, 0xb2, 0x00, 0x6a, 0x04, 0xb2, 0x00, 0x56, 0x04, 0xb2,
-    0xff, 0xb2, 0x04, 0xb2, 0x00, 0x81, 0x04, 0xb2, 0xff, 0xc6, 0x04, 0xb2, 0x00, 0x3a, 0x04, 0xb2, 0x00, 0x3b, 0x04,
-    0xb2, 0xff, 0xf1, 0x04, 0xb2, 0x00, 0x28, 0x04, 0xb2, 0x00, 0x6f, 0x04, 0xb2, 0x00, 0x56, 0x04, 0xb2, 0xff, 0xf7,
-    0x04, 0xb2, 0x00, 0x1d, 0x04, 0xb2, 0x00, 0x5c, 0x04, 0xb2, 0x00, 0x14, 0x04, 0xb2, 0xff, 0xe5, 0x04, 0xb2, 0x00,
-    0x4c, 0x04, 0xb2, 0x00, 0x33, 0x04, 0xb2, 0x00, 0x5c, 0x04, 0xb2, 0x00, 0x41, 0x04, 0xb2, 0x00, 0x4a, 0x04, 0xb2,
-    0x00, 0x34, 0x04, 0xb2, 0x00, 0x0e, 0x04, 0xb2, 0x01, 0x52, 0x04, 0xb2, 0x00, 0x02, 0x04, 0xb2, 0x00, 0x5f, 0x04,
-    0xb2, 0x00, 0x5d, 0x04, 0xb2, 0x00, 0x68, 0x04, 0xb2, 0x00, 0x8d, 0x04, 0xb2, 0x00, 0x01, 0x04, 0xb2, 0x00, 0x8a,
-    0x04, 0xb2, 0x01, 0x2e, 0x04, 0xb2, 0x01, 0xc1, 0x04, 0xb2, 0x01, 0xb6, 0x04, 0xb2, 0x02, 0x66, 0x04, 0xb2, 0x02,
-    0x08, 0x04, 0xb2, 0x01, 0x00, 0x04, 0xb2, 0x00, 0xf0, 0x04, 0xb2, 0x01, 0x58, 0x04, 0xb2, 0x01, 0x0f, 0x04, 0x3b,
-    0xfd, 0x8d, 0x04, 0x3b, 0xfd, 0xe1, 0x04, 0x3b, 0xfd, 0x0d, 0x04, 0x3b, 0xfd, 0xf0, 0x04, 0x3b, 0xfc, 0xbb, 0x04,
-    0x3b, 0xfc, 0xac, 0x04, 0xb2, 0x02, 0x8a, 0x04, 0xb2, 0x01, 0x8e, 0x04, 0xb2, 0x02, 0x35, 0x04, 0xb2, 0x00, 0x47,
-    0x04, 0xb2, 0xff, 0xc0, 0x04, 0xb2, 0x00, 0x66, 0x04, 0xb2, 0xff, 0xc8, 0x04, 0xb2, 0x00, 0x24, 0x04, 0xb2, 0x00,
-    0x35, 0x04, 0xb2, 0x00, 0x04, 0x04, 0xb2, 0x00, 0x50, 0x04, 0xb2, 0x00, 0x84, 0x04, 0xb2, 0xff, 0xf9, 0x04, 0xb2,
-    0x00, 0x67, 0x04, 0xb2, 0xff, 0xfe, 0x04, 0xb2, 0x00, 0x9d, 0x04, 0xb2, 0x00, 0x5b, 0x04, 0xb2, 0x00, 0x50, 0x04,
-    0xb2, 0x00, 0x82, 0x04, 0xb2, 0x00, 0x36, 0x04, 0xb2, 0x00, 0xa6, 0x04, 0xb2, 0x00, 0xe9, 0x04, 0xb2, 0xff, 0xcb,
-    0x04, 0xb2, 0x00, 0x86, 0x04, 0xb2, 0x00, 0x6e, 0x04, 0xb2, 0xff, 0xef, 0x04, 0xb2, 0x00, 0x5f, 0x04, 0xb2, 0x00,
-    0x53, 0x04, 0xb2, 0x00, 0xdf, 0x04, 0xb2, 0x00, 0x79, 0x04, 0xb2, 0x00, 0x57, 0x04, 0xb2, 0x00, 0x53, 0x04, 0xb2,
-    0x00, 0x36, 0x04, 0xb2, 0x00, 0x6f, 0x04, 0xb2, 0x00, 0xc1, 0x04, 0xb2, 0x00, 0x27, 0x04, 0xb2, 0x00, 0xa2, 0x04,
-    0xb2, 0x00, 0x72, 0x04, 0xb2, 0xff, 0xba, 0x04, 0xb2, 0x00, 0x16, 0x04, 0xb2, 0x00, 0xba, 0x04, 0xb2, 0x00, 0x35,
-    0x04, 0xb2, 0x00, 0x35, 0x04, 0xb2, 0xff, 0xb8, 0x04, 0xb2, 0xff, 0xb0, 0x04, 0xb2, 0x00, 0x2e, 0x04, 0xb2, 0x00,
-    0x35, 0x04, 0xb2, 0xff, 0xca, 0x04, 0xb2, 0x00, 0x01, 0x04, 0xb2, 0x00, 0x39, 0x04, 0xb2, 0x00, 0xe4, 0x04, 0xb2,
-    0x00, 0x11, 0x04, 0xb2, 0x00, 0x11, 0x04, 0xb2, 0x00, 0xaa, 0x04, 0xb2, 0x00, 0x23, 0x04, 0xb2, 0x00, 0x3a, 0x04,
-    0xb2, 0x00, 0x4e, 0x04, 0xb2, 0x00, 0x0b, 0x04, 0xb2, 0xff, 0xd1, 0x04, 0xb2, 0x00, 0x65, 0x04, 0xb2, 0x00, 0x37,
-    0x04, 0xb2, 0x00, 0x49, 0x04, 0xb2, 0xff, 0xa7, 0x04, 0xb2, 0xff, 0xa3, 0x04, 0xb2, 0x00, 0x4f, 0x04, 0xb2, 0x00,
-    0x37, 0x04, 0xb2, 0x00, 0x36, 0x04, 0xb2, 0xff, 0xd2, 0x04, 0xb2, 0x00, 0x1c, 0x04, 0xb2, 0x00, 0x37, 0x04, 0xb2,
-    0x00, 0x37, 0x04, 0xb2, 0x00, 0x9e, 0x04, 0xb2, 0x00, 0x62, 0x04, 0xb2, 0x00, 0x3c, 0x04, 0xb2, 0x00, 0x9f, 0x04,
-    0xb2, 0x00, 0x15, 0x04, 0xb2, 0x00, 0x0a, 0x04, 0xb2, 0x00, 0x70, 0x04, 0xb2, 0x00, 0x23, 0x04, 0xb2, 0x00, 0x38,
-    0x04, 0xb2, 0x00, 0x50, 0x04, 0xb2, 0x00, 0x05, 0x04, 0xb2, 0xff, 0xde, 0x04, 0xb2, 0x00, 0x38, 0x04, 0xb2, 0x00,
-    0x75, 0x04, 0xb2, 0xff, 0xc4, 0x04, 0xb2, 0x00, 0x15, 0x04, 0xb2, 0x00, 0x3f, 0x04, 0xb2, 0x00, 0x38, 0x04, 0xb2,
-    0x00, 0x35, 0x04, 0xb2, 0x00, 0x29, 0x04, 0xb2, 0x00, 0x6d, 0x04, 0xb2, 0x00, 0x11, 0x04, 0xb2, 0x00, 0x2e, 0x04,
-    0xb2, 0xff, 0xb9, 0x04, 0xb2, 0xff, 0xe7, 0x04, 0xb2, 0x00, 0x05, 0x04, 0xb2, 0x00, 0x04, 0x04, 0xb2, 0xff, 0xeb,
-    0x04, 0xb2, 0xff, 0xfe, 0x04, 0xb2, 0xff, 0xe5, 0x04, 0xb2, 0xff, 0xe6, 0x04, 0xb2, 0x00, 0x44, 0x04, 0xb2, 0x00,
-    0x58, 0x04, 0xb2, 0x00, 0x5f, 0x04, 0xb2, 0x00, 0x44, 0x04, 0xb2, 0x00, 0xb1, 0x04, 0xb2, 0x00, 0xa6, 0x04, 0xb2,
-    0x00, 0x26, 0x04, 0xb2, 0x00, 0x1e, 0x04, 0xb2, 0x00, 0x66, 0x04, 0xb2, 0x00, 0x60, 0x04, 0xb2, 0x00, 0x1a, 0x04,
-    0xb2, 0x00, 0x33, 0x04, 0xb2, 0x00, 0x3b, 0x04, 0xb2, 0x00, 0x29, 0x04, 0xb2, 0x00, 0x88, 0x04, 0xb2, 0x00, 0xa5,
-    0x04, 0xb2, 0x00, 0x42, 0x00, 0x0a, 0x01, 0x30, 0x00, 0x0a, 0x01, 0x73, 0x00, 0x0a, 0x02, 0x52, 0x00, 0x0a, 0x02,
-    0xaf, 0x00, 0x0a, 0xfe, 0xdd, 0x00, 0x0a, 0x00, 0x42, 0x04, 0xb2, 0x00, 0x51, 0x04, 0xb2, 0xff, 0xf7, 0x04, 0xb2,
-    0x00, 0x48, 0x04, 0xb2, 0x00, 0x48, 0x04, 0xb2, 0x00, 0x4b, 0x04, 0xb2, 0x00, 0x4a, 0x04, 0xb2, 0x00, 0x40, 0x04,
-    0xb2, 0x00, 0x36, 0x04, 0xb2, 0x00, 0xa5, 0x04, 0xb2, 0x00, 0x6f, 0x04, 0xb2, 0x00, 0x06, 0x04, 0xb2, 0x00, 0x02,
-    0x04, 0xb2, 0x00, 0x01, 0x04, 0xb2, 0x00, 0x08, 0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2, 0x00, 0x4e, 0x04, 0xb2, 0x00,
-    0xb1, 0x04, 0xb2, 0x00, 0x6b, 0x04, 0xb2, 0x00, 0xe4, 0x04, 0xb2, 0x00, 0xa4, 0x04, 0xb2, 0x00, 0x74, 0x04, 0xb2,
-    0x00, 0x73, 0x04, 0xb2, 0x00, 0x4f, 0x04, 0xb2, 0x00, 0x59, 0x04, 0xb2, 0x00, 0x46, 0x04, 0xb2, 0x00, 0x48, 0x04,
-    0xb2, 0x00, 0x45, 0x04, 0xb2, 0x00, 0x4d, 0x04, 0xb2, 0x00, 0x67, 0x04, 0xb2, 0x00, 0x1c, 0x04, 0xb2, 0x00, 0x01,
-    0x04, 0xb2, 0xff, 0xf7, 0x04, 0xb2, 0x00, 0x3a, 0x04, 0xb2, 0x00, 0x28, 0x04, 0xb2, 0x00, 0x43, 0x04, 0xb2, 0x00,
-    0xaf, 0x04, 0xb2, 0x00, 0x85, 0x04, 0xb2, 0x01, 0x0d, 0x04, 0xb2, 0x00, 0xf4, 0x04, 0xb2, 0xff, 0xb0, 0x04, 0xb2,
-    0xff, 0xca, 0x04, 0xb2, 0x00, 0x03, 0x04, 0xb2, 0x00, 0x09, 0x04, 0xb2, 0x00, 0x82, 0x04, 0xb2, 0x00, 0x85, 0x04,
-    0xb2, 0x00, 0xc3, 0x04, 0xb2, 0x00, 0x80, 0x04, 0xb2, 0x00, 0x40, 0x04, 0xb2, 0x00, 0x00, 0x04, 0xb2, 0x00, 0x00,
-    0x04, 0xb2, 0x00, 0x00, 0x04, 0xb2, 0x00, 0x00, 0x04, 0xb2, 0x00, 0x00, 0x04, 0xb2, 0x00, 0x00, 0x04, 0xb2, 0x00,
-    0x00, 0x04, 0xb2, 0x00, 0x00, 0x04, 0xb2, 0x00, 0x00, 0x04, 0xb2, 0x00, 0x00, 0x04, 0xb2, 0x00, 0x00, 0x04, 0xb2,
-    0x00, 0x00, 0x04, 0xb2, 0x00, 0x51, 0x04, 0xb2, 0x00, 0x56, 0x04, 0xb2, 0xff, 0xf3, 0x04, 0xb2, 0x02, 0x29, 0x04,
-    0xb2, 0x02, 0x18, 0x04, 0xb2, 0x01, 0x20, 0x04, 0xb2, 0x01, 0x1a, 0x04, 0xb2, 0x01, 0x8b, 0x04, 0xb2, 0x01, 0x7d,
-    0x04, 0xb2, 0x00, 0x97, 0x04, 0xb2, 0x00, 0xa6, 0x04, 0xb2, 0x00, 0x17, 0x04, 0xb2, 0x01, 0xa9, 0x04, 0xb2, 0x00,
-    0xfe, 0x04, 0xb2, 0x00, 0xae, 0x04, 0xb2, 0x00, 0x5c, 0x04, 0xb2, 0x01, 0x76, 0x04, 0xb2, 0x01, 0x2c, 0x04, 0xb2,
-    0x00, 0xe9, 0x04, 0xb2, 0x01, 0x24, 0x04, 0xb2, 0x01, 0x49, 0x04, 0xb2, 0x00, 0x03, 0x04, 0xb2, 0x00, 0x13, 0x04,
-    0xb2, 0x00, 0x71, 0x04, 0xb2, 0x00, 0x9d, 0x04, 0xb2, 0x00, 0xbc, 0x04, 0xb2, 0x00, 0x0c, 0x04, 0xb2, 0x00, 0xe9,
-    0x04, 0xb2, 0x00, 0x83, 0x04, 0xb2, 0x00, 0xc5, 0x04, 0xb2, 0x00, 0x77, 0x04, 0xb2, 0x00, 0x68, 0x04, 0xb2, 0x00,
-    0xb6, 0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2, 0x00, 0x22, 0x04, 0xb2, 0xff, 0x9a, 0x04, 0xb2, 0x00, 0xac, 0x04, 0xb2,
-    0x00, 0x3b, 0x04, 0xb2, 0x00, 0x30, 0x04, 0xb2, 0x00, 0x54, 0x04, 0xb2, 0x00, 0x5e, 0x04, 0xb2, 0x00, 0x7a, 0x04,
-    0xb2, 0x00, 0x4f, 0x04, 0xb2, 0x00, 0x57, 0x04, 0xb2, 0x00, 0xa1, 0x04, 0xb2, 0x00, 0xad, 0x04, 0xb2, 0x00, 0x00,
-    0x04, 0xb2, 0xff, 0xf0, 0x04, 0xcd, 0x00, 0x0f, 0x04, 0xb2, 0x00, 0x9b, 0x04, 0xb2, 0x00, 0xda, 0x04, 0xb2, 0x01,
-    0x74, 0x04, 0xb2, 0x01, 0x60, 0x04, 0xb2, 0x00, 0xcf, 0x04, 0xb2, 0x01, 0x6e, 0x04, 0xb2, 0x01, 0xb9, 0x04, 0xb2,
-    0x02, 0x4c, 0x04, 0xb2, 0xff, 0xc7, 0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2, 0x00, 0x55, 0x04, 0xb2, 0x00, 0x49, 0x04,
-    0xb2, 0x00, 0x59, 0x04, 0xb2, 0x00, 0x77, 0x04, 0xb2, 0x00, 0x64, 0x04, 0xb2, 0x00, 0x2e, 0x04, 0xb2, 0x00, 0x6a,
-    0x04, 0xb2, 0x00, 0x68, 0x04, 0xb2, 0x00, 0x46, 0x04, 0xb2, 0x00, 0x62, 0x04, 0xb2, 0x00, 0x2e, 0x04, 0xb2, 0x00,
-    0x54, 0x04, 0xb2, 0x00, 0x71, 0x04, 0xb2, 0x00, 0x48, 0x04, 0xb2, 0x00, 0x23, 0x04, 0xb2, 0x00, 0x5e, 0x04, 0xb2,
-    0x00, 0xa1, 0x04, 0xb2, 0x00, 0x86, 0x04, 0xb2, 0x00, 0xb9, 0x04, 0xb2, 0x00, 0x91, 0x04, 0xb2, 0xff, 0xee, 0x04,
-    0xb2, 0x00, 0xb2, 0x04, 0xb2, 0x00, 0x55, 0x04, 0xb2, 0x01, 0xdc, 0x04, 0xb2, 0x01, 0x2c, 0x04, 0xb2, 0x00, 0x62,
-    0x04, 0xb2, 0x00, 0x8d, 0x04, 0xb2, 0x00, 0x4d, 0x04, 0xb2, 0x00, 0x98, 0x04, 0xb2, 0x00, 0xb8, 0x04, 0xb2, 0x00,
-    0xe7, 0x04, 0xb2, 0x00, 0x96, 0x04, 0xb2, 0x00, 0xcd, 0x04, 0xb2, 0x01, 0x05, 0x04, 0xb2, 0x01, 0x46, 0x04, 0xb2,
-    0x01, 0xcd, 0x04, 0xb2, 0x00, 0xed, 0x04, 0xb2, 0x00, 0xd6, 0x04, 0xb2, 0x00, 0xf4, 0x04, 0xb2, 0x00, 0xfe, 0x04,
-    0xb2, 0x01, 0x1d, 0x04, 0xb2, 0x00, 0xf3, 0x04, 0xb2, 0x01, 0x26, 0x04, 0xb2, 0x01, 0x34, 0x04, 0xb2, 0x02, 0x34,
-    0x04, 0xb2, 0x02, 0x45, 0x04, 0xb2, 0x01, 0xfd, 0x04, 0xb2, 0x01, 0x50, 0x04, 0xb2, 0x00, 0xbc, 0x04, 0xb2, 0x00,
-    0xad, 0x04, 0xb2, 0xff, 0xe8, 0x04, 0xb2, 0x00, 0xb8, 0x04, 0xb2, 0x00, 0xfc, 0x04, 0xb2, 0x01, 0x6a, 0x04, 0xb2,
-    0x01, 0x1a, 0x04, 0xb2, 0x00, 0xa4, 0x04, 0xb2, 0x00, 0x5d, 0x04, 0xb2, 0xff, 0xcf, 0x04, 0xb2, 0x00, 0x36, 0x04,
-    0xb2, 0x00, 0x3b, 0x04, 0xb2, 0x00, 0xac, 0x04, 0xb2, 0x01, 0x21, 0x04, 0xb2, 0x00, 0x6b, 0x04, 0xb0, 0x00, 0x80,
-    0x04, 0xb2, 0x00, 0x2d, 0x04, 0xb2, 0x00, 0x22, 0x04, 0xb2, 0x00, 0x63, 0x04, 0xb2, 0x01, 0xb6, 0x04, 0xb2, 0x00,
-    0x00, 0x04, 0xb3, 0x00, 0xcc, 0x04, 0xd0, 0xff, 0xe2, 0x04, 0xd0, 0xff, 0xe2, 0x04, 0xd0, 0x00, 0x5e, 0x04, 0xb2,
-    0x00, 0xc2, 0x04, 0xb2, 0x00, 0xc4, 0x04, 0xb2, 0xff, 0xe2, 0x04, 0xb2, 0xff, 0xe2, 0x04, 0xb2, 0xff, 0xe2, 0x04,
-    0xb2, 0xff, 0xe2, 0x04, 0xb2, 0xff, 0xe2, 0x04, 0xb2, 0xff, 0xe2, 0x04, 0xb2, 0xff, 0xe2, 0x04, 0xb2, 0x00, 0x64,
-    0x04, 0xb2, 0x00, 0x48, 0x04, 0xb2, 0x00, 0x48, 0x04, 0xb2, 0x00, 0x48, 0x04, 0xb2, 0x00, 0x48, 0x04, 0xb2, 0x00,
-    0x40, 0x04, 0xb2, 0x00, 0x40, 0x04, 0xb2, 0x00, 0x40, 0x04, 0xb2, 0x00, 0x40, 0x04, 0xb2, 0x00, 0x22, 0x04, 0xb2,
-    0x00, 0x66, 0x04, 0xb2, 0x00, 0x66, 0x04, 0xb2, 0x00, 0x66, 0x04, 0xb2, 0x00, 0x66, 0x04, 0xb2, 0x00, 0x66, 0x04,
-    0xb2, 0x00, 0x68, 0x04, 0xb2, 0x00, 0x68, 0x04, 0xb2, 0x00, 0x68, 0x04, 0xb2, 0x00, 0x68, 0x04, 0xb2, 0x00, 0xd4,
-    0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2, 0x00,
-    0x61, 0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2, 0x00, 0x75, 0x04, 0xb2, 0x00, 0x6c, 0x04, 0xb2,
-    0x00, 0x6c, 0x04, 0xb2, 0x00, 0x6c, 0x04, 0xb2, 0x00, 0x6c, 0x04, 0xb2, 0x00, 0x5c, 0x04, 0xb2, 0x00, 0x5c, 0x04,
-    0xb2, 0x00, 0x5c, 0x04, 0xb2, 0x00, 0x5c, 0x04, 0xb2, 0x00, 0x40, 0x04, 0xb2, 0x00, 0x60, 0x04, 0xb2, 0x00, 0x60,
-    0x04, 0xb2, 0x00, 0x60, 0x04, 0xb2, 0x00, 0x60, 0x04, 0xb2, 0x00, 0x60, 0x04, 0xb2, 0x00, 0x8d, 0x04, 0xb2, 0x00,
-    0x8d, 0x04, 0xb2, 0x00, 0x8d, 0x04, 0xb2, 0x00, 0x8d, 0x04, 0xb2, 0xff, 0xe4, 0x04, 0xb2, 0xff, 0xe4, 0x04, 0xb2,
-    0xff, 0xe2, 0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2, 0xff, 0xe2, 0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2, 0xff, 0xe2, 0x04,
-    0xb2, 0x00, 0x61, 0x04, 0xb2, 0x00, 0x64, 0x04, 0xb2, 0x00, 0x75, 0x04, 0xb2, 0x00, 0x64, 0x04, 0xb2, 0x00, 0x75,
-    0x04, 0xb2, 0x00, 0x64, 0x04, 0xb2, 0x00, 0x75, 0x04, 0xb2, 0x00, 0x64, 0x04, 0xb2, 0x00, 0x75, 0x04, 0xb2, 0x00,
-    0x2e, 0x05, 0x48, 0x00, 0x76, 0x04, 0xb2, 0x00, 0x48, 0x04, 0xb2, 0x00, 0x6c, 0x04, 0xb2, 0x00, 0x48, 0x04, 0xb2,
-    0x00, 0x6c, 0x04, 0xb2, 0x00, 0x48, 0x04, 0xb2, 0x00, 0x6c, 0x04, 0xb2, 0x00, 0x48, 0x04, 0xb2, 0x00, 0x6c, 0x04,
-    0xb2, 0x00, 0x48, 0x04, 0xb2, 0x00, 0x6c, 0x04, 0xb2, 0x00, 0x60, 0x04, 0xb2, 0x00, 0x2d, 0x04, 0xb2, 0x00, 0x60,
-    0x04, 0xb2, 0x00, 0x2d, 0x04, 0xb2, 0x00, 0x60, 0x04, 0xb2, 0x00, 0x2d, 0x04, 0xb2, 0x00, 0x60, 0x04, 0xb2, 0x00,
-    0x2d, 0x04, 0xb2, 0x00, 0x20, 0x04, 0xb2, 0x00, 0x40, 0x04, 0xb2, 0x00, 0x40, 0x04, 0xb2, 0x00, 0x5c, 0x04, 0xb2,
-    0x00, 0x40, 0x04, 0xb2, 0x00, 0x5c, 0x04, 0xb2, 0x00, 0x40, 0x04, 0xb2, 0x00, 0x5c, 0x04, 0xb2, 0x00, 0x40, 0x04,
-    0xb2, 0x00, 0x5c, 0x04, 0xb2, 0x00, 0x40, 0x04, 0xb2, 0x00, 0x3f, 0x04, 0xb2, 0x00, 0x01, 0x04, 0xb2, 0x00, 0x3e,
-    0x04, 0xb2, 0x00, 0x42, 0x04, 0xb2, 0x00, 0x58, 0x04, 0xb2, 0x00, 0x5c, 0x04, 0xb2, 0x00, 0x58, 0x04, 0xb2, 0x00,
-    0x5c, 0x04, 0xb2, 0x00, 0x58, 0x05, 0x48, 0x00, 0x5c, 0x04, 0xb2, 0x00, 0x58, 0x05, 0x8e, 0x00, 0x5c, 0x04, 0xb2,
-    0x00, 0x22, 0x04, 0xb2, 0x00, 0x40, 0x04, 0xb2, 0x00, 0x22, 0x04, 0xb2, 0x00, 0x40, 0x04, 0xb2, 0x00, 0x22, 0x04,
-    0xb2, 0x00, 0x40, 0x04, 0xb2, 0x00, 0x15, 0x04, 0xb2, 0x00, 0x66, 0x04, 0xb2, 0x00, 0x60, 0x04, 0xb2, 0x00, 0x66,
-    0x04, 0xb2, 0x00, 0x60, 0x04, 0xb2, 0x00, 0x66, 0x04, 0xb2, 0x00, 0x60, 0x04, 0xb2, 0x00, 0x47, 0x04, 0xb2, 0x00,
-    0xd7, 0x04, 0xb2, 0x00, 0x47, 0x04, 0xb2, 0x00, 0x5e, 0x04, 0xb2, 0x00, 0x47, 0x04, 0xb2, 0x00, 0xd7, 0x04, 0xb2,
-    0x00, 0x53, 0x04, 0xb2, 0x00, 0x7c, 0x04, 0xb2, 0x00, 0x53, 0x04, 0xb2, 0x00, 0x7c, 0x04, 0xb2, 0x00, 0x53, 0x04,
-    0xb2, 0x00, 0x7c, 0x04, 0xb2, 0x00, 0x53, 0x04, 0xb2, 0x00, 0x7c, 0x04, 0xb2, 0x00, 0x53, 0x04, 0xb2, 0x00, 0x7c,
-    0x04, 0xb2, 0x00, 0xc2, 0x04, 0xb2, 0x00, 0xc4, 0x04, 0xb2, 0x00, 0xc2, 0x04, 0xb2, 0x00, 0xa1, 0x04, 0xb2, 0x00,
-    0xc4, 0x04, 0xb2, 0x00, 0xc2, 0x04, 0xda, 0x00, 0xc4, 0x04, 0xb2, 0x00, 0x68, 0x04, 0xb2, 0x00, 0x8d, 0x04, 0xb2,
-    0x00, 0x68, 0x04, 0xb2, 0x00, 0x8d, 0x04, 0xb2, 0x00, 0x68, 0x04, 0xb2, 0x00, 0x8d, 0x04, 0xb2, 0x00, 0x68, 0x04,
-    0xb2, 0x00, 0x8d, 0x04, 0xb2, 0x00, 0x68, 0x04, 0xb2, 0x00, 0x8d, 0x04, 0xb2, 0x00, 0x69, 0x04, 0xb2, 0x00, 0x8d,
-    0x04, 0xb2, 0x00, 0x95, 0x04, 0xb2, 0x00, 0x84, 0x04, 0xb2, 0x00, 0xd4, 0x04, 0xb2, 0xff, 0xe4, 0x04, 0xb2, 0x00,
-    0xd4, 0x04, 0xb2, 0x00, 0x13, 0x04, 0xb2, 0x00, 0x3d, 0x04, 0xb2, 0x00, 0x13, 0x04, 0xb2, 0x00, 0x3d, 0x04, 0xb2,
-    0x00, 0x13, 0x04, 0xb2, 0x00, 0x3d, 0x04, 0xb2, 0xff, 0xb2, 0x04, 0xb2, 0xff, 0xf1, 0x04, 0xb2, 0xff, 0xc6, 0x04,
-    0xb2, 0x00, 0x56, 0x04, 0xb2, 0xff, 0xd9, 0x04, 0xb2, 0xff, 0xd9, 0x04, 0xb2, 0x00, 0xa1, 0x04, 0xb2, 0xff, 0xc7,
-    0x04, 0xb2, 0xff, 0xc7, 0x04, 0xb2, 0xff, 0xc7, 0x04, 0xb2, 0xff, 0xc7, 0x04, 0xb2, 0xff, 0xc7, 0x04, 0xb2, 0xff,
-    0xc7, 0x04, 0xb2, 0xff, 0xc7, 0x04, 0xb2, 0x00, 0x55, 0x04, 0xb2, 0x00, 0x59, 0x04, 0xb2, 0x00, 0x59, 0x04, 0xb2,
-    0x00, 0x59, 0x04, 0xb2, 0x00, 0x59, 0x04, 0xb2, 0x00, 0x6a, 0x04, 0xb2, 0x00, 0x6a, 0x04, 0xb2, 0x00, 0x6a, 0x04,
-    0xb2, 0x00, 0x6a, 0x04, 0xb2, 0x00, 0x54, 0x04, 0xb2, 0x00, 0x71, 0x04, 0xb2, 0x00, 0x71, 0x04, 0xb2, 0x00, 0x71,
-    0x04, 0xb2, 0x00, 0x71, 0x04, 0xb2, 0x00, 0x71, 0x04, 0xb2, 0x00, 0x86, 0x04, 0xb2, 0x00, 0x86, 0x04, 0xb2, 0x00,
-    0x86, 0x04, 0xb2, 0x00, 0x86, 0x04, 0xb2, 0x00, 0xb2, 0x04, 0xb2, 0xff, 0xc7, 0x04, 0xb2, 0xff, 0xc7, 0x04, 0xb2,
-    0xff, 0xc7, 0x04, 0xb2, 0x00, 0x55, 0x04, 0xb2, 0x00, 0x55, 0x04, 0xb2, 0x00, 0x55, 0x04, 0xb2, 0x00, 0x55, 0x04,
-    0xb2, 0x00, 0x49, 0x04, 0xb2, 0x00, 0x59, 0x04, 0xb2, 0x00, 0x59, 0x04, 0xb2, 0x00, 0x59, 0x04, 0xb2, 0x00, 0x59,
-    0x04, 0xb2, 0x00, 0x59, 0x04, 0xb2, 0x00, 0x64, 0x04, 0xb2, 0x00, 0x64, 0x04, 0xb2, 0x00, 0x64, 0x04, 0xb2, 0x00,
-    0x64, 0x04, 0xb2, 0x00, 0x2e, 0x04, 0xb2, 0x00, 0x6a, 0x04, 0xb2, 0x00, 0x6a, 0x04, 0xb2, 0x00, 0x6a, 0x04, 0xb2,
-    0x00, 0x6a, 0x04, 0xb2, 0x00, 0x6a, 0x04, 0xb2, 0x00, 0x68, 0x04, 0xb2, 0x00, 0x46, 0x04, 0xb2, 0x00, 0x62, 0x04,
-    0xb2, 0x00, 0x62, 0x04, 0xb2, 0x00, 0x62, 0x04, 0xb2, 0x00, 0x62, 0x04, 0xb2, 0x00, 0x54, 0x04, 0xb2, 0x00, 0x54,
-    0x04, 0xb2, 0x00, 0x54, 0x04, 0xb2, 0x00, 0x71, 0x04, 0xb2, 0x00, 0x71, 0x04, 0xb2, 0x00, 0x71, 0x04, 0xb2, 0x00,
-    0x23, 0x04, 0xb2, 0x00, 0x23, 0x04, 0xb2, 0x00, 0x23, 0x04, 0xb2, 0x00, 0x5e, 0x04, 0xb2, 0x00, 0x5e, 0x04, 0xb2,
-    0x00, 0x5e, 0x04, 0xb2, 0x00, 0x5e, 0x04, 0xb2, 0x00, 0xa1, 0x04, 0xb2, 0x00, 0xa1, 0x04, 0xb2, 0x00, 0x86, 0x04,
-    0xb2, 0x00, 0x86, 0x04, 0xb2, 0x00, 0x86, 0x04, 0xb2, 0x00, 0x86, 0x04, 0xb2, 0x00, 0x86, 0x04, 0xb2, 0x00, 0x86,
-    0x04, 0xb2, 0x00, 0x91, 0x04, 0xb2, 0x00, 0xb2, 0x04, 0xb2, 0x00, 0xb2, 0x04, 0xb2, 0x00, 0x55, 0x04, 0xb2, 0x00,
-    0x55, 0x04, 0xb2, 0x00, 0x55, 0x04, 0xb2, 0xff, 0xe2, 0x05, 0x16, 0x00, 0x83, 0x05, 0x16, 0x00, 0x72, 0x05, 0x16,
-    0x00, 0x62, 0x04, 0xc6, 0x00, 0x7a, 0x05, 0x16, 0x00, 0x29, 0x04, 0xc6, 0x00, 0x0d, 0x04, 0xb2, 0x00, 0xe9, 0x04,
-    0xb2, 0xff, 0xe2, 0x04, 0xb2, 0x00, 0x3e, 0x04, 0xb2, 0x00, 0x48, 0x04, 0xb2, 0x00, 0x13, 0x04, 0xb2, 0x00, 0x20,
-    0x04, 0xb2, 0x00, 0x40, 0x04, 0xb2, 0x00, 0x3e, 0x04, 0xb2, 0x00, 0x27, 0x04, 0xb2, 0x00, 0x22, 0x04, 0xb2, 0x00,
-    0x66, 0x04, 0xb2, 0x00, 0x51, 0x04, 0xb2, 0x00, 0xc2, 0x04, 0xb2, 0x00, 0xd4, 0x04, 0xb2, 0xff, 0xf1, 0x04, 0xb2,
-    0x00, 0x40, 0x04, 0xb2, 0x00, 0xd4, 0x04, 0xb2, 0x00, 0x67, 0x04, 0xb2, 0x00, 0x50, 0x04, 0xb2, 0x00, 0x36, 0x04,
-    0xb2, 0x00, 0xe9, 0x04, 0xb2, 0x00, 0x79, 0x04, 0xb2, 0x00, 0x4c, 0x04, 0xb2, 0x00, 0x60, 0x04, 0xb2, 0x00, 0x06,
-    0x04, 0xb2, 0x00, 0xae, 0x04, 0xb2, 0x00, 0x06, 0x04, 0xb2, 0x00, 0xe9, 0x04, 0xb2, 0x00, 0x79, 0x04, 0xb2, 0x00,
-    0x60, 0x04, 0xb2, 0x00, 0x79, 0x04, 0xb2, 0x00, 0x36, 0x04, 0xb2, 0x00, 0x48, 0x04, 0xb2, 0x00, 0x47, 0x04, 0xb2,
-    0x00, 0x53, 0x04, 0xb2, 0x00, 0x40, 0x04, 0xb2, 0x00, 0x40, 0x04, 0xb2, 0x00, 0x3f, 0x04, 0xb2, 0x00, 0x3b, 0x04,
-    0xb2, 0x00, 0x3e, 0x04, 0xb2, 0x00, 0x01, 0x04, 0xb2, 0xff, 0xe2, 0x04, 0xb2, 0x00, 0x3e, 0x04, 0xb2, 0x00, 0x47,
-    0x04, 0xb2, 0x00, 0x48, 0x04, 0xb2, 0x00, 0x35, 0x04, 0xb2, 0x00, 0x27, 0x04, 0xb2, 0x00, 0x20, 0x04, 0xb2, 0x00,
-    0x66, 0x04, 0xb2, 0x00, 0x35, 0x04, 0xb2, 0x00, 0x51, 0x04, 0xb2, 0x00, 0x64, 0x04, 0xb2, 0x00, 0xc2, 0x04, 0xb2,
-    0x00, 0x50, 0x04, 0xb2, 0xff, 0xf1, 0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2, 0x00, 0x6c, 0x04, 0xb2, 0x00, 0x37, 0x04,
-    0xb2, 0x00, 0x60, 0x04, 0xb2, 0xff, 0xf7, 0x04, 0xb2, 0x00, 0x75, 0x04, 0xb2, 0xff, 0xe4, 0x04, 0xb2, 0x00, 0x06,
-    0x04, 0xb2, 0x00, 0x6c, 0x04, 0xb2, 0x00, 0x49, 0x04, 0xb2, 0x00, 0x7c, 0x04, 0xb2, 0x00, 0x5c, 0x04, 0xb2, 0x00,
-    0x5c, 0x04, 0xb2, 0x00, 0x23, 0x04, 0xb2, 0x00, 0x36, 0x04, 0xb2, 0xff, 0xe4, 0x04, 0xb2, 0x00, 0x95, 0x04, 0xb2,
-    0x00, 0x84, 0x04, 0xb2, 0x00, 0x95, 0x04, 0xb2, 0x00, 0x84, 0x04, 0xb2, 0x00, 0x95, 0x04, 0xb2, 0x00, 0x84, 0x04,
-    0xb2, 0x00, 0xd4, 0x04, 0xb2, 0xff, 0xe4, 0x04, 0xb2, 0x02, 0x26, 0x04, 0xb2, 0x01, 0x9e, 0x09, 0x64, 0x01, 0x80,
-    0x04, 0xb2, 0x00, 0x01, 0x04, 0xb2, 0x02, 0x18, 0x04, 0xb2, 0x00, 0x27, 0x04, 0xb2, 0xff, 0xf2, 0x04, 0xb2, 0xff,
-    0xe2, 0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2, 0x00, 0x05, 0x04, 0xb2, 0x00, 0x48, 0x04, 0xb2, 0x00, 0x35, 0x04, 0xb2,
-    0x00, 0x6c, 0x04, 0xb2, 0x00, 0x37, 0x04, 0xb2, 0x00, 0x84, 0x04, 0xb2, 0x00, 0x53, 0x04, 0xb2, 0x00, 0xb1, 0x04,
-    0xb2, 0x00, 0xa6, 0x04, 0xb2, 0x00, 0x2e, 0x04, 0xb2, 0x00, 0x4f, 0x04, 0xb2, 0x00, 0x64, 0x04, 0xb2, 0x00, 0x75,
-    0x04, 0xb2, 0x00, 0xd4, 0x04, 0xb2, 0x00, 0x9d, 0x04, 0xb2, 0x00, 0x40, 0x04, 0xb2, 0xff, 0xb0, 0x04, 0xb2, 0xff,
-    0xa3, 0x04, 0xb2, 0x00, 0x40, 0x04, 0xb2, 0xff, 0xe2, 0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2, 0xff, 0xe2, 0x04, 0xb2,
-    0x00, 0x61, 0x04, 0xb2, 0xff, 0xb2, 0x04, 0xb2, 0xff, 0xf1, 0x04, 0xb2, 0x00, 0x48, 0x04, 0xb2, 0x00, 0x6c, 0x04,
-    0xb2, 0x00, 0x4d, 0x04, 0xb2, 0x00, 0x8a, 0x04, 0xb2, 0x00, 0x8a, 0x04, 0xb2, 0xff, 0xb0, 0x04, 0xb2, 0xff, 0xa3,
-    0x04, 0xb2, 0x00, 0x2e, 0x04, 0xb2, 0x00, 0x4f, 0x04, 0xb2, 0x00, 0x35, 0x04, 0xb2, 0x00, 0x37, 0x04, 0xb2, 0x00,
-    0x35, 0x04, 0xb2, 0x00, 0x37, 0x04, 0xb2, 0x00, 0x66, 0x04, 0xb2, 0x00, 0x60, 0x04, 0xb2, 0x00, 0x5f, 0x04, 0xb2,
-    0x00, 0x44, 0x04, 0xb2, 0x00, 0x5f, 0x04, 0xb2, 0x00, 0x44, 0x04, 0xb2, 0x00, 0x4e, 0x04, 0xb2, 0x00, 0x50, 0x04,
-    0xb2, 0x00, 0x01, 0x04, 0xb2, 0xff, 0xe4, 0x04, 0xb2, 0x00, 0x01, 0x04, 0xb2, 0xff, 0xe4, 0x04, 0xb2, 0x00, 0x01,
-    0x04, 0xb2, 0xff, 0xe4, 0x04, 0xb2, 0x00, 0xe4, 0x04, 0xb2, 0x00, 0x9f, 0x04, 0xb2, 0x00, 0x23, 0x04, 0xb2, 0x00,
-    0x23, 0x04, 0xb2, 0xff, 0xf1, 0x04, 0xb2, 0x00, 0x06, 0x04, 0xb2, 0x00, 0x76, 0x04, 0xb2, 0xff, 0xca, 0x04, 0xb2,
-    0xff, 0xd2, 0x04, 0xb2, 0xff, 0xe2, 0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2, 0xff, 0xe2, 0x04, 0xb2, 0x00, 0x61, 0x04,
-    0xb2, 0xff, 0xe2, 0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2, 0xff, 0xe2, 0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2, 0xff, 0xe2,
-    0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2, 0xff, 0xe2, 0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2, 0xff, 0xe2, 0x04, 0xb2, 0x00,
-    0x61, 0x04, 0xb2, 0xff, 0xe2, 0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2, 0xff, 0xe2, 0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2,
-    0xff, 0xe2, 0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2, 0xff, 0xe2, 0x04, 0xb2, 0x00, 0x61, 0x04, 0xb2, 0xff, 0xe2, 0x04,
-    0xb2, 0x00, 0x61, 0x04, 0xb2, 0x00, 0x48, 0x04, 0xb2, 0x00, 0x6c, 0x04, 0xb2, 0x00, 0x48, 0x04, 0xb2, 0x00, 0x6c,
-    0x04, 0xb2, 0x00, 0x48, 0x04, 0xb2, 0x00, 0x6c, 0x04, 0xb2, 0x00, 0x48, 0x04, 0xb2, 0x00, 0x6c, 0x04, 0xb2, 0x00,
-    0x48, 0x04, 0xb2, 0x00, 0x6c, 0x04, 0xb2, 0x00, 0x48, 0x04, 0xb2, 0x00, 0x6c, 0x04, 0xb2, 0x00, 0x48, 0x04, 0xb2,
-    0x00, 0x6c, 0x04, 0xb2, 0x00, 0x48, 0x04, 0xb2, 0x00, 0x6c, 0x04, 0xb2, 0x00, 0x40, 0x04, 0xb2, 0x00, 0x5c, 0x04,
-    0xb2, 0x00, 0x40, 0x04, 0xb2, 0x00, 0x5c, 0x04, 0xb2, 0x00, 0x66, 0x04, 0xb2, 0x00, 0x60, 0x04, 0xb2, 0x00, 0x66,
-    0x04, 0xb2, 0x00, 0x60, 0x04, 0xb2, 0x00, 0x66, 0x04, 0xb2, 0x00, 0x60, 0x04, 0xb2, 0x00, 0x66, 0x04, 0xb2, 0x00,
-    0x60, 0x04, 0xb2, 0x00, 0x66, 0x04, 0xb2, 0x00, 0x60, 0x04, 0xb2, 0x00, 0x66, 0x04, 0xb2, 0x00, 0x60, 0x04, 0xb2,
-    0x00, 0x66, 0x04, 0xb2, 0x00, 0x60, 0x04, 0xb2, 0x00, 0x5f, 0x04, 0xb2, 0x00, 0x5d, 0x04, 0xb2, 0x00, 0x5f, 0x04,
-    0xb2, 0x00, 0x5d, 0x04, 0xb2, 0x00, 0x5f, 0x04, 0xb2, 0x00, 0x5d, 0x04, 0xb2, 0x00, 0x5f, 0x04, 0xb2, 0x00, 0x5d,
-    0x04, 0xb2, 0x00, 0x5f, 0x04, 0xb2, 0x00, 0x5d, 0x04, 0xb2, 0x00, 0x68, 0x04, 0xb2, 0x00, 0x8d, 0x04, 0xb2, 0x00,
-    0x68, 0x04, 0xb2, 0x00, 0x8d, 0x04, 0xb2, 0x00, 0x68, 0x04, 0xb2, 0x00, 0x8d, 0x04, 0xb2, 0x00, 0x68, 0x04, 0xb2,
-    0x00, 0x8d, 0x04, 0xb2, 0x00, 0x68, 0x04, 0xb2, 0x00, 0x8d, 0x04, 0xb2, 0x00, 0x68, 0x04, 0xb2, 0x00, 0x8d, 0x04,
-    0xb2, 0x00, 0x68, 0x04, 0xb2, 0x00, 0x8d, 0x04, 0xb2, 0x00, 0xd4, 0x04, 0xb2, 0xff, 0xe4, 0x04, 0xb2, 0x00, 0xd4,
-    0x04, 0xb2, 0xff, 0xe4, 0x04, 0xb2, 0x00, 0xd4, 0x04, 0xb2, 0xff, 0xe4, 0x04, 0xd0, 0x00, 0x76, 0x04, 0xd0, 0x00,
-    0x2c, 0x04, 0xb2, 0x00, 0x3b, 0x04, 0xb2, 0x00, 0x36, 0x04, 0xb2, 0x00, 0x20, 0x04, 0xb2, 0x00, 0x37, 0x04, 0xb2,
-    0x00, 0xc2, 0x04, 0xb2, 0x00, 0x9e, 0x04, 0xb2, 0xff, 0xf1, 0x04, 0xb2, 0x00, 0x06, 0x04, 0xb2, 0x00, 0xe4, 0x04,
-    0xb2, 0x00, 0x9f, 0x04, 0xb2, 0x00, 0xe4, 0x04, 0xb2, 0x00, 0x9f, 0x04, 0xb2, 0x00, 0x47, 0x04, 0xb2, 0x00, 0x49,
-    0x04, 0xb2, 0xff, 0xb0, 0x04, 0xb2, 0xff, 0xa3, 0x04, 0xb2, 0x00, 0x73, 0x04, 0xb2, 0x00, 0x4f, 0x04, 0xb2, 0x00,
-    0x40, 0x04, 0xb2, 0x00, 0x34, 0x04, 0xb2, 0x00, 0x2c, 0x04, 0xb2, 0x00, 0x2c, 0x04, 0xb2, 0x00, 0x0c, 0x04, 0xb2,
-    0xff, 0xe6, 0x04, 0xc6, 0x00, 0x4f, 0x04, 0xc6, 0x00, 0x56, 0x04, 0xb2, 0x00, 0x35, 0x00, 0x37, 0x00, 0x20, 0x00,
-    0x37, 0x00, 0x27, 0x00, 0x1c, 0xff, 0xca, 0xff, 0xd2, 0x00, 0xd4, 0x00, 0x9d, 0xff, 0xf1, 0x00, 0x06, 0x00, 0x50,
-    0xff, 0xd7, 0x00, 0x56, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xaa, 0x01, 0x30, 0x01, 0xda, 0x02, 0x8e, 0x02, 0xb8, 0x02, 0xec, 0x03, 0x20,
-    0x03, 0x50, 0x03, 0x80, 0x03, 0x9e, 0x03, 0xb8, 0x03, 0xe2, 0x03, 0xfa, 0x04, 0x60, 0x04, 0x7c, 0x04, 0xcc, 0x05,
-    0x50, 0x05, 0x86, 0x05, 0xe6, 0x06, 0x5a, 0x06, 0x7c, 0x07, 0x0c, 0x07, 0x84, 0x07, 0x96, 0x07, 0xaa, 0x07, 0xc6,
-    0x07, 0xee, 0x08, 0x0a, 0x08, 0x96, 0x09, 0x8c, 0x09, 0xba, 0x0a, 0x2a, 0x0a, 0x92, 0x0a, 0xd8, 0x0b, 0x08, 0x0b,
-    0x32, 0x0b, 0x98, 0x0b, 0xc2, 0x0b, 0xf0, 0x0c, 0x2a, 0x0c, 0x58, 0x0c, 0x76, 0x0c, 0xb0, 0x0c, 0xd8, 0x0d, 0x3e,
-    0x0d, 0x86, 0x0d, 0xf8, 0x0e, 0x46, 0x0e, 0xbe, 0x0e, 0xe0, 0x0f, 0x1e, 0x0f, 0x3c, 0x0f, 0x6c, 0x0f, 0x9a, 0x0f,
-    0xc0, 0x0f, 0xe8, 0x10, 0x0e, 0x10, 0x26, 0x10, 0x4c, 0x10, 0x70, 0x10, 0x8a, 0x10, 0xac, 0x11, 0x2a, 0x11, 0xc4,
-    0x12, 0x2a, 0x12, 0xb8, 0x13, 0x20, 0x13, 0x6c, 0x14, 0x92, 0x14, 0xe4, 0x15, 0x28, 0x15, 0x80, 0x15, 0xbe, 0x15,
-    0xf6, 0x16, 0x6e, 0x16, 0xc4, 0x17, 0x1c, 0x17, 0x90, 0x18, 0x18, 0x18, 0x70, 0x18, 0xea, 0x19, 0x50, 0x19, 0x9a,
-    0x19, 0xc0, 0x19, 0xf8, 0x1a, 0x26, 0x1a, 0x66, 0x1a, 0x8e, 0x1a, 0xec, 0x1b, 0x04, 0x1b, 0x74, 0x1b, 0xc8, 0x1c,
-    0x0c, 0x1c, 0x7e, 0x1c, 0xe4, 0x1d, 0x70, 0x1d, 0xba, 0x1d, 0xe2, 0x1e, 0x9c, 0x1e, 0xd4, 0x1f, 0x7c, 0x20, 0x30,
-    0x20, 0x48, 0x20, 0x78, 0x21, 0x12, 0x21, 0x2a, 0x21, 0x78, 0x21, 0xb2, 0x21, 0xfc, 0x22, 0x74, 0x22, 0x96, 0x22,
-    0xf2, 0x23, 0x1e, 0x23, 0x4a, 0x23, 0x84, 0x23, 0xa4, 0x23, 0xf8, 0x24, 0x06, 0x24, 0x22, 0x24, 0x3e, 0x24, 0x5a,
-    0x24, 0xe0, 0x25, 0x26, 0x25, 0x4c, 0x25, 0xd6, 0x26, 0x26, 0x26, 0xb0, 0x27, 0x76, 0x27, 0xee, 0x28, 0x40, 0x28,
-    0xc4, 0x29, 0x2c, 0x29, 0x78, 0x29, 0xa2, 0x29, 0xf8, 0x2a, 0x82, 0x2a, 0xb0, 0x2a, 0xe0, 0x2b, 0x2c, 0x2b, 0x78,
-    0x2b, 0xee, 0x2c, 0xba, 0x2d, 0x6a, 0x2d, 0xa2, 0x2e, 0x06, 0x2e, 0x94, 0x2f, 0x04, 0x2f, 0x56, 0x2f, 0xb6, 0x2f,
-    0xf2, 0x30, 0x5c, 0x30, 0x80, 0x30, 0xa4, 0x30, 0xd8, 0x30, 0xfe, 0x31, 0x46, 0x31, 0x7e, 0x31, 0xd4, 0x31, 0xf6,
-    0x32, 0x4c, 0x32, 0x66, 0x32, 0x7c, 0x32, 0x86, 0x32, 0xc2, 0x32, 0xe4, 0x33, 0x0e, 0x33, 0x24, 0x33, 0x70, 0x33,
-    0x78, 0x33, 0x96, 0x33, 0xba, 0x34, 0x2c, 0x34, 0x4a, 0x34, 0x7c, 0x34, 0x9e, 0x34, 0xd0, 0x35, 0x2c, 0x35, 0x72,
-    0x35, 0xe4, 0x36, 0xa8, 0x37, 0x4a, 0x37, 0x74, 0x37, 0xf8, 0x38, 0x86, 0x38, 0xe2, 0x39, 0x38, 0x39, 0xaa, 0x39,
-    0xe6, 0x3a, 0x84, 0x3b, 0x0a, 0x3b, 0x70, 0x3b, 0xd4, 0x3c, 0x3a, 0x3c, 0x96, 0x3c, 0xd6, 0x3d, 0x20, 0x3d, 0x8c,
-    0x3d, 0xde, 0x3e, 0x64, 0x3e, 0xe4, 0x3f, 0x3a, 0x3f, 0xc2, 0x40, 0x6a, 0x40, 0xdc, 0x41, 0x4c, 0x41, 0xfa, 0x42,
-    0x44, 0x42, 0x72, 0x42, 0xc0, 0x43, 0x0a, 0x43, 0x50, 0x43, 0xd6, 0x43, 0xfe, 0x44, 0x3c, 0x44, 0x7e, 0x44, 0xaa,
-    0x44, 0xec, 0x45, 0x1a, 0x45, 0x54, 0x45, 0xa0, 0x45, 0xf0, 0x46, 0x36, 0x46, 0xa2, 0x47, 0x36, 0x47, 0x86, 0x48,
-    0x06, 0x48, 0x7a, 0x48, 0x98, 0x48, 0xe8, 0x49, 0x2e, 0x49, 0xd4, 0x49, 0xfc, 0x4a, 0x2e, 0x4a, 0x6a, 0x4a, 0x98,
-    0x4a, 0xc2, 0x4a, 0xe4, 0x4b, 0x06, 0x4b, 0x6a, 0x4b, 0x96, 0x4b, 0xd2, 0x4c, 0x00, 0x4c, 0x3a, 0x4c, 0x86, 0x4c,
-    0xd4, 0x4d, 0x1a, 0x4d, 0x86, 0x4e, 0x2a, 0x4e, 0x7a, 0x4f, 0x10, 0x4f, 0x7e, 0x4f, 0xe4, 0x50, 0x3a, 0x50, 0xa6,
-    0x50, 0xd8, 0x51, 0x3a, 0x51, 0x9c, 0x51, 0xf6, 0x52, 0x9c, 0x53, 0x58, 0x53, 0x8e, 0x53, 0xc8, 0x54, 0x0e, 0x54,
-    0x56, 0x54, 0xb6, 0x55, 0x18, 0x55, 0x80, 0x55, 0xea, 0x56, 0x8a, 0x57, 0x2e, 0x57, 0xa8, 0x58, 0x0e, 0x58, 0x56,
-    0x58, 0xb2, 0x59, 0x54, 0x5a, 0x0c, 0x5a, 0xc8, 0x5b, 0xaa, 0x5c, 0x72, 0x5d, 0x5e, 0x5d, 0xf0, 0x5e, 0x86, 0x5e,
-    0xf0, 0x5f, 0x56, 0x5f, 0x94, 0x5f, 0xee, 0x60, 0x42, 0x60, 0x5c, 0x60, 0x74, 0x62, 0x26, 0x62, 0xb6, 0x63, 0x0c,
-    0x63, 0x8c, 0x63, 0xb0, 0x63, 0xd4, 0x64, 0x1e, 0x64, 0x66, 0x64, 0xc8, 0x65, 0x44, 0x65, 0x7c, 0x65, 0xb4, 0x65,
-    0xe6, 0x66, 0x18, 0x66, 0x6a, 0x66, 0xb6, 0x67, 0x98, 0x68, 0x66, 0x68, 0xa0, 0x68, 0xd6, 0x69, 0x42, 0x69, 0xbc,
-    0x69, 0xfc, 0x6a, 0x8a, 0x6b, 0x24, 0x6b, 0x6c, 0x6b, 0xb6, 0x6c, 0x06, 0x6c, 0x56, 0x6c, 0xca, 0x6d, 0x22, 0x6d,
-    0x7a, 0x6d, 0x90, 0x6d, 0xa6, 0x6d, 0xf0, 0x6e, 0x6e, 0x6f, 0x08, 0x6f, 0x8a, 0x70, 0x0c, 0x70, 0x8a, 0x71, 0x06,
-    0x71, 0x88, 0x72, 0x14, 0x72, 0x94, 0x73, 0x06, 0x73, 0x74, 0x73, 0xda, 0x74, 0x2c, 0x74, 0x7a, 0x75, 0x02, 0x75,
-    0x02, 0x75, 0x02, 0x75, 0x02, 0x75, 0x02, 0x75, 0x02, 0x75, 0x02, 0x75, 0x02, 0x75, 0x02, 0x75, 0x02, 0x75, 0x02,
-    0x75, 0x02, 0x75, 0x02, 0x75, 0x0e, 0x75, 0x1a, 0x75, 0x2c, 0x75, 0x4c, 0x75, 0x6c, 0x75, 0x8a, 0x75, 0x96, 0x75,
-    0xa4, 0x75, 0xb2, 0x75, 0xe2, 0x76, 0x10, 0x76, 0x52, 0x76, 0x82, 0x76, 0x90, 0x76, 0xa2, 0x77, 0x8a, 0x77, 0xaa,
-    0x77, 0xd0, 0x77, 0xe2, 0x78, 0x28, 0x78, 0x86, 0x78, 0xfe, 0x79, 0xca, 0x7a, 0x3c, 0x7a, 0xcc, 0x7b, 0x26, 0x7b,
-    0x88, 0x7b, 0xb8, 0x7c, 0x06, 0x7c, 0x1e, 0x7c, 0x3a, 0x7c, 0x56, 0x7c, 0x6e, 0x7c, 0xd6, 0x7c, 0xee, 0x7d, 0x12,
-    0x7d, 0x2c, 0x7d, 0x4a, 0x7d, 0xcc, 0x7e, 0x0a, 0x7e, 0x76, 0x7e, 0xa0, 0x7e, 0xba, 0x7e, 0xd4, 0x7e, 0xfa, 0x7f,
-    0x14, 0x7f, 0x14, 0x80, 0x30, 0x80, 0x8a, 0x80, 0xdc, 0x81, 0x26, 0x81, 0x64, 0x81, 0x9c, 0x81, 0xba, 0x81, 0xd8,
-    0x82, 0x04, 0x82, 0x1e, 0x82, 0x4c, 0x82, 0xba, 0x83, 0x1a, 0x83, 0x60, 0x83, 0x90, 0x83, 0xba, 0x84, 0x18, 0x84,
-    0x42, 0x84, 0x6e, 0x84, 0xa8, 0x84, 0xd6, 0x84, 0xf4, 0x85, 0x26, 0x85, 0x4e, 0x85, 0xaa, 0x86, 0x0a, 0x86, 0x56,
-    0x86, 0xd0, 0x86, 0xf2, 0x87, 0x30, 0x87, 0x54, 0x87, 0x84, 0x87, 0xb4, 0x87, 0xda, 0x88, 0x00, 0x88, 0x48, 0x88,
-    0x5e, 0x88, 0x9e, 0x88, 0xfe, 0x89, 0x24, 0x89, 0x6a, 0x89, 0xbe, 0x89, 0xd6, 0x8a, 0x4c, 0x8a, 0xa0, 0x8a, 0xea,
-    0x8b, 0x00, 0x8b, 0x2c, 0x8b, 0x86, 0x8b, 0xba, 0x8b, 0xfa, 0x8c, 0x48, 0x8c, 0x60, 0x8c, 0xfa, 0x8d, 0x46, 0x8d,
-    0x58, 0x8d, 0x9c, 0x8d, 0xc2, 0x8e, 0x10, 0x8e, 0x2a, 0x8e, 0x58, 0x8e, 0x90, 0x8f, 0x3a, 0x8f, 0x66, 0x8f, 0x92,
-    0x8f, 0xba, 0x8f, 0xc2, 0x8f, 0xca, 0x90, 0x14, 0x90, 0x64, 0x90, 0xba, 0x90, 0xec, 0x91, 0x32, 0x91, 0x62, 0x91,
-    0x7e, 0x91, 0xfc, 0x92, 0x60, 0x92, 0xb4, 0x93, 0x36, 0x93, 0x3e, 0x93, 0x46, 0x93, 0x4e, 0x93, 0xa4, 0x93, 0xfa,
-    0x94, 0x66, 0x94, 0x9a, 0x95, 0x12, 0x95, 0x24, 0x95, 0x36, 0x95, 0x48, 0x95, 0x5a, 0x95, 0x6c, 0x95, 0x7e, 0x95,
-    0x90, 0x95, 0x9c, 0x95, 0xae, 0x95, 0xc0, 0x95, 0xd2, 0x95, 0xe4, 0x95, 0xf6, 0x96, 0x08, 0x96, 0x1a, 0x96, 0x2c,
-    0x96, 0x3e, 0x96, 0x50, 0x96, 0x62, 0x96, 0x74, 0x96, 0x86, 0x96, 0x98, 0x96, 0xaa, 0x96, 0xbc, 0x96, 0xce, 0x96,
-    0xe0, 0x96, 0xf2, 0x97, 0x02, 0x97, 0x14, 0x97, 0x26, 0x97, 0x38, 0x97, 0x48, 0x97, 0x58, 0x97, 0x68, 0x97, 0x74,
-    0x97, 0x84, 0x97, 0x96, 0x97, 0xa6, 0x97, 0xb6, 0x97, 0xc6, 0x97, 0xd2, 0x97, 0xe4, 0x97, 0xf4, 0x98, 0x06, 0x98,
-    0x16, 0x98, 0x28, 0x98, 0x38, 0x98, 0x4a, 0x98, 0x5a, 0x98, 0x6a, 0x98, 0x7a, 0x98, 0x8a, 0x98, 0x9a, 0x98, 0xac,
-    0x98, 0xbc, 0x98, 0xce, 0x98, 0xde, 0x98, 0xf0, 0x99, 0x00, 0x99, 0x5e, 0x9a, 0x08, 0x9a, 0x1a, 0x9a, 0x2c, 0x9a,
-    0x3e, 0x9a, 0x50, 0x9a, 0x62, 0x9a, 0x72, 0x9a, 0x84, 0x9a, 0x94, 0x9a, 0xa6, 0x9a, 0xb8, 0x9a, 0xca, 0x9a, 0xda,
-    0x9a, 0xec, 0x9a, 0xfc, 0x9b, 0x0e, 0x9b, 0x1e, 0x9b, 0x7c, 0x9c, 0x06, 0x9c, 0x18, 0x9c, 0x28, 0x9c, 0x3a, 0x9c,
-    0x4a, 0x9c, 0x5c, 0x9c, 0x6c, 0x9c, 0x7e, 0x9c, 0x8e, 0x9c, 0xa0, 0x9c, 0xb0, 0x9c, 0xc2, 0x9c, 0xd4, 0x9c, 0xe6,
-    0x9c, 0xf8, 0x9d, 0x0a, 0x9d, 0x1c, 0x9d, 0x2e, 0x9d, 0x3e, 0x9d, 0x98, 0x9e, 0x0c, 0x9e, 0x1e, 0x9e, 0x30, 0x9e,
-    0x42, 0x9e, 0x54, 0x9e, 0x66, 0x9e, 0x78, 0x9e, 0x8a, 0x9e, 0x9c, 0x9e, 0xae, 0x9e, 0xc0, 0x9e, 0xd2, 0x9e, 0xe4,
-    0x9e, 0xf6, 0x9f, 0x08, 0x9f, 0x18, 0x9f, 0x2a, 0x9f, 0x3c, 0x9f, 0x4e, 0x9f, 0x5e, 0x9f, 0x6a, 0x9f, 0x7c, 0x9f,
-    0x8c, 0x9f, 0x9e, 0x9f, 0xae, 0x9f, 0xc0, 0x9f, 0xd2, 0x9f, 0xe4, 0x9f, 0xf4, 0xa0, 0x06, 0xa0, 0x18, 0xa0, 0x2a,
-    0xa0, 0x3a, 0xa0, 0x4c, 0xa0, 0x5e, 0xa0, 0x70, 0xa0, 0x80, 0xa0, 0x92, 0xa0, 0xa4, 0xa0, 0xb6, 0xa0, 0xc8, 0xa0,
-    0xda, 0xa0, 0xea, 0xa0, 0xfc, 0xa1, 0x0e, 0xa1, 0x1a, 0xa1, 0x2a, 0xa1, 0x36, 0xa1, 0x48, 0xa1, 0x5a, 0xa1, 0x6c,
-    0xa1, 0x7e, 0xa1, 0x90, 0xa1, 0xa2, 0xa1, 0xb4, 0xa1, 0xc4, 0xa1, 0xd6, 0xa1, 0xe6, 0xa1, 0xf8, 0xa2, 0x0a, 0xa2,
-    0x82, 0xa2, 0xe8, 0xa2, 0xfa, 0xa3, 0x0a, 0xa3, 0x1c, 0xa3, 0x2e, 0xa3, 0x40, 0xa3, 0x52, 0xa3, 0x64, 0xa3, 0x76,
-    0xa3, 0x86, 0xa3, 0x98, 0xa3, 0xa8, 0xa3, 0xba, 0xa3, 0xcc, 0xa3, 0xde, 0xa3, 0xee, 0xa4, 0x00, 0xa4, 0x12, 0xa4,
-    0x24, 0xa4, 0x34, 0xa4, 0x46, 0xa4, 0x56, 0xa4, 0x68, 0xa4, 0x78, 0xa4, 0x8a, 0xa4, 0x9c, 0xa4, 0xae, 0xa4, 0xbe,
-    0xa4, 0xce, 0xa4, 0xde, 0xa4, 0xee, 0xa4, 0xfe, 0xa5, 0x10, 0xa5, 0x22, 0xa5, 0x32, 0xa5, 0x44, 0xa5, 0x54, 0xa5,
-    0x66, 0xa5, 0x78, 0xa5, 0x8a, 0xa5, 0x9a, 0xa5, 0xaa, 0xa5, 0xbc, 0xa5, 0xce, 0xa5, 0xde, 0xa5, 0xee, 0xa5, 0xfe,
-    0xa6, 0x0e, 0xa6, 0x6c, 0xa6, 0x7c, 0xa6, 0x8c, 0xa6, 0x9c, 0xa6, 0xac, 0xa6, 0xbc, 0xa6, 0xcc, 0xa6, 0xdc, 0xa6,
-    0xec, 0xa7, 0x4a, 0xa7, 0x5a, 0xa7, 0x6a, 0xa7, 0x7a, 0xa7, 0x8a, 0xa7, 0x9c, 0xa7, 0xae, 0xa7, 0xc0, 0xa7, 0xd0,
-    0xa7, 0xe0, 0xa8, 0x3a, 0xa8, 0x4a, 0xa8, 0x5c, 0xa8, 0x6e, 0xa8, 0x80, 0xa8, 0x92, 0xa8, 0xa4, 0xa8, 0xb6, 0xa8,
-    0xc8, 0xa8, 0xda, 0xa8, 0xea, 0xa8, 0xfa, 0xa9, 0x0a, 0xa9, 0x1c, 0xa9, 0x2c, 0xa9, 0x3e, 0xa9, 0x4e, 0xa9, 0x5e,
-    0xa9, 0x6e, 0xa9, 0x7a, 0xa9, 0x8a, 0xa9, 0x9c, 0xa9, 0xac, 0xa9, 0xbe, 0xa9, 0xce, 0xa9, 0xde, 0xa9, 0xf0, 0xaa,
-    0x02, 0xaa, 0x7c, 0xaa, 0x8e, 0xaa, 0x9e, 0xaa, 0xae, 0xaa, 0xc0, 0xaa, 0xd0, 0xaa, 0xe0, 0xaa, 0xec, 0xaa, 0xf8,
-    0xab, 0x0a, 0xab, 0x1c, 0xab, 0x28, 0xab, 0x34, 0xab, 0x40, 0xab, 0x52, 0xab, 0x5a, 0xab, 0x62, 0xab, 0x6a, 0xab,
-    0x72, 0xab, 0x7a, 0xab, 0x82, 0xab, 0x8a, 0xab, 0x92, 0xab, 0x9a, 0xab, 0xa2, 0xab, 0xaa, 0xab, 0xb2, 0xab, 0xba,
-    0xab, 0xc2, 0xab, 0xd4, 0xab, 0xe6, 0xab, 0xf6, 0xac, 0x06, 0xac, 0x16, 0xac, 0x28, 0xac, 0x3a, 0xac, 0x42, 0xac,
-    0x4a, 0xac, 0x52, 0xac, 0x5a, 0xac, 0x62, 0xac, 0x72, 0xac, 0x82, 0xac, 0x92, 0xac, 0xa4, 0xac, 0xb6, 0xac, 0xc8,
-    0xac, 0xda, 0xad, 0x52, 0xad, 0x5a, 0xad, 0x6c, 0xad, 0x74, 0xad, 0x7c, 0xad, 0x8e, 0xad, 0xa0, 0xad, 0xa8, 0xad,
-    0xb0, 0xad, 0xb8, 0xad, 0xc0, 0xad, 0xd2, 0xad, 0xda, 0xad, 0xe2, 0xad, 0xea, 0xad, 0xf2, 0xad, 0xfa, 0xae, 0x02,
-    0xae, 0x0a, 0xae, 0x12, 0xae, 0x1a, 0xae, 0x22, 0xae, 0x2a, 0xae, 0x3a, 0xae, 0x42, 0xae, 0x4a, 0xae, 0xb0, 0xae,
-    0xb8, 0xae, 0xc0, 0xae, 0xd0, 0xae, 0xdc, 0xae, 0xe4, 0xae, 0xec, 0xae, 0xfc, 0xaf, 0x04, 0xaf, 0x10, 0xaf, 0x20,
-    0xaf, 0x32, 0xaf, 0x42, 0xaf, 0x54, 0xaf, 0x66, 0xaf, 0x78, 0xaf, 0x88, 0xaf, 0x9a, 0xaf, 0xaa, 0xaf, 0xb2, 0xaf,
-    0xba, 0xaf, 0xc6, 0xaf, 0xd8, 0xaf, 0xe0, 0xaf, 0xf2, 0xb0, 0x04, 0xb0, 0x10, 0xb0, 0x1c, 0xb0, 0x2e, 0xb0, 0x40,
-    0xb0, 0x52, 0xb0, 0x62, 0xb0, 0x72, 0xb0, 0x7a, 0xb0, 0x82, 0xb0, 0x94, 0xb0, 0xa6, 0xb0, 0xb8, 0xb0, 0xca, 0xb0,
-    0xdc, 0xb0, 0xee, 0xb0, 0xf6, 0xb0, 0xfe, 0xb1, 0x06, 0xb1, 0x18, 0xb1, 0x28, 0xb1, 0x30, 0xb1, 0x42, 0xb1, 0x52,
-    0xb1, 0x64, 0xb1, 0x74, 0xb1, 0x7c, 0xb1, 0x84, 0xb1, 0x96, 0xb1, 0xa6, 0xb1, 0xb8, 0xb1, 0xc0, 0xb1, 0xd0, 0xb1,
-    0xe2, 0xb1, 0xf2, 0xb2, 0x04, 0xb2, 0x14, 0xb2, 0x26, 0xb2, 0x38, 0xb2, 0x4a, 0xb2, 0x5a, 0xb2, 0x6c, 0xb2, 0x7c,
-    0xb2, 0x84, 0xb2, 0x8c, 0xb2, 0x9e, 0xb2, 0xae, 0xb2, 0xc0, 0xb2, 0xd0, 0xb2, 0xe2, 0xb2, 0xf4, 0xb3, 0x06, 0xb3,
-    0x16, 0xb3, 0x28, 0xb3, 0x3a, 0xb3, 0x4c, 0xb3, 0x5c, 0xb3, 0x6e, 0xb3, 0x7e, 0xb3, 0x8a, 0xb3, 0x96, 0xb3, 0x9e,
-    0xb3, 0xaa, 0xb3, 0xb6, 0xb3, 0xc2, 0xb3, 0xce, 0xb3, 0xe0, 0xb3, 0xf2, 0xb4, 0x04, 0xb4, 0x14, 0xb4, 0x26, 0xb4,
-    0x36, 0xb4, 0x48, 0xb4, 0x5a, 0xb4, 0x6c, 0xb4, 0x7e, 0xb4, 0x94, 0xb4, 0xaa, 0xb4, 0xbc, 0xb4, 0xcc, 0xb4, 0xde,
-    0xb4, 0xee, 0xb5, 0x00, 0xb5, 0x10, 0xb5, 0x22, 0xb5, 0x32, 0xb5, 0x48, 0xb5, 0x5c, 0xb5, 0x6e, 0xb5, 0x7a, 0xb5,
-    0x8c, 0xb5, 0x9e, 0xb5, 0xb0, 0xb5, 0xc2, 0xb5, 0xd4, 0xb5, 0xe4, 0xb5, 0xf6, 0xb6, 0x06, 0xb6, 0x18, 0xb6, 0x2a,
-    0xb6, 0x3c, 0xb6, 0x4e, 0xb6, 0x68, 0xb6, 0x7c, 0xb6, 0x8e, 0xb6, 0xa0, 0xb6, 0xb2, 0xb6, 0xc4, 0xb6, 0xd6, 0xb6,
-    0xe8, 0xb6, 0xfa, 0xb7, 0x0c, 0xb7, 0x1e, 0xb7, 0x2e, 0xb7, 0x40, 0xb7, 0x50, 0xb7, 0x62, 0xb7, 0x74, 0xb7, 0x86,
-    0xb7, 0x98, 0xb7, 0xb2, 0xb7, 0xcc, 0xb7, 0xde, 0xb7, 0xf0, 0xb8, 0x02, 0xb8, 0x12, 0xb8, 0x24, 0xb8, 0x36, 0xb8,
-    0x48, 0xb8, 0x5a, 0xb8, 0x66, 0xb8, 0x78, 0xb8, 0x84, 0xb8, 0x90, 0xb8, 0xa2, 0xb8, 0xb4, 0xb8, 0xc6, 0xb8, 0xd2,
-    0xb8, 0xe4, 0xb8, 0xf4, 0xb9, 0x06, 0xb9, 0x18, 0xb9, 0x2a, 0xb9, 0x3c, 0xb9, 0x4e, 0xb9, 0x5a, 0xb9, 0x6c, 0xb9,
-    0x7e, 0xb9, 0x90, 0xb9, 0xa2, 0xb9, 0xb4, 0xb9, 0xc6, 0xba, 0x70, 0xba, 0x8a, 0xba, 0x9c, 0xba, 0xa8, 0xba, 0xb4,
-    0xba, 0xc0, 0xba, 0xcc, 0xba, 0xd8, 0xba, 0xe4, 0xba, 0xf0, 0xba, 0xfc, 0xbb, 0x08, 0xbb, 0x14, 0xbb, 0x20, 0xbb,
-    0x2c, 0xbb, 0x38, 0xbb, 0x44, 0xbb, 0x50, 0xbb, 0x62, 0xbb, 0x74, 0xbb, 0x7c, 0xbb, 0xd6, 0xbc, 0x2e, 0xbc, 0x86,
-    0xbc, 0xb8, 0xbc, 0xea, 0xbd, 0x2e, 0xbd, 0x84, 0xbd, 0x9e, 0xbd, 0xb8, 0xbd, 0xca, 0xbd, 0xdc, 0xbd, 0xee, 0xbe,
-    0x00, 0xbe, 0x12, 0xbe, 0x24, 0xbe, 0x58, 0xbe, 0x90, 0xbe, 0xce, 0xbf, 0x0c, 0xbf, 0x14, 0xbf, 0x26, 0xbf, 0x32,
-    0xbf, 0x32, 0xbf, 0x32, 0xbf, 0x77, 0x00, 0x01, 0x00, 0x00, 0x04, 0x11, 0x00, 0x9d, 0x00, 0x16, 0x00, 0x89, 0x00,
-    0x05, 0x00, 0x02, 0x00, 0x50, 0x00, 0x60, 0x00, 0x77, 0x00, 0x00, 0x00, 0xdd, 0x0b, 0x97, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x0d, 0x00, 0xa2, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
-    0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x16, 0x00, 0x5e, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x02,
-    0x00, 0x0c, 0x00, 0x74, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x2e, 0x00, 0x80, 0x00, 0x03, 0x00,
-    0x01, 0x04, 0x09, 0x00, 0x04, 0x00, 0x24, 0x00, 0xae, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x54,
-    0x00, 0xd2, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x06, 0x00, 0x22, 0x01, 0x26, 0x00, 0x03, 0x00, 0x01, 0x04,
-    0x09, 0x00, 0x07, 0x00, 0x4a, 0x01, 0x48, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x09, 0x00, 0x0c, 0x01, 0x92,
-    0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0b, 0x00, 0x14, 0x01, 0x9e, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00,
-    0x0c, 0x00, 0x26, 0x01, 0xb2, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0d, 0x00, 0x5c, 0x01, 0xd8, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x00, 0x0e, 0x00, 0x54, 0x02, 0x34, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00,
-    0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x35,
-    0x00, 0x20, 0x00, 0x47, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x67, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x20, 0x00, 0x49, 0x00,
-    0x6e, 0x00, 0x63, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x41, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x20, 0x00, 0x52, 0x00, 0x69,
-    0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20, 0x00, 0x52, 0x00, 0x65, 0x00, 0x73, 0x00, 0x65, 0x00,
-    0x72, 0x00, 0x76, 0x00, 0x65, 0x00, 0x64, 0x00, 0x2e, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74,
-    0x00, 0x6f, 0x00, 0x20, 0x00, 0x4d, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x49, 0x00, 0x74, 0x00, 0x61, 0x00,
-    0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x47, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x67, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x3a,
-    0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x4d, 0x00, 0x6f, 0x00,
-    0x6e, 0x00, 0x6f, 0x00, 0x3a, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x35, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62,
-    0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x4d, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x20, 0x00,
-    0x49, 0x00, 0x74, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73,
-    0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x32, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
-    0x39, 0x00, 0x38, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x35, 0x00, 0x3b,
-    0x00, 0x20, 0x00, 0x74, 0x00, 0x74, 0x00, 0x66, 0x00, 0x61, 0x00, 0x75, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x68, 0x00,
-    0x69, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x28, 0x00, 0x76, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x33, 0x00, 0x29,
-    0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x4d, 0x00, 0x6f, 0x00, 0x6e, 0x00,
-    0x6f, 0x00, 0x2d, 0x00, 0x49, 0x00, 0x74, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x52, 0x00, 0x6f,
-    0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x4d, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x6f, 0x00,
-    0x20, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00, 0x20, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x64,
-    0x00, 0x65, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x72, 0x00, 0x6b, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00,
-    0x47, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x67, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x2e, 0x00, 0x47, 0x00, 0x6f, 0x00, 0x6f,
-    0x00, 0x67, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x47, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x67, 0x00, 0x6c, 0x00, 0x65, 0x00,
-    0x2e, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x43, 0x00, 0x68, 0x00, 0x72, 0x00, 0x69, 0x00, 0x73, 0x00, 0x74,
-    0x00, 0x69, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x65, 0x00, 0x72, 0x00,
-    0x74, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73,
-    0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00,
-    0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x41, 0x00, 0x70, 0x00, 0x61, 0x00, 0x63, 0x00, 0x68, 0x00, 0x65,
-    0x00, 0x20, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x2c, 0x00,
-    0x20, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x32,
-    0x00, 0x2e, 0x00, 0x30, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00,
-    0x77, 0x00, 0x77, 0x00, 0x77, 0x00, 0x2e, 0x00, 0x61, 0x00, 0x70, 0x00, 0x61, 0x00, 0x63, 0x00, 0x68, 0x00, 0x65,
-    0x00, 0x2e, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x67, 0x00, 0x2f, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00,
-    0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x73, 0x00, 0x2f, 0x00, 0x4c, 0x00, 0x49, 0x00, 0x43, 0x00, 0x45, 0x00, 0x4e,
-    0x00, 0x53, 0x00, 0x45, 0x00, 0x2d, 0x00, 0x32, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xff, 0x6a, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x00, 0x00, 0x01, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00,
-    0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0e,
-    0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00,
-    0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x20, 0x00, 0x21,
-    0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2a, 0x00,
-    0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34,
-    0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00,
-    0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47,
-    0x00, 0x48, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x50, 0x00,
-    0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5a,
-    0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x61, 0x00, 0xa3, 0x00, 0x84, 0x00,
-    0x85, 0x00, 0xbd, 0x00, 0x96, 0x00, 0xe8, 0x00, 0x86, 0x00, 0x8e, 0x00, 0x8b, 0x00, 0x9d, 0x00, 0xa9, 0x00, 0xa4,
-    0x00, 0x8a, 0x01, 0x03, 0x00, 0x83, 0x00, 0x93, 0x00, 0xf2, 0x00, 0xf3, 0x00, 0x8d, 0x00, 0x97, 0x00, 0x88, 0x01,
-    0x04, 0x00, 0xde, 0x00, 0xf1, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xf5, 0x00, 0xf4, 0x00, 0xf6, 0x00, 0xa2, 0x00, 0x90,
-    0x00, 0xf0, 0x00, 0x91, 0x00, 0xed, 0x00, 0x89, 0x00, 0xa0, 0x00, 0xea, 0x00, 0xb8, 0x00, 0xa1, 0x00, 0xee, 0x01,
-    0x05, 0x00, 0xd7, 0x01, 0x06, 0x01, 0x07, 0x01, 0x08, 0x00, 0xe2, 0x00, 0xe3, 0x01, 0x09, 0x01, 0x0a, 0x00, 0xb0,
-    0x00, 0xb1, 0x01, 0x0b, 0x00, 0xa6, 0x01, 0x0c, 0x01, 0x0d, 0x01, 0x0e, 0x01, 0x0f, 0x01, 0x10, 0x01, 0x11, 0x00,
-    0xd8, 0x00, 0xe1, 0x00, 0xdb, 0x00, 0xdc, 0x00, 0xdd, 0x00, 0xe0, 0x00, 0xd9, 0x00, 0xdf, 0x01, 0x12, 0x01, 0x13,
-    0x01, 0x14, 0x01, 0x15, 0x01, 0x16, 0x01, 0x17, 0x01, 0x18, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x1b, 0x01, 0x1c, 0x01,
-    0x1d, 0x01, 0x1e, 0x01, 0x1f, 0x01, 0x20, 0x01, 0x21, 0x01, 0x22, 0x01, 0x23, 0x01, 0x24, 0x00, 0x9f, 0x01, 0x25,
-    0x01, 0x26, 0x01, 0x27, 0x01, 0x28, 0x01, 0x29, 0x01, 0x2a, 0x01, 0x2b, 0x01, 0x2c, 0x01, 0x2d, 0x01, 0x2e, 0x01,
-    0x2f, 0x00, 0x9b, 0x01, 0x30, 0x01, 0x31, 0x01, 0x32, 0x01, 0x33, 0x01, 0x34, 0x01, 0x35, 0x01, 0x36, 0x01, 0x37,
-    0x01, 0x38, 0x01, 0x39, 0x01, 0x3a, 0x01, 0x3b, 0x01, 0x3c, 0x01, 0x3d, 0x01, 0x3e, 0x01, 0x3f, 0x01, 0x40, 0x01,
-    0x41, 0x01, 0x42, 0x01, 0x43, 0x01, 0x44, 0x01, 0x45, 0x01, 0x46, 0x01, 0x47, 0x01, 0x48, 0x01, 0x49, 0x01, 0x4a,
-    0x01, 0x4b, 0x01, 0x4c, 0x01, 0x4d, 0x01, 0x4e, 0x01, 0x4f, 0x01, 0x50, 0x01, 0x51, 0x01, 0x52, 0x01, 0x53, 0x01,
-    0x54, 0x01, 0x55, 0x01, 0x56, 0x01, 0x57, 0x01, 0x58, 0x01, 0x59, 0x01, 0x5a, 0x01, 0x5b, 0x01, 0x5c, 0x01, 0x5d,
-    0x01, 0x5e, 0x01, 0x5f, 0x01, 0x60, 0x01, 0x61, 0x01, 0x62, 0x01, 0x63, 0x01, 0x64, 0x01, 0x65, 0x01, 0x66, 0x01,
-    0x67, 0x01, 0x68, 0x01, 0x69, 0x01, 0x6a, 0x01, 0x6b, 0x01, 0x6c, 0x01, 0x6d, 0x01, 0x6e, 0x01, 0x6f, 0x01, 0x70,
-    0x01, 0x71, 0x01, 0x72, 0x01, 0x73, 0x01, 0x74, 0x01, 0x75, 0x01, 0x76, 0x01, 0x77, 0x01, 0x78, 0x01, 0x79, 0x01,
-    0x7a, 0x01, 0x7b, 0x01, 0x7c, 0x01, 0x7d, 0x01, 0x7e, 0x01, 0x7f, 0x01, 0x80, 0x01, 0x81, 0x01, 0x82, 0x01, 0x83,
-    0x01, 0x84, 0x01, 0x85, 0x01, 0x86, 0x01, 0x87, 0x01, 0x88, 0x01, 0x89, 0x01, 0x8a, 0x01, 0x8b, 0x01, 0x8c, 0x01,
-    0x8d, 0x01, 0x8e, 0x01, 0x8f, 0x01, 0x90, 0x01, 0x91, 0x01, 0x92, 0x01, 0x93, 0x01, 0x94, 0x01, 0x95, 0x01, 0x96,
-    0x01, 0x97, 0x01, 0x98, 0x01, 0x99, 0x01, 0x9a, 0x01, 0x9b, 0x01, 0x9c, 0x01, 0x9d, 0x01, 0x9e, 0x01, 0x9f, 0x01,
-    0xa0, 0x01, 0xa1, 0x01, 0xa2, 0x01, 0xa3, 0x01, 0xa4, 0x01, 0xa5, 0x01, 0xa6, 0x01, 0xa7, 0x01, 0xa8, 0x01, 0xa9,
-    0x01, 0xaa, 0x01, 0xab, 0x01, 0xac, 0x01, 0xad, 0x01, 0xae, 0x01, 0xaf, 0x01, 0xb0, 0x01, 0xb1, 0x01, 0xb2, 0x01,
-    0xb3, 0x01, 0xb4, 0x01, 0xb5, 0x01, 0xb6, 0x01, 0xb7, 0x01, 0xb8, 0x01, 0xb9, 0x01, 0xba, 0x01, 0xbb, 0x01, 0xbc,
-    0x01, 0xbd, 0x01, 0xbe, 0x01, 0xbf, 0x01, 0xc0, 0x01, 0xc1, 0x01, 0xc2, 0x01, 0xc3, 0x01, 0xc4, 0x01, 0xc5, 0x01,
-    0xc6, 0x01, 0xc7, 0x01, 0xc8, 0x01, 0xc9, 0x01, 0xca, 0x01, 0xcb, 0x01, 0xcc, 0x01, 0xcd, 0x01, 0xce, 0x01, 0xcf,
-    0x00, 0xb2, 0x00, 0xb3, 0x01, 0xd0, 0x00, 0xb6, 0x00, 0xb7, 0x00, 0xc4, 0x01, 0xd1, 0x00, 0xb4, 0x00, 0xb5, 0x00,
-    0xc5, 0x00, 0x82, 0x00, 0xc2, 0x00, 0x87, 0x01, 0xd2, 0x00, 0xab, 0x00, 0xc6, 0x00, 0xbe, 0x00, 0xbf, 0x00, 0xbc,
-    0x01, 0xd3, 0x01, 0xd4, 0x01, 0xd5, 0x01, 0xd6, 0x01, 0xd7, 0x01, 0xd8, 0x01, 0xd9, 0x01, 0xda, 0x00, 0x8c, 0x01,
-    0xdb, 0x01, 0xdc, 0x01, 0xdd, 0x01, 0xde, 0x01, 0xdf, 0x00, 0x98, 0x00, 0x9a, 0x00, 0x99, 0x00, 0xef, 0x00, 0xa5,
-    0x00, 0x92, 0x00, 0x9c, 0x00, 0xa7, 0x00, 0x8f, 0x00, 0x94, 0x00, 0x95, 0x00, 0xb9, 0x01, 0xe0, 0x01, 0xe1, 0x01,
-    0xe2, 0x01, 0xe3, 0x01, 0xe4, 0x01, 0xe5, 0x01, 0xe6, 0x01, 0xe7, 0x01, 0xe8, 0x01, 0xe9, 0x01, 0xea, 0x01, 0xeb,
-    0x01, 0xec, 0x01, 0xed, 0x01, 0xee, 0x01, 0xef, 0x01, 0xf0, 0x01, 0xf1, 0x01, 0xf2, 0x01, 0xf3, 0x01, 0xf4, 0x01,
-    0xf5, 0x01, 0xf6, 0x01, 0xf7, 0x01, 0xf8, 0x01, 0xf9, 0x01, 0xfa, 0x01, 0xfb, 0x01, 0xfc, 0x01, 0xfd, 0x01, 0xfe,
-    0x01, 0xff, 0x02, 0x00, 0x02, 0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x02,
-    0x08, 0x02, 0x09, 0x02, 0x0a, 0x02, 0x0b, 0x02, 0x0c, 0x02, 0x0d, 0x02, 0x0e, 0x02, 0x0f, 0x02, 0x10, 0x02, 0x11,
-    0x02, 0x12, 0x02, 0x13, 0x02, 0x14, 0x02, 0x15, 0x02, 0x16, 0x02, 0x17, 0x02, 0x18, 0x02, 0x19, 0x02, 0x1a, 0x02,
-    0x1b, 0x02, 0x1c, 0x02, 0x1d, 0x02, 0x1e, 0x02, 0x1f, 0x02, 0x20, 0x02, 0x21, 0x02, 0x22, 0x02, 0x23, 0x02, 0x24,
-    0x02, 0x25, 0x02, 0x26, 0x02, 0x27, 0x02, 0x28, 0x02, 0x29, 0x02, 0x2a, 0x02, 0x2b, 0x02, 0x2c, 0x02, 0x2d, 0x02,
-    0x2e, 0x02, 0x2f, 0x02, 0x30, 0x02, 0x31, 0x00, 0xac, 0x02, 0x32, 0x02, 0x33, 0x00, 0xe9, 0x02, 0x34, 0x02, 0x35,
-    0x02, 0x36, 0x00, 0xad, 0x00, 0xc9, 0x00, 0xc7, 0x00, 0xae, 0x00, 0x62, 0x00, 0x63, 0x02, 0x37, 0x00, 0x64, 0x00,
-    0xcb, 0x00, 0x65, 0x00, 0xc8, 0x00, 0xca, 0x00, 0xcf, 0x00, 0xcc, 0x00, 0xcd, 0x00, 0xce, 0x00, 0x66, 0x00, 0xd3,
-    0x00, 0xd0, 0x00, 0xd1, 0x00, 0xaf, 0x00, 0x67, 0x00, 0xd6, 0x00, 0xd4, 0x00, 0xd5, 0x00, 0x68, 0x00, 0xeb, 0x00,
-    0x6a, 0x00, 0x69, 0x00, 0x6b, 0x00, 0x6d, 0x00, 0x6c, 0x00, 0x6e, 0x02, 0x38, 0x00, 0x6f, 0x00, 0x71, 0x00, 0x70,
-    0x00, 0x72, 0x00, 0x73, 0x00, 0x75, 0x00, 0x74, 0x00, 0x76, 0x00, 0x77, 0x00, 0x78, 0x00, 0x7a, 0x00, 0x79, 0x00,
-    0x7b, 0x00, 0x7d, 0x00, 0x7c, 0x00, 0x7f, 0x00, 0x7e, 0x00, 0x80, 0x00, 0x81, 0x00, 0xec, 0x00, 0xba, 0x02, 0x39,
-    0x02, 0x3a, 0x02, 0x3b, 0x02, 0x3c, 0x02, 0x3d, 0x02, 0x3e, 0x00, 0xfd, 0x00, 0xfe, 0x02, 0x3f, 0x02, 0x40, 0x02,
-    0x41, 0x02, 0x42, 0x00, 0xff, 0x01, 0x00, 0x02, 0x43, 0x02, 0x44, 0x02, 0x45, 0x02, 0x46, 0x02, 0x47, 0x02, 0x48,
-    0x02, 0x49, 0x02, 0x4a, 0x02, 0x4b, 0x02, 0x4c, 0x02, 0x4d, 0x02, 0x4e, 0x02, 0x4f, 0x02, 0x50, 0x00, 0xf8, 0x00,
-    0xf9, 0x02, 0x51, 0x02, 0x52, 0x02, 0x53, 0x02, 0x54, 0x02, 0x55, 0x02, 0x56, 0x02, 0x57, 0x02, 0x58, 0x02, 0x59,
-    0x02, 0x5a, 0x02, 0x5b, 0x02, 0x5c, 0x02, 0x5d, 0x02, 0x5e, 0x02, 0x5f, 0x02, 0x60, 0x02, 0x61, 0x02, 0x62, 0x02,
-    0x63, 0x02, 0x64, 0x02, 0x65, 0x02, 0x66, 0x02, 0x67, 0x02, 0x68, 0x02, 0x69, 0x02, 0x6a, 0x02, 0x6b, 0x02, 0x6c,
-    0x02, 0x6d, 0x02, 0x6e, 0x02, 0x6f, 0x02, 0x70, 0x02, 0x71, 0x02, 0x72, 0x02, 0x73, 0x02, 0x74, 0x02, 0x75, 0x02,
-    0x76, 0x02, 0x77, 0x02, 0x78, 0x02, 0x79, 0x02, 0x7a, 0x02, 0x7b, 0x02, 0x7c, 0x02, 0x7d, 0x02, 0x7e, 0x02, 0x7f,
-    0x02, 0x80, 0x02, 0x81, 0x02, 0x82, 0x00, 0xfb, 0x00, 0xfc, 0x02, 0x83, 0x02, 0x84, 0x00, 0xe4, 0x00, 0xe5, 0x02,
-    0x85, 0x02, 0x86, 0x02, 0x87, 0x02, 0x88, 0x02, 0x89, 0x02, 0x8a, 0x02, 0x8b, 0x02, 0x8c, 0x02, 0x8d, 0x02, 0x8e,
-    0x02, 0x8f, 0x02, 0x90, 0x02, 0x91, 0x02, 0x92, 0x02, 0x93, 0x02, 0x94, 0x02, 0x95, 0x02, 0x96, 0x02, 0x97, 0x02,
-    0x98, 0x02, 0x99, 0x02, 0x9a, 0x02, 0x9b, 0x00, 0xbb, 0x02, 0x9c, 0x02, 0x9d, 0x02, 0x9e, 0x02, 0x9f, 0x00, 0xe6,
-    0x00, 0xe7, 0x02, 0xa0, 0x02, 0xa1, 0x02, 0xa2, 0x02, 0xa3, 0x02, 0xa4, 0x02, 0xa5, 0x02, 0xa6, 0x02, 0xa7, 0x02,
-    0xa8, 0x02, 0xa9, 0x02, 0xaa, 0x02, 0xab, 0x02, 0xac, 0x02, 0xad, 0x02, 0xae, 0x02, 0xaf, 0x02, 0xb0, 0x02, 0xb1,
-    0x02, 0xb2, 0x02, 0xb3, 0x02, 0xb4, 0x02, 0xb5, 0x02, 0xb6, 0x02, 0xb7, 0x02, 0xb8, 0x02, 0xb9, 0x02, 0xba, 0x02,
-    0xbb, 0x02, 0xbc, 0x02, 0xbd, 0x02, 0xbe, 0x02, 0xbf, 0x02, 0xc0, 0x02, 0xc1, 0x02, 0xc2, 0x02, 0xc3, 0x02, 0xc4,
-    0x02, 0xc5, 0x02, 0xc6, 0x02, 0xc7, 0x02, 0xc8, 0x02, 0xc9, 0x02, 0xca, 0x02, 0xcb, 0x02, 0xcc, 0x02, 0xcd, 0x02,
-    0xce, 0x02, 0xcf, 0x02, 0xd0, 0x02, 0xd1, 0x02, 0xd2, 0x02, 0xd3, 0x02, 0xd4, 0x02, 0xd5, 0x02, 0xd6, 0x02, 0xd7,
-    0x02, 0xd8, 0x02, 0xd9, 0x02, 0xda, 0x02, 0xdb, 0x02, 0xdc, 0x02, 0xdd, 0x02, 0xde, 0x02, 0xdf, 0x02, 0xe0, 0x02,
-    0xe1, 0x02, 0xe2, 0x02, 0xe3, 0x02, 0xe4, 0x02, 0xe5, 0x02, 0xe6, 0x02, 0xe7, 0x02, 0xe8, 0x02, 0xe9, 0x02, 0xea,
-    0x02, 0xeb, 0x02, 0xec, 0x02, 0xed, 0x02, 0xee, 0x02, 0xef, 0x02, 0xf0, 0x02, 0xf1, 0x02, 0xf2, 0x02, 0xf3, 0x02,
-    0xf4, 0x02, 0xf5, 0x02, 0xf6, 0x02, 0xf7, 0x02, 0xf8, 0x02, 0xf9, 0x02, 0xfa, 0x02, 0xfb, 0x02, 0xfc, 0x02, 0xfd,
-    0x02, 0xfe, 0x02, 0xff, 0x03, 0x00, 0x03, 0x01, 0x03, 0x02, 0x03, 0x03, 0x03, 0x04, 0x03, 0x05, 0x03, 0x06, 0x03,
-    0x07, 0x03, 0x08, 0x03, 0x09, 0x03, 0x0a, 0x03, 0x0b, 0x03, 0x0c, 0x03, 0x0d, 0x03, 0x0e, 0x03, 0x0f, 0x03, 0x10,
-    0x03, 0x11, 0x03, 0x12, 0x03, 0x13, 0x03, 0x14, 0x03, 0x15, 0x03, 0x16, 0x03, 0x17, 0x03, 0x18, 0x03, 0x19, 0x03,
-    0x1a, 0x03, 0x1b, 0x03, 0x1c, 0x03, 0x1d, 0x03, 0x1e, 0x03, 0x1f, 0x03, 0x20, 0x03, 0x21, 0x03, 0x22, 0x03, 0x23,
-    0x03, 0x24, 0x03, 0x25, 0x03, 0x26, 0x03, 0x27, 0x03, 0x28, 0x03, 0x29, 0x03, 0x2a, 0x03, 0x2b, 0x03, 0x2c, 0x03,
-    0x2d, 0x03, 0x2e, 0x03, 0x2f, 0x03, 0x30, 0x03, 0x31, 0x03, 0x32, 0x03, 0x33, 0x03, 0x34, 0x03, 0x35, 0x03, 0x36,
-    0x03, 0x37, 0x03, 0x38, 0x03, 0x39, 0x03, 0x3a, 0x03, 0x3b, 0x03, 0x3c, 0x03, 0x3d, 0x03, 0x3e, 0x03, 0x3f, 0x03,
-    0x40, 0x03, 0x41, 0x03, 0x42, 0x03, 0x43, 0x03, 0x44, 0x03, 0x45, 0x03, 0x46, 0x03, 0x47, 0x03, 0x48, 0x03, 0x49,
-    0x03, 0x4a, 0x03, 0x4b, 0x03, 0x4c, 0x03, 0x4d, 0x03, 0x4e, 0x03, 0x4f, 0x03, 0x50, 0x03, 0x51, 0x03, 0x52, 0x03,
-    0x53, 0x03, 0x54, 0x03, 0x55, 0x03, 0x56, 0x03, 0x57, 0x03, 0x58, 0x03, 0x59, 0x03, 0x5a, 0x03, 0x5b, 0x03, 0x5c,
-    0x03, 0x5d, 0x03, 0x5e, 0x03, 0x5f, 0x03, 0x60, 0x03, 0x61, 0x03, 0x62, 0x03, 0x63, 0x03, 0x64, 0x03, 0x65, 0x03,
-    0x66, 0x03, 0x67, 0x03, 0x68, 0x03, 0x69, 0x03, 0x6a, 0x03, 0x6b, 0x03, 0x6c, 0x03, 0x6d, 0x03, 0x6e, 0x03, 0x6f,
-    0x03, 0x70, 0x03, 0x71, 0x03, 0x72, 0x03, 0x73, 0x03, 0x74, 0x03, 0x75, 0x03, 0x76, 0x03, 0x77, 0x03, 0x78, 0x03,
-    0x79, 0x03, 0x7a, 0x03, 0x7b, 0x03, 0x7c, 0x03, 0x7d, 0x03, 0x7e, 0x03, 0x7f, 0x03, 0x80, 0x03, 0x81, 0x03, 0x82,
-    0x03, 0x83, 0x03, 0x84, 0x03, 0x85, 0x03, 0x86, 0x03, 0x87, 0x03, 0x88, 0x03, 0x89, 0x03, 0x8a, 0x03, 0x8b, 0x03,
-    0x8c, 0x03, 0x8d, 0x03, 0x8e, 0x03, 0x8f, 0x03, 0x90, 0x03, 0x91, 0x03, 0x92, 0x03, 0x93, 0x03, 0x94, 0x03, 0x95,
-    0x03, 0x96, 0x03, 0x97, 0x03, 0x98, 0x03, 0x99, 0x03, 0x9a, 0x03, 0x9b, 0x03, 0x9c, 0x03, 0x9d, 0x03, 0x9e, 0x03,
-    0x9f, 0x03, 0xa0, 0x03, 0xa1, 0x03, 0xa2, 0x03, 0xa3, 0x03, 0xa4, 0x03, 0xa5, 0x03, 0xa6, 0x03, 0xa7, 0x03, 0xa8,
-    0x03, 0xa9, 0x03, 0xaa, 0x03, 0xab, 0x03, 0xac, 0x03, 0xad, 0x03, 0xae, 0x03, 0xaf, 0x03, 0xb0, 0x03, 0xb1, 0x03,
-    0xb2, 0x03, 0xb3, 0x03, 0xb4, 0x03, 0xb5, 0x03, 0xb6, 0x03, 0xb7, 0x03, 0xb8, 0x03, 0xb9, 0x03, 0xba, 0x03, 0xbb,
-    0x03, 0xbc, 0x03, 0xbd, 0x03, 0xbe, 0x03, 0xbf, 0x03, 0xc0, 0x03, 0xc1, 0x03, 0xc2, 0x03, 0xc3, 0x03, 0xc4, 0x03,
-    0xc5, 0x03, 0xc6, 0x03, 0xc7, 0x03, 0xc8, 0x03, 0xc9, 0x03, 0xca, 0x03, 0xcb, 0x03, 0xcc, 0x03, 0xcd, 0x03, 0xce,
-    0x03, 0xcf, 0x03, 0xd0, 0x03, 0xd1, 0x03, 0xd2, 0x03, 0xd3, 0x03, 0xd4, 0x03, 0xd5, 0x03, 0xd6, 0x03, 0xd7, 0x03,
-    0xd8, 0x03, 0xd9, 0x03, 0xda, 0x03, 0xdb, 0x03, 0xdc, 0x03, 0xdd, 0x03, 0xde, 0x03, 0xdf, 0x03, 0xe0, 0x03, 0xe1,
-    0x03, 0xe2, 0x03, 0xe3, 0x03, 0xe4, 0x03, 0xe5, 0x03, 0xe6, 0x03, 0xe7, 0x03, 0xe8, 0x03, 0xe9, 0x03, 0xea, 0x03,
-    0xeb, 0x03, 0xec, 0x03, 0xed, 0x03, 0xee, 0x03, 0xef, 0x03, 0xf0, 0x03, 0xf1, 0x03, 0xf2, 0x03, 0xf3, 0x03, 0xf4,
-    0x03, 0xf5, 0x03, 0xf6, 0x03, 0xf7, 0x03, 0xf8, 0x03, 0xf9, 0x03, 0xfa, 0x03, 0xfb, 0x03, 0xfc, 0x03, 0xfd, 0x03,
-    0xfe, 0x03, 0xff, 0x04, 0x00, 0x04, 0x01, 0x04, 0x02, 0x04, 0x03, 0x04, 0x04, 0x04, 0x05, 0x04, 0x06, 0x04, 0x07,
-    0x04, 0x08, 0x04, 0x09, 0x04, 0x0a, 0x04, 0x0b, 0x04, 0x0c, 0x04, 0x0d, 0x04, 0x0e, 0x04, 0x0f, 0x04, 0x10, 0x04,
-    0x11, 0x04, 0x12, 0x04, 0x13, 0x04, 0x14, 0x04, 0x15, 0x04, 0x16, 0x00, 0xf7, 0x04, 0x17, 0x04, 0x18, 0x04, 0x19,
-    0x00, 0x04, 0x04, 0x4e, 0x55, 0x4c, 0x4c, 0x06, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x0e, 0x70, 0x65, 0x72, 0x69,
-    0x6f, 0x64, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x65, 0x64, 0x04, 0x48, 0x62, 0x61, 0x72, 0x02, 0x49, 0x4a, 0x02,
-    0x69, 0x6a, 0x0c, 0x6b, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x6c, 0x61, 0x6e, 0x64, 0x69, 0x63, 0x03, 0x45, 0x6e, 0x67,
-    0x03, 0x65, 0x6e, 0x67, 0x05, 0x6c, 0x6f, 0x6e, 0x67, 0x73, 0x05, 0x4f, 0x68, 0x6f, 0x72, 0x6e, 0x05, 0x6f, 0x68,
-    0x6f, 0x72, 0x6e, 0x05, 0x55, 0x68, 0x6f, 0x72, 0x6e, 0x05, 0x75, 0x68, 0x6f, 0x72, 0x6e, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x32, 0x33, 0x37, 0x05, 0x73, 0x63, 0x68, 0x77, 0x61, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x46, 0x33, 0x09,
-    0x67, 0x72, 0x61, 0x76, 0x65, 0x63, 0x6f, 0x6d, 0x62, 0x09, 0x61, 0x63, 0x75, 0x74, 0x65, 0x63, 0x6f, 0x6d, 0x62,
-    0x09, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x63, 0x6f, 0x6d, 0x62, 0x04, 0x68, 0x6f, 0x6f, 0x6b, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x33, 0x30, 0x46, 0x08, 0x64, 0x6f, 0x74, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x05, 0x74, 0x6f, 0x6e, 0x6f, 0x73,
-    0x0d, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x09, 0x61, 0x6e, 0x6f, 0x74,
-    0x65, 0x6c, 0x65, 0x69, 0x61, 0x05, 0x47, 0x61, 0x6d, 0x6d, 0x61, 0x05, 0x44, 0x65, 0x6c, 0x74, 0x61, 0x05, 0x54,
-    0x68, 0x65, 0x74, 0x61, 0x06, 0x4c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x02, 0x58, 0x69, 0x02, 0x50, 0x69, 0x05, 0x53,
-    0x69, 0x67, 0x6d, 0x61, 0x03, 0x50, 0x68, 0x69, 0x03, 0x50, 0x73, 0x69, 0x05, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x04,
-    0x62, 0x65, 0x74, 0x61, 0x05, 0x67, 0x61, 0x6d, 0x6d, 0x61, 0x05, 0x64, 0x65, 0x6c, 0x74, 0x61, 0x07, 0x65, 0x70,
-    0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x04, 0x7a, 0x65, 0x74, 0x61, 0x03, 0x65, 0x74, 0x61, 0x05, 0x74, 0x68, 0x65, 0x74,
-    0x61, 0x04, 0x69, 0x6f, 0x74, 0x61, 0x06, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x02, 0x78, 0x69, 0x03, 0x72, 0x68,
-    0x6f, 0x06, 0x73, 0x69, 0x67, 0x6d, 0x61, 0x31, 0x05, 0x73, 0x69, 0x67, 0x6d, 0x61, 0x03, 0x74, 0x61, 0x75, 0x07,
-    0x75, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x03, 0x70, 0x68, 0x69, 0x03, 0x70, 0x73, 0x69, 0x05, 0x6f, 0x6d, 0x65,
-    0x67, 0x61, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x44, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x44, 0x32, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x33, 0x44, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x32, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x30, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30,
-    0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x46, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x31, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x31, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x38,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x33, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x32, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x32, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x41, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x43, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x32, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32,
-    0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x32, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x33, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x33, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x38,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x42, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x33, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x33, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x34, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x37, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x34, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34,
-    0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x43, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x34, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x34, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x34,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x41, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x35, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x36, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x33, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x35, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x36, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36,
-    0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x41, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x36, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x36, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x46,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37, 0x33, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x37, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x37, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37, 0x41, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x37, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37, 0x43, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x37, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37,
-    0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x31, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x38, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x38, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x36,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x39, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x38, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x39, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x34, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x43, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x39, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41,
-    0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x35, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x41, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x41, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x34,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x38, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x42, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x42, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x33, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x37, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x43, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45,
-    0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x41, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x46, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x35, 0x30, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x34,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x36, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x35, 0x30, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35,
-    0x30, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x42, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x44, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x35, 0x30, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x31,
-    0x30, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x31, 0x07, 0x75,
-    0x6e, 0x69, 0x32, 0x30, 0x30, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x32,
-    0x30, 0x30, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x36,
-    0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x38, 0x07, 0x75, 0x6e,
-    0x69, 0x32, 0x30, 0x30, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30,
-    0x30, 0x42, 0x0d, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x64, 0x62, 0x6c, 0x0d, 0x71, 0x75,
-    0x6f, 0x74, 0x65, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x64, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x32, 0x35,
-    0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x37, 0x34, 0x09, 0x6e, 0x73, 0x75, 0x70, 0x65, 0x72, 0x69, 0x6f, 0x72, 0x04,
-    0x6c, 0x69, 0x72, 0x61, 0x06, 0x70, 0x65, 0x73, 0x65, 0x74, 0x61, 0x04, 0x45, 0x75, 0x72, 0x6f, 0x07, 0x75, 0x6e,
-    0x69, 0x32, 0x31, 0x30, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x31, 0x31, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x31,
-    0x31, 0x36, 0x09, 0x65, 0x73, 0x74, 0x69, 0x6d, 0x61, 0x74, 0x65, 0x64, 0x09, 0x6f, 0x6e, 0x65, 0x65, 0x69, 0x67,
-    0x68, 0x74, 0x68, 0x0c, 0x74, 0x68, 0x72, 0x65, 0x65, 0x65, 0x69, 0x67, 0x68, 0x74, 0x68, 0x73, 0x0b, 0x66, 0x69,
-    0x76, 0x65, 0x65, 0x69, 0x67, 0x68, 0x74, 0x68, 0x73, 0x0c, 0x73, 0x65, 0x76, 0x65, 0x6e, 0x65, 0x69, 0x67, 0x68,
-    0x74, 0x68, 0x73, 0x0b, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x07, 0x75, 0x6e, 0x69,
-    0x46, 0x45, 0x46, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x46, 0x46, 0x46, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x46, 0x46, 0x46,
-    0x44, 0x09, 0x7a, 0x65, 0x72, 0x6f, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x07, 0x74, 0x77, 0x6f, 0x2e, 0x73, 0x75, 0x70,
-    0x13, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x63, 0x6f, 0x6d,
-    0x62, 0x12, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x68, 0x6f, 0x6f, 0x6b, 0x63, 0x6f, 0x6d,
-    0x62, 0x13, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x67, 0x72, 0x61, 0x76, 0x65, 0x63, 0x6f,
-    0x6d, 0x62, 0x13, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x61, 0x63, 0x75, 0x74, 0x65, 0x63,
-    0x6f, 0x6d, 0x62, 0x0e, 0x62, 0x72, 0x65, 0x76, 0x65, 0x67, 0x72, 0x61, 0x76, 0x65, 0x63, 0x6f, 0x6d, 0x62, 0x11,
-    0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x06, 0x41,
-    0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x42, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x43, 0x2e, 0x73, 0x6d, 0x63, 0x70,
-    0x06, 0x44, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x45, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x46, 0x2e, 0x73, 0x6d,
-    0x63, 0x70, 0x06, 0x47, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x48, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x49, 0x2e,
-    0x73, 0x6d, 0x63, 0x70, 0x06, 0x4a, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x4b, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06,
-    0x4c, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x4d, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x4e, 0x2e, 0x73, 0x6d, 0x63,
-    0x70, 0x06, 0x4f, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x51, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x52, 0x2e, 0x73,
-    0x6d, 0x63, 0x70, 0x06, 0x53, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x54, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x55,
-    0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x56, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x57, 0x2e, 0x73, 0x6d, 0x63, 0x70,
-    0x06, 0x58, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x59, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x5a, 0x2e, 0x73, 0x6d,
-    0x63, 0x70, 0x0d, 0x62, 0x72, 0x65, 0x76, 0x65, 0x68, 0x6f, 0x6f, 0x6b, 0x63, 0x6f, 0x6d, 0x62, 0x08, 0x6f, 0x6e,
-    0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x08, 0x74, 0x77, 0x6f, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0a, 0x74, 0x68, 0x72,
-    0x65, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x09, 0x66, 0x6f, 0x75, 0x72, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x09, 0x66,
-    0x69, 0x76, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x08, 0x73, 0x69, 0x78, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0a, 0x73,
-    0x65, 0x76, 0x65, 0x6e, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0a, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2e, 0x73, 0x6d, 0x63,
-    0x70, 0x09, 0x6e, 0x69, 0x6e, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x08, 0x7a, 0x65, 0x72, 0x6f, 0x2e, 0x73, 0x75,
-    0x70, 0x07, 0x6f, 0x6e, 0x65, 0x2e, 0x73, 0x75, 0x70, 0x0e, 0x62, 0x72, 0x65, 0x76, 0x65, 0x61, 0x63, 0x75, 0x74,
-    0x65, 0x63, 0x6f, 0x6d, 0x62, 0x09, 0x74, 0x68, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x75, 0x70, 0x08, 0x66, 0x6f, 0x75,
-    0x72, 0x2e, 0x73, 0x75, 0x70, 0x08, 0x66, 0x69, 0x76, 0x65, 0x2e, 0x73, 0x75, 0x70, 0x07, 0x73, 0x69, 0x78, 0x2e,
-    0x73, 0x75, 0x70, 0x09, 0x73, 0x65, 0x76, 0x65, 0x6e, 0x2e, 0x73, 0x75, 0x70, 0x09, 0x65, 0x69, 0x67, 0x68, 0x74,
-    0x2e, 0x73, 0x75, 0x70, 0x08, 0x6e, 0x69, 0x6e, 0x65, 0x2e, 0x73, 0x75, 0x70, 0x08, 0x63, 0x72, 0x6f, 0x73, 0x73,
-    0x62, 0x61, 0x72, 0x09, 0x72, 0x69, 0x6e, 0x67, 0x61, 0x63, 0x75, 0x74, 0x65, 0x09, 0x64, 0x61, 0x73, 0x69, 0x61,
-    0x6f, 0x78, 0x69, 0x61, 0x0e, 0x62, 0x72, 0x65, 0x76, 0x65, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x63, 0x6f, 0x6d, 0x62,
-    0x0b, 0x63, 0x79, 0x72, 0x69, 0x6c, 0x6c, 0x69, 0x63, 0x74, 0x69, 0x63, 0x10, 0x63, 0x79, 0x72, 0x69, 0x6c, 0x6c,
-    0x69, 0x63, 0x68, 0x6f, 0x6f, 0x6b, 0x6c, 0x65, 0x66, 0x74, 0x0c, 0x63, 0x79, 0x72, 0x69, 0x6c, 0x6c, 0x69, 0x63,
-    0x68, 0x6f, 0x6f, 0x6b, 0x05, 0x67, 0x2e, 0x61, 0x6c, 0x74, 0x0e, 0x6c, 0x61, 0x72, 0x67, 0x65, 0x72, 0x69, 0x67,
-    0x68, 0x74, 0x68, 0x6f, 0x6f, 0x6b, 0x05, 0x69, 0x2e, 0x61, 0x6c, 0x74, 0x05, 0x6c, 0x2e, 0x61, 0x6c, 0x74, 0x08,
-    0x6f, 0x6e, 0x65, 0x2e, 0x6c, 0x6e, 0x75, 0x6d, 0x0a, 0x73, 0x65, 0x76, 0x65, 0x6e, 0x2e, 0x6c, 0x6e, 0x75, 0x6d,
-    0x06, 0x50, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x07, 0x63, 0x68, 0x69, 0x2e, 0x61, 0x6c, 0x74, 0x05, 0x52, 0x2e, 0x61,
-    0x6c, 0x74, 0x05, 0x4b, 0x2e, 0x61, 0x6c, 0x74, 0x04, 0x69, 0x2e, 0x69, 0x74, 0x04, 0x6c, 0x2e, 0x69, 0x74, 0x07,
-    0x6f, 0x6e, 0x65, 0x2e, 0x61, 0x6c, 0x74, 0x06, 0x61, 0x74, 0x2e, 0x61, 0x6c, 0x74, 0x0d, 0x61, 0x6d, 0x70, 0x65,
-    0x72, 0x73, 0x61, 0x6e, 0x64, 0x2e, 0x61, 0x6c, 0x74, 0x0a, 0x47, 0x65, 0x72, 0x6d, 0x61, 0x6e, 0x64, 0x62, 0x6c,
-    0x73, 0x0f, 0x47, 0x65, 0x72, 0x6d, 0x61, 0x6e, 0x64, 0x62, 0x6c, 0x73, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0d, 0x63,
-    0x79, 0x72, 0x69, 0x6c, 0x6c, 0x69, 0x63, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x41,
-    0x44, 0x06, 0x44, 0x63, 0x72, 0x6f, 0x61, 0x74, 0x04, 0x68, 0x62, 0x61, 0x72, 0x04, 0x54, 0x62, 0x61, 0x72, 0x04,
-    0x74, 0x62, 0x61, 0x72, 0x0a, 0x41, 0x72, 0x69, 0x6e, 0x67, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0a, 0x61, 0x72, 0x69,
-    0x6e, 0x67, 0x61, 0x63, 0x75, 0x74, 0x65, 0x07, 0x41, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x61, 0x6d, 0x61,
-    0x63, 0x72, 0x6f, 0x6e, 0x06, 0x41, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x61, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07,
-    0x41, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x07, 0x61, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x0b, 0x43, 0x63, 0x69,
-    0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x63, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65,
-    0x78, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x30, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x30, 0x42, 0x06, 0x44,
-    0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x64, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x07, 0x45, 0x6d, 0x61, 0x63, 0x72, 0x6f,
-    0x6e, 0x07, 0x65, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x06, 0x45, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x65, 0x62,
-    0x72, 0x65, 0x76, 0x65, 0x0a, 0x45, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0a, 0x65, 0x64, 0x6f,
-    0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x07, 0x45, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x07, 0x65, 0x6f, 0x67,
-    0x6f, 0x6e, 0x65, 0x6b, 0x06, 0x45, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x65, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x0b,
-    0x47, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x67, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d,
-    0x66, 0x6c, 0x65, 0x78, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x32, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x32,
-    0x31, 0x0c, 0x47, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0c, 0x67, 0x63, 0x6f, 0x6d,
-    0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0b, 0x48, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65,
-    0x78, 0x0b, 0x68, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x06, 0x49, 0x74, 0x69, 0x6c, 0x64,
-    0x65, 0x06, 0x69, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x07, 0x49, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x69, 0x6d,
-    0x61, 0x63, 0x72, 0x6f, 0x6e, 0x06, 0x49, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x69, 0x62, 0x72, 0x65, 0x76, 0x65,
-    0x07, 0x49, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x07, 0x69, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x0a, 0x49, 0x64,
-    0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0b, 0x4a, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65,
-    0x78, 0x0b, 0x6a, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0c, 0x4b, 0x63, 0x6f, 0x6d, 0x6d,
-    0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0c, 0x6b, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e,
-    0x74, 0x06, 0x4c, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x6c, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0c, 0x4c, 0x63, 0x6f,
-    0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0c, 0x6c, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63,
-    0x65, 0x6e, 0x74, 0x06, 0x4c, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x6c, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x04, 0x4c,
-    0x64, 0x6f, 0x74, 0x04, 0x6c, 0x64, 0x6f, 0x74, 0x06, 0x4e, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x6e, 0x61, 0x63,
-    0x75, 0x74, 0x65, 0x0c, 0x4e, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0c, 0x6e, 0x63,
-    0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x06, 0x4e, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x6e,
-    0x63, 0x61, 0x72, 0x6f, 0x6e, 0x0b, 0x6e, 0x61, 0x70, 0x6f, 0x73, 0x74, 0x72, 0x6f, 0x70, 0x68, 0x65, 0x07, 0x4f,
-    0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x6f, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x06, 0x4f, 0x62, 0x72, 0x65,
-    0x76, 0x65, 0x06, 0x6f, 0x62, 0x72, 0x65, 0x76, 0x65, 0x0d, 0x4f, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d,
-    0x6c, 0x61, 0x75, 0x74, 0x0d, 0x6f, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x06,
-    0x52, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x72, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0c, 0x52, 0x63, 0x6f, 0x6d, 0x6d,
-    0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0c, 0x72, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e,
-    0x74, 0x06, 0x52, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x72, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x53, 0x61, 0x63,
-    0x75, 0x74, 0x65, 0x06, 0x73, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0b, 0x53, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66,
-    0x6c, 0x65, 0x78, 0x0b, 0x73, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x32, 0x31, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31,
-    0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x36, 0x32, 0x0c, 0x75,
-    0x6e, 0x69, 0x30, 0x31, 0x36, 0x32, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x36, 0x33,
-    0x06, 0x54, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x74, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x55, 0x74, 0x69, 0x6c,
-    0x64, 0x65, 0x06, 0x75, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x07, 0x55, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x75,
-    0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x06, 0x55, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x75, 0x62, 0x72, 0x65, 0x76,
-    0x65, 0x05, 0x55, 0x72, 0x69, 0x6e, 0x67, 0x05, 0x75, 0x72, 0x69, 0x6e, 0x67, 0x0d, 0x55, 0x68, 0x75, 0x6e, 0x67,
-    0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x0d, 0x75, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c,
-    0x61, 0x75, 0x74, 0x07, 0x55, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x07, 0x75, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b,
-    0x0b, 0x57, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x77, 0x63, 0x69, 0x72, 0x63, 0x75,
-    0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x59, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x79,
-    0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x06, 0x5a, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x7a,
-    0x61, 0x63, 0x75, 0x74, 0x65, 0x0a, 0x5a, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0a, 0x7a, 0x64,
-    0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x07, 0x41, 0x45, 0x61, 0x63, 0x75, 0x74, 0x65, 0x07, 0x61, 0x65,
-    0x61, 0x63, 0x75, 0x74, 0x65, 0x0b, 0x4f, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0b, 0x6f,
-    0x73, 0x6c, 0x61, 0x73, 0x68, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0b, 0x44, 0x63, 0x72, 0x6f, 0x61, 0x74, 0x2e, 0x73,
-    0x6d, 0x63, 0x70, 0x08, 0x45, 0x74, 0x68, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x09, 0x54, 0x62, 0x61, 0x72, 0x2e, 0x73,
-    0x6d, 0x63, 0x70, 0x0b, 0x41, 0x67, 0x72, 0x61, 0x76, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x41, 0x61, 0x63,
-    0x75, 0x74, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x10, 0x41, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65,
-    0x78, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x41, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0e,
-    0x41, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0a, 0x41, 0x72, 0x69, 0x6e,
-    0x67, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0f, 0x41, 0x72, 0x69, 0x6e, 0x67, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2e, 0x73,
-    0x6d, 0x63, 0x70, 0x0d, 0x43, 0x63, 0x65, 0x64, 0x69, 0x6c, 0x6c, 0x61, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x45,
-    0x67, 0x72, 0x61, 0x76, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x45, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2e, 0x73,
-    0x6d, 0x63, 0x70, 0x10, 0x45, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2e, 0x73, 0x6d, 0x63,
-    0x70, 0x0e, 0x45, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x49, 0x67,
-    0x72, 0x61, 0x76, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x49, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2e, 0x73, 0x6d,
-    0x63, 0x70, 0x10, 0x49, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2e, 0x73, 0x6d, 0x63, 0x70,
-    0x0e, 0x49, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x4e, 0x74, 0x69,
-    0x6c, 0x64, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x4f, 0x67, 0x72, 0x61, 0x76, 0x65, 0x2e, 0x73, 0x6d, 0x63,
-    0x70, 0x0b, 0x4f, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x10, 0x4f, 0x63, 0x69, 0x72, 0x63,
-    0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x4f, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x2e,
-    0x73, 0x6d, 0x63, 0x70, 0x0e, 0x4f, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x2e, 0x73, 0x6d, 0x63, 0x70,
-    0x0b, 0x55, 0x67, 0x72, 0x61, 0x76, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x55, 0x61, 0x63, 0x75, 0x74, 0x65,
-    0x2e, 0x73, 0x6d, 0x63, 0x70, 0x10, 0x55, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2e, 0x73,
-    0x6d, 0x63, 0x70, 0x0e, 0x55, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b,
-    0x59, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0c, 0x41, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e,
-    0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x41, 0x62, 0x72, 0x65, 0x76, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0c, 0x41,
-    0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x43, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2e,
-    0x73, 0x6d, 0x63, 0x70, 0x10, 0x43, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2e, 0x73, 0x6d,
-    0x63, 0x70, 0x0c, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x30, 0x41, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x43, 0x63, 0x61,
-    0x72, 0x6f, 0x6e, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x44, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x2e, 0x73, 0x6d, 0x63,
-    0x70, 0x0c, 0x45, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x45, 0x62, 0x72, 0x65,
-    0x76, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0f, 0x45, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x2e,
-    0x73, 0x6d, 0x63, 0x70, 0x0c, 0x45, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x45,
-    0x63, 0x61, 0x72, 0x6f, 0x6e, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x10, 0x47, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66,
-    0x6c, 0x65, 0x78, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x47, 0x62, 0x72, 0x65, 0x76, 0x65, 0x2e, 0x73, 0x6d, 0x63,
-    0x70, 0x0c, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x32, 0x30, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x11, 0x47, 0x63, 0x6f, 0x6d,
-    0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x10, 0x48, 0x63, 0x69, 0x72, 0x63,
-    0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x49, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x2e,
-    0x73, 0x6d, 0x63, 0x70, 0x0c, 0x49, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x49,
-    0x62, 0x72, 0x65, 0x76, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0c, 0x49, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x2e,
-    0x73, 0x6d, 0x63, 0x70, 0x0f, 0x49, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x2e, 0x73, 0x6d, 0x63,
-    0x70, 0x10, 0x4a, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x11,
-    0x4b, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x4c,
-    0x61, 0x63, 0x75, 0x74, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x11, 0x4c, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63,
-    0x63, 0x65, 0x6e, 0x74, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x4c, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x2e, 0x73, 0x6d,
-    0x63, 0x70, 0x09, 0x4c, 0x64, 0x6f, 0x74, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x4e, 0x61, 0x63, 0x75, 0x74, 0x65,
-    0x2e, 0x73, 0x6d, 0x63, 0x70, 0x11, 0x4e, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x2e,
-    0x73, 0x6d, 0x63, 0x70, 0x0b, 0x4e, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0c, 0x4f, 0x6d,
-    0x61, 0x63, 0x72, 0x6f, 0x6e, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x4f, 0x62, 0x72, 0x65, 0x76, 0x65, 0x2e, 0x73,
-    0x6d, 0x63, 0x70, 0x12, 0x4f, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x2e, 0x73,
-    0x6d, 0x63, 0x70, 0x0b, 0x52, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x11, 0x52, 0x63, 0x6f,
-    0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x52, 0x63, 0x61, 0x72,
-    0x6f, 0x6e, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x53, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70,
-    0x10, 0x53, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0d, 0x53,
-    0x63, 0x65, 0x64, 0x69, 0x6c, 0x6c, 0x61, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x53, 0x63, 0x61, 0x72, 0x6f, 0x6e,
-    0x2e, 0x73, 0x6d, 0x63, 0x70, 0x11, 0x54, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x2e,
-    0x73, 0x6d, 0x63, 0x70, 0x0b, 0x54, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x55, 0x74,
-    0x69, 0x6c, 0x64, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0c, 0x55, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x2e, 0x73,
-    0x6d, 0x63, 0x70, 0x0b, 0x55, 0x62, 0x72, 0x65, 0x76, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0a, 0x55, 0x72, 0x69,
-    0x6e, 0x67, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x12, 0x55, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61,
-    0x75, 0x74, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0c, 0x55, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x2e, 0x73, 0x6d, 0x63,
-    0x70, 0x10, 0x57, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x10,
-    0x59, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0e, 0x59, 0x64,
-    0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x5a, 0x61, 0x63, 0x75, 0x74, 0x65,
-    0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0f, 0x5a, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x2e, 0x73, 0x6d,
-    0x63, 0x70, 0x0b, 0x5a, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0a, 0x41, 0x6c, 0x70, 0x68,
-    0x61, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0c, 0x45, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x74, 0x6f, 0x6e, 0x6f, 0x73,
-    0x08, 0x45, 0x74, 0x61, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x09, 0x49, 0x6f, 0x74, 0x61, 0x74, 0x6f, 0x6e, 0x6f, 0x73,
-    0x0c, 0x4f, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x6e, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0c, 0x55, 0x70, 0x73, 0x69, 0x6c,
-    0x6f, 0x6e, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0a, 0x4f, 0x6d, 0x65, 0x67, 0x61, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x11,
-    0x69, 0x6f, 0x74, 0x61, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x05, 0x41,
-    0x6c, 0x70, 0x68, 0x61, 0x04, 0x42, 0x65, 0x74, 0x61, 0x07, 0x45, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x04, 0x5a,
-    0x65, 0x74, 0x61, 0x03, 0x45, 0x74, 0x61, 0x04, 0x49, 0x6f, 0x74, 0x61, 0x05, 0x4b, 0x61, 0x70, 0x70, 0x61, 0x02,
-    0x4d, 0x75, 0x02, 0x4e, 0x75, 0x07, 0x4f, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x6e, 0x03, 0x52, 0x68, 0x6f, 0x03, 0x54,
-    0x61, 0x75, 0x07, 0x55, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x03, 0x43, 0x68, 0x69, 0x0c, 0x49, 0x6f, 0x74, 0x61,
-    0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x0f, 0x55, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x64, 0x69, 0x65,
-    0x72, 0x65, 0x73, 0x69, 0x73, 0x0a, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0c, 0x65, 0x70,
-    0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x08, 0x65, 0x74, 0x61, 0x74, 0x6f, 0x6e, 0x6f, 0x73,
-    0x09, 0x69, 0x6f, 0x74, 0x61, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x14, 0x75, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x64,
-    0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x05, 0x6b, 0x61, 0x70, 0x70, 0x61, 0x07,
-    0x6f, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x42, 0x43, 0x02, 0x6e, 0x75, 0x03,
-    0x63, 0x68, 0x69, 0x0c, 0x69, 0x6f, 0x74, 0x61, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x0f, 0x75, 0x70,
-    0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x0c, 0x6f, 0x6d, 0x69, 0x63, 0x72,
-    0x6f, 0x6e, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0c, 0x75, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x74, 0x6f, 0x6e, 0x6f,
-    0x73, 0x0a, 0x6f, 0x6d, 0x65, 0x67, 0x61, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30,
-    0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x35, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x30, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x30, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x43,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x30, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x31, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x31, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x43, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x45, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x31, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32,
-    0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x34, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x32, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x33, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x45,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x31, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x34, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x35, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x35, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x37, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x35, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35,
-    0x45, 0x06, 0x57, 0x67, 0x72, 0x61, 0x76, 0x65, 0x06, 0x77, 0x67, 0x72, 0x61, 0x76, 0x65, 0x06, 0x57, 0x61, 0x63,
-    0x75, 0x74, 0x65, 0x06, 0x77, 0x61, 0x63, 0x75, 0x74, 0x65, 0x09, 0x57, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69,
-    0x73, 0x09, 0x77, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x06, 0x59, 0x67, 0x72, 0x61, 0x76, 0x65, 0x06,
-    0x79, 0x67, 0x72, 0x61, 0x76, 0x65, 0x06, 0x6d, 0x69, 0x6e, 0x75, 0x74, 0x65, 0x06, 0x73, 0x65, 0x63, 0x6f, 0x6e,
-    0x64, 0x09, 0x65, 0x78, 0x63, 0x6c, 0x61, 0x6d, 0x64, 0x62, 0x6c, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x46, 0x30,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x42, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x33, 0x45, 0x07, 0x75, 0x6e,
-    0x69, 0x31, 0x45, 0x33, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x30, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
-    0x30, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x34, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x30, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x30, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x35, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37,
-    0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37, 0x37, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x39, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x41, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x45,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x30, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x43, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x43, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x31, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x33, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x44, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44,
-    0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x41, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x44, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x44, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x45,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x32, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x45, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x45, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x37, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x39, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x45, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45,
-    0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x45, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x45, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x46, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x33,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x35, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x46, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x46, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x31, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x35, 0x31, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x31, 0x33, 0x07, 0x75, 0x6e, 0x69,
-    0x31, 0x45, 0x41, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41,
-    0x32, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x34, 0x07, 0x75,
-    0x6e, 0x69, 0x31, 0x45, 0x41, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x31,
-    0x45, 0x41, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x39,
-    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x42, 0x07, 0x75, 0x6e,
-    0x69, 0x31, 0x45, 0x41, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
-    0x41, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x30, 0x07,
-    0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x32, 0x07, 0x75, 0x6e, 0x69,
-    0x31, 0x45, 0x42, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42,
-    0x35, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x37, 0x07, 0x75,
-    0x6e, 0x69, 0x31, 0x45, 0x42, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x31,
-    0x45, 0x42, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x43,
-    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x45, 0x07, 0x75, 0x6e,
-    0x69, 0x31, 0x45, 0x42, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
-    0x43, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x33, 0x07,
-    0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x35, 0x07, 0x75, 0x6e, 0x69,
-    0x31, 0x45, 0x43, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43,
-    0x38, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x41, 0x07, 0x75,
-    0x6e, 0x69, 0x31, 0x45, 0x43, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x31,
-    0x45, 0x43, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x46,
-    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x31, 0x07, 0x75, 0x6e,
-    0x69, 0x31, 0x45, 0x44, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
-    0x44, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x36, 0x07,
-    0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x38, 0x07, 0x75, 0x6e, 0x69,
-    0x31, 0x45, 0x44, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44,
-    0x42, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x44, 0x07, 0x75,
-    0x6e, 0x69, 0x31, 0x45, 0x44, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x31,
-    0x45, 0x45, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x32,
-    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x34, 0x07, 0x75, 0x6e,
-    0x69, 0x31, 0x45, 0x45, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
-    0x45, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x39, 0x07,
-    0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x42, 0x07, 0x75, 0x6e, 0x69,
-    0x31, 0x45, 0x45, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45,
-    0x45, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46, 0x30, 0x07, 0x75,
-    0x6e, 0x69, 0x31, 0x45, 0x46, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x31,
-    0x45, 0x46, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46, 0x37,
-    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46, 0x39, 0x06, 0x64, 0x63,
-    0x72, 0x6f, 0x61, 0x74, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x41, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39,
-    0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x32, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x41, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x41, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x33,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x37, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x43, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x46, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x36, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x45, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x42, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38,
-    0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x32, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x39, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x39, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x41,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x39, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x43, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x43, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x36, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x31, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x46, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x31,
-    0x31, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x31, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x30, 0x32, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x30, 0x30, 0x39, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x95, 0x00, 0x95, 0x05, 0xb0, 0x00, 0x00, 0x04, 0x3a, 0x00, 0x00, 0xfe, 0x60, 0x08, 0x62, 0xfd, 0xd5, 0x05,
-    0xc6, 0xff, 0xe9, 0x04, 0x50, 0xff, 0xeb, 0xfe, 0x48, 0x08, 0x62, 0xfd, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95,
-    0x00, 0x95, 0x05, 0xb0, 0x00, 0x00, 0x05, 0xb0, 0x04, 0x3a, 0xff, 0xea, 0xfe, 0x60, 0x08, 0x62, 0xfd, 0xd5, 0x05,
-    0xc6, 0xff, 0xea, 0x05, 0xc7, 0x04, 0x50, 0xff, 0xea, 0xfe, 0x60, 0x08, 0x62, 0xfd, 0xd5, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x95, 0x00, 0x95, 0x05, 0xb0, 0x00, 0x00, 0x05, 0xe2, 0x04, 0x3a, 0x00, 0x00, 0xfe, 0x60, 0x08, 0x62, 0xfd,
-    0xd5, 0x05, 0xc6, 0xff, 0xea, 0x05, 0xe2, 0x04, 0x50, 0xff, 0xea, 0xfe, 0x49, 0x08, 0x62, 0xfd, 0xd5, 0x00, 0x32,
-    0x00, 0x32, 0xb0, 0x00, 0x2c, 0x20, 0xb0, 0x00, 0x55, 0x58, 0x45, 0x59, 0x20, 0x20, 0x4b, 0xb8, 0x00, 0x0e, 0x51,
-    0x4b, 0xb0, 0x06, 0x53, 0x5a, 0x58, 0xb0, 0x34, 0x1b, 0xb0, 0x28, 0x59, 0x60, 0x66, 0x20, 0x8a, 0x55, 0x58, 0xb0,
-    0x02, 0x25, 0x61, 0xb9, 0x08, 0x00, 0x08, 0x00, 0x63, 0x63, 0x23, 0x62, 0x1b, 0x21, 0x21, 0xb0, 0x00, 0x59, 0xb0,
-    0x00, 0x43, 0x23, 0x44, 0xb2, 0x00, 0x01, 0x00, 0x43, 0x60, 0x42, 0x2d, 0xb0, 0x01, 0x2c, 0xb0, 0x20, 0x60, 0x66,
-    0x2d, 0xb0, 0x02, 0x2c, 0x20, 0x64, 0x20, 0xb0, 0xc0, 0x50, 0xb0, 0x04, 0x26, 0x5a, 0xb2, 0x28, 0x01, 0x0a, 0x43,
-    0x45, 0x63, 0x45, 0x52, 0x5b, 0x58, 0x21, 0x23, 0x21, 0x1b, 0x8a, 0x58, 0x20, 0xb0, 0x50, 0x50, 0x58, 0x21, 0xb0,
-    0x40, 0x59, 0x1b, 0x20, 0xb0, 0x38, 0x50, 0x58, 0x21, 0xb0, 0x38, 0x59, 0x59, 0x20, 0xb1, 0x01, 0x0a, 0x43, 0x45,
-    0x63, 0x45, 0x61, 0x64, 0xb0, 0x28, 0x50, 0x58, 0x21, 0xb1, 0x01, 0x0a, 0x43, 0x45, 0x63, 0x45, 0x20, 0xb0, 0x30,
-    0x50, 0x58, 0x21, 0xb0, 0x30, 0x59, 0x1b, 0x20, 0xb0, 0xc0, 0x50, 0x58, 0x20, 0x66, 0x20, 0x8a, 0x8a, 0x61, 0x20,
-    0xb0, 0x0a, 0x50, 0x58, 0x60, 0x1b, 0x20, 0xb0, 0x20, 0x50, 0x58, 0x21, 0xb0, 0x0a, 0x60, 0x1b, 0x20, 0xb0, 0x36,
-    0x50, 0x58, 0x21, 0xb0, 0x36, 0x60, 0x1b, 0x60, 0x59, 0x59, 0x59, 0x1b, 0xb0, 0x01, 0x2b, 0x59, 0x59, 0x23, 0xb0,
-    0x00, 0x50, 0x58, 0x65, 0x59, 0x59, 0x2d, 0xb0, 0x03, 0x2c, 0x20, 0x45, 0x20, 0xb0, 0x04, 0x25, 0x61, 0x64, 0x20,
-    0xb0, 0x05, 0x43, 0x50, 0x58, 0xb0, 0x05, 0x23, 0x42, 0xb0, 0x06, 0x23, 0x42, 0x1b, 0x21, 0x21, 0x59, 0xb0, 0x01,
-    0x60, 0x2d, 0xb0, 0x04, 0x2c, 0x23, 0x21, 0x23, 0x21, 0x20, 0x64, 0xb1, 0x05, 0x62, 0x42, 0x20, 0xb0, 0x06, 0x23,
-    0x42, 0xb1, 0x01, 0x0a, 0x43, 0x45, 0x63, 0xb1, 0x01, 0x0a, 0x43, 0xb0, 0x04, 0x60, 0x45, 0x63, 0xb0, 0x03, 0x2a,
-    0x21, 0x20, 0xb0, 0x06, 0x43, 0x20, 0x8a, 0x20, 0x8a, 0xb0, 0x01, 0x2b, 0xb1, 0x30, 0x05, 0x25, 0xb0, 0x04, 0x26,
-    0x51, 0x58, 0x60, 0x50, 0x1b, 0x61, 0x52, 0x59, 0x58, 0x23, 0x59, 0x21, 0x20, 0xb0, 0x40, 0x53, 0x58, 0xb0, 0x01,
-    0x2b, 0x1b, 0x21, 0xb0, 0x40, 0x59, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59, 0x2d, 0xb0, 0x05, 0x2c, 0xb0, 0x07,
-    0x43, 0x2b, 0xb2, 0x00, 0x02, 0x00, 0x43, 0x60, 0x42, 0x2d, 0xb0, 0x06, 0x2c, 0xb0, 0x07, 0x23, 0x42, 0x23, 0x20,
-    0xb0, 0x00, 0x23, 0x42, 0x61, 0xb0, 0x02, 0x62, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x01, 0x60, 0xb0, 0x05, 0x2a, 0x2d,
-    0xb0, 0x07, 0x2c, 0x20, 0x20, 0x45, 0x20, 0xb0, 0x0b, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50,
-    0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x08, 0x2c, 0xb2,
-    0x07, 0x0b, 0x00, 0x43, 0x45, 0x42, 0x2a, 0x21, 0xb2, 0x00, 0x01, 0x00, 0x43, 0x60, 0x42, 0x2d, 0xb0, 0x09, 0x2c,
-    0xb0, 0x00, 0x43, 0x23, 0x44, 0xb2, 0x00, 0x01, 0x00, 0x43, 0x60, 0x42, 0x2d, 0xb0, 0x0a, 0x2c, 0x20, 0x20, 0x45,
-    0x20, 0xb0, 0x01, 0x2b, 0x23, 0xb0, 0x00, 0x43, 0xb0, 0x04, 0x25, 0x60, 0x20, 0x45, 0x8a, 0x23, 0x61, 0x20, 0x64,
-    0x20, 0xb0, 0x20, 0x50, 0x58, 0x21, 0xb0, 0x00, 0x1b, 0xb0, 0x30, 0x50, 0x58, 0xb0, 0x20, 0x1b, 0xb0, 0x40, 0x59,
-    0x59, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59, 0xb0, 0x03, 0x25, 0x23, 0x61, 0x44, 0x44, 0xb0, 0x01, 0x60, 0x2d,
-    0xb0, 0x0b, 0x2c, 0x20, 0x20, 0x45, 0x20, 0xb0, 0x01, 0x2b, 0x23, 0xb0, 0x00, 0x43, 0xb0, 0x04, 0x25, 0x60, 0x20,
-    0x45, 0x8a, 0x23, 0x61, 0x20, 0x64, 0xb0, 0x24, 0x50, 0x58, 0xb0, 0x00, 0x1b, 0xb0, 0x40, 0x59, 0x23, 0xb0, 0x00,
-    0x50, 0x58, 0x65, 0x59, 0xb0, 0x03, 0x25, 0x23, 0x61, 0x44, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x0c, 0x2c, 0x20,
-    0xb0, 0x00, 0x23, 0x42, 0xb2, 0x0b, 0x0a, 0x03, 0x45, 0x58, 0x21, 0x1b, 0x23, 0x21, 0x59, 0x2a, 0x21, 0x2d, 0xb0,
-    0x0d, 0x2c, 0xb1, 0x02, 0x02, 0x45, 0xb0, 0x64, 0x61, 0x44, 0x2d, 0xb0, 0x0e, 0x2c, 0xb0, 0x01, 0x60, 0x20, 0x20,
-    0xb0, 0x0c, 0x43, 0x4a, 0xb0, 0x00, 0x50, 0x58, 0x20, 0xb0, 0x0c, 0x23, 0x42, 0x59, 0xb0, 0x0d, 0x43, 0x4a, 0xb0,
-    0x00, 0x52, 0x58, 0x20, 0xb0, 0x0d, 0x23, 0x42, 0x59, 0x2d, 0xb0, 0x0f, 0x2c, 0x20, 0xb0, 0x10, 0x62, 0x66, 0xb0,
-    0x01, 0x63, 0x20, 0xb8, 0x04, 0x00, 0x63, 0x8a, 0x23, 0x61, 0xb0, 0x0e, 0x43, 0x60, 0x20, 0x8a, 0x60, 0x20, 0xb0,
-    0x0e, 0x23, 0x42, 0x23, 0x2d, 0xb0, 0x10, 0x2c, 0x4b, 0x54, 0x58, 0xb1, 0x04, 0x64, 0x44, 0x59, 0x24, 0xb0, 0x0d,
-    0x65, 0x23, 0x78, 0x2d, 0xb0, 0x11, 0x2c, 0x4b, 0x51, 0x58, 0x4b, 0x53, 0x58, 0xb1, 0x04, 0x64, 0x44, 0x59, 0x1b,
-    0x21, 0x59, 0x24, 0xb0, 0x13, 0x65, 0x23, 0x78, 0x2d, 0xb0, 0x12, 0x2c, 0xb1, 0x00, 0x0f, 0x43, 0x55, 0x58, 0xb1,
-    0x0f, 0x0f, 0x43, 0xb0, 0x01, 0x61, 0x42, 0xb0, 0x0f, 0x2b, 0x59, 0xb0, 0x00, 0x43, 0xb0, 0x02, 0x25, 0x42, 0xb1,
-    0x0c, 0x02, 0x25, 0x42, 0xb1, 0x0d, 0x02, 0x25, 0x42, 0xb0, 0x01, 0x16, 0x23, 0x20, 0xb0, 0x03, 0x25, 0x50, 0x58,
-    0xb1, 0x01, 0x00, 0x43, 0x60, 0xb0, 0x04, 0x25, 0x42, 0x8a, 0x8a, 0x20, 0x8a, 0x23, 0x61, 0xb0, 0x0e, 0x2a, 0x21,
-    0x23, 0xb0, 0x01, 0x61, 0x20, 0x8a, 0x23, 0x61, 0xb0, 0x0e, 0x2a, 0x21, 0x1b, 0xb1, 0x01, 0x00, 0x43, 0x60, 0xb0,
-    0x02, 0x25, 0x42, 0xb0, 0x02, 0x25, 0x61, 0xb0, 0x0e, 0x2a, 0x21, 0x59, 0xb0, 0x0c, 0x43, 0x47, 0xb0, 0x0d, 0x43,
-    0x47, 0x60, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x20,
-    0xb0, 0x0b, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0,
-    0x01, 0x63, 0x60, 0xb1, 0x00, 0x00, 0x13, 0x23, 0x44, 0xb0, 0x01, 0x43, 0xb0, 0x00, 0x3e, 0xb2, 0x01, 0x01, 0x01,
-    0x43, 0x60, 0x42, 0x2d, 0xb0, 0x13, 0x2c, 0x00, 0xb1, 0x00, 0x02, 0x45, 0x54, 0x58, 0xb0, 0x0f, 0x23, 0x42, 0x20,
-    0x45, 0xb0, 0x0b, 0x23, 0x42, 0xb0, 0x0a, 0x23, 0xb0, 0x04, 0x60, 0x42, 0x20, 0x60, 0xb0, 0x01, 0x61, 0xb5, 0x10,
-    0x10, 0x01, 0x00, 0x0e, 0x00, 0x42, 0x42, 0x8a, 0x60, 0xb1, 0x12, 0x06, 0x2b, 0xb0, 0x75, 0x2b, 0x1b, 0x22, 0x59,
-    0x2d, 0xb0, 0x14, 0x2c, 0xb1, 0x00, 0x13, 0x2b, 0x2d, 0xb0, 0x15, 0x2c, 0xb1, 0x01, 0x13, 0x2b, 0x2d, 0xb0, 0x16,
-    0x2c, 0xb1, 0x02, 0x13, 0x2b, 0x2d, 0xb0, 0x17, 0x2c, 0xb1, 0x03, 0x13, 0x2b, 0x2d, 0xb0, 0x18, 0x2c, 0xb1, 0x04,
-    0x13, 0x2b, 0x2d, 0xb0, 0x19, 0x2c, 0xb1, 0x05, 0x13, 0x2b, 0x2d, 0xb0, 0x1a, 0x2c, 0xb1, 0x06, 0x13, 0x2b, 0x2d,
-    0xb0, 0x1b, 0x2c, 0xb1, 0x07, 0x13, 0x2b, 0x2d, 0xb0, 0x1c, 0x2c, 0xb1, 0x08, 0x13, 0x2b, 0x2d, 0xb0, 0x1d, 0x2c,
-    0xb1, 0x09, 0x13, 0x2b, 0x2d, 0xb0, 0x29, 0x2c, 0x20, 0x2e, 0xb0, 0x01, 0x5d, 0x2d, 0xb0, 0x2a, 0x2c, 0x20, 0x2e,
-    0xb0, 0x01, 0x71, 0x2d, 0xb0, 0x2b, 0x2c, 0x20, 0x2e, 0xb0, 0x01, 0x72, 0x2d, 0xb0, 0x1e, 0x2c, 0x00, 0xb0, 0x0d,
-    0x2b, 0xb1, 0x00, 0x02, 0x45, 0x54, 0x58, 0xb0, 0x0f, 0x23, 0x42, 0x20, 0x45, 0xb0, 0x0b, 0x23, 0x42, 0xb0, 0x0a,
-    0x23, 0xb0, 0x04, 0x60, 0x42, 0x20, 0x60, 0xb0, 0x01, 0x61, 0xb5, 0x10, 0x10, 0x01, 0x00, 0x0e, 0x00, 0x42, 0x42,
-    0x8a, 0x60, 0xb1, 0x12, 0x06, 0x2b, 0xb0, 0x75, 0x2b, 0x1b, 0x22, 0x59, 0x2d, 0xb0, 0x1f, 0x2c, 0xb1, 0x00, 0x1e,
-    0x2b, 0x2d, 0xb0, 0x20, 0x2c, 0xb1, 0x01, 0x1e, 0x2b, 0x2d, 0xb0, 0x21, 0x2c, 0xb1, 0x02, 0x1e, 0x2b, 0x2d, 0xb0,
-    0x22, 0x2c, 0xb1, 0x03, 0x1e, 0x2b, 0x2d, 0xb0, 0x23, 0x2c, 0xb1, 0x04, 0x1e, 0x2b, 0x2d, 0xb0, 0x24, 0x2c, 0xb1,
-    0x05, 0x1e, 0x2b, 0x2d, 0xb0, 0x25, 0x2c, 0xb1, 0x06, 0x1e, 0x2b, 0x2d, 0xb0, 0x26, 0x2c, 0xb1, 0x07, 0x1e, 0x2b,
-    0x2d, 0xb0, 0x27, 0x2c, 0xb1, 0x08, 0x1e, 0x2b, 0x2d, 0xb0, 0x28, 0x2c, 0xb1, 0x09, 0x1e, 0x2b, 0x2d, 0xb0, 0x2c,
-    0x2c, 0x20, 0x3c, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x2d, 0x2c, 0x20, 0x60, 0xb0, 0x10, 0x60, 0x20, 0x43, 0x23, 0xb0,
-    0x01, 0x60, 0x43, 0xb0, 0x02, 0x25, 0x61, 0xb0, 0x01, 0x60, 0xb0, 0x2c, 0x2a, 0x21, 0x2d, 0xb0, 0x2e, 0x2c, 0xb0,
-    0x2d, 0x2b, 0xb0, 0x2d, 0x2a, 0x2d, 0xb0, 0x2f, 0x2c, 0x20, 0x20, 0x47, 0x20, 0x20, 0xb0, 0x0b, 0x43, 0x63, 0xb8,
-    0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x23, 0x61,
-    0x38, 0x23, 0x20, 0x8a, 0x55, 0x58, 0x20, 0x47, 0x20, 0x20, 0xb0, 0x0b, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20,
-    0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x23, 0x61, 0x38, 0x1b, 0x21, 0x59,
-    0x2d, 0xb0, 0x30, 0x2c, 0x00, 0xb1, 0x00, 0x02, 0x45, 0x54, 0x58, 0xb0, 0x01, 0x16, 0xb0, 0x2f, 0x2a, 0xb1, 0x05,
-    0x01, 0x15, 0x45, 0x58, 0x30, 0x59, 0x1b, 0x22, 0x59, 0x2d, 0xb0, 0x31, 0x2c, 0x00, 0xb0, 0x0d, 0x2b, 0xb1, 0x00,
-    0x02, 0x45, 0x54, 0x58, 0xb0, 0x01, 0x16, 0xb0, 0x2f, 0x2a, 0xb1, 0x05, 0x01, 0x15, 0x45, 0x58, 0x30, 0x59, 0x1b,
-    0x22, 0x59, 0x2d, 0xb0, 0x32, 0x2c, 0x20, 0x35, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x33, 0x2c, 0x00, 0xb0, 0x01, 0x45,
-    0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0xb0,
-    0x01, 0x2b, 0xb0, 0x0b, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59,
-    0x66, 0xb0, 0x01, 0x63, 0xb0, 0x01, 0x2b, 0xb0, 0x00, 0x16, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x3e, 0x23,
-    0x38, 0xb1, 0x32, 0x01, 0x15, 0x2a, 0x2d, 0xb0, 0x34, 0x2c, 0x20, 0x3c, 0x20, 0x47, 0x20, 0xb0, 0x0b, 0x43, 0x63,
-    0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0xb0,
-    0x00, 0x43, 0x61, 0x38, 0x2d, 0xb0, 0x35, 0x2c, 0x2e, 0x17, 0x3c, 0x2d, 0xb0, 0x36, 0x2c, 0x20, 0x3c, 0x20, 0x47,
-    0x20, 0xb0, 0x0b, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66,
-    0xb0, 0x01, 0x63, 0x60, 0xb0, 0x00, 0x43, 0x61, 0xb0, 0x01, 0x43, 0x63, 0x38, 0x2d, 0xb0, 0x37, 0x2c, 0xb1, 0x02,
-    0x00, 0x16, 0x25, 0x20, 0x2e, 0x20, 0x47, 0xb0, 0x00, 0x23, 0x42, 0xb0, 0x02, 0x25, 0x49, 0x8a, 0x8a, 0x47, 0x23,
-    0x47, 0x23, 0x61, 0x20, 0x58, 0x62, 0x1b, 0x21, 0x59, 0xb0, 0x01, 0x23, 0x42, 0xb2, 0x36, 0x01, 0x01, 0x15, 0x14,
-    0x2a, 0x2d, 0xb0, 0x38, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0x47, 0x23, 0x47, 0x23, 0x61,
-    0xb0, 0x09, 0x43, 0x2b, 0x65, 0x8a, 0x2e, 0x23, 0x20, 0x20, 0x3c, 0x8a, 0x38, 0x2d, 0xb0, 0x39, 0x2c, 0xb0, 0x00,
-    0x16, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0x20, 0xb0, 0x04, 0x23, 0x42,
-    0xb0, 0x09, 0x43, 0x2b, 0x20, 0xb0, 0x60, 0x50, 0x58, 0x20, 0xb0, 0x40, 0x51, 0x58, 0xb3, 0x02, 0x20, 0x03, 0x20,
-    0x1b, 0xb3, 0x02, 0x26, 0x03, 0x1a, 0x59, 0x42, 0x42, 0x23, 0x20, 0xb0, 0x08, 0x43, 0x20, 0x8a, 0x23, 0x47, 0x23,
-    0x47, 0x23, 0x61, 0x23, 0x46, 0x60, 0xb0, 0x04, 0x43, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40,
-    0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x20, 0xb0, 0x01, 0x2b, 0x20, 0x8a, 0x8a, 0x61, 0x20, 0xb0, 0x02, 0x43,
-    0x60, 0x64, 0x23, 0xb0, 0x03, 0x43, 0x61, 0x64, 0x50, 0x58, 0xb0, 0x02, 0x43, 0x61, 0x1b, 0xb0, 0x03, 0x43, 0x60,
-    0x59, 0xb0, 0x03, 0x25, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01,
-    0x63, 0x61, 0x23, 0x20, 0x20, 0xb0, 0x04, 0x26, 0x23, 0x46, 0x61, 0x38, 0x1b, 0x23, 0xb0, 0x08, 0x43, 0x46, 0xb0,
-    0x02, 0x25, 0xb0, 0x08, 0x43, 0x47, 0x23, 0x47, 0x23, 0x61, 0x60, 0x20, 0xb0, 0x04, 0x43, 0xb0, 0x02, 0x62, 0x20,
-    0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x23, 0x20, 0xb0, 0x01, 0x2b, 0x23,
-    0xb0, 0x04, 0x43, 0x60, 0xb0, 0x01, 0x2b, 0xb0, 0x05, 0x25, 0x61, 0xb0, 0x05, 0x25, 0xb0, 0x02, 0x62, 0x20, 0xb0,
-    0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x04, 0x26, 0x61, 0x20, 0xb0, 0x04, 0x25,
-    0x60, 0x64, 0x23, 0xb0, 0x03, 0x25, 0x60, 0x64, 0x50, 0x58, 0x21, 0x1b, 0x23, 0x21, 0x59, 0x23, 0x20, 0x20, 0xb0,
-    0x04, 0x26, 0x23, 0x46, 0x61, 0x38, 0x59, 0x2d, 0xb0, 0x3a, 0x2c, 0xb0, 0x00, 0x16, 0x20, 0x20, 0x20, 0xb0, 0x05,
-    0x26, 0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0x23, 0x3c, 0x38, 0x2d, 0xb0, 0x3b, 0x2c, 0xb0, 0x00, 0x16, 0x20,
-    0xb0, 0x08, 0x23, 0x42, 0x20, 0x20, 0x20, 0x46, 0x23, 0x47, 0xb0, 0x01, 0x2b, 0x23, 0x61, 0x38, 0x2d, 0xb0, 0x3c,
-    0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x03, 0x25, 0xb0, 0x02, 0x25, 0x47, 0x23, 0x47, 0x23, 0x61, 0xb0, 0x00, 0x54, 0x58,
-    0x2e, 0x20, 0x3c, 0x23, 0x21, 0x1b, 0xb0, 0x02, 0x25, 0xb0, 0x02, 0x25, 0x47, 0x23, 0x47, 0x23, 0x61, 0x20, 0xb0,
-    0x05, 0x25, 0xb0, 0x04, 0x25, 0x47, 0x23, 0x47, 0x23, 0x61, 0xb0, 0x06, 0x25, 0xb0, 0x05, 0x25, 0x49, 0xb0, 0x02,
-    0x25, 0x61, 0xb9, 0x08, 0x00, 0x08, 0x00, 0x63, 0x63, 0x23, 0x20, 0x58, 0x62, 0x1b, 0x21, 0x59, 0x63, 0xb8, 0x04,
-    0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x23, 0x2e, 0x23,
-    0x20, 0x20, 0x3c, 0x8a, 0x38, 0x23, 0x21, 0x59, 0x2d, 0xb0, 0x3d, 0x2c, 0xb0, 0x00, 0x16, 0x20, 0xb0, 0x08, 0x43,
-    0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0x20, 0x60, 0xb0, 0x20, 0x60, 0x66, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00,
-    0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x23, 0x20, 0x20, 0x3c, 0x8a, 0x38, 0x2d, 0xb0, 0x3e,
-    0x2c, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0x52, 0x58, 0x20, 0x3c, 0x59, 0x2e, 0xb1, 0x2e, 0x01, 0x14,
-    0x2b, 0x2d, 0xb0, 0x3f, 0x2c, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0x50, 0x58, 0x20, 0x3c, 0x59, 0x2e,
-    0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x40, 0x2c, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0x52, 0x58,
-    0x20, 0x3c, 0x59, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0x50, 0x58, 0x20, 0x3c, 0x59, 0x2e, 0xb1, 0x2e,
-    0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x41, 0x2c, 0xb0, 0x38, 0x2b, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0x52,
-    0x58, 0x20, 0x3c, 0x59, 0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x42, 0x2c, 0xb0, 0x39, 0x2b, 0x8a, 0x20,
-    0x20, 0x3c, 0xb0, 0x04, 0x23, 0x42, 0x8a, 0x38, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0x52, 0x58, 0x20,
-    0x3c, 0x59, 0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0xb0, 0x04, 0x43, 0x2e, 0xb0, 0x2e, 0x2b, 0x2d, 0xb0, 0x43, 0x2c,
-    0xb0, 0x00, 0x16, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x26, 0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0xb0, 0x09, 0x43,
-    0x2b, 0x23, 0x20, 0x3c, 0x20, 0x2e, 0x23, 0x38, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x44, 0x2c, 0xb1, 0x08,
-    0x04, 0x25, 0x42, 0xb0, 0x00, 0x16, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61,
-    0x20, 0xb0, 0x04, 0x23, 0x42, 0xb0, 0x09, 0x43, 0x2b, 0x20, 0xb0, 0x60, 0x50, 0x58, 0x20, 0xb0, 0x40, 0x51, 0x58,
-    0xb3, 0x02, 0x20, 0x03, 0x20, 0x1b, 0xb3, 0x02, 0x26, 0x03, 0x1a, 0x59, 0x42, 0x42, 0x23, 0x20, 0x47, 0xb0, 0x04,
-    0x43, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x20,
-    0xb0, 0x01, 0x2b, 0x20, 0x8a, 0x8a, 0x61, 0x20, 0xb0, 0x02, 0x43, 0x60, 0x64, 0x23, 0xb0, 0x03, 0x43, 0x61, 0x64,
-    0x50, 0x58, 0xb0, 0x02, 0x43, 0x61, 0x1b, 0xb0, 0x03, 0x43, 0x60, 0x59, 0xb0, 0x03, 0x25, 0xb0, 0x02, 0x62, 0x20,
-    0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x61, 0xb0, 0x02, 0x25, 0x46, 0x61, 0x38,
-    0x23, 0x20, 0x3c, 0x23, 0x38, 0x1b, 0x21, 0x20, 0x20, 0x46, 0x23, 0x47, 0xb0, 0x01, 0x2b, 0x23, 0x61, 0x38, 0x21,
-    0x59, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x45, 0x2c, 0xb0, 0x38, 0x2b, 0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b,
-    0x2d, 0xb0, 0x46, 0x2c, 0xb0, 0x39, 0x2b, 0x21, 0x23, 0x20, 0x20, 0x3c, 0xb0, 0x04, 0x23, 0x42, 0x23, 0x38, 0xb1,
-    0x2e, 0x01, 0x14, 0x2b, 0xb0, 0x04, 0x43, 0x2e, 0xb0, 0x2e, 0x2b, 0x2d, 0xb0, 0x47, 0x2c, 0xb0, 0x00, 0x15, 0x20,
-    0x47, 0xb0, 0x00, 0x23, 0x42, 0xb2, 0x00, 0x01, 0x01, 0x15, 0x14, 0x13, 0x2e, 0xb0, 0x34, 0x2a, 0x2d, 0xb0, 0x48,
-    0x2c, 0xb0, 0x00, 0x15, 0x20, 0x47, 0xb0, 0x00, 0x23, 0x42, 0xb2, 0x00, 0x01, 0x01, 0x15, 0x14, 0x13, 0x2e, 0xb0,
-    0x34, 0x2a, 0x2d, 0xb0, 0x49, 0x2c, 0xb1, 0x00, 0x01, 0x14, 0x13, 0xb0, 0x35, 0x2a, 0x2d, 0xb0, 0x4a, 0x2c, 0xb0,
-    0x37, 0x2a, 0x2d, 0xb0, 0x4b, 0x2c, 0xb0, 0x00, 0x16, 0x45, 0x23, 0x20, 0x2e, 0x20, 0x46, 0x8a, 0x23, 0x61, 0x38,
-    0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x4c, 0x2c, 0xb0, 0x08, 0x23, 0x42, 0xb0, 0x4b, 0x2b, 0x2d, 0xb0, 0x4d,
-    0x2c, 0xb2, 0x00, 0x00, 0x44, 0x2b, 0x2d, 0xb0, 0x4e, 0x2c, 0xb2, 0x00, 0x01, 0x44, 0x2b, 0x2d, 0xb0, 0x4f, 0x2c,
-    0xb2, 0x01, 0x00, 0x44, 0x2b, 0x2d, 0xb0, 0x50, 0x2c, 0xb2, 0x01, 0x01, 0x44, 0x2b, 0x2d, 0xb0, 0x51, 0x2c, 0xb2,
-    0x00, 0x00, 0x45, 0x2b, 0x2d, 0xb0, 0x52, 0x2c, 0xb2, 0x00, 0x01, 0x45, 0x2b, 0x2d, 0xb0, 0x53, 0x2c, 0xb2, 0x01,
-    0x00, 0x45, 0x2b, 0x2d, 0xb0, 0x54, 0x2c, 0xb2, 0x01, 0x01, 0x45, 0x2b, 0x2d, 0xb0, 0x55, 0x2c, 0xb2, 0x00, 0x00,
-    0x41, 0x2b, 0x2d, 0xb0, 0x56, 0x2c, 0xb2, 0x00, 0x01, 0x41, 0x2b, 0x2d, 0xb0, 0x57, 0x2c, 0xb2, 0x01, 0x00, 0x41,
-    0x2b, 0x2d, 0xb0, 0x58, 0x2c, 0xb2, 0x01, 0x01, 0x41, 0x2b, 0x2d, 0xb0, 0x59, 0x2c, 0xb2, 0x00, 0x00, 0x43, 0x2b,
-    0x2d, 0xb0, 0x5a, 0x2c, 0xb2, 0x00, 0x01, 0x43, 0x2b, 0x2d, 0xb0, 0x5b, 0x2c, 0xb2, 0x01, 0x00, 0x43, 0x2b, 0x2d,
-    0xb0, 0x5c, 0x2c, 0xb2, 0x01, 0x01, 0x43, 0x2b, 0x2d, 0xb0, 0x5d, 0x2c, 0xb2, 0x00, 0x00, 0x46, 0x2b, 0x2d, 0xb0,
-    0x5e, 0x2c, 0xb2, 0x00, 0x01, 0x46, 0x2b, 0x2d, 0xb0, 0x5f, 0x2c, 0xb2, 0x01, 0x00, 0x46, 0x2b, 0x2d, 0xb0, 0x60,
-    0x2c, 0xb2, 0x01, 0x01, 0x46, 0x2b, 0x2d, 0xb0, 0x61, 0x2c, 0xb2, 0x00, 0x00, 0x42, 0x2b, 0x2d, 0xb0, 0x62, 0x2c,
-    0xb2, 0x00, 0x01, 0x42, 0x2b, 0x2d, 0xb0, 0x63, 0x2c, 0xb2, 0x01, 0x00, 0x42, 0x2b, 0x2d, 0xb0, 0x64, 0x2c, 0xb2,
-    0x01, 0x01, 0x42, 0x2b, 0x2d, 0xb0, 0x65, 0x2c, 0xb0, 0x3a, 0x2b, 0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0,
-    0x66, 0x2c, 0xb0, 0x3a, 0x2b, 0xb0, 0x3e, 0x2b, 0x2d, 0xb0, 0x67, 0x2c, 0xb0, 0x3a, 0x2b, 0xb0, 0x3f, 0x2b, 0x2d,
-    0xb0, 0x68, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x3a, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x69, 0x2c, 0xb0, 0x3b, 0x2b,
-    0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x6a, 0x2c, 0xb0, 0x3b, 0x2b, 0xb0, 0x3e, 0x2b, 0x2d, 0xb0, 0x6b,
-    0x2c, 0xb0, 0x3b, 0x2b, 0xb0, 0x3f, 0x2b, 0x2d, 0xb0, 0x6c, 0x2c, 0xb0, 0x3b, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0,
-    0x6d, 0x2c, 0xb0, 0x3c, 0x2b, 0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x6e, 0x2c, 0xb0, 0x3c, 0x2b, 0xb0,
-    0x3e, 0x2b, 0x2d, 0xb0, 0x6f, 0x2c, 0xb0, 0x3c, 0x2b, 0xb0, 0x3f, 0x2b, 0x2d, 0xb0, 0x70, 0x2c, 0xb0, 0x3c, 0x2b,
-    0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x71, 0x2c, 0xb0, 0x3d, 0x2b, 0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x72,
-    0x2c, 0xb0, 0x3d, 0x2b, 0xb0, 0x3e, 0x2b, 0x2d, 0xb0, 0x73, 0x2c, 0xb0, 0x3d, 0x2b, 0xb0, 0x3f, 0x2b, 0x2d, 0xb0,
-    0x74, 0x2c, 0xb0, 0x3d, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x75, 0x2c, 0xb3, 0x09, 0x04, 0x02, 0x03, 0x45, 0x58,
-    0x21, 0x1b, 0x23, 0x21, 0x59, 0x42, 0x2b, 0xb0, 0x08, 0x65, 0xb0, 0x03, 0x24, 0x50, 0x78, 0xb1, 0x05, 0x01, 0x15,
-    0x45, 0x58, 0x30, 0x59, 0x2d, 0x00, 0x00, 0x4b, 0xb8, 0x00, 0xc8, 0x52, 0x58, 0xb1, 0x01, 0x01, 0x8e, 0x59, 0xb0,
-    0x01, 0xb9, 0x08, 0x00, 0x08, 0x00, 0x63, 0x70, 0xb1, 0x00, 0x06, 0x42, 0xb5, 0x00, 0x47, 0x33, 0x1f, 0x04, 0x00,
-    0x2a, 0xb1, 0x00, 0x06, 0x42, 0x40, 0x0a, 0x4d, 0x01, 0x3a, 0x08, 0x26, 0x08, 0x14, 0x07, 0x04, 0x08, 0x2a, 0xb1,
-    0x00, 0x06, 0x42, 0x40, 0x0a, 0x4e, 0x00, 0x44, 0x06, 0x30, 0x06, 0x1d, 0x05, 0x04, 0x08, 0x2a, 0xb1, 0x00, 0x0a,
-    0x42, 0xbd, 0x13, 0x80, 0x0e, 0xc0, 0x09, 0xc0, 0x05, 0x40, 0x00, 0x04, 0x00, 0x09, 0x2a, 0xb1, 0x00, 0x0e, 0x42,
-    0xbd, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x04, 0x00, 0x09, 0x2a, 0xb1, 0x03, 0x00, 0x44, 0xb1,
-    0x24, 0x01, 0x88, 0x51, 0x58, 0xb0, 0x40, 0x88, 0x58, 0xb1, 0x03, 0x64, 0x44, 0xb1, 0x26, 0x01, 0x88, 0x51, 0x58,
-    0xba, 0x08, 0x80, 0x00, 0x01, 0x04, 0x40, 0x88, 0x63, 0x54, 0x58, 0xb1, 0x03, 0x00, 0x44, 0x59, 0x59, 0x59, 0x59,
-    0x40, 0x0a, 0x4e, 0x00, 0x3c, 0x08, 0x28, 0x08, 0x16, 0x07, 0x04, 0x0c, 0x2a, 0xb8, 0x01, 0xff, 0x85, 0xb0, 0x04,
-    0x8d, 0xb1, 0x02, 0x00, 0x44, 0xb1, 0x05, 0x64, 0x44, 0x00, 0x00};
-unsigned int RobotoMono_Italic_ttf_len = 120832;
@@ -1,6037 +0,0 @@
-#include "imfonts.h"
-
-unsigned char RobotoMono_Regular_ttf[] = {
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x47, 0x44, 0x45, 0x46, 0x0b, 0x31, 0x0b,
-    0x32, 0x00, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x40, 0x47, 0x53, 0x55, 0x42, 0xe6, 0x11, 0xdf, 0x13, 0x00, 0x00,
-    0x01, 0x4c, 0x00, 0x00, 0x02, 0x48, 0x4f, 0x53, 0x2f, 0x32, 0xba, 0xd5, 0xea, 0x96, 0x00, 0x00, 0x03, 0x94, 0x00,
-    0x00, 0x00, 0x60, 0x63, 0x6d, 0x61, 0x70, 0x53, 0xe7, 0xa2, 0x2f, 0x00, 0x00, 0x03, 0xf4, 0x00, 0x00, 0x08, 0x6a,
-    0x63, 0x76, 0x74, 0x20, 0x61, 0xf2, 0x14, 0x5d, 0x00, 0x01, 0xb2, 0xdc, 0x00, 0x00, 0x00, 0x9c, 0x66, 0x70, 0x67,
-    0x6d, 0xe1, 0x14, 0xdb, 0xf0, 0x00, 0x01, 0xb3, 0x78, 0x00, 0x00, 0x0b, 0x97, 0x67, 0x61, 0x73, 0x70, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x01, 0xb2, 0xd4, 0x00, 0x00, 0x00, 0x08, 0x67, 0x6c, 0x79, 0x66, 0x3f, 0x34, 0x05, 0x0e, 0x00,
-    0x00, 0x0c, 0x60, 0x00, 0x01, 0x66, 0xbc, 0x68, 0x65, 0x61, 0x64, 0xf9, 0x31, 0x10, 0x10, 0x00, 0x01, 0x73, 0x1c,
-    0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61, 0x0c, 0x03, 0x03, 0xe2, 0x00, 0x01, 0x73, 0x54, 0x00, 0x00, 0x00,
-    0x24, 0x68, 0x6d, 0x74, 0x78, 0x1d, 0xca, 0x38, 0x5b, 0x00, 0x01, 0x73, 0x78, 0x00, 0x00, 0x10, 0x22, 0x6c, 0x6f,
-    0x63, 0x61, 0xe1, 0xf5, 0x39, 0xf2, 0x00, 0x01, 0x83, 0x9c, 0x00, 0x00, 0x08, 0x24, 0x6d, 0x61, 0x78, 0x70, 0x05,
-    0xd4, 0x0d, 0x1a, 0x00, 0x01, 0x8b, 0xc0, 0x00, 0x00, 0x00, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x45, 0x6c, 0x6f, 0xc0,
-    0x00, 0x01, 0x8b, 0xe0, 0x00, 0x00, 0x03, 0x20, 0x70, 0x6f, 0x73, 0x74, 0xe5, 0x42, 0xa7, 0xe9, 0x00, 0x01, 0x8f,
-    0x00, 0x00, 0x00, 0x23, 0xd1, 0x70, 0x72, 0x65, 0x70, 0x37, 0x75, 0x3b, 0xbf, 0x00, 0x01, 0xbf, 0x10, 0x00, 0x00,
-    0x00, 0xae, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x08, 0x00,
-    0xcc, 0x00, 0xcc, 0x00, 0x01, 0x01, 0x21, 0x01, 0x27, 0x00, 0x01, 0x01, 0x58, 0x01, 0x63, 0x00, 0x01, 0x01, 0x78,
-    0x01, 0x78, 0x00, 0x01, 0x01, 0x7d, 0x01, 0x7e, 0x00, 0x01, 0x01, 0x80, 0x01, 0x80, 0x00, 0x01, 0x01, 0x92, 0x01,
-    0x94, 0x00, 0x01, 0x01, 0xcc, 0x01, 0xcc, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1e, 0x00, 0x2c,
-    0x00, 0x01, 0x44, 0x46, 0x4c, 0x54, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x01, 0x73, 0x6d, 0x63, 0x70, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x01, 0xbe, 0x00, 0xdc, 0x01, 0x9d, 0x01, 0x9e, 0x01,
-    0x9f, 0x01, 0xa0, 0x01, 0xa1, 0x01, 0xa2, 0x01, 0xa3, 0x01, 0xa4, 0x01, 0xa5, 0x01, 0xa6, 0x01, 0xa7, 0x01, 0xa8,
-    0x01, 0xa9, 0x01, 0xaa, 0x01, 0xab, 0x01, 0xd7, 0x01, 0xac, 0x01, 0xad, 0x01, 0xae, 0x01, 0xaf, 0x01, 0xb0, 0x01,
-    0xb1, 0x01, 0xb2, 0x01, 0xb3, 0x01, 0xb4, 0x01, 0xb5, 0x01, 0x9d, 0x01, 0x9e, 0x01, 0x9f, 0x01, 0xa0, 0x01, 0xa1,
-    0x01, 0xa2, 0x01, 0xa3, 0x01, 0xa4, 0x01, 0xa5, 0x01, 0xa6, 0x01, 0xa7, 0x01, 0xa8, 0x01, 0xa9, 0x01, 0xaa, 0x01,
-    0xab, 0x01, 0xd7, 0x01, 0xac, 0x01, 0xad, 0x01, 0xae, 0x01, 0xaf, 0x01, 0xb0, 0x01, 0xb1, 0x01, 0xb2, 0x01, 0xb3,
-    0x01, 0xb4, 0x01, 0xb5, 0x01, 0xe1, 0x02, 0x9a, 0x02, 0x99, 0x02, 0x9a, 0x02, 0x9b, 0x02, 0x9b, 0x02, 0x9c, 0x02,
-    0x9d, 0x02, 0x9e, 0x02, 0x9f, 0x02, 0xa0, 0x02, 0xa1, 0x02, 0xa2, 0x02, 0xa3, 0x02, 0xa4, 0x02, 0xa5, 0x02, 0xa6,
-    0x02, 0xa7, 0x02, 0xa8, 0x02, 0xa9, 0x02, 0xaa, 0x02, 0xab, 0x02, 0xac, 0x02, 0xad, 0x02, 0xae, 0x02, 0xaf, 0x02,
-    0xb0, 0x02, 0xb1, 0x02, 0xb2, 0x02, 0xb3, 0x02, 0xb4, 0x02, 0xb5, 0x02, 0xb6, 0x02, 0x9c, 0x02, 0x9d, 0x02, 0x9e,
-    0x02, 0x9f, 0x02, 0xa0, 0x02, 0xa1, 0x02, 0xa2, 0x02, 0xa3, 0x02, 0xa4, 0x02, 0xa5, 0x02, 0xa6, 0x02, 0xa7, 0x02,
-    0xa8, 0x02, 0xa9, 0x02, 0xaa, 0x02, 0xab, 0x02, 0xac, 0x02, 0xad, 0x02, 0xae, 0x02, 0xaf, 0x02, 0xb0, 0x02, 0xb1,
-    0x02, 0xb2, 0x02, 0xb3, 0x02, 0xb4, 0x02, 0xb5, 0x02, 0xb6, 0x02, 0xeb, 0x02, 0xb7, 0x02, 0xb7, 0x02, 0xb8, 0x02,
-    0xb8, 0x02, 0xb9, 0x02, 0xb9, 0x02, 0xba, 0x02, 0xba, 0x02, 0xbb, 0x02, 0xbb, 0x02, 0xbd, 0x02, 0xbd, 0x02, 0xbe,
-    0x02, 0xbe, 0x02, 0xbf, 0x02, 0xbf, 0x02, 0xc0, 0x02, 0xc0, 0x02, 0xc1, 0x02, 0xc1, 0x02, 0xc2, 0x02, 0xc2, 0x02,
-    0xc3, 0x02, 0xc3, 0x02, 0xc4, 0x02, 0xc4, 0x02, 0xc5, 0x02, 0xc5, 0x02, 0xc7, 0x02, 0xc7, 0x02, 0xc8, 0x02, 0xc8,
-    0x02, 0xc9, 0x02, 0xc9, 0x02, 0xca, 0x02, 0xca, 0x02, 0xcb, 0x02, 0xcb, 0x02, 0xcc, 0x02, 0xcc, 0x02, 0xcd, 0x02,
-    0xce, 0x02, 0xce, 0x02, 0xcf, 0x02, 0xcf, 0x02, 0xd0, 0x02, 0xd0, 0x02, 0xd1, 0x02, 0xd1, 0x02, 0xd2, 0x02, 0xd2,
-    0x02, 0xd3, 0x02, 0xd3, 0x02, 0xd4, 0x02, 0xd4, 0x02, 0xd5, 0x02, 0xd5, 0x02, 0xd6, 0x02, 0xd6, 0x02, 0xd7, 0x02,
-    0xd7, 0x02, 0xd8, 0x02, 0xd8, 0x02, 0xd9, 0x02, 0xd9, 0x02, 0xda, 0x02, 0xda, 0x02, 0xdb, 0x02, 0xdb, 0x02, 0xdc,
-    0x02, 0xdc, 0x02, 0xdd, 0x02, 0xdd, 0x02, 0xde, 0x02, 0xde, 0x02, 0xdf, 0x02, 0xdf, 0x02, 0xe0, 0x02, 0xe0, 0x02,
-    0x7a, 0x02, 0x7a, 0x02, 0xe2, 0x02, 0xe2, 0x02, 0xe3, 0x02, 0xe3, 0x02, 0xe4, 0x02, 0xe4, 0x02, 0xe5, 0x02, 0xe5,
-    0x02, 0xe6, 0x02, 0xe6, 0x02, 0xe7, 0x02, 0xe7, 0x02, 0xe8, 0x02, 0xe8, 0x02, 0xe9, 0x02, 0xe9, 0x02, 0xea, 0x02,
-    0xea, 0x02, 0xeb, 0x02, 0xec, 0x02, 0xec, 0x02, 0xed, 0x02, 0xed, 0x02, 0xee, 0x02, 0xee, 0x02, 0x99, 0x00, 0x02,
-    0x00, 0x0d, 0x00, 0x23, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x43, 0x00, 0x5c, 0x00, 0x1a, 0x00, 0x83, 0x00, 0x83, 0x00,
-    0x34, 0x00, 0x85, 0x00, 0x85, 0x00, 0x35, 0x01, 0xe5, 0x01, 0xe6, 0x00, 0x36, 0x01, 0xe8, 0x02, 0x2a, 0x00, 0x38,
-    0x02, 0x2d, 0x02, 0x3e, 0x00, 0x7b, 0x02, 0x41, 0x02, 0x5f, 0x00, 0x8d, 0x02, 0x61, 0x02, 0x72, 0x00, 0xac, 0x02,
-    0x75, 0x02, 0x76, 0x00, 0xbe, 0x02, 0x79, 0x02, 0x79, 0x00, 0xc0, 0x02, 0x7b, 0x02, 0x94, 0x00, 0xc1, 0x03, 0xe3,
-    0x03, 0xe3, 0x00, 0xdb, 0x00, 0x03, 0x04, 0xce, 0x01, 0x90, 0x00, 0x05, 0x00, 0x00, 0x05, 0x9a, 0x05, 0x33, 0x00,
-    0x00, 0x01, 0x1f, 0x05, 0x9a, 0x05, 0x33, 0x00, 0x00, 0x03, 0xd1, 0x00, 0x66, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x02, 0xff, 0x10, 0x00, 0x20, 0x5b, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x70, 0x79, 0x72, 0x73, 0x00, 0x40, 0x00, 0x00, 0xff, 0xfd, 0x08, 0x62, 0xfd, 0xd5,
-    0x00, 0x00, 0x08, 0x62, 0x02, 0x2b, 0x20, 0x00, 0x01, 0x9f, 0x4f, 0x01, 0x00, 0x00, 0x04, 0x3a, 0x05, 0xb0, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x06, 0x44, 0x00,
-    0x00, 0x00, 0xe0, 0x00, 0x80, 0x00, 0x06, 0x00, 0x60, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x21,
-    0x00, 0x7e, 0x00, 0xa0, 0x00, 0xac, 0x00, 0xad, 0x00, 0xbf, 0x00, 0xc6, 0x00, 0xcf, 0x00, 0xe6, 0x00, 0xef, 0x00,
-    0xfe, 0x01, 0x0f, 0x01, 0x11, 0x01, 0x25, 0x01, 0x27, 0x01, 0x30, 0x01, 0x53, 0x01, 0x5f, 0x01, 0x67, 0x01, 0x7e,
-    0x01, 0x7f, 0x01, 0x92, 0x01, 0xa1, 0x01, 0xb0, 0x01, 0xf0, 0x01, 0xff, 0x02, 0x1b, 0x02, 0x37, 0x02, 0x59, 0x02,
-    0xbc, 0x02, 0xc7, 0x02, 0xc9, 0x02, 0xdd, 0x02, 0xf3, 0x03, 0x01, 0x03, 0x03, 0x03, 0x09, 0x03, 0x0f, 0x03, 0x23,
-    0x03, 0x8a, 0x03, 0x8c, 0x03, 0x92, 0x03, 0xa1, 0x03, 0xb0, 0x03, 0xb9, 0x03, 0xc9, 0x03, 0xce, 0x03, 0xd2, 0x03,
-    0xd6, 0x04, 0x25, 0x04, 0x2f, 0x04, 0x45, 0x04, 0x4f, 0x04, 0x62, 0x04, 0x6f, 0x04, 0x77, 0x04, 0x86, 0x04, 0xce,
-    0x04, 0xd7, 0x04, 0xe1, 0x04, 0xf5, 0x05, 0x01, 0x05, 0x10, 0x05, 0x13, 0x1e, 0x01, 0x1e, 0x3f, 0x1e, 0x85, 0x1e,
-    0xf1, 0x1e, 0xf3, 0x1e, 0xf9, 0x1f, 0x4d, 0x20, 0x0b, 0x20, 0x15, 0x20, 0x1e, 0x20, 0x22, 0x20, 0x26, 0x20, 0x30,
-    0x20, 0x33, 0x20, 0x3a, 0x20, 0x3c, 0x20, 0x44, 0x20, 0x74, 0x20, 0x7f, 0x20, 0xa4, 0x20, 0xa7, 0x20, 0xac, 0x21,
-    0x05, 0x21, 0x13, 0x21, 0x16, 0x21, 0x22, 0x21, 0x26, 0x21, 0x2e, 0x21, 0x5e, 0x22, 0x02, 0x22, 0x06, 0x22, 0x0f,
-    0x22, 0x12, 0x22, 0x1a, 0x22, 0x1e, 0x22, 0x2b, 0x22, 0x48, 0x22, 0x60, 0x22, 0x65, 0x25, 0xca, 0xf6, 0xc3, 0xfe,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x20, 0x00, 0x22,
-    0x00, 0xa0, 0x00, 0xa1, 0x00, 0xad, 0x00, 0xae, 0x00, 0xc0, 0x00, 0xc7, 0x00, 0xd0, 0x00, 0xe7, 0x00, 0xf0, 0x00,
-    0xff, 0x01, 0x10, 0x01, 0x12, 0x01, 0x26, 0x01, 0x28, 0x01, 0x31, 0x01, 0x54, 0x01, 0x60, 0x01, 0x68, 0x01, 0x7f,
-    0x01, 0x92, 0x01, 0xa0, 0x01, 0xaf, 0x01, 0xf0, 0x01, 0xfa, 0x02, 0x18, 0x02, 0x37, 0x02, 0x59, 0x02, 0xbc, 0x02,
-    0xc6, 0x02, 0xc9, 0x02, 0xd8, 0x02, 0xf3, 0x03, 0x00, 0x03, 0x03, 0x03, 0x09, 0x03, 0x0f, 0x03, 0x23, 0x03, 0x84,
-    0x03, 0x8c, 0x03, 0x8e, 0x03, 0x93, 0x03, 0xa3, 0x03, 0xb1, 0x03, 0xba, 0x03, 0xca, 0x03, 0xd1, 0x03, 0xd6, 0x04,
-    0x00, 0x04, 0x26, 0x04, 0x30, 0x04, 0x46, 0x04, 0x50, 0x04, 0x63, 0x04, 0x70, 0x04, 0x78, 0x04, 0x88, 0x04, 0xcf,
-    0x04, 0xd8, 0x04, 0xe2, 0x04, 0xf6, 0x05, 0x02, 0x05, 0x11, 0x1e, 0x00, 0x1e, 0x3e, 0x1e, 0x80, 0x1e, 0xa0, 0x1e,
-    0xf2, 0x1e, 0xf4, 0x1f, 0x4d, 0x20, 0x00, 0x20, 0x13, 0x20, 0x17, 0x20, 0x20, 0x20, 0x25, 0x20, 0x30, 0x20, 0x32,
-    0x20, 0x39, 0x20, 0x3c, 0x20, 0x44, 0x20, 0x74, 0x20, 0x7f, 0x20, 0xa3, 0x20, 0xa7, 0x20, 0xab, 0x21, 0x05, 0x21,
-    0x13, 0x21, 0x16, 0x21, 0x22, 0x21, 0x26, 0x21, 0x2e, 0x21, 0x5b, 0x22, 0x02, 0x22, 0x06, 0x22, 0x0f, 0x22, 0x11,
-    0x22, 0x1a, 0x22, 0x1e, 0x22, 0x2b, 0x22, 0x48, 0x22, 0x60, 0x22, 0x64, 0x25, 0xca, 0xf6, 0xc3, 0xfe, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0x00, 0x01, 0x04, 0x0c, 0x04, 0x06, 0xff, 0xf5, 0x00, 0x00, 0xff, 0xe2, 0x01, 0x43, 0xff, 0xc0,
-    0x01, 0x37, 0xff, 0xbf, 0x00, 0x00, 0x01, 0x2a, 0x00, 0x00, 0x01, 0x25, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x01,
-    0x1f, 0x00, 0x00, 0x01, 0x1d, 0x00, 0x00, 0x01, 0x13, 0x00, 0x00, 0x01, 0x16, 0xff, 0x15, 0xff, 0x03, 0xfe, 0xf6,
-    0xfe, 0xe9, 0x01, 0x58, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x63, 0xfe, 0x42, 0x00, 0x8d, 0xfd, 0xd6, 0xfd, 0xa5, 0xfd,
-    0xc6, 0xfd, 0xb1, 0xfd, 0xa5, 0xfd, 0xa4, 0xfd, 0x9f, 0xfd, 0x9a, 0xfd, 0x87, 0x00, 0x00, 0xff, 0x67, 0xff, 0x66,
-    0x00, 0x00, 0x00, 0x00, 0xfd, 0x07, 0x00, 0x00, 0xff, 0x47, 0xfc, 0xfb, 0xfc, 0xf8, 0x00, 0x00, 0xfc, 0xb6, 0x00,
-    0x00, 0xfc, 0xae, 0x00, 0x00, 0xfc, 0xa3, 0x00, 0x00, 0xfc, 0x9f, 0x00, 0x00, 0xfe, 0x91, 0x00, 0x00, 0xfe, 0x8e,
-    0x00, 0x00, 0xfc, 0x47, 0x00, 0x00, 0xe5, 0x4c, 0xe5, 0x0c, 0xe4, 0xbd, 0xe4, 0xeb, 0xe4, 0x51, 0xe4, 0xe9, 0xe4,
-    0x01, 0xe1, 0x58, 0x00, 0x00, 0xe1, 0x4f, 0xe1, 0x4e, 0xe1, 0x4c, 0xe1, 0x43, 0xe3, 0x13, 0xe1, 0x3b, 0xe3, 0x0b,
-    0xe1, 0x32, 0xe1, 0x03, 0xe0, 0xf9, 0x00, 0x00, 0xe0, 0xd3, 0x00, 0x00, 0xe0, 0x77, 0xe0, 0x6a, 0xe0, 0x68, 0xe0,
-    0x5d, 0xdf, 0x91, 0xe0, 0x52, 0xe0, 0x26, 0xdf, 0x83, 0xde, 0xa9, 0xdf, 0x77, 0xdf, 0x76, 0xdf, 0x6f, 0xdf, 0x6c,
-    0xdf, 0x60, 0xdf, 0x44, 0xdf, 0x2d, 0xdf, 0x2a, 0xdb, 0xc6, 0x0a, 0xce, 0x02, 0x93, 0x01, 0x97, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xd0, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x1e, 0x00, 0x00, 0x01, 0x1e, 0x00,
-    0x00, 0x01, 0x1e, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x62, 0x01, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x62, 0x01, 0x7e,
-    0x00, 0x00, 0x01, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xae, 0x00, 0x00, 0x01, 0xf6, 0x00, 0x00, 0x02,
-    0x1e, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x02, 0x4c, 0x00, 0x00, 0x02, 0xd6, 0x00, 0x00, 0x02, 0xe6, 0x00, 0x00,
-    0x02, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xde, 0x00, 0x00, 0x02, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x10, 0x01,
-    0xea, 0x01, 0xeb, 0x01, 0xec, 0x01, 0xed, 0x01, 0xee, 0x01, 0xef, 0x00, 0x7f, 0x01, 0xe6, 0x01, 0xfa, 0x01, 0xfb,
-    0x01, 0xfc, 0x01, 0xfd, 0x01, 0xfe, 0x01, 0xff, 0x00, 0x80, 0x00, 0x81, 0x02, 0x00, 0x02, 0x01, 0x02, 0x02, 0x02,
-    0x03, 0x02, 0x04, 0x00, 0x82, 0x00, 0x83, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02, 0x0a,
-    0x00, 0x84, 0x00, 0x85, 0x02, 0x15, 0x02, 0x16, 0x02, 0x17, 0x02, 0x18, 0x02, 0x19, 0x02, 0x1a, 0x00, 0x86, 0x00,
-    0x87, 0x02, 0x1b, 0x02, 0x1c, 0x02, 0x1d, 0x02, 0x1e, 0x02, 0x1f, 0x00, 0x88, 0x01, 0xe5, 0x03, 0xe3, 0x00, 0x89,
-    0x01, 0xe7, 0x00, 0x8a, 0x00, 0x8b, 0x00, 0x8c, 0x02, 0x4e, 0x02, 0x4f, 0x02, 0x50, 0x02, 0x51, 0x00, 0x8d, 0x02,
-    0x52, 0x02, 0x53, 0x02, 0x54, 0x02, 0x55, 0x02, 0x56, 0x02, 0x57, 0x02, 0x58, 0x02, 0x59, 0x00, 0x8e, 0x00, 0x8f,
-    0x02, 0x5a, 0x02, 0x5b, 0x02, 0x5c, 0x02, 0x5d, 0x02, 0x5e, 0x02, 0x5f, 0x02, 0x60, 0x00, 0x90, 0x00, 0x91, 0x02,
-    0x61, 0x02, 0x62, 0x02, 0x63, 0x02, 0x64, 0x02, 0x65, 0x02, 0x66, 0x00, 0x92, 0x00, 0x93, 0x02, 0x75, 0x02, 0x76,
-    0x02, 0x79, 0x02, 0x7b, 0x02, 0x7c, 0x02, 0x7d, 0x01, 0xe8, 0x01, 0xe9, 0x01, 0xf0, 0x02, 0x0b, 0x02, 0x95, 0x02,
-    0x96, 0x02, 0x97, 0x02, 0x98, 0x02, 0x73, 0x02, 0x74, 0x02, 0x77, 0x02, 0x78, 0x00, 0xab, 0x00, 0xac, 0x02, 0xef,
-    0x00, 0xad, 0x02, 0xf0, 0x02, 0xf1, 0x02, 0xf2, 0x00, 0xae, 0x00, 0xaf, 0x02, 0xf9, 0x02, 0xfa, 0x02, 0xfb, 0x00,
-    0xb0, 0x02, 0xfc, 0x02, 0xfd, 0x00, 0xb1, 0x02, 0xfe, 0x02, 0xff, 0x00, 0xb2, 0x03, 0x00, 0x00, 0xb3, 0x03, 0x01,
-    0x00, 0xb4, 0x03, 0x02, 0x03, 0x03, 0x00, 0xb5, 0x03, 0x04, 0x00, 0xb6, 0x00, 0xb7, 0x03, 0x05, 0x03, 0x06, 0x03,
-    0x07, 0x03, 0x08, 0x03, 0x09, 0x03, 0x0a, 0x03, 0x0b, 0x03, 0x0c, 0x00, 0xc1, 0x03, 0x0e, 0x03, 0x0f, 0x00, 0xc2,
-    0x03, 0x0d, 0x00, 0xc3, 0x00, 0xc4, 0x00, 0xc5, 0x00, 0xc6, 0x00, 0xc7, 0x00, 0xc8, 0x00, 0xc9, 0x03, 0x10, 0x00,
-    0xca, 0x00, 0xcb, 0x03, 0x4f, 0x03, 0x16, 0x00, 0xcf, 0x03, 0x17, 0x00, 0xd0, 0x03, 0x18, 0x03, 0x19, 0x03, 0x1a,
-    0x03, 0x1b, 0x00, 0xd1, 0x00, 0xd2, 0x00, 0xd3, 0x03, 0x1d, 0x03, 0x50, 0x03, 0x1e, 0x00, 0xd4, 0x03, 0x1f, 0x00,
-    0xd5, 0x03, 0x20, 0x03, 0x21, 0x00, 0xd6, 0x03, 0x22, 0x00, 0xd7, 0x00, 0xd8, 0x00, 0xd9, 0x03, 0x23, 0x03, 0x1c,
-    0x00, 0xda, 0x03, 0x24, 0x03, 0x25, 0x03, 0x26, 0x03, 0x27, 0x03, 0x28, 0x03, 0x29, 0x03, 0x2a, 0x00, 0xdb, 0x03,
-    0x2b, 0x03, 0x2c, 0x03, 0x2d, 0x00, 0xe6, 0x00, 0xe7, 0x00, 0xe8, 0x00, 0xe9, 0x03, 0x2e, 0x00, 0xea, 0x00, 0xeb,
-    0x00, 0xec, 0x03, 0x2f, 0x00, 0xed, 0x00, 0xee, 0x00, 0xef, 0x00, 0xf0, 0x03, 0x30, 0x00, 0xf1, 0x03, 0x31, 0x03,
-    0x32, 0x00, 0xf2, 0x03, 0x33, 0x00, 0xf3, 0x03, 0x34, 0x03, 0x51, 0x03, 0x35, 0x00, 0xfe, 0x03, 0x36, 0x00, 0xff,
-    0x03, 0x37, 0x03, 0x38, 0x03, 0x39, 0x03, 0x3a, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x3b, 0x03, 0x52, 0x03,
-    0x3c, 0x01, 0x03, 0x01, 0x04, 0x01, 0x05, 0x03, 0xfa, 0x03, 0x53, 0x03, 0x54, 0x01, 0x13, 0x01, 0x14, 0x01, 0x15,
-    0x01, 0x16, 0x03, 0x55, 0x03, 0x56, 0x01, 0x26, 0x01, 0x27, 0x03, 0xff, 0x04, 0x00, 0x03, 0xf9, 0x03, 0xf8, 0x01,
-    0x28, 0x01, 0x29, 0x01, 0x2a, 0x01, 0x2b, 0x03, 0xfb, 0x03, 0xfc, 0x01, 0x2c, 0x01, 0x2d, 0x03, 0xf3, 0x03, 0xf4,
-    0x03, 0x57, 0x03, 0x58, 0x03, 0xe5, 0x03, 0xe6, 0x01, 0x2e, 0x01, 0x2f, 0x03, 0xfd, 0x03, 0xfe, 0x01, 0x30, 0x01,
-    0x31, 0x03, 0xe7, 0x03, 0xe8, 0x01, 0x32, 0x01, 0x33, 0x01, 0x34, 0x01, 0x35, 0x01, 0x36, 0x01, 0x37, 0x03, 0x59,
-    0x03, 0x5a, 0x03, 0xe9, 0x03, 0xea, 0x03, 0x5b, 0x03, 0x5c, 0x04, 0x07, 0x04, 0x08, 0x03, 0xeb, 0x03, 0xec, 0x01,
-    0x38, 0x01, 0x39, 0x03, 0xed, 0x03, 0xee, 0x01, 0x3a, 0x01, 0x3b, 0x01, 0x3c, 0x03, 0xf7, 0x01, 0x3d, 0x01, 0x3e,
-    0x03, 0xf5, 0x03, 0xf6, 0x03, 0x5d, 0x03, 0x5e, 0x03, 0x5f, 0x01, 0x3f, 0x01, 0x40, 0x04, 0x05, 0x04, 0x06, 0x01,
-    0x41, 0x01, 0x42, 0x04, 0x01, 0x04, 0x02, 0x03, 0xef, 0x03, 0xf0, 0x04, 0x03, 0x04, 0x04, 0x01, 0x43, 0x03, 0x6a,
-    0x03, 0x69, 0x03, 0x6b, 0x03, 0x6c, 0x03, 0x6d, 0x03, 0x6e, 0x03, 0x6f, 0x01, 0x44, 0x01, 0x45, 0x03, 0xf1, 0x03,
-    0xf2, 0x03, 0x84, 0x03, 0x85, 0x01, 0x46, 0x01, 0x47, 0x03, 0x86, 0x03, 0x87, 0x04, 0x09, 0x04, 0x0a, 0x01, 0x48,
-    0x03, 0x88, 0x04, 0x0b, 0x03, 0x89, 0x03, 0x8a, 0x01, 0x64, 0x01, 0x65, 0x04, 0x0d, 0x04, 0x0c, 0x01, 0x79, 0x03,
-    0xe4, 0x01, 0x7b, 0x00, 0x06, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x04, 0x10, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0a,
-    0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00,
-    0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d,
-    0x00, 0x1e, 0x00, 0x1f, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00,
-    0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x30,
-    0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00,
-    0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43,
-    0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00,
-    0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56,
-    0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00,
-    0x60, 0x00, 0x00, 0x01, 0xee, 0x01, 0xef, 0x01, 0xf1, 0x01, 0xf3, 0x01, 0xfa, 0x01, 0xff, 0x02, 0x03, 0x02, 0x06,
-    0x02, 0x05, 0x02, 0x07, 0x02, 0x09, 0x02, 0x08, 0x02, 0x0a, 0x02, 0x0c, 0x02, 0x0e, 0x02, 0x0d, 0x02, 0x0f, 0x02,
-    0x10, 0x02, 0x12, 0x02, 0x11, 0x02, 0x13, 0x02, 0x14, 0x02, 0x15, 0x02, 0x17, 0x02, 0x16, 0x02, 0x18, 0x02, 0x1a,
-    0x02, 0x19, 0x02, 0x1c, 0x02, 0x1b, 0x02, 0x1d, 0x02, 0x1e, 0x01, 0x6e, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x63, 0x00,
-    0x67, 0x01, 0x70, 0x00, 0x75, 0x00, 0x83, 0x00, 0x6d, 0x00, 0x69, 0x01, 0x7f, 0x00, 0x73, 0x00, 0x68, 0x01, 0x8d,
-    0x00, 0x7f, 0x00, 0x81, 0x01, 0x8a, 0x00, 0x70, 0x01, 0x8e, 0x01, 0x8f, 0x00, 0x65, 0x00, 0x74, 0x01, 0x85, 0x01,
-    0x87, 0x01, 0x86, 0x00, 0xc3, 0x01, 0x8b, 0x00, 0x6a, 0x00, 0x79, 0x00, 0xb7, 0x00, 0x84, 0x00, 0x87, 0x00, 0x7e,
-    0x00, 0x61, 0x00, 0x6c, 0x01, 0x89, 0x00, 0x95, 0x01, 0x8c, 0x00, 0xaf, 0x00, 0x6b, 0x00, 0x7a, 0x01, 0x72, 0x00,
-    0x03, 0x01, 0xea, 0x01, 0xed, 0x01, 0xfe, 0x00, 0x92, 0x00, 0x93, 0x01, 0x64, 0x01, 0x65, 0x01, 0x6b, 0x01, 0x6c,
-    0x01, 0x67, 0x01, 0x68, 0x00, 0x86, 0x01, 0x90, 0x02, 0x20, 0x02, 0x8e, 0x01, 0x76, 0x01, 0x7b, 0x01, 0x74, 0x01,
-    0x75, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6f, 0x00, 0x76, 0x01, 0x69, 0x01, 0x6d, 0x01, 0x73, 0x01, 0xec, 0x01, 0xf4,
-    0x01, 0xeb, 0x01, 0xf5, 0x01, 0xf2, 0x01, 0xf7, 0x01, 0xf8, 0x01, 0xf9, 0x01, 0xf6, 0x01, 0xfc, 0x01, 0xfd, 0x00,
-    0x00, 0x01, 0xfb, 0x02, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00, 0x8a, 0x00, 0x9c, 0x00, 0xa2, 0x00, 0x6e, 0x00, 0x9e,
-    0x00, 0x9f, 0x00, 0xa0, 0x00, 0x77, 0x00, 0xa3, 0x00, 0xa1, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x02, 0x01, 0x62, 0x04,
-    0x21, 0x03, 0x5f, 0x06, 0x00, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x34, 0x4b, 0xb0, 0x21, 0x50, 0x58, 0x40, 0x0d, 0x02,
-    0x01, 0x00, 0x00, 0x01, 0x59, 0x03, 0x01, 0x01, 0x01, 0x3e, 0x00, 0x4c, 0x1b, 0x40, 0x13, 0x03, 0x01, 0x01, 0x00,
-    0x00, 0x01, 0x55, 0x03, 0x01, 0x01, 0x01, 0x00, 0x59, 0x02, 0x01, 0x00, 0x01, 0x00, 0x4d, 0x59, 0xb6, 0x12, 0x12,
-    0x12, 0x11, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x03, 0x23, 0x13, 0x35, 0x33, 0x05, 0x03, 0x23, 0x13, 0x35, 0x33, 0x01,
-    0xf9, 0x15, 0x82, 0x01, 0x96, 0x01, 0x65, 0x15, 0x81, 0x01, 0x96, 0x05, 0x93, 0xfe, 0x8e, 0x01, 0x62, 0x7d, 0x6d,
-    0xfe, 0x8e, 0x01, 0x62, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3d, 0x00, 0x00, 0x04, 0x99, 0x05, 0xb0, 0x00,
-    0x1b, 0x00, 0x1f, 0x00, 0x74, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x27, 0x0e, 0x0b, 0x02, 0x03, 0x0c, 0x02, 0x02,
-    0x00, 0x01, 0x03, 0x00, 0x61, 0x08, 0x01, 0x06, 0x06, 0x3c, 0x4b, 0x0f, 0x0a, 0x02, 0x04, 0x04, 0x05, 0x59, 0x09,
-    0x07, 0x02, 0x05, 0x05, 0x3f, 0x4b, 0x0d, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x1b, 0x40, 0x25, 0x09, 0x07, 0x02,
-    0x05, 0x0f, 0x0a, 0x02, 0x04, 0x03, 0x05, 0x04, 0x62, 0x0e, 0x0b, 0x02, 0x03, 0x0c, 0x02, 0x02, 0x00, 0x01, 0x03,
-    0x00, 0x61, 0x08, 0x01, 0x06, 0x06, 0x3c, 0x4b, 0x0d, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x59, 0x40, 0x1a, 0x1f,
-    0x1e, 0x1d, 0x1c, 0x1b, 0x1a, 0x19, 0x18, 0x17, 0x16, 0x15, 0x14, 0x13, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x10, 0x08, 0x1d, 0x2b, 0x01, 0x21, 0x03, 0x23, 0x13, 0x23, 0x35, 0x21, 0x13, 0x21, 0x35, 0x21,
-    0x13, 0x33, 0x03, 0x21, 0x13, 0x33, 0x03, 0x33, 0x15, 0x23, 0x03, 0x33, 0x15, 0x23, 0x03, 0x23, 0x03, 0x21, 0x13,
-    0x21, 0x02, 0xc3, 0xfe, 0xf8, 0x50, 0x8f, 0x50, 0xef, 0x01, 0x09, 0x45, 0xfe, 0xfe, 0x01, 0x1d, 0x52, 0x8f, 0x52,
-    0x01, 0x08, 0x52, 0x8f, 0x52, 0xcd, 0xe8, 0x45, 0xe2, 0xfc, 0x50, 0x8f, 0x9e, 0x01, 0x08, 0x45, 0xfe, 0xf8, 0x01,
-    0x9a, 0xfe, 0x66, 0x01, 0x9a, 0x89, 0x01, 0x62, 0x8b, 0x01, 0xa0, 0xfe, 0x60, 0x01, 0xa0, 0xfe, 0x60, 0x8b, 0xfe,
-    0x9e, 0x89, 0xfe, 0x66, 0x02, 0x23, 0x01, 0x62, 0x00, 0x01, 0x00, 0xa2, 0xff, 0x30, 0x04, 0x45, 0x06, 0x9c, 0x00,
-    0x3d, 0x00, 0x42, 0x40, 0x3f, 0x10, 0x0d, 0x02, 0x02, 0x00, 0x2e, 0x2b, 0x02, 0x03, 0x05, 0x02, 0x4a, 0x00, 0x01,
-    0x02, 0x04, 0x02, 0x01, 0x04, 0x70, 0x00, 0x04, 0x05, 0x02, 0x04, 0x05, 0x6e, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00,
-    0x02, 0x63, 0x00, 0x05, 0x03, 0x03, 0x05, 0x57, 0x00, 0x05, 0x05, 0x03, 0x59, 0x00, 0x03, 0x05, 0x03, 0x4d, 0x3a,
-    0x38, 0x34, 0x33, 0x2d, 0x2c, 0x24, 0x14, 0x1e, 0x06, 0x08, 0x17, 0x2b, 0x01, 0x36, 0x26, 0x27, 0x2e, 0x03, 0x35,
-    0x34, 0x3e, 0x02, 0x37, 0x35, 0x33, 0x15, 0x16, 0x16, 0x17, 0x23, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x07, 0x14,
-    0x1e, 0x02, 0x17, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x15, 0x23, 0x35, 0x2e, 0x03, 0x35, 0x33, 0x14, 0x1e,
-    0x02, 0x33, 0x32, 0x3e, 0x02, 0x03, 0x8b, 0x01, 0x87, 0x93, 0x5d, 0x96, 0x6b, 0x3a, 0x33, 0x5d, 0x85, 0x51, 0x95,
-    0xa8, 0xba, 0x01, 0xb8, 0x21, 0x3f, 0x5c, 0x3b, 0x79, 0x7c, 0x01, 0x20, 0x45, 0x6d, 0x4d, 0x5e, 0x96, 0x68, 0x37,
-    0x37, 0x64, 0x8f, 0x57, 0x95, 0x4e, 0x8f, 0x6e, 0x42, 0xb9, 0x32, 0x4f, 0x64, 0x33, 0x41, 0x68, 0x48, 0x27, 0x01,
-    0x77, 0x5b, 0x82, 0x30, 0x1d, 0x4c, 0x69, 0x88, 0x59, 0x54, 0x88, 0x65, 0x3e, 0x0a, 0xdc, 0xdc, 0x17, 0xed, 0xcc,
-    0x43, 0x71, 0x51, 0x2e, 0x7e, 0x6b, 0x32, 0x4e, 0x40, 0x37, 0x1a, 0x1f, 0x4c, 0x66, 0x86, 0x59, 0x57, 0x8a, 0x63,
-    0x3c, 0x09, 0xc0, 0xbf, 0x08, 0x38, 0x6b, 0xa2, 0x71, 0x54, 0x6f, 0x42, 0x1c, 0x20, 0x3d, 0x57, 0x00, 0x05, 0x00,
-    0x2c, 0xff, 0xeb, 0x04, 0x9e, 0x05, 0xc5, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x41, 0x00, 0x57, 0x00, 0x5b, 0x00, 0x3e,
-    0x40, 0x3b, 0x5b, 0x5a, 0x02, 0x02, 0x03, 0x59, 0x01, 0x06, 0x07, 0x02, 0x4a, 0x00, 0x02, 0x00, 0x01, 0x04, 0x02,
-    0x01, 0x63, 0x00, 0x04, 0x00, 0x07, 0x06, 0x04, 0x07, 0x63, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x44,
-    0x4b, 0x00, 0x06, 0x06, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x45, 0x05, 0x4c, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
-    0x24, 0x08, 0x08, 0x1c, 0x2b, 0x13, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23,
-    0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22,
-    0x0e, 0x02, 0x15, 0x01, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e,
-    0x02, 0x35, 0x33, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02,
-    0x15, 0x05, 0x27, 0x01, 0x17, 0x2c, 0x23, 0x43, 0x64, 0x41, 0x42, 0x65, 0x43, 0x23, 0x23, 0x43, 0x64, 0x41, 0x41,
-    0x65, 0x44, 0x23, 0x8a, 0x0e, 0x20, 0x31, 0x24, 0x23, 0x31, 0x1e, 0x0f, 0x0f, 0x1f, 0x31, 0x24, 0x23, 0x31, 0x1f,
-    0x0e, 0x01, 0xcf, 0x23, 0x44, 0x64, 0x41, 0x42, 0x64, 0x44, 0x23, 0x23, 0x44, 0x63, 0x41, 0x42, 0x65, 0x44, 0x23,
-    0x8a, 0x0f, 0x1f, 0x32, 0x24, 0x23, 0x31, 0x1e, 0x0e, 0x0e, 0x1f, 0x32, 0x23, 0x24, 0x31, 0x1f, 0x0e, 0xfe, 0x7f,
-    0x6f, 0x02, 0x37, 0x6f, 0x04, 0xaa, 0x39, 0x67, 0x4e, 0x2d, 0x2d, 0x4e, 0x67, 0x39, 0x4d, 0x39, 0x66, 0x4d, 0x2d,
-    0x2d, 0x4d, 0x66, 0x39, 0x1f, 0x39, 0x2d, 0x1b, 0x1b, 0x2d, 0x39, 0x1f, 0x4d, 0x1f, 0x3b, 0x2d, 0x1b, 0x1b, 0x2d,
-    0x3b, 0x1f, 0xfc, 0xa8, 0x39, 0x66, 0x4e, 0x2d, 0x2d, 0x4e, 0x66, 0x39, 0x4e, 0x39, 0x66, 0x4d, 0x2d, 0x2d, 0x4d,
-    0x66, 0x39, 0x1f, 0x3a, 0x2d, 0x1b, 0x1b, 0x2d, 0x3a, 0x1f, 0x4e, 0x1f, 0x3a, 0x2d, 0x1b, 0x1b, 0x2d, 0x3a, 0x1f,
-    0x96, 0x3e, 0x04, 0x0d, 0x3e, 0x00, 0x03, 0x00, 0x6b, 0xff, 0xec, 0x04, 0xa9, 0x05, 0xc5, 0x00, 0x2a, 0x00, 0x39,
-    0x00, 0x4c, 0x00, 0x74, 0x40, 0x13, 0x3d, 0x18, 0x05, 0x03, 0x01, 0x05, 0x2f, 0x2e, 0x20, 0x19, 0x04, 0x04, 0x01,
-    0x23, 0x01, 0x02, 0x04, 0x03, 0x4a, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x22, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x00,
-    0x00, 0x00, 0x44, 0x4b, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x03, 0x01, 0x02, 0x02, 0x3d, 0x4b, 0x06, 0x01, 0x04, 0x04,
-    0x02, 0x5b, 0x03, 0x01, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x1b, 0x40, 0x20, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00,
-    0x00, 0x44, 0x4b, 0x00, 0x01, 0x01, 0x02, 0x59, 0x00, 0x02, 0x02, 0x3d, 0x4b, 0x06, 0x01, 0x04, 0x04, 0x03, 0x5b,
-    0x00, 0x03, 0x03, 0x45, 0x03, 0x4c, 0x59, 0x40, 0x0f, 0x2c, 0x2b, 0x49, 0x47, 0x2b, 0x39, 0x2c, 0x39, 0x23, 0x14,
-    0x1e, 0x2c, 0x07, 0x08, 0x18, 0x2b, 0x13, 0x34, 0x3e, 0x02, 0x37, 0x26, 0x26, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32,
-    0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x07, 0x01, 0x36, 0x36, 0x37, 0x33, 0x14, 0x06, 0x07, 0x17, 0x23, 0x27,
-    0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x05, 0x32, 0x36, 0x37, 0x01, 0x07, 0x0e, 0x03, 0x15, 0x14, 0x1e, 0x02, 0x03,
-    0x14, 0x16, 0x17, 0x37, 0x3e, 0x03, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x6b, 0x28, 0x48, 0x64, 0x3d,
-    0x43, 0x4f, 0x33, 0x5e, 0x84, 0x52, 0x47, 0x74, 0x51, 0x2c, 0x1f, 0x37, 0x4c, 0x2c, 0x5e, 0x01, 0x33, 0x23, 0x28,
-    0x01, 0xa7, 0x49, 0x46, 0xb5, 0xdd, 0x53, 0x4a, 0xb2, 0x62, 0x63, 0xa0, 0x70, 0x3d, 0x01, 0xb0, 0x47, 0x84, 0x39,
-    0xfe, 0xbd, 0x1c, 0x32, 0x3e, 0x21, 0x0b, 0x20, 0x3e, 0x5c, 0x3a, 0x32, 0x2d, 0x75, 0x1f, 0x28, 0x16, 0x09, 0x13,
-    0x25, 0x34, 0x21, 0x2b, 0x41, 0x2b, 0x16, 0x01, 0x75, 0x43, 0x72, 0x63, 0x59, 0x2b, 0x5b, 0xa2, 0x58, 0x55, 0x83,
-    0x59, 0x2e, 0x32, 0x55, 0x70, 0x3e, 0x35, 0x57, 0x4c, 0x44, 0x21, 0x50, 0xfe, 0x6d, 0x40, 0x98, 0x58, 0x80, 0xdb,
-    0x58, 0xed, 0x6e, 0x3f, 0x43, 0x3a, 0x68, 0x91, 0x9d, 0x34, 0x30, 0x01, 0xaf, 0x18, 0x29, 0x4e, 0x45, 0x39, 0x13,
-    0x33, 0x58, 0x42, 0x26, 0x03, 0xe6, 0x38, 0x75, 0x41, 0x5d, 0x15, 0x2e, 0x2f, 0x30, 0x17, 0x1e, 0x39, 0x2b, 0x1b,
-    0x20, 0x36, 0x47, 0x00, 0x01, 0x01, 0xee, 0x04, 0x21, 0x02, 0x8d, 0x06, 0x00, 0x00, 0x05, 0x00, 0x2d, 0x4b, 0xb0,
-    0x21, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x3e, 0x00, 0x4c, 0x1b, 0x40, 0x10,
-    0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x01, 0x00, 0x4d, 0x59, 0xb4, 0x12,
-    0x11, 0x02, 0x08, 0x16, 0x2b, 0x01, 0x03, 0x23, 0x13, 0x35, 0x33, 0x02, 0x8d, 0x15, 0x8a, 0x01, 0x9e, 0x05, 0x91,
-    0xfe, 0x90, 0x01, 0x60, 0x7f, 0x00, 0x00, 0x00, 0x01, 0x01, 0x65, 0xfe, 0x2a, 0x03, 0x75, 0x06, 0x6b, 0x00, 0x1b,
-    0x00, 0x06, 0xb3, 0x14, 0x07, 0x01, 0x30, 0x2b, 0x01, 0x34, 0x3e, 0x04, 0x37, 0x17, 0x0e, 0x02, 0x02, 0x15, 0x15,
-    0x14, 0x12, 0x16, 0x16, 0x17, 0x07, 0x2e, 0x05, 0x35, 0x01, 0x65, 0x2d, 0x4c, 0x63, 0x6d, 0x6e, 0x32, 0x27, 0x3e,
-    0x7b, 0x61, 0x3d, 0x3d, 0x61, 0x7b, 0x3e, 0x27, 0x32, 0x6f, 0x6d, 0x63, 0x4b, 0x2d, 0x02, 0x4f, 0x8f, 0xfc, 0xd7,
-    0xb2, 0x8a, 0x62, 0x1c, 0x7a, 0x2f, 0xa2, 0xe7, 0xfe, 0xd3, 0xbb, 0x0e, 0xbb, 0xfe, 0xd2, 0xe8, 0xa5, 0x32, 0x71,
-    0x1c, 0x61, 0x8b, 0xb1, 0xd7, 0xfc, 0x8f, 0x00, 0x00, 0x01, 0x01, 0x40, 0xfe, 0x2a, 0x03, 0x51, 0x06, 0x6b, 0x00,
-    0x1b, 0x00, 0x06, 0xb3, 0x14, 0x07, 0x01, 0x30, 0x2b, 0x01, 0x14, 0x0e, 0x04, 0x07, 0x27, 0x3e, 0x02, 0x12, 0x35,
-    0x35, 0x34, 0x02, 0x26, 0x26, 0x27, 0x37, 0x1e, 0x05, 0x15, 0x03, 0x51, 0x2d, 0x4c, 0x63, 0x6d, 0x6f, 0x32, 0x27,
-    0x3e, 0x7b, 0x61, 0x3d, 0x40, 0x65, 0x79, 0x39, 0x27, 0x32, 0x6f, 0x6d, 0x63, 0x4c, 0x2d, 0x02, 0x45, 0x8f, 0xfc,
-    0xd7, 0xb1, 0x8b, 0x61, 0x1c, 0x71, 0x2e, 0xa5, 0xea, 0x01, 0x30, 0xbb, 0x0e, 0xbb, 0x01, 0x31, 0xeb, 0xa4, 0x2e,
-    0x71, 0x1c, 0x62, 0x8a, 0xb2, 0xd7, 0xfc, 0x8f, 0x00, 0x00, 0x01, 0x00, 0xa0, 0x00, 0xf1, 0x04, 0x60, 0x04, 0xc8,
-    0x00, 0x0e, 0x00, 0x1a, 0x40, 0x17, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x03, 0x02, 0x01, 0x0c,
-    0x00, 0x47, 0x00, 0x00, 0x00, 0x69, 0x14, 0x01, 0x08, 0x15, 0x2b, 0x01, 0x25, 0x37, 0x05, 0x03, 0x33, 0x03, 0x25,
-    0x17, 0x05, 0x01, 0x07, 0x03, 0x03, 0x27, 0x02, 0x19, 0xfe, 0x87, 0x36, 0x01, 0x6d, 0x19, 0xb2, 0x1d, 0x01, 0x6b,
-    0x36, 0xfe, 0x82, 0x01, 0x00, 0x92, 0xd6, 0xd4, 0x92, 0x02, 0xab, 0x60, 0xaf, 0x97, 0x01, 0xa5, 0xfe, 0x55, 0x96,
-    0xb2, 0x5e, 0xfe, 0xbc, 0x6e, 0x01, 0x6b, 0xfe, 0x9e, 0x6a, 0x00, 0x01, 0x00, 0x77, 0x00, 0x92, 0x04, 0x5d, 0x04,
-    0xb6, 0x00, 0x0b, 0x00, 0x26, 0x40, 0x23, 0x00, 0x05, 0x00, 0x02, 0x05, 0x55, 0x04, 0x01, 0x00, 0x03, 0x01, 0x01,
-    0x02, 0x00, 0x01, 0x61, 0x00, 0x05, 0x05, 0x02, 0x59, 0x00, 0x02, 0x05, 0x02, 0x4d, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x10, 0x06, 0x08, 0x1a, 0x2b, 0x01, 0x21, 0x15, 0x21, 0x11, 0x23, 0x11, 0x21, 0x35, 0x21, 0x11, 0x33, 0x02, 0xc6,
-    0x01, 0x97, 0xfe, 0x69, 0xb9, 0xfe, 0x6a, 0x01, 0x96, 0xb9, 0x03, 0x0d, 0xb8, 0xfe, 0x3d, 0x01, 0xc3, 0xb8, 0x01,
-    0xa9, 0x00, 0x00, 0x00, 0x01, 0x01, 0x62, 0xfe, 0xb0, 0x02, 0x83, 0x00, 0xdb, 0x00, 0x0b, 0x00, 0x10, 0x40, 0x0d,
-    0x06, 0x05, 0x02, 0x00, 0x47, 0x00, 0x00, 0x00, 0x69, 0x1a, 0x01, 0x08, 0x15, 0x2b, 0x25, 0x14, 0x0e, 0x02, 0x07,
-    0x27, 0x36, 0x36, 0x35, 0x35, 0x33, 0x02, 0x83, 0x17, 0x2d, 0x40, 0x2a, 0x73, 0x30, 0x28, 0xc9, 0x2b, 0x2f, 0x67,
-    0x65, 0x5c, 0x24, 0x3f, 0x46, 0x9e, 0x55, 0xb3, 0x00, 0x00, 0x00, 0x01, 0x00, 0xda, 0x02, 0x31, 0x03, 0xd7, 0x02,
-    0xc9, 0x00, 0x03, 0x00, 0x18, 0x40, 0x15, 0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0x01, 0x00, 0x59, 0x00,
-    0x00, 0x01, 0x00, 0x4d, 0x11, 0x10, 0x02, 0x08, 0x16, 0x2b, 0x01, 0x21, 0x35, 0x21, 0x03, 0xd7, 0xfd, 0x03, 0x02,
-    0xfd, 0x02, 0x31, 0x98, 0x00, 0x00, 0x01, 0x01, 0xf0, 0xff, 0xed, 0x03, 0x14, 0x01, 0x07, 0x00, 0x13, 0x00, 0x13,
-    0x40, 0x10, 0x00, 0x00, 0x00, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x45, 0x01, 0x4c, 0x28, 0x24, 0x02, 0x08, 0x16, 0x2b,
-    0x25, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x01, 0xf0, 0x13,
-    0x24, 0x36, 0x24, 0x24, 0x37, 0x25, 0x13, 0x13, 0x25, 0x37, 0x24, 0x24, 0x36, 0x24, 0x13, 0x78, 0x1e, 0x34, 0x27,
-    0x16, 0x16, 0x27, 0x34, 0x1e, 0x1d, 0x33, 0x26, 0x15, 0x15, 0x26, 0x33, 0x00, 0x00, 0x01, 0x00, 0xfc, 0xff, 0x83,
-    0x04, 0x01, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x13, 0x40, 0x10, 0x00, 0x00, 0x01, 0x00, 0x73, 0x00, 0x01, 0x01, 0x3c,
-    0x01, 0x4c, 0x11, 0x10, 0x02, 0x08, 0x16, 0x2b, 0x05, 0x23, 0x01, 0x33, 0x01, 0xa2, 0xa6, 0x02, 0x60, 0xa5, 0x7d,
-    0x06, 0x2d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x91, 0xff, 0xec, 0x04, 0x40, 0x05, 0xc5, 0x00, 0x15, 0x00, 0x1d, 0x00,
-    0x25, 0x00, 0x28, 0x40, 0x25, 0x1f, 0x1e, 0x17, 0x16, 0x04, 0x03, 0x02, 0x01, 0x4a, 0x00, 0x02, 0x02, 0x01, 0x5b,
-    0x00, 0x01, 0x01, 0x44, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x26, 0x28, 0x29,
-    0x24, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x1e, 0x02, 0x15, 0x01, 0x01, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x05, 0x01, 0x16, 0x16, 0x33, 0x32, 0x36,
-    0x35, 0x04, 0x40, 0x40, 0x78, 0xae, 0x70, 0x6f, 0xaf, 0x7a, 0x41, 0x40, 0x79, 0xaf, 0x6f, 0x70, 0xaf, 0x79, 0x40,
-    0xfd, 0x0b, 0x02, 0x37, 0x10, 0x89, 0x81, 0x92, 0x8b, 0x02, 0x3b, 0xfd, 0xca, 0x11, 0x8c, 0x7d, 0x93, 0x89, 0x02,
-    0x2d, 0x8b, 0xd7, 0x93, 0x4c, 0x4c, 0x93, 0xd7, 0x8b, 0x01, 0x55, 0x8b, 0xd7, 0x94, 0x4d, 0x4d, 0x94, 0xd7, 0x8b,
-    0xfe, 0xd0, 0x01, 0xb3, 0x91, 0x97, 0xc5, 0xbd, 0x57, 0xfe, 0x4f, 0x8d, 0x94, 0xc8, 0xbc, 0x00, 0x00, 0x01, 0x00,
-    0xd0, 0x00, 0x00, 0x03, 0x06, 0x05, 0xb0, 0x00, 0x06, 0x00, 0x14, 0x40, 0x11, 0x05, 0x04, 0x03, 0x02, 0x04, 0x00,
-    0x48, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x10, 0x01, 0x08, 0x15, 0x2b, 0x21, 0x23, 0x11, 0x05, 0x35, 0x25, 0x33,
-    0x03, 0x06, 0xb9, 0xfe, 0x83, 0x02, 0x27, 0x0f, 0x04, 0xc4, 0x91, 0xa9, 0xd4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x55,
-    0x00, 0x00, 0x04, 0x2b, 0x05, 0xc4, 0x00, 0x24, 0x00, 0x2e, 0x40, 0x2b, 0x02, 0x01, 0x00, 0x04, 0x01, 0x4a, 0x00,
-    0x02, 0x01, 0x04, 0x01, 0x02, 0x04, 0x70, 0x00, 0x01, 0x01, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x44, 0x4b, 0x00, 0x04,
-    0x04, 0x00, 0x59, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x1a, 0x24, 0x14, 0x2b, 0x10, 0x05, 0x08, 0x19, 0x2b, 0x21,
-    0x21, 0x35, 0x01, 0x3e, 0x03, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x23, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x01, 0x21, 0x04, 0x2b, 0xfc, 0x46, 0x01, 0xdd, 0x40, 0x56, 0x34,
-    0x16, 0x23, 0x43, 0x5f, 0x3c, 0x49, 0x6b, 0x47, 0x23, 0xba, 0x40, 0x79, 0xaf, 0x70, 0x67, 0xa5, 0x72, 0x3d, 0x2c,
-    0x4b, 0x63, 0x37, 0xfe, 0x79, 0x02, 0xdb, 0x85, 0x02, 0x12, 0x47, 0x6e, 0x5d, 0x53, 0x2c, 0x36, 0x5f, 0x46, 0x29,
-    0x2a, 0x4d, 0x6e, 0x44, 0x5c, 0xa3, 0x7a, 0x48, 0x3d, 0x6c, 0x94, 0x57, 0x41, 0x7f, 0x7c, 0x79, 0x3c, 0xfe, 0x58,
-    0x00, 0x01, 0x00, 0x5e, 0xff, 0xec, 0x03, 0xf9, 0x05, 0xc4, 0x00, 0x3e, 0x00, 0x45, 0x40, 0x42, 0x1e, 0x01, 0x07,
-    0x00, 0x01, 0x4a, 0x00, 0x02, 0x01, 0x00, 0x01, 0x02, 0x00, 0x70, 0x00, 0x05, 0x07, 0x06, 0x07, 0x05, 0x06, 0x70,
-    0x00, 0x00, 0x00, 0x07, 0x05, 0x00, 0x07, 0x63, 0x00, 0x01, 0x01, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x44, 0x4b, 0x00,
-    0x06, 0x06, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x45, 0x04, 0x4c, 0x3e, 0x3c, 0x34, 0x32, 0x2e, 0x2d, 0x29, 0x27, 0x24,
-    0x14, 0x26, 0x20, 0x08, 0x08, 0x18, 0x2b, 0x01, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x23, 0x22, 0x0e, 0x02,
-    0x15, 0x23, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x1e, 0x03, 0x15, 0x14, 0x0e,
-    0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23,
-    0x23, 0x01, 0x86, 0x84, 0x46, 0x6b, 0x49, 0x26, 0x82, 0x7d, 0x3b, 0x61, 0x45, 0x26, 0xba, 0x41, 0x76, 0xa5, 0x65,
-    0x62, 0xa2, 0x74, 0x40, 0x1a, 0x36, 0x55, 0x3b, 0x47, 0x5f, 0x39, 0x17, 0x46, 0x7c, 0xa9, 0x62, 0x60, 0xa9, 0x7c,
-    0x49, 0xb9, 0x27, 0x48, 0x67, 0x3f, 0x3f, 0x66, 0x48, 0x27, 0x2d, 0x51, 0x73, 0x45, 0x84, 0x03, 0x31, 0x26, 0x42,
-    0x5c, 0x37, 0x7f, 0x81, 0x23, 0x42, 0x5c, 0x39, 0x53, 0x93, 0x6d, 0x3f, 0x35, 0x68, 0x9a, 0x65, 0x2a, 0x5a, 0x55,
-    0x4b, 0x19, 0x17, 0x4a, 0x5c, 0x66, 0x32, 0x66, 0x9e, 0x6d, 0x39, 0x36, 0x68, 0x96, 0x60, 0x39, 0x5e, 0x42, 0x24,
-    0x21, 0x44, 0x65, 0x45, 0x44, 0x63, 0x42, 0x20, 0x00, 0x02, 0x00, 0x4b, 0x00, 0x00, 0x04, 0x67, 0x05, 0xb0, 0x00,
-    0x0a, 0x00, 0x0e, 0x00, 0x2b, 0x40, 0x28, 0x0d, 0x01, 0x00, 0x04, 0x08, 0x01, 0x01, 0x00, 0x02, 0x4a, 0x05, 0x01,
-    0x00, 0x03, 0x01, 0x01, 0x02, 0x00, 0x01, 0x62, 0x00, 0x04, 0x04, 0x3c, 0x4b, 0x00, 0x02, 0x02, 0x3d, 0x02, 0x4c,
-    0x11, 0x12, 0x11, 0x11, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x01, 0x33, 0x15, 0x23, 0x11, 0x23, 0x11, 0x21, 0x35,
-    0x01, 0x33, 0x01, 0x21, 0x11, 0x07, 0x03, 0x9c, 0xcb, 0xcb, 0xb9, 0xfd, 0x68, 0x02, 0x8c, 0xc5, 0xfd, 0x7c, 0x01,
-    0xcb, 0x1e, 0x01, 0xe9, 0x97, 0xfe, 0xae, 0x01, 0x52, 0x6d, 0x03, 0xf1, 0xfc, 0x39, 0x02, 0xd1, 0x38, 0x00, 0x01,
-    0x00, 0xbb, 0xff, 0xec, 0x04, 0x4f, 0x05, 0xb0, 0x00, 0x2a, 0x00, 0x3c, 0x40, 0x39, 0x05, 0x01, 0x06, 0x02, 0x2a,
-    0x01, 0x04, 0x06, 0x02, 0x4a, 0x00, 0x04, 0x06, 0x05, 0x06, 0x04, 0x05, 0x70, 0x00, 0x02, 0x00, 0x06, 0x04, 0x02,
-    0x06, 0x63, 0x00, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x00, 0x3c, 0x4b, 0x00, 0x05, 0x05, 0x03, 0x5b, 0x00, 0x03,
-    0x03, 0x45, 0x03, 0x4c, 0x28, 0x22, 0x14, 0x28, 0x23, 0x11, 0x11, 0x07, 0x08, 0x1b, 0x2b, 0x13, 0x13, 0x21, 0x15,
-    0x21, 0x03, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x33, 0x16,
-    0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0xf0, 0x49, 0x02, 0xeb, 0xfd,
-    0xb1, 0x29, 0x2b, 0x78, 0x4f, 0x65, 0xa0, 0x70, 0x3c, 0x38, 0x71, 0xac, 0x74, 0x59, 0x9e, 0x7b, 0x4f, 0x0a, 0xb0,
-    0x11, 0x95, 0x75, 0x42, 0x66, 0x45, 0x23, 0x27, 0x4a, 0x6c, 0x46, 0x2e, 0x43, 0x36, 0x2f, 0x19, 0x02, 0xda, 0x02,
-    0xd6, 0xb4, 0xfe, 0x7c, 0x19, 0x26, 0x46, 0x7f, 0xb4, 0x6e, 0x68, 0xb2, 0x81, 0x49, 0x32, 0x64, 0x98, 0x65, 0x7c,
-    0x80, 0x2f, 0x57, 0x7a, 0x4b, 0x44, 0x76, 0x57, 0x32, 0x0d, 0x18, 0x22, 0x16, 0x00, 0x00, 0x00, 0x02, 0x00, 0x8d,
-    0xff, 0xec, 0x04, 0x25, 0x05, 0xb1, 0x00, 0x27, 0x00, 0x3c, 0x00, 0x3a, 0x40, 0x37, 0x09, 0x01, 0x04, 0x01, 0x2d,
-    0x01, 0x05, 0x04, 0x02, 0x4a, 0x00, 0x01, 0x06, 0x01, 0x04, 0x05, 0x01, 0x04, 0x63, 0x00, 0x00, 0x00, 0x03, 0x5b,
-    0x00, 0x03, 0x03, 0x3c, 0x4b, 0x00, 0x05, 0x05, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x45, 0x02, 0x4c, 0x29, 0x28, 0x34,
-    0x32, 0x28, 0x3c, 0x29, 0x3c, 0x1d, 0x28, 0x2a, 0x21, 0x07, 0x08, 0x18, 0x2b, 0x01, 0x15, 0x23, 0x22, 0x0e, 0x04,
-    0x07, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x04, 0x35, 0x35, 0x34, 0x3e,
-    0x04, 0x33, 0x03, 0x22, 0x0e, 0x02, 0x07, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02,
-    0x03, 0x58, 0x10, 0x5c, 0x91, 0x6e, 0x4f, 0x34, 0x1c, 0x04, 0x1a, 0x44, 0x4f, 0x5b, 0x32, 0x6d, 0x9e, 0x66, 0x30,
-    0x39, 0x72, 0xa9, 0x6f, 0x4f, 0x83, 0x68, 0x4e, 0x33, 0x1a, 0x19, 0x3c, 0x66, 0x9b, 0xd6, 0x8f, 0xe2, 0x2f, 0x58,
-    0x4c, 0x3a, 0x11, 0x2e, 0x4e, 0x66, 0x38, 0x41, 0x64, 0x45, 0x23, 0x20, 0x42, 0x64, 0x05, 0xb1, 0xa6, 0x26, 0x42,
-    0x5b, 0x6c, 0x76, 0x3d, 0x1f, 0x35, 0x27, 0x17, 0x53, 0x88, 0xac, 0x59, 0x66, 0xb4, 0x87, 0x4e, 0x2e, 0x4f, 0x6c,
-    0x7c, 0x86, 0x43, 0x57, 0x64, 0xc9, 0xb8, 0xa1, 0x76, 0x44, 0xfd, 0x70, 0x1e, 0x36, 0x4c, 0x2e, 0x3e, 0x60, 0x95,
-    0x66, 0x35, 0x32, 0x58, 0x7b, 0x48, 0x40, 0x79, 0x5e, 0x38, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x00, 0x04, 0x48,
-    0x05, 0xb0, 0x00, 0x06, 0x00, 0x1f, 0x40, 0x1c, 0x00, 0x01, 0x01, 0x02, 0x01, 0x4a, 0x00, 0x01, 0x01, 0x02, 0x59,
-    0x00, 0x02, 0x02, 0x3c, 0x4b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x11, 0x11, 0x11, 0x03, 0x08, 0x17, 0x2b, 0x01,
-    0x01, 0x23, 0x01, 0x21, 0x35, 0x21, 0x04, 0x48, 0xfd, 0xa5, 0xc2, 0x02, 0x59, 0xfc, 0xec, 0x03, 0xd8, 0x05, 0x48,
-    0xfa, 0xb8, 0x05, 0x0e, 0xa2, 0x00, 0x00, 0x00, 0x03, 0x00, 0xb1, 0xff, 0xec, 0x04, 0x4f, 0x05, 0xc4, 0x00, 0x25,
-    0x00, 0x39, 0x00, 0x4d, 0x00, 0x35, 0x40, 0x32, 0x17, 0x03, 0x02, 0x02, 0x05, 0x01, 0x4a, 0x00, 0x05, 0x00, 0x02,
-    0x03, 0x05, 0x02, 0x63, 0x00, 0x04, 0x04, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x44, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b,
-    0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x4a, 0x48, 0x40, 0x3e, 0x36, 0x34, 0x2c, 0x2a, 0x22, 0x20, 0x2c, 0x06, 0x08,
-    0x15, 0x2b, 0x01, 0x06, 0x06, 0x07, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e,
-    0x02, 0x37, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x03, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e,
-    0x02, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x03, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14,
-    0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x04, 0x2e, 0x01, 0x74, 0x61, 0x38, 0x5b, 0x41, 0x23, 0x49, 0x7d, 0xa8, 0x60,
-    0x62, 0xa9, 0x7d, 0x48, 0x22, 0x40, 0x5a, 0x38, 0x30, 0x4e, 0x36, 0x1e, 0x40, 0x71, 0x9d, 0x5d, 0x5c, 0x9e, 0x74,
-    0x42, 0x98, 0x29, 0x4a, 0x67, 0x3d, 0x3f, 0x66, 0x48, 0x27, 0x27, 0x48, 0x67, 0x40, 0x3d, 0x66, 0x49, 0x29, 0x22,
-    0x25, 0x41, 0x5a, 0x36, 0x36, 0x58, 0x40, 0x23, 0x23, 0x41, 0x59, 0x36, 0x35, 0x5a, 0x41, 0x24, 0x04, 0x34, 0x6d,
-    0xaa, 0x30, 0x18, 0x47, 0x5c, 0x6c, 0x3d, 0x63, 0x9a, 0x69, 0x37, 0x36, 0x69, 0x9a, 0x64, 0x3d, 0x6d, 0x5b, 0x48,
-    0x18, 0x18, 0x43, 0x53, 0x62, 0x36, 0x5f, 0x95, 0x66, 0x36, 0x36, 0x66, 0x95, 0xfc, 0xfa, 0x3d, 0x66, 0x49, 0x28,
-    0x28, 0x49, 0x66, 0x3d, 0x3f, 0x63, 0x44, 0x24, 0x24, 0x44, 0x63, 0x02, 0xe3, 0x37, 0x5c, 0x43, 0x25, 0x23, 0x42,
-    0x5d, 0x39, 0x39, 0x5b, 0x41, 0x23, 0x23, 0x41, 0x5c, 0x00, 0x02, 0x00, 0x95, 0xff, 0xff, 0x04, 0x29, 0x05, 0xc4,
-    0x00, 0x27, 0x00, 0x3c, 0x00, 0x43, 0x40, 0x40, 0x2d, 0x01, 0x04, 0x05, 0x07, 0x01, 0x01, 0x04, 0x02, 0x4a, 0x07,
-    0x01, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x63, 0x00, 0x05, 0x05, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x44, 0x4b, 0x06,
-    0x01, 0x00, 0x00, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x3d, 0x03, 0x4c, 0x29, 0x28, 0x01, 0x00, 0x34, 0x32, 0x28, 0x3c,
-    0x29, 0x3c, 0x25, 0x24, 0x17, 0x15, 0x0d, 0x0b, 0x00, 0x27, 0x01, 0x27, 0x08, 0x08, 0x14, 0x2b, 0x25, 0x32, 0x3e,
-    0x04, 0x37, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x04, 0x15, 0x15, 0x14,
-    0x0e, 0x04, 0x23, 0x23, 0x35, 0x13, 0x32, 0x3e, 0x02, 0x37, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15,
-    0x14, 0x1e, 0x02, 0x01, 0x75, 0x63, 0x96, 0x6f, 0x4a, 0x2f, 0x16, 0x03, 0x18, 0x3e, 0x4e, 0x5f, 0x38, 0x6c, 0x9d,
-    0x66, 0x30, 0x39, 0x71, 0xa9, 0x70, 0x54, 0x87, 0x67, 0x4a, 0x2f, 0x16, 0x12, 0x35, 0x60, 0x9a, 0xdc, 0x97, 0x13,
-    0xf0, 0x2f, 0x59, 0x4b, 0x3b, 0x11, 0x2d, 0x4d, 0x65, 0x39, 0x41, 0x64, 0x45, 0x24, 0x20, 0x41, 0x63, 0xa4, 0x23,
-    0x40, 0x57, 0x69, 0x75, 0x3d, 0x1e, 0x35, 0x28, 0x17, 0x55, 0x8a, 0xae, 0x58, 0x67, 0xb7, 0x89, 0x51, 0x2f, 0x53,
-    0x71, 0x83, 0x8f, 0x48, 0x43, 0x5d, 0xc3, 0xb6, 0xa1, 0x78, 0x46, 0xa5, 0x01, 0xdc, 0x1f, 0x39, 0x4d, 0x2f, 0x3c,
-    0x61, 0x98, 0x69, 0x38, 0x34, 0x5b, 0x7d, 0x48, 0x40, 0x7b, 0x60, 0x3b, 0x00, 0xff, 0xff, 0x02, 0x22, 0xff, 0xed,
-    0x03, 0x46, 0x04, 0x73, 0x02, 0x26, 0x00, 0x10, 0x32, 0x00, 0x01, 0x07, 0x00, 0x10, 0x00, 0x32, 0x03, 0x6c, 0x00,
-    0x09, 0xb1, 0x01, 0x01, 0xb8, 0x03, 0x6c, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x01, 0xe6, 0xfe, 0xb0, 0x03, 0x3d,
-    0x04, 0x73, 0x02, 0x27, 0x00, 0x10, 0x00, 0x29, 0x03, 0x6c, 0x01, 0x07, 0x00, 0x0e, 0x00, 0x84, 0x00, 0x00, 0x00,
-    0x09, 0xb1, 0x00, 0x01, 0xb8, 0x03, 0x6c, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xaa, 0x00, 0xc4,
-    0x03, 0xfa, 0x04, 0x4b, 0x00, 0x08, 0x00, 0x06, 0xb3, 0x07, 0x04, 0x01, 0x30, 0x2b, 0x01, 0x07, 0x17, 0x05, 0x15,
-    0x01, 0x35, 0x01, 0x15, 0x01, 0x96, 0x35, 0x35, 0x02, 0x64, 0xfc, 0xb0, 0x03, 0x50, 0x02, 0x97, 0x11, 0x12, 0xec,
-    0xc4, 0x01, 0x7b, 0x92, 0x01, 0x7a, 0xc4, 0x00, 0x00, 0x02, 0x00, 0xad, 0x01, 0x6d, 0x04, 0x2a, 0x03, 0xad, 0x00,
-    0x03, 0x00, 0x07, 0x00, 0x22, 0x40, 0x1f, 0x00, 0x01, 0x00, 0x00, 0x03, 0x01, 0x00, 0x61, 0x00, 0x03, 0x02, 0x02,
-    0x03, 0x55, 0x00, 0x03, 0x03, 0x02, 0x59, 0x00, 0x02, 0x03, 0x02, 0x4d, 0x11, 0x11, 0x11, 0x10, 0x04, 0x08, 0x18,
-    0x2b, 0x01, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x04, 0x2a, 0xfc, 0x83, 0x03, 0x7d, 0xfc, 0x83, 0x03, 0x7d,
-    0x03, 0x0c, 0xa1, 0xfd, 0xc0, 0xa0, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb2, 0x00, 0xc5, 0x04, 0x25, 0x04, 0x4c, 0x00,
-    0x08, 0x00, 0x06, 0xb3, 0x04, 0x01, 0x01, 0x30, 0x2b, 0x13, 0x35, 0x01, 0x15, 0x01, 0x35, 0x25, 0x37, 0x27, 0xb2,
-    0x03, 0x73, 0xfc, 0x8d, 0x02, 0x87, 0x3c, 0x3c, 0x03, 0x8d, 0xbf, 0xfe, 0x86, 0x92, 0xfe, 0x85, 0xc0, 0xf4, 0x11,
-    0x13, 0x00, 0x00, 0x00, 0x02, 0x00, 0xbf, 0xff, 0xf5, 0x04, 0x1b, 0x05, 0xc4, 0x00, 0x27, 0x00, 0x33, 0x00, 0xc4,
-    0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x25, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x03, 0x70, 0x06, 0x01, 0x03, 0x04,
-    0x00, 0x03, 0x04, 0x6e, 0x00, 0x00, 0x00, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x44, 0x4b, 0x00, 0x04, 0x04, 0x05, 0x5b,
-    0x00, 0x05, 0x05, 0x3d, 0x05, 0x4c, 0x1b, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40, 0x25, 0x00, 0x01, 0x00, 0x03, 0x00,
-    0x01, 0x03, 0x70, 0x06, 0x01, 0x03, 0x04, 0x00, 0x03, 0x04, 0x6e, 0x00, 0x00, 0x00, 0x02, 0x5b, 0x00, 0x02, 0x02,
-    0x44, 0x4b, 0x00, 0x04, 0x04, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x45, 0x05, 0x4c, 0x1b, 0x4b, 0xb0, 0x0e, 0x50, 0x58,
-    0x40, 0x25, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x03, 0x70, 0x06, 0x01, 0x03, 0x04, 0x00, 0x03, 0x04, 0x6e, 0x00,
-    0x00, 0x00, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x44, 0x4b, 0x00, 0x04, 0x04, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x3d, 0x05,
-    0x4c, 0x1b, 0x40, 0x25, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x03, 0x70, 0x06, 0x01, 0x03, 0x04, 0x00, 0x03, 0x04,
-    0x6e, 0x00, 0x00, 0x00, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x44, 0x4b, 0x00, 0x04, 0x04, 0x05, 0x5b, 0x00, 0x05, 0x05,
-    0x45, 0x05, 0x4c, 0x59, 0x59, 0x59, 0x40, 0x10, 0x00, 0x00, 0x32, 0x30, 0x2c, 0x2a, 0x00, 0x27, 0x00, 0x27, 0x24,
-    0x14, 0x2c, 0x07, 0x08, 0x17, 0x2b, 0x01, 0x3e, 0x03, 0x37, 0x3e, 0x03, 0x35, 0x34, 0x26, 0x23, 0x22, 0x0e, 0x02,
-    0x15, 0x23, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x0e, 0x03, 0x15, 0x03, 0x34, 0x36,
-    0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x01, 0xff, 0x01, 0x0a, 0x20, 0x3c, 0x32, 0x22, 0x47, 0x3b,
-    0x26, 0x7e, 0x75, 0x2f, 0x59, 0x45, 0x2a, 0xb9, 0x01, 0x44, 0x73, 0x9d, 0x5b, 0x65, 0x9f, 0x6e, 0x3a, 0x32, 0x4e,
-    0x61, 0x2f, 0x1e, 0x21, 0x10, 0x04, 0xce, 0x39, 0x39, 0x39, 0x3b, 0x3b, 0x39, 0x39, 0x39, 0x01, 0x9a, 0x48, 0x5d,
-    0x49, 0x43, 0x2e, 0x23, 0x4a, 0x51, 0x5a, 0x32, 0x6d, 0x73, 0x17, 0x31, 0x4b, 0x34, 0x54, 0x86, 0x5d, 0x31, 0x33,
-    0x62, 0x8c, 0x5a, 0x48, 0x7f, 0x71, 0x62, 0x2a, 0x1d, 0x34, 0x36, 0x3d, 0x27, 0xfe, 0xc7, 0x30, 0x40, 0x40, 0x30,
-    0x2e, 0x3e, 0x3e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x40, 0xff, 0xf8, 0x04, 0x8b, 0x05, 0xb2, 0x00, 0x4d, 0x00, 0x5b,
-    0x00, 0xa5, 0x4b, 0xb0, 0x14, 0x50, 0x58, 0x40, 0x14, 0x18, 0x01, 0x09, 0x02, 0x55, 0x4e, 0x08, 0x03, 0x03, 0x09,
-    0x37, 0x01, 0x05, 0x00, 0x38, 0x01, 0x06, 0x05, 0x04, 0x4a, 0x1b, 0x40, 0x17, 0x18, 0x01, 0x09, 0x02, 0x55, 0x4e,
-    0x02, 0x08, 0x09, 0x08, 0x01, 0x03, 0x08, 0x37, 0x01, 0x05, 0x00, 0x38, 0x01, 0x06, 0x05, 0x05, 0x4a, 0x59, 0x4b,
-    0xb0, 0x14, 0x50, 0x58, 0x40, 0x27, 0x00, 0x02, 0x00, 0x09, 0x03, 0x02, 0x09, 0x63, 0x08, 0x01, 0x03, 0x01, 0x01,
-    0x00, 0x05, 0x03, 0x00, 0x63, 0x00, 0x04, 0x04, 0x07, 0x5b, 0x00, 0x07, 0x07, 0x3c, 0x4b, 0x00, 0x05, 0x05, 0x06,
-    0x5b, 0x00, 0x06, 0x06, 0x3d, 0x06, 0x4c, 0x1b, 0x40, 0x2c, 0x00, 0x02, 0x00, 0x09, 0x08, 0x02, 0x09, 0x63, 0x00,
-    0x08, 0x03, 0x00, 0x08, 0x57, 0x00, 0x03, 0x01, 0x01, 0x00, 0x05, 0x03, 0x00, 0x63, 0x00, 0x04, 0x04, 0x07, 0x5b,
-    0x00, 0x07, 0x07, 0x3c, 0x4b, 0x00, 0x05, 0x05, 0x06, 0x5b, 0x00, 0x06, 0x06, 0x3d, 0x06, 0x4c, 0x59, 0x40, 0x0e,
-    0x58, 0x56, 0x26, 0x2a, 0x29, 0x28, 0x28, 0x27, 0x28, 0x24, 0x24, 0x0a, 0x08, 0x1d, 0x2b, 0x01, 0x0e, 0x03, 0x23,
-    0x22, 0x26, 0x27, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x3e, 0x03, 0x33, 0x32, 0x16, 0x17, 0x03, 0x06, 0x1e,
-    0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x06, 0x1e, 0x02, 0x33, 0x32,
-    0x3e, 0x02, 0x37, 0x17, 0x0e, 0x03, 0x23, 0x22, 0x26, 0x26, 0x02, 0x37, 0x3e, 0x05, 0x33, 0x32, 0x1e, 0x02, 0x01,
-    0x06, 0x16, 0x33, 0x32, 0x36, 0x37, 0x13, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x04, 0x87, 0x03, 0x20, 0x41, 0x66, 0x4a,
-    0x3d, 0x51, 0x11, 0x23, 0x67, 0x3e, 0x31, 0x48, 0x2d, 0x11, 0x06, 0x09, 0x38, 0x59, 0x76, 0x47, 0x43, 0x58, 0x1a,
-    0x2c, 0x03, 0x0a, 0x13, 0x1c, 0x10, 0x25, 0x39, 0x26, 0x14, 0x01, 0x04, 0x32, 0x67, 0x96, 0x60, 0x65, 0xa7, 0x7a,
-    0x46, 0x04, 0x05, 0x30, 0x6a, 0xa5, 0x70, 0x1e, 0x3e, 0x3c, 0x36, 0x16, 0x20, 0x19, 0x40, 0x46, 0x48, 0x20, 0x93,
-    0xd3, 0x85, 0x3b, 0x05, 0x04, 0x2a, 0x49, 0x67, 0x80, 0x99, 0x56, 0x7a, 0xbe, 0x81, 0x40, 0xfd, 0x4b, 0x05, 0x2c,
-    0x30, 0x31, 0x50, 0x1e, 0x27, 0x1c, 0x1e, 0x35, 0x4f, 0x36, 0x21, 0x03, 0x15, 0x50, 0xa7, 0x88, 0x56, 0x40, 0x39,
-    0x38, 0x41, 0x34, 0x5e, 0x82, 0x4e, 0x6f, 0xb3, 0x7d, 0x43, 0x35, 0x24, 0xfe, 0x08, 0x29, 0x33, 0x1d, 0x0a, 0x39,
-    0x61, 0x82, 0x49, 0x7f, 0xca, 0x8c, 0x4a, 0x5f, 0xaa, 0xec, 0x8c, 0x88, 0xd4, 0x93, 0x4d, 0x09, 0x11, 0x18, 0x0f,
-    0x75, 0x13, 0x1c, 0x13, 0x09, 0x67, 0xba, 0x01, 0x01, 0x99, 0x67, 0xc3, 0xaa, 0x8d, 0x66, 0x38, 0x5f, 0xb0, 0xf7,
-    0xfe, 0xf6, 0x66, 0x72, 0x36, 0x3f, 0x01, 0xbd, 0x0d, 0x33, 0x5d, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x51,
-    0x00, 0x00, 0x04, 0x90, 0x05, 0xb0, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x25, 0x40, 0x22, 0x0a, 0x01, 0x04, 0x02, 0x01,
-    0x4a, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x62, 0x00, 0x02, 0x02, 0x3c, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x3d,
-    0x01, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x10, 0x05, 0x08, 0x19, 0x2b, 0x01, 0x21, 0x03, 0x23, 0x01, 0x33, 0x01, 0x23,
-    0x01, 0x21, 0x03, 0x03, 0x65, 0xfe, 0x1a, 0x75, 0xb9, 0x01, 0xd6, 0x9b, 0x01, 0xce, 0xb8, 0xfd, 0xd9, 0x01, 0x83,
-    0xc0, 0x01, 0x79, 0xfe, 0x87, 0x05, 0xb0, 0xfa, 0x50, 0x02, 0x1a, 0x02, 0x78, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
-    0xac, 0x00, 0x00, 0x04, 0x60, 0x05, 0xb0, 0x00, 0x16, 0x00, 0x23, 0x00, 0x30, 0x00, 0x3e, 0x40, 0x3b, 0x0c, 0x01,
-    0x03, 0x04, 0x01, 0x4a, 0x00, 0x04, 0x07, 0x01, 0x03, 0x02, 0x04, 0x03, 0x63, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x00,
-    0x00, 0x00, 0x3c, 0x4b, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x06, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x17, 0x17, 0x00,
-    0x00, 0x30, 0x2e, 0x26, 0x24, 0x17, 0x23, 0x17, 0x22, 0x1a, 0x18, 0x00, 0x16, 0x00, 0x15, 0x21, 0x08, 0x08, 0x15,
-    0x2b, 0x33, 0x11, 0x21, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x07, 0x1e, 0x03, 0x15, 0x16, 0x0e, 0x02, 0x07, 0x01, 0x11,
-    0x21, 0x3e, 0x03, 0x35, 0x36, 0x2e, 0x02, 0x27, 0x25, 0x21, 0x3e, 0x03, 0x35, 0x34, 0x2e, 0x02, 0x27, 0x23, 0xac,
-    0x01, 0xb1, 0x5a, 0xac, 0x86, 0x50, 0x01, 0x01, 0x23, 0x3d, 0x52, 0x2e, 0x3a, 0x61, 0x46, 0x27, 0x01, 0x50, 0x86,
-    0xaf, 0x5d, 0xfe, 0xe8, 0x01, 0x1d, 0x3a, 0x68, 0x50, 0x2f, 0x01, 0x2b, 0x4c, 0x66, 0x3b, 0xfe, 0xd9, 0x01, 0x02,
-    0x34, 0x64, 0x4e, 0x30, 0x2f, 0x4f, 0x67, 0x36, 0xfd, 0x05, 0xb0, 0x01, 0x2d, 0x5e, 0x92, 0x66, 0x39, 0x5e, 0x4b,
-    0x38, 0x14, 0x11, 0x3f, 0x59, 0x70, 0x41, 0x66, 0x9c, 0x69, 0x38, 0x01, 0x02, 0xa9, 0xfd, 0xf4, 0x01, 0x25, 0x42,
-    0x60, 0x3d, 0x3e, 0x60, 0x43, 0x24, 0x02, 0x9a, 0x01, 0x1f, 0x3b, 0x56, 0x39, 0x3d, 0x56, 0x37, 0x1a, 0x01, 0x00,
-    0x00, 0x01, 0x00, 0x6b, 0xff, 0xec, 0x04, 0x5d, 0x05, 0xc4, 0x00, 0x33, 0x00, 0x36, 0x40, 0x33, 0x00, 0x02, 0x03,
-    0x05, 0x03, 0x02, 0x05, 0x70, 0x06, 0x01, 0x05, 0x04, 0x03, 0x05, 0x04, 0x6e, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00,
-    0x01, 0x01, 0x44, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x33,
-    0x00, 0x33, 0x2d, 0x24, 0x14, 0x2d, 0x24, 0x07, 0x08, 0x19, 0x2b, 0x01, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x04, 0x27,
-    0x35, 0x3e, 0x05, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x23, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x04, 0x15, 0x15, 0x14, 0x1e,
-    0x04, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x04, 0x5d, 0x0d, 0x4e, 0x7d, 0xab, 0x69, 0x5a, 0x93, 0x73, 0x53, 0x37, 0x1b,
-    0x01, 0x01, 0x1b, 0x37, 0x53, 0x73, 0x92, 0x5b, 0x6d, 0xac, 0x7c, 0x4b, 0x0c, 0xb9, 0x09, 0x2c, 0x4a, 0x6b, 0x49,
-    0x42, 0x65, 0x49, 0x31, 0x1e, 0x0d, 0x0d, 0x1e, 0x30, 0x4a, 0x64, 0x43, 0x49, 0x6b, 0x4a, 0x2c, 0x09, 0x01, 0xb6,
-    0x65, 0xa9, 0x79, 0x43, 0x33, 0x5a, 0x7a, 0x90, 0x9e, 0x51, 0xcb, 0x51, 0x9e, 0x90, 0x7b, 0x5a, 0x33, 0x43, 0x7b,
-    0xac, 0x68, 0x42, 0x72, 0x56, 0x31, 0x2b, 0x4a, 0x62, 0x6e, 0x73, 0x36, 0xcd, 0x36, 0x73, 0x6f, 0x62, 0x4b, 0x2b,
-    0x2e, 0x53, 0x71, 0x42, 0x00, 0x00, 0x00, 0x02, 0x00, 0x9b, 0x00, 0x00, 0x04, 0x70, 0x05, 0xb0, 0x00, 0x0d, 0x00,
-    0x1b, 0x00, 0x2c, 0x40, 0x29, 0x05, 0x01, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x3c, 0x4b, 0x00, 0x02, 0x02,
-    0x01, 0x5b, 0x04, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x0e, 0x0e, 0x00, 0x00, 0x0e, 0x1b, 0x0e, 0x1a, 0x11, 0x0f,
-    0x00, 0x0d, 0x00, 0x0c, 0x21, 0x06, 0x08, 0x15, 0x2b, 0x33, 0x11, 0x21, 0x1e, 0x03, 0x17, 0x15, 0x0e, 0x03, 0x07,
-    0x03, 0x11, 0x33, 0x3e, 0x03, 0x37, 0x35, 0x2e, 0x03, 0x27, 0x9b, 0x01, 0x51, 0x98, 0xef, 0xa5, 0x57, 0x01, 0x01,
-    0x57, 0xa5, 0xef, 0x98, 0x95, 0x95, 0x76, 0xac, 0x71, 0x37, 0x01, 0x01, 0x38, 0x70, 0xac, 0x76, 0x05, 0xb0, 0x02,
-    0x63, 0xb1, 0xf7, 0x96, 0x6b, 0x96, 0xf7, 0xb1, 0x63, 0x01, 0x05, 0x18, 0xfb, 0x7f, 0x01, 0x51, 0x8c, 0xbe, 0x6f,
-    0x6d, 0x6f, 0xbd, 0x8b, 0x50, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb6, 0x00, 0x00, 0x04, 0x34, 0x05, 0xb0,
-    0x00, 0x0b, 0x00, 0x29, 0x40, 0x26, 0x00, 0x05, 0x00, 0x00, 0x01, 0x05, 0x00, 0x61, 0x00, 0x04, 0x04, 0x03, 0x59,
-    0x00, 0x03, 0x03, 0x3c, 0x4b, 0x00, 0x01, 0x01, 0x02, 0x59, 0x00, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x01, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21,
-    0x03, 0xcf, 0xfd, 0xa0, 0x02, 0xc5, 0xfc, 0x82, 0x03, 0x75, 0xfd, 0x44, 0x02, 0x60, 0x02, 0xa1, 0xfd, 0xfc, 0x9d,
-    0x05, 0xb0, 0x9e, 0xfe, 0x2c, 0x00, 0x00, 0x01, 0x00, 0xbf, 0x00, 0x00, 0x04, 0x3d, 0x05, 0xb0, 0x00, 0x09, 0x00,
-    0x23, 0x40, 0x20, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x61, 0x00, 0x03, 0x03, 0x02, 0x59, 0x00, 0x02, 0x02,
-    0x3c, 0x4b, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x10, 0x05, 0x08, 0x19, 0x2b, 0x01, 0x21,
-    0x11, 0x23, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x03, 0xd8, 0xfd, 0xa2, 0xbb, 0x03, 0x7e, 0xfd, 0x3d, 0x02, 0x5e,
-    0x02, 0x83, 0xfd, 0x7d, 0x05, 0xb0, 0x9e, 0xfe, 0x0e, 0x00, 0x00, 0x01, 0x00, 0x64, 0xff, 0xeb, 0x04, 0x5c, 0x05,
-    0xc4, 0x00, 0x35, 0x00, 0x39, 0x40, 0x36, 0x31, 0x00, 0x02, 0x04, 0x05, 0x01, 0x4a, 0x00, 0x02, 0x03, 0x06, 0x03,
-    0x02, 0x06, 0x70, 0x00, 0x06, 0x00, 0x05, 0x04, 0x06, 0x05, 0x61, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01,
-    0x44, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x11, 0x15, 0x2d, 0x24, 0x14, 0x2d,
-    0x22, 0x07, 0x08, 0x1b, 0x2b, 0x25, 0x06, 0x06, 0x27, 0x2e, 0x05, 0x27, 0x35, 0x3e, 0x05, 0x33, 0x32, 0x1e, 0x02,
-    0x17, 0x23, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x04, 0x15, 0x15, 0x1e, 0x05, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x13, 0x21,
-    0x35, 0x21, 0x04, 0x5c, 0x5c, 0xee, 0x8e, 0x5a, 0x97, 0x78, 0x5a, 0x3d, 0x1f, 0x01, 0x01, 0x1b, 0x38, 0x54, 0x75,
-    0x94, 0x5c, 0x66, 0xac, 0x80, 0x4e, 0x09, 0xb7, 0x0b, 0x2e, 0x4b, 0x68, 0x45, 0x42, 0x66, 0x4c, 0x32, 0x20, 0x0e,
-    0x01, 0x11, 0x24, 0x38, 0x4f, 0x68, 0x42, 0x26, 0x53, 0x4e, 0x44, 0x17, 0x02, 0xfe, 0xd8, 0x01, 0xd8, 0xbf, 0x6c,
-    0x68, 0x01, 0x01, 0x35, 0x5d, 0x7e, 0x93, 0xa1, 0x52, 0xa9, 0x51, 0xa1, 0x94, 0x7f, 0x5d, 0x36, 0x3f, 0x75, 0xa5,
-    0x66, 0x3f, 0x6b, 0x4c, 0x2b, 0x2d, 0x4c, 0x65, 0x70, 0x74, 0x36, 0xab, 0x37, 0x75, 0x70, 0x64, 0x4c, 0x2d, 0x01,
-    0x01, 0x08, 0x18, 0x29, 0x21, 0x01, 0x47, 0x9c, 0x00, 0x00, 0x01, 0x00, 0x8d, 0x00, 0x00, 0x04, 0x3f, 0x05, 0xb0,
-    0x00, 0x0b, 0x00, 0x21, 0x40, 0x1e, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x61, 0x05, 0x01, 0x03, 0x03, 0x3c,
-    0x4b, 0x02, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x21,
-    0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x04, 0x3f, 0xaf, 0xfd, 0xab, 0xae, 0xae, 0x02,
-    0x55, 0xaf, 0x02, 0xa1, 0xfd, 0x5f, 0x05, 0xb0, 0xfd, 0x8e, 0x02, 0x72, 0x00, 0x00, 0x01, 0x00, 0xae, 0x00, 0x00,
-    0x04, 0x1e, 0x05, 0xb0, 0x00, 0x0b, 0x00, 0x23, 0x40, 0x20, 0x05, 0x01, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x00,
-    0x3c, 0x4b, 0x04, 0x01, 0x02, 0x02, 0x03, 0x59, 0x00, 0x03, 0x03, 0x3d, 0x03, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x10, 0x06, 0x08, 0x1a, 0x2b, 0x13, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0xae, 0x03,
-    0x70, 0xfe, 0xa3, 0x01, 0x5d, 0xfc, 0x90, 0x01, 0x55, 0xfe, 0xab, 0x05, 0xb0, 0xa1, 0xfb, 0x91, 0xa0, 0xa0, 0x04,
-    0x6f, 0x00, 0x00, 0x01, 0x00, 0x62, 0xff, 0xec, 0x04, 0x16, 0x05, 0xb0, 0x00, 0x17, 0x00, 0x22, 0x40, 0x1f, 0x00,
-    0x02, 0x00, 0x03, 0x00, 0x02, 0x03, 0x70, 0x00, 0x00, 0x00, 0x3c, 0x4b, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01,
-    0x01, 0x45, 0x01, 0x4c, 0x24, 0x14, 0x25, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x33, 0x11, 0x0e, 0x03, 0x23, 0x22,
-    0x2e, 0x02, 0x27, 0x33, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x03, 0x59, 0xbd, 0x02, 0x49, 0x7e, 0xab, 0x65,
-    0x66, 0xa7, 0x7b, 0x4a, 0x09, 0xbc, 0x03, 0x2b, 0x4a, 0x67, 0x40, 0x42, 0x68, 0x49, 0x27, 0x02, 0x05, 0xb0, 0xfc,
-    0x0b, 0x65, 0xaa, 0x7b, 0x45, 0x3e, 0x73, 0xa3, 0x65, 0x3d, 0x68, 0x4d, 0x2a, 0x31, 0x54, 0x6f, 0x3e, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0xac, 0x00, 0x00, 0x04, 0xa4, 0x05, 0xb0, 0x00, 0x0c, 0x00, 0x1f, 0x40, 0x1c, 0x0a, 0x06, 0x01,
-    0x03, 0x00, 0x01, 0x01, 0x4a, 0x02, 0x01, 0x01, 0x01, 0x3c, 0x4b, 0x03, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x12,
-    0x13, 0x11, 0x12, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x07, 0x11, 0x23, 0x11, 0x33, 0x11, 0x37, 0x01, 0x33, 0x01, 0x01,
-    0x23, 0x02, 0x0b, 0xa2, 0xbd, 0xbd, 0x8d, 0x01, 0xab, 0xe1, 0xfe, 0x03, 0x02, 0x1f, 0xe1, 0x02, 0xa4, 0xb8, 0xfe,
-    0x14, 0x05, 0xb0, 0xfd, 0x39, 0xb0, 0x02, 0x17, 0xfd, 0x83, 0xfc, 0xcd, 0x00, 0x01, 0x00, 0xc6, 0x00, 0x00, 0x04,
-    0x47, 0x05, 0xb0, 0x00, 0x05, 0x00, 0x19, 0x40, 0x16, 0x00, 0x02, 0x02, 0x3c, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x5a,
-    0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x11, 0x11, 0x10, 0x03, 0x08, 0x17, 0x2b, 0x25, 0x21, 0x15, 0x21, 0x11, 0x33,
-    0x01, 0x7f, 0x02, 0xc8, 0xfc, 0x7f, 0xb9, 0x9d, 0x9d, 0x05, 0xb0, 0x00, 0x01, 0x00, 0x94, 0x00, 0x00, 0x04, 0x4c,
-    0x05, 0xb0, 0x00, 0x0e, 0x00, 0x2e, 0x40, 0x2b, 0x0a, 0x07, 0x01, 0x03, 0x02, 0x00, 0x01, 0x4a, 0x00, 0x02, 0x00,
-    0x01, 0x00, 0x02, 0x01, 0x70, 0x05, 0x04, 0x02, 0x00, 0x00, 0x3c, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c,
-    0x00, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x13, 0x13, 0x11, 0x12, 0x06, 0x08, 0x18, 0x2b, 0x01, 0x13, 0x01, 0x33, 0x11,
-    0x23, 0x11, 0x13, 0x01, 0x23, 0x03, 0x13, 0x11, 0x23, 0x11, 0x01, 0x79, 0xed, 0x01, 0x00, 0xe6, 0xb4, 0x0f, 0xfe,
-    0xf3, 0x6a, 0xf7, 0x0f, 0xb4, 0x05, 0xb0, 0xfd, 0x28, 0x02, 0xd8, 0xfa, 0x50, 0x02, 0x45, 0x02, 0x60, 0xfc, 0xf0,
-    0x02, 0xfb, 0xfd, 0xb5, 0xfd, 0xbb, 0x05, 0xb0, 0x00, 0x00, 0x01, 0x00, 0x8f, 0x00, 0x00, 0x04, 0x3e, 0x05, 0xb0,
-    0x00, 0x09, 0x00, 0x1e, 0x40, 0x1b, 0x07, 0x02, 0x02, 0x00, 0x02, 0x01, 0x4a, 0x03, 0x01, 0x02, 0x02, 0x3c, 0x4b,
-    0x01, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x12, 0x11, 0x12, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x21, 0x23, 0x01, 0x03,
-    0x23, 0x11, 0x33, 0x01, 0x13, 0x33, 0x04, 0x3e, 0xbc, 0xfd, 0xcb, 0x03, 0xbb, 0xbc, 0x02, 0x35, 0x03, 0xbb, 0x04,
-    0x40, 0xfb, 0xc0, 0x05, 0xb0, 0xfb, 0xc2, 0x04, 0x3e, 0x00, 0x02, 0x00, 0x6a, 0xff, 0xec, 0x04, 0x61, 0x05, 0xc4,
-    0x00, 0x1d, 0x00, 0x3b, 0x00, 0x1f, 0x40, 0x1c, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x44, 0x4b, 0x00,
-    0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x2d, 0x2d, 0x2d, 0x26, 0x04, 0x08, 0x18, 0x2b, 0x01,
-    0x0e, 0x05, 0x23, 0x22, 0x2e, 0x04, 0x27, 0x35, 0x3e, 0x05, 0x33, 0x32, 0x1e, 0x04, 0x17, 0x27, 0x2e, 0x05, 0x23,
-    0x22, 0x0e, 0x04, 0x07, 0x15, 0x1e, 0x05, 0x33, 0x32, 0x3e, 0x04, 0x37, 0x04, 0x61, 0x01, 0x19, 0x34, 0x51, 0x70,
-    0x91, 0x5a, 0x5a, 0x91, 0x70, 0x52, 0x35, 0x1a, 0x01, 0x01, 0x19, 0x35, 0x51, 0x70, 0x91, 0x5a, 0x5a, 0x92, 0x70,
-    0x51, 0x35, 0x19, 0x01, 0xb7, 0x01, 0x0c, 0x1d, 0x30, 0x48, 0x62, 0x41, 0x40, 0x62, 0x48, 0x30, 0x1d, 0x0d, 0x01,
-    0x01, 0x0d, 0x1e, 0x30, 0x48, 0x62, 0x41, 0x41, 0x63, 0x47, 0x2f, 0x1d, 0x0b, 0x01, 0x02, 0x84, 0x4e, 0x9f, 0x94,
-    0x80, 0x60, 0x37, 0x37, 0x60, 0x81, 0x94, 0x9e, 0x4e, 0xa6, 0x4e, 0x9f, 0x94, 0x81, 0x61, 0x37, 0x37, 0x60, 0x81,
-    0x94, 0xa0, 0x4e, 0x02, 0x34, 0x71, 0x6f, 0x65, 0x4d, 0x2d, 0x2e, 0x4d, 0x65, 0x6f, 0x71, 0x33, 0xa8, 0x33, 0x72,
-    0x6f, 0x66, 0x4d, 0x2e, 0x2e, 0x4d, 0x65, 0x6f, 0x72, 0x34, 0x00, 0x00, 0x02, 0x00, 0xbf, 0x00, 0x00, 0x04, 0x79,
-    0x05, 0xb0, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x2b, 0x40, 0x28, 0x00, 0x03, 0x05, 0x01, 0x02, 0x00, 0x03, 0x02, 0x63,
-    0x00, 0x04, 0x04, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x3c, 0x4b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x00, 0x00, 0x1b,
-    0x19, 0x11, 0x0f, 0x00, 0x0e, 0x00, 0x0d, 0x21, 0x11, 0x06, 0x08, 0x16, 0x2b, 0x01, 0x11, 0x23, 0x11, 0x21, 0x1e,
-    0x03, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x25, 0x21, 0x3e, 0x03, 0x35, 0x34, 0x2e, 0x02, 0x27, 0x21, 0x01, 0x78, 0xb9,
-    0x01, 0xd8, 0x62, 0xaf, 0x84, 0x4d, 0x4d, 0x84, 0xaf, 0x62, 0xfe, 0xe1, 0x01, 0x1f, 0x40, 0x6c, 0x50, 0x2d, 0x2d,
-    0x4f, 0x6d, 0x40, 0xfe, 0xe1, 0x02, 0x48, 0xfd, 0xb8, 0x05, 0xb0, 0x02, 0x3a, 0x6e, 0xa2, 0x69, 0x69, 0xa1, 0x6e,
-    0x3a, 0x01, 0x98, 0x01, 0x27, 0x48, 0x67, 0x42, 0x42, 0x6a, 0x4a, 0x28, 0x01, 0x00, 0x00, 0x02, 0x00, 0x5e, 0xff,
-    0x0a, 0x04, 0x8c, 0x05, 0xc4, 0x00, 0x20, 0x00, 0x3e, 0x00, 0x2b, 0x40, 0x28, 0x08, 0x05, 0x02, 0x00, 0x03, 0x01,
-    0x4a, 0x07, 0x06, 0x02, 0x00, 0x47, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x44, 0x4b, 0x00, 0x03, 0x03,
-    0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x2d, 0x2d, 0x2d, 0x29, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x0e, 0x03,
-    0x07, 0x17, 0x07, 0x25, 0x06, 0x23, 0x22, 0x2e, 0x04, 0x27, 0x35, 0x3e, 0x05, 0x33, 0x32, 0x1e, 0x04, 0x17, 0x27,
-    0x2e, 0x05, 0x23, 0x22, 0x0e, 0x04, 0x15, 0x15, 0x14, 0x1e, 0x04, 0x33, 0x32, 0x3e, 0x04, 0x37, 0x04, 0x6e, 0x01,
-    0x1a, 0x35, 0x53, 0x3a, 0xfb, 0x7f, 0xfe, 0xe0, 0x3e, 0x48, 0x5d, 0x94, 0x73, 0x54, 0x36, 0x1a, 0x01, 0x01, 0x1a,
-    0x36, 0x52, 0x73, 0x95, 0x5d, 0x5d, 0x95, 0x73, 0x53, 0x35, 0x1a, 0x01, 0xb8, 0x01, 0x0b, 0x1d, 0x31, 0x4a, 0x67,
-    0x45, 0x44, 0x66, 0x4a, 0x31, 0x1e, 0x0d, 0x0d, 0x1e, 0x31, 0x4a, 0x67, 0x44, 0x45, 0x67, 0x4a, 0x30, 0x1d, 0x0b,
-    0x01, 0x02, 0x97, 0x51, 0xa4, 0x98, 0x85, 0x31, 0xd1, 0x79, 0xf4, 0x12, 0x39, 0x62, 0x85, 0x98, 0xa3, 0x50, 0x80,
-    0x50, 0xa4, 0x98, 0x85, 0x63, 0x39, 0x39, 0x62, 0x85, 0x98, 0xa5, 0x50, 0x02, 0x37, 0x77, 0x73, 0x68, 0x4f, 0x2e,
-    0x2f, 0x4f, 0x68, 0x73, 0x77, 0x36, 0x82, 0x36, 0x77, 0x74, 0x68, 0x50, 0x2f, 0x2f, 0x4f, 0x68, 0x74, 0x77, 0x37,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0xb5, 0x00, 0x00, 0x04, 0x72, 0x05, 0xb0, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x2b, 0x40,
-    0x28, 0x0f, 0x01, 0x00, 0x04, 0x01, 0x4a, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x61, 0x00, 0x05, 0x05, 0x02,
-    0x5b, 0x00, 0x02, 0x02, 0x3c, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x28, 0x21, 0x2a, 0x21, 0x11, 0x10,
-    0x06, 0x08, 0x1a, 0x2b, 0x01, 0x21, 0x11, 0x23, 0x11, 0x21, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x01, 0x07,
-    0x23, 0x01, 0x33, 0x3e, 0x03, 0x35, 0x34, 0x2e, 0x02, 0x27, 0x23, 0x02, 0x90, 0xfe, 0xdd, 0xb8, 0x01, 0xab, 0x66,
-    0xb4, 0x87, 0x4d, 0x29, 0x48, 0x64, 0x3c, 0x01, 0x35, 0x01, 0xc3, 0xfd, 0xbf, 0xf8, 0x3e, 0x6e, 0x53, 0x30, 0x2e,
-    0x52, 0x71, 0x43, 0xf3, 0x02, 0x52, 0xfd, 0xae, 0x05, 0xb0, 0x02, 0x36, 0x6c, 0xa3, 0x6e, 0x47, 0x76, 0x60, 0x4a,
-    0x1a, 0xfd, 0x92, 0x0c, 0x02, 0xea, 0x01, 0x25, 0x46, 0x65, 0x42, 0x46, 0x69, 0x47, 0x24, 0x01, 0x00, 0x00, 0x01,
-    0x00, 0x76, 0xff, 0xec, 0x04, 0x69, 0x05, 0xc4, 0x00, 0x3f, 0x00, 0x33, 0x40, 0x30, 0x00, 0x01, 0x02, 0x04, 0x02,
-    0x01, 0x04, 0x70, 0x00, 0x04, 0x05, 0x02, 0x04, 0x05, 0x6e, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x44,
-    0x4b, 0x00, 0x05, 0x05, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x45, 0x03, 0x4c, 0x3c, 0x3a, 0x36, 0x35, 0x31, 0x2f, 0x24,
-    0x14, 0x2e, 0x06, 0x08, 0x17, 0x2b, 0x01, 0x34, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32,
-    0x1e, 0x02, 0x17, 0x23, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x1e, 0x03, 0x17, 0x1e, 0x05, 0x15, 0x14, 0x0e,
-    0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x33, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x03, 0xa8, 0x3d, 0x60, 0x73, 0x35,
-    0x4d, 0x9f, 0x83, 0x53, 0x53, 0x86, 0xaa, 0x56, 0x5f, 0xb0, 0x88, 0x52, 0x02, 0xbe, 0x08, 0x2e, 0x4c, 0x69, 0x42,
-    0x35, 0x65, 0x4f, 0x2f, 0x01, 0x3e, 0x5f, 0x6f, 0x31, 0x36, 0x6e, 0x66, 0x58, 0x42, 0x25, 0x57, 0x8a, 0xae, 0x57,
-    0x61, 0xba, 0x93, 0x5c, 0x03, 0xbd, 0x09, 0x38, 0x58, 0x73, 0x44, 0x36, 0x69, 0x52, 0x34, 0x01, 0x70, 0x43, 0x5c,
-    0x3f, 0x2a, 0x11, 0x19, 0x46, 0x66, 0x8b, 0x5e, 0x5e, 0x94, 0x66, 0x35, 0x3f, 0x72, 0xa2, 0x64, 0x3f, 0x67, 0x4a,
-    0x29, 0x1e, 0x3c, 0x58, 0x3a, 0x3f, 0x57, 0x3c, 0x28, 0x0f, 0x11, 0x2b, 0x38, 0x46, 0x59, 0x6b, 0x41, 0x62, 0x92,
-    0x61, 0x31, 0x3c, 0x71, 0xa3, 0x68, 0x44, 0x69, 0x49, 0x25, 0x1b, 0x39, 0x57, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x00,
-    0x04, 0x84, 0x05, 0xb0, 0x00, 0x07, 0x00, 0x1b, 0x40, 0x18, 0x02, 0x01, 0x00, 0x00, 0x03, 0x59, 0x00, 0x03, 0x03,
-    0x3c, 0x4b, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x21, 0x11,
-    0x23, 0x11, 0x21, 0x35, 0x21, 0x04, 0x84, 0xfe, 0x3e, 0xb4, 0xfe, 0x3e, 0x04, 0x38, 0x05, 0x12, 0xfa, 0xee, 0x05,
-    0x12, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x8b, 0xff, 0xec, 0x04, 0x42, 0x05, 0xb0, 0x00, 0x19, 0x00, 0x21,
-    0x40, 0x1e, 0x04, 0x03, 0x02, 0x01, 0x01, 0x3c, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00,
-    0x4c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x19, 0x25, 0x15, 0x25, 0x05, 0x08, 0x17, 0x2b, 0x01, 0x13, 0x0e, 0x03, 0x23,
-    0x22, 0x2e, 0x02, 0x27, 0x13, 0x33, 0x13, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x13, 0x04, 0x40, 0x02, 0x02,
-    0x46, 0x7e, 0xae, 0x68, 0x6a, 0xae, 0x7c, 0x46, 0x01, 0x02, 0xb0, 0x04, 0x01, 0x27, 0x49, 0x6d, 0x47, 0x47, 0x6c,
-    0x49, 0x26, 0x02, 0x03, 0x05, 0xb0, 0xfc, 0x26, 0x66, 0xb2, 0x85, 0x4d, 0x4c, 0x85, 0xb3, 0x66, 0x03, 0xda, 0xfc,
-    0x26, 0x41, 0x78, 0x5c, 0x38, 0x37, 0x5d, 0x78, 0x41, 0x03, 0xda, 0x00, 0x01, 0x00, 0x47, 0x00, 0x00, 0x04, 0x7f,
-    0x05, 0xb0, 0x00, 0x06, 0x00, 0x15, 0x40, 0x12, 0x02, 0x01, 0x00, 0x00, 0x3c, 0x4b, 0x00, 0x01, 0x01, 0x3d, 0x01,
-    0x4c, 0x11, 0x11, 0x11, 0x03, 0x08, 0x17, 0x2b, 0x01, 0x01, 0x33, 0x01, 0x23, 0x01, 0x33, 0x02, 0x62, 0x01, 0x58,
-    0xc5, 0xfe, 0x35, 0xa1, 0xfe, 0x34, 0xc6, 0x01, 0x2a, 0x04, 0x86, 0xfa, 0x50, 0x05, 0xb0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x49, 0x00, 0x00, 0x04, 0x9e, 0x05, 0xb0, 0x00, 0x0c, 0x00, 0x20, 0x40, 0x1d, 0x0a, 0x05, 0x02, 0x01,
-    0x00, 0x01, 0x4a, 0x04, 0x03, 0x02, 0x00, 0x00, 0x3c, 0x4b, 0x02, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x12, 0x11,
-    0x12, 0x11, 0x11, 0x05, 0x08, 0x19, 0x2b, 0x01, 0x13, 0x33, 0x03, 0x23, 0x03, 0x03, 0x23, 0x03, 0x33, 0x13, 0x13,
-    0x33, 0x03, 0x80, 0x6f, 0xaf, 0xb1, 0xbd, 0xbb, 0xbd, 0xbe, 0xb1, 0xb0, 0x6f, 0xbb, 0xa1, 0x01, 0x8a, 0x04, 0x26,
-    0xfa, 0x50, 0x04, 0x49, 0xfb, 0xb7, 0x05, 0xb0, 0xfb, 0xda, 0x04, 0x26, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x57,
-    0x00, 0x00, 0x04, 0x8f, 0x05, 0xb0, 0x00, 0x0b, 0x00, 0x1f, 0x40, 0x1c, 0x09, 0x06, 0x03, 0x03, 0x01, 0x00, 0x01,
-    0x4a, 0x03, 0x01, 0x00, 0x00, 0x3c, 0x4b, 0x02, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x12, 0x12, 0x12, 0x11, 0x04,
-    0x08, 0x18, 0x2b, 0x01, 0x01, 0x33, 0x01, 0x01, 0x23, 0x01, 0x01, 0x23, 0x01, 0x01, 0x33, 0x02, 0x71, 0x01, 0x3a,
-    0xda, 0xfe, 0x59, 0x01, 0xb1, 0xd8, 0xfe, 0xbe, 0xfe, 0xbd, 0xdb, 0x01, 0xb2, 0xfe, 0x59, 0xd9, 0x03, 0x75, 0x02,
-    0x3b, 0xfd, 0x2e, 0xfd, 0x22, 0x02, 0x46, 0xfd, 0xba, 0x02, 0xde, 0x02, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x3d, 0x00, 0x00, 0x04, 0x79, 0x05, 0xb0, 0x00, 0x08, 0x00, 0x1c, 0x40, 0x19, 0x06, 0x03, 0x02, 0x01, 0x00, 0x01,
-    0x4a, 0x02, 0x01, 0x00, 0x00, 0x3c, 0x4b, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x12, 0x12, 0x11, 0x03, 0x08, 0x17,
-    0x2b, 0x01, 0x01, 0x33, 0x01, 0x03, 0x23, 0x03, 0x01, 0x33, 0x02, 0x5b, 0x01, 0x4c, 0xd2, 0xfe, 0x3b, 0x03, 0xac,
-    0x03, 0xfe, 0x3b, 0xd3, 0x02, 0xd5, 0x02, 0xdb, 0xfc, 0x6f, 0xfd, 0xe1, 0x02, 0x1f, 0x03, 0x91, 0x00, 0x01, 0x00,
-    0x72, 0x00, 0x00, 0x04, 0x37, 0x05, 0xb0, 0x00, 0x09, 0x00, 0x29, 0x40, 0x26, 0x09, 0x01, 0x02, 0x03, 0x04, 0x01,
-    0x01, 0x00, 0x02, 0x4a, 0x00, 0x02, 0x02, 0x03, 0x59, 0x00, 0x03, 0x03, 0x3c, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x59,
-    0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x11, 0x12, 0x11, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x25, 0x21, 0x15, 0x21, 0x27,
-    0x01, 0x21, 0x35, 0x21, 0x17, 0x01, 0x45, 0x02, 0xf2, 0xfc, 0x3d, 0x02, 0x02, 0xd5, 0xfd, 0x38, 0x03, 0x9b, 0x02,
-    0x9d, 0x9d, 0x90, 0x04, 0x82, 0x9e, 0x8d, 0x00, 0x00, 0x00, 0x01, 0x01, 0xaa, 0xfe, 0xc8, 0x03, 0x36, 0x06, 0x80,
-    0x00, 0x07, 0x00, 0x22, 0x40, 0x1f, 0x00, 0x03, 0x00, 0x00, 0x01, 0x03, 0x00, 0x61, 0x00, 0x01, 0x02, 0x02, 0x01,
-    0x55, 0x00, 0x01, 0x01, 0x02, 0x59, 0x00, 0x02, 0x01, 0x02, 0x4d, 0x11, 0x11, 0x11, 0x10, 0x04, 0x08, 0x18, 0x2b,
-    0x01, 0x23, 0x11, 0x33, 0x15, 0x21, 0x11, 0x21, 0x03, 0x36, 0xdd, 0xdd, 0xfe, 0x74, 0x01, 0x8c, 0x05, 0xe8, 0xf9,
-    0x78, 0x98, 0x07, 0xb8, 0x00, 0x00, 0x01, 0x00, 0xe7, 0xff, 0x83, 0x03, 0xee, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x13,
-    0x40, 0x10, 0x00, 0x01, 0x00, 0x01, 0x73, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x4c, 0x11, 0x10, 0x02, 0x08, 0x16, 0x2b,
-    0x13, 0x33, 0x01, 0x23, 0xe7, 0xa7, 0x02, 0x60, 0xa7, 0x05, 0xb0, 0xf9, 0xd3, 0x00, 0x00, 0x00, 0x01, 0x01, 0x95,
-    0xfe, 0xc8, 0x03, 0x22, 0x06, 0x80, 0x00, 0x07, 0x00, 0x22, 0x40, 0x1f, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x03,
-    0x61, 0x00, 0x02, 0x01, 0x01, 0x02, 0x55, 0x00, 0x02, 0x02, 0x01, 0x59, 0x00, 0x01, 0x02, 0x01, 0x4d, 0x11, 0x11,
-    0x11, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x21, 0x11, 0x21, 0x35, 0x33, 0x11, 0x23, 0x01, 0x95, 0x01, 0x8d, 0xfe,
-    0x73, 0xde, 0xde, 0x06, 0x80, 0xf8, 0x48, 0x98, 0x06, 0x88, 0x00, 0x00, 0x01, 0x00, 0xe7, 0x02, 0xa5, 0x03, 0xe5,
-    0x05, 0xb0, 0x00, 0x08, 0x00, 0x1b, 0x40, 0x18, 0x07, 0x01, 0x00, 0x01, 0x01, 0x4a, 0x02, 0x01, 0x00, 0x01, 0x00,
-    0x73, 0x00, 0x01, 0x01, 0x3c, 0x01, 0x4c, 0x11, 0x11, 0x10, 0x03, 0x08, 0x17, 0x2b, 0x01, 0x23, 0x01, 0x33, 0x01,
-    0x23, 0x03, 0x27, 0x07, 0x01, 0x93, 0xac, 0x01, 0x40, 0x7f, 0x01, 0x3f, 0xab, 0xc6, 0x0f, 0x0f, 0x02, 0xa5, 0x03,
-    0x0b, 0xfc, 0xf5, 0x01, 0xe6, 0x44, 0x44, 0x00, 0x01, 0x00, 0x9b, 0xff, 0x69, 0x04, 0x30, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x18, 0x40, 0x15, 0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x01, 0x00,
-    0x4d, 0x11, 0x10, 0x02, 0x08, 0x16, 0x2b, 0x05, 0x21, 0x35, 0x21, 0x04, 0x30, 0xfc, 0x6b, 0x03, 0x95, 0x97, 0x97,
-    0x00, 0x00, 0x00, 0x01, 0x01, 0x9f, 0x04, 0xbf, 0x03, 0x2d, 0x05, 0xc9, 0x00, 0x03, 0x00, 0xda, 0x4b, 0xb0, 0x0a,
-    0x50, 0x58, 0x40, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x73, 0x00, 0x01, 0x01, 0x3c, 0x01, 0x4c, 0x1b, 0x4b, 0xb0, 0x0c,
-    0x50, 0x58, 0x40, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x73, 0x00, 0x01, 0x01, 0x3e, 0x01, 0x4c, 0x1b, 0x4b, 0xb0, 0x0e,
-    0x50, 0x58, 0x40, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x73, 0x00, 0x01, 0x01, 0x3c, 0x01, 0x4c, 0x1b, 0x4b, 0xb0, 0x10,
-    0x50, 0x58, 0x40, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x73, 0x00, 0x01, 0x01, 0x3e, 0x01, 0x4c, 0x1b, 0x4b, 0xb0, 0x12,
-    0x50, 0x58, 0x40, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x73, 0x00, 0x01, 0x01, 0x3c, 0x01, 0x4c, 0x1b, 0x4b, 0xb0, 0x16,
-    0x50, 0x58, 0x40, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x73, 0x00, 0x01, 0x01, 0x3e, 0x01, 0x4c, 0x1b, 0x4b, 0xb0, 0x17,
-    0x50, 0x58, 0x40, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x73, 0x00, 0x01, 0x01, 0x3c, 0x01, 0x4c, 0x1b, 0x4b, 0xb0, 0x19,
-    0x50, 0x58, 0x40, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x73, 0x00, 0x01, 0x01, 0x3e, 0x01, 0x4c, 0x1b, 0x4b, 0xb0, 0x1b,
-    0x50, 0x58, 0x40, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x73, 0x00, 0x01, 0x01, 0x3c, 0x01, 0x4c, 0x1b, 0x4b, 0xb0, 0x2a,
-    0x50, 0x58, 0x40, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x73, 0x00, 0x01, 0x01, 0x3e, 0x01, 0x4c, 0x1b, 0x40, 0x09, 0x00,
-    0x01, 0x00, 0x01, 0x72, 0x00, 0x00, 0x00, 0x69, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0xb4,
-    0x11, 0x10, 0x02, 0x08, 0x16, 0x2b, 0x01, 0x23, 0x03, 0x33, 0x03, 0x2d, 0x96, 0xf8, 0xdf, 0x04, 0xbf, 0x01, 0x0a,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x9c, 0xff, 0xec, 0x04, 0x36, 0x04, 0x4e, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x44,
-    0x40, 0x41, 0x34, 0x01, 0x05, 0x06, 0x2d, 0x03, 0x02, 0x00, 0x05, 0x02, 0x4a, 0x00, 0x03, 0x02, 0x01, 0x02, 0x03,
-    0x01, 0x70, 0x00, 0x01, 0x00, 0x06, 0x05, 0x01, 0x06, 0x63, 0x00, 0x02, 0x02, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x47,
-    0x4b, 0x07, 0x01, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x30, 0x2f, 0x37, 0x35, 0x2f, 0x3d,
-    0x30, 0x3d, 0x24, 0x14, 0x25, 0x28, 0x27, 0x08, 0x08, 0x19, 0x2b, 0x21, 0x26, 0x26, 0x27, 0x0e, 0x03, 0x23, 0x22,
-    0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x33, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x23, 0x3e,
-    0x03, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x14, 0x16, 0x17, 0x15, 0x25, 0x32, 0x3e, 0x02, 0x37, 0x35, 0x23, 0x22,
-    0x06, 0x15, 0x14, 0x1e, 0x02, 0x03, 0x75, 0x0b, 0x0d, 0x03, 0x1c, 0x45, 0x53, 0x5e, 0x35, 0x56, 0x8b, 0x61, 0x35,
-    0x47, 0x82, 0xb7, 0x71, 0xca, 0x24, 0x42, 0x5f, 0x3b, 0x37, 0x57, 0x3c, 0x21, 0xba, 0x01, 0x3b, 0x6f, 0x9f, 0x65,
-    0x5c, 0x9e, 0x73, 0x42, 0x14, 0x12, 0xfd, 0xf8, 0x36, 0x5e, 0x4d, 0x38, 0x10, 0xac, 0xa2, 0xb4, 0x1b, 0x36, 0x52,
-    0x15, 0x3f, 0x22, 0x1c, 0x32, 0x26, 0x16, 0x32, 0x55, 0x75, 0x44, 0x59, 0x86, 0x59, 0x2c, 0x55, 0x31, 0x4e, 0x37,
-    0x1e, 0x1c, 0x2e, 0x3f, 0x22, 0x3b, 0x72, 0x5b, 0x38, 0x2d, 0x5b, 0x88, 0x5b, 0xfe, 0x09, 0x36, 0x79, 0x2d, 0x10,
-    0x8d, 0x1c, 0x2e, 0x3b, 0x20, 0xdb, 0x60, 0x67, 0x28, 0x44, 0x31, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xaf,
-    0xff, 0xec, 0x04, 0x43, 0x06, 0x00, 0x00, 0x15, 0x00, 0x2b, 0x00, 0xa2, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x0f,
-    0x0d, 0x01, 0x04, 0x03, 0x21, 0x20, 0x02, 0x05, 0x04, 0x08, 0x01, 0x00, 0x05, 0x03, 0x4a, 0x1b, 0x40, 0x0f, 0x0d,
-    0x01, 0x04, 0x03, 0x21, 0x20, 0x02, 0x05, 0x04, 0x08, 0x01, 0x01, 0x05, 0x03, 0x4a, 0x59, 0x4b, 0xb0, 0x19, 0x50,
-    0x58, 0x40, 0x1b, 0x00, 0x02, 0x02, 0x3e, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x47, 0x4b, 0x00,
-    0x05, 0x05, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x21, 0x50, 0x58, 0x40, 0x1f,
-    0x00, 0x02, 0x02, 0x3e, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x47, 0x4b, 0x00, 0x01, 0x01, 0x3d,
-    0x4b, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x1b, 0x40, 0x1f, 0x00, 0x04, 0x04, 0x03,
-    0x5b, 0x00, 0x03, 0x03, 0x47, 0x4b, 0x00, 0x02, 0x02, 0x01, 0x59, 0x00, 0x01, 0x01, 0x3d, 0x4b, 0x00, 0x05, 0x05,
-    0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x59, 0x59, 0x40, 0x09, 0x29, 0x29, 0x23, 0x11, 0x13, 0x24, 0x06,
-    0x08, 0x1a, 0x2b, 0x01, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x07, 0x23, 0x11, 0x33, 0x11, 0x36, 0x36, 0x33,
-    0x32, 0x1e, 0x02, 0x15, 0x23, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x11, 0x1e, 0x03, 0x33, 0x32, 0x3e,
-    0x02, 0x35, 0x04, 0x43, 0x38, 0x6c, 0x9f, 0x67, 0x68, 0x99, 0x36, 0x09, 0xaa, 0xb9, 0x35, 0x96, 0x64, 0x68, 0xa0,
-    0x6c, 0x38, 0xb9, 0x1f, 0x44, 0x6e, 0x50, 0x30, 0x50, 0x3f, 0x31, 0x11, 0x12, 0x31, 0x40, 0x50, 0x30, 0x4c, 0x6d,
-    0x45, 0x21, 0x02, 0x11, 0x74, 0xc9, 0x94, 0x54, 0x4a, 0x45, 0x7b, 0x06, 0x00, 0xfd, 0xc6, 0x42, 0x46, 0x52, 0x92,
-    0xcb, 0x79, 0x4f, 0x8f, 0x6d, 0x40, 0x19, 0x2d, 0x3d, 0x24, 0xfe, 0x27, 0x24, 0x3d, 0x2e, 0x19, 0x3f, 0x6c, 0x8e,
-    0x4f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x8f, 0xff, 0xec, 0x04, 0x33, 0x04, 0x4e, 0x00, 0x2b, 0x00, 0x3b, 0x40, 0x38,
-    0x00, 0x04, 0x05, 0x01, 0x05, 0x04, 0x01, 0x70, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x6e, 0x00, 0x05, 0x05, 0x03,
-    0x5b, 0x00, 0x03, 0x03, 0x47, 0x4b, 0x06, 0x01, 0x00, 0x00, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x45, 0x02, 0x4c, 0x01,
-    0x00, 0x22, 0x20, 0x1c, 0x1b, 0x17, 0x15, 0x0c, 0x0a, 0x06, 0x05, 0x00, 0x2b, 0x01, 0x2b, 0x07, 0x08, 0x14, 0x2b,
-    0x25, 0x32, 0x3e, 0x02, 0x37, 0x33, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32,
-    0x1e, 0x02, 0x15, 0x23, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x02, 0x7b, 0x32, 0x5f,
-    0x4a, 0x2d, 0x01, 0xaf, 0x01, 0x49, 0x7a, 0x9e, 0x56, 0x7b, 0xb8, 0x7b, 0x3e, 0x3e, 0x7b, 0xb8, 0x7b, 0x60, 0xa1,
-    0x75, 0x42, 0xaf, 0x01, 0x29, 0x46, 0x61, 0x38, 0x56, 0x75, 0x48, 0x1f, 0x1f, 0x47, 0x75, 0x82, 0x20, 0x39, 0x4d,
-    0x2d, 0x48, 0x83, 0x63, 0x3b, 0x58, 0x95, 0xc3, 0x6c, 0x2a, 0x6b, 0xc4, 0x95, 0x58, 0x3d, 0x69, 0x90, 0x52, 0x31,
-    0x57, 0x42, 0x26, 0x45, 0x6f, 0x8a, 0x46, 0x2a, 0x47, 0x8b, 0x6f, 0x45, 0x00, 0x02, 0x00, 0x8b, 0xff, 0xec, 0x04,
-    0x1c, 0x06, 0x00, 0x00, 0x15, 0x00, 0x29, 0x00, 0x8a, 0x40, 0x0f, 0x08, 0x01, 0x05, 0x00, 0x21, 0x20, 0x02, 0x04,
-    0x05, 0x0d, 0x01, 0x02, 0x04, 0x03, 0x4a, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x1b, 0x00, 0x01, 0x01, 0x3e, 0x4b,
-    0x00, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x03, 0x01, 0x02, 0x02,
-    0x3d, 0x02, 0x4c, 0x1b, 0x4b, 0xb0, 0x21, 0x50, 0x58, 0x40, 0x1f, 0x00, 0x01, 0x01, 0x3e, 0x4b, 0x00, 0x05, 0x05,
-    0x00, 0x5b, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x02, 0x02, 0x3d, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03,
-    0x03, 0x45, 0x03, 0x4c, 0x1b, 0x40, 0x1f, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x01,
-    0x01, 0x02, 0x59, 0x00, 0x02, 0x02, 0x3d, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x45, 0x03, 0x4c,
-    0x59, 0x59, 0x40, 0x09, 0x27, 0x29, 0x23, 0x11, 0x13, 0x24, 0x06, 0x08, 0x1a, 0x2b, 0x13, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x16, 0x17, 0x11, 0x33, 0x11, 0x23, 0x27, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x1e, 0x02,
-    0x33, 0x32, 0x3e, 0x02, 0x37, 0x11, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x8b, 0x3d, 0x71, 0xa0, 0x63, 0x61,
-    0x91, 0x35, 0xb9, 0xaa, 0x08, 0x36, 0x96, 0x64, 0x62, 0x9f, 0x70, 0x3e, 0xb9, 0x22, 0x47, 0x6e, 0x4d, 0x2f, 0x4c,
-    0x3e, 0x30, 0x12, 0x24, 0x7a, 0x5b, 0x4e, 0x6f, 0x47, 0x22, 0x02, 0x26, 0x79, 0xcb, 0x92, 0x52, 0x41, 0x3e, 0x02,
-    0x31, 0xfa, 0x00, 0x72, 0x42, 0x44, 0x54, 0x94, 0xc9, 0x74, 0x4f, 0x8e, 0x6c, 0x3f, 0x16, 0x29, 0x39, 0x23, 0x01,
-    0xf6, 0x42, 0x55, 0x40, 0x6d, 0x8f, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x87, 0xff, 0xec, 0x04, 0x45, 0x04,
-    0x4e, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x40, 0x40, 0x3d, 0x1b, 0x1a, 0x02, 0x03, 0x02, 0x01, 0x4a, 0x00, 0x05, 0x00,
-    0x02, 0x03, 0x05, 0x02, 0x61, 0x07, 0x01, 0x04, 0x04, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x47, 0x4b, 0x00, 0x03, 0x03,
-    0x00, 0x5b, 0x06, 0x01, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x21, 0x20, 0x01, 0x00, 0x26, 0x25, 0x20, 0x2b, 0x21, 0x2b,
-    0x18, 0x16, 0x12, 0x11, 0x0c, 0x0a, 0x00, 0x1f, 0x01, 0x1f, 0x08, 0x08, 0x14, 0x2b, 0x05, 0x22, 0x2e, 0x02, 0x35,
-    0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x21, 0x1e, 0x03, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0e,
-    0x03, 0x03, 0x22, 0x0e, 0x02, 0x07, 0x21, 0x35, 0x2e, 0x03, 0x02, 0x8c, 0x72, 0xbf, 0x88, 0x4c, 0x54, 0x8b, 0xb1,
-    0x5d, 0x75, 0xaf, 0x74, 0x39, 0xfc, 0xfb, 0x03, 0x33, 0x59, 0x7c, 0x4b, 0x63, 0x9a, 0x33, 0x71, 0x1b, 0x51, 0x6a,
-    0x86, 0x67, 0x38, 0x64, 0x50, 0x37, 0x0b, 0x02, 0x46, 0x03, 0x23, 0x44, 0x67, 0x14, 0x4e, 0x8c, 0xc0, 0x71, 0x2a,
-    0x83, 0xcf, 0x8f, 0x4c, 0x51, 0x8f, 0xc2, 0x71, 0x53, 0x4a, 0x82, 0x61, 0x38, 0x50, 0x42, 0x58, 0x29, 0x4b, 0x3a,
-    0x23, 0x03, 0xca, 0x29, 0x4f, 0x73, 0x4b, 0x0e, 0x36, 0x6a, 0x54, 0x34, 0x00, 0x01, 0x00, 0x98, 0x00, 0x00, 0x04,
-    0x6b, 0x06, 0x2b, 0x00, 0x19, 0x00, 0x37, 0x40, 0x34, 0x0d, 0x01, 0x03, 0x02, 0x0e, 0x01, 0x01, 0x03, 0x02, 0x4a,
-    0x00, 0x02, 0x00, 0x03, 0x01, 0x02, 0x03, 0x63, 0x05, 0x01, 0x00, 0x00, 0x01, 0x59, 0x04, 0x01, 0x01, 0x01, 0x3f,
-    0x4b, 0x07, 0x01, 0x06, 0x06, 0x3d, 0x06, 0x4c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x19, 0x11, 0x13, 0x25, 0x25, 0x11,
-    0x11, 0x08, 0x08, 0x1a, 0x2b, 0x21, 0x11, 0x21, 0x35, 0x21, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07,
-    0x26, 0x26, 0x23, 0x06, 0x06, 0x15, 0x15, 0x21, 0x15, 0x21, 0x11, 0x01, 0xc2, 0xfe, 0xd6, 0x01, 0x2a, 0x3d, 0x6f,
-    0x9c, 0x60, 0x42, 0x7d, 0x42, 0x16, 0x29, 0x6d, 0x3e, 0x82, 0x83, 0x01, 0xa1, 0xfe, 0x5f, 0x03, 0xab, 0x8f, 0x4c,
-    0x68, 0x9d, 0x6a, 0x36, 0x16, 0x11, 0x99, 0x0e, 0x15, 0x01, 0x82, 0x85, 0x4c, 0x8f, 0xfc, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x8c, 0xfe, 0x56, 0x04, 0x1d, 0x04, 0x4e, 0x00, 0x29, 0x00, 0x3f, 0x00, 0x8f, 0x4b, 0xb0, 0x19,
-    0x50, 0x58, 0x40, 0x14, 0x08, 0x01, 0x06, 0x00, 0x35, 0x34, 0x02, 0x05, 0x06, 0x21, 0x01, 0x04, 0x05, 0x16, 0x15,
-    0x02, 0x03, 0x04, 0x04, 0x4a, 0x1b, 0x40, 0x14, 0x08, 0x01, 0x06, 0x01, 0x35, 0x34, 0x02, 0x05, 0x06, 0x21, 0x01,
-    0x04, 0x05, 0x16, 0x15, 0x02, 0x03, 0x04, 0x04, 0x4a, 0x59, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x20, 0x00, 0x06,
-    0x06, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x05, 0x05, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x45, 0x4b,
-    0x00, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x41, 0x02, 0x4c, 0x1b, 0x40, 0x24, 0x00, 0x01, 0x01, 0x3f, 0x4b,
-    0x00, 0x06, 0x06, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x05, 0x05, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x45,
-    0x4b, 0x00, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x41, 0x02, 0x4c, 0x59, 0x40, 0x0a, 0x29, 0x29, 0x27, 0x29,
-    0x25, 0x13, 0x24, 0x07, 0x08, 0x1b, 0x2b, 0x13, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x37, 0x33, 0x11, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x37, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x06, 0x06, 0x23,
-    0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x11, 0x2e, 0x03, 0x23, 0x22, 0x0e,
-    0x02, 0x15, 0x8c, 0x3b, 0x70, 0xa0, 0x65, 0x64, 0x97, 0x35, 0x09, 0xa8, 0x43, 0x79, 0xa8, 0x66, 0x2a, 0x6c, 0x6f,
-    0x67, 0x25, 0x60, 0x22, 0x48, 0x4a, 0x4a, 0x25, 0x42, 0x6a, 0x4b, 0x28, 0x36, 0x93, 0x61, 0x63, 0xa0, 0x6f, 0x3c,
-    0xb9, 0x21, 0x47, 0x6e, 0x4d, 0x30, 0x4d, 0x3d, 0x30, 0x12, 0x12, 0x30, 0x3e, 0x4c, 0x2e, 0x4e, 0x6f, 0x47, 0x21,
-    0x02, 0x26, 0x79, 0xcb, 0x92, 0x52, 0x47, 0x43, 0x76, 0xfb, 0xdd, 0x6b, 0xa6, 0x74, 0x3c, 0x13, 0x2b, 0x48, 0x35,
-    0x6f, 0x29, 0x39, 0x22, 0x0f, 0x26, 0x49, 0x6c, 0x46, 0x5d, 0x3e, 0x41, 0x54, 0x94, 0xc9, 0x74, 0x4f, 0x8e, 0x6c,
-    0x3f, 0x17, 0x2a, 0x3a, 0x23, 0x01, 0xf0, 0x22, 0x38, 0x29, 0x17, 0x40, 0x6d, 0x8f, 0x4f, 0x00, 0x00, 0x01, 0x00,
-    0xae, 0x00, 0x00, 0x04, 0x2c, 0x06, 0x00, 0x00, 0x15, 0x00, 0x49, 0xb6, 0x11, 0x00, 0x02, 0x01, 0x02, 0x01, 0x4a,
-    0x4b, 0xb0, 0x21, 0x50, 0x58, 0x40, 0x16, 0x00, 0x04, 0x04, 0x3e, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00,
-    0x00, 0x47, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x1b, 0x40, 0x16, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00,
-    0x00, 0x00, 0x47, 0x4b, 0x00, 0x04, 0x04, 0x01, 0x59, 0x03, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x59, 0xb7, 0x11,
-    0x13, 0x23, 0x15, 0x22, 0x05, 0x08, 0x19, 0x2b, 0x01, 0x36, 0x36, 0x37, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x23, 0x11,
-    0x34, 0x26, 0x07, 0x22, 0x06, 0x07, 0x11, 0x23, 0x11, 0x33, 0x01, 0x67, 0x3a, 0xaa, 0x6a, 0x55, 0x8b, 0x62, 0x35,
-    0xb9, 0x7f, 0x76, 0x59, 0x91, 0x2d, 0xb9, 0xb9, 0x03, 0x99, 0x55, 0x5f, 0x01, 0x31, 0x68, 0x9f, 0x6d, 0xfd, 0x57,
-    0x02, 0xab, 0x85, 0x82, 0x01, 0x57, 0x48, 0xfc, 0xee, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0xcb, 0x00, 0x00, 0x04,
-    0x55, 0x05, 0xc3, 0x00, 0x09, 0x00, 0x15, 0x00, 0x2d, 0x40, 0x2a, 0x00, 0x06, 0x06, 0x05, 0x5b, 0x00, 0x05, 0x05,
-    0x44, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x59, 0x00, 0x00, 0x00, 0x3f, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x02, 0x59, 0x00,
-    0x02, 0x02, 0x3d, 0x02, 0x4c, 0x24, 0x23, 0x11, 0x11, 0x11, 0x11, 0x10, 0x07, 0x08, 0x1b, 0x2b, 0x13, 0x21, 0x11,
-    0x21, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x01, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26,
-    0xcb, 0x02, 0x29, 0x01, 0x61, 0xfc, 0x76, 0x01, 0x70, 0xfe, 0x90, 0x01, 0x58, 0x37, 0x38, 0x37, 0x38, 0x38, 0x37,
-    0x38, 0x37, 0x04, 0x3a, 0xfc, 0x66, 0xa0, 0xa0, 0x02, 0xf9, 0x01, 0xbd, 0x2e, 0x3f, 0x3f, 0x2e, 0x2d, 0x3c, 0x3c,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xd3, 0xfe, 0x4b, 0x03, 0x58, 0x05, 0xc3, 0x00, 0x17, 0x00, 0x23, 0x00, 0x35,
-    0x40, 0x32, 0x0b, 0x01, 0x02, 0x03, 0x0a, 0x01, 0x01, 0x02, 0x02, 0x4a, 0x00, 0x05, 0x05, 0x04, 0x5b, 0x00, 0x04,
-    0x04, 0x44, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x59, 0x00, 0x00, 0x00, 0x3f, 0x4b, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x00,
-    0x01, 0x01, 0x49, 0x01, 0x4c, 0x24, 0x23, 0x15, 0x44, 0x35, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x01, 0x21, 0x11, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x37, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x11, 0x21, 0x01, 0x34, 0x36,
-    0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x01, 0x2b, 0x02, 0x22, 0x39, 0x6d, 0x9d, 0x64, 0x39, 0x63,
-    0x37, 0x0d, 0x11, 0x34, 0x35, 0x31, 0x0e, 0x34, 0x5c, 0x44, 0x27, 0xfe, 0x97, 0x01, 0x4f, 0x36, 0x38, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x36, 0x04, 0x3a, 0xfb, 0xbf, 0x68, 0xa0, 0x6d, 0x39, 0x07, 0x0a, 0x98, 0x03, 0x05, 0x03, 0x01,
-    0x1b, 0x40, 0x69, 0x4d, 0x03, 0xa0, 0x01, 0xbe, 0x2d, 0x3f, 0x3f, 0x2d, 0x2d, 0x3d, 0x3d, 0x00, 0x01, 0x00, 0xb0,
-    0x00, 0x00, 0x04, 0x6a, 0x06, 0x00, 0x00, 0x0c, 0x00, 0x45, 0xb7, 0x0a, 0x06, 0x01, 0x03, 0x00, 0x02, 0x01, 0x4a,
-    0x4b, 0xb0, 0x21, 0x50, 0x58, 0x40, 0x11, 0x00, 0x01, 0x01, 0x3e, 0x4b, 0x00, 0x02, 0x02, 0x3f, 0x4b, 0x03, 0x01,
-    0x00, 0x00, 0x3d, 0x00, 0x4c, 0x1b, 0x40, 0x17, 0x00, 0x01, 0x01, 0x00, 0x59, 0x03, 0x01, 0x00, 0x00, 0x3d, 0x4b,
-    0x00, 0x02, 0x02, 0x3f, 0x4b, 0x03, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x59, 0xb6, 0x12, 0x13, 0x11, 0x12, 0x04,
-    0x08, 0x18, 0x2b, 0x01, 0x07, 0x11, 0x23, 0x11, 0x33, 0x11, 0x37, 0x01, 0x33, 0x01, 0x01, 0x23, 0x01, 0xf2, 0x88,
-    0xba, 0xba, 0x79, 0x01, 0x63, 0xe1, 0xfe, 0x4a, 0x01, 0xf9, 0xeb, 0x01, 0xf9, 0x83, 0xfe, 0x8a, 0x06, 0x00, 0xfc,
-    0x54, 0x82, 0x01, 0x64, 0xfe, 0x3d, 0xfd, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0xcb, 0x00, 0x00, 0x04, 0x55, 0x06,
-    0x00, 0x00, 0x09, 0x00, 0x3f, 0x4b, 0xb0, 0x21, 0x50, 0x58, 0x40, 0x16, 0x00, 0x04, 0x04, 0x00, 0x59, 0x00, 0x00,
-    0x00, 0x3e, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x02, 0x59, 0x00, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x1b, 0x40, 0x14, 0x00,
-    0x00, 0x00, 0x04, 0x01, 0x00, 0x04, 0x61, 0x03, 0x01, 0x01, 0x01, 0x02, 0x59, 0x00, 0x02, 0x02, 0x3d, 0x02, 0x4c,
-    0x59, 0xb7, 0x11, 0x11, 0x11, 0x11, 0x10, 0x05, 0x08, 0x19, 0x2b, 0x13, 0x21, 0x11, 0x21, 0x15, 0x21, 0x35, 0x21,
-    0x11, 0x21, 0xcb, 0x02, 0x29, 0x01, 0x61, 0xfc, 0x76, 0x01, 0x70, 0xfe, 0x90, 0x06, 0x00, 0xfa, 0xa0, 0xa0, 0xa0,
-    0x04, 0xbf, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x04, 0x72, 0x04, 0x4e, 0x00, 0x22, 0x00, 0x71, 0x4b,
-    0xb0, 0x1b, 0x50, 0x58, 0x40, 0x0c, 0x06, 0x01, 0x02, 0x03, 0x00, 0x1f, 0x16, 0x02, 0x02, 0x03, 0x02, 0x4a, 0x1b,
-    0x40, 0x0c, 0x06, 0x01, 0x02, 0x03, 0x07, 0x1f, 0x16, 0x02, 0x02, 0x03, 0x02, 0x4a, 0x59, 0x4b, 0xb0, 0x1b, 0x50,
-    0x58, 0x40, 0x16, 0x05, 0x01, 0x03, 0x03, 0x00, 0x5b, 0x08, 0x07, 0x01, 0x03, 0x00, 0x00, 0x47, 0x4b, 0x06, 0x04,
-    0x02, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x1b, 0x40, 0x1a, 0x08, 0x01, 0x07, 0x07, 0x3f, 0x4b, 0x05, 0x01, 0x03, 0x03,
-    0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x47, 0x4b, 0x06, 0x04, 0x02, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x59, 0x40, 0x10,
-    0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x13, 0x23, 0x15, 0x22, 0x13, 0x23, 0x23, 0x09, 0x08, 0x1b, 0x2b, 0x01, 0x17,
-    0x36, 0x36, 0x37, 0x32, 0x17, 0x36, 0x36, 0x37, 0x32, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x07, 0x22, 0x0e, 0x02,
-    0x07, 0x11, 0x23, 0x11, 0x34, 0x26, 0x07, 0x22, 0x06, 0x07, 0x11, 0x23, 0x11, 0x01, 0x03, 0x05, 0x21, 0x6b, 0x4c,
-    0x95, 0x32, 0x20, 0x69, 0x4b, 0x77, 0x80, 0xb0, 0x7d, 0x21, 0x30, 0x20, 0x12, 0x03, 0xb0, 0x3a, 0x3f, 0x3a, 0x40,
-    0x0f, 0xb0, 0x04, 0x3a, 0x66, 0x39, 0x40, 0x01, 0x74, 0x34, 0x3f, 0x01, 0x92, 0x94, 0xfc, 0xd8, 0x03, 0x2a, 0x88,
-    0x01, 0x12, 0x1f, 0x29, 0x16, 0xfc, 0xbf, 0x03, 0x2b, 0x41, 0x46, 0x01, 0x2e, 0x26, 0xfc, 0xa3, 0x04, 0x3a, 0x00,
-    0x00, 0x01, 0x00, 0xae, 0x00, 0x00, 0x04, 0x29, 0x04, 0x4e, 0x00, 0x17, 0x00, 0x4d, 0xb6, 0x14, 0x01, 0x02, 0x01,
-    0x02, 0x01, 0x4a, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x13, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x05, 0x04, 0x02, 0x00,
-    0x00, 0x47, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x1b, 0x40, 0x17, 0x05, 0x01, 0x04, 0x04, 0x3f, 0x4b,
-    0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x59, 0x40,
-    0x0d, 0x00, 0x00, 0x00, 0x17, 0x00, 0x17, 0x13, 0x25, 0x15, 0x23, 0x06, 0x08, 0x18, 0x2b, 0x01, 0x17, 0x36, 0x36,
-    0x37, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x07, 0x11, 0x23, 0x11, 0x01,
-    0x54, 0x0d, 0x3b, 0xac, 0x6a, 0x55, 0x8b, 0x62, 0x35, 0xb9, 0x20, 0x3f, 0x5b, 0x3b, 0x5d, 0x8d, 0x2a, 0xb9, 0x04,
-    0x3a, 0xa0, 0x54, 0x5f, 0x01, 0x30, 0x66, 0x9d, 0x6c, 0xfd, 0x51, 0x02, 0xab, 0x48, 0x64, 0x3e, 0x1c, 0x5d, 0x4c,
-    0xfc, 0xf8, 0x04, 0x3a, 0x00, 0x02, 0x00, 0x7a, 0xff, 0xec, 0x04, 0x52, 0x04, 0x4e, 0x00, 0x15, 0x00, 0x2b, 0x00,
-    0x1f, 0x40, 0x1c, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x00,
-    0x01, 0x01, 0x45, 0x01, 0x4c, 0x29, 0x29, 0x29, 0x24, 0x04, 0x08, 0x18, 0x2b, 0x13, 0x34, 0x3e, 0x02, 0x33, 0x32,
-    0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e,
-    0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x7a, 0x44, 0x7f, 0xb6, 0x72, 0x73, 0xb7, 0x7f,
-    0x44, 0x44, 0x7f, 0xb6, 0x72, 0x73, 0xb7, 0x7f, 0x44, 0xb9, 0x26, 0x4d, 0x74, 0x4d, 0x4c, 0x73, 0x4d, 0x26, 0x27,
-    0x4d, 0x73, 0x4d, 0x4d, 0x72, 0x4d, 0x26, 0x02, 0x27, 0x75, 0xc9, 0x94, 0x55, 0x55, 0x94, 0xc9, 0x75, 0x16, 0x75,
-    0xc8, 0x94, 0x54, 0x54, 0x94, 0xc8, 0x75, 0x50, 0x91, 0x6e, 0x40, 0x40, 0x6e, 0x91, 0x50, 0x16, 0x4f, 0x91, 0x6e,
-    0x41, 0x41, 0x6e, 0x91, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xad, 0xfe, 0x60, 0x04, 0x3f, 0x04, 0x4e, 0x00,
-    0x15, 0x00, 0x27, 0x00, 0x62, 0x40, 0x0f, 0x0d, 0x01, 0x04, 0x02, 0x1f, 0x1e, 0x02, 0x05, 0x04, 0x08, 0x01, 0x00,
-    0x05, 0x03, 0x4a, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x1b, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x03, 0x01, 0x02, 0x02,
-    0x3f, 0x4b, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x4b, 0x00, 0x01, 0x01, 0x41, 0x01, 0x4c, 0x1b,
-    0x40, 0x1f, 0x00, 0x02, 0x02, 0x3f, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x47, 0x4b, 0x00, 0x05,
-    0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x4b, 0x00, 0x01, 0x01, 0x41, 0x01, 0x4c, 0x59, 0x40, 0x09, 0x25, 0x29,
-    0x23, 0x11, 0x13, 0x24, 0x06, 0x08, 0x1a, 0x2b, 0x01, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x11, 0x23, 0x11,
-    0x33, 0x17, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x07, 0x11, 0x16,
-    0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x04, 0x3f, 0x38, 0x6c, 0x9f, 0x66, 0x63, 0x97, 0x36, 0xb9, 0xa9, 0x09, 0x36,
-    0x99, 0x65, 0x68, 0xa0, 0x6c, 0x38, 0xb9, 0x23, 0x49, 0x70, 0x4e, 0x59, 0x79, 0x24, 0x24, 0x78, 0x5c, 0x4d, 0x70,
-    0x48, 0x23, 0x02, 0x11, 0x74, 0xc9, 0x94, 0x54, 0x40, 0x3c, 0xfd, 0xf8, 0x05, 0xda, 0x76, 0x43, 0x47, 0x52, 0x92,
-    0xcb, 0x79, 0x4f, 0x8f, 0x6d, 0x40, 0x53, 0x41, 0xfd, 0xf7, 0x40, 0x51, 0x41, 0x6e, 0x90, 0x4f, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x8c, 0xfe, 0x60, 0x04, 0x1c, 0x04, 0x4e, 0x00, 0x15, 0x00, 0x29, 0x00, 0x7a, 0x4b, 0xb0, 0x19,
-    0x50, 0x58, 0x40, 0x0f, 0x08, 0x01, 0x05, 0x00, 0x1f, 0x1e, 0x02, 0x04, 0x05, 0x0d, 0x01, 0x03, 0x04, 0x03, 0x4a,
-    0x1b, 0x40, 0x0f, 0x08, 0x01, 0x05, 0x01, 0x1f, 0x1e, 0x02, 0x04, 0x05, 0x0d, 0x01, 0x03, 0x04, 0x03, 0x4a, 0x59,
-    0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x1b, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x47, 0x4b, 0x00,
-    0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x45, 0x4b, 0x00, 0x02, 0x02, 0x41, 0x02, 0x4c, 0x1b, 0x40, 0x1f, 0x00,
-    0x01, 0x01, 0x3f, 0x4b, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b,
-    0x00, 0x03, 0x03, 0x45, 0x4b, 0x00, 0x02, 0x02, 0x41, 0x02, 0x4c, 0x59, 0x40, 0x09, 0x27, 0x29, 0x23, 0x11, 0x13,
-    0x24, 0x06, 0x08, 0x1a, 0x2b, 0x13, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x37, 0x33, 0x11, 0x23, 0x11, 0x06,
-    0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x11, 0x2e, 0x03, 0x23, 0x22,
-    0x0e, 0x02, 0x15, 0x8c, 0x3a, 0x70, 0xa3, 0x68, 0x60, 0x93, 0x36, 0x08, 0xaa, 0xb9, 0x36, 0x90, 0x5e, 0x67, 0xa1,
-    0x70, 0x3b, 0xb9, 0x23, 0x48, 0x6f, 0x4d, 0x59, 0x78, 0x26, 0x13, 0x31, 0x3d, 0x49, 0x2b, 0x4d, 0x70, 0x49, 0x23,
-    0x02, 0x26, 0x79, 0xcb, 0x92, 0x52, 0x41, 0x3e, 0x6b, 0xfa, 0x26, 0x02, 0x02, 0x39, 0x3d, 0x54, 0x94, 0xc9, 0x74,
-    0x4f, 0x90, 0x6e, 0x41, 0x50, 0x40, 0x02, 0x16, 0x1f, 0x33, 0x26, 0x15, 0x42, 0x6f, 0x90, 0x4f, 0x00, 0x01, 0x01,
-    0x49, 0x00, 0x00, 0x04, 0x31, 0x04, 0x4e, 0x00, 0x13, 0x00, 0x68, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x0c, 0x05,
-    0x01, 0x01, 0x00, 0x11, 0x0c, 0x06, 0x03, 0x02, 0x01, 0x02, 0x4a, 0x1b, 0x40, 0x0c, 0x05, 0x01, 0x01, 0x03, 0x11,
-    0x0c, 0x06, 0x03, 0x02, 0x01, 0x02, 0x4a, 0x59, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x12, 0x00, 0x01, 0x01, 0x00,
-    0x5b, 0x03, 0x04, 0x02, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x1b, 0x40, 0x16, 0x00, 0x03,
-    0x03, 0x3f, 0x4b, 0x00, 0x01, 0x01, 0x00, 0x5b, 0x04, 0x01, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x02, 0x02, 0x3d, 0x02,
-    0x4c, 0x59, 0x40, 0x0f, 0x02, 0x00, 0x10, 0x0f, 0x0e, 0x0d, 0x0a, 0x08, 0x00, 0x13, 0x02, 0x13, 0x05, 0x08, 0x14,
-    0x2b, 0x01, 0x32, 0x1e, 0x02, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x11, 0x23, 0x11, 0x33, 0x17, 0x36,
-    0x36, 0x03, 0x73, 0x1a, 0x38, 0x33, 0x2b, 0x0e, 0x19, 0x36, 0x61, 0x35, 0x82, 0xa1, 0x26, 0xba, 0xb0, 0x09, 0x42,
-    0xb9, 0x04, 0x4e, 0x03, 0x07, 0x0a, 0x06, 0xb5, 0x0c, 0x0b, 0x76, 0x6a, 0xfd, 0x4a, 0x04, 0x3a, 0xac, 0x59, 0x67,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0xaf, 0xff, 0xec, 0x04, 0x36, 0x04, 0x4e, 0x00, 0x3b, 0x00, 0x33, 0x40, 0x30, 0x00,
-    0x01, 0x02, 0x04, 0x02, 0x01, 0x04, 0x70, 0x00, 0x04, 0x05, 0x02, 0x04, 0x05, 0x6e, 0x00, 0x02, 0x02, 0x00, 0x5b,
-    0x00, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x05, 0x05, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x45, 0x03, 0x4c, 0x3a, 0x38, 0x34,
-    0x33, 0x2f, 0x2d, 0x24, 0x14, 0x2e, 0x06, 0x08, 0x17, 0x2b, 0x01, 0x34, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02,
-    0x17, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x1e, 0x03, 0x33, 0x32, 0x36, 0x03,
-    0x7d, 0x1a, 0x3e, 0x66, 0x4c, 0x5d, 0x99, 0x6d, 0x3c, 0x3e, 0x70, 0x9b, 0x5d, 0x64, 0xa0, 0x70, 0x3d, 0xb9, 0x24,
-    0x40, 0x5b, 0x39, 0x3b, 0x59, 0x3b, 0x1e, 0x18, 0x3b, 0x63, 0x4c, 0x64, 0x9e, 0x6c, 0x39, 0x41, 0x74, 0xa2, 0x60,
-    0x6e, 0xac, 0x77, 0x3f, 0xb9, 0x04, 0x35, 0x4f, 0x60, 0x2f, 0x75, 0x88, 0x01, 0x1f, 0x21, 0x35, 0x2c, 0x25, 0x0f,
-    0x13, 0x36, 0x4b, 0x65, 0x43, 0x42, 0x73, 0x56, 0x32, 0x34, 0x5c, 0x7b, 0x47, 0x23, 0x43, 0x34, 0x20, 0x1a, 0x2c,
-    0x3a, 0x1f, 0x20, 0x32, 0x28, 0x20, 0x0f, 0x15, 0x37, 0x4d, 0x66, 0x43, 0x48, 0x76, 0x54, 0x2e, 0x3b, 0x61, 0x80,
-    0x45, 0x39, 0x4e, 0x30, 0x14, 0x56, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x8e, 0xff, 0xec, 0x04, 0x29, 0x05, 0x40,
-    0x00, 0x1f, 0x00, 0x39, 0x40, 0x36, 0x0f, 0x01, 0x02, 0x01, 0x10, 0x01, 0x03, 0x02, 0x02, 0x4a, 0x07, 0x01, 0x06,
-    0x00, 0x06, 0x72, 0x04, 0x01, 0x01, 0x01, 0x00, 0x59, 0x05, 0x01, 0x00, 0x00, 0x3f, 0x4b, 0x00, 0x02, 0x02, 0x03,
-    0x5b, 0x00, 0x03, 0x03, 0x45, 0x03, 0x4c, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x11, 0x15, 0x29, 0x25, 0x11, 0x11,
-    0x08, 0x08, 0x1a, 0x2b, 0x01, 0x11, 0x21, 0x15, 0x21, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x17,
-    0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x21, 0x35, 0x21, 0x11, 0x02, 0x64, 0x01, 0x9c, 0xfe, 0x64, 0x20,
-    0x38, 0x49, 0x29, 0x1e, 0x40, 0x3d, 0x35, 0x11, 0x1a, 0x17, 0x42, 0x4e, 0x57, 0x2b, 0x48, 0x7d, 0x5c, 0x35, 0xfe,
-    0xe4, 0x01, 0x1c, 0x05, 0x40, 0xfe, 0xfa, 0x8f, 0xfd, 0xb4, 0x3f, 0x52, 0x31, 0x14, 0x07, 0x0a, 0x0b, 0x04, 0x83,
-    0x0e, 0x15, 0x0f, 0x08, 0x29, 0x59, 0x8d, 0x64, 0x02, 0x4c, 0x8f, 0x01, 0x06, 0x00, 0x01, 0x00, 0xb4, 0xff, 0xec,
-    0x04, 0x1f, 0x04, 0x3a, 0x00, 0x17, 0x00, 0x44, 0xb5, 0x13, 0x01, 0x02, 0x01, 0x01, 0x4a, 0x4b, 0xb0, 0x19, 0x50,
-    0x58, 0x40, 0x12, 0x03, 0x01, 0x01, 0x01, 0x3f, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x04, 0x01, 0x00, 0x00, 0x45,
-    0x00, 0x4c, 0x1b, 0x40, 0x16, 0x03, 0x01, 0x01, 0x01, 0x3f, 0x4b, 0x00, 0x04, 0x04, 0x3d, 0x4b, 0x00, 0x02, 0x02,
-    0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x59, 0xb7, 0x11, 0x13, 0x25, 0x15, 0x22, 0x05, 0x08, 0x19, 0x2b,
-    0x25, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x11,
-    0x33, 0x11, 0x23, 0x03, 0x6c, 0x36, 0xa2, 0x6a, 0x55, 0x8a, 0x62, 0x35, 0xb9, 0x1c, 0x38, 0x51, 0x35, 0x71, 0x8b,
-    0x22, 0xba, 0xa8, 0x95, 0x50, 0x59, 0x35, 0x70, 0xad, 0x79, 0x02, 0x83, 0xfd, 0x7b, 0x58, 0x74, 0x45, 0x1c, 0x5c,
-    0x4e, 0x03, 0x08, 0xfb, 0xc6, 0x00, 0x01, 0x00, 0x62, 0x00, 0x00, 0x04, 0x65, 0x04, 0x3a, 0x00, 0x08, 0x00, 0x1b,
-    0x40, 0x18, 0x01, 0x01, 0x01, 0x00, 0x01, 0x4a, 0x02, 0x01, 0x00, 0x00, 0x3f, 0x4b, 0x00, 0x01, 0x01, 0x3d, 0x01,
-    0x4c, 0x11, 0x11, 0x13, 0x03, 0x08, 0x17, 0x2b, 0x01, 0x17, 0x37, 0x01, 0x33, 0x01, 0x23, 0x01, 0x33, 0x02, 0x56,
-    0x11, 0x12, 0x01, 0x2f, 0xbd, 0xfe, 0x47, 0x8d, 0xfe, 0x43, 0xbe, 0x01, 0x0a, 0x43, 0x43, 0x03, 0x30, 0xfb, 0xc6,
-    0x04, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x30, 0x00, 0x00, 0x04, 0xa7, 0x04, 0x3a, 0x00, 0x12, 0x00, 0x21,
-    0x40, 0x1e, 0x0d, 0x06, 0x01, 0x03, 0x02, 0x00, 0x01, 0x4a, 0x04, 0x01, 0x02, 0x00, 0x00, 0x3f, 0x4b, 0x03, 0x01,
-    0x02, 0x02, 0x3d, 0x02, 0x4c, 0x11, 0x14, 0x11, 0x14, 0x13, 0x05, 0x08, 0x19, 0x2b, 0x01, 0x17, 0x37, 0x13, 0x33,
-    0x13, 0x17, 0x37, 0x13, 0x33, 0x03, 0x23, 0x03, 0x27, 0x07, 0x03, 0x23, 0x03, 0x33, 0x01, 0x52, 0x16, 0x1b, 0xad,
-    0x77, 0xac, 0x1d, 0x1b, 0x78, 0xa4, 0xe6, 0x92, 0xa9, 0x1c, 0x1b, 0xa7, 0x92, 0xe6, 0xa4, 0x01, 0x88, 0x9b, 0x9b,
-    0x02, 0xb2, 0xfd, 0x4e, 0xaa, 0xaa, 0x02, 0xb2, 0xfb, 0xc6, 0x02, 0x97, 0xa8, 0xa8, 0xfd, 0x69, 0x04, 0x3a, 0x00,
-    0x01, 0x00, 0x6e, 0x00, 0x00, 0x04, 0x72, 0x04, 0x3a, 0x00, 0x0b, 0x00, 0x1f, 0x40, 0x1c, 0x09, 0x06, 0x03, 0x03,
-    0x01, 0x00, 0x01, 0x4a, 0x03, 0x01, 0x00, 0x00, 0x3f, 0x4b, 0x02, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x12, 0x12,
-    0x12, 0x11, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x01, 0x33, 0x01, 0x01, 0x23, 0x01, 0x01, 0x23, 0x01, 0x01, 0x33, 0x02,
-    0x6d, 0x01, 0x21, 0xd9, 0xfe, 0x6d, 0x01, 0x9e, 0xd6, 0xfe, 0xd5, 0xfe, 0xd5, 0xd8, 0x01, 0x9e, 0xfe, 0x6d, 0xd6,
-    0x02, 0xa9, 0x01, 0x91, 0xfd, 0xe9, 0xfd, 0xdd, 0x01, 0x9c, 0xfe, 0x64, 0x02, 0x23, 0x02, 0x17, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x44, 0xfe, 0x4b, 0x04, 0x85, 0x04, 0x3a, 0x00, 0x1c, 0x00, 0x24, 0x40, 0x21, 0x1a, 0x01, 0x02,
-    0x02, 0x00, 0x01, 0x4a, 0x04, 0x01, 0x00, 0x00, 0x3f, 0x4b, 0x03, 0x01, 0x02, 0x02, 0x01, 0x5c, 0x00, 0x01, 0x01,
-    0x49, 0x01, 0x4c, 0x16, 0x31, 0x24, 0x35, 0x12, 0x05, 0x08, 0x19, 0x2b, 0x01, 0x17, 0x01, 0x33, 0x01, 0x0e, 0x03,
-    0x23, 0x22, 0x2e, 0x02, 0x27, 0x37, 0x32, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x37, 0x01, 0x33, 0x02, 0x3c,
-    0x30, 0x01, 0x4a, 0xcf, 0xfd, 0xdb, 0x13, 0x3b, 0x54, 0x70, 0x49, 0x0d, 0x20, 0x20, 0x1c, 0x09, 0x1e, 0x07, 0x18,
-    0x1a, 0x18, 0x07, 0x26, 0x3f, 0x31, 0x23, 0x0a, 0x4a, 0xfe, 0x2e, 0xcf, 0x01, 0x80, 0x83, 0x03, 0x3d, 0xfb, 0x1f,
-    0x2a, 0x5e, 0x50, 0x36, 0x03, 0x05, 0x06, 0x02, 0x97, 0x02, 0x02, 0x01, 0x2a, 0x3a, 0x3e, 0x14, 0x90, 0x04, 0x07,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xa0, 0x00, 0x00, 0x04, 0x3d, 0x04, 0x3a, 0x00, 0x09, 0x00, 0x29, 0x40, 0x26,
-    0x09, 0x01, 0x02, 0x03, 0x04, 0x01, 0x01, 0x00, 0x02, 0x4a, 0x00, 0x02, 0x02, 0x03, 0x59, 0x00, 0x03, 0x03, 0x3f,
-    0x4b, 0x00, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x11, 0x12, 0x11, 0x10, 0x04, 0x08, 0x18,
-    0x2b, 0x25, 0x21, 0x15, 0x21, 0x35, 0x01, 0x21, 0x35, 0x21, 0x15, 0x01, 0x8c, 0x02, 0xb1, 0xfc, 0x63, 0x02, 0x86,
-    0xfd, 0x83, 0x03, 0x70, 0x97, 0x97, 0x88, 0x03, 0x19, 0x99, 0x83, 0x00, 0x01, 0x01, 0x43, 0xfe, 0x92, 0x03, 0xe7,
-    0x06, 0x3d, 0x00, 0x2a, 0x00, 0x33, 0x40, 0x30, 0x21, 0x01, 0x01, 0x02, 0x01, 0x4a, 0x00, 0x03, 0x00, 0x04, 0x02,
-    0x03, 0x04, 0x63, 0x00, 0x02, 0x00, 0x01, 0x05, 0x02, 0x01, 0x63, 0x00, 0x05, 0x00, 0x00, 0x05, 0x57, 0x00, 0x05,
-    0x05, 0x00, 0x5b, 0x00, 0x00, 0x05, 0x00, 0x4f, 0x2a, 0x29, 0x11, 0x19, 0x11, 0x19, 0x10, 0x06, 0x08, 0x19, 0x2b,
-    0x01, 0x2e, 0x05, 0x35, 0x35, 0x34, 0x26, 0x27, 0x35, 0x32, 0x36, 0x35, 0x35, 0x34, 0x3e, 0x04, 0x37, 0x17, 0x0e,
-    0x03, 0x15, 0x15, 0x06, 0x06, 0x07, 0x16, 0x16, 0x17, 0x15, 0x14, 0x1e, 0x02, 0x17, 0x03, 0xd2, 0x41, 0x6a, 0x54,
-    0x3d, 0x29, 0x14, 0x89, 0x8d, 0x8d, 0x89, 0x12, 0x26, 0x3b, 0x54, 0x6d, 0x45, 0x15, 0x48, 0x55, 0x2b, 0x0c, 0x01,
-    0x6e, 0x74, 0x74, 0x6e, 0x01, 0x14, 0x31, 0x51, 0x3e, 0xfe, 0x92, 0x02, 0x28, 0x44, 0x5a, 0x67, 0x6d, 0x35, 0xa9,
-    0x90, 0x82, 0x01, 0x91, 0x81, 0x91, 0xaa, 0x35, 0x6d, 0x67, 0x5a, 0x44, 0x28, 0x02, 0x73, 0x02, 0x40, 0x63, 0x7c,
-    0x3d, 0xaa, 0x78, 0xb5, 0x2f, 0x2e, 0xb5, 0x77, 0xa9, 0x3e, 0x7b, 0x63, 0x40, 0x02, 0x00, 0x00, 0x00, 0x01, 0x02,
-    0x1c, 0xfe, 0x72, 0x02, 0xb1, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x13, 0x40, 0x10, 0x00, 0x01, 0x01, 0x3c, 0x4b, 0x00,
-    0x00, 0x00, 0x41, 0x00, 0x4c, 0x11, 0x10, 0x02, 0x08, 0x16, 0x2b, 0x01, 0x23, 0x11, 0x33, 0x02, 0xb1, 0x95, 0x95,
-    0xfe, 0x72, 0x07, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x43, 0xfe, 0x92, 0x03, 0xe7, 0x06, 0x3d, 0x00, 0x28,
-    0x00, 0x37, 0x40, 0x34, 0x09, 0x01, 0x04, 0x03, 0x01, 0x4a, 0x00, 0x02, 0x00, 0x01, 0x03, 0x02, 0x01, 0x63, 0x00,
-    0x03, 0x00, 0x04, 0x00, 0x03, 0x04, 0x63, 0x00, 0x00, 0x05, 0x05, 0x00, 0x57, 0x00, 0x00, 0x00, 0x05, 0x5b, 0x00,
-    0x05, 0x00, 0x05, 0x4f, 0x28, 0x27, 0x20, 0x1f, 0x1e, 0x1d, 0x14, 0x13, 0x12, 0x11, 0x10, 0x06, 0x08, 0x15, 0x2b,
-    0x05, 0x3e, 0x03, 0x35, 0x35, 0x34, 0x36, 0x37, 0x26, 0x26, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x27, 0x37, 0x1e, 0x05,
-    0x15, 0x15, 0x14, 0x16, 0x33, 0x15, 0x06, 0x06, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x01, 0x43, 0x3d, 0x52, 0x31,
-    0x15, 0x6e, 0x74, 0x74, 0x6e, 0x0d, 0x2b, 0x54, 0x48, 0x14, 0x45, 0x6d, 0x54, 0x3b, 0x26, 0x12, 0x8a, 0x8c, 0x8c,
-    0x8a, 0x2c, 0x5d, 0x8e, 0x62, 0xfb, 0x02, 0x40, 0x63, 0x7b, 0x3e, 0xa9, 0x77, 0xb5, 0x2e, 0x2f, 0xb5, 0x78, 0xaa,
-    0x3d, 0x7c, 0x63, 0x40, 0x02, 0x73, 0x02, 0x28, 0x44, 0x5a, 0x67, 0x6d, 0x35, 0xaa, 0x91, 0x81, 0x91, 0x01, 0x82,
-    0x90, 0xa9, 0x50, 0xa3, 0x86, 0x56, 0x02, 0x00, 0x00, 0x01, 0x00, 0x30, 0x01, 0x92, 0x04, 0x9c, 0x03, 0x22, 0x00,
-    0x25, 0x00, 0x2e, 0x40, 0x2b, 0x25, 0x00, 0x02, 0x01, 0x02, 0x13, 0x12, 0x02, 0x00, 0x03, 0x02, 0x4a, 0x00, 0x02,
-    0x00, 0x01, 0x03, 0x02, 0x01, 0x63, 0x00, 0x03, 0x00, 0x00, 0x03, 0x57, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00,
-    0x03, 0x00, 0x4f, 0x26, 0x29, 0x26, 0x24, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02,
-    0x27, 0x26, 0x26, 0x07, 0x22, 0x0e, 0x02, 0x15, 0x27, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x16, 0x16,
-    0x37, 0x32, 0x3e, 0x02, 0x35, 0x04, 0x9c, 0x2c, 0x50, 0x6e, 0x43, 0x2f, 0x51, 0x4d, 0x4b, 0x28, 0x37, 0x64, 0x38,
-    0x23, 0x3d, 0x2c, 0x1a, 0x86, 0x2c, 0x4f, 0x6e, 0x43, 0x2e, 0x53, 0x4e, 0x4b, 0x27, 0x39, 0x61, 0x38, 0x23, 0x3d,
-    0x2d, 0x1a, 0x02, 0xe4, 0x42, 0x7a, 0x5e, 0x38, 0x12, 0x24, 0x34, 0x22, 0x2d, 0x35, 0x01, 0x1d, 0x31, 0x43, 0x26,
-    0x11, 0x42, 0x78, 0x5a, 0x35, 0x13, 0x24, 0x34, 0x20, 0x30, 0x33, 0x01, 0x20, 0x35, 0x46, 0x26, 0x00, 0x02, 0x01,
-    0xf2, 0xfe, 0x8c, 0x02, 0xd8, 0x04, 0x4f, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x3b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40,
-    0x15, 0x00, 0x02, 0x02, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x47, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01,
-    0x41, 0x01, 0x4c, 0x1b, 0x40, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x5d, 0x00, 0x02, 0x02, 0x03, 0x5b, 0x00,
-    0x03, 0x03, 0x47, 0x02, 0x4c, 0x59, 0xb6, 0x24, 0x23, 0x11, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x33, 0x11, 0x23,
-    0x13, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x02, 0x0a, 0xb9, 0xb9, 0xce, 0x3b, 0x38,
-    0x39, 0x3a, 0x3a, 0x39, 0x38, 0x3b, 0x02, 0x63, 0xfc, 0x29, 0x05, 0x52, 0x2e, 0x3f, 0x3f, 0x2e, 0x30, 0x41, 0x41,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x93, 0xff, 0x0b, 0x04, 0x37, 0x05, 0x26, 0x00, 0x31, 0x00, 0x4b, 0x40, 0x48,
-    0x1c, 0x19, 0x02, 0x05, 0x03, 0x0e, 0x0b, 0x02, 0x02, 0x00, 0x02, 0x4a, 0x00, 0x04, 0x05, 0x01, 0x05, 0x04, 0x01,
-    0x70, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x6e, 0x00, 0x03, 0x00, 0x05, 0x04, 0x03, 0x05, 0x63, 0x06, 0x01, 0x00,
-    0x02, 0x02, 0x00, 0x57, 0x06, 0x01, 0x00, 0x00, 0x02, 0x59, 0x00, 0x02, 0x00, 0x02, 0x4d, 0x01, 0x00, 0x28, 0x26,
-    0x22, 0x21, 0x1b, 0x1a, 0x0d, 0x0c, 0x06, 0x05, 0x00, 0x31, 0x01, 0x31, 0x07, 0x08, 0x14, 0x2b, 0x25, 0x32, 0x3e,
-    0x02, 0x37, 0x33, 0x0e, 0x03, 0x07, 0x15, 0x23, 0x35, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x35, 0x33,
-    0x15, 0x1e, 0x03, 0x15, 0x23, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x02, 0x7f, 0x32,
-    0x5f, 0x4a, 0x2d, 0x01, 0xaf, 0x01, 0x3a, 0x62, 0x83, 0x49, 0xb9, 0x60, 0x91, 0x60, 0x31, 0x31, 0x60, 0x91, 0x60,
-    0xb9, 0x50, 0x84, 0x60, 0x35, 0xaf, 0x01, 0x29, 0x46, 0x61, 0x38, 0x56, 0x75, 0x48, 0x1f, 0x1f, 0x47, 0x75, 0x82,
-    0x20, 0x39, 0x4d, 0x2d, 0x40, 0x75, 0x5f, 0x42, 0x0c, 0xe8, 0xeb, 0x12, 0x63, 0x8e, 0xb0, 0x5f, 0x2a, 0x5f, 0xaf,
-    0x8f, 0x63, 0x12, 0xe2, 0xde, 0x0c, 0x45, 0x66, 0x82, 0x49, 0x31, 0x57, 0x42, 0x26, 0x45, 0x6f, 0x8a, 0x46, 0x2a,
-    0x47, 0x8b, 0x6f, 0x45, 0x00, 0x00, 0x00, 0x01, 0x00, 0x71, 0x00, 0x00, 0x04, 0x7c, 0x05, 0xc4, 0x00, 0x2b, 0x00,
-    0x3e, 0x40, 0x3b, 0x00, 0x06, 0x07, 0x04, 0x07, 0x06, 0x04, 0x70, 0x08, 0x01, 0x04, 0x0a, 0x09, 0x02, 0x03, 0x00,
-    0x04, 0x03, 0x61, 0x00, 0x07, 0x07, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x44, 0x4b, 0x02, 0x01, 0x00, 0x00, 0x01, 0x59,
-    0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x2b, 0x15, 0x24, 0x14, 0x25, 0x11, 0x16, 0x11,
-    0x11, 0x14, 0x0b, 0x08, 0x1d, 0x2b, 0x01, 0x17, 0x14, 0x06, 0x07, 0x21, 0x07, 0x21, 0x35, 0x33, 0x3e, 0x03, 0x35,
-    0x27, 0x23, 0x35, 0x33, 0x03, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34, 0x2e, 0x02, 0x23, 0x22,
-    0x0e, 0x02, 0x15, 0x13, 0x21, 0x15, 0x01, 0xcf, 0x08, 0x1d, 0x20, 0x02, 0xe2, 0x01, 0xfb, 0xfa, 0x4b, 0x1b, 0x25,
-    0x16, 0x08, 0x08, 0xa5, 0xa0, 0x09, 0x43, 0x76, 0xa4, 0x60, 0x60, 0x98, 0x69, 0x38, 0xba, 0x27, 0x43, 0x57, 0x30,
-    0x33, 0x59, 0x40, 0x25, 0x08, 0x01, 0x40, 0x02, 0x72, 0xe2, 0x45, 0x84, 0x30, 0x97, 0x97, 0x07, 0x38, 0x49, 0x51,
-    0x20, 0xe2, 0x98, 0x01, 0x05, 0x66, 0xa2, 0x71, 0x3c, 0x38, 0x66, 0x8e, 0x57, 0x3f, 0x59, 0x39, 0x1b, 0x27, 0x49,
-    0x6b, 0x43, 0xfe, 0xfb, 0x98, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x67, 0xff, 0xe5, 0x04, 0x92, 0x04, 0x38, 0x00,
-    0x23, 0x00, 0x37, 0x00, 0x62, 0x40, 0x20, 0x1a, 0x18, 0x12, 0x10, 0x04, 0x03, 0x01, 0x21, 0x1b, 0x0f, 0x09, 0x04,
-    0x02, 0x03, 0x22, 0x08, 0x06, 0x03, 0x00, 0x02, 0x03, 0x4a, 0x19, 0x11, 0x02, 0x01, 0x48, 0x23, 0x07, 0x02, 0x00,
-    0x47, 0x4b, 0xb0, 0x1f, 0x50, 0x58, 0x40, 0x15, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x3f, 0x4b, 0x00,
-    0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x1b, 0x40, 0x13, 0x00, 0x01, 0x00, 0x03, 0x02, 0x01,
-    0x03, 0x63, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x59, 0x40, 0x0a, 0x34, 0x32, 0x2a,
-    0x28, 0x16, 0x14, 0x22, 0x04, 0x08, 0x15, 0x2b, 0x25, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x07, 0x27, 0x37, 0x26,
-    0x26, 0x35, 0x34, 0x36, 0x37, 0x27, 0x37, 0x17, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x37, 0x17, 0x07, 0x16, 0x16,
-    0x15, 0x14, 0x06, 0x07, 0x17, 0x07, 0x01, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23,
-    0x22, 0x0e, 0x02, 0x03, 0xa3, 0x3e, 0x96, 0x55, 0x55, 0x95, 0x3e, 0x68, 0x83, 0x70, 0x26, 0x28, 0x2c, 0x2a, 0x78,
-    0x83, 0x75, 0x3c, 0x8f, 0x50, 0x50, 0x90, 0x3c, 0x78, 0x84, 0x7c, 0x28, 0x2c, 0x28, 0x24, 0x74, 0x84, 0xfd, 0x27,
-    0x32, 0x57, 0x77, 0x45, 0x45, 0x76, 0x57, 0x31, 0x31, 0x57, 0x76, 0x45, 0x45, 0x77, 0x57, 0x32, 0x54, 0x32, 0x36,
-    0x36, 0x30, 0x6c, 0x87, 0x73, 0x3f, 0x93, 0x51, 0x56, 0x9a, 0x41, 0x7c, 0x87, 0x7a, 0x2c, 0x30, 0x31, 0x2d, 0x7d,
-    0x88, 0x80, 0x40, 0x98, 0x55, 0x50, 0x91, 0x3e, 0x77, 0x88, 0x02, 0x1e, 0x4a, 0x84, 0x63, 0x3b, 0x3b, 0x63, 0x84,
-    0x4a, 0x4a, 0x84, 0x63, 0x3a, 0x3a, 0x63, 0x84, 0x00, 0x00, 0x00, 0x01, 0x00, 0x21, 0x00, 0x00, 0x04, 0xab, 0x05,
-    0xb0, 0x00, 0x17, 0x00, 0x33, 0x40, 0x30, 0x09, 0x01, 0x01, 0x08, 0x01, 0x02, 0x03, 0x01, 0x02, 0x62, 0x07, 0x01,
-    0x03, 0x06, 0x01, 0x04, 0x05, 0x03, 0x04, 0x61, 0x0a, 0x01, 0x00, 0x00, 0x3c, 0x4b, 0x00, 0x05, 0x05, 0x3d, 0x05,
-    0x4c, 0x17, 0x16, 0x15, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x0b, 0x08, 0x1d, 0x2b, 0x01,
-    0x01, 0x33, 0x01, 0x21, 0x15, 0x21, 0x07, 0x15, 0x21, 0x15, 0x21, 0x11, 0x23, 0x11, 0x21, 0x35, 0x21, 0x35, 0x21,
-    0x35, 0x21, 0x01, 0x33, 0x02, 0x66, 0x01, 0x71, 0xd4, 0xfe, 0x5b, 0x01, 0x3e, 0xfe, 0x7c, 0x01, 0x01, 0x85, 0xfe,
-    0x7b, 0xb9, 0xfe, 0x84, 0x01, 0x7c, 0xfe, 0x84, 0x01, 0x3c, 0xfe, 0x5b, 0xd4, 0x03, 0x0b, 0x02, 0xa5, 0xfd, 0x30,
-    0x79, 0x02, 0xa7, 0x78, 0xfe, 0xba, 0x01, 0x46, 0x78, 0xa9, 0x79, 0x02, 0xd0, 0x00, 0x02, 0x01, 0xff, 0xfe, 0xf2,
-    0x02, 0xb8, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x24, 0x40, 0x21, 0x00, 0x00, 0x04, 0x01, 0x01, 0x00, 0x01,
-    0x5d, 0x00, 0x02, 0x02, 0x03, 0x59, 0x00, 0x03, 0x03, 0x3c, 0x02, 0x4c, 0x00, 0x00, 0x07, 0x06, 0x05, 0x04, 0x00,
-    0x03, 0x00, 0x03, 0x11, 0x05, 0x08, 0x15, 0x2b, 0x01, 0x11, 0x33, 0x11, 0x11, 0x23, 0x11, 0x33, 0x01, 0xff, 0xb9,
-    0xb9, 0xb9, 0xfe, 0xf2, 0x03, 0x17, 0xfc, 0xe9, 0x03, 0xc8, 0x02, 0xf6, 0x00, 0x00, 0x02, 0x00, 0x57, 0xfe, 0x11,
-    0x04, 0x74, 0x05, 0xc4, 0x00, 0x49, 0x00, 0x5f, 0x00, 0x39, 0x40, 0x36, 0x58, 0x4d, 0x28, 0x03, 0x04, 0x01, 0x04,
-    0x01, 0x4a, 0x00, 0x04, 0x05, 0x01, 0x05, 0x04, 0x01, 0x70, 0x00, 0x01, 0x02, 0x05, 0x01, 0x02, 0x6e, 0x00, 0x02,
-    0x00, 0x00, 0x02, 0x00, 0x5f, 0x00, 0x05, 0x05, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x44, 0x05, 0x4c, 0x3c, 0x3a, 0x36,
-    0x35, 0x31, 0x2f, 0x24, 0x14, 0x2a, 0x06, 0x08, 0x17, 0x2b, 0x01, 0x14, 0x06, 0x07, 0x16, 0x16, 0x15, 0x14, 0x0e,
-    0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x37, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x27,
-    0x2e, 0x03, 0x35, 0x34, 0x36, 0x37, 0x26, 0x26, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34,
-    0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x25, 0x26, 0x26, 0x27, 0x06, 0x06,
-    0x15, 0x14, 0x1e, 0x02, 0x17, 0x16, 0x16, 0x17, 0x36, 0x36, 0x37, 0x34, 0x2e, 0x02, 0x04, 0x74, 0x62, 0x58, 0x45,
-    0x49, 0x47, 0x81, 0xb3, 0x6d, 0x62, 0xbb, 0x92, 0x5a, 0xb9, 0x3c, 0x60, 0x78, 0x3c, 0x46, 0x70, 0x4f, 0x2a, 0x26,
-    0x54, 0x85, 0x60, 0x6a, 0xad, 0x7a, 0x42, 0x60, 0x56, 0x42, 0x47, 0x47, 0x80, 0xb4, 0x6d, 0x72, 0xb6, 0x7f, 0x45,
-    0xb9, 0x29, 0x4e, 0x73, 0x49, 0x4b, 0x71, 0x4d, 0x26, 0x22, 0x51, 0x86, 0x64, 0x6c, 0xad, 0x7a, 0x41, 0xfd, 0xe2,
-    0x2d, 0x51, 0x25, 0x4e, 0x4f, 0x24, 0x52, 0x88, 0x64, 0x2c, 0x50, 0x25, 0x4c, 0x56, 0x01, 0x28, 0x56, 0x88, 0x01,
-    0xaf, 0x61, 0x8a, 0x28, 0x30, 0x88, 0x64, 0x58, 0x88, 0x5e, 0x31, 0x2d, 0x65, 0xa5, 0x78, 0x02, 0x4e, 0x6b, 0x43,
-    0x1d, 0x20, 0x38, 0x4e, 0x2f, 0x30, 0x46, 0x39, 0x34, 0x1d, 0x1d, 0x45, 0x62, 0x86, 0x5f, 0x5e, 0x8b, 0x29, 0x31,
-    0x88, 0x64, 0x54, 0x87, 0x60, 0x33, 0x39, 0x6d, 0xa1, 0x68, 0x3a, 0x67, 0x4b, 0x2c, 0x21, 0x39, 0x4e, 0x2d, 0x34,
-    0x48, 0x39, 0x31, 0x1c, 0x1e, 0x46, 0x60, 0x85, 0xa6, 0x0c, 0x19, 0x0e, 0x12, 0x64, 0x47, 0x35, 0x4a, 0x3b, 0x32,
-    0x1c, 0x0d, 0x18, 0x0e, 0x14, 0x63, 0x47, 0x30, 0x49, 0x3c, 0x35, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x1f, 0x04,
-    0xf0, 0x03, 0xa8, 0x05, 0xc5, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x17, 0x40, 0x14, 0x03, 0x01, 0x01, 0x01, 0x00, 0x5b,
-    0x02, 0x01, 0x00, 0x00, 0x44, 0x01, 0x4c, 0x24, 0x24, 0x24, 0x22, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x34, 0x36, 0x33,
-    0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x25, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22,
-    0x26, 0x01, 0x1f, 0x37, 0x36, 0x36, 0x38, 0x38, 0x36, 0x36, 0x37, 0x01, 0xae, 0x37, 0x36, 0x36, 0x38, 0x38, 0x36,
-    0x36, 0x37, 0x05, 0x5b, 0x2d, 0x3d, 0x3d, 0x2d, 0x2d, 0x3c, 0x3c, 0x2b, 0x2d, 0x3e, 0x3e, 0x2d, 0x2c, 0x3d, 0x3d,
-    0x00, 0x03, 0x00, 0x5a, 0xff, 0xeb, 0x04, 0x83, 0x04, 0x4e, 0x00, 0x23, 0x00, 0x37, 0x00, 0x4d, 0x00, 0x4e, 0x40,
-    0x4b, 0x00, 0x02, 0x03, 0x05, 0x03, 0x02, 0x05, 0x70, 0x0a, 0x01, 0x05, 0x04, 0x03, 0x05, 0x04, 0x6e, 0x00, 0x01,
-    0x00, 0x03, 0x02, 0x01, 0x03, 0x63, 0x00, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x63, 0x00, 0x07, 0x07, 0x08, 0x5b,
-    0x00, 0x08, 0x08, 0x47, 0x4b, 0x00, 0x06, 0x06, 0x09, 0x5b, 0x00, 0x09, 0x09, 0x45, 0x09, 0x4c, 0x00, 0x00, 0x4a,
-    0x48, 0x40, 0x3e, 0x34, 0x32, 0x2a, 0x28, 0x00, 0x23, 0x00, 0x23, 0x29, 0x22, 0x12, 0x29, 0x22, 0x0b, 0x08, 0x19,
-    0x2b, 0x01, 0x14, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x15, 0x23, 0x26,
-    0x26, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x25, 0x14, 0x1e, 0x02, 0x33,
-    0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x34, 0x3e, 0x04, 0x33, 0x32, 0x1e, 0x02,
-    0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x03, 0x5e, 0x83, 0x76, 0x3e, 0x60, 0x42, 0x24, 0x24, 0x42, 0x60,
-    0x3e, 0x76, 0x84, 0x6e, 0x01, 0x43, 0x48, 0x26, 0x39, 0x26, 0x12, 0x12, 0x26, 0x39, 0x26, 0x48, 0x42, 0x01, 0xfd,
-    0xc1, 0x44, 0x78, 0xa3, 0x5f, 0x5e, 0xa3, 0x78, 0x44, 0x44, 0x78, 0xa3, 0x5e, 0x5f, 0xa3, 0x78, 0x44, 0x57, 0x25,
-    0x44, 0x61, 0x76, 0x8a, 0x4b, 0x71, 0xc2, 0x8f, 0x52, 0x52, 0x8f, 0xc2, 0x71, 0x71, 0xc3, 0x8f, 0x52, 0x01, 0xbb,
-    0x74, 0x77, 0x2c, 0x4d, 0x6a, 0x3f, 0x57, 0x3e, 0x6b, 0x4e, 0x2c, 0x78, 0x73, 0x47, 0x42, 0x1e, 0x33, 0x47, 0x28,
-    0x58, 0x29, 0x46, 0x34, 0x1e, 0x42, 0x48, 0x63, 0x62, 0xad, 0x81, 0x4a, 0x4b, 0x81, 0xac, 0x62, 0x61, 0xab, 0x80,
-    0x49, 0x49, 0x80, 0xab, 0x61, 0x4e, 0x8f, 0x7d, 0x66, 0x48, 0x28, 0x58, 0x97, 0xcc, 0x75, 0x75, 0xcd, 0x99, 0x58,
-    0x58, 0x99, 0xcd, 0x00, 0x02, 0x01, 0x1c, 0x02, 0xb3, 0x03, 0xb1, 0x05, 0xc4, 0x00, 0x22, 0x00, 0x2f, 0x00, 0xb5,
-    0x4b, 0xb0, 0x23, 0x50, 0x58, 0x40, 0x0f, 0x14, 0x13, 0x02, 0x01, 0x02, 0x28, 0x01, 0x05, 0x06, 0x02, 0x01, 0x00,
-    0x05, 0x03, 0x4a, 0x1b, 0x40, 0x0f, 0x14, 0x13, 0x02, 0x01, 0x02, 0x28, 0x01, 0x05, 0x06, 0x02, 0x01, 0x04, 0x05,
-    0x03, 0x4a, 0x59, 0x4b, 0xb0, 0x16, 0x50, 0x58, 0x40, 0x1f, 0x08, 0x01, 0x05, 0x07, 0x04, 0x02, 0x00, 0x05, 0x00,
-    0x5f, 0x00, 0x02, 0x02, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x44, 0x4b, 0x00, 0x06, 0x06, 0x01, 0x5b, 0x00, 0x01, 0x01,
-    0x47, 0x06, 0x4c, 0x1b, 0x4b, 0xb0, 0x23, 0x50, 0x58, 0x40, 0x1d, 0x00, 0x01, 0x00, 0x06, 0x05, 0x01, 0x06, 0x63,
-    0x08, 0x01, 0x05, 0x07, 0x04, 0x02, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x02, 0x02, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x44,
-    0x02, 0x4c, 0x1b, 0x40, 0x24, 0x07, 0x01, 0x04, 0x05, 0x00, 0x05, 0x04, 0x00, 0x70, 0x00, 0x01, 0x00, 0x06, 0x05,
-    0x01, 0x06, 0x63, 0x08, 0x01, 0x05, 0x00, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x02, 0x02, 0x03, 0x5b, 0x00, 0x03, 0x03,
-    0x44, 0x02, 0x4c, 0x59, 0x59, 0x40, 0x15, 0x24, 0x23, 0x00, 0x00, 0x2b, 0x29, 0x23, 0x2f, 0x24, 0x2f, 0x00, 0x22,
-    0x00, 0x22, 0x27, 0x23, 0x24, 0x24, 0x09, 0x08, 0x18, 0x2b, 0x01, 0x26, 0x27, 0x06, 0x06, 0x07, 0x22, 0x26, 0x35,
-    0x34, 0x36, 0x33, 0x33, 0x35, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x15,
-    0x11, 0x14, 0x16, 0x17, 0x25, 0x32, 0x3e, 0x02, 0x37, 0x35, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x03, 0x0c, 0x0f,
-    0x06, 0x1e, 0x70, 0x54, 0x76, 0x83, 0xad, 0x9e, 0x8d, 0x01, 0x3e, 0x3f, 0x43, 0x51, 0x01, 0xa1, 0x01, 0x2d, 0x51,
-    0x72, 0x45, 0x41, 0x6b, 0x4b, 0x2a, 0x0c, 0x0e, 0xfe, 0x8b, 0x1b, 0x3b, 0x33, 0x27, 0x08, 0x8c, 0x4f, 0x5b, 0x40,
-    0x02, 0xc1, 0x2c, 0x35, 0x2b, 0x43, 0x01, 0x7a, 0x69, 0x70, 0x77, 0x34, 0x41, 0x46, 0x35, 0x34, 0x0c, 0x33, 0x56,
-    0x3e, 0x22, 0x23, 0x45, 0x68, 0x44, 0xfe, 0xc6, 0x30, 0x58, 0x2d, 0x7b, 0x11, 0x1d, 0x24, 0x12, 0x6d, 0x42, 0x31,
-    0x2d, 0x31, 0x00, 0x00, 0xff, 0xff, 0x00, 0xd4, 0x00, 0x76, 0x03, 0xd7, 0x03, 0x92, 0x02, 0x27, 0x01, 0x74, 0xff,
-    0x48, 0xff, 0xdd, 0x01, 0x07, 0x01, 0x74, 0x00, 0x97, 0xff, 0xdd, 0x00, 0x12, 0xb1, 0x00, 0x01, 0xb8, 0xff, 0xdd,
-    0xb0, 0x33, 0x2b, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xdd, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0x01, 0x00, 0xbd, 0x01,
-    0x77, 0x03, 0xfb, 0x03, 0x20, 0x00, 0x05, 0x00, 0x3e, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x16, 0x00, 0x00, 0x01,
-    0x01, 0x00, 0x67, 0x00, 0x02, 0x01, 0x01, 0x02, 0x55, 0x00, 0x02, 0x02, 0x01, 0x59, 0x00, 0x01, 0x02, 0x01, 0x4d,
-    0x1b, 0x40, 0x15, 0x00, 0x00, 0x01, 0x00, 0x73, 0x00, 0x02, 0x01, 0x01, 0x02, 0x55, 0x00, 0x02, 0x02, 0x01, 0x59,
-    0x00, 0x01, 0x02, 0x01, 0x4d, 0x59, 0xb5, 0x11, 0x11, 0x10, 0x03, 0x08, 0x17, 0x2b, 0x01, 0x23, 0x11, 0x21, 0x35,
-    0x21, 0x03, 0xfb, 0xb9, 0xfd, 0x7b, 0x03, 0x3e, 0x01, 0x77, 0x01, 0x08, 0xa1, 0x00, 0x00, 0x00, 0x04, 0x00, 0x57,
-    0xff, 0xeb, 0x04, 0x80, 0x04, 0x4d, 0x00, 0x13, 0x00, 0x27, 0x00, 0x37, 0x00, 0x40, 0x00, 0x4c, 0x40, 0x49, 0x34,
-    0x01, 0x07, 0x08, 0x01, 0x4a, 0x06, 0x01, 0x04, 0x07, 0x02, 0x07, 0x04, 0x02, 0x70, 0x00, 0x05, 0x00, 0x09, 0x08,
-    0x05, 0x09, 0x63, 0x00, 0x08, 0x0a, 0x01, 0x07, 0x04, 0x08, 0x07, 0x61, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00,
-    0x00, 0x47, 0x4b, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x45, 0x01, 0x4c, 0x28, 0x28, 0x40, 0x3e, 0x3a,
-    0x38, 0x28, 0x37, 0x28, 0x37, 0x18, 0x21, 0x15, 0x28, 0x28, 0x28, 0x24, 0x0b, 0x08, 0x1b, 0x2b, 0x13, 0x34, 0x3e,
-    0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x14, 0x1e, 0x02, 0x33, 0x32,
-    0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x05, 0x15, 0x23, 0x11, 0x33, 0x32, 0x1e, 0x02, 0x15,
-    0x14, 0x06, 0x07, 0x13, 0x23, 0x27, 0x27, 0x33, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x23, 0x57, 0x52, 0x8f, 0xc3,
-    0x71, 0x71, 0xc2, 0x8f, 0x52, 0x52, 0x8f, 0xc2, 0x71, 0x71, 0xc3, 0x8f, 0x52, 0x57, 0x44, 0x78, 0xa3, 0x5f, 0x5e,
-    0xa3, 0x78, 0x44, 0x44, 0x78, 0xa3, 0x5e, 0x5f, 0xa3, 0x78, 0x44, 0x01, 0x4e, 0x6b, 0xd3, 0x37, 0x58, 0x3f, 0x22,
-    0x46, 0x42, 0x93, 0x6e, 0x78, 0x7d, 0x77, 0x30, 0x46, 0x3c, 0x49, 0x68, 0x02, 0x1c, 0x75, 0xcd, 0x98, 0x57, 0x57,
-    0x98, 0xcd, 0x75, 0x75, 0xcd, 0x97, 0x58, 0x58, 0x97, 0xcd, 0x75, 0x62, 0xab, 0x80, 0x4a, 0x4a, 0x80, 0xab, 0x62,
-    0x62, 0xac, 0x7f, 0x49, 0x49, 0x7f, 0xac, 0x99, 0xfd, 0x02, 0x7b, 0x18, 0x30, 0x48, 0x30, 0x38, 0x4e, 0x16, 0xfe,
-    0xe1, 0xfd, 0x61, 0x01, 0x2e, 0x2a, 0x37, 0x2c, 0x00, 0x00, 0x01, 0x01, 0x01, 0x05, 0x21, 0x03, 0xcb, 0x05, 0xb0,
-    0x00, 0x03, 0x00, 0x13, 0x40, 0x10, 0x00, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x3c, 0x00, 0x4c, 0x11, 0x10,
-    0x02, 0x08, 0x16, 0x2b, 0x01, 0x21, 0x35, 0x21, 0x03, 0xcb, 0xfd, 0x36, 0x02, 0xca, 0x05, 0x21, 0x8f, 0x00, 0x00,
-    0x00, 0x02, 0x01, 0x69, 0x03, 0xc0, 0x03, 0x62, 0x05, 0xc4, 0x00, 0x13, 0x00, 0x27, 0x00, 0x1f, 0x40, 0x1c, 0x00,
-    0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x44, 0x4b, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x3f, 0x01,
-    0x4c, 0x28, 0x28, 0x28, 0x24, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23,
-    0x22, 0x0e, 0x02, 0x01, 0x69, 0x29, 0x45, 0x5d, 0x34, 0x33, 0x5b, 0x44, 0x28, 0x28, 0x44, 0x5b, 0x33, 0x34, 0x5d,
-    0x45, 0x29, 0x7c, 0x15, 0x23, 0x30, 0x1b, 0x1b, 0x2e, 0x23, 0x13, 0x13, 0x23, 0x2e, 0x1b, 0x1b, 0x30, 0x23, 0x15,
-    0x04, 0xc0, 0x35, 0x5f, 0x47, 0x29, 0x29, 0x47, 0x5f, 0x35, 0x35, 0x5e, 0x45, 0x28, 0x28, 0x45, 0x5d, 0x36, 0x1b,
-    0x2f, 0x23, 0x13, 0x13, 0x23, 0x2f, 0x1b, 0x1c, 0x31, 0x24, 0x14, 0x14, 0x24, 0x31, 0x00, 0x00, 0x02, 0x00, 0x9c,
-    0x00, 0x01, 0x04, 0x30, 0x04, 0xf3, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x2b, 0x40, 0x28, 0x04, 0x01, 0x00, 0x03, 0x01,
-    0x01, 0x02, 0x00, 0x01, 0x61, 0x00, 0x05, 0x00, 0x02, 0x07, 0x05, 0x02, 0x61, 0x00, 0x07, 0x07, 0x06, 0x59, 0x00,
-    0x06, 0x06, 0x3d, 0x06, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x08, 0x08, 0x1c, 0x2b, 0x01, 0x21,
-    0x15, 0x21, 0x11, 0x23, 0x11, 0x21, 0x35, 0x21, 0x11, 0x33, 0x01, 0x21, 0x35, 0x21, 0x02, 0xc5, 0x01, 0x6b, 0xfe,
-    0x95, 0xa8, 0xfe, 0x7f, 0x01, 0x81, 0xa8, 0x01, 0x41, 0xfc, 0xbd, 0x03, 0x43, 0x03, 0x57, 0x98, 0xfe, 0x62, 0x01,
-    0x9e, 0x98, 0x01, 0x9c, 0xfb, 0x0e, 0x97, 0x00, 0x00, 0x00, 0x01, 0x01, 0x3c, 0x02, 0x9b, 0x03, 0xa6, 0x05, 0xbb,
-    0x00, 0x1e, 0x00, 0x96, 0xb5, 0x02, 0x01, 0x00, 0x04, 0x01, 0x4a, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x1a, 0x00,
-    0x02, 0x01, 0x04, 0x01, 0x02, 0x04, 0x70, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x5d, 0x00, 0x01, 0x01, 0x03, 0x5b,
-    0x00, 0x03, 0x03, 0x3c, 0x01, 0x4c, 0x1b, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40, 0x1a, 0x00, 0x02, 0x01, 0x04, 0x01,
-    0x02, 0x04, 0x70, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x5d, 0x00, 0x01, 0x01, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x44,
-    0x01, 0x4c, 0x1b, 0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40, 0x1a, 0x00, 0x02, 0x01, 0x04, 0x01, 0x02, 0x04, 0x70, 0x00,
-    0x04, 0x00, 0x00, 0x04, 0x00, 0x5d, 0x00, 0x01, 0x01, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x3c, 0x01, 0x4c, 0x1b, 0x40,
-    0x1a, 0x00, 0x02, 0x01, 0x04, 0x01, 0x02, 0x04, 0x70, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x5d, 0x00, 0x01, 0x01,
-    0x03, 0x5b, 0x00, 0x03, 0x03, 0x44, 0x01, 0x4c, 0x59, 0x59, 0x59, 0xb7, 0x1a, 0x24, 0x12, 0x27, 0x10, 0x05, 0x08,
-    0x19, 0x2b, 0x01, 0x21, 0x35, 0x01, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x23, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x07, 0x21, 0x03, 0xa6, 0xfd, 0xa9, 0x01, 0x20, 0x41, 0x38,
-    0x42, 0x3a, 0x4a, 0x47, 0x01, 0x9e, 0x2a, 0x4e, 0x6f, 0x45, 0x42, 0x6a, 0x4a, 0x28, 0x1b, 0x33, 0x47, 0x2b, 0xaf,
-    0x01, 0x8f, 0x02, 0x9b, 0x6c, 0x01, 0x0f, 0x3c, 0x57, 0x23, 0x31, 0x3d, 0x4b, 0x3a, 0x36, 0x60, 0x47, 0x29, 0x21,
-    0x3e, 0x57, 0x37, 0x28, 0x47, 0x45, 0x47, 0x27, 0x91, 0x00, 0x00, 0x01, 0x01, 0x43, 0x02, 0x8f, 0x03, 0x9f, 0x05,
-    0xba, 0x00, 0x2f, 0x00, 0x76, 0xb5, 0x18, 0x01, 0x07, 0x00, 0x01, 0x4a, 0x4b, 0xb0, 0x2c, 0x50, 0x58, 0x40, 0x2c,
-    0x00, 0x02, 0x01, 0x00, 0x01, 0x02, 0x00, 0x70, 0x00, 0x05, 0x07, 0x06, 0x07, 0x05, 0x06, 0x70, 0x00, 0x06, 0x00,
-    0x04, 0x06, 0x04, 0x5f, 0x00, 0x01, 0x01, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x3c, 0x4b, 0x00, 0x07, 0x07, 0x00, 0x5b,
-    0x00, 0x00, 0x00, 0x47, 0x07, 0x4c, 0x1b, 0x40, 0x2a, 0x00, 0x02, 0x01, 0x00, 0x01, 0x02, 0x00, 0x70, 0x00, 0x05,
-    0x07, 0x06, 0x07, 0x05, 0x06, 0x70, 0x00, 0x00, 0x00, 0x07, 0x05, 0x00, 0x07, 0x63, 0x00, 0x06, 0x00, 0x04, 0x06,
-    0x04, 0x5f, 0x00, 0x01, 0x01, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x3c, 0x01, 0x4c, 0x59, 0x40, 0x0b, 0x24, 0x22, 0x14,
-    0x2d, 0x24, 0x12, 0x24, 0x20, 0x08, 0x08, 0x1c, 0x2b, 0x01, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
-    0x07, 0x23, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x07, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23,
-    0x22, 0x2e, 0x02, 0x35, 0x33, 0x16, 0x16, 0x33, 0x32, 0x36, 0x27, 0x34, 0x26, 0x23, 0x23, 0x02, 0x0e, 0x54, 0x46,
-    0x4c, 0x42, 0x43, 0x39, 0x4a, 0x01, 0x9d, 0x2d, 0x4d, 0x68, 0x3c, 0x40, 0x6c, 0x4e, 0x2b, 0x47, 0x41, 0x96, 0x2f,
-    0x53, 0x70, 0x40, 0x39, 0x6b, 0x53, 0x33, 0x9e, 0x01, 0x4f, 0x41, 0x44, 0x4c, 0x01, 0x57, 0x48, 0x54, 0x04, 0x65,
-    0x3a, 0x33, 0x2d, 0x3a, 0x30, 0x2c, 0x33, 0x52, 0x39, 0x1f, 0x1d, 0x39, 0x54, 0x37, 0x38, 0x5a, 0x19, 0x2a, 0x8e,
-    0x38, 0x56, 0x3a, 0x1f, 0x1b, 0x39, 0x58, 0x3d, 0x2e, 0x3b, 0x3c, 0x33, 0x3f, 0x34, 0x00, 0x00, 0x01, 0x01, 0x9a,
-    0x04, 0xbf, 0x03, 0x32, 0x05, 0xc9, 0x00, 0x03, 0x00, 0xda, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x01,
-    0x00, 0x01, 0x73, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x01,
-    0x00, 0x01, 0x73, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x01,
-    0x00, 0x01, 0x73, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x10, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x01,
-    0x00, 0x01, 0x73, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x12, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x01,
-    0x00, 0x01, 0x73, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x16, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x01,
-    0x00, 0x01, 0x73, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x01,
-    0x00, 0x01, 0x73, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x01,
-    0x00, 0x01, 0x73, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x01,
-    0x00, 0x01, 0x73, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x2a, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x01,
-    0x00, 0x01, 0x73, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x4c, 0x1b, 0x40, 0x09, 0x00, 0x00, 0x01, 0x00, 0x72, 0x00, 0x01,
-    0x01, 0x69, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0xb4, 0x11, 0x10, 0x02, 0x08, 0x16, 0x2b,
-    0x01, 0x33, 0x01, 0x23, 0x02, 0x52, 0xe0, 0xfe, 0xf4, 0x8c, 0x05, 0xc9, 0xfe, 0xf6, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0xbc, 0xfe, 0x60, 0x04, 0x10, 0x04, 0x3a, 0x00, 0x16, 0x00, 0x5d, 0x40, 0x0b, 0x09, 0x01, 0x00, 0x01, 0x13, 0x0e,
-    0x02, 0x02, 0x00, 0x02, 0x4a, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x18, 0x06, 0x05, 0x02, 0x01, 0x01, 0x3f, 0x4b,
-    0x00, 0x00, 0x00, 0x02, 0x5b, 0x03, 0x01, 0x02, 0x02, 0x3d, 0x4b, 0x00, 0x04, 0x04, 0x41, 0x04, 0x4c, 0x1b, 0x40,
-    0x1c, 0x06, 0x05, 0x02, 0x01, 0x01, 0x3f, 0x4b, 0x00, 0x02, 0x02, 0x3d, 0x4b, 0x00, 0x00, 0x00, 0x03, 0x5b, 0x00,
-    0x03, 0x03, 0x45, 0x4b, 0x00, 0x04, 0x04, 0x41, 0x04, 0x4c, 0x59, 0x40, 0x0e, 0x00, 0x00, 0x00, 0x16, 0x00, 0x16,
-    0x12, 0x23, 0x11, 0x13, 0x25, 0x07, 0x08, 0x19, 0x2b, 0x01, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x11,
-    0x33, 0x11, 0x23, 0x27, 0x06, 0x06, 0x23, 0x22, 0x27, 0x11, 0x23, 0x11, 0x01, 0x75, 0x20, 0x3b, 0x51, 0x30, 0x6b,
-    0x7d, 0x1d, 0xba, 0xa7, 0x09, 0x2c, 0x81, 0x5a, 0x92, 0x52, 0xb9, 0x04, 0x3a, 0xfd, 0x92, 0x64, 0x80, 0x4a, 0x1c,
-    0x52, 0x47, 0x03, 0x1f, 0xfb, 0xc6, 0x74, 0x41, 0x47, 0x49, 0xfe, 0x2b, 0x05, 0xda, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0xd3, 0x00, 0x00, 0x03, 0xd0, 0x05, 0xb0, 0x00, 0x0e, 0x00, 0x1f, 0x40, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x5b,
-    0x00, 0x01, 0x01, 0x3c, 0x4b, 0x03, 0x01, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x28,
-    0x21, 0x04, 0x08, 0x16, 0x2b, 0x21, 0x11, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x21, 0x11, 0x03,
-    0x16, 0x57, 0x76, 0xb7, 0x7e, 0x41, 0x41, 0x7e, 0xb7, 0x76, 0x01, 0x11, 0x02, 0x08, 0x46, 0x7c, 0xac, 0x66, 0x65,
-    0xab, 0x7d, 0x47, 0xfa, 0x50, 0x00, 0x00, 0x01, 0x01, 0xf8, 0x02, 0x6b, 0x02, 0xde, 0x03, 0x49, 0x00, 0x0b, 0x00,
-    0x18, 0x40, 0x15, 0x00, 0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x5b, 0x00, 0x01, 0x00, 0x01, 0x4f,
-    0x24, 0x22, 0x02, 0x08, 0x16, 0x2b, 0x01, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x01,
-    0xf8, 0x3a, 0x39, 0x38, 0x3b, 0x3b, 0x38, 0x39, 0x3a, 0x02, 0xd9, 0x30, 0x40, 0x40, 0x30, 0x2f, 0x3f, 0x3f, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x01, 0xcd, 0xfe, 0x4d, 0x03, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x26, 0x40, 0x23, 0x14,
-    0x01, 0x02, 0x01, 0x02, 0x01, 0x4a, 0x03, 0x01, 0x02, 0x01, 0x02, 0x72, 0x00, 0x01, 0x01, 0x00, 0x5c, 0x00, 0x00,
-    0x00, 0x49, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x15, 0x00, 0x15, 0x11, 0x18, 0x04, 0x08, 0x16, 0x2b, 0x21, 0x07, 0x1e,
-    0x03, 0x15, 0x14, 0x06, 0x07, 0x27, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x27, 0x37, 0x02, 0x76, 0x0c, 0x1d,
-    0x37, 0x2b, 0x1a, 0x9e, 0x91, 0x07, 0x22, 0x3c, 0x2d, 0x1b, 0x14, 0x29, 0x3c, 0x28, 0x1f, 0x34, 0x05, 0x18, 0x28,
-    0x3d, 0x2b, 0x61, 0x70, 0x01, 0x6b, 0x0b, 0x18, 0x25, 0x1b, 0x19, 0x22, 0x15, 0x0c, 0x03, 0x86, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x01, 0x82, 0x02, 0x99, 0x02, 0xf6, 0x05, 0xae, 0x00, 0x06, 0x00, 0x12, 0x40, 0x0f, 0x05, 0x04, 0x03,
-    0x02, 0x04, 0x00, 0x48, 0x00, 0x00, 0x00, 0x69, 0x10, 0x01, 0x08, 0x15, 0x2b, 0x01, 0x23, 0x11, 0x07, 0x35, 0x25,
-    0x33, 0x02, 0xf6, 0x9d, 0xd7, 0x01, 0x62, 0x12, 0x02, 0x99, 0x02, 0x59, 0x39, 0x80, 0x75, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x01, 0x10, 0x02, 0xb2, 0x03, 0xbc, 0x05, 0xc4, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x1c, 0x40, 0x19, 0x00, 0x02,
-    0x00, 0x01, 0x02, 0x01, 0x5f, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x44, 0x03, 0x4c, 0x29, 0x29, 0x29,
-    0x24, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23,
-    0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22,
-    0x0e, 0x02, 0x15, 0x01, 0x10, 0x30, 0x59, 0x7e, 0x4f, 0x4f, 0x7f, 0x59, 0x2f, 0x2f, 0x58, 0x7e, 0x4f, 0x50, 0x7f,
-    0x59, 0x30, 0xa3, 0x16, 0x2d, 0x44, 0x2e, 0x2c, 0x43, 0x2c, 0x17, 0x17, 0x2d, 0x43, 0x2d, 0x2d, 0x43, 0x2d, 0x16,
-    0x04, 0x75, 0x49, 0x7b, 0x59, 0x32, 0x32, 0x59, 0x7b, 0x49, 0x75, 0x48, 0x7b, 0x59, 0x32, 0x32, 0x59, 0x7b, 0x48,
-    0x2a, 0x47, 0x34, 0x1e, 0x1e, 0x34, 0x47, 0x2a, 0x75, 0x29, 0x47, 0x35, 0x1e, 0x1e, 0x35, 0x47, 0x29, 0x00, 0xff,
-    0xff, 0x00, 0xf1, 0x00, 0x98, 0x03, 0xfe, 0x03, 0xb5, 0x02, 0x27, 0x01, 0x75, 0xff, 0x65, 0x00, 0x00, 0x00, 0x07,
-    0x01, 0x75, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x30, 0x00, 0x00, 0x04, 0x8d, 0x05, 0xb6, 0x00,
-    0x2f, 0x01, 0xc1, 0xfe, 0xf8, 0x02, 0xef, 0x39, 0x9a, 0x00, 0x26, 0x01, 0x76, 0xf6, 0x08, 0x01, 0x0f, 0x01, 0xc4,
-    0x01, 0x42, 0x00, 0x00, 0x39, 0x9a, 0x00, 0x11, 0xb1, 0x00, 0x01, 0xb8, 0x02, 0xef, 0xb0, 0x33, 0x2b, 0xb1, 0x01,
-    0x01, 0xb0, 0x08, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x24, 0x00, 0x00, 0x04, 0x96, 0x05, 0xb2, 0x02, 0x26,
-    0x01, 0x76, 0xba, 0x08, 0x00, 0x2f, 0x01, 0xc1, 0xfe, 0xec, 0x02, 0xeb, 0x39, 0x9a, 0x01, 0x0f, 0x01, 0x96, 0x01,
-    0x4f, 0x00, 0x00, 0x39, 0x9a, 0x00, 0x11, 0xb1, 0x00, 0x01, 0xb0, 0x08, 0xb0, 0x33, 0x2b, 0xb1, 0x01, 0x01, 0xb8,
-    0x02, 0xeb, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x25, 0x00, 0x00, 0x04, 0xae, 0x05, 0xb8, 0x02, 0x26, 0x01,
-    0x76, 0x39, 0x07, 0x00, 0x2f, 0x01, 0xc4, 0x01, 0x63, 0x00, 0x00, 0x39, 0x9a, 0x01, 0x0f, 0x01, 0xc3, 0xff, 0x0d,
-    0x02, 0xe8, 0x39, 0x9a, 0x00, 0x11, 0xb1, 0x00, 0x01, 0xb0, 0x07, 0xb0, 0x33, 0x2b, 0xb1, 0x03, 0x01, 0xb8, 0x02,
-    0xe8, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x02, 0x00, 0xcc, 0xfe, 0x78, 0x04, 0x00, 0x04, 0x4d, 0x00, 0x27, 0x00, 0x33,
-    0x00, 0x65, 0x4b, 0xb0, 0x2a, 0x50, 0x58, 0x40, 0x25, 0x06, 0x01, 0x03, 0x05, 0x01, 0x05, 0x03, 0x01, 0x70, 0x00,
-    0x01, 0x00, 0x05, 0x01, 0x00, 0x6e, 0x00, 0x05, 0x05, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x47, 0x4b, 0x00, 0x00, 0x00,
-    0x02, 0x5c, 0x00, 0x02, 0x02, 0x41, 0x02, 0x4c, 0x1b, 0x40, 0x22, 0x06, 0x01, 0x03, 0x05, 0x01, 0x05, 0x03, 0x01,
-    0x70, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x60, 0x00, 0x05, 0x05, 0x04,
-    0x5b, 0x00, 0x04, 0x04, 0x47, 0x05, 0x4c, 0x59, 0x40, 0x10, 0x00, 0x00, 0x32, 0x30, 0x2c, 0x2a, 0x00, 0x27, 0x00,
-    0x27, 0x24, 0x14, 0x2c, 0x07, 0x08, 0x17, 0x2b, 0x01, 0x0e, 0x03, 0x07, 0x0e, 0x03, 0x15, 0x14, 0x16, 0x33, 0x32,
-    0x3e, 0x02, 0x35, 0x33, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x3e, 0x03, 0x35, 0x03,
-    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x02, 0xd4, 0x01, 0x09, 0x1e, 0x3b, 0x31, 0x1f,
-    0x42, 0x37, 0x23, 0x74, 0x6d, 0x2b, 0x51, 0x3f, 0x26, 0xb9, 0x01, 0x3f, 0x6e, 0x95, 0x57, 0x61, 0x99, 0x69, 0x37,
-    0x2f, 0x49, 0x5b, 0x2d, 0x1d, 0x20, 0x0f, 0x03, 0x1e, 0x3a, 0x39, 0x39, 0x3a, 0x3a, 0x39, 0x39, 0x3a, 0x02, 0xa1,
-    0x47, 0x5c, 0x48, 0x43, 0x2d, 0x23, 0x4b, 0x52, 0x5a, 0x33, 0x6d, 0x73, 0x17, 0x31, 0x4b, 0x34, 0x54, 0x86, 0x5d,
-    0x31, 0x33, 0x62, 0x8c, 0x5a, 0x48, 0x80, 0x71, 0x63, 0x2b, 0x1d, 0x32, 0x35, 0x3c, 0x27, 0x01, 0x3b, 0x30, 0x41,
-    0x41, 0x30, 0x2e, 0x3f, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x20, 0x00, 0x00, 0x04, 0xab, 0x05, 0xb0, 0x00, 0x0f, 0x00,
-    0x12, 0x00, 0x3b, 0x40, 0x38, 0x12, 0x01, 0x05, 0x04, 0x01, 0x4a, 0x00, 0x05, 0x00, 0x06, 0x08, 0x05, 0x06, 0x61,
-    0x00, 0x08, 0x00, 0x01, 0x07, 0x08, 0x01, 0x61, 0x00, 0x04, 0x04, 0x03, 0x59, 0x00, 0x03, 0x03, 0x3c, 0x4b, 0x00,
-    0x07, 0x07, 0x00, 0x59, 0x02, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x10, 0x09, 0x08, 0x1d, 0x2b, 0x21, 0x21, 0x03, 0x21, 0x03, 0x23, 0x01, 0x21, 0x15, 0x21, 0x13, 0x21, 0x15, 0x21,
-    0x13, 0x21, 0x01, 0x33, 0x03, 0x04, 0xab, 0xfd, 0xed, 0x01, 0xfe, 0xca, 0x7b, 0xc6, 0x02, 0x30, 0x02, 0x44, 0xfe,
-    0xaf, 0x02, 0x01, 0x2e, 0xfe, 0xd2, 0x01, 0x01, 0x65, 0xfc, 0xf3, 0xf9, 0x02, 0x01, 0x61, 0xfe, 0x9f, 0x05, 0xb0,
-    0x98, 0xfe, 0x29, 0x97, 0xfd, 0xed, 0x01, 0x78, 0x02, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb5, 0x00, 0xce,
-    0x04, 0x3a, 0x04, 0x63, 0x00, 0x0b, 0x00, 0x06, 0xb3, 0x09, 0x03, 0x01, 0x30, 0x2b, 0x13, 0x01, 0x01, 0x37, 0x01,
-    0x01, 0x17, 0x01, 0x01, 0x07, 0x01, 0x01, 0xb5, 0x01, 0x4a, 0xfe, 0xb9, 0x77, 0x01, 0x48, 0x01, 0x49, 0x77, 0xfe,
-    0xb8, 0x01, 0x4b, 0x77, 0xfe, 0xb4, 0xfe, 0xb5, 0x01, 0x49, 0x01, 0x51, 0x01, 0x4e, 0x7b, 0xfe, 0xb1, 0x01, 0x4f,
-    0x7b, 0xfe, 0xb2, 0xfe, 0xaf, 0x7b, 0x01, 0x51, 0xfe, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x47, 0xff, 0xa3,
-    0x04, 0x8c, 0x05, 0xec, 0x00, 0x25, 0x00, 0x34, 0x00, 0x43, 0x00, 0x3e, 0x40, 0x3b, 0x1d, 0x01, 0x04, 0x02, 0x39,
-    0x38, 0x2a, 0x29, 0x20, 0x0d, 0x06, 0x05, 0x04, 0x0a, 0x01, 0x00, 0x05, 0x03, 0x4a, 0x00, 0x01, 0x00, 0x01, 0x73,
-    0x00, 0x03, 0x03, 0x3e, 0x4b, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x44, 0x4b, 0x00, 0x05, 0x05, 0x00,
-    0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x2d, 0x2d, 0x13, 0x2d, 0x13, 0x26, 0x06, 0x08, 0x1a, 0x2b, 0x01, 0x0e,
-    0x05, 0x23, 0x22, 0x26, 0x27, 0x07, 0x23, 0x13, 0x2e, 0x03, 0x35, 0x35, 0x3e, 0x05, 0x33, 0x32, 0x16, 0x17, 0x37,
-    0x33, 0x03, 0x1e, 0x03, 0x17, 0x05, 0x16, 0x16, 0x17, 0x01, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x04, 0x07, 0x21, 0x26,
-    0x26, 0x27, 0x01, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x04, 0x37, 0x04, 0x59, 0x01, 0x19, 0x34, 0x51, 0x70, 0x91, 0x5a,
-    0x5b, 0x8e, 0x39, 0x68, 0x8e, 0xa0, 0x22, 0x32, 0x21, 0x10, 0x01, 0x19, 0x35, 0x51, 0x70, 0x91, 0x5a, 0x66, 0x9d,
-    0x3b, 0x63, 0x8e, 0xa1, 0x1c, 0x29, 0x1b, 0x0d, 0x01, 0xfc, 0xbf, 0x01, 0x17, 0x1d, 0x01, 0xf2, 0x25, 0x6f, 0x4e,
-    0x40, 0x62, 0x48, 0x30, 0x1d, 0x0d, 0x01, 0x02, 0x8a, 0x01, 0x0f, 0x13, 0xfe, 0x15, 0x25, 0x64, 0x42, 0x41, 0x63,
-    0x47, 0x2f, 0x1d, 0x0b, 0x01, 0x02, 0x84, 0x4e, 0x9f, 0x94, 0x80, 0x60, 0x37, 0x37, 0x30, 0xb0, 0x01, 0x0e, 0x31,
-    0x70, 0x78, 0x7d, 0x3d, 0xa6, 0x4e, 0x9f, 0x94, 0x81, 0x61, 0x37, 0x45, 0x3b, 0xa8, 0xfe, 0xf0, 0x2f, 0x69, 0x6f,
-    0x73, 0x38, 0xa6, 0x45, 0x9b, 0x46, 0x03, 0x4b, 0x35, 0x41, 0x2e, 0x4d, 0x65, 0x6f, 0x71, 0x33, 0x3a, 0x81, 0x3e,
-    0xfc, 0xc2, 0x29, 0x2f, 0x2e, 0x4d, 0x65, 0x6f, 0x72, 0x34, 0x00, 0x00, 0x02, 0x00, 0xa8, 0x00, 0x00, 0x04, 0x5e,
-    0x05, 0xb0, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x34, 0x40, 0x31, 0x00, 0x00, 0x07, 0x01, 0x05, 0x04, 0x00, 0x05, 0x63,
-    0x00, 0x04, 0x00, 0x01, 0x02, 0x04, 0x01, 0x63, 0x06, 0x01, 0x03, 0x03, 0x3c, 0x4b, 0x00, 0x02, 0x02, 0x3d, 0x02,
-    0x4c, 0x11, 0x11, 0x00, 0x00, 0x11, 0x1d, 0x11, 0x1c, 0x14, 0x12, 0x00, 0x10, 0x00, 0x10, 0x11, 0x28, 0x21, 0x08,
-    0x08, 0x17, 0x2b, 0x01, 0x11, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x23, 0x11, 0x13,
-    0x11, 0x21, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x01, 0x61, 0x01, 0x15, 0x75, 0xb5, 0x7d, 0x41, 0x41,
-    0x7d, 0xb5, 0x75, 0xfe, 0xeb, 0xb9, 0xb9, 0x01, 0x15, 0x4e, 0x72, 0x4b, 0x24, 0x24, 0x4a, 0x73, 0x4e, 0x05, 0xb0,
-    0xfe, 0xdb, 0x3f, 0x71, 0x9c, 0x5d, 0x5d, 0x9c, 0x71, 0x3f, 0xfe, 0xc7, 0x05, 0xb0, 0xfe, 0x43, 0xfd, 0xde, 0x2d,
-    0x4b, 0x62, 0x35, 0x36, 0x63, 0x4d, 0x2d, 0x00, 0x01, 0x00, 0xa9, 0xff, 0xeb, 0x04, 0x4c, 0x06, 0x16, 0x00, 0x43,
-    0x00, 0x51, 0x40, 0x0a, 0x23, 0x01, 0x03, 0x04, 0x22, 0x01, 0x00, 0x03, 0x02, 0x4a, 0x4b, 0xb0, 0x17, 0x50, 0x58,
-    0x40, 0x14, 0x00, 0x01, 0x00, 0x04, 0x03, 0x01, 0x04, 0x63, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x02, 0x01, 0x00, 0x00,
-    0x3d, 0x00, 0x4c, 0x1b, 0x40, 0x18, 0x00, 0x01, 0x00, 0x04, 0x03, 0x01, 0x04, 0x63, 0x00, 0x00, 0x00, 0x3d, 0x4b,
-    0x00, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x45, 0x02, 0x4c, 0x59, 0x40, 0x0b, 0x41, 0x3f, 0x29, 0x27, 0x1e,
-    0x1c, 0x25, 0x10, 0x05, 0x08, 0x16, 0x2b, 0x21, 0x23, 0x11, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14,
-    0x0e, 0x02, 0x15, 0x14, 0x1e, 0x04, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x37, 0x1e, 0x03, 0x33,
-    0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x04, 0x35, 0x34, 0x3e, 0x04, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x07,
-    0x01, 0x61, 0xb8, 0x3b, 0x69, 0x90, 0x55, 0x4b, 0x82, 0x62, 0x38, 0x28, 0x30, 0x27, 0x2d, 0x44, 0x50, 0x44, 0x2d,
-    0x33, 0x5c, 0x7f, 0x4c, 0x29, 0x58, 0x51, 0x44, 0x14, 0x2a, 0x12, 0x35, 0x3f, 0x45, 0x22, 0x2f, 0x44, 0x2c, 0x15,
-    0x2d, 0x44, 0x50, 0x44, 0x2e, 0x14, 0x1f, 0x24, 0x1f, 0x14, 0x1e, 0x31, 0x3f, 0x20, 0x63, 0x77, 0x01, 0x04, 0x3f,
-    0x70, 0xb0, 0x78, 0x3f, 0x29, 0x54, 0x7f, 0x56, 0x4f, 0x6b, 0x54, 0x4d, 0x32, 0x2e, 0x4a, 0x46, 0x46, 0x52, 0x64,
-    0x41, 0x55, 0x7e, 0x54, 0x2a, 0x0b, 0x13, 0x1a, 0x10, 0x9b, 0x0b, 0x1b, 0x17, 0x0f, 0x1b, 0x30, 0x40, 0x26, 0x2f,
-    0x4d, 0x45, 0x47, 0x53, 0x67, 0x44, 0x27, 0x42, 0x3b, 0x37, 0x3b, 0x3f, 0x26, 0x32, 0x4b, 0x33, 0x1a, 0xa4, 0x9b,
-    0x00, 0x00, 0x03, 0x00, 0x2b, 0xff, 0xec, 0x04, 0xa9, 0x04, 0x4e, 0x00, 0x3b, 0x00, 0x48, 0x00, 0x57, 0x00, 0x6a,
-    0x40, 0x67, 0x21, 0x01, 0x03, 0x05, 0x4c, 0x36, 0x02, 0x08, 0x07, 0x37, 0x03, 0x02, 0x00, 0x08, 0x03, 0x4a, 0x00,
-    0x04, 0x03, 0x02, 0x03, 0x04, 0x02, 0x70, 0x0a, 0x01, 0x02, 0x0c, 0x01, 0x07, 0x08, 0x02, 0x07, 0x63, 0x0e, 0x09,
-    0x02, 0x03, 0x03, 0x05, 0x5b, 0x06, 0x01, 0x05, 0x05, 0x47, 0x4b, 0x0f, 0x0b, 0x02, 0x08, 0x08, 0x00, 0x5b, 0x01,
-    0x0d, 0x02, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x4a, 0x49, 0x3d, 0x3c, 0x01, 0x00, 0x4f, 0x4d, 0x49, 0x57, 0x4a, 0x57,
-    0x43, 0x42, 0x3c, 0x48, 0x3d, 0x48, 0x32, 0x30, 0x2b, 0x2a, 0x25, 0x23, 0x1f, 0x1d, 0x19, 0x18, 0x16, 0x14, 0x11,
-    0x0f, 0x09, 0x07, 0x00, 0x3b, 0x01, 0x3b, 0x10, 0x08, 0x14, 0x2b, 0x05, 0x22, 0x26, 0x27, 0x0e, 0x03, 0x23, 0x22,
-    0x2e, 0x02, 0x35, 0x34, 0x36, 0x33, 0x33, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x27, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x16, 0x17, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x21, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e,
-    0x02, 0x37, 0x17, 0x0e, 0x03, 0x03, 0x22, 0x0e, 0x02, 0x07, 0x15, 0x21, 0x35, 0x34, 0x2e, 0x02, 0x01, 0x32, 0x36,
-    0x37, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x03, 0x80, 0x67, 0x94, 0x2e, 0x13, 0x33, 0x42, 0x50,
-    0x30, 0x47, 0x6c, 0x4a, 0x27, 0xd0, 0xc5, 0x3f, 0x3e, 0x44, 0x3f, 0x4e, 0xb3, 0x2d, 0x53, 0x76, 0x48, 0x53, 0x7d,
-    0x27, 0x2b, 0x77, 0x4a, 0x51, 0x7b, 0x54, 0x2b, 0xfe, 0x07, 0x1b, 0x3b, 0x5c, 0x42, 0x26, 0x3b, 0x2f, 0x26, 0x10,
-    0x2e, 0x0d, 0x2e, 0x45, 0x5d, 0x5d, 0x2d, 0x41, 0x2a, 0x15, 0x01, 0x01, 0x49, 0x14, 0x28, 0x3a, 0xfd, 0xf0, 0x25,
-    0x4c, 0x1c, 0x01, 0x3d, 0x35, 0x54, 0x3a, 0x1f, 0x13, 0x25, 0x37, 0x14, 0x4b, 0x47, 0x1d, 0x35, 0x28, 0x18, 0x2c,
-    0x4f, 0x71, 0x45, 0xa6, 0xb8, 0x94, 0x4c, 0x5b, 0x53, 0x4b, 0x08, 0x45, 0x6f, 0x4f, 0x2b, 0x36, 0x35, 0x33, 0x38,
-    0x35, 0x61, 0x89, 0x54, 0xea, 0x56, 0x42, 0x68, 0x48, 0x27, 0x0e, 0x15, 0x18, 0x0b, 0x88, 0x0a, 0x1d, 0x1a, 0x13,
-    0x03, 0xca, 0x27, 0x42, 0x58, 0x30, 0x45, 0x80, 0x23, 0x41, 0x33, 0x1f, 0xfc, 0xcc, 0x2b, 0x1d, 0x01, 0x25, 0x23,
-    0x3b, 0x4d, 0x2b, 0x1f, 0x37, 0x29, 0x18, 0x00, 0x02, 0x00, 0x49, 0xff, 0xec, 0x04, 0x2a, 0x05, 0xf1, 0x00, 0x25,
-    0x00, 0x3d, 0x00, 0x31, 0x40, 0x2e, 0x16, 0x01, 0x02, 0x01, 0x01, 0x4a, 0x25, 0x24, 0x23, 0x20, 0x1f, 0x1c, 0x1b,
-    0x1a, 0x19, 0x09, 0x01, 0x48, 0x00, 0x01, 0x00, 0x02, 0x03, 0x01, 0x02, 0x63, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00,
-    0x00, 0x00, 0x45, 0x00, 0x4c, 0x39, 0x37, 0x2f, 0x2d, 0x28, 0x28, 0x04, 0x08, 0x16, 0x2b, 0x01, 0x16, 0x12, 0x15,
-    0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x26, 0x26, 0x27,
-    0x05, 0x27, 0x37, 0x26, 0x26, 0x27, 0x37, 0x16, 0x16, 0x17, 0x37, 0x17, 0x03, 0x34, 0x26, 0x35, 0x2e, 0x03, 0x23,
-    0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x03, 0x4d, 0x68, 0x75, 0x4b, 0x86, 0xb7,
-    0x6d, 0x6c, 0xb5, 0x83, 0x48, 0x49, 0x83, 0xb3, 0x69, 0x58, 0x99, 0x39, 0x17, 0x5a, 0x3e, 0xfe, 0xf6, 0x49, 0xef,
-    0x29, 0x57, 0x2e, 0x39, 0x50, 0x8f, 0x3f, 0xe6, 0x49, 0xaf, 0x01, 0x11, 0x39, 0x50, 0x67, 0x3e, 0x45, 0x70, 0x4f,
-    0x2a, 0x2a, 0x4f, 0x73, 0x4a, 0x48, 0x73, 0x51, 0x2c, 0x05, 0x06, 0x76, 0xfe, 0xb7, 0xce, 0x3e, 0x8a, 0xdb, 0x99,
-    0x51, 0x4b, 0x84, 0xb2, 0x66, 0x73, 0xbc, 0x86, 0x49, 0x44, 0x38, 0x6e, 0xa8, 0x3f, 0x98, 0x63, 0x89, 0x1b, 0x29,
-    0x10, 0x9f, 0x16, 0x49, 0x33, 0x84, 0x64, 0xfc, 0xfc, 0x0d, 0x18, 0x0d, 0x1b, 0x33, 0x27, 0x17, 0x39, 0x62, 0x82,
-    0x49, 0x3e, 0x79, 0x5f, 0x3b, 0x40, 0x73, 0xa3, 0x63, 0x00, 0x00, 0x00, 0x03, 0x00, 0x73, 0x00, 0xb1, 0x04, 0x59,
-    0x04, 0xb4, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x2c, 0x40, 0x29, 0x00, 0x02, 0x00, 0x03, 0x01, 0x02, 0x03,
-    0x63, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x61, 0x00, 0x04, 0x05, 0x05, 0x04, 0x57, 0x00, 0x04, 0x04, 0x05,
-    0x5b, 0x00, 0x05, 0x04, 0x05, 0x4f, 0x24, 0x24, 0x24, 0x23, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x01, 0x21, 0x35,
-    0x21, 0x01, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x03, 0x34, 0x36, 0x33, 0x32, 0x16,
-    0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x04, 0x59, 0xfc, 0x1a, 0x03, 0xe6, 0xfd, 0xa2, 0x37, 0x36, 0x36, 0x38, 0x38,
-    0x36, 0x36, 0x37, 0x02, 0x37, 0x36, 0x36, 0x38, 0x38, 0x36, 0x36, 0x37, 0x02, 0x58, 0xb8, 0x01, 0x39, 0x2d, 0x3e,
-    0x3e, 0x2d, 0x2d, 0x3c, 0x3c, 0xfc, 0xfe, 0x2d, 0x3e, 0x3e, 0x2d, 0x2c, 0x3d, 0x3d, 0x00, 0x03, 0x00, 0x7a, 0xff,
-    0x79, 0x04, 0x52, 0x04, 0xb9, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x3e, 0x40, 0x3b, 0x0b, 0x08, 0x02, 0x04,
-    0x00, 0x2f, 0x2e, 0x22, 0x21, 0x04, 0x05, 0x04, 0x1a, 0x17, 0x02, 0x02, 0x05, 0x03, 0x4a, 0x00, 0x01, 0x00, 0x01,
-    0x72, 0x00, 0x03, 0x02, 0x03, 0x73, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x05, 0x05,
-    0x02, 0x5b, 0x00, 0x02, 0x02, 0x45, 0x02, 0x4c, 0x2a, 0x2b, 0x13, 0x29, 0x13, 0x24, 0x06, 0x08, 0x1a, 0x2b, 0x13,
-    0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x37, 0x33, 0x07, 0x16, 0x16, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22,
-    0x26, 0x27, 0x07, 0x23, 0x37, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x17, 0x01, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02,
-    0x15, 0x21, 0x34, 0x26, 0x27, 0x01, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x7a, 0x44, 0x7f, 0xb6, 0x72, 0x39, 0x65,
-    0x2d, 0x49, 0x7b, 0x65, 0x5e, 0x65, 0x44, 0x7f, 0xb6, 0x72, 0x36, 0x5f, 0x2b, 0x4a, 0x7b, 0x65, 0x63, 0x6a, 0xb9,
-    0x30, 0x30, 0x01, 0x56, 0x1d, 0x41, 0x26, 0x4d, 0x72, 0x4d, 0x26, 0x02, 0x66, 0x2c, 0x2d, 0xfe, 0xac, 0x37, 0x44,
-    0x4c, 0x73, 0x4d, 0x26, 0x02, 0x27, 0x75, 0xc9, 0x94, 0x55, 0x15, 0x14, 0x94, 0xcd, 0x4b, 0xea, 0x90, 0x16, 0x75,
-    0xc8, 0x94, 0x54, 0x13, 0x11, 0x97, 0xcd, 0x49, 0xee, 0x94, 0x5b, 0x9d, 0x39, 0x02, 0xb6, 0x0f, 0x11, 0x41, 0x6e,
-    0x91, 0x4f, 0x55, 0x98, 0x39, 0xfd, 0x4f, 0x1a, 0x40, 0x6e, 0x91, 0x50, 0x00, 0x00, 0x00, 0x02, 0x00, 0xad, 0xfe,
-    0x60, 0x04, 0x3f, 0x06, 0x16, 0x00, 0x15, 0x00, 0x27, 0x00, 0x3a, 0x40, 0x37, 0x0d, 0x01, 0x04, 0x03, 0x1f, 0x1e,
-    0x02, 0x05, 0x04, 0x08, 0x01, 0x00, 0x05, 0x03, 0x4a, 0x00, 0x02, 0x03, 0x02, 0x72, 0x00, 0x04, 0x04, 0x03, 0x5b,
-    0x00, 0x03, 0x03, 0x47, 0x4b, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x4b, 0x00, 0x01, 0x01, 0x41,
-    0x01, 0x4c, 0x25, 0x29, 0x23, 0x11, 0x13, 0x24, 0x06, 0x08, 0x1a, 0x2b, 0x01, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26,
-    0x27, 0x11, 0x23, 0x11, 0x33, 0x11, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34, 0x2e, 0x02, 0x23, 0x22,
-    0x06, 0x07, 0x11, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x04, 0x3f, 0x36, 0x6b, 0x9c, 0x66, 0x64, 0x9a, 0x38,
-    0xb9, 0xb9, 0x37, 0x98, 0x64, 0x68, 0x9e, 0x6a, 0x36, 0xb9, 0x22, 0x47, 0x6e, 0x4d, 0x5b, 0x7c, 0x25, 0x26, 0x7a,
-    0x5e, 0x4c, 0x6e, 0x46, 0x22, 0x02, 0x11, 0x74, 0xc9, 0x94, 0x54, 0x41, 0x3e, 0xfd, 0xf5, 0x07, 0xb6, 0xfd, 0xb4,
-    0x40, 0x44, 0x52, 0x92, 0xcb, 0x79, 0x4f, 0x8f, 0x6d, 0x40, 0x53, 0x42, 0xfd, 0xfa, 0x41, 0x52, 0x41, 0x6e, 0x90,
-    0x4f, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x18, 0x00, 0x00, 0x04, 0xbc, 0x05, 0xb0, 0x00, 0x13, 0x00, 0x17, 0x00,
-    0x36, 0x40, 0x33, 0x08, 0x06, 0x02, 0x00, 0x0b, 0x05, 0x02, 0x01, 0x0a, 0x00, 0x01, 0x61, 0x00, 0x0a, 0x00, 0x03,
-    0x02, 0x0a, 0x03, 0x61, 0x09, 0x01, 0x07, 0x07, 0x3c, 0x4b, 0x04, 0x01, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x17, 0x16,
-    0x15, 0x14, 0x13, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0c, 0x08, 0x1d, 0x2b, 0x01, 0x33,
-    0x15, 0x23, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x23, 0x35, 0x33, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x01,
-    0x21, 0x35, 0x21, 0x04, 0x3c, 0x80, 0x80, 0xaf, 0xfd, 0xab, 0xae, 0x72, 0x72, 0xae, 0x02, 0x55, 0xaf, 0xfc, 0xfc,
-    0x02, 0x55, 0xfd, 0xab, 0x04, 0x8f, 0x8f, 0xfc, 0x00, 0x02, 0xa1, 0xfd, 0x5f, 0x04, 0x00, 0x8f, 0x01, 0x21, 0xfe,
-    0xdf, 0x01, 0x21, 0xfd, 0x8e, 0xc2, 0x00, 0x00, 0x01, 0x00, 0xcb, 0x00, 0x00, 0x04, 0x55, 0x04, 0x3a, 0x00, 0x09,
-    0x00, 0x21, 0x40, 0x1e, 0x00, 0x04, 0x04, 0x00, 0x59, 0x00, 0x00, 0x00, 0x3f, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x02,
-    0x59, 0x00, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x10, 0x05, 0x08, 0x19, 0x2b, 0x13, 0x21, 0x11,
-    0x21, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0xcb, 0x02, 0x29, 0x01, 0x61, 0xfc, 0x76, 0x01, 0x70, 0xfe, 0x90, 0x04,
-    0x3a, 0xfc, 0x66, 0xa0, 0xa0, 0x02, 0xf9, 0x00, 0x02, 0x00, 0x80, 0xff, 0xed, 0x04, 0x4c, 0x05, 0xb0, 0x00, 0x03,
-    0x00, 0x19, 0x00, 0x4f, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x1a, 0x00, 0x04, 0x01, 0x05, 0x01, 0x04, 0x05, 0x70,
-    0x02, 0x01, 0x01, 0x01, 0x3c, 0x4b, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x03, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x1b,
-    0x40, 0x1e, 0x00, 0x04, 0x01, 0x05, 0x01, 0x04, 0x05, 0x70, 0x02, 0x01, 0x01, 0x01, 0x3c, 0x4b, 0x00, 0x00, 0x00,
-    0x3d, 0x4b, 0x00, 0x05, 0x05, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x45, 0x03, 0x4c, 0x59, 0x40, 0x09, 0x22, 0x14, 0x25,
-    0x11, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x21, 0x23, 0x11, 0x33, 0x21, 0x33, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x22,
-    0x2e, 0x02, 0x35, 0x33, 0x14, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x01, 0x39, 0xb9, 0xb9, 0x02, 0x5a, 0xb9, 0x29,
-    0x55, 0x81, 0x57, 0x49, 0x7b, 0x58, 0x32, 0xba, 0x50, 0x44, 0x2e, 0x3c, 0x24, 0x0f, 0x05, 0xb0, 0xfb, 0x93, 0x51,
-    0x7f, 0x58, 0x2e, 0x29, 0x54, 0x80, 0x57, 0x63, 0x5a, 0x1b, 0x31, 0x47, 0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x50,
-    0xfe, 0x4e, 0x04, 0x4f, 0x05, 0xbf, 0x00, 0x17, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x4f, 0x40, 0x4c, 0x0b,
-    0x01, 0x02, 0x06, 0x0a, 0x01, 0x01, 0x02, 0x02, 0x4a, 0x0c, 0x01, 0x0a, 0x0a, 0x09, 0x5b, 0x0b, 0x01, 0x09, 0x09,
-    0x44, 0x4b, 0x08, 0x01, 0x03, 0x03, 0x00, 0x59, 0x04, 0x01, 0x00, 0x00, 0x3f, 0x4b, 0x07, 0x01, 0x05, 0x05, 0x06,
-    0x59, 0x00, 0x06, 0x06, 0x3d, 0x4b, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x49, 0x01, 0x4c, 0x38, 0x36,
-    0x32, 0x30, 0x2c, 0x2a, 0x26, 0x24, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x44, 0x35, 0x10, 0x0d, 0x08, 0x1d, 0x2b,
-    0x01, 0x21, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x37, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x11,
-    0x23, 0x25, 0x21, 0x11, 0x33, 0x15, 0x21, 0x35, 0x33, 0x11, 0x23, 0x01, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
-    0x06, 0x23, 0x22, 0x26, 0x25, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x02, 0xae, 0x01,
-    0x97, 0x39, 0x6d, 0x9d, 0x64, 0x39, 0x63, 0x37, 0x0d, 0x11, 0x34, 0x36, 0x30, 0x0e, 0x34, 0x5c, 0x44, 0x27, 0xde,
-    0xfd, 0xa7, 0x01, 0xa4, 0xdf, 0xfd, 0x78, 0xef, 0xea, 0x03, 0x1c, 0x36, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x36,
-    0xfd, 0xbe, 0x37, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x37, 0x04, 0x3a, 0xfb, 0xc1, 0x68, 0x9f, 0x6e, 0x38, 0x07,
-    0x0a, 0x9e, 0x03, 0x05, 0x03, 0x01, 0x19, 0x3d, 0x67, 0x4d, 0x03, 0x9e, 0xa1, 0xfc, 0x66, 0xa0, 0xa0, 0x02, 0xf9,
-    0x01, 0xba, 0x2d, 0x3f, 0x3f, 0x2d, 0x2d, 0x3d, 0x3d, 0x2c, 0x2d, 0x3f, 0x3f, 0x2d, 0x2d, 0x3d, 0x3d, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0xba, 0x00, 0x00, 0x04, 0x72, 0x04, 0x3a, 0x00, 0x0c, 0x00, 0x1f, 0x40, 0x1c, 0x0a, 0x06,
-    0x01, 0x03, 0x00, 0x01, 0x01, 0x4a, 0x02, 0x01, 0x01, 0x01, 0x3f, 0x4b, 0x03, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x4c,
-    0x12, 0x13, 0x11, 0x12, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x07, 0x11, 0x23, 0x11, 0x33, 0x11, 0x37, 0x01, 0x33, 0x01,
-    0x01, 0x23, 0x02, 0x09, 0x96, 0xb9, 0xb9, 0x6e, 0x01, 0x8e, 0xdf, 0xfe, 0x38, 0x01, 0xec, 0xea, 0x01, 0xdd, 0x85,
-    0xfe, 0xa8, 0x04, 0x3a, 0xfd, 0xed, 0x78, 0x01, 0x9b, 0xfe, 0x21, 0xfd, 0xa5, 0x00, 0x01, 0x00, 0x3a, 0x00, 0x00,
-    0x04, 0x4b, 0x05, 0xb0, 0x00, 0x0d, 0x00, 0x26, 0x40, 0x23, 0x0b, 0x0a, 0x09, 0x08, 0x03, 0x02, 0x01, 0x00, 0x08,
-    0x00, 0x02, 0x01, 0x4a, 0x00, 0x02, 0x02, 0x3c, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x5a, 0x00, 0x01, 0x01, 0x3d, 0x01,
-    0x4c, 0x15, 0x11, 0x14, 0x03, 0x08, 0x17, 0x2b, 0x01, 0x25, 0x15, 0x05, 0x11, 0x21, 0x15, 0x21, 0x11, 0x07, 0x35,
-    0x37, 0x11, 0x33, 0x01, 0x83, 0x01, 0x06, 0xfe, 0xfa, 0x02, 0xc8, 0xfc, 0x7f, 0x90, 0x90, 0xb9, 0x03, 0x4d, 0x53,
-    0xa2, 0x53, 0xfd, 0xf2, 0x9d, 0x02, 0x70, 0x2d, 0xa2, 0x2d, 0x02, 0x9e, 0x00, 0x00, 0x00, 0x01, 0x00, 0xcb, 0x00,
-    0x00, 0x04, 0x55, 0x06, 0x00, 0x00, 0x11, 0x00, 0x4e, 0x40, 0x0d, 0x0d, 0x0c, 0x0b, 0x0a, 0x03, 0x02, 0x01, 0x00,
-    0x08, 0x00, 0x03, 0x01, 0x4a, 0x4b, 0xb0, 0x21, 0x50, 0x58, 0x40, 0x16, 0x00, 0x03, 0x03, 0x04, 0x59, 0x00, 0x04,
-    0x04, 0x3e, 0x4b, 0x02, 0x01, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x1b, 0x40, 0x14, 0x00,
-    0x04, 0x00, 0x03, 0x00, 0x04, 0x03, 0x61, 0x02, 0x01, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c,
-    0x59, 0xb7, 0x11, 0x15, 0x11, 0x11, 0x14, 0x05, 0x08, 0x19, 0x2b, 0x01, 0x25, 0x07, 0x05, 0x11, 0x21, 0x15, 0x21,
-    0x35, 0x21, 0x11, 0x05, 0x35, 0x25, 0x11, 0x21, 0x35, 0x21, 0x02, 0xf4, 0x01, 0x22, 0x01, 0xfe, 0xdf, 0x01, 0x61,
-    0xfc, 0x76, 0x01, 0x70, 0xfe, 0xad, 0x01, 0x53, 0xfe, 0x90, 0x02, 0x29, 0x03, 0xcd, 0x84, 0xa2, 0x84, 0xfd, 0x75,
-    0xa0, 0xa0, 0x02, 0x36, 0x9a, 0xa2, 0x9a, 0x01, 0xe7, 0xa1, 0x00, 0x01, 0x00, 0xaf, 0xfe, 0x4b, 0x04, 0x1d, 0x05,
-    0xb0, 0x00, 0x1a, 0x00, 0x37, 0x40, 0x34, 0x19, 0x14, 0x13, 0x03, 0x02, 0x03, 0x0a, 0x01, 0x01, 0x02, 0x09, 0x01,
-    0x00, 0x01, 0x03, 0x4a, 0x05, 0x04, 0x02, 0x03, 0x03, 0x3c, 0x4b, 0x00, 0x02, 0x02, 0x3d, 0x4b, 0x00, 0x01, 0x01,
-    0x00, 0x5b, 0x00, 0x00, 0x00, 0x49, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x1a, 0x11, 0x15, 0x27, 0x25, 0x06,
-    0x08, 0x18, 0x2b, 0x01, 0x13, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x37, 0x1e, 0x03, 0x33, 0x32, 0x36, 0x35,
-    0x35, 0x01, 0x11, 0x23, 0x11, 0x33, 0x01, 0x11, 0x04, 0x1c, 0x01, 0x2b, 0x51, 0x76, 0x4c, 0x1e, 0x33, 0x1d, 0x0e,
-    0x08, 0x1b, 0x1d, 0x1a, 0x06, 0x41, 0x43, 0xfe, 0x05, 0xb9, 0xb9, 0x01, 0xfb, 0x05, 0xb0, 0xf9, 0xf7, 0x52, 0x81,
-    0x5a, 0x2f, 0x08, 0x0a, 0x93, 0x03, 0x05, 0x03, 0x02, 0x6d, 0x57, 0x5b, 0x04, 0x2b, 0xfb, 0xd3, 0x05, 0xb0, 0xfb,
-    0xd5, 0x04, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb8, 0xfe, 0x4b, 0x04, 0x17, 0x04, 0x4e, 0x00, 0x23, 0x00,
-    0x69, 0x40, 0x0f, 0x20, 0x01, 0x02, 0x04, 0x03, 0x11, 0x01, 0x02, 0x04, 0x10, 0x01, 0x01, 0x02, 0x03, 0x4a, 0x4b,
-    0xb0, 0x19, 0x50, 0x58, 0x40, 0x1c, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x06, 0x05, 0x02, 0x00, 0x00, 0x47, 0x4b, 0x00,
-    0x04, 0x04, 0x3d, 0x4b, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x49, 0x01, 0x4c, 0x1b, 0x40, 0x20, 0x06,
-    0x01, 0x05, 0x05, 0x3f, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x04, 0x04, 0x3d,
-    0x4b, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x49, 0x01, 0x4c, 0x59, 0x40, 0x0e, 0x00, 0x00, 0x00, 0x23,
-    0x00, 0x23, 0x13, 0x25, 0x27, 0x27, 0x23, 0x07, 0x08, 0x19, 0x2b, 0x01, 0x17, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02,
-    0x15, 0x11, 0x14, 0x06, 0x07, 0x22, 0x26, 0x27, 0x37, 0x1e, 0x03, 0x33, 0x32, 0x36, 0x35, 0x11, 0x34, 0x26, 0x23,
-    0x22, 0x06, 0x07, 0x11, 0x23, 0x11, 0x01, 0x5e, 0x0c, 0x36, 0x9f, 0x6a, 0x56, 0x88, 0x5e, 0x32, 0xa9, 0x9a, 0x1e,
-    0x36, 0x1e, 0x0e, 0x09, 0x1c, 0x1e, 0x1a, 0x07, 0x43, 0x47, 0x76, 0x76, 0x5e, 0x7e, 0x25, 0xb9, 0x04, 0x3a, 0x9a,
-    0x51, 0x5d, 0x32, 0x67, 0x9f, 0x6c, 0xfc, 0xfd, 0xa7, 0xb4, 0x01, 0x08, 0x0a, 0x9d, 0x03, 0x05, 0x03, 0x02, 0x60,
-    0x5a, 0x02, 0xff, 0x8f, 0x7c, 0x49, 0x3e, 0xfc, 0xd6, 0x04, 0x3a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x4f, 0xff, 0xec,
-    0x04, 0xa6, 0x05, 0xc4, 0x00, 0x1b, 0x00, 0x2c, 0x00, 0xd8, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0xb5, 0x1f, 0x01, 0x04,
-    0x02, 0x01, 0x4a, 0x1b, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0xb5, 0x1f, 0x01, 0x04, 0x03, 0x01, 0x4a, 0x1b, 0xb5, 0x1f,
-    0x01, 0x04, 0x09, 0x01, 0x4a, 0x59, 0x59, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x22, 0x00, 0x05, 0x00, 0x06, 0x07,
-    0x05, 0x06, 0x61, 0x09, 0x01, 0x04, 0x04, 0x02, 0x5b, 0x03, 0x01, 0x02, 0x02, 0x44, 0x4b, 0x0a, 0x08, 0x02, 0x07,
-    0x07, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x37, 0x00,
-    0x05, 0x00, 0x06, 0x07, 0x05, 0x06, 0x61, 0x09, 0x01, 0x04, 0x04, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x44, 0x4b, 0x09,
-    0x01, 0x04, 0x04, 0x03, 0x59, 0x00, 0x03, 0x03, 0x3c, 0x4b, 0x0a, 0x08, 0x02, 0x07, 0x07, 0x00, 0x59, 0x00, 0x00,
-    0x00, 0x3d, 0x4b, 0x0a, 0x08, 0x02, 0x07, 0x07, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x45, 0x01, 0x4c, 0x1b, 0x40, 0x32,
-    0x00, 0x05, 0x00, 0x06, 0x07, 0x05, 0x06, 0x61, 0x00, 0x09, 0x09, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x44, 0x4b, 0x00,
-    0x04, 0x04, 0x03, 0x59, 0x00, 0x03, 0x03, 0x3c, 0x4b, 0x00, 0x07, 0x07, 0x00, 0x59, 0x00, 0x00, 0x00, 0x3d, 0x4b,
-    0x0a, 0x01, 0x08, 0x08, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x45, 0x01, 0x4c, 0x59, 0x59, 0x40, 0x13, 0x1e, 0x1c, 0x23,
-    0x20, 0x1c, 0x2c, 0x1e, 0x2c, 0x11, 0x11, 0x11, 0x11, 0x12, 0x29, 0x22, 0x10, 0x0b, 0x08, 0x1c, 0x2b, 0x21, 0x21,
-    0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x21, 0x15, 0x21, 0x11,
-    0x21, 0x15, 0x21, 0x11, 0x21, 0x05, 0x32, 0x37, 0x11, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x11, 0x14, 0x1e,
-    0x02, 0x04, 0xa6, 0xfe, 0x54, 0x3e, 0x84, 0x45, 0x61, 0x9b, 0x6d, 0x3b, 0x3a, 0x6c, 0x9b, 0x61, 0x45, 0x86, 0x3e,
-    0x01, 0xa2, 0xfe, 0x73, 0x01, 0x58, 0xfe, 0xa8, 0x01, 0x97, 0xfd, 0x4d, 0x31, 0x32, 0x19, 0x32, 0x1a, 0x39, 0x58,
-    0x3a, 0x1e, 0x1e, 0x3c, 0x58, 0x07, 0x0d, 0x43, 0x84, 0xc3, 0x80, 0x01, 0xc3, 0x80, 0xc3, 0x84, 0x44, 0x0c, 0x08,
-    0x98, 0xfe, 0x24, 0x98, 0xfd, 0xf3, 0x14, 0x03, 0x04, 0xa2, 0x02, 0x02, 0x25, 0x56, 0x8d, 0x69, 0xfe, 0x3b, 0x69,
-    0x8f, 0x56, 0x25, 0x00, 0x00, 0x03, 0x00, 0x2e, 0xff, 0xec, 0x04, 0xb0, 0x04, 0x4e, 0x00, 0x2c, 0x00, 0x42, 0x00,
-    0x4f, 0x00, 0x47, 0x40, 0x44, 0x08, 0x01, 0x07, 0x00, 0x1b, 0x01, 0x03, 0x02, 0x24, 0x1c, 0x02, 0x04, 0x03, 0x03,
-    0x4a, 0x0a, 0x01, 0x08, 0x00, 0x02, 0x03, 0x08, 0x02, 0x61, 0x09, 0x01, 0x07, 0x07, 0x00, 0x5b, 0x01, 0x01, 0x00,
-    0x00, 0x47, 0x4b, 0x06, 0x01, 0x03, 0x03, 0x04, 0x5b, 0x05, 0x01, 0x04, 0x04, 0x45, 0x04, 0x4c, 0x44, 0x43, 0x4b,
-    0x49, 0x43, 0x4f, 0x44, 0x4f, 0x29, 0x29, 0x24, 0x27, 0x25, 0x15, 0x24, 0x24, 0x0b, 0x08, 0x1c, 0x2b, 0x13, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x21, 0x15, 0x14, 0x1e, 0x02,
-    0x33, 0x32, 0x36, 0x37, 0x17, 0x0e, 0x03, 0x23, 0x22, 0x26, 0x27, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33,
-    0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x25, 0x21,
-    0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x2e, 0x2d, 0x57, 0x80, 0x52, 0x54, 0x80, 0x2c, 0x2d, 0x78,
-    0x46, 0x53, 0x79, 0x4f, 0x26, 0xfe, 0x36, 0x14, 0x28, 0x3e, 0x2b, 0x44, 0x5b, 0x20, 0x37, 0x11, 0x2d, 0x3c, 0x4c,
-    0x30, 0x57, 0x83, 0x2d, 0x2c, 0x7f, 0x53, 0x53, 0x80, 0x58, 0x2d, 0xba, 0x11, 0x26, 0x3c, 0x2b, 0x2a, 0x3b, 0x26,
-    0x12, 0x12, 0x26, 0x3d, 0x2a, 0x2a, 0x3b, 0x25, 0x12, 0x01, 0xfe, 0x01, 0x11, 0x0f, 0x21, 0x33, 0x25, 0x20, 0x33,
-    0x23, 0x13, 0x02, 0x7f, 0x69, 0xaa, 0x7a, 0x42, 0x43, 0x3e, 0x3f, 0x42, 0x40, 0x72, 0x9c, 0x5b, 0xb5, 0x40, 0x44,
-    0x6f, 0x50, 0x2b, 0x2a, 0x1c, 0x7e, 0x12, 0x22, 0x1a, 0x10, 0x41, 0x3e, 0x3d, 0x42, 0x42, 0x78, 0xaa, 0x69, 0x44,
-    0x73, 0x52, 0x2e, 0x2e, 0x52, 0x73, 0x44, 0xc6, 0x44, 0x72, 0x53, 0x2e, 0x2f, 0x52, 0x73, 0x43, 0x08, 0x55, 0x2a,
-    0x4e, 0x3d, 0x25, 0x2b, 0x4e, 0x6f, 0x43, 0x00, 0x01, 0x01, 0xc8, 0x00, 0x00, 0x04, 0x0b, 0x06, 0x2b, 0x00, 0x13,
-    0x00, 0x27, 0x40, 0x24, 0x09, 0x01, 0x01, 0x00, 0x0a, 0x01, 0x02, 0x01, 0x02, 0x4a, 0x00, 0x00, 0x00, 0x01, 0x02,
-    0x00, 0x01, 0x63, 0x03, 0x01, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x25, 0x25, 0x04,
-    0x08, 0x16, 0x2b, 0x21, 0x11, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02,
-    0x15, 0x11, 0x01, 0xc8, 0x3d, 0x71, 0xa0, 0x64, 0x25, 0x47, 0x25, 0x17, 0x12, 0x2e, 0x1d, 0x44, 0x67, 0x46, 0x24,
-    0x04, 0x66, 0x6d, 0xa9, 0x73, 0x3c, 0x0c, 0x09, 0x8e, 0x05, 0x06, 0x2a, 0x4e, 0x70, 0x45, 0xfb, 0x9a, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0xa0, 0xfe, 0x4b, 0x04, 0x4a, 0x06, 0x2b, 0x00, 0x29, 0x00, 0x3f, 0x40, 0x3c, 0x20, 0x01,
-    0x06, 0x05, 0x21, 0x01, 0x04, 0x06, 0x0b, 0x01, 0x02, 0x00, 0x0a, 0x01, 0x01, 0x02, 0x04, 0x4a, 0x00, 0x05, 0x00,
-    0x06, 0x04, 0x05, 0x06, 0x63, 0x03, 0x01, 0x00, 0x00, 0x04, 0x59, 0x07, 0x01, 0x04, 0x04, 0x3f, 0x4b, 0x00, 0x02,
-    0x02, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x49, 0x01, 0x4c, 0x13, 0x25, 0x25, 0x11, 0x13, 0x27, 0x25, 0x10, 0x08, 0x08,
-    0x1c, 0x2b, 0x01, 0x23, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x37, 0x1e, 0x03, 0x33, 0x32, 0x36, 0x37,
-    0x11, 0x23, 0x35, 0x33, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x06, 0x06, 0x07,
-    0x15, 0x33, 0x03, 0x7f, 0xd4, 0x32, 0x5d, 0x87, 0x55, 0x29, 0x50, 0x27, 0x0e, 0x0b, 0x29, 0x2c, 0x27, 0x0b, 0x55,
-    0x5c, 0x01, 0xb1, 0xb1, 0x3a, 0x6d, 0x9a, 0x60, 0x2f, 0x59, 0x2f, 0x17, 0x1a, 0x47, 0x28, 0x82, 0x7c, 0x01, 0xd4,
-    0x03, 0xab, 0xfc, 0x21, 0x5d, 0x90, 0x61, 0x33, 0x10, 0x14, 0x94, 0x08, 0x0b, 0x09, 0x04, 0x7c, 0x6d, 0x03, 0xdf,
-    0x8f, 0x63, 0x60, 0x95, 0x65, 0x34, 0x16, 0x11, 0x93, 0x0d, 0x10, 0x01, 0x7b, 0x75, 0x63, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x63, 0xff, 0xec, 0x04, 0xc6, 0x05, 0xfa, 0x00, 0x23, 0x00, 0x41, 0x00, 0x55, 0x40, 0x0a, 0x19, 0x01,
-    0x03, 0x01, 0x20, 0x01, 0x04, 0x03, 0x02, 0x4a, 0x4b, 0xb0, 0x28, 0x50, 0x58, 0x40, 0x1a, 0x00, 0x02, 0x02, 0x3e,
-    0x4b, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x44, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x00, 0x00, 0x00,
-    0x45, 0x00, 0x4c, 0x1b, 0x40, 0x1a, 0x00, 0x02, 0x01, 0x02, 0x72, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01,
-    0x44, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x59, 0xb7, 0x2d, 0x2d, 0x15, 0x2d,
-    0x26, 0x05, 0x08, 0x19, 0x2b, 0x01, 0x0e, 0x05, 0x23, 0x22, 0x2e, 0x04, 0x27, 0x35, 0x3e, 0x05, 0x33, 0x32, 0x16,
-    0x17, 0x36, 0x36, 0x37, 0x33, 0x16, 0x06, 0x07, 0x16, 0x16, 0x17, 0x27, 0x2e, 0x05, 0x23, 0x22, 0x0e, 0x04, 0x07,
-    0x15, 0x1e, 0x05, 0x33, 0x32, 0x3e, 0x04, 0x37, 0x04, 0x5a, 0x01, 0x19, 0x34, 0x51, 0x70, 0x91, 0x5a, 0x5a, 0x91,
-    0x70, 0x52, 0x35, 0x1a, 0x01, 0x01, 0x19, 0x35, 0x51, 0x70, 0x91, 0x5a, 0x71, 0xa9, 0x3d, 0x36, 0x32, 0x01, 0xa7,
-    0x01, 0x64, 0x5e, 0x2c, 0x28, 0x02, 0xb7, 0x01, 0x0c, 0x1d, 0x30, 0x48, 0x62, 0x41, 0x40, 0x62, 0x48, 0x30, 0x1d,
-    0x0d, 0x01, 0x01, 0x0d, 0x1e, 0x30, 0x48, 0x62, 0x41, 0x41, 0x63, 0x47, 0x2f, 0x1d, 0x0b, 0x01, 0x02, 0x84, 0x4e,
-    0x9f, 0x94, 0x80, 0x60, 0x37, 0x37, 0x60, 0x81, 0x94, 0x9e, 0x4e, 0xa6, 0x4e, 0x9f, 0x94, 0x81, 0x61, 0x37, 0x54,
-    0x47, 0x12, 0x6c, 0x53, 0x7f, 0xa8, 0x23, 0x58, 0xca, 0x64, 0x02, 0x34, 0x71, 0x6f, 0x65, 0x4d, 0x2d, 0x2e, 0x4d,
-    0x65, 0x6f, 0x71, 0x33, 0xa8, 0x33, 0x72, 0x6f, 0x66, 0x4d, 0x2e, 0x2e, 0x4d, 0x65, 0x6f, 0x72, 0x34, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x77, 0xff, 0xec, 0x04, 0xae, 0x04, 0xaa, 0x00, 0x1d, 0x00, 0x33, 0x00, 0x2f, 0x40, 0x2c,
-    0x08, 0x01, 0x04, 0x00, 0x0f, 0x01, 0x03, 0x04, 0x02, 0x4a, 0x00, 0x01, 0x00, 0x01, 0x72, 0x00, 0x04, 0x04, 0x00,
-    0x5b, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x45, 0x02, 0x4c, 0x29, 0x29,
-    0x2b, 0x15, 0x24, 0x05, 0x08, 0x19, 0x2b, 0x13, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x36, 0x36, 0x35, 0x33,
-    0x06, 0x06, 0x07, 0x16, 0x16, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x1e, 0x02,
-    0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x77, 0x44, 0x7f, 0xb6, 0x72,
-    0x60, 0x9e, 0x3d, 0x36, 0x33, 0xa8, 0x01, 0x5b, 0x56, 0x29, 0x2a, 0x44, 0x7f, 0xb6, 0x72, 0x73, 0xb7, 0x7f, 0x44,
-    0xb9, 0x26, 0x4d, 0x74, 0x4d, 0x4c, 0x73, 0x4d, 0x26, 0x27, 0x4d, 0x73, 0x4d, 0x4d, 0x72, 0x4d, 0x26, 0x02, 0x27,
-    0x75, 0xc9, 0x94, 0x55, 0x3b, 0x35, 0x11, 0x68, 0x53, 0x79, 0xa2, 0x24, 0x44, 0xa4, 0x5c, 0x16, 0x75, 0xc8, 0x94,
-    0x54, 0x54, 0x94, 0xc8, 0x75, 0x50, 0x91, 0x6e, 0x40, 0x40, 0x6e, 0x91, 0x50, 0x16, 0x4f, 0x91, 0x6e, 0x41, 0x41,
-    0x6e, 0x91, 0x4f, 0x00, 0x01, 0x00, 0x8b, 0xff, 0xec, 0x05, 0x83, 0x05, 0xe8, 0x00, 0x23, 0x00, 0x33, 0x40, 0x30,
-    0x01, 0x01, 0x01, 0x03, 0x01, 0x4a, 0x06, 0x05, 0x02, 0x03, 0x03, 0x3c, 0x4b, 0x00, 0x01, 0x01, 0x00, 0x59, 0x00,
-    0x00, 0x00, 0x3e, 0x4b, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x45, 0x02, 0x4c, 0x00, 0x00, 0x00, 0x23,
-    0x00, 0x23, 0x25, 0x15, 0x25, 0x12, 0x16, 0x07, 0x08, 0x19, 0x2b, 0x01, 0x15, 0x3e, 0x03, 0x35, 0x33, 0x14, 0x06,
-    0x07, 0x13, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x13, 0x33, 0x13, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x37,
-    0x13, 0x04, 0x40, 0x2d, 0x3c, 0x24, 0x0f, 0xa7, 0x9c, 0xa6, 0x01, 0x02, 0x46, 0x7e, 0xae, 0x68, 0x6a, 0xae, 0x7c,
-    0x46, 0x01, 0x02, 0xb0, 0x04, 0x01, 0x27, 0x49, 0x6d, 0x47, 0x47, 0x6c, 0x49, 0x26, 0x02, 0x03, 0x05, 0xb0, 0xb8,
-    0x06, 0x22, 0x3b, 0x55, 0x38, 0xb4, 0xb9, 0x0b, 0xfd, 0x66, 0x66, 0xb2, 0x85, 0x4d, 0x4c, 0x85, 0xb3, 0x66, 0x03,
-    0xda, 0xfc, 0x26, 0x41, 0x78, 0x5c, 0x38, 0x37, 0x5d, 0x78, 0x41, 0x03, 0xda, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb4,
-    0xff, 0xec, 0x05, 0x3f, 0x04, 0x93, 0x00, 0x1f, 0x00, 0x5b, 0x40, 0x09, 0x1c, 0x19, 0x06, 0x03, 0x04, 0x03, 0x02,
-    0x01, 0x4a, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x18, 0x06, 0x01, 0x05, 0x02, 0x05, 0x72, 0x04, 0x01, 0x02, 0x02,
-    0x3f, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x1b, 0x40, 0x1c, 0x06, 0x01,
-    0x05, 0x02, 0x05, 0x72, 0x04, 0x01, 0x02, 0x02, 0x3f, 0x4b, 0x00, 0x00, 0x00, 0x3d, 0x4b, 0x00, 0x03, 0x03, 0x01,
-    0x5b, 0x00, 0x01, 0x01, 0x45, 0x01, 0x4c, 0x59, 0x40, 0x0e, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x13, 0x25, 0x15,
-    0x23, 0x14, 0x07, 0x08, 0x19, 0x2b, 0x01, 0x06, 0x06, 0x07, 0x11, 0x23, 0x27, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02,
-    0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x11, 0x33, 0x15, 0x36, 0x36, 0x35, 0x05, 0x3f,
-    0x01, 0x8c, 0x93, 0xa8, 0x0b, 0x36, 0xa2, 0x6a, 0x55, 0x8a, 0x62, 0x35, 0xb9, 0x1c, 0x38, 0x51, 0x35, 0x71, 0x8b,
-    0x22, 0xba, 0x44, 0x34, 0x04, 0x93, 0xaa, 0xb4, 0x13, 0xfc, 0xde, 0x95, 0x50, 0x59, 0x35, 0x70, 0xad, 0x79, 0x02,
-    0x83, 0xfd, 0x7b, 0x58, 0x74, 0x45, 0x1c, 0x5c, 0x4e, 0x03, 0x08, 0x8d, 0x12, 0x6f, 0x65, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0xb0, 0xfe, 0x4b, 0x03, 0x2a, 0x04, 0x3a, 0x00, 0x17, 0x00, 0x29, 0x40, 0x26, 0x0b, 0x01, 0x02, 0x03, 0x0a,
-    0x01, 0x01, 0x02, 0x02, 0x4a, 0x00, 0x03, 0x03, 0x00, 0x59, 0x00, 0x00, 0x00, 0x3f, 0x4b, 0x00, 0x02, 0x02, 0x01,
-    0x5b, 0x00, 0x01, 0x01, 0x49, 0x01, 0x4c, 0x15, 0x44, 0x35, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x21, 0x11, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x37, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x11, 0x21, 0x01, 0x04, 0x02,
-    0x26, 0x39, 0x6d, 0x9d, 0x64, 0x39, 0x63, 0x37, 0x0d, 0x11, 0x33, 0x36, 0x31, 0x0e, 0x34, 0x5b, 0x44, 0x27, 0xfe,
-    0x94, 0x04, 0x3a, 0xfb, 0xbf, 0x68, 0xa0, 0x6d, 0x39, 0x07, 0x0a, 0x98, 0x03, 0x05, 0x03, 0x01, 0x1b, 0x40, 0x69,
-    0x4d, 0x03, 0xa0, 0x00, 0x00, 0x02, 0x00, 0xb1, 0xff, 0xec, 0x04, 0x5f, 0x04, 0x4f, 0x00, 0x1f, 0x00, 0x2b, 0x00,
-    0x43, 0x40, 0x40, 0x1b, 0x01, 0x03, 0x00, 0x1a, 0x01, 0x02, 0x03, 0x02, 0x4a, 0x00, 0x02, 0x00, 0x05, 0x04, 0x02,
-    0x05, 0x61, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x06, 0x01, 0x00, 0x00, 0x47, 0x4b, 0x07, 0x01, 0x04, 0x04, 0x01, 0x5b,
-    0x00, 0x01, 0x01, 0x45, 0x01, 0x4c, 0x21, 0x20, 0x01, 0x00, 0x26, 0x25, 0x20, 0x2b, 0x21, 0x2b, 0x18, 0x16, 0x12,
-    0x11, 0x0c, 0x0a, 0x00, 0x1f, 0x01, 0x1f, 0x08, 0x08, 0x14, 0x2b, 0x01, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e,
-    0x02, 0x27, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x21, 0x2e, 0x03, 0x23, 0x22, 0x06, 0x07, 0x27, 0x3e, 0x03, 0x13, 0x32,
-    0x3e, 0x02, 0x37, 0x21, 0x15, 0x14, 0x1e, 0x02, 0x02, 0x61, 0x76, 0xbd, 0x84, 0x47, 0x4e, 0x85, 0xaf, 0x60, 0x75,
-    0xad, 0x72, 0x38, 0x02, 0xf4, 0x03, 0x2c, 0x51, 0x76, 0x4e, 0x71, 0xa1, 0x36, 0x49, 0x1b, 0x4b, 0x63, 0x7d, 0x67,
-    0x39, 0x61, 0x4b, 0x32, 0x0b, 0xfd, 0xcb, 0x21, 0x43, 0x68, 0x04, 0x4f, 0x51, 0x91, 0xc6, 0x75, 0x2c, 0x75, 0xc6,
-    0x8f, 0x50, 0x01, 0x48, 0x80, 0xb1, 0x69, 0x79, 0x4c, 0x86, 0x64, 0x3a, 0x3e, 0x2e, 0x7d, 0x19, 0x30, 0x26, 0x17,
-    0xfc, 0x35, 0x2e, 0x51, 0x6e, 0x40, 0x1a, 0x36, 0x64, 0x4c, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc1, 0x04,
-    0xe4, 0x03, 0x1e, 0x05, 0xed, 0x00, 0x08, 0x00, 0x1d, 0x40, 0x1a, 0x06, 0x03, 0x00, 0x03, 0x00, 0x02, 0x01, 0x4a,
-    0x01, 0x01, 0x00, 0x02, 0x00, 0x73, 0x00, 0x02, 0x02, 0x3e, 0x02, 0x4c, 0x12, 0x12, 0x11, 0x03, 0x08, 0x17, 0x2b,
-    0x01, 0x15, 0x23, 0x27, 0x07, 0x23, 0x35, 0x37, 0x33, 0x03, 0x1e, 0x9a, 0x96, 0x95, 0x98, 0xf5, 0x70, 0x04, 0xfd,
-    0x19, 0x97, 0x97, 0x1a, 0xef, 0x00, 0x00, 0x01, 0x01, 0x30, 0x04, 0xe3, 0x03, 0x9b, 0x05, 0xed, 0x00, 0x08, 0x00,
-    0x1b, 0x40, 0x18, 0x06, 0x01, 0x01, 0x00, 0x01, 0x4a, 0x00, 0x01, 0x00, 0x01, 0x73, 0x02, 0x01, 0x00, 0x00, 0x3e,
-    0x00, 0x4c, 0x12, 0x12, 0x11, 0x03, 0x08, 0x17, 0x2b, 0x01, 0x37, 0x33, 0x15, 0x07, 0x23, 0x27, 0x35, 0x33, 0x02,
-    0x64, 0x97, 0xa0, 0xfe, 0x72, 0xfb, 0x9d, 0x05, 0x55, 0x98, 0x12, 0xf8, 0xf5, 0x15, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x01, 0x3b, 0x04, 0xa7, 0x03, 0x91, 0x05, 0xb2, 0x00, 0x15, 0x00, 0x1e, 0x40, 0x1b, 0x00, 0x02, 0x00, 0x00, 0x02,
-    0x00, 0x5f, 0x04, 0x03, 0x02, 0x01, 0x01, 0x3c, 0x01, 0x4c, 0x00, 0x00, 0x00, 0x15, 0x00, 0x15, 0x24, 0x14, 0x24,
-    0x05, 0x08, 0x17, 0x2b, 0x01, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x1e, 0x02, 0x33, 0x32,
-    0x3e, 0x02, 0x35, 0x03, 0x91, 0x2a, 0x4e, 0x6e, 0x44, 0x45, 0x6e, 0x4e, 0x2b, 0x96, 0x12, 0x24, 0x38, 0x28, 0x27,
-    0x37, 0x24, 0x12, 0x05, 0xb2, 0x3b, 0x63, 0x46, 0x27, 0x27, 0x46, 0x63, 0x3b, 0x1e, 0x37, 0x28, 0x18, 0x18, 0x28,
-    0x37, 0x1e, 0x00, 0x00, 0x01, 0x01, 0xf2, 0x04, 0xe1, 0x02, 0xd8, 0x05, 0xbe, 0x00, 0x0b, 0x00, 0x13, 0x40, 0x10,
-    0x00, 0x01, 0x01, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x44, 0x01, 0x4c, 0x24, 0x22, 0x02, 0x08, 0x16, 0x2b, 0x01, 0x34,
-    0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x01, 0xf2, 0x3a, 0x39, 0x39, 0x3a, 0x3a, 0x39, 0x39,
-    0x3a, 0x05, 0x4e, 0x30, 0x40, 0x40, 0x30, 0x2e, 0x3f, 0x3f, 0x00, 0x02, 0x01, 0x9a, 0x04, 0x5e, 0x03, 0x31, 0x05,
-    0xe7, 0x00, 0x13, 0x00, 0x23, 0x00, 0x1c, 0x40, 0x19, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01, 0x5f, 0x00, 0x03, 0x03,
-    0x00, 0x5b, 0x00, 0x00, 0x00, 0x3e, 0x03, 0x4c, 0x26, 0x28, 0x28, 0x24, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x34, 0x3e,
-    0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x14, 0x1e, 0x02, 0x33, 0x32,
-    0x3e, 0x02, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x01, 0x9a, 0x21, 0x37, 0x4b, 0x2a, 0x2a, 0x49, 0x37, 0x20, 0x20,
-    0x37, 0x49, 0x2a, 0x2a, 0x4b, 0x37, 0x21, 0x63, 0x11, 0x1d, 0x26, 0x16, 0x16, 0x25, 0x1c, 0x10, 0x3b, 0x2c, 0x2c,
-    0x3e, 0x05, 0x20, 0x2b, 0x49, 0x35, 0x1e, 0x1e, 0x35, 0x49, 0x2b, 0x2b, 0x48, 0x33, 0x1c, 0x1c, 0x33, 0x48, 0x2b,
-    0x16, 0x26, 0x1d, 0x10, 0x10, 0x1c, 0x26, 0x17, 0x30, 0x3d, 0x3d, 0x00, 0x00, 0x00, 0x01, 0x01, 0x8e, 0xfe, 0x4f,
-    0x03, 0x01, 0x00, 0x38, 0x00, 0x17, 0x00, 0x1e, 0x40, 0x1b, 0x0a, 0x01, 0x01, 0x00, 0x01, 0x4a, 0x17, 0x09, 0x02,
-    0x00, 0x48, 0x00, 0x00, 0x00, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x49, 0x01, 0x4c, 0x25, 0x25, 0x02, 0x08, 0x16, 0x2b,
-    0x21, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34,
-    0x3e, 0x02, 0x37, 0x02, 0xdb, 0x4e, 0x5e, 0x24, 0x2a, 0x20, 0x35, 0x10, 0x1f, 0x1c, 0x55, 0x41, 0x29, 0x46, 0x34,
-    0x1e, 0x23, 0x40, 0x5b, 0x38, 0x2a, 0x6f, 0x42, 0x22, 0x29, 0x01, 0x13, 0x08, 0x79, 0x10, 0x1c, 0x18, 0x30, 0x47,
-    0x2f, 0x29, 0x53, 0x4e, 0x46, 0x1b, 0x00, 0x00, 0x01, 0x00, 0x8a, 0x04, 0xe3, 0x03, 0x3a, 0x05, 0xf1, 0x00, 0x1f,
-    0x00, 0x4f, 0x40, 0x12, 0x00, 0x01, 0x03, 0x02, 0x10, 0x01, 0x00, 0x01, 0x02, 0x4a, 0x1f, 0x01, 0x02, 0x48, 0x0f,
-    0x01, 0x00, 0x47, 0x4b, 0xb0, 0x16, 0x50, 0x58, 0x40, 0x15, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x3e,
-    0x4b, 0x00, 0x00, 0x00, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x3c, 0x00, 0x4c, 0x1b, 0x40, 0x12, 0x00, 0x03, 0x00, 0x00,
-    0x03, 0x00, 0x5f, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x3e, 0x01, 0x4c, 0x59, 0xb6, 0x23, 0x27, 0x25,
-    0x24, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x04, 0x23, 0x22, 0x06, 0x07, 0x27, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x03, 0x3a, 0x1f, 0x36, 0x4c, 0x2d, 0x21, 0x34,
-    0x2b, 0x26, 0x27, 0x2c, 0x1b, 0x2c, 0x39, 0x01, 0x68, 0x1f, 0x36, 0x4b, 0x2e, 0x2a, 0x43, 0x3f, 0x41, 0x27, 0x15,
-    0x26, 0x1b, 0x11, 0x05, 0xd3, 0x2d, 0x52, 0x3d, 0x24, 0x0e, 0x15, 0x19, 0x15, 0x0e, 0x41, 0x2e, 0x18, 0x2d, 0x53,
-    0x3f, 0x26, 0x1e, 0x23, 0x1e, 0x12, 0x1e, 0x29, 0x17, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xf6, 0x04, 0xe2, 0x03,
-    0xd6, 0x05, 0xef, 0x00, 0x03, 0x00, 0x07, 0x00, 0x17, 0x40, 0x14, 0x03, 0x01, 0x01, 0x01, 0x00, 0x59, 0x02, 0x01,
-    0x00, 0x00, 0x3e, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x33, 0x01, 0x23, 0x03, 0x33,
-    0x03, 0x23, 0x02, 0xf5, 0xe1, 0xfe, 0xcf, 0xa9, 0x4a, 0xcf, 0xf5, 0x96, 0x05, 0xef, 0xfe, 0xf3, 0x01, 0x0d, 0xfe,
-    0xf3, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0xad, 0xfe, 0x86, 0x02, 0xdd, 0xff, 0xab, 0x00, 0x13, 0x00, 0x1f, 0x00,
-    0x3f, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x13, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x03, 0x63, 0x00, 0x02, 0x02,
-    0x01, 0x5b, 0x00, 0x01, 0x01, 0x41, 0x01, 0x4c, 0x1b, 0x40, 0x18, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x03, 0x63,
-    0x00, 0x02, 0x01, 0x01, 0x02, 0x57, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x00, 0x01, 0x02, 0x01, 0x4f, 0x59, 0xb6, 0x24,
-    0x26, 0x28, 0x24, 0x04, 0x08, 0x18, 0x2b, 0x05, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x2e, 0x02, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x01, 0xad, 0x18,
-    0x2a, 0x38, 0x20, 0x1f, 0x36, 0x29, 0x18, 0x18, 0x29, 0x36, 0x1f, 0x20, 0x38, 0x2a, 0x18, 0x56, 0x01, 0x27, 0x1c,
-    0x1a, 0x26, 0x26, 0x1a, 0x1c, 0x27, 0xe9, 0x20, 0x37, 0x27, 0x16, 0x16, 0x27, 0x37, 0x20, 0x20, 0x36, 0x26, 0x15,
-    0x15, 0x26, 0x36, 0x20, 0x1b, 0x26, 0x25, 0x1c, 0x1d, 0x27, 0x27, 0x00, 0x00, 0x01, 0xfc, 0xca, 0x04, 0xbc, 0xfd,
-    0xfb, 0x06, 0x16, 0x00, 0x03, 0x00, 0x11, 0x40, 0x0e, 0x00, 0x01, 0x00, 0x01, 0x72, 0x00, 0x00, 0x00, 0x69, 0x11,
-    0x10, 0x02, 0x08, 0x16, 0x2b, 0x01, 0x23, 0x03, 0x33, 0xfd, 0xfb, 0x7e, 0xb3, 0xb2, 0x04, 0xbc, 0x01, 0x5a, 0x00,
-    0x01, 0xfd, 0x68, 0x04, 0xbc, 0xfe, 0x96, 0x06, 0x17, 0x00, 0x03, 0x00, 0x11, 0x40, 0x0e, 0x00, 0x00, 0x01, 0x00,
-    0x72, 0x00, 0x01, 0x01, 0x69, 0x11, 0x10, 0x02, 0x08, 0x16, 0x2b, 0x01, 0x33, 0x03, 0x23, 0xfd, 0xea, 0xac, 0xba,
-    0x74, 0x06, 0x17, 0xfe, 0xa5, 0xff, 0xff, 0xfc, 0x88, 0x04, 0xe3, 0xff, 0x38, 0x05, 0xf1, 0x00, 0x07, 0x00, 0xa2,
-    0xfb, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfd, 0x59, 0x04, 0xd9, 0xfe, 0x8f, 0x06, 0x74, 0x00, 0x13, 0x00,
-    0x2e, 0x40, 0x2b, 0x12, 0x01, 0x03, 0x00, 0x01, 0x4a, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x63, 0x00, 0x00,
-    0x03, 0x03, 0x00, 0x57, 0x00, 0x00, 0x00, 0x03, 0x59, 0x04, 0x01, 0x03, 0x00, 0x03, 0x4d, 0x00, 0x00, 0x00, 0x13,
-    0x00, 0x13, 0x11, 0x16, 0x11, 0x05, 0x08, 0x17, 0x2b, 0x01, 0x27, 0x36, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x37,
-    0x32, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x07, 0xfd, 0x6f, 0x01, 0x47, 0x4a, 0x1b, 0x2e, 0x3c, 0x21, 0x07, 0x90,
-    0x9f, 0x1b, 0x2c, 0x38, 0x1c, 0x01, 0x04, 0xd9, 0x99, 0x05, 0x1c, 0x29, 0x16, 0x1e, 0x12, 0x08, 0x6a, 0x64, 0x58,
-    0x26, 0x36, 0x24, 0x14, 0x04, 0x47, 0x00, 0x00, 0x00, 0x02, 0xfc, 0x05, 0x04, 0xe4, 0xfe, 0xe5, 0x05, 0xee, 0x00,
-    0x03, 0x00, 0x07, 0x00, 0x17, 0x40, 0x14, 0x02, 0x01, 0x00, 0x00, 0x01, 0x59, 0x03, 0x01, 0x01, 0x01, 0x3e, 0x00,
-    0x4c, 0x11, 0x11, 0x11, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x23, 0x01, 0x33, 0x01, 0x23, 0x03, 0x33, 0xfd, 0xe0,
-    0xa9, 0xfe, 0xce, 0xe1, 0x01, 0xff, 0x96, 0xf6, 0xcf, 0x04, 0xe4, 0x01, 0x0a, 0xfe, 0xf6, 0x01, 0x0a, 0x00, 0x00,
-    0x00, 0x01, 0xfd, 0x27, 0xfe, 0xa8, 0xfe, 0x0d, 0xff, 0x85, 0x00, 0x0b, 0x00, 0x18, 0x40, 0x15, 0x00, 0x00, 0x01,
-    0x01, 0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x5b, 0x00, 0x01, 0x00, 0x01, 0x4f, 0x24, 0x22, 0x02, 0x08, 0x16, 0x2b,
-    0x05, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0xfd, 0x27, 0x3a, 0x39, 0x39, 0x3a, 0x3a,
-    0x39, 0x39, 0x3a, 0xeb, 0x30, 0x40, 0x40, 0x30, 0x2e, 0x3f, 0x3f, 0x00, 0x01, 0x02, 0x29, 0x04, 0xf7, 0x03, 0x2d,
-    0x06, 0x7a, 0x00, 0x03, 0x00, 0x18, 0x40, 0x15, 0x00, 0x00, 0x01, 0x01, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x59,
-    0x00, 0x01, 0x00, 0x01, 0x4d, 0x11, 0x10, 0x02, 0x07, 0x16, 0x2b, 0x01, 0x33, 0x03, 0x23, 0x02, 0x6a, 0xc3, 0xaa,
-    0x5a, 0x06, 0x7a, 0xfe, 0x7d, 0x00, 0x00, 0x03, 0x01, 0x13, 0x04, 0xe2, 0x03, 0xf3, 0x06, 0xbf, 0x00, 0x03, 0x00,
-    0x0f, 0x00, 0x1b, 0x00, 0x21, 0x40, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x01, 0x61, 0x05, 0x01, 0x03, 0x03,
-    0x02, 0x5b, 0x04, 0x01, 0x02, 0x02, 0x30, 0x03, 0x4c, 0x24, 0x24, 0x24, 0x23, 0x11, 0x10, 0x06, 0x07, 0x1a, 0x2b,
-    0x01, 0x33, 0x03, 0x23, 0x05, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x25, 0x34, 0x36,
-    0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x02, 0x74, 0xcd, 0x76, 0x87, 0xfe, 0xcf, 0x39, 0x39, 0x39,
-    0x3a, 0x3a, 0x39, 0x39, 0x39, 0x01, 0xfb, 0x39, 0x39, 0x39, 0x3a, 0x3a, 0x39, 0x39, 0x39, 0x06, 0xbf, 0xfe, 0xf8,
-    0x67, 0x30, 0x40, 0x40, 0x30, 0x2e, 0x40, 0x40, 0x2e, 0x30, 0x40, 0x40, 0x30, 0x2e, 0x40, 0x40, 0xff, 0xff, 0x02,
-    0x30, 0x02, 0x6b, 0x03, 0x16, 0x03, 0x49, 0x02, 0x06, 0x00, 0x76, 0x38, 0x00, 0x00, 0x01, 0x00, 0xb5, 0x00, 0x00,
-    0x04, 0x30, 0x05, 0xb0, 0x00, 0x05, 0x00, 0x19, 0x40, 0x16, 0x00, 0x00, 0x00, 0x02, 0x59, 0x00, 0x02, 0x02, 0x28,
-    0x4b, 0x00, 0x01, 0x01, 0x29, 0x01, 0x4c, 0x11, 0x11, 0x10, 0x03, 0x07, 0x17, 0x2b, 0x01, 0x21, 0x11, 0x23, 0x11,
-    0x21, 0x04, 0x30, 0xfd, 0x3f, 0xba, 0x03, 0x7b, 0x05, 0x18, 0xfa, 0xe8, 0x05, 0xb0, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x2e, 0x00, 0x00, 0x04, 0xb4, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x06, 0x00, 0x1f, 0x40, 0x1c, 0x06, 0x01, 0x02, 0x00,
-    0x01, 0x4a, 0x00, 0x00, 0x00, 0x28, 0x4b, 0x00, 0x02, 0x02, 0x01, 0x5a, 0x00, 0x01, 0x01, 0x29, 0x01, 0x4c, 0x11,
-    0x11, 0x10, 0x03, 0x07, 0x17, 0x2b, 0x01, 0x33, 0x01, 0x21, 0x37, 0x21, 0x01, 0x02, 0x34, 0xa0, 0x01, 0xe0, 0xfb,
-    0x7a, 0xf0, 0x02, 0xa9, 0xfe, 0xba, 0x05, 0xb0, 0xfa, 0x50, 0x97, 0x04, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
-    0x6a, 0xff, 0xec, 0x04, 0x61, 0x05, 0xc4, 0x00, 0x03, 0x00, 0x21, 0x00, 0x3f, 0x00, 0x29, 0x40, 0x26, 0x00, 0x01,
-    0x00, 0x00, 0x05, 0x01, 0x00, 0x61, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x30, 0x4b, 0x00, 0x05, 0x05,
-    0x02, 0x5b, 0x00, 0x02, 0x02, 0x31, 0x02, 0x4c, 0x2d, 0x2d, 0x2d, 0x27, 0x11, 0x10, 0x06, 0x07, 0x1a, 0x2b, 0x01,
-    0x21, 0x35, 0x21, 0x05, 0x0e, 0x05, 0x23, 0x22, 0x2e, 0x04, 0x27, 0x35, 0x3e, 0x05, 0x33, 0x32, 0x1e, 0x04, 0x17,
-    0x27, 0x2e, 0x05, 0x23, 0x22, 0x0e, 0x04, 0x07, 0x15, 0x1e, 0x05, 0x33, 0x32, 0x3e, 0x04, 0x37, 0x03, 0x4d, 0xfe,
-    0x30, 0x01, 0xd0, 0x01, 0x14, 0x01, 0x19, 0x34, 0x51, 0x70, 0x91, 0x5a, 0x5a, 0x91, 0x70, 0x52, 0x35, 0x1a, 0x01,
-    0x01, 0x19, 0x35, 0x51, 0x70, 0x91, 0x5a, 0x5a, 0x92, 0x70, 0x51, 0x35, 0x19, 0x01, 0xb7, 0x01, 0x0c, 0x1d, 0x30,
-    0x48, 0x62, 0x41, 0x40, 0x62, 0x48, 0x30, 0x1d, 0x0d, 0x01, 0x01, 0x0d, 0x1e, 0x30, 0x48, 0x62, 0x41, 0x41, 0x63,
-    0x47, 0x2f, 0x1d, 0x0b, 0x01, 0x02, 0x94, 0x97, 0xa7, 0x4e, 0x9f, 0x94, 0x80, 0x60, 0x37, 0x37, 0x60, 0x81, 0x94,
-    0x9e, 0x4e, 0xa6, 0x4e, 0x9f, 0x94, 0x81, 0x61, 0x37, 0x37, 0x60, 0x81, 0x94, 0xa0, 0x4e, 0x02, 0x34, 0x71, 0x6f,
-    0x65, 0x4d, 0x2d, 0x2e, 0x4d, 0x65, 0x6f, 0x71, 0x33, 0xa8, 0x33, 0x72, 0x6f, 0x66, 0x4d, 0x2e, 0x2e, 0x4d, 0x65,
-    0x6f, 0x72, 0x34, 0x00, 0x00, 0x01, 0x00, 0x36, 0x00, 0x00, 0x04, 0xa0, 0x05, 0xb0, 0x00, 0x06, 0x00, 0x15, 0x40,
-    0x12, 0x00, 0x01, 0x01, 0x28, 0x4b, 0x02, 0x01, 0x00, 0x00, 0x29, 0x00, 0x4c, 0x11, 0x11, 0x11, 0x03, 0x07, 0x17,
-    0x2b, 0x01, 0x01, 0x23, 0x01, 0x33, 0x01, 0x23, 0x02, 0x6a, 0xfe, 0x89, 0xbd, 0x01, 0xe4, 0xa1, 0x01, 0xe5, 0xbd,
-    0x04, 0x9c, 0xfb, 0x64, 0x05, 0xb0, 0xfa, 0x50, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x91, 0x00, 0x00, 0x04, 0x37,
-    0x05, 0xb0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x29, 0x40, 0x26, 0x00, 0x02, 0x00, 0x03, 0x00, 0x02, 0x03,
-    0x61, 0x00, 0x05, 0x05, 0x04, 0x59, 0x00, 0x04, 0x04, 0x28, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01,
-    0x29, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x07, 0x1a, 0x2b, 0x37, 0x21, 0x15, 0x21, 0x13, 0x21,
-    0x15, 0x21, 0x03, 0x21, 0x15, 0x21, 0x91, 0x03, 0xa6, 0xfc, 0x5a, 0x55, 0x02, 0xf2, 0xfd, 0x0e, 0x53, 0x03, 0x96,
-    0xfc, 0x6a, 0x97, 0x97, 0x03, 0x3e, 0x98, 0x03, 0x0a, 0x98, 0x00, 0x00, 0x00, 0x01, 0x00, 0xa2, 0x00, 0x00, 0x04,
-    0x2a, 0x05, 0xb0, 0x00, 0x07, 0x00, 0x1b, 0x40, 0x18, 0x00, 0x01, 0x01, 0x03, 0x59, 0x00, 0x03, 0x03, 0x28, 0x4b,
-    0x02, 0x01, 0x00, 0x00, 0x29, 0x00, 0x4c, 0x11, 0x11, 0x11, 0x10, 0x04, 0x07, 0x18, 0x2b, 0x21, 0x23, 0x11, 0x21,
-    0x11, 0x23, 0x11, 0x21, 0x04, 0x2a, 0xb9, 0xfd, 0xea, 0xb9, 0x03, 0x88, 0x05, 0x18, 0xfa, 0xe8, 0x05, 0xb0, 0x00,
-    0x00, 0x01, 0x00, 0x70, 0x00, 0x00, 0x04, 0x6f, 0x05, 0xb0, 0x00, 0x0c, 0x00, 0x2f, 0x40, 0x2c, 0x07, 0x01, 0x03,
-    0x02, 0x0c, 0x06, 0x00, 0x03, 0x00, 0x03, 0x05, 0x01, 0x01, 0x00, 0x03, 0x4a, 0x00, 0x03, 0x03, 0x02, 0x59, 0x00,
-    0x02, 0x02, 0x28, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x29, 0x01, 0x4c, 0x11, 0x14, 0x11, 0x11,
-    0x04, 0x07, 0x18, 0x2b, 0x01, 0x01, 0x21, 0x15, 0x21, 0x35, 0x01, 0x01, 0x35, 0x21, 0x15, 0x21, 0x01, 0x03, 0x19,
-    0xfe, 0x3c, 0x03, 0x1a, 0xfc, 0x01, 0x01, 0xe5, 0xfe, 0x1b, 0x03, 0xcd, 0xfd, 0x19, 0x01, 0xc3, 0x02, 0xcd, 0xfd,
-    0xcb, 0x98, 0x90, 0x02, 0x49, 0x02, 0x47, 0x90, 0x98, 0xfd, 0xce, 0x00, 0x00, 0x00, 0x03, 0x00, 0x45, 0x00, 0x00,
-    0x04, 0x87, 0x05, 0xb0, 0x00, 0x19, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x20, 0x40, 0x1d, 0x2b, 0x2a, 0x20, 0x1f, 0x17,
-    0x0d, 0x0a, 0x00, 0x08, 0x00, 0x01, 0x01, 0x4a, 0x00, 0x01, 0x01, 0x28, 0x4b, 0x00, 0x00, 0x00, 0x29, 0x00, 0x4c,
-    0x1c, 0x1b, 0x02, 0x07, 0x16, 0x2b, 0x01, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x15, 0x23, 0x35, 0x2e, 0x03,
-    0x35, 0x34, 0x3e, 0x02, 0x37, 0x35, 0x33, 0x01, 0x14, 0x1e, 0x02, 0x17, 0x11, 0x0e, 0x03, 0x05, 0x34, 0x2e, 0x02,
-    0x27, 0x11, 0x3e, 0x03, 0x02, 0xc3, 0x61, 0xa5, 0x79, 0x45, 0x45, 0x79, 0xa5, 0x61, 0xb9, 0x62, 0xa5, 0x7a, 0x44,
-    0x44, 0x7a, 0xa5, 0x62, 0xb9, 0xfe, 0x39, 0x24, 0x45, 0x64, 0x41, 0x41, 0x64, 0x45, 0x24, 0x02, 0xd3, 0x24, 0x45,
-    0x63, 0x40, 0x40, 0x63, 0x45, 0x24, 0x04, 0xe2, 0x08, 0x52, 0x8a, 0xba, 0x6f, 0x70, 0xbb, 0x8b, 0x54, 0x07, 0xc4,
-    0xc4, 0x07, 0x52, 0x8a, 0xbc, 0x70, 0x6f, 0xbc, 0x8a, 0x53, 0x07, 0xce, 0xfd, 0x23, 0x50, 0x85, 0x61, 0x3b, 0x06,
-    0x02, 0xee, 0x07, 0x3b, 0x62, 0x84, 0x4d, 0x4f, 0x83, 0x61, 0x3b, 0x07, 0xfd, 0x12, 0x07, 0x3b, 0x62, 0x85, 0x00,
-    0x01, 0x00, 0x65, 0x00, 0x00, 0x04, 0x72, 0x05, 0xb0, 0x00, 0x1f, 0x00, 0x20, 0x40, 0x1d, 0x1d, 0x10, 0x0d, 0x00,
-    0x04, 0x01, 0x00, 0x01, 0x4a, 0x03, 0x02, 0x02, 0x00, 0x00, 0x28, 0x4b, 0x00, 0x01, 0x01, 0x29, 0x01, 0x4c, 0x17,
-    0x17, 0x17, 0x16, 0x04, 0x07, 0x18, 0x2b, 0x01, 0x3e, 0x03, 0x35, 0x11, 0x33, 0x11, 0x14, 0x0e, 0x02, 0x07, 0x11,
-    0x23, 0x11, 0x2e, 0x03, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x17, 0x11, 0x33, 0x02, 0xc7, 0x37, 0x59, 0x3f,
-    0x23, 0xb9, 0x3f, 0x70, 0x9e, 0x5e, 0xb9, 0x5f, 0x9c, 0x70, 0x3e, 0xb9, 0x22, 0x3f, 0x59, 0x36, 0xb9, 0x01, 0xdf,
-    0x0c, 0x38, 0x5a, 0x7d, 0x50, 0x02, 0x66, 0xfd, 0x9a, 0x76, 0xb7, 0x82, 0x4c, 0x0b, 0xfe, 0xbc, 0x01, 0x44, 0x0b,
-    0x4c, 0x82, 0xb7, 0x76, 0x02, 0x66, 0xfd, 0x9a, 0x50, 0x7c, 0x5a, 0x38, 0x0c, 0x03, 0xd0, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x61, 0x00, 0x00, 0x04, 0x6c, 0x05, 0xc4, 0x00, 0x2f, 0x00, 0x2a, 0x40, 0x27, 0x12, 0x00, 0x02, 0x02, 0x00,
-    0x01, 0x4a, 0x00, 0x00, 0x00, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x30, 0x4b, 0x04, 0x01, 0x02, 0x02, 0x01, 0x59, 0x05,
-    0x01, 0x01, 0x01, 0x29, 0x01, 0x4c, 0x11, 0x1a, 0x2a, 0x11, 0x19, 0x28, 0x06, 0x07, 0x1a, 0x2b, 0x25, 0x36, 0x12,
-    0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x16, 0x12, 0x17, 0x15, 0x21, 0x35, 0x21, 0x2e,
-    0x03, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x21, 0x15, 0x21,
-    0x02, 0xa8, 0x80, 0x88, 0x2d, 0x55, 0x7c, 0x4e, 0x4d, 0x7a, 0x55, 0x2e, 0x01, 0x8d, 0x81, 0xfe, 0x3c, 0x01, 0x06,
-    0x3e, 0x63, 0x45, 0x24, 0x49, 0x87, 0xbe, 0x75, 0x75, 0xbf, 0x87, 0x4a, 0x24, 0x43, 0x62, 0x3e, 0x01, 0x0a, 0xfe,
-    0x3c, 0xc1, 0x1d, 0x01, 0x20, 0xf9, 0x51, 0x75, 0xb5, 0x7b, 0x40, 0x40, 0x7b, 0xb5, 0x75, 0x51, 0xfb, 0xfe, 0xe2,
-    0x1d, 0xc1, 0x97, 0x2f, 0x87, 0xa1, 0xb0, 0x59, 0x4f, 0x8b, 0xeb, 0xa9, 0x5f, 0x5f, 0xa9, 0xeb, 0x8b, 0x4f, 0x59,
-    0xb1, 0xa0, 0x87, 0x2f, 0x97, 0x00, 0x00, 0x00, 0x02, 0x00, 0x81, 0xff, 0xeb, 0x04, 0x8a, 0x04, 0x4e, 0x00, 0x22,
-    0x00, 0x36, 0x00, 0xc6, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x10, 0x21, 0x01, 0x06, 0x03, 0x2c, 0x2b, 0x02, 0x00,
-    0x06, 0x10, 0x0a, 0x02, 0x01, 0x00, 0x03, 0x4a, 0x1b, 0x4b, 0xb0, 0x21, 0x50, 0x58, 0x40, 0x10, 0x21, 0x01, 0x06,
-    0x04, 0x2c, 0x2b, 0x02, 0x00, 0x06, 0x10, 0x0a, 0x02, 0x01, 0x00, 0x03, 0x4a, 0x1b, 0x40, 0x10, 0x21, 0x01, 0x06,
-    0x04, 0x2c, 0x2b, 0x02, 0x00, 0x06, 0x10, 0x0a, 0x02, 0x01, 0x05, 0x03, 0x4a, 0x59, 0x59, 0x4b, 0xb0, 0x19, 0x50,
-    0x58, 0x40, 0x19, 0x00, 0x06, 0x06, 0x03, 0x5b, 0x07, 0x04, 0x02, 0x03, 0x03, 0x33, 0x4b, 0x05, 0x01, 0x00, 0x00,
-    0x01, 0x5b, 0x02, 0x01, 0x01, 0x01, 0x31, 0x01, 0x4c, 0x1b, 0x4b, 0xb0, 0x21, 0x50, 0x58, 0x40, 0x1d, 0x07, 0x01,
-    0x04, 0x04, 0x2b, 0x4b, 0x00, 0x06, 0x06, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x33, 0x4b, 0x05, 0x01, 0x00, 0x00, 0x01,
-    0x5b, 0x02, 0x01, 0x01, 0x01, 0x31, 0x01, 0x4c, 0x1b, 0x40, 0x24, 0x00, 0x00, 0x06, 0x05, 0x06, 0x00, 0x05, 0x70,
-    0x07, 0x01, 0x04, 0x04, 0x2b, 0x4b, 0x00, 0x06, 0x06, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x33, 0x4b, 0x00, 0x05, 0x05,
-    0x01, 0x5b, 0x02, 0x01, 0x01, 0x01, 0x31, 0x01, 0x4c, 0x59, 0x59, 0x40, 0x11, 0x00, 0x00, 0x32, 0x30, 0x29, 0x27,
-    0x00, 0x22, 0x00, 0x22, 0x29, 0x24, 0x25, 0x25, 0x08, 0x07, 0x18, 0x2b, 0x01, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32,
-    0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e,
-    0x02, 0x33, 0x32, 0x16, 0x17, 0x37, 0x01, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x11, 0x2e, 0x03, 0x23, 0x22,
-    0x0e, 0x02, 0x15, 0x03, 0xef, 0x0c, 0x15, 0x1d, 0x12, 0x0f, 0x1b, 0x0a, 0x17, 0x1f, 0x3b, 0x20, 0x4b, 0x63, 0x18,
-    0x36, 0x9a, 0x67, 0x62, 0x96, 0x66, 0x34, 0x34, 0x66, 0x97, 0x63, 0x68, 0x9b, 0x36, 0x31, 0xfd, 0xbb, 0x1c, 0x3f,
-    0x64, 0x47, 0x59, 0x77, 0x26, 0x13, 0x30, 0x3d, 0x49, 0x2b, 0x48, 0x65, 0x3f, 0x1c, 0x04, 0x3a, 0xfc, 0xdb, 0x26,
-    0x33, 0x1e, 0x0d, 0x04, 0x02, 0x8a, 0x15, 0x0d, 0x43, 0x4a, 0x45, 0x48, 0x4f, 0x8b, 0xbf, 0x70, 0x15, 0x7d, 0xd5,
-    0x9b, 0x58, 0x4c, 0x47, 0x7f, 0xfd, 0xba, 0x4b, 0x86, 0x65, 0x3c, 0x52, 0x41, 0x02, 0x13, 0x1f, 0x34, 0x26, 0x15,
-    0x46, 0x77, 0x9b, 0x55, 0x00, 0x00, 0x00, 0x02, 0x00, 0xae, 0xfe, 0x80, 0x04, 0x5b, 0x05, 0xc4, 0x00, 0x1a, 0x00,
-    0x3a, 0x00, 0x7f, 0x40, 0x0e, 0x08, 0x01, 0x06, 0x03, 0x2b, 0x01, 0x05, 0x06, 0x13, 0x01, 0x01, 0x05, 0x03, 0x4a,
-    0x4b, 0xb0, 0x1f, 0x50, 0x58, 0x40, 0x24, 0x08, 0x01, 0x03, 0x00, 0x06, 0x05, 0x03, 0x06, 0x63, 0x00, 0x04, 0x04,
-    0x00, 0x5b, 0x07, 0x01, 0x00, 0x00, 0x30, 0x4b, 0x00, 0x05, 0x05, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x31, 0x4b, 0x00,
-    0x02, 0x02, 0x2d, 0x02, 0x4c, 0x1b, 0x40, 0x24, 0x00, 0x02, 0x01, 0x02, 0x73, 0x08, 0x01, 0x03, 0x00, 0x06, 0x05,
-    0x03, 0x06, 0x63, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x07, 0x01, 0x00, 0x00, 0x30, 0x4b, 0x00, 0x05, 0x05, 0x01, 0x5b,
-    0x00, 0x01, 0x01, 0x31, 0x01, 0x4c, 0x59, 0x40, 0x19, 0x1c, 0x1b, 0x01, 0x00, 0x39, 0x37, 0x2f, 0x2d, 0x26, 0x24,
-    0x1b, 0x3a, 0x1c, 0x3a, 0x15, 0x14, 0x11, 0x0f, 0x00, 0x1a, 0x01, 0x1a, 0x09, 0x07, 0x14, 0x2b, 0x01, 0x32, 0x1e,
-    0x02, 0x15, 0x14, 0x06, 0x07, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x11, 0x23, 0x11, 0x34,
-    0x3e, 0x02, 0x13, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x11, 0x16, 0x16, 0x33,
-    0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x23, 0x35, 0x02, 0x6b, 0x61, 0x9e, 0x70, 0x3d, 0x62, 0x58, 0x79,
-    0x85, 0x44, 0x7a, 0xa6, 0x62, 0x51, 0x9e, 0x3e, 0xba, 0x47, 0x79, 0xa1, 0x58, 0x40, 0x5e, 0x3c, 0x1d, 0x20, 0x3e,
-    0x5b, 0x3a, 0x37, 0x5f, 0x45, 0x28, 0x2d, 0x90, 0x5d, 0x43, 0x6b, 0x4a, 0x28, 0x22, 0x42, 0x5f, 0x3d, 0x8f, 0x05,
-    0xc4, 0x39, 0x69, 0x90, 0x57, 0x5c, 0x97, 0x2f, 0x2c, 0xc2, 0x83, 0x6b, 0xa5, 0x72, 0x3b, 0x2e, 0x32, 0xfe, 0x35,
-    0x05, 0xb1, 0x52, 0x93, 0x6e, 0x40, 0xfd, 0x96, 0x22, 0x3c, 0x54, 0x33, 0x2e, 0x56, 0x42, 0x28, 0x27, 0x44, 0x5c,
-    0x35, 0xfc, 0xc5, 0x35, 0x3f, 0x2b, 0x4d, 0x6b, 0x3f, 0x35, 0x66, 0x51, 0x32, 0x98, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x47, 0xfe, 0x60, 0x04, 0x96, 0x04, 0x3a, 0x00, 0x0a, 0x00, 0x1d, 0x40, 0x1a, 0x09, 0x05, 0x02, 0x03, 0x01,
-    0x00, 0x01, 0x4a, 0x02, 0x01, 0x00, 0x00, 0x2b, 0x4b, 0x00, 0x01, 0x01, 0x2d, 0x01, 0x4c, 0x12, 0x12, 0x10, 0x03,
-    0x07, 0x17, 0x2b, 0x01, 0x33, 0x01, 0x11, 0x23, 0x11, 0x01, 0x33, 0x01, 0x17, 0x37, 0x03, 0xd8, 0xbe, 0xfe, 0x36,
-    0xba, 0xfe, 0x35, 0xbe, 0x01, 0x54, 0x18, 0x1a, 0x04, 0x3a, 0xfb, 0xf5, 0xfe, 0x31, 0x01, 0xd6, 0x04, 0x04, 0xfc,
-    0xf0, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x78, 0xff, 0xec, 0x04, 0x66, 0x06, 0x1c, 0x00, 0x31, 0x00,
-    0x47, 0x00, 0x34, 0x40, 0x31, 0x08, 0x01, 0x01, 0x00, 0x2c, 0x09, 0x02, 0x04, 0x01, 0x02, 0x4a, 0x00, 0x04, 0x01,
-    0x03, 0x01, 0x04, 0x03, 0x70, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x01, 0x63, 0x00, 0x03, 0x03, 0x02, 0x5b, 0x00,
-    0x02, 0x02, 0x31, 0x02, 0x4c, 0x43, 0x42, 0x38, 0x36, 0x22, 0x20, 0x27, 0x24, 0x05, 0x07, 0x16, 0x2b, 0x01, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x17, 0x16,
-    0x12, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x37, 0x2e, 0x03,
-    0x13, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x27, 0x26, 0x0e, 0x02, 0x15, 0x01,
-    0x07, 0x36, 0x63, 0x8c, 0x56, 0x50, 0x9f, 0x4b, 0x29, 0x17, 0x3f, 0x48, 0x4e, 0x28, 0x2a, 0x45, 0x32, 0x1c, 0x17,
-    0x36, 0x59, 0x43, 0xdc, 0xdf, 0x44, 0x81, 0xba, 0x76, 0x78, 0xbb, 0x82, 0x44, 0x36, 0x5d, 0x7f, 0x48, 0x04, 0x2f,
-    0x4c, 0x36, 0x1e, 0x2b, 0x26, 0x4f, 0x78, 0x52, 0x51, 0x76, 0x4e, 0x26, 0x2d, 0x52, 0x73, 0x47, 0x51, 0x78, 0x50,
-    0x28, 0x04, 0xf5, 0x45, 0x6e, 0x4c, 0x28, 0x2f, 0x26, 0x82, 0x09, 0x16, 0x13, 0x0d, 0x14, 0x24, 0x33, 0x1f, 0x16,
-    0x2f, 0x30, 0x30, 0x17, 0x49, 0xfe, 0xec, 0xcf, 0x15, 0x71, 0xc1, 0x8e, 0x51, 0x51, 0x8e, 0xc1, 0x71, 0x15, 0x57,
-    0x98, 0x78, 0x52, 0x11, 0x0b, 0x13, 0x36, 0x45, 0x51, 0xfd, 0x37, 0x4d, 0x8a, 0x67, 0x3d, 0x3d, 0x67, 0x8a, 0x4d,
-    0x15, 0x3f, 0x7d, 0x69, 0x4b, 0x0c, 0x01, 0x3d, 0x69, 0x8b, 0x4c, 0x00, 0x01, 0x00, 0x8b, 0xff, 0xec, 0x04, 0x60,
-    0x04, 0x4d, 0x00, 0x3c, 0x00, 0x4e, 0x40, 0x4b, 0x1d, 0x01, 0x00, 0x07, 0x01, 0x4a, 0x00, 0x05, 0x06, 0x07, 0x06,
-    0x05, 0x07, 0x70, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x70, 0x00, 0x07, 0x08, 0x01, 0x00, 0x02, 0x07, 0x00,
-    0x63, 0x00, 0x06, 0x06, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x33, 0x4b, 0x00, 0x01, 0x01, 0x03, 0x5b, 0x00, 0x03, 0x03,
-    0x31, 0x03, 0x4c, 0x01, 0x00, 0x3b, 0x39, 0x31, 0x2f, 0x2b, 0x2a, 0x26, 0x24, 0x16, 0x14, 0x0e, 0x0d, 0x09, 0x07,
-    0x00, 0x3c, 0x01, 0x3c, 0x09, 0x07, 0x14, 0x2b, 0x01, 0x22, 0x06, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02,
-    0x35, 0x33, 0x0e, 0x05, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x37, 0x26, 0x26, 0x35, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x1e, 0x02, 0x17, 0x23, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x33, 0x15,
-    0x02, 0x6a, 0x91, 0x94, 0x28, 0x4d, 0x72, 0x4a, 0x42, 0x70, 0x51, 0x2e, 0xb9, 0x01, 0x27, 0x45, 0x5e, 0x6c, 0x77,
-    0x3c, 0x6c, 0xb4, 0x83, 0x48, 0x71, 0x6a, 0x5f, 0x69, 0x42, 0x7b, 0xaf, 0x6c, 0x5f, 0xab, 0x81, 0x4c, 0x01, 0xb9,
-    0x2f, 0x4e, 0x68, 0x3a, 0x4b, 0x6c, 0x46, 0x21, 0x1e, 0x42, 0x68, 0x4a, 0xf3, 0x01, 0xde, 0x51, 0x5d, 0x25, 0x40,
-    0x2f, 0x1b, 0x1e, 0x35, 0x45, 0x27, 0x3b, 0x61, 0x4b, 0x37, 0x25, 0x11, 0x2b, 0x53, 0x78, 0x4e, 0x5f, 0x7e, 0x1f,
-    0x23, 0x79, 0x4b, 0x4e, 0x75, 0x4f, 0x28, 0x2c, 0x53, 0x77, 0x4b, 0x25, 0x3f, 0x2d, 0x1a, 0x1a, 0x2d, 0x3c, 0x22,
-    0x25, 0x3b, 0x2a, 0x16, 0x94, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x75, 0xfe, 0x81, 0x04, 0x2f, 0x05, 0xb0, 0x00,
-    0x2a, 0x00, 0x25, 0x40, 0x22, 0x01, 0x01, 0x00, 0x01, 0x01, 0x4a, 0x16, 0x15, 0x02, 0x00, 0x47, 0x00, 0x00, 0x00,
-    0x01, 0x59, 0x02, 0x01, 0x01, 0x01, 0x28, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x2a, 0x29, 0x28, 0x03, 0x07,
-    0x14, 0x2b, 0x01, 0x15, 0x01, 0x0e, 0x03, 0x15, 0x14, 0x16, 0x17, 0x17, 0x1e, 0x03, 0x15, 0x0e, 0x03, 0x07, 0x27,
-    0x36, 0x36, 0x35, 0x34, 0x26, 0x27, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x01, 0x21, 0x35, 0x04, 0x2f,
-    0xfe, 0x67, 0x45, 0x6e, 0x4d, 0x29, 0x5c, 0x5a, 0xdd, 0x36, 0x60, 0x46, 0x29, 0x01, 0x23, 0x34, 0x3f, 0x1c, 0x62,
-    0x31, 0x32, 0x4b, 0x50, 0xb5, 0x59, 0x7f, 0x51, 0x26, 0x2a, 0x57, 0x86, 0x5c, 0x01, 0x32, 0xfd, 0x2c, 0x05, 0xb0,
-    0x78, 0xfe, 0x55, 0x42, 0x75, 0x78, 0x82, 0x4e, 0x63, 0x62, 0x12, 0x32, 0x0c, 0x1a, 0x2e, 0x4b, 0x3e, 0x27, 0x56,
-    0x4f, 0x45, 0x16, 0x54, 0x36, 0x55, 0x2c, 0x23, 0x38, 0x10, 0x23, 0x10, 0x3b, 0x59, 0x7a, 0x51, 0x39, 0x87, 0x98,
-    0xa4, 0x57, 0x01, 0x3c, 0x98, 0x00, 0x01, 0x00, 0xa4, 0xfe, 0x61, 0x04, 0x2b, 0x04, 0x4e, 0x00, 0x15, 0x00, 0x55,
-    0xb6, 0x12, 0x01, 0x02, 0x03, 0x02, 0x01, 0x4a, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x17, 0x00, 0x02, 0x02, 0x00,
-    0x5b, 0x05, 0x04, 0x02, 0x00, 0x00, 0x33, 0x4b, 0x00, 0x03, 0x03, 0x29, 0x4b, 0x00, 0x01, 0x01, 0x2d, 0x01, 0x4c,
-    0x1b, 0x40, 0x1b, 0x05, 0x01, 0x04, 0x04, 0x2b, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x33, 0x4b,
-    0x00, 0x03, 0x03, 0x29, 0x4b, 0x00, 0x01, 0x01, 0x2d, 0x01, 0x4c, 0x59, 0x40, 0x0d, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x15, 0x13, 0x23, 0x15, 0x23, 0x06, 0x07, 0x18, 0x2b, 0x01, 0x17, 0x36, 0x36, 0x37, 0x32, 0x1e, 0x02, 0x15, 0x11,
-    0x23, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x11, 0x23, 0x11, 0x01, 0x4b, 0x0d, 0x37, 0xaa, 0x70, 0x5a, 0x8e,
-    0x64, 0x36, 0xba, 0x80, 0x7f, 0x65, 0x88, 0x27, 0xba, 0x04, 0x3a, 0xa0, 0x54, 0x5f, 0x01, 0x2c, 0x63, 0x9f, 0x73,
-    0xfb, 0xb4, 0x04, 0x48, 0x90, 0x7d, 0x4d, 0x41, 0xfc, 0xd8, 0x04, 0x3a, 0x00, 0x00, 0x03, 0x00, 0xb9, 0xff, 0xec,
-    0x04, 0x18, 0x05, 0xc5, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x51, 0x4b, 0xb0, 0x10, 0x50, 0x58, 0x40, 0x1d,
-    0x00, 0x04, 0x00, 0x02, 0x03, 0x04, 0x02, 0x61, 0x00, 0x05, 0x05, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x30, 0x4b, 0x00,
-    0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x31, 0x00, 0x4c, 0x1b, 0x40, 0x1d, 0x00, 0x04, 0x00, 0x02, 0x03, 0x04,
-    0x02, 0x61, 0x00, 0x05, 0x05, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x32, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00,
-    0x00, 0x31, 0x00, 0x4c, 0x59, 0x40, 0x09, 0x23, 0x13, 0x23, 0x15, 0x29, 0x24, 0x06, 0x07, 0x1a, 0x2b, 0x01, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x07, 0x21, 0x15,
-    0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x01, 0x21, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x04, 0x18, 0x39, 0x6e,
-    0xa0, 0x67, 0x66, 0xa1, 0x6f, 0x3b, 0x3a, 0x6e, 0xa1, 0x66, 0x67, 0xa1, 0x6e, 0x3a, 0xb9, 0xfe, 0x13, 0x79, 0x7f,
-    0x7f, 0x76, 0xfe, 0x13, 0x01, 0xed, 0x77, 0x80, 0x7f, 0x77, 0x02, 0x2d, 0x8a, 0xd7, 0x93, 0x4d, 0x4d, 0x93, 0xd7,
-    0x8a, 0x01, 0x55, 0x8a, 0xd7, 0x95, 0x4d, 0x4d, 0x95, 0xd7, 0x8a, 0xef, 0x8d, 0xba, 0xca, 0xca, 0xba, 0x01, 0x24,
-    0x81, 0xba, 0xc8, 0xc8, 0xba, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb8, 0xff, 0xec, 0x04, 0x3a, 0x04, 0x3a, 0x00,
-    0x15, 0x00, 0x29, 0x40, 0x26, 0x0a, 0x01, 0x01, 0x03, 0x0b, 0x01, 0x02, 0x01, 0x02, 0x4a, 0x00, 0x03, 0x03, 0x00,
-    0x59, 0x00, 0x00, 0x00, 0x2b, 0x4b, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x31, 0x02, 0x4c, 0x15, 0x25,
-    0x25, 0x10, 0x04, 0x07, 0x18, 0x2b, 0x13, 0x21, 0x13, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06,
-    0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x21, 0xb8, 0x02, 0x19, 0x01, 0x1b, 0x2f, 0x3c, 0x21, 0x2d, 0x4e, 0x1d, 0x29,
-    0x3e, 0x74, 0x3e, 0x48, 0x71, 0x4f, 0x2a, 0xfe, 0xa0, 0x04, 0x3a, 0xfd, 0x08, 0x41, 0x4b, 0x25, 0x0a, 0x1c, 0x11,
-    0x82, 0x2c, 0x1a, 0x22, 0x52, 0x87, 0x65, 0x02, 0x4d, 0x00, 0x00, 0x01, 0x00, 0x39, 0xff, 0xef, 0x04, 0x5c, 0x05,
-    0xee, 0x00, 0x2a, 0x01, 0xa2, 0x4b, 0xb0, 0x1d, 0x50, 0x58, 0x40, 0x10, 0x0c, 0x01, 0x01, 0x02, 0x29, 0x1f, 0x02,
-    0x03, 0x03, 0x01, 0x02, 0x4a, 0x20, 0x01, 0x00, 0x47, 0x1b, 0x40, 0x10, 0x0c, 0x01, 0x01, 0x02, 0x29, 0x1f, 0x02,
-    0x03, 0x03, 0x01, 0x20, 0x01, 0x04, 0x00, 0x03, 0x4a, 0x59, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x16, 0x00, 0x01,
-    0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x30, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x04, 0x01, 0x00, 0x00, 0x29, 0x00,
-    0x4c, 0x1b, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40, 0x16, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x32, 0x4b,
-    0x00, 0x03, 0x03, 0x00, 0x5b, 0x04, 0x01, 0x00, 0x00, 0x29, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40,
-    0x16, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x30, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x04, 0x01, 0x00,
-    0x00, 0x29, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x16, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02,
-    0x02, 0x32, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x04, 0x01, 0x00, 0x00, 0x29, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x10,
-    0x50, 0x58, 0x40, 0x16, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x30, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b,
-    0x04, 0x01, 0x00, 0x00, 0x29, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x12, 0x50, 0x58, 0x40, 0x16, 0x00, 0x01, 0x01, 0x02,
-    0x5b, 0x00, 0x02, 0x02, 0x32, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x04, 0x01, 0x00, 0x00, 0x29, 0x00, 0x4c, 0x1b,
-    0x4b, 0xb0, 0x14, 0x50, 0x58, 0x40, 0x16, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x30, 0x4b, 0x00, 0x03,
-    0x03, 0x00, 0x5b, 0x04, 0x01, 0x00, 0x00, 0x29, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x16, 0x50, 0x58, 0x40, 0x16, 0x00,
-    0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x32, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x04, 0x01, 0x00, 0x00, 0x29,
-    0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x16, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x30,
-    0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x04, 0x01, 0x00, 0x00, 0x29, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x19, 0x50, 0x58,
-    0x40, 0x16, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x32, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x04, 0x01,
-    0x00, 0x00, 0x29, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x1d, 0x50, 0x58, 0x40, 0x14, 0x00, 0x02, 0x00, 0x01, 0x03, 0x02,
-    0x01, 0x63, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x04, 0x01, 0x00, 0x00, 0x29, 0x00, 0x4c, 0x1b, 0x40, 0x18, 0x00, 0x02,
-    0x00, 0x01, 0x03, 0x02, 0x01, 0x63, 0x00, 0x00, 0x00, 0x29, 0x4b, 0x00, 0x03, 0x03, 0x04, 0x5b, 0x00, 0x04, 0x04,
-    0x31, 0x04, 0x4c, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0xb7, 0x28, 0x19, 0x26, 0x16,
-    0x10, 0x05, 0x07, 0x19, 0x2b, 0x21, 0x23, 0x01, 0x27, 0x2e, 0x03, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33,
-    0x32, 0x1e, 0x02, 0x17, 0x01, 0x1e, 0x03, 0x33, 0x32, 0x32, 0x36, 0x36, 0x37, 0x07, 0x06, 0x06, 0x23, 0x22, 0x2e,
-    0x02, 0x27, 0x03, 0x07, 0x01, 0x07, 0xce, 0x01, 0x8b, 0x37, 0x0e, 0x22, 0x2c, 0x37, 0x22, 0x0d, 0x28, 0x0d, 0x01,
-    0x12, 0x3c, 0x19, 0x48, 0x6a, 0x4b, 0x31, 0x0f, 0x01, 0x6a, 0x0a, 0x1d, 0x22, 0x2a, 0x18, 0x08, 0x0a, 0x09, 0x0a,
-    0x09, 0x02, 0x0b, 0x24, 0x0c, 0x3b, 0x5c, 0x49, 0x39, 0x18, 0xd4, 0x1d, 0x04, 0x08, 0x8f, 0x23, 0x45, 0x36, 0x21,
-    0x04, 0x01, 0x8e, 0x05, 0x0a, 0x36, 0x51, 0x5f, 0x28, 0xfc, 0x4a, 0x21, 0x38, 0x29, 0x18, 0x02, 0x01, 0x02, 0x97,
-    0x06, 0x09, 0x22, 0x43, 0x64, 0x42, 0x02, 0x2b, 0x77, 0x00, 0x00, 0x00, 0x01, 0x00, 0xaf, 0xfe, 0x77, 0x04, 0x2e,
-    0x05, 0xc4, 0x00, 0x44, 0x00, 0x2c, 0x40, 0x29, 0x44, 0x01, 0x00, 0x03, 0x37, 0x01, 0x02, 0x01, 0x02, 0x4a, 0x24,
-    0x23, 0x02, 0x02, 0x47, 0x00, 0x01, 0x00, 0x02, 0x01, 0x02, 0x5f, 0x00, 0x00, 0x00, 0x03, 0x5b, 0x00, 0x03, 0x03,
-    0x30, 0x00, 0x4c, 0x42, 0x40, 0x21, 0x28, 0x22, 0x04, 0x07, 0x17, 0x2b, 0x01, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02,
-    0x15, 0x14, 0x1e, 0x02, 0x33, 0x33, 0x15, 0x23, 0x22, 0x06, 0x15, 0x14, 0x1e, 0x02, 0x17, 0x17, 0x1e, 0x03, 0x15,
-    0x0e, 0x03, 0x07, 0x27, 0x3e, 0x03, 0x35, 0x26, 0x26, 0x27, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x2e,
-    0x03, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x03, 0xf7, 0x39, 0x71, 0x3d, 0x5f, 0x87, 0x57, 0x29, 0x2a,
-    0x5d, 0x91, 0x66, 0x8e, 0x8e, 0xdd, 0xe3, 0x37, 0x5d, 0x7b, 0x43, 0x6f, 0x36, 0x5f, 0x47, 0x29, 0x01, 0x23, 0x35,
-    0x3e, 0x1b, 0x61, 0x18, 0x24, 0x19, 0x0d, 0x01, 0x4e, 0x4d, 0x3a, 0x72, 0xba, 0x84, 0x48, 0x2f, 0x59, 0x7e, 0x4f,
-    0x41, 0x66, 0x47, 0x26, 0x4b, 0x8d, 0xc8, 0x7e, 0x47, 0x8c, 0x30, 0x05, 0x08, 0x0f, 0x15, 0x1e, 0x33, 0x44, 0x27,
-    0x33, 0x51, 0x39, 0x1e, 0x98, 0x9c, 0xa5, 0x44, 0x66, 0x4a, 0x2e, 0x0c, 0x19, 0x0d, 0x19, 0x2d, 0x4a, 0x3d, 0x27,
-    0x54, 0x4f, 0x44, 0x16, 0x54, 0x1b, 0x2a, 0x29, 0x2d, 0x1d, 0x2c, 0x2b, 0x11, 0x0d, 0x16, 0x41, 0x67, 0x9a, 0x70,
-    0x4c, 0x7e, 0x62, 0x48, 0x16, 0x15, 0x3b, 0x4a, 0x57, 0x31, 0x53, 0x80, 0x58, 0x2d, 0x16, 0x11, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x59, 0xff, 0xed, 0x04, 0xa9, 0x04, 0x3a, 0x00, 0x1b, 0x00, 0x6b, 0x4b, 0xb0, 0x1b, 0x50, 0x58,
-    0x40, 0x0a, 0x0a, 0x01, 0x01, 0x00, 0x0b, 0x01, 0x02, 0x01, 0x02, 0x4a, 0x1b, 0x40, 0x0a, 0x0a, 0x01, 0x01, 0x00,
-    0x0b, 0x01, 0x04, 0x01, 0x02, 0x4a, 0x59, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x18, 0x05, 0x03, 0x02, 0x00, 0x00,
-    0x06, 0x59, 0x00, 0x06, 0x06, 0x2b, 0x4b, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x04, 0x01, 0x02, 0x02, 0x31, 0x02, 0x4c,
-    0x1b, 0x40, 0x1c, 0x05, 0x03, 0x02, 0x00, 0x00, 0x06, 0x59, 0x00, 0x06, 0x06, 0x2b, 0x4b, 0x00, 0x04, 0x04, 0x29,
-    0x4b, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x31, 0x02, 0x4c, 0x59, 0x40, 0x0a, 0x11, 0x11, 0x11, 0x15,
-    0x25, 0x25, 0x10, 0x07, 0x07, 0x1b, 0x2b, 0x01, 0x23, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06,
-    0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x21, 0x11, 0x23, 0x11, 0x23, 0x35, 0x21, 0x04, 0x4c, 0x8f, 0x10, 0x1c,
-    0x25, 0x16, 0x1a, 0x31, 0x11, 0x29, 0x2f, 0x57, 0x2f, 0x39, 0x5a, 0x3d, 0x20, 0xfe, 0x92, 0xb9, 0x84, 0x03, 0xf3,
-    0x03, 0xa1, 0xfd, 0x6b, 0x2c, 0x33, 0x1c, 0x08, 0x10, 0x09, 0x82, 0x20, 0x13, 0x1e, 0x45, 0x72, 0x54, 0x02, 0x8b,
-    0xfc, 0x5f, 0x03, 0xa1, 0x99, 0x00, 0x00, 0x02, 0x00, 0xa5, 0xfe, 0x60, 0x04, 0x46, 0x04, 0x4e, 0x00, 0x16, 0x00,
-    0x2e, 0x00, 0x2f, 0x40, 0x2c, 0x24, 0x01, 0x04, 0x03, 0x08, 0x01, 0x00, 0x04, 0x02, 0x4a, 0x00, 0x03, 0x03, 0x02,
-    0x5b, 0x00, 0x02, 0x02, 0x33, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x31, 0x4b, 0x00, 0x01, 0x01,
-    0x2d, 0x01, 0x4c, 0x2b, 0x29, 0x26, 0x13, 0x24, 0x05, 0x07, 0x19, 0x2b, 0x01, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26,
-    0x27, 0x11, 0x23, 0x11, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34, 0x2e, 0x02, 0x23, 0x22,
-    0x0e, 0x04, 0x15, 0x11, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x04, 0x46, 0x36, 0x69, 0x9b, 0x66, 0x6a, 0xa3,
-    0x3b, 0xb9, 0x49, 0x7f, 0xa9, 0x60, 0x75, 0xaf, 0x73, 0x39, 0xb9, 0x1e, 0x42, 0x6a, 0x4d, 0x31, 0x50, 0x3e, 0x2d,
-    0x1d, 0x0f, 0x13, 0x34, 0x43, 0x54, 0x33, 0x4c, 0x6d, 0x45, 0x20, 0x01, 0xf4, 0x70, 0xbf, 0x8b, 0x4e, 0x44, 0x40,
-    0xfd, 0xf0, 0x03, 0xe1, 0x01, 0x7f, 0xc4, 0x85, 0x44, 0x58, 0x9b, 0xd4, 0x7e, 0x55, 0x9c, 0x76, 0x46, 0x20, 0x38,
-    0x4a, 0x53, 0x57, 0x29, 0xfe, 0xdb, 0x21, 0x39, 0x29, 0x17, 0x3b, 0x66, 0x86, 0x4b, 0x00, 0x00, 0x01, 0x00, 0x78,
-    0xfe, 0x59, 0x04, 0x30, 0x04, 0x4e, 0x00, 0x33, 0x00, 0x26, 0x40, 0x23, 0x21, 0x20, 0x02, 0x01, 0x47, 0x00, 0x01,
-    0x02, 0x01, 0x73, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x03, 0x01, 0x00, 0x00, 0x33, 0x02, 0x4c, 0x01, 0x00, 0x0c, 0x0a,
-    0x06, 0x05, 0x00, 0x33, 0x01, 0x33, 0x04, 0x07, 0x14, 0x2b, 0x01, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34, 0x2e, 0x02,
-    0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x15, 0x0e, 0x03, 0x07, 0x27, 0x3e, 0x03,
-    0x35, 0x36, 0x26, 0x27, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x02, 0x66, 0x64, 0xa8, 0x79, 0x45, 0xaf, 0x24,
-    0x46, 0x6a, 0x47, 0x51, 0x75, 0x4b, 0x23, 0x2b, 0x59, 0x88, 0x5c, 0x56, 0x8a, 0x62, 0x34, 0x01, 0x2e, 0x49, 0x5a,
-    0x2d, 0x4d, 0x16, 0x36, 0x2f, 0x20, 0x01, 0x70, 0x6c, 0x82, 0xc4, 0x83, 0x43, 0x42, 0x7e, 0xb7, 0x04, 0x4e, 0x35,
-    0x65, 0x92, 0x5d, 0x32, 0x58, 0x41, 0x26, 0x45, 0x6f, 0x8a, 0x46, 0x2a, 0x44, 0x7b, 0x62, 0x45, 0x0d, 0x0c, 0x21,
-    0x38, 0x57, 0x42, 0x3b, 0x63, 0x50, 0x3c, 0x14, 0x7b, 0x0a, 0x1f, 0x2d, 0x3c, 0x28, 0x33, 0x31, 0x0e, 0x13, 0x58,
-    0x85, 0xaf, 0x69, 0x2a, 0x6c, 0xc3, 0x95, 0x58, 0x00, 0x00, 0x02, 0x00, 0x6d, 0xff, 0xec, 0x04, 0x86, 0x04, 0x3a,
-    0x00, 0x16, 0x00, 0x2c, 0x00, 0x21, 0x40, 0x1e, 0x04, 0x01, 0x00, 0x00, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x2b, 0x4b,
-    0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x31, 0x01, 0x4c, 0x29, 0x25, 0x29, 0x28, 0x10, 0x05, 0x07, 0x19,
-    0x2b, 0x01, 0x21, 0x16, 0x16, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02,
-    0x33, 0x21, 0x01, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02,
-    0x15, 0x04, 0x86, 0xfe, 0xe5, 0x61, 0x67, 0x41, 0x7b, 0xb4, 0x72, 0x73, 0xb4, 0x7c, 0x41, 0x41, 0x7c, 0xb3, 0x72,
-    0x02, 0x37, 0xfc, 0xa0, 0x24, 0x49, 0x71, 0x4d, 0x4c, 0x70, 0x4a, 0x23, 0x24, 0x49, 0x71, 0x4d, 0x4c, 0x70, 0x49,
-    0x24, 0x03, 0xa1, 0x48, 0xd3, 0x84, 0x17, 0x63, 0xb8, 0x8e, 0x56, 0x54, 0x94, 0xc8, 0x75, 0x16, 0x70, 0xc3, 0x8e,
-    0x52, 0xfd, 0xd7, 0x50, 0x91, 0x6e, 0x40, 0x40, 0x6e, 0x91, 0x50, 0x16, 0x4c, 0x89, 0x68, 0x3d, 0x3d, 0x68, 0x89,
-    0x4c, 0x00, 0x00, 0x01, 0x00, 0xad, 0xff, 0xeb, 0x04, 0x32, 0x04, 0x3a, 0x00, 0x19, 0x00, 0x2b, 0x40, 0x28, 0x0a,
-    0x01, 0x01, 0x00, 0x0b, 0x01, 0x02, 0x01, 0x02, 0x4a, 0x03, 0x01, 0x00, 0x00, 0x04, 0x59, 0x00, 0x04, 0x04, 0x2b,
-    0x4b, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x31, 0x02, 0x4c, 0x11, 0x15, 0x27, 0x25, 0x10, 0x05, 0x07,
-    0x19, 0x2b, 0x01, 0x21, 0x03, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02,
-    0x35, 0x11, 0x21, 0x35, 0x21, 0x04, 0x32, 0xfe, 0x9d, 0x01, 0x1b, 0x2c, 0x3a, 0x21, 0x2c, 0x4d, 0x1b, 0x29, 0x1e,
-    0x3b, 0x3a, 0x3b, 0x1e, 0x48, 0x6f, 0x4d, 0x28, 0xfe, 0x98, 0x03, 0x85, 0x03, 0x9c, 0xfd, 0xa8, 0x40, 0x4b, 0x26,
-    0x0b, 0x1b, 0x11, 0x83, 0x16, 0x1b, 0x0f, 0x06, 0x24, 0x53, 0x87, 0x65, 0x02, 0x4e, 0x9e, 0x00, 0x00, 0x01, 0x00,
-    0x9e, 0xff, 0xec, 0x04, 0x3f, 0x04, 0x3a, 0x00, 0x1f, 0x00, 0x21, 0x40, 0x1e, 0x04, 0x03, 0x02, 0x01, 0x01, 0x2b,
-    0x4b, 0x00, 0x00, 0x00, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x31, 0x02, 0x4c, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x29,
-    0x17, 0x25, 0x05, 0x07, 0x17, 0x2b, 0x01, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x26, 0x02, 0x27,
-    0x33, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x01, 0x57, 0x26, 0x46, 0x63, 0x3c,
-    0x4d, 0x6e, 0x47, 0x22, 0x03, 0x45, 0x34, 0xc3, 0x17, 0x29, 0x20, 0x12, 0x34, 0x70, 0xb2, 0x7e, 0x6e, 0xab, 0x76,
-    0x3e, 0x04, 0x3a, 0xfd, 0x95, 0x59, 0x7e, 0x51, 0x25, 0x4d, 0x7b, 0x9a, 0x4e, 0x86, 0x01, 0x05, 0x7d, 0x30, 0x71,
-    0x82, 0x93, 0x52, 0x72, 0xd3, 0xa1, 0x60, 0x3a, 0x77, 0xb7, 0x7d, 0x02, 0x69, 0x00, 0x00, 0x00, 0x02, 0x00, 0x6e,
-    0xfe, 0x22, 0x04, 0x77, 0x04, 0x3a, 0x00, 0x25, 0x00, 0x33, 0x00, 0x2d, 0x40, 0x2a, 0x09, 0x01, 0x02, 0x00, 0x26,
-    0x23, 0x13, 0x00, 0x04, 0x01, 0x02, 0x02, 0x4a, 0x08, 0x01, 0x00, 0x48, 0x00, 0x01, 0x02, 0x01, 0x73, 0x00, 0x02,
-    0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x2b, 0x02, 0x4c, 0x31, 0x2f, 0x25, 0x24, 0x1a, 0x18, 0x03, 0x07, 0x14, 0x2b,
-    0x05, 0x2e, 0x03, 0x35, 0x34, 0x12, 0x37, 0x17, 0x0e, 0x03, 0x07, 0x14, 0x1e, 0x02, 0x17, 0x11, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x11, 0x23, 0x13, 0x3e, 0x03, 0x35, 0x2e, 0x03, 0x23, 0x22,
-    0x06, 0x07, 0x02, 0x0d, 0x71, 0x9d, 0x64, 0x2d, 0x7b, 0x80, 0x65, 0x2d, 0x3e, 0x27, 0x13, 0x02, 0x19, 0x36, 0x58,
-    0x3f, 0x1e, 0x3d, 0x5e, 0x40, 0x4e, 0x86, 0x64, 0x39, 0x30, 0x68, 0xa4, 0x75, 0xb9, 0xb9, 0x43, 0x5e, 0x3c, 0x1b,
-    0x02, 0x17, 0x2d, 0x44, 0x2e, 0x21, 0x1e, 0x01, 0x0e, 0x0f, 0x67, 0x97, 0xbd, 0x66, 0xaa, 0x01, 0x13, 0x5b, 0x85,
-    0x29, 0x62, 0x69, 0x6c, 0x34, 0x40, 0x80, 0x6d, 0x53, 0x12, 0x02, 0xb4, 0x30, 0x59, 0x45, 0x29, 0x54, 0x91, 0xc5,
-    0x70, 0x65, 0xbc, 0x98, 0x67, 0x0f, 0xfe, 0x31, 0x02, 0x6b, 0x12, 0x52, 0x6f, 0x81, 0x3f, 0x46, 0x8a, 0x6d, 0x44,
-    0x30, 0x27, 0x00, 0x01, 0x00, 0x61, 0xfe, 0x28, 0x04, 0x80, 0x04, 0x3a, 0x00, 0x23, 0x00, 0x26, 0x40, 0x23, 0x22,
-    0x15, 0x12, 0x01, 0x04, 0x01, 0x00, 0x01, 0x4a, 0x00, 0x01, 0x01, 0x00, 0x59, 0x04, 0x03, 0x02, 0x03, 0x00, 0x00,
-    0x2b, 0x01, 0x4c, 0x00, 0x00, 0x00, 0x23, 0x00, 0x23, 0x17, 0x19, 0x19, 0x05, 0x07, 0x17, 0x2b, 0x01, 0x11, 0x3e,
-    0x03, 0x35, 0x26, 0x02, 0x27, 0x33, 0x16, 0x12, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x11, 0x23, 0x11, 0x2e, 0x03, 0x35,
-    0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x17, 0x11, 0x02, 0xbc, 0x49, 0x66, 0x3f, 0x1d, 0x02, 0x31, 0x26, 0xc3, 0x20,
-    0x2f, 0x30, 0x6b, 0xac, 0x7d, 0xb9, 0x63, 0x9b, 0x6c, 0x38, 0xb9, 0x21, 0x3d, 0x56, 0x35, 0x04, 0x3a, 0xfc, 0x52,
-    0x12, 0x56, 0x75, 0x8a, 0x44, 0x86, 0x01, 0x00, 0x7d, 0x5f, 0xff, 0x00, 0xa4, 0x6b, 0xc6, 0x9e, 0x69, 0x0e, 0xfe,
-    0x37, 0x01, 0xcb, 0x0e, 0x58, 0x98, 0xd7, 0x8c, 0x01, 0xe6, 0xfe, 0x18, 0x67, 0x9c, 0x6f, 0x43, 0x0f, 0x03, 0xac,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x4f, 0xff, 0xec, 0x04, 0x89, 0x04, 0x3a, 0x00, 0x30, 0x00, 0x34, 0x40, 0x31, 0x25,
-    0x01, 0x00, 0x01, 0x01, 0x4a, 0x00, 0x01, 0x03, 0x00, 0x03, 0x01, 0x00, 0x70, 0x07, 0x06, 0x02, 0x03, 0x03, 0x2b,
-    0x4b, 0x02, 0x01, 0x00, 0x00, 0x04, 0x5c, 0x05, 0x01, 0x04, 0x04, 0x31, 0x04, 0x4c, 0x00, 0x00, 0x00, 0x30, 0x00,
-    0x30, 0x24, 0x27, 0x17, 0x23, 0x13, 0x27, 0x08, 0x07, 0x1a, 0x2b, 0x01, 0x06, 0x02, 0x07, 0x14, 0x1e, 0x02, 0x33,
-    0x32, 0x36, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x26, 0x02, 0x27, 0x33, 0x16, 0x12,
-    0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x12, 0x37, 0x01,
-    0x71, 0x2d, 0x3a, 0x02, 0x0c, 0x1d, 0x2e, 0x22, 0x43, 0x4b, 0xba, 0x4b, 0x42, 0x22, 0x2f, 0x1d, 0x0c, 0x02, 0x3a,
-    0x2d, 0xc2, 0x28, 0x38, 0x1e, 0x46, 0x72, 0x53, 0x5a, 0x7a, 0x20, 0x21, 0x79, 0x5a, 0x53, 0x72, 0x46, 0x1e, 0x38,
-    0x28, 0x04, 0x3a, 0x7e, 0xfe, 0xfb, 0x87, 0x54, 0x9b, 0x78, 0x47, 0xa6, 0xaf, 0x01, 0x2b, 0xfe, 0xd5, 0xaf, 0xa6,
-    0x47, 0x76, 0x9c, 0x55, 0x87, 0x01, 0x05, 0x7e, 0x61, 0xfe, 0xfc, 0xa5, 0x6f, 0xd1, 0xa2, 0x62, 0x6d, 0x66, 0x66,
-    0x6d, 0x62, 0xa2, 0xd1, 0x6f, 0xa5, 0x01, 0x04, 0x61, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x98, 0xff, 0xec, 0x04,
-    0x99, 0x05, 0xc6, 0x00, 0x2d, 0x00, 0x3a, 0x00, 0x87, 0x40, 0x0e, 0x2d, 0x01, 0x01, 0x04, 0x33, 0x2a, 0x19, 0x02,
-    0x00, 0x05, 0x02, 0x01, 0x02, 0x4a, 0x4b, 0xb0, 0x10, 0x50, 0x58, 0x40, 0x1d, 0x00, 0x01, 0x04, 0x02, 0x04, 0x01,
-    0x02, 0x70, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x32, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00,
-    0x00, 0x31, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x1d, 0x00, 0x01, 0x04, 0x02, 0x04, 0x01, 0x02,
-    0x70, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x30, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00,
-    0x31, 0x00, 0x4c, 0x1b, 0x40, 0x1d, 0x00, 0x01, 0x04, 0x02, 0x04, 0x01, 0x02, 0x70, 0x00, 0x04, 0x04, 0x03, 0x5b,
-    0x00, 0x03, 0x03, 0x32, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x31, 0x00, 0x4c, 0x59, 0x59, 0x40,
-    0x09, 0x38, 0x36, 0x2d, 0x25, 0x15, 0x27, 0x05, 0x07, 0x18, 0x2b, 0x01, 0x06, 0x07, 0x15, 0x14, 0x0e, 0x02, 0x23,
-    0x22, 0x2e, 0x02, 0x35, 0x11, 0x37, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x16, 0x36, 0x35, 0x35, 0x2e, 0x03, 0x35, 0x35,
-    0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x36, 0x36, 0x37, 0x01, 0x14, 0x1e, 0x02, 0x17, 0x11, 0x34,
-    0x26, 0x23, 0x22, 0x06, 0x15, 0x04, 0x99, 0x43, 0x4d, 0x3e, 0x70, 0x9f, 0x62, 0x66, 0xa6, 0x75, 0x41, 0xba, 0x24,
-    0x44, 0x62, 0x3e, 0x76, 0x80, 0x6e, 0xb3, 0x7f, 0x46, 0x32, 0x58, 0x7a, 0x4a, 0x4f, 0x7e, 0x56, 0x2e, 0x23, 0x44,
-    0x20, 0xfd, 0x94, 0x28, 0x4d, 0x70, 0x47, 0x4a, 0x4e, 0x43, 0x51, 0x02, 0x73, 0x18, 0x08, 0xa0, 0x6d, 0xaa, 0x74,
-    0x3c, 0x41, 0x77, 0xa8, 0x67, 0x01, 0x4e, 0x02, 0xfe, 0xb0, 0x45, 0x6f, 0x4d, 0x29, 0x01, 0x95, 0x96, 0xa6, 0x10,
-    0x5a, 0x87, 0xae, 0x64, 0x0f, 0x51, 0x81, 0x5a, 0x2f, 0x33, 0x60, 0x8a, 0x58, 0xfe, 0x9f, 0x03, 0x0d, 0x08, 0x01,
-    0x52, 0x3f, 0x72, 0x5c, 0x42, 0x10, 0x01, 0x56, 0x6d, 0x6a, 0x59, 0x64, 0x00, 0x01, 0x00, 0x36, 0x00, 0x00, 0x04,
-    0xa4, 0x05, 0xbb, 0x00, 0x24, 0x00, 0x80, 0x40, 0x0f, 0x19, 0x08, 0x02, 0x01, 0x00, 0x23, 0x18, 0x12, 0x0f, 0x09,
-    0x05, 0x02, 0x01, 0x02, 0x4a, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x12, 0x03, 0x01, 0x01, 0x01, 0x00, 0x5b, 0x04,
-    0x01, 0x00, 0x00, 0x28, 0x4b, 0x00, 0x02, 0x02, 0x29, 0x02, 0x4c, 0x1b, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40, 0x12,
-    0x03, 0x01, 0x01, 0x01, 0x00, 0x5b, 0x04, 0x01, 0x00, 0x00, 0x30, 0x4b, 0x00, 0x02, 0x02, 0x29, 0x02, 0x4c, 0x1b,
-    0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40, 0x12, 0x03, 0x01, 0x01, 0x01, 0x00, 0x5b, 0x04, 0x01, 0x00, 0x00, 0x28, 0x4b,
-    0x00, 0x02, 0x02, 0x29, 0x02, 0x4c, 0x1b, 0x40, 0x12, 0x03, 0x01, 0x01, 0x01, 0x00, 0x5b, 0x04, 0x01, 0x00, 0x00,
-    0x30, 0x4b, 0x00, 0x02, 0x02, 0x29, 0x02, 0x4c, 0x59, 0x59, 0x59, 0xb7, 0x24, 0x24, 0x14, 0x24, 0x24, 0x05, 0x07,
-    0x19, 0x2b, 0x01, 0x3e, 0x03, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x23, 0x22, 0x06, 0x07, 0x01, 0x11, 0x23, 0x11,
-    0x01, 0x26, 0x26, 0x23, 0x22, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x13, 0x17, 0x37, 0x03, 0x39,
-    0x1a, 0x38, 0x3f, 0x46, 0x28, 0x1c, 0x35, 0x1b, 0x16, 0x0e, 0x1e, 0x23, 0x3b, 0x12, 0xfe, 0xd8, 0xb8, 0xfe, 0xd6,
-    0x12, 0x3b, 0x23, 0x1d, 0x0e, 0x17, 0x1b, 0x35, 0x1d, 0x27, 0x46, 0x3f, 0x39, 0x1a, 0xb3, 0x18, 0x18, 0x04, 0xd7,
-    0x3f, 0x58, 0x36, 0x17, 0x07, 0x11, 0x95, 0x09, 0x26, 0x28, 0xfd, 0x7b, 0xfd, 0xbc, 0x02, 0x40, 0x02, 0x89, 0x27,
-    0x27, 0x09, 0x95, 0x11, 0x07, 0x17, 0x36, 0x58, 0x3f, 0xfe, 0x69, 0x58, 0x58, 0x00, 0x02, 0x00, 0x2e, 0xff, 0xec,
-    0x04, 0x96, 0x04, 0x3a, 0x00, 0x1a, 0x00, 0x34, 0x00, 0x36, 0x40, 0x33, 0x0c, 0x01, 0x06, 0x07, 0x01, 0x4a, 0x00,
-    0x07, 0x00, 0x06, 0x00, 0x07, 0x06, 0x70, 0x05, 0x03, 0x02, 0x00, 0x00, 0x04, 0x59, 0x00, 0x04, 0x04, 0x2b, 0x4b,
-    0x08, 0x01, 0x06, 0x06, 0x01, 0x5b, 0x02, 0x01, 0x01, 0x01, 0x31, 0x01, 0x4c, 0x23, 0x13, 0x27, 0x14, 0x11, 0x17,
-    0x24, 0x27, 0x10, 0x09, 0x07, 0x1d, 0x2b, 0x01, 0x23, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27,
-    0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x37, 0x23, 0x35, 0x21, 0x03, 0x26, 0x26, 0x27, 0x21, 0x06,
-    0x06, 0x07, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x35, 0x35, 0x33, 0x15, 0x14, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x04,
-    0x96, 0x7e, 0x20, 0x2a, 0x1d, 0x41, 0x6b, 0x4e, 0x5a, 0x7a, 0x20, 0x20, 0x79, 0x5a, 0x4e, 0x6b, 0x41, 0x1d, 0x29,
-    0x21, 0x69, 0x04, 0x68, 0xee, 0x02, 0x2f, 0x26, 0xfe, 0x0d, 0x26, 0x2f, 0x02, 0x0a, 0x18, 0x27, 0x1e, 0x43, 0x4a,
-    0xba, 0x4a, 0x43, 0x1d, 0x27, 0x18, 0x0a, 0x03, 0xa1, 0x6a, 0xfb, 0x8c, 0x59, 0xa3, 0x7d, 0x4b, 0x6d, 0x67, 0x66,
-    0x6e, 0x4b, 0x7d, 0xa3, 0x59, 0x8c, 0xfb, 0x6a, 0x99, 0xfd, 0x75, 0x7c, 0xfd, 0x79, 0x79, 0xfd, 0x7c, 0x3b, 0x6d,
-    0x53, 0x32, 0xa6, 0xaf, 0xfb, 0xfb, 0xaf, 0xa6, 0x31, 0x52, 0x6e, 0x00, 0x00, 0x01, 0x00, 0x2a, 0xff, 0xf5, 0x04,
-    0x7c, 0x05, 0xb0, 0x00, 0x1f, 0x00, 0xd3, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x1f, 0x00, 0x01, 0x00, 0x04, 0x03,
-    0x01, 0x04, 0x63, 0x06, 0x01, 0x00, 0x00, 0x07, 0x59, 0x00, 0x07, 0x07, 0x16, 0x4b, 0x00, 0x03, 0x03, 0x02, 0x5b,
-    0x05, 0x01, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x1b, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40, 0x1f, 0x00, 0x01, 0x00, 0x04,
-    0x03, 0x01, 0x04, 0x63, 0x06, 0x01, 0x00, 0x00, 0x07, 0x59, 0x00, 0x07, 0x07, 0x16, 0x4b, 0x00, 0x03, 0x03, 0x02,
-    0x5b, 0x05, 0x01, 0x02, 0x02, 0x1e, 0x02, 0x4c, 0x1b, 0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40, 0x1f, 0x00, 0x01, 0x00,
-    0x04, 0x03, 0x01, 0x04, 0x63, 0x06, 0x01, 0x00, 0x00, 0x07, 0x59, 0x00, 0x07, 0x07, 0x16, 0x4b, 0x00, 0x03, 0x03,
-    0x02, 0x5b, 0x05, 0x01, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x1b, 0x4b, 0xb0, 0x2c, 0x50, 0x58, 0x40, 0x1f, 0x00, 0x01,
-    0x00, 0x04, 0x03, 0x01, 0x04, 0x63, 0x06, 0x01, 0x00, 0x00, 0x07, 0x59, 0x00, 0x07, 0x07, 0x16, 0x4b, 0x00, 0x03,
-    0x03, 0x02, 0x5b, 0x05, 0x01, 0x02, 0x02, 0x1e, 0x02, 0x4c, 0x1b, 0x40, 0x23, 0x00, 0x01, 0x00, 0x04, 0x03, 0x01,
-    0x04, 0x63, 0x06, 0x01, 0x00, 0x00, 0x07, 0x59, 0x00, 0x07, 0x07, 0x16, 0x4b, 0x00, 0x05, 0x05, 0x17, 0x4b, 0x00,
-    0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x1e, 0x02, 0x4c, 0x59, 0x59, 0x59, 0x59, 0x40, 0x0b, 0x11, 0x11, 0x11,
-    0x46, 0x11, 0x16, 0x41, 0x10, 0x08, 0x06, 0x1c, 0x2b, 0x01, 0x21, 0x11, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x15,
-    0x14, 0x06, 0x23, 0x27, 0x32, 0x3e, 0x02, 0x35, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x11, 0x23, 0x11, 0x21, 0x35,
-    0x21, 0x04, 0x3d, 0xfe, 0x00, 0x1e, 0x3d, 0x1f, 0x6c, 0xa9, 0x74, 0x3c, 0xca, 0xc0, 0x02, 0x3a, 0x51, 0x31, 0x16,
-    0x01, 0x81, 0x89, 0x20, 0x3c, 0x1e, 0xb8, 0xfe, 0xa5, 0x04, 0x13, 0x05, 0x18, 0xfe, 0x39, 0x02, 0x04, 0x40, 0x76,
-    0xab, 0x6a, 0xc6, 0xd1, 0x91, 0x25, 0x44, 0x61, 0x3c, 0x8b, 0x9e, 0x04, 0x02, 0xfd, 0x51, 0x05, 0x18, 0x98, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x81, 0xff, 0xec, 0x04, 0x6b, 0x05, 0xc5, 0x00, 0x2f, 0x00, 0x41, 0x40, 0x3e, 0x00, 0x02,
-    0x03, 0x04, 0x03, 0x02, 0x04, 0x70, 0x08, 0x01, 0x07, 0x05, 0x06, 0x05, 0x07, 0x06, 0x70, 0x00, 0x04, 0x00, 0x05,
-    0x07, 0x04, 0x05, 0x61, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x1d, 0x4b, 0x00, 0x06, 0x06, 0x00, 0x5b,
-    0x00, 0x00, 0x00, 0x1e, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x25, 0x11, 0x15, 0x24, 0x14, 0x29, 0x24,
-    0x09, 0x06, 0x1b, 0x2b, 0x01, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e,
-    0x02, 0x17, 0x23, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x21, 0x15, 0x21, 0x15, 0x14, 0x1e, 0x02, 0x33,
-    0x32, 0x3e, 0x02, 0x37, 0x04, 0x6b, 0x0a, 0x48, 0x7d, 0xb0, 0x72, 0x75, 0xbb, 0x83, 0x46, 0x46, 0x83, 0xbb, 0x75,
-    0x72, 0xb0, 0x7d, 0x48, 0x0a, 0xb9, 0x0a, 0x2c, 0x4a, 0x6d, 0x4b, 0x4f, 0x77, 0x51, 0x29, 0x02, 0x3b, 0xfd, 0xc5,
-    0x29, 0x51, 0x77, 0x4f, 0x4b, 0x6d, 0x4b, 0x2b, 0x0a, 0x01, 0xb7, 0x65, 0xa9, 0x7a, 0x43, 0x57, 0x9d, 0xd9, 0x83,
-    0x01, 0x39, 0x83, 0xda, 0x9c, 0x57, 0x3f, 0x78, 0xad, 0x6e, 0x4b, 0x76, 0x50, 0x2a, 0x43, 0x75, 0xa1, 0x5e, 0x4b,
-    0x98, 0x58, 0x5f, 0xa1, 0x76, 0x43, 0x27, 0x4d, 0x73, 0x4d, 0x00, 0x00, 0x02, 0x00, 0x1e, 0x00, 0x00, 0x04, 0x9d,
-    0x05, 0xb0, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x3a, 0x40, 0x37, 0x00, 0x00, 0x09, 0x01, 0x07, 0x04, 0x00, 0x07, 0x63,
-    0x00, 0x02, 0x02, 0x05, 0x59, 0x08, 0x01, 0x05, 0x05, 0x16, 0x4b, 0x06, 0x01, 0x04, 0x04, 0x01, 0x5b, 0x03, 0x01,
-    0x01, 0x01, 0x17, 0x01, 0x4c, 0x1d, 0x1d, 0x00, 0x00, 0x1d, 0x29, 0x1d, 0x28, 0x20, 0x1e, 0x00, 0x1c, 0x00, 0x1c,
-    0x21, 0x25, 0x11, 0x28, 0x21, 0x0a, 0x06, 0x19, 0x2b, 0x01, 0x11, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x21, 0x11, 0x23, 0x03, 0x14, 0x02, 0x06, 0x06, 0x23, 0x23, 0x35, 0x33, 0x32, 0x12, 0x13, 0x13, 0x01, 0x11,
-    0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x02, 0xeb, 0x5b, 0x54, 0x81, 0x56, 0x2c, 0x2c, 0x56, 0x81,
-    0x54, 0xfe, 0xec, 0xc5, 0x01, 0x1f, 0x46, 0x74, 0x55, 0x20, 0x16, 0x48, 0x37, 0x01, 0x03, 0x02, 0x34, 0x5b, 0x2c,
-    0x3d, 0x25, 0x11, 0x11, 0x26, 0x3d, 0x2b, 0x05, 0xb0, 0xfd, 0xc7, 0x45, 0x77, 0xa2, 0x5e, 0x5e, 0xa2, 0x77, 0x44,
-    0x05, 0x18, 0xfd, 0xec, 0xb8, 0xfe, 0xe1, 0xc6, 0x67, 0x97, 0x01, 0x3b, 0x01, 0x32, 0x02, 0xac, 0xfd, 0x2f, 0xfd,
-    0xb8, 0x33, 0x53, 0x69, 0x37, 0x36, 0x68, 0x52, 0x32, 0x00, 0x02, 0x00, 0x83, 0x00, 0x00, 0x04, 0x8b, 0x05, 0xb0,
-    0x00, 0x16, 0x00, 0x23, 0x00, 0x5f, 0x4b, 0xb0, 0x23, 0x50, 0x58, 0x40, 0x1d, 0x02, 0x01, 0x00, 0x09, 0x08, 0x02,
-    0x04, 0x07, 0x00, 0x04, 0x63, 0x06, 0x01, 0x01, 0x01, 0x16, 0x4b, 0x00, 0x07, 0x07, 0x03, 0x5c, 0x05, 0x01, 0x03,
-    0x03, 0x17, 0x03, 0x4c, 0x1b, 0x40, 0x23, 0x00, 0x02, 0x09, 0x01, 0x08, 0x04, 0x02, 0x08, 0x63, 0x00, 0x00, 0x00,
-    0x04, 0x07, 0x00, 0x04, 0x61, 0x06, 0x01, 0x01, 0x01, 0x16, 0x4b, 0x00, 0x07, 0x07, 0x03, 0x5c, 0x05, 0x01, 0x03,
-    0x03, 0x17, 0x03, 0x4c, 0x59, 0x40, 0x11, 0x17, 0x17, 0x17, 0x23, 0x17, 0x22, 0x22, 0x11, 0x11, 0x11, 0x28, 0x21,
-    0x11, 0x10, 0x0a, 0x06, 0x1c, 0x2b, 0x01, 0x33, 0x11, 0x33, 0x11, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x33, 0x01, 0x11, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23,
-    0x01, 0x3b, 0xfa, 0xb8, 0x31, 0x5b, 0x89, 0x5b, 0x2e, 0x2e, 0x5b, 0x89, 0x5b, 0xe9, 0xfa, 0xb8, 0xb8, 0x01, 0xb2,
-    0x31, 0x33, 0x45, 0x2b, 0x12, 0x13, 0x2a, 0x45, 0x33, 0x03, 0x39, 0x02, 0x77, 0xfd, 0x97, 0x3e, 0x6f, 0x98, 0x5a,
-    0x5a, 0x9b, 0x72, 0x41, 0x02, 0xa1, 0xfd, 0x5f, 0x05, 0xb0, 0xfc, 0xff, 0xfd, 0xf2, 0x2d, 0x4a, 0x5f, 0x33, 0x33,
-    0x5e, 0x48, 0x2c, 0x00, 0x00, 0x01, 0x00, 0x43, 0x00, 0x00, 0x04, 0x68, 0x05, 0xb0, 0x00, 0x1a, 0x00, 0x31, 0x40,
-    0x2e, 0x02, 0x01, 0x03, 0x01, 0x14, 0x01, 0x02, 0x03, 0x02, 0x4a, 0x00, 0x01, 0x00, 0x03, 0x02, 0x01, 0x03, 0x63,
-    0x05, 0x01, 0x00, 0x00, 0x06, 0x59, 0x00, 0x06, 0x06, 0x16, 0x4b, 0x04, 0x01, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x11,
-    0x11, 0x12, 0x25, 0x15, 0x23, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x01, 0x21, 0x11, 0x36, 0x36, 0x17, 0x32, 0x1e, 0x02,
-    0x15, 0x11, 0x23, 0x11, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x07, 0x11, 0x23, 0x11, 0x21, 0x35, 0x21, 0x04, 0x40, 0xfe,
-    0x16, 0x1c, 0x36, 0x1a, 0x63, 0x9d, 0x6c, 0x3a, 0xb9, 0x1c, 0x3b, 0x59, 0x3d, 0x38, 0x34, 0xb9, 0xfe, 0xa6, 0x03,
-    0xfd, 0x05, 0x18, 0xfe, 0x3c, 0x04, 0x04, 0x01, 0x2e, 0x62, 0x98, 0x6a, 0xfe, 0x37, 0x01, 0xc9, 0x44, 0x5f, 0x3c,
-    0x1b, 0x06, 0xfd, 0x43, 0x05, 0x18, 0x98, 0x00, 0x01, 0x00, 0xa2, 0xfe, 0x99, 0x04, 0x2a, 0x05, 0xb0, 0x00, 0x0b,
-    0x00, 0x23, 0x40, 0x20, 0x00, 0x04, 0x03, 0x04, 0x73, 0x02, 0x01, 0x00, 0x00, 0x16, 0x4b, 0x00, 0x01, 0x01, 0x03,
-    0x5a, 0x05, 0x01, 0x03, 0x03, 0x17, 0x03, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x06, 0x1a, 0x2b, 0x13,
-    0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0x11, 0x23, 0x11, 0x21, 0xa2, 0xb9, 0x02, 0x16, 0xb9, 0xfe, 0x9d, 0xb9,
-    0xfe, 0x94, 0x05, 0xb0, 0xfa, 0xe7, 0x05, 0x19, 0xfa, 0x50, 0xfe, 0x99, 0x01, 0x67, 0x00, 0x00, 0x02, 0x00, 0xa2,
-    0x00, 0x00, 0x04, 0x4c, 0x05, 0xb0, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x2f, 0x40, 0x2c, 0x00, 0x01, 0x06, 0x01, 0x05,
-    0x04, 0x01, 0x05, 0x63, 0x00, 0x00, 0x00, 0x03, 0x59, 0x00, 0x03, 0x03, 0x16, 0x4b, 0x00, 0x04, 0x04, 0x02, 0x5b,
-    0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x11, 0x11, 0x11, 0x1d, 0x11, 0x1c, 0x22, 0x11, 0x28, 0x21, 0x10, 0x07, 0x06,
-    0x19, 0x2b, 0x01, 0x21, 0x11, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x21, 0x01, 0x11,
-    0x21, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x04, 0x1d, 0xfd, 0x3f, 0x01, 0x0a, 0x74, 0xb5, 0x7c, 0x41,
-    0x41, 0x7c, 0xb5, 0x74, 0xfe, 0x3c, 0x03, 0x7b, 0xfd, 0x3f, 0x01, 0x0a, 0x4e, 0x71, 0x4a, 0x23, 0x23, 0x4a, 0x71,
-    0x4e, 0x05, 0x18, 0xfe, 0x41, 0x3c, 0x6f, 0x9c, 0x61, 0x60, 0xa0, 0x72, 0x3f, 0x05, 0xb0, 0xfd, 0x12, 0xfd, 0xd5,
-    0x2e, 0x4e, 0x67, 0x39, 0x38, 0x63, 0x49, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x46, 0xfe, 0x99, 0x04, 0x78,
-    0x05, 0xb0, 0x00, 0x10, 0x00, 0x17, 0x00, 0x2b, 0x40, 0x28, 0x02, 0x01, 0x00, 0x03, 0x00, 0x51, 0x00, 0x07, 0x07,
-    0x04, 0x59, 0x00, 0x04, 0x04, 0x16, 0x4b, 0x06, 0x05, 0x02, 0x03, 0x03, 0x01, 0x59, 0x00, 0x01, 0x01, 0x17, 0x01,
-    0x4c, 0x11, 0x14, 0x11, 0x16, 0x11, 0x11, 0x11, 0x10, 0x08, 0x06, 0x1c, 0x2b, 0x01, 0x23, 0x11, 0x21, 0x11, 0x23,
-    0x03, 0x33, 0x3e, 0x03, 0x37, 0x13, 0x21, 0x11, 0x33, 0x01, 0x06, 0x02, 0x07, 0x21, 0x11, 0x21, 0x04, 0x66, 0xa7,
-    0xfd, 0x3f, 0x9d, 0x1b, 0x41, 0x2e, 0x46, 0x32, 0x1e, 0x05, 0x20, 0x02, 0x89, 0x7f, 0xfd, 0x93, 0x09, 0x42, 0x40,
-    0x01, 0xc0, 0xfe, 0xe1, 0xfe, 0x9b, 0x01, 0x65, 0xfe, 0x99, 0x01, 0xfe, 0x1e, 0x71, 0xaf, 0xf2, 0xa0, 0x02, 0x49,
-    0xfa, 0xe7, 0x02, 0xd0, 0xf2, 0xfe, 0x93, 0x71, 0x04, 0x81, 0x00, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x04, 0xae, 0x05,
-    0xb0, 0x00, 0x15, 0x00, 0x31, 0x40, 0x2e, 0x13, 0x08, 0x02, 0x00, 0x05, 0x01, 0x4a, 0x07, 0x01, 0x05, 0x02, 0x01,
-    0x00, 0x01, 0x05, 0x00, 0x61, 0x08, 0x06, 0x02, 0x04, 0x04, 0x16, 0x4b, 0x09, 0x03, 0x02, 0x01, 0x01, 0x17, 0x01,
-    0x4c, 0x15, 0x14, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x10, 0x0a, 0x06, 0x1d, 0x2b, 0x01, 0x23, 0x11,
-    0x23, 0x11, 0x23, 0x03, 0x23, 0x01, 0x03, 0x33, 0x13, 0x33, 0x11, 0x33, 0x11, 0x33, 0x13, 0x33, 0x03, 0x01, 0x23,
-    0x02, 0xfb, 0x36, 0xb7, 0x3e, 0xcd, 0xe6, 0x01, 0x0d, 0xe6, 0xd7, 0xae, 0x45, 0xb7, 0x3e, 0xad, 0xd8, 0xe8, 0x01,
-    0x0e, 0xe5, 0x02, 0x8b, 0xfd, 0x75, 0x02, 0x8b, 0xfd, 0x75, 0x02, 0xd7, 0x02, 0xd9, 0xfd, 0x73, 0x02, 0x8d, 0xfd,
-    0x73, 0x02, 0x8d, 0xfd, 0x29, 0xfd, 0x27, 0x00, 0x00, 0x00, 0x01, 0x00, 0x59, 0xff, 0xeb, 0x04, 0x70, 0x05, 0xc4,
-    0x00, 0x3a, 0x00, 0x4e, 0x40, 0x4b, 0x1b, 0x01, 0x07, 0x00, 0x01, 0x4a, 0x00, 0x02, 0x01, 0x00, 0x01, 0x02, 0x00,
-    0x70, 0x00, 0x05, 0x07, 0x06, 0x07, 0x05, 0x06, 0x70, 0x08, 0x01, 0x00, 0x00, 0x07, 0x05, 0x00, 0x07, 0x63, 0x00,
-    0x01, 0x01, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x1d, 0x4b, 0x00, 0x06, 0x06, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x1e, 0x04,
-    0x4c, 0x01, 0x00, 0x39, 0x37, 0x2f, 0x2d, 0x29, 0x28, 0x24, 0x22, 0x14, 0x12, 0x0e, 0x0d, 0x09, 0x07, 0x00, 0x3a,
-    0x01, 0x3a, 0x09, 0x06, 0x14, 0x2b, 0x01, 0x36, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x23,
-    0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x06, 0x06, 0x07, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22,
-    0x2e, 0x02, 0x35, 0x33, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x23, 0x35, 0x02,
-    0x67, 0x9f, 0x9a, 0x29, 0x52, 0x7a, 0x52, 0x3f, 0x70, 0x52, 0x31, 0xb9, 0x4f, 0x87, 0xb2, 0x63, 0x73, 0xbd, 0x87,
-    0x4a, 0x01, 0x7f, 0x6e, 0x7d, 0x87, 0x51, 0x8f, 0xc4, 0x73, 0x5f, 0xb7, 0x90, 0x5a, 0xba, 0x30, 0x56, 0x78, 0x48,
-    0x51, 0x81, 0x5b, 0x30, 0x2d, 0x56, 0x7d, 0x4f, 0xb7, 0x03, 0x32, 0x01, 0x87, 0x70, 0x37, 0x5e, 0x46, 0x28, 0x25,
-    0x43, 0x5c, 0x36, 0x5d, 0x95, 0x67, 0x38, 0x34, 0x68, 0x9c, 0x66, 0x67, 0xa4, 0x30, 0x2a, 0xaa, 0x81, 0x67, 0x9f,
-    0x6d, 0x38, 0x31, 0x68, 0xa1, 0x6f, 0x39, 0x64, 0x4a, 0x2b, 0x28, 0x48, 0x64, 0x3c, 0x45, 0x63, 0x41, 0x1f, 0x98,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0xa2, 0x00, 0x00, 0x04, 0x2a, 0x05, 0xb0, 0x00, 0x09, 0x00, 0x1e, 0x40, 0x1b, 0x09,
-    0x04, 0x02, 0x01, 0x00, 0x01, 0x4a, 0x03, 0x01, 0x00, 0x00, 0x16, 0x4b, 0x02, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4c,
-    0x11, 0x12, 0x11, 0x10, 0x04, 0x06, 0x18, 0x2b, 0x01, 0x33, 0x11, 0x23, 0x13, 0x01, 0x23, 0x11, 0x33, 0x03, 0x03,
-    0x71, 0xb9, 0xb9, 0x01, 0xfd, 0xe9, 0xb9, 0xb9, 0x01, 0x05, 0xb0, 0xfa, 0x50, 0x04, 0x31, 0xfb, 0xcf, 0x05, 0xb0,
-    0xfb, 0xd0, 0x00, 0x01, 0x00, 0x2f, 0x00, 0x00, 0x04, 0x2b, 0x05, 0xb0, 0x00, 0x11, 0x00, 0x27, 0x40, 0x24, 0x00,
-    0x01, 0x01, 0x04, 0x59, 0x05, 0x01, 0x04, 0x04, 0x16, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x02, 0x01, 0x00, 0x00,
-    0x17, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x11, 0x00, 0x11, 0x21, 0x25, 0x11, 0x11, 0x06, 0x06, 0x18, 0x2b, 0x01, 0x11,
-    0x23, 0x11, 0x21, 0x03, 0x14, 0x0e, 0x02, 0x23, 0x23, 0x35, 0x33, 0x32, 0x12, 0x11, 0x13, 0x04, 0x2b, 0xb9, 0xfe,
-    0x5b, 0x02, 0x26, 0x55, 0x8a, 0x64, 0x33, 0x28, 0x66, 0x55, 0x04, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0x18, 0xfd, 0x90,
-    0xa2, 0xfd, 0xae, 0x5b, 0x97, 0x01, 0x0d, 0x01, 0x04, 0x03, 0x08, 0x00, 0x01, 0x00, 0x2b, 0xff, 0xeb, 0x04, 0xb5,
-    0x05, 0xb0, 0x00, 0x1a, 0x00, 0x27, 0x40, 0x24, 0x18, 0x0d, 0x01, 0x03, 0x02, 0x00, 0x0c, 0x01, 0x01, 0x02, 0x02,
-    0x4a, 0x03, 0x01, 0x00, 0x00, 0x16, 0x4b, 0x00, 0x02, 0x02, 0x01, 0x5c, 0x00, 0x01, 0x01, 0x1e, 0x01, 0x4c, 0x16,
-    0x27, 0x25, 0x12, 0x04, 0x06, 0x18, 0x2b, 0x01, 0x17, 0x01, 0x33, 0x01, 0x0e, 0x03, 0x23, 0x22, 0x26, 0x27, 0x37,
-    0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x37, 0x01, 0x33, 0x02, 0x2f, 0x47, 0x01, 0x68, 0xd7, 0xfd, 0xe9, 0x17,
-    0x3b, 0x54, 0x77, 0x53, 0x44, 0x69, 0x1a, 0x18, 0x0d, 0x25, 0x2b, 0x2b, 0x13, 0x2e, 0x46, 0x34, 0x24, 0x0d, 0x2a,
-    0xfe, 0x0e, 0xd0, 0x02, 0xf7, 0xbf, 0x03, 0x78, 0xfb, 0x40, 0x34, 0x5f, 0x48, 0x2a, 0x18, 0x0b, 0x8d, 0x03, 0x09,
-    0x08, 0x05, 0x1b, 0x2c, 0x38, 0x1c, 0x55, 0x04, 0x3e, 0x00, 0x00, 0x01, 0x00, 0xa6, 0xfe, 0xa1, 0x04, 0xb4, 0x05,
-    0xb0, 0x00, 0x0b, 0x00, 0x23, 0x40, 0x20, 0x00, 0x04, 0x01, 0x04, 0x52, 0x02, 0x01, 0x00, 0x00, 0x16, 0x4b, 0x03,
-    0x01, 0x01, 0x01, 0x05, 0x5a, 0x00, 0x05, 0x05, 0x17, 0x05, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x06,
-    0x1a, 0x2b, 0x13, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x33, 0x03, 0x23, 0x11, 0x21, 0xa6, 0xb9, 0x02, 0x09, 0xb9,
-    0x93, 0x12, 0xa6, 0xfc, 0xaa, 0x05, 0xb0, 0xfa, 0xe7, 0x05, 0x19, 0xfa, 0xec, 0xfe, 0x05, 0x01, 0x5f, 0x00, 0x00,
-    0x01, 0x00, 0xab, 0x00, 0x00, 0x04, 0x27, 0x05, 0xb0, 0x00, 0x19, 0x00, 0x2f, 0x40, 0x2c, 0x18, 0x01, 0x03, 0x02,
-    0x03, 0x01, 0x01, 0x03, 0x02, 0x4a, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x01, 0x63, 0x05, 0x04, 0x02, 0x02, 0x02,
-    0x16, 0x4b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x19, 0x25, 0x15, 0x25, 0x11, 0x06,
-    0x06, 0x18, 0x2b, 0x01, 0x11, 0x23, 0x11, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e,
-    0x02, 0x33, 0x32, 0x36, 0x37, 0x11, 0x04, 0x27, 0xb9, 0x21, 0x42, 0x47, 0x51, 0x30, 0x61, 0x98, 0x68, 0x37, 0xb9,
-    0x1b, 0x37, 0x54, 0x39, 0x53, 0x90, 0x48, 0x05, 0xb0, 0xfa, 0x50, 0x02, 0x5b, 0x0c, 0x12, 0x0e, 0x07, 0x31, 0x6c,
-    0xaa, 0x79, 0x01, 0xc8, 0xfe, 0x38, 0x55, 0x71, 0x45, 0x1d, 0x1d, 0x18, 0x02, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x7d, 0x00, 0x00, 0x04, 0x50, 0x05, 0xb0, 0x00, 0x0b, 0x00, 0x25, 0x40, 0x22, 0x06, 0x05, 0x03, 0x03, 0x01,
-    0x01, 0x16, 0x4b, 0x02, 0x01, 0x00, 0x00, 0x04, 0x5a, 0x00, 0x04, 0x04, 0x17, 0x04, 0x4c, 0x00, 0x00, 0x00, 0x0b,
-    0x00, 0x0b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x07, 0x06, 0x19, 0x2b, 0x01, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11,
-    0x33, 0x11, 0x21, 0x11, 0x01, 0x36, 0xd5, 0xb8, 0xd5, 0xb8, 0xfc, 0x2d, 0x05, 0xb0, 0xfa, 0xe7, 0x05, 0x19, 0xfa,
-    0xe7, 0x05, 0x19, 0xfa, 0x50, 0x05, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7d, 0xfe, 0xa1, 0x04, 0xaa, 0x05,
-    0xb0, 0x00, 0x11, 0x00, 0x2d, 0x40, 0x2a, 0x00, 0x05, 0x00, 0x05, 0x52, 0x08, 0x07, 0x03, 0x03, 0x01, 0x01, 0x16,
-    0x4b, 0x04, 0x02, 0x02, 0x00, 0x00, 0x06, 0x5a, 0x00, 0x06, 0x06, 0x17, 0x06, 0x4c, 0x00, 0x00, 0x00, 0x11, 0x00,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x31, 0x11, 0x11, 0x09, 0x06, 0x1b, 0x2b, 0x01, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33,
-    0x35, 0x33, 0x11, 0x33, 0x11, 0x33, 0x03, 0x23, 0x11, 0x21, 0x11, 0x01, 0x36, 0xd5, 0xb8, 0x95, 0x40, 0xb8, 0x5a,
-    0x12, 0xa5, 0xfc, 0x8a, 0x05, 0xb0, 0xfa, 0xe7, 0x05, 0x19, 0xfa, 0xe7, 0x01, 0x05, 0x18, 0xfa, 0xe8, 0xfe, 0x09,
-    0x01, 0x5f, 0x05, 0xb0, 0x00, 0x02, 0x00, 0x32, 0x00, 0x00, 0x04, 0x79, 0x05, 0xb0, 0x00, 0x10, 0x00, 0x1d, 0x00,
-    0x2f, 0x40, 0x2c, 0x00, 0x01, 0x06, 0x01, 0x05, 0x04, 0x01, 0x05, 0x63, 0x00, 0x03, 0x03, 0x00, 0x59, 0x00, 0x00,
-    0x00, 0x16, 0x4b, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x11, 0x11, 0x11, 0x1d, 0x11,
-    0x1c, 0x22, 0x11, 0x28, 0x21, 0x10, 0x07, 0x06, 0x19, 0x2b, 0x13, 0x21, 0x11, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14,
-    0x0e, 0x02, 0x23, 0x21, 0x11, 0x21, 0x01, 0x11, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x32, 0x01,
-    0xea, 0x90, 0x6f, 0xac, 0x75, 0x3d, 0x3d, 0x75, 0xac, 0x6f, 0xfe, 0xb7, 0xfe, 0xcf, 0x01, 0xea, 0x90, 0x49, 0x68,
-    0x43, 0x1f, 0x1f, 0x43, 0x68, 0x49, 0x05, 0xb0, 0xfd, 0xa9, 0x3d, 0x6f, 0x9c, 0x60, 0x5f, 0x9f, 0x73, 0x40, 0x05,
-    0x18, 0xfd, 0xaa, 0xfd, 0xd5, 0x2f, 0x4e, 0x67, 0x38, 0x37, 0x63, 0x4a, 0x2b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x90,
-    0x00, 0x00, 0x04, 0x4b, 0x05, 0xb0, 0x00, 0x0e, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x2d, 0x40, 0x2a, 0x00, 0x00, 0x07,
-    0x01, 0x06, 0x05, 0x00, 0x06, 0x63, 0x04, 0x01, 0x02, 0x02, 0x16, 0x4b, 0x00, 0x05, 0x05, 0x01, 0x5c, 0x03, 0x01,
-    0x01, 0x01, 0x17, 0x01, 0x4c, 0x13, 0x13, 0x13, 0x1f, 0x13, 0x1e, 0x22, 0x11, 0x11, 0x11, 0x28, 0x20, 0x08, 0x06,
-    0x1a, 0x2b, 0x01, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x01, 0x23, 0x11, 0x33,
-    0x01, 0x11, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x01, 0x49, 0x5c, 0x5f, 0x91, 0x63, 0x32, 0x32,
-    0x63, 0x91, 0x5f, 0xfe, 0xeb, 0xb9, 0x03, 0x02, 0xb9, 0xb9, 0xfc, 0xfe, 0x5c, 0x37, 0x4e, 0x30, 0x16, 0x16, 0x31,
-    0x4d, 0x37, 0x03, 0x59, 0x3d, 0x6f, 0x9d, 0x5f, 0x5f, 0x9f, 0x73, 0x40, 0x05, 0xb0, 0xfa, 0x50, 0x05, 0xb0, 0xfd,
-    0x12, 0xfd, 0xd5, 0x2f, 0x4f, 0x66, 0x38, 0x37, 0x62, 0x4a, 0x2c, 0x00, 0x02, 0x00, 0xa8, 0x00, 0x00, 0x04, 0x51,
-    0x05, 0xb0, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x29, 0x40, 0x26, 0x00, 0x00, 0x05, 0x01, 0x04, 0x03, 0x00, 0x04, 0x63,
-    0x00, 0x02, 0x02, 0x16, 0x4b, 0x00, 0x03, 0x03, 0x01, 0x5c, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x0f, 0x0f, 0x0f,
-    0x1b, 0x0f, 0x1a, 0x22, 0x11, 0x28, 0x20, 0x06, 0x06, 0x18, 0x2b, 0x01, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e,
-    0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x11, 0x21, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x01, 0x61, 0x01,
-    0x0a, 0x74, 0xb5, 0x7c, 0x41, 0x41, 0x7c, 0xb5, 0x74, 0xfe, 0x3d, 0xb9, 0x01, 0x0a, 0x4e, 0x71, 0x4a, 0x23, 0x23,
-    0x4a, 0x71, 0x4e, 0x03, 0x59, 0x3c, 0x6f, 0x9c, 0x61, 0x60, 0xa0, 0x72, 0x3f, 0x05, 0xb0, 0xfd, 0x12, 0xfd, 0xd5,
-    0x2e, 0x4e, 0x67, 0x39, 0x38, 0x63, 0x49, 0x2b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x72, 0xff, 0xec, 0x04, 0x53, 0x05,
-    0xc5, 0x00, 0x2f, 0x00, 0x41, 0x40, 0x3e, 0x00, 0x04, 0x03, 0x02, 0x03, 0x04, 0x02, 0x70, 0x08, 0x01, 0x07, 0x01,
-    0x00, 0x01, 0x07, 0x00, 0x70, 0x00, 0x02, 0x00, 0x01, 0x07, 0x02, 0x01, 0x61, 0x00, 0x03, 0x03, 0x05, 0x5b, 0x00,
-    0x05, 0x05, 0x1d, 0x4b, 0x00, 0x00, 0x00, 0x06, 0x5b, 0x00, 0x06, 0x06, 0x1e, 0x06, 0x4c, 0x00, 0x00, 0x00, 0x2f,
-    0x00, 0x2f, 0x29, 0x24, 0x14, 0x25, 0x11, 0x15, 0x24, 0x09, 0x06, 0x1b, 0x2b, 0x01, 0x1e, 0x03, 0x33, 0x32, 0x3e,
-    0x02, 0x35, 0x35, 0x21, 0x35, 0x21, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x23, 0x3e, 0x03, 0x33,
-    0x32, 0x1e, 0x02, 0x15, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x01, 0x2b, 0x01, 0x27, 0x4a, 0x6d,
-    0x47, 0x4e, 0x7a, 0x54, 0x2d, 0xfe, 0x1c, 0x01, 0xe4, 0x2c, 0x54, 0x7a, 0x4f, 0x47, 0x6d, 0x4a, 0x27, 0x01, 0xb9,
-    0x01, 0x43, 0x7d, 0xb0, 0x6e, 0x75, 0xbe, 0x86, 0x49, 0x49, 0x86, 0xbe, 0x75, 0x6e, 0xb0, 0x7d, 0x43, 0x01, 0x01,
-    0xd1, 0x4c, 0x7b, 0x57, 0x30, 0x40, 0x72, 0x9e, 0x5e, 0x5a, 0x97, 0x5d, 0x5e, 0x9f, 0x72, 0x40, 0x30, 0x57, 0x7d,
-    0x4c, 0x65, 0xb2, 0x84, 0x4c, 0x54, 0x99, 0xd7, 0x83, 0xfe, 0xb4, 0x83, 0xd6, 0x99, 0x54, 0x45, 0x7f, 0xb3, 0x6e,
-    0x00, 0x00, 0x02, 0x00, 0x77, 0xff, 0xec, 0x04, 0x6a, 0x05, 0xc4, 0x00, 0x1d, 0x00, 0x31, 0x00, 0x5f, 0x4b, 0xb0,
-    0x19, 0x50, 0x58, 0x40, 0x1f, 0x00, 0x04, 0x00, 0x01, 0x07, 0x04, 0x01, 0x61, 0x00, 0x06, 0x06, 0x03, 0x5b, 0x05,
-    0x01, 0x03, 0x03, 0x16, 0x4b, 0x00, 0x07, 0x07, 0x00, 0x5b, 0x02, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x4c, 0x1b, 0x40,
-    0x27, 0x00, 0x04, 0x00, 0x01, 0x07, 0x04, 0x01, 0x61, 0x00, 0x03, 0x03, 0x16, 0x4b, 0x00, 0x06, 0x06, 0x05, 0x5b,
-    0x00, 0x05, 0x05, 0x1d, 0x4b, 0x00, 0x02, 0x02, 0x17, 0x4b, 0x00, 0x07, 0x07, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x1e,
-    0x00, 0x4c, 0x59, 0x40, 0x0b, 0x29, 0x27, 0x25, 0x11, 0x11, 0x11, 0x15, 0x24, 0x08, 0x06, 0x1c, 0x2b, 0x01, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x23, 0x11, 0x23, 0x11, 0x33, 0x11, 0x33, 0x35, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x1e, 0x02, 0x15, 0x27, 0x34, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32,
-    0x3e, 0x02, 0x35, 0x04, 0x6a, 0x2e, 0x5c, 0x89, 0x5a, 0x56, 0x82, 0x57, 0x2c, 0x72, 0xb9, 0xb9, 0x72, 0x2b, 0x57,
-    0x82, 0x56, 0x5b, 0x89, 0x5c, 0x2e, 0xb9, 0x51, 0x64, 0x2d, 0x3e, 0x26, 0x10, 0x10, 0x26, 0x3e, 0x2e, 0x32, 0x45,
-    0x2a, 0x13, 0x02, 0x03, 0x7f, 0xc7, 0x89, 0x48, 0x48, 0x89, 0xc7, 0x7f, 0x7a, 0xfd, 0x83, 0x05, 0xb0, 0xfd, 0x64,
-    0x98, 0x7f, 0xc7, 0x8a, 0x48, 0x48, 0x8a, 0xc7, 0x7f, 0x02, 0xbc, 0xbc, 0x2f, 0x5e, 0x8d, 0x5e, 0xfe, 0x55, 0x5f,
-    0x8e, 0x5e, 0x2f, 0x2f, 0x5e, 0x8e, 0x5f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x41, 0x00, 0x00, 0x04, 0x26, 0x05, 0xb0,
-    0x00, 0x0f, 0x00, 0x1c, 0x00, 0x33, 0x40, 0x30, 0x05, 0x01, 0x00, 0x04, 0x01, 0x4a, 0x00, 0x04, 0x00, 0x00, 0x01,
-    0x04, 0x00, 0x61, 0x00, 0x05, 0x05, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x16, 0x4b, 0x06, 0x03, 0x02, 0x01, 0x01, 0x17,
-    0x01, 0x4c, 0x00, 0x00, 0x19, 0x17, 0x16, 0x14, 0x00, 0x0f, 0x00, 0x0f, 0x28, 0x11, 0x11, 0x07, 0x06, 0x17, 0x2b,
-    0x21, 0x11, 0x21, 0x01, 0x23, 0x01, 0x26, 0x26, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x21, 0x11, 0x01, 0x14, 0x1e, 0x02,
-    0x33, 0x33, 0x11, 0x23, 0x22, 0x0e, 0x02, 0x03, 0x6d, 0xfe, 0xca, 0xfe, 0xcf, 0xc5, 0x01, 0x55, 0x8c, 0x94, 0x47,
-    0x85, 0xbd, 0x75, 0x01, 0xb2, 0xfd, 0x09, 0x29, 0x50, 0x78, 0x4e, 0xff, 0xf9, 0x50, 0x79, 0x52, 0x2a, 0x02, 0x5f,
-    0xfd, 0xa1, 0x02, 0x92, 0x33, 0xbc, 0x8b, 0x64, 0x9d, 0x6b, 0x38, 0xfa, 0x50, 0x04, 0x0e, 0x3b, 0x66, 0x4b, 0x2a,
-    0x02, 0x20, 0x25, 0x45, 0x63, 0x00, 0x02, 0x00, 0x81, 0xff, 0xec, 0x04, 0x47, 0x06, 0x11, 0x00, 0x2e, 0x00, 0x44,
-    0x00, 0x38, 0x40, 0x35, 0x2a, 0x01, 0x04, 0x03, 0x01, 0x4a, 0x00, 0x02, 0x00, 0x02, 0x72, 0x05, 0x01, 0x00, 0x06,
-    0x01, 0x03, 0x04, 0x00, 0x03, 0x63, 0x00, 0x04, 0x04, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x1e, 0x01, 0x4c, 0x30, 0x2f,
-    0x01, 0x00, 0x3b, 0x39, 0x2f, 0x44, 0x30, 0x44, 0x1e, 0x1d, 0x0c, 0x0a, 0x00, 0x2e, 0x01, 0x2e, 0x07, 0x06, 0x14,
-    0x2b, 0x01, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x3d, 0x03, 0x34, 0x12, 0x36,
-    0x36, 0x37, 0x3e, 0x03, 0x35, 0x33, 0x14, 0x0e, 0x04, 0x07, 0x0e, 0x03, 0x07, 0x3e, 0x03, 0x17, 0x22, 0x0e, 0x02,
-    0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x02, 0x86, 0x6a, 0xa6, 0x74,
-    0x3d, 0x41, 0x7c, 0xb3, 0x72, 0x72, 0xb4, 0x7c, 0x42, 0x45, 0x7f, 0xb5, 0x6f, 0x35, 0x5b, 0x43, 0x26, 0x98, 0x1d,
-    0x33, 0x45, 0x50, 0x58, 0x2c, 0x46, 0x7a, 0x60, 0x42, 0x0f, 0x20, 0x4e, 0x5a, 0x66, 0x15, 0x4c, 0x70, 0x49, 0x24,
-    0x24, 0x49, 0x71, 0x4d, 0x4c, 0x6f, 0x4a, 0x24, 0x24, 0x4a, 0x71, 0x03, 0xfc, 0x4b, 0x83, 0xb3, 0x69, 0x17, 0x71,
-    0xc0, 0x8e, 0x50, 0x50, 0x8e, 0xc0, 0x71, 0x17, 0x07, 0x45, 0xb5, 0x01, 0x13, 0xc1, 0x73, 0x15, 0x0a, 0x17, 0x23,
-    0x35, 0x29, 0x42, 0x5e, 0x41, 0x29, 0x1c, 0x12, 0x0a, 0x0f, 0x35, 0x5a, 0x83, 0x5c, 0x25, 0x3f, 0x2d, 0x19, 0x98,
-    0x37, 0x5d, 0x7a, 0x44, 0x17, 0x4c, 0x89, 0x67, 0x3d, 0x3d, 0x67, 0x89, 0x4c, 0x17, 0x44, 0x7a, 0x5d, 0x37, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0xa4, 0x00, 0x00, 0x04, 0x30, 0x04, 0x3a, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x26, 0x00,
-    0x3e, 0x40, 0x3b, 0x0a, 0x01, 0x03, 0x04, 0x01, 0x4a, 0x00, 0x04, 0x07, 0x01, 0x03, 0x02, 0x04, 0x03, 0x63, 0x00,
-    0x05, 0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x18, 0x4b, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x06, 0x01, 0x01, 0x01, 0x17,
-    0x01, 0x4c, 0x15, 0x15, 0x00, 0x00, 0x26, 0x24, 0x20, 0x1e, 0x15, 0x1d, 0x15, 0x1c, 0x18, 0x16, 0x00, 0x14, 0x00,
-    0x13, 0x21, 0x08, 0x06, 0x15, 0x2b, 0x33, 0x11, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x07, 0x1e, 0x03, 0x15,
-    0x14, 0x0e, 0x02, 0x23, 0x01, 0x11, 0x21, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x25, 0x33, 0x32, 0x36, 0x35, 0x34,
-    0x26, 0x23, 0x23, 0xa4, 0x01, 0xa9, 0x64, 0xa4, 0x75, 0x3f, 0x5a, 0x56, 0x34, 0x50, 0x37, 0x1c, 0x3a, 0x6c, 0x99,
-    0x5f, 0xfe, 0xcc, 0x01, 0x34, 0x70, 0x74, 0x75, 0x6f, 0xfe, 0xcc, 0xf1, 0x7c, 0x85, 0x87, 0x7c, 0xef, 0x04, 0x3a,
-    0x24, 0x48, 0x70, 0x4d, 0x4d, 0x76, 0x20, 0x0c, 0x31, 0x42, 0x50, 0x2c, 0x4d, 0x73, 0x4d, 0x26, 0x01, 0xdb, 0xfe,
-    0xba, 0x54, 0x50, 0x4e, 0x54, 0x94, 0x4a, 0x4e, 0x51, 0x4c, 0x00, 0x00, 0x01, 0x00, 0xb7, 0x00, 0x00, 0x04, 0x2a,
-    0x04, 0x3a, 0x00, 0x05, 0x00, 0x19, 0x40, 0x16, 0x00, 0x00, 0x00, 0x02, 0x59, 0x00, 0x02, 0x02, 0x18, 0x4b, 0x00,
-    0x01, 0x01, 0x17, 0x01, 0x4c, 0x11, 0x11, 0x10, 0x03, 0x06, 0x17, 0x2b, 0x01, 0x21, 0x11, 0x23, 0x11, 0x21, 0x04,
-    0x2a, 0xfd, 0x47, 0xba, 0x03, 0x73, 0x03, 0xa1, 0xfc, 0x5f, 0x04, 0x3a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x36, 0xfe,
-    0xc2, 0x04, 0x9a, 0x04, 0x3a, 0x00, 0x10, 0x00, 0x19, 0x00, 0x33, 0x40, 0x30, 0x04, 0x01, 0x02, 0x01, 0x02, 0x51,
-    0x00, 0x07, 0x07, 0x00, 0x59, 0x00, 0x00, 0x00, 0x18, 0x4b, 0x06, 0x08, 0x05, 0x03, 0x01, 0x01, 0x03, 0x59, 0x00,
-    0x03, 0x03, 0x17, 0x03, 0x4c, 0x00, 0x00, 0x19, 0x18, 0x17, 0x16, 0x00, 0x10, 0x00, 0x10, 0x11, 0x11, 0x11, 0x11,
-    0x16, 0x09, 0x06, 0x19, 0x2b, 0x37, 0x3e, 0x03, 0x37, 0x13, 0x21, 0x11, 0x33, 0x03, 0x23, 0x11, 0x21, 0x11, 0x23,
-    0x03, 0x01, 0x0e, 0x03, 0x07, 0x21, 0x11, 0x21, 0x9c, 0x2b, 0x3b, 0x26, 0x17, 0x07, 0x10, 0x02, 0xb9, 0x8b, 0x12,
-    0xa7, 0xfd, 0x0d, 0xa6, 0x12, 0x01, 0xc9, 0x05, 0x0f, 0x16, 0x21, 0x18, 0x01, 0xba, 0xfe, 0xb2, 0x97, 0x06, 0x4f,
-    0x88, 0xbc, 0x74, 0x01, 0x96, 0xfc, 0x5d, 0xfe, 0x2b, 0x01, 0x3e, 0xfe, 0xc2, 0x01, 0xd5, 0x02, 0x0d, 0x54, 0x98,
-    0x85, 0x70, 0x2c, 0x02, 0xf8, 0x00, 0x00, 0x01, 0x00, 0x11, 0x00, 0x00, 0x04, 0xac, 0x04, 0x3a, 0x00, 0x15, 0x00,
-    0x31, 0x40, 0x2e, 0x13, 0x08, 0x02, 0x00, 0x05, 0x01, 0x4a, 0x07, 0x01, 0x05, 0x02, 0x01, 0x00, 0x01, 0x05, 0x00,
-    0x61, 0x08, 0x06, 0x02, 0x04, 0x04, 0x18, 0x4b, 0x09, 0x03, 0x02, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x15, 0x14, 0x11,
-    0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x10, 0x0a, 0x06, 0x1d, 0x2b, 0x01, 0x23, 0x11, 0x23, 0x11, 0x23, 0x03,
-    0x23, 0x01, 0x01, 0x33, 0x13, 0x33, 0x11, 0x33, 0x11, 0x33, 0x13, 0x33, 0x01, 0x01, 0x23, 0x02, 0xf5, 0x3a, 0xb9,
-    0x3b, 0xd7, 0xdf, 0x01, 0x29, 0xfe, 0xfa, 0xd6, 0xbd, 0x3b, 0xb9, 0x3b, 0xbe, 0xd6, 0xfe, 0xf8, 0x01, 0x2a, 0xe0,
-    0x01, 0xd6, 0xfe, 0x2a, 0x01, 0xd6, 0xfe, 0x2a, 0x02, 0x33, 0x02, 0x07, 0xfe, 0x40, 0x01, 0xc0, 0xfe, 0x40, 0x01,
-    0xc0, 0xfd, 0xf9, 0xfd, 0xcd, 0x00, 0x01, 0x00, 0x87, 0xff, 0xed, 0x04, 0x4a, 0x04, 0x4d, 0x00, 0x3c, 0x00, 0x4e,
-    0x40, 0x4b, 0x1b, 0x01, 0x07, 0x00, 0x01, 0x4a, 0x00, 0x02, 0x01, 0x00, 0x01, 0x02, 0x00, 0x70, 0x00, 0x05, 0x07,
-    0x06, 0x07, 0x05, 0x06, 0x70, 0x08, 0x01, 0x00, 0x00, 0x07, 0x05, 0x00, 0x07, 0x63, 0x00, 0x01, 0x01, 0x03, 0x5b,
-    0x00, 0x03, 0x03, 0x1f, 0x4b, 0x00, 0x06, 0x06, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x1e, 0x04, 0x4c, 0x01, 0x00, 0x3b,
-    0x39, 0x31, 0x2f, 0x2b, 0x2a, 0x24, 0x22, 0x14, 0x12, 0x0e, 0x0d, 0x09, 0x07, 0x00, 0x3c, 0x01, 0x3c, 0x09, 0x06,
-    0x14, 0x2b, 0x01, 0x32, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x23, 0x3e, 0x03, 0x33, 0x32,
-    0x1e, 0x02, 0x15, 0x14, 0x06, 0x07, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x04, 0x35, 0x33, 0x14,
-    0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x23, 0x35, 0x02, 0x7c, 0x80, 0x80, 0x23, 0x43,
-    0x64, 0x41, 0x3a, 0x68, 0x4f, 0x2f, 0xb9, 0x01, 0x4d, 0x81, 0xab, 0x5f, 0x64, 0xa6, 0x78, 0x42, 0x6a, 0x5b, 0x67,
-    0x73, 0x49, 0x80, 0xac, 0x64, 0x3c, 0x77, 0x6c, 0x5e, 0x45, 0x28, 0xb9, 0x2e, 0x52, 0x70, 0x41, 0x40, 0x6a, 0x4b,
-    0x29, 0x26, 0x48, 0x66, 0x3f, 0xf1, 0x02, 0x76, 0x51, 0x4b, 0x22, 0x3c, 0x2d, 0x1a, 0x1a, 0x2d, 0x3f, 0x25, 0x4b,
-    0x77, 0x53, 0x2c, 0x28, 0x4f, 0x75, 0x4e, 0x4b, 0x79, 0x23, 0x1f, 0x7e, 0x5f, 0x4e, 0x78, 0x53, 0x2a, 0x11, 0x24,
-    0x37, 0x4b, 0x61, 0x3b, 0x27, 0x45, 0x35, 0x1f, 0x1b, 0x30, 0x40, 0x25, 0x2e, 0x41, 0x29, 0x12, 0x9c, 0x00, 0x01,
-    0x00, 0xa5, 0x00, 0x00, 0x04, 0x27, 0x04, 0x3a, 0x00, 0x09, 0x00, 0x1e, 0x40, 0x1b, 0x09, 0x04, 0x02, 0x01, 0x00,
-    0x01, 0x4a, 0x03, 0x01, 0x00, 0x00, 0x18, 0x4b, 0x02, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x11, 0x12, 0x11, 0x10,
-    0x04, 0x06, 0x18, 0x2b, 0x01, 0x33, 0x11, 0x23, 0x11, 0x01, 0x23, 0x11, 0x33, 0x11, 0x03, 0x6e, 0xb9, 0xb9, 0xfd,
-    0xef, 0xb8, 0xb8, 0x04, 0x3a, 0xfb, 0xc6, 0x03, 0x1e, 0xfc, 0xe2, 0x04, 0x3a, 0xfc, 0xe1, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0xa4, 0x00, 0x00, 0x04, 0x95, 0x04, 0x3a, 0x00, 0x0c, 0x00, 0x27, 0x40, 0x24, 0x0a, 0x01, 0x00, 0x03, 0x01,
-    0x4a, 0x00, 0x03, 0x00, 0x00, 0x01, 0x03, 0x00, 0x61, 0x04, 0x01, 0x02, 0x02, 0x18, 0x4b, 0x05, 0x01, 0x01, 0x01,
-    0x17, 0x01, 0x4c, 0x12, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x06, 0x1a, 0x2b, 0x01, 0x23, 0x11, 0x23, 0x11, 0x33,
-    0x11, 0x33, 0x01, 0x33, 0x01, 0x01, 0x23, 0x02, 0x0d, 0xb0, 0xb9, 0xb9, 0xa0, 0x01, 0x93, 0xe1, 0xfe, 0x30, 0x01,
-    0xf4, 0xeb, 0x01, 0xcd, 0xfe, 0x33, 0x04, 0x3a, 0xfe, 0x36, 0x01, 0xca, 0xfd, 0xf7, 0xfd, 0xcf, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x37, 0x00, 0x00, 0x04, 0x26, 0x04, 0x3a, 0x00, 0x13, 0x00, 0x27, 0x40, 0x24, 0x00, 0x01, 0x01, 0x04,
-    0x59, 0x05, 0x01, 0x04, 0x04, 0x18, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x02, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c,
-    0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x21, 0x25, 0x11, 0x11, 0x06, 0x06, 0x18, 0x2b, 0x01, 0x11, 0x23, 0x11, 0x21,
-    0x03, 0x14, 0x0e, 0x02, 0x23, 0x23, 0x37, 0x37, 0x32, 0x3e, 0x02, 0x35, 0x13, 0x04, 0x26, 0xba, 0xfe, 0x72, 0x01,
-    0x24, 0x54, 0x8e, 0x6a, 0x36, 0x03, 0x29, 0x39, 0x4b, 0x2b, 0x11, 0x02, 0x04, 0x3a, 0xfb, 0xc6, 0x03, 0xa1, 0xfe,
-    0xca, 0x94, 0xe6, 0x9e, 0x53, 0xa5, 0x01, 0x39, 0x71, 0xaa, 0x71, 0x01, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x89, 0x00, 0x00, 0x04, 0x29, 0x04, 0x3a, 0x00, 0x0c, 0x00, 0x20, 0x40, 0x1d, 0x08, 0x05, 0x02, 0x01, 0x00, 0x01,
-    0x4a, 0x04, 0x01, 0x00, 0x00, 0x18, 0x4b, 0x03, 0x02, 0x02, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x11, 0x12, 0x12, 0x11,
-    0x11, 0x05, 0x06, 0x19, 0x2b, 0x25, 0x13, 0x33, 0x11, 0x23, 0x11, 0x03, 0x23, 0x03, 0x11, 0x23, 0x11, 0x33, 0x02,
-    0x5c, 0xe6, 0xe7, 0xb9, 0xd4, 0x80, 0xda, 0xb9, 0xef, 0xf5, 0x03, 0x45, 0xfb, 0xc6, 0x02, 0x9b, 0xfd, 0x65, 0x02,
-    0xb3, 0xfd, 0x4d, 0x04, 0x3a, 0x00, 0x01, 0x00, 0xa5, 0x00, 0x00, 0x04, 0x27, 0x04, 0x3a, 0x00, 0x0b, 0x00, 0x21,
-    0x40, 0x1e, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x61, 0x05, 0x01, 0x03, 0x03, 0x18, 0x4b, 0x02, 0x01, 0x00,
-    0x00, 0x17, 0x00, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x06, 0x1a, 0x2b, 0x21, 0x23, 0x11, 0x21, 0x11,
-    0x23, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x04, 0x27, 0xb9, 0xfd, 0xf0, 0xb9, 0xb9, 0x02, 0x10, 0xb9, 0x01, 0xce,
-    0xfe, 0x32, 0x04, 0x3a, 0xfe, 0x2b, 0x01, 0xd5, 0x00, 0x00, 0x01, 0x00, 0xa5, 0x00, 0x00, 0x04, 0x27, 0x04, 0x3a,
-    0x00, 0x07, 0x00, 0x1b, 0x40, 0x18, 0x00, 0x01, 0x01, 0x03, 0x59, 0x00, 0x03, 0x03, 0x18, 0x4b, 0x02, 0x01, 0x00,
-    0x00, 0x17, 0x00, 0x4c, 0x11, 0x11, 0x11, 0x10, 0x04, 0x06, 0x18, 0x2b, 0x21, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11,
-    0x21, 0x04, 0x27, 0xb9, 0xfd, 0xf0, 0xb9, 0x03, 0x82, 0x03, 0xa1, 0xfc, 0x5f, 0x04, 0x3a, 0x00, 0x00, 0x01, 0x00,
-    0x68, 0x00, 0x00, 0x04, 0x7b, 0x04, 0x3a, 0x00, 0x07, 0x00, 0x1b, 0x40, 0x18, 0x02, 0x01, 0x00, 0x00, 0x03, 0x59,
-    0x00, 0x03, 0x03, 0x18, 0x4b, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x10, 0x04, 0x06, 0x18, 0x2b,
-    0x01, 0x21, 0x11, 0x23, 0x11, 0x21, 0x35, 0x21, 0x04, 0x7b, 0xfe, 0x50, 0xba, 0xfe, 0x57, 0x04, 0x13, 0x03, 0xa4,
-    0xfc, 0x5c, 0x03, 0xa4, 0x96, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x7a, 0xfe, 0x60, 0x04, 0x52, 0x06, 0x00, 0x00,
-    0x1b, 0x00, 0x27, 0x00, 0x33, 0x00, 0x20, 0x40, 0x1d, 0x2e, 0x2d, 0x22, 0x21, 0x16, 0x13, 0x08, 0x05, 0x08, 0x01,
-    0x00, 0x01, 0x4a, 0x00, 0x00, 0x01, 0x00, 0x72, 0x00, 0x01, 0x01, 0x1a, 0x01, 0x4c, 0x1d, 0x16, 0x02, 0x06, 0x16,
-    0x2b, 0x13, 0x34, 0x3e, 0x02, 0x37, 0x11, 0x33, 0x11, 0x1e, 0x03, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x11, 0x23,
-    0x11, 0x2e, 0x03, 0x35, 0x25, 0x34, 0x2e, 0x02, 0x27, 0x11, 0x3e, 0x03, 0x35, 0x21, 0x14, 0x1e, 0x02, 0x17, 0x11,
-    0x0e, 0x03, 0x15, 0x7a, 0x36, 0x67, 0x94, 0x5d, 0xb9, 0x5e, 0x95, 0x68, 0x36, 0x37, 0x67, 0x95, 0x5e, 0xb9, 0x5d,
-    0x94, 0x67, 0x36, 0x03, 0x1f, 0x1b, 0x36, 0x51, 0x36, 0x36, 0x51, 0x36, 0x1b, 0xfd, 0x9a, 0x1a, 0x35, 0x50, 0x36,
-    0x35, 0x50, 0x35, 0x1b, 0x02, 0x27, 0x68, 0xb8, 0x8f, 0x5f, 0x11, 0x01, 0xba, 0xfe, 0x46, 0x10, 0x60, 0x8f, 0xb8,
-    0x68, 0x16, 0x69, 0xb7, 0x8f, 0x5f, 0x0f, 0xfe, 0x6c, 0x01, 0x95, 0x10, 0x5f, 0x8e, 0xb7, 0x68, 0x16, 0x42, 0x7c,
-    0x66, 0x4a, 0x12, 0xfc, 0xe8, 0x12, 0x4a, 0x66, 0x7c, 0x44, 0x43, 0x7b, 0x66, 0x4a, 0x12, 0x03, 0x16, 0x12, 0x4b,
-    0x66, 0x7b, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xaa, 0xfe, 0xbf, 0x04, 0x90, 0x04, 0x3a, 0x00, 0x0b, 0x00,
-    0x23, 0x40, 0x20, 0x00, 0x04, 0x01, 0x04, 0x52, 0x02, 0x01, 0x00, 0x00, 0x18, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x05,
-    0x5a, 0x00, 0x05, 0x05, 0x17, 0x05, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x06, 0x1a, 0x2b, 0x13, 0x33,
-    0x11, 0x21, 0x11, 0x33, 0x11, 0x33, 0x03, 0x23, 0x11, 0x21, 0xaa, 0xb9, 0x01, 0xf2, 0xba, 0x81, 0x12, 0xa6, 0xfc,
-    0xd2, 0x04, 0x3a, 0xfc, 0x5d, 0x03, 0xa3, 0xfc, 0x5d, 0xfe, 0x28, 0x01, 0x41, 0x00, 0x00, 0x01, 0x00, 0x8d, 0x00,
-    0x00, 0x04, 0x27, 0x04, 0x3a, 0x00, 0x15, 0x00, 0x29, 0x40, 0x26, 0x13, 0x01, 0x03, 0x02, 0x02, 0x01, 0x01, 0x03,
-    0x02, 0x4a, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x01, 0x63, 0x04, 0x01, 0x02, 0x02, 0x18, 0x4b, 0x00, 0x00, 0x00,
-    0x17, 0x00, 0x4c, 0x13, 0x23, 0x15, 0x23, 0x10, 0x05, 0x06, 0x19, 0x2b, 0x21, 0x23, 0x11, 0x06, 0x06, 0x23, 0x22,
-    0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x11, 0x33, 0x04, 0x27, 0xb9, 0x44, 0x91,
-    0x55, 0x64, 0xa2, 0x73, 0x3e, 0xb9, 0x01, 0x83, 0x7a, 0x51, 0x94, 0x45, 0xb9, 0x01, 0x8b, 0x11, 0x12, 0x32, 0x65,
-    0x99, 0x67, 0x01, 0x3b, 0xfe, 0xc5, 0x85, 0x7a, 0x12, 0x11, 0x02, 0x17, 0x00, 0x01, 0x00, 0x81, 0x00, 0x00, 0x04,
-    0x4c, 0x04, 0x3a, 0x00, 0x0b, 0x00, 0x25, 0x40, 0x22, 0x06, 0x05, 0x03, 0x03, 0x01, 0x01, 0x18, 0x4b, 0x02, 0x01,
-    0x00, 0x00, 0x04, 0x5a, 0x00, 0x04, 0x04, 0x17, 0x04, 0x4c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0b, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x07, 0x06, 0x19, 0x2b, 0x01, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x21, 0x11, 0x01,
-    0x3a, 0xd0, 0xb9, 0xd0, 0xb9, 0xfc, 0x35, 0x04, 0x3a, 0xfc, 0x5d, 0x03, 0xa3, 0xfc, 0x5d, 0x03, 0xa3, 0xfb, 0xc6,
-    0x04, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x76, 0xfe, 0xbf, 0x04, 0x98, 0x04, 0x3a, 0x00, 0x11, 0x00, 0x2d,
-    0x40, 0x2a, 0x00, 0x05, 0x00, 0x05, 0x52, 0x08, 0x07, 0x03, 0x03, 0x01, 0x01, 0x18, 0x4b, 0x04, 0x02, 0x02, 0x00,
-    0x00, 0x06, 0x5a, 0x00, 0x06, 0x06, 0x17, 0x06, 0x4c, 0x00, 0x00, 0x00, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x31, 0x11, 0x11, 0x09, 0x06, 0x1b, 0x2b, 0x01, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x35, 0x33, 0x11, 0x33, 0x11,
-    0x33, 0x03, 0x23, 0x11, 0x21, 0x11, 0x01, 0x2f, 0xd0, 0xb9, 0x9a, 0x36, 0xb9, 0x57, 0x12, 0xa5, 0xfc, 0x95, 0x04,
-    0x3a, 0xfc, 0x5d, 0x03, 0xa3, 0xfc, 0x5d, 0x01, 0x03, 0xa2, 0xfc, 0x5e, 0xfe, 0x27, 0x01, 0x41, 0x04, 0x3a, 0x00,
-    0x02, 0x00, 0x39, 0x00, 0x00, 0x04, 0x77, 0x04, 0x3a, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x2f, 0x40, 0x2c, 0x00, 0x01,
-    0x06, 0x01, 0x05, 0x04, 0x01, 0x05, 0x63, 0x00, 0x03, 0x03, 0x00, 0x59, 0x00, 0x00, 0x00, 0x18, 0x4b, 0x00, 0x04,
-    0x04, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x11, 0x11, 0x11, 0x1d, 0x11, 0x1c, 0x22, 0x11, 0x28, 0x21,
-    0x10, 0x07, 0x06, 0x19, 0x2b, 0x13, 0x21, 0x11, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11,
-    0x21, 0x01, 0x11, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x39, 0x01, 0xe5, 0xc8, 0x60, 0x96, 0x66,
-    0x35, 0x35, 0x66, 0x96, 0x60, 0xfe, 0x7f, 0xfe, 0xd4, 0x01, 0xe5, 0xc8, 0x3a, 0x51, 0x34, 0x18, 0x18, 0x34, 0x52,
-    0x39, 0x04, 0x3a, 0xfe, 0x66, 0x32, 0x58, 0x7a, 0x48, 0x48, 0x7c, 0x5b, 0x35, 0x03, 0xa2, 0xfe, 0x67, 0xfe, 0x8e,
-    0x1e, 0x33, 0x42, 0x23, 0x22, 0x43, 0x35, 0x22, 0x00, 0x00, 0x00, 0x03, 0x00, 0x90, 0x00, 0x00, 0x04, 0x3f, 0x04,
-    0x3a, 0x00, 0x0e, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x2d, 0x40, 0x2a, 0x00, 0x00, 0x07, 0x01, 0x06, 0x05, 0x00, 0x06,
-    0x63, 0x04, 0x01, 0x02, 0x02, 0x18, 0x4b, 0x00, 0x05, 0x05, 0x01, 0x5c, 0x03, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4c,
-    0x13, 0x13, 0x13, 0x1f, 0x13, 0x1e, 0x22, 0x11, 0x11, 0x11, 0x28, 0x20, 0x08, 0x06, 0x1a, 0x2b, 0x01, 0x33, 0x32,
-    0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x33, 0x01, 0x23, 0x11, 0x33, 0x01, 0x11, 0x33, 0x32, 0x3e,
-    0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x01, 0x49, 0x63, 0x57, 0x87, 0x5b, 0x2f, 0x2f, 0x5b, 0x86, 0x58, 0xfe, 0xe4,
-    0xb9, 0x02, 0xf6, 0xb9, 0xb9, 0xfd, 0x0a, 0x63, 0x2f, 0x42, 0x29, 0x13, 0x13, 0x29, 0x42, 0x2f, 0x02, 0xa0, 0x32,
-    0x59, 0x7a, 0x47, 0x47, 0x7c, 0x5c, 0x35, 0x04, 0x3a, 0xfb, 0xc6, 0x04, 0x3a, 0xfd, 0xcf, 0xfe, 0x8e, 0x1f, 0x33,
-    0x41, 0x23, 0x21, 0x43, 0x36, 0x22, 0x00, 0x02, 0x00, 0xa5, 0x00, 0x00, 0x04, 0x40, 0x04, 0x3a, 0x00, 0x0e, 0x00,
-    0x1b, 0x00, 0x29, 0x40, 0x26, 0x00, 0x00, 0x05, 0x01, 0x04, 0x03, 0x00, 0x04, 0x63, 0x00, 0x02, 0x02, 0x18, 0x4b,
-    0x00, 0x03, 0x03, 0x01, 0x5c, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x0f, 0x0f, 0x0f, 0x1b, 0x0f, 0x1a, 0x22, 0x11,
-    0x28, 0x20, 0x06, 0x06, 0x18, 0x2b, 0x01, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x33,
-    0x11, 0x11, 0x21, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x01, 0x5e, 0x01, 0x4b, 0x61, 0x97, 0x68, 0x37,
-    0x36, 0x68, 0x98, 0x61, 0xfd, 0xfc, 0xb9, 0x01, 0x4b, 0x3a, 0x54, 0x36, 0x19, 0x1a, 0x36, 0x53, 0x3a, 0x02, 0xa0,
-    0x31, 0x58, 0x7a, 0x49, 0x48, 0x7d, 0x5b, 0x34, 0x04, 0x3a, 0xfd, 0xcf, 0xfe, 0x8e, 0x1e, 0x32, 0x42, 0x24, 0x23,
-    0x43, 0x35, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x81, 0xff, 0xec, 0x04, 0x3a, 0x04, 0x4e, 0x00, 0x2d, 0x00, 0x48,
-    0x40, 0x45, 0x00, 0x01, 0x00, 0x07, 0x00, 0x01, 0x07, 0x70, 0x00, 0x04, 0x06, 0x05, 0x06, 0x04, 0x05, 0x70, 0x00,
-    0x07, 0x00, 0x06, 0x04, 0x07, 0x06, 0x61, 0x08, 0x01, 0x00, 0x00, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x1f, 0x4b, 0x00,
-    0x05, 0x05, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x1e, 0x03, 0x4c, 0x01, 0x00, 0x29, 0x28, 0x27, 0x26, 0x22, 0x20, 0x1c,
-    0x1b, 0x17, 0x15, 0x0c, 0x0a, 0x06, 0x05, 0x00, 0x2d, 0x01, 0x2d, 0x09, 0x06, 0x14, 0x2b, 0x01, 0x22, 0x0e, 0x02,
-    0x15, 0x23, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35,
-    0x33, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x21, 0x35, 0x21, 0x2e, 0x03, 0x02, 0x3c, 0x32, 0x60, 0x4b,
-    0x2e, 0xb0, 0x4a, 0x7b, 0xa0, 0x56, 0x7f, 0xc0, 0x7f, 0x40, 0x40, 0x80, 0xbf, 0x7f, 0x60, 0xa2, 0x76, 0x43, 0xb0,
-    0x2a, 0x48, 0x61, 0x38, 0x54, 0x76, 0x4d, 0x27, 0x05, 0xfe, 0x53, 0x01, 0xab, 0x06, 0x2a, 0x4c, 0x74, 0x03, 0xb6,
-    0x20, 0x39, 0x4d, 0x2e, 0x49, 0x84, 0x64, 0x3b, 0x58, 0x94, 0xc4, 0x6c, 0x2a, 0x6c, 0xc4, 0x95, 0x57, 0x3c, 0x69,
-    0x8f, 0x53, 0x32, 0x58, 0x41, 0x26, 0x3b, 0x61, 0x7c, 0x41, 0x98, 0x3f, 0x74, 0x5a, 0x36, 0x00, 0x02, 0x00, 0x71,
-    0xff, 0xec, 0x04, 0x81, 0x04, 0x4e, 0x00, 0x1b, 0x00, 0x31, 0x00, 0x5f, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x1f,
-    0x00, 0x00, 0x00, 0x03, 0x06, 0x00, 0x03, 0x61, 0x00, 0x07, 0x07, 0x01, 0x5b, 0x05, 0x01, 0x01, 0x01, 0x1f, 0x4b,
-    0x00, 0x06, 0x06, 0x02, 0x5b, 0x04, 0x01, 0x02, 0x02, 0x1e, 0x02, 0x4c, 0x1b, 0x40, 0x27, 0x00, 0x00, 0x00, 0x03,
-    0x06, 0x00, 0x03, 0x61, 0x00, 0x05, 0x05, 0x18, 0x4b, 0x00, 0x07, 0x07, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x1f, 0x4b,
-    0x00, 0x04, 0x04, 0x17, 0x4b, 0x00, 0x06, 0x06, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x1e, 0x02, 0x4c, 0x59, 0x40, 0x0b,
-    0x29, 0x25, 0x11, 0x11, 0x14, 0x29, 0x24, 0x10, 0x08, 0x06, 0x1c, 0x2b, 0x01, 0x33, 0x3e, 0x03, 0x33, 0x32, 0x1e,
-    0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x23, 0x11, 0x23, 0x11, 0x33, 0x01, 0x14, 0x1e,
-    0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x01, 0x2a, 0x82, 0x07,
-    0x32, 0x5a, 0x80, 0x55, 0x5d, 0x8a, 0x5a, 0x2c, 0x2c, 0x59, 0x89, 0x5d, 0x57, 0x83, 0x5a, 0x31, 0x06, 0x81, 0xb9,
-    0xb9, 0x01, 0x3a, 0x10, 0x29, 0x44, 0x35, 0x34, 0x45, 0x28, 0x11, 0x11, 0x29, 0x45, 0x35, 0x34, 0x44, 0x28, 0x10,
-    0x02, 0x6f, 0x66, 0xaf, 0x81, 0x49, 0x56, 0x96, 0xc9, 0x72, 0x16, 0x72, 0xc9, 0x94, 0x56, 0x4b, 0x84, 0xb4, 0x68,
-    0xfe, 0x29, 0x04, 0x3a, 0xfd, 0xd7, 0x4e, 0x91, 0x6e, 0x42, 0x42, 0x6e, 0x91, 0x4e, 0x16, 0x4e, 0x90, 0x6f, 0x42,
-    0x42, 0x6f, 0x90, 0x4e, 0x00, 0x02, 0x00, 0x4f, 0x00, 0x00, 0x04, 0x21, 0x04, 0x3a, 0x00, 0x0f, 0x00, 0x1c, 0x00,
-    0x33, 0x40, 0x30, 0x07, 0x01, 0x01, 0x04, 0x01, 0x4a, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x61, 0x00, 0x05,
-    0x05, 0x03, 0x5b, 0x06, 0x01, 0x03, 0x03, 0x18, 0x4b, 0x02, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x00, 0x00, 0x19,
-    0x17, 0x16, 0x14, 0x00, 0x0f, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x07, 0x06, 0x17, 0x2b, 0x01, 0x11, 0x23, 0x11, 0x21,
-    0x01, 0x23, 0x01, 0x26, 0x26, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x03, 0x14, 0x1e, 0x02, 0x33, 0x21, 0x11, 0x21, 0x22,
-    0x0e, 0x02, 0x04, 0x21, 0xb9, 0xfe, 0xb0, 0xfe, 0xff, 0xc8, 0x01, 0x11, 0x68, 0x70, 0x39, 0x6a, 0x9a, 0x60, 0xe3,
-    0x18, 0x33, 0x4c, 0x35, 0x01, 0x5a, 0xfe, 0xbd, 0x39, 0x56, 0x38, 0x1c, 0x04, 0x3a, 0xfb, 0xc6, 0x01, 0xa5, 0xfe,
-    0x5b, 0x01, 0xc1, 0x26, 0x9f, 0x6a, 0x48, 0x79, 0x57, 0x32, 0xfe, 0xb4, 0x22, 0x40, 0x31, 0x1e, 0x01, 0x67, 0x1f,
-    0x33, 0x41, 0x00, 0x00, 0x00, 0x01, 0xff, 0xe9, 0xfe, 0x4b, 0x04, 0x25, 0x06, 0x00, 0x00, 0x2f, 0x00, 0x49, 0x40,
-    0x46, 0x25, 0x02, 0x02, 0x05, 0x04, 0x14, 0x01, 0x03, 0x05, 0x13, 0x01, 0x02, 0x03, 0x03, 0x4a, 0x09, 0x01, 0x07,
-    0x06, 0x01, 0x00, 0x01, 0x07, 0x00, 0x61, 0x00, 0x04, 0x04, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x1f, 0x4b, 0x00, 0x08,
-    0x08, 0x05, 0x59, 0x00, 0x05, 0x05, 0x17, 0x4b, 0x00, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x21, 0x02, 0x4c,
-    0x2f, 0x2e, 0x11, 0x11, 0x11, 0x13, 0x27, 0x27, 0x29, 0x23, 0x10, 0x0a, 0x06, 0x1d, 0x2b, 0x01, 0x21, 0x11, 0x36,
-    0x36, 0x37, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x33, 0x11, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x1e, 0x03, 0x33,
-    0x32, 0x36, 0x35, 0x35, 0x23, 0x11, 0x34, 0x26, 0x07, 0x22, 0x06, 0x07, 0x11, 0x23, 0x11, 0x23, 0x35, 0x33, 0x35,
-    0x33, 0x15, 0x21, 0x02, 0x66, 0xfe, 0xf9, 0x3a, 0xaa, 0x6a, 0x55, 0x8b, 0x62, 0x35, 0x01, 0xa9, 0x9a, 0x20, 0x36,
-    0x1e, 0x0f, 0x08, 0x1c, 0x1e, 0x1b, 0x08, 0x42, 0x48, 0x01, 0x7f, 0x76, 0x59, 0x91, 0x2d, 0xb9, 0xbd, 0xbd, 0xb9,
-    0x01, 0x07, 0x04, 0xb9, 0xfe, 0xe0, 0x55, 0x5f, 0x01, 0x31, 0x68, 0x9f, 0x6d, 0xe3, 0xfd, 0xe1, 0xa8, 0xb4, 0x07,
-    0x0a, 0x94, 0x03, 0x05, 0x03, 0x02, 0x69, 0x5b, 0x59, 0x02, 0xab, 0x85, 0x82, 0x01, 0x57, 0x48, 0xfc, 0xee, 0x04,
-    0xb9, 0x97, 0xb0, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x8f, 0xff, 0xec, 0x04, 0x33, 0x04, 0x4e, 0x00, 0x2d,
-    0x00, 0x48, 0x40, 0x45, 0x00, 0x04, 0x05, 0x06, 0x05, 0x04, 0x06, 0x70, 0x00, 0x01, 0x07, 0x00, 0x07, 0x01, 0x00,
-    0x70, 0x00, 0x06, 0x00, 0x07, 0x01, 0x06, 0x07, 0x61, 0x00, 0x05, 0x05, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x1f, 0x4b,
-    0x08, 0x01, 0x00, 0x00, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x1e, 0x02, 0x4c, 0x01, 0x00, 0x29, 0x28, 0x27, 0x26, 0x22,
-    0x20, 0x1c, 0x1b, 0x17, 0x15, 0x0c, 0x0a, 0x06, 0x05, 0x00, 0x2d, 0x01, 0x2d, 0x09, 0x06, 0x14, 0x2b, 0x25, 0x32,
-    0x3e, 0x02, 0x37, 0x33, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02,
-    0x15, 0x23, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x21, 0x15, 0x21, 0x1e, 0x03, 0x02, 0x7b, 0x32, 0x5f, 0x4a,
-    0x2d, 0x01, 0xaf, 0x01, 0x49, 0x7a, 0x9e, 0x56, 0x7b, 0xb8, 0x7b, 0x3e, 0x3e, 0x7b, 0xb8, 0x7b, 0x60, 0xa1, 0x75,
-    0x42, 0xaf, 0x01, 0x29, 0x46, 0x61, 0x38, 0x4e, 0x6e, 0x49, 0x26, 0x05, 0x01, 0x9a, 0xfe, 0x66, 0x05, 0x26, 0x48,
-    0x6f, 0x82, 0x20, 0x39, 0x4d, 0x2d, 0x48, 0x83, 0x63, 0x3b, 0x58, 0x95, 0xc3, 0x6c, 0x2a, 0x6b, 0xc4, 0x95, 0x58,
-    0x3d, 0x69, 0x90, 0x52, 0x31, 0x57, 0x42, 0x26, 0x39, 0x5d, 0x79, 0x3f, 0x98, 0x40, 0x79, 0x5d, 0x38, 0x00, 0x02,
-    0x00, 0x26, 0x00, 0x00, 0x04, 0xb0, 0x04, 0x3a, 0x00, 0x1e, 0x00, 0x2b, 0x00, 0x3a, 0x40, 0x37, 0x00, 0x00, 0x09,
-    0x01, 0x07, 0x04, 0x00, 0x07, 0x63, 0x00, 0x02, 0x02, 0x05, 0x59, 0x08, 0x01, 0x05, 0x05, 0x18, 0x4b, 0x06, 0x01,
-    0x04, 0x04, 0x01, 0x5b, 0x03, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x2b, 0x1f, 0x2a,
-    0x22, 0x20, 0x00, 0x1e, 0x00, 0x1e, 0x21, 0x25, 0x11, 0x28, 0x21, 0x0a, 0x06, 0x19, 0x2b, 0x01, 0x11, 0x33, 0x32,
-    0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x23, 0x11, 0x23, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x23, 0x37, 0x37, 0x32,
-    0x3e, 0x02, 0x35, 0x11, 0x01, 0x11, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x03, 0x08, 0x42, 0x57,
-    0x86, 0x5a, 0x2f, 0x2f, 0x5a, 0x86, 0x57, 0xfb, 0xc2, 0x1f, 0x49, 0x78, 0x5a, 0x2d, 0x04, 0x1e, 0x29, 0x36, 0x20,
-    0x0d, 0x02, 0x34, 0x42, 0x2f, 0x41, 0x29, 0x12, 0x12, 0x29, 0x41, 0x2f, 0x04, 0x3a, 0xfe, 0x64, 0x32, 0x59, 0x79,
-    0x48, 0x47, 0x7b, 0x5b, 0x35, 0x03, 0xa1, 0xfe, 0xca, 0x92, 0xe6, 0x9f, 0x54, 0x9b, 0x01, 0x3d, 0x76, 0xac, 0x70,
-    0x01, 0xcf, 0xfd, 0xcc, 0xfe, 0x8f, 0x23, 0x36, 0x44, 0x22, 0x21, 0x40, 0x32, 0x1f, 0x00, 0x00, 0x02, 0x00, 0x82,
-    0x00, 0x00, 0x04, 0x92, 0x04, 0x3a, 0x00, 0x16, 0x00, 0x23, 0x00, 0x31, 0x40, 0x2e, 0x02, 0x01, 0x00, 0x09, 0x08,
-    0x02, 0x04, 0x07, 0x00, 0x04, 0x63, 0x06, 0x01, 0x01, 0x01, 0x18, 0x4b, 0x00, 0x07, 0x07, 0x03, 0x5c, 0x05, 0x01,
-    0x03, 0x03, 0x17, 0x03, 0x4c, 0x17, 0x17, 0x17, 0x23, 0x17, 0x22, 0x22, 0x11, 0x11, 0x11, 0x28, 0x21, 0x11, 0x10,
-    0x0a, 0x06, 0x1c, 0x2b, 0x01, 0x33, 0x11, 0x33, 0x11, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21,
-    0x11, 0x23, 0x11, 0x23, 0x11, 0x33, 0x01, 0x11, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x01, 0x3b,
-    0xf9, 0xb9, 0x53, 0x52, 0x7f, 0x55, 0x2c, 0x2c, 0x55, 0x7f, 0x52, 0xfe, 0xf4, 0xf9, 0xb9, 0xb9, 0x01, 0xb2, 0x53,
-    0x2a, 0x3a, 0x24, 0x10, 0x10, 0x24, 0x3a, 0x2a, 0x02, 0xa1, 0x01, 0x99, 0xfe, 0x63, 0x32, 0x59, 0x79, 0x47, 0x47,
-    0x7b, 0x5b, 0x35, 0x02, 0x0a, 0xfd, 0xf6, 0x04, 0x3a, 0xfd, 0xcc, 0xfe, 0x8f, 0x23, 0x36, 0x44, 0x22, 0x21, 0x40,
-    0x32, 0x1f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x04, 0x2b, 0x06, 0x00, 0x00, 0x1d, 0x00, 0x36, 0x40,
-    0x33, 0x13, 0x02, 0x02, 0x02, 0x03, 0x01, 0x4a, 0x08, 0x01, 0x06, 0x05, 0x01, 0x00, 0x01, 0x06, 0x00, 0x61, 0x00,
-    0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x1f, 0x4b, 0x00, 0x07, 0x07, 0x02, 0x59, 0x04, 0x01, 0x02, 0x02, 0x17,
-    0x02, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x13, 0x23, 0x15, 0x23, 0x10, 0x09, 0x06, 0x1d, 0x2b, 0x01, 0x21, 0x11, 0x36,
-    0x36, 0x37, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x07, 0x22, 0x06, 0x07, 0x11, 0x23, 0x11, 0x23,
-    0x35, 0x33, 0x35, 0x33, 0x15, 0x21, 0x02, 0x99, 0xfe, 0xcd, 0x3a, 0xaa, 0x6a, 0x55, 0x8b, 0x62, 0x35, 0xb9, 0x7f,
-    0x76, 0x59, 0x91, 0x2d, 0xb9, 0x91, 0x91, 0xb9, 0x01, 0x33, 0x04, 0xbe, 0xfe, 0xdb, 0x55, 0x5f, 0x01, 0x31, 0x68,
-    0x9f, 0x6d, 0xfd, 0x57, 0x02, 0xab, 0x85, 0x82, 0x01, 0x57, 0x48, 0xfc, 0xee, 0x04, 0xbe, 0x97, 0xab, 0xab, 0x00,
-    0x00, 0x01, 0x00, 0xa5, 0xfe, 0x9c, 0x04, 0x27, 0x04, 0x3a, 0x00, 0x0b, 0x00, 0x29, 0x40, 0x26, 0x00, 0x03, 0x02,
-    0x03, 0x73, 0x06, 0x05, 0x02, 0x01, 0x01, 0x18, 0x4b, 0x00, 0x00, 0x00, 0x02, 0x5a, 0x04, 0x01, 0x02, 0x02, 0x17,
-    0x02, 0x4c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x07, 0x06, 0x19, 0x2b, 0x01, 0x11,
-    0x21, 0x11, 0x33, 0x11, 0x21, 0x11, 0x23, 0x11, 0x21, 0x11, 0x01, 0x5e, 0x02, 0x10, 0xb9, 0xfe, 0x9e, 0xb9, 0xfe,
-    0x99, 0x04, 0x3a, 0xfc, 0x5d, 0x03, 0xa3, 0xfb, 0xc6, 0xfe, 0x9c, 0x01, 0x64, 0x04, 0x3a, 0x00, 0x00, 0x01, 0x00,
-    0x6b, 0xff, 0xec, 0x04, 0x7f, 0x05, 0xb0, 0x00, 0x24, 0x00, 0x2d, 0x40, 0x2a, 0x09, 0x01, 0x00, 0x03, 0x01, 0x4a,
-    0x07, 0x06, 0x04, 0x03, 0x02, 0x02, 0x16, 0x4b, 0x05, 0x01, 0x03, 0x03, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x1e,
-    0x00, 0x4c, 0x00, 0x00, 0x00, 0x24, 0x00, 0x24, 0x23, 0x13, 0x23, 0x15, 0x24, 0x25, 0x08, 0x06, 0x1a, 0x2b, 0x01,
-    0x13, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x13, 0x33, 0x13, 0x14,
-    0x16, 0x33, 0x32, 0x36, 0x35, 0x13, 0x33, 0x11, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x13, 0x04, 0x7e, 0x01, 0x2b,
-    0x4e, 0x6d, 0x42, 0x4e, 0x74, 0x20, 0x20, 0x74, 0x4d, 0x43, 0x6d, 0x4e, 0x2b, 0x01, 0xb8, 0x01, 0x3b, 0x34, 0x3c,
-    0x45, 0x01, 0xbf, 0x45, 0x3d, 0x34, 0x3a, 0x01, 0x05, 0xb0, 0xfb, 0x8e, 0x52, 0x7e, 0x56, 0x2c, 0x4a, 0x49, 0x48,
-    0x4b, 0x2c, 0x56, 0x7e, 0x52, 0x04, 0x72, 0xfb, 0x8e, 0x58, 0x64, 0x64, 0x58, 0x04, 0x72, 0xfb, 0x8e, 0x58, 0x64,
-    0x64, 0x58, 0x04, 0x72, 0x00, 0x00, 0x01, 0x00, 0x5f, 0xff, 0xeb, 0x04, 0x7a, 0x04, 0x3b, 0x00, 0x24, 0x00, 0x2d,
-    0x40, 0x2a, 0x09, 0x01, 0x00, 0x03, 0x01, 0x4a, 0x07, 0x06, 0x04, 0x03, 0x02, 0x02, 0x18, 0x4b, 0x05, 0x01, 0x03,
-    0x03, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x24, 0x00, 0x24, 0x23, 0x13, 0x23,
-    0x15, 0x24, 0x25, 0x08, 0x06, 0x1a, 0x2b, 0x01, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x06, 0x06, 0x23,
-    0x22, 0x2e, 0x02, 0x35, 0x13, 0x33, 0x11, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x11, 0x33, 0x13, 0x14, 0x16, 0x33,
-    0x32, 0x36, 0x35, 0x11, 0x04, 0x7a, 0x2b, 0x4f, 0x6e, 0x42, 0x4e, 0x75, 0x21, 0x20, 0x74, 0x4e, 0x43, 0x6e, 0x4e,
-    0x2c, 0x01, 0xb9, 0x3c, 0x35, 0x3c, 0x47, 0xbf, 0x01, 0x46, 0x3d, 0x34, 0x3d, 0x04, 0x3b, 0xfd, 0x01, 0x52, 0x7e,
-    0x55, 0x2c, 0x4a, 0x49, 0x48, 0x4b, 0x2c, 0x55, 0x7e, 0x52, 0x02, 0xff, 0xfd, 0x01, 0x58, 0x62, 0x62, 0x58, 0x02,
-    0xff, 0xfd, 0x01, 0x58, 0x62, 0x62, 0x58, 0x02, 0xff, 0x00, 0x02, 0x00, 0x1c, 0x00, 0x00, 0x04, 0x3c, 0x06, 0x18,
-    0x00, 0x16, 0x00, 0x23, 0x00, 0x37, 0x40, 0x34, 0x00, 0x05, 0x04, 0x05, 0x72, 0x06, 0x01, 0x04, 0x03, 0x01, 0x00,
-    0x01, 0x04, 0x00, 0x61, 0x00, 0x01, 0x09, 0x01, 0x08, 0x07, 0x01, 0x08, 0x63, 0x00, 0x07, 0x07, 0x02, 0x5c, 0x00,
-    0x02, 0x02, 0x17, 0x02, 0x4c, 0x17, 0x17, 0x17, 0x23, 0x17, 0x22, 0x22, 0x11, 0x11, 0x11, 0x11, 0x28, 0x21, 0x10,
-    0x0a, 0x06, 0x1c, 0x2b, 0x01, 0x21, 0x11, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x23,
-    0x35, 0x33, 0x11, 0x33, 0x11, 0x21, 0x01, 0x11, 0x21, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x02, 0xd7,
-    0xfe, 0xbe, 0x01, 0x13, 0x61, 0x96, 0x67, 0x36, 0x36, 0x67, 0x96, 0x61, 0xfe, 0x34, 0xc0, 0xc0, 0xb9, 0x01, 0x42,
-    0xfe, 0xbe, 0x01, 0x13, 0x3a, 0x52, 0x35, 0x19, 0x19, 0x35, 0x52, 0x3a, 0x04, 0x34, 0xfe, 0x6c, 0x31, 0x59, 0x7a,
-    0x48, 0x48, 0x7c, 0x5c, 0x34, 0x04, 0x34, 0x98, 0x01, 0x4c, 0xfe, 0xb4, 0xfd, 0x3d, 0xfe, 0x8e, 0x1e, 0x33, 0x41,
-    0x24, 0x22, 0x44, 0x35, 0x21, 0x00, 0x00, 0x01, 0x00, 0x7d, 0xff, 0xed, 0x04, 0x94, 0x05, 0xc5, 0x00, 0x37, 0x00,
-    0xc8, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x31, 0x00, 0x02, 0x03, 0x00, 0x03, 0x02, 0x00, 0x70, 0x00, 0x07, 0x05,
-    0x06, 0x05, 0x07, 0x06, 0x70, 0x04, 0x01, 0x00, 0x09, 0x01, 0x05, 0x07, 0x00, 0x05, 0x61, 0x00, 0x03, 0x03, 0x01,
-    0x5b, 0x0b, 0x01, 0x01, 0x01, 0x1d, 0x4b, 0x00, 0x06, 0x06, 0x08, 0x5b, 0x0a, 0x01, 0x08, 0x08, 0x1e, 0x08, 0x4c,
-    0x1b, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x35, 0x00, 0x02, 0x03, 0x00, 0x03, 0x02, 0x00, 0x70, 0x00, 0x07, 0x05,
-    0x06, 0x05, 0x07, 0x06, 0x70, 0x04, 0x01, 0x00, 0x09, 0x01, 0x05, 0x07, 0x00, 0x05, 0x61, 0x00, 0x0b, 0x0b, 0x16,
-    0x4b, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x1d, 0x4b, 0x00, 0x06, 0x06, 0x08, 0x5b, 0x0a, 0x01, 0x08,
-    0x08, 0x1e, 0x08, 0x4c, 0x1b, 0x40, 0x39, 0x00, 0x02, 0x03, 0x00, 0x03, 0x02, 0x00, 0x70, 0x00, 0x07, 0x05, 0x06,
-    0x05, 0x07, 0x06, 0x70, 0x04, 0x01, 0x00, 0x09, 0x01, 0x05, 0x07, 0x00, 0x05, 0x61, 0x00, 0x0b, 0x0b, 0x16, 0x4b,
-    0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x1d, 0x4b, 0x00, 0x0a, 0x0a, 0x17, 0x4b, 0x00, 0x06, 0x06, 0x08,
-    0x5b, 0x00, 0x08, 0x08, 0x1e, 0x08, 0x4c, 0x59, 0x59, 0x40, 0x12, 0x37, 0x36, 0x35, 0x34, 0x33, 0x32, 0x24, 0x14,
-    0x25, 0x11, 0x15, 0x24, 0x14, 0x25, 0x10, 0x0c, 0x06, 0x1d, 0x2b, 0x01, 0x33, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32,
-    0x1e, 0x02, 0x17, 0x23, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x21, 0x15, 0x21, 0x15, 0x14, 0x1e, 0x02,
-    0x33, 0x32, 0x3e, 0x02, 0x37, 0x33, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x23, 0x11, 0x23, 0x11, 0x33,
-    0x01, 0x35, 0x96, 0x32, 0x5f, 0x89, 0x57, 0x51, 0x7a, 0x55, 0x31, 0x07, 0xa7, 0x05, 0x18, 0x2a, 0x3e, 0x2c, 0x2f,
-    0x45, 0x2d, 0x17, 0x01, 0x1a, 0xfe, 0xe6, 0x17, 0x2d, 0x45, 0x2f, 0x2c, 0x3e, 0x2a, 0x17, 0x06, 0xa7, 0x07, 0x31,
-    0x55, 0x7a, 0x51, 0x57, 0x89, 0x5f, 0x32, 0x96, 0xb8, 0xb8, 0x03, 0x40, 0x63, 0x81, 0xcb, 0x8c, 0x4a, 0x3b, 0x6d,
-    0x9c, 0x60, 0x3d, 0x63, 0x47, 0x26, 0x36, 0x65, 0x92, 0x5c, 0x65, 0x97, 0x9b, 0x5d, 0x93, 0x65, 0x36, 0x24, 0x43,
-    0x61, 0x3e, 0x58, 0x97, 0x6f, 0x3e, 0x4a, 0x8b, 0xcb, 0x81, 0x9b, 0xfd, 0x57, 0x05, 0xb0, 0x00, 0x00, 0x01, 0x00,
-    0x9b, 0xff, 0xec, 0x04, 0x89, 0x04, 0x4e, 0x00, 0x33, 0x00, 0x8a, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x31, 0x00,
-    0x09, 0x0a, 0x07, 0x0a, 0x09, 0x07, 0x70, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x70, 0x0b, 0x01, 0x07, 0x04,
-    0x01, 0x00, 0x02, 0x07, 0x00, 0x61, 0x00, 0x0a, 0x0a, 0x06, 0x5b, 0x08, 0x01, 0x06, 0x06, 0x18, 0x4b, 0x00, 0x01,
-    0x01, 0x03, 0x5b, 0x05, 0x01, 0x03, 0x03, 0x1e, 0x03, 0x4c, 0x1b, 0x40, 0x39, 0x00, 0x09, 0x0a, 0x07, 0x0a, 0x09,
-    0x07, 0x70, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x70, 0x0b, 0x01, 0x07, 0x04, 0x01, 0x00, 0x02, 0x07, 0x00,
-    0x61, 0x00, 0x06, 0x06, 0x18, 0x4b, 0x00, 0x0a, 0x0a, 0x08, 0x5b, 0x00, 0x08, 0x08, 0x1f, 0x4b, 0x00, 0x05, 0x05,
-    0x17, 0x4b, 0x00, 0x01, 0x01, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x1e, 0x03, 0x4c, 0x59, 0x40, 0x12, 0x33, 0x32, 0x2e,
-    0x2c, 0x28, 0x27, 0x24, 0x11, 0x11, 0x11, 0x14, 0x24, 0x14, 0x24, 0x10, 0x0c, 0x06, 0x1d, 0x2b, 0x01, 0x21, 0x1e,
-    0x03, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x33, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x23, 0x11, 0x23, 0x11,
-    0x33, 0x11, 0x33, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07,
-    0x21, 0x03, 0xc7, 0xfe, 0xd5, 0x02, 0x15, 0x2a, 0x43, 0x2f, 0x1e, 0x32, 0x25, 0x15, 0x01, 0xaf, 0x32, 0x55, 0x73,
-    0x40, 0x59, 0x85, 0x5b, 0x30, 0x03, 0x8f, 0xb9, 0xb9, 0x8f, 0x02, 0x30, 0x5b, 0x86, 0x59, 0x47, 0x74, 0x52, 0x2d,
-    0xaf, 0x13, 0x24, 0x33, 0x21, 0x2f, 0x43, 0x2b, 0x15, 0x01, 0x01, 0x2b, 0x01, 0xd0, 0x42, 0x78, 0x5d, 0x37, 0x1b,
-    0x30, 0x3f, 0x24, 0x40, 0x75, 0x5a, 0x35, 0x4b, 0x83, 0xb0, 0x66, 0xfe, 0x30, 0x04, 0x3a, 0xfe, 0x2d, 0x66, 0xb1,
-    0x84, 0x4c, 0x38, 0x60, 0x81, 0x4a, 0x28, 0x4a, 0x38, 0x21, 0x38, 0x5e, 0x79, 0x40, 0x00, 0x00, 0x02, 0x00, 0x27,
-    0x00, 0x00, 0x04, 0xb2, 0x05, 0xb0, 0x00, 0x0b, 0x00, 0x0e, 0x00, 0x29, 0x40, 0x26, 0x0e, 0x01, 0x06, 0x04, 0x01,
-    0x4a, 0x00, 0x06, 0x02, 0x01, 0x00, 0x01, 0x06, 0x00, 0x61, 0x00, 0x04, 0x04, 0x16, 0x4b, 0x05, 0x03, 0x02, 0x01,
-    0x01, 0x17, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x01, 0x23, 0x11, 0x23,
-    0x11, 0x23, 0x03, 0x23, 0x01, 0x33, 0x01, 0x23, 0x01, 0x21, 0x03, 0x03, 0x65, 0xa1, 0xb9, 0x94, 0x93, 0xbd, 0x01,
-    0xfa, 0xa0, 0x01, 0xf1, 0xbd, 0xfd, 0xb7, 0x01, 0x84, 0xc0, 0x01, 0xb8, 0xfe, 0x48, 0x01, 0xb8, 0xfe, 0x48, 0x05,
-    0xb0, 0xfa, 0x50, 0x02, 0x59, 0x02, 0x4b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x57, 0x00, 0x00, 0x04, 0x81, 0x04, 0x3a,
-    0x00, 0x0b, 0x00, 0x10, 0x00, 0x29, 0x40, 0x26, 0x0f, 0x01, 0x06, 0x04, 0x01, 0x4a, 0x00, 0x06, 0x02, 0x01, 0x00,
-    0x01, 0x06, 0x00, 0x61, 0x00, 0x04, 0x04, 0x18, 0x4b, 0x05, 0x03, 0x02, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x01, 0x23, 0x11, 0x23, 0x11, 0x23, 0x03, 0x23, 0x01, 0x33,
-    0x01, 0x23, 0x01, 0x21, 0x03, 0x27, 0x07, 0x03, 0x4a, 0x80, 0xb9, 0x87, 0x76, 0xbd, 0x01, 0xc4, 0x9f, 0x01, 0xc7,
-    0xbe, 0xfe, 0x04, 0x01, 0x45, 0x8b, 0x18, 0x19, 0x01, 0x29, 0xfe, 0xd7, 0x01, 0x29, 0xfe, 0xd7, 0x04, 0x3a, 0xfb,
-    0xc6, 0x01, 0xc1, 0x01, 0x57, 0x52, 0x52, 0x00, 0x02, 0x00, 0x71, 0x00, 0x00, 0x04, 0xbc, 0x05, 0xb0, 0x00, 0x13,
-    0x00, 0x16, 0x00, 0x33, 0x40, 0x30, 0x16, 0x01, 0x07, 0x06, 0x01, 0x4a, 0x0a, 0x01, 0x07, 0x04, 0x02, 0x02, 0x00,
-    0x01, 0x07, 0x00, 0x62, 0x08, 0x01, 0x06, 0x06, 0x16, 0x4b, 0x09, 0x05, 0x03, 0x03, 0x01, 0x01, 0x17, 0x01, 0x4c,
-    0x15, 0x14, 0x13, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0b, 0x06, 0x1d, 0x2b, 0x01, 0x23,
-    0x11, 0x23, 0x11, 0x23, 0x03, 0x23, 0x13, 0x23, 0x11, 0x23, 0x11, 0x33, 0x11, 0x33, 0x13, 0x33, 0x01, 0x23, 0x01,
-    0x33, 0x03, 0x03, 0xa1, 0x46, 0x94, 0x45, 0x68, 0xbd, 0x75, 0xa8, 0xb9, 0xb9, 0xd1, 0xd0, 0x9f, 0x01, 0x52, 0xbc,
-    0xfe, 0xa5, 0xdb, 0x68, 0x01, 0xd4, 0xfe, 0x2c, 0x01, 0xd4, 0xfe, 0x2c, 0x01, 0xd4, 0xfe, 0x2c, 0x05, 0xb0, 0xfc,
-    0xc5, 0x03, 0x3b, 0xfa, 0x50, 0x02, 0x75, 0x02, 0x04, 0x00, 0x00, 0x02, 0x00, 0x70, 0x00, 0x00, 0x04, 0xbd, 0x04,
-    0x3a, 0x00, 0x13, 0x00, 0x16, 0x00, 0x33, 0x40, 0x30, 0x16, 0x01, 0x07, 0x06, 0x01, 0x4a, 0x0a, 0x01, 0x07, 0x04,
-    0x02, 0x02, 0x00, 0x01, 0x07, 0x00, 0x61, 0x08, 0x01, 0x06, 0x06, 0x18, 0x4b, 0x09, 0x05, 0x03, 0x03, 0x01, 0x01,
-    0x17, 0x01, 0x4c, 0x15, 0x14, 0x13, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0b, 0x06, 0x1d,
-    0x2b, 0x01, 0x23, 0x11, 0x23, 0x11, 0x23, 0x03, 0x23, 0x13, 0x23, 0x11, 0x23, 0x11, 0x33, 0x11, 0x33, 0x13, 0x33,
-    0x01, 0x23, 0x01, 0x33, 0x03, 0x03, 0xab, 0x48, 0x9d, 0x4f, 0x5d, 0xbd, 0x63, 0x97, 0xb9, 0xb9, 0xcd, 0xd5, 0x9f,
-    0x01, 0x53, 0xbd, 0xfe, 0xaa, 0xd3, 0x65, 0x01, 0x25, 0xfe, 0xdb, 0x01, 0x25, 0xfe, 0xdb, 0x01, 0x25, 0xfe, 0xdb,
-    0x04, 0x3a, 0xfd, 0x8c, 0x02, 0x74, 0xfb, 0xc6, 0x01, 0xc6, 0x01, 0x5c, 0x00, 0x00, 0x02, 0x00, 0x55, 0x00, 0x00,
-    0x04, 0x85, 0x05, 0xb0, 0x00, 0x24, 0x00, 0x27, 0x00, 0x38, 0x40, 0x35, 0x19, 0x01, 0x03, 0x04, 0x01, 0x4a, 0x02,
-    0x01, 0x00, 0x06, 0x01, 0x04, 0x03, 0x00, 0x04, 0x63, 0x00, 0x08, 0x08, 0x01, 0x59, 0x00, 0x01, 0x01, 0x16, 0x4b,
-    0x09, 0x07, 0x05, 0x03, 0x03, 0x03, 0x17, 0x03, 0x4c, 0x00, 0x00, 0x27, 0x26, 0x00, 0x24, 0x00, 0x24, 0x31, 0x12,
-    0x25, 0x15, 0x11, 0x12, 0x15, 0x0a, 0x06, 0x1b, 0x2b, 0x33, 0x03, 0x34, 0x3e, 0x02, 0x33, 0x33, 0x01, 0x21, 0x01,
-    0x1e, 0x03, 0x15, 0x11, 0x23, 0x11, 0x34, 0x2e, 0x02, 0x23, 0x23, 0x07, 0x11, 0x23, 0x11, 0x27, 0x23, 0x22, 0x0e,
-    0x02, 0x15, 0x11, 0x01, 0x13, 0x21, 0x56, 0x01, 0x31, 0x5d, 0x87, 0x56, 0x03, 0xfe, 0xaf, 0x03, 0xdf, 0xfe, 0xcb,
-    0x56, 0x86, 0x5d, 0x30, 0xb9, 0x16, 0x2c, 0x43, 0x2e, 0x44, 0x09, 0xb9, 0x03, 0x50, 0x2e, 0x43, 0x2b, 0x15, 0x01,
-    0x61, 0xcc, 0xfe, 0x52, 0x01, 0xab, 0x62, 0x8b, 0x59, 0x29, 0x02, 0x96, 0xfd, 0x6a, 0x01, 0x29, 0x59, 0x8a, 0x62,
-    0xfe, 0x55, 0x01, 0xab, 0x3d, 0x52, 0x32, 0x16, 0x14, 0xfd, 0x92, 0x02, 0x7d, 0x05, 0x16, 0x32, 0x52, 0x3d, 0xfe,
-    0x55, 0x03, 0x3e, 0x01, 0xda, 0x00, 0x00, 0x00, 0x02, 0x00, 0x69, 0x00, 0x00, 0x04, 0x59, 0x04, 0x3a, 0x00, 0x23,
-    0x00, 0x27, 0x00, 0x39, 0x40, 0x36, 0x1b, 0x18, 0x02, 0x03, 0x04, 0x01, 0x4a, 0x02, 0x01, 0x00, 0x06, 0x01, 0x04,
-    0x03, 0x00, 0x04, 0x63, 0x00, 0x08, 0x08, 0x01, 0x59, 0x00, 0x01, 0x01, 0x18, 0x4b, 0x09, 0x07, 0x05, 0x03, 0x03,
-    0x03, 0x17, 0x03, 0x4c, 0x00, 0x00, 0x27, 0x26, 0x00, 0x23, 0x00, 0x23, 0x13, 0x12, 0x25, 0x15, 0x11, 0x11, 0x15,
-    0x0a, 0x06, 0x1b, 0x2b, 0x33, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x01, 0x21, 0x01, 0x1e, 0x03, 0x15, 0x15, 0x23, 0x27,
-    0x34, 0x2e, 0x02, 0x23, 0x23, 0x07, 0x11, 0x23, 0x11, 0x27, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x01, 0x33, 0x13,
-    0x21, 0x69, 0x2b, 0x53, 0x77, 0x4b, 0xfe, 0xe6, 0x03, 0xb0, 0xfe, 0xe5, 0x49, 0x72, 0x50, 0x2a, 0xb9, 0x01, 0x14,
-    0x28, 0x3d, 0x2a, 0x31, 0x0a, 0xba, 0x05, 0x3d, 0x2a, 0x3d, 0x28, 0x14, 0x01, 0x42, 0x05, 0xb2, 0xfe, 0x96, 0xdb,
-    0x63, 0x8f, 0x5c, 0x2f, 0x03, 0x01, 0xdf, 0xfe, 0x20, 0x05, 0x30, 0x5d, 0x8c, 0x61, 0xdb, 0xdb, 0x43, 0x59, 0x36,
-    0x17, 0x11, 0xfe, 0x4d, 0x01, 0xbb, 0x09, 0x17, 0x36, 0x59, 0x43, 0xdb, 0x02, 0x5c, 0x01, 0x46, 0x00, 0x02, 0x00,
-    0x50, 0x00, 0x00, 0x04, 0x87, 0x05, 0xb0, 0x00, 0x23, 0x00, 0x26, 0x00, 0x3b, 0x40, 0x38, 0x0e, 0x0b, 0x02, 0x01,
-    0x02, 0x01, 0x4a, 0x09, 0x01, 0x00, 0x06, 0x04, 0x02, 0x02, 0x01, 0x00, 0x02, 0x63, 0x00, 0x0b, 0x0b, 0x08, 0x59,
-    0x0a, 0x01, 0x08, 0x08, 0x16, 0x4b, 0x07, 0x05, 0x03, 0x03, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x26, 0x25, 0x23, 0x22,
-    0x21, 0x20, 0x11, 0x11, 0x13, 0x13, 0x42, 0x12, 0x23, 0x13, 0x10, 0x0c, 0x06, 0x1d, 0x2b, 0x01, 0x16, 0x16, 0x15,
-    0x11, 0x23, 0x03, 0x34, 0x26, 0x23, 0x23, 0x07, 0x11, 0x23, 0x11, 0x27, 0x2b, 0x02, 0x06, 0x06, 0x15, 0x11, 0x23,
-    0x03, 0x34, 0x37, 0x23, 0x11, 0x23, 0x11, 0x33, 0x11, 0x21, 0x03, 0x21, 0x01, 0x13, 0x21, 0x03, 0x8f, 0x78, 0x80,
-    0x99, 0x01, 0x33, 0x3d, 0x23, 0x07, 0x99, 0x08, 0x26, 0x02, 0x04, 0x39, 0x31, 0x99, 0x01, 0x14, 0x9b, 0xab, 0xab,
-    0x01, 0x81, 0xeb, 0x02, 0xe9, 0xfe, 0x8c, 0x81, 0xfe, 0xfe, 0x03, 0x18, 0x05, 0x8d, 0x92, 0xfe, 0x0c, 0x01, 0xf4,
-    0x4b, 0x41, 0x14, 0xfd, 0x94, 0x02, 0x69, 0x17, 0x02, 0x41, 0x49, 0xfe, 0x0c, 0x01, 0xf4, 0x50, 0x3c, 0xfd, 0x80,
-    0x05, 0xb0, 0xfd, 0x68, 0x02, 0x98, 0xfd, 0xcd, 0x01, 0x9b, 0x00, 0x02, 0x00, 0x51, 0x00, 0x00, 0x04, 0x86, 0x04,
-    0x3a, 0x00, 0x24, 0x00, 0x27, 0x00, 0x38, 0x40, 0x35, 0x0f, 0x0b, 0x02, 0x00, 0x01, 0x01, 0x4a, 0x00, 0x08, 0x05,
-    0x03, 0x02, 0x01, 0x00, 0x08, 0x01, 0x63, 0x00, 0x0a, 0x0a, 0x07, 0x59, 0x09, 0x01, 0x07, 0x07, 0x18, 0x4b, 0x06,
-    0x04, 0x02, 0x03, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x27, 0x26, 0x24, 0x23, 0x11, 0x11, 0x11, 0x13, 0x13, 0x42, 0x14,
-    0x13, 0x14, 0x0b, 0x06, 0x1d, 0x2b, 0x01, 0x16, 0x16, 0x15, 0x11, 0x23, 0x03, 0x34, 0x26, 0x23, 0x23, 0x07, 0x23,
-    0x11, 0x23, 0x11, 0x27, 0x2b, 0x02, 0x06, 0x06, 0x15, 0x11, 0x23, 0x03, 0x34, 0x37, 0x23, 0x11, 0x23, 0x11, 0x33,
-    0x11, 0x21, 0x03, 0x21, 0x01, 0x13, 0x23, 0x03, 0xa7, 0x6d, 0x72, 0x99, 0x01, 0x35, 0x3f, 0x12, 0x0c, 0x06, 0x9a,
-    0x0a, 0x20, 0x04, 0x02, 0x39, 0x34, 0x99, 0x01, 0x15, 0x9c, 0xab, 0xab, 0x01, 0x72, 0xd2, 0x02, 0xde, 0xfe, 0x91,
-    0x7c, 0xf8, 0x02, 0x50, 0x0b, 0x8a, 0x8c, 0xfe, 0xd1, 0x01, 0x2f, 0x4c, 0x40, 0x1d, 0xfe, 0x62, 0x01, 0xa5, 0x16,
-    0x02, 0x40, 0x4a, 0xfe, 0xd1, 0x01, 0x2f, 0x51, 0x3b, 0xfe, 0x45, 0x04, 0x3a, 0xfe, 0x19, 0x01, 0xe7, 0xfe, 0x32,
-    0x01, 0x3f, 0x00, 0x00, 0x00, 0x02, 0x00, 0xca, 0xfe, 0x46, 0x04, 0x24, 0x07, 0x74, 0x00, 0x3e, 0x00, 0x47, 0x00,
-    0x54, 0x40, 0x51, 0x45, 0x01, 0x07, 0x06, 0x15, 0x01, 0x05, 0x00, 0x02, 0x4a, 0x27, 0x26, 0x02, 0x03, 0x47, 0x08,
-    0x01, 0x06, 0x07, 0x06, 0x72, 0x00, 0x07, 0x02, 0x07, 0x72, 0x09, 0x01, 0x00, 0x00, 0x05, 0x04, 0x00, 0x05, 0x63,
-    0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x16, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x1e,
-    0x03, 0x4c, 0x01, 0x00, 0x47, 0x46, 0x44, 0x43, 0x41, 0x40, 0x3d, 0x3b, 0x33, 0x30, 0x1f, 0x1c, 0x0c, 0x0a, 0x09,
-    0x07, 0x00, 0x3e, 0x01, 0x3e, 0x0a, 0x06, 0x14, 0x2b, 0x01, 0x36, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x21, 0x35,
-    0x21, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x23, 0x22, 0x06,
-    0x15, 0x14, 0x1e, 0x02, 0x17, 0x07, 0x2e, 0x03, 0x27, 0x34, 0x3e, 0x02, 0x33, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34,
-    0x2e, 0x02, 0x23, 0x23, 0x35, 0x13, 0x37, 0x33, 0x15, 0x07, 0x23, 0x27, 0x35, 0x33, 0x02, 0x1c, 0x9f, 0x99, 0x25,
-    0x4a, 0x6d, 0x48, 0xfe, 0xce, 0x01, 0x32, 0x66, 0xaf, 0x80, 0x49, 0x23, 0x40, 0x5c, 0x39, 0x80, 0x8e, 0x4a, 0x81,
-    0xb0, 0x65, 0x35, 0x4e, 0x47, 0x21, 0x32, 0x37, 0x17, 0x4a, 0x2f, 0x5d, 0x4b, 0x2f, 0x01, 0x30, 0x57, 0x7a, 0x4b,
-    0x2e, 0x42, 0x6d, 0x4d, 0x2a, 0x2d, 0x56, 0x7c, 0x4f, 0x8d, 0xad, 0x97, 0xa0, 0xfe, 0x72, 0xfb, 0x9d, 0x03, 0x37,
-    0x01, 0x82, 0x71, 0x32, 0x57, 0x40, 0x24, 0x98, 0x35, 0x65, 0x92, 0x5d, 0x35, 0x5e, 0x50, 0x40, 0x16, 0x28, 0xac,
-    0x84, 0x66, 0x9f, 0x6c, 0x38, 0x3e, 0x33, 0x28, 0x3d, 0x2c, 0x1f, 0x0a, 0x7c, 0x14, 0x3b, 0x50, 0x64, 0x3c, 0x43,
-    0x60, 0x3e, 0x1e, 0x28, 0x47, 0x63, 0x3c, 0x45, 0x66, 0x42, 0x21, 0x97, 0x03, 0xa5, 0x98, 0x12, 0xf8, 0xf5, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xde, 0xfe, 0x46, 0x04, 0x09, 0x06, 0x1e, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x54,
-    0x40, 0x51, 0x43, 0x01, 0x07, 0x06, 0x13, 0x01, 0x05, 0x00, 0x02, 0x4a, 0x25, 0x24, 0x02, 0x03, 0x47, 0x08, 0x01,
-    0x06, 0x07, 0x06, 0x72, 0x00, 0x07, 0x02, 0x07, 0x72, 0x09, 0x01, 0x00, 0x00, 0x05, 0x04, 0x00, 0x05, 0x63, 0x00,
-    0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x18, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x1e, 0x03,
-    0x4c, 0x01, 0x00, 0x45, 0x44, 0x42, 0x41, 0x3f, 0x3e, 0x3b, 0x39, 0x31, 0x2e, 0x1d, 0x1a, 0x0c, 0x0a, 0x09, 0x07,
-    0x00, 0x3c, 0x01, 0x3c, 0x0a, 0x06, 0x14, 0x2b, 0x01, 0x32, 0x36, 0x27, 0x34, 0x2e, 0x02, 0x23, 0x21, 0x35, 0x21,
-    0x32, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x07, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x23, 0x22, 0x06, 0x17, 0x14,
-    0x1e, 0x02, 0x17, 0x07, 0x2e, 0x03, 0x27, 0x34, 0x3e, 0x02, 0x33, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02,
-    0x23, 0x23, 0x35, 0x13, 0x37, 0x33, 0x15, 0x07, 0x23, 0x27, 0x35, 0x33, 0x02, 0x2c, 0x89, 0x85, 0x01, 0x21, 0x40,
-    0x5c, 0x3c, 0xfe, 0xd4, 0x01, 0x2c, 0x5b, 0x9f, 0x75, 0x44, 0x68, 0x5b, 0x67, 0x72, 0x44, 0x76, 0xa0, 0x5b, 0x30,
-    0x4e, 0x48, 0x01, 0x21, 0x32, 0x37, 0x17, 0x4b, 0x2e, 0x5d, 0x4b, 0x30, 0x01, 0x30, 0x57, 0x7b, 0x4b, 0x29, 0x37,
-    0x5d, 0x42, 0x26, 0x29, 0x4c, 0x6c, 0x43, 0x8d, 0xa5, 0x97, 0xa0, 0xfe, 0x72, 0xfb, 0x9d, 0x02, 0x69, 0x55, 0x4b,
-    0x21, 0x38, 0x28, 0x17, 0x99, 0x29, 0x50, 0x73, 0x49, 0x4b, 0x76, 0x23, 0x1f, 0x79, 0x59, 0x4e, 0x78, 0x52, 0x2b,
-    0x3e, 0x33, 0x28, 0x3d, 0x2c, 0x1f, 0x0a, 0x7c, 0x14, 0x3b, 0x50, 0x64, 0x3c, 0x43, 0x60, 0x3e, 0x1e, 0x18, 0x2c,
-    0x3e, 0x26, 0x2b, 0x3f, 0x28, 0x14, 0x97, 0x03, 0x1d, 0x98, 0x12, 0xf8, 0xf5, 0x15, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x63, 0xff, 0xec, 0x04, 0x5a, 0x05, 0xc4, 0x00, 0x1d, 0x00, 0x2e, 0x00, 0x3f, 0x00, 0x37, 0x40, 0x34, 0x06,
-    0x01, 0x02, 0x07, 0x01, 0x04, 0x05, 0x02, 0x04, 0x61, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x1d, 0x4b,
-    0x00, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x4c, 0x30, 0x2f, 0x1f, 0x1e, 0x39, 0x37, 0x2f, 0x3f,
-    0x30, 0x3f, 0x28, 0x26, 0x1e, 0x2e, 0x1f, 0x2e, 0x2d, 0x26, 0x08, 0x06, 0x16, 0x2b, 0x01, 0x0e, 0x05, 0x23, 0x22,
-    0x2e, 0x04, 0x27, 0x35, 0x3e, 0x05, 0x33, 0x32, 0x1e, 0x04, 0x17, 0x05, 0x21, 0x35, 0x2e, 0x05, 0x23, 0x22, 0x0e,
-    0x04, 0x07, 0x05, 0x21, 0x15, 0x1e, 0x05, 0x33, 0x32, 0x3e, 0x04, 0x37, 0x04, 0x5a, 0x01, 0x19, 0x34, 0x51, 0x70,
-    0x91, 0x5a, 0x5a, 0x91, 0x70, 0x52, 0x35, 0x1a, 0x01, 0x01, 0x19, 0x35, 0x51, 0x70, 0x91, 0x5a, 0x5a, 0x92, 0x70,
-    0x51, 0x35, 0x19, 0x01, 0xfc, 0xbf, 0x02, 0x8a, 0x01, 0x0c, 0x1d, 0x30, 0x48, 0x62, 0x41, 0x40, 0x62, 0x48, 0x30,
-    0x1d, 0x0d, 0x01, 0x02, 0x8a, 0xfd, 0x76, 0x01, 0x0d, 0x1e, 0x30, 0x48, 0x62, 0x41, 0x41, 0x63, 0x47, 0x2f, 0x1d,
-    0x0b, 0x01, 0x02, 0x84, 0x4e, 0x9f, 0x94, 0x80, 0x60, 0x37, 0x37, 0x60, 0x81, 0x94, 0x9e, 0x4e, 0xa6, 0x4e, 0x9f,
-    0x94, 0x81, 0x61, 0x37, 0x37, 0x60, 0x81, 0x94, 0xa0, 0x4e, 0x09, 0x0b, 0x34, 0x71, 0x6f, 0x65, 0x4d, 0x2d, 0x2e,
-    0x4d, 0x65, 0x6f, 0x71, 0x33, 0xa3, 0x05, 0x33, 0x72, 0x6f, 0x66, 0x4d, 0x2e, 0x2e, 0x4d, 0x65, 0x6f, 0x72, 0x34,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x5d, 0xff, 0xec, 0x04, 0x35, 0x04, 0x4e, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2b, 0x00,
-    0x37, 0x40, 0x34, 0x00, 0x05, 0x00, 0x03, 0x02, 0x05, 0x03, 0x61, 0x07, 0x01, 0x04, 0x04, 0x00, 0x5b, 0x00, 0x00,
-    0x00, 0x1f, 0x4b, 0x06, 0x01, 0x02, 0x02, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x1e, 0x01, 0x4c, 0x22, 0x21, 0x17, 0x16,
-    0x27, 0x26, 0x21, 0x2b, 0x22, 0x2b, 0x1c, 0x1b, 0x16, 0x20, 0x17, 0x20, 0x29, 0x24, 0x08, 0x06, 0x16, 0x2b, 0x13,
-    0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x01, 0x32,
-    0x3e, 0x02, 0x37, 0x21, 0x1e, 0x03, 0x13, 0x22, 0x0e, 0x02, 0x07, 0x21, 0x2e, 0x03, 0x5d, 0x44, 0x7f, 0xb6, 0x72,
-    0x73, 0xb7, 0x7f, 0x44, 0x44, 0x7f, 0xb6, 0x72, 0x73, 0xb7, 0x7f, 0x44, 0x01, 0xed, 0x45, 0x6b, 0x4c, 0x2c, 0x07,
-    0xfd, 0xa0, 0x07, 0x2c, 0x4d, 0x6b, 0x44, 0x44, 0x6a, 0x4c, 0x2e, 0x07, 0x02, 0x5f, 0x08, 0x2d, 0x4c, 0x6b, 0x02,
-    0x27, 0x75, 0xc9, 0x94, 0x55, 0x55, 0x94, 0xc9, 0x75, 0x16, 0x75, 0xc8, 0x94, 0x54, 0x54, 0x94, 0xc8, 0x75, 0xfe,
-    0x71, 0x35, 0x5c, 0x7b, 0x46, 0x46, 0x7b, 0x5c, 0x35, 0x03, 0x34, 0x34, 0x5a, 0x79, 0x44, 0x44, 0x79, 0x5a, 0x34,
-    0x00, 0x01, 0x00, 0x1a, 0x00, 0x00, 0x04, 0xe1, 0x05, 0xc3, 0x00, 0x14, 0x00, 0x41, 0xb5, 0x01, 0x01, 0x02, 0x01,
-    0x01, 0x4a, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x11, 0x00, 0x01, 0x01, 0x00, 0x5b, 0x03, 0x01, 0x00, 0x00, 0x1d,
-    0x4b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x1b, 0x40, 0x15, 0x00, 0x03, 0x03, 0x16, 0x4b, 0x00, 0x01, 0x01, 0x00,
-    0x5b, 0x00, 0x00, 0x00, 0x1d, 0x4b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x59, 0xb6, 0x11, 0x15, 0x21, 0x27, 0x04,
-    0x06, 0x18, 0x2b, 0x01, 0x17, 0x37, 0x01, 0x3e, 0x03, 0x33, 0x17, 0x07, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x01, 0x23,
-    0x01, 0x33, 0x02, 0x47, 0x22, 0x22, 0x01, 0x02, 0x18, 0x38, 0x46, 0x58, 0x38, 0x2e, 0x01, 0x0d, 0x1b, 0x2a, 0x23,
-    0x1c, 0x0e, 0xfe, 0x7d, 0xaa, 0xfe, 0x06, 0xd1, 0x01, 0x76, 0x82, 0x81, 0x03, 0x29, 0x4d, 0x6e, 0x48, 0x22, 0x01,
-    0xab, 0x10, 0x23, 0x37, 0x26, 0xfb, 0x79, 0x05, 0xb0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x04, 0x60,
-    0x04, 0x4e, 0x00, 0x14, 0x00, 0x5b, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x0b, 0x09, 0x01, 0x01, 0x00, 0x0a, 0x01,
-    0x02, 0x02, 0x01, 0x02, 0x4a, 0x1b, 0x40, 0x0b, 0x09, 0x01, 0x01, 0x03, 0x0a, 0x01, 0x02, 0x02, 0x01, 0x02, 0x4a,
-    0x59, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x11, 0x00, 0x01, 0x01, 0x00, 0x5b, 0x03, 0x01, 0x00, 0x00, 0x1f, 0x4b,
-    0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x1b, 0x40, 0x15, 0x00, 0x03, 0x03, 0x18, 0x4b, 0x00, 0x01, 0x01, 0x00, 0x5b,
-    0x00, 0x00, 0x00, 0x1f, 0x4b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x59, 0xb6, 0x11, 0x13, 0x25, 0x25, 0x04, 0x06,
-    0x18, 0x2b, 0x01, 0x17, 0x37, 0x13, 0x36, 0x36, 0x17, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07,
-    0x01, 0x23, 0x01, 0x33, 0x02, 0x1b, 0x18, 0x19, 0xb0, 0x2a, 0x83, 0x4d, 0x1c, 0x34, 0x1a, 0x15, 0x06, 0x17, 0x0e,
-    0x21, 0x3c, 0x0e, 0xfe, 0xc3, 0x8d, 0xfe, 0x66, 0xbe, 0x01, 0x3c, 0x65, 0x65, 0x02, 0x1f, 0x81, 0x72, 0x01, 0x07,
-    0x11, 0x94, 0x03, 0x05, 0x34, 0x29, 0xfc, 0xb4, 0x04, 0x3a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x45, 0xfe, 0x51, 0x04,
-    0xba, 0x05, 0xc4, 0x00, 0x15, 0x00, 0x32, 0x00, 0x48, 0x00, 0x41, 0x40, 0x3e, 0x17, 0x01, 0x07, 0x02, 0x30, 0x01,
-    0x00, 0x07, 0x25, 0x01, 0x04, 0x00, 0x03, 0x4a, 0x00, 0x06, 0x06, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x1d, 0x4b, 0x05,
-    0x01, 0x02, 0x02, 0x18, 0x4b, 0x00, 0x07, 0x07, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x1e, 0x4b, 0x00, 0x04, 0x04, 0x03,
-    0x5c, 0x00, 0x03, 0x03, 0x21, 0x03, 0x4c, 0x29, 0x25, 0x16, 0x39, 0x15, 0x17, 0x29, 0x24, 0x08, 0x06, 0x1c, 0x2b,
-    0x01, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x01,
-    0x17, 0x13, 0x33, 0x03, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x37, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x37,
-    0x37, 0x03, 0x33, 0x05, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e,
-    0x02, 0x35, 0x02, 0x8a, 0x27, 0x4c, 0x71, 0x49, 0x45, 0x69, 0x47, 0x23, 0x23, 0x47, 0x69, 0x45, 0x49, 0x70, 0x4d,
-    0x27, 0x01, 0x14, 0x0f, 0x69, 0xa4, 0xf1, 0x09, 0x22, 0x37, 0x50, 0x39, 0x0a, 0x19, 0x1a, 0x18, 0x07, 0x04, 0x06,
-    0x13, 0x14, 0x13, 0x06, 0x1d, 0x29, 0x1b, 0x11, 0x05, 0x18, 0x9f, 0xa4, 0xfe, 0x71, 0x0c, 0x1b, 0x2d, 0x20, 0x20,
-    0x2b, 0x1a, 0x0c, 0x0c, 0x1a, 0x2b, 0x20, 0x21, 0x2c, 0x1b, 0x0c, 0x01, 0xe7, 0x73, 0xbb, 0x85, 0x48, 0x48, 0x85,
-    0xbb, 0x73, 0x01, 0xe1, 0x73, 0xbc, 0x85, 0x48, 0x48, 0x85, 0xbc, 0x73, 0xfe, 0xab, 0xa3, 0x02, 0x6a, 0xfb, 0x1e,
-    0x27, 0x5c, 0x4f, 0x35, 0x03, 0x05, 0x06, 0x02, 0x90, 0x01, 0x02, 0x02, 0x01, 0x29, 0x3a, 0x3e, 0x15, 0x5e, 0x04,
-    0x3b, 0x4b, 0x48, 0x73, 0x51, 0x2b, 0x2b, 0x51, 0x73, 0x48, 0xfd, 0xd3, 0x48, 0x74, 0x51, 0x2c, 0x2c, 0x51, 0x74,
-    0x48, 0x00, 0x00, 0x00, 0x03, 0x00, 0x37, 0xfe, 0x51, 0x04, 0xbb, 0x04, 0x4e, 0x00, 0x15, 0x00, 0x32, 0x00, 0x48,
-    0x00, 0x6f, 0x40, 0x0e, 0x17, 0x01, 0x06, 0x07, 0x30, 0x01, 0x01, 0x06, 0x25, 0x01, 0x04, 0x01, 0x03, 0x4a, 0x4b,
-    0xb0, 0x19, 0x50, 0x58, 0x40, 0x21, 0x00, 0x07, 0x07, 0x00, 0x59, 0x05, 0x02, 0x02, 0x00, 0x00, 0x18, 0x4b, 0x00,
-    0x06, 0x06, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x1e, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5c, 0x00, 0x03, 0x03, 0x21, 0x03,
-    0x4c, 0x1b, 0x40, 0x25, 0x05, 0x01, 0x02, 0x02, 0x18, 0x4b, 0x00, 0x07, 0x07, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x1f,
-    0x4b, 0x00, 0x06, 0x06, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x1e, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5c, 0x00, 0x03, 0x03,
-    0x21, 0x03, 0x4c, 0x59, 0x40, 0x0b, 0x29, 0x25, 0x16, 0x39, 0x15, 0x17, 0x29, 0x24, 0x08, 0x06, 0x1c, 0x2b, 0x13,
-    0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x25, 0x17,
-    0x13, 0x33, 0x03, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x37, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x37,
-    0x03, 0x33, 0x01, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02,
-    0x15, 0x37, 0x23, 0x4d, 0x78, 0x55, 0x56, 0x7a, 0x4d, 0x24, 0x24, 0x4d, 0x79, 0x55, 0x56, 0x79, 0x4c, 0x24, 0x03,
-    0x67, 0x0d, 0x6c, 0xa4, 0xf1, 0x09, 0x22, 0x37, 0x50, 0x39, 0x0a, 0x19, 0x1a, 0x18, 0x07, 0x04, 0x06, 0x13, 0x14,
-    0x13, 0x06, 0x1d, 0x29, 0x1b, 0x10, 0x06, 0x18, 0x9f, 0xa4, 0xfd, 0x8f, 0x08, 0x1c, 0x35, 0x2d, 0x2d, 0x35, 0x1b,
-    0x08, 0x08, 0x1c, 0x36, 0x2d, 0x2c, 0x35, 0x1b, 0x08, 0x02, 0x28, 0x75, 0xc9, 0x94, 0x54, 0x54, 0x94, 0xc9, 0x75,
-    0x17, 0x75, 0xc9, 0x93, 0x54, 0x54, 0x93, 0xc9, 0x75, 0x62, 0xb3, 0x02, 0x7a, 0xfb, 0x1e, 0x27, 0x5c, 0x4f, 0x35,
-    0x03, 0x05, 0x06, 0x02, 0x90, 0x01, 0x02, 0x02, 0x01, 0x29, 0x3a, 0x3e, 0x15, 0x5e, 0x04, 0x3b, 0xfd, 0xd7, 0x50,
-    0x90, 0x6e, 0x41, 0x41, 0x6e, 0x90, 0x50, 0x17, 0x4e, 0x90, 0x6e, 0x42, 0x42, 0x6e, 0x90, 0x4e, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x6a, 0xff, 0x73, 0x04, 0x61, 0x06, 0x35, 0x00, 0x03, 0x00, 0x07, 0x00, 0x25, 0x00, 0x43, 0x00,
-    0xab, 0x4b, 0xb0, 0x16, 0x50, 0x58, 0x40, 0x2e, 0x00, 0x01, 0x05, 0x05, 0x01, 0x66, 0x00, 0x00, 0x06, 0x03, 0x06,
-    0x00, 0x68, 0x00, 0x03, 0x07, 0x07, 0x03, 0x66, 0x00, 0x02, 0x04, 0x04, 0x02, 0x67, 0x00, 0x06, 0x06, 0x05, 0x5b,
-    0x00, 0x05, 0x05, 0x1d, 0x4b, 0x00, 0x07, 0x07, 0x04, 0x5c, 0x00, 0x04, 0x04, 0x1e, 0x04, 0x4c, 0x1b, 0x4b, 0xb0,
-    0x17, 0x50, 0x58, 0x40, 0x2d, 0x00, 0x01, 0x05, 0x05, 0x01, 0x66, 0x00, 0x00, 0x06, 0x03, 0x06, 0x00, 0x68, 0x00,
-    0x03, 0x07, 0x07, 0x03, 0x66, 0x00, 0x02, 0x04, 0x02, 0x73, 0x00, 0x06, 0x06, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x1d,
-    0x4b, 0x00, 0x07, 0x07, 0x04, 0x5c, 0x00, 0x04, 0x04, 0x1e, 0x04, 0x4c, 0x1b, 0x40, 0x2e, 0x00, 0x01, 0x05, 0x01,
-    0x72, 0x00, 0x00, 0x06, 0x03, 0x06, 0x00, 0x03, 0x70, 0x00, 0x03, 0x07, 0x06, 0x03, 0x07, 0x6e, 0x00, 0x02, 0x04,
-    0x02, 0x73, 0x00, 0x06, 0x06, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x1d, 0x4b, 0x00, 0x07, 0x07, 0x04, 0x5c, 0x00, 0x04,
-    0x04, 0x1e, 0x04, 0x4c, 0x59, 0x59, 0x40, 0x0b, 0x2d, 0x2d, 0x2d, 0x27, 0x11, 0x11, 0x11, 0x10, 0x08, 0x06, 0x1c,
-    0x2b, 0x01, 0x23, 0x11, 0x33, 0x11, 0x23, 0x11, 0x33, 0x01, 0x0e, 0x05, 0x23, 0x22, 0x2e, 0x04, 0x27, 0x35, 0x3e,
-    0x05, 0x33, 0x32, 0x1e, 0x04, 0x17, 0x27, 0x2e, 0x05, 0x23, 0x22, 0x0e, 0x04, 0x07, 0x15, 0x1e, 0x05, 0x33, 0x32,
-    0x3e, 0x04, 0x37, 0x02, 0xc2, 0xb9, 0xb9, 0xb9, 0xb9, 0x01, 0x9f, 0x01, 0x19, 0x34, 0x51, 0x70, 0x91, 0x5a, 0x5a,
-    0x91, 0x70, 0x52, 0x35, 0x1a, 0x01, 0x01, 0x19, 0x35, 0x51, 0x70, 0x91, 0x5a, 0x5a, 0x92, 0x70, 0x51, 0x35, 0x19,
-    0x01, 0xb7, 0x01, 0x0c, 0x1d, 0x30, 0x48, 0x62, 0x41, 0x40, 0x62, 0x48, 0x30, 0x1d, 0x0d, 0x01, 0x01, 0x0d, 0x1e,
-    0x30, 0x48, 0x62, 0x41, 0x41, 0x63, 0x47, 0x2f, 0x1d, 0x0b, 0x01, 0x04, 0xb3, 0x01, 0x82, 0xf9, 0x3e, 0x01, 0x8b,
-    0x01, 0x86, 0x4e, 0x9f, 0x94, 0x80, 0x60, 0x37, 0x37, 0x60, 0x81, 0x94, 0x9e, 0x4e, 0xa6, 0x4e, 0x9f, 0x94, 0x81,
-    0x61, 0x37, 0x37, 0x60, 0x81, 0x94, 0xa0, 0x4e, 0x02, 0x34, 0x71, 0x6f, 0x65, 0x4d, 0x2d, 0x2e, 0x4d, 0x65, 0x6f,
-    0x71, 0x33, 0xa8, 0x33, 0x72, 0x6f, 0x66, 0x4d, 0x2e, 0x2e, 0x4d, 0x65, 0x6f, 0x72, 0x34, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x7a, 0xff, 0x61, 0x04, 0x52, 0x04, 0xcb, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1d, 0x00, 0x33, 0x01, 0x16,
-    0x4b, 0xb0, 0x12, 0x50, 0x58, 0x40, 0x2e, 0x00, 0x01, 0x04, 0x04, 0x01, 0x66, 0x00, 0x00, 0x07, 0x03, 0x07, 0x00,
-    0x68, 0x00, 0x03, 0x06, 0x06, 0x03, 0x66, 0x00, 0x02, 0x05, 0x05, 0x02, 0x67, 0x00, 0x07, 0x07, 0x04, 0x5b, 0x00,
-    0x04, 0x04, 0x1f, 0x4b, 0x00, 0x06, 0x06, 0x05, 0x5c, 0x00, 0x05, 0x05, 0x1e, 0x05, 0x4c, 0x1b, 0x4b, 0xb0, 0x14,
-    0x50, 0x58, 0x40, 0x2d, 0x00, 0x01, 0x04, 0x04, 0x01, 0x66, 0x00, 0x00, 0x07, 0x03, 0x07, 0x00, 0x68, 0x00, 0x03,
-    0x06, 0x06, 0x03, 0x66, 0x00, 0x02, 0x05, 0x02, 0x73, 0x00, 0x07, 0x07, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x1f, 0x4b,
-    0x00, 0x06, 0x06, 0x05, 0x5c, 0x00, 0x05, 0x05, 0x1e, 0x05, 0x4c, 0x1b, 0x4b, 0xb0, 0x16, 0x50, 0x58, 0x40, 0x2c,
-    0x00, 0x01, 0x04, 0x01, 0x72, 0x00, 0x00, 0x07, 0x03, 0x07, 0x00, 0x68, 0x00, 0x03, 0x06, 0x06, 0x03, 0x66, 0x00,
-    0x02, 0x05, 0x02, 0x73, 0x00, 0x07, 0x07, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x1f, 0x4b, 0x00, 0x06, 0x06, 0x05, 0x5c,
-    0x00, 0x05, 0x05, 0x1e, 0x05, 0x4c, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x2d, 0x00, 0x01, 0x04, 0x01, 0x72,
-    0x00, 0x00, 0x07, 0x03, 0x07, 0x00, 0x68, 0x00, 0x03, 0x06, 0x07, 0x03, 0x06, 0x6e, 0x00, 0x02, 0x05, 0x02, 0x73,
-    0x00, 0x07, 0x07, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x1f, 0x4b, 0x00, 0x06, 0x06, 0x05, 0x5c, 0x00, 0x05, 0x05, 0x1e,
-    0x05, 0x4c, 0x1b, 0x40, 0x2e, 0x00, 0x01, 0x04, 0x01, 0x72, 0x00, 0x00, 0x07, 0x03, 0x07, 0x00, 0x03, 0x70, 0x00,
-    0x03, 0x06, 0x07, 0x03, 0x06, 0x6e, 0x00, 0x02, 0x05, 0x02, 0x73, 0x00, 0x07, 0x07, 0x04, 0x5b, 0x00, 0x04, 0x04,
-    0x1f, 0x4b, 0x00, 0x06, 0x06, 0x05, 0x5c, 0x00, 0x05, 0x05, 0x1e, 0x05, 0x4c, 0x59, 0x59, 0x59, 0x59, 0x40, 0x0b,
-    0x29, 0x29, 0x29, 0x25, 0x11, 0x11, 0x11, 0x10, 0x08, 0x06, 0x1c, 0x2b, 0x01, 0x23, 0x11, 0x33, 0x11, 0x23, 0x11,
-    0x33, 0x01, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35,
-    0x33, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x02,
-    0xc4, 0xba, 0xba, 0xba, 0xba, 0xfd, 0xb6, 0x44, 0x7f, 0xb6, 0x72, 0x73, 0xb7, 0x7f, 0x44, 0x44, 0x7f, 0xb6, 0x72,
-    0x73, 0xb7, 0x7f, 0x44, 0xb9, 0x26, 0x4d, 0x74, 0x4d, 0x4c, 0x73, 0x4d, 0x26, 0x27, 0x4d, 0x73, 0x4d, 0x4d, 0x72,
-    0x4d, 0x26, 0x03, 0x46, 0x01, 0x85, 0xfa, 0x96, 0x01, 0x97, 0x01, 0x2f, 0x75, 0xc9, 0x94, 0x55, 0x55, 0x94, 0xc9,
-    0x75, 0x16, 0x75, 0xc8, 0x94, 0x54, 0x54, 0x94, 0xc8, 0x75, 0x50, 0x91, 0x6e, 0x40, 0x40, 0x6e, 0x91, 0x50, 0x16,
-    0x4f, 0x91, 0x6e, 0x41, 0x41, 0x6e, 0x91, 0x4f, 0x00, 0x00, 0x03, 0x00, 0x4d, 0xff, 0xeb, 0x04, 0x83, 0x07, 0x51,
-    0x00, 0x34, 0x00, 0x4c, 0x00, 0x58, 0x00, 0x69, 0x40, 0x66, 0x3f, 0x01, 0x0d, 0x0a, 0x41, 0x01, 0x00, 0x09, 0x58,
-    0x01, 0x04, 0x00, 0x0e, 0x01, 0x01, 0x05, 0x04, 0x4a, 0x00, 0x0d, 0x0a, 0x09, 0x0a, 0x0d, 0x09, 0x70, 0x00, 0x06,
-    0x04, 0x05, 0x04, 0x06, 0x05, 0x70, 0x00, 0x0b, 0x00, 0x0a, 0x0d, 0x0b, 0x0a, 0x63, 0x0e, 0x01, 0x0c, 0x00, 0x09,
-    0x00, 0x0c, 0x09, 0x63, 0x08, 0x01, 0x04, 0x04, 0x00, 0x5b, 0x03, 0x01, 0x00, 0x00, 0x16, 0x4b, 0x07, 0x01, 0x05,
-    0x05, 0x01, 0x5b, 0x02, 0x01, 0x01, 0x01, 0x1e, 0x01, 0x4c, 0x35, 0x35, 0x52, 0x51, 0x35, 0x4c, 0x35, 0x4b, 0x46,
-    0x44, 0x3d, 0x3b, 0x38, 0x36, 0x15, 0x23, 0x13, 0x25, 0x11, 0x19, 0x24, 0x29, 0x10, 0x0f, 0x06, 0x1d, 0x2b, 0x01,
-    0x32, 0x1e, 0x02, 0x15, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35,
-    0x11, 0x34, 0x3e, 0x02, 0x33, 0x15, 0x06, 0x06, 0x15, 0x11, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x11, 0x33, 0x11,
-    0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x11, 0x26, 0x26, 0x27, 0x13, 0x15, 0x23, 0x22, 0x2e, 0x02, 0x23, 0x22, 0x06,
-    0x15, 0x07, 0x23, 0x35, 0x34, 0x36, 0x33, 0x32, 0x1e, 0x04, 0x33, 0x01, 0x36, 0x36, 0x35, 0x35, 0x33, 0x15, 0x14,
-    0x0e, 0x02, 0x07, 0x03, 0x22, 0x4e, 0x82, 0x5d, 0x34, 0x2e, 0x53, 0x75, 0x46, 0x4c, 0x73, 0x20, 0x21, 0x73, 0x4b,
-    0x47, 0x74, 0x53, 0x2e, 0x33, 0x5d, 0x82, 0x4f, 0x4e, 0x59, 0x45, 0x3d, 0x3c, 0x46, 0xba, 0x46, 0x3c, 0x3c, 0x46,
-    0x01, 0x01, 0x5a, 0x4d, 0xbb, 0x2a, 0x49, 0x74, 0x60, 0x51, 0x26, 0x32, 0x39, 0x01, 0x7f, 0x7a, 0x6d, 0x22, 0x3f,
-    0x3d, 0x3e, 0x44, 0x4d, 0x2d, 0xfe, 0x48, 0x21, 0x22, 0x8b, 0x16, 0x24, 0x2f, 0x19, 0x05, 0xaf, 0x33, 0x64, 0x93,
-    0x60, 0xfd, 0x2b, 0x57, 0x85, 0x5a, 0x2f, 0x48, 0x46, 0x46, 0x48, 0x2f, 0x5a, 0x85, 0x57, 0x02, 0xd5, 0x60, 0x93,
-    0x64, 0x33, 0x97, 0x01, 0x7e, 0x74, 0xfd, 0x2b, 0x61, 0x6d, 0x64, 0x58, 0x01, 0xfc, 0xfe, 0x04, 0x58, 0x64, 0x6d,
-    0x61, 0x02, 0xd5, 0x74, 0x7e, 0x01, 0x01, 0xbb, 0x7f, 0x28, 0x2f, 0x27, 0x36, 0x37, 0x12, 0x24, 0x6e, 0x6c, 0x13,
-    0x1b, 0x21, 0x1c, 0x13, 0xfe, 0x90, 0x28, 0x47, 0x26, 0x60, 0x66, 0x1d, 0x3b, 0x35, 0x2d, 0x0d, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x67, 0xff, 0xeb, 0x04, 0x7c, 0x05, 0xde, 0x00, 0x34, 0x00, 0x4a, 0x00, 0x56, 0x00, 0xb2, 0x40,
-    0x12, 0x3f, 0x01, 0x0d, 0x0a, 0x41, 0x01, 0x00, 0x09, 0x56, 0x01, 0x04, 0x00, 0x0e, 0x01, 0x01, 0x05, 0x04, 0x4a,
-    0x4b, 0xb0, 0x26, 0x50, 0x58, 0x40, 0x3c, 0x00, 0x0d, 0x0a, 0x09, 0x0a, 0x0d, 0x09, 0x70, 0x00, 0x06, 0x04, 0x05,
-    0x04, 0x06, 0x05, 0x70, 0x0e, 0x01, 0x0c, 0x00, 0x09, 0x00, 0x0c, 0x09, 0x63, 0x00, 0x0a, 0x0a, 0x0b, 0x5b, 0x00,
-    0x0b, 0x0b, 0x1d, 0x4b, 0x08, 0x01, 0x04, 0x04, 0x00, 0x5b, 0x03, 0x01, 0x00, 0x00, 0x1f, 0x4b, 0x07, 0x01, 0x05,
-    0x05, 0x01, 0x5b, 0x02, 0x01, 0x01, 0x01, 0x1e, 0x01, 0x4c, 0x1b, 0x40, 0x3a, 0x00, 0x0d, 0x0a, 0x09, 0x0a, 0x0d,
-    0x09, 0x70, 0x00, 0x06, 0x04, 0x05, 0x04, 0x06, 0x05, 0x70, 0x00, 0x0b, 0x00, 0x0a, 0x0d, 0x0b, 0x0a, 0x63, 0x0e,
-    0x01, 0x0c, 0x00, 0x09, 0x00, 0x0c, 0x09, 0x63, 0x08, 0x01, 0x04, 0x04, 0x00, 0x5b, 0x03, 0x01, 0x00, 0x00, 0x1f,
-    0x4b, 0x07, 0x01, 0x05, 0x05, 0x01, 0x5b, 0x02, 0x01, 0x01, 0x01, 0x1e, 0x01, 0x4c, 0x59, 0x40, 0x1a, 0x35, 0x35,
-    0x50, 0x4f, 0x35, 0x4a, 0x35, 0x49, 0x46, 0x44, 0x3d, 0x3b, 0x38, 0x36, 0x15, 0x23, 0x13, 0x25, 0x11, 0x19, 0x24,
-    0x29, 0x10, 0x0f, 0x06, 0x1d, 0x2b, 0x01, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27,
-    0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x34, 0x3e, 0x02, 0x33, 0x15, 0x06, 0x06, 0x15, 0x11, 0x14, 0x16,
-    0x33, 0x32, 0x36, 0x37, 0x11, 0x33, 0x11, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x11, 0x34, 0x26, 0x27, 0x13, 0x15,
-    0x23, 0x22, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x15, 0x07, 0x23, 0x35, 0x34, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x33, 0x01,
-    0x36, 0x36, 0x35, 0x35, 0x33, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x03, 0x2d, 0x4a, 0x7b, 0x59, 0x31, 0x2b, 0x4f, 0x6e,
-    0x43, 0x4c, 0x72, 0x21, 0x21, 0x73, 0x4c, 0x43, 0x6e, 0x4f, 0x2b, 0x31, 0x58, 0x7b, 0x4b, 0x45, 0x50, 0x3b, 0x36,
-    0x3c, 0x46, 0x01, 0xba, 0x46, 0x3c, 0x35, 0x3d, 0x51, 0x45, 0xc2, 0x2b, 0x4a, 0x74, 0x61, 0x51, 0x27, 0x32, 0x3a,
-    0x01, 0x7f, 0x7b, 0x6d, 0x34, 0x5b, 0x5f, 0x6c, 0x44, 0xfe, 0x43, 0x21, 0x22, 0x8b, 0x16, 0x24, 0x2f, 0x19, 0x04,
-    0x4d, 0x32, 0x63, 0x92, 0x60, 0xfe, 0x86, 0x57, 0x84, 0x59, 0x2d, 0x46, 0x46, 0x46, 0x46, 0x2d, 0x59, 0x84, 0x57,
-    0x01, 0x7a, 0x60, 0x92, 0x63, 0x32, 0x97, 0x01, 0x79, 0x76, 0xfe, 0x86, 0x61, 0x69, 0x60, 0x58, 0x01, 0x0d, 0xfe,
-    0xf3, 0x58, 0x60, 0x69, 0x61, 0x01, 0x7a, 0x76, 0x79, 0x01, 0x01, 0xaa, 0x7f, 0x28, 0x2f, 0x27, 0x36, 0x37, 0x12,
-    0x25, 0x6e, 0x6b, 0x27, 0x2f, 0x28, 0xfe, 0x8f, 0x28, 0x47, 0x26, 0x60, 0x66, 0x1d, 0x3b, 0x35, 0x2d, 0x0d, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x71, 0xff, 0xec, 0x04, 0x85, 0x07, 0x04, 0x00, 0x07, 0x00, 0x2c, 0x00, 0x74, 0xb5,
-    0x11, 0x01, 0x04, 0x07, 0x01, 0x4a, 0x4b, 0xb0, 0x14, 0x50, 0x58, 0x40, 0x25, 0x00, 0x02, 0x01, 0x06, 0x01, 0x02,
-    0x68, 0x00, 0x00, 0x03, 0x01, 0x01, 0x02, 0x00, 0x01, 0x61, 0x0b, 0x0a, 0x08, 0x03, 0x06, 0x06, 0x16, 0x4b, 0x09,
-    0x01, 0x07, 0x07, 0x04, 0x5b, 0x05, 0x01, 0x04, 0x04, 0x1e, 0x04, 0x4c, 0x1b, 0x40, 0x26, 0x00, 0x02, 0x01, 0x06,
-    0x01, 0x02, 0x06, 0x70, 0x00, 0x00, 0x03, 0x01, 0x01, 0x02, 0x00, 0x01, 0x61, 0x0b, 0x0a, 0x08, 0x03, 0x06, 0x06,
-    0x16, 0x4b, 0x09, 0x01, 0x07, 0x07, 0x04, 0x5b, 0x05, 0x01, 0x04, 0x04, 0x1e, 0x04, 0x4c, 0x59, 0x40, 0x14, 0x08,
-    0x08, 0x08, 0x2c, 0x08, 0x2c, 0x29, 0x27, 0x13, 0x23, 0x15, 0x24, 0x26, 0x11, 0x11, 0x11, 0x10, 0x0c, 0x06, 0x1d,
-    0x2b, 0x01, 0x21, 0x17, 0x21, 0x15, 0x23, 0x35, 0x21, 0x05, 0x13, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x06,
-    0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x13, 0x33, 0x13, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x13, 0x33, 0x11, 0x14,
-    0x16, 0x33, 0x32, 0x36, 0x35, 0x13, 0x01, 0x1b, 0x02, 0xd0, 0x01, 0xfe, 0xe3, 0xa8, 0xfe, 0xf4, 0x03, 0x69, 0x01,
-    0x2b, 0x4e, 0x6d, 0x42, 0x4e, 0x74, 0x20, 0x20, 0x74, 0x4d, 0x43, 0x6d, 0x4e, 0x2b, 0x01, 0xb8, 0x01, 0x3b, 0x34,
-    0x3c, 0x45, 0x01, 0xbf, 0x45, 0x3d, 0x34, 0x3a, 0x01, 0x07, 0x04, 0x6c, 0x7d, 0x7d, 0xe8, 0xfb, 0x8e, 0x52, 0x7e,
-    0x56, 0x2c, 0x4a, 0x49, 0x48, 0x4b, 0x2c, 0x56, 0x7e, 0x52, 0x04, 0x72, 0xfb, 0x8e, 0x58, 0x64, 0x64, 0x58, 0x04,
-    0x72, 0xfb, 0x8e, 0x58, 0x64, 0x64, 0x58, 0x04, 0x72, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5f, 0xff, 0xeb, 0x04, 0x7a,
-    0x05, 0xb0, 0x00, 0x07, 0x00, 0x2c, 0x00, 0x78, 0xb5, 0x11, 0x01, 0x04, 0x07, 0x01, 0x4a, 0x4b, 0xb0, 0x14, 0x50,
-    0x58, 0x40, 0x27, 0x00, 0x02, 0x01, 0x06, 0x01, 0x02, 0x68, 0x03, 0x01, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x00,
-    0x16, 0x4b, 0x0b, 0x0a, 0x08, 0x03, 0x06, 0x06, 0x18, 0x4b, 0x09, 0x01, 0x07, 0x07, 0x04, 0x5b, 0x05, 0x01, 0x04,
-    0x04, 0x1e, 0x04, 0x4c, 0x1b, 0x40, 0x28, 0x00, 0x02, 0x01, 0x06, 0x01, 0x02, 0x06, 0x70, 0x03, 0x01, 0x01, 0x01,
-    0x00, 0x59, 0x00, 0x00, 0x00, 0x16, 0x4b, 0x0b, 0x0a, 0x08, 0x03, 0x06, 0x06, 0x18, 0x4b, 0x09, 0x01, 0x07, 0x07,
-    0x04, 0x5b, 0x05, 0x01, 0x04, 0x04, 0x1e, 0x04, 0x4c, 0x59, 0x40, 0x14, 0x08, 0x08, 0x08, 0x2c, 0x08, 0x2c, 0x29,
-    0x27, 0x13, 0x23, 0x15, 0x24, 0x26, 0x11, 0x11, 0x11, 0x10, 0x0c, 0x06, 0x1d, 0x2b, 0x01, 0x21, 0x17, 0x21, 0x15,
-    0x23, 0x35, 0x21, 0x01, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35,
-    0x13, 0x33, 0x11, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x11, 0x33, 0x13, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x11,
-    0x01, 0x04, 0x02, 0xd6, 0x01, 0xfe, 0xe0, 0xa8, 0xfe, 0xf1, 0x03, 0x76, 0x2b, 0x4f, 0x6e, 0x42, 0x4e, 0x75, 0x21,
-    0x20, 0x74, 0x4e, 0x43, 0x6e, 0x4e, 0x2c, 0x01, 0xb9, 0x3c, 0x35, 0x3c, 0x47, 0xbf, 0x01, 0x46, 0x3d, 0x34, 0x3d,
-    0x05, 0xb0, 0x6c, 0x7f, 0x7f, 0xfe, 0xf7, 0xfd, 0x01, 0x52, 0x7e, 0x55, 0x2c, 0x4a, 0x49, 0x48, 0x4b, 0x2c, 0x55,
-    0x7e, 0x52, 0x02, 0xff, 0xfd, 0x01, 0x58, 0x62, 0x62, 0x58, 0x02, 0xff, 0xfd, 0x01, 0x58, 0x62, 0x62, 0x58, 0x02,
-    0xff, 0x00, 0x01, 0x00, 0x97, 0xfe, 0x82, 0x04, 0x65, 0x05, 0xc5, 0x00, 0x24, 0x00, 0x53, 0xb5, 0x02, 0x01, 0x00,
-    0x04, 0x01, 0x4a, 0x4b, 0xb0, 0x1d, 0x50, 0x58, 0x40, 0x1d, 0x00, 0x02, 0x03, 0x04, 0x03, 0x02, 0x04, 0x70, 0x00,
-    0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x1d, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x59, 0x00, 0x00, 0x00, 0x1a, 0x00,
-    0x4c, 0x1b, 0x40, 0x1a, 0x00, 0x02, 0x03, 0x04, 0x03, 0x02, 0x04, 0x70, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x5d,
-    0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x1d, 0x03, 0x4c, 0x59, 0xb7, 0x29, 0x24, 0x14, 0x2b, 0x10, 0x05,
-    0x06, 0x19, 0x2b, 0x01, 0x23, 0x11, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23,
-    0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x33, 0x03, 0x2a, 0xb9, 0x6e, 0xaf, 0x7b,
-    0x42, 0x46, 0x82, 0xb8, 0x72, 0x6e, 0xb0, 0x7b, 0x43, 0xb9, 0x01, 0x26, 0x49, 0x6c, 0x47, 0x4b, 0x75, 0x50, 0x29,
-    0x30, 0x5d, 0x88, 0x58, 0x6d, 0xfe, 0x82, 0x01, 0x6f, 0x0e, 0x6b, 0xa5, 0xd5, 0x79, 0xf7, 0x83, 0xe4, 0xa9, 0x61,
-    0x45, 0x80, 0xb3, 0x6e, 0x4b, 0x7c, 0x57, 0x30, 0x4d, 0x81, 0xab, 0x5e, 0xf9, 0x5f, 0xac, 0x83, 0x4d, 0x00, 0x00,
-    0x01, 0x00, 0xbf, 0xfe, 0x82, 0x04, 0x3b, 0x04, 0x4e, 0x00, 0x24, 0x00, 0x53, 0xb5, 0x02, 0x01, 0x00, 0x04, 0x01,
-    0x4a, 0x4b, 0xb0, 0x1d, 0x50, 0x58, 0x40, 0x1d, 0x00, 0x02, 0x03, 0x04, 0x03, 0x02, 0x04, 0x70, 0x00, 0x03, 0x03,
-    0x01, 0x5b, 0x00, 0x01, 0x01, 0x1f, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x59, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x4c, 0x1b,
-    0x40, 0x1a, 0x00, 0x02, 0x03, 0x04, 0x03, 0x02, 0x04, 0x70, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x5d, 0x00, 0x03,
-    0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x1f, 0x03, 0x4c, 0x59, 0xb7, 0x29, 0x24, 0x14, 0x2b, 0x10, 0x05, 0x06, 0x19,
-    0x2b, 0x01, 0x23, 0x11, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34, 0x2e,
-    0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x33, 0x02, 0xfd, 0xb9, 0x5f, 0x91, 0x62, 0x33,
-    0x3e, 0x78, 0xb0, 0x72, 0x5b, 0x9a, 0x70, 0x3f, 0xaf, 0x26, 0x41, 0x5a, 0x34, 0x4c, 0x6c, 0x46, 0x21, 0x20, 0x46,
-    0x6c, 0x4d, 0x66, 0xfe, 0x82, 0x01, 0x70, 0x10, 0x61, 0x90, 0xb3, 0x62, 0x2a, 0x6b, 0xc4, 0x95, 0x58, 0x3d, 0x6a,
-    0x8f, 0x53, 0x31, 0x58, 0x42, 0x26, 0x45, 0x6f, 0x8b, 0x45, 0x2a, 0x47, 0x8b, 0x6f, 0x45, 0x00, 0x00, 0x01, 0x00,
-    0x76, 0x00, 0x00, 0x04, 0x92, 0x05, 0x3e, 0x00, 0x13, 0x00, 0x27, 0x40, 0x24, 0x13, 0x12, 0x11, 0x10, 0x0d, 0x0c,
-    0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x03, 0x02, 0x01, 0x0f, 0x00, 0x01, 0x01, 0x4a, 0x00, 0x01, 0x00, 0x01, 0x72,
-    0x00, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x19, 0x14, 0x02, 0x06, 0x16, 0x2b, 0x01, 0x05, 0x07, 0x25, 0x03, 0x23, 0x13,
-    0x25, 0x37, 0x05, 0x13, 0x25, 0x37, 0x05, 0x13, 0x33, 0x03, 0x05, 0x07, 0x25, 0x02, 0x5a, 0x01, 0x21, 0x44, 0xfe,
-    0xdd, 0xb6, 0xa8, 0xe1, 0xfe, 0xdf, 0x44, 0x01, 0x25, 0xcd, 0xfe, 0xde, 0x46, 0x01, 0x23, 0xbc, 0xa5, 0xe7, 0x01,
-    0x25, 0x48, 0xfe, 0xe0, 0x01, 0xbe, 0xac, 0x7b, 0xaa, 0xfe, 0xbf, 0x01, 0x8e, 0xab, 0x7b, 0xab, 0x01, 0x6d, 0xab,
-    0x7d, 0xab, 0x01, 0x4b, 0xfe, 0x68, 0xab, 0x7a, 0xaa, 0x00, 0x00, 0x00, 0x01, 0x00, 0xd1, 0x04, 0xa6, 0x03, 0x91,
-    0x05, 0xfc, 0x00, 0x07, 0x00, 0x8c, 0x4b, 0xb0, 0x14, 0x50, 0x58, 0x40, 0x18, 0x00, 0x02, 0x01, 0x01, 0x02, 0x66,
-    0x00, 0x00, 0x03, 0x03, 0x00, 0x67, 0x04, 0x01, 0x03, 0x03, 0x01, 0x59, 0x00, 0x01, 0x01, 0x16, 0x03, 0x4c, 0x1b,
-    0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x17, 0x00, 0x02, 0x01, 0x01, 0x02, 0x66, 0x00, 0x00, 0x03, 0x00, 0x73, 0x04,
-    0x01, 0x03, 0x03, 0x01, 0x59, 0x00, 0x01, 0x01, 0x16, 0x03, 0x4c, 0x1b, 0x4b, 0xb0, 0x1f, 0x50, 0x58, 0x40, 0x16,
-    0x00, 0x02, 0x01, 0x02, 0x72, 0x00, 0x00, 0x03, 0x00, 0x73, 0x04, 0x01, 0x03, 0x03, 0x01, 0x59, 0x00, 0x01, 0x01,
-    0x16, 0x03, 0x4c, 0x1b, 0x40, 0x1b, 0x00, 0x02, 0x01, 0x02, 0x72, 0x00, 0x00, 0x03, 0x00, 0x73, 0x00, 0x01, 0x03,
-    0x03, 0x01, 0x55, 0x00, 0x01, 0x01, 0x03, 0x5a, 0x04, 0x01, 0x03, 0x01, 0x03, 0x4e, 0x59, 0x59, 0x59, 0x40, 0x0c,
-    0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x11, 0x11, 0x11, 0x05, 0x06, 0x17, 0x2b, 0x01, 0x15, 0x27, 0x37, 0x21, 0x27,
-    0x17, 0x15, 0x01, 0x77, 0xa6, 0x01, 0x02, 0x1b, 0x01, 0xa5, 0x05, 0x23, 0x7d, 0x01, 0xe9, 0x6c, 0x01, 0xd8, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0xfc, 0x05, 0x17, 0x03, 0xf0, 0x06, 0x15, 0x00, 0x17, 0x00, 0x4f, 0x4b, 0xb0, 0x26, 0x50,
-    0x58, 0x40, 0x15, 0x00, 0x01, 0x00, 0x03, 0x02, 0x01, 0x03, 0x63, 0x04, 0x01, 0x02, 0x02, 0x00, 0x5b, 0x05, 0x01,
-    0x00, 0x00, 0x16, 0x02, 0x4c, 0x1b, 0x40, 0x1b, 0x05, 0x01, 0x00, 0x03, 0x02, 0x00, 0x57, 0x00, 0x01, 0x00, 0x03,
-    0x02, 0x01, 0x03, 0x63, 0x05, 0x01, 0x00, 0x00, 0x02, 0x5b, 0x04, 0x01, 0x02, 0x00, 0x02, 0x4f, 0x59, 0x40, 0x11,
-    0x01, 0x00, 0x16, 0x14, 0x11, 0x0f, 0x0c, 0x0b, 0x08, 0x06, 0x00, 0x17, 0x01, 0x17, 0x06, 0x06, 0x14, 0x2b, 0x01,
-    0x32, 0x3e, 0x04, 0x33, 0x32, 0x16, 0x15, 0x15, 0x23, 0x35, 0x34, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x23, 0x23, 0x35,
-    0x01, 0x26, 0x34, 0x5a, 0x4f, 0x48, 0x47, 0x48, 0x28, 0x6e, 0x80, 0x80, 0x3f, 0x33, 0x2d, 0x5e, 0x6f, 0x87, 0x55,
-    0x2c, 0x05, 0x96, 0x13, 0x1c, 0x21, 0x1c, 0x13, 0x6c, 0x6e, 0x24, 0x12, 0x38, 0x34, 0x27, 0x2f, 0x27, 0x7e, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0xc3, 0x05, 0x16, 0x02, 0xb2, 0x06, 0x57, 0x00, 0x05, 0x00, 0x12, 0x40, 0x0f, 0x05, 0x04,
-    0x03, 0x00, 0x04, 0x00, 0x47, 0x00, 0x00, 0x00, 0x69, 0x11, 0x01, 0x06, 0x15, 0x2b, 0x01, 0x35, 0x33, 0x07, 0x17,
-    0x07, 0x01, 0xc3, 0xb4, 0x01, 0x3c, 0x4e, 0x05, 0xdc, 0x7b, 0x8c, 0x74, 0x41, 0x00, 0x00, 0x00, 0x01, 0x02, 0x3c,
-    0x05, 0x16, 0x03, 0x2a, 0x06, 0x57, 0x00, 0x05, 0x00, 0x11, 0x40, 0x0e, 0x05, 0x02, 0x01, 0x03, 0x00, 0x47, 0x00,
-    0x00, 0x00, 0x69, 0x13, 0x01, 0x06, 0x15, 0x2b, 0x01, 0x27, 0x37, 0x35, 0x33, 0x15, 0x02, 0x88, 0x4c, 0x3a, 0xb4,
-    0x05, 0x16, 0x41, 0x74, 0x8c, 0x7b, 0x00, 0x08, 0xfe, 0xe7, 0xfe, 0xc4, 0x06, 0x83, 0x05, 0xaf, 0x00, 0x15, 0x00,
-    0x2b, 0x00, 0x41, 0x00, 0x57, 0x00, 0x6d, 0x00, 0x83, 0x00, 0x99, 0x00, 0xaf, 0x01, 0x3d, 0x4b, 0xb0, 0x1f, 0x50,
-    0x58, 0x40, 0x66, 0x20, 0x03, 0x02, 0x01, 0x02, 0x04, 0x02, 0x01, 0x04, 0x70, 0x25, 0x17, 0x15, 0x21, 0x07, 0x05,
-    0x05, 0x06, 0x08, 0x06, 0x05, 0x08, 0x70, 0x26, 0x1b, 0x19, 0x22, 0x0b, 0x05, 0x09, 0x0a, 0x0c, 0x0a, 0x09, 0x0c,
-    0x70, 0x24, 0x13, 0x02, 0x11, 0x12, 0x11, 0x73, 0x14, 0x01, 0x04, 0x16, 0x01, 0x06, 0x05, 0x04, 0x06, 0x63, 0x18,
-    0x01, 0x08, 0x1a, 0x01, 0x0a, 0x09, 0x08, 0x0a, 0x63, 0x1c, 0x01, 0x0c, 0x1e, 0x01, 0x0e, 0x0d, 0x0c, 0x0e, 0x63,
-    0x00, 0x10, 0x00, 0x12, 0x11, 0x10, 0x12, 0x63, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x16, 0x4b, 0x27,
-    0x1f, 0x1d, 0x23, 0x0f, 0x05, 0x0d, 0x0d, 0x17, 0x0d, 0x4c, 0x1b, 0x40, 0x69, 0x20, 0x03, 0x02, 0x01, 0x02, 0x04,
-    0x02, 0x01, 0x04, 0x70, 0x25, 0x17, 0x15, 0x21, 0x07, 0x05, 0x05, 0x06, 0x08, 0x06, 0x05, 0x08, 0x70, 0x26, 0x1b,
-    0x19, 0x22, 0x0b, 0x05, 0x09, 0x0a, 0x0c, 0x0a, 0x09, 0x0c, 0x70, 0x27, 0x1f, 0x1d, 0x23, 0x0f, 0x05, 0x0d, 0x0e,
-    0x10, 0x0e, 0x0d, 0x10, 0x70, 0x24, 0x13, 0x02, 0x11, 0x12, 0x11, 0x73, 0x14, 0x01, 0x04, 0x16, 0x01, 0x06, 0x05,
-    0x04, 0x06, 0x63, 0x18, 0x01, 0x08, 0x1a, 0x01, 0x0a, 0x09, 0x08, 0x0a, 0x63, 0x1c, 0x01, 0x0c, 0x1e, 0x01, 0x0e,
-    0x0d, 0x0c, 0x0e, 0x63, 0x00, 0x10, 0x00, 0x12, 0x11, 0x10, 0x12, 0x63, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00,
-    0x00, 0x16, 0x02, 0x4c, 0x59, 0x40, 0x60, 0x9a, 0x9a, 0x84, 0x84, 0x6e, 0x6e, 0x58, 0x58, 0x42, 0x42, 0x2c, 0x2c,
-    0x16, 0x16, 0x00, 0x00, 0x9a, 0xaf, 0x9a, 0xaf, 0xab, 0xa9, 0xa5, 0xa4, 0xa0, 0x9e, 0x84, 0x99, 0x84, 0x99, 0x95,
-    0x93, 0x8f, 0x8e, 0x8a, 0x88, 0x6e, 0x83, 0x6e, 0x83, 0x7f, 0x7d, 0x79, 0x78, 0x74, 0x72, 0x58, 0x6d, 0x58, 0x6d,
-    0x69, 0x67, 0x63, 0x62, 0x5e, 0x5c, 0x42, 0x57, 0x42, 0x57, 0x53, 0x51, 0x4d, 0x4c, 0x48, 0x46, 0x2c, 0x41, 0x2c,
-    0x41, 0x3d, 0x3b, 0x37, 0x36, 0x32, 0x30, 0x16, 0x2b, 0x16, 0x2b, 0x27, 0x25, 0x21, 0x20, 0x1c, 0x1a, 0x00, 0x15,
-    0x00, 0x15, 0x24, 0x14, 0x24, 0x28, 0x06, 0x17, 0x2b, 0x01, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23,
-    0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x01, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34,
-    0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x13, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34, 0x2e,
-    0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x01, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34, 0x2e, 0x02,
-    0x23, 0x22, 0x0e, 0x02, 0x15, 0x01, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34, 0x2e, 0x02, 0x23,
-    0x22, 0x0e, 0x02, 0x15, 0x01, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34, 0x2e, 0x02, 0x23, 0x22,
-    0x0e, 0x02, 0x15, 0x01, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e,
-    0x02, 0x15, 0x13, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02,
-    0x15, 0x01, 0xd4, 0x1d, 0x37, 0x4e, 0x30, 0x30, 0x4e, 0x37, 0x1e, 0x70, 0x0b, 0x18, 0x25, 0x1b, 0x1b, 0x25, 0x17,
-    0x0a, 0x01, 0xde, 0x1e, 0x36, 0x4e, 0x30, 0x30, 0x4e, 0x38, 0x1e, 0x71, 0x0b, 0x18, 0x25, 0x1b, 0x1a, 0x25, 0x17,
-    0x0a, 0x49, 0x1e, 0x36, 0x4e, 0x30, 0x30, 0x4e, 0x37, 0x1e, 0x70, 0x0b, 0x18, 0x25, 0x1b, 0x1a, 0x25, 0x17, 0x0b,
-    0xfe, 0xca, 0x1e, 0x36, 0x4e, 0x30, 0x30, 0x4e, 0x37, 0x1e, 0x70, 0x0b, 0x18, 0x25, 0x1b, 0x1a, 0x25, 0x17, 0x0b,
-    0xfd, 0x4f, 0x1d, 0x37, 0x4e, 0x30, 0x30, 0x4e, 0x37, 0x1e, 0x70, 0x0b, 0x18, 0x25, 0x1b, 0x1a, 0x25, 0x17, 0x0b,
-    0xfd, 0x4d, 0x1e, 0x37, 0x4e, 0x30, 0x30, 0x4e, 0x37, 0x1e, 0x70, 0x0b, 0x18, 0x25, 0x1b, 0x1b, 0x25, 0x17, 0x0a,
-    0xfe, 0xde, 0x1e, 0x37, 0x4d, 0x30, 0x30, 0x4e, 0x37, 0x1e, 0x70, 0x0b, 0x18, 0x25, 0x1b, 0x1a, 0x24, 0x18, 0x0b,
-    0x35, 0x1e, 0x37, 0x4d, 0x30, 0x30, 0x4e, 0x38, 0x1e, 0x71, 0x0b, 0x18, 0x25, 0x1b, 0x1a, 0x25, 0x16, 0x0b, 0x04,
-    0xf3, 0x29, 0x45, 0x32, 0x1c, 0x1c, 0x32, 0x45, 0x29, 0x14, 0x24, 0x1c, 0x11, 0x11, 0x1c, 0x24, 0x14, 0xfe, 0xeb,
-    0x29, 0x45, 0x32, 0x1c, 0x1c, 0x32, 0x45, 0x29, 0x14, 0x24, 0x1c, 0x11, 0x11, 0x1c, 0x24, 0x14, 0xfe, 0x09, 0x29,
-    0x45, 0x32, 0x1c, 0x1c, 0x32, 0x45, 0x29, 0x14, 0x24, 0x1c, 0x11, 0x11, 0x1c, 0x24, 0x14, 0xfd, 0xf9, 0x29, 0x45,
-    0x32, 0x1c, 0x1c, 0x32, 0x45, 0x29, 0x14, 0x24, 0x1c, 0x11, 0x11, 0x1c, 0x24, 0x14, 0xfe, 0xe4, 0x2a, 0x45, 0x31,
-    0x1c, 0x1c, 0x31, 0x45, 0x2a, 0x14, 0x25, 0x1c, 0x10, 0x10, 0x1c, 0x25, 0x14, 0x05, 0x1a, 0x29, 0x45, 0x32, 0x1c,
-    0x1c, 0x32, 0x45, 0x29, 0x14, 0x24, 0x1c, 0x11, 0x11, 0x1c, 0x24, 0x14, 0xfe, 0x09, 0x29, 0x45, 0x32, 0x1c, 0x1c,
-    0x32, 0x45, 0x29, 0x14, 0x24, 0x1c, 0x11, 0x11, 0x1c, 0x24, 0x14, 0xfd, 0xf9, 0x29, 0x45, 0x32, 0x1c, 0x1c, 0x32,
-    0x45, 0x29, 0x14, 0x24, 0x1c, 0x11, 0x11, 0x1c, 0x24, 0x14, 0x00, 0x00, 0x08, 0x00, 0x4e, 0xfe, 0x63, 0x07, 0x8e,
-    0x05, 0xc6, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0e, 0x00, 0x13, 0x00, 0x18, 0x00, 0x1d, 0x00, 0x22, 0x00, 0x27, 0x00,
-    0x6d, 0x40, 0x1f, 0x21, 0x20, 0x16, 0x03, 0x03, 0x02, 0x27, 0x22, 0x1d, 0x18, 0x17, 0x13, 0x12, 0x11, 0x0f, 0x0e,
-    0x0d, 0x0c, 0x0a, 0x0d, 0x01, 0x03, 0x26, 0x25, 0x1c, 0x1b, 0x04, 0x00, 0x01, 0x03, 0x4a, 0x4b, 0xb0, 0x2e, 0x50,
-    0x58, 0x40, 0x17, 0x05, 0x01, 0x03, 0x03, 0x02, 0x59, 0x00, 0x02, 0x02, 0x16, 0x4b, 0x04, 0x01, 0x01, 0x01, 0x00,
-    0x59, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x4c, 0x1b, 0x40, 0x15, 0x00, 0x02, 0x05, 0x01, 0x03, 0x01, 0x02, 0x03, 0x61,
-    0x04, 0x01, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x4c, 0x59, 0x40, 0x12, 0x05, 0x05, 0x00, 0x00,
-    0x05, 0x09, 0x05, 0x09, 0x08, 0x07, 0x00, 0x04, 0x00, 0x04, 0x12, 0x06, 0x06, 0x15, 0x2b, 0x05, 0x17, 0x03, 0x23,
-    0x13, 0x03, 0x27, 0x13, 0x33, 0x03, 0x01, 0x37, 0x05, 0x15, 0x25, 0x05, 0x07, 0x25, 0x35, 0x05, 0x01, 0x37, 0x25,
-    0x17, 0x05, 0x01, 0x07, 0x05, 0x27, 0x25, 0x03, 0x27, 0x03, 0x37, 0x13, 0x01, 0x17, 0x13, 0x07, 0x03, 0x04, 0x51,
-    0x0b, 0x7a, 0x60, 0x46, 0x3a, 0x0c, 0x7a, 0x60, 0x46, 0x02, 0x1e, 0x0d, 0x01, 0x4d, 0xfe, 0xa6, 0xfb, 0x74, 0x0d,
-    0xfe, 0xb3, 0x01, 0x5a, 0x03, 0x9c, 0x02, 0x01, 0x41, 0x44, 0xfe, 0xda, 0xfc, 0xf3, 0x02, 0xfe, 0xc0, 0x45, 0x01,
-    0x26, 0x2b, 0x11, 0x94, 0x41, 0xc6, 0x03, 0x60, 0x11, 0x95, 0x42, 0xc5, 0x3c, 0x0e, 0xfe, 0xad, 0x01, 0x61, 0x04,
-    0xa2, 0x0e, 0x01, 0x52, 0xfe, 0xa0, 0xfe, 0x11, 0x0c, 0x7c, 0x62, 0x47, 0x3b, 0x0c, 0x7c, 0x62, 0x47, 0x01, 0xae,
-    0x10, 0x99, 0x44, 0xc8, 0xfc, 0x8e, 0x11, 0x99, 0x45, 0xc8, 0x02, 0xe4, 0x02, 0x01, 0x46, 0x45, 0xfe, 0xd5, 0xfc,
-    0xe3, 0x02, 0xfe, 0xbb, 0x47, 0x01, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xbf, 0x00, 0x00, 0x04, 0x79, 0x05,
-    0xb0, 0x00, 0x03, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x36, 0x40, 0x33, 0x03, 0x02, 0x02, 0x03, 0x04, 0x01, 0x01, 0x00,
-    0x02, 0x02, 0x4a, 0x00, 0x03, 0x05, 0x01, 0x02, 0x00, 0x03, 0x02, 0x63, 0x00, 0x04, 0x04, 0x01, 0x5b, 0x00, 0x01,
-    0x01, 0x16, 0x4b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x04, 0x04, 0x1f, 0x1d, 0x15, 0x13, 0x04, 0x12, 0x04, 0x11,
-    0x21, 0x15, 0x06, 0x06, 0x16, 0x2b, 0x01, 0x07, 0x01, 0x37, 0x01, 0x11, 0x23, 0x11, 0x21, 0x1e, 0x03, 0x15, 0x14,
-    0x0e, 0x02, 0x07, 0x25, 0x21, 0x3e, 0x03, 0x35, 0x34, 0x2e, 0x02, 0x27, 0x21, 0x04, 0x31, 0x84, 0xfe, 0x95, 0x83,
-    0xfe, 0xb3, 0xb9, 0x01, 0xd8, 0x62, 0xaf, 0x84, 0x4d, 0x4d, 0x84, 0xaf, 0x62, 0xfe, 0xe1, 0x01, 0x1f, 0x40, 0x6c,
-    0x50, 0x2d, 0x2d, 0x4f, 0x6d, 0x40, 0xfe, 0xe1, 0x01, 0xd3, 0x46, 0x01, 0xec, 0x46, 0xfe, 0x89, 0xfd, 0xb8, 0x05,
-    0xb0, 0x02, 0x3a, 0x6e, 0xa2, 0x69, 0x69, 0xa1, 0x6e, 0x3a, 0x01, 0x98, 0x01, 0x27, 0x48, 0x67, 0x42, 0x42, 0x6a,
-    0x4a, 0x28, 0x01, 0x00, 0x03, 0x00, 0xad, 0xfe, 0x60, 0x04, 0x3f, 0x04, 0x4e, 0x00, 0x03, 0x00, 0x19, 0x00, 0x2b,
-    0x00, 0x68, 0x40, 0x15, 0x11, 0x01, 0x04, 0x02, 0x23, 0x22, 0x03, 0x02, 0x04, 0x05, 0x04, 0x0c, 0x01, 0x00, 0x05,
-    0x01, 0x01, 0x01, 0x00, 0x04, 0x4a, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x1b, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x03,
-    0x01, 0x02, 0x02, 0x18, 0x4b, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x1e, 0x4b, 0x00, 0x01, 0x01, 0x1a,
-    0x01, 0x4c, 0x1b, 0x40, 0x1f, 0x00, 0x02, 0x02, 0x18, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x1f,
-    0x4b, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x1e, 0x4b, 0x00, 0x01, 0x01, 0x1a, 0x01, 0x4c, 0x59, 0x40,
-    0x09, 0x25, 0x29, 0x23, 0x11, 0x13, 0x28, 0x06, 0x06, 0x1a, 0x2b, 0x25, 0x07, 0x01, 0x37, 0x25, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x26, 0x27, 0x11, 0x23, 0x11, 0x33, 0x17, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34, 0x2e,
-    0x02, 0x23, 0x22, 0x06, 0x07, 0x11, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x04, 0x36, 0x70, 0xfe, 0x95, 0x71,
-    0x01, 0x73, 0x38, 0x6c, 0x9f, 0x66, 0x63, 0x97, 0x36, 0xb9, 0xa9, 0x09, 0x36, 0x99, 0x65, 0x68, 0xa0, 0x6c, 0x38,
-    0xb9, 0x23, 0x49, 0x70, 0x4e, 0x59, 0x79, 0x24, 0x24, 0x78, 0x5c, 0x4d, 0x70, 0x48, 0x23, 0x02, 0x5d, 0x01, 0x75,
-    0x5e, 0x99, 0x74, 0xc9, 0x94, 0x54, 0x40, 0x3c, 0xfd, 0xf8, 0x05, 0xda, 0x76, 0x43, 0x47, 0x52, 0x92, 0xcb, 0x79,
-    0x4f, 0x8f, 0x6d, 0x40, 0x53, 0x41, 0xfd, 0xf7, 0x40, 0x51, 0x41, 0x6e, 0x90, 0x4f, 0x00, 0x00, 0x01, 0x00, 0xb6,
-    0x00, 0x00, 0x04, 0x47, 0x06, 0xff, 0x00, 0x07, 0x00, 0x1f, 0x40, 0x1c, 0x00, 0x03, 0x02, 0x03, 0x72, 0x00, 0x00,
-    0x00, 0x02, 0x59, 0x00, 0x02, 0x02, 0x16, 0x4b, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x10, 0x04,
-    0x06, 0x18, 0x2b, 0x01, 0x21, 0x11, 0x23, 0x11, 0x21, 0x11, 0x33, 0x04, 0x47, 0xfd, 0x29, 0xba, 0x02, 0xd8, 0xb9,
-    0x05, 0x18, 0xfa, 0xe8, 0x05, 0xb0, 0x01, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb6, 0x00, 0x00, 0x04, 0x31,
-    0x05, 0x77, 0x00, 0x07, 0x00, 0x1f, 0x40, 0x1c, 0x00, 0x03, 0x02, 0x03, 0x72, 0x00, 0x00, 0x00, 0x02, 0x59, 0x00,
-    0x02, 0x02, 0x18, 0x4b, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x10, 0x04, 0x06, 0x18, 0x2b, 0x01,
-    0x21, 0x11, 0x23, 0x11, 0x21, 0x11, 0x33, 0x04, 0x31, 0xfd, 0x3f, 0xba, 0x02, 0xc1, 0xba, 0x03, 0xa1, 0xfc, 0x5f,
-    0x04, 0x3a, 0x01, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb9, 0xfe, 0xe0, 0x04, 0x7f, 0x05, 0xb0, 0x00, 0x1b,
-    0x00, 0x2c, 0x40, 0x29, 0x00, 0x01, 0x00, 0x04, 0x05, 0x01, 0x04, 0x63, 0x00, 0x03, 0x00, 0x02, 0x03, 0x02, 0x5f,
-    0x00, 0x00, 0x00, 0x06, 0x59, 0x00, 0x06, 0x06, 0x16, 0x4b, 0x00, 0x05, 0x05, 0x17, 0x05, 0x4c, 0x11, 0x11, 0x26,
-    0x11, 0x18, 0x21, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x01, 0x21, 0x11, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x27, 0x32, 0x3e, 0x02, 0x35, 0x26, 0x26, 0x23, 0x23, 0x11, 0x23, 0x11, 0x21, 0x04, 0x34, 0xfd, 0x3f, 0xb8,
-    0x8e, 0xdd, 0x99, 0x50, 0x3d, 0x78, 0xb1, 0x73, 0x02, 0x51, 0x6f, 0x44, 0x1e, 0x02, 0xcb, 0xce, 0xb8, 0xba, 0x03,
-    0x7b, 0x05, 0x18, 0xfe, 0x2a, 0x50, 0x95, 0xd6, 0x86, 0x83, 0xcb, 0x8a, 0x49, 0x93, 0x39, 0x68, 0x93, 0x5a, 0xc7,
-    0xd8, 0xfd, 0x60, 0x05, 0xb0, 0x00, 0x00, 0x01, 0x00, 0xb8, 0xfe, 0xe4, 0x04, 0x52, 0x04, 0x3a, 0x00, 0x1d, 0x00,
-    0x2b, 0x40, 0x28, 0x0e, 0x0d, 0x02, 0x03, 0x47, 0x00, 0x01, 0x00, 0x02, 0x03, 0x01, 0x02, 0x63, 0x00, 0x00, 0x00,
-    0x04, 0x59, 0x00, 0x04, 0x04, 0x18, 0x4b, 0x00, 0x03, 0x03, 0x17, 0x03, 0x4c, 0x1d, 0x1c, 0x1b, 0x1a, 0x19, 0x17,
-    0x21, 0x10, 0x05, 0x06, 0x16, 0x2b, 0x01, 0x21, 0x11, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x27,
-    0x3e, 0x03, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x23, 0x11, 0x23, 0x11, 0x21, 0x04, 0x2b, 0xfd, 0x47, 0xda, 0x6f, 0xbd,
-    0x8b, 0x4f, 0x2c, 0x5e, 0x94, 0x67, 0x30, 0x44, 0x60, 0x3c, 0x1c, 0x33, 0x5a, 0x79, 0x47, 0xda, 0xba, 0x03, 0x73,
-    0x03, 0xa1, 0xfe, 0xe5, 0x41, 0x79, 0xb1, 0x71, 0x3a, 0x8e, 0x84, 0x67, 0x13, 0x92, 0x12, 0x3b, 0x4f, 0x60, 0x38,
-    0x4c, 0x76, 0x4f, 0x29, 0xfe, 0x1c, 0x04, 0x3a, 0x00, 0x00, 0x01, 0x00, 0xae, 0x00, 0x00, 0x04, 0xc4, 0x05, 0xb0,
-    0x00, 0x14, 0x00, 0x3d, 0x40, 0x3a, 0x01, 0x01, 0x01, 0x06, 0x01, 0x4a, 0x08, 0x01, 0x06, 0x03, 0x01, 0x01, 0x02,
-    0x06, 0x01, 0x61, 0x0a, 0x09, 0x02, 0x05, 0x05, 0x16, 0x4b, 0x00, 0x02, 0x02, 0x07, 0x59, 0x00, 0x07, 0x07, 0x18,
-    0x4b, 0x04, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x12, 0x0b, 0x06, 0x1d, 0x2b, 0x09, 0x02, 0x23, 0x01, 0x23, 0x15, 0x23, 0x35, 0x23, 0x11, 0x23,
-    0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x01, 0x04, 0x98, 0xfe, 0xb1, 0x01, 0x7b, 0xe7, 0xfe, 0xba, 0x36,
-    0x95, 0x65, 0xb9, 0xb9, 0x65, 0x95, 0x36, 0x01, 0x29, 0x05, 0xb0, 0xfd, 0x51, 0xfc, 0xff, 0x02, 0x94, 0xf5, 0xf5,
-    0xfd, 0x6c, 0x05, 0xb0, 0xfd, 0x7b, 0x01, 0x01, 0xfe, 0xff, 0x02, 0x85, 0x00, 0x01, 0x00, 0xa3, 0x00, 0x00, 0x04,
-    0x7e, 0x04, 0x3a, 0x00, 0x14, 0x00, 0x3b, 0x40, 0x38, 0x01, 0x01, 0x01, 0x06, 0x01, 0x4a, 0x08, 0x01, 0x06, 0x03,
-    0x01, 0x01, 0x02, 0x06, 0x01, 0x61, 0x00, 0x07, 0x00, 0x02, 0x00, 0x07, 0x02, 0x61, 0x0a, 0x09, 0x02, 0x05, 0x05,
-    0x18, 0x4b, 0x04, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x12, 0x0b, 0x06, 0x1d, 0x2b, 0x09, 0x02, 0x23, 0x01, 0x23, 0x15, 0x23, 0x35, 0x23, 0x11,
-    0x23, 0x11, 0x33, 0x11, 0x33, 0x35, 0x33, 0x15, 0x33, 0x01, 0x04, 0x59, 0xfe, 0xae, 0x01, 0x77, 0xea, 0xfe, 0xea,
-    0x33, 0x94, 0x5a, 0xba, 0xba, 0x5a, 0x94, 0x2c, 0x01, 0x03, 0x04, 0x3a, 0xfd, 0xfe, 0xfd, 0xc8, 0x01, 0xcd, 0xc2,
-    0xc2, 0xfe, 0x33, 0x04, 0x3a, 0xfe, 0x36, 0xd5, 0xd5, 0x01, 0xca, 0x00, 0x01, 0x00, 0x2d, 0x00, 0x00, 0x04, 0xa6,
-    0x05, 0xb0, 0x00, 0x0e, 0x00, 0x2d, 0x40, 0x2a, 0x0c, 0x01, 0x00, 0x04, 0x01, 0x4a, 0x00, 0x04, 0x00, 0x00, 0x01,
-    0x04, 0x00, 0x61, 0x00, 0x02, 0x02, 0x03, 0x59, 0x05, 0x01, 0x03, 0x03, 0x16, 0x4b, 0x06, 0x01, 0x01, 0x01, 0x17,
-    0x01, 0x4c, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x01, 0x23, 0x11, 0x23, 0x11, 0x21,
-    0x35, 0x21, 0x11, 0x33, 0x01, 0x33, 0x01, 0x01, 0x23, 0x02, 0x95, 0x6a, 0xb8, 0xfe, 0xba, 0x01, 0xfe, 0x62, 0x01,
-    0x1e, 0xd3, 0xfe, 0xbb, 0x01, 0x6d, 0xe2, 0x02, 0x93, 0xfd, 0x6d, 0x05, 0x18, 0x98, 0xfd, 0x7a, 0x02, 0x86, 0xfd,
-    0x3f, 0xfd, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x38, 0x00, 0x00, 0x04, 0xb1, 0x04, 0x3a, 0x00, 0x0e, 0x00, 0x2d,
-    0x40, 0x2a, 0x0c, 0x01, 0x00, 0x04, 0x01, 0x4a, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x61, 0x00, 0x02, 0x02,
-    0x03, 0x59, 0x05, 0x01, 0x03, 0x03, 0x18, 0x4b, 0x06, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x12, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x01, 0x23, 0x11, 0x23, 0x11, 0x21, 0x35, 0x21, 0x11, 0x33, 0x13, 0x33,
-    0x01, 0x01, 0x23, 0x02, 0xbc, 0x86, 0xb9, 0xfe, 0xbb, 0x01, 0xfe, 0x7f, 0xf9, 0xe0, 0xfe, 0xb7, 0x01, 0x6c, 0xea,
-    0x01, 0xcd, 0xfe, 0x33, 0x03, 0xa1, 0x99, 0xfe, 0x36, 0x01, 0xca, 0xfd, 0xfe, 0xfd, 0xc8, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x72, 0x00, 0x00, 0x04, 0x9a, 0x05, 0xb0, 0x00, 0x0d, 0x00, 0x27, 0x40, 0x24, 0x00, 0x00, 0x00, 0x04,
-    0x03, 0x00, 0x04, 0x61, 0x00, 0x02, 0x02, 0x01, 0x59, 0x06, 0x01, 0x01, 0x01, 0x16, 0x4b, 0x05, 0x01, 0x03, 0x03,
-    0x17, 0x03, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x01, 0x21, 0x11, 0x21, 0x15,
-    0x21, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x33, 0x01, 0x2b, 0x01, 0x73, 0x01, 0xfc, 0xfe, 0xbc, 0xb8, 0xfe,
-    0x8d, 0xb9, 0xb9, 0x03, 0x1f, 0x02, 0x91, 0x98, 0xfa, 0xe8, 0x02, 0x87, 0xfd, 0x79, 0x05, 0xb0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x6e, 0x00, 0x00, 0x04, 0x9c, 0x04, 0x3a, 0x00, 0x0d, 0x00, 0x27, 0x40, 0x24, 0x00, 0x00, 0x00,
-    0x04, 0x03, 0x00, 0x04, 0x61, 0x00, 0x02, 0x02, 0x01, 0x59, 0x06, 0x01, 0x01, 0x01, 0x18, 0x4b, 0x05, 0x01, 0x03,
-    0x03, 0x17, 0x03, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x01, 0x21, 0x11, 0x21,
-    0x15, 0x21, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x33, 0x01, 0x27, 0x01, 0x7c, 0x01, 0xf9, 0xfe, 0xc0, 0xb9,
-    0xfe, 0x84, 0xb9, 0xb9, 0x02, 0x65, 0x01, 0xd5, 0x99, 0xfc, 0x5f, 0x01, 0xce, 0xfe, 0x32, 0x04, 0x3a, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x6d, 0xfe, 0xdf, 0x04, 0x9a, 0x05, 0xb0, 0x00, 0x1d, 0x00, 0x2e, 0x40, 0x2b, 0x00, 0x00,
-    0x00, 0x03, 0x04, 0x00, 0x03, 0x63, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01, 0x5f, 0x00, 0x05, 0x05, 0x07, 0x59, 0x00,
-    0x07, 0x07, 0x16, 0x4b, 0x06, 0x01, 0x04, 0x04, 0x17, 0x04, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x18, 0x11, 0x18, 0x10,
-    0x08, 0x06, 0x1c, 0x2b, 0x01, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x27, 0x32, 0x3e, 0x02, 0x35, 0x2e, 0x03,
-    0x27, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x21, 0x02, 0xe1, 0x6b, 0xa5, 0x70, 0x39, 0x30, 0x61, 0x90, 0x60,
-    0x02, 0x3a, 0x4e, 0x2f, 0x13, 0x01, 0x1e, 0x3e, 0x60, 0x43, 0xb9, 0xfe, 0xfd, 0xb8, 0x02, 0x74, 0x03, 0x41, 0x02,
-    0x53, 0x98, 0xd3, 0x81, 0x81, 0xca, 0x8c, 0x4a, 0x93, 0x3b, 0x69, 0x93, 0x57, 0x5e, 0x98, 0x6b, 0x3b, 0x02, 0xfd,
-    0x62, 0x05, 0x18, 0xfa, 0xe8, 0x05, 0xb0, 0x00, 0x00, 0x01, 0x00, 0x74, 0xfe, 0xe5, 0x04, 0x7c, 0x04, 0x3a, 0x00,
-    0x21, 0x00, 0x2f, 0x40, 0x2c, 0x0e, 0x0d, 0x02, 0x02, 0x47, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x01, 0x63, 0x00,
-    0x03, 0x03, 0x05, 0x59, 0x00, 0x05, 0x05, 0x18, 0x4b, 0x04, 0x01, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x21, 0x20, 0x1f,
-    0x1e, 0x1d, 0x1c, 0x1b, 0x1a, 0x18, 0x17, 0x20, 0x06, 0x06, 0x15, 0x2b, 0x01, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x0e,
-    0x05, 0x07, 0x27, 0x3e, 0x03, 0x35, 0x2e, 0x03, 0x23, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x21, 0x02,
-    0xcd, 0x08, 0x5d, 0x9c, 0x70, 0x3e, 0x01, 0x10, 0x22, 0x35, 0x4b, 0x62, 0x3d, 0x30, 0x39, 0x4d, 0x2f, 0x14, 0x01,
-    0x22, 0x3e, 0x57, 0x36, 0x08, 0xb9, 0xe7, 0xb9, 0x02, 0x59, 0x02, 0x85, 0x42, 0x7c, 0xb0, 0x6d, 0x26, 0x59, 0x5c,
-    0x59, 0x4c, 0x38, 0x0d, 0x92, 0x12, 0x3c, 0x4f, 0x60, 0x36, 0x49, 0x75, 0x50, 0x2b, 0xfe, 0x1d, 0x03, 0xa1, 0xfc,
-    0x5f, 0x04, 0x3a, 0x00, 0x00, 0x02, 0x00, 0x68, 0xff, 0xe2, 0x04, 0x50, 0x05, 0xc5, 0x00, 0x35, 0x00, 0x47, 0x00,
-    0x33, 0x40, 0x30, 0x39, 0x32, 0x20, 0x03, 0x04, 0x03, 0x03, 0x01, 0x00, 0x04, 0x02, 0x4a, 0x07, 0x01, 0x03, 0x03,
-    0x02, 0x5b, 0x05, 0x01, 0x02, 0x02, 0x1d, 0x4b, 0x06, 0x01, 0x04, 0x04, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x1e,
-    0x00, 0x4c, 0x2c, 0x1a, 0x2b, 0x19, 0x11, 0x19, 0x24, 0x10, 0x08, 0x06, 0x1c, 0x2b, 0x05, 0x26, 0x26, 0x27, 0x06,
-    0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x34, 0x3e, 0x02, 0x33, 0x17, 0x22, 0x0e, 0x02, 0x15, 0x11, 0x14, 0x1e,
-    0x02, 0x33, 0x32, 0x36, 0x37, 0x26, 0x26, 0x35, 0x11, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x06,
-    0x06, 0x07, 0x16, 0x16, 0x33, 0x01, 0x14, 0x16, 0x17, 0x36, 0x36, 0x35, 0x11, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e,
-    0x02, 0x15, 0x04, 0x50, 0x52, 0x92, 0x3f, 0x30, 0x6d, 0x3c, 0x71, 0xb6, 0x80, 0x45, 0x2f, 0x57, 0x7c, 0x4e, 0x01,
-    0x26, 0x38, 0x27, 0x13, 0x28, 0x4e, 0x73, 0x4a, 0x11, 0x20, 0x10, 0x5b, 0x61, 0x2b, 0x50, 0x73, 0x48, 0x48, 0x73,
-    0x50, 0x2b, 0x01, 0x4b, 0x46, 0x23, 0x4e, 0x2c, 0xfe, 0x42, 0x49, 0x45, 0x35, 0x36, 0x0f, 0x1f, 0x2f, 0x1f, 0x20,
-    0x2e, 0x20, 0x0f, 0x1e, 0x01, 0x21, 0x1f, 0x1b, 0x1d, 0x66, 0xae, 0xe9, 0x85, 0x01, 0x17, 0x78, 0xd2, 0x9c, 0x5b,
-    0x9e, 0x42, 0x71, 0x97, 0x57, 0xfe, 0xe7, 0x65, 0xb0, 0x83, 0x4d, 0x04, 0x04, 0x5b, 0xfc, 0x9b, 0x01, 0x53, 0x65,
-    0xb4, 0x86, 0x4e, 0x4c, 0x85, 0xb4, 0x68, 0xfe, 0x98, 0x8c, 0xf1, 0x58, 0x0c, 0x0d, 0x02, 0x01, 0x80, 0xcb, 0x44,
-    0x43, 0xc5, 0x74, 0x01, 0x6b, 0x45, 0x7a, 0x5a, 0x33, 0x36, 0x5b, 0x78, 0x43, 0x00, 0x02, 0x00, 0x5c, 0xff, 0xeb,
-    0x04, 0x8b, 0x04, 0x4f, 0x00, 0x33, 0x00, 0x45, 0x00, 0x33, 0x40, 0x30, 0x37, 0x31, 0x1f, 0x03, 0x04, 0x03, 0x03,
-    0x01, 0x00, 0x04, 0x02, 0x4a, 0x07, 0x01, 0x03, 0x03, 0x02, 0x5b, 0x05, 0x01, 0x02, 0x02, 0x1f, 0x4b, 0x06, 0x01,
-    0x04, 0x04, 0x00, 0x5b, 0x01, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x4c, 0x2c, 0x19, 0x29, 0x29, 0x11, 0x19, 0x24, 0x10,
-    0x08, 0x06, 0x1c, 0x2b, 0x05, 0x26, 0x26, 0x27, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02,
-    0x33, 0x15, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x37, 0x26, 0x26, 0x35, 0x35, 0x34, 0x3e,
-    0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x06, 0x07, 0x16, 0x33, 0x01, 0x14, 0x16, 0x17, 0x36, 0x36, 0x37,
-    0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x04, 0x8b, 0x5a, 0x9e, 0x45, 0x39, 0x83, 0x4a, 0x6f, 0xb5,
-    0x81, 0x47, 0x32, 0x5c, 0x82, 0x50, 0x28, 0x3e, 0x2a, 0x16, 0x2a, 0x4e, 0x72, 0x48, 0x2f, 0x2c, 0x5e, 0x65, 0x2b,
-    0x51, 0x76, 0x4b, 0x4b, 0x77, 0x51, 0x2b, 0x42, 0x3e, 0x4f, 0x61, 0xfe, 0x0f, 0x51, 0x4d, 0x33, 0x36, 0x01, 0x10,
-    0x21, 0x32, 0x22, 0x22, 0x31, 0x20, 0x10, 0x0c, 0x01, 0x1d, 0x1c, 0x20, 0x23, 0x5b, 0x9f, 0xd8, 0x7c, 0x3a, 0x63,
-    0xad, 0x81, 0x4a, 0x9e, 0x31, 0x55, 0x73, 0x42, 0x3c, 0x5b, 0x9e, 0x75, 0x43, 0x0c, 0x4f, 0xd9, 0x80, 0x68, 0x5b,
-    0x9c, 0x73, 0x41, 0x47, 0x7a, 0xa3, 0x5c, 0x69, 0x71, 0xc4, 0x4b, 0x15, 0x01, 0xa9, 0x69, 0xa7, 0x39, 0x39, 0x9e,
-    0x5e, 0x6c, 0x3a, 0x68, 0x4f, 0x2f, 0x29, 0x48, 0x62, 0x39, 0x00, 0x01, 0x00, 0x39, 0xfe, 0xa1, 0x04, 0xb6, 0x05,
-    0xb0, 0x00, 0x13, 0x00, 0x2b, 0x40, 0x28, 0x00, 0x06, 0x03, 0x06, 0x52, 0x02, 0x01, 0x00, 0x00, 0x01, 0x59, 0x04,
-    0x01, 0x01, 0x01, 0x16, 0x4b, 0x05, 0x01, 0x03, 0x03, 0x07, 0x5a, 0x00, 0x07, 0x07, 0x17, 0x07, 0x4c, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x51, 0x10, 0x08, 0x06, 0x1c, 0x2b, 0x01, 0x21, 0x35, 0x21, 0x35, 0x33, 0x15, 0x33, 0x15,
-    0x23, 0x11, 0x21, 0x11, 0x33, 0x11, 0x33, 0x03, 0x23, 0x11, 0x21, 0x01, 0x46, 0xfe, 0xf3, 0x01, 0x0d, 0xb9, 0xee,
-    0xee, 0x01, 0x6d, 0xb9, 0x91, 0x12, 0xa5, 0xfd, 0x47, 0x05, 0x18, 0x97, 0x01, 0x01, 0x97, 0xfb, 0x7f, 0x05, 0x19,
-    0xfa, 0xec, 0xfe, 0x05, 0x01, 0x5f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x34, 0xfe, 0xbf, 0x04, 0x8b, 0x04, 0x3a, 0x00,
-    0x0f, 0x00, 0x2b, 0x40, 0x28, 0x00, 0x06, 0x03, 0x06, 0x52, 0x02, 0x01, 0x00, 0x00, 0x01, 0x59, 0x04, 0x01, 0x01,
-    0x01, 0x18, 0x4b, 0x05, 0x01, 0x03, 0x03, 0x07, 0x5a, 0x00, 0x07, 0x07, 0x17, 0x07, 0x4c, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x08, 0x06, 0x1c, 0x2b, 0x01, 0x23, 0x35, 0x21, 0x15, 0x23, 0x11, 0x21, 0x11, 0x33, 0x11,
-    0x33, 0x03, 0x23, 0x11, 0x21, 0x01, 0x1c, 0xe8, 0x02, 0x85, 0xe4, 0x01, 0x7d, 0xb9, 0x80, 0x12, 0xa6, 0xfd, 0x49,
-    0x03, 0xa3, 0x97, 0x97, 0xfc, 0xf4, 0x03, 0xa3, 0xfc, 0x5d, 0xfe, 0x28, 0x01, 0x41, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0xab, 0x00, 0x00, 0x04, 0x27, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x1d, 0x00, 0x72, 0x40, 0x0a, 0x1c, 0x01, 0x05,
-    0x01, 0x07, 0x01, 0x03, 0x05, 0x02, 0x4a, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x24, 0x00, 0x01, 0x04, 0x05, 0x04,
-    0x01, 0x05, 0x70, 0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 0x68, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x03, 0x64, 0x07,
-    0x06, 0x02, 0x04, 0x04, 0x16, 0x4b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x1b, 0x40, 0x25, 0x00, 0x01, 0x04, 0x05,
-    0x04, 0x01, 0x05, 0x70, 0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 0x02, 0x70, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x03,
-    0x64, 0x07, 0x06, 0x02, 0x04, 0x04, 0x16, 0x4b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x59, 0x40, 0x0f, 0x04, 0x04,
-    0x04, 0x1d, 0x04, 0x1d, 0x25, 0x15, 0x25, 0x12, 0x11, 0x10, 0x08, 0x06, 0x1a, 0x2b, 0x01, 0x23, 0x11, 0x33, 0x01,
-    0x11, 0x23, 0x11, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36,
-    0x37, 0x11, 0x02, 0xa6, 0x95, 0x95, 0x01, 0x81, 0xb9, 0x21, 0x42, 0x47, 0x51, 0x30, 0x61, 0x98, 0x68, 0x37, 0xb9,
-    0x1b, 0x37, 0x54, 0x39, 0x53, 0x90, 0x48, 0x01, 0x35, 0x02, 0xbc, 0x01, 0xbf, 0xfa, 0x50, 0x02, 0x5b, 0x0c, 0x12,
-    0x0e, 0x07, 0x31, 0x6c, 0xaa, 0x79, 0x01, 0xc8, 0xfe, 0x38, 0x55, 0x71, 0x45, 0x1d, 0x1d, 0x18, 0x02, 0xbb, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x92, 0x00, 0x00, 0x04, 0x2c, 0x04, 0x3a, 0x00, 0x03, 0x00, 0x19, 0x00, 0x96, 0x40, 0x0a,
-    0x17, 0x01, 0x05, 0x01, 0x06, 0x01, 0x03, 0x05, 0x02, 0x4a, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x22, 0x00, 0x01,
-    0x04, 0x05, 0x05, 0x01, 0x68, 0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 0x68, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x03,
-    0x64, 0x06, 0x01, 0x04, 0x04, 0x18, 0x4b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x1b, 0x4b, 0xb0, 0x12, 0x50, 0x58,
-    0x40, 0x23, 0x00, 0x01, 0x04, 0x05, 0x04, 0x01, 0x05, 0x70, 0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 0x68, 0x00, 0x05,
-    0x00, 0x03, 0x00, 0x05, 0x03, 0x64, 0x06, 0x01, 0x04, 0x04, 0x18, 0x4b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x1b,
-    0x40, 0x24, 0x00, 0x01, 0x04, 0x05, 0x04, 0x01, 0x05, 0x70, 0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 0x02, 0x70, 0x00,
-    0x05, 0x00, 0x03, 0x00, 0x05, 0x03, 0x64, 0x06, 0x01, 0x04, 0x04, 0x18, 0x4b, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c,
-    0x59, 0x59, 0x40, 0x0a, 0x13, 0x23, 0x15, 0x23, 0x11, 0x11, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x25, 0x23, 0x11, 0x33,
-    0x01, 0x23, 0x11, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37,
-    0x11, 0x33, 0x02, 0xaf, 0x96, 0x96, 0x01, 0x7d, 0xb9, 0x44, 0x91, 0x55, 0x64, 0xa2, 0x73, 0x3e, 0xb9, 0x01, 0x83,
-    0x7a, 0x51, 0x94, 0x45, 0xb9, 0xd3, 0x02, 0x36, 0xfc, 0xf7, 0x01, 0x8b, 0x11, 0x12, 0x32, 0x65, 0x99, 0x67, 0x01,
-    0x3b, 0xfe, 0xc5, 0x85, 0x7a, 0x12, 0x11, 0x02, 0x17, 0x00, 0x01, 0x00, 0xe3, 0x00, 0x00, 0x04, 0x5f, 0x05, 0xb0,
-    0x00, 0x19, 0x00, 0x2f, 0x40, 0x2c, 0x03, 0x01, 0x03, 0x01, 0x18, 0x01, 0x02, 0x03, 0x02, 0x4a, 0x00, 0x01, 0x00,
-    0x03, 0x02, 0x01, 0x03, 0x63, 0x00, 0x00, 0x00, 0x16, 0x4b, 0x05, 0x04, 0x02, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x00,
-    0x00, 0x00, 0x19, 0x00, 0x19, 0x25, 0x15, 0x25, 0x11, 0x06, 0x06, 0x18, 0x2b, 0x33, 0x11, 0x33, 0x11, 0x3e, 0x03,
-    0x33, 0x32, 0x1e, 0x02, 0x15, 0x03, 0x23, 0x11, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x07, 0x11, 0xe3, 0xb9, 0x21,
-    0x41, 0x47, 0x51, 0x30, 0x61, 0x98, 0x69, 0x37, 0x01, 0xb9, 0x1b, 0x37, 0x54, 0x39, 0x53, 0x90, 0x47, 0x05, 0xb0,
-    0xfd, 0xa3, 0x0c, 0x13, 0x0e, 0x07, 0x31, 0x6c, 0xaa, 0x79, 0xfe, 0x39, 0x01, 0xc7, 0x55, 0x71, 0x45, 0x1d, 0x1d,
-    0x18, 0xfd, 0x46, 0x00, 0x00, 0x02, 0x00, 0x26, 0xff, 0xea, 0x04, 0x89, 0x05, 0xc3, 0x00, 0x29, 0x00, 0x34, 0x00,
-    0x52, 0x40, 0x4f, 0x0f, 0x01, 0x05, 0x01, 0x06, 0x01, 0x03, 0x05, 0x24, 0x01, 0x04, 0x03, 0x25, 0x01, 0x00, 0x04,
-    0x04, 0x4a, 0x08, 0x01, 0x05, 0x00, 0x03, 0x04, 0x05, 0x03, 0x61, 0x00, 0x06, 0x06, 0x02, 0x5b, 0x00, 0x02, 0x02,
-    0x1d, 0x4b, 0x00, 0x01, 0x01, 0x18, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x07, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x4c,
-    0x2b, 0x2a, 0x01, 0x00, 0x32, 0x30, 0x2a, 0x34, 0x2b, 0x34, 0x20, 0x1e, 0x19, 0x18, 0x15, 0x13, 0x0c, 0x0b, 0x00,
-    0x29, 0x01, 0x29, 0x09, 0x06, 0x14, 0x2b, 0x05, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x2e, 0x03, 0x35, 0x33, 0x16, 0x16,
-    0x17, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x12, 0x11, 0x15, 0x21, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37,
-    0x17, 0x0e, 0x03, 0x01, 0x21, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x15, 0x03, 0x2a, 0x7c, 0xbf, 0x82, 0x43,
-    0x41, 0x61, 0x41, 0x21, 0x95, 0x01, 0x34, 0x3a, 0x46, 0x7a, 0xa5, 0x5f, 0xd5, 0xc6, 0xfd, 0x5a, 0x24, 0x4f, 0x7c,
-    0x58, 0x2f, 0x4d, 0x41, 0x35, 0x16, 0x2f, 0x0f, 0x35, 0x4c, 0x66, 0xfe, 0x78, 0x01, 0xed, 0x15, 0x33, 0x57, 0x43,
-    0x7f, 0x8c, 0x16, 0x58, 0x9d, 0xd7, 0x80, 0x90, 0x0c, 0x3f, 0x5f, 0x7e, 0x4b, 0x54, 0x78, 0x19, 0x90, 0xe6, 0xa2,
-    0x57, 0xfe, 0xd5, 0xfe, 0xe2, 0xbc, 0x88, 0x5a, 0x9f, 0x77, 0x46, 0x10, 0x1a, 0x1e, 0x0e, 0x88, 0x0c, 0x23, 0x1f,
-    0x16, 0x03, 0x58, 0x70, 0x4e, 0x89, 0x66, 0x3c, 0xf3, 0xe6, 0x00, 0x00, 0x00, 0x02, 0x00, 0x26, 0xff, 0xec, 0x04,
-    0x85, 0x04, 0x4e, 0x00, 0x26, 0x00, 0x32, 0x00, 0x55, 0x40, 0x52, 0x0d, 0x01, 0x06, 0x01, 0x05, 0x01, 0x03, 0x06,
-    0x21, 0x01, 0x04, 0x03, 0x22, 0x01, 0x00, 0x04, 0x04, 0x4a, 0x00, 0x01, 0x05, 0x06, 0x05, 0x01, 0x06, 0x70, 0x00,
-    0x06, 0x00, 0x03, 0x04, 0x06, 0x03, 0x61, 0x08, 0x01, 0x05, 0x05, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x1f, 0x4b, 0x00,
-    0x04, 0x04, 0x00, 0x5b, 0x07, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x4c, 0x28, 0x27, 0x01, 0x00, 0x2d, 0x2c, 0x27, 0x32,
-    0x28, 0x32, 0x1f, 0x1d, 0x19, 0x18, 0x13, 0x11, 0x0a, 0x09, 0x00, 0x26, 0x01, 0x26, 0x09, 0x06, 0x14, 0x2b, 0x05,
-    0x22, 0x2e, 0x02, 0x35, 0x35, 0x26, 0x26, 0x35, 0x33, 0x16, 0x16, 0x17, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x15,
-    0x15, 0x21, 0x1e, 0x03, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0e, 0x03, 0x03, 0x22, 0x0e, 0x02, 0x07, 0x21, 0x35, 0x34,
-    0x2e, 0x02, 0x02, 0xfe, 0x6e, 0xaf, 0x7a, 0x42, 0x80, 0x7f, 0x94, 0x01, 0x36, 0x3b, 0x0f, 0x50, 0x74, 0x91, 0x50,
-    0x6b, 0x9f, 0x68, 0x33, 0xfd, 0x5a, 0x03, 0x26, 0x48, 0x69, 0x45, 0x64, 0x8b, 0x30, 0x4a, 0x18, 0x43, 0x59, 0x70,
-    0x63, 0x32, 0x54, 0x40, 0x2c, 0x09, 0x01, 0xe7, 0x1c, 0x3a, 0x59, 0x14, 0x51, 0x91, 0xc6, 0x75, 0x01, 0x17, 0xb3,
-    0x8e, 0x4d, 0x6b, 0x15, 0x61, 0xa3, 0x75, 0x40, 0x49, 0x81, 0xb2, 0x69, 0x78, 0x4c, 0x85, 0x64, 0x3a, 0x3f, 0x2e,
-    0x7c, 0x19, 0x30, 0x26, 0x18, 0x03, 0xca, 0x2e, 0x51, 0x6e, 0x40, 0x18, 0x36, 0x64, 0x4d, 0x2e, 0x00, 0x01, 0x00,
-    0xc8, 0xfe, 0xda, 0x04, 0x8c, 0x05, 0xb0, 0x00, 0x1e, 0x00, 0x28, 0x40, 0x25, 0x00, 0x05, 0x00, 0x02, 0x03, 0x05,
-    0x02, 0x63, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x5f, 0x06, 0x01, 0x04, 0x04, 0x16, 0x4b, 0x00, 0x03, 0x03, 0x17,
-    0x03, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x28, 0x11, 0x19, 0x07, 0x06, 0x1b, 0x2b, 0x01, 0x1e, 0x03, 0x15, 0x14, 0x0e,
-    0x02, 0x23, 0x27, 0x32, 0x3e, 0x02, 0x35, 0x2e, 0x03, 0x23, 0x23, 0x11, 0x23, 0x11, 0x33, 0x11, 0x33, 0x01, 0x33,
-    0x02, 0xca, 0x6c, 0xa8, 0x72, 0x3c, 0x3d, 0x76, 0xaf, 0x73, 0x02, 0x50, 0x6d, 0x44, 0x1d, 0x01, 0x2e, 0x5b, 0x8b,
-    0x5d, 0xe0, 0xb9, 0xb9, 0x8e, 0x01, 0x9b, 0xd7, 0x03, 0x35, 0x0f, 0x5d, 0x92, 0xc5, 0x77, 0x83, 0xca, 0x8b, 0x49,
-    0x92, 0x3a, 0x69, 0x92, 0x5a, 0x63, 0x9a, 0x6a, 0x38, 0xfd, 0x66, 0x05, 0xb0, 0xfd, 0x8c, 0x02, 0x74, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0xb4, 0xfe, 0xfe, 0x04, 0x3c, 0x04, 0x3a, 0x00, 0x1e, 0x00, 0x29, 0x40, 0x26, 0x0b, 0x0a, 0x02,
-    0x01, 0x47, 0x00, 0x03, 0x00, 0x00, 0x01, 0x03, 0x00, 0x63, 0x04, 0x01, 0x02, 0x02, 0x18, 0x4b, 0x00, 0x01, 0x01,
-    0x17, 0x01, 0x4c, 0x1e, 0x1d, 0x1c, 0x1b, 0x1a, 0x19, 0x18, 0x17, 0x16, 0x14, 0x05, 0x06, 0x14, 0x2b, 0x01, 0x1e,
-    0x03, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x27, 0x3e, 0x03, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x23, 0x11, 0x23, 0x11, 0x33,
-    0x11, 0x33, 0x01, 0x33, 0x02, 0xaf, 0x56, 0x8f, 0x66, 0x39, 0x2a, 0x58, 0x8b, 0x61, 0x31, 0x3f, 0x57, 0x38, 0x19,
-    0x32, 0x57, 0x77, 0x47, 0xc7, 0xb9, 0xb9, 0x77, 0x01, 0x78, 0xe0, 0x02, 0x64, 0x0e, 0x44, 0x6d, 0x96, 0x60, 0x38,
-    0x88, 0x7d, 0x62, 0x12, 0x92, 0x10, 0x38, 0x49, 0x5b, 0x33, 0x4c, 0x6d, 0x45, 0x20, 0xfe, 0x33, 0x04, 0x3a, 0xfe,
-    0x36, 0x01, 0xca, 0x00, 0x01, 0x00, 0xb6, 0xfe, 0x4b, 0x04, 0x19, 0x05, 0xb0, 0x00, 0x1b, 0x00, 0x3b, 0x40, 0x38,
-    0x0e, 0x01, 0x03, 0x05, 0x0d, 0x01, 0x02, 0x03, 0x02, 0x4a, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x04, 0x61, 0x07,
-    0x06, 0x02, 0x01, 0x01, 0x16, 0x4b, 0x00, 0x05, 0x05, 0x17, 0x4b, 0x00, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02,
-    0x21, 0x02, 0x4c, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x1b, 0x11, 0x13, 0x27, 0x25, 0x11, 0x11, 0x08, 0x06, 0x1a, 0x2b,
-    0x01, 0x11, 0x21, 0x11, 0x33, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x37, 0x1e, 0x03, 0x33, 0x32, 0x36,
-    0x35, 0x11, 0x21, 0x11, 0x23, 0x11, 0x01, 0x6f, 0x01, 0xf1, 0xb9, 0x2a, 0x51, 0x76, 0x4c, 0x1d, 0x34, 0x1d, 0x0e,
-    0x08, 0x1b, 0x1d, 0x1a, 0x06, 0x41, 0x43, 0xfe, 0x0f, 0xb9, 0x05, 0xb0, 0xfd, 0x6c, 0x02, 0x94, 0xf9, 0xf7, 0x52,
-    0x81, 0x5a, 0x2f, 0x08, 0x0a, 0x93, 0x03, 0x05, 0x03, 0x02, 0x6d, 0x57, 0x02, 0xde, 0xfd, 0x7b, 0x05, 0xb0, 0x00,
-    0x01, 0x00, 0xb3, 0xfe, 0x4b, 0x04, 0x16, 0x04, 0x3a, 0x00, 0x1b, 0x00, 0x3b, 0x40, 0x38, 0x0e, 0x01, 0x03, 0x05,
-    0x0d, 0x01, 0x02, 0x03, 0x02, 0x4a, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x04, 0x61, 0x07, 0x06, 0x02, 0x01, 0x01,
-    0x18, 0x4b, 0x00, 0x05, 0x05, 0x17, 0x4b, 0x00, 0x03, 0x03, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x21, 0x02, 0x4c, 0x00,
-    0x00, 0x00, 0x1b, 0x00, 0x1b, 0x11, 0x13, 0x27, 0x25, 0x11, 0x11, 0x08, 0x06, 0x1a, 0x2b, 0x01, 0x11, 0x21, 0x11,
-    0x33, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x37, 0x1e, 0x03, 0x33, 0x32, 0x36, 0x35, 0x11, 0x21, 0x11,
-    0x23, 0x11, 0x01, 0x6c, 0x01, 0xf1, 0xb9, 0x2c, 0x52, 0x78, 0x4c, 0x1e, 0x35, 0x1d, 0x0e, 0x08, 0x1c, 0x1d, 0x1a,
-    0x07, 0x42, 0x47, 0xfe, 0x0f, 0xb9, 0x04, 0x3a, 0xfe, 0x2b, 0x01, 0xd5, 0xfb, 0x6d, 0x53, 0x81, 0x59, 0x2f, 0x08,
-    0x0a, 0x93, 0x03, 0x05, 0x03, 0x02, 0x6a, 0x5a, 0x02, 0x27, 0xfe, 0x32, 0x04, 0x3a, 0x00, 0x02, 0x00, 0x5a, 0xff,
-    0xeb, 0x04, 0x57, 0x05, 0xc4, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x43, 0x40, 0x40, 0x1e, 0x01, 0x03, 0x00, 0x1d, 0x01,
-    0x02, 0x03, 0x02, 0x4a, 0x00, 0x02, 0x00, 0x05, 0x04, 0x02, 0x05, 0x61, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x06, 0x01,
-    0x00, 0x00, 0x1d, 0x4b, 0x07, 0x01, 0x04, 0x04, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x1e, 0x01, 0x4c, 0x24, 0x23, 0x01,
-    0x00, 0x29, 0x28, 0x23, 0x2e, 0x24, 0x2e, 0x19, 0x17, 0x12, 0x11, 0x0c, 0x0a, 0x00, 0x22, 0x01, 0x22, 0x08, 0x06,
-    0x14, 0x2b, 0x01, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x27, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x21, 0x35,
-    0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x27, 0x3e, 0x03, 0x13, 0x32, 0x3e, 0x02, 0x37, 0x21, 0x15, 0x14,
-    0x1e, 0x02, 0x02, 0x3e, 0x82, 0xc8, 0x89, 0x46, 0x4f, 0x8b, 0xbd, 0x6f, 0x7e, 0xbc, 0x7e, 0x3f, 0x03, 0x44, 0x27,
-    0x55, 0x86, 0x5e, 0x35, 0x59, 0x4a, 0x3d, 0x19, 0x2f, 0x11, 0x3b, 0x57, 0x72, 0x5b, 0x51, 0x7b, 0x54, 0x2c, 0x01,
-    0xfd, 0x75, 0x21, 0x4b, 0x79, 0x05, 0xc4, 0x5f, 0xa8, 0xe7, 0x88, 0xda, 0x8c, 0xee, 0xae, 0x61, 0x01, 0x56, 0x9f,
-    0xe0, 0x8a, 0xa6, 0x5d, 0x62, 0xae, 0x83, 0x4c, 0x10, 0x19, 0x1f, 0x0e, 0x88, 0x0c, 0x23, 0x20, 0x16, 0xfa, 0xbe,
-    0x4f, 0x86, 0xb3, 0x63, 0x5a, 0x53, 0x92, 0x6d, 0x3f, 0x00, 0x01, 0x00, 0x94, 0xff, 0xeb, 0x04, 0x52, 0x05, 0xb0,
-    0x00, 0x24, 0x00, 0x3c, 0x40, 0x39, 0x04, 0x01, 0x00, 0x01, 0x24, 0x01, 0x02, 0x00, 0x02, 0x4a, 0x00, 0x04, 0x06,
-    0x05, 0x06, 0x04, 0x05, 0x70, 0x00, 0x02, 0x00, 0x06, 0x04, 0x02, 0x06, 0x63, 0x00, 0x00, 0x00, 0x01, 0x59, 0x00,
-    0x01, 0x01, 0x16, 0x4b, 0x00, 0x05, 0x05, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x1e, 0x03, 0x4c, 0x26, 0x24, 0x14, 0x28,
-    0x12, 0x11, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x01, 0x21, 0x35, 0x21, 0x17, 0x01, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x23, 0x23, 0x35,
-    0x03, 0x4a, 0xfd, 0x74, 0x03, 0x65, 0x01, 0xfe, 0x65, 0x6c, 0xaa, 0x75, 0x3e, 0x49, 0x83, 0xb3, 0x6a, 0x57, 0xa9,
-    0x84, 0x51, 0xb9, 0x2a, 0x4a, 0x69, 0x3f, 0x47, 0x71, 0x4e, 0x2a, 0xa7, 0x9f, 0x8f, 0x05, 0x18, 0x98, 0x76, 0xfe,
-    0x14, 0x06, 0x40, 0x6f, 0x9f, 0x64, 0x66, 0x9e, 0x6e, 0x39, 0x32, 0x68, 0xa0, 0x6f, 0x39, 0x63, 0x4b, 0x2b, 0x29,
-    0x48, 0x64, 0x3b, 0x9c, 0x8e, 0x97, 0x00, 0x01, 0x00, 0x89, 0xfe, 0x75, 0x04, 0x48, 0x04, 0x3a, 0x00, 0x24, 0x00,
-    0x69, 0x40, 0x0b, 0x04, 0x01, 0x00, 0x01, 0x24, 0x05, 0x02, 0x05, 0x00, 0x02, 0x4a, 0x4b, 0xb0, 0x30, 0x50, 0x58,
-    0x40, 0x24, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x03, 0x70, 0x00, 0x03, 0x04, 0x00, 0x03, 0x04, 0x6e, 0x00, 0x00,
-    0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x18, 0x4b, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x1a, 0x02, 0x4c,
-    0x1b, 0x40, 0x21, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x03, 0x70, 0x00, 0x03, 0x04, 0x00, 0x03, 0x04, 0x6e, 0x00,
-    0x04, 0x00, 0x02, 0x04, 0x02, 0x5f, 0x00, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x18, 0x00, 0x4c, 0x59, 0x40,
-    0x09, 0x26, 0x24, 0x14, 0x2b, 0x11, 0x10, 0x06, 0x06, 0x1a, 0x2b, 0x01, 0x21, 0x35, 0x21, 0x17, 0x01, 0x1e, 0x03,
-    0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34,
-    0x26, 0x23, 0x23, 0x35, 0x03, 0x2c, 0xfd, 0x88, 0x03, 0x65, 0x01, 0xfe, 0x72, 0x69, 0xa5, 0x72, 0x3c, 0x49, 0x83,
-    0xb4, 0x6a, 0x57, 0xa8, 0x84, 0x52, 0xba, 0x29, 0x4b, 0x68, 0x3f, 0x48, 0x71, 0x4e, 0x2a, 0xab, 0x9f, 0x8d, 0x03,
-    0xa1, 0x99, 0x76, 0xfe, 0x11, 0x08, 0x41, 0x6f, 0x9c, 0x62, 0x65, 0x9e, 0x6e, 0x39, 0x32, 0x68, 0xa0, 0x6e, 0x38,
-    0x63, 0x4a, 0x2b, 0x28, 0x48, 0x63, 0x3b, 0x9d, 0x8d, 0x97, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x42, 0xfe, 0x4b,
-    0x04, 0x7b, 0x05, 0xb0, 0x02, 0x26, 0x00, 0xae, 0x4b, 0x00, 0x00, 0x27, 0x01, 0xca, 0xff, 0x0d, 0x00, 0x3f, 0x01,
-    0x07, 0x01, 0xd0, 0xff, 0x4f, 0x00, 0x00, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x3f, 0xb0, 0x33, 0x2b, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x74, 0xfe, 0x4b, 0x04, 0x7c, 0x04, 0x3a, 0x02, 0x26, 0x00, 0xe8, 0x52, 0x00, 0x00, 0x27, 0x01,
-    0xca, 0xff, 0x3f, 0xff, 0x64, 0x01, 0x07, 0x01, 0xd0, 0xff, 0x44, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8,
-    0xff, 0x64, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x02, 0x00, 0x61, 0x00, 0x00, 0x04, 0x30, 0x05, 0xb0, 0x00, 0x0e, 0x00,
-    0x1b, 0x00, 0x30, 0x40, 0x2d, 0x05, 0x01, 0x02, 0x00, 0x03, 0x04, 0x02, 0x03, 0x63, 0x00, 0x00, 0x00, 0x16, 0x4b,
-    0x06, 0x01, 0x04, 0x04, 0x01, 0x5c, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x1b, 0x0f,
-    0x1a, 0x12, 0x10, 0x00, 0x0e, 0x00, 0x0d, 0x21, 0x11, 0x07, 0x06, 0x16, 0x2b, 0x01, 0x11, 0x33, 0x11, 0x21, 0x22,
-    0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x01, 0x11, 0x21, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x03,
-    0x77, 0xb9, 0xfe, 0x18, 0x75, 0xb5, 0x7c, 0x41, 0x41, 0x7c, 0xb5, 0x75, 0x01, 0x2f, 0xfe, 0xd1, 0x4e, 0x72, 0x4a,
-    0x23, 0x23, 0x4a, 0x72, 0x4e, 0x03, 0x6d, 0x02, 0x43, 0xfa, 0x50, 0x42, 0x76, 0xa3, 0x60, 0x61, 0xa0, 0x72, 0x3f,
-    0xfd, 0x2a, 0x02, 0x3f, 0x2e, 0x4d, 0x66, 0x38, 0x39, 0x6a, 0x52, 0x31, 0x00, 0x00, 0x02, 0x00, 0x4d, 0x00, 0x00,
-    0x04, 0x8d, 0x05, 0xb0, 0x00, 0x20, 0x00, 0x2d, 0x00, 0x66, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x1c, 0x04, 0x01,
-    0x01, 0x00, 0x05, 0x03, 0x01, 0x05, 0x63, 0x00, 0x02, 0x02, 0x16, 0x4b, 0x08, 0x06, 0x02, 0x03, 0x03, 0x00, 0x5c,
-    0x07, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x1b, 0x40, 0x23, 0x00, 0x04, 0x01, 0x05, 0x01, 0x04, 0x05, 0x70, 0x00,
-    0x01, 0x00, 0x05, 0x03, 0x01, 0x05, 0x63, 0x00, 0x02, 0x02, 0x16, 0x4b, 0x08, 0x06, 0x02, 0x03, 0x03, 0x00, 0x5c,
-    0x07, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x59, 0x40, 0x19, 0x21, 0x21, 0x01, 0x00, 0x21, 0x2d, 0x21, 0x2c, 0x24,
-    0x22, 0x18, 0x17, 0x10, 0x0e, 0x0d, 0x0c, 0x0b, 0x09, 0x00, 0x20, 0x01, 0x1f, 0x09, 0x06, 0x14, 0x2b, 0x21, 0x22,
-    0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x33, 0x11, 0x33, 0x11, 0x37, 0x3e, 0x03, 0x37, 0x36, 0x26, 0x27, 0x33,
-    0x16, 0x16, 0x07, 0x0e, 0x03, 0x23, 0x27, 0x11, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x01, 0xcf,
-    0x5e, 0x90, 0x62, 0x32, 0x32, 0x62, 0x90, 0x5e, 0x72, 0xb9, 0x31, 0x29, 0x3d, 0x2a, 0x16, 0x01, 0x02, 0x20, 0x1d,
-    0xb3, 0x1b, 0x28, 0x02, 0x02, 0x39, 0x5f, 0x7f, 0x47, 0xea, 0x72, 0x36, 0x4d, 0x30, 0x16, 0x16, 0x30, 0x4d, 0x36,
-    0x43, 0x77, 0xa2, 0x5f, 0x5f, 0xa0, 0x73, 0x40, 0x02, 0x43, 0xfa, 0xe6, 0x01, 0x01, 0x2f, 0x56, 0x77, 0x48, 0x5b,
-    0xc5, 0x5b, 0x5b, 0xc0, 0x60, 0x76, 0xb2, 0x78, 0x3c, 0x97, 0x02, 0x3f, 0x2e, 0x4e, 0x66, 0x37, 0x38, 0x6a, 0x52,
-    0x32, 0x00, 0x00, 0x02, 0x00, 0x65, 0xff, 0xe8, 0x04, 0x94, 0x06, 0x18, 0x00, 0x2b, 0x00, 0x40, 0x00, 0x41, 0x40,
-    0x3e, 0x08, 0x01, 0x06, 0x00, 0x3d, 0x2c, 0x02, 0x02, 0x03, 0x23, 0x01, 0x04, 0x02, 0x03, 0x4a, 0x00, 0x01, 0x00,
-    0x01, 0x72, 0x00, 0x03, 0x06, 0x02, 0x06, 0x03, 0x02, 0x70, 0x00, 0x06, 0x06, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x1f,
-    0x4b, 0x07, 0x01, 0x02, 0x02, 0x04, 0x5c, 0x05, 0x01, 0x04, 0x04, 0x1e, 0x04, 0x4c, 0x29, 0x27, 0x23, 0x27, 0x17,
-    0x25, 0x13, 0x24, 0x08, 0x06, 0x1c, 0x2b, 0x13, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x11, 0x33, 0x11, 0x06,
-    0x1e, 0x02, 0x33, 0x3e, 0x03, 0x37, 0x36, 0x26, 0x27, 0x37, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x23, 0x06, 0x27, 0x06,
-    0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x01, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e, 0x02, 0x33,
-    0x16, 0x36, 0x37, 0x26, 0x26, 0x27, 0x65, 0x26, 0x4b, 0x72, 0x4b, 0x34, 0x54, 0x21, 0xb9, 0x01, 0x0b, 0x18, 0x23,
-    0x17, 0x22, 0x32, 0x21, 0x11, 0x01, 0x02, 0x1f, 0x1d, 0xb2, 0x1c, 0x28, 0x02, 0x02, 0x32, 0x56, 0x74, 0x43, 0xa8,
-    0x43, 0x25, 0x69, 0x47, 0x4a, 0x70, 0x4c, 0x26, 0x01, 0xd7, 0x16, 0x3c, 0x29, 0x2e, 0x3f, 0x26, 0x10, 0x10, 0x26,
-    0x3e, 0x2d, 0x2e, 0x40, 0x17, 0x03, 0x04, 0x01, 0x02, 0x40, 0x6f, 0xc0, 0x8e, 0x51, 0x26, 0x23, 0x02, 0x13, 0xfb,
-    0x1c, 0x24, 0x41, 0x30, 0x1d, 0x01, 0x3c, 0x6a, 0x91, 0x57, 0x64, 0xca, 0x64, 0x01, 0x62, 0xca, 0x67, 0x86, 0xcc,
-    0x8c, 0x48, 0x03, 0x86, 0x3f, 0x44, 0x48, 0x7e, 0xaa, 0x62, 0x01, 0xab, 0x21, 0x28, 0x3d, 0x67, 0x85, 0x48, 0x83,
-    0x3e, 0x6f, 0x56, 0x32, 0x01, 0x30, 0x28, 0x14, 0x2a, 0x17, 0x00, 0x00, 0x01, 0x00, 0x37, 0xff, 0xe9, 0x04, 0x8a,
-    0x05, 0xb0, 0x00, 0x3a, 0x00, 0x3b, 0x40, 0x38, 0x1b, 0x01, 0x00, 0x01, 0x01, 0x4a, 0x00, 0x05, 0x02, 0x01, 0x02,
-    0x05, 0x01, 0x70, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x63, 0x00, 0x02, 0x02, 0x03, 0x5b, 0x00, 0x03, 0x03,
-    0x16, 0x4b, 0x00, 0x04, 0x04, 0x06, 0x5b, 0x00, 0x06, 0x06, 0x1e, 0x06, 0x4c, 0x38, 0x36, 0x2f, 0x2e, 0x27, 0x25,
-    0x21, 0x26, 0x21, 0x24, 0x07, 0x06, 0x18, 0x2b, 0x01, 0x34, 0x2e, 0x02, 0x23, 0x23, 0x35, 0x33, 0x32, 0x36, 0x35,
-    0x34, 0x2e, 0x02, 0x23, 0x23, 0x35, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x07, 0x1e, 0x03, 0x15, 0x15, 0x14,
-    0x1e, 0x02, 0x33, 0x3e, 0x03, 0x37, 0x36, 0x26, 0x27, 0x33, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x23, 0x06, 0x26, 0x27,
-    0x01, 0xf7, 0x1b, 0x31, 0x45, 0x2a, 0x85, 0x52, 0x81, 0x77, 0x1d, 0x3a, 0x57, 0x3b, 0xe1, 0xe1, 0x62, 0x9b, 0x6c,
-    0x39, 0x64, 0x5b, 0x31, 0x45, 0x2c, 0x13, 0x0e, 0x1c, 0x29, 0x1b, 0x2b, 0x41, 0x2c, 0x17, 0x02, 0x01, 0x20, 0x1d,
-    0xb3, 0x1a, 0x2a, 0x02, 0x02, 0x3a, 0x61, 0x83, 0x4a, 0x89, 0x98, 0x06, 0x01, 0x72, 0x3a, 0x62, 0x46, 0x27, 0x98,
-    0x85, 0x7f, 0x3b, 0x5f, 0x43, 0x24, 0x98, 0x36, 0x67, 0x9a, 0x64, 0x72, 0xaa, 0x30, 0x15, 0x43, 0x58, 0x6a, 0x3b,
-    0x69, 0x1c, 0x32, 0x25, 0x16, 0x01, 0x3b, 0x6a, 0x92, 0x57, 0x64, 0xca, 0x65, 0x62, 0xca, 0x67, 0x87, 0xcd, 0x8b,
-    0x47, 0x02, 0x8b, 0x97, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x50, 0xff, 0xe3, 0x04, 0x7d, 0x04, 0x3a, 0x00, 0x33,
-    0x00, 0x38, 0x40, 0x35, 0x2f, 0x01, 0x03, 0x04, 0x01, 0x4a, 0x00, 0x01, 0x05, 0x04, 0x05, 0x01, 0x04, 0x70, 0x00,
-    0x04, 0x00, 0x03, 0x00, 0x04, 0x03, 0x63, 0x00, 0x05, 0x05, 0x06, 0x5b, 0x00, 0x06, 0x06, 0x18, 0x4b, 0x00, 0x00,
-    0x00, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x1e, 0x02, 0x4c, 0x21, 0x24, 0x21, 0x25, 0x27, 0x17, 0x22, 0x07, 0x06, 0x1b,
-    0x2b, 0x25, 0x14, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x26, 0x27, 0x33, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x23,
-    0x06, 0x26, 0x27, 0x35, 0x26, 0x26, 0x27, 0x23, 0x27, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x23, 0x27, 0x33,
-    0x32, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x07, 0x16, 0x16, 0x15, 0x15, 0x02, 0xdb, 0x26, 0x35, 0x22, 0x33, 0x23, 0x12,
-    0x01, 0x02, 0x21, 0x1e, 0xb4, 0x1a, 0x2b, 0x02, 0x02, 0x35, 0x57, 0x75, 0x42, 0x86, 0x88, 0x06, 0x01, 0x6b, 0x63,
-    0xad, 0x02, 0x95, 0x7a, 0x70, 0x74, 0x7a, 0xdf, 0x06, 0xe5, 0x64, 0x9e, 0x6d, 0x39, 0x61, 0x5b, 0x66, 0x54, 0xd5,
-    0x27, 0x31, 0x2b, 0x4d, 0x6c, 0x42, 0x4e, 0xa3, 0x4e, 0x4e, 0xa0, 0x51, 0x6e, 0xa6, 0x70, 0x39, 0x03, 0x72, 0x81,
-    0x4b, 0x4a, 0x4e, 0x01, 0x96, 0x57, 0x4b, 0x4f, 0x63, 0x96, 0x2c, 0x52, 0x78, 0x4c, 0x54, 0x6f, 0x24, 0x1c, 0x7e,
-    0x55, 0x4d, 0x00, 0x02, 0x00, 0xb3, 0xfe, 0xa5, 0x04, 0x52, 0x05, 0xb0, 0x00, 0x2b, 0x00, 0x37, 0x00, 0x40, 0x40,
-    0x3d, 0x15, 0x01, 0x04, 0x00, 0x1e, 0x01, 0x03, 0x05, 0x02, 0x4a, 0x32, 0x31, 0x02, 0x03, 0x47, 0x00, 0x00, 0x06,
-    0x01, 0x04, 0x05, 0x00, 0x04, 0x63, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x16, 0x4b, 0x00, 0x05, 0x05,
-    0x03, 0x59, 0x00, 0x03, 0x03, 0x17, 0x03, 0x4c, 0x00, 0x00, 0x37, 0x36, 0x00, 0x2b, 0x00, 0x2a, 0x20, 0x1f, 0x21,
-    0x26, 0x21, 0x07, 0x06, 0x17, 0x2b, 0x01, 0x35, 0x33, 0x32, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x21, 0x35, 0x21,
-    0x32, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x07, 0x1e, 0x03, 0x15, 0x15, 0x14, 0x16, 0x17, 0x15, 0x23, 0x2e, 0x03, 0x35,
-    0x35, 0x34, 0x2e, 0x02, 0x23, 0x01, 0x14, 0x0e, 0x02, 0x07, 0x27, 0x36, 0x36, 0x35, 0x35, 0x33, 0x01, 0x10, 0xa3,
-    0xa9, 0x9b, 0x24, 0x4b, 0x73, 0x4e, 0xfe, 0xec, 0x01, 0x14, 0x74, 0xb6, 0x7d, 0x42, 0x77, 0x70, 0x3e, 0x56, 0x36,
-    0x19, 0x1e, 0x27, 0xbf, 0x17, 0x19, 0x0c, 0x03, 0x26, 0x45, 0x61, 0x3c, 0x02, 0x67, 0x17, 0x2d, 0x40, 0x2a, 0x73,
-    0x30, 0x28, 0xc9, 0x02, 0x79, 0x98, 0x81, 0x82, 0x3c, 0x61, 0x43, 0x24, 0x98, 0x35, 0x68, 0x9b, 0x66, 0x73, 0xa4,
-    0x31, 0x14, 0x42, 0x58, 0x6c, 0x3d, 0x88, 0x3f, 0x6d, 0x26, 0x19, 0x15, 0x41, 0x45, 0x3f, 0x13, 0x84, 0x3c, 0x62,
-    0x45, 0x25, 0xfd, 0xa7, 0x2f, 0x67, 0x65, 0x5c, 0x24, 0x3f, 0x46, 0x9e, 0x55, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0xd0, 0xfe, 0x92, 0x04, 0x30, 0x04, 0x3a, 0x00, 0x29, 0x00, 0x35, 0x00, 0x38, 0x40, 0x35, 0x13, 0x01, 0x03,
-    0x00, 0x01, 0x4a, 0x30, 0x2f, 0x20, 0x1e, 0x19, 0x05, 0x04, 0x47, 0x00, 0x04, 0x03, 0x04, 0x73, 0x00, 0x00, 0x05,
-    0x01, 0x03, 0x04, 0x00, 0x03, 0x63, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x18, 0x01, 0x4c, 0x00, 0x00,
-    0x35, 0x34, 0x00, 0x29, 0x00, 0x28, 0x21, 0x24, 0x21, 0x06, 0x06, 0x17, 0x2b, 0x01, 0x35, 0x33, 0x32, 0x36, 0x35,
-    0x34, 0x26, 0x23, 0x21, 0x37, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x07, 0x1e, 0x03, 0x15, 0x15, 0x14, 0x1e,
-    0x02, 0x17, 0x15, 0x23, 0x2e, 0x03, 0x35, 0x35, 0x34, 0x26, 0x27, 0x01, 0x14, 0x0e, 0x02, 0x07, 0x27, 0x36, 0x36,
-    0x35, 0x35, 0x33, 0x01, 0x19, 0xd4, 0x7c, 0x74, 0x75, 0x7b, 0xfe, 0xe3, 0x01, 0x01, 0x1c, 0x64, 0x9e, 0x6e, 0x3a,
-    0x62, 0x5e, 0x34, 0x49, 0x2e, 0x15, 0x05, 0x0d, 0x17, 0x12, 0xbf, 0x14, 0x16, 0x0a, 0x02, 0x6e, 0x65, 0x02, 0x26,
-    0x17, 0x2d, 0x40, 0x2a, 0x73, 0x30, 0x28, 0xc9, 0x01, 0xb9, 0x96, 0x56, 0x4e, 0x50, 0x61, 0x96, 0x2b, 0x52, 0x77,
-    0x4d, 0x54, 0x73, 0x23, 0x0f, 0x32, 0x42, 0x51, 0x2e, 0x61, 0x12, 0x2a, 0x2a, 0x26, 0x0d, 0x13, 0x0e, 0x30, 0x33,
-    0x2f, 0x0d, 0x5f, 0x52, 0x5a, 0x01, 0xfe, 0x54, 0x2f, 0x67, 0x65, 0x5c, 0x24, 0x3f, 0x46, 0x9e, 0x55, 0xb3, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x14, 0xff, 0xe9, 0x04, 0xa5, 0x05, 0xb0, 0x00, 0x2b, 0x00, 0x5e, 0x4b, 0xb0, 0x17, 0x50,
-    0x58, 0x40, 0x1f, 0x00, 0x05, 0x00, 0x02, 0x00, 0x05, 0x02, 0x70, 0x00, 0x00, 0x00, 0x03, 0x59, 0x00, 0x03, 0x03,
-    0x16, 0x4b, 0x04, 0x01, 0x02, 0x02, 0x01, 0x5b, 0x06, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x1b, 0x40, 0x27, 0x00,
-    0x05, 0x00, 0x02, 0x00, 0x05, 0x02, 0x70, 0x00, 0x00, 0x00, 0x03, 0x59, 0x00, 0x03, 0x03, 0x16, 0x4b, 0x00, 0x02,
-    0x02, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x17, 0x4b, 0x00, 0x04, 0x04, 0x06, 0x5b, 0x00, 0x06, 0x06, 0x1e, 0x06, 0x4c,
-    0x59, 0x40, 0x0a, 0x27, 0x17, 0x25, 0x15, 0x21, 0x25, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x01, 0x23, 0x13, 0x14, 0x02,
-    0x06, 0x06, 0x23, 0x23, 0x35, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x13, 0x21, 0x13, 0x14, 0x1e, 0x02, 0x33, 0x3e, 0x03,
-    0x37, 0x36, 0x26, 0x27, 0x37, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x23, 0x06, 0x26, 0x27, 0x02, 0x63, 0xca, 0x01, 0x23,
-    0x53, 0x89, 0x65, 0x22, 0x17, 0x34, 0x46, 0x2a, 0x12, 0x01, 0x02, 0x39, 0x01, 0x08, 0x11, 0x1c, 0x13, 0x22, 0x31,
-    0x21, 0x10, 0x01, 0x01, 0x15, 0x14, 0xb3, 0x14, 0x1d, 0x02, 0x02, 0x32, 0x56, 0x73, 0x42, 0x7a, 0x83, 0x05, 0x05,
-    0x18, 0xfd, 0xe8, 0xb8, 0xfe, 0xe2, 0xc4, 0x66, 0x97, 0x4e, 0x9b, 0xe7, 0x99, 0x02, 0xb0, 0xfb, 0x5f, 0x1b, 0x33,
-    0x27, 0x18, 0x01, 0x3c, 0x6a, 0x92, 0x56, 0x64, 0xca, 0x64, 0x01, 0x62, 0xca, 0x67, 0x86, 0xcc, 0x8c, 0x48, 0x02,
-    0x90, 0x96, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2f, 0xff, 0xe9, 0x04, 0x85, 0x04, 0x3a, 0x00, 0x2b, 0x00, 0x6f,
-    0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x2a, 0x00, 0x01, 0x03, 0x05, 0x03, 0x01, 0x05, 0x70, 0x00, 0x03, 0x03, 0x06,
-    0x59, 0x07, 0x01, 0x06, 0x06, 0x18, 0x4b, 0x00, 0x05, 0x05, 0x02, 0x5b, 0x04, 0x01, 0x02, 0x02, 0x1e, 0x4b, 0x00,
-    0x00, 0x00, 0x02, 0x5b, 0x04, 0x01, 0x02, 0x02, 0x1e, 0x02, 0x4c, 0x1b, 0x40, 0x28, 0x00, 0x01, 0x03, 0x05, 0x03,
-    0x01, 0x05, 0x70, 0x00, 0x03, 0x03, 0x06, 0x59, 0x07, 0x01, 0x06, 0x06, 0x18, 0x4b, 0x00, 0x05, 0x05, 0x04, 0x5b,
-    0x00, 0x04, 0x04, 0x17, 0x4b, 0x00, 0x00, 0x00, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x1e, 0x02, 0x4c, 0x59, 0x40, 0x0f,
-    0x00, 0x00, 0x00, 0x2b, 0x00, 0x2b, 0x21, 0x25, 0x13, 0x27, 0x17, 0x25, 0x08, 0x06, 0x1a, 0x2b, 0x01, 0x11, 0x14,
-    0x1e, 0x02, 0x33, 0x3e, 0x03, 0x37, 0x36, 0x26, 0x27, 0x33, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x23, 0x06, 0x26, 0x27,
-    0x11, 0x23, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x23, 0x37, 0x37, 0x32, 0x3e, 0x02, 0x35, 0x11, 0x02, 0xfa, 0x09, 0x12,
-    0x1b, 0x13, 0x21, 0x32, 0x22, 0x11, 0x01, 0x02, 0x20, 0x1d, 0xb3, 0x1b, 0x28, 0x02, 0x02, 0x32, 0x56, 0x73, 0x43,
-    0x79, 0x84, 0x05, 0xc5, 0x1d, 0x44, 0x72, 0x54, 0x26, 0x03, 0x17, 0x24, 0x30, 0x1b, 0x0b, 0x04, 0x3a, 0xfc, 0xe7,
-    0x20, 0x39, 0x2c, 0x1a, 0x01, 0x34, 0x5e, 0x81, 0x4e, 0x5f, 0xc0, 0x5e, 0x5d, 0xbf, 0x61, 0x7c, 0xbc, 0x80, 0x41,
-    0x02, 0x98, 0xa0, 0x02, 0x80, 0xfe, 0xcd, 0x92, 0xe7, 0xa0, 0x55, 0xa5, 0x01, 0x3b, 0x73, 0xaa, 0x70, 0x01, 0xcc,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x6f, 0xff, 0xe9, 0x04, 0x95, 0x05, 0xb0, 0x00, 0x23, 0x00, 0x68, 0x4b, 0xb0, 0x17,
-    0x50, 0x58, 0x40, 0x23, 0x00, 0x01, 0x05, 0x06, 0x05, 0x01, 0x06, 0x70, 0x00, 0x06, 0x00, 0x03, 0x00, 0x06, 0x03,
-    0x61, 0x08, 0x07, 0x02, 0x05, 0x05, 0x16, 0x4b, 0x00, 0x00, 0x00, 0x02, 0x5c, 0x04, 0x01, 0x02, 0x02, 0x1e, 0x02,
-    0x4c, 0x1b, 0x40, 0x27, 0x00, 0x01, 0x05, 0x06, 0x05, 0x01, 0x06, 0x70, 0x00, 0x06, 0x00, 0x03, 0x00, 0x06, 0x03,
-    0x61, 0x08, 0x07, 0x02, 0x05, 0x05, 0x16, 0x4b, 0x00, 0x04, 0x04, 0x17, 0x4b, 0x00, 0x00, 0x00, 0x02, 0x5c, 0x00,
-    0x02, 0x02, 0x1e, 0x02, 0x4c, 0x59, 0x40, 0x10, 0x00, 0x00, 0x00, 0x23, 0x00, 0x23, 0x11, 0x11, 0x11, 0x13, 0x27,
-    0x17, 0x25, 0x09, 0x06, 0x1b, 0x2b, 0x01, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x3e, 0x03, 0x37, 0x36, 0x26, 0x27, 0x37,
-    0x16, 0x16, 0x07, 0x0e, 0x03, 0x23, 0x06, 0x26, 0x27, 0x11, 0x21, 0x11, 0x23, 0x11, 0x33, 0x11, 0x21, 0x11, 0x03,
-    0x0c, 0x08, 0x12, 0x1b, 0x13, 0x22, 0x31, 0x20, 0x11, 0x01, 0x02, 0x20, 0x1c, 0xb2, 0x1a, 0x2a, 0x02, 0x02, 0x32,
-    0x55, 0x73, 0x43, 0x79, 0x83, 0x05, 0xfe, 0xd5, 0xb9, 0xb9, 0x01, 0x2b, 0x05, 0xb0, 0xfb, 0x84, 0x24, 0x40, 0x31,
-    0x1d, 0x01, 0x3c, 0x6b, 0x91, 0x56, 0x64, 0xca, 0x64, 0x01, 0x62, 0xca, 0x67, 0x85, 0xcd, 0x8c, 0x48, 0x02, 0xa1,
-    0xaa, 0x01, 0x51, 0xfd, 0x7b, 0x05, 0xb0, 0xfd, 0x6c, 0x02, 0x94, 0x00, 0x00, 0x00, 0x01, 0x00, 0x75, 0xff, 0xe9,
-    0x04, 0x7e, 0x04, 0x3a, 0x00, 0x23, 0x00, 0x61, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x22, 0x00, 0x06, 0x02, 0x03,
-    0x02, 0x06, 0x03, 0x70, 0x00, 0x03, 0x00, 0x00, 0x05, 0x03, 0x00, 0x61, 0x04, 0x01, 0x02, 0x02, 0x18, 0x4b, 0x00,
-    0x05, 0x05, 0x01, 0x5c, 0x07, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x1b, 0x40, 0x26, 0x00, 0x06, 0x02, 0x03, 0x02,
-    0x06, 0x03, 0x70, 0x00, 0x03, 0x00, 0x00, 0x05, 0x03, 0x00, 0x61, 0x04, 0x01, 0x02, 0x02, 0x18, 0x4b, 0x00, 0x01,
-    0x01, 0x17, 0x4b, 0x00, 0x05, 0x05, 0x07, 0x5c, 0x00, 0x07, 0x07, 0x1e, 0x07, 0x4c, 0x59, 0x40, 0x0b, 0x27, 0x17,
-    0x25, 0x11, 0x11, 0x11, 0x11, 0x10, 0x08, 0x06, 0x1c, 0x2b, 0x01, 0x21, 0x11, 0x23, 0x11, 0x33, 0x11, 0x21, 0x11,
-    0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x3e, 0x03, 0x37, 0x36, 0x26, 0x27, 0x33, 0x16, 0x16, 0x07, 0x0e, 0x03, 0x23,
-    0x06, 0x26, 0x27, 0x02, 0x3b, 0xfe, 0xf3, 0xb9, 0xb9, 0x01, 0x0d, 0xb9, 0x0a, 0x17, 0x22, 0x17, 0x1d, 0x2c, 0x1c,
-    0x0f, 0x01, 0x01, 0x16, 0x14, 0xb2, 0x14, 0x1e, 0x02, 0x02, 0x2f, 0x51, 0x6d, 0x3f, 0x81, 0x8d, 0x05, 0x01, 0xcd,
-    0xfe, 0x33, 0x04, 0x3a, 0xfe, 0x2a, 0x01, 0xd6, 0xfc, 0xe7, 0x20, 0x39, 0x2c, 0x1a, 0x01, 0x34, 0x5e, 0x81, 0x4e,
-    0x5f, 0xc0, 0x5e, 0x5d, 0xbf, 0x61, 0x7c, 0xbc, 0x80, 0x41, 0x02, 0x98, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x8e, 0xff, 0xeb, 0x04, 0x75, 0x05, 0xc5, 0x00, 0x2d, 0x00, 0x3c, 0x40, 0x39, 0x0e, 0x01, 0x02, 0x01, 0x0f, 0x01,
-    0x04, 0x02, 0x02, 0x4a, 0x00, 0x04, 0x02, 0x03, 0x02, 0x04, 0x03, 0x70, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x00, 0x01,
-    0x01, 0x1d, 0x4b, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x05, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x4c, 0x01, 0x00, 0x24, 0x23,
-    0x1e, 0x1c, 0x13, 0x11, 0x0c, 0x0a, 0x00, 0x2d, 0x01, 0x2d, 0x06, 0x06, 0x14, 0x2b, 0x05, 0x22, 0x2e, 0x02, 0x35,
-    0x11, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x11, 0x14, 0x1e,
-    0x02, 0x33, 0x36, 0x36, 0x37, 0x36, 0x26, 0x27, 0x33, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x02, 0x94, 0x75, 0xbf, 0x88,
-    0x4a, 0x4a, 0x88, 0xbf, 0x75, 0x70, 0xae, 0x43, 0x3b, 0x41, 0x8f, 0x56, 0x4f, 0x7c, 0x55, 0x2d, 0x2d, 0x55, 0x7c,
-    0x4f, 0x8d, 0x97, 0x03, 0x02, 0x1d, 0x17, 0xb3, 0x0a, 0x14, 0x11, 0x0a, 0x01, 0x02, 0x4e, 0x83, 0xad, 0x15, 0x5f,
-    0xa6, 0xe2, 0x83, 0x01, 0x06, 0x83, 0xe1, 0xa7, 0x5f, 0x2c, 0x2c, 0x84, 0x21, 0x23, 0x4a, 0x7f, 0xa9, 0x5e, 0xfe,
-    0xf8, 0x5f, 0xaa, 0x80, 0x4a, 0x02, 0x9d, 0x88, 0x5a, 0xb5, 0x5a, 0x2c, 0x5a, 0x5b, 0x5b, 0x2d, 0x70, 0xa8, 0x6f,
-    0x37, 0x00, 0x00, 0x00, 0x01, 0x00, 0xa0, 0xff, 0xeb, 0x04, 0x50, 0x04, 0x4e, 0x00, 0x2b, 0x00, 0x3c, 0x40, 0x39,
-    0x1d, 0x01, 0x04, 0x03, 0x1e, 0x01, 0x01, 0x04, 0x02, 0x4a, 0x00, 0x01, 0x04, 0x00, 0x04, 0x01, 0x00, 0x70, 0x00,
-    0x04, 0x04, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x1f, 0x4b, 0x05, 0x01, 0x00, 0x00, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x1e,
-    0x02, 0x4c, 0x01, 0x00, 0x22, 0x20, 0x1b, 0x19, 0x10, 0x0e, 0x07, 0x06, 0x00, 0x2b, 0x01, 0x2b, 0x06, 0x06, 0x14,
-    0x2b, 0x25, 0x36, 0x36, 0x37, 0x34, 0x26, 0x27, 0x33, 0x16, 0x16, 0x15, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x35,
-    0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x15, 0x14, 0x1e,
-    0x02, 0x02, 0xb4, 0x79, 0x68, 0x02, 0x06, 0x0e, 0xb2, 0x0b, 0x10, 0x02, 0x40, 0x6e, 0x95, 0x57, 0x80, 0xc6, 0x87,
-    0x47, 0x44, 0x82, 0xbe, 0x7b, 0x6b, 0x9f, 0x35, 0x2c, 0x36, 0x8c, 0x51, 0x56, 0x7a, 0x50, 0x25, 0x28, 0x54, 0x83,
-    0x82, 0x01, 0x62, 0x5a, 0x35, 0x6f, 0x36, 0x36, 0x6e, 0x36, 0x57, 0x80, 0x54, 0x29, 0x59, 0x94, 0xc4, 0x6c, 0x2a,
-    0x6c, 0xc3, 0x94, 0x59, 0x22, 0x20, 0x90, 0x1c, 0x1e, 0x45, 0x6f, 0x8a, 0x46, 0x2a, 0x47, 0x8b, 0x6f, 0x45, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x4c, 0xff, 0xea, 0x04, 0x95, 0x05, 0xb0, 0x00, 0x21, 0x00, 0x2a, 0x40, 0x27, 0x00, 0x04,
-    0x00, 0x03, 0x00, 0x04, 0x03, 0x70, 0x02, 0x01, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x16, 0x4b, 0x00, 0x03,
-    0x03, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x1e, 0x05, 0x4c, 0x27, 0x17, 0x25, 0x11, 0x11, 0x10, 0x06, 0x06, 0x1a, 0x2b,
-    0x01, 0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x3e, 0x03, 0x37, 0x36, 0x26, 0x27, 0x37, 0x16,
-    0x16, 0x07, 0x0e, 0x03, 0x23, 0x06, 0x2e, 0x02, 0x27, 0x01, 0xb5, 0xfe, 0x97, 0x03, 0xa8, 0xfe, 0x7a, 0x13, 0x26,
-    0x38, 0x24, 0x35, 0x4f, 0x35, 0x1b, 0x02, 0x02, 0x21, 0x1d, 0xb3, 0x1b, 0x2a, 0x03, 0x02, 0x3f, 0x6c, 0x90, 0x52,
-    0x4d, 0x79, 0x55, 0x2f, 0x04, 0x05, 0x18, 0x98, 0x98, 0xfc, 0x41, 0x2d, 0x4f, 0x3a, 0x21, 0x01, 0x3b, 0x69, 0x92,
-    0x58, 0x64, 0xca, 0x64, 0x01, 0x62, 0xca, 0x67, 0x87, 0xcd, 0x8b, 0x47, 0x01, 0x2b, 0x5a, 0x8b, 0x5f, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x49, 0xff, 0xe9, 0x04, 0x6a, 0x04, 0x3a, 0x00, 0x21, 0x00, 0x2a, 0x40, 0x27, 0x00, 0x04,
-    0x00, 0x03, 0x00, 0x04, 0x03, 0x70, 0x02, 0x01, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x18, 0x4b, 0x00, 0x03,
-    0x03, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x1e, 0x05, 0x4c, 0x29, 0x17, 0x25, 0x11, 0x11, 0x10, 0x06, 0x06, 0x1a, 0x2b,
-    0x01, 0x21, 0x35, 0x21, 0x15, 0x21, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x3e, 0x03, 0x37, 0x36, 0x26, 0x27, 0x33, 0x1e,
-    0x03, 0x07, 0x0e, 0x03, 0x23, 0x06, 0x26, 0x27, 0x01, 0x9a, 0xfe, 0xaf, 0x03, 0x85, 0xfe, 0x86, 0x13, 0x27, 0x38,
-    0x25, 0x30, 0x48, 0x32, 0x19, 0x02, 0x02, 0x21, 0x1d, 0xb2, 0x0d, 0x19, 0x13, 0x0b, 0x01, 0x02, 0x3d, 0x68, 0x89,
-    0x4e, 0x9b, 0xae, 0x08, 0x03, 0xa4, 0x96, 0x96, 0xfd, 0xb5, 0x2e, 0x4e, 0x3a, 0x21, 0x01, 0x2b, 0x4e, 0x6c, 0x42,
-    0x4f, 0xa8, 0x4e, 0x27, 0x51, 0x52, 0x52, 0x29, 0x6e, 0xa7, 0x71, 0x39, 0x02, 0xb1, 0xbf, 0x00, 0x00, 0x01, 0x00,
-    0x6c, 0xff, 0xec, 0x04, 0x6f, 0x05, 0xc5, 0x00, 0x3e, 0x00, 0x4e, 0x40, 0x4b, 0x1d, 0x01, 0x00, 0x07, 0x01, 0x4a,
-    0x00, 0x05, 0x06, 0x07, 0x06, 0x05, 0x07, 0x70, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x70, 0x00, 0x07, 0x08,
-    0x01, 0x00, 0x02, 0x07, 0x00, 0x63, 0x00, 0x06, 0x06, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x1d, 0x4b, 0x00, 0x01, 0x01,
-    0x03, 0x5b, 0x00, 0x03, 0x03, 0x1e, 0x03, 0x4c, 0x01, 0x00, 0x3d, 0x3b, 0x33, 0x31, 0x2d, 0x2c, 0x28, 0x26, 0x16,
-    0x14, 0x10, 0x0f, 0x0b, 0x09, 0x00, 0x3e, 0x01, 0x3e, 0x09, 0x06, 0x14, 0x2b, 0x01, 0x22, 0x0e, 0x02, 0x15, 0x14,
-    0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x33, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x26, 0x36, 0x37,
-    0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15,
-    0x14, 0x1e, 0x02, 0x33, 0x33, 0x15, 0x02, 0x75, 0x4f, 0x7d, 0x56, 0x2d, 0x31, 0x5a, 0x81, 0x51, 0x44, 0x70, 0x51,
-    0x2d, 0x01, 0xb9, 0x56, 0x8b, 0xb0, 0x5b, 0x73, 0xc3, 0x8f, 0x51, 0x01, 0x87, 0x7c, 0x37, 0x58, 0x3d, 0x21, 0x4a,
-    0x87, 0xbd, 0x73, 0x5f, 0xac, 0x81, 0x4c, 0xb9, 0x01, 0x2d, 0x4d, 0x68, 0x3c, 0x52, 0x7b, 0x51, 0x29, 0x26, 0x4d,
-    0x76, 0x50, 0xb6, 0x02, 0x9a, 0x1f, 0x41, 0x63, 0x45, 0x3c, 0x64, 0x48, 0x28, 0x2b, 0x4a, 0x64, 0x39, 0x6f, 0xa0,
-    0x68, 0x31, 0x38, 0x6c, 0x9f, 0x67, 0x80, 0xab, 0x2a, 0x17, 0x42, 0x51, 0x5e, 0x33, 0x66, 0x9b, 0x69, 0x35, 0x38,
-    0x68, 0x95, 0x5d, 0x36, 0x5c, 0x42, 0x26, 0x28, 0x46, 0x5e, 0x37, 0x38, 0x5b, 0x41, 0x24, 0x98, 0x00, 0xff, 0xff,
-    0x00, 0x49, 0x02, 0x8b, 0x04, 0x88, 0x03, 0x22, 0x00, 0x47, 0x01, 0x88, 0xff, 0x6e, 0x00, 0x00, 0x53, 0x33, 0x40,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x4e, 0x02, 0x8b, 0x04, 0x8d, 0x03, 0x22, 0x00, 0x47, 0x01, 0x88, 0xff, 0x73,
-    0x00, 0x00, 0x53, 0x33, 0x40, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xa6, 0xfe, 0x6a, 0x04, 0x3b, 0x00, 0x00, 0x02,
-    0x27, 0x00, 0x41, 0x00, 0x0b, 0xff, 0x01, 0x01, 0x06, 0x00, 0x41, 0x0b, 0x00, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8,
-    0xff, 0x01, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x01, 0x01, 0xec, 0x04, 0x0f, 0x02, 0xff, 0x06, 0x1d, 0x00, 0x0b, 0x00,
-    0x10, 0x40, 0x0d, 0x06, 0x05, 0x02, 0x00, 0x48, 0x00, 0x00, 0x00, 0x69, 0x1a, 0x01, 0x08, 0x15, 0x2b, 0x01, 0x34,
-    0x3e, 0x02, 0x37, 0x17, 0x06, 0x06, 0x15, 0x15, 0x23, 0x01, 0xec, 0x17, 0x2d, 0x40, 0x2a, 0x65, 0x2f, 0x2f, 0xb5,
-    0x04, 0xa1, 0x2f, 0x68, 0x65, 0x5c, 0x24, 0x48, 0x47, 0x94, 0x56, 0x95, 0x00, 0x00, 0x01, 0x01, 0xcd, 0x04, 0x07,
-    0x02, 0xe0, 0x06, 0x16, 0x00, 0x0b, 0x00, 0x10, 0x40, 0x0d, 0x06, 0x05, 0x02, 0x00, 0x47, 0x00, 0x00, 0x00, 0x69,
-    0x1a, 0x01, 0x08, 0x15, 0x2b, 0x01, 0x14, 0x0e, 0x02, 0x07, 0x27, 0x36, 0x36, 0x35, 0x35, 0x33, 0x02, 0xe0, 0x17,
-    0x2d, 0x40, 0x2a, 0x65, 0x2f, 0x2f, 0xb5, 0x05, 0x83, 0x2f, 0x68, 0x65, 0x5c, 0x24, 0x48, 0x47, 0x94, 0x56, 0x96,
-    0x00, 0x00, 0x01, 0x01, 0xbc, 0xfe, 0xd1, 0x02, 0xd3, 0x00, 0xe1, 0x00, 0x0b, 0x00, 0x10, 0x40, 0x0d, 0x06, 0x05,
-    0x02, 0x00, 0x47, 0x00, 0x00, 0x00, 0x69, 0x1a, 0x01, 0x08, 0x15, 0x2b, 0x25, 0x14, 0x0e, 0x02, 0x07, 0x27, 0x36,
-    0x36, 0x35, 0x35, 0x33, 0x02, 0xd3, 0x17, 0x2d, 0x40, 0x2a, 0x69, 0x2f, 0x2f, 0xb9, 0x4c, 0x2f, 0x67, 0x64, 0x5d,
-    0x24, 0x49, 0x46, 0x94, 0x56, 0x97, 0x00, 0x00, 0xff, 0xff, 0x01, 0xcf, 0x04, 0x07, 0x02, 0xe3, 0x06, 0x16, 0x00,
-    0x47, 0x01, 0x68, 0x04, 0xaf, 0x00, 0x00, 0xc0, 0x00, 0x40, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x49, 0x04, 0x0f,
-    0x03, 0xa1, 0x06, 0x1d, 0x02, 0x27, 0x01, 0x67, 0xff, 0x5d, 0x00, 0x00, 0x00, 0x07, 0x01, 0x67, 0x00, 0xa2, 0x00,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x2d, 0x04, 0x07, 0x03, 0x8c, 0x06, 0x16, 0x02, 0x27, 0x01, 0x68, 0xff, 0x60,
-    0x00, 0x00, 0x00, 0x07, 0x01, 0x68, 0x00, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x2f, 0xfe, 0xcf, 0x03,
-    0x68, 0x00, 0xdf, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x14, 0x40, 0x11, 0x12, 0x11, 0x06, 0x05, 0x04, 0x00, 0x47, 0x01,
-    0x01, 0x00, 0x00, 0x69, 0x1b, 0x1a, 0x02, 0x08, 0x16, 0x2b, 0x25, 0x14, 0x0e, 0x02, 0x07, 0x27, 0x36, 0x36, 0x35,
-    0x35, 0x33, 0x05, 0x14, 0x0e, 0x02, 0x07, 0x27, 0x36, 0x36, 0x35, 0x35, 0x33, 0x02, 0x46, 0x17, 0x2d, 0x40, 0x2a,
-    0x69, 0x2f, 0x2f, 0xb9, 0x01, 0x22, 0x17, 0x2d, 0x40, 0x2a, 0x69, 0x2f, 0x2f, 0xb9, 0x4b, 0x2f, 0x68, 0x64, 0x5d,
-    0x24, 0x49, 0x46, 0x94, 0x56, 0x97, 0x94, 0x2f, 0x68, 0x64, 0x5d, 0x24, 0x49, 0x46, 0x94, 0x56, 0x97, 0x00, 0x01,
-    0x00, 0x77, 0x00, 0x00, 0x04, 0x55, 0x05, 0xb0, 0x00, 0x0b, 0x00, 0x23, 0x40, 0x20, 0x00, 0x04, 0x04, 0x3c, 0x4b,
-    0x02, 0x01, 0x00, 0x00, 0x03, 0x59, 0x05, 0x01, 0x03, 0x03, 0x3f, 0x4b, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x01, 0x21, 0x11, 0x23, 0x11, 0x21, 0x35, 0x21, 0x11, 0x33,
-    0x11, 0x21, 0x04, 0x55, 0xfe, 0x6b, 0xb9, 0xfe, 0x70, 0x01, 0x90, 0xb9, 0x01, 0x95, 0x03, 0xa1, 0xfc, 0x5f, 0x03,
-    0xa1, 0x99, 0x01, 0x76, 0xfe, 0x8a, 0x00, 0x01, 0x00, 0x79, 0xfe, 0x60, 0x04, 0x56, 0x05, 0xb0, 0x00, 0x13, 0x00,
-    0x34, 0x40, 0x31, 0x00, 0x06, 0x06, 0x3c, 0x4b, 0x08, 0x01, 0x04, 0x04, 0x05, 0x59, 0x07, 0x01, 0x05, 0x05, 0x3f,
-    0x4b, 0x09, 0x01, 0x03, 0x03, 0x00, 0x59, 0x02, 0x01, 0x00, 0x00, 0x3d, 0x4b, 0x00, 0x01, 0x01, 0x41, 0x01, 0x4c,
-    0x13, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0a, 0x08, 0x1d, 0x2b, 0x21, 0x21, 0x11, 0x23,
-    0x11, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x33, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x04, 0x56, 0xfe,
-    0x69, 0xb9, 0xfe, 0x73, 0x01, 0x8d, 0xfe, 0x73, 0x01, 0x8d, 0xb9, 0x01, 0x97, 0xfe, 0x69, 0x01, 0x97, 0xfe, 0x60,
-    0x01, 0xa0, 0x97, 0x03, 0x0a, 0x99, 0x01, 0x76, 0xfe, 0x8a, 0x99, 0xfc, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0x9a, 0x02, 0x17, 0x03, 0x31, 0x03, 0xdc, 0x00, 0x15, 0x00, 0x18, 0x40, 0x15, 0x00, 0x00, 0x01, 0x01, 0x00, 0x57,
-    0x00, 0x00, 0x00, 0x01, 0x5b, 0x00, 0x01, 0x00, 0x01, 0x4f, 0x29, 0x24, 0x02, 0x08, 0x16, 0x2b, 0x01, 0x34, 0x3e,
-    0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x01, 0x9a, 0x1d, 0x34,
-    0x4b, 0x2f, 0x2f, 0x4c, 0x35, 0x1c, 0x1c, 0x35, 0x4b, 0x2f, 0x2f, 0x4b, 0x35, 0x1d, 0x03, 0x16, 0x2b, 0x49, 0x34,
-    0x1e, 0x1e, 0x34, 0x49, 0x2b, 0x3a, 0x2b, 0x48, 0x35, 0x1d, 0x1d, 0x35, 0x48, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x01, 0x5c, 0xff, 0xed, 0x04, 0x3a, 0x01, 0x07, 0x02, 0x27, 0x00, 0x10, 0xff, 0x6c, 0x00, 0x00, 0x00, 0x07, 0x00,
-    0x10, 0x01, 0x26, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x09, 0xff, 0xed, 0x05, 0x26, 0x01, 0x07, 0x02, 0x27,
-    0x00, 0x10, 0xff, 0x19, 0x00, 0x00, 0x00, 0x27, 0x00, 0x10, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x02,
-    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x36, 0xff, 0xeb, 0x04, 0xa0, 0x05, 0xc5, 0x00, 0x21, 0x00, 0x37,
-    0x00, 0x3b, 0x00, 0x51, 0x00, 0x67, 0x00, 0x7d, 0x00, 0x4e, 0x40, 0x4b, 0x3b, 0x3a, 0x02, 0x0a, 0x0b, 0x39, 0x08,
-    0x02, 0x07, 0x00, 0x19, 0x01, 0x02, 0x06, 0x03, 0x4a, 0x00, 0x0a, 0x00, 0x05, 0x00, 0x0a, 0x05, 0x63, 0x01, 0x01,
-    0x00, 0x09, 0x01, 0x07, 0x06, 0x00, 0x07, 0x63, 0x00, 0x0b, 0x0b, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x44, 0x4b, 0x08,
-    0x01, 0x06, 0x06, 0x02, 0x5b, 0x03, 0x01, 0x02, 0x02, 0x45, 0x02, 0x4c, 0x79, 0x77, 0x6e, 0x6c, 0x63, 0x61, 0x29,
-    0x29, 0x2d, 0x29, 0x29, 0x24, 0x29, 0x24, 0x24, 0x0c, 0x08, 0x1d, 0x2b, 0x01, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16,
-    0x17, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x06, 0x06, 0x23,
-    0x22, 0x2e, 0x02, 0x35, 0x01, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22,
-    0x2e, 0x02, 0x35, 0x13, 0x27, 0x01, 0x17, 0x03, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e,
-    0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x05, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02,
-    0x23, 0x22, 0x0e, 0x02, 0x15, 0x01, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23,
-    0x22, 0x0e, 0x02, 0x15, 0x01, 0x56, 0x1f, 0x3e, 0x5b, 0x3c, 0x3a, 0x58, 0x1f, 0x1f, 0x57, 0x3a, 0x3d, 0x5b, 0x3e,
-    0x1f, 0x1f, 0x3d, 0x5b, 0x3c, 0x3a, 0x59, 0x1f, 0x1f, 0x57, 0x39, 0x3d, 0x5c, 0x3e, 0x1f, 0xfe, 0xe0, 0x1f, 0x3e,
-    0x5b, 0x3c, 0x3d, 0x5b, 0x3e, 0x1f, 0x20, 0x3d, 0x5a, 0x3c, 0x3c, 0x5c, 0x3e, 0x20, 0x79, 0x44, 0x03, 0x10, 0x44,
-    0x7e, 0x0b, 0x1a, 0x29, 0x1e, 0x1d, 0x28, 0x18, 0x0b, 0x0b, 0x19, 0x29, 0x1d, 0x1e, 0x28, 0x19, 0x0b, 0xfe, 0xa0,
-    0x0b, 0x19, 0x29, 0x1e, 0x1d, 0x28, 0x18, 0x0b, 0x0b, 0x19, 0x28, 0x1e, 0x1d, 0x28, 0x19, 0x0b, 0xfe, 0xe0, 0x0b,
-    0x1a, 0x28, 0x1e, 0x1c, 0x28, 0x19, 0x0b, 0x0b, 0x19, 0x28, 0x1e, 0x1d, 0x28, 0x19, 0x0b, 0x01, 0x2f, 0x38, 0x65,
-    0x4d, 0x2e, 0x2a, 0x23, 0x23, 0x2a, 0x2e, 0x4d, 0x65, 0x38, 0x2c, 0x38, 0x66, 0x4d, 0x2d, 0x29, 0x23, 0x23, 0x29,
-    0x2d, 0x4d, 0x66, 0x38, 0x03, 0xa9, 0x38, 0x66, 0x4d, 0x2e, 0x2e, 0x4d, 0x66, 0x38, 0x2c, 0x38, 0x65, 0x4c, 0x2e,
-    0x2e, 0x4c, 0x65, 0x38, 0xfd, 0x3f, 0x54, 0x02, 0x81, 0x54, 0xfc, 0xc3, 0x1e, 0x3a, 0x2d, 0x1b, 0x1b, 0x2d, 0x3a,
-    0x1e, 0x2c, 0x1e, 0x39, 0x2d, 0x1c, 0x1c, 0x2d, 0x39, 0x1e, 0x2c, 0x1e, 0x3a, 0x2d, 0x1b, 0x1b, 0x2d, 0x3a, 0x1e,
-    0x2c, 0x1e, 0x39, 0x2d, 0x1c, 0x1c, 0x2d, 0x39, 0x1e, 0x03, 0x51, 0x1e, 0x39, 0x2d, 0x1b, 0x1b, 0x2d, 0x39, 0x1e,
-    0x2c, 0x1e, 0x39, 0x2d, 0x1c, 0x1c, 0x2d, 0x39, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x01, 0x8c, 0x00, 0x99, 0x03, 0x40,
-    0x03, 0xb5, 0x00, 0x06, 0x00, 0x1e, 0x40, 0x1b, 0x03, 0x01, 0x00, 0x01, 0x01, 0x4a, 0x00, 0x01, 0x00, 0x00, 0x01,
-    0x55, 0x00, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x01, 0x00, 0x4d, 0x13, 0x11, 0x02, 0x08, 0x16, 0x2b, 0x01, 0x01,
-    0x23, 0x01, 0x35, 0x01, 0x33, 0x02, 0x3e, 0x01, 0x02, 0x8d, 0xfe, 0xd9, 0x01, 0x27, 0x8d, 0x02, 0x26, 0xfe, 0x73,
-    0x01, 0x84, 0x13, 0x01, 0x85, 0x00, 0x00, 0x00, 0x01, 0x01, 0x8c, 0x00, 0x98, 0x03, 0x40, 0x03, 0xb5, 0x00, 0x06,
-    0x00, 0x26, 0x40, 0x23, 0x05, 0x01, 0x02, 0x00, 0x01, 0x01, 0x4a, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x55, 0x02,
-    0x01, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x01, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x13, 0x03, 0x08,
-    0x15, 0x2b, 0x01, 0x01, 0x15, 0x01, 0x23, 0x01, 0x01, 0x02, 0x1a, 0x01, 0x26, 0xfe, 0xda, 0x8e, 0x01, 0x02, 0xfe,
-    0xfe, 0x03, 0xb5, 0xfe, 0x7b, 0x13, 0xfe, 0x7b, 0x01, 0x8e, 0x01, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x2b,
-    0x00, 0xd5, 0x03, 0x9e, 0x04, 0xd1, 0x00, 0x03, 0x00, 0x06, 0xb3, 0x02, 0x00, 0x01, 0x30, 0x2b, 0x25, 0x27, 0x01,
-    0x17, 0x01, 0x9c, 0x71, 0x02, 0x01, 0x72, 0xd5, 0x42, 0x03, 0xba, 0x42, 0x00, 0x00, 0x02, 0x01, 0x0f, 0x02, 0x38,
-    0x04, 0x18, 0x05, 0xc3, 0x00, 0x0a, 0x00, 0x0e, 0x00, 0x2b, 0x40, 0x28, 0x0d, 0x01, 0x00, 0x04, 0x08, 0x01, 0x01,
-    0x00, 0x02, 0x4a, 0x05, 0x01, 0x00, 0x03, 0x01, 0x01, 0x02, 0x00, 0x01, 0x61, 0x00, 0x02, 0x02, 0x04, 0x59, 0x00,
-    0x04, 0x04, 0x3c, 0x02, 0x4c, 0x11, 0x12, 0x11, 0x11, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x01, 0x33, 0x15, 0x23,
-    0x15, 0x23, 0x35, 0x21, 0x27, 0x01, 0x33, 0x01, 0x21, 0x11, 0x07, 0x03, 0x81, 0x97, 0x97, 0xa3, 0xfe, 0x34, 0x03,
-    0x01, 0xc9, 0xa9, 0xfe, 0x43, 0x01, 0x1a, 0x16, 0x03, 0x6f, 0x7e, 0xb9, 0xb9, 0x5e, 0x02, 0x74, 0xfd, 0xac, 0x01,
-    0x88, 0x2c, 0x00, 0x00, 0x01, 0x01, 0x4b, 0x02, 0x8b, 0x03, 0xc9, 0x05, 0xba, 0x00, 0x15, 0x00, 0x6b, 0x4b, 0xb0,
-    0x23, 0x50, 0x58, 0x40, 0x0a, 0x01, 0x01, 0x02, 0x00, 0x12, 0x01, 0x01, 0x02, 0x02, 0x4a, 0x1b, 0x40, 0x0a, 0x01,
-    0x01, 0x02, 0x04, 0x12, 0x01, 0x01, 0x02, 0x02, 0x4a, 0x59, 0x4b, 0xb0, 0x23, 0x50, 0x58, 0x40, 0x1a, 0x00, 0x02,
-    0x02, 0x00, 0x5b, 0x05, 0x04, 0x02, 0x00, 0x00, 0x3c, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x00, 0x5b, 0x05, 0x04, 0x02,
-    0x00, 0x00, 0x3c, 0x01, 0x4c, 0x1b, 0x40, 0x17, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x3c, 0x4b, 0x03,
-    0x01, 0x01, 0x01, 0x04, 0x59, 0x05, 0x01, 0x04, 0x04, 0x3c, 0x01, 0x4c, 0x59, 0x40, 0x0d, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x15, 0x13, 0x23, 0x15, 0x23, 0x06, 0x08, 0x18, 0x2b, 0x01, 0x17, 0x36, 0x36, 0x37, 0x32, 0x1e, 0x02, 0x15,
-    0x11, 0x23, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x11, 0x23, 0x11, 0x01, 0xcc, 0x1d, 0x24, 0x6f, 0x4a, 0x3c,
-    0x5f, 0x44, 0x24, 0xaa, 0x4d, 0x43, 0x3b, 0x4b, 0x14, 0xaa, 0x05, 0xab, 0x7b, 0x40, 0x49, 0x01, 0x24, 0x4b, 0x74,
-    0x50, 0xfe, 0x04, 0x01, 0xdc, 0x6a, 0x59, 0x3c, 0x31, 0xfd, 0xce, 0x03, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x69, 0x00, 0x00, 0x04, 0x76, 0x05, 0xc4, 0x00, 0x33, 0x00, 0x4b, 0x40, 0x48, 0x00, 0x09, 0x0a, 0x07, 0x0a, 0x09,
-    0x07, 0x70, 0x0b, 0x01, 0x07, 0x0c, 0x01, 0x06, 0x05, 0x07, 0x06, 0x61, 0x0d, 0x01, 0x05, 0x04, 0x01, 0x00, 0x01,
-    0x05, 0x00, 0x61, 0x00, 0x0a, 0x0a, 0x08, 0x5b, 0x00, 0x08, 0x08, 0x44, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x02, 0x59,
-    0x00, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x33, 0x32, 0x31, 0x30, 0x2f, 0x2e, 0x29, 0x27, 0x23, 0x22, 0x25, 0x11, 0x11,
-    0x11, 0x16, 0x11, 0x11, 0x14, 0x10, 0x0e, 0x08, 0x1d, 0x2b, 0x01, 0x21, 0x17, 0x14, 0x06, 0x07, 0x21, 0x07, 0x21,
-    0x35, 0x33, 0x3e, 0x03, 0x35, 0x27, 0x23, 0x35, 0x33, 0x27, 0x23, 0x35, 0x33, 0x27, 0x34, 0x3e, 0x02, 0x33, 0x32,
-    0x1e, 0x02, 0x15, 0x23, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x17, 0x21, 0x15, 0x21, 0x17, 0x21, 0x03,
-    0x22, 0xfe, 0xab, 0x03, 0x1d, 0x1f, 0x02, 0xe2, 0x01, 0xfb, 0xfa, 0x4b, 0x1b, 0x24, 0x16, 0x09, 0x03, 0xac, 0xa8,
-    0x05, 0xa3, 0x9f, 0x06, 0x42, 0x77, 0xa3, 0x60, 0x60, 0x98, 0x69, 0x38, 0xb9, 0x28, 0x43, 0x57, 0x30, 0x33, 0x59,
-    0x40, 0x25, 0x06, 0x01, 0x61, 0xfe, 0xa3, 0x04, 0x01, 0x59, 0x01, 0xd7, 0x47, 0x45, 0x84, 0x30, 0x97, 0x97, 0x07,
-    0x38, 0x49, 0x51, 0x20, 0x47, 0x7a, 0x8a, 0x7b, 0xb9, 0x66, 0xa2, 0x71, 0x3c, 0x38, 0x66, 0x8e, 0x57, 0x3f, 0x59,
-    0x39, 0x1b, 0x27, 0x49, 0x6b, 0x43, 0xb9, 0x7b, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x7f, 0xff, 0xec, 0x04,
-    0xb3, 0x05, 0xb0, 0x00, 0x29, 0x00, 0x36, 0x00, 0x9d, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0xb5, 0x0b, 0x01, 0x02, 0x01,
-    0x01, 0x4a, 0x1b, 0xb5, 0x0b, 0x01, 0x05, 0x01, 0x01, 0x4a, 0x59, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x32, 0x00,
-    0x08, 0x06, 0x0b, 0x06, 0x08, 0x0b, 0x70, 0x00, 0x0a, 0x00, 0x04, 0x01, 0x0a, 0x04, 0x63, 0x00, 0x0b, 0x0b, 0x06,
-    0x5b, 0x00, 0x06, 0x06, 0x3c, 0x4b, 0x03, 0x01, 0x00, 0x00, 0x07, 0x59, 0x09, 0x01, 0x07, 0x07, 0x3f, 0x4b, 0x00,
-    0x01, 0x01, 0x02, 0x5b, 0x05, 0x01, 0x02, 0x02, 0x45, 0x02, 0x4c, 0x1b, 0x40, 0x36, 0x00, 0x08, 0x06, 0x0b, 0x06,
-    0x08, 0x0b, 0x70, 0x00, 0x0a, 0x00, 0x04, 0x01, 0x0a, 0x04, 0x63, 0x00, 0x0b, 0x0b, 0x06, 0x5b, 0x00, 0x06, 0x06,
-    0x3c, 0x4b, 0x03, 0x01, 0x00, 0x00, 0x07, 0x59, 0x09, 0x01, 0x07, 0x07, 0x3f, 0x4b, 0x00, 0x05, 0x05, 0x3d, 0x4b,
-    0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x45, 0x02, 0x4c, 0x59, 0x40, 0x12, 0x36, 0x34, 0x2c, 0x2a, 0x29,
-    0x28, 0x11, 0x14, 0x21, 0x11, 0x24, 0x15, 0x25, 0x25, 0x10, 0x0c, 0x08, 0x1d, 0x2b, 0x01, 0x23, 0x11, 0x14, 0x1e,
-    0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x23, 0x0e, 0x03, 0x23, 0x23,
-    0x11, 0x23, 0x11, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x33, 0x11, 0x33, 0x11, 0x33, 0x01, 0x33, 0x32, 0x3e, 0x02, 0x35,
-    0x34, 0x2e, 0x02, 0x23, 0x23, 0x04, 0x9e, 0xb0, 0x0f, 0x19, 0x24, 0x15, 0x14, 0x2b, 0x0c, 0x19, 0x17, 0x51, 0x2a,
-    0x34, 0x56, 0x3f, 0x23, 0x59, 0x08, 0x35, 0x59, 0x7b, 0x4e, 0x45, 0xb9, 0xfe, 0x4e, 0x7b, 0x58, 0x36, 0x08, 0x59,
-    0xb9, 0xb0, 0xfc, 0x9a, 0x45, 0x2d, 0x40, 0x29, 0x13, 0x13, 0x28, 0x41, 0x2d, 0x45, 0x03, 0xab, 0xfd, 0x7c, 0x2c,
-    0x3c, 0x25, 0x11, 0x0a, 0x04, 0x84, 0x11, 0x16, 0x24, 0x4d, 0x78, 0x53, 0x02, 0x83, 0x52, 0x8a, 0x63, 0x37, 0xfd,
-    0xcb, 0x05, 0xb0, 0x38, 0x63, 0x89, 0x52, 0x01, 0x06, 0xfe, 0xfa, 0xfe, 0x92, 0x32, 0x52, 0x68, 0x38, 0x38, 0x6b,
-    0x53, 0x32, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7f, 0xff, 0xeb, 0x04, 0x39, 0x05, 0xc4, 0x00, 0x2f, 0x00, 0x50,
-    0x40, 0x4d, 0x21, 0x01, 0x08, 0x07, 0x22, 0x01, 0x06, 0x08, 0x09, 0x01, 0x01, 0x00, 0x0a, 0x01, 0x02, 0x01, 0x04,
-    0x4a, 0x09, 0x01, 0x06, 0x0a, 0x01, 0x05, 0x04, 0x06, 0x05, 0x61, 0x0b, 0x01, 0x04, 0x03, 0x01, 0x00, 0x01, 0x04,
-    0x00, 0x61, 0x00, 0x08, 0x08, 0x07, 0x5b, 0x00, 0x07, 0x07, 0x44, 0x4b, 0x00, 0x01, 0x01, 0x02, 0x5b, 0x00, 0x02,
-    0x02, 0x45, 0x02, 0x4c, 0x2f, 0x2e, 0x2d, 0x2c, 0x2b, 0x2a, 0x25, 0x24, 0x11, 0x11, 0x11, 0x14, 0x25, 0x24, 0x10,
-    0x0c, 0x08, 0x1d, 0x2b, 0x01, 0x21, 0x1e, 0x03, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02,
-    0x27, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x3e, 0x03, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22,
-    0x0e, 0x02, 0x07, 0x21, 0x15, 0x21, 0x15, 0x21, 0x03, 0x6e, 0xfe, 0x7e, 0x02, 0x33, 0x5a, 0x80, 0x4f, 0x3b, 0x6e,
-    0x34, 0x12, 0x38, 0x78, 0x3f, 0x75, 0xc3, 0x8d, 0x50, 0x03, 0xb3, 0xb3, 0xb3, 0xb3, 0x05, 0x51, 0x8c, 0xc0, 0x74,
-    0x3f, 0x75, 0x3d, 0x12, 0x34, 0x6f, 0x3c, 0x4e, 0x7e, 0x5a, 0x33, 0x03, 0x01, 0x82, 0xfe, 0x7e, 0x01, 0x82, 0x02,
-    0x1f, 0x67, 0x9b, 0x67, 0x34, 0x11, 0x11, 0x9a, 0x0f, 0x10, 0x48, 0x8e, 0xd3, 0x8b, 0x7a, 0x8a, 0x7b, 0x88, 0xce,
-    0x8a, 0x46, 0x11, 0x0e, 0x9b, 0x10, 0x13, 0x32, 0x63, 0x96, 0x64, 0x7b, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x49, 0xff, 0xeb, 0x04, 0x94, 0x05, 0xc5, 0x00, 0x2b, 0x00, 0x41, 0x00, 0x57, 0x00, 0x5b, 0x00, 0x0d, 0x40, 0x0a,
-    0x5a, 0x58, 0x51, 0x46, 0x3b, 0x30, 0x0f, 0x04, 0x04, 0x30, 0x2b, 0x01, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02,
-    0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15,
-    0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x13, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15,
-    0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34,
-    0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x05, 0x27, 0x01, 0x17, 0x02, 0x4c, 0x23, 0x42, 0x5f, 0x3b, 0x3d, 0x61,
-    0x43, 0x23, 0x23, 0x42, 0x60, 0x3d, 0x3c, 0x5f, 0x42, 0x24, 0x8a, 0x0f, 0x1e, 0x2c, 0x1e, 0x1e, 0x2d, 0x1d, 0x0f,
-    0x0f, 0x1e, 0x2d, 0x1f, 0x1e, 0x2b, 0x1d, 0x0f, 0xcc, 0x23, 0x43, 0x60, 0x3d, 0x3d, 0x60, 0x43, 0x23, 0x23, 0x42,
-    0x60, 0x3d, 0x3d, 0x61, 0x43, 0x23, 0x8b, 0x0e, 0x1e, 0x2e, 0x1f, 0x1e, 0x2d, 0x1e, 0x0e, 0x0e, 0x1e, 0x2d, 0x1f,
-    0x1f, 0x2d, 0x1e, 0x0e, 0xfe, 0x9c, 0x71, 0x02, 0x01, 0x72, 0x04, 0x1e, 0x34, 0x5d, 0x45, 0x28, 0x30, 0x52, 0x6d,
-    0x3c, 0x4d, 0x3d, 0x6d, 0x53, 0x30, 0x29, 0x46, 0x5d, 0x35, 0x1b, 0x32, 0x26, 0x16, 0x1f, 0x32, 0x42, 0x22, 0x4d,
-    0x22, 0x40, 0x32, 0x1f, 0x18, 0x26, 0x30, 0x18, 0xfd, 0x47, 0x3d, 0x6d, 0x52, 0x30, 0x30, 0x52, 0x6d, 0x3d, 0x4e,
-    0x3d, 0x6d, 0x52, 0x30, 0x30, 0x52, 0x6d, 0x3d, 0x23, 0x40, 0x33, 0x1e, 0x1e, 0x33, 0x40, 0x23, 0x4e, 0x22, 0x41,
-    0x33, 0x1e, 0x1e, 0x33, 0x41, 0x22, 0x90, 0x42, 0x03, 0xba, 0x42, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xdd, 0xff,
-    0xeb, 0x03, 0xf3, 0x05, 0xc9, 0x00, 0x24, 0x00, 0x31, 0x00, 0x08, 0xb5, 0x2d, 0x25, 0x12, 0x00, 0x02, 0x30, 0x2b,
-    0x05, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x06, 0x06, 0x23, 0x35, 0x32, 0x36, 0x37, 0x11, 0x34, 0x3e, 0x02, 0x33, 0x32,
-    0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x03, 0x3e, 0x03, 0x35, 0x35, 0x34,
-    0x26, 0x23, 0x22, 0x06, 0x15, 0x03, 0x54, 0x6c, 0x9e, 0x69, 0x33, 0x31, 0x68, 0x38, 0x3a, 0x68, 0x2f, 0x29, 0x50,
-    0x73, 0x4a, 0x3c, 0x64, 0x48, 0x27, 0x34, 0x65, 0x93, 0x60, 0x17, 0x38, 0x5a, 0x44, 0xed, 0x36, 0x4f, 0x34, 0x1a,
-    0x2d, 0x29, 0x42, 0x3b, 0x15, 0x42, 0x77, 0xa6, 0x65, 0x0e, 0x0c, 0x0d, 0xb0, 0x0e, 0x0d, 0x01, 0xdf, 0x56, 0x8c,
-    0x63, 0x36, 0x2d, 0x53, 0x74, 0x48, 0x29, 0x4d, 0xa9, 0xa3, 0x91, 0x34, 0x57, 0x44, 0x6d, 0x4d, 0x29, 0x02, 0x3f,
-    0x27, 0x60, 0x6b, 0x71, 0x38, 0x2b, 0x4e, 0x50, 0x73, 0x6a, 0x00, 0x04, 0x00, 0x79, 0x00, 0x00, 0x04, 0x76, 0x05,
-    0xc0, 0x00, 0x09, 0x00, 0x1f, 0x00, 0x35, 0x00, 0x39, 0x00, 0x0d, 0x40, 0x0a, 0x38, 0x36, 0x2f, 0x24, 0x19, 0x0e,
-    0x05, 0x00, 0x04, 0x30, 0x2b, 0x21, 0x23, 0x01, 0x13, 0x23, 0x11, 0x33, 0x01, 0x03, 0x33, 0x17, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x37, 0x14, 0x1e, 0x02, 0x33,
-    0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x13, 0x21, 0x35, 0x21, 0x02, 0xe3,
-    0xb0, 0xfe, 0xf5, 0x01, 0xb0, 0xaf, 0x01, 0x0c, 0x01, 0xb0, 0x53, 0x15, 0x28, 0x3c, 0x26, 0x27, 0x3d, 0x28, 0x15,
-    0x15, 0x28, 0x3c, 0x27, 0x27, 0x3b, 0x29, 0x15, 0x65, 0x04, 0x0d, 0x17, 0x13, 0x13, 0x17, 0x0d, 0x04, 0x05, 0x0d,
-    0x17, 0x13, 0x12, 0x17, 0x0c, 0x05, 0xd9, 0xfe, 0xcd, 0x01, 0x33, 0x03, 0x93, 0xfc, 0x6d, 0x05, 0xb0, 0xfc, 0x71,
-    0x03, 0x8f, 0xb5, 0x28, 0x48, 0x36, 0x1f, 0x1f, 0x36, 0x48, 0x28, 0xce, 0x28, 0x47, 0x35, 0x1f, 0x1f, 0x35, 0x47,
-    0x28, 0x09, 0x17, 0x27, 0x1d, 0x11, 0x11, 0x1d, 0x27, 0x17, 0xbc, 0x16, 0x28, 0x1d, 0x11, 0x11, 0x1d, 0x28, 0x16,
-    0xfd, 0xd5, 0x5f, 0x00, 0x00, 0x02, 0x00, 0x67, 0x03, 0x97, 0x04, 0x37, 0x05, 0xb0, 0x00, 0x0c, 0x00, 0x14, 0x00,
-    0x08, 0xb5, 0x13, 0x0f, 0x06, 0x01, 0x02, 0x30, 0x2b, 0x01, 0x03, 0x23, 0x03, 0x11, 0x23, 0x11, 0x33, 0x13, 0x13,
-    0x33, 0x11, 0x23, 0x01, 0x23, 0x11, 0x23, 0x11, 0x23, 0x35, 0x21, 0x03, 0xdd, 0x8c, 0x34, 0x8b, 0x5a, 0x70, 0x8f,
-    0x90, 0x70, 0x5a, 0xfe, 0x0c, 0x94, 0x5b, 0x93, 0x01, 0x82, 0x05, 0x21, 0xfe, 0x76, 0x01, 0x89, 0xfe, 0x77, 0x02,
-    0x19, 0xfe, 0x71, 0x01, 0x8f, 0xfd, 0xe7, 0x01, 0xc8, 0xfe, 0x38, 0x01, 0xc8, 0x51, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x99, 0xff, 0xec, 0x04, 0x94, 0x04, 0x4e, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x08, 0xb5, 0x22, 0x1e, 0x0e, 0x02, 0x02,
-    0x30, 0x2b, 0x25, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x04, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15,
-    0x21, 0x11, 0x16, 0x16, 0x33, 0x16, 0x36, 0x37, 0x01, 0x22, 0x06, 0x07, 0x11, 0x21, 0x11, 0x26, 0x26, 0x04, 0x17,
-    0x55, 0xba, 0x63, 0x6e, 0xbf, 0x8d, 0x52, 0x29, 0x48, 0x63, 0x75, 0x81, 0x42, 0x67, 0xb5, 0x85, 0x4e, 0xfd, 0x00,
-    0x37, 0x8c, 0x4e, 0x5e, 0xb9, 0x59, 0xfe, 0x90, 0x4c, 0x8c, 0x39, 0x02, 0x1c, 0x36, 0x88, 0x5e, 0x35, 0x3d, 0x59,
-    0x99, 0xcc, 0x73, 0x4c, 0x8f, 0x7c, 0x67, 0x4a, 0x29, 0x52, 0x92, 0xc6, 0x73, 0x2f, 0xfe, 0xb8, 0x33, 0x3b, 0x01,
-    0x3c, 0x3f, 0x03, 0x2a, 0x42, 0x38, 0xfe, 0xeb, 0x01, 0x1e, 0x33, 0x3e, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x50,
-    0xff, 0xf6, 0x04, 0xb9, 0x05, 0xaf, 0x00, 0x2f, 0x01, 0xc1, 0xff, 0x18, 0x02, 0xe8, 0x39, 0x9a, 0x00, 0x26, 0x01,
-    0x76, 0xf8, 0x00, 0x01, 0x0f, 0x01, 0xc8, 0x01, 0x86, 0x00, 0x00, 0x39, 0x9a, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8,
-    0x02, 0xe8, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x32, 0xff, 0xf6, 0x04, 0xc1, 0x05, 0xba, 0x00, 0x2f, 0x01,
-    0xc3, 0xff, 0x1a, 0x02, 0xea, 0x39, 0x9a, 0x00, 0x26, 0x01, 0x76, 0x1f, 0xf7, 0x01, 0x0f, 0x01, 0xc8, 0x01, 0x8e,
-    0x00, 0x00, 0x39, 0x9a, 0x00, 0x12, 0xb1, 0x00, 0x01, 0xb8, 0x02, 0xea, 0xb0, 0x33, 0x2b, 0xb1, 0x01, 0x01, 0xb8,
-    0xff, 0xf7, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x24, 0xff, 0xfa, 0x04, 0xad, 0x05, 0xb2, 0x00, 0x2f, 0x01, 0xc5,
-    0xff, 0x04, 0x02, 0xeb, 0x39, 0x9a, 0x00, 0x26, 0x01, 0x76, 0x08, 0x00, 0x01, 0x0f, 0x01, 0xc8, 0x01, 0x7a, 0x00,
-    0x04, 0x39, 0x9a, 0x00, 0x11, 0xb1, 0x00, 0x01, 0xb8, 0x02, 0xeb, 0xb0, 0x33, 0x2b, 0xb1, 0x02, 0x03, 0xb0, 0x04,
-    0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x40, 0xff, 0xf6, 0x04, 0xa7, 0x05, 0xb2, 0x00, 0x2f, 0x01, 0xc7, 0xff,
-    0x2f, 0x02, 0xeb, 0x39, 0x9a, 0x00, 0x26, 0x01, 0x76, 0xd3, 0x00, 0x01, 0x0f, 0x01, 0xc8, 0x01, 0x74, 0x00, 0x00,
-    0x39, 0x9a, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x02, 0xeb, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x02, 0x00, 0x7e, 0xff,
-    0xeb, 0x04, 0x46, 0x05, 0xec, 0x00, 0x26, 0x00, 0x3c, 0x00, 0x08, 0xb5, 0x31, 0x27, 0x1b, 0x10, 0x02, 0x30, 0x2b,
-    0x01, 0x32, 0x16, 0x17, 0x2e, 0x03, 0x23, 0x22, 0x06, 0x07, 0x27, 0x3e, 0x03, 0x33, 0x32, 0x16, 0x16, 0x12, 0x15,
-    0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x17, 0x22, 0x0e, 0x02, 0x15, 0x15,
-    0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x2e, 0x03, 0x02, 0x50, 0x5b, 0xa6, 0x3c, 0x0b, 0x42, 0x64,
-    0x82, 0x4a, 0x4e, 0x87, 0x47, 0x10, 0x1d, 0x3f, 0x4b, 0x5b, 0x3a, 0x8f, 0xcf, 0x87, 0x41, 0x41, 0x7c, 0xb5, 0x74,
-    0x72, 0xb3, 0x7c, 0x41, 0x3f, 0x78, 0xad, 0x80, 0x4d, 0x70, 0x4a, 0x24, 0x24, 0x49, 0x70, 0x4c, 0x4f, 0x71, 0x4a,
-    0x23, 0x06, 0x28, 0x48, 0x6b, 0x03, 0xfe, 0x4c, 0x45, 0x69, 0xb0, 0x7e, 0x47, 0x20, 0x1b, 0x97, 0x0d, 0x19, 0x14,
-    0x0b, 0x7c, 0xdc, 0xfe, 0xd1, 0xb4, 0x3b, 0x88, 0xee, 0xb0, 0x65, 0x51, 0x8d, 0xc1, 0x71, 0x17, 0x69, 0xb4, 0x84,
-    0x4b, 0x98, 0x37, 0x5e, 0x7b, 0x44, 0x17, 0x4c, 0x89, 0x67, 0x3d, 0x49, 0x7e, 0xa8, 0x60, 0x42, 0x1c, 0x49, 0x41,
-    0x2d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xa7, 0xff, 0x2b, 0x04, 0x25, 0x05, 0xb0, 0x00, 0x07, 0x00, 0x06, 0xb3,
-    0x06, 0x00, 0x01, 0x30, 0x2b, 0x05, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x21, 0x04, 0x25, 0xb9, 0xfd, 0xf4, 0xb9,
-    0x03, 0x7e, 0xd5, 0x05, 0xed, 0xfa, 0x13, 0x06, 0x85, 0x00, 0x00, 0x01, 0x00, 0x33, 0xfe, 0xf3, 0x04, 0x98, 0x05,
-    0xb0, 0x00, 0x0c, 0x00, 0x06, 0xb3, 0x08, 0x03, 0x01, 0x30, 0x2b, 0x01, 0x01, 0x21, 0x15, 0x21, 0x35, 0x01, 0x01,
-    0x35, 0x21, 0x15, 0x21, 0x01, 0x03, 0x58, 0xfd, 0xbc, 0x03, 0x84, 0xfb, 0x9b, 0x02, 0x60, 0xfd, 0xa0, 0x04, 0x19,
-    0xfc, 0xc7, 0x02, 0x45, 0x02, 0x41, 0xfd, 0x4a, 0x98, 0x8f, 0x02, 0xcc, 0x02, 0xd2, 0x90, 0x98, 0xfd, 0x42, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0xa9, 0x02, 0x8b, 0x03, 0xec, 0x03, 0x22, 0x00, 0x03, 0x00, 0x18, 0x40, 0x15, 0x00,
-    0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x01, 0x00, 0x4d, 0x11, 0x10, 0x02, 0x08,
-    0x16, 0x2b, 0x01, 0x21, 0x35, 0x21, 0x03, 0xec, 0xfc, 0xbd, 0x03, 0x43, 0x02, 0x8b, 0x97, 0x00, 0x00, 0x01, 0x00,
-    0x39, 0x00, 0x00, 0x04, 0x92, 0x05, 0xb0, 0x00, 0x0a, 0x00, 0x06, 0xb3, 0x05, 0x03, 0x01, 0x30, 0x2b, 0x01, 0x17,
-    0x37, 0x01, 0x33, 0x01, 0x23, 0x03, 0x23, 0x35, 0x21, 0x02, 0x18, 0x16, 0x19, 0x01, 0x8e, 0xbd, 0xfd, 0xe2, 0x8d,
-    0xf5, 0xb9, 0x01, 0x3b, 0x01, 0x51, 0x69, 0x69, 0x04, 0x5f, 0xfa, 0x50, 0x02, 0x74, 0x9a, 0x00, 0x03, 0x00, 0x35,
-    0x00, 0xe0, 0x04, 0x9a, 0x03, 0xdd, 0x00, 0x29, 0x00, 0x43, 0x00, 0x5d, 0x00, 0x0a, 0xb7, 0x57, 0x48, 0x3d, 0x2e,
-    0x19, 0x04, 0x03, 0x30, 0x2b, 0x01, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x0e, 0x03, 0x23, 0x22, 0x2e,
-    0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23,
-    0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x04, 0x07, 0x15, 0x1e, 0x05, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x21, 0x14, 0x1e,
-    0x02, 0x33, 0x32, 0x3e, 0x04, 0x37, 0x35, 0x2e, 0x05, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x04, 0x9a, 0x24, 0x47, 0x6b,
-    0x46, 0x34, 0x56, 0x45, 0x35, 0x13, 0x13, 0x34, 0x45, 0x56, 0x34, 0x47, 0x6a, 0x47, 0x24, 0x24, 0x46, 0x6a, 0x47,
-    0x34, 0x57, 0x45, 0x34, 0x13, 0x13, 0x35, 0x45, 0x56, 0x35, 0x46, 0x6a, 0x47, 0x24, 0x7c, 0x10, 0x25, 0x3d, 0x2d,
-    0x1e, 0x36, 0x2d, 0x25, 0x1c, 0x11, 0x03, 0x03, 0x11, 0x1c, 0x24, 0x2e, 0x35, 0x1e, 0x2e, 0x3d, 0x25, 0x10, 0xfc,
-    0x93, 0x10, 0x25, 0x3d, 0x2e, 0x1e, 0x35, 0x2d, 0x25, 0x1b, 0x11, 0x03, 0x03, 0x11, 0x1b, 0x25, 0x2d, 0x36, 0x1e,
-    0x2d, 0x3d, 0x25, 0x10, 0x02, 0x4a, 0x47, 0x83, 0x64, 0x3c, 0x2c, 0x46, 0x56, 0x2a, 0x2a, 0x56, 0x46, 0x2c, 0x3c,
-    0x64, 0x83, 0x47, 0x2a, 0x46, 0x83, 0x64, 0x3c, 0x2c, 0x46, 0x56, 0x2a, 0x2a, 0x56, 0x46, 0x2c, 0x3c, 0x64, 0x83,
-    0x46, 0x30, 0x57, 0x43, 0x28, 0x1c, 0x2e, 0x38, 0x37, 0x31, 0x0f, 0x1d, 0x0f, 0x31, 0x37, 0x38, 0x2d, 0x1d, 0x27,
-    0x43, 0x58, 0x31, 0x31, 0x58, 0x43, 0x27, 0x1d, 0x2d, 0x38, 0x37, 0x30, 0x10, 0x1d, 0x0f, 0x31, 0x37, 0x38, 0x2e,
-    0x1c, 0x28, 0x43, 0x57, 0x30, 0x00, 0x01, 0x00, 0xf8, 0xfe, 0x4b, 0x03, 0xd3, 0x06, 0x2b, 0x00, 0x20, 0x00, 0x06,
-    0xb3, 0x14, 0x02, 0x01, 0x30, 0x2b, 0x05, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x1e, 0x03, 0x33, 0x32, 0x36,
-    0x35, 0x11, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x11, 0x02, 0xaa,
-    0xa8, 0x9a, 0x1e, 0x35, 0x1d, 0x0e, 0x08, 0x1c, 0x1d, 0x1a, 0x07, 0x42, 0x47, 0x2e, 0x57, 0x7e, 0x4f, 0x25, 0x46,
-    0x25, 0x18, 0x11, 0x2d, 0x1d, 0x5a, 0x5c, 0x59, 0xa7, 0xb5, 0x08, 0x0a, 0x93, 0x03, 0x05, 0x03, 0x02, 0x6a, 0x5a,
-    0x05, 0x1b, 0x56, 0x86, 0x5c, 0x31, 0x0c, 0x09, 0x8e, 0x05, 0x06, 0x71, 0x60, 0xfa, 0xe5, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x8d, 0x01, 0x14, 0x04, 0x3e, 0x03, 0xff, 0x00, 0x21, 0x00, 0x43, 0x00, 0x08, 0xb5, 0x43, 0x32, 0x21,
-    0x10, 0x02, 0x30, 0x2b, 0x13, 0x36, 0x36, 0x33, 0x36, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x33, 0x32, 0x36, 0x37, 0x17,
-    0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x07, 0x06, 0x06, 0x07, 0x07, 0x36, 0x36, 0x37, 0x36, 0x1e,
-    0x02, 0x17, 0x1e, 0x03, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x07,
-    0x22, 0x06, 0x07, 0x97, 0x30, 0x7a, 0x43, 0x27, 0x3b, 0x35, 0x33, 0x20, 0x1d, 0x30, 0x31, 0x38, 0x24, 0x43, 0x7a,
-    0x2f, 0x0a, 0x30, 0x7a, 0x42, 0x25, 0x37, 0x31, 0x30, 0x1e, 0x1f, 0x34, 0x34, 0x3c, 0x27, 0x43, 0x7a, 0x2f, 0x14,
-    0x30, 0x7a, 0x43, 0x27, 0x3b, 0x35, 0x33, 0x20, 0x1d, 0x30, 0x31, 0x38, 0x24, 0x43, 0x7a, 0x2f, 0x0a, 0x30, 0x7a,
-    0x42, 0x25, 0x37, 0x31, 0x30, 0x1e, 0x1f, 0x34, 0x34, 0x3c, 0x27, 0x43, 0x7a, 0x2f, 0x03, 0x69, 0x44, 0x4e, 0x01,
-    0x0b, 0x14, 0x1b, 0x10, 0x0f, 0x19, 0x12, 0x0b, 0x4e, 0x44, 0xab, 0x43, 0x4f, 0x0b, 0x12, 0x19, 0x0f, 0x10, 0x1c,
-    0x14, 0x0b, 0x01, 0x01, 0x4e, 0x44, 0xff, 0x43, 0x4e, 0x01, 0x01, 0x0b, 0x14, 0x1c, 0x0f, 0x0f, 0x1a, 0x12, 0x0b,
-    0x4f, 0x44, 0xab, 0x44, 0x4e, 0x0a, 0x13, 0x19, 0x0f, 0x10, 0x1b, 0x14, 0x0b, 0x01, 0x4e, 0x44, 0x00, 0x00, 0x01,
-    0x00, 0xa9, 0x00, 0xb5, 0x04, 0x26, 0x04, 0x41, 0x00, 0x13, 0x00, 0x06, 0xb3, 0x0c, 0x02, 0x01, 0x30, 0x2b, 0x01,
-    0x21, 0x07, 0x27, 0x37, 0x21, 0x35, 0x21, 0x37, 0x21, 0x35, 0x21, 0x37, 0x17, 0x07, 0x33, 0x15, 0x21, 0x07, 0x21,
-    0x04, 0x26, 0xfd, 0xfc, 0x5c, 0x4e, 0x42, 0xfe, 0xef, 0x01, 0x62, 0x80, 0xfe, 0x1e, 0x02, 0x33, 0x4a, 0x4d, 0x31,
-    0xe4, 0xfe, 0xcc, 0x80, 0x01, 0xb4, 0x01, 0x6d, 0xb8, 0x33, 0x85, 0xa0, 0xff, 0xa1, 0x94, 0x33, 0x61, 0xa1, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0xbb, 0x00, 0x09, 0x04, 0x0d, 0x04, 0x9a, 0x00, 0x67, 0x00, 0x1e, 0x00, 0x13, 0x00,
-    0xbc, 0x40, 0x00, 0x39, 0x9a, 0x01, 0x07, 0x01, 0x88, 0x00, 0x12, 0xfd, 0x7e, 0x00, 0x11, 0xb1, 0x00, 0x01, 0xb0,
-    0xbc, 0xb0, 0x33, 0x2b, 0xb1, 0x01, 0x01, 0xb8, 0xfd, 0x7e, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0xc2, 0x00, 0x07, 0x04, 0x35, 0x04, 0xad, 0x00, 0x67, 0x00, 0x20, 0x00, 0x10, 0x00, 0xcf, 0x40, 0x00, 0x39, 0x9a,
-    0x01, 0x07, 0x01, 0x88, 0x00, 0x1a, 0xfd, 0x7c, 0x00, 0x11, 0xb1, 0x00, 0x01, 0xb0, 0xcf, 0xb0, 0x33, 0x2b, 0xb1,
-    0x01, 0x01, 0xb8, 0xfd, 0x7c, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x8e, 0x00, 0x00, 0x04, 0x3f,
-    0x05, 0xb0, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x08, 0xb5, 0x0c, 0x08, 0x03, 0x00, 0x02, 0x30, 0x2b, 0x01, 0x33, 0x01,
-    0x01, 0x23, 0x01, 0x21, 0x01, 0x27, 0x07, 0x01, 0x01, 0x17, 0x37, 0x02, 0x1e, 0x8d, 0x01, 0x94, 0xfe, 0x6f, 0x8d,
-    0xfe, 0x6d, 0x02, 0xf2, 0xfe, 0xf4, 0x11, 0x11, 0xfe, 0xfa, 0x01, 0x0c, 0x10, 0x12, 0x05, 0xb0, 0xfd, 0x27, 0xfd,
-    0x29, 0x02, 0xd7, 0x02, 0x0a, 0x33, 0x33, 0xfd, 0xf6, 0xfd, 0xf7, 0x33, 0x33, 0x00, 0x00, 0x00, 0x01, 0x01, 0x2e,
-    0xff, 0x56, 0x02, 0x28, 0x00, 0xef, 0x00, 0x0b, 0x00, 0x06, 0xb3, 0x0a, 0x05, 0x01, 0x30, 0x2b, 0x25, 0x14, 0x0e,
-    0x02, 0x07, 0x27, 0x36, 0x36, 0x35, 0x35, 0x33, 0x02, 0x28, 0x11, 0x24, 0x37, 0x25, 0x69, 0x25, 0x25, 0xb0, 0xa9,
-    0x2a, 0x5c, 0x5a, 0x53, 0x20, 0x48, 0x3e, 0x7f, 0x4b, 0x49, 0x00, 0x16, 0x00, 0x5c, 0x00, 0x0a, 0x04, 0x87, 0x04,
-    0x06, 0x00, 0x0d, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x3a, 0x00, 0x40, 0x00, 0x46, 0x00, 0x4c, 0x00, 0x52, 0x00, 0x5b,
-    0x00, 0x5f, 0x00, 0x63, 0x00, 0x67, 0x00, 0x6b, 0x00, 0x6f, 0x00, 0x73, 0x00, 0x7b, 0x00, 0x7f, 0x00, 0x83, 0x00,
-    0x87, 0x00, 0x8b, 0x00, 0x8f, 0x00, 0x93, 0x00, 0x31, 0x40, 0x2e, 0x92, 0x90, 0x8e, 0x8c, 0x8a, 0x88, 0x86, 0x84,
-    0x82, 0x80, 0x7e, 0x7c, 0x79, 0x74, 0x71, 0x70, 0x6d, 0x6c, 0x69, 0x68, 0x65, 0x64, 0x61, 0x60, 0x5d, 0x5c, 0x58,
-    0x53, 0x50, 0x4e, 0x48, 0x47, 0x44, 0x41, 0x3c, 0x3b, 0x39, 0x34, 0x26, 0x1f, 0x19, 0x0e, 0x09, 0x02, 0x16, 0x30,
-    0x2b, 0x01, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x17, 0x32, 0x36, 0x35,
-    0x34, 0x26, 0x27, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x23, 0x11, 0x27, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35,
-    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x05, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x23, 0x14, 0x16, 0x33, 0x32, 0x36,
-    0x35, 0x35, 0x23, 0x01, 0x35, 0x33, 0x15, 0x33, 0x15, 0x21, 0x35, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
-    0x23, 0x15, 0x25, 0x35, 0x33, 0x15, 0x23, 0x35, 0x01, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x23, 0x35, 0x03, 0x35,
-    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x13, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x21,
-    0x35, 0x33, 0x15, 0x13, 0x33, 0x32, 0x16, 0x15, 0x14, 0x23, 0x23, 0x05, 0x23, 0x35, 0x33, 0x11, 0x23, 0x35, 0x33,
-    0x11, 0x23, 0x35, 0x33, 0x01, 0x23, 0x35, 0x33, 0x11, 0x23, 0x35, 0x33, 0x11, 0x23, 0x35, 0x33, 0x01, 0xf0, 0x46,
-    0x39, 0x39, 0x46, 0x47, 0x39, 0x39, 0x45, 0x9f, 0x33, 0x39, 0x1c, 0x1c, 0x17, 0x17, 0x3e, 0x37, 0x67, 0x58, 0x28,
-    0x23, 0x24, 0x29, 0x29, 0x23, 0x23, 0x29, 0x02, 0x0e, 0x1e, 0x17, 0x1a, 0x1f, 0x33, 0x3c, 0x30, 0x2d, 0x3a, 0x32,
-    0xfc, 0x91, 0x3e, 0x6c, 0x02, 0xd7, 0x6d, 0x3d, 0xfb, 0xd5, 0xaa, 0x6c, 0x03, 0x43, 0xaa, 0x3d, 0xfe, 0x45, 0x1d,
-    0x1b, 0x1b, 0x1d, 0x46, 0x24, 0x99, 0x43, 0x99, 0xfd, 0xb0, 0x98, 0x43, 0x99, 0x43, 0x99, 0xfd, 0xb0, 0x98, 0x67,
-    0x33, 0x21, 0x20, 0x41, 0x33, 0xfe, 0x51, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x03, 0xed, 0x3d, 0x3d, 0x3d, 0x3d,
-    0x3d, 0x3d, 0x02, 0x25, 0x36, 0x42, 0x42, 0x36, 0x3e, 0x36, 0x42, 0x42, 0x36, 0x77, 0x2b, 0x2b, 0x17, 0x27, 0x08,
-    0x09, 0x22, 0x15, 0x2b, 0x28, 0xfe, 0xd1, 0x77, 0x26, 0x2b, 0x2b, 0x26, 0x3e, 0x26, 0x2b, 0x2b, 0x26, 0x55, 0x18,
-    0x1e, 0x18, 0x1a, 0x2e, 0x2d, 0x32, 0x2d, 0xd0, 0xfd, 0x6a, 0xae, 0x6f, 0x3f, 0x3f, 0x6f, 0xae, 0x03, 0x5f, 0x9d,
-    0x40, 0x5d, 0x5d, 0x40, 0x9d, 0x5d, 0xfe, 0x31, 0x1a, 0x16, 0x15, 0x18, 0x5d, 0x01, 0xcf, 0x40, 0x40, 0x40, 0x40,
-    0x40, 0x40, 0xfc, 0x44, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x02, 0x66, 0x10, 0x17, 0x2c, 0x52, 0x8a, 0xfe, 0xa7,
-    0x89, 0x01, 0x16, 0x89, 0xfe, 0xa7, 0x8a, 0xfe, 0xa7, 0x89, 0x01, 0x16, 0x89, 0x00, 0x00, 0x05, 0x00, 0x0f, 0xfd,
-    0xd5, 0x04, 0xaf, 0x08, 0x73, 0x00, 0x03, 0x00, 0x29, 0x00, 0x2d, 0x00, 0x31, 0x00, 0x35, 0x00, 0x0f, 0x40, 0x0c,
-    0x34, 0x32, 0x30, 0x2e, 0x2c, 0x2a, 0x12, 0x04, 0x02, 0x00, 0x05, 0x30, 0x2b, 0x09, 0x03, 0x05, 0x34, 0x3e, 0x02,
-    0x37, 0x3e, 0x03, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x33, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15,
-    0x14, 0x0e, 0x02, 0x07, 0x0e, 0x03, 0x15, 0x17, 0x23, 0x15, 0x33, 0x03, 0x33, 0x15, 0x23, 0x03, 0x33, 0x15, 0x23,
-    0x02, 0x62, 0x02, 0x4d, 0xfd, 0xb3, 0xfd, 0xad, 0x02, 0xba, 0x06, 0x0c, 0x11, 0x0b, 0x16, 0x2d, 0x24, 0x17, 0x25,
-    0x45, 0x66, 0x40, 0x38, 0x61, 0x49, 0x2b, 0x01, 0xcb, 0x02, 0x29, 0x18, 0x25, 0x20, 0x11, 0x18, 0x1b, 0x0a, 0x1d,
-    0x23, 0x15, 0x08, 0xca, 0xca, 0xca, 0x6c, 0x04, 0x04, 0x02, 0x04, 0x04, 0x06, 0x52, 0xfc, 0x31, 0xfc, 0x31, 0x03,
-    0xcf, 0xfb, 0x19, 0x27, 0x1f, 0x1d, 0x10, 0x1f, 0x37, 0x39, 0x40, 0x29, 0x40, 0x67, 0x49, 0x27, 0x1e, 0x41, 0x65,
-    0x46, 0x37, 0x30, 0x40, 0x34, 0x1a, 0x33, 0x2f, 0x27, 0x0d, 0x24, 0x28, 0x26, 0x32, 0x30, 0x5b, 0xaa, 0xfd, 0x56,
-    0x04, 0x0a, 0x9e, 0x04, 0x00, 0x02, 0x00, 0xb8, 0xff, 0xf0, 0x04, 0x00, 0x04, 0x9d, 0x00, 0x15, 0x00, 0x2b, 0x00,
-    0x08, 0xb5, 0x25, 0x1a, 0x0f, 0x04, 0x02, 0x30, 0x2b, 0x01, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x35, 0x3e,
-    0x03, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x27, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x15, 0x1e, 0x03, 0x33, 0x32,
-    0x3e, 0x02, 0x37, 0x04, 0x00, 0x01, 0x2f, 0x65, 0x9f, 0x6f, 0x6f, 0x9f, 0x66, 0x30, 0x01, 0x01, 0x30, 0x65, 0x9e,
-    0x6f, 0x6f, 0x9e, 0x66, 0x31, 0x01, 0xbb, 0x01, 0x15, 0x35, 0x5a, 0x45, 0x45, 0x5a, 0x35, 0x15, 0x01, 0x01, 0x16,
-    0x35, 0x5b, 0x45, 0x45, 0x5a, 0x34, 0x14, 0x01, 0x01, 0xf1, 0x64, 0xb9, 0x8f, 0x55, 0x55, 0x8f, 0xb9, 0x64, 0xae,
-    0x64, 0xb9, 0x8d, 0x54, 0x54, 0x8d, 0xb9, 0x64, 0x1c, 0x39, 0x76, 0x5e, 0x3c, 0x3c, 0x5f, 0x75, 0x39, 0xe5, 0x39,
-    0x76, 0x62, 0x3e, 0x3e, 0x62, 0x76, 0x39, 0x00, 0x01, 0x01, 0x3a, 0x00, 0x00, 0x03, 0xa4, 0x03, 0x20, 0x00, 0x1e,
-    0x00, 0x2c, 0x40, 0x29, 0x02, 0x01, 0x00, 0x04, 0x01, 0x4a, 0x00, 0x02, 0x01, 0x04, 0x01, 0x02, 0x04, 0x70, 0x00,
-    0x03, 0x00, 0x01, 0x02, 0x03, 0x01, 0x63, 0x00, 0x04, 0x04, 0x00, 0x59, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x1a,
-    0x24, 0x12, 0x27, 0x10, 0x05, 0x08, 0x19, 0x2b, 0x21, 0x21, 0x35, 0x01, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22,
-    0x06, 0x07, 0x23, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x07, 0x21, 0x03, 0xa4,
-    0xfd, 0xa9, 0x01, 0x20, 0x41, 0x38, 0x42, 0x3a, 0x4a, 0x47, 0x01, 0x9e, 0x2a, 0x4e, 0x6f, 0x45, 0x42, 0x6a, 0x4a,
-    0x28, 0x1b, 0x33, 0x47, 0x2b, 0xaf, 0x01, 0x8f, 0x6c, 0x01, 0x0f, 0x3c, 0x57, 0x23, 0x31, 0x3d, 0x4b, 0x3a, 0x36,
-    0x60, 0x47, 0x29, 0x21, 0x3e, 0x57, 0x37, 0x28, 0x47, 0x45, 0x47, 0x27, 0x91, 0x00, 0x00, 0x02, 0x01, 0x11, 0x04,
-    0xe4, 0x03, 0xef, 0x06, 0xf9, 0x00, 0x06, 0x00, 0x26, 0x00, 0x08, 0xb5, 0x26, 0x16, 0x05, 0x00, 0x02, 0x30, 0x2b,
-    0x01, 0x23, 0x27, 0x07, 0x23, 0x01, 0x33, 0x37, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02,
-    0x15, 0x27, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x03, 0xef, 0xab, 0xc5, 0xc4,
-    0xaa, 0x01, 0x24, 0x95, 0xba, 0x19, 0x2b, 0x3a, 0x22, 0x25, 0x32, 0x2b, 0x2c, 0x1e, 0x10, 0x1d, 0x17, 0x0f, 0x4d,
-    0x19, 0x2b, 0x3a, 0x22, 0x1f, 0x32, 0x2e, 0x30, 0x1d, 0x10, 0x1e, 0x17, 0x0e, 0x04, 0xe4, 0xb0, 0xb0, 0x01, 0x06,
-    0xf8, 0x21, 0x3f, 0x31, 0x1e, 0x16, 0x1b, 0x17, 0x11, 0x1b, 0x21, 0x11, 0x13, 0x21, 0x41, 0x32, 0x1f, 0x16, 0x1a,
-    0x16, 0x10, 0x1a, 0x21, 0x11, 0x00, 0x02, 0x00, 0xfc, 0x04, 0xe4, 0x04, 0xba, 0x06, 0xcf, 0x00, 0x06, 0x00, 0x1a,
-    0x00, 0x08, 0xb5, 0x11, 0x07, 0x05, 0x00, 0x02, 0x30, 0x2b, 0x01, 0x23, 0x27, 0x07, 0x23, 0x01, 0x33, 0x17, 0x27,
-    0x36, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x37, 0x32, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x07, 0x03, 0xdd, 0xab,
-    0xc6, 0xc6, 0xaa, 0x01, 0x12, 0xbc, 0xf6, 0x01, 0x3d, 0x40, 0x18, 0x27, 0x34, 0x1c, 0x06, 0x7b, 0x8c, 0x17, 0x26,
-    0x31, 0x19, 0x01, 0x04, 0xe4, 0xba, 0xba, 0x01, 0x06, 0x7c, 0x83, 0x05, 0x17, 0x23, 0x13, 0x19, 0x10, 0x07, 0x5c,
-    0x56, 0x4b, 0x21, 0x2f, 0x1f, 0x12, 0x03, 0x3c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x04, 0xe4, 0x03, 0xf9, 0x06,
-    0x95, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x08, 0xb5, 0x09, 0x07, 0x05, 0x00, 0x02, 0x30, 0x2b, 0x01, 0x23, 0x27, 0x07,
-    0x23, 0x01, 0x33, 0x05, 0x23, 0x03, 0x33, 0x03, 0xf9, 0xc5, 0xaa, 0xaa, 0xc4, 0x01, 0x22, 0x98, 0xfe, 0x8f, 0x8c,
-    0xc9, 0xc8, 0x04, 0xe4, 0x9e, 0x9e, 0x01, 0x06, 0x58, 0x01, 0x03, 0x00, 0x00, 0x00, 0x02, 0x01, 0x0b, 0x04, 0xe4,
-    0x04, 0xf4, 0x06, 0x95, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x08, 0xb5, 0x09, 0x07, 0x02, 0x00, 0x02, 0x30, 0x2b, 0x01,
-    0x33, 0x01, 0x23, 0x27, 0x07, 0x23, 0x01, 0x33, 0x03, 0x23, 0x02, 0x2f, 0x97, 0x01, 0x23, 0xc5, 0xa9, 0xaa, 0xc6,
-    0x03, 0x22, 0xc7, 0xc8, 0x8d, 0x05, 0xea, 0xfe, 0xfa, 0x9e, 0x9e, 0x01, 0xb1, 0xfe, 0xfd, 0x00, 0x00, 0x02, 0x01,
-    0x30, 0x04, 0xa6, 0x03, 0xac, 0x06, 0xa7, 0x00, 0x15, 0x00, 0x19, 0x00, 0x08, 0xb5, 0x18, 0x16, 0x04, 0x00, 0x02,
-    0x30, 0x2b, 0x01, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02,
-    0x35, 0x27, 0x23, 0x27, 0x33, 0x03, 0xac, 0x2e, 0x53, 0x75, 0x48, 0x49, 0x75, 0x53, 0x2d, 0x95, 0x14, 0x29, 0x40,
-    0x2c, 0x2b, 0x3f, 0x29, 0x14, 0x53, 0x97, 0xd2, 0xd8, 0x05, 0xb0, 0x3b, 0x62, 0x46, 0x27, 0x27, 0x46, 0x62, 0x3b,
-    0x1e, 0x36, 0x29, 0x17, 0x17, 0x29, 0x36, 0x1e, 0x29, 0xce, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0xf9, 0x04, 0x8e,
-    0x02, 0xf0, 0x06, 0x3b, 0x00, 0x0b, 0x00, 0x06, 0xb3, 0x0a, 0x05, 0x01, 0x30, 0x2b, 0x01, 0x34, 0x3e, 0x02, 0x37,
-    0x17, 0x06, 0x06, 0x15, 0x15, 0x23, 0x01, 0xf9, 0x1a, 0x29, 0x31, 0x18, 0x6b, 0x23, 0x1b, 0xb9, 0x05, 0x0f, 0x2c,
-    0x59, 0x50, 0x42, 0x15, 0x53, 0x3b, 0x6a, 0x3d, 0x78, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x36, 0x00, 0x00, 0x04,
-    0x8e, 0x04, 0x8d, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x25, 0x40, 0x22, 0x0a, 0x01, 0x04, 0x02, 0x01, 0x4a, 0x00, 0x02,
-    0x04, 0x02, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x62, 0x03, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x05, 0x08, 0x19, 0x2b, 0x01, 0x21, 0x03, 0x23, 0x01, 0x33, 0x01, 0x23, 0x01, 0x21, 0x03,
-    0x03, 0x66, 0xfd, 0xfa, 0x6e, 0xbc, 0x01, 0xdd, 0xa5, 0x01, 0xd6, 0xbb, 0xfd, 0xc9, 0x01, 0x8f, 0xc7, 0x01, 0x17,
-    0xfe, 0xe9, 0x04, 0x8d, 0xfb, 0x73, 0x01, 0xae, 0x01, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xd0, 0x00, 0x00,
-    0x04, 0x46, 0x04, 0x8d, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x34, 0x00, 0x3c, 0x40, 0x39, 0x0e, 0x01, 0x03, 0x04, 0x01,
-    0x4a, 0x00, 0x00, 0x00, 0x05, 0x04, 0x00, 0x05, 0x63, 0x00, 0x04, 0x07, 0x01, 0x03, 0x02, 0x04, 0x03, 0x63, 0x00,
-    0x02, 0x02, 0x01, 0x5b, 0x06, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x1b, 0x1b, 0x00, 0x00, 0x34, 0x32, 0x2a, 0x28,
-    0x1b, 0x27, 0x1b, 0x26, 0x1e, 0x1c, 0x00, 0x1a, 0x00, 0x19, 0x21, 0x08, 0x08, 0x15, 0x2b, 0x33, 0x11, 0x21, 0x32,
-    0x1e, 0x04, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x04, 0x23, 0x01, 0x11, 0x21, 0x3e, 0x03,
-    0x35, 0x34, 0x2e, 0x02, 0x27, 0x25, 0x33, 0x3e, 0x03, 0x35, 0x34, 0x2e, 0x02, 0x27, 0x23, 0xd0, 0x01, 0x9d, 0x33,
-    0x69, 0x62, 0x56, 0x3f, 0x24, 0x20, 0x35, 0x47, 0x28, 0x31, 0x54, 0x3d, 0x24, 0x22, 0x3c, 0x53, 0x60, 0x69, 0x35,
-    0xfe, 0xf4, 0x01, 0x0c, 0x2c, 0x58, 0x46, 0x2b, 0x26, 0x41, 0x56, 0x2f, 0xfe, 0xeb, 0xf9, 0x28, 0x52, 0x42, 0x2b,
-    0x2e, 0x4a, 0x5a, 0x2b, 0xe3, 0x04, 0x8d, 0x0e, 0x1e, 0x30, 0x47, 0x5e, 0x3d, 0x30, 0x4d, 0x3b, 0x2b, 0x0e, 0x0c,
-    0x2e, 0x45, 0x5b, 0x37, 0x3d, 0x60, 0x4a, 0x34, 0x22, 0x10, 0x02, 0x12, 0xfe, 0x85, 0x01, 0x13, 0x2b, 0x45, 0x33,
-    0x34, 0x49, 0x2f, 0x17, 0x01, 0x8d, 0x01, 0x11, 0x27, 0x40, 0x2f, 0x34, 0x43, 0x26, 0x0f, 0x01, 0x00, 0x01, 0x00,
-    0x6e, 0xff, 0xf0, 0x04, 0x36, 0x04, 0x9d, 0x00, 0x27, 0x00, 0x34, 0x40, 0x31, 0x00, 0x02, 0x03, 0x05, 0x03, 0x02,
-    0x05, 0x70, 0x06, 0x01, 0x05, 0x04, 0x03, 0x05, 0x04, 0x6e, 0x00, 0x01, 0x00, 0x03, 0x02, 0x01, 0x03, 0x63, 0x00,
-    0x04, 0x04, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x27, 0x00, 0x27, 0x29, 0x22, 0x14,
-    0x29, 0x24, 0x07, 0x08, 0x19, 0x2b, 0x01, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x35, 0x3e, 0x03, 0x33, 0x32,
-    0x1e, 0x02, 0x17, 0x23, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x15, 0x1e, 0x03, 0x33, 0x16, 0x36, 0x37, 0x04,
-    0x36, 0x0c, 0x52, 0x7e, 0xa3, 0x5e, 0x75, 0xb6, 0x7d, 0x42, 0x01, 0x01, 0x44, 0x81, 0xb9, 0x77, 0x5e, 0xa1, 0x79,
-    0x4e, 0x0c, 0xb9, 0x15, 0x87, 0x7d, 0x55, 0x78, 0x4c, 0x23, 0x01, 0x01, 0x20, 0x48, 0x75, 0x54, 0x80, 0x8d, 0x17,
-    0x01, 0x79, 0x60, 0x92, 0x64, 0x33, 0x58, 0x96, 0xc6, 0x6f, 0x65, 0x71, 0xc7, 0x96, 0x57, 0x36, 0x66, 0x94, 0x5e,
-    0x76, 0x80, 0x43, 0x6f, 0x8f, 0x4b, 0x66, 0x49, 0x8e, 0x70, 0x45, 0x01, 0x79, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0xb7, 0x00, 0x00, 0x04, 0x53, 0x04, 0x8d, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x2a, 0x40, 0x27, 0x00, 0x00, 0x05,
-    0x01, 0x03, 0x02, 0x00, 0x03, 0x63, 0x00, 0x02, 0x02, 0x01, 0x5b, 0x04, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x0e,
-    0x0e, 0x00, 0x00, 0x0e, 0x1b, 0x0e, 0x1a, 0x11, 0x0f, 0x00, 0x0d, 0x00, 0x0c, 0x21, 0x06, 0x08, 0x15, 0x2b, 0x33,
-    0x11, 0x21, 0x1e, 0x03, 0x17, 0x15, 0x0e, 0x03, 0x07, 0x03, 0x11, 0x33, 0x3e, 0x03, 0x37, 0x35, 0x2e, 0x03, 0x27,
-    0xb7, 0x01, 0x6b, 0x79, 0xcd, 0x95, 0x55, 0x01, 0x01, 0x58, 0x99, 0xd0, 0x7b, 0xa5, 0xa5, 0x5c, 0x8f, 0x63, 0x35,
-    0x01, 0x01, 0x31, 0x5f, 0x8c, 0x5b, 0x04, 0x8d, 0x02, 0x50, 0x91, 0xca, 0x7b, 0x3f, 0x7e, 0xca, 0x8f, 0x4e, 0x01,
-    0x03, 0xf4, 0xfc, 0xa3, 0x01, 0x39, 0x68, 0x93, 0x5a, 0x41, 0x58, 0x91, 0x69, 0x3a, 0x01, 0x00, 0x00, 0x01, 0x00,
-    0xc8, 0x00, 0x00, 0x04, 0x23, 0x04, 0x8d, 0x00, 0x0b, 0x00, 0x27, 0x40, 0x24, 0x00, 0x03, 0x00, 0x04, 0x05, 0x03,
-    0x04, 0x61, 0x00, 0x05, 0x00, 0x00, 0x01, 0x05, 0x00, 0x61, 0x00, 0x01, 0x01, 0x02, 0x59, 0x00, 0x02, 0x02, 0x3d,
-    0x02, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x01, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11,
-    0x21, 0x15, 0x21, 0x11, 0x21, 0x03, 0xc5, 0xfd, 0xc0, 0x02, 0x9e, 0xfc, 0xa5, 0x03, 0x55, 0xfd, 0x68, 0x02, 0x40,
-    0x02, 0x0e, 0xfe, 0x89, 0x97, 0x04, 0x8d, 0x99, 0xfe, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xe7, 0x00, 0x00,
-    0x04, 0x3d, 0x04, 0x8d, 0x00, 0x09, 0x00, 0x21, 0x40, 0x1e, 0x00, 0x02, 0x00, 0x03, 0x04, 0x02, 0x03, 0x61, 0x00,
-    0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x61, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x10, 0x05,
-    0x08, 0x19, 0x2b, 0x01, 0x21, 0x11, 0x23, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x03, 0xe4, 0xfd, 0xc3, 0xc0, 0x03,
-    0x56, 0xfd, 0x6a, 0x02, 0x3d, 0x01, 0xf3, 0xfe, 0x0d, 0x04, 0x8d, 0x99, 0xfe, 0x98, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x7c, 0xff, 0xf0, 0x04, 0x41, 0x04, 0x9d, 0x00, 0x2d, 0x00, 0x37, 0x40, 0x34, 0x29, 0x00, 0x02, 0x04, 0x05,
-    0x01, 0x4a, 0x00, 0x02, 0x03, 0x06, 0x03, 0x02, 0x06, 0x70, 0x00, 0x01, 0x00, 0x03, 0x02, 0x01, 0x03, 0x63, 0x00,
-    0x06, 0x00, 0x05, 0x04, 0x06, 0x05, 0x61, 0x00, 0x04, 0x04, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x11,
-    0x15, 0x29, 0x22, 0x14, 0x29, 0x24, 0x07, 0x08, 0x1b, 0x2b, 0x25, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x35,
-    0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x23, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x15, 0x1e, 0x03, 0x33,
-    0x32, 0x3e, 0x02, 0x37, 0x37, 0x21, 0x35, 0x21, 0x04, 0x41, 0x29, 0x67, 0x74, 0x7c, 0x3c, 0x79, 0xc0, 0x86, 0x49,
-    0x01, 0x01, 0x42, 0x7e, 0xbb, 0x7a, 0x59, 0x9d, 0x7a, 0x51, 0x0e, 0xb7, 0x19, 0x8d, 0x70, 0x57, 0x79, 0x4b, 0x21,
-    0x01, 0x01, 0x28, 0x53, 0x7e, 0x57, 0x21, 0x46, 0x43, 0x3e, 0x19, 0x01, 0xfe, 0xeb, 0x01, 0xcc, 0x96, 0x31, 0x40,
-    0x26, 0x0f, 0x57, 0x97, 0xca, 0x74, 0x54, 0x74, 0xcb, 0x97, 0x57, 0x2f, 0x5c, 0x8b, 0x5b, 0x6b, 0x6e, 0x44, 0x72,
-    0x91, 0x4c, 0x56, 0x4e, 0x92, 0x70, 0x45, 0x05, 0x10, 0x1d, 0x18, 0xee, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x9b,
-    0x00, 0x00, 0x03, 0xf9, 0x04, 0x8d, 0x00, 0x0b, 0x00, 0x21, 0x40, 0x1e, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01,
-    0x61, 0x05, 0x01, 0x03, 0x03, 0x00, 0x59, 0x02, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x10, 0x06, 0x08, 0x1a, 0x2b, 0x21, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x03, 0xf9,
-    0xb2, 0xfe, 0x06, 0xb2, 0xb2, 0x01, 0xfa, 0xb2, 0x01, 0xf2, 0xfe, 0x0e, 0x04, 0x8d, 0xfd, 0xfd, 0x02, 0x03, 0x00,
-    0x00, 0x01, 0x00, 0xd9, 0x00, 0x00, 0x04, 0x10, 0x04, 0x8c, 0x00, 0x0b, 0x00, 0x21, 0x40, 0x1e, 0x00, 0x00, 0x05,
-    0x01, 0x01, 0x02, 0x00, 0x01, 0x61, 0x04, 0x01, 0x02, 0x02, 0x03, 0x59, 0x00, 0x03, 0x03, 0x3d, 0x03, 0x4c, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x13, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x35, 0x21,
-    0x11, 0x21, 0xd9, 0x03, 0x37, 0xfe, 0xbd, 0x01, 0x43, 0xfc, 0xc9, 0x01, 0x3b, 0xfe, 0xc5, 0x04, 0x8c, 0xa1, 0xfc,
-    0xb5, 0xa0, 0xa0, 0x03, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x96, 0xff, 0xf0, 0x03, 0xe6, 0x04, 0x8d, 0x00,
-    0x17, 0x00, 0x1f, 0x40, 0x1c, 0x00, 0x00, 0x02, 0x00, 0x72, 0x00, 0x02, 0x03, 0x02, 0x72, 0x00, 0x03, 0x03, 0x01,
-    0x5b, 0x00, 0x01, 0x01, 0x45, 0x01, 0x4c, 0x24, 0x14, 0x25, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x33, 0x03, 0x0e,
-    0x03, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x33, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x03, 0x28, 0xbe, 0x02,
-    0x02, 0x44, 0x71, 0x94, 0x50, 0x57, 0x98, 0x73, 0x49, 0x08, 0xbe, 0x28, 0x44, 0x58, 0x31, 0x2f, 0x50, 0x3c, 0x23,
-    0x02, 0x04, 0x8d, 0xfc, 0xea, 0x5f, 0x92, 0x63, 0x33, 0x2c, 0x5d, 0x91, 0x65, 0x3e, 0x59, 0x38, 0x19, 0x21, 0x3d,
-    0x59, 0x39, 0x00, 0x01, 0x00, 0xb4, 0x00, 0x00, 0x04, 0x80, 0x04, 0x8d, 0x00, 0x0c, 0x00, 0x1f, 0x40, 0x1c, 0x0a,
-    0x06, 0x01, 0x03, 0x00, 0x01, 0x01, 0x4a, 0x02, 0x01, 0x01, 0x01, 0x00, 0x59, 0x03, 0x01, 0x00, 0x00, 0x3d, 0x00,
-    0x4c, 0x12, 0x13, 0x11, 0x12, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x07, 0x11, 0x23, 0x11, 0x33, 0x11, 0x37, 0x01, 0x33,
-    0x01, 0x01, 0x23, 0x02, 0x00, 0x93, 0xb9, 0xb9, 0x82, 0x01, 0x8c, 0xe3, 0xfe, 0x22, 0x02, 0x00, 0xe1, 0x02, 0x07,
-    0x8e, 0xfe, 0x87, 0x04, 0x8d, 0xfd, 0xd6, 0x8f, 0x01, 0x9b, 0xfd, 0xf9, 0xfd, 0x7a, 0x00, 0x01, 0x00, 0xd1, 0x00,
-    0x00, 0x04, 0x52, 0x04, 0x8d, 0x00, 0x05, 0x00, 0x19, 0x40, 0x16, 0x00, 0x02, 0x00, 0x02, 0x72, 0x00, 0x00, 0x00,
-    0x01, 0x5a, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x11, 0x11, 0x10, 0x03, 0x08, 0x17, 0x2b, 0x25, 0x21, 0x15, 0x21,
-    0x11, 0x33, 0x01, 0x95, 0x02, 0xbd, 0xfc, 0x7f, 0xc4, 0x97, 0x97, 0x04, 0x8d, 0x00, 0x01, 0x00, 0x9b, 0x00, 0x00,
-    0x04, 0x3a, 0x04, 0x8d, 0x00, 0x0c, 0x00, 0x27, 0x40, 0x24, 0x08, 0x05, 0x02, 0x02, 0x00, 0x01, 0x4a, 0x00, 0x02,
-    0x00, 0x01, 0x00, 0x02, 0x01, 0x70, 0x04, 0x01, 0x00, 0x00, 0x01, 0x59, 0x03, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c,
-    0x11, 0x12, 0x12, 0x11, 0x11, 0x05, 0x08, 0x19, 0x2b, 0x01, 0x13, 0x33, 0x11, 0x23, 0x11, 0x03, 0x23, 0x03, 0x11,
-    0x23, 0x11, 0x33, 0x02, 0x6d, 0xdc, 0xf1, 0xb0, 0xda, 0x83, 0xe2, 0xb0, 0xf8, 0x02, 0x58, 0x02, 0x35, 0xfb, 0x73,
-    0x03, 0xbf, 0xfd, 0x7f, 0x02, 0x73, 0xfc, 0x4f, 0x04, 0x8d, 0x00, 0x01, 0x00, 0xc2, 0x00, 0x00, 0x04, 0x0f, 0x04,
-    0x8d, 0x00, 0x09, 0x00, 0x1e, 0x40, 0x1b, 0x07, 0x02, 0x02, 0x00, 0x02, 0x01, 0x4a, 0x03, 0x01, 0x02, 0x02, 0x00,
-    0x59, 0x01, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x12, 0x11, 0x12, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x21, 0x23, 0x01,
-    0x13, 0x23, 0x11, 0x33, 0x01, 0x03, 0x33, 0x04, 0x0f, 0xac, 0xfe, 0x0b, 0x05, 0xb1, 0xae, 0x01, 0xf5, 0x06, 0xb0,
-    0x03, 0x6c, 0xfc, 0x94, 0x04, 0x8d, 0xfc, 0x93, 0x03, 0x6d, 0x00, 0x02, 0x00, 0x82, 0xff, 0xf0, 0x04, 0x4a, 0x04,
-    0x9d, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x1d, 0x40, 0x1a, 0x00, 0x01, 0x00, 0x02, 0x03, 0x01, 0x02, 0x63, 0x00, 0x03,
-    0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x29, 0x29, 0x29, 0x24, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x0e,
-    0x03, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x35, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x27, 0x2e, 0x03, 0x23, 0x22,
-    0x0e, 0x02, 0x07, 0x15, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x04, 0x4a, 0x01, 0x3d, 0x79, 0xb4, 0x78, 0x77,
-    0xb4, 0x7a, 0x3f, 0x01, 0x01, 0x3e, 0x7a, 0xb4, 0x77, 0x78, 0xb5, 0x79, 0x3d, 0x01, 0xb7, 0x01, 0x1f, 0x46, 0x73,
-    0x54, 0x54, 0x72, 0x47, 0x1f, 0x01, 0x01, 0x20, 0x47, 0x72, 0x54, 0x55, 0x73, 0x45, 0x1e, 0x01, 0x02, 0x24, 0x6e,
-    0xcc, 0x9c, 0x5e, 0x5e, 0x9d, 0xcc, 0x6d, 0x43, 0x6d, 0xcc, 0x9e, 0x5f, 0x5e, 0x9d, 0xcd, 0x6e, 0x02, 0x47, 0x92,
-    0x75, 0x4a, 0x4b, 0x76, 0x91, 0x46, 0x45, 0x47, 0x91, 0x77, 0x4b, 0x4b, 0x76, 0x92, 0x47, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x5e, 0xff, 0x36, 0x04, 0x67, 0x04, 0x9d, 0x00, 0x1a, 0x00, 0x30, 0x00, 0x28, 0x40, 0x25, 0x05, 0x01,
-    0x00, 0x03, 0x01, 0x4a, 0x07, 0x06, 0x02, 0x00, 0x47, 0x00, 0x01, 0x00, 0x02, 0x03, 0x01, 0x02, 0x63, 0x00, 0x03,
-    0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x29, 0x29, 0x29, 0x29, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x0e,
-    0x03, 0x07, 0x17, 0x07, 0x25, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x35, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x17,
-    0x27, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x15, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x04, 0x65, 0x01,
-    0x1d, 0x38, 0x52, 0x35, 0xdf, 0x7d, 0xfe, 0xf6, 0x3d, 0x40, 0x7a, 0xbf, 0x84, 0x47, 0x01, 0x01, 0x46, 0x84, 0xbe,
-    0x7a, 0x7a, 0xbf, 0x84, 0x46, 0x01, 0xb8, 0x01, 0x26, 0x50, 0x7d, 0x58, 0x57, 0x7c, 0x50, 0x27, 0x01, 0x01, 0x27,
-    0x51, 0x7d, 0x57, 0x58, 0x7c, 0x50, 0x25, 0x01, 0x02, 0x24, 0x4a, 0x8b, 0x7b, 0x66, 0x26, 0xa3, 0x6f, 0xc8, 0x0e,
-    0x5a, 0x9a, 0xcd, 0x73, 0x43, 0x73, 0xcd, 0x9b, 0x5b, 0x5a, 0x9a, 0xce, 0x74, 0x02, 0x4e, 0x93, 0x72, 0x45, 0x46,
-    0x73, 0x93, 0x4c, 0x45, 0x4d, 0x93, 0x74, 0x46, 0x46, 0x72, 0x94, 0x4e, 0x00, 0x02, 0x00, 0x90, 0x00, 0x00, 0x04,
-    0x2c, 0x04, 0x8d, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x29, 0x40, 0x26, 0x0f, 0x01, 0x00, 0x04, 0x01, 0x4a, 0x00, 0x02,
-    0x00, 0x05, 0x04, 0x02, 0x05, 0x63, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x61, 0x03, 0x01, 0x01, 0x01, 0x3d,
-    0x01, 0x4c, 0x28, 0x21, 0x2a, 0x21, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x01, 0x21, 0x11, 0x23, 0x11, 0x21, 0x1e,
-    0x03, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x01, 0x15, 0x23, 0x01, 0x33, 0x3e, 0x03, 0x35, 0x34, 0x2e, 0x02, 0x27, 0x23,
-    0x02, 0x61, 0xfe, 0xe8, 0xb9, 0x01, 0xaa, 0x54, 0xa1, 0x7d, 0x4b, 0x24, 0x40, 0x57, 0x32, 0x01, 0x22, 0xc7, 0xfd,
-    0xe4, 0xf6, 0x2f, 0x5b, 0x47, 0x2d, 0x2b, 0x48, 0x5e, 0x32, 0xf1, 0x01, 0xc1, 0xfe, 0x3f, 0x04, 0x8d, 0x01, 0x28,
-    0x56, 0x86, 0x5f, 0x3f, 0x60, 0x4b, 0x39, 0x16, 0xfe, 0x1a, 0x0a, 0x02, 0x58, 0x01, 0x18, 0x31, 0x4b, 0x35, 0x38,
-    0x4f, 0x32, 0x18, 0x01, 0x00, 0x01, 0x00, 0x8a, 0xff, 0xf0, 0x04, 0x39, 0x04, 0x9d, 0x00, 0x45, 0x00, 0x34, 0x40,
-    0x31, 0x00, 0x01, 0x02, 0x04, 0x02, 0x01, 0x04, 0x70, 0x00, 0x04, 0x05, 0x02, 0x04, 0x05, 0x6e, 0x00, 0x00, 0x00,
-    0x02, 0x01, 0x00, 0x02, 0x63, 0x00, 0x05, 0x05, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x45, 0x03, 0x4c, 0x42, 0x40, 0x3c,
-    0x3b, 0x37, 0x35, 0x1f, 0x1d, 0x19, 0x18, 0x14, 0x12, 0x06, 0x08, 0x14, 0x2b, 0x01, 0x36, 0x2e, 0x04, 0x27, 0x2e,
-    0x03, 0x35, 0x34, 0x3e, 0x04, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x23, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14,
-    0x1e, 0x04, 0x17, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x04, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x33, 0x1e, 0x03, 0x33, 0x32,
-    0x3e, 0x02, 0x03, 0x7f, 0x01, 0x1a, 0x2d, 0x3a, 0x3f, 0x3f, 0x1b, 0x45, 0x99, 0x81, 0x53, 0x27, 0x42, 0x58, 0x63,
-    0x67, 0x30, 0x54, 0x9f, 0x7e, 0x51, 0x06, 0xbb, 0x02, 0x2f, 0x4c, 0x60, 0x32, 0x28, 0x5a, 0x4c, 0x32, 0x1f, 0x34,
-    0x41, 0x43, 0x40, 0x19, 0x46, 0x92, 0x78, 0x4c, 0x28, 0x44, 0x5a, 0x64, 0x69, 0x31, 0x56, 0xab, 0x8a, 0x5a, 0x06,
-    0xbc, 0x02, 0x37, 0x56, 0x6a, 0x36, 0x28, 0x5d, 0x4f, 0x35, 0x01, 0x2a, 0x24, 0x36, 0x2a, 0x1d, 0x16, 0x10, 0x07,
-    0x11, 0x33, 0x52, 0x78, 0x56, 0x39, 0x5d, 0x47, 0x33, 0x21, 0x10, 0x2b, 0x59, 0x86, 0x5a, 0x37, 0x4e, 0x32, 0x16,
-    0x10, 0x27, 0x41, 0x31, 0x22, 0x34, 0x28, 0x1d, 0x15, 0x0f, 0x06, 0x12, 0x37, 0x55, 0x79, 0x55, 0x3b, 0x5d, 0x46,
-    0x31, 0x1f, 0x0e, 0x2a, 0x59, 0x8a, 0x60, 0x3d, 0x53, 0x33, 0x15, 0x0e, 0x25, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x5d, 0x00, 0x00, 0x04, 0x69, 0x04, 0x8d, 0x00, 0x07, 0x00, 0x19, 0x40, 0x16, 0x00, 0x03, 0x02, 0x01, 0x00, 0x01,
-    0x03, 0x00, 0x61, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x10, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x21,
-    0x11, 0x23, 0x11, 0x21, 0x35, 0x21, 0x04, 0x69, 0xfe, 0x57, 0xbc, 0xfe, 0x59, 0x04, 0x0c, 0x03, 0xf4, 0xfc, 0x0c,
-    0x03, 0xf4, 0x99, 0x00, 0x00, 0x01, 0x00, 0xb5, 0xff, 0xf0, 0x04, 0x2b, 0x04, 0x8d, 0x00, 0x19, 0x00, 0x21, 0x40,
-    0x1e, 0x04, 0x03, 0x02, 0x01, 0x02, 0x01, 0x72, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c,
-    0x00, 0x00, 0x00, 0x19, 0x00, 0x19, 0x25, 0x15, 0x25, 0x05, 0x08, 0x17, 0x2b, 0x01, 0x13, 0x0e, 0x03, 0x23, 0x22,
-    0x2e, 0x02, 0x27, 0x13, 0x33, 0x13, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x13, 0x04, 0x2a, 0x01, 0x02, 0x47,
-    0x78, 0xa0, 0x5b, 0x5c, 0xa0, 0x77, 0x46, 0x01, 0x01, 0xb5, 0x01, 0x01, 0x25, 0x43, 0x5f, 0x3b, 0x3b, 0x5f, 0x43,
-    0x25, 0x01, 0x01, 0x04, 0x8d, 0xfc, 0xf4, 0x5f, 0x94, 0x68, 0x36, 0x36, 0x66, 0x95, 0x60, 0x03, 0x0c, 0xfc, 0xf4,
-    0x3b, 0x5d, 0x40, 0x22, 0x22, 0x40, 0x5d, 0x3b, 0x03, 0x0c, 0x00, 0x01, 0x00, 0x56, 0x00, 0x00, 0x04, 0x83, 0x04,
-    0x8d, 0x00, 0x08, 0x00, 0x1b, 0x40, 0x18, 0x01, 0x01, 0x01, 0x00, 0x01, 0x4a, 0x02, 0x01, 0x00, 0x01, 0x00, 0x72,
-    0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x11, 0x11, 0x13, 0x03, 0x08, 0x17, 0x2b, 0x01, 0x17, 0x37, 0x01, 0x33, 0x01,
-    0x23, 0x01, 0x33, 0x02, 0x50, 0x1c, 0x1d, 0x01, 0x31, 0xc9, 0xfe, 0x40, 0xae, 0xfe, 0x41, 0xc8, 0x01, 0x36, 0x6b,
-    0x6a, 0x03, 0x58, 0xfb, 0x73, 0x04, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2f, 0x00, 0x00, 0x04, 0xbb, 0x04,
-    0x8d, 0x00, 0x0c, 0x00, 0x20, 0x40, 0x1d, 0x0a, 0x05, 0x02, 0x01, 0x00, 0x01, 0x4a, 0x04, 0x03, 0x02, 0x00, 0x01,
-    0x00, 0x72, 0x02, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x12, 0x11, 0x12, 0x11, 0x11, 0x05, 0x08, 0x19, 0x2b, 0x01,
-    0x13, 0x33, 0x03, 0x23, 0x03, 0x03, 0x23, 0x03, 0x33, 0x13, 0x13, 0x33, 0x03, 0x78, 0x97, 0xac, 0xe9, 0x9f, 0xbc,
-    0xc1, 0x9f, 0xe8, 0xab, 0x98, 0xb8, 0x9a, 0x01, 0x53, 0x03, 0x3a, 0xfb, 0x73, 0x03, 0x3e, 0xfc, 0xc2, 0x04, 0x8d,
-    0xfc, 0xc6, 0x03, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x60, 0x00, 0x00, 0x04, 0x66, 0x04, 0x8d, 0x00, 0x0b,
-    0x00, 0x1f, 0x40, 0x1c, 0x09, 0x06, 0x03, 0x03, 0x01, 0x00, 0x01, 0x4a, 0x03, 0x01, 0x00, 0x00, 0x01, 0x59, 0x02,
-    0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x12, 0x12, 0x12, 0x11, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x01, 0x33, 0x01, 0x01,
-    0x23, 0x01, 0x01, 0x23, 0x01, 0x01, 0x33, 0x02, 0x5f, 0x01, 0x1d, 0xdb, 0xfe, 0x78, 0x01, 0x97, 0xdc, 0xfe, 0xd8,
-    0xfe, 0xda, 0xdc, 0x01, 0x94, 0xfe, 0x75, 0xdb, 0x02, 0xda, 0x01, 0xb3, 0xfd, 0xbe, 0xfd, 0xb5, 0x01, 0xbb, 0xfe,
-    0x45, 0x02, 0x4b, 0x02, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x4d, 0x00, 0x00, 0x04, 0x81, 0x04, 0x8d, 0x00,
-    0x08, 0x00, 0x1c, 0x40, 0x19, 0x06, 0x03, 0x02, 0x01, 0x00, 0x01, 0x4a, 0x02, 0x01, 0x00, 0x01, 0x00, 0x72, 0x00,
-    0x01, 0x01, 0x3d, 0x01, 0x4c, 0x12, 0x12, 0x11, 0x03, 0x08, 0x17, 0x2b, 0x01, 0x01, 0x33, 0x01, 0x11, 0x23, 0x11,
-    0x01, 0x33, 0x02, 0x66, 0x01, 0x47, 0xd4, 0xfe, 0x40, 0xbb, 0xfe, 0x47, 0xd4, 0x02, 0x44, 0x02, 0x49, 0xfd, 0x08,
-    0xfe, 0x6b, 0x01, 0xa1, 0x02, 0xec, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb9, 0x00, 0x00, 0x04, 0x42, 0x04, 0x8d, 0x00,
-    0x09, 0x00, 0x27, 0x40, 0x24, 0x09, 0x01, 0x02, 0x03, 0x04, 0x01, 0x01, 0x00, 0x02, 0x4a, 0x00, 0x03, 0x00, 0x02,
-    0x00, 0x03, 0x02, 0x61, 0x00, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x11, 0x12, 0x11, 0x10,
-    0x04, 0x08, 0x18, 0x2b, 0x25, 0x21, 0x15, 0x21, 0x35, 0x01, 0x21, 0x35, 0x21, 0x17, 0x01, 0x9f, 0x02, 0xa3, 0xfc,
-    0x77, 0x02, 0x8b, 0xfd, 0x7e, 0x03, 0x67, 0x01, 0x97, 0x97, 0x7c, 0x03, 0x78, 0x99, 0x79, 0x00, 0x00, 0x02, 0x01,
-    0x52, 0x04, 0xe0, 0x03, 0x9a, 0x07, 0x03, 0x00, 0x11, 0x00, 0x25, 0x00, 0x08, 0xb5, 0x1c, 0x12, 0x04, 0x00, 0x02,
-    0x30, 0x2b, 0x01, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x27,
-    0x27, 0x36, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x37, 0x32, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x17, 0x03, 0x9a,
-    0x2a, 0x4b, 0x6c, 0x42, 0x42, 0x6c, 0x4d, 0x2a, 0x91, 0x01, 0x47, 0x4c, 0x4a, 0x46, 0x01, 0xd2, 0x06, 0x45, 0x47,
-    0x1b, 0x2c, 0x3a, 0x20, 0x07, 0x8c, 0x99, 0x1a, 0x2a, 0x36, 0x1b, 0x03, 0x05, 0xb0, 0x2f, 0x4c, 0x37, 0x1e, 0x1e,
-    0x37, 0x4c, 0x2f, 0x30, 0x43, 0x43, 0x30, 0x11, 0x7c, 0x04, 0x16, 0x1f, 0x11, 0x17, 0x0d, 0x06, 0x52, 0x4c, 0x44,
-    0x1d, 0x29, 0x1b, 0x10, 0x03, 0x3e, 0x00, 0x00, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x03, 0x52, 0x04, 0x90, 0x00, 0x06,
-    0x00, 0x06, 0xb3, 0x05, 0x00, 0x01, 0x30, 0x2b, 0x21, 0x23, 0x11, 0x05, 0x35, 0x25, 0x33, 0x03, 0x52, 0xba, 0xfe,
-    0x76, 0x02, 0x2a, 0x1a, 0x03, 0xaf, 0x75, 0x9e, 0xb8, 0x00, 0x01, 0x00, 0xb6, 0x00, 0x00, 0x04, 0x32, 0x04, 0x9d,
-    0x00, 0x24, 0x00, 0x06, 0xb3, 0x17, 0x00, 0x01, 0x30, 0x2b, 0x21, 0x21, 0x35, 0x01, 0x3e, 0x03, 0x27, 0x2e, 0x03,
-    0x23, 0x26, 0x0e, 0x02, 0x07, 0x23, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x01, 0x21,
-    0x04, 0x32, 0xfc, 0x9f, 0x01, 0xab, 0x1e, 0x46, 0x3a, 0x27, 0x01, 0x01, 0x22, 0x3a, 0x4c, 0x2a, 0x36, 0x5b, 0x42,
-    0x27, 0x03, 0xba, 0x03, 0x4a, 0x79, 0x9c, 0x55, 0x4c, 0x8f, 0x6f, 0x43, 0x31, 0x4a, 0x59, 0x2a, 0xfe, 0xb8, 0x02,
-    0x7e, 0x83, 0x01, 0x9d, 0x1d, 0x41, 0x4a, 0x53, 0x2f, 0x2c, 0x45, 0x30, 0x1a, 0x01, 0x1b, 0x38, 0x52, 0x37, 0x5a,
-    0x8b, 0x5e, 0x30, 0x2b, 0x54, 0x7d, 0x53, 0x3d, 0x73, 0x6a, 0x5f, 0x27, 0xfe, 0xe9, 0x00, 0x00, 0x01, 0x00, 0xc5,
-    0xff, 0xf0, 0x04, 0x16, 0x04, 0x9d, 0x00, 0x40, 0x00, 0x06, 0xb3, 0x29, 0x15, 0x01, 0x30, 0x2b, 0x01, 0x33, 0x3e,
-    0x03, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x23, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14,
-    0x0e, 0x02, 0x07, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x33, 0x1e, 0x03, 0x33, 0x32,
-    0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x27, 0x23, 0x01, 0xd7, 0x7a, 0x2b, 0x59, 0x46, 0x2d, 0x25, 0x3d, 0x4f, 0x2b,
-    0x29, 0x4e, 0x3e, 0x28, 0x04, 0xba, 0x04, 0x49, 0x73, 0x90, 0x4a, 0x4c, 0x93, 0x72, 0x45, 0x21, 0x38, 0x49, 0x2a,
-    0x2f, 0x52, 0x3d, 0x23, 0x4b, 0x79, 0x98, 0x4e, 0x4e, 0x95, 0x76, 0x4a, 0x04, 0xb9, 0x04, 0x2a, 0x42, 0x53, 0x2c,
-    0x2d, 0x55, 0x44, 0x29, 0x2f, 0x4d, 0x5f, 0x30, 0x7a, 0x02, 0x9b, 0x01, 0x13, 0x2b, 0x45, 0x33, 0x2e, 0x44, 0x2c,
-    0x15, 0x13, 0x29, 0x40, 0x2c, 0x51, 0x78, 0x4f, 0x28, 0x27, 0x51, 0x7d, 0x56, 0x32, 0x50, 0x3e, 0x2e, 0x0f, 0x0e,
-    0x2d, 0x42, 0x59, 0x3b, 0x57, 0x80, 0x54, 0x29, 0x27, 0x51, 0x7c, 0x55, 0x2f, 0x43, 0x2c, 0x14, 0x16, 0x2e, 0x47,
-    0x32, 0x38, 0x4b, 0x2c, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x89, 0x00, 0x00, 0x04, 0x3e, 0x04, 0x8d,
-    0x00, 0x0a, 0x00, 0x0e, 0x00, 0x08, 0xb5, 0x0d, 0x0b, 0x09, 0x04, 0x02, 0x30, 0x2b, 0x01, 0x33, 0x15, 0x23, 0x11,
-    0x23, 0x11, 0x21, 0x27, 0x01, 0x33, 0x01, 0x21, 0x11, 0x07, 0x03, 0x8e, 0xb0, 0xb0, 0xb0, 0xfd, 0xae, 0x03, 0x02,
-    0x43, 0xc2, 0xfd, 0xca, 0x01, 0x86, 0x26, 0x01, 0x9d, 0x97, 0xfe, 0xfa, 0x01, 0x06, 0x73, 0x03, 0x14, 0xfd, 0x10,
-    0x02, 0x17, 0x41, 0x00, 0x00, 0x00, 0x01, 0x00, 0xd1, 0xff, 0xf0, 0x04, 0x15, 0x04, 0x8d, 0x00, 0x28, 0x00, 0x06,
-    0xb3, 0x11, 0x01, 0x01, 0x30, 0x2b, 0x13, 0x13, 0x21, 0x15, 0x21, 0x03, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x15,
-    0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x33, 0x16, 0x16, 0x37, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02,
-    0x23, 0x26, 0x06, 0x07, 0xf5, 0x44, 0x02, 0xa8, 0xfd, 0xf5, 0x26, 0x33, 0x6b, 0x39, 0x56, 0x92, 0x6a, 0x3c, 0x40,
-    0x71, 0x99, 0x58, 0x4e, 0x8e, 0x70, 0x4c, 0x0a, 0xb2, 0x13, 0x82, 0x5b, 0x36, 0x57, 0x3c, 0x20, 0x29, 0x46, 0x5d,
-    0x34, 0x3e, 0x63, 0x32, 0x02, 0x43, 0x02, 0x4a, 0xa2, 0xfe, 0xdf, 0x17, 0x19, 0x38, 0x66, 0x90, 0x58, 0x5b, 0x90,
-    0x64, 0x35, 0x2a, 0x53, 0x7a, 0x51, 0x5b, 0x57, 0x01, 0x25, 0x41, 0x58, 0x35, 0x36, 0x56, 0x3c, 0x21, 0x01, 0x24,
-    0x22, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xe1, 0xff, 0xf0, 0x04, 0x2a, 0x04, 0x93, 0x00, 0x1f, 0x00, 0x34, 0x00,
-    0x08, 0xb5, 0x2a, 0x20, 0x13, 0x00, 0x02, 0x30, 0x2b, 0x01, 0x15, 0x23, 0x0e, 0x03, 0x07, 0x36, 0x36, 0x37, 0x32,
-    0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x35, 0x3e, 0x03, 0x37, 0x03, 0x22, 0x0e, 0x02,
-    0x07, 0x15, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x03, 0x6f, 0x0f, 0x5d, 0x9e, 0x77, 0x49,
-    0x09, 0x35, 0x95, 0x4e, 0x55, 0x8a, 0x62, 0x35, 0x3f, 0x6f, 0x97, 0x57, 0x62, 0x9e, 0x6f, 0x3d, 0x01, 0x01, 0x54,
-    0xa2, 0xec, 0x98, 0xcf, 0x27, 0x4a, 0x40, 0x33, 0x0f, 0x01, 0x1e, 0x3b, 0x5a, 0x3e, 0x34, 0x56, 0x3d, 0x21, 0x21,
-    0x3c, 0x55, 0x04, 0x93, 0x9c, 0x01, 0x2e, 0x5a, 0x88, 0x5a, 0x39, 0x3d, 0x01, 0x3b, 0x69, 0x8e, 0x53, 0x59, 0x93,
-    0x68, 0x3a, 0x47, 0x7b, 0xa5, 0x5f, 0x54, 0x95, 0xf0, 0xa8, 0x5b, 0x01, 0xfd, 0xd8, 0x14, 0x26, 0x36, 0x22, 0x23,
-    0x35, 0x6c, 0x57, 0x36, 0x25, 0x41, 0x58, 0x33, 0x33, 0x58, 0x41, 0x26, 0x00, 0x01, 0x00, 0xbc, 0x00, 0x00, 0x04,
-    0x3a, 0x04, 0x8d, 0x00, 0x06, 0x00, 0x06, 0xb3, 0x05, 0x01, 0x01, 0x30, 0x2b, 0x01, 0x01, 0x23, 0x01, 0x21, 0x35,
-    0x21, 0x04, 0x3a, 0xfd, 0xe8, 0xc3, 0x02, 0x17, 0xfd, 0x46, 0x03, 0x7e, 0x04, 0x24, 0xfb, 0xdc, 0x03, 0xf4, 0x99,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xd1, 0xff, 0xf0, 0x04, 0x1e, 0x04, 0x9d, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x4f,
-    0x00, 0x0a, 0xb7, 0x4a, 0x40, 0x36, 0x2c, 0x22, 0x0e, 0x03, 0x30, 0x2b, 0x01, 0x14, 0x0e, 0x02, 0x07, 0x1e, 0x03,
-    0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x1e, 0x02, 0x03, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e,
-    0x02, 0x03, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x04, 0x00,
-    0x1e, 0x33, 0x45, 0x27, 0x2d, 0x50, 0x3c, 0x22, 0x4b, 0x79, 0x97, 0x4c, 0x4c, 0x97, 0x78, 0x4b, 0x22, 0x3a, 0x4f,
-    0x2d, 0x27, 0x44, 0x32, 0x1d, 0x43, 0x6d, 0x8d, 0x49, 0x49, 0x8f, 0x6f, 0x44, 0x9c, 0x2a, 0x43, 0x56, 0x2c, 0x2c,
-    0x55, 0x42, 0x28, 0x29, 0x43, 0x55, 0x2c, 0x2c, 0x55, 0x43, 0x29, 0x1d, 0x24, 0x3b, 0x4c, 0x27, 0x29, 0x49, 0x39,
-    0x21, 0x22, 0x39, 0x4b, 0x28, 0x28, 0x4b, 0x3a, 0x23, 0x03, 0x5a, 0x30, 0x50, 0x41, 0x31, 0x11, 0x12, 0x34, 0x46,
-    0x59, 0x36, 0x56, 0x7d, 0x52, 0x27, 0x27, 0x51, 0x7e, 0x56, 0x36, 0x59, 0x46, 0x34, 0x12, 0x12, 0x31, 0x41, 0x4f,
-    0x30, 0x52, 0x79, 0x50, 0x28, 0x28, 0x50, 0x79, 0xfd, 0x9a, 0x30, 0x4a, 0x31, 0x19, 0x19, 0x31, 0x4a, 0x30, 0x31,
-    0x48, 0x2f, 0x17, 0x17, 0x2f, 0x48, 0x02, 0x3e, 0x2a, 0x43, 0x2d, 0x18, 0x18, 0x2d, 0x42, 0x2b, 0x2b, 0x42, 0x2d,
-    0x18, 0x18, 0x2d, 0x42, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xba, 0xff, 0xfa, 0x03, 0xff, 0x04, 0x9d, 0x00, 0x1f,
-    0x00, 0x34, 0x00, 0x08, 0xb5, 0x2a, 0x20, 0x1d, 0x11, 0x02, 0x30, 0x2b, 0x25, 0x3e, 0x03, 0x37, 0x06, 0x06, 0x23,
-    0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x15, 0x0e, 0x03, 0x07, 0x23, 0x35, 0x13,
-    0x32, 0x3e, 0x02, 0x37, 0x35, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x01, 0x88, 0x5b, 0x9c,
-    0x75, 0x48, 0x08, 0x33, 0x8f, 0x4e, 0x55, 0x8c, 0x63, 0x36, 0x3f, 0x70, 0x97, 0x59, 0x67, 0x9d, 0x6a, 0x37, 0x01,
-    0x01, 0x53, 0xa0, 0xeb, 0x98, 0x12, 0xdf, 0x27, 0x4a, 0x3f, 0x32, 0x0f, 0x01, 0x1d, 0x3a, 0x59, 0x3c, 0x35, 0x56,
-    0x3c, 0x21, 0x20, 0x3b, 0x54, 0x92, 0x01, 0x2a, 0x55, 0x82, 0x5a, 0x36, 0x3a, 0x3b, 0x69, 0x90, 0x53, 0x5a, 0x95,
-    0x6c, 0x3d, 0x4c, 0x81, 0xac, 0x61, 0x45, 0x96, 0xed, 0xa7, 0x59, 0x01, 0x98, 0x01, 0x7f, 0x15, 0x27, 0x36, 0x22,
-    0x3d, 0x34, 0x68, 0x53, 0x33, 0x29, 0x45, 0x5b, 0x32, 0x32, 0x5a, 0x44, 0x28, 0x00, 0x00, 0x00, 0x02, 0x01, 0x3f,
-    0xff, 0xf5, 0x03, 0x8d, 0x03, 0x20, 0x00, 0x15, 0x00, 0x23, 0x00, 0x08, 0xb5, 0x1f, 0x18, 0x0f, 0x04, 0x02, 0x30,
-    0x2b, 0x01, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15,
-    0x27, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x03, 0x8d, 0x2a, 0x4c, 0x6c,
-    0x43, 0x44, 0x6d, 0x4d, 0x2b, 0x2a, 0x4d, 0x6d, 0x43, 0x43, 0x6d, 0x4d, 0x2a, 0x9e, 0x46, 0x43, 0x43, 0x46, 0x47,
-    0x44, 0x42, 0x45, 0x01, 0x45, 0x55, 0x7e, 0x54, 0x29, 0x29, 0x54, 0x7e, 0x55, 0x8a, 0x54, 0x7f, 0x54, 0x2a, 0x2a,
-    0x54, 0x7f, 0x54, 0x0f, 0x61, 0x5f, 0x5f, 0x61, 0xa7, 0x63, 0x5f, 0x5f, 0x63, 0x00, 0x01, 0x01, 0x5b, 0x00, 0x00,
-    0x02, 0xcf, 0x03, 0x15, 0x00, 0x06, 0x00, 0x06, 0xb3, 0x05, 0x00, 0x01, 0x30, 0x2b, 0x21, 0x23, 0x11, 0x07, 0x35,
-    0x25, 0x33, 0x02, 0xcf, 0x9d, 0xd7, 0x01, 0x62, 0x12, 0x02, 0x59, 0x39, 0x80, 0x75, 0x00, 0x00, 0x02, 0x01, 0x42,
-    0x04, 0xdf, 0x03, 0xa0, 0x06, 0x8a, 0x00, 0x13, 0x00, 0x17, 0x00, 0x08, 0xb5, 0x16, 0x14, 0x04, 0x00, 0x02, 0x30,
-    0x2b, 0x01, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x27,
-    0x33, 0x07, 0x23, 0x03, 0xa0, 0x2c, 0x4f, 0x6f, 0x44, 0x45, 0x70, 0x4f, 0x2c, 0x98, 0x12, 0x25, 0x39, 0x28, 0x4d,
-    0x47, 0x01, 0x5f, 0x99, 0xa4, 0x66, 0x05, 0xb0, 0x2f, 0x4d, 0x37, 0x1e, 0x1e, 0x37, 0x4d, 0x2f, 0x18, 0x2b, 0x1f,
-    0x12, 0x44, 0x30, 0xda, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x38, 0xff, 0xf5, 0x03, 0x94, 0x03, 0x20, 0x00,
-    0x2f, 0x00, 0x06, 0xb3, 0x1e, 0x0f, 0x01, 0x30, 0x2b, 0x01, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
-    0x07, 0x23, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x07, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23,
-    0x22, 0x2e, 0x02, 0x35, 0x33, 0x16, 0x16, 0x33, 0x32, 0x36, 0x27, 0x34, 0x26, 0x23, 0x23, 0x02, 0x03, 0x54, 0x46,
-    0x4c, 0x42, 0x43, 0x39, 0x4a, 0x01, 0x9d, 0x2d, 0x4d, 0x68, 0x3c, 0x40, 0x6c, 0x4e, 0x2b, 0x47, 0x41, 0x96, 0x2f,
-    0x53, 0x70, 0x40, 0x39, 0x6b, 0x53, 0x33, 0x9e, 0x01, 0x4f, 0x41, 0x44, 0x4c, 0x01, 0x57, 0x48, 0x54, 0x01, 0xcb,
-    0x3a, 0x33, 0x2d, 0x3a, 0x30, 0x2c, 0x33, 0x52, 0x39, 0x1f, 0x1d, 0x39, 0x54, 0x37, 0x38, 0x5a, 0x19, 0x2a, 0x8e,
-    0x38, 0x56, 0x3a, 0x1f, 0x1b, 0x39, 0x58, 0x3d, 0x2e, 0x3b, 0x3c, 0x33, 0x3f, 0x34, 0x00, 0x00, 0x02, 0x01, 0x23,
-    0x00, 0x00, 0x03, 0xa8, 0x03, 0x15, 0x00, 0x0a, 0x00, 0x0e, 0x00, 0x2b, 0x40, 0x28, 0x0d, 0x01, 0x00, 0x04, 0x08,
-    0x01, 0x01, 0x00, 0x02, 0x4a, 0x05, 0x01, 0x00, 0x03, 0x01, 0x01, 0x02, 0x00, 0x01, 0x61, 0x00, 0x04, 0x04, 0x02,
-    0x59, 0x00, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x11, 0x12, 0x11, 0x11, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x01, 0x33,
-    0x15, 0x23, 0x15, 0x23, 0x35, 0x21, 0x27, 0x01, 0x33, 0x01, 0x33, 0x11, 0x07, 0x03, 0x3d, 0x6b, 0x6b, 0x9d, 0xfe,
-    0x89, 0x06, 0x01, 0x79, 0xa1, 0xfe, 0x84, 0xdf, 0x11, 0x01, 0x2b, 0x82, 0xa9, 0xa9, 0x66, 0x02, 0x06, 0xfe, 0x16,
-    0x01, 0x21, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x01, 0x40, 0xff, 0xf5, 0x03, 0x8c, 0x03, 0x15, 0x00, 0x28, 0x00, 0x06,
-    0xb3, 0x11, 0x01, 0x01, 0x30, 0x2b, 0x01, 0x13, 0x21, 0x15, 0x21, 0x07, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x15,
-    0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x33, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x23,
-    0x22, 0x0e, 0x02, 0x07, 0x01, 0x55, 0x32, 0x01, 0xde, 0xfe, 0xa3, 0x16, 0x14, 0x4a, 0x2d, 0x3f, 0x65, 0x46, 0x25,
-    0x24, 0x49, 0x6f, 0x4a, 0x38, 0x68, 0x51, 0x32, 0x03, 0x9b, 0x06, 0x4a, 0x3b, 0x24, 0x33, 0x22, 0x10, 0x50, 0x48,
-    0x1a, 0x28, 0x1f, 0x18, 0x0c, 0x01, 0x83, 0x01, 0x92, 0x84, 0xaa, 0x08, 0x15, 0x23, 0x43, 0x60, 0x3c, 0x36, 0x62,
-    0x4a, 0x2b, 0x1e, 0x3b, 0x54, 0x36, 0x33, 0x30, 0x15, 0x27, 0x34, 0x1f, 0x3f, 0x4c, 0x08, 0x0c, 0x0f, 0x08, 0x00,
-    0x00, 0x02, 0x01, 0x3b, 0xff, 0xf5, 0x03, 0x90, 0x03, 0x1e, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0x08, 0xb5, 0x23, 0x1d,
-    0x10, 0x00, 0x02, 0x30, 0x2b, 0x01, 0x15, 0x23, 0x20, 0x07, 0x36, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e,
-    0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x03, 0x22, 0x06, 0x07, 0x15, 0x16, 0x16, 0x37,
-    0x32, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x03, 0x0d, 0x0b, 0xfe, 0xf0, 0x19, 0x20, 0x5e, 0x3c, 0x3f, 0x5f, 0x3f, 0x20,
-    0x29, 0x4b, 0x6c, 0x43, 0x47, 0x71, 0x4f, 0x2b, 0x39, 0x70, 0xa6, 0x6e, 0x8f, 0x33, 0x4e, 0x11, 0x01, 0x52, 0x3f,
-    0x20, 0x33, 0x24, 0x14, 0x48, 0x03, 0x1e, 0x83, 0xdd, 0x21, 0x2c, 0x29, 0x47, 0x60, 0x38, 0x39, 0x63, 0x48, 0x2a,
-    0x2c, 0x51, 0x74, 0x48, 0x37, 0x67, 0xa4, 0x72, 0x3c, 0xfe, 0x6e, 0x2d, 0x20, 0x21, 0x54, 0x56, 0x01, 0x16, 0x25,
-    0x34, 0x1e, 0x3f, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x30, 0x00, 0x00, 0x03, 0x9b, 0x03, 0x15, 0x00, 0x06,
-    0x00, 0x06, 0xb3, 0x05, 0x01, 0x01, 0x30, 0x2b, 0x01, 0x01, 0x23, 0x01, 0x21, 0x35, 0x21, 0x03, 0x9b, 0xfe, 0xa2,
-    0xa6, 0x01, 0x5e, 0xfe, 0x3b, 0x02, 0x6b, 0x02, 0xbb, 0xfd, 0x45, 0x02, 0x93, 0x82, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x01, 0x3e, 0xff, 0xf5, 0x03, 0x8e, 0x03, 0x20, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x9d, 0xb6, 0x13, 0x03,
-    0x02, 0x02, 0x05, 0x01, 0x4a, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x1b, 0x00, 0x01, 0x00, 0x04, 0x05, 0x01, 0x04,
-    0x63, 0x00, 0x05, 0x00, 0x02, 0x03, 0x05, 0x02, 0x63, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x3d, 0x00,
-    0x4c, 0x1b, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40, 0x1b, 0x00, 0x01, 0x00, 0x04, 0x05, 0x01, 0x04, 0x63, 0x00, 0x05,
-    0x00, 0x02, 0x03, 0x05, 0x02, 0x63, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x1b, 0x4b,
-    0xb0, 0x0e, 0x50, 0x58, 0x40, 0x1b, 0x00, 0x01, 0x00, 0x04, 0x05, 0x01, 0x04, 0x63, 0x00, 0x05, 0x00, 0x02, 0x03,
-    0x05, 0x02, 0x63, 0x00, 0x03, 0x03, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x1b, 0x40, 0x1b, 0x00, 0x01,
-    0x00, 0x04, 0x05, 0x01, 0x04, 0x63, 0x00, 0x05, 0x00, 0x02, 0x03, 0x05, 0x02, 0x63, 0x00, 0x03, 0x03, 0x00, 0x5b,
-    0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x59, 0x59, 0x59, 0x40, 0x09, 0x24, 0x26, 0x24, 0x28, 0x2e, 0x2a, 0x06, 0x08,
-    0x1a, 0x2b, 0x01, 0x06, 0x06, 0x07, 0x16, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x36,
-    0x37, 0x26, 0x26, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x03, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x15,
-    0x14, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x03, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x03,
-    0x7b, 0x01, 0x40, 0x37, 0x3f, 0x4c, 0x2e, 0x4f, 0x6c, 0x3e, 0x3e, 0x6d, 0x50, 0x2e, 0x4b, 0x40, 0x37, 0x40, 0x29,
-    0x4a, 0x65, 0x3c, 0x3b, 0x66, 0x4a, 0x2a, 0x89, 0x16, 0x25, 0x33, 0x1e, 0x3d, 0x4e, 0x4e, 0x3e, 0x1e, 0x32, 0x26,
-    0x15, 0x15, 0x41, 0x36, 0x36, 0x41, 0x42, 0x36, 0x36, 0x40, 0x02, 0x43, 0x3b, 0x58, 0x1a, 0x1a, 0x61, 0x43, 0x39,
-    0x55, 0x39, 0x1c, 0x1c, 0x39, 0x55, 0x39, 0x43, 0x61, 0x1a, 0x1a, 0x58, 0x3b, 0x36, 0x52, 0x38, 0x1d, 0x1d, 0x38,
-    0x52, 0xfe, 0x6b, 0x1a, 0x29, 0x1c, 0x0f, 0x39, 0x35, 0x36, 0x39, 0x0f, 0x1c, 0x29, 0x01, 0x71, 0x2f, 0x36, 0x35,
-    0x30, 0x2f, 0x37, 0x37, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x40, 0xff, 0xf9, 0x03, 0x8c, 0x03, 0x20, 0x00, 0x1b,
-    0x00, 0x2c, 0x00, 0x08, 0xb5, 0x22, 0x1c, 0x19, 0x0f, 0x02, 0x30, 0x2b, 0x25, 0x32, 0x36, 0x37, 0x06, 0x06, 0x23,
-    0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x14, 0x06, 0x07, 0x23, 0x35, 0x13,
-    0x32, 0x36, 0x37, 0x35, 0x34, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x01, 0xd5, 0x87, 0x86, 0x0b,
-    0x1f, 0x56, 0x35, 0x3f, 0x61, 0x41, 0x22, 0x29, 0x4c, 0x6c, 0x44, 0x46, 0x6d, 0x4c, 0x28, 0xd6, 0xe0, 0x0e, 0x9f,
-    0x30, 0x47, 0x11, 0x4e, 0x3c, 0x20, 0x32, 0x23, 0x13, 0x12, 0x22, 0x34, 0x78, 0x61, 0x67, 0x1d, 0x24, 0x27, 0x45,
-    0x61, 0x3b, 0x39, 0x66, 0x4d, 0x2d, 0x2c, 0x54, 0x78, 0x4b, 0x33, 0xd1, 0xdf, 0x01, 0x7f, 0x01, 0x00, 0x2a, 0x1d,
-    0x3c, 0x51, 0x52, 0x18, 0x29, 0x37, 0x1f, 0x1e, 0x35, 0x26, 0x16, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x35, 0x02,
-    0x8b, 0x03, 0xb2, 0x03, 0x22, 0x00, 0x03, 0x00, 0x06, 0xb3, 0x02, 0x00, 0x01, 0x30, 0x2b, 0x01, 0x21, 0x35, 0x21,
-    0x03, 0xb2, 0xfd, 0x83, 0x02, 0x7d, 0x02, 0x8b, 0x97, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0xd1, 0x04, 0x40, 0x03,
-    0xa8, 0x06, 0x72, 0x00, 0x03, 0x00, 0x17, 0x00, 0x23, 0x00, 0x0a, 0xb7, 0x20, 0x1a, 0x12, 0x08, 0x02, 0x00, 0x03,
-    0x30, 0x2b, 0x01, 0x33, 0x07, 0x23, 0x07, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23,
-    0x22, 0x2e, 0x02, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x34, 0x26, 0x23, 0x22, 0x06, 0x02, 0xe2, 0xc6, 0xdc,
-    0x7c, 0x7f, 0x1c, 0x2f, 0x3e, 0x23, 0x22, 0x3e, 0x2d, 0x1b, 0x1b, 0x2d, 0x3e, 0x22, 0x23, 0x3e, 0x2f, 0x1c, 0x55,
-    0x01, 0x32, 0x24, 0x23, 0x30, 0x01, 0x31, 0x23, 0x24, 0x32, 0x06, 0x72, 0xb8, 0xd7, 0x24, 0x3e, 0x2c, 0x19, 0x19,
-    0x2c, 0x3e, 0x24, 0x24, 0x3c, 0x2b, 0x18, 0x18, 0x2b, 0x3c, 0x24, 0x23, 0x32, 0x32, 0x23, 0x26, 0x32, 0x32, 0x00,
-    0x02, 0x01, 0xf5, 0x04, 0x82, 0x03, 0xb7, 0x05, 0xc4, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x08, 0xb5, 0x0d, 0x09, 0x04,
-    0x01, 0x02, 0x30, 0x2b, 0x01, 0x13, 0x33, 0x15, 0x03, 0x23, 0x27, 0x36, 0x36, 0x37, 0x17, 0x06, 0x07, 0x15, 0x23,
-    0x02, 0xaf, 0x60, 0xa8, 0xb8, 0x50, 0xba, 0x09, 0x33, 0x2d, 0x48, 0x33, 0x03, 0x7b, 0x04, 0x9e, 0x01, 0x26, 0x15,
-    0xfe, 0xd5, 0x8a, 0x3b, 0x5d, 0x1e, 0x03, 0x53, 0x66, 0x86, 0x00, 0x02, 0x01, 0x74, 0x04, 0xd9, 0x03, 0xc2, 0x06,
-    0xd0, 0x00, 0x13, 0x00, 0x2f, 0x00, 0x08, 0xb5, 0x2f, 0x21, 0x04, 0x00, 0x02, 0x30, 0x2b, 0x01, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x13, 0x14, 0x0e, 0x02, 0x23, 0x22,
-    0x2e, 0x02, 0x23, 0x22, 0x06, 0x07, 0x27, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x35, 0x03,
-    0xc2, 0x2a, 0x4d, 0x6d, 0x43, 0x43, 0x6d, 0x4d, 0x2a, 0x95, 0x01, 0x44, 0x4d, 0x26, 0x37, 0x24, 0x11, 0x8c, 0x18,
-    0x2c, 0x3d, 0x24, 0x28, 0x36, 0x2f, 0x2f, 0x21, 0x23, 0x2e, 0x01, 0x54, 0x19, 0x2b, 0x3d, 0x25, 0x21, 0x35, 0x33,
-    0x34, 0x20, 0x22, 0x30, 0x05, 0xae, 0x2f, 0x4f, 0x38, 0x1f, 0x1f, 0x38, 0x4f, 0x2f, 0x31, 0x45, 0x13, 0x20, 0x2b,
-    0x18, 0x01, 0x0a, 0x24, 0x41, 0x31, 0x1d, 0x17, 0x1d, 0x17, 0x33, 0x26, 0x15, 0x24, 0x42, 0x32, 0x1e, 0x17, 0x1d,
-    0x17, 0x33, 0x26, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x06, 0xfe, 0x99, 0x02, 0xbf, 0x00, 0x9a, 0x00, 0x03, 0x00,
-    0x18, 0x40, 0x15, 0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x01, 0x00, 0x4d,
-    0x11, 0x10, 0x02, 0x06, 0x16, 0x2b, 0x01, 0x23, 0x11, 0x33, 0x02, 0xbf, 0xb9, 0xb9, 0xfe, 0x99, 0x02, 0x01, 0x00,
-    0x00, 0x00, 0x01, 0x01, 0x69, 0xfe, 0x64, 0x03, 0x11, 0x00, 0x42, 0x00, 0x19, 0x00, 0x06, 0xb3, 0x09, 0x00, 0x01,
-    0x30, 0x2b, 0x25, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36,
-    0x35, 0x34, 0x2e, 0x02, 0x27, 0x02, 0x47, 0x34, 0x4d, 0x31, 0x18, 0x24, 0x3d, 0x53, 0x2f, 0x48, 0x5e, 0x1f, 0x20,
-    0x13, 0x3d, 0x26, 0x3e, 0x33, 0x16, 0x25, 0x2e, 0x18, 0x42, 0x1b, 0x41, 0x46, 0x49, 0x23, 0x33, 0x4d, 0x35, 0x1b,
-    0x1d, 0x0f, 0x7a, 0x08, 0x13, 0x30, 0x2a, 0x1b, 0x32, 0x2d, 0x2a, 0x13, 0x00, 0x00, 0x01, 0x01, 0x60, 0xfe, 0x4b,
-    0x03, 0x12, 0x00, 0x97, 0x00, 0x11, 0x00, 0x29, 0x40, 0x26, 0x08, 0x01, 0x01, 0x02, 0x07, 0x01, 0x00, 0x01, 0x02,
-    0x4a, 0x03, 0x01, 0x02, 0x01, 0x02, 0x72, 0x00, 0x01, 0x01, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x21, 0x00, 0x4c, 0x00,
-    0x00, 0x00, 0x11, 0x00, 0x11, 0x27, 0x23, 0x04, 0x06, 0x16, 0x2b, 0x25, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27,
-    0x37, 0x1e, 0x03, 0x33, 0x32, 0x36, 0x35, 0x35, 0x03, 0x12, 0xa8, 0x9a, 0x1e, 0x35, 0x1d, 0x0e, 0x08, 0x1b, 0x1e,
-    0x1a, 0x07, 0x42, 0x47, 0x97, 0xf0, 0xa7, 0xb5, 0x08, 0x0a, 0x9d, 0x03, 0x05, 0x03, 0x02, 0x60, 0x5a, 0xf0, 0x00,
-    0x03, 0x00, 0x6e, 0xfe, 0x4a, 0x04, 0x60, 0x04, 0x4e, 0x00, 0x3d, 0x00, 0x52, 0x00, 0x68, 0x00, 0x0a, 0xb7, 0x62,
-    0x57, 0x47, 0x40, 0x39, 0x1e, 0x03, 0x30, 0x2b, 0x01, 0x23, 0x16, 0x16, 0x15, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22,
-    0x27, 0x06, 0x06, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e,
-    0x02, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x26, 0x26, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x26, 0x26, 0x35, 0x35, 0x34, 0x3e,
-    0x02, 0x33, 0x32, 0x17, 0x21, 0x01, 0x22, 0x27, 0x06, 0x06, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35,
-    0x34, 0x2e, 0x02, 0x23, 0x01, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22,
-    0x0e, 0x02, 0x15, 0x04, 0x60, 0x96, 0x1d, 0x1e, 0x3f, 0x71, 0x9d, 0x5e, 0x52, 0x46, 0x14, 0x1f, 0x13, 0x23, 0x2e,
-    0x1b, 0xac, 0x60, 0x99, 0x6a, 0x39, 0x4b, 0x8c, 0xc7, 0x7b, 0x6e, 0xac, 0x76, 0x3f, 0x1d, 0x31, 0x41, 0x24, 0x1b,
-    0x1e, 0x14, 0x20, 0x2a, 0x15, 0x51, 0x5e, 0x40, 0x71, 0x9d, 0x5e, 0x50, 0x48, 0x01, 0x6e, 0xfd, 0x8c, 0x29, 0x25,
-    0x31, 0x44, 0x24, 0x46, 0x68, 0x44, 0x50, 0x82, 0x5b, 0x32, 0x18, 0x36, 0x56, 0x3e, 0xfe, 0xac, 0x24, 0x41, 0x59,
-    0x36, 0x35, 0x59, 0x40, 0x24, 0x24, 0x41, 0x59, 0x36, 0x35, 0x59, 0x40, 0x24, 0x03, 0xa7, 0x2a, 0x60, 0x36, 0x16,
-    0x4a, 0x82, 0x62, 0x38, 0x15, 0x11, 0x33, 0x26, 0x17, 0x1f, 0x14, 0x08, 0x23, 0x48, 0x6e, 0x4c, 0x3c, 0x7a, 0x61,
-    0x3e, 0x2c, 0x4b, 0x65, 0x39, 0x30, 0x50, 0x42, 0x33, 0x12, 0x16, 0x3b, 0x28, 0x26, 0x3e, 0x33, 0x27, 0x10, 0x31,
-    0x98, 0x5b, 0x16, 0x4e, 0x84, 0x60, 0x35, 0x14, 0xfb, 0xf2, 0x06, 0x16, 0x5a, 0x3e, 0x23, 0x3c, 0x2b, 0x19, 0x22,
-    0x36, 0x44, 0x22, 0x23, 0x35, 0x23, 0x12, 0x02, 0xa5, 0x28, 0x4a, 0x39, 0x23, 0x23, 0x39, 0x4a, 0x28, 0x16, 0x2b,
-    0x4b, 0x38, 0x21, 0x21, 0x38, 0x4b, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb2, 0xfe, 0xdf, 0x03, 0xdc, 0x03,
-    0x41, 0x00, 0x15, 0x00, 0x06, 0xb3, 0x0a, 0x00, 0x01, 0x30, 0x2b, 0x13, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e,
-    0x02, 0x23, 0x27, 0x32, 0x3e, 0x02, 0x35, 0x26, 0x26, 0x23, 0x23, 0xb2, 0xd6, 0x8e, 0xdd, 0x99, 0x50, 0x3d, 0x78,
-    0xb1, 0x73, 0x02, 0x51, 0x6f, 0x44, 0x1e, 0x02, 0xcb, 0xce, 0xd6, 0x03, 0x41, 0x50, 0x95, 0xd6, 0x86, 0x83, 0xcb,
-    0x8a, 0x49, 0x93, 0x39, 0x68, 0x93, 0x5a, 0xc7, 0xd8, 0x00, 0x00, 0x02, 0x00, 0xcb, 0x00, 0x00, 0x03, 0x01, 0x05,
-    0xc3, 0x00, 0x05, 0x00, 0x11, 0x00, 0x08, 0xb5, 0x0e, 0x08, 0x02, 0x00, 0x02, 0x30, 0x2b, 0x13, 0x21, 0x11, 0x23,
-    0x11, 0x21, 0x01, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0xcb, 0x02, 0x29, 0xb9, 0xfe,
-    0x90, 0x01, 0x58, 0x37, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x37, 0x04, 0x3a, 0xfb, 0xc6, 0x03, 0x99, 0x01, 0xbd,
-    0x2e, 0x3f, 0x3f, 0x2e, 0x2d, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0xa0, 0xff, 0xec, 0x03, 0xfb, 0x06,
-    0x18, 0x00, 0x15, 0x00, 0x06, 0xb3, 0x0e, 0x00, 0x01, 0x30, 0x2b, 0x01, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e,
-    0x02, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x02, 0x59, 0x15, 0x2f, 0x4d, 0x38, 0x1e, 0x37,
-    0x32, 0x2c, 0x12, 0x14, 0x46, 0x86, 0x46, 0x5d, 0x7f, 0x4c, 0x21, 0x06, 0x18, 0xfb, 0x62, 0x48, 0x5d, 0x36, 0x15,
-    0x0a, 0x0f, 0x11, 0x07, 0x91, 0x20, 0x1e, 0x2f, 0x63, 0x9b, 0x6c, 0x04, 0x93, 0x00, 0xff, 0xff, 0x00, 0xd0, 0x00,
-    0x00, 0x03, 0x06, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x13, 0x00, 0x00, 0xff, 0xff, 0x00, 0x54, 0x00, 0x00, 0x04, 0x2c,
-    0x05, 0xb0, 0x02, 0x06, 0x00, 0x19, 0xe4, 0x00, 0x00, 0x02, 0x00, 0xcc, 0x00, 0x00, 0x04, 0x4b, 0x04, 0x8d, 0x00,
-    0x0e, 0x00, 0x1b, 0x00, 0x29, 0x40, 0x26, 0x00, 0x01, 0x00, 0x04, 0x03, 0x01, 0x04, 0x63, 0x00, 0x03, 0x05, 0x01,
-    0x02, 0x00, 0x03, 0x02, 0x63, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x00, 0x00, 0x1b, 0x19, 0x11, 0x0f, 0x00, 0x0e,
-    0x00, 0x0d, 0x21, 0x11, 0x06, 0x08, 0x16, 0x2b, 0x01, 0x11, 0x23, 0x11, 0x21, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02,
-    0x07, 0x25, 0x21, 0x3e, 0x03, 0x35, 0x34, 0x2e, 0x02, 0x27, 0x21, 0x01, 0x84, 0xb8, 0x01, 0xca, 0x54, 0x9d, 0x7a,
-    0x4a, 0x4a, 0x79, 0x9e, 0x54, 0xfe, 0xee, 0x01, 0x12, 0x31, 0x5c, 0x45, 0x2a, 0x2a, 0x45, 0x5c, 0x31, 0xfe, 0xee,
-    0x01, 0xb6, 0xfe, 0x4a, 0x04, 0x8d, 0x01, 0x2e, 0x5b, 0x89, 0x5c, 0x5f, 0x87, 0x57, 0x2a, 0x01, 0x98, 0x01, 0x17,
-    0x32, 0x4d, 0x37, 0x36, 0x50, 0x35, 0x1c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x6b, 0xfe, 0x4c, 0x04, 0x7b,
-    0x04, 0x49, 0x00, 0x2b, 0x00, 0x06, 0xb3, 0x15, 0x00, 0x01, 0x30, 0x2b, 0x13, 0x32, 0x1e, 0x02, 0x17, 0x13, 0x01,
-    0x33, 0x01, 0x13, 0x1e, 0x03, 0x33, 0x32, 0x36, 0x37, 0x07, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x03, 0x01,
-    0x23, 0x01, 0x03, 0x2e, 0x03, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0xd4, 0x47, 0x69, 0x4b, 0x32, 0x0f, 0x76,
-    0x01, 0x0a, 0xbc, 0xfe, 0x94, 0xe0, 0x0e, 0x1d, 0x21, 0x28, 0x18, 0x10, 0x0e, 0x11, 0x02, 0x0b, 0x24, 0x0d, 0x3b,
-    0x5b, 0x47, 0x38, 0x18, 0x9a, 0xfe, 0xd8, 0xc5, 0x01, 0x92, 0xb7, 0x0e, 0x22, 0x2b, 0x37, 0x22, 0x0d, 0x29, 0x0e,
-    0x01, 0x12, 0x3d, 0x04, 0x49, 0x36, 0x50, 0x5e, 0x28, 0xfe, 0xfc, 0x02, 0x01, 0xfd, 0x3a, 0xfe, 0x17, 0x20, 0x37,
-    0x28, 0x18, 0x02, 0x03, 0x9e, 0x07, 0x08, 0x23, 0x45, 0x65, 0x42, 0x01, 0x4a, 0xfd, 0xbc, 0x03, 0x09, 0x01, 0x8a,
-    0x22, 0x42, 0x34, 0x1f, 0x04, 0x01, 0x94, 0x05, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0xa3, 0x00, 0x00, 0x04, 0x60,
-    0x05, 0xaf, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x08, 0xb5, 0x2b, 0x23, 0x03, 0x01, 0x02, 0x30, 0x2b, 0x01, 0x11, 0x23,
-    0x11, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x06, 0x06, 0x07, 0x1e, 0x03, 0x15, 0x15, 0x14, 0x16, 0x17, 0x15, 0x23, 0x2e,
-    0x03, 0x35, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x25, 0x33, 0x36, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x23, 0x01, 0x5c,
-    0xb9, 0x01, 0x99, 0x75, 0xb5, 0x7c, 0x40, 0x01, 0x75, 0x70, 0x3e, 0x56, 0x35, 0x18, 0x1d, 0x26, 0xbe, 0x17, 0x19,
-    0x0c, 0x02, 0x25, 0x45, 0x60, 0x3c, 0xfe, 0xfe, 0xcd, 0xa9, 0x96, 0x23, 0x49, 0x72, 0x4e, 0xe0, 0x02, 0x79, 0xfd,
-    0x87, 0x05, 0xaf, 0x35, 0x69, 0x9a, 0x66, 0x71, 0xa5, 0x31, 0x14, 0x43, 0x58, 0x6b, 0x3d, 0x89, 0x3e, 0x6e, 0x26,
-    0x18, 0x15, 0x41, 0x45, 0x3e, 0x13, 0x85, 0x3c, 0x61, 0x45, 0x26, 0x97, 0x01, 0x82, 0x80, 0x3c, 0x61, 0x43, 0x25,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xa9, 0x00, 0x00, 0x04, 0xb6, 0x05, 0xb0, 0x00, 0x0c, 0x00, 0x27, 0x40, 0x24,
-    0x0a, 0x01, 0x00, 0x03, 0x01, 0x4a, 0x00, 0x03, 0x00, 0x00, 0x01, 0x03, 0x00, 0x61, 0x04, 0x01, 0x02, 0x02, 0x16,
-    0x4b, 0x05, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x12, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x06, 0x1a, 0x2b, 0x01,
-    0x23, 0x11, 0x23, 0x11, 0x33, 0x11, 0x33, 0x01, 0x33, 0x01, 0x01, 0x23, 0x02, 0x0d, 0xab, 0xb9, 0xb9, 0x9c, 0x01,
-    0xbb, 0xd4, 0xfe, 0x11, 0x02, 0x18, 0xe3, 0x02, 0x93, 0xfd, 0x6d, 0x05, 0xb0, 0xfd, 0x7a, 0x02, 0x86, 0xfd, 0x3f,
-    0xfd, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x79, 0xff, 0xec, 0x04, 0x5f, 0x05, 0xc2, 0x00, 0x19, 0x00, 0x25, 0x00,
-    0x08, 0xb5, 0x22, 0x1c, 0x11, 0x00, 0x02, 0x30, 0x2b, 0x13, 0x21, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02,
-    0x37, 0x17, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x21, 0x01, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
-    0x06, 0x23, 0x22, 0x26, 0x79, 0x02, 0x22, 0x20, 0x37, 0x4a, 0x29, 0x1e, 0x40, 0x3d, 0x34, 0x12, 0x19, 0x17, 0x42,
-    0x4e, 0x56, 0x2b, 0x48, 0x7d, 0x5c, 0x35, 0xfe, 0x98, 0x01, 0x52, 0x37, 0x36, 0x36, 0x38, 0x38, 0x36, 0x36, 0x37,
-    0x04, 0x3a, 0xfd, 0x25, 0x3f, 0x53, 0x30, 0x14, 0x07, 0x0b, 0x0b, 0x05, 0x85, 0x0e, 0x15, 0x0f, 0x08, 0x29, 0x59,
-    0x8d, 0x64, 0x02, 0x3a, 0x01, 0xbe, 0x2d, 0x3e, 0x3e, 0x2d, 0x2c, 0x3d, 0x3d, 0x00, 0x00, 0x01, 0x00, 0xa0, 0xff,
-    0xec, 0x04, 0x68, 0x06, 0x00, 0x00, 0x1a, 0x00, 0x06, 0xb3, 0x12, 0x02, 0x01, 0x30, 0x2b, 0x13, 0x21, 0x37, 0x03,
-    0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x17, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x13, 0x21, 0xa0,
-    0x01, 0x68, 0xba, 0x1e, 0x20, 0x37, 0x4a, 0x29, 0x1e, 0x40, 0x3d, 0x35, 0x11, 0x19, 0x17, 0x42, 0x4e, 0x56, 0x2b,
-    0x48, 0x7d, 0x5c, 0x35, 0x1a, 0xfe, 0x9c, 0x05, 0xff, 0x01, 0xfb, 0x5f, 0x3f, 0x53, 0x30, 0x14, 0x07, 0x0b, 0x0b,
-    0x05, 0x85, 0x0e, 0x15, 0x0f, 0x08, 0x29, 0x59, 0x8d, 0x64, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xce,
-    0x00, 0x00, 0x03, 0xf1, 0x05, 0xb0, 0x00, 0x0a, 0x00, 0x06, 0xb3, 0x09, 0x05, 0x01, 0x30, 0x2b, 0x37, 0x21, 0x11,
-    0x05, 0x35, 0x25, 0x33, 0x11, 0x21, 0x15, 0x21, 0xda, 0x01, 0x37, 0xfe, 0xbd, 0x01, 0xed, 0x0f, 0x01, 0x27, 0xfc,
-    0xe9, 0xa0, 0x04, 0x24, 0x71, 0xa8, 0xb5, 0xfa, 0xf0, 0xa0, 0x00, 0x02, 0x00, 0x8d, 0xff, 0x98, 0x04, 0x63, 0x04,
-    0xeb, 0x00, 0x41, 0x00, 0x52, 0x00, 0x08, 0xb5, 0x48, 0x42, 0x36, 0x2b, 0x02, 0x30, 0x2b, 0x01, 0x26, 0x26, 0x27,
-    0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x33, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x17,
-    0x17, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x17, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x27, 0x26, 0x3e,
-    0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x14, 0x16, 0x17, 0x15, 0x25, 0x32, 0x3e, 0x02, 0x37, 0x35, 0x23, 0x22,
-    0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x03, 0xc0, 0x08, 0x0b, 0x03, 0x23, 0x67, 0x42, 0x41, 0x64, 0x44, 0x23, 0x38,
-    0x63, 0x87, 0x50, 0x61, 0x05, 0x29, 0x45, 0x5e, 0x39, 0x5d, 0x8b, 0x5c, 0x2d, 0x02, 0x01, 0x02, 0x39, 0x65, 0x8d,
-    0x56, 0x1c, 0x3a, 0x37, 0x30, 0x12, 0x31, 0x19, 0x3f, 0x45, 0x46, 0x20, 0x8c, 0xc9, 0x83, 0x41, 0x03, 0x01, 0x03,
-    0x43, 0x88, 0xca, 0x83, 0x56, 0x96, 0x70, 0x41, 0x10, 0x11, 0xfe, 0x9b, 0x21, 0x37, 0x2c, 0x1d, 0x07, 0x48, 0x33,
-    0x58, 0x41, 0x24, 0x11, 0x23, 0x36, 0x01, 0x06, 0x0f, 0x2e, 0x19, 0x26, 0x37, 0x2d, 0x4e, 0x6a, 0x3d, 0x4c, 0x77,
-    0x53, 0x2c, 0x3b, 0x5c, 0x3f, 0x21, 0x47, 0x85, 0xbe, 0x77, 0x3c, 0x7a, 0xba, 0x7e, 0x40, 0x09, 0x10, 0x16, 0x0d,
-    0x84, 0x13, 0x1c, 0x13, 0x09, 0x62, 0xaf, 0xf3, 0x90, 0x2d, 0x8f, 0xf1, 0xb0, 0x62, 0x33, 0x69, 0xa0, 0x6e, 0xfe,
-    0x8d, 0x2e, 0x66, 0x26, 0x0e, 0x81, 0x12, 0x1e, 0x25, 0x12, 0xf4, 0x12, 0x29, 0x44, 0x31, 0x24, 0x3f, 0x2e, 0x1a,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5a, 0xff, 0xeb, 0x04, 0x9a, 0x05, 0xc4, 0x00, 0x2f, 0x00, 0x40, 0x00, 0x08,
-    0xb5, 0x3b, 0x30, 0x19, 0x05, 0x02, 0x30, 0x2b, 0x01, 0x15, 0x23, 0x11, 0x06, 0x06, 0x27, 0x22, 0x2e, 0x02, 0x35,
-    0x34, 0x3e, 0x02, 0x37, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34, 0x2e, 0x02,
-    0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x07, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x16,
-    0x3e, 0x02, 0x37, 0x11, 0x04, 0x9a, 0xc5, 0x58, 0xdb, 0x86, 0x5e, 0xa4, 0x7a, 0x46, 0x17, 0x38, 0x5d, 0x47, 0x35,
-    0x4c, 0x31, 0x17, 0x45, 0x75, 0x9a, 0x55, 0x60, 0x9b, 0x6d, 0x3b, 0xb9, 0x21, 0x3c, 0x57, 0x36, 0x30, 0x57, 0x42,
-    0x27, 0x20, 0x3f, 0x5b, 0x3c, 0x03, 0x41, 0x69, 0x4a, 0x29, 0x2c, 0x4f, 0x6f, 0x42, 0x1e, 0x3f, 0x3c, 0x34, 0x13,
-    0x03, 0x31, 0x97, 0xfd, 0xf5, 0x4e, 0x56, 0x01, 0x38, 0x6b, 0x9d, 0x65, 0x33, 0x68, 0x5d, 0x4b, 0x17, 0x19, 0x4b,
-    0x56, 0x5b, 0x2a, 0x65, 0x99, 0x68, 0x34, 0x3f, 0x6d, 0x93, 0x53, 0x39, 0x5c, 0x42, 0x23, 0x20, 0x40, 0x5f, 0x3f,
-    0x38, 0x5c, 0x44, 0x25, 0x97, 0x21, 0x43, 0x65, 0x44, 0x44, 0x62, 0x40, 0x1e, 0x01, 0x0b, 0x14, 0x1a, 0x0f, 0x01,
-    0xca, 0x00, 0x01, 0x00, 0x8f, 0xff, 0xec, 0x04, 0x7f, 0x05, 0xc4, 0x00, 0x31, 0x00, 0x06, 0xb3, 0x14, 0x04, 0x01,
-    0x30, 0x2b, 0x21, 0x23, 0x11, 0x34, 0x12, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x01, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x23, 0x23, 0x35, 0x01, 0x2e,
-    0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x01, 0x47, 0xb8, 0xdb, 0xe3, 0x4b, 0x7f, 0x6f, 0x61, 0x2c, 0xfe, 0xd9, 0x60,
-    0x96, 0x67, 0x36, 0x43, 0x78, 0xa6, 0x63, 0x3d, 0x7a, 0x3e, 0x36, 0x23, 0x5f, 0x3d, 0x3f, 0x62, 0x45, 0x24, 0x92,
-    0x90, 0x6f, 0x01, 0x0c, 0x15, 0x30, 0x3c, 0x47, 0x2b, 0x51, 0x66, 0x3a, 0x15, 0x03, 0xc1, 0xff, 0x01, 0x04, 0x23,
-    0x3e, 0x55, 0x32, 0xfe, 0x70, 0x09, 0x41, 0x6f, 0x9a, 0x61, 0x66, 0xa0, 0x6d, 0x39, 0x17, 0x1a, 0x98, 0x14, 0x1f,
-    0x29, 0x48, 0x65, 0x3c, 0x9a, 0x8e, 0x97, 0x01, 0x75, 0x13, 0x24, 0x1c, 0x11, 0x3b, 0x64, 0x84, 0x4a, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0xd2, 0xff, 0xec, 0x04, 0x41, 0x04, 0x9d, 0x00, 0x2f, 0x00, 0x62, 0x40, 0x0d, 0x22, 0x21,
-    0x0e, 0x0d, 0x04, 0x01, 0x02, 0x2f, 0x01, 0x03, 0x00, 0x02, 0x4a, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x1c, 0x00,
-    0x01, 0x02, 0x00, 0x02, 0x01, 0x00, 0x70, 0x00, 0x04, 0x00, 0x02, 0x01, 0x04, 0x02, 0x63, 0x00, 0x00, 0x00, 0x03,
-    0x5b, 0x05, 0x01, 0x03, 0x03, 0x3d, 0x03, 0x4c, 0x1b, 0x40, 0x20, 0x00, 0x01, 0x02, 0x00, 0x02, 0x01, 0x00, 0x70,
-    0x00, 0x04, 0x00, 0x02, 0x01, 0x04, 0x02, 0x63, 0x00, 0x03, 0x03, 0x3d, 0x4b, 0x00, 0x00, 0x00, 0x05, 0x5b, 0x00,
-    0x05, 0x05, 0x45, 0x05, 0x4c, 0x59, 0x40, 0x09, 0x2e, 0x23, 0x15, 0x24, 0x26, 0x22, 0x06, 0x08, 0x1a, 0x2b, 0x25,
-    0x16, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x23, 0x23, 0x35, 0x13, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02,
-    0x15, 0x11, 0x23, 0x11, 0x34, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x01, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x23,
-    0x22, 0x26, 0x27, 0x02, 0x0b, 0x20, 0x54, 0x36, 0x32, 0x4e, 0x36, 0x1d, 0x88, 0x87, 0x54, 0xed, 0x1d, 0x54, 0x3f,
-    0x3f, 0x53, 0x31, 0x15, 0xb8, 0xc4, 0xcc, 0x41, 0x70, 0x63, 0x57, 0x27, 0xfe, 0xee, 0x51, 0x82, 0x5b, 0x31, 0x3b,
-    0x69, 0x91, 0x57, 0x39, 0x6f, 0x37, 0xb5, 0x14, 0x1f, 0x21, 0x3b, 0x51, 0x31, 0x62, 0x55, 0x89, 0x01, 0x27, 0x17,
-    0x27, 0x2c, 0x4b, 0x65, 0x38, 0xfd, 0x0f, 0x02, 0xf1, 0xd5, 0xd7, 0x1d, 0x31, 0x43, 0x26, 0xfe, 0xb6, 0x07, 0x2f,
-    0x4f, 0x6d, 0x46, 0x5a, 0x8c, 0x60, 0x32, 0x17, 0x1a, 0xff, 0xff, 0x01, 0x3b, 0x04, 0xa7, 0x03, 0x91, 0x05, 0xb2,
-    0x02, 0x06, 0x00, 0x9e, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00,
-    0x03, 0x00, 0x00, 0xff, 0xff, 0x00, 0xda, 0x02, 0x31, 0x03, 0xd7, 0x02, 0xc9, 0x02, 0x06, 0x00, 0x0f, 0x00, 0x00,
-    0x00, 0x02, 0xff, 0xd4, 0x00, 0x00, 0x04, 0x8e, 0x05, 0xb0, 0x00, 0x11, 0x00, 0x23, 0x00, 0x37, 0x40, 0x34, 0x07,
-    0x01, 0x01, 0x04, 0x01, 0x00, 0x05, 0x01, 0x00, 0x61, 0x00, 0x06, 0x06, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x3c, 0x4b,
-    0x00, 0x05, 0x05, 0x03, 0x5b, 0x08, 0x01, 0x03, 0x03, 0x3d, 0x03, 0x4c, 0x00, 0x00, 0x23, 0x22, 0x21, 0x1f, 0x16,
-    0x14, 0x13, 0x12, 0x00, 0x11, 0x00, 0x10, 0x21, 0x11, 0x11, 0x09, 0x08, 0x17, 0x2b, 0x33, 0x11, 0x23, 0x35, 0x33,
-    0x11, 0x21, 0x1e, 0x03, 0x17, 0x15, 0x0e, 0x03, 0x07, 0x13, 0x23, 0x11, 0x33, 0x3e, 0x03, 0x37, 0x35, 0x2e, 0x03,
-    0x27, 0x23, 0x11, 0x33, 0xb9, 0xe5, 0xe5, 0x01, 0x51, 0x98, 0xef, 0xa5, 0x57, 0x01, 0x01, 0x57, 0xa5, 0xef, 0x98,
-    0x47, 0xdc, 0x95, 0x76, 0xac, 0x71, 0x37, 0x01, 0x01, 0x38, 0x70, 0xac, 0x76, 0x95, 0xdc, 0x02, 0x9a, 0x97, 0x02,
-    0x7f, 0x02, 0x63, 0xb1, 0xf7, 0x96, 0x6b, 0x96, 0xf7, 0xb1, 0x63, 0x01, 0x02, 0x9a, 0xfd, 0xfd, 0x01, 0x51, 0x8c,
-    0xbe, 0x6f, 0x6d, 0x6f, 0xbd, 0x8b, 0x50, 0x02, 0xfe, 0x19, 0x00, 0x00, 0x00, 0x02, 0xff, 0xd4, 0x00, 0x00, 0x04,
-    0x8e, 0x05, 0xb0, 0x00, 0x11, 0x00, 0x23, 0x00, 0x37, 0x40, 0x34, 0x07, 0x01, 0x01, 0x04, 0x01, 0x00, 0x05, 0x01,
-    0x00, 0x61, 0x00, 0x06, 0x06, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x3c, 0x4b, 0x00, 0x05, 0x05, 0x03, 0x5b, 0x08, 0x01,
-    0x03, 0x03, 0x3d, 0x03, 0x4c, 0x00, 0x00, 0x23, 0x22, 0x21, 0x1f, 0x16, 0x14, 0x13, 0x12, 0x00, 0x11, 0x00, 0x10,
-    0x21, 0x11, 0x11, 0x09, 0x08, 0x17, 0x2b, 0x33, 0x11, 0x23, 0x35, 0x33, 0x11, 0x21, 0x1e, 0x03, 0x17, 0x15, 0x0e,
-    0x03, 0x07, 0x13, 0x23, 0x11, 0x33, 0x3e, 0x03, 0x37, 0x35, 0x2e, 0x03, 0x27, 0x23, 0x11, 0x33, 0xb9, 0xe5, 0xe5,
-    0x01, 0x51, 0x98, 0xef, 0xa5, 0x57, 0x01, 0x01, 0x57, 0xa5, 0xef, 0x98, 0x47, 0xdc, 0x95, 0x76, 0xac, 0x71, 0x37,
-    0x01, 0x01, 0x38, 0x70, 0xac, 0x76, 0x95, 0xdc, 0x02, 0x9a, 0x97, 0x02, 0x7f, 0x02, 0x63, 0xb1, 0xf7, 0x96, 0x6b,
-    0x96, 0xf7, 0xb1, 0x63, 0x01, 0x02, 0x9a, 0xfd, 0xfd, 0x01, 0x51, 0x8c, 0xbe, 0x6f, 0x6d, 0x6f, 0xbd, 0x8b, 0x50,
-    0x02, 0xfe, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x00, 0x04, 0x4a, 0x06, 0x00, 0x00, 0x1d, 0x00, 0x62,
-    0xb6, 0x13, 0x02, 0x02, 0x02, 0x03, 0x01, 0x4a, 0x4b, 0xb0, 0x21, 0x50, 0x58, 0x40, 0x20, 0x08, 0x01, 0x06, 0x05,
-    0x01, 0x00, 0x01, 0x06, 0x00, 0x61, 0x00, 0x07, 0x07, 0x3e, 0x4b, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01,
-    0x47, 0x4b, 0x04, 0x01, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x1b, 0x40, 0x20, 0x08, 0x01, 0x06, 0x05, 0x01, 0x00, 0x01,
-    0x06, 0x00, 0x61, 0x00, 0x03, 0x03, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x47, 0x4b, 0x00, 0x07, 0x07, 0x02, 0x59, 0x04,
-    0x01, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x59, 0x40, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x13, 0x23, 0x15, 0x23, 0x10, 0x09,
-    0x08, 0x1d, 0x2b, 0x01, 0x21, 0x11, 0x36, 0x36, 0x37, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x07,
-    0x22, 0x06, 0x07, 0x11, 0x23, 0x11, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x21, 0x02, 0x97, 0xfe, 0xee, 0x3a, 0xaa,
-    0x6a, 0x55, 0x8b, 0x62, 0x35, 0xb9, 0x7f, 0x76, 0x59, 0x91, 0x2d, 0xb9, 0xb2, 0xb2, 0xb9, 0x01, 0x12, 0x04, 0xd2,
-    0xfe, 0xc7, 0x55, 0x5f, 0x01, 0x31, 0x68, 0x9f, 0x6d, 0xfd, 0x57, 0x02, 0xab, 0x85, 0x82, 0x01, 0x57, 0x48, 0xfc,
-    0xee, 0x04, 0xd2, 0x97, 0x97, 0x97, 0x00, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x00, 0x04, 0x84, 0x05, 0xb0, 0x00, 0x0f,
-    0x00, 0x29, 0x40, 0x26, 0x07, 0x01, 0x03, 0x02, 0x01, 0x00, 0x01, 0x03, 0x00, 0x61, 0x06, 0x01, 0x04, 0x04, 0x05,
-    0x59, 0x00, 0x05, 0x05, 0x3c, 0x4b, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x10, 0x08, 0x08, 0x1c, 0x2b, 0x01, 0x23, 0x11, 0x23, 0x11, 0x23, 0x35, 0x33, 0x11, 0x21, 0x35, 0x21, 0x15, 0x21,
-    0x11, 0x33, 0x03, 0xad, 0xeb, 0xb4, 0xde, 0xde, 0xfe, 0x3e, 0x04, 0x38, 0xfe, 0x3e, 0xeb, 0x03, 0x37, 0xfc, 0xc9,
-    0x03, 0x37, 0x97, 0x01, 0x44, 0x9e, 0x9e, 0xfe, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x8e, 0xff, 0xec, 0x04,
-    0x29, 0x05, 0x40, 0x00, 0x27, 0x00, 0x48, 0x40, 0x45, 0x13, 0x01, 0x04, 0x03, 0x14, 0x01, 0x05, 0x04, 0x02, 0x4a,
-    0x0b, 0x01, 0x0a, 0x00, 0x0a, 0x72, 0x07, 0x01, 0x02, 0x06, 0x01, 0x03, 0x04, 0x02, 0x03, 0x61, 0x08, 0x01, 0x01,
-    0x01, 0x00, 0x59, 0x09, 0x01, 0x00, 0x00, 0x3f, 0x4b, 0x00, 0x04, 0x04, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x45, 0x05,
-    0x4c, 0x00, 0x00, 0x00, 0x27, 0x00, 0x27, 0x26, 0x25, 0x11, 0x11, 0x15, 0x29, 0x25, 0x11, 0x11, 0x11, 0x11, 0x0c,
-    0x08, 0x1d, 0x2b, 0x01, 0x11, 0x21, 0x15, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e,
-    0x02, 0x37, 0x17, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x35, 0x21, 0x11,
-    0x02, 0x64, 0x01, 0x9c, 0xfe, 0x64, 0xea, 0xea, 0x20, 0x38, 0x49, 0x29, 0x1e, 0x40, 0x3d, 0x35, 0x11, 0x1a, 0x17,
-    0x42, 0x4e, 0x57, 0x2b, 0x48, 0x7d, 0x5c, 0x35, 0xd9, 0xd9, 0xfe, 0xe4, 0x01, 0x1c, 0x05, 0x40, 0xfe, 0xfa, 0x8f,
-    0xba, 0x97, 0xfb, 0x3f, 0x52, 0x31, 0x14, 0x07, 0x0a, 0x0b, 0x04, 0x83, 0x0e, 0x15, 0x0f, 0x08, 0x29, 0x59, 0x8d,
-    0x64, 0xfb, 0x97, 0xba, 0x8f, 0x01, 0x06, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x04, 0x90, 0x07,
-    0x23, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x00, 0x42, 0xff, 0x99, 0x01, 0x5a, 0x00, 0x09, 0xb1, 0x02,
-    0x01, 0xb8, 0x01, 0x5a, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x04, 0x90, 0x07, 0x20, 0x02,
-    0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x85, 0x01, 0x57, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8,
-    0x01, 0x57, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x04, 0x90, 0x07, 0x48, 0x02, 0x26, 0x00,
-    0x23, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0x87, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x5b,
-    0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x04, 0x90, 0x07, 0x52, 0x02, 0x26, 0x00, 0x23, 0x00,
-    0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0x93, 0x01, 0x61, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x61, 0xb0, 0x33,
-    0x2b, 0x00, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x04, 0x90, 0x07, 0x20, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01,
-    0x07, 0x00, 0x68, 0x00, 0x0f, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x04, 0x90, 0x07, 0x8b, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x00,
-    0xa0, 0x00, 0x0e, 0x01, 0xa4, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0xa4, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff,
-    0x00, 0x51, 0x00, 0x00, 0x04, 0x90, 0x08, 0x18, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x01, 0xcb, 0xff,
-    0xfc, 0x01, 0xa6, 0x00, 0x09, 0xb1, 0x02, 0x03, 0xb8, 0x01, 0xa6, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x6b,
-    0xfe, 0x4d, 0x04, 0x5d, 0x05, 0xc4, 0x02, 0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x06, 0x00, 0x77, 0x36, 0x00, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0xb6, 0x00, 0x00, 0x04, 0x34, 0x07, 0x23, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x42, 0xff, 0x8f, 0x01, 0x5a, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5a, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0x00, 0xb6, 0x00, 0x00, 0x04, 0x34, 0x07, 0x20, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73,
-    0x00, 0x7b, 0x01, 0x57, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x57, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00,
-    0xb6, 0x00, 0x00, 0x04, 0x34, 0x07, 0x48, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0x7d,
-    0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xb6, 0x00,
-    0x00, 0x04, 0x34, 0x07, 0x20, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0x00, 0x05, 0x01, 0x5b,
-    0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xae, 0x00, 0x00, 0x04,
-    0x1e, 0x07, 0x23, 0x02, 0x26, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x42, 0xff, 0x5b, 0x01, 0x5a, 0x00, 0x09,
-    0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5a, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xae, 0x00, 0x00, 0x04, 0x1e, 0x07,
-    0x20, 0x02, 0x26, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x47, 0x01, 0x57, 0x00, 0x09, 0xb1, 0x01,
-    0x01, 0xb8, 0x01, 0x57, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xae, 0x00, 0x00, 0x04, 0x1e, 0x07, 0x48, 0x02,
-    0x26, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0x49, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8,
-    0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xae, 0x00, 0x00, 0x04, 0x1e, 0x07, 0x20, 0x02, 0x26, 0x00,
-    0x2b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0xff, 0xd2, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x5b,
-    0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8f, 0x00, 0x00, 0x04, 0x3e, 0x07, 0x52, 0x02, 0x26, 0x00, 0x30, 0x00,
-    0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0x6c, 0x01, 0x61, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x61, 0xb0, 0x33,
-    0x2b, 0x00, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xec, 0x04, 0x61, 0x07, 0x38, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01,
-    0x07, 0x00, 0x42, 0xff, 0x9d, 0x01, 0x6f, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x6f, 0xb0, 0x33, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x6a, 0xff, 0xec, 0x04, 0x61, 0x07, 0x35, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00,
-    0x73, 0x00, 0x89, 0x01, 0x6c, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x6c, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff,
-    0x00, 0x6a, 0xff, 0xec, 0x04, 0x61, 0x07, 0x5d, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00,
-    0x8b, 0x01, 0x70, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x70, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x6a,
-    0xff, 0xec, 0x04, 0x61, 0x07, 0x67, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0x97, 0x01,
-    0x76, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x76, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xec,
-    0x04, 0x61, 0x07, 0x35, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0x00, 0x13, 0x01, 0x70, 0x00,
-    0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x70, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8b, 0xff, 0xec, 0x04, 0x42,
-    0x07, 0x17, 0x02, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0x42, 0xff, 0xb7, 0x01, 0x4e, 0x00, 0x09, 0xb1,
-    0x01, 0x01, 0xb8, 0x01, 0x4e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8b, 0xff, 0xec, 0x04, 0x42, 0x07, 0x14,
-    0x02, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0xa3, 0x01, 0x4b, 0x00, 0x09, 0xb1, 0x01, 0x01,
-    0xb8, 0x01, 0x4b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8b, 0xff, 0xec, 0x04, 0x42, 0x07, 0x3c, 0x02, 0x26,
-    0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0xa5, 0x01, 0x4f, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01,
-    0x4f, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8b, 0xff, 0xec, 0x04, 0x42, 0x07, 0x14, 0x02, 0x26, 0x00, 0x37,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0x00, 0x2d, 0x01, 0x4f, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x4f, 0xb0,
-    0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x3d, 0x00, 0x00, 0x04, 0x79, 0x07, 0x1f, 0x02, 0x26, 0x00, 0x3b, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x73, 0x00, 0x71, 0x01, 0x56, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x56, 0xb0, 0x33, 0x2b,
-    0x00, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xec, 0x04, 0x36, 0x05, 0xe1, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0x42, 0x95, 0x18, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x18, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x9c, 0xff,
-    0xec, 0x04, 0x36, 0x05, 0xde, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x81, 0x00, 0x15,
-    0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x15, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xec, 0x04,
-    0x36, 0x06, 0x06, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0x83, 0x00, 0x19, 0x00, 0x08,
-    0xb1, 0x02, 0x01, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xec, 0x04, 0x36, 0x06,
-    0x10, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0x8f, 0x00, 0x1f, 0x00, 0x08, 0xb1, 0x02,
-    0x01, 0xb0, 0x1f, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xec, 0x04, 0x36, 0x05, 0xde, 0x02,
-    0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x0b, 0x19, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x19, 0xb0,
-    0x33, 0x2b, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xec, 0x04, 0x36, 0x06, 0x49, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01,
-    0x06, 0x00, 0xa0, 0x0a, 0x62, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x62, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x9c,
-    0xff, 0xec, 0x04, 0x36, 0x06, 0xd6, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x06, 0x01, 0xcb, 0xf8, 0x64, 0x00,
-    0x08, 0xb1, 0x02, 0x03, 0xb0, 0x64, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x8f, 0xfe, 0x4d, 0x04, 0x33, 0x04, 0x4e,
-    0x02, 0x26, 0x00, 0x45, 0x00, 0x00, 0x00, 0x06, 0x00, 0x77, 0x4b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x87, 0xff,
-    0xec, 0x04, 0x45, 0x05, 0xe2, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06, 0x00, 0x42, 0x90, 0x19, 0x00, 0x08,
-    0xb1, 0x02, 0x01, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x87, 0xff, 0xec, 0x04, 0x45, 0x05, 0xdf, 0x02,
-    0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06, 0x00, 0x73, 0x7c, 0x16, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x16, 0xb0,
-    0x33, 0x2b, 0xff, 0xff, 0x00, 0x87, 0xff, 0xec, 0x04, 0x45, 0x06, 0x07, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01,
-    0x06, 0x00, 0x9c, 0x7e, 0x1a, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x1a, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x87,
-    0xff, 0xec, 0x04, 0x45, 0x05, 0xdf, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x06, 0x1a, 0x00,
-    0x08, 0xb1, 0x02, 0x02, 0xb0, 0x1a, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xcb, 0x00, 0x00, 0x04, 0x55, 0x05, 0xcc,
-    0x02, 0x26, 0x00, 0x8a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x42, 0xbe, 0x03, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x03,
-    0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xcb, 0x00, 0x00, 0x04, 0x55, 0x05, 0xc9, 0x02, 0x26, 0x00, 0x8a, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0x73, 0x00, 0xaa, 0x00, 0x00, 0xff, 0xff, 0x00, 0xcb, 0x00, 0x00, 0x04, 0x55, 0x05, 0xf1, 0x02,
-    0x26, 0x00, 0x8a, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0xac, 0x00, 0x04, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0,
-    0x04, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0xcb, 0x00, 0x00, 0x04, 0x55, 0x05, 0xc9, 0x02, 0x26, 0x00,
-    0x8a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x34, 0x04, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x04, 0xb0, 0x33, 0x2b,
-    0xff, 0xff, 0x00, 0xae, 0x00, 0x00, 0x04, 0x29, 0x06, 0x10, 0x02, 0x26, 0x00, 0x50, 0x00, 0x00, 0x01, 0x06, 0x00,
-    0xa2, 0x7b, 0x1f, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x1f, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xec,
-    0x04, 0x52, 0x05, 0xe1, 0x02, 0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x06, 0x00, 0x42, 0x8a, 0x18, 0x00, 0x08, 0xb1,
-    0x02, 0x01, 0xb0, 0x18, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xec, 0x04, 0x52, 0x05, 0xde, 0x02, 0x26,
-    0x00, 0x51, 0x00, 0x00, 0x01, 0x06, 0x00, 0x73, 0x76, 0x15, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x15, 0xb0, 0x33,
-    0x2b, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xec, 0x04, 0x52, 0x06, 0x06, 0x02, 0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0x9c, 0x78, 0x19, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x7a, 0xff,
-    0xec, 0x04, 0x52, 0x06, 0x10, 0x02, 0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0x84, 0x00, 0x1f,
-    0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x1f, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xec, 0x04,
-    0x52, 0x05, 0xde, 0x02, 0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x00, 0x19, 0x00, 0x08, 0xb1, 0x02,
-    0x02, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xec, 0x04, 0x1f, 0x05, 0xcd, 0x02, 0x26, 0x00,
-    0x57, 0x00, 0x00, 0x01, 0x06, 0x00, 0x42, 0x89, 0x04, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x04, 0xb0, 0x33, 0x2b,
-    0xff, 0xff, 0x00, 0xb4, 0xff, 0xec, 0x04, 0x1f, 0x05, 0xca, 0x02, 0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x06, 0x00,
-    0x73, 0x75, 0x01, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x01, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xec,
-    0x04, 0x1f, 0x05, 0xf2, 0x02, 0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9c, 0x77, 0x05, 0x00, 0x08, 0xb1,
-    0x01, 0x01, 0xb0, 0x05, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xec, 0x04, 0x1f, 0x05, 0xca, 0x02, 0x26,
-    0x00, 0x57, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x00, 0x05, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x05, 0xb0, 0x33,
-    0x2b, 0xff, 0xff, 0x00, 0x44, 0xfe, 0x4b, 0x04, 0x85, 0x05, 0xca, 0x02, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x73, 0x00, 0x89, 0x00, 0x01, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x01, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x44, 0xfe, 0x4b, 0x04, 0x85, 0x05, 0xca, 0x02, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68,
-    0x13, 0x05, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x05, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x04,
-    0x90, 0x06, 0xfa, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6e, 0x00, 0x13, 0x01, 0x4a, 0x00, 0x09,
-    0xb1, 0x02, 0x01, 0xb8, 0x01, 0x4a, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xec, 0x04, 0x36, 0x05,
-    0xb8, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6e, 0x0f, 0x08, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0,
-    0x08, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x04, 0x90, 0x07, 0x4a, 0x02, 0x26, 0x00, 0x23, 0x00,
-    0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x0f, 0x01, 0x98, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x98, 0xb0, 0x33,
-    0x2b, 0x00, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xec, 0x04, 0x36, 0x06, 0x08, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01,
-    0x06, 0x00, 0x9e, 0x0b, 0x56, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x56, 0xb0, 0x33, 0x2b, 0x00, 0x02, 0x00, 0x51,
-    0xfe, 0x4f, 0x04, 0x90, 0x05, 0xb0, 0x00, 0x1e, 0x00, 0x21, 0x00, 0x3d, 0x40, 0x3a, 0x21, 0x01, 0x06, 0x00, 0x1a,
-    0x01, 0x01, 0x04, 0x0c, 0x01, 0x02, 0x01, 0x0d, 0x01, 0x03, 0x02, 0x04, 0x4a, 0x00, 0x06, 0x00, 0x04, 0x01, 0x06,
-    0x04, 0x62, 0x00, 0x00, 0x00, 0x3c, 0x4b, 0x05, 0x01, 0x01, 0x01, 0x3d, 0x4b, 0x00, 0x02, 0x02, 0x03, 0x5b, 0x00,
-    0x03, 0x03, 0x49, 0x03, 0x4c, 0x11, 0x11, 0x1a, 0x25, 0x25, 0x11, 0x10, 0x07, 0x08, 0x1b, 0x2b, 0x01, 0x33, 0x01,
-    0x23, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34,
-    0x3e, 0x02, 0x37, 0x03, 0x21, 0x03, 0x23, 0x01, 0x21, 0x03, 0x02, 0x27, 0x9b, 0x01, 0xce, 0x30, 0x4e, 0x5e, 0x24,
-    0x2a, 0x20, 0x35, 0x10, 0x1f, 0x1c, 0x55, 0x41, 0x29, 0x46, 0x34, 0x1e, 0x1a, 0x31, 0x46, 0x2c, 0x6b, 0xfe, 0x1a,
-    0x75, 0xb9, 0x01, 0x60, 0x01, 0x83, 0xc0, 0x05, 0xb0, 0xfa, 0x50, 0x2a, 0x6f, 0x42, 0x22, 0x29, 0x01, 0x13, 0x08,
-    0x79, 0x10, 0x1c, 0x18, 0x30, 0x47, 0x2f, 0x24, 0x48, 0x45, 0x40, 0x1b, 0x01, 0x60, 0xfe, 0x87, 0x02, 0x1a, 0x02,
-    0x78, 0x00, 0x02, 0x00, 0x9c, 0xfe, 0x4f, 0x04, 0x36, 0x04, 0x4e, 0x00, 0x43, 0x00, 0x52, 0x00, 0x58, 0x40, 0x55,
-    0x49, 0x01, 0x07, 0x08, 0x2d, 0x03, 0x02, 0x00, 0x07, 0x38, 0x01, 0x05, 0x00, 0x39, 0x01, 0x06, 0x05, 0x04, 0x4a,
-    0x00, 0x03, 0x02, 0x01, 0x02, 0x03, 0x01, 0x70, 0x00, 0x01, 0x00, 0x08, 0x07, 0x01, 0x08, 0x63, 0x00, 0x02, 0x02,
-    0x04, 0x5b, 0x00, 0x04, 0x04, 0x47, 0x4b, 0x09, 0x01, 0x07, 0x07, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x45, 0x4b, 0x00,
-    0x05, 0x05, 0x06, 0x5b, 0x00, 0x06, 0x06, 0x49, 0x06, 0x4c, 0x45, 0x44, 0x4c, 0x4a, 0x44, 0x52, 0x45, 0x52, 0x25,
-    0x2f, 0x24, 0x14, 0x25, 0x28, 0x27, 0x0a, 0x08, 0x1b, 0x2b, 0x25, 0x26, 0x26, 0x27, 0x0e, 0x03, 0x23, 0x22, 0x2e,
-    0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x33, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x23, 0x3e, 0x03,
-    0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x14, 0x16, 0x17, 0x15, 0x23, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x16, 0x36,
-    0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x27, 0x32, 0x3e, 0x02, 0x37, 0x35, 0x23, 0x22,
-    0x06, 0x15, 0x14, 0x1e, 0x02, 0x03, 0x6f, 0x08, 0x0a, 0x03, 0x1c, 0x45, 0x53, 0x5e, 0x35, 0x56, 0x8b, 0x61, 0x35,
-    0x47, 0x82, 0xb7, 0x71, 0xca, 0x24, 0x42, 0x5f, 0x3b, 0x37, 0x57, 0x3c, 0x21, 0xba, 0x01, 0x3b, 0x6f, 0x9f, 0x65,
-    0x5c, 0x9e, 0x73, 0x42, 0x14, 0x12, 0x26, 0x4e, 0x5e, 0x24, 0x2a, 0x20, 0x35, 0x10, 0x1f, 0x1c, 0x55, 0x41, 0x29,
-    0x46, 0x34, 0x1e, 0x5b, 0xf0, 0x36, 0x5e, 0x4d, 0x38, 0x10, 0xac, 0xa2, 0xb4, 0x1b, 0x36, 0x52, 0x0e, 0x15, 0x36,
-    0x1d, 0x1c, 0x32, 0x26, 0x16, 0x32, 0x55, 0x75, 0x44, 0x59, 0x86, 0x59, 0x2c, 0x55, 0x31, 0x4e, 0x37, 0x1e, 0x1c,
-    0x2e, 0x3f, 0x22, 0x3b, 0x72, 0x5b, 0x38, 0x2d, 0x5b, 0x88, 0x5b, 0xfe, 0x09, 0x36, 0x79, 0x2d, 0x10, 0x2a, 0x6f,
-    0x42, 0x22, 0x29, 0x01, 0x13, 0x08, 0x79, 0x10, 0x1c, 0x18, 0x30, 0x47, 0x2f, 0x44, 0x87, 0xb5, 0x1c, 0x2e, 0x3b,
-    0x20, 0xdb, 0x60, 0x67, 0x28, 0x44, 0x31, 0x1c, 0x00, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xec, 0x04, 0x5d, 0x07, 0x35,
-    0x02, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0xaa, 0x01, 0x6c, 0x00, 0x09, 0xb1, 0x01, 0x01,
-    0xb8, 0x01, 0x6c, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8f, 0xff, 0xec, 0x04, 0x33, 0x05, 0xde, 0x02, 0x26,
-    0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x93, 0x00, 0x15, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x15,
-    0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xec, 0x04, 0x5d, 0x07, 0x5d, 0x02, 0x26, 0x00, 0x25,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0xac, 0x01, 0x70, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x70, 0xb0,
-    0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8f, 0xff, 0xec, 0x04, 0x33, 0x06, 0x06, 0x02, 0x26, 0x00, 0x45, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x9c, 0x00, 0x95, 0x00, 0x19, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xec, 0x04, 0x5d, 0x07, 0x2e, 0x02, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x9f, 0x00, 0x34, 0x01, 0x70, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x70, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0x00, 0x8f, 0xff, 0xec, 0x04, 0x33, 0x05, 0xd7, 0x02, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9f,
-    0x1d, 0x19, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xec, 0x04,
-    0x5d, 0x07, 0x5e, 0x02, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9d, 0x00, 0x35, 0x01, 0x71, 0x00, 0x09,
-    0xb1, 0x01, 0x01, 0xb8, 0x01, 0x71, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8f, 0xff, 0xec, 0x04, 0x33, 0x06,
-    0x07, 0x02, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9d, 0x1e, 0x1a, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0,
-    0x1a, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x04, 0x70, 0x07, 0x49, 0x02, 0x26, 0x00, 0x26, 0x00,
-    0x00, 0x01, 0x07, 0x00, 0x9d, 0xff, 0xda, 0x01, 0x5c, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x5c, 0xb0, 0x33,
-    0x2b, 0x00, 0xff, 0xff, 0x00, 0x8b, 0xff, 0xec, 0x05, 0xe6, 0x06, 0x15, 0x00, 0x26, 0x00, 0x46, 0x00, 0x00, 0x01,
-    0x07, 0x01, 0x68, 0x03, 0x06, 0xff, 0xff, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0xff, 0xff, 0xb0, 0x33, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0xb6, 0x00, 0x00, 0x04, 0x34, 0x06, 0xfa, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00,
-    0x6e, 0x00, 0x09, 0x01, 0x4a, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x4a, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff,
-    0x00, 0x87, 0xff, 0xec, 0x04, 0x45, 0x05, 0xb9, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6e, 0x0a,
-    0x09, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x09, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xb6, 0x00, 0x00, 0x04, 0x34,
-    0x07, 0x4a, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x05, 0x01, 0x98, 0x00, 0x09, 0xb1,
-    0x01, 0x01, 0xb8, 0x01, 0x98, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x87, 0xff, 0xec, 0x04, 0x45, 0x06, 0x09,
-    0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x06, 0x57, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x57,
-    0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xb6, 0x00, 0x00, 0x04, 0x34, 0x07, 0x19, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x9f, 0x00, 0x05, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b,
-    0x00, 0xff, 0xff, 0x00, 0x87, 0xff, 0xec, 0x04, 0x45, 0x05, 0xd8, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0x9f, 0x06, 0x1a, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x1a, 0xb0, 0x33, 0x2b, 0x00, 0x01, 0x00, 0xb6, 0xfe,
-    0x4f, 0x04, 0x34, 0x05, 0xb0, 0x00, 0x21, 0x00, 0x41, 0x40, 0x3e, 0x0e, 0x01, 0x03, 0x02, 0x0f, 0x01, 0x04, 0x03,
-    0x02, 0x4a, 0x00, 0x08, 0x00, 0x00, 0x01, 0x08, 0x00, 0x61, 0x00, 0x07, 0x07, 0x06, 0x59, 0x00, 0x06, 0x06, 0x3c,
-    0x4b, 0x00, 0x01, 0x01, 0x02, 0x59, 0x05, 0x01, 0x02, 0x02, 0x3d, 0x4b, 0x00, 0x03, 0x03, 0x04, 0x5b, 0x00, 0x04,
-    0x04, 0x49, 0x04, 0x4c, 0x11, 0x11, 0x11, 0x17, 0x25, 0x25, 0x11, 0x11, 0x10, 0x09, 0x08, 0x1d, 0x2b, 0x01, 0x21,
-    0x11, 0x21, 0x15, 0x23, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x2e,
-    0x02, 0x35, 0x34, 0x36, 0x37, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x03, 0xcf, 0xfd, 0xa0, 0x02, 0xc5, 0x54,
-    0x4e, 0x5e, 0x24, 0x2a, 0x20, 0x35, 0x10, 0x1f, 0x1c, 0x55, 0x41, 0x29, 0x46, 0x34, 0x1e, 0x50, 0x48, 0xfd, 0x8b,
-    0x03, 0x75, 0xfd, 0x44, 0x02, 0x60, 0x02, 0xa1, 0xfd, 0xfc, 0x9d, 0x2a, 0x6f, 0x42, 0x22, 0x29, 0x01, 0x13, 0x08,
-    0x79, 0x10, 0x1c, 0x18, 0x30, 0x47, 0x2f, 0x3f, 0x7f, 0x35, 0x05, 0xb0, 0x9e, 0xfe, 0x2c, 0x00, 0x02, 0x00, 0x87,
-    0xfe, 0x61, 0x04, 0x45, 0x04, 0x4e, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x4a, 0x40, 0x47, 0x33, 0x01, 0x05, 0x04, 0x0d,
-    0x01, 0x00, 0x02, 0x0e, 0x01, 0x01, 0x00, 0x03, 0x4a, 0x00, 0x07, 0x00, 0x04, 0x05, 0x07, 0x04, 0x61, 0x08, 0x01,
-    0x06, 0x06, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x47, 0x4b, 0x00, 0x05, 0x05, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x45, 0x4b,
-    0x00, 0x00, 0x00, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x41, 0x01, 0x4c, 0x35, 0x34, 0x3a, 0x39, 0x34, 0x3f, 0x35, 0x3f,
-    0x24, 0x15, 0x29, 0x17, 0x25, 0x29, 0x09, 0x08, 0x1a, 0x2b, 0x25, 0x06, 0x06, 0x07, 0x33, 0x06, 0x06, 0x15, 0x14,
-    0x16, 0x33, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x37, 0x2e, 0x03, 0x35,
-    0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x15, 0x21, 0x1e, 0x03, 0x33, 0x32, 0x36, 0x37, 0x01, 0x22,
-    0x0e, 0x02, 0x07, 0x21, 0x35, 0x2e, 0x03, 0x04, 0x37, 0x22, 0x6b, 0x4b, 0x01, 0x4e, 0x5e, 0x24, 0x2a, 0x20, 0x35,
-    0x10, 0x1f, 0x1c, 0x55, 0x41, 0x29, 0x46, 0x34, 0x1e, 0x37, 0x33, 0x6f, 0xb9, 0x85, 0x49, 0x54, 0x8b, 0xb1, 0x5d,
-    0x75, 0xaf, 0x74, 0x39, 0xfc, 0xfb, 0x03, 0x33, 0x59, 0x7c, 0x4b, 0x63, 0x9a, 0x33, 0xfe, 0xae, 0x38, 0x64, 0x50,
-    0x37, 0x0b, 0x02, 0x46, 0x03, 0x23, 0x44, 0x67, 0xbd, 0x33, 0x5b, 0x1d, 0x2a, 0x6f, 0x42, 0x22, 0x29, 0x01, 0x13,
-    0x08, 0x79, 0x10, 0x1c, 0x18, 0x30, 0x47, 0x2f, 0x35, 0x69, 0x30, 0x03, 0x50, 0x8b, 0xbd, 0x6f, 0x2a, 0x83, 0xcf,
-    0x8f, 0x4c, 0x51, 0x8f, 0xc2, 0x71, 0x53, 0x4a, 0x82, 0x61, 0x38, 0x50, 0x42, 0x02, 0xa1, 0x29, 0x4f, 0x73, 0x4b,
-    0x0e, 0x36, 0x6a, 0x54, 0x34, 0xff, 0xff, 0x00, 0xb6, 0x00, 0x00, 0x04, 0x34, 0x07, 0x49, 0x02, 0x26, 0x00, 0x27,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x9d, 0x00, 0x06, 0x01, 0x5c, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5c, 0xb0,
-    0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x87, 0xff, 0xec, 0x04, 0x45, 0x06, 0x08, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x9d, 0x07, 0x1b, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x1b, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00,
-    0x64, 0xff, 0xeb, 0x04, 0x5c, 0x07, 0x5d, 0x02, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0x91,
-    0x01, 0x70, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x70, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8c, 0xfe,
-    0x56, 0x04, 0x1d, 0x06, 0x06, 0x02, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9c, 0x6d, 0x19, 0x00, 0x08,
-    0xb1, 0x02, 0x01, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x64, 0xff, 0xeb, 0x04, 0x5c, 0x07, 0x5f, 0x02,
-    0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x19, 0x01, 0xad, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8,
-    0x01, 0xad, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8c, 0xfe, 0x56, 0x04, 0x1d, 0x06, 0x08, 0x02, 0x26, 0x00,
-    0x49, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0xf6, 0x56, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x56, 0xb0, 0x33, 0x2b,
-    0xff, 0xff, 0x00, 0x64, 0xff, 0xeb, 0x04, 0x5c, 0x07, 0x2e, 0x02, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00,
-    0x9f, 0x00, 0x19, 0x01, 0x70, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x70, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff,
-    0x00, 0x8c, 0xfe, 0x56, 0x04, 0x1d, 0x05, 0xd7, 0x02, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9f, 0xf6,
-    0x19, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x64, 0xfe, 0x25, 0x04, 0x5c,
-    0x05, 0xc4, 0x02, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0xb1, 0xfe, 0xcf, 0x00, 0x09, 0xb1,
-    0x01, 0x01, 0xb8, 0xfe, 0xcf, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8c, 0xfe, 0x56, 0x04, 0x1d, 0x06, 0x93,
-    0x02, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x06, 0x01, 0x9c, 0x07, 0x58, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x58,
-    0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x8d, 0x00, 0x00, 0x04, 0x3f, 0x07, 0x48, 0x02, 0x26, 0x00, 0x2a, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x9c, 0x00, 0x71, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b,
-    0x00, 0xff, 0xff, 0x00, 0xae, 0x00, 0x00, 0x04, 0x2c, 0x07, 0x6f, 0x02, 0x26, 0x00, 0x4a, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x9c, 0x00, 0x24, 0x01, 0x82, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x82, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0x00, 0xae, 0x00, 0x00, 0x04, 0x1e, 0x07, 0x52, 0x02, 0x26, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2,
-    0x00, 0x55, 0x01, 0x61, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x61, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00,
-    0xcb, 0x00, 0x00, 0x04, 0x55, 0x05, 0xfb, 0x02, 0x26, 0x00, 0x8a, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0xb8,
-    0x00, 0x0a, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x0a, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0xae, 0x00,
-    0x00, 0x04, 0x1e, 0x06, 0xfa, 0x02, 0x26, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6e, 0xff, 0xd6, 0x01, 0x4a,
-    0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x4a, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xcb, 0x00, 0x00, 0x04,
-    0x55, 0x05, 0xa4, 0x02, 0x26, 0x00, 0x8a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6e, 0x38, 0xf4, 0x00, 0x09, 0xb1, 0x01,
-    0x01, 0xb8, 0xff, 0xf4, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xae, 0x00, 0x00, 0x04, 0x1e, 0x07,
-    0x4a, 0x02, 0x26, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0xff, 0xd2, 0x01, 0x98, 0x00, 0x09, 0xb1, 0x01,
-    0x01, 0xb8, 0x01, 0x98, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xcb, 0x00, 0x00, 0x04, 0x55, 0x05, 0xf3, 0x02,
-    0x26, 0x00, 0x8a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x34, 0x41, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x41, 0xb0,
-    0x33, 0x2b, 0x00, 0x01, 0x00, 0xae, 0xfe, 0x4f, 0x04, 0x1e, 0x05, 0xb0, 0x00, 0x21, 0x00, 0x3b, 0x40, 0x38, 0x10,
-    0x01, 0x04, 0x03, 0x11, 0x01, 0x05, 0x04, 0x02, 0x4a, 0x08, 0x01, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x00, 0x3c,
-    0x4b, 0x07, 0x01, 0x02, 0x02, 0x03, 0x59, 0x06, 0x01, 0x03, 0x03, 0x3d, 0x4b, 0x00, 0x04, 0x04, 0x05, 0x5b, 0x00,
-    0x05, 0x05, 0x49, 0x05, 0x4c, 0x11, 0x11, 0x17, 0x25, 0x25, 0x11, 0x11, 0x11, 0x10, 0x09, 0x08, 0x1d, 0x2b, 0x13,
-    0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06,
-    0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x37, 0x21, 0x35, 0x21, 0x11, 0x21, 0xae, 0x03, 0x70, 0xfe, 0xa3, 0x01,
-    0x5d, 0xfe, 0xdc, 0x4e, 0x5e, 0x24, 0x2a, 0x20, 0x35, 0x10, 0x1f, 0x1c, 0x55, 0x41, 0x29, 0x46, 0x34, 0x1e, 0x50,
-    0x48, 0xfe, 0x69, 0x01, 0x55, 0xfe, 0xab, 0x05, 0xb0, 0xa1, 0xfb, 0x91, 0xa0, 0x2a, 0x6f, 0x42, 0x22, 0x29, 0x01,
-    0x13, 0x08, 0x79, 0x10, 0x1c, 0x18, 0x30, 0x47, 0x2f, 0x3f, 0x7f, 0x35, 0xa0, 0x04, 0x6f, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0xcb, 0xfe, 0x4f, 0x04, 0x55, 0x05, 0xc3, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x46, 0x40, 0x43, 0x0e, 0x01,
-    0x03, 0x02, 0x0f, 0x01, 0x04, 0x03, 0x02, 0x4a, 0x00, 0x09, 0x09, 0x08, 0x5b, 0x00, 0x08, 0x08, 0x44, 0x4b, 0x00,
-    0x07, 0x07, 0x00, 0x59, 0x00, 0x00, 0x00, 0x3f, 0x4b, 0x06, 0x01, 0x01, 0x01, 0x02, 0x59, 0x05, 0x01, 0x02, 0x02,
-    0x3d, 0x4b, 0x00, 0x03, 0x03, 0x04, 0x5b, 0x00, 0x04, 0x04, 0x49, 0x04, 0x4c, 0x2a, 0x28, 0x23, 0x11, 0x11, 0x17,
-    0x25, 0x25, 0x11, 0x11, 0x10, 0x0a, 0x08, 0x1d, 0x2b, 0x13, 0x21, 0x11, 0x21, 0x15, 0x21, 0x06, 0x06, 0x15, 0x14,
-    0x16, 0x33, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x37, 0x21, 0x35, 0x21,
-    0x11, 0x21, 0x01, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0xcb, 0x02, 0x29, 0x01, 0x61,
-    0xfe, 0x9f, 0x4e, 0x5e, 0x24, 0x2a, 0x20, 0x35, 0x10, 0x1f, 0x1c, 0x55, 0x41, 0x29, 0x46, 0x34, 0x1e, 0x50, 0x48,
-    0xfe, 0x8c, 0x01, 0x70, 0xfe, 0x90, 0x01, 0x58, 0x37, 0x38, 0x37, 0x38, 0x38, 0x37, 0x38, 0x37, 0x04, 0x3a, 0xfc,
-    0x66, 0xa0, 0x2a, 0x6f, 0x42, 0x22, 0x29, 0x01, 0x13, 0x08, 0x79, 0x10, 0x1c, 0x18, 0x30, 0x47, 0x2f, 0x3f, 0x7f,
-    0x35, 0xa0, 0x02, 0xf9, 0x01, 0xbd, 0x2e, 0x3f, 0x3f, 0x2e, 0x2d, 0x3c, 0x3c, 0xff, 0xff, 0x00, 0xae, 0x00, 0x00,
-    0x04, 0x1e, 0x07, 0x19, 0x02, 0x26, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0xff, 0xd2, 0x01, 0x5b, 0x00,
-    0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x62, 0xff, 0xec, 0x04, 0xdf,
-    0x07, 0x3b, 0x02, 0x26, 0x00, 0x2c, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x01, 0xc1, 0x01, 0x4e, 0x00, 0x09, 0xb1,
-    0x01, 0x01, 0xb8, 0x01, 0x4e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xb0, 0xfe, 0x4b, 0x03, 0xf5, 0x05, 0xe8,
-    0x02, 0x26, 0x00, 0x9a, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0xd7, 0xff, 0xfb, 0x00, 0x09, 0xb1, 0x01, 0x01,
-    0xb8, 0xff, 0xfb, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xac, 0xfe, 0x3e, 0x04, 0xa4, 0x05, 0xb0, 0x02, 0x26,
-    0x00, 0x2d, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0xb6, 0xfe, 0xe8, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe,
-    0xe8, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xb0, 0xfe, 0x40, 0x04, 0x6a, 0x06, 0x00, 0x02, 0x26, 0x00, 0x4d,
-    0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0x62, 0xfe, 0xea, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0xea, 0xb0,
-    0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xc6, 0x00, 0x00, 0x04, 0x47, 0x07, 0x00, 0x02, 0x26, 0x00, 0x2e, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x73, 0xff, 0x36, 0x01, 0x37, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x37, 0xb0, 0x33, 0x2b,
-    0x00, 0xff, 0xff, 0x00, 0xcb, 0x00, 0x00, 0x04, 0x55, 0x07, 0x66, 0x02, 0x26, 0x00, 0x4e, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x73, 0x00, 0xa2, 0x01, 0x9d, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x9d, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0x00, 0xc6, 0xfe, 0x38, 0x04, 0x47, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x2e, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91,
-    0x00, 0xb7, 0xfe, 0xe2, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0xe2, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00,
-    0xcb, 0xfe, 0x39, 0x04, 0x55, 0x06, 0x00, 0x02, 0x26, 0x00, 0x4e, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0xd2,
-    0xfe, 0xe3, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0xe3, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xc6, 0x00,
-    0x00, 0x04, 0x47, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x2e, 0x00, 0x00, 0x01, 0x07, 0x01, 0x68, 0x00, 0xf2, 0xff, 0x9a,
-    0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0x9a, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xcb, 0x00, 0x00, 0x04,
-    0xe1, 0x06, 0x04, 0x00, 0x26, 0x00, 0x4e, 0x00, 0x00, 0x01, 0x07, 0x01, 0x68, 0x02, 0x01, 0xff, 0xee, 0x00, 0x09,
-    0xb1, 0x01, 0x01, 0xb8, 0xff, 0xee, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xc6, 0x00, 0x00, 0x04, 0x47, 0x05,
-    0xb0, 0x02, 0x26, 0x00, 0x2e, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x00, 0x74, 0xfd, 0xc5, 0x00, 0x09, 0xb1, 0x01,
-    0x01, 0xb8, 0xfd, 0xc5, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xcb, 0x00, 0x00, 0x04, 0x58, 0x06, 0x00, 0x00,
-    0x26, 0x00, 0x4e, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x01, 0x80, 0xfd, 0xe7, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8,
-    0xfd, 0xe7, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8f, 0x00, 0x00, 0x04, 0x3e, 0x07, 0x20, 0x02, 0x26, 0x00,
-    0x30, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x5e, 0x01, 0x57, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x57,
-    0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xae, 0x00, 0x00, 0x04, 0x29, 0x05, 0xde, 0x02, 0x26, 0x00, 0x50, 0x00,
-    0x00, 0x01, 0x06, 0x00, 0x73, 0x6d, 0x15, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x15, 0xb0, 0x33, 0x2b, 0xff, 0xff,
-    0x00, 0x8f, 0xfe, 0x38, 0x04, 0x3e, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x30, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00,
-    0x84, 0xfe, 0xe2, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0xe2, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xae,
-    0xfe, 0x38, 0x04, 0x29, 0x04, 0x4e, 0x02, 0x26, 0x00, 0x50, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0x93, 0xfe,
-    0xe2, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0xe2, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8f, 0x00, 0x00,
-    0x04, 0x3e, 0x07, 0x49, 0x02, 0x26, 0x00, 0x30, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9d, 0xff, 0xea, 0x01, 0x5c, 0x00,
-    0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5c, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xae, 0x00, 0x00, 0x04, 0x29,
-    0x06, 0x07, 0x02, 0x26, 0x00, 0x50, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9d, 0xf9, 0x1a, 0x00, 0x08, 0xb1, 0x01, 0x01,
-    0xb0, 0x1a, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0xff, 0xba, 0x00, 0x00, 0x04, 0x29, 0x06, 0x16, 0x02, 0x26, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x07, 0x01, 0x68, 0xfd, 0xed, 0x00, 0x00, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xec, 0x04, 0x61, 0x07,
-    0x0f, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6e, 0x00, 0x17, 0x01, 0x5f, 0x00, 0x09, 0xb1, 0x02,
-    0x01, 0xb8, 0x01, 0x5f, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xec, 0x04, 0x52, 0x05, 0xb8, 0x02,
-    0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6e, 0x04, 0x08, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x08, 0xb0,
-    0x33, 0x2b, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xec, 0x04, 0x61, 0x07, 0x5f, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01,
-    0x07, 0x00, 0x9e, 0x00, 0x13, 0x01, 0xad, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0xad, 0xb0, 0x33, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x7a, 0xff, 0xec, 0x04, 0x52, 0x06, 0x08, 0x02, 0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x06, 0x00,
-    0x9e, 0x00, 0x56, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x56, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xec,
-    0x04, 0x6f, 0x07, 0x5f, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa3, 0x00, 0x99, 0x01, 0x70, 0x00,
-    0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x70, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xec, 0x04, 0x5c,
-    0x06, 0x08, 0x02, 0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa3, 0x00, 0x86, 0x00, 0x19, 0x00, 0x08, 0xb1,
-    0x02, 0x02, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb5, 0x00, 0x00, 0x04, 0x72, 0x07, 0x14,
-    0x02, 0x26, 0x00, 0x34, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x78, 0x01, 0x4b, 0x00, 0x09, 0xb1, 0x02, 0x01,
-    0xb8, 0x01, 0x4b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x01, 0x49, 0x00, 0x00, 0x04, 0x31, 0x05, 0xde, 0x02, 0x26,
-    0x00, 0x54, 0x00, 0x00, 0x01, 0x06, 0x00, 0x73, 0x58, 0x15, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x15, 0xb0, 0x33,
-    0x2b, 0xff, 0xff, 0x00, 0xb5, 0xfe, 0x38, 0x04, 0x72, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x34, 0x00, 0x00, 0x01, 0x07,
-    0x01, 0x91, 0x00, 0x9c, 0xfe, 0xe2, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0xfe, 0xe2, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0x01, 0x10, 0xfe, 0x38, 0x04, 0x31, 0x04, 0x4e, 0x02, 0x26, 0x00, 0x54, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91,
-    0xff, 0xe2, 0xfe, 0xe2, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0xe2, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00,
-    0xb5, 0x00, 0x00, 0x04, 0x72, 0x07, 0x3d, 0x02, 0x26, 0x00, 0x34, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9d, 0x00, 0x03,
-    0x01, 0x50, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x50, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x01, 0x14, 0x00,
-    0x00, 0x04, 0x31, 0x06, 0x07, 0x02, 0x26, 0x00, 0x54, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9d, 0xe4, 0x1a, 0x00, 0x08,
-    0xb1, 0x01, 0x01, 0xb0, 0x1a, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x76, 0xff, 0xec, 0x04, 0x69, 0x07, 0x35, 0x02,
-    0x26, 0x00, 0x35, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x82, 0x01, 0x6c, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8,
-    0x01, 0x6c, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xec, 0x04, 0x36, 0x05, 0xde, 0x02, 0x26, 0x00,
-    0x55, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x84, 0x00, 0x15, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x15, 0xb0,
-    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x76, 0xff, 0xec, 0x04, 0x69, 0x07, 0x5d, 0x02, 0x26, 0x00, 0x35, 0x00,
-    0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0x84, 0x01, 0x70, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x70, 0xb0, 0x33,
-    0x2b, 0x00, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xec, 0x04, 0x36, 0x06, 0x06, 0x02, 0x26, 0x00, 0x55, 0x00, 0x00, 0x01,
-    0x07, 0x00, 0x9c, 0x00, 0x86, 0x00, 0x19, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x76, 0xfe, 0x44, 0x04, 0x69, 0x05, 0xc4, 0x02, 0x26, 0x00, 0x35, 0x00, 0x00, 0x01, 0x06, 0x00,
-    0x77, 0x51, 0xf7, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf7, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xaf, 0xfe, 0x45, 0x04, 0x36, 0x04, 0x4e, 0x02, 0x26, 0x00, 0x55, 0x00, 0x00, 0x01, 0x06, 0x00, 0x77, 0x44,
-    0xf8, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf8, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x76,
-    0xfe, 0x24, 0x04, 0x69, 0x05, 0xc4, 0x02, 0x26, 0x00, 0x35, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0xb5, 0xfe,
-    0xce, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0xce, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xaf, 0xfe, 0x25,
-    0x04, 0x36, 0x04, 0x4e, 0x02, 0x26, 0x00, 0x55, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0xa8, 0xfe, 0xcf, 0x00,
-    0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0xcf, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x76, 0xff, 0xec, 0x04, 0x69,
-    0x07, 0x5e, 0x02, 0x26, 0x00, 0x35, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9d, 0x00, 0x0d, 0x01, 0x71, 0x00, 0x09, 0xb1,
-    0x01, 0x01, 0xb8, 0x01, 0x71, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xec, 0x04, 0x36, 0x06, 0x07,
-    0x02, 0x26, 0x00, 0x55, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9d, 0x0f, 0x1a, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x1a,
-    0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x4c, 0xfe, 0x2e, 0x04, 0x84, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x36, 0x00, 0x00,
-    0x01, 0x07, 0x01, 0x91, 0x00, 0xa3, 0xfe, 0xd8, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0xd8, 0xb0, 0x33, 0x2b,
-    0x00, 0xff, 0xff, 0x00, 0x8e, 0xfe, 0x2e, 0x04, 0x29, 0x05, 0x40, 0x02, 0x26, 0x00, 0x56, 0x00, 0x00, 0x01, 0x07,
-    0x01, 0x91, 0x01, 0x05, 0xfe, 0xd8, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0xd8, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0x00, 0x4c, 0xfe, 0x4d, 0x04, 0x84, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x36, 0x00, 0x00, 0x00, 0x06, 0x00, 0x77,
-    0x3f, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5d, 0xfe, 0x4f, 0x04, 0x69, 0x04, 0x8d, 0x02, 0x26, 0x01, 0xaf, 0x00,
-    0x00, 0x01, 0x06, 0x00, 0x77, 0x30, 0x02, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x02, 0xb0, 0x33, 0x2b, 0xff, 0xff,
-    0x00, 0x8e, 0xfe, 0x4d, 0x04, 0x29, 0x05, 0x40, 0x02, 0x26, 0x00, 0x56, 0x00, 0x00, 0x00, 0x07, 0x00, 0x77, 0x00,
-    0xa1, 0x00, 0x00, 0xff, 0xff, 0x00, 0x4c, 0x00, 0x00, 0x04, 0x84, 0x07, 0x3d, 0x02, 0x26, 0x00, 0x36, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x9d, 0x00, 0x0d, 0x01, 0x50, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x50, 0xb0, 0x33, 0x2b,
-    0x00, 0xff, 0xff, 0x00, 0x8e, 0xff, 0xec, 0x04, 0x7c, 0x06, 0xb3, 0x00, 0x26, 0x00, 0x56, 0x00, 0x00, 0x01, 0x07,
-    0x01, 0x68, 0x01, 0x9c, 0x00, 0x9d, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x9d, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x8b, 0xff, 0xec, 0x04, 0x42, 0x07, 0x46, 0x02, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2,
-    0x00, 0xb1, 0x01, 0x55, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x55, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00,
-    0xb4, 0xff, 0xec, 0x04, 0x1f, 0x05, 0xfc, 0x02, 0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0x83,
-    0x00, 0x0b, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x0b, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x8b, 0xff,
-    0xec, 0x04, 0x42, 0x06, 0xee, 0x02, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6e, 0x00, 0x31, 0x01, 0x3e,
-    0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x3e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xec, 0x04,
-    0x1f, 0x05, 0xa5, 0x02, 0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6e, 0x03, 0xf5, 0x00, 0x09, 0xb1, 0x01,
-    0x01, 0xb8, 0xff, 0xf5, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x8b, 0xff, 0xec, 0x04, 0x42, 0x07,
-    0x3e, 0x02, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x2d, 0x01, 0x8c, 0x00, 0x09, 0xb1, 0x01,
-    0x01, 0xb8, 0x01, 0x8c, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xec, 0x04, 0x1f, 0x05, 0xf4, 0x02,
-    0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x00, 0x42, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x42, 0xb0,
-    0x33, 0x2b, 0xff, 0xff, 0x00, 0x8b, 0xff, 0xec, 0x04, 0x42, 0x07, 0x7f, 0x02, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01,
-    0x07, 0x00, 0xa0, 0x00, 0x2c, 0x01, 0x98, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x98, 0xb0, 0x33, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0xb4, 0xff, 0xec, 0x04, 0x1f, 0x06, 0x35, 0x02, 0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x06, 0x00,
-    0xa0, 0xff, 0x4e, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x4e, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x8b, 0xff, 0xec,
-    0x04, 0x89, 0x07, 0x3e, 0x02, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa3, 0x00, 0xb3, 0x01, 0x4f, 0x00,
-    0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x4f, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xec, 0x04, 0x5b,
-    0x05, 0xf4, 0x02, 0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa3, 0x00, 0x85, 0x00, 0x05, 0x00, 0x08, 0xb1,
-    0x01, 0x02, 0xb0, 0x05, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x8b, 0xfe, 0x7e, 0x04, 0x42, 0x05, 0xb0,
-    0x00, 0x2e, 0x00, 0x5d, 0x40, 0x0a, 0x0f, 0x01, 0x00, 0x02, 0x10, 0x01, 0x01, 0x00, 0x02, 0x4a, 0x4b, 0xb0, 0x23,
-    0x50, 0x58, 0x40, 0x1c, 0x06, 0x05, 0x02, 0x03, 0x03, 0x3c, 0x4b, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x00, 0x02, 0x02,
-    0x45, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x41, 0x01, 0x4c, 0x1b, 0x40, 0x19, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x01, 0x5f, 0x06, 0x05, 0x02, 0x03, 0x03, 0x3c, 0x4b, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x00, 0x02, 0x02,
-    0x45, 0x02, 0x4c, 0x59, 0x40, 0x0e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x2e, 0x25, 0x15, 0x17, 0x25, 0x2b, 0x07, 0x08,
-    0x19, 0x2b, 0x01, 0x13, 0x0e, 0x03, 0x07, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06,
-    0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x37, 0x2e, 0x03, 0x27, 0x13, 0x33, 0x13, 0x1e, 0x03, 0x33, 0x32, 0x3e,
-    0x02, 0x37, 0x13, 0x04, 0x40, 0x02, 0x01, 0x27, 0x46, 0x64, 0x3d, 0x3e, 0x48, 0x24, 0x2a, 0x20, 0x35, 0x10, 0x1f,
-    0x1c, 0x55, 0x41, 0x29, 0x46, 0x34, 0x1e, 0x28, 0x26, 0x68, 0xa9, 0x79, 0x44, 0x01, 0x02, 0xb0, 0x04, 0x01, 0x27,
-    0x49, 0x6d, 0x47, 0x47, 0x6c, 0x49, 0x26, 0x02, 0x03, 0x05, 0xb0, 0xfc, 0x26, 0x4a, 0x88, 0x74, 0x5a, 0x1d, 0x28,
-    0x63, 0x3a, 0x22, 0x29, 0x01, 0x13, 0x08, 0x79, 0x10, 0x1c, 0x18, 0x30, 0x47, 0x2f, 0x2d, 0x5a, 0x2a, 0x02, 0x4e,
-    0x84, 0xb0, 0x65, 0x03, 0xda, 0xfc, 0x26, 0x41, 0x78, 0x5c, 0x38, 0x37, 0x5d, 0x78, 0x41, 0x03, 0xda, 0x00, 0x01,
-    0x00, 0xb4, 0xfe, 0x4f, 0x04, 0x44, 0x04, 0x3a, 0x00, 0x2c, 0x00, 0x3a, 0x40, 0x37, 0x29, 0x16, 0x02, 0x04, 0x03,
-    0x2c, 0x01, 0x02, 0x04, 0x09, 0x01, 0x00, 0x02, 0x0a, 0x01, 0x01, 0x00, 0x04, 0x4a, 0x05, 0x01, 0x03, 0x03, 0x3f,
-    0x4b, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x45, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x5c, 0x00, 0x01, 0x01,
-    0x49, 0x01, 0x4c, 0x13, 0x25, 0x15, 0x2a, 0x25, 0x25, 0x06, 0x08, 0x1a, 0x2b, 0x21, 0x06, 0x06, 0x15, 0x14, 0x16,
-    0x33, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x37, 0x27, 0x06, 0x06, 0x23,
-    0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x11, 0x33, 0x11, 0x04, 0x1e,
-    0x4e, 0x5e, 0x24, 0x2a, 0x20, 0x35, 0x10, 0x1f, 0x1c, 0x55, 0x41, 0x29, 0x46, 0x34, 0x1e, 0x57, 0x4e, 0x0a, 0x36,
-    0xa2, 0x6a, 0x55, 0x8a, 0x62, 0x35, 0xb9, 0x1c, 0x38, 0x51, 0x35, 0x71, 0x8b, 0x22, 0xba, 0x2a, 0x6f, 0x42, 0x22,
-    0x29, 0x01, 0x13, 0x08, 0x79, 0x10, 0x1c, 0x18, 0x30, 0x47, 0x2f, 0x42, 0x84, 0x36, 0x8c, 0x50, 0x59, 0x35, 0x70,
-    0xad, 0x79, 0x02, 0x83, 0xfd, 0x7b, 0x58, 0x74, 0x45, 0x1c, 0x5c, 0x4e, 0x03, 0x08, 0xfb, 0xc6, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x49, 0x00, 0x00, 0x04, 0x9e, 0x07, 0x48, 0x02, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00,
-    0x9c, 0x00, 0x7f, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff,
-    0x00, 0x30, 0x00, 0x00, 0x04, 0xa7, 0x05, 0xf2, 0x02, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9c, 0x7e,
-    0x05, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x05, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x3d, 0x00, 0x00, 0x04, 0x79,
-    0x07, 0x47, 0x02, 0x26, 0x00, 0x3b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0x73, 0x01, 0x5a, 0x00, 0x09, 0xb1,
-    0x01, 0x01, 0xb8, 0x01, 0x5a, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x44, 0xfe, 0x4b, 0x04, 0x85, 0x05, 0xf2,
-    0x02, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0x8b, 0x00, 0x05, 0x00, 0x08, 0xb1, 0x01, 0x01,
-    0xb0, 0x05, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3d, 0x00, 0x00, 0x04, 0x79, 0x07, 0x1f, 0x02, 0x26,
-    0x00, 0x3b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0xff, 0xfc, 0x01, 0x5a, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01,
-    0x5a, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x72, 0x00, 0x00, 0x04, 0x37, 0x07, 0x14, 0x02, 0x26, 0x00, 0x3c,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x9d, 0x01, 0x4b, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x4b, 0xb0,
-    0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xa0, 0x00, 0x00, 0x04, 0x3d, 0x05, 0xca, 0x02, 0x26, 0x00, 0x5c, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x73, 0x00, 0x9a, 0x00, 0x01, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x01, 0xb0, 0x33, 0x2b, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0x72, 0x00, 0x00, 0x04, 0x37, 0x07, 0x0d, 0x02, 0x26, 0x00, 0x3c, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x9f, 0x00, 0x27, 0x01, 0x4f, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x4f, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0x00, 0xa0, 0x00, 0x00, 0x04, 0x3d, 0x05, 0xc3, 0x02, 0x26, 0x00, 0x5c, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9f,
-    0x24, 0x05, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x05, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x72, 0x00, 0x00, 0x04,
-    0x37, 0x07, 0x3d, 0x02, 0x26, 0x00, 0x3c, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9d, 0x00, 0x28, 0x01, 0x50, 0x00, 0x09,
-    0xb1, 0x01, 0x01, 0xb8, 0x01, 0x50, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xa0, 0x00, 0x00, 0x04, 0x3d, 0x05,
-    0xf3, 0x02, 0x26, 0x00, 0x5c, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9d, 0x25, 0x06, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0,
-    0x06, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x20, 0x00, 0x00, 0x04, 0xab, 0x07, 0x20, 0x02, 0x26, 0x00, 0x7f, 0x00,
-    0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0xd7, 0x01, 0x57, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x57, 0xb0, 0x33,
-    0x2b, 0x00, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xec, 0x04, 0xa9, 0x05, 0xdf, 0x02, 0x26, 0x00, 0x84, 0x00, 0x00, 0x01,
-    0x07, 0x00, 0x73, 0x00, 0x98, 0x00, 0x16, 0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x16, 0xb0, 0x33, 0x2b, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x47, 0xff, 0xa3, 0x04, 0x8c, 0x07, 0x5e, 0x02, 0x26, 0x00, 0x81, 0x00, 0x00, 0x01, 0x07, 0x00,
-    0x73, 0x00, 0x7b, 0x01, 0x95, 0x00, 0x09, 0xb1, 0x03, 0x01, 0xb8, 0x01, 0x95, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff,
-    0x00, 0x7a, 0xff, 0x79, 0x04, 0x52, 0x05, 0xdd, 0x02, 0x26, 0x00, 0x87, 0x00, 0x00, 0x01, 0x06, 0x00, 0x73, 0x50,
-    0x14, 0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x14, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0xff, 0xe7, 0x00, 0x00, 0x04, 0x53,
-    0x04, 0x8d, 0x02, 0x26, 0x01, 0xa0, 0x00, 0x00, 0x01, 0x07, 0x01, 0xca, 0xfe, 0xb2, 0xff, 0x78, 0x00, 0x09, 0xb1,
-    0x02, 0x01, 0xb8, 0xff, 0x78, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0xff, 0xe7, 0x00, 0x00, 0x04, 0x53, 0x04, 0x8d,
-    0x02, 0x26, 0x01, 0xa0, 0x00, 0x00, 0x01, 0x07, 0x01, 0xca, 0xfe, 0xb2, 0xff, 0x78, 0x00, 0x09, 0xb1, 0x02, 0x01,
-    0xb8, 0xff, 0x78, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5d, 0x00, 0x00, 0x04, 0x69, 0x04, 0x8d, 0x02, 0x26,
-    0x01, 0xaf, 0x00, 0x00, 0x01, 0x06, 0x01, 0xca, 0xf3, 0xe0, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xe0, 0xb0,
-    0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x36, 0x00, 0x00, 0x04, 0x8e, 0x05, 0xff, 0x02, 0x26, 0x01, 0x9d,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x42, 0x8b, 0x36, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x36, 0xb0, 0x33, 0x2b, 0xff,
-    0xff, 0x00, 0x36, 0x00, 0x00, 0x04, 0x8e, 0x05, 0xfc, 0x02, 0x26, 0x01, 0x9d, 0x00, 0x00, 0x01, 0x06, 0x00, 0x73,
-    0x77, 0x33, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x33, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x36, 0x00, 0x00, 0x04,
-    0x8e, 0x06, 0x24, 0x02, 0x26, 0x01, 0x9d, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9c, 0x79, 0x37, 0x00, 0x08, 0xb1, 0x02,
-    0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x36, 0x00, 0x00, 0x04, 0x8e, 0x06, 0x2e, 0x02, 0x26, 0x01,
-    0x9d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0x85, 0x00, 0x3d, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x3d, 0xb0,
-    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x36, 0x00, 0x00, 0x04, 0x8e, 0x05, 0xfc, 0x02, 0x26, 0x01, 0x9d, 0x00,
-    0x00, 0x01, 0x06, 0x00, 0x68, 0x01, 0x37, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0xff, 0xff,
-    0x00, 0x36, 0x00, 0x00, 0x04, 0x8e, 0x06, 0x67, 0x02, 0x26, 0x01, 0x9d, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa0, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x80, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x36,
-    0x00, 0x00, 0x04, 0x8e, 0x06, 0xf4, 0x02, 0x26, 0x01, 0x9d, 0x00, 0x00, 0x01, 0x07, 0x01, 0xcb, 0xff, 0xee, 0x00,
-    0x82, 0x00, 0x08, 0xb1, 0x02, 0x03, 0xb0, 0x82, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x6e, 0xfe, 0x4a,
-    0x04, 0x36, 0x04, 0x9d, 0x02, 0x26, 0x01, 0x9f, 0x00, 0x00, 0x01, 0x06, 0x00, 0x77, 0x2a, 0xfd, 0x00, 0x09, 0xb1,
-    0x01, 0x01, 0xb8, 0xff, 0xfd, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xc8, 0x00, 0x00, 0x04, 0x23,
-    0x05, 0xff, 0x02, 0x26, 0x01, 0xa1, 0x00, 0x00, 0x01, 0x07, 0x00, 0x42, 0xff, 0x6d, 0x00, 0x36, 0x00, 0x08, 0xb1,
-    0x01, 0x01, 0xb0, 0x36, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0xc8, 0x00, 0x00, 0x04, 0x23, 0x05, 0xfc,
-    0x02, 0x26, 0x01, 0xa1, 0x00, 0x00, 0x01, 0x06, 0x00, 0x73, 0x59, 0x33, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x33,
-    0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xc8, 0x00, 0x00, 0x04, 0x23, 0x06, 0x24, 0x02, 0x26, 0x01, 0xa1, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x9c, 0x5b, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00,
-    0xc8, 0x00, 0x00, 0x04, 0x23, 0x05, 0xfc, 0x02, 0x26, 0x01, 0xa1, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0xe4, 0x37,
-    0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xd9, 0x00, 0x00, 0x04, 0x10, 0x05,
-    0xe3, 0x02, 0x26, 0x01, 0xa5, 0x00, 0x00, 0x01, 0x06, 0x00, 0x42, 0xa6, 0x1a, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0,
-    0x1a, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xd9, 0x00, 0x00, 0x04, 0x10, 0x05, 0xe0, 0x02, 0x26, 0x01, 0xa5, 0x00,
-    0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x92, 0x00, 0x17, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x17, 0xb0, 0x33, 0x2b,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0xd9, 0x00, 0x00, 0x04, 0x10, 0x06, 0x08, 0x02, 0x26, 0x01, 0xa5, 0x00, 0x00, 0x01,
-    0x07, 0x00, 0x9c, 0x00, 0x94, 0x00, 0x1b, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x1b, 0xb0, 0x33, 0x2b, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0xd9, 0x00, 0x00, 0x04, 0x10, 0x05, 0xe0, 0x02, 0x26, 0x01, 0xa5, 0x00, 0x00, 0x01, 0x06, 0x00,
-    0x68, 0x1c, 0x1b, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x1b, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xc2, 0x00, 0x00,
-    0x04, 0x16, 0x06, 0x2e, 0x02, 0x26, 0x01, 0xaa, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0xdc, 0x00, 0x3d, 0x00,
-    0x08, 0xb1, 0x01, 0x01, 0xb0, 0x3d, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x82, 0xff, 0xf0, 0x04, 0x4a,
-    0x05, 0xff, 0x02, 0x26, 0x01, 0xab, 0x00, 0x00, 0x01, 0x06, 0x00, 0x42, 0xad, 0x36, 0x00, 0x08, 0xb1, 0x02, 0x01,
-    0xb0, 0x36, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x82, 0xff, 0xf0, 0x04, 0x4a, 0x05, 0xfc, 0x02, 0x26, 0x01, 0xab,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x99, 0x00, 0x33, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x33, 0xb0, 0x33,
-    0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x82, 0xff, 0xf0, 0x04, 0x4a, 0x06, 0x24, 0x02, 0x26, 0x01, 0xab, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x9c, 0x00, 0x9b, 0x00, 0x37, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0x82, 0xff, 0xf0, 0x04, 0x4a, 0x06, 0x2e, 0x02, 0x26, 0x01, 0xab, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa2, 0x00, 0xa7, 0x00, 0x3d, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x3d, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x82, 0xff, 0xf0, 0x04, 0x4a, 0x05, 0xfc, 0x02, 0x26, 0x01, 0xab, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68,
-    0x23, 0x37, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xf0, 0x04,
-    0x2b, 0x05, 0xff, 0x02, 0x26, 0x01, 0xb0, 0x00, 0x00, 0x01, 0x06, 0x00, 0x42, 0xa9, 0x36, 0x00, 0x08, 0xb1, 0x01,
-    0x01, 0xb0, 0x36, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xf0, 0x04, 0x2b, 0x05, 0xfc, 0x02, 0x26, 0x01,
-    0xb0, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x95, 0x00, 0x33, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x33, 0xb0,
-    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xf0, 0x04, 0x2b, 0x06, 0x24, 0x02, 0x26, 0x01, 0xb0, 0x00,
-    0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0x97, 0x00, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xf0, 0x04, 0x2b, 0x05, 0xfc, 0x02, 0x26, 0x01, 0xb0, 0x00, 0x00, 0x01,
-    0x06, 0x00, 0x68, 0x1f, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x4d,
-    0x00, 0x00, 0x04, 0x81, 0x05, 0xfc, 0x02, 0x26, 0x01, 0xb4, 0x00, 0x00, 0x01, 0x06, 0x00, 0x73, 0x62, 0x33, 0x00,
-    0x08, 0xb1, 0x01, 0x01, 0xb0, 0x33, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x36, 0x00, 0x00, 0x04, 0x8e, 0x05, 0xd6,
-    0x02, 0x26, 0x01, 0x9d, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6e, 0x05, 0x26, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x26,
-    0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x36, 0x00, 0x00, 0x04, 0x8e, 0x06, 0x26, 0x02, 0x26, 0x01, 0x9d, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x9e, 0x01, 0x74, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x74, 0xb0, 0x33, 0x2b, 0x00, 0x02, 0x00,
-    0x36, 0xfe, 0x4f, 0x04, 0x91, 0x04, 0x8d, 0x00, 0x1c, 0x00, 0x1f, 0x00, 0x44, 0x40, 0x41, 0x1f, 0x01, 0x06, 0x05,
-    0x17, 0x01, 0x00, 0x03, 0x0b, 0x01, 0x01, 0x00, 0x0c, 0x01, 0x02, 0x01, 0x04, 0x4a, 0x07, 0x01, 0x05, 0x06, 0x05,
-    0x72, 0x00, 0x06, 0x00, 0x03, 0x00, 0x06, 0x03, 0x62, 0x04, 0x01, 0x00, 0x00, 0x3d, 0x4b, 0x00, 0x01, 0x01, 0x02,
-    0x5b, 0x00, 0x02, 0x02, 0x49, 0x02, 0x4c, 0x00, 0x00, 0x1e, 0x1d, 0x00, 0x1c, 0x00, 0x1c, 0x11, 0x18, 0x25, 0x25,
-    0x11, 0x08, 0x08, 0x19, 0x2b, 0x01, 0x01, 0x23, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x16, 0x36, 0x37, 0x17, 0x06,
-    0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x37, 0x03, 0x21, 0x03, 0x23, 0x01, 0x03, 0x21, 0x03, 0x02, 0xb8,
-    0x01, 0xd6, 0x23, 0x4e, 0x5e, 0x24, 0x2a, 0x20, 0x35, 0x10, 0x1f, 0x1c, 0x55, 0x41, 0x29, 0x46, 0x34, 0x1e, 0x5d,
-    0x52, 0x67, 0xfd, 0xfa, 0x6e, 0xbc, 0x01, 0xdd, 0x77, 0x01, 0x8f, 0xc7, 0x04, 0x8d, 0xfb, 0x73, 0x2a, 0x6f, 0x42,
-    0x22, 0x29, 0x01, 0x13, 0x08, 0x79, 0x10, 0x1c, 0x18, 0x30, 0x47, 0x2f, 0x45, 0x87, 0x36, 0x01, 0x08, 0xfe, 0xe9,
-    0x04, 0x8d, 0xfd, 0x21, 0x01, 0xfb, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xf0, 0x04, 0x36, 0x05, 0xfc, 0x02, 0x26, 0x01,
-    0x9f, 0x00, 0x00, 0x01, 0x06, 0x00, 0x73, 0x68, 0x33, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x33, 0xb0, 0x33, 0x2b,
-    0xff, 0xff, 0x00, 0x6e, 0xff, 0xf0, 0x04, 0x36, 0x06, 0x24, 0x02, 0x26, 0x01, 0x9f, 0x00, 0x00, 0x01, 0x06, 0x00,
-    0x9c, 0x6a, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xf0,
-    0x04, 0x36, 0x05, 0xf5, 0x02, 0x26, 0x01, 0x9f, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9f, 0xf3, 0x37, 0x00, 0x08, 0xb1,
-    0x01, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xf0, 0x04, 0x36, 0x06, 0x25, 0x02, 0x26,
-    0x01, 0x9f, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9d, 0xf4, 0x38, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x38, 0xb0, 0x33,
-    0x2b, 0xff, 0xff, 0x00, 0xb7, 0x00, 0x00, 0x04, 0x53, 0x06, 0x25, 0x02, 0x26, 0x01, 0xa0, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0x9d, 0xbb, 0x38, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x38, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xc8, 0x00,
-    0x00, 0x04, 0x23, 0x05, 0xd6, 0x02, 0x26, 0x01, 0xa1, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6e, 0xe8, 0x26, 0x00, 0x08,
-    0xb1, 0x01, 0x01, 0xb0, 0x26, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xc8, 0x00, 0x00, 0x04, 0x23, 0x06, 0x26, 0x02,
-    0x26, 0x01, 0xa1, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0xe4, 0x74, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x74, 0xb0,
-    0x33, 0x2b, 0xff, 0xff, 0x00, 0xc8, 0x00, 0x00, 0x04, 0x23, 0x05, 0xf5, 0x02, 0x26, 0x01, 0xa1, 0x00, 0x00, 0x01,
-    0x06, 0x00, 0x9f, 0xe4, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0x00, 0x01, 0x00, 0xc8,
-    0xfe, 0x4f, 0x04, 0x23, 0x04, 0x8d, 0x00, 0x21, 0x00, 0x3f, 0x40, 0x3c, 0x0e, 0x01, 0x03, 0x02, 0x0f, 0x01, 0x04,
-    0x03, 0x02, 0x4a, 0x00, 0x06, 0x00, 0x07, 0x08, 0x06, 0x07, 0x61, 0x00, 0x08, 0x00, 0x00, 0x01, 0x08, 0x00, 0x61,
-    0x00, 0x01, 0x01, 0x02, 0x59, 0x05, 0x01, 0x02, 0x02, 0x3d, 0x4b, 0x00, 0x03, 0x03, 0x04, 0x5b, 0x00, 0x04, 0x04,
-    0x49, 0x04, 0x4c, 0x11, 0x11, 0x11, 0x17, 0x25, 0x25, 0x11, 0x11, 0x10, 0x09, 0x08, 0x1d, 0x2b, 0x01, 0x21, 0x11,
-    0x21, 0x15, 0x23, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02,
-    0x35, 0x34, 0x36, 0x37, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x03, 0xc5, 0xfd, 0xc0, 0x02, 0x9e, 0x87, 0x4e,
-    0x5e, 0x24, 0x2a, 0x20, 0x35, 0x10, 0x1f, 0x1c, 0x55, 0x41, 0x29, 0x46, 0x34, 0x1e, 0x50, 0x48, 0xfd, 0xe1, 0x03,
-    0x55, 0xfd, 0x68, 0x02, 0x40, 0x02, 0x0e, 0xfe, 0x89, 0x97, 0x2a, 0x6f, 0x42, 0x22, 0x29, 0x01, 0x13, 0x08, 0x79,
-    0x10, 0x1c, 0x18, 0x30, 0x47, 0x2f, 0x3f, 0x7f, 0x35, 0x04, 0x8d, 0x99, 0xfe, 0xb2, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0xc8, 0x00, 0x00, 0x04, 0x23, 0x06, 0x25, 0x02, 0x26, 0x01, 0xa1, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9d, 0xe5, 0x38,
-    0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x38, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xf0, 0x04, 0x41, 0x06,
-    0x24, 0x02, 0x26, 0x01, 0xa3, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9c, 0x74, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0,
-    0x37, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xf0, 0x04, 0x41, 0x06, 0x26, 0x02, 0x26, 0x01, 0xa3, 0x00,
-    0x00, 0x01, 0x06, 0x00, 0x9e, 0xfd, 0x74, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x74, 0xb0, 0x33, 0x2b, 0xff, 0xff,
-    0x00, 0x7c, 0xff, 0xf0, 0x04, 0x41, 0x05, 0xf5, 0x02, 0x26, 0x01, 0xa3, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9f, 0xfd,
-    0x37, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x7c, 0xfe, 0x2b, 0x04, 0x41,
-    0x04, 0x9d, 0x02, 0x26, 0x01, 0xa3, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0x9d, 0xfe, 0xd5, 0x00, 0x09, 0xb1,
-    0x01, 0x01, 0xb8, 0xfe, 0xd5, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x03, 0xf9, 0x06, 0x24,
-    0x02, 0x26, 0x01, 0xa4, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x00, 0x9e, 0x00, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x01,
-    0xb0, 0x37, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0xd9, 0x00, 0x00, 0x04, 0x10, 0x06, 0x12, 0x02, 0x26,
-    0x01, 0xa5, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0xa0, 0x00, 0x21, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x21,
-    0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0xd9, 0x00, 0x00, 0x04, 0x10, 0x05, 0xba, 0x02, 0x26, 0x01, 0xa5,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x6e, 0x20, 0x0a, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x0a, 0xb0, 0x33, 0x2b, 0xff,
-    0xff, 0x00, 0xd9, 0x00, 0x00, 0x04, 0x10, 0x06, 0x0a, 0x02, 0x26, 0x01, 0xa5, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e,
-    0x1c, 0x58, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x58, 0xb0, 0x33, 0x2b, 0x00, 0x01, 0x00, 0xd9, 0xfe, 0x4f, 0x04,
-    0x10, 0x04, 0x8c, 0x00, 0x21, 0x00, 0x39, 0x40, 0x36, 0x10, 0x01, 0x04, 0x03, 0x11, 0x01, 0x05, 0x04, 0x02, 0x4a,
-    0x00, 0x00, 0x08, 0x01, 0x01, 0x02, 0x00, 0x01, 0x61, 0x07, 0x01, 0x02, 0x02, 0x03, 0x59, 0x06, 0x01, 0x03, 0x03,
-    0x3d, 0x4b, 0x00, 0x04, 0x04, 0x05, 0x5b, 0x00, 0x05, 0x05, 0x49, 0x05, 0x4c, 0x11, 0x11, 0x17, 0x25, 0x25, 0x11,
-    0x11, 0x11, 0x10, 0x09, 0x08, 0x1d, 0x2b, 0x13, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x06, 0x06, 0x15, 0x14,
-    0x16, 0x33, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x37, 0x21, 0x35, 0x21,
-    0x11, 0x21, 0xd9, 0x03, 0x37, 0xfe, 0xbd, 0x01, 0x43, 0xfe, 0xea, 0x4e, 0x5e, 0x24, 0x2a, 0x20, 0x35, 0x10, 0x1f,
-    0x1c, 0x55, 0x41, 0x29, 0x46, 0x34, 0x1e, 0x50, 0x48, 0xfe, 0x94, 0x01, 0x3b, 0xfe, 0xc5, 0x04, 0x8c, 0xa1, 0xfc,
-    0xb5, 0xa0, 0x2a, 0x6f, 0x42, 0x22, 0x29, 0x01, 0x13, 0x08, 0x79, 0x10, 0x1c, 0x18, 0x30, 0x47, 0x2f, 0x3f, 0x7f,
-    0x35, 0xa0, 0x03, 0x4b, 0x00, 0xff, 0xff, 0x00, 0xd9, 0x00, 0x00, 0x04, 0x10, 0x05, 0xd9, 0x02, 0x26, 0x01, 0xa5,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x9f, 0x1c, 0x1b, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x1b, 0xb0, 0x33, 0x2b, 0xff,
-    0xff, 0x00, 0x96, 0xff, 0xf0, 0x04, 0x77, 0x06, 0x24, 0x02, 0x26, 0x01, 0xa6, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c,
-    0x01, 0x59, 0x00, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0xb4, 0xfe, 0x34, 0x04, 0x80, 0x04, 0x8d, 0x02, 0x26, 0x01, 0xa7, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0x6b,
-    0xfe, 0xde, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0xde, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xb6, 0x00,
-    0x00, 0x04, 0x52, 0x05, 0xfc, 0x02, 0x26, 0x01, 0xa8, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0xff, 0x1c, 0x00, 0x33,
-    0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x33, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0xd1, 0xfe, 0x36, 0x04,
-    0x52, 0x04, 0x8d, 0x02, 0x26, 0x01, 0xa8, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0x68, 0xfe, 0xe0, 0x00, 0x09,
-    0xb1, 0x01, 0x01, 0xb8, 0xfe, 0xe0, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xd1, 0x00, 0x00, 0x04, 0x52, 0x04,
-    0x8d, 0x02, 0x26, 0x01, 0xa8, 0x00, 0x00, 0x01, 0x07, 0x01, 0x68, 0x00, 0x94, 0xfe, 0x77, 0x00, 0x09, 0xb1, 0x01,
-    0x01, 0xb8, 0xfe, 0x77, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xd1, 0x00, 0x00, 0x04, 0x52, 0x04, 0x8d, 0x02,
-    0x26, 0x01, 0xa8, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9f, 0x00, 0x19, 0xfd, 0x37, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8,
-    0xfd, 0x37, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xc2, 0x00, 0x00, 0x04, 0x0f, 0x05, 0xfc, 0x02, 0x26, 0x01,
-    0xaa, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0xce, 0x00, 0x33, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x33, 0xb0,
-    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0xc2, 0xfe, 0x32, 0x04, 0x0f, 0x04, 0x8d, 0x02, 0x26, 0x01, 0xaa, 0x00,
-    0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0xef, 0xfe, 0xdc, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xfe, 0xdc, 0xb0, 0x33,
-    0x2b, 0x00, 0xff, 0xff, 0x00, 0xc2, 0x00, 0x00, 0x04, 0x0f, 0x06, 0x25, 0x02, 0x26, 0x01, 0xaa, 0x00, 0x00, 0x01,
-    0x06, 0x00, 0x9d, 0x59, 0x38, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x38, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x82,
-    0xff, 0xf0, 0x04, 0x4a, 0x05, 0xd6, 0x02, 0x26, 0x01, 0xab, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6e, 0x27, 0x26, 0x00,
-    0x08, 0xb1, 0x02, 0x01, 0xb0, 0x26, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x82, 0xff, 0xf0, 0x04, 0x4a, 0x06, 0x26,
-    0x02, 0x26, 0x01, 0xab, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x23, 0x74, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x74,
-    0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x82, 0xff, 0xf0, 0x04, 0x7f, 0x06, 0x26, 0x02, 0x26, 0x01, 0xab, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa3, 0x00, 0xa9, 0x00, 0x37, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0x90, 0x00, 0x00, 0x04, 0x2c, 0x05, 0xfc, 0x02, 0x26, 0x01, 0xad, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0x73, 0x1e, 0x33, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x33, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x90, 0xfe,
-    0x36, 0x04, 0x2c, 0x04, 0x8d, 0x02, 0x26, 0x01, 0xad, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0x45, 0xfe, 0xe0,
-    0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0xfe, 0xe0, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x90, 0x00, 0x00, 0x04,
-    0x2c, 0x06, 0x25, 0x02, 0x26, 0x01, 0xad, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9d, 0xaa, 0x38, 0x00, 0x08, 0xb1, 0x02,
-    0x01, 0xb0, 0x38, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x8a, 0xff, 0xf0, 0x04, 0x39, 0x05, 0xfc, 0x02, 0x26, 0x01,
-    0xae, 0x00, 0x00, 0x01, 0x06, 0x00, 0x73, 0x71, 0x33, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x33, 0xb0, 0x33, 0x2b,
-    0xff, 0xff, 0x00, 0x8a, 0xff, 0xf0, 0x04, 0x39, 0x06, 0x24, 0x02, 0x26, 0x01, 0xae, 0x00, 0x00, 0x01, 0x06, 0x00,
-    0x9c, 0x73, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x8a, 0xfe, 0x4d,
-    0x04, 0x39, 0x04, 0x9d, 0x02, 0x26, 0x01, 0xae, 0x00, 0x00, 0x00, 0x06, 0x00, 0x77, 0x3d, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x8a, 0xff, 0xf0, 0x04, 0x39, 0x06, 0x25, 0x02, 0x26, 0x01, 0xae, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9d,
-    0xfd, 0x38, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x38, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x5d, 0xfe, 0x30, 0x04,
-    0x69, 0x04, 0x8d, 0x02, 0x26, 0x01, 0xaf, 0x00, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0x94, 0xfe, 0xda, 0x00, 0x09,
-    0xb1, 0x01, 0x01, 0xb8, 0xfe, 0xda, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5d, 0x00, 0x00, 0x04, 0x69, 0x06,
-    0x25, 0x02, 0x26, 0x01, 0xaf, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9d, 0xf9, 0x38, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0,
-    0x38, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xf0, 0x04, 0x2b, 0x06, 0x2e, 0x02, 0x26, 0x01, 0xb0, 0x00,
-    0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0xa3, 0x00, 0x3d, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x3d, 0xb0, 0x33, 0x2b,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xf0, 0x04, 0x2b, 0x05, 0xd6, 0x02, 0x26, 0x01, 0xb0, 0x00, 0x00, 0x01,
-    0x06, 0x00, 0x6e, 0x23, 0x26, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x26, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xb5,
-    0xff, 0xf0, 0x04, 0x2b, 0x06, 0x26, 0x02, 0x26, 0x01, 0xb0, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x1f, 0x74, 0x00,
-    0x08, 0xb1, 0x01, 0x01, 0xb0, 0x74, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xf0, 0x04, 0x2b, 0x06, 0x67,
-    0x02, 0x26, 0x01, 0xb0, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa0, 0x00, 0x1e, 0x00, 0x80, 0x00, 0x08, 0xb1, 0x01, 0x02,
-    0xb0, 0x80, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb5, 0xff, 0xf0, 0x04, 0x7b, 0x06, 0x26, 0x02, 0x26,
-    0x01, 0xb0, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa3, 0x00, 0xa5, 0x00, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x37,
-    0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb5, 0xfe, 0x8c, 0x04, 0x2b, 0x04, 0x8d, 0x00, 0x2f, 0x00, 0x5d,
-    0x40, 0x0a, 0x0f, 0x01, 0x00, 0x02, 0x10, 0x01, 0x01, 0x00, 0x02, 0x4a, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x1c,
-    0x06, 0x05, 0x02, 0x03, 0x04, 0x03, 0x72, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x45, 0x4b, 0x00, 0x00,
-    0x00, 0x01, 0x5b, 0x00, 0x01, 0x01, 0x41, 0x01, 0x4c, 0x1b, 0x40, 0x19, 0x06, 0x05, 0x02, 0x03, 0x04, 0x03, 0x72,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x5f, 0x00, 0x04, 0x04, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x45, 0x02, 0x4c, 0x59,
-    0x40, 0x0e, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x25, 0x15, 0x27, 0x25, 0x2b, 0x07, 0x08, 0x19, 0x2b, 0x01, 0x13,
-    0x0e, 0x03, 0x07, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x16, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x2e, 0x02,
-    0x35, 0x34, 0x36, 0x37, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x13, 0x33, 0x13, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x37,
-    0x13, 0x04, 0x2a, 0x01, 0x01, 0x22, 0x3c, 0x54, 0x32, 0x38, 0x3f, 0x24, 0x2a, 0x20, 0x35, 0x10, 0x1f, 0x1c, 0x55,
-    0x41, 0x29, 0x46, 0x34, 0x1e, 0x24, 0x21, 0x04, 0x5c, 0xa0, 0x77, 0x46, 0x01, 0x01, 0xb5, 0x01, 0x01, 0x25, 0x43,
-    0x5f, 0x3b, 0x3b, 0x5f, 0x43, 0x25, 0x01, 0x01, 0x04, 0x8d, 0xfc, 0xf4, 0x40, 0x6e, 0x5a, 0x46, 0x17, 0x26, 0x5e,
-    0x36, 0x22, 0x29, 0x01, 0x13, 0x08, 0x79, 0x10, 0x1c, 0x18, 0x30, 0x47, 0x2f, 0x2a, 0x54, 0x28, 0x36, 0x66, 0x95,
-    0x60, 0x03, 0x0c, 0xfc, 0xf4, 0x3b, 0x5d, 0x40, 0x22, 0x22, 0x40, 0x5d, 0x3b, 0x03, 0x0c, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x2f, 0x00, 0x00, 0x04, 0xbb, 0x06, 0x24, 0x02, 0x26, 0x01, 0xb2, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9c, 0x01,
-    0x2d, 0x00, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x4d,
-    0x00, 0x00, 0x04, 0x81, 0x06, 0x24, 0x02, 0x26, 0x01, 0xb4, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9c, 0x64, 0x37, 0x00,
-    0x08, 0xb1, 0x01, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x4d, 0x00, 0x00, 0x04, 0x81, 0x05, 0xfc,
-    0x02, 0x26, 0x01, 0xb4, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0xed, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x37,
-    0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xb9, 0x00, 0x00, 0x04, 0x42, 0x05, 0xfc, 0x02, 0x26, 0x01, 0xb5, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0x73, 0x00, 0xa0, 0x00, 0x33, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x33, 0xb0, 0x33, 0x2b, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0xb9, 0x00, 0x00, 0x04, 0x42, 0x05, 0xf5, 0x02, 0x26, 0x01, 0xb5, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0x9f, 0x2a, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x37, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xb9, 0x00,
-    0x00, 0x04, 0x42, 0x06, 0x25, 0x02, 0x26, 0x01, 0xb5, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9d, 0x2b, 0x38, 0x00, 0x08,
-    0xb1, 0x01, 0x01, 0xb0, 0x38, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x04, 0x90, 0x06, 0x7a, 0x02,
-    0x26, 0x00, 0x23, 0x00, 0x00, 0x00, 0x07, 0x00, 0xab, 0xfe, 0xc0, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x00,
-    0x04, 0x98, 0x06, 0x7a, 0x00, 0x26, 0x00, 0x27, 0x64, 0x00, 0x00, 0x07, 0x00, 0xab, 0xfd, 0xe6, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xfd, 0x00, 0x00, 0x04, 0xa3, 0x06, 0x7c, 0x00, 0x26, 0x00, 0x2a, 0x64, 0x00, 0x01, 0x07, 0x00, 0xab,
-    0xfd, 0xd4, 0x00, 0x02, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x02, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xec, 0x00, 0x00, 0x04, 0x82, 0x06, 0x7c, 0x00, 0x26, 0x00, 0x2b, 0x64, 0x00, 0x01, 0x07, 0x00, 0xab, 0xfd, 0xc3,
-    0x00, 0x02, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x02, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x09, 0xff,
-    0xec, 0x04, 0x75, 0x06, 0x7a, 0x00, 0x26, 0x00, 0x31, 0x14, 0x00, 0x00, 0x07, 0x00, 0xab, 0xfd, 0xe0, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xb2, 0x00, 0x00, 0x04, 0xdd, 0x06, 0x7a, 0x00, 0x26, 0x00, 0x3b, 0x64, 0x00, 0x00, 0x07, 0x00,
-    0xab, 0xfd, 0x89, 0x00, 0x00, 0xff, 0xff, 0x00, 0x05, 0x00, 0x00, 0x04, 0x80, 0x06, 0x7a, 0x00, 0x26, 0x00, 0xb7,
-    0x14, 0x00, 0x00, 0x07, 0x00, 0xab, 0xfd, 0xdc, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xec, 0x04, 0x3a, 0x06,
-    0x7a, 0x02, 0x26, 0x00, 0xc0, 0x00, 0x00, 0x01, 0x06, 0x00, 0xac, 0xe4, 0xbb, 0x00, 0x09, 0xb1, 0x01, 0x03, 0xb8,
-    0xff, 0xbb, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x04, 0x90, 0x05, 0xb0, 0x02,
-    0x06, 0x00, 0x23, 0x00, 0x00, 0xff, 0xff, 0x00, 0xac, 0x00, 0x00, 0x04, 0x60, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x24,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0xb6, 0x00, 0x00, 0x04, 0x34, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x27, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x72, 0x00, 0x00, 0x04, 0x37, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x3c, 0x00, 0x00, 0xff, 0xff, 0x00, 0x8d,
-    0x00, 0x00, 0x04, 0x3f, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x2a, 0x00, 0x00, 0xff, 0xff, 0x00, 0xae, 0x00, 0x00, 0x04,
-    0x1e, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0xac, 0x00, 0x00, 0x04, 0xa4, 0x05, 0xb0,
-    0x02, 0x06, 0x00, 0x2d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x94, 0x00, 0x00, 0x04, 0x4c, 0x05, 0xb0, 0x02, 0x06, 0x00,
-    0x2f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x8f, 0x00, 0x00, 0x04, 0x3e, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x30, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x6a, 0xff, 0xec, 0x04, 0x61, 0x05, 0xc4, 0x02, 0x06, 0x00, 0x31, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0xbf, 0x00, 0x00, 0x04, 0x79, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x32, 0x00, 0x00, 0xff, 0xff, 0x00, 0x4c, 0x00, 0x00,
-    0x04, 0x84, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x36, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3d, 0x00, 0x00, 0x04, 0x79, 0x05,
-    0xb0, 0x02, 0x06, 0x00, 0x3b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x57, 0x00, 0x00, 0x04, 0x8f, 0x05, 0xb0, 0x02, 0x06,
-    0x00, 0x3a, 0x00, 0x00, 0xff, 0xff, 0x00, 0xae, 0x00, 0x00, 0x04, 0x1e, 0x07, 0x20, 0x02, 0x26, 0x00, 0x2b, 0x00,
-    0x00, 0x01, 0x07, 0x00, 0x68, 0xff, 0xd2, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x5b, 0xb0, 0x33,
-    0x2b, 0x00, 0xff, 0xff, 0x00, 0x3d, 0x00, 0x00, 0x04, 0x79, 0x07, 0x1f, 0x02, 0x26, 0x00, 0x3b, 0x00, 0x00, 0x01,
-    0x07, 0x00, 0x68, 0xff, 0xfc, 0x01, 0x5a, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x5a, 0xb0, 0x33, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x81, 0xff, 0xeb, 0x04, 0x8a, 0x06, 0x7e, 0x02, 0x26, 0x00, 0xb8, 0x00, 0x00, 0x01, 0x06, 0x00,
-    0xab, 0x0f, 0x04, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x04, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x8b, 0xff, 0xec,
-    0x04, 0x60, 0x06, 0x7d, 0x02, 0x26, 0x00, 0xbc, 0x00, 0x00, 0x01, 0x06, 0x00, 0xab, 0x14, 0x03, 0x00, 0x08, 0xb1,
-    0x01, 0x01, 0xb0, 0x03, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xa4, 0xfe, 0x61, 0x04, 0x2b, 0x06, 0x7e, 0x02, 0x26,
-    0x00, 0xbe, 0x00, 0x00, 0x01, 0x06, 0x00, 0xab, 0x1c, 0x04, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x04, 0xb0, 0x33,
-    0x2b, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xec, 0x04, 0x3a, 0x06, 0x6a, 0x02, 0x26, 0x00, 0xc0, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0xab, 0x0e, 0xf0, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf0, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x9e, 0xff, 0xec, 0x04, 0x3f, 0x06, 0x7a, 0x02, 0x26, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x06, 0x00, 0xac,
-    0xc0, 0xbb, 0x00, 0x09, 0xb1, 0x01, 0x03, 0xb8, 0xff, 0xbb, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0xba, 0x00, 0x00, 0x04, 0x72, 0x04, 0x3a, 0x02, 0x06, 0x00, 0x8d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xec,
-    0x04, 0x52, 0x04, 0x4e, 0x02, 0x06, 0x00, 0x51, 0x00, 0x00, 0xff, 0xff, 0x00, 0xbc, 0xfe, 0x60, 0x04, 0x10, 0x04,
-    0x3a, 0x02, 0x06, 0x00, 0x74, 0x00, 0x00, 0xff, 0xff, 0x00, 0x62, 0x00, 0x00, 0x04, 0x65, 0x04, 0x3a, 0x02, 0x06,
-    0x00, 0x58, 0x00, 0x00, 0xff, 0xff, 0x00, 0x6e, 0x00, 0x00, 0x04, 0x72, 0x04, 0x3a, 0x02, 0x06, 0x00, 0x5a, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0xb8, 0xff, 0xec, 0x04, 0x3a, 0x05, 0xc9, 0x02, 0x26, 0x00, 0xc0, 0x00, 0x00, 0x01, 0x06,
-    0x00, 0x68, 0x05, 0x04, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x04, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x9e, 0xff,
-    0xec, 0x04, 0x3f, 0x05, 0xc9, 0x02, 0x26, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0xe2, 0x04, 0x00, 0x08,
-    0xb1, 0x01, 0x02, 0xb0, 0x04, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xec, 0x04, 0x52, 0x06, 0x7e, 0x02,
-    0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x06, 0x00, 0xab, 0x09, 0x04, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x04, 0xb0,
-    0x33, 0x2b, 0xff, 0xff, 0x00, 0x9e, 0xff, 0xec, 0x04, 0x3f, 0x06, 0x6a, 0x02, 0x26, 0x00, 0xc8, 0x00, 0x00, 0x01,
-    0x06, 0x00, 0xab, 0xeb, 0xf0, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf0, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x4f, 0xff, 0xec, 0x04, 0x89, 0x06, 0x6a, 0x02, 0x26, 0x00, 0xcb, 0x00, 0x00, 0x01, 0x06, 0x00,
-    0xab, 0x15, 0xf0, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf0, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xb6, 0x00, 0x00, 0x04, 0x34, 0x07, 0x20, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0x00,
-    0x05, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xb5,
-    0x00, 0x00, 0x04, 0x30, 0x07, 0x20, 0x02, 0x26, 0x00, 0xae, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x80, 0x01,
-    0x57, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x57, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x01, 0x00, 0x76, 0xff, 0xec,
-    0x04, 0x69, 0x05, 0xc4, 0x00, 0x3f, 0x00, 0x33, 0x40, 0x30, 0x00, 0x01, 0x02, 0x04, 0x02, 0x01, 0x04, 0x70, 0x00,
-    0x04, 0x05, 0x02, 0x04, 0x05, 0x6e, 0x00, 0x02, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x1d, 0x4b, 0x00, 0x05, 0x05,
-    0x03, 0x5b, 0x00, 0x03, 0x03, 0x1e, 0x03, 0x4c, 0x3c, 0x3a, 0x36, 0x35, 0x31, 0x2f, 0x24, 0x14, 0x2e, 0x06, 0x06,
-    0x17, 0x2b, 0x01, 0x34, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x23,
-    0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x1e, 0x03, 0x17, 0x1e, 0x05, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e,
-    0x02, 0x27, 0x33, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x03, 0xa8, 0x3d, 0x60, 0x73, 0x35, 0x4d, 0x9f, 0x83, 0x53,
-    0x53, 0x86, 0xaa, 0x56, 0x5f, 0xb0, 0x88, 0x52, 0x02, 0xbe, 0x08, 0x2e, 0x4c, 0x69, 0x42, 0x35, 0x65, 0x4f, 0x2f,
-    0x01, 0x3e, 0x5f, 0x6f, 0x31, 0x36, 0x6e, 0x66, 0x58, 0x42, 0x25, 0x57, 0x8a, 0xae, 0x57, 0x61, 0xba, 0x93, 0x5c,
-    0x03, 0xbd, 0x09, 0x38, 0x58, 0x73, 0x44, 0x36, 0x69, 0x52, 0x34, 0x01, 0x70, 0x43, 0x5c, 0x3f, 0x2a, 0x11, 0x19,
-    0x46, 0x66, 0x8b, 0x5e, 0x5e, 0x94, 0x66, 0x35, 0x3f, 0x72, 0xa2, 0x64, 0x3f, 0x67, 0x4a, 0x29, 0x1e, 0x3c, 0x58,
-    0x3a, 0x3f, 0x57, 0x3c, 0x28, 0x0f, 0x11, 0x2b, 0x38, 0x46, 0x59, 0x6b, 0x41, 0x62, 0x92, 0x61, 0x31, 0x3c, 0x71,
-    0xa3, 0x68, 0x44, 0x69, 0x49, 0x25, 0x1b, 0x39, 0x57, 0xff, 0xff, 0x00, 0xae, 0x00, 0x00, 0x04, 0x1e, 0x05, 0xb0,
-    0x02, 0x06, 0x00, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0xae, 0x00, 0x00, 0x04, 0x1e, 0x07, 0x20, 0x02, 0x26, 0x00,
-    0x2b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0xff, 0xd2, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x5b,
-    0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x62, 0xff, 0xec, 0x04, 0x16, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x2c, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0xa9, 0x00, 0x00, 0x04, 0xb6, 0x05, 0xb0, 0x02, 0x06, 0x01, 0xda, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xac, 0x00, 0x00, 0x04, 0xa4, 0x07, 0x0e, 0x02, 0x26, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00,
-    0x7e, 0x01, 0x45, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x45, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x2b,
-    0xff, 0xeb, 0x04, 0xb5, 0x07, 0x4a, 0x02, 0x26, 0x00, 0xdb, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x21, 0x01,
-    0x98, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x98, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00,
-    0x04, 0x90, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x23, 0x00, 0x00, 0xff, 0xff, 0x00, 0xac, 0x00, 0x00, 0x04, 0x60, 0x05,
-    0xb0, 0x02, 0x06, 0x00, 0x24, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb5, 0x00, 0x00, 0x04, 0x30, 0x05, 0xb0, 0x02, 0x06,
-    0x00, 0xae, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb6, 0x00, 0x00, 0x04, 0x34, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x27, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0xa2, 0x00, 0x00, 0x04, 0x2a, 0x07, 0x3e, 0x02, 0x26, 0x00, 0xd9, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x9e, 0xff, 0xf9, 0x01, 0x8c, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x8c, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0x00, 0x94, 0x00, 0x00, 0x04, 0x4c, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x2f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x8d,
-    0x00, 0x00, 0x04, 0x3f, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x2a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xec, 0x04,
-    0x61, 0x05, 0xc4, 0x02, 0x06, 0x00, 0x31, 0x00, 0x00, 0xff, 0xff, 0x00, 0xa2, 0x00, 0x00, 0x04, 0x2a, 0x05, 0xb0,
-    0x02, 0x06, 0x00, 0xb3, 0x00, 0x00, 0xff, 0xff, 0x00, 0xbf, 0x00, 0x00, 0x04, 0x79, 0x05, 0xb0, 0x02, 0x06, 0x00,
-    0x32, 0x00, 0x00, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xec, 0x04, 0x5d, 0x05, 0xc4, 0x02, 0x06, 0x00, 0x25, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x4c, 0x00, 0x00, 0x04, 0x84, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x36, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0x45, 0x00, 0x00, 0x04, 0x87, 0x05, 0xb0, 0x02, 0x06, 0x00, 0xb5, 0x00, 0x00, 0xff, 0xff, 0x00, 0x57, 0x00, 0x00,
-    0x04, 0x8f, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x3a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xec, 0x04, 0x36, 0x04,
-    0x4e, 0x02, 0x06, 0x00, 0x43, 0x00, 0x00, 0xff, 0xff, 0x00, 0x87, 0xff, 0xec, 0x04, 0x45, 0x04, 0x4e, 0x02, 0x06,
-    0x00, 0x47, 0x00, 0x00, 0xff, 0xff, 0x00, 0xa5, 0x00, 0x00, 0x04, 0x27, 0x05, 0xf3, 0x02, 0x26, 0x00, 0xec, 0x00,
-    0x00, 0x01, 0x06, 0x00, 0x9e, 0xf4, 0x41, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x41, 0xb0, 0x33, 0x2b, 0xff, 0xff,
-    0x00, 0x7a, 0xff, 0xec, 0x04, 0x52, 0x04, 0x4e, 0x02, 0x06, 0x00, 0x51, 0x00, 0x00, 0xff, 0xff, 0x00, 0xad, 0xfe,
-    0x60, 0x04, 0x3f, 0x04, 0x4e, 0x02, 0x06, 0x00, 0x52, 0x00, 0x00, 0x00, 0x01, 0x00, 0x8f, 0xff, 0xec, 0x04, 0x33,
-    0x04, 0x4e, 0x00, 0x2b, 0x00, 0x3b, 0x40, 0x38, 0x00, 0x04, 0x05, 0x01, 0x05, 0x04, 0x01, 0x70, 0x00, 0x01, 0x00,
-    0x05, 0x01, 0x00, 0x6e, 0x00, 0x05, 0x05, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x1f, 0x4b, 0x06, 0x01, 0x00, 0x00, 0x02,
-    0x5b, 0x00, 0x02, 0x02, 0x1e, 0x02, 0x4c, 0x01, 0x00, 0x22, 0x20, 0x1c, 0x1b, 0x17, 0x15, 0x0c, 0x0a, 0x06, 0x05,
-    0x00, 0x2b, 0x01, 0x2b, 0x07, 0x06, 0x14, 0x2b, 0x25, 0x32, 0x3e, 0x02, 0x37, 0x33, 0x0e, 0x03, 0x23, 0x22, 0x2e,
-    0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15,
-    0x15, 0x14, 0x1e, 0x02, 0x02, 0x7b, 0x32, 0x5f, 0x4a, 0x2d, 0x01, 0xaf, 0x01, 0x49, 0x7a, 0x9e, 0x56, 0x7b, 0xb8,
-    0x7b, 0x3e, 0x3e, 0x7b, 0xb8, 0x7b, 0x60, 0xa1, 0x75, 0x42, 0xaf, 0x01, 0x29, 0x46, 0x61, 0x38, 0x56, 0x75, 0x48,
-    0x1f, 0x1f, 0x47, 0x75, 0x82, 0x20, 0x39, 0x4d, 0x2d, 0x48, 0x83, 0x63, 0x3b, 0x58, 0x95, 0xc3, 0x6c, 0x2a, 0x6b,
-    0xc4, 0x95, 0x58, 0x3d, 0x69, 0x90, 0x52, 0x31, 0x57, 0x42, 0x26, 0x45, 0x6f, 0x8a, 0x46, 0x2a, 0x47, 0x8b, 0x6f,
-    0x45, 0xff, 0xff, 0x00, 0x44, 0xfe, 0x4b, 0x04, 0x85, 0x04, 0x3a, 0x02, 0x06, 0x00, 0x5b, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x6e, 0x00, 0x00, 0x04, 0x72, 0x04, 0x3a, 0x02, 0x06, 0x00, 0x5a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x87, 0xff,
-    0xec, 0x04, 0x45, 0x05, 0xdf, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x06, 0x1a, 0x00, 0x08,
-    0xb1, 0x02, 0x02, 0xb0, 0x1a, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xb7, 0x00, 0x00, 0x04, 0x2a, 0x05, 0xc9, 0x02,
-    0x26, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x06, 0x00, 0x73, 0x73, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xec,
-    0x04, 0x36, 0x04, 0x4e, 0x02, 0x06, 0x00, 0x55, 0x00, 0x00, 0xff, 0xff, 0x00, 0xcb, 0x00, 0x00, 0x04, 0x55, 0x05,
-    0xc3, 0x02, 0x06, 0x00, 0x4b, 0x00, 0x00, 0xff, 0xff, 0x00, 0xcb, 0x00, 0x00, 0x04, 0x55, 0x05, 0xc9, 0x02, 0x26,
-    0x00, 0x8a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x34, 0x04, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x04, 0xb0, 0x33,
-    0x2b, 0xff, 0xff, 0x00, 0xd3, 0xfe, 0x4b, 0x03, 0x58, 0x05, 0xc3, 0x02, 0x06, 0x00, 0x4c, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0xa4, 0x00, 0x00, 0x04, 0x95, 0x05, 0xc9, 0x02, 0x26, 0x00, 0xed, 0x00, 0x00, 0x00, 0x06, 0x00, 0x73, 0x27,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x44, 0xfe, 0x4b, 0x04, 0x85, 0x05, 0xf4, 0x02, 0x26, 0x00, 0x5b, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x9e, 0x13, 0x42, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x42, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00,
-    0x49, 0x00, 0x00, 0x04, 0x9e, 0x07, 0x23, 0x02, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0x42, 0xff, 0x91,
-    0x01, 0x5a, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5a, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x30, 0x00,
-    0x00, 0x04, 0xa7, 0x05, 0xcd, 0x02, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x06, 0x00, 0x42, 0x90, 0x04, 0x00, 0x08,
-    0xb1, 0x01, 0x01, 0xb0, 0x04, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x49, 0x00, 0x00, 0x04, 0x9e, 0x07, 0x20, 0x02,
-    0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x7d, 0x01, 0x57, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8,
-    0x01, 0x57, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x30, 0x00, 0x00, 0x04, 0xa7, 0x05, 0xca, 0x02, 0x26, 0x00,
-    0x59, 0x00, 0x00, 0x01, 0x06, 0x00, 0x73, 0x7c, 0x01, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x01, 0xb0, 0x33, 0x2b,
-    0xff, 0xff, 0x00, 0x49, 0x00, 0x00, 0x04, 0x9e, 0x07, 0x20, 0x02, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00,
-    0x68, 0x00, 0x07, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff,
-    0x00, 0x30, 0x00, 0x00, 0x04, 0xa7, 0x05, 0xca, 0x02, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x06,
-    0x05, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x05, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x3d, 0x00, 0x00, 0x04, 0x79,
-    0x07, 0x22, 0x02, 0x26, 0x00, 0x3b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x42, 0xff, 0x85, 0x01, 0x59, 0x00, 0x09, 0xb1,
-    0x01, 0x01, 0xb8, 0x01, 0x59, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x44, 0xfe, 0x4b, 0x04, 0x85, 0x05, 0xcd,
-    0x02, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x06, 0x00, 0x42, 0x9d, 0x04, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x04,
-    0xb0, 0x33, 0x2b, 0xff, 0xff, 0x01, 0xee, 0x04, 0x21, 0x02, 0x8d, 0x06, 0x00, 0x02, 0x06, 0x00, 0x09, 0x00, 0x00,
-    0xff, 0xff, 0x01, 0x62, 0x04, 0x21, 0x03, 0x5f, 0x06, 0x00, 0x02, 0x06, 0x00, 0x04, 0x00, 0x00, 0xff, 0xff, 0x01,
-    0xe6, 0xff, 0xf5, 0x07, 0x99, 0x05, 0xb0, 0x00, 0x26, 0x04, 0x10, 0x00, 0x00, 0x00, 0x07, 0x04, 0x10, 0x04, 0xcd,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0xb0, 0xfe, 0x4b, 0x03, 0xfb, 0x05, 0xe9, 0x02, 0x26, 0x00, 0x9a, 0x00, 0x00, 0x01,
-    0x06, 0x00, 0x9d, 0x60, 0xfc, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xfc, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x01, 0xcd, 0x04, 0x07, 0x02, 0xe0, 0x06, 0x16, 0x02, 0x06, 0x01, 0x68, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0x94, 0x00, 0x00, 0x04, 0x4c, 0x07, 0x20, 0x02, 0x26, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x75,
-    0x01, 0x57, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x57, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5d, 0x00,
-    0x00, 0x04, 0x72, 0x05, 0xde, 0x02, 0x26, 0x00, 0x4f, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x9c, 0x00, 0x15,
-    0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x15, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x51, 0xfe, 0x86, 0x04,
-    0x90, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x00, 0x06, 0x00, 0xa4, 0x25, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x9c, 0xfe, 0x86, 0x04, 0x36, 0x04, 0x4e, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x00, 0x06, 0x00, 0xa4, 0xea,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x89, 0xff, 0xec, 0x04, 0x61, 0x06, 0x56, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00,
-    0x01, 0x07, 0x01, 0xcc, 0xfd, 0x94, 0x00, 0x92, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x92, 0xb0, 0x33, 0x2b, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0xb6, 0x00, 0x00, 0x04, 0x34, 0x07, 0x23, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x42, 0xff, 0x8f, 0x01, 0x5a, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5a, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0x00, 0xa2, 0x00, 0x00, 0x04, 0x2a, 0x07, 0x17, 0x02, 0x26, 0x00, 0xd9, 0x00, 0x00, 0x01, 0x07, 0x00, 0x42,
-    0xff, 0x82, 0x01, 0x4e, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x4e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00,
-    0x87, 0xff, 0xec, 0x04, 0x45, 0x05, 0xe2, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06, 0x00, 0x42, 0x90, 0x19,
-    0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xa5, 0x00, 0x00, 0x04, 0x27, 0x05,
-    0xcc, 0x02, 0x26, 0x00, 0xec, 0x00, 0x00, 0x01, 0x07, 0x00, 0x42, 0xff, 0x7d, 0x00, 0x03, 0x00, 0x08, 0xb1, 0x01,
-    0x01, 0xb0, 0x03, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x65, 0x00, 0x00, 0x04, 0x72, 0x05, 0xb0, 0x02,
-    0x06, 0x00, 0xb6, 0x00, 0x00, 0xff, 0xff, 0x00, 0x61, 0xfe, 0x28, 0x04, 0x80, 0x04, 0x3a, 0x02, 0x06, 0x00, 0xca,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x1a, 0x00, 0x00, 0x04, 0xe1, 0x07, 0x42, 0x02, 0x26, 0x01, 0x15, 0x00, 0x00, 0x01,
-    0x07, 0x00, 0xa9, 0x04, 0x59, 0x01, 0x54, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x54, 0xb0, 0x33, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x35, 0x00, 0x00, 0x04, 0x60, 0x06, 0x1a, 0x02, 0x26, 0x01, 0x16, 0x00, 0x00, 0x01, 0x07, 0x00,
-    0xa9, 0x04, 0x30, 0x00, 0x2c, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x2c, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x59, 0xfe, 0x2f, 0x04, 0x70, 0x05, 0xc4, 0x02, 0x26, 0x00, 0xd8, 0x00, 0x00, 0x01, 0x06, 0x01, 0xce, 0xf1,
-    0x96, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0x96, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x87,
-    0xfe, 0x39, 0x04, 0x4a, 0x04, 0x4d, 0x02, 0x26, 0x00, 0xeb, 0x00, 0x00, 0x01, 0x06, 0x01, 0xce, 0x08, 0xa0, 0x00,
-    0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xa0, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x6b, 0xfe, 0x39,
-    0x04, 0x5d, 0x05, 0xc4, 0x02, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x06, 0x01, 0xce, 0xff, 0xa0, 0x00, 0x09, 0xb1,
-    0x01, 0x01, 0xb8, 0xff, 0xa0, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x8f, 0xfe, 0x39, 0x04, 0x33,
-    0x04, 0x4e, 0x02, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x06, 0x01, 0xce, 0x13, 0xa0, 0x00, 0x09, 0xb1, 0x01, 0x01,
-    0xb8, 0xff, 0xa0, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3d, 0x00, 0x00, 0x04, 0x79, 0x05, 0xb0,
-    0x02, 0x06, 0x00, 0x3b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x47, 0xfe, 0x60, 0x04, 0x96, 0x04, 0x3a, 0x02, 0x06, 0x00,
-    0xba, 0x00, 0x00, 0xff, 0xff, 0x00, 0xae, 0x00, 0x00, 0x04, 0x1e, 0x05, 0xb0, 0x02, 0x06, 0x00, 0x2b, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x1d, 0x00, 0x00, 0x04, 0xae, 0x07, 0x4a, 0x02, 0x26, 0x00, 0xd7, 0x00, 0x00, 0x01, 0x07, 0x00,
-    0x9e, 0x00, 0x0d, 0x01, 0x98, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x98, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff,
-    0x00, 0x11, 0x00, 0x00, 0x04, 0xac, 0x05, 0xf3, 0x02, 0x26, 0x00, 0xea, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0xf4,
-    0x41, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x41, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xae, 0x00, 0x00, 0x04, 0x1e,
-    0x05, 0xb0, 0x02, 0x06, 0x00, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x04, 0x90, 0x07, 0x4a, 0x02,
-    0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x0f, 0x01, 0x98, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8,
-    0x01, 0x98, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xec, 0x04, 0x36, 0x06, 0x08, 0x02, 0x26, 0x00,
-    0x43, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9e, 0x0b, 0x56, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x56, 0xb0, 0x33, 0x2b,
-    0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x04, 0x90, 0x07, 0x20, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x00,
-    0x68, 0x00, 0x0f, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff,
-    0x00, 0x9c, 0xff, 0xec, 0x04, 0x36, 0x05, 0xde, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x0b,
-    0x19, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x20, 0x00, 0x00, 0x04, 0xab,
-    0x05, 0xb0, 0x02, 0x06, 0x00, 0x7f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xec, 0x04, 0xa9, 0x04, 0x4e, 0x02,
-    0x06, 0x00, 0x84, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb6, 0x00, 0x00, 0x04, 0x34, 0x07, 0x4a, 0x02, 0x26, 0x00, 0x27,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x9e, 0x00, 0x05, 0x01, 0x98, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x98, 0xb0,
-    0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x87, 0xff, 0xec, 0x04, 0x45, 0x06, 0x09, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x9e, 0x06, 0x57, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x57, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00,
-    0x5a, 0xff, 0xeb, 0x04, 0x57, 0x06, 0xf2, 0x02, 0x26, 0x01, 0x43, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0xff, 0xfb,
-    0x01, 0x2d, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x2d, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xb1, 0xff,
-    0xec, 0x04, 0x5f, 0x04, 0x4f, 0x02, 0x06, 0x00, 0x9b, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb1, 0xff, 0xec, 0x04, 0x5f,
-    0x05, 0xdf, 0x02, 0x26, 0x00, 0x9b, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x28, 0x1a, 0x00, 0x08, 0xb1, 0x02, 0x02,
-    0xb0, 0x1a, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x1d, 0x00, 0x00, 0x04, 0xae, 0x07, 0x20, 0x02, 0x26, 0x00, 0xd7,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0x00, 0x0d, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x5b, 0xb0,
-    0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0x04, 0xac, 0x05, 0xc9, 0x02, 0x26, 0x00, 0xea, 0x00, 0x00,
-    0x01, 0x06, 0x00, 0x68, 0xf4, 0x04, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x04, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00,
-    0x59, 0xff, 0xeb, 0x04, 0x70, 0x07, 0x35, 0x02, 0x26, 0x00, 0xd8, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0xff, 0xfc,
-    0x01, 0x70, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x70, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x87, 0xff,
-    0xed, 0x04, 0x4a, 0x05, 0xdd, 0x02, 0x26, 0x00, 0xeb, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x0a, 0x18, 0x00, 0x08,
-    0xb1, 0x01, 0x02, 0xb0, 0x18, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xa2, 0x00, 0x00, 0x04, 0x2a, 0x06, 0xee, 0x02,
-    0x26, 0x00, 0xd9, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6e, 0xff, 0xfd, 0x01, 0x3e, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8,
-    0x01, 0x3e, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xa5, 0x00, 0x00, 0x04, 0x27, 0x05, 0xa4, 0x02, 0x26, 0x00,
-    0xec, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6e, 0xf8, 0xf4, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf4, 0xb0, 0x33,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xa2, 0x00, 0x00, 0x04, 0x2a, 0x07, 0x14, 0x02, 0x26, 0x00, 0xd9, 0x00,
-    0x00, 0x01, 0x07, 0x00, 0x68, 0xff, 0xf9, 0x01, 0x4f, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x4f, 0xb0, 0x33,
-    0x2b, 0x00, 0xff, 0xff, 0x00, 0xa5, 0x00, 0x00, 0x04, 0x27, 0x05, 0xc9, 0x02, 0x26, 0x00, 0xec, 0x00, 0x00, 0x01,
-    0x06, 0x00, 0x68, 0xf4, 0x04, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x04, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x6a,
-    0xff, 0xec, 0x04, 0x61, 0x07, 0x35, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0x00, 0x13, 0x01,
-    0x70, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x70, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xec,
-    0x04, 0x52, 0x05, 0xde, 0x02, 0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x00, 0x19, 0x00, 0x08, 0xb1,
-    0x02, 0x02, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x63, 0xff, 0xec, 0x04, 0x5a, 0x05, 0xc4, 0x02, 0x06,
-    0x01, 0x13, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xec, 0x04, 0x35, 0x04, 0x4e, 0x02, 0x06, 0x01, 0x14, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0x63, 0xff, 0xec, 0x04, 0x5a, 0x07, 0x1b, 0x02, 0x26, 0x01, 0x13, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x68, 0x00, 0x14, 0x01, 0x56, 0x00, 0x09, 0xb1, 0x03, 0x02, 0xb8, 0x01, 0x56, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0x00, 0x5d, 0xff, 0xec, 0x04, 0x35, 0x05, 0xfa, 0x02, 0x26, 0x01, 0x14, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68,
-    0xd0, 0x35, 0x00, 0x08, 0xb1, 0x03, 0x02, 0xb0, 0x35, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x72, 0xff, 0xec, 0x04,
-    0x53, 0x07, 0x36, 0x02, 0x26, 0x00, 0xe3, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0xff, 0xf1, 0x01, 0x71, 0x00, 0x09,
-    0xb1, 0x01, 0x02, 0xb8, 0x01, 0x71, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x81, 0xff, 0xec, 0x04, 0x3a, 0x05,
-    0xde, 0x02, 0x26, 0x00, 0xfb, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0xed, 0x19, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0,
-    0x19, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xeb, 0x04, 0xb5, 0x06, 0xfa, 0x02, 0x26, 0x00, 0xdb, 0x00,
-    0x00, 0x01, 0x07, 0x00, 0x6e, 0x00, 0x25, 0x01, 0x4a, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x4a, 0xb0, 0x33,
-    0x2b, 0x00, 0xff, 0xff, 0x00, 0x44, 0xfe, 0x4b, 0x04, 0x85, 0x05, 0xa5, 0x02, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01,
-    0x06, 0x00, 0x6e, 0x17, 0xf5, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf5, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x2b, 0xff, 0xeb, 0x04, 0xb5, 0x07, 0x20, 0x02, 0x26, 0x00, 0xdb, 0x00, 0x00, 0x01, 0x07, 0x00,
-    0x68, 0x00, 0x21, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff,
-    0x00, 0x44, 0xfe, 0x4b, 0x04, 0x85, 0x05, 0xca, 0x02, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x13,
-    0x05, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x05, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xeb, 0x04, 0xb5,
-    0x07, 0x4a, 0x02, 0x26, 0x00, 0xdb, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa3, 0x00, 0xa7, 0x01, 0x5b, 0x00, 0x09, 0xb1,
-    0x01, 0x02, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x44, 0xfe, 0x4b, 0x04, 0x85, 0x05, 0xf4,
-    0x02, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa3, 0x00, 0x99, 0x00, 0x05, 0x00, 0x08, 0xb1, 0x01, 0x02,
-    0xb0, 0x05, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0xab, 0x00, 0x00, 0x04, 0x27, 0x07, 0x20, 0x02, 0x26,
-    0x00, 0xdd, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0xff, 0xb3, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01,
-    0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8d, 0x00, 0x00, 0x04, 0x27, 0x05, 0xc9, 0x02, 0x26, 0x00, 0xf5,
-    0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x1b, 0x04, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x04, 0xb0, 0x33, 0x2b, 0xff,
-    0xff, 0x00, 0x90, 0x00, 0x00, 0x04, 0x4b, 0x07, 0x20, 0x02, 0x26, 0x00, 0xe1, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68,
-    0xff, 0xe1, 0x01, 0x5b, 0x00, 0x09, 0xb1, 0x03, 0x02, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00,
-    0x90, 0x00, 0x00, 0x04, 0x3f, 0x05, 0xc9, 0x02, 0x26, 0x00, 0xf9, 0x00, 0x00, 0x01, 0x06, 0x00, 0x68, 0x43, 0x04,
-    0x00, 0x08, 0xb1, 0x03, 0x02, 0xb0, 0x04, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x57, 0xfe, 0x4b, 0x05, 0x16, 0x05,
-    0xb0, 0x02, 0x26, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x07, 0x01, 0xd0, 0x02, 0x04, 0x00, 0x00, 0xff, 0xff, 0x00, 0x6e,
-    0xfe, 0x4b, 0x04, 0xa5, 0x04, 0x3a, 0x02, 0x26, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x07, 0x01, 0xd0, 0x01, 0x93, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0x8b, 0xff, 0xec, 0x04, 0x1c, 0x06, 0x00, 0x02, 0x06, 0x00, 0x46, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x2f, 0xfe, 0x4b, 0x04, 0xe3, 0x05, 0xb0, 0x02, 0x26, 0x00, 0xda, 0x00, 0x00, 0x00, 0x07, 0x01, 0xd0, 0x01,
-    0xd1, 0x00, 0x00, 0xff, 0xff, 0x00, 0x37, 0xfe, 0x4b, 0x04, 0xde, 0x04, 0x3a, 0x02, 0x26, 0x00, 0xee, 0x00, 0x00,
-    0x00, 0x07, 0x01, 0xd0, 0x01, 0xcc, 0x00, 0x00, 0xff, 0xff, 0x00, 0x51, 0xfe, 0xa8, 0x04, 0x90, 0x05, 0xb0, 0x02,
-    0x26, 0x00, 0x23, 0x00, 0x00, 0x00, 0x07, 0x00, 0xaa, 0x04, 0xdf, 0x00, 0x00, 0xff, 0xff, 0x00, 0x9c, 0xfe, 0xa8,
-    0x04, 0x36, 0x04, 0x4e, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x00, 0x07, 0x00, 0xaa, 0x04, 0xa3, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x51, 0x00, 0x00, 0x04, 0x90, 0x07, 0xc6, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa8,
-    0x04, 0xc8, 0x01, 0x52, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x52, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00,
-    0x9c, 0xff, 0xec, 0x04, 0x36, 0x06, 0x84, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa8, 0x04, 0xc4,
-    0x00, 0x10, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x10, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x51, 0x00,
-    0x00, 0x04, 0xe9, 0x07, 0xee, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x01, 0x9a, 0xff, 0xf5, 0x01, 0x59,
-    0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x59, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xec, 0x04,
-    0xe5, 0x06, 0xac, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x06, 0x01, 0x9a, 0xf1, 0x17, 0x00, 0x08, 0xb1, 0x02,
-    0x02, 0xb0, 0x17, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x04, 0x90, 0x07, 0xdd, 0x02, 0x26, 0x00,
-    0x23, 0x00, 0x00, 0x01, 0x07, 0x01, 0x99, 0xff, 0xec, 0x01, 0x48, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x48,
-    0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xec, 0x04, 0x36, 0x06, 0x9b, 0x02, 0x26, 0x00, 0x43, 0x00,
-    0x00, 0x01, 0x06, 0x01, 0x99, 0xe8, 0x06, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x06, 0xb0, 0x33, 0x2b, 0xff, 0xff,
-    0x00, 0x51, 0x00, 0x00, 0x04, 0xbb, 0x08, 0x04, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x01, 0x98, 0x00,
-    0x01, 0x01, 0x35, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x35, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x9c,
-    0xff, 0xec, 0x04, 0xb8, 0x06, 0xc3, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x06, 0x01, 0x98, 0xfe, 0xf4, 0x00,
-    0x09, 0xb1, 0x02, 0x02, 0xb8, 0xff, 0xf4, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00,
-    0x04, 0x90, 0x08, 0x2f, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x01, 0x97, 0xff, 0xf3, 0x01, 0x36, 0x00,
-    0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x36, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xec, 0x04, 0x36,
-    0x06, 0xee, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x06, 0x01, 0x97, 0xef, 0xf5, 0x00, 0x09, 0xb1, 0x02, 0x02,
-    0xb8, 0xff, 0xf5, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x51, 0xfe, 0xa8, 0x04, 0x90, 0x07, 0x48,
-    0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x00, 0x27, 0x00, 0x9c, 0x00, 0x87, 0x01, 0x5b, 0x01, 0x07, 0x00, 0xaa, 0x04,
-    0xdf, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x9c,
-    0xfe, 0xa8, 0x04, 0x36, 0x06, 0x06, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x00, 0x27, 0x00, 0x9c, 0x00, 0x83, 0x00,
-    0x19, 0x01, 0x07, 0x00, 0xaa, 0x04, 0xa3, 0x00, 0x00, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x19, 0xb0, 0x33, 0x2b,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x04, 0x90, 0x07, 0xde, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01,
-    0x07, 0x01, 0xc2, 0x00, 0x00, 0x01, 0x54, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x54, 0xb0, 0x33, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x9c, 0xff, 0xec, 0x04, 0x36, 0x06, 0x9c, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x06, 0x01,
-    0xc2, 0xfc, 0x12, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x12, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00,
-    0x04, 0x90, 0x08, 0x21, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x01, 0x9b, 0x00, 0x03, 0x01, 0x7a, 0x00,
-    0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x7a, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xec, 0x04, 0x36,
-    0x06, 0xdf, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x06, 0x01, 0x9b, 0x00, 0x38, 0x00, 0x08, 0xb1, 0x02, 0x02,
-    0xb0, 0x38, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x04, 0x90, 0x08, 0x4c, 0x02, 0x26, 0x00, 0x23,
-    0x00, 0x00, 0x01, 0x07, 0x01, 0xb6, 0xff, 0xf4, 0x01, 0x49, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x49, 0xb0,
-    0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xec, 0x04, 0x36, 0x07, 0x0a, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00,
-    0x01, 0x06, 0x01, 0xb6, 0xf0, 0x07, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x07, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00,
-    0x51, 0x00, 0x00, 0x04, 0x90, 0x08, 0x21, 0x02, 0x26, 0x00, 0x23, 0x00, 0x00, 0x01, 0x07, 0x01, 0xcd, 0xff, 0xd4,
-    0x01, 0x51, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x51, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x9c, 0xff,
-    0xec, 0x04, 0x36, 0x06, 0xdf, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x01, 0x06, 0x01, 0xcd, 0xd0, 0x0f, 0x00, 0x08,
-    0xb1, 0x02, 0x02, 0xb0, 0x0f, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x51, 0xfe, 0xa8, 0x04, 0x90, 0x07, 0x4a, 0x02,
-    0x26, 0x00, 0x23, 0x00, 0x00, 0x00, 0x27, 0x00, 0x9e, 0x00, 0x0f, 0x01, 0x98, 0x01, 0x07, 0x00, 0xaa, 0x04, 0xdf,
-    0x00, 0x00, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x98, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x9c, 0xfe,
-    0xa8, 0x04, 0x36, 0x06, 0x08, 0x02, 0x26, 0x00, 0x43, 0x00, 0x00, 0x00, 0x26, 0x00, 0x9e, 0x0b, 0x56, 0x01, 0x07,
-    0x00, 0xaa, 0x04, 0xa3, 0x00, 0x00, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x56, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00,
-    0xb6, 0xfe, 0xb2, 0x04, 0x34, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0xaa, 0x04, 0xd2,
-    0x00, 0x0a, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x0a, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x87, 0xfe,
-    0xa8, 0x04, 0x45, 0x04, 0x4e, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x00, 0x07, 0x00, 0xaa, 0x04, 0xe3, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0xb6, 0x00, 0x00, 0x04, 0x34, 0x07, 0xc6, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00,
-    0xa8, 0x04, 0xbe, 0x01, 0x52, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x52, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff,
-    0x00, 0x87, 0xff, 0xec, 0x04, 0x45, 0x06, 0x85, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa8, 0x04,
-    0xbf, 0x00, 0x11, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x11, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb6,
-    0x00, 0x00, 0x04, 0x34, 0x07, 0x52, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0x89, 0x01,
-    0x61, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x61, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x87, 0xff, 0xec,
-    0x04, 0x45, 0x06, 0x11, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0x8a, 0x00, 0x20, 0x00,
-    0x08, 0xb1, 0x02, 0x01, 0xb0, 0x20, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb6, 0x00, 0x00, 0x04, 0xdf,
-    0x07, 0xee, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x01, 0x9a, 0xff, 0xeb, 0x01, 0x59, 0x00, 0x09, 0xb1,
-    0x01, 0x02, 0xb8, 0x01, 0x59, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x87, 0xff, 0xec, 0x04, 0xe0, 0x06, 0xad,
-    0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06, 0x01, 0x9a, 0xec, 0x18, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x18,
-    0xb0, 0x33, 0x2b, 0xff, 0xff, 0xff, 0xf2, 0x00, 0x00, 0x04, 0x34, 0x07, 0xdd, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00,
-    0x01, 0x07, 0x01, 0x99, 0xff, 0xe2, 0x01, 0x48, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x48, 0xb0, 0x33, 0x2b,
-    0x00, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xec, 0x04, 0x45, 0x06, 0x9c, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06,
-    0x01, 0x99, 0xe3, 0x07, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x07, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xb6, 0x00,
-    0x00, 0x04, 0xb2, 0x08, 0x04, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x01, 0x98, 0xff, 0xf8, 0x01, 0x35,
-    0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0x01, 0x35, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x87, 0xff, 0xec, 0x04,
-    0xb3, 0x06, 0xc4, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06, 0x01, 0x98, 0xf9, 0xf5, 0x00, 0x09, 0xb1, 0x02,
-    0x02, 0xb8, 0xff, 0xf5, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb6, 0x00, 0x00, 0x04, 0x34, 0x08,
-    0x2f, 0x02, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x01, 0x97, 0xff, 0xe9, 0x01, 0x36, 0x00, 0x09, 0xb1, 0x01,
-    0x02, 0xb8, 0x01, 0x36, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x87, 0xff, 0xec, 0x04, 0x45, 0x06, 0xef, 0x02,
-    0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06, 0x01, 0x97, 0xea, 0xf6, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0xff, 0xf6,
-    0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb6, 0xfe, 0xb2, 0x04, 0x34, 0x07, 0x48, 0x02, 0x26, 0x00,
-    0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x9c, 0x00, 0x7d, 0x01, 0x5b, 0x01, 0x07, 0x00, 0xaa, 0x04, 0xd2, 0x00, 0x0a,
-    0x00, 0x11, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5b, 0xb0, 0x33, 0x2b, 0xb1, 0x02, 0x01, 0xb0, 0x0a, 0xb0, 0x33, 0x2b,
-    0x00, 0xff, 0xff, 0x00, 0x87, 0xfe, 0xa8, 0x04, 0x45, 0x06, 0x07, 0x02, 0x26, 0x00, 0x47, 0x00, 0x00, 0x00, 0x26,
-    0x00, 0x9c, 0x7e, 0x1a, 0x01, 0x07, 0x00, 0xaa, 0x04, 0xe3, 0x00, 0x00, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x1a,
-    0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xae, 0x00, 0x00, 0x04, 0x1e, 0x07, 0xc6, 0x02, 0x26, 0x00, 0x2b, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa8, 0x04, 0x8a, 0x01, 0x52, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x52, 0xb0, 0x33, 0x2b,
-    0x00, 0xff, 0xff, 0x00, 0xcb, 0x00, 0x00, 0x04, 0x55, 0x06, 0x70, 0x02, 0x26, 0x00, 0x8a, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xa8, 0x04, 0xed, 0xff, 0xfc, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xfc, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0x00, 0xae, 0xfe, 0xb2, 0x04, 0x1e, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xaa,
-    0x04, 0x9e, 0x00, 0x0a, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x0a, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0xcb, 0xfe, 0xb2, 0x04, 0x55, 0x05, 0xc3, 0x02, 0x26, 0x00, 0x4b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xaa, 0x05, 0x06,
-    0x00, 0x0a, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x0a, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x6a, 0xfe,
-    0xa0, 0x04, 0x61, 0x05, 0xc4, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00, 0xaa, 0x04, 0xdf, 0xff, 0xf8,
-    0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0xff, 0xf8, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x7a, 0xfe, 0x9f, 0x04,
-    0x52, 0x04, 0x4e, 0x02, 0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x07, 0x00, 0xaa, 0x04, 0xcd, 0xff, 0xf7, 0x00, 0x09,
-    0xb1, 0x02, 0x01, 0xb8, 0xff, 0xf7, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xec, 0x04, 0x61, 0x07,
-    0xdb, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa8, 0x04, 0xcc, 0x01, 0x67, 0x00, 0x09, 0xb1, 0x02,
-    0x01, 0xb8, 0x01, 0x67, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xec, 0x04, 0x52, 0x06, 0x84, 0x02,
-    0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa8, 0x04, 0xb9, 0x00, 0x10, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0,
-    0x10, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xec, 0x04, 0xed, 0x08, 0x03, 0x02, 0x26, 0x00,
-    0x31, 0x00, 0x00, 0x01, 0x07, 0x01, 0x9a, 0xff, 0xf9, 0x01, 0x6e, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x6e,
-    0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xec, 0x04, 0xda, 0x06, 0xac, 0x02, 0x26, 0x00, 0x51, 0x00,
-    0x00, 0x01, 0x06, 0x01, 0x9a, 0xe6, 0x17, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x17, 0xb0, 0x33, 0x2b, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xec, 0x04, 0x61, 0x07, 0xf2, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x01, 0x99, 0xff,
-    0xf0, 0x01, 0x5d, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x5d, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0xff, 0xed,
-    0xff, 0xec, 0x04, 0x52, 0x06, 0x9b, 0x02, 0x26, 0x00, 0x51, 0x00, 0x00, 0x01, 0x06, 0x01, 0x99, 0xdd, 0x06, 0x00,
-    0x08, 0xb1, 0x02, 0x02, 0xb0, 0x06, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xec, 0x04, 0xbf, 0x08, 0x19,
-    0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x01, 0x98, 0x00, 0x05, 0x01, 0x4a, 0x00, 0x09, 0xb1, 0x02, 0x02,
-    0xb8, 0x01, 0x4a, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xec, 0x04, 0xad, 0x06, 0xc3, 0x02, 0x26,
-    0x00, 0x51, 0x00, 0x00, 0x01, 0x06, 0x01, 0x98, 0xf3, 0xf4, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0xff, 0xf4, 0xb0,
-    0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xec, 0x04, 0x61, 0x08, 0x44, 0x02, 0x26, 0x00, 0x31,
-    0x00, 0x00, 0x01, 0x07, 0x01, 0x97, 0xff, 0xf7, 0x01, 0x4b, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0x01, 0x4b, 0xb0,
-    0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xec, 0x04, 0x52, 0x06, 0xee, 0x02, 0x26, 0x00, 0x51, 0x00, 0x00,
-    0x01, 0x06, 0x01, 0x97, 0xe4, 0xf5, 0x00, 0x09, 0xb1, 0x02, 0x02, 0xb8, 0xff, 0xf5, 0xb0, 0x33, 0x2b, 0x00, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0x6a, 0xfe, 0xa0, 0x04, 0x61, 0x07, 0x5d, 0x02, 0x26, 0x00, 0x31, 0x00, 0x00, 0x00, 0x27,
-    0x00, 0x9c, 0x00, 0x8b, 0x01, 0x70, 0x01, 0x07, 0x00, 0xaa, 0x04, 0xdf, 0xff, 0xf8, 0x00, 0x12, 0xb1, 0x02, 0x01,
-    0xb8, 0x01, 0x70, 0xb0, 0x33, 0x2b, 0xb1, 0x03, 0x01, 0xb8, 0xff, 0xf8, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x7a,
-    0xfe, 0x9f, 0x04, 0x52, 0x06, 0x06, 0x02, 0x26, 0x00, 0x51, 0x00, 0x00, 0x00, 0x26, 0x00, 0x9c, 0x78, 0x19, 0x01,
-    0x07, 0x00, 0xaa, 0x04, 0xcd, 0xff, 0xf7, 0x00, 0x11, 0xb1, 0x02, 0x01, 0xb0, 0x19, 0xb0, 0x33, 0x2b, 0xb1, 0x03,
-    0x01, 0xb8, 0xff, 0xf7, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x63, 0xff, 0xec, 0x04, 0xc6, 0x07,
-    0x20, 0x02, 0x26, 0x00, 0x96, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x84, 0x01, 0x57, 0x00, 0x09, 0xb1, 0x02,
-    0x01, 0xb8, 0x01, 0x57, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x77, 0xff, 0xec, 0x04, 0xae, 0x05, 0xde, 0x02,
-    0x26, 0x00, 0x97, 0x00, 0x00, 0x01, 0x06, 0x00, 0x73, 0x7c, 0x15, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x15, 0xb0,
-    0x33, 0x2b, 0xff, 0xff, 0x00, 0x63, 0xff, 0xec, 0x04, 0xc6, 0x07, 0x23, 0x02, 0x26, 0x00, 0x96, 0x00, 0x00, 0x01,
-    0x07, 0x00, 0x42, 0xff, 0x98, 0x01, 0x5a, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x5a, 0xb0, 0x33, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x77, 0xff, 0xec, 0x04, 0xae, 0x05, 0xe1, 0x02, 0x26, 0x00, 0x97, 0x00, 0x00, 0x01, 0x06, 0x00,
-    0x42, 0x90, 0x18, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x18, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x63, 0xff, 0xec,
-    0x04, 0xc6, 0x07, 0xc6, 0x02, 0x26, 0x00, 0x96, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa8, 0x04, 0xc7, 0x01, 0x52, 0x00,
-    0x09, 0xb1, 0x02, 0x01, 0xb8, 0x01, 0x52, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x77, 0xff, 0xec, 0x04, 0xae,
-    0x06, 0x84, 0x02, 0x26, 0x00, 0x97, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa8, 0x04, 0xbf, 0x00, 0x10, 0x00, 0x08, 0xb1,
-    0x02, 0x01, 0xb0, 0x10, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x63, 0xff, 0xec, 0x04, 0xc6, 0x07, 0x52,
-    0x02, 0x26, 0x00, 0x96, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0x92, 0x01, 0x61, 0x00, 0x09, 0xb1, 0x02, 0x01,
-    0xb8, 0x01, 0x61, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x77, 0xff, 0xec, 0x04, 0xae, 0x06, 0x10, 0x02, 0x26,
-    0x00, 0x97, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0x8a, 0x00, 0x1f, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x1f,
-    0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x63, 0xfe, 0xa8, 0x04, 0xc6, 0x05, 0xfa, 0x02, 0x26, 0x00, 0x96,
-    0x00, 0x00, 0x00, 0x07, 0x00, 0xaa, 0x04, 0xd3, 0x00, 0x00, 0xff, 0xff, 0x00, 0x77, 0xfe, 0x9f, 0x04, 0xae, 0x04,
-    0xaa, 0x02, 0x26, 0x00, 0x97, 0x00, 0x00, 0x01, 0x07, 0x00, 0xaa, 0x04, 0xcb, 0xff, 0xf7, 0x00, 0x09, 0xb1, 0x02,
-    0x01, 0xb8, 0xff, 0xf7, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8b, 0xfe, 0xa8, 0x04, 0x42, 0x05, 0xb0, 0x02,
-    0x26, 0x00, 0x37, 0x00, 0x00, 0x00, 0x07, 0x00, 0xaa, 0x04, 0xc8, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb4, 0xfe, 0xa8,
-    0x04, 0x1f, 0x04, 0x3a, 0x02, 0x26, 0x00, 0x57, 0x00, 0x00, 0x00, 0x07, 0x00, 0xaa, 0x04, 0x91, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x8b, 0xff, 0xec, 0x04, 0x42, 0x07, 0xba, 0x02, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa8,
-    0x04, 0xe6, 0x01, 0x46, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x46, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00,
-    0xb4, 0xff, 0xec, 0x04, 0x1f, 0x06, 0x71, 0x02, 0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa8, 0x04, 0xb8,
-    0xff, 0xfd, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xfd, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8b, 0xff,
-    0xec, 0x05, 0x83, 0x07, 0x20, 0x02, 0x26, 0x00, 0x98, 0x00, 0x00, 0x01, 0x07, 0x00, 0x73, 0x00, 0x74, 0x01, 0x57,
-    0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x57, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xec, 0x05,
-    0x3f, 0x05, 0xc9, 0x02, 0x26, 0x00, 0x99, 0x00, 0x00, 0x00, 0x06, 0x00, 0x73, 0x76, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x8b, 0xff, 0xec, 0x05, 0x83, 0x07, 0x23, 0x02, 0x26, 0x00, 0x98, 0x00, 0x00, 0x01, 0x07, 0x00, 0x42, 0xff,
-    0x88, 0x01, 0x5a, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x5a, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xb4,
-    0xff, 0xec, 0x05, 0x3f, 0x05, 0xcc, 0x02, 0x26, 0x00, 0x99, 0x00, 0x00, 0x01, 0x06, 0x00, 0x42, 0x8a, 0x03, 0x00,
-    0x08, 0xb1, 0x01, 0x01, 0xb0, 0x03, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0x8b, 0xff, 0xec, 0x05, 0x83, 0x07, 0xc6,
-    0x02, 0x26, 0x00, 0x98, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa8, 0x04, 0xb7, 0x01, 0x52, 0x00, 0x09, 0xb1, 0x01, 0x01,
-    0xb8, 0x01, 0x52, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xec, 0x05, 0x3f, 0x06, 0x70, 0x02, 0x26,
-    0x00, 0x99, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa8, 0x04, 0xb9, 0xff, 0xfc, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff,
-    0xfc, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x8b, 0xff, 0xec, 0x05, 0x83, 0x07, 0x52, 0x02, 0x26, 0x00, 0x98,
-    0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0x82, 0x01, 0x61, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x61, 0xb0,
-    0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xb4, 0xff, 0xec, 0x05, 0x3f, 0x05, 0xfb, 0x02, 0x26, 0x00, 0x99, 0x00, 0x00,
-    0x01, 0x07, 0x00, 0xa2, 0x00, 0x84, 0x00, 0x0a, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x0a, 0xb0, 0x33, 0x2b, 0x00,
-    0x00, 0xff, 0xff, 0x00, 0x8b, 0xfe, 0xa0, 0x05, 0x83, 0x05, 0xe8, 0x02, 0x26, 0x00, 0x98, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0xaa, 0x04, 0xcd, 0xff, 0xf8, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf8, 0xb0, 0x33, 0x2b, 0x00, 0xff,
-    0xff, 0x00, 0xb4, 0xfe, 0xa8, 0x05, 0x3f, 0x04, 0x93, 0x02, 0x26, 0x00, 0x99, 0x00, 0x00, 0x00, 0x07, 0x00, 0xaa,
-    0x04, 0x90, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3d, 0xfe, 0xb2, 0x04, 0x79, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x3b, 0x00,
-    0x00, 0x01, 0x07, 0x00, 0xaa, 0x04, 0xc3, 0x00, 0x0a, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x0a, 0xb0, 0x33, 0x2b,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x44, 0xfe, 0x0b, 0x04, 0x85, 0x04, 0x3a, 0x02, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01,
-    0x07, 0x00, 0xaa, 0x05, 0xa7, 0xff, 0x63, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0x63, 0xb0, 0x33, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x3d, 0x00, 0x00, 0x04, 0x79, 0x07, 0xc5, 0x02, 0x26, 0x00, 0x3b, 0x00, 0x00, 0x01, 0x07, 0x00,
-    0xa8, 0x04, 0xb4, 0x01, 0x51, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x51, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff,
-    0x00, 0x44, 0xfe, 0x4b, 0x04, 0x85, 0x06, 0x71, 0x02, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa8, 0x04,
-    0xcc, 0xff, 0xfd, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xfd, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x3d,
-    0x00, 0x00, 0x04, 0x79, 0x07, 0x51, 0x02, 0x26, 0x00, 0x3b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0x7f, 0x01,
-    0x60, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x60, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x44, 0xfe, 0x4b,
-    0x04, 0x85, 0x05, 0xfc, 0x02, 0x26, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x07, 0x00, 0xa2, 0x00, 0x97, 0x00, 0x0b, 0x00,
-    0x08, 0xb1, 0x01, 0x01, 0xb0, 0x0b, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x8b, 0xff, 0xec, 0x04, 0xe1,
-    0x06, 0x00, 0x00, 0x1d, 0x00, 0x31, 0x00, 0xad, 0x40, 0x0f, 0x15, 0x01, 0x09, 0x03, 0x29, 0x28, 0x02, 0x08, 0x09,
-    0x04, 0x01, 0x01, 0x08, 0x03, 0x4a, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x25, 0x07, 0x01, 0x05, 0x04, 0x01, 0x00,
-    0x03, 0x05, 0x00, 0x61, 0x00, 0x06, 0x06, 0x3e, 0x4b, 0x00, 0x09, 0x09, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x47, 0x4b,
-    0x00, 0x08, 0x08, 0x01, 0x5b, 0x02, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x1b, 0x4b, 0xb0, 0x21, 0x50, 0x58, 0x40,
-    0x29, 0x07, 0x01, 0x05, 0x04, 0x01, 0x00, 0x03, 0x05, 0x00, 0x61, 0x00, 0x06, 0x06, 0x3e, 0x4b, 0x00, 0x09, 0x09,
-    0x03, 0x5b, 0x00, 0x03, 0x03, 0x47, 0x4b, 0x00, 0x01, 0x01, 0x3d, 0x4b, 0x00, 0x08, 0x08, 0x02, 0x5b, 0x00, 0x02,
-    0x02, 0x45, 0x02, 0x4c, 0x1b, 0x40, 0x29, 0x07, 0x01, 0x05, 0x04, 0x01, 0x00, 0x03, 0x05, 0x00, 0x61, 0x00, 0x09,
-    0x09, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x47, 0x4b, 0x00, 0x06, 0x06, 0x01, 0x59, 0x00, 0x01, 0x01, 0x3d, 0x4b, 0x00,
-    0x08, 0x08, 0x02, 0x5b, 0x00, 0x02, 0x02, 0x45, 0x02, 0x4c, 0x59, 0x59, 0x40, 0x0e, 0x2d, 0x2b, 0x25, 0x11, 0x11,
-    0x11, 0x13, 0x29, 0x23, 0x11, 0x10, 0x0a, 0x08, 0x1d, 0x2b, 0x01, 0x23, 0x11, 0x23, 0x27, 0x06, 0x06, 0x23, 0x22,
-    0x2e, 0x02, 0x35, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x11, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33,
-    0x01, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x11, 0x26, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x04, 0xe1,
-    0xc5, 0xaa, 0x08, 0x36, 0x96, 0x64, 0x62, 0x9f, 0x70, 0x3e, 0x3d, 0x71, 0xa0, 0x63, 0x61, 0x91, 0x35, 0xff, 0xff,
-    0xb9, 0xc5, 0xfc, 0x63, 0x22, 0x47, 0x6e, 0x4d, 0x2f, 0x4c, 0x3e, 0x30, 0x12, 0x24, 0x7a, 0x5b, 0x4e, 0x6f, 0x47,
-    0x22, 0x04, 0xd2, 0xfb, 0x2e, 0x72, 0x42, 0x44, 0x54, 0x94, 0xc9, 0x74, 0x15, 0x79, 0xcb, 0x92, 0x52, 0x41, 0x3e,
-    0x01, 0x03, 0x97, 0x97, 0x97, 0xfc, 0xa8, 0x4f, 0x8e, 0x6c, 0x3f, 0x16, 0x29, 0x39, 0x23, 0x01, 0xf6, 0x42, 0x55,
-    0x40, 0x6d, 0x8f, 0x4f, 0xff, 0xff, 0x00, 0x8b, 0xfe, 0xed, 0x04, 0xe1, 0x06, 0x00, 0x00, 0x26, 0x00, 0x46, 0x00,
-    0x00, 0x00, 0x27, 0x01, 0xca, 0x01, 0x2f, 0x02, 0x47, 0x01, 0x06, 0x00, 0x41, 0x30, 0x84, 0x00, 0x12, 0xb1, 0x02,
-    0x01, 0xb8, 0x02, 0x47, 0xb0, 0x33, 0x2b, 0xb1, 0x03, 0x01, 0xb8, 0xff, 0x84, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0xa9, 0xfe, 0xa0, 0x04, 0xdf, 0x05, 0xb0, 0x02, 0x26, 0x01, 0xda, 0x00, 0x00, 0x01, 0x07, 0x01, 0xce,
-    0x02, 0x20, 0x00, 0x07, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x07, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0xa4, 0xfe, 0x99, 0x04, 0xba, 0x04, 0x3a, 0x02, 0x26, 0x00, 0xed, 0x00, 0x00, 0x00, 0x07, 0x01, 0xce, 0x01, 0xfb,
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x8d, 0xfe, 0x99, 0x04, 0xa8, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x2a, 0x00, 0x00, 0x00,
-    0x07, 0x01, 0xce, 0x01, 0xe9, 0x00, 0x00, 0xff, 0xff, 0x00, 0xa5, 0xfe, 0x99, 0x04, 0xb0, 0x04, 0x3a, 0x02, 0x26,
-    0x00, 0xf0, 0x00, 0x00, 0x00, 0x07, 0x01, 0xce, 0x01, 0xf1, 0x00, 0x00, 0xff, 0xff, 0x00, 0x4c, 0xfe, 0x99, 0x04,
-    0x84, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x36, 0x00, 0x00, 0x00, 0x07, 0x01, 0xce, 0x00, 0x8c, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x68, 0xfe, 0x99, 0x04, 0x7b, 0x04, 0x3a, 0x02, 0x26, 0x00, 0xf2, 0x00, 0x00, 0x00, 0x07, 0x01, 0xce, 0x00,
-    0x95, 0x00, 0x00, 0xff, 0xff, 0x00, 0x57, 0xfe, 0x99, 0x04, 0xe7, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x3a, 0x00, 0x00,
-    0x00, 0x07, 0x01, 0xce, 0x02, 0x28, 0x00, 0x00, 0xff, 0xff, 0x00, 0x6e, 0xfe, 0x99, 0x04, 0x76, 0x04, 0x3a, 0x02,
-    0x26, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x07, 0x01, 0xce, 0x01, 0xb7, 0x00, 0x00, 0xff, 0xff, 0x00, 0xab, 0xfe, 0x99,
-    0x04, 0xb0, 0x05, 0xb0, 0x02, 0x26, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x07, 0x01, 0xce, 0x01, 0xf1, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x8d, 0xfe, 0x99, 0x04, 0xb0, 0x04, 0x3a, 0x02, 0x26, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x07, 0x01, 0xce,
-    0x01, 0xf1, 0x00, 0x00, 0xff, 0xff, 0x00, 0xab, 0xfe, 0x99, 0x04, 0x27, 0x05, 0xb0, 0x02, 0x26, 0x00, 0xdd, 0x00,
-    0x00, 0x00, 0x07, 0x01, 0xce, 0x00, 0xde, 0x00, 0x00, 0xff, 0xff, 0x00, 0x8d, 0xfe, 0x99, 0x04, 0x27, 0x04, 0x3a,
-    0x02, 0x26, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x07, 0x01, 0xce, 0x00, 0xdd, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb5, 0xfe,
-    0x99, 0x04, 0x30, 0x05, 0xb0, 0x02, 0x26, 0x00, 0xae, 0x00, 0x00, 0x00, 0x07, 0x01, 0xce, 0xff, 0x3a, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0xb7, 0xfe, 0x99, 0x04, 0x2a, 0x04, 0x3a, 0x02, 0x26, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x07, 0x01,
-    0xce, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1d, 0xfe, 0x99, 0x04, 0xfb, 0x05, 0xb0, 0x02, 0x26, 0x00, 0xd7,
-    0x00, 0x00, 0x00, 0x07, 0x01, 0xce, 0x02, 0x3c, 0x00, 0x00, 0xff, 0xff, 0x00, 0x11, 0xfe, 0x99, 0x04, 0xef, 0x04,
-    0x3a, 0x02, 0x26, 0x00, 0xea, 0x00, 0x00, 0x00, 0x07, 0x01, 0xce, 0x02, 0x30, 0x00, 0x00, 0xff, 0xff, 0x00, 0x26,
-    0xfe, 0x3b, 0x04, 0x89, 0x05, 0xc3, 0x02, 0x26, 0x01, 0x3d, 0x00, 0x00, 0x01, 0x07, 0x01, 0xce, 0x00, 0xbf, 0xff,
-    0xa2, 0x00, 0x09, 0xb1, 0x02, 0x01, 0xb8, 0xff, 0xa2, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x26, 0xfe, 0x3b,
-    0x04, 0x85, 0x04, 0x4e, 0x02, 0x26, 0x01, 0x3e, 0x00, 0x00, 0x01, 0x07, 0x01, 0xce, 0x00, 0x9b, 0xff, 0xa2, 0x00,
-    0x09, 0xb1, 0x02, 0x01, 0xb8, 0xff, 0xa2, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xae, 0x00, 0x00, 0x04, 0x2c,
-    0x06, 0x00, 0x02, 0x06, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x12, 0x00, 0x00, 0x04, 0x40, 0x04, 0x3a, 0x00,
-    0x16, 0x00, 0x23, 0x00, 0x37, 0x40, 0x34, 0x06, 0x01, 0x04, 0x03, 0x01, 0x00, 0x01, 0x04, 0x00, 0x61, 0x00, 0x01,
-    0x09, 0x01, 0x08, 0x07, 0x01, 0x08, 0x63, 0x00, 0x05, 0x05, 0x18, 0x4b, 0x00, 0x07, 0x07, 0x02, 0x5c, 0x00, 0x02,
-    0x02, 0x17, 0x02, 0x4c, 0x17, 0x17, 0x17, 0x23, 0x17, 0x22, 0x22, 0x11, 0x11, 0x11, 0x11, 0x28, 0x21, 0x10, 0x0a,
-    0x06, 0x1c, 0x2b, 0x01, 0x21, 0x15, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x23, 0x35,
-    0x33, 0x35, 0x33, 0x15, 0x21, 0x01, 0x11, 0x21, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x02, 0x8f, 0xfe,
-    0xcf, 0x01, 0x4b, 0x61, 0x97, 0x68, 0x37, 0x36, 0x68, 0x98, 0x61, 0xfd, 0xfc, 0x93, 0x93, 0xb9, 0x01, 0x31, 0xfe,
-    0xcf, 0x01, 0x4b, 0x3a, 0x54, 0x36, 0x19, 0x1a, 0x36, 0x53, 0x3a, 0x03, 0x23, 0x83, 0x31, 0x58, 0x7a, 0x49, 0x48,
-    0x7d, 0x5b, 0x34, 0x03, 0x23, 0x97, 0x80, 0x80, 0xfe, 0x4f, 0xfe, 0x8e, 0x1e, 0x32, 0x42, 0x24, 0x23, 0x43, 0x35,
-    0x21, 0x00, 0x02, 0xff, 0xd4, 0x00, 0x00, 0x04, 0x51, 0x05, 0xb0, 0x00, 0x16, 0x00, 0x23, 0x00, 0x37, 0x40, 0x34,
-    0x06, 0x01, 0x04, 0x03, 0x01, 0x00, 0x01, 0x04, 0x00, 0x61, 0x00, 0x01, 0x09, 0x01, 0x08, 0x07, 0x01, 0x08, 0x63,
-    0x00, 0x05, 0x05, 0x16, 0x4b, 0x00, 0x07, 0x07, 0x02, 0x5c, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x17, 0x17, 0x17,
-    0x23, 0x17, 0x22, 0x22, 0x11, 0x11, 0x11, 0x11, 0x28, 0x21, 0x10, 0x0a, 0x06, 0x1c, 0x2b, 0x01, 0x23, 0x15, 0x21,
-    0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x11, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x03, 0x11,
-    0x21, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x02, 0x51, 0xf0, 0x01, 0x0a, 0x74, 0xb5, 0x7c, 0x41, 0x41,
-    0x7c, 0xb5, 0x74, 0xfe, 0x3d, 0xd4, 0xd4, 0xb9, 0xf0, 0xf0, 0x01, 0x0a, 0x4e, 0x71, 0x4a, 0x23, 0x23, 0x4a, 0x71,
-    0x4e, 0x04, 0x50, 0xf7, 0x3c, 0x6f, 0x9c, 0x61, 0x60, 0xa0, 0x72, 0x3f, 0x04, 0x50, 0x97, 0xc9, 0xc9, 0xfd, 0xdb,
-    0xfd, 0xd5, 0x2e, 0x4e, 0x67, 0x39, 0x38, 0x63, 0x49, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xd4, 0x00, 0x00,
-    0x04, 0x51, 0x05, 0xb0, 0x00, 0x16, 0x00, 0x23, 0x00, 0x37, 0x40, 0x34, 0x06, 0x01, 0x04, 0x03, 0x01, 0x00, 0x01,
-    0x04, 0x00, 0x61, 0x00, 0x01, 0x09, 0x01, 0x08, 0x07, 0x01, 0x08, 0x63, 0x00, 0x05, 0x05, 0x16, 0x4b, 0x00, 0x07,
-    0x07, 0x02, 0x5c, 0x00, 0x02, 0x02, 0x17, 0x02, 0x4c, 0x17, 0x17, 0x17, 0x23, 0x17, 0x22, 0x22, 0x11, 0x11, 0x11,
-    0x11, 0x28, 0x21, 0x10, 0x0a, 0x06, 0x1c, 0x2b, 0x01, 0x23, 0x15, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02,
-    0x23, 0x21, 0x11, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x03, 0x11, 0x21, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e,
-    0x02, 0x23, 0x02, 0x51, 0xf0, 0x01, 0x0a, 0x74, 0xb5, 0x7c, 0x41, 0x41, 0x7c, 0xb5, 0x74, 0xfe, 0x3d, 0xd4, 0xd4,
-    0xb9, 0xf0, 0xf0, 0x01, 0x0a, 0x4e, 0x71, 0x4a, 0x23, 0x23, 0x4a, 0x71, 0x4e, 0x04, 0x50, 0xf7, 0x3c, 0x6f, 0x9c,
-    0x61, 0x60, 0xa0, 0x72, 0x3f, 0x04, 0x50, 0x97, 0xc9, 0xc9, 0xfd, 0xdb, 0xfd, 0xd5, 0x2e, 0x4e, 0x67, 0x39, 0x38,
-    0x63, 0x49, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xfd, 0x00, 0x00, 0x04, 0x30, 0x05, 0xb0, 0x00, 0x0d, 0x00,
-    0x27, 0x40, 0x24, 0x06, 0x01, 0x03, 0x02, 0x01, 0x00, 0x01, 0x03, 0x00, 0x61, 0x00, 0x05, 0x05, 0x04, 0x59, 0x00,
-    0x04, 0x04, 0x16, 0x4b, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x07, 0x06,
-    0x1b, 0x2b, 0x01, 0x21, 0x11, 0x23, 0x11, 0x23, 0x35, 0x33, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x02, 0x7a, 0xfe,
-    0xf5, 0xba, 0xb8, 0xb8, 0x03, 0x7b, 0xfd, 0x3f, 0x01, 0x0b, 0x02, 0xac, 0xfd, 0x54, 0x02, 0xac, 0x97, 0x02, 0x6d,
-    0x98, 0xfe, 0x2b, 0x00, 0x01, 0xff, 0xfb, 0x00, 0x00, 0x04, 0x2a, 0x04, 0x3a, 0x00, 0x0d, 0x00, 0x27, 0x40, 0x24,
-    0x06, 0x01, 0x03, 0x02, 0x01, 0x00, 0x01, 0x03, 0x00, 0x61, 0x00, 0x05, 0x05, 0x04, 0x59, 0x00, 0x04, 0x04, 0x18,
-    0x4b, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x01,
-    0x21, 0x11, 0x23, 0x11, 0x23, 0x35, 0x33, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x02, 0x78, 0xfe, 0xf9, 0xba, 0xbc,
-    0xbc, 0x03, 0x73, 0xfd, 0x47, 0x01, 0x07, 0x01, 0xdf, 0xfe, 0x21, 0x01, 0xdf, 0x97, 0x01, 0xc4, 0x99, 0xfe, 0xd5,
-    0x00, 0x01, 0x00, 0x09, 0x00, 0x00, 0x04, 0xca, 0x05, 0xb0, 0x00, 0x14, 0x00, 0x36, 0x40, 0x33, 0x12, 0x01, 0x00,
-    0x07, 0x01, 0x4a, 0x05, 0x01, 0x03, 0x06, 0x01, 0x02, 0x07, 0x03, 0x02, 0x61, 0x00, 0x07, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x61, 0x08, 0x01, 0x04, 0x04, 0x16, 0x4b, 0x09, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x14, 0x13, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0a, 0x06, 0x1d, 0x2b, 0x01, 0x23, 0x11, 0x23, 0x11, 0x23, 0x35, 0x33,
-    0x35, 0x33, 0x15, 0x21, 0x15, 0x21, 0x11, 0x33, 0x01, 0x33, 0x01, 0x01, 0x23, 0x02, 0x21, 0xab, 0xb9, 0xb4, 0xb4,
-    0xb9, 0x01, 0x10, 0xfe, 0xf0, 0x9c, 0x01, 0xbb, 0xd4, 0xfe, 0x11, 0x02, 0x18, 0xe3, 0x02, 0x93, 0xfd, 0x6d, 0x04,
-    0x69, 0x97, 0xb0, 0xb0, 0x97, 0xfe, 0xc1, 0x02, 0x86, 0xfd, 0x3f, 0xfd, 0x11, 0x00, 0x00, 0x01, 0xff, 0xf3, 0x00,
-    0x00, 0x04, 0x7e, 0x06, 0x00, 0x00, 0x14, 0x00, 0x37, 0x40, 0x34, 0x12, 0x0e, 0x01, 0x03, 0x00, 0x06, 0x01, 0x4a,
-    0x04, 0x01, 0x02, 0x05, 0x01, 0x01, 0x06, 0x02, 0x01, 0x61, 0x00, 0x03, 0x03, 0x00, 0x59, 0x07, 0x01, 0x00, 0x00,
-    0x17, 0x4b, 0x00, 0x06, 0x06, 0x18, 0x4b, 0x07, 0x01, 0x00, 0x00, 0x17, 0x00, 0x4c, 0x12, 0x13, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x12, 0x08, 0x06, 0x1c, 0x2b, 0x01, 0x07, 0x11, 0x23, 0x11, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33,
-    0x15, 0x23, 0x11, 0x37, 0x01, 0x33, 0x01, 0x01, 0x23, 0x02, 0x06, 0x88, 0xba, 0xd1, 0xd1, 0xba, 0xf2, 0xf2, 0x79,
-    0x01, 0x63, 0xe1, 0xfe, 0x4a, 0x01, 0xf9, 0xeb, 0x01, 0xf9, 0x83, 0xfe, 0x8a, 0x04, 0xc1, 0x97, 0xa8, 0xa8, 0x97,
-    0xfd, 0x93, 0x82, 0x01, 0x64, 0xfe, 0x3d, 0xfd, 0x89, 0xff, 0xff, 0x00, 0xa2, 0xfe, 0x8a, 0x04, 0xe3, 0x07, 0x3e,
-    0x02, 0x26, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x27, 0x00, 0x9e, 0xff, 0xf9, 0x01, 0x8c, 0x01, 0x07, 0x00, 0x0e, 0x02,
-    0x60, 0xff, 0xda, 0x00, 0x12, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x8c, 0xb0, 0x33, 0x2b, 0xb1, 0x02, 0x01, 0xb8, 0xff,
-    0xda, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0x00, 0xa5, 0xfe, 0x8a, 0x04, 0xe0, 0x05, 0xf3, 0x02, 0x26, 0x00, 0xec, 0x00,
-    0x00, 0x00, 0x26, 0x00, 0x9e, 0xf4, 0x41, 0x01, 0x07, 0x00, 0x0e, 0x02, 0x5d, 0xff, 0xda, 0x00, 0x11, 0xb1, 0x01,
-    0x01, 0xb0, 0x41, 0xb0, 0x33, 0x2b, 0xb1, 0x02, 0x01, 0xb8, 0xff, 0xda, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0x00, 0x8d, 0xfe, 0x8a, 0x04, 0xd8, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x2a, 0x00, 0x00, 0x01, 0x07, 0x00, 0x0e,
-    0x02, 0x55, 0xff, 0xda, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xda, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00,
-    0xa5, 0xfe, 0x8a, 0x04, 0xe0, 0x04, 0x3a, 0x02, 0x26, 0x00, 0xf0, 0x00, 0x00, 0x01, 0x07, 0x00, 0x0e, 0x02, 0x5d,
-    0xff, 0xda, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xda, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x94, 0xfe,
-    0x8a, 0x05, 0x02, 0x05, 0xb0, 0x02, 0x26, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x07, 0x00, 0x0e, 0x02, 0x7f, 0xff, 0xda,
-    0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xda, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x89, 0xfe, 0x8a, 0x04,
-    0xe4, 0x04, 0x3a, 0x02, 0x26, 0x00, 0xef, 0x00, 0x00, 0x01, 0x07, 0x00, 0x0e, 0x02, 0x61, 0xff, 0xda, 0x00, 0x09,
-    0xb1, 0x01, 0x01, 0xb8, 0xff, 0xda, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x2f, 0xfe, 0x8a, 0x04, 0xe4, 0x05,
-    0xb0, 0x02, 0x26, 0x00, 0xda, 0x00, 0x00, 0x01, 0x07, 0x00, 0x0e, 0x02, 0x61, 0xff, 0xda, 0x00, 0x09, 0xb1, 0x01,
-    0x01, 0xb8, 0xff, 0xda, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x37, 0xfe, 0x8a, 0x04, 0xdf, 0x04, 0x3a, 0x02,
-    0x26, 0x00, 0xee, 0x00, 0x00, 0x01, 0x07, 0x00, 0x0e, 0x02, 0x5c, 0xff, 0xda, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8,
-    0xff, 0xda, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x01, 0x00, 0x3d, 0x00, 0x00, 0x04, 0x79, 0x05, 0xb0, 0x00, 0x0e, 0x00,
-    0x29, 0x40, 0x26, 0x0a, 0x01, 0x03, 0x04, 0x01, 0x4a, 0x06, 0x01, 0x03, 0x02, 0x01, 0x00, 0x01, 0x03, 0x00, 0x61,
-    0x05, 0x01, 0x04, 0x04, 0x16, 0x4b, 0x00, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x07, 0x06, 0x1b, 0x2b, 0x01, 0x23, 0x03, 0x23, 0x03, 0x23, 0x35, 0x33, 0x01, 0x33, 0x01, 0x01, 0x33, 0x01, 0x33,
-    0x03, 0x9b, 0xe7, 0x03, 0xac, 0x03, 0xe4, 0x9f, 0xfe, 0x80, 0xd3, 0x01, 0x4b, 0x01, 0x4c, 0xd2, 0xfe, 0x7f, 0xa3,
-    0x02, 0x12, 0xfd, 0xee, 0x02, 0x12, 0x97, 0x03, 0x07, 0xfd, 0x25, 0x02, 0xdb, 0xfc, 0xf9, 0x00, 0x01, 0x00, 0x47,
-    0xfe, 0x60, 0x04, 0x96, 0x04, 0x3a, 0x00, 0x10, 0x00, 0x2b, 0x40, 0x28, 0x0b, 0x01, 0x03, 0x04, 0x01, 0x4a, 0x05,
-    0x01, 0x04, 0x04, 0x18, 0x4b, 0x06, 0x01, 0x03, 0x03, 0x00, 0x59, 0x02, 0x01, 0x00, 0x00, 0x17, 0x4b, 0x00, 0x01,
-    0x01, 0x1a, 0x01, 0x4c, 0x11, 0x14, 0x11, 0x11, 0x11, 0x11, 0x10, 0x07, 0x06, 0x1b, 0x2b, 0x05, 0x23, 0x11, 0x23,
-    0x11, 0x23, 0x35, 0x33, 0x01, 0x33, 0x01, 0x17, 0x37, 0x01, 0x33, 0x01, 0x33, 0x03, 0xb1, 0xe5, 0xba, 0xde, 0xb7,
-    0xfe, 0x5c, 0xbe, 0x01, 0x54, 0x18, 0x1a, 0x01, 0x4d, 0xbe, 0xfe, 0x5f, 0xbc, 0x0b, 0xfe, 0x6b, 0x01, 0x95, 0x97,
-    0x03, 0xae, 0xfc, 0xf0, 0x61, 0x61, 0x03, 0x10, 0xfc, 0x52, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x57, 0x00, 0x00,
-    0x04, 0x8f, 0x05, 0xb0, 0x00, 0x11, 0x00, 0x2f, 0x40, 0x2c, 0x0d, 0x01, 0x04, 0x05, 0x04, 0x01, 0x01, 0x00, 0x02,
-    0x4a, 0x07, 0x01, 0x04, 0x03, 0x01, 0x00, 0x01, 0x04, 0x00, 0x62, 0x06, 0x01, 0x05, 0x05, 0x16, 0x4b, 0x02, 0x01,
-    0x01, 0x01, 0x17, 0x01, 0x4c, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x10, 0x08, 0x06, 0x1c, 0x2b, 0x01, 0x23,
-    0x01, 0x23, 0x01, 0x01, 0x23, 0x01, 0x23, 0x35, 0x33, 0x01, 0x33, 0x01, 0x01, 0x33, 0x01, 0x33, 0x03, 0xae, 0xaa,
-    0x01, 0x8b, 0xd8, 0xfe, 0xbe, 0xfe, 0xbd, 0xdb, 0x01, 0x8c, 0xb2, 0xa5, 0xfe, 0x8c, 0xd9, 0x01, 0x36, 0x01, 0x3a,
-    0xda, 0xfe, 0x8c, 0x9d, 0x02, 0x9e, 0xfd, 0x62, 0x02, 0x46, 0xfd, 0xba, 0x02, 0x9e, 0x97, 0x02, 0x7b, 0xfd, 0xc5,
-    0x02, 0x3b, 0xfd, 0x85, 0x00, 0x01, 0x00, 0x6e, 0x00, 0x00, 0x04, 0x72, 0x04, 0x3a, 0x00, 0x11, 0x00, 0x2f, 0x40,
-    0x2c, 0x0d, 0x01, 0x04, 0x05, 0x04, 0x01, 0x01, 0x00, 0x02, 0x4a, 0x07, 0x01, 0x04, 0x03, 0x01, 0x00, 0x01, 0x04,
-    0x00, 0x62, 0x06, 0x01, 0x05, 0x05, 0x18, 0x4b, 0x02, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4c, 0x11, 0x12, 0x11, 0x11,
-    0x11, 0x12, 0x11, 0x10, 0x08, 0x06, 0x1c, 0x2b, 0x01, 0x23, 0x01, 0x23, 0x01, 0x01, 0x23, 0x01, 0x23, 0x35, 0x33,
-    0x01, 0x33, 0x01, 0x01, 0x33, 0x01, 0x33, 0x03, 0xa2, 0x9c, 0x01, 0x6c, 0xd6, 0xfe, 0xd5, 0xfe, 0xd5, 0xd8, 0x01,
-    0x6c, 0xb5, 0xa7, 0xfe, 0xad, 0xd6, 0x01, 0x1e, 0x01, 0x21, 0xd9, 0xfe, 0xad, 0x8e, 0x01, 0xe1, 0xfe, 0x1f, 0x01,
-    0x9c, 0xfe, 0x64, 0x01, 0xe1, 0x97, 0x01, 0xc2, 0xfe, 0x6f, 0x01, 0x91, 0xfe, 0x3e, 0xff, 0xff, 0x00, 0x8b, 0xff,
-    0xec, 0x04, 0x60, 0x04, 0x4d, 0x02, 0x06, 0x00, 0xbc, 0x00, 0x00, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0x04, 0x3d,
-    0x05, 0xb0, 0x02, 0x26, 0x00, 0x28, 0x00, 0x00, 0x01, 0x07, 0x01, 0xca, 0xfe, 0xdc, 0xfe, 0x7f, 0x00, 0x09, 0xb1,
-    0x01, 0x01, 0xb8, 0xfe, 0x7f, 0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x4e, 0x02, 0x8b, 0x04, 0x8d, 0x03, 0x22,
-    0x00, 0x47, 0x01, 0x88, 0xff, 0x73, 0x00, 0x00, 0x53, 0x33, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0xe6, 0xff,
-    0xf5, 0x02, 0xcc, 0x05, 0xb0, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x7a, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x15, 0x00,
-    0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x3c, 0x4b, 0x00, 0x02, 0x02, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x3d, 0x03,
-    0x4c, 0x1b, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40, 0x15, 0x00, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x3c, 0x4b,
-    0x00, 0x02, 0x02, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x45, 0x03, 0x4c, 0x1b, 0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40, 0x15,
-    0x00, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x3c, 0x4b, 0x00, 0x02, 0x02, 0x03, 0x5b, 0x00, 0x03, 0x03, 0x3d,
-    0x03, 0x4c, 0x1b, 0x40, 0x15, 0x00, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x3c, 0x4b, 0x00, 0x02, 0x02, 0x03,
-    0x5b, 0x00, 0x03, 0x03, 0x45, 0x03, 0x4c, 0x59, 0x59, 0x59, 0xb6, 0x24, 0x23, 0x11, 0x10, 0x04, 0x08, 0x18, 0x2b,
-    0x01, 0x23, 0x11, 0x33, 0x03, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x02, 0xb2, 0xba,
-    0xba, 0xcc, 0x39, 0x39, 0x39, 0x3b, 0x3b, 0x39, 0x39, 0x39, 0x01, 0xd7, 0x03, 0xd9, 0xfa, 0xb1, 0x30, 0x40, 0x40,
-    0x30, 0x2e, 0x3e, 0x3e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x41, 0x96, 0xdd, 0x86, 0x26, 0x5f, 0x0f, 0x3c,
-    0xf5, 0x00, 0x0b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf0, 0x11, 0x2e, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x82,
-    0xb3, 0x5b, 0xfc, 0x05, 0xfd, 0xd5, 0x07, 0x99, 0x08, 0x73, 0x00, 0x00, 0x00, 0x09, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x62, 0xfd, 0xd5, 0x00, 0x00, 0x09, 0x9a, 0xfc, 0x05, 0xf8, 0x72,
-    0x07, 0x99, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x04, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcd, 0x00, 0x00, 0x04, 0xcd, 0x00, 0x00, 0x04, 0xcd,
-    0x01, 0x62, 0x04, 0xcd, 0x00, 0x3d, 0x04, 0xcd, 0x00, 0xa2, 0x04, 0xcd, 0x00, 0x2c, 0x04, 0xcd, 0x00, 0x6b, 0x04,
-    0xcd, 0x01, 0xee, 0x04, 0xcd, 0x01, 0x65, 0x04, 0xcd, 0x01, 0x40, 0x04, 0xcd, 0x00, 0xa0, 0x04, 0xcd, 0x00, 0x77,
-    0x04, 0xcd, 0x01, 0x62, 0x04, 0xce, 0x00, 0xda, 0x04, 0xcd, 0x01, 0xf0, 0x04, 0xcd, 0x00, 0xfc, 0x04, 0xcd, 0x00,
-    0x91, 0x04, 0xcd, 0x00, 0xd0, 0x04, 0xcd, 0x00, 0x55, 0x04, 0xcd, 0x00, 0x5e, 0x04, 0xcd, 0x00, 0x4b, 0x04, 0xcd,
-    0x00, 0xbb, 0x04, 0xcd, 0x00, 0x8d, 0x04, 0xcd, 0x00, 0x70, 0x04, 0xcd, 0x00, 0xb1, 0x04, 0xcd, 0x00, 0x95, 0x04,
-    0xcd, 0x02, 0x22, 0x04, 0xcd, 0x01, 0xe6, 0x04, 0xcd, 0x00, 0xaa, 0x04, 0xcd, 0x00, 0xad, 0x04, 0xcd, 0x00, 0xb2,
-    0x04, 0xcd, 0x00, 0xbf, 0x04, 0xcd, 0x00, 0x40, 0x04, 0xcd, 0x00, 0x51, 0x04, 0xcd, 0x00, 0xac, 0x04, 0xcd, 0x00,
-    0x6b, 0x04, 0xcd, 0x00, 0x9b, 0x04, 0xcd, 0x00, 0xb6, 0x04, 0xcd, 0x00, 0xbf, 0x04, 0xcd, 0x00, 0x64, 0x04, 0xcd,
-    0x00, 0x8d, 0x04, 0xcd, 0x00, 0xae, 0x04, 0xcd, 0x00, 0x62, 0x04, 0xcd, 0x00, 0xac, 0x04, 0xcd, 0x00, 0xc6, 0x04,
-    0xcd, 0x00, 0x94, 0x04, 0xcd, 0x00, 0x8f, 0x04, 0xcd, 0x00, 0x6a, 0x04, 0xcd, 0x00, 0xbf, 0x04, 0xcd, 0x00, 0x5e,
-    0x04, 0xcd, 0x00, 0xb5, 0x04, 0xcd, 0x00, 0x76, 0x04, 0xcd, 0x00, 0x4c, 0x04, 0xcd, 0x00, 0x8b, 0x04, 0xcd, 0x00,
-    0x47, 0x04, 0xcd, 0x00, 0x49, 0x04, 0xcd, 0x00, 0x57, 0x04, 0xcd, 0x00, 0x3d, 0x04, 0xcd, 0x00, 0x72, 0x04, 0xcd,
-    0x01, 0xaa, 0x04, 0xcd, 0x00, 0xe7, 0x04, 0xcd, 0x01, 0x95, 0x04, 0xcd, 0x00, 0xe7, 0x04, 0xcd, 0x00, 0x9b, 0x04,
-    0xcd, 0x01, 0x9f, 0x04, 0xcd, 0x00, 0x9c, 0x04, 0xcd, 0x00, 0xaf, 0x04, 0xcd, 0x00, 0x8f, 0x04, 0xcd, 0x00, 0x8b,
-    0x04, 0xcd, 0x00, 0x87, 0x04, 0xce, 0x00, 0x98, 0x04, 0xcd, 0x00, 0x8c, 0x04, 0xcd, 0x00, 0xae, 0x04, 0xcd, 0x00,
-    0xcb, 0x04, 0xcd, 0x00, 0xd3, 0x04, 0xcd, 0x00, 0xb0, 0x04, 0xcd, 0x00, 0xcb, 0x04, 0xcd, 0x00, 0x5d, 0x04, 0xcd,
-    0x00, 0xae, 0x04, 0xcd, 0x00, 0x7a, 0x04, 0xcd, 0x00, 0xad, 0x04, 0xcd, 0x00, 0x8c, 0x04, 0xcd, 0x01, 0x49, 0x04,
-    0xcd, 0x00, 0xaf, 0x04, 0xcd, 0x00, 0x8e, 0x04, 0xcd, 0x00, 0xb4, 0x04, 0xcd, 0x00, 0x62, 0x04, 0xcd, 0x00, 0x30,
-    0x04, 0xcd, 0x00, 0x6e, 0x04, 0xcd, 0x00, 0x44, 0x04, 0xcd, 0x00, 0xa0, 0x04, 0xcd, 0x01, 0x43, 0x04, 0xcd, 0x02,
-    0x1c, 0x04, 0xcd, 0x01, 0x43, 0x04, 0xcd, 0x00, 0x30, 0x04, 0xcd, 0x01, 0xf2, 0x04, 0xcd, 0x00, 0x93, 0x04, 0xcd,
-    0x00, 0x71, 0x04, 0xcd, 0x00, 0x67, 0x04, 0xcd, 0x00, 0x21, 0x04, 0xcd, 0x01, 0xff, 0x04, 0xcd, 0x00, 0x57, 0x04,
-    0xcd, 0x01, 0x1f, 0x04, 0xcd, 0x00, 0x5a, 0x04, 0xcd, 0x01, 0x1c, 0x04, 0xcd, 0x00, 0xd4, 0x04, 0xcd, 0x00, 0xbd,
-    0x04, 0xcd, 0x00, 0x57, 0x04, 0xcd, 0x01, 0x01, 0x04, 0xcd, 0x01, 0x69, 0x04, 0xcd, 0x00, 0x9c, 0x04, 0xcd, 0x01,
-    0x3c, 0x04, 0xcd, 0x01, 0x43, 0x04, 0xcd, 0x01, 0x9a, 0x04, 0xcd, 0x00, 0xbc, 0x04, 0xcd, 0x00, 0xd3, 0x04, 0xcd,
-    0x01, 0xf8, 0x04, 0xcd, 0x01, 0xcd, 0x04, 0xcd, 0x01, 0x82, 0x04, 0xcd, 0x01, 0x10, 0x04, 0xcd, 0x00, 0xf1, 0x04,
-    0xcd, 0x00, 0x30, 0x04, 0xcd, 0x00, 0x24, 0x04, 0xcd, 0x00, 0x25, 0x04, 0xcd, 0x00, 0xcc, 0x04, 0xcd, 0x00, 0x20,
-    0x04, 0xcd, 0x00, 0xb5, 0x04, 0xcd, 0x00, 0x47, 0x04, 0xcd, 0x00, 0xa8, 0x04, 0xcd, 0x00, 0xa9, 0x04, 0xcd, 0x00,
-    0x2b, 0x04, 0xcd, 0x00, 0x49, 0x04, 0xcd, 0x00, 0x73, 0x04, 0xcd, 0x00, 0x7a, 0x04, 0xcd, 0x00, 0xad, 0x04, 0xcd,
-    0x00, 0x18, 0x04, 0xcd, 0x00, 0xcb, 0x04, 0xcd, 0x00, 0x80, 0x04, 0xcd, 0x00, 0x50, 0x04, 0xcd, 0x00, 0xba, 0x04,
-    0xcd, 0x00, 0x3a, 0x04, 0xcd, 0x00, 0xcb, 0x04, 0xcd, 0x00, 0xaf, 0x04, 0xcd, 0x00, 0xb8, 0x04, 0xcd, 0x00, 0x4f,
-    0x04, 0xcd, 0x00, 0x2e, 0x04, 0xcd, 0x01, 0xc8, 0x04, 0xcd, 0x00, 0xa0, 0x04, 0xcd, 0x00, 0x63, 0x04, 0xcd, 0x00,
-    0x77, 0x04, 0xcd, 0x00, 0x8b, 0x04, 0xcd, 0x00, 0xb4, 0x04, 0xcd, 0x00, 0xb0, 0x04, 0xcd, 0x00, 0xb1, 0x04, 0xcd,
-    0x00, 0xc1, 0x04, 0xcd, 0x01, 0x30, 0x04, 0xcd, 0x01, 0x3b, 0x04, 0xcd, 0x01, 0xf2, 0x04, 0xcd, 0x01, 0x9a, 0x04,
-    0xcd, 0x01, 0x8e, 0x04, 0xcd, 0x00, 0x8a, 0x04, 0xcd, 0x00, 0xf6, 0x04, 0xcd, 0x01, 0xad, 0x04, 0x52, 0xfc, 0xca,
-    0x04, 0x52, 0xfd, 0x68, 0x04, 0x52, 0xfc, 0x88, 0x04, 0x52, 0xfd, 0x59, 0x04, 0x52, 0xfc, 0x05, 0x04, 0x52, 0xfd,
-    0x27, 0x04, 0xcd, 0x02, 0x29, 0x04, 0xcd, 0x01, 0x13, 0x04, 0xcd, 0x02, 0x30, 0x04, 0xcd, 0x00, 0xb5, 0x04, 0xcd,
-    0x00, 0x2e, 0x04, 0xcd, 0x00, 0x6a, 0x04, 0xcd, 0x00, 0x36, 0x04, 0xcd, 0x00, 0x91, 0x04, 0xcd, 0x00, 0xa2, 0x04,
-    0xcd, 0x00, 0x70, 0x04, 0xcd, 0x00, 0x45, 0x04, 0xcd, 0x00, 0x65, 0x04, 0xcd, 0x00, 0x61, 0x04, 0xcd, 0x00, 0x81,
-    0x04, 0xcd, 0x00, 0xae, 0x04, 0xcd, 0x00, 0x47, 0x04, 0xcd, 0x00, 0x78, 0x04, 0xcd, 0x00, 0x8b, 0x04, 0xcd, 0x00,
-    0x75, 0x04, 0xcd, 0x00, 0xa4, 0x04, 0xcd, 0x00, 0xb9, 0x04, 0xcd, 0x00, 0xb8, 0x04, 0xcd, 0x00, 0x39, 0x04, 0xcd,
-    0x00, 0xaf, 0x04, 0xcd, 0x00, 0x59, 0x04, 0xcd, 0x00, 0xa5, 0x04, 0xcd, 0x00, 0x78, 0x04, 0xcd, 0x00, 0x6d, 0x04,
-    0xcd, 0x00, 0xad, 0x04, 0xcd, 0x00, 0x9e, 0x04, 0xcd, 0x00, 0x6e, 0x04, 0xcd, 0x00, 0x61, 0x04, 0xcd, 0x00, 0x4f,
-    0x04, 0xcd, 0x00, 0x98, 0x04, 0xcd, 0x00, 0x36, 0x04, 0xcd, 0x00, 0x2e, 0x04, 0xcd, 0x00, 0x2a, 0x04, 0xcd, 0x00,
-    0x81, 0x04, 0xcd, 0x00, 0x1e, 0x04, 0xcd, 0x00, 0x83, 0x04, 0xcd, 0x00, 0x43, 0x04, 0xcd, 0x00, 0xa2, 0x04, 0xcd,
-    0x00, 0xa2, 0x04, 0xcd, 0x00, 0x46, 0x04, 0xcd, 0x00, 0x1d, 0x04, 0xcd, 0x00, 0x59, 0x04, 0xcd, 0x00, 0xa2, 0x04,
-    0xcd, 0x00, 0x2f, 0x04, 0xcd, 0x00, 0x2b, 0x04, 0xcd, 0x00, 0xa6, 0x04, 0xcd, 0x00, 0xab, 0x04, 0xcd, 0x00, 0x7d,
-    0x04, 0xcd, 0x00, 0x7d, 0x04, 0xcd, 0x00, 0x32, 0x04, 0xcd, 0x00, 0x90, 0x04, 0xcd, 0x00, 0xa8, 0x04, 0xcd, 0x00,
-    0x72, 0x04, 0xcd, 0x00, 0x77, 0x04, 0xcd, 0x00, 0x41, 0x04, 0xcd, 0x00, 0x81, 0x04, 0xcd, 0x00, 0xa4, 0x04, 0xcd,
-    0x00, 0xb7, 0x04, 0xcd, 0x00, 0x36, 0x04, 0xcd, 0x00, 0x11, 0x04, 0xcd, 0x00, 0x87, 0x04, 0xcd, 0x00, 0xa5, 0x04,
-    0xcd, 0x00, 0xa4, 0x04, 0xcd, 0x00, 0x37, 0x04, 0xcd, 0x00, 0x89, 0x04, 0xcd, 0x00, 0xa5, 0x04, 0xcd, 0x00, 0xa5,
-    0x04, 0xcd, 0x00, 0x68, 0x04, 0xcd, 0x00, 0x7a, 0x04, 0xcd, 0x00, 0xaa, 0x04, 0xcd, 0x00, 0x8d, 0x04, 0xcd, 0x00,
-    0x81, 0x04, 0xcd, 0x00, 0x76, 0x04, 0xcd, 0x00, 0x39, 0x04, 0xcd, 0x00, 0x90, 0x04, 0xcd, 0x00, 0xa5, 0x04, 0xcd,
-    0x00, 0x81, 0x04, 0xcd, 0x00, 0x71, 0x04, 0xcd, 0x00, 0x4f, 0x04, 0xcd, 0xff, 0xe9, 0x04, 0xcd, 0x00, 0x8f, 0x04,
-    0xcd, 0x00, 0x26, 0x04, 0xcd, 0x00, 0x82, 0x04, 0xcd, 0x00, 0x1c, 0x04, 0xcd, 0x00, 0xa5, 0x04, 0xcd, 0x00, 0x6b,
-    0x04, 0xcd, 0x00, 0x5f, 0x04, 0xcd, 0x00, 0x1c, 0x04, 0xcd, 0x00, 0x7d, 0x04, 0xcd, 0x00, 0x9b, 0x04, 0xcd, 0x00,
-    0x27, 0x04, 0xcd, 0x00, 0x57, 0x04, 0xcd, 0x00, 0x71, 0x04, 0xcd, 0x00, 0x70, 0x04, 0xcd, 0x00, 0x55, 0x04, 0xcd,
-    0x00, 0x69, 0x04, 0xcd, 0x00, 0x50, 0x04, 0xcd, 0x00, 0x51, 0x04, 0xcd, 0x00, 0xca, 0x04, 0xcd, 0x00, 0xde, 0x04,
-    0xcd, 0x00, 0x63, 0x04, 0xcd, 0x00, 0x5d, 0x04, 0xcd, 0x00, 0x1a, 0x04, 0xcd, 0x00, 0x51, 0x04, 0xcd, 0x00, 0x45,
-    0x04, 0xcd, 0x00, 0x37, 0x04, 0xcd, 0x00, 0x6a, 0x04, 0xcd, 0x00, 0x7a, 0x04, 0xcd, 0x00, 0x4d, 0x04, 0xcd, 0x00,
-    0x67, 0x04, 0xcd, 0x00, 0x71, 0x04, 0xcd, 0x00, 0x5f, 0x04, 0xcd, 0x00, 0x97, 0x04, 0xcd, 0x00, 0xbf, 0x04, 0xcd,
-    0x00, 0x76, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x01, 0xc3, 0x00, 0x00, 0x02, 0x3c, 0x00,
-    0x00, 0xfe, 0xe7, 0x00, 0x00, 0x00, 0x4e, 0x04, 0xcd, 0x00, 0xbf, 0x04, 0xcd, 0x00, 0xad, 0x04, 0xcd, 0x00, 0xb6,
-    0x04, 0xcd, 0x00, 0xb6, 0x04, 0xcd, 0x00, 0xb9, 0x04, 0xcd, 0x00, 0xb8, 0x04, 0xcd, 0x00, 0xae, 0x04, 0xcd, 0x00,
-    0xa3, 0x04, 0xcd, 0x00, 0x2d, 0x04, 0xcd, 0x00, 0x38, 0x04, 0xcd, 0x00, 0x72, 0x04, 0xcd, 0x00, 0x6e, 0x04, 0xcd,
-    0x00, 0x6d, 0x04, 0xcd, 0x00, 0x74, 0x04, 0xcd, 0x00, 0x68, 0x04, 0xcd, 0x00, 0x5c, 0x04, 0xcd, 0x00, 0x39, 0x04,
-    0xcd, 0x00, 0x34, 0x04, 0xcd, 0x00, 0xab, 0x04, 0xcd, 0x00, 0x92, 0x04, 0xcd, 0x00, 0xe3, 0x04, 0xcd, 0x00, 0x26,
-    0x04, 0xcd, 0x00, 0x26, 0x04, 0xcd, 0x00, 0xc8, 0x04, 0xcd, 0x00, 0xb4, 0x04, 0xcd, 0x00, 0xb6, 0x04, 0xcd, 0x00,
-    0xb3, 0x04, 0xcd, 0x00, 0x5a, 0x04, 0xcd, 0x00, 0x94, 0x04, 0xcd, 0x00, 0x89, 0x04, 0xcd, 0x00, 0x42, 0x04, 0xcd,
-    0x00, 0x74, 0x04, 0xcd, 0x00, 0x61, 0x04, 0xcd, 0x00, 0x4d, 0x04, 0xcd, 0x00, 0x65, 0x04, 0xcd, 0x00, 0x37, 0x04,
-    0xcd, 0x00, 0x50, 0x04, 0xcd, 0x00, 0xb3, 0x04, 0xcd, 0x00, 0xd0, 0x04, 0xcd, 0x00, 0x14, 0x04, 0xcd, 0x00, 0x2f,
-    0x04, 0xcd, 0x00, 0x6f, 0x04, 0xcd, 0x00, 0x75, 0x04, 0xcd, 0x00, 0x8e, 0x04, 0xcd, 0x00, 0xa0, 0x04, 0xcd, 0x00,
-    0x4c, 0x04, 0xcd, 0x00, 0x49, 0x04, 0xcd, 0x00, 0x6c, 0x04, 0xcd, 0x00, 0x00, 0x04, 0xcd, 0x00, 0x00, 0x04, 0xcd,
-    0x00, 0x00, 0x04, 0xcd, 0x00, 0x00, 0x04, 0xcd, 0x00, 0x00, 0x04, 0xcd, 0x00, 0x00, 0x04, 0xcd, 0x00, 0x00, 0x04,
-    0xcd, 0x00, 0x00, 0x04, 0xcd, 0x00, 0x00, 0x04, 0xcd, 0x00, 0x00, 0x04, 0xcd, 0x00, 0x00, 0x04, 0xcd, 0x00, 0x00,
-    0x04, 0xcd, 0x00, 0x49, 0x04, 0xcd, 0x00, 0x4e, 0x04, 0xcd, 0x00, 0xa6, 0x04, 0xcd, 0x01, 0xec, 0x04, 0xcd, 0x01,
-    0xcd, 0x04, 0xcd, 0x01, 0xbc, 0x04, 0xcd, 0x01, 0xcf, 0x04, 0xcd, 0x01, 0x49, 0x04, 0xcd, 0x01, 0x2d, 0x04, 0xcd,
-    0x01, 0x2f, 0x04, 0xcd, 0x00, 0x77, 0x04, 0xcd, 0x00, 0x79, 0x04, 0xcd, 0x01, 0x9a, 0x04, 0xcd, 0x01, 0x5c, 0x04,
-    0xcd, 0x01, 0x09, 0x04, 0xcd, 0x00, 0x36, 0x04, 0xcd, 0x01, 0x8c, 0x04, 0xcd, 0x01, 0x8c, 0x04, 0xcd, 0x01, 0x2b,
-    0x04, 0xcd, 0x01, 0x0f, 0x04, 0xcd, 0x01, 0x4b, 0x04, 0xcd, 0x00, 0x69, 0x04, 0xcd, 0x00, 0x7f, 0x04, 0xcd, 0x00,
-    0x7f, 0x04, 0xcd, 0x00, 0x49, 0x04, 0xcd, 0x00, 0xdd, 0x04, 0xcd, 0x00, 0x79, 0x04, 0xcd, 0x00, 0x67, 0x04, 0xcd,
-    0x00, 0x99, 0x04, 0xcd, 0x00, 0x50, 0x04, 0xcd, 0x00, 0x32, 0x04, 0xcd, 0x00, 0x24, 0x04, 0xcd, 0x00, 0x40, 0x04,
-    0xcd, 0x00, 0x7e, 0x04, 0xcd, 0x00, 0xa7, 0x04, 0xcd, 0x00, 0x33, 0x04, 0xcd, 0x00, 0xa9, 0x04, 0xcd, 0x00, 0x39,
-    0x04, 0xcd, 0x00, 0x35, 0x04, 0xcd, 0x00, 0xf8, 0x04, 0xcd, 0x00, 0x8d, 0x04, 0xcd, 0x00, 0xa9, 0x04, 0xcd, 0x00,
-    0xbb, 0x04, 0xcd, 0x00, 0xc2, 0x04, 0xcd, 0x00, 0x8e, 0x04, 0xcd, 0x01, 0x2e, 0x04, 0xcd, 0x00, 0x00, 0x04, 0xcd,
-    0x00, 0x5c, 0x04, 0xcd, 0x00, 0x0f, 0x04, 0xcd, 0x00, 0xb8, 0x04, 0xcd, 0x01, 0x3a, 0x04, 0xcd, 0x01, 0x11, 0x04,
-    0xcd, 0x00, 0xfc, 0x04, 0xcd, 0x00, 0x10, 0x04, 0xcd, 0x01, 0x0b, 0x04, 0xcd, 0x01, 0x30, 0x04, 0xcd, 0x01, 0xf9,
-    0x04, 0xcd, 0x00, 0x36, 0x04, 0xcd, 0x00, 0xd0, 0x04, 0xcd, 0x00, 0x6e, 0x04, 0xcd, 0x00, 0xb7, 0x04, 0xcd, 0x00,
-    0xc8, 0x04, 0xcd, 0x00, 0xe7, 0x04, 0xcd, 0x00, 0x7c, 0x04, 0xcd, 0x00, 0x9b, 0x04, 0xcd, 0x00, 0xd9, 0x04, 0xcd,
-    0x00, 0x96, 0x04, 0xcd, 0x00, 0xb4, 0x04, 0xcd, 0x00, 0xd1, 0x04, 0xcd, 0x00, 0x9b, 0x04, 0xcd, 0x00, 0xc2, 0x04,
-    0xcd, 0x00, 0x82, 0x04, 0xcd, 0x00, 0x5e, 0x04, 0xcd, 0x00, 0x90, 0x04, 0xcd, 0x00, 0x8a, 0x04, 0xcd, 0x00, 0x5d,
-    0x04, 0xcd, 0x00, 0xb5, 0x04, 0xcd, 0x00, 0x56, 0x04, 0xcd, 0x00, 0x2f, 0x04, 0xcd, 0x00, 0x60, 0x04, 0xcd, 0x00,
-    0x4d, 0x04, 0xcd, 0x00, 0xb9, 0x04, 0xcd, 0x01, 0x52, 0x04, 0xcd, 0x01, 0x0e, 0x04, 0xcd, 0x00, 0xb6, 0x04, 0xcd,
-    0x00, 0xc5, 0x04, 0xcd, 0x00, 0x89, 0x04, 0xcd, 0x00, 0xd1, 0x04, 0xcd, 0x00, 0xe1, 0x04, 0xcd, 0x00, 0xbc, 0x04,
-    0xcd, 0x00, 0xd1, 0x04, 0xcd, 0x00, 0xba, 0x04, 0xcd, 0x01, 0x3f, 0x04, 0xcd, 0x01, 0x5b, 0x04, 0xcd, 0x01, 0x42,
-    0x04, 0xcd, 0x01, 0x38, 0x04, 0xcd, 0x01, 0x23, 0x04, 0xcd, 0x01, 0x40, 0x04, 0xcd, 0x01, 0x3b, 0x04, 0xcd, 0x01,
-    0x30, 0x04, 0xcd, 0x01, 0x3e, 0x04, 0xcd, 0x01, 0x40, 0x04, 0xcd, 0x01, 0x35, 0x04, 0xcd, 0x01, 0xd1, 0x04, 0xcd,
-    0x01, 0xf5, 0x04, 0xcd, 0x01, 0x74, 0x04, 0xcd, 0x02, 0x06, 0x04, 0xcd, 0x01, 0x69, 0x04, 0xcd, 0x01, 0x60, 0x04,
-    0xcd, 0x00, 0x6e, 0x04, 0xcd, 0x00, 0xb2, 0x04, 0xcd, 0x00, 0xcb, 0x04, 0xcd, 0x01, 0xa0, 0x04, 0xcd, 0x00, 0xd0,
-    0x04, 0xcd, 0x00, 0x54, 0x04, 0xcd, 0x00, 0xcc, 0x04, 0xcd, 0x00, 0x6b, 0x04, 0xcd, 0x00, 0xa3, 0x04, 0xcd, 0x00,
-    0xa9, 0x04, 0xcd, 0x00, 0x79, 0x04, 0xcd, 0x00, 0xa0, 0x04, 0xcd, 0x00, 0xce, 0x04, 0xcb, 0x00, 0x8d, 0x04, 0xcd,
-    0x00, 0x5a, 0x04, 0xcd, 0x00, 0x8f, 0x04, 0xcd, 0x00, 0xd2, 0x04, 0xcd, 0x01, 0x3b, 0x04, 0xcd, 0x00, 0x00, 0x04,
-    0xce, 0x00, 0xda, 0x04, 0xeb, 0xff, 0xd4, 0x04, 0xeb, 0xff, 0xd4, 0x04, 0xeb, 0x00, 0x1a, 0x04, 0xcd, 0x00, 0x4c,
-    0x04, 0xcd, 0x00, 0x8e, 0x04, 0xcd, 0x00, 0x51, 0x04, 0xcd, 0x00, 0x51, 0x04, 0xcd, 0x00, 0x51, 0x04, 0xcd, 0x00,
-    0x51, 0x04, 0xcd, 0x00, 0x51, 0x04, 0xcd, 0x00, 0x51, 0x04, 0xcd, 0x00, 0x51, 0x04, 0xcd, 0x00, 0x6b, 0x04, 0xcd,
-    0x00, 0xb6, 0x04, 0xcd, 0x00, 0xb6, 0x04, 0xcd, 0x00, 0xb6, 0x04, 0xcd, 0x00, 0xb6, 0x04, 0xcd, 0x00, 0xae, 0x04,
-    0xcd, 0x00, 0xae, 0x04, 0xcd, 0x00, 0xae, 0x04, 0xcd, 0x00, 0xae, 0x04, 0xcd, 0x00, 0x8f, 0x04, 0xcd, 0x00, 0x6a,
-    0x04, 0xcd, 0x00, 0x6a, 0x04, 0xcd, 0x00, 0x6a, 0x04, 0xcd, 0x00, 0x6a, 0x04, 0xcd, 0x00, 0x6a, 0x04, 0xcd, 0x00,
-    0x8b, 0x04, 0xcd, 0x00, 0x8b, 0x04, 0xcd, 0x00, 0x8b, 0x04, 0xcd, 0x00, 0x8b, 0x04, 0xcd, 0x00, 0x3d, 0x04, 0xcd,
-    0x00, 0x9c, 0x04, 0xcd, 0x00, 0x9c, 0x04, 0xcd, 0x00, 0x9c, 0x04, 0xcd, 0x00, 0x9c, 0x04, 0xcd, 0x00, 0x9c, 0x04,
-    0xcd, 0x00, 0x9c, 0x04, 0xcd, 0x00, 0x9c, 0x04, 0xcd, 0x00, 0x8f, 0x04, 0xcd, 0x00, 0x87, 0x04, 0xcd, 0x00, 0x87,
-    0x04, 0xcd, 0x00, 0x87, 0x04, 0xcd, 0x00, 0x87, 0x04, 0xcd, 0x00, 0xcb, 0x04, 0xcd, 0x00, 0xcb, 0x04, 0xcd, 0x00,
-    0xcb, 0x04, 0xcd, 0x00, 0xcb, 0x04, 0xcd, 0x00, 0xae, 0x04, 0xcd, 0x00, 0x7a, 0x04, 0xcd, 0x00, 0x7a, 0x04, 0xcd,
-    0x00, 0x7a, 0x04, 0xcd, 0x00, 0x7a, 0x04, 0xcd, 0x00, 0x7a, 0x04, 0xcd, 0x00, 0xb4, 0x04, 0xcd, 0x00, 0xb4, 0x04,
-    0xcd, 0x00, 0xb4, 0x04, 0xcd, 0x00, 0xb4, 0x04, 0xcd, 0x00, 0x44, 0x04, 0xcd, 0x00, 0x44, 0x04, 0xcd, 0x00, 0x51,
-    0x04, 0xcd, 0x00, 0x9c, 0x04, 0xcd, 0x00, 0x51, 0x04, 0xcd, 0x00, 0x9c, 0x04, 0xcd, 0x00, 0x51, 0x04, 0xcd, 0x00,
-    0x9c, 0x04, 0xcd, 0x00, 0x6b, 0x04, 0xcd, 0x00, 0x8f, 0x04, 0xcd, 0x00, 0x6b, 0x04, 0xcd, 0x00, 0x8f, 0x04, 0xcd,
-    0x00, 0x6b, 0x04, 0xcd, 0x00, 0x8f, 0x04, 0xcd, 0x00, 0x6b, 0x04, 0xcd, 0x00, 0x8f, 0x04, 0xcd, 0x00, 0x9b, 0x05,
-    0x63, 0x00, 0x8b, 0x04, 0xcd, 0x00, 0xb6, 0x04, 0xcd, 0x00, 0x87, 0x04, 0xcd, 0x00, 0xb6, 0x04, 0xcd, 0x00, 0x87,
-    0x04, 0xcd, 0x00, 0xb6, 0x04, 0xcd, 0x00, 0x87, 0x04, 0xcd, 0x00, 0xb6, 0x04, 0xcd, 0x00, 0x87, 0x04, 0xcd, 0x00,
-    0xb6, 0x04, 0xcd, 0x00, 0x87, 0x04, 0xcd, 0x00, 0x64, 0x04, 0xcd, 0x00, 0x8c, 0x04, 0xcd, 0x00, 0x64, 0x04, 0xcd,
-    0x00, 0x8c, 0x04, 0xcd, 0x00, 0x64, 0x04, 0xcd, 0x00, 0x8c, 0x04, 0xcd, 0x00, 0x64, 0x04, 0xcd, 0x00, 0x8c, 0x04,
-    0xcd, 0x00, 0x8d, 0x04, 0xcd, 0x00, 0xae, 0x04, 0xcd, 0x00, 0xae, 0x04, 0xcd, 0x00, 0xcb, 0x04, 0xcd, 0x00, 0xae,
-    0x04, 0xcd, 0x00, 0xcb, 0x04, 0xcd, 0x00, 0xae, 0x04, 0xcd, 0x00, 0xcb, 0x04, 0xcd, 0x00, 0xae, 0x04, 0xcd, 0x00,
-    0xcb, 0x04, 0xcd, 0x00, 0xae, 0x04, 0xcd, 0x00, 0x62, 0x04, 0xcd, 0x00, 0xb0, 0x04, 0xcd, 0x00, 0xac, 0x04, 0xcd,
-    0x00, 0xb0, 0x04, 0xcd, 0x00, 0xc6, 0x04, 0xcd, 0x00, 0xcb, 0x04, 0xcd, 0x00, 0xc6, 0x04, 0xcd, 0x00, 0xcb, 0x04,
-    0xcd, 0x00, 0xc6, 0x05, 0x63, 0x00, 0xcb, 0x04, 0xcd, 0x00, 0xc6, 0x05, 0xa9, 0x00, 0xcb, 0x04, 0xcd, 0x00, 0x8f,
-    0x04, 0xcd, 0x00, 0xae, 0x04, 0xcd, 0x00, 0x8f, 0x04, 0xcd, 0x00, 0xae, 0x04, 0xcd, 0x00, 0x8f, 0x04, 0xcd, 0x00,
-    0xae, 0x04, 0xcd, 0xff, 0xba, 0x04, 0xcd, 0x00, 0x6a, 0x04, 0xcd, 0x00, 0x7a, 0x04, 0xcd, 0x00, 0x6a, 0x04, 0xcd,
-    0x00, 0x7a, 0x04, 0xcd, 0x00, 0x6a, 0x04, 0xcd, 0x00, 0x7a, 0x04, 0xcd, 0x00, 0xb5, 0x04, 0xcd, 0x01, 0x49, 0x04,
-    0xcd, 0x00, 0xb5, 0x04, 0xcd, 0x01, 0x10, 0x04, 0xcd, 0x00, 0xb5, 0x04, 0xcd, 0x01, 0x14, 0x04, 0xcd, 0x00, 0x76,
-    0x04, 0xcd, 0x00, 0xaf, 0x04, 0xcd, 0x00, 0x76, 0x04, 0xcd, 0x00, 0xaf, 0x04, 0xcd, 0x00, 0x76, 0x04, 0xcd, 0x00,
-    0xaf, 0x04, 0xcd, 0x00, 0x76, 0x04, 0xcd, 0x00, 0xaf, 0x04, 0xcd, 0x00, 0x76, 0x04, 0xcd, 0x00, 0xaf, 0x04, 0xcd,
-    0x00, 0x4c, 0x04, 0xcd, 0x00, 0x8e, 0x04, 0xcd, 0x00, 0x4c, 0x04, 0xcd, 0x00, 0x5d, 0x04, 0xcd, 0x00, 0x8e, 0x04,
-    0xcd, 0x00, 0x4c, 0x04, 0xf5, 0x00, 0x8e, 0x04, 0xcd, 0x00, 0x8b, 0x04, 0xcd, 0x00, 0xb4, 0x04, 0xcd, 0x00, 0x8b,
-    0x04, 0xcd, 0x00, 0xb4, 0x04, 0xcd, 0x00, 0x8b, 0x04, 0xcd, 0x00, 0xb4, 0x04, 0xcd, 0x00, 0x8b, 0x04, 0xcd, 0x00,
-    0xb4, 0x04, 0xcd, 0x00, 0x8b, 0x04, 0xcd, 0x00, 0xb4, 0x04, 0xcd, 0x00, 0x8b, 0x04, 0xcd, 0x00, 0xb4, 0x04, 0xcd,
-    0x00, 0x49, 0x04, 0xcd, 0x00, 0x30, 0x04, 0xcd, 0x00, 0x3d, 0x04, 0xcd, 0x00, 0x44, 0x04, 0xcd, 0x00, 0x3d, 0x04,
-    0xcd, 0x00, 0x72, 0x04, 0xcd, 0x00, 0xa0, 0x04, 0xcd, 0x00, 0x72, 0x04, 0xcd, 0x00, 0xa0, 0x04, 0xcd, 0x00, 0x72,
-    0x04, 0xcd, 0x00, 0xa0, 0x04, 0xcd, 0x00, 0x20, 0x04, 0xcd, 0x00, 0x2b, 0x04, 0xcd, 0x00, 0x47, 0x04, 0xcd, 0x00,
-    0x7a, 0x04, 0xcd, 0xff, 0xe7, 0x04, 0xcd, 0xff, 0xe7, 0x04, 0xcd, 0x00, 0x5d, 0x04, 0xcd, 0x00, 0x36, 0x04, 0xcd,
-    0x00, 0x36, 0x04, 0xcd, 0x00, 0x36, 0x04, 0xcd, 0x00, 0x36, 0x04, 0xcd, 0x00, 0x36, 0x04, 0xcd, 0x00, 0x36, 0x04,
-    0xcd, 0x00, 0x36, 0x04, 0xcd, 0x00, 0x6e, 0x04, 0xcd, 0x00, 0xc8, 0x04, 0xcd, 0x00, 0xc8, 0x04, 0xcd, 0x00, 0xc8,
-    0x04, 0xcd, 0x00, 0xc8, 0x04, 0xcd, 0x00, 0xd9, 0x04, 0xcd, 0x00, 0xd9, 0x04, 0xcd, 0x00, 0xd9, 0x04, 0xcd, 0x00,
-    0xd9, 0x04, 0xcd, 0x00, 0xc2, 0x04, 0xcd, 0x00, 0x82, 0x04, 0xcd, 0x00, 0x82, 0x04, 0xcd, 0x00, 0x82, 0x04, 0xcd,
-    0x00, 0x82, 0x04, 0xcd, 0x00, 0x82, 0x04, 0xcd, 0x00, 0xb5, 0x04, 0xcd, 0x00, 0xb5, 0x04, 0xcd, 0x00, 0xb5, 0x04,
-    0xcd, 0x00, 0xb5, 0x04, 0xcd, 0x00, 0x4d, 0x04, 0xcd, 0x00, 0x36, 0x04, 0xcd, 0x00, 0x36, 0x04, 0xcd, 0x00, 0x36,
-    0x04, 0xcd, 0x00, 0x6e, 0x04, 0xcd, 0x00, 0x6e, 0x04, 0xcd, 0x00, 0x6e, 0x04, 0xcd, 0x00, 0x6e, 0x04, 0xcd, 0x00,
-    0xb7, 0x04, 0xcd, 0x00, 0xc8, 0x04, 0xcd, 0x00, 0xc8, 0x04, 0xcd, 0x00, 0xc8, 0x04, 0xcd, 0x00, 0xc8, 0x04, 0xcd,
-    0x00, 0xc8, 0x04, 0xcd, 0x00, 0x7c, 0x04, 0xcd, 0x00, 0x7c, 0x04, 0xcd, 0x00, 0x7c, 0x04, 0xcd, 0x00, 0x7c, 0x04,
-    0xcd, 0x00, 0x9b, 0x04, 0xcd, 0x00, 0xd9, 0x04, 0xcd, 0x00, 0xd9, 0x04, 0xcd, 0x00, 0xd9, 0x04, 0xcd, 0x00, 0xd9,
-    0x04, 0xcd, 0x00, 0xd9, 0x04, 0xcd, 0x00, 0x96, 0x04, 0xcd, 0x00, 0xb4, 0x04, 0xcd, 0x00, 0xb6, 0x04, 0xcd, 0x00,
-    0xd1, 0x04, 0xcd, 0x00, 0xd1, 0x04, 0xcd, 0x00, 0xd1, 0x04, 0xcd, 0x00, 0xc2, 0x04, 0xcd, 0x00, 0xc2, 0x04, 0xcd,
-    0x00, 0xc2, 0x04, 0xcd, 0x00, 0x82, 0x04, 0xcd, 0x00, 0x82, 0x04, 0xcd, 0x00, 0x82, 0x04, 0xcd, 0x00, 0x90, 0x04,
-    0xcd, 0x00, 0x90, 0x04, 0xcd, 0x00, 0x90, 0x04, 0xcd, 0x00, 0x8a, 0x04, 0xcd, 0x00, 0x8a, 0x04, 0xcd, 0x00, 0x8a,
-    0x04, 0xcd, 0x00, 0x8a, 0x04, 0xcd, 0x00, 0x5d, 0x04, 0xcd, 0x00, 0x5d, 0x04, 0xcd, 0x00, 0xb5, 0x04, 0xcd, 0x00,
-    0xb5, 0x04, 0xcd, 0x00, 0xb5, 0x04, 0xcd, 0x00, 0xb5, 0x04, 0xcd, 0x00, 0xb5, 0x04, 0xcd, 0x00, 0xb5, 0x04, 0xcd,
-    0x00, 0x2f, 0x04, 0xcd, 0x00, 0x4d, 0x04, 0xcd, 0x00, 0x4d, 0x04, 0xcd, 0x00, 0xb9, 0x04, 0xcd, 0x00, 0xb9, 0x04,
-    0xcd, 0x00, 0xb9, 0x04, 0xcd, 0x00, 0x51, 0x05, 0x31, 0x00, 0x0f, 0x05, 0x31, 0xff, 0xfd, 0x05, 0x31, 0xff, 0xec,
-    0x04, 0xe1, 0x00, 0x09, 0x05, 0x31, 0xff, 0xb2, 0x04, 0xe1, 0x00, 0x05, 0x04, 0xcd, 0x00, 0xb8, 0x04, 0xcd, 0x00,
-    0x51, 0x04, 0xcd, 0x00, 0xac, 0x04, 0xcd, 0x00, 0xb6, 0x04, 0xcd, 0x00, 0x72, 0x04, 0xcd, 0x00, 0x8d, 0x04, 0xcd,
-    0x00, 0xae, 0x04, 0xcd, 0x00, 0xac, 0x04, 0xcd, 0x00, 0x94, 0x04, 0xcd, 0x00, 0x8f, 0x04, 0xcd, 0x00, 0x6a, 0x04,
-    0xcd, 0x00, 0xbf, 0x04, 0xcd, 0x00, 0x4c, 0x04, 0xcd, 0x00, 0x3d, 0x04, 0xcd, 0x00, 0x57, 0x04, 0xcd, 0x00, 0xae,
-    0x04, 0xcd, 0x00, 0x3d, 0x04, 0xcd, 0x00, 0x81, 0x04, 0xcd, 0x00, 0x8b, 0x04, 0xcd, 0x00, 0xa4, 0x04, 0xcd, 0x00,
-    0xb8, 0x04, 0xcd, 0x00, 0x9e, 0x04, 0xcd, 0x00, 0xba, 0x04, 0xcd, 0x00, 0x7a, 0x04, 0xcd, 0x00, 0xbc, 0x04, 0xcd,
-    0x00, 0x62, 0x04, 0xcd, 0x00, 0x6e, 0x04, 0xcd, 0x00, 0xb8, 0x04, 0xcd, 0x00, 0x9e, 0x04, 0xcd, 0x00, 0x7a, 0x04,
-    0xcd, 0x00, 0x9e, 0x04, 0xcd, 0x00, 0x4f, 0x04, 0xcd, 0x00, 0xb6, 0x04, 0xcd, 0x00, 0xb5, 0x04, 0xcd, 0x00, 0x76,
-    0x04, 0xcd, 0x00, 0xae, 0x04, 0xcd, 0x00, 0xae, 0x04, 0xcd, 0x00, 0x62, 0x04, 0xcd, 0x00, 0xa9, 0x04, 0xcd, 0x00,
-    0xac, 0x04, 0xcd, 0x00, 0x2b, 0x04, 0xcd, 0x00, 0x51, 0x04, 0xcd, 0x00, 0xac, 0x04, 0xcd, 0x00, 0xb5, 0x04, 0xcd,
-    0x00, 0xb6, 0x04, 0xcd, 0x00, 0xa2, 0x04, 0xcd, 0x00, 0x94, 0x04, 0xcd, 0x00, 0x8d, 0x04, 0xcd, 0x00, 0x6a, 0x04,
-    0xcd, 0x00, 0xa2, 0x04, 0xcd, 0x00, 0xbf, 0x04, 0xcd, 0x00, 0x6b, 0x04, 0xcd, 0x00, 0x4c, 0x04, 0xcd, 0x00, 0x45,
-    0x04, 0xcd, 0x00, 0x57, 0x04, 0xcd, 0x00, 0x9c, 0x04, 0xcd, 0x00, 0x87, 0x04, 0xcd, 0x00, 0xa5, 0x04, 0xcd, 0x00,
-    0x7a, 0x04, 0xcd, 0x00, 0xad, 0x04, 0xcd, 0x00, 0x8f, 0x04, 0xcd, 0x00, 0x44, 0x04, 0xcd, 0x00, 0x6e, 0x04, 0xcd,
-    0x00, 0x87, 0x04, 0xcd, 0x00, 0xb7, 0x04, 0xcd, 0x00, 0xaf, 0x04, 0xcd, 0x00, 0xcb, 0x04, 0xcd, 0x00, 0xcb, 0x04,
-    0xcd, 0x00, 0xd3, 0x04, 0xcd, 0x00, 0xa4, 0x04, 0xcd, 0x00, 0x44, 0x04, 0xcd, 0x00, 0x49, 0x04, 0xcd, 0x00, 0x30,
-    0x04, 0xcd, 0x00, 0x49, 0x04, 0xcd, 0x00, 0x30, 0x04, 0xcd, 0x00, 0x49, 0x04, 0xcd, 0x00, 0x30, 0x04, 0xcd, 0x00,
-    0x3d, 0x04, 0xcd, 0x00, 0x44, 0x04, 0xcd, 0x01, 0xee, 0x04, 0xcd, 0x01, 0x62, 0x09, 0x9a, 0x01, 0xe6, 0x04, 0xcd,
-    0x00, 0xb0, 0x04, 0xcd, 0x01, 0xcd, 0x04, 0xcd, 0x00, 0x94, 0x04, 0xcd, 0x00, 0x5d, 0x04, 0xcd, 0x00, 0x51, 0x04,
-    0xcd, 0x00, 0x9c, 0x04, 0xcd, 0xff, 0x89, 0x04, 0xcd, 0x00, 0xb6, 0x04, 0xcd, 0x00, 0xa2, 0x04, 0xcd, 0x00, 0x87,
-    0x04, 0xcd, 0x00, 0xa5, 0x04, 0xcd, 0x00, 0x65, 0x04, 0xcd, 0x00, 0x61, 0x04, 0xcd, 0x00, 0x1a, 0x04, 0xcd, 0x00,
-    0x35, 0x04, 0xcd, 0x00, 0x59, 0x04, 0xcd, 0x00, 0x87, 0x04, 0xcd, 0x00, 0x6b, 0x04, 0xcd, 0x00, 0x8f, 0x04, 0xcd,
-    0x00, 0x3d, 0x04, 0xcd, 0x00, 0x47, 0x04, 0xcd, 0x00, 0xae, 0x04, 0xcd, 0x00, 0x1d, 0x04, 0xcd, 0x00, 0x11, 0x04,
-    0xcd, 0x00, 0xae, 0x04, 0xcd, 0x00, 0x51, 0x04, 0xcd, 0x00, 0x9c, 0x04, 0xcd, 0x00, 0x51, 0x04, 0xcd, 0x00, 0x9c,
-    0x04, 0xcd, 0x00, 0x20, 0x04, 0xcd, 0x00, 0x2b, 0x04, 0xcd, 0x00, 0xb6, 0x04, 0xcd, 0x00, 0x87, 0x04, 0xcd, 0x00,
-    0x5a, 0x04, 0xcd, 0x00, 0xb1, 0x04, 0xcd, 0x00, 0xb1, 0x04, 0xcd, 0x00, 0x1d, 0x04, 0xcd, 0x00, 0x11, 0x04, 0xcd,
-    0x00, 0x59, 0x04, 0xcd, 0x00, 0x87, 0x04, 0xcd, 0x00, 0xa2, 0x04, 0xcd, 0x00, 0xa5, 0x04, 0xcd, 0x00, 0xa2, 0x04,
-    0xcd, 0x00, 0xa5, 0x04, 0xcd, 0x00, 0x6a, 0x04, 0xcd, 0x00, 0x7a, 0x04, 0xcd, 0x00, 0x63, 0x04, 0xcd, 0x00, 0x5d,
-    0x04, 0xcd, 0x00, 0x63, 0x04, 0xcd, 0x00, 0x5d, 0x04, 0xcd, 0x00, 0x72, 0x04, 0xcd, 0x00, 0x81, 0x04, 0xcd, 0x00,
-    0x2b, 0x04, 0xcd, 0x00, 0x44, 0x04, 0xcd, 0x00, 0x2b, 0x04, 0xcd, 0x00, 0x44, 0x04, 0xcd, 0x00, 0x2b, 0x04, 0xcd,
-    0x00, 0x44, 0x04, 0xcd, 0x00, 0xab, 0x04, 0xcd, 0x00, 0x8d, 0x04, 0xcd, 0x00, 0x90, 0x04, 0xcd, 0x00, 0x90, 0x04,
-    0xcd, 0x00, 0x57, 0x04, 0xcd, 0x00, 0x6e, 0x04, 0xcd, 0x00, 0x8b, 0x04, 0xcd, 0x00, 0x2f, 0x04, 0xcd, 0x00, 0x37,
-    0x04, 0xcd, 0x00, 0x51, 0x04, 0xcd, 0x00, 0x9c, 0x04, 0xcd, 0x00, 0x51, 0x04, 0xcd, 0x00, 0x9c, 0x04, 0xcd, 0x00,
-    0x51, 0x04, 0xcd, 0x00, 0x9c, 0x04, 0xcd, 0xff, 0xfc, 0x04, 0xcd, 0xff, 0xf8, 0x04, 0xcd, 0x00, 0x51, 0x04, 0xcd,
-    0x00, 0x9c, 0x04, 0xcd, 0x00, 0x51, 0x04, 0xcd, 0x00, 0x9c, 0x04, 0xcd, 0x00, 0x51, 0x04, 0xcd, 0x00, 0x9c, 0x04,
-    0xcd, 0x00, 0x51, 0x04, 0xcd, 0x00, 0x9c, 0x04, 0xcd, 0x00, 0x51, 0x04, 0xcd, 0x00, 0x9c, 0x04, 0xcd, 0x00, 0x51,
-    0x04, 0xcd, 0x00, 0x9c, 0x04, 0xcd, 0x00, 0x51, 0x04, 0xcd, 0x00, 0x9c, 0x04, 0xcd, 0x00, 0x51, 0x04, 0xcd, 0x00,
-    0x9c, 0x04, 0xcd, 0x00, 0xb6, 0x04, 0xcd, 0x00, 0x87, 0x04, 0xcd, 0x00, 0xb6, 0x04, 0xcd, 0x00, 0x87, 0x04, 0xcd,
-    0x00, 0xb6, 0x04, 0xcd, 0x00, 0x87, 0x04, 0xcd, 0x00, 0xb6, 0x04, 0xcd, 0x00, 0x87, 0x04, 0xcd, 0xff, 0xf2, 0x04,
-    0xcd, 0xff, 0xf3, 0x04, 0xcd, 0x00, 0xb6, 0x04, 0xcd, 0x00, 0x87, 0x04, 0xcd, 0x00, 0xb6, 0x04, 0xcd, 0x00, 0x87,
-    0x04, 0xcd, 0x00, 0xb6, 0x04, 0xcd, 0x00, 0x87, 0x04, 0xcd, 0x00, 0xae, 0x04, 0xcd, 0x00, 0xcb, 0x04, 0xcd, 0x00,
-    0xae, 0x04, 0xcd, 0x00, 0xcb, 0x04, 0xcd, 0x00, 0x6a, 0x04, 0xcd, 0x00, 0x7a, 0x04, 0xcd, 0x00, 0x6a, 0x04, 0xcd,
-    0x00, 0x7a, 0x04, 0xcd, 0x00, 0x6a, 0x04, 0xcd, 0x00, 0x7a, 0x04, 0xcd, 0x00, 0x00, 0x04, 0xcd, 0xff, 0xed, 0x04,
-    0xcd, 0x00, 0x6a, 0x04, 0xcd, 0x00, 0x7a, 0x04, 0xcd, 0x00, 0x6a, 0x04, 0xcd, 0x00, 0x7a, 0x04, 0xcd, 0x00, 0x6a,
-    0x04, 0xcd, 0x00, 0x7a, 0x04, 0xcd, 0x00, 0x63, 0x04, 0xcd, 0x00, 0x77, 0x04, 0xcd, 0x00, 0x63, 0x04, 0xcd, 0x00,
-    0x77, 0x04, 0xcd, 0x00, 0x63, 0x04, 0xcd, 0x00, 0x77, 0x04, 0xcd, 0x00, 0x63, 0x04, 0xcd, 0x00, 0x77, 0x04, 0xcd,
-    0x00, 0x63, 0x04, 0xcd, 0x00, 0x77, 0x04, 0xcd, 0x00, 0x8b, 0x04, 0xcd, 0x00, 0xb4, 0x04, 0xcd, 0x00, 0x8b, 0x04,
-    0xcd, 0x00, 0xb4, 0x04, 0xcd, 0x00, 0x8b, 0x04, 0xcd, 0x00, 0xb4, 0x04, 0xcd, 0x00, 0x8b, 0x04, 0xcd, 0x00, 0xb4,
-    0x04, 0xcd, 0x00, 0x8b, 0x04, 0xcd, 0x00, 0xb4, 0x04, 0xcd, 0x00, 0x8b, 0x04, 0xcd, 0x00, 0xb4, 0x04, 0xcd, 0x00,
-    0x8b, 0x04, 0xcd, 0x00, 0xb4, 0x04, 0xcd, 0x00, 0x3d, 0x04, 0xcd, 0x00, 0x44, 0x04, 0xcd, 0x00, 0x3d, 0x04, 0xcd,
-    0x00, 0x44, 0x04, 0xcd, 0x00, 0x3d, 0x04, 0xcd, 0x00, 0x44, 0x04, 0xeb, 0x00, 0x8b, 0x04, 0xeb, 0x00, 0x8b, 0x04,
-    0xcd, 0x00, 0xa9, 0x04, 0xcd, 0x00, 0xa4, 0x04, 0xcd, 0x00, 0x8d, 0x04, 0xcd, 0x00, 0xa5, 0x04, 0xcd, 0x00, 0x4c,
-    0x04, 0xcd, 0x00, 0x68, 0x04, 0xcd, 0x00, 0x57, 0x04, 0xcd, 0x00, 0x6e, 0x04, 0xcd, 0x00, 0xab, 0x04, 0xcd, 0x00,
-    0x8d, 0x04, 0xcd, 0x00, 0xab, 0x04, 0xcd, 0x00, 0x8d, 0x04, 0xcd, 0x00, 0xb5, 0x04, 0xcd, 0x00, 0xb7, 0x04, 0xcd,
-    0x00, 0x1d, 0x04, 0xcd, 0x00, 0x11, 0x04, 0xcd, 0x00, 0x26, 0x04, 0xcd, 0x00, 0x26, 0x04, 0xcd, 0x00, 0xae, 0x04,
-    0xcd, 0x00, 0x12, 0x04, 0xcd, 0xff, 0xd4, 0x04, 0xcd, 0xff, 0xd4, 0x04, 0xcd, 0xff, 0xfd, 0x04, 0xcd, 0xff, 0xfb,
-    0x04, 0xe1, 0x00, 0x09, 0x04, 0xe1, 0xff, 0xf3, 0x04, 0xcd, 0x00, 0xa2, 0x00, 0xa5, 0x00, 0x8d, 0x00, 0xa5, 0x00,
-    0x94, 0x00, 0x89, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x3d, 0x00, 0x47, 0x00, 0x57, 0x00, 0x6e, 0x00, 0x8b, 0x00, 0x11,
-    0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x36, 0x00, 0xa8, 0x01, 0x1e, 0x01, 0xba, 0x02, 0x64, 0x02, 0x8c, 0x02, 0xbc, 0x02, 0xec, 0x03, 0x1c,
-    0x03, 0x48, 0x03, 0x68, 0x03, 0x82, 0x03, 0xac, 0x03, 0xc4, 0x04, 0x16, 0x04, 0x32, 0x04, 0x80, 0x04, 0xf6, 0x05,
-    0x2a, 0x05, 0x88, 0x05, 0xf8, 0x06, 0x1c, 0x06, 0xa2, 0x07, 0x16, 0x07, 0x28, 0x07, 0x3c, 0x07, 0x56, 0x07, 0x7c,
-    0x07, 0x96, 0x08, 0x42, 0x09, 0x18, 0x09, 0x48, 0x09, 0xb2, 0x0a, 0x14, 0x0a, 0x58, 0x0a, 0x86, 0x0a, 0xae, 0x0b,
-    0x16, 0x0b, 0x3e, 0x0b, 0x68, 0x0b, 0xa0, 0x0b, 0xcc, 0x0b, 0xe8, 0x0c, 0x20, 0x0c, 0x46, 0x0c, 0xa6, 0x0c, 0xea,
-    0x0d, 0x56, 0x0d, 0xa0, 0x0e, 0x10, 0x0e, 0x32, 0x0e, 0x6e, 0x0e, 0x8e, 0x0e, 0xbc, 0x0e, 0xec, 0x0f, 0x12, 0x0f,
-    0x3e, 0x0f, 0x62, 0x0f, 0x7a, 0x0f, 0x9e, 0x0f, 0xc2, 0x0f, 0xdc, 0x10, 0x58, 0x10, 0xd0, 0x11, 0x62, 0x11, 0xbc,
-    0x12, 0x40, 0x12, 0xa0, 0x12, 0xe6, 0x13, 0x86, 0x13, 0xd0, 0x14, 0x0e, 0x14, 0x60, 0x14, 0xa0, 0x14, 0xd6, 0x15,
-    0x46, 0x15, 0x94, 0x15, 0xe2, 0x16, 0x50, 0x16, 0xca, 0x17, 0x22, 0x17, 0x8e, 0x17, 0xdc, 0x18, 0x24, 0x18, 0x4a,
-    0x18, 0x80, 0x18, 0xb0, 0x18, 0xf4, 0x19, 0x1e, 0x19, 0x76, 0x19, 0x8e, 0x19, 0xe4, 0x1a, 0x34, 0x1a, 0x70, 0x1a,
-    0xda, 0x1b, 0x3a, 0x1b, 0xc0, 0x1c, 0x04, 0x1c, 0x2a, 0x1c, 0xcc, 0x1c, 0xfe, 0x1d, 0x8e, 0x1e, 0x30, 0x1e, 0x48,
-    0x1e, 0x78, 0x1e, 0xfa, 0x1f, 0x12, 0x1f, 0x5c, 0x1f, 0x92, 0x20, 0x0e, 0x20, 0x8c, 0x21, 0x08, 0x21, 0x5e, 0x21,
-    0x88, 0x21, 0xac, 0x21, 0xe4, 0x22, 0x00, 0x22, 0x4c, 0x22, 0x5a, 0x22, 0x76, 0x22, 0x92, 0x22, 0xae, 0x23, 0x2a,
-    0x23, 0x70, 0x23, 0x96, 0x24, 0x1a, 0x24, 0x64, 0x24, 0xe6, 0x25, 0x94, 0x26, 0x08, 0x26, 0x4c, 0x26, 0xbe, 0x27,
-    0x18, 0x27, 0x5c, 0x27, 0x82, 0x27, 0xd2, 0x28, 0x50, 0x28, 0x7c, 0x28, 0xac, 0x28, 0xf6, 0x29, 0x40, 0x29, 0xac,
-    0x2a, 0x5c, 0x2a, 0xec, 0x2b, 0x22, 0x2b, 0x80, 0x2c, 0x06, 0x2c, 0x66, 0x2c, 0xb8, 0x2d, 0x18, 0x2d, 0x54, 0x2d,
-    0xb8, 0x2d, 0xda, 0x2d, 0xfc, 0x2e, 0x2e, 0x2e, 0x4e, 0x2e, 0x92, 0x2e, 0xc8, 0x2f, 0x20, 0x2f, 0x42, 0x2f, 0x92,
-    0x2f, 0xa8, 0x2f, 0xbe, 0x2f, 0xc8, 0x30, 0x02, 0x30, 0x24, 0x30, 0x46, 0x30, 0x60, 0x30, 0x9e, 0x30, 0xa6, 0x30,
-    0xc4, 0x30, 0xea, 0x31, 0x56, 0x31, 0x76, 0x31, 0xa6, 0x31, 0xc6, 0x31, 0xfc, 0x32, 0x54, 0x32, 0x96, 0x32, 0xf0,
-    0x33, 0xa4, 0x34, 0x38, 0x34, 0x62, 0x34, 0xe0, 0x35, 0x5a, 0x35, 0xae, 0x35, 0xfe, 0x36, 0x64, 0x36, 0x9e, 0x37,
-    0xb2, 0x38, 0x28, 0x38, 0x8a, 0x38, 0xe4, 0x39, 0x40, 0x39, 0x92, 0x39, 0xd2, 0x3a, 0x14, 0x3a, 0x76, 0x3a, 0xc2,
-    0x3b, 0x26, 0x3b, 0xbe, 0x3c, 0x3a, 0x3c, 0xa2, 0x3d, 0x3e, 0x3d, 0xa2, 0x3e, 0x00, 0x3e, 0x66, 0x3e, 0xaa, 0x3e,
-    0xd4, 0x3f, 0x1e, 0x3f, 0x60, 0x3f, 0xa2, 0x40, 0x1a, 0x40, 0x40, 0x40, 0x74, 0x40, 0xb6, 0x40, 0xe0, 0x41, 0x22,
-    0x41, 0x4e, 0x41, 0x84, 0x41, 0xcc, 0x42, 0x16, 0x42, 0x58, 0x42, 0xbc, 0x43, 0x32, 0x43, 0x7c, 0x43, 0xf6, 0x44,
-    0x50, 0x44, 0x6e, 0x44, 0xb6, 0x44, 0xf8, 0x45, 0x70, 0x45, 0x96, 0x45, 0xc6, 0x45, 0xfe, 0x46, 0x28, 0x46, 0x50,
-    0x46, 0x70, 0x46, 0x92, 0x46, 0xf0, 0x47, 0x1a, 0x47, 0x52, 0x47, 0x7e, 0x47, 0xb4, 0x47, 0xfc, 0x48, 0x46, 0x48,
-    0x88, 0x48, 0xec, 0x49, 0x62, 0x49, 0xae, 0x4a, 0x18, 0x4a, 0x7c, 0x4a, 0xda, 0x4b, 0x2a, 0x4b, 0x74, 0x4b, 0xa2,
-    0x4b, 0xf2, 0x4c, 0x40, 0x4c, 0x94, 0x4d, 0x44, 0x4d, 0xd2, 0x4e, 0x08, 0x4e, 0x40, 0x4e, 0x84, 0x4e, 0xc8, 0x4f,
-    0x24, 0x4f, 0x7e, 0x4f, 0xda, 0x50, 0x36, 0x50, 0xc4, 0x51, 0x50, 0x51, 0xc4, 0x52, 0x22, 0x52, 0x6a, 0x52, 0xc0,
-    0x53, 0x4a, 0x53, 0xea, 0x54, 0x9e, 0x55, 0x74, 0x56, 0x24, 0x56, 0xf6, 0x57, 0x76, 0x57, 0xf6, 0x58, 0x54, 0x58,
-    0xb2, 0x58, 0xf2, 0x59, 0x4c, 0x59, 0x98, 0x59, 0xb2, 0x59, 0xca, 0x5b, 0x52, 0x5b, 0xe0, 0x5c, 0x32, 0x5c, 0xaa,
-    0x5c, 0xce, 0x5c, 0xf2, 0x5d, 0x34, 0x5d, 0x78, 0x5d, 0xbc, 0x5d, 0xfe, 0x5e, 0x34, 0x5e, 0x6a, 0x5e, 0x9a, 0x5e,
-    0xca, 0x5f, 0x10, 0x5f, 0x5a, 0x5f, 0xda, 0x60, 0x54, 0x60, 0x8c, 0x60, 0xc0, 0x61, 0x2a, 0x61, 0xa0, 0x61, 0xe0,
-    0x62, 0x56, 0x62, 0xca, 0x63, 0x0e, 0x63, 0x52, 0x63, 0x9c, 0x63, 0xe6, 0x64, 0x4c, 0x64, 0xa0, 0x65, 0x0c, 0x65,
-    0x22, 0x65, 0x38, 0x65, 0x7e, 0x65, 0xf4, 0x66, 0x74, 0x66, 0xe4, 0x67, 0x4a, 0x67, 0xba, 0x68, 0x24, 0x68, 0x98,
-    0x69, 0x12, 0x69, 0x80, 0x69, 0xea, 0x6a, 0x4c, 0x6a, 0xaa, 0x6a, 0xf6, 0x6b, 0x40, 0x6b, 0xbc, 0x6b, 0xbc, 0x6b,
-    0xbc, 0x6b, 0xbc, 0x6b, 0xbc, 0x6b, 0xbc, 0x6b, 0xbc, 0x6b, 0xbc, 0x6b, 0xbc, 0x6b, 0xbc, 0x6b, 0xbc, 0x6b, 0xbc,
-    0x6b, 0xbc, 0x6b, 0xc8, 0x6b, 0xd4, 0x6b, 0xe6, 0x6c, 0x06, 0x6c, 0x26, 0x6c, 0x46, 0x6c, 0x52, 0x6c, 0x60, 0x6c,
-    0x6e, 0x6c, 0xa0, 0x6c, 0xca, 0x6d, 0x08, 0x6d, 0x38, 0x6d, 0x46, 0x6d, 0x58, 0x6e, 0x2c, 0x6e, 0x50, 0x6e, 0x7a,
-    0x6e, 0x8c, 0x6e, 0xc0, 0x6f, 0x1c, 0x6f, 0x8c, 0x70, 0x2a, 0x70, 0x98, 0x71, 0x1c, 0x71, 0x66, 0x71, 0xc2, 0x71,
-    0xee, 0x72, 0x30, 0x72, 0x48, 0x72, 0x64, 0x72, 0x80, 0x72, 0x98, 0x72, 0xf2, 0x73, 0x08, 0x73, 0x2a, 0x73, 0x44,
-    0x73, 0x60, 0x73, 0xe0, 0x74, 0x16, 0x74, 0x7e, 0x74, 0xa6, 0x74, 0xc0, 0x74, 0xda, 0x75, 0x02, 0x75, 0x1c, 0x75,
-    0x1c, 0x76, 0x02, 0x76, 0x5c, 0x76, 0xa0, 0x76, 0xe6, 0x77, 0x24, 0x77, 0x56, 0x77, 0x74, 0x77, 0x92, 0x77, 0xc0,
-    0x77, 0xdc, 0x78, 0x0c, 0x78, 0x76, 0x78, 0xcc, 0x79, 0x0e, 0x79, 0x3c, 0x79, 0x64, 0x79, 0xc2, 0x79, 0xea, 0x7a,
-    0x14, 0x7a, 0x4a, 0x7a, 0x76, 0x7a, 0x92, 0x7a, 0xc0, 0x7a, 0xe6, 0x7b, 0x36, 0x7b, 0x92, 0x7b, 0xda, 0x7c, 0x52,
-    0x7c, 0x72, 0x7c, 0xae, 0x7c, 0xd4, 0x7d, 0x02, 0x7d, 0x32, 0x7d, 0x58, 0x7d, 0x82, 0x7d, 0xc0, 0x7d, 0xd4, 0x7e,
-    0x10, 0x7e, 0x6c, 0x7e, 0x90, 0x7e, 0xd2, 0x7f, 0x22, 0x7f, 0x3a, 0x7f, 0xae, 0x7f, 0xfe, 0x80, 0x36, 0x80, 0x4a,
-    0x80, 0x76, 0x80, 0xbc, 0x80, 0xf0, 0x81, 0x30, 0x81, 0x76, 0x81, 0x8e, 0x82, 0x34, 0x82, 0x7a, 0x82, 0x8c, 0x82,
-    0xc8, 0x82, 0xea, 0x83, 0x34, 0x83, 0x4e, 0x83, 0x7a, 0x83, 0xac, 0x84, 0x40, 0x84, 0x66, 0x84, 0x8c, 0x84, 0xb4,
-    0x84, 0xbc, 0x84, 0xc4, 0x85, 0x08, 0x85, 0x54, 0x85, 0x9c, 0x85, 0xcc, 0x86, 0x0a, 0x86, 0x3a, 0x86, 0x54, 0x86,
-    0xcc, 0x87, 0x2a, 0x87, 0x76, 0x87, 0xec, 0x87, 0xf4, 0x87, 0xfc, 0x88, 0x04, 0x88, 0x56, 0x88, 0xa8, 0x89, 0x08,
-    0x89, 0x3a, 0x89, 0x98, 0x89, 0xaa, 0x89, 0xbc, 0x89, 0xce, 0x89, 0xe0, 0x89, 0xf2, 0x8a, 0x04, 0x8a, 0x16, 0x8a,
-    0x22, 0x8a, 0x34, 0x8a, 0x46, 0x8a, 0x58, 0x8a, 0x6a, 0x8a, 0x7c, 0x8a, 0x8e, 0x8a, 0xa0, 0x8a, 0xb2, 0x8a, 0xc4,
-    0x8a, 0xd6, 0x8a, 0xe8, 0x8a, 0xfa, 0x8b, 0x0c, 0x8b, 0x1e, 0x8b, 0x30, 0x8b, 0x42, 0x8b, 0x54, 0x8b, 0x66, 0x8b,
-    0x78, 0x8b, 0x88, 0x8b, 0x9a, 0x8b, 0xac, 0x8b, 0xbe, 0x8b, 0xce, 0x8b, 0xde, 0x8b, 0xee, 0x8b, 0xfa, 0x8c, 0x0a,
-    0x8c, 0x1a, 0x8c, 0x2a, 0x8c, 0x3a, 0x8c, 0x4a, 0x8c, 0x56, 0x8c, 0x68, 0x8c, 0x78, 0x8c, 0x88, 0x8c, 0x98, 0x8c,
-    0xa8, 0x8c, 0xb8, 0x8c, 0xca, 0x8c, 0xda, 0x8c, 0xea, 0x8c, 0xfa, 0x8d, 0x0a, 0x8d, 0x1a, 0x8d, 0x2c, 0x8d, 0x3c,
-    0x8d, 0x4e, 0x8d, 0x5e, 0x8d, 0x70, 0x8d, 0x80, 0x8d, 0xd8, 0x8e, 0x74, 0x8e, 0x86, 0x8e, 0x98, 0x8e, 0xaa, 0x8e,
-    0xbc, 0x8e, 0xce, 0x8e, 0xde, 0x8e, 0xf0, 0x8f, 0x00, 0x8f, 0x12, 0x8f, 0x24, 0x8f, 0x36, 0x8f, 0x46, 0x8f, 0x58,
-    0x8f, 0x68, 0x8f, 0x7a, 0x8f, 0x8a, 0x8f, 0xe0, 0x90, 0x60, 0x90, 0x72, 0x90, 0x82, 0x90, 0x94, 0x90, 0xa4, 0x90,
-    0xb6, 0x90, 0xc6, 0x90, 0xd8, 0x90, 0xe8, 0x90, 0xfa, 0x91, 0x0a, 0x91, 0x1c, 0x91, 0x2e, 0x91, 0x40, 0x91, 0x52,
-    0x91, 0x64, 0x91, 0x76, 0x91, 0x88, 0x91, 0x98, 0x91, 0xec, 0x92, 0x52, 0x92, 0x64, 0x92, 0x76, 0x92, 0x88, 0x92,
-    0x9a, 0x92, 0xac, 0x92, 0xbe, 0x92, 0xd0, 0x92, 0xe2, 0x92, 0xf4, 0x93, 0x06, 0x93, 0x18, 0x93, 0x2a, 0x93, 0x3c,
-    0x93, 0x4e, 0x93, 0x5e, 0x93, 0x70, 0x93, 0x82, 0x93, 0x94, 0x93, 0xa4, 0x93, 0xb0, 0x93, 0xc2, 0x93, 0xd2, 0x93,
-    0xe4, 0x93, 0xf4, 0x94, 0x06, 0x94, 0x18, 0x94, 0x2a, 0x94, 0x3a, 0x94, 0x4c, 0x94, 0x5e, 0x94, 0x70, 0x94, 0x80,
-    0x94, 0x92, 0x94, 0xa4, 0x94, 0xb6, 0x94, 0xc8, 0x94, 0xda, 0x94, 0xec, 0x94, 0xfe, 0x95, 0x10, 0x95, 0x22, 0x95,
-    0x32, 0x95, 0x44, 0x95, 0x56, 0x95, 0x62, 0x95, 0x72, 0x95, 0x7e, 0x95, 0x90, 0x95, 0xa2, 0x95, 0xb4, 0x95, 0xc6,
-    0x95, 0xd8, 0x95, 0xea, 0x95, 0xfc, 0x96, 0x0c, 0x96, 0x1e, 0x96, 0x2e, 0x96, 0x40, 0x96, 0x52, 0x96, 0xc8, 0x97,
-    0x28, 0x97, 0x3a, 0x97, 0x4a, 0x97, 0x5c, 0x97, 0x6e, 0x97, 0x80, 0x97, 0x92, 0x97, 0xa4, 0x97, 0xb6, 0x97, 0xc6,
-    0x97, 0xd8, 0x97, 0xe8, 0x97, 0xfa, 0x98, 0x0c, 0x98, 0x1e, 0x98, 0x2e, 0x98, 0x40, 0x98, 0x52, 0x98, 0x64, 0x98,
-    0x74, 0x98, 0x84, 0x98, 0x94, 0x98, 0xa6, 0x98, 0xb6, 0x98, 0xc8, 0x98, 0xda, 0x98, 0xec, 0x98, 0xfe, 0x99, 0x0e,
-    0x99, 0x1e, 0x99, 0x2e, 0x99, 0x3e, 0x99, 0x50, 0x99, 0x62, 0x99, 0x72, 0x99, 0x84, 0x99, 0x94, 0x99, 0xa6, 0x99,
-    0xb8, 0x99, 0xca, 0x99, 0xda, 0x99, 0xea, 0x99, 0xfc, 0x9a, 0x0e, 0x9a, 0x1e, 0x9a, 0x2e, 0x9a, 0x3e, 0x9a, 0x4e,
-    0x9a, 0xa8, 0x9a, 0xb8, 0x9a, 0xc8, 0x9a, 0xd8, 0x9a, 0xe8, 0x9a, 0xf8, 0x9b, 0x08, 0x9b, 0x18, 0x9b, 0x28, 0x9b,
-    0x7e, 0x9b, 0x8e, 0x9b, 0x9e, 0x9b, 0xae, 0x9b, 0xbe, 0x9b, 0xd0, 0x9b, 0xe2, 0x9b, 0xf4, 0x9c, 0x04, 0x9c, 0x14,
-    0x9c, 0x66, 0x9c, 0x76, 0x9c, 0x88, 0x9c, 0x9a, 0x9c, 0xac, 0x9c, 0xbe, 0x9c, 0xd0, 0x9c, 0xe2, 0x9c, 0xf4, 0x9d,
-    0x06, 0x9d, 0x16, 0x9d, 0x26, 0x9d, 0x36, 0x9d, 0x48, 0x9d, 0x58, 0x9d, 0x6a, 0x9d, 0x7a, 0x9d, 0x8a, 0x9d, 0x9a,
-    0x9d, 0xa6, 0x9d, 0xb6, 0x9d, 0xc8, 0x9d, 0xd8, 0x9d, 0xea, 0x9d, 0xfa, 0x9e, 0x0a, 0x9e, 0x1c, 0x9e, 0x2e, 0x9e,
-    0xa6, 0x9e, 0xb8, 0x9e, 0xc8, 0x9e, 0xd8, 0x9e, 0xea, 0x9e, 0xfa, 0x9f, 0x0a, 0x9f, 0x16, 0x9f, 0x22, 0x9f, 0x34,
-    0x9f, 0x46, 0x9f, 0x52, 0x9f, 0x5e, 0x9f, 0x6a, 0x9f, 0x7c, 0x9f, 0x84, 0x9f, 0x8c, 0x9f, 0x94, 0x9f, 0x9c, 0x9f,
-    0xa4, 0x9f, 0xac, 0x9f, 0xb4, 0x9f, 0xbc, 0x9f, 0xc4, 0x9f, 0xcc, 0x9f, 0xd4, 0x9f, 0xdc, 0x9f, 0xe4, 0x9f, 0xec,
-    0x9f, 0xfe, 0xa0, 0x10, 0xa0, 0x20, 0xa0, 0x30, 0xa0, 0x40, 0xa0, 0x52, 0xa0, 0x64, 0xa0, 0x6c, 0xa0, 0x74, 0xa0,
-    0x7c, 0xa0, 0x84, 0xa0, 0x8c, 0xa0, 0x9c, 0xa0, 0xac, 0xa0, 0xbc, 0xa0, 0xce, 0xa0, 0xe0, 0xa0, 0xf2, 0xa1, 0x04,
-    0xa1, 0x74, 0xa1, 0x7c, 0xa1, 0x8e, 0xa1, 0x96, 0xa1, 0x9e, 0xa1, 0xb0, 0xa1, 0xc2, 0xa1, 0xca, 0xa1, 0xd2, 0xa1,
-    0xda, 0xa1, 0xe2, 0xa1, 0xf4, 0xa1, 0xfc, 0xa2, 0x04, 0xa2, 0x0c, 0xa2, 0x14, 0xa2, 0x1c, 0xa2, 0x24, 0xa2, 0x2c,
-    0xa2, 0x34, 0xa2, 0x3c, 0xa2, 0x44, 0xa2, 0x4c, 0xa2, 0x5c, 0xa2, 0x64, 0xa2, 0x6c, 0xa2, 0xc6, 0xa2, 0xce, 0xa2,
-    0xd6, 0xa2, 0xe6, 0xa2, 0xf2, 0xa2, 0xfa, 0xa3, 0x02, 0xa3, 0x12, 0xa3, 0x1a, 0xa3, 0x26, 0xa3, 0x36, 0xa3, 0x48,
-    0xa3, 0x58, 0xa3, 0x6a, 0xa3, 0x7a, 0xa3, 0x8c, 0xa3, 0x9c, 0xa3, 0xae, 0xa3, 0xbe, 0xa3, 0xc6, 0xa3, 0xce, 0xa3,
-    0xda, 0xa3, 0xec, 0xa3, 0xf4, 0xa4, 0x06, 0xa4, 0x18, 0xa4, 0x24, 0xa4, 0x30, 0xa4, 0x42, 0xa4, 0x54, 0xa4, 0x66,
-    0xa4, 0x76, 0xa4, 0x88, 0xa4, 0x90, 0xa4, 0x98, 0xa4, 0xaa, 0xa4, 0xbc, 0xa4, 0xce, 0xa4, 0xe0, 0xa4, 0xf2, 0xa5,
-    0x04, 0xa5, 0x0c, 0xa5, 0x14, 0xa5, 0x1c, 0xa5, 0x2e, 0xa5, 0x3e, 0xa5, 0x46, 0xa5, 0x58, 0xa5, 0x68, 0xa5, 0x7a,
-    0xa5, 0x8a, 0xa5, 0x92, 0xa5, 0x9a, 0xa5, 0xac, 0xa5, 0xbc, 0xa5, 0xce, 0xa5, 0xd6, 0xa5, 0xe6, 0xa5, 0xf8, 0xa6,
-    0x08, 0xa6, 0x1a, 0xa6, 0x2a, 0xa6, 0x3c, 0xa6, 0x4e, 0xa6, 0x60, 0xa6, 0x70, 0xa6, 0x82, 0xa6, 0x92, 0xa6, 0x9a,
-    0xa6, 0xa2, 0xa6, 0xb4, 0xa6, 0xc4, 0xa6, 0xd6, 0xa6, 0xe6, 0xa6, 0xf8, 0xa7, 0x0a, 0xa7, 0x1c, 0xa7, 0x2c, 0xa7,
-    0x3e, 0xa7, 0x50, 0xa7, 0x62, 0xa7, 0x72, 0xa7, 0x84, 0xa7, 0x94, 0xa7, 0xa0, 0xa7, 0xac, 0xa7, 0xb4, 0xa7, 0xc0,
-    0xa7, 0xcc, 0xa7, 0xd8, 0xa7, 0xe4, 0xa7, 0xf6, 0xa8, 0x08, 0xa8, 0x1a, 0xa8, 0x2a, 0xa8, 0x3c, 0xa8, 0x4c, 0xa8,
-    0x5e, 0xa8, 0x70, 0xa8, 0x82, 0xa8, 0x94, 0xa8, 0xaa, 0xa8, 0xc0, 0xa8, 0xd2, 0xa8, 0xe2, 0xa8, 0xf4, 0xa9, 0x04,
-    0xa9, 0x16, 0xa9, 0x26, 0xa9, 0x38, 0xa9, 0x48, 0xa9, 0x5e, 0xa9, 0x72, 0xa9, 0x84, 0xa9, 0x90, 0xa9, 0xa2, 0xa9,
-    0xb4, 0xa9, 0xc6, 0xa9, 0xd8, 0xa9, 0xea, 0xa9, 0xfa, 0xaa, 0x0c, 0xaa, 0x1c, 0xaa, 0x2e, 0xaa, 0x40, 0xaa, 0x52,
-    0xaa, 0x64, 0xaa, 0x7e, 0xaa, 0x92, 0xaa, 0xa4, 0xaa, 0xb6, 0xaa, 0xc8, 0xaa, 0xda, 0xaa, 0xec, 0xaa, 0xfe, 0xab,
-    0x10, 0xab, 0x22, 0xab, 0x34, 0xab, 0x44, 0xab, 0x56, 0xab, 0x66, 0xab, 0x78, 0xab, 0x8a, 0xab, 0x9c, 0xab, 0xae,
-    0xab, 0xc8, 0xab, 0xe2, 0xab, 0xf4, 0xac, 0x04, 0xac, 0x16, 0xac, 0x26, 0xac, 0x38, 0xac, 0x4a, 0xac, 0x5c, 0xac,
-    0x6e, 0xac, 0x7a, 0xac, 0x8c, 0xac, 0x98, 0xac, 0xa4, 0xac, 0xb6, 0xac, 0xc8, 0xac, 0xda, 0xac, 0xe6, 0xac, 0xf8,
-    0xad, 0x08, 0xad, 0x1a, 0xad, 0x2c, 0xad, 0x3e, 0xad, 0x50, 0xad, 0x62, 0xad, 0x6e, 0xad, 0x80, 0xad, 0x92, 0xad,
-    0xa4, 0xad, 0xb6, 0xad, 0xc8, 0xad, 0xda, 0xae, 0x78, 0xae, 0x92, 0xae, 0xa4, 0xae, 0xb0, 0xae, 0xbc, 0xae, 0xc8,
-    0xae, 0xd4, 0xae, 0xe0, 0xae, 0xec, 0xae, 0xf8, 0xaf, 0x04, 0xaf, 0x10, 0xaf, 0x1c, 0xaf, 0x28, 0xaf, 0x34, 0xaf,
-    0x40, 0xaf, 0x4c, 0xaf, 0x58, 0xaf, 0x6a, 0xaf, 0x7c, 0xaf, 0x84, 0xaf, 0xd6, 0xb0, 0x28, 0xb0, 0x7a, 0xb0, 0xa8,
-    0xb0, 0xd6, 0xb1, 0x16, 0xb1, 0x56, 0xb1, 0x70, 0xb1, 0x8a, 0xb1, 0x9c, 0xb1, 0xae, 0xb1, 0xc0, 0xb1, 0xd2, 0xb1,
-    0xe4, 0xb1, 0xf6, 0xb2, 0x2a, 0xb2, 0x62, 0xb2, 0xa0, 0xb2, 0xde, 0xb2, 0xe6, 0xb2, 0xf8, 0xb3, 0x04, 0xb3, 0x04,
-    0xb3, 0x04, 0xb3, 0x5e, 0x00, 0x01, 0x00, 0x00, 0x04, 0x11, 0x00, 0xb0, 0x00, 0x16, 0x00, 0x70, 0x00, 0x05, 0x00,
-    0x02, 0x00, 0x50, 0x00, 0x60, 0x00, 0x77, 0x00, 0x00, 0x00, 0xdd, 0x0b, 0x97, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x0d, 0x00, 0xa2, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x03, 0x00,
-    0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x16, 0x00, 0x5e, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x02, 0x00, 0x0e,
-    0x00, 0x74, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x2e, 0x00, 0x82, 0x00, 0x03, 0x00, 0x01, 0x04,
-    0x09, 0x00, 0x04, 0x00, 0x16, 0x00, 0xb0, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x54, 0x00, 0xc6,
-    0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x06, 0x00, 0x24, 0x01, 0x1a, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00,
-    0x07, 0x00, 0x4a, 0x01, 0x3e, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x09, 0x00, 0x0c, 0x01, 0x88, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x00, 0x0b, 0x00, 0x14, 0x01, 0x94, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0c, 0x00,
-    0x26, 0x01, 0xa8, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0d, 0x00, 0x5c, 0x01, 0xce, 0x00, 0x03, 0x00, 0x01,
-    0x04, 0x09, 0x00, 0x0e, 0x00, 0x54, 0x02, 0x2a, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00,
-    0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x35, 0x00, 0x20,
-    0x00, 0x47, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x67, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x20, 0x00, 0x49, 0x00, 0x6e, 0x00,
-    0x63, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x41, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x20, 0x00, 0x52, 0x00, 0x69, 0x00, 0x67,
-    0x00, 0x68, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20, 0x00, 0x52, 0x00, 0x65, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00,
-    0x76, 0x00, 0x65, 0x00, 0x64, 0x00, 0x2e, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f,
-    0x00, 0x20, 0x00, 0x4d, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00,
-    0x6c, 0x00, 0x61, 0x00, 0x72, 0x00, 0x47, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x67, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x3a,
-    0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x4d, 0x00, 0x6f, 0x00,
-    0x6e, 0x00, 0x6f, 0x00, 0x3a, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x35, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62,
-    0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x4d, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x56, 0x00,
-    0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x32, 0x00, 0x2e, 0x00, 0x30,
-    0x00, 0x30, 0x00, 0x30, 0x00, 0x39, 0x00, 0x38, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00,
-    0x31, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x20, 0x00, 0x74, 0x00, 0x74, 0x00, 0x66, 0x00, 0x61, 0x00, 0x75, 0x00, 0x74,
-    0x00, 0x6f, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x28, 0x00, 0x76, 0x00, 0x31, 0x00,
-    0x2e, 0x00, 0x33, 0x00, 0x29, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x4d,
-    0x00, 0x6f, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x2d, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00,
-    0x61, 0x00, 0x72, 0x00, 0x52, 0x00, 0x6f, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x4d,
-    0x00, 0x6f, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00, 0x20, 0x00,
-    0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x72, 0x00, 0x6b, 0x00, 0x20,
-    0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x47, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x67, 0x00, 0x6c, 0x00, 0x65, 0x00,
-    0x2e, 0x00, 0x47, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x67, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x47, 0x00, 0x6f, 0x00, 0x6f,
-    0x00, 0x67, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x2e, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x43, 0x00, 0x68, 0x00,
-    0x72, 0x00, 0x69, 0x00, 0x73, 0x00, 0x74, 0x00, 0x69, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x52, 0x00, 0x6f,
-    0x00, 0x62, 0x00, 0x65, 0x00, 0x72, 0x00, 0x74, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x4c, 0x00, 0x69, 0x00,
-    0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x64,
-    0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x41, 0x00, 0x70, 0x00,
-    0x61, 0x00, 0x63, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e,
-    0x00, 0x73, 0x00, 0x65, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00,
-    0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x32, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70,
-    0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x77, 0x00, 0x77, 0x00, 0x77, 0x00, 0x2e, 0x00, 0x61, 0x00, 0x70, 0x00,
-    0x61, 0x00, 0x63, 0x00, 0x68, 0x00, 0x65, 0x00, 0x2e, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x67, 0x00, 0x2f, 0x00, 0x6c,
-    0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x73, 0x00, 0x2f, 0x00, 0x4c, 0x00,
-    0x49, 0x00, 0x43, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x53, 0x00, 0x45, 0x00, 0x2d, 0x00, 0x32, 0x00, 0x2e, 0x00, 0x30,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x6a, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x00, 0x00, 0x01, 0x02,
-    0x00, 0x02, 0x00, 0x03, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x0b, 0x00,
-    0x0c, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15,
-    0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e, 0x00,
-    0x1f, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28,
-    0x00, 0x29, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x30, 0x00, 0x31, 0x00,
-    0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b,
-    0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00,
-    0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e,
-    0x00, 0x4f, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00,
-    0x58, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x61,
-    0x00, 0xa3, 0x00, 0x84, 0x00, 0x85, 0x00, 0xbd, 0x00, 0x96, 0x00, 0xe8, 0x00, 0x86, 0x00, 0x8e, 0x00, 0x8b, 0x00,
-    0x9d, 0x00, 0xa9, 0x00, 0xa4, 0x00, 0x8a, 0x01, 0x03, 0x00, 0x83, 0x00, 0x93, 0x00, 0xf2, 0x00, 0xf3, 0x00, 0x8d,
-    0x00, 0x97, 0x00, 0x88, 0x01, 0x04, 0x00, 0xde, 0x00, 0xf1, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xf5, 0x00, 0xf4, 0x00,
-    0xf6, 0x00, 0xa2, 0x00, 0x90, 0x00, 0xf0, 0x00, 0x91, 0x00, 0xed, 0x00, 0x89, 0x00, 0xa0, 0x00, 0xea, 0x00, 0xb8,
-    0x00, 0xa1, 0x00, 0xee, 0x01, 0x05, 0x00, 0xd7, 0x01, 0x06, 0x01, 0x07, 0x01, 0x08, 0x00, 0xe2, 0x00, 0xe3, 0x01,
-    0x09, 0x01, 0x0a, 0x00, 0xb0, 0x00, 0xb1, 0x01, 0x0b, 0x00, 0xa6, 0x01, 0x0c, 0x01, 0x0d, 0x01, 0x0e, 0x01, 0x0f,
-    0x01, 0x10, 0x01, 0x11, 0x00, 0xd8, 0x00, 0xe1, 0x00, 0xdb, 0x00, 0xdc, 0x00, 0xdd, 0x00, 0xe0, 0x00, 0xd9, 0x00,
-    0xdf, 0x01, 0x12, 0x01, 0x13, 0x01, 0x14, 0x01, 0x15, 0x01, 0x16, 0x01, 0x17, 0x01, 0x18, 0x01, 0x19, 0x01, 0x1a,
-    0x01, 0x1b, 0x01, 0x1c, 0x01, 0x1d, 0x01, 0x1e, 0x01, 0x1f, 0x01, 0x20, 0x01, 0x21, 0x01, 0x22, 0x01, 0x23, 0x01,
-    0x24, 0x00, 0x9f, 0x01, 0x25, 0x01, 0x26, 0x01, 0x27, 0x01, 0x28, 0x01, 0x29, 0x01, 0x2a, 0x01, 0x2b, 0x01, 0x2c,
-    0x01, 0x2d, 0x01, 0x2e, 0x01, 0x2f, 0x00, 0x9b, 0x01, 0x30, 0x01, 0x31, 0x01, 0x32, 0x01, 0x33, 0x01, 0x34, 0x01,
-    0x35, 0x01, 0x36, 0x01, 0x37, 0x01, 0x38, 0x01, 0x39, 0x01, 0x3a, 0x01, 0x3b, 0x01, 0x3c, 0x01, 0x3d, 0x01, 0x3e,
-    0x01, 0x3f, 0x01, 0x40, 0x01, 0x41, 0x01, 0x42, 0x01, 0x43, 0x01, 0x44, 0x01, 0x45, 0x01, 0x46, 0x01, 0x47, 0x01,
-    0x48, 0x01, 0x49, 0x01, 0x4a, 0x01, 0x4b, 0x01, 0x4c, 0x01, 0x4d, 0x01, 0x4e, 0x01, 0x4f, 0x01, 0x50, 0x01, 0x51,
-    0x01, 0x52, 0x01, 0x53, 0x01, 0x54, 0x01, 0x55, 0x01, 0x56, 0x01, 0x57, 0x01, 0x58, 0x01, 0x59, 0x01, 0x5a, 0x01,
-    0x5b, 0x01, 0x5c, 0x01, 0x5d, 0x01, 0x5e, 0x01, 0x5f, 0x01, 0x60, 0x01, 0x61, 0x01, 0x62, 0x01, 0x63, 0x01, 0x64,
-    0x01, 0x65, 0x01, 0x66, 0x01, 0x67, 0x01, 0x68, 0x01, 0x69, 0x01, 0x6a, 0x01, 0x6b, 0x01, 0x6c, 0x01, 0x6d, 0x01,
-    0x6e, 0x01, 0x6f, 0x01, 0x70, 0x01, 0x71, 0x01, 0x72, 0x01, 0x73, 0x01, 0x74, 0x01, 0x75, 0x01, 0x76, 0x01, 0x77,
-    0x01, 0x78, 0x01, 0x79, 0x01, 0x7a, 0x01, 0x7b, 0x01, 0x7c, 0x01, 0x7d, 0x01, 0x7e, 0x01, 0x7f, 0x01, 0x80, 0x01,
-    0x81, 0x01, 0x82, 0x01, 0x83, 0x01, 0x84, 0x01, 0x85, 0x01, 0x86, 0x01, 0x87, 0x01, 0x88, 0x01, 0x89, 0x01, 0x8a,
-    0x01, 0x8b, 0x01, 0x8c, 0x01, 0x8d, 0x01, 0x8e, 0x01, 0x8f, 0x01, 0x90, 0x01, 0x91, 0x01, 0x92, 0x01, 0x93, 0x01,
-    0x94, 0x01, 0x95, 0x01, 0x96, 0x01, 0x97, 0x01, 0x98, 0x01, 0x99, 0x01, 0x9a, 0x01, 0x9b, 0x01, 0x9c, 0x01, 0x9d,
-    0x01, 0x9e, 0x01, 0x9f, 0x01, 0xa0, 0x01, 0xa1, 0x01, 0xa2, 0x01, 0xa3, 0x01, 0xa4, 0x01, 0xa5, 0x01, 0xa6, 0x01,
-    0xa7, 0x01, 0xa8, 0x01, 0xa9, 0x01, 0xaa, 0x01, 0xab, 0x01, 0xac, 0x01, 0xad, 0x01, 0xae, 0x01, 0xaf, 0x01, 0xb0,
-    0x01, 0xb1, 0x01, 0xb2, 0x01, 0xb3, 0x01, 0xb4, 0x01, 0xb5, 0x01, 0xb6, 0x01, 0xb7, 0x01, 0xb8, 0x01, 0xb9, 0x01,
-    0xba, 0x01, 0xbb, 0x01, 0xbc, 0x01, 0xbd, 0x01, 0xbe, 0x01, 0xbf, 0x01, 0xc0, 0x01, 0xc1, 0x01, 0xc2, 0x01, 0xc3,
-    0x01, 0xc4, 0x01, 0xc5, 0x01, 0xc6, 0x01, 0xc7, 0x01, 0xc8, 0x01, 0xc9, 0x01, 0xca, 0x01, 0xcb, 0x01, 0xcc, 0x01,
-    0xcd, 0x01, 0xce, 0x01, 0xcf, 0x00, 0xb2, 0x00, 0xb3, 0x01, 0xd0, 0x00, 0xb6, 0x00, 0xb7, 0x00, 0xc4, 0x01, 0xd1,
-    0x00, 0xb4, 0x00, 0xb5, 0x00, 0xc5, 0x00, 0x82, 0x00, 0xc2, 0x00, 0x87, 0x01, 0xd2, 0x00, 0xab, 0x00, 0xc6, 0x00,
-    0xbe, 0x00, 0xbf, 0x00, 0xbc, 0x01, 0xd3, 0x01, 0xd4, 0x01, 0xd5, 0x01, 0xd6, 0x01, 0xd7, 0x01, 0xd8, 0x01, 0xd9,
-    0x01, 0xda, 0x00, 0x8c, 0x01, 0xdb, 0x01, 0xdc, 0x01, 0xdd, 0x01, 0xde, 0x01, 0xdf, 0x00, 0x98, 0x00, 0x9a, 0x00,
-    0x99, 0x00, 0xef, 0x00, 0xa5, 0x00, 0x92, 0x00, 0x9c, 0x00, 0xa7, 0x00, 0x8f, 0x00, 0x94, 0x00, 0x95, 0x00, 0xb9,
-    0x01, 0xe0, 0x01, 0xe1, 0x01, 0xe2, 0x01, 0xe3, 0x01, 0xe4, 0x01, 0xe5, 0x01, 0xe6, 0x01, 0xe7, 0x01, 0xe8, 0x01,
-    0xe9, 0x01, 0xea, 0x01, 0xeb, 0x01, 0xec, 0x01, 0xed, 0x01, 0xee, 0x01, 0xef, 0x01, 0xf0, 0x01, 0xf1, 0x01, 0xf2,
-    0x01, 0xf3, 0x01, 0xf4, 0x01, 0xf5, 0x01, 0xf6, 0x01, 0xf7, 0x01, 0xf8, 0x01, 0xf9, 0x01, 0xfa, 0x01, 0xfb, 0x01,
-    0xfc, 0x01, 0xfd, 0x01, 0xfe, 0x01, 0xff, 0x02, 0x00, 0x02, 0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05,
-    0x02, 0x06, 0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02, 0x0a, 0x02, 0x0b, 0x02, 0x0c, 0x02, 0x0d, 0x02, 0x0e, 0x02,
-    0x0f, 0x02, 0x10, 0x02, 0x11, 0x02, 0x12, 0x02, 0x13, 0x02, 0x14, 0x02, 0x15, 0x02, 0x16, 0x02, 0x17, 0x02, 0x18,
-    0x02, 0x19, 0x02, 0x1a, 0x02, 0x1b, 0x02, 0x1c, 0x02, 0x1d, 0x02, 0x1e, 0x02, 0x1f, 0x02, 0x20, 0x02, 0x21, 0x02,
-    0x22, 0x02, 0x23, 0x02, 0x24, 0x02, 0x25, 0x02, 0x26, 0x02, 0x27, 0x02, 0x28, 0x02, 0x29, 0x02, 0x2a, 0x02, 0x2b,
-    0x02, 0x2c, 0x02, 0x2d, 0x02, 0x2e, 0x02, 0x2f, 0x02, 0x30, 0x02, 0x31, 0x00, 0xac, 0x02, 0x32, 0x02, 0x33, 0x00,
-    0xe9, 0x02, 0x34, 0x02, 0x35, 0x02, 0x36, 0x00, 0xad, 0x00, 0xc9, 0x00, 0xc7, 0x00, 0xae, 0x00, 0x62, 0x00, 0x63,
-    0x02, 0x37, 0x00, 0x64, 0x00, 0xcb, 0x00, 0x65, 0x00, 0xc8, 0x00, 0xca, 0x00, 0xcf, 0x00, 0xcc, 0x00, 0xcd, 0x00,
-    0xce, 0x00, 0x66, 0x00, 0xd3, 0x00, 0xd0, 0x00, 0xd1, 0x00, 0xaf, 0x00, 0x67, 0x00, 0xd6, 0x00, 0xd4, 0x00, 0xd5,
-    0x00, 0x68, 0x00, 0xeb, 0x00, 0x6a, 0x00, 0x69, 0x00, 0x6b, 0x00, 0x6d, 0x00, 0x6c, 0x00, 0x6e, 0x02, 0x38, 0x00,
-    0x6f, 0x00, 0x71, 0x00, 0x70, 0x00, 0x72, 0x00, 0x73, 0x00, 0x75, 0x00, 0x74, 0x00, 0x76, 0x00, 0x77, 0x00, 0x78,
-    0x00, 0x7a, 0x00, 0x79, 0x00, 0x7b, 0x00, 0x7d, 0x00, 0x7c, 0x00, 0x7f, 0x00, 0x7e, 0x00, 0x80, 0x00, 0x81, 0x00,
-    0xec, 0x00, 0xba, 0x02, 0x39, 0x02, 0x3a, 0x02, 0x3b, 0x02, 0x3c, 0x02, 0x3d, 0x02, 0x3e, 0x00, 0xfd, 0x00, 0xfe,
-    0x02, 0x3f, 0x02, 0x40, 0x02, 0x41, 0x02, 0x42, 0x00, 0xff, 0x01, 0x00, 0x02, 0x43, 0x02, 0x44, 0x02, 0x45, 0x02,
-    0x46, 0x02, 0x47, 0x02, 0x48, 0x02, 0x49, 0x02, 0x4a, 0x02, 0x4b, 0x02, 0x4c, 0x02, 0x4d, 0x02, 0x4e, 0x02, 0x4f,
-    0x02, 0x50, 0x00, 0xf8, 0x00, 0xf9, 0x02, 0x51, 0x02, 0x52, 0x02, 0x53, 0x02, 0x54, 0x02, 0x55, 0x02, 0x56, 0x02,
-    0x57, 0x02, 0x58, 0x02, 0x59, 0x02, 0x5a, 0x02, 0x5b, 0x02, 0x5c, 0x02, 0x5d, 0x02, 0x5e, 0x02, 0x5f, 0x02, 0x60,
-    0x02, 0x61, 0x02, 0x62, 0x02, 0x63, 0x02, 0x64, 0x02, 0x65, 0x02, 0x66, 0x02, 0x67, 0x02, 0x68, 0x02, 0x69, 0x02,
-    0x6a, 0x02, 0x6b, 0x02, 0x6c, 0x02, 0x6d, 0x02, 0x6e, 0x02, 0x6f, 0x02, 0x70, 0x02, 0x71, 0x02, 0x72, 0x02, 0x73,
-    0x02, 0x74, 0x02, 0x75, 0x02, 0x76, 0x02, 0x77, 0x02, 0x78, 0x02, 0x79, 0x02, 0x7a, 0x02, 0x7b, 0x02, 0x7c, 0x02,
-    0x7d, 0x02, 0x7e, 0x02, 0x7f, 0x02, 0x80, 0x02, 0x81, 0x02, 0x82, 0x00, 0xfb, 0x00, 0xfc, 0x02, 0x83, 0x02, 0x84,
-    0x00, 0xe4, 0x00, 0xe5, 0x02, 0x85, 0x02, 0x86, 0x02, 0x87, 0x02, 0x88, 0x02, 0x89, 0x02, 0x8a, 0x02, 0x8b, 0x02,
-    0x8c, 0x02, 0x8d, 0x02, 0x8e, 0x02, 0x8f, 0x02, 0x90, 0x02, 0x91, 0x02, 0x92, 0x02, 0x93, 0x02, 0x94, 0x02, 0x95,
-    0x02, 0x96, 0x02, 0x97, 0x02, 0x98, 0x02, 0x99, 0x02, 0x9a, 0x02, 0x9b, 0x00, 0xbb, 0x02, 0x9c, 0x02, 0x9d, 0x02,
-    0x9e, 0x02, 0x9f, 0x00, 0xe6, 0x00, 0xe7, 0x02, 0xa0, 0x02, 0xa1, 0x02, 0xa2, 0x02, 0xa3, 0x02, 0xa4, 0x02, 0xa5,
-    0x02, 0xa6, 0x02, 0xa7, 0x02, 0xa8, 0x02, 0xa9, 0x02, 0xaa, 0x02, 0xab, 0x02, 0xac, 0x02, 0xad, 0x02, 0xae, 0x02,
-    0xaf, 0x02, 0xb0, 0x02, 0xb1, 0x02, 0xb2, 0x02, 0xb3, 0x02, 0xb4, 0x02, 0xb5, 0x02, 0xb6, 0x02, 0xb7, 0x02, 0xb8,
-    0x02, 0xb9, 0x02, 0xba, 0x02, 0xbb, 0x02, 0xbc, 0x02, 0xbd, 0x02, 0xbe, 0x02, 0xbf, 0x02, 0xc0, 0x02, 0xc1, 0x02,
-    0xc2, 0x02, 0xc3, 0x02, 0xc4, 0x02, 0xc5, 0x02, 0xc6, 0x02, 0xc7, 0x02, 0xc8, 0x02, 0xc9, 0x02, 0xca, 0x02, 0xcb,
-    0x02, 0xcc, 0x02, 0xcd, 0x02, 0xce, 0x02, 0xcf, 0x02, 0xd0, 0x02, 0xd1, 0x02, 0xd2, 0x02, 0xd3, 0x02, 0xd4, 0x02,
-    0xd5, 0x02, 0xd6, 0x02, 0xd7, 0x02, 0xd8, 0x02, 0xd9, 0x02, 0xda, 0x02, 0xdb, 0x02, 0xdc, 0x02, 0xdd, 0x02, 0xde,
-    0x02, 0xdf, 0x02, 0xe0, 0x02, 0xe1, 0x02, 0xe2, 0x02, 0xe3, 0x02, 0xe4, 0x02, 0xe5, 0x02, 0xe6, 0x02, 0xe7, 0x02,
-    0xe8, 0x02, 0xe9, 0x02, 0xea, 0x02, 0xeb, 0x02, 0xec, 0x02, 0xed, 0x02, 0xee, 0x02, 0xef, 0x02, 0xf0, 0x02, 0xf1,
-    0x02, 0xf2, 0x02, 0xf3, 0x02, 0xf4, 0x02, 0xf5, 0x02, 0xf6, 0x02, 0xf7, 0x02, 0xf8, 0x02, 0xf9, 0x02, 0xfa, 0x02,
-    0xfb, 0x02, 0xfc, 0x02, 0xfd, 0x02, 0xfe, 0x02, 0xff, 0x03, 0x00, 0x03, 0x01, 0x03, 0x02, 0x03, 0x03, 0x03, 0x04,
-    0x03, 0x05, 0x03, 0x06, 0x03, 0x07, 0x03, 0x08, 0x03, 0x09, 0x03, 0x0a, 0x03, 0x0b, 0x03, 0x0c, 0x03, 0x0d, 0x03,
-    0x0e, 0x03, 0x0f, 0x03, 0x10, 0x03, 0x11, 0x03, 0x12, 0x03, 0x13, 0x03, 0x14, 0x03, 0x15, 0x03, 0x16, 0x03, 0x17,
-    0x03, 0x18, 0x03, 0x19, 0x03, 0x1a, 0x03, 0x1b, 0x03, 0x1c, 0x03, 0x1d, 0x03, 0x1e, 0x03, 0x1f, 0x03, 0x20, 0x03,
-    0x21, 0x03, 0x22, 0x03, 0x23, 0x03, 0x24, 0x03, 0x25, 0x03, 0x26, 0x03, 0x27, 0x03, 0x28, 0x03, 0x29, 0x03, 0x2a,
-    0x03, 0x2b, 0x03, 0x2c, 0x03, 0x2d, 0x03, 0x2e, 0x03, 0x2f, 0x03, 0x30, 0x03, 0x31, 0x03, 0x32, 0x03, 0x33, 0x03,
-    0x34, 0x03, 0x35, 0x03, 0x36, 0x03, 0x37, 0x03, 0x38, 0x03, 0x39, 0x03, 0x3a, 0x03, 0x3b, 0x03, 0x3c, 0x03, 0x3d,
-    0x03, 0x3e, 0x03, 0x3f, 0x03, 0x40, 0x03, 0x41, 0x03, 0x42, 0x03, 0x43, 0x03, 0x44, 0x03, 0x45, 0x03, 0x46, 0x03,
-    0x47, 0x03, 0x48, 0x03, 0x49, 0x03, 0x4a, 0x03, 0x4b, 0x03, 0x4c, 0x03, 0x4d, 0x03, 0x4e, 0x03, 0x4f, 0x03, 0x50,
-    0x03, 0x51, 0x03, 0x52, 0x03, 0x53, 0x03, 0x54, 0x03, 0x55, 0x03, 0x56, 0x03, 0x57, 0x03, 0x58, 0x03, 0x59, 0x03,
-    0x5a, 0x03, 0x5b, 0x03, 0x5c, 0x03, 0x5d, 0x03, 0x5e, 0x03, 0x5f, 0x03, 0x60, 0x03, 0x61, 0x03, 0x62, 0x03, 0x63,
-    0x03, 0x64, 0x03, 0x65, 0x03, 0x66, 0x03, 0x67, 0x03, 0x68, 0x03, 0x69, 0x03, 0x6a, 0x03, 0x6b, 0x03, 0x6c, 0x03,
-    0x6d, 0x03, 0x6e, 0x03, 0x6f, 0x03, 0x70, 0x03, 0x71, 0x03, 0x72, 0x03, 0x73, 0x03, 0x74, 0x03, 0x75, 0x03, 0x76,
-    0x03, 0x77, 0x03, 0x78, 0x03, 0x79, 0x03, 0x7a, 0x03, 0x7b, 0x03, 0x7c, 0x03, 0x7d, 0x03, 0x7e, 0x03, 0x7f, 0x03,
-    0x80, 0x03, 0x81, 0x03, 0x82, 0x03, 0x83, 0x03, 0x84, 0x03, 0x85, 0x03, 0x86, 0x03, 0x87, 0x03, 0x88, 0x03, 0x89,
-    0x03, 0x8a, 0x03, 0x8b, 0x03, 0x8c, 0x03, 0x8d, 0x03, 0x8e, 0x03, 0x8f, 0x03, 0x90, 0x03, 0x91, 0x03, 0x92, 0x03,
-    0x93, 0x03, 0x94, 0x03, 0x95, 0x03, 0x96, 0x03, 0x97, 0x03, 0x98, 0x03, 0x99, 0x03, 0x9a, 0x03, 0x9b, 0x03, 0x9c,
-    0x03, 0x9d, 0x03, 0x9e, 0x03, 0x9f, 0x03, 0xa0, 0x03, 0xa1, 0x03, 0xa2, 0x03, 0xa3, 0x03, 0xa4, 0x03, 0xa5, 0x03,
-    0xa6, 0x03, 0xa7, 0x03, 0xa8, 0x03, 0xa9, 0x03, 0xaa, 0x03, 0xab, 0x03, 0xac, 0x03, 0xad, 0x03, 0xae, 0x03, 0xaf,
-    0x03, 0xb0, 0x03, 0xb1, 0x03, 0xb2, 0x03, 0xb3, 0x03, 0xb4, 0x03, 0xb5, 0x03, 0xb6, 0x03, 0xb7, 0x03, 0xb8, 0x03,
-    0xb9, 0x03, 0xba, 0x03, 0xbb, 0x03, 0xbc, 0x03, 0xbd, 0x03, 0xbe, 0x03, 0xbf, 0x03, 0xc0, 0x03, 0xc1, 0x03, 0xc2,
-    0x03, 0xc3, 0x03, 0xc4, 0x03, 0xc5, 0x03, 0xc6, 0x03, 0xc7, 0x03, 0xc8, 0x03, 0xc9, 0x03, 0xca, 0x03, 0xcb, 0x03,
-    0xcc, 0x03, 0xcd, 0x03, 0xce, 0x03, 0xcf, 0x03, 0xd0, 0x03, 0xd1, 0x03, 0xd2, 0x03, 0xd3, 0x03, 0xd4, 0x03, 0xd5,
-    0x03, 0xd6, 0x03, 0xd7, 0x03, 0xd8, 0x03, 0xd9, 0x03, 0xda, 0x03, 0xdb, 0x03, 0xdc, 0x03, 0xdd, 0x03, 0xde, 0x03,
-    0xdf, 0x03, 0xe0, 0x03, 0xe1, 0x03, 0xe2, 0x03, 0xe3, 0x03, 0xe4, 0x03, 0xe5, 0x03, 0xe6, 0x03, 0xe7, 0x03, 0xe8,
-    0x03, 0xe9, 0x03, 0xea, 0x03, 0xeb, 0x03, 0xec, 0x03, 0xed, 0x03, 0xee, 0x03, 0xef, 0x03, 0xf0, 0x03, 0xf1, 0x03,
-    0xf2, 0x03, 0xf3, 0x03, 0xf4, 0x03, 0xf5, 0x03, 0xf6, 0x03, 0xf7, 0x03, 0xf8, 0x03, 0xf9, 0x03, 0xfa, 0x03, 0xfb,
-    0x03, 0xfc, 0x03, 0xfd, 0x03, 0xfe, 0x03, 0xff, 0x04, 0x00, 0x04, 0x01, 0x04, 0x02, 0x04, 0x03, 0x04, 0x04, 0x04,
-    0x05, 0x04, 0x06, 0x04, 0x07, 0x04, 0x08, 0x04, 0x09, 0x04, 0x0a, 0x04, 0x0b, 0x04, 0x0c, 0x04, 0x0d, 0x04, 0x0e,
-    0x04, 0x0f, 0x04, 0x10, 0x04, 0x11, 0x04, 0x12, 0x04, 0x13, 0x04, 0x14, 0x04, 0x15, 0x04, 0x16, 0x00, 0xf7, 0x04,
-    0x17, 0x04, 0x18, 0x04, 0x19, 0x00, 0x04, 0x04, 0x4e, 0x55, 0x4c, 0x4c, 0x06, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e,
-    0x0e, 0x70, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x65, 0x64, 0x04, 0x48, 0x62, 0x61,
-    0x72, 0x02, 0x49, 0x4a, 0x02, 0x69, 0x6a, 0x0c, 0x6b, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x6c, 0x61, 0x6e, 0x64, 0x69,
-    0x63, 0x03, 0x45, 0x6e, 0x67, 0x03, 0x65, 0x6e, 0x67, 0x05, 0x6c, 0x6f, 0x6e, 0x67, 0x73, 0x05, 0x4f, 0x68, 0x6f,
-    0x72, 0x6e, 0x05, 0x6f, 0x68, 0x6f, 0x72, 0x6e, 0x05, 0x55, 0x68, 0x6f, 0x72, 0x6e, 0x05, 0x75, 0x68, 0x6f, 0x72,
-    0x6e, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x33, 0x37, 0x05, 0x73, 0x63, 0x68, 0x77, 0x61, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x32, 0x46, 0x33, 0x09, 0x67, 0x72, 0x61, 0x76, 0x65, 0x63, 0x6f, 0x6d, 0x62, 0x09, 0x61, 0x63, 0x75, 0x74,
-    0x65, 0x63, 0x6f, 0x6d, 0x62, 0x09, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x63, 0x6f, 0x6d, 0x62, 0x04, 0x68, 0x6f, 0x6f,
-    0x6b, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x46, 0x08, 0x64, 0x6f, 0x74, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x05,
-    0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0d, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x74, 0x6f, 0x6e, 0x6f, 0x73,
-    0x09, 0x61, 0x6e, 0x6f, 0x74, 0x65, 0x6c, 0x65, 0x69, 0x61, 0x05, 0x47, 0x61, 0x6d, 0x6d, 0x61, 0x05, 0x44, 0x65,
-    0x6c, 0x74, 0x61, 0x05, 0x54, 0x68, 0x65, 0x74, 0x61, 0x06, 0x4c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x02, 0x58, 0x69,
-    0x02, 0x50, 0x69, 0x05, 0x53, 0x69, 0x67, 0x6d, 0x61, 0x03, 0x50, 0x68, 0x69, 0x03, 0x50, 0x73, 0x69, 0x05, 0x61,
-    0x6c, 0x70, 0x68, 0x61, 0x04, 0x62, 0x65, 0x74, 0x61, 0x05, 0x67, 0x61, 0x6d, 0x6d, 0x61, 0x05, 0x64, 0x65, 0x6c,
-    0x74, 0x61, 0x07, 0x65, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x04, 0x7a, 0x65, 0x74, 0x61, 0x03, 0x65, 0x74, 0x61,
-    0x05, 0x74, 0x68, 0x65, 0x74, 0x61, 0x04, 0x69, 0x6f, 0x74, 0x61, 0x06, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x02,
-    0x78, 0x69, 0x03, 0x72, 0x68, 0x6f, 0x06, 0x73, 0x69, 0x67, 0x6d, 0x61, 0x31, 0x05, 0x73, 0x69, 0x67, 0x6d, 0x61,
-    0x03, 0x74, 0x61, 0x75, 0x07, 0x75, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x03, 0x70, 0x68, 0x69, 0x03, 0x70, 0x73,
-    0x69, 0x05, 0x6f, 0x6d, 0x65, 0x67, 0x61, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x44, 0x31, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x33, 0x44, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x44, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30,
-    0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x39, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x30, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x30, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x34,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x37, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x31, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x32, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x37, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x39, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x32, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32,
-    0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x45, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x32, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x33, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x34,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x37, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x33, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x33, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x44, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x32, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x34, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34,
-    0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x39, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x34, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x34, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x45,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x32, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x35, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x35, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x46, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x31, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x36, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36,
-    0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x37, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x36, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x36, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x43,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x36, 0x45, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x36, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x37, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37, 0x35, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x37, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37, 0x39, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x37, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37,
-    0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37, 0x45, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x37, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x38, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x33,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x35, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x38, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x38, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x46, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x31, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x39, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39,
-    0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x30, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x41, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x41, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x37,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x39, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x42, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x42, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x41, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x44, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x43, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43,
-    0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x38, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x45, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x46, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x30,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x33, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x35, 0x30, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35,
-    0x30, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x38, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x41, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x35, 0x30, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30,
-    0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x30, 0x46, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x35, 0x31, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x32,
-    0x30, 0x30, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x33,
-    0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x35, 0x07, 0x75, 0x6e,
-    0x69, 0x32, 0x30, 0x30, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30,
-    0x30, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x41, 0x07,
-    0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x42, 0x0d, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x64,
-    0x62, 0x6c, 0x0d, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x64, 0x07, 0x75, 0x6e,
-    0x69, 0x32, 0x30, 0x32, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x37, 0x34, 0x09, 0x6e, 0x73, 0x75, 0x70, 0x65,
-    0x72, 0x69, 0x6f, 0x72, 0x04, 0x6c, 0x69, 0x72, 0x61, 0x06, 0x70, 0x65, 0x73, 0x65, 0x74, 0x61, 0x04, 0x45, 0x75,
-    0x72, 0x6f, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x31, 0x30, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x31, 0x31, 0x33, 0x07,
-    0x75, 0x6e, 0x69, 0x32, 0x31, 0x31, 0x36, 0x09, 0x65, 0x73, 0x74, 0x69, 0x6d, 0x61, 0x74, 0x65, 0x64, 0x09, 0x6f,
-    0x6e, 0x65, 0x65, 0x69, 0x67, 0x68, 0x74, 0x68, 0x0c, 0x74, 0x68, 0x72, 0x65, 0x65, 0x65, 0x69, 0x67, 0x68, 0x74,
-    0x68, 0x73, 0x0b, 0x66, 0x69, 0x76, 0x65, 0x65, 0x69, 0x67, 0x68, 0x74, 0x68, 0x73, 0x0c, 0x73, 0x65, 0x76, 0x65,
-    0x6e, 0x65, 0x69, 0x67, 0x68, 0x74, 0x68, 0x73, 0x0b, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e,
-    0x74, 0x07, 0x75, 0x6e, 0x69, 0x46, 0x45, 0x46, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x46, 0x46, 0x46, 0x43, 0x07, 0x75,
-    0x6e, 0x69, 0x46, 0x46, 0x46, 0x44, 0x09, 0x7a, 0x65, 0x72, 0x6f, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x07, 0x74, 0x77,
-    0x6f, 0x2e, 0x73, 0x75, 0x70, 0x13, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x74, 0x69, 0x6c,
-    0x64, 0x65, 0x63, 0x6f, 0x6d, 0x62, 0x12, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x68, 0x6f,
-    0x6f, 0x6b, 0x63, 0x6f, 0x6d, 0x62, 0x13, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x67, 0x72,
-    0x61, 0x76, 0x65, 0x63, 0x6f, 0x6d, 0x62, 0x13, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x61,
-    0x63, 0x75, 0x74, 0x65, 0x63, 0x6f, 0x6d, 0x62, 0x0e, 0x62, 0x72, 0x65, 0x76, 0x65, 0x67, 0x72, 0x61, 0x76, 0x65,
-    0x63, 0x6f, 0x6d, 0x62, 0x11, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x72, 0x6f, 0x74,
-    0x61, 0x74, 0x65, 0x06, 0x41, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x42, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x43,
-    0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x44, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x45, 0x2e, 0x73, 0x6d, 0x63, 0x70,
-    0x06, 0x46, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x47, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x48, 0x2e, 0x73, 0x6d,
-    0x63, 0x70, 0x06, 0x49, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x4a, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x4b, 0x2e,
-    0x73, 0x6d, 0x63, 0x70, 0x06, 0x4c, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x4d, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06,
-    0x4e, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x4f, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x51, 0x2e, 0x73, 0x6d, 0x63,
-    0x70, 0x06, 0x52, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x53, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x54, 0x2e, 0x73,
-    0x6d, 0x63, 0x70, 0x06, 0x55, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x56, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x57,
-    0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x58, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x06, 0x59, 0x2e, 0x73, 0x6d, 0x63, 0x70,
-    0x06, 0x5a, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0d, 0x62, 0x72, 0x65, 0x76, 0x65, 0x68, 0x6f, 0x6f, 0x6b, 0x63, 0x6f,
-    0x6d, 0x62, 0x08, 0x6f, 0x6e, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x08, 0x74, 0x77, 0x6f, 0x2e, 0x73, 0x6d, 0x63,
-    0x70, 0x0a, 0x74, 0x68, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x09, 0x66, 0x6f, 0x75, 0x72, 0x2e, 0x73,
-    0x6d, 0x63, 0x70, 0x09, 0x66, 0x69, 0x76, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x08, 0x73, 0x69, 0x78, 0x2e, 0x73,
-    0x6d, 0x63, 0x70, 0x0a, 0x73, 0x65, 0x76, 0x65, 0x6e, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0a, 0x65, 0x69, 0x67, 0x68,
-    0x74, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x09, 0x6e, 0x69, 0x6e, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x08, 0x7a, 0x65,
-    0x72, 0x6f, 0x2e, 0x73, 0x75, 0x70, 0x07, 0x6f, 0x6e, 0x65, 0x2e, 0x73, 0x75, 0x70, 0x0e, 0x62, 0x72, 0x65, 0x76,
-    0x65, 0x61, 0x63, 0x75, 0x74, 0x65, 0x63, 0x6f, 0x6d, 0x62, 0x09, 0x74, 0x68, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x75,
-    0x70, 0x08, 0x66, 0x6f, 0x75, 0x72, 0x2e, 0x73, 0x75, 0x70, 0x08, 0x66, 0x69, 0x76, 0x65, 0x2e, 0x73, 0x75, 0x70,
-    0x07, 0x73, 0x69, 0x78, 0x2e, 0x73, 0x75, 0x70, 0x09, 0x73, 0x65, 0x76, 0x65, 0x6e, 0x2e, 0x73, 0x75, 0x70, 0x09,
-    0x65, 0x69, 0x67, 0x68, 0x74, 0x2e, 0x73, 0x75, 0x70, 0x08, 0x6e, 0x69, 0x6e, 0x65, 0x2e, 0x73, 0x75, 0x70, 0x08,
-    0x63, 0x72, 0x6f, 0x73, 0x73, 0x62, 0x61, 0x72, 0x09, 0x72, 0x69, 0x6e, 0x67, 0x61, 0x63, 0x75, 0x74, 0x65, 0x09,
-    0x64, 0x61, 0x73, 0x69, 0x61, 0x6f, 0x78, 0x69, 0x61, 0x0e, 0x62, 0x72, 0x65, 0x76, 0x65, 0x74, 0x69, 0x6c, 0x64,
-    0x65, 0x63, 0x6f, 0x6d, 0x62, 0x0b, 0x63, 0x79, 0x72, 0x69, 0x6c, 0x6c, 0x69, 0x63, 0x74, 0x69, 0x63, 0x10, 0x63,
-    0x79, 0x72, 0x69, 0x6c, 0x6c, 0x69, 0x63, 0x68, 0x6f, 0x6f, 0x6b, 0x6c, 0x65, 0x66, 0x74, 0x0c, 0x63, 0x79, 0x72,
-    0x69, 0x6c, 0x6c, 0x69, 0x63, 0x68, 0x6f, 0x6f, 0x6b, 0x05, 0x67, 0x2e, 0x61, 0x6c, 0x74, 0x0e, 0x6c, 0x61, 0x72,
-    0x67, 0x65, 0x72, 0x69, 0x67, 0x68, 0x74, 0x68, 0x6f, 0x6f, 0x6b, 0x05, 0x69, 0x2e, 0x61, 0x6c, 0x74, 0x05, 0x6c,
-    0x2e, 0x61, 0x6c, 0x74, 0x08, 0x6f, 0x6e, 0x65, 0x2e, 0x6c, 0x6e, 0x75, 0x6d, 0x0a, 0x73, 0x65, 0x76, 0x65, 0x6e,
-    0x2e, 0x6c, 0x6e, 0x75, 0x6d, 0x06, 0x50, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x07, 0x63, 0x68, 0x69, 0x2e, 0x61, 0x6c,
-    0x74, 0x05, 0x52, 0x2e, 0x61, 0x6c, 0x74, 0x05, 0x4b, 0x2e, 0x61, 0x6c, 0x74, 0x04, 0x69, 0x2e, 0x69, 0x74, 0x04,
-    0x6c, 0x2e, 0x69, 0x74, 0x07, 0x6f, 0x6e, 0x65, 0x2e, 0x61, 0x6c, 0x74, 0x06, 0x61, 0x74, 0x2e, 0x61, 0x6c, 0x74,
-    0x0d, 0x61, 0x6d, 0x70, 0x65, 0x72, 0x73, 0x61, 0x6e, 0x64, 0x2e, 0x61, 0x6c, 0x74, 0x0a, 0x47, 0x65, 0x72, 0x6d,
-    0x61, 0x6e, 0x64, 0x62, 0x6c, 0x73, 0x0f, 0x47, 0x65, 0x72, 0x6d, 0x61, 0x6e, 0x64, 0x62, 0x6c, 0x73, 0x2e, 0x73,
-    0x6d, 0x63, 0x70, 0x0d, 0x63, 0x79, 0x72, 0x69, 0x6c, 0x6c, 0x69, 0x63, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x30, 0x41, 0x44, 0x06, 0x44, 0x63, 0x72, 0x6f, 0x61, 0x74, 0x04, 0x68, 0x62, 0x61, 0x72, 0x04,
-    0x54, 0x62, 0x61, 0x72, 0x04, 0x74, 0x62, 0x61, 0x72, 0x0a, 0x41, 0x72, 0x69, 0x6e, 0x67, 0x61, 0x63, 0x75, 0x74,
-    0x65, 0x0a, 0x61, 0x72, 0x69, 0x6e, 0x67, 0x61, 0x63, 0x75, 0x74, 0x65, 0x07, 0x41, 0x6d, 0x61, 0x63, 0x72, 0x6f,
-    0x6e, 0x07, 0x61, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x06, 0x41, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x61, 0x62,
-    0x72, 0x65, 0x76, 0x65, 0x07, 0x41, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x07, 0x61, 0x6f, 0x67, 0x6f, 0x6e, 0x65,
-    0x6b, 0x0b, 0x43, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x63, 0x63, 0x69, 0x72, 0x63,
-    0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x30, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x31, 0x30, 0x42, 0x06, 0x44, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x64, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x07, 0x45,
-    0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x65, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x06, 0x45, 0x62, 0x72, 0x65,
-    0x76, 0x65, 0x06, 0x65, 0x62, 0x72, 0x65, 0x76, 0x65, 0x0a, 0x45, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e,
-    0x74, 0x0a, 0x65, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x07, 0x45, 0x6f, 0x67, 0x6f, 0x6e, 0x65,
-    0x6b, 0x07, 0x65, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x06, 0x45, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x65, 0x63,
-    0x61, 0x72, 0x6f, 0x6e, 0x0b, 0x47, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x67, 0x63,
-    0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x32, 0x30, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x31, 0x32, 0x31, 0x0c, 0x47, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74,
-    0x0c, 0x67, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0b, 0x48, 0x63, 0x69, 0x72, 0x63,
-    0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x68, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x06,
-    0x49, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x06, 0x69, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x07, 0x49, 0x6d, 0x61, 0x63, 0x72,
-    0x6f, 0x6e, 0x07, 0x69, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x06, 0x49, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x69,
-    0x62, 0x72, 0x65, 0x76, 0x65, 0x07, 0x49, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x07, 0x69, 0x6f, 0x67, 0x6f, 0x6e,
-    0x65, 0x6b, 0x0a, 0x49, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0b, 0x4a, 0x63, 0x69, 0x72, 0x63,
-    0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x6a, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0c,
-    0x4b, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0c, 0x6b, 0x63, 0x6f, 0x6d, 0x6d, 0x61,
-    0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x06, 0x4c, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x6c, 0x61, 0x63, 0x75, 0x74,
-    0x65, 0x0c, 0x4c, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0c, 0x6c, 0x63, 0x6f, 0x6d,
-    0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x06, 0x4c, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x6c, 0x63, 0x61,
-    0x72, 0x6f, 0x6e, 0x04, 0x4c, 0x64, 0x6f, 0x74, 0x04, 0x6c, 0x64, 0x6f, 0x74, 0x06, 0x4e, 0x61, 0x63, 0x75, 0x74,
-    0x65, 0x06, 0x6e, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0c, 0x4e, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65,
-    0x6e, 0x74, 0x0c, 0x6e, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x06, 0x4e, 0x63, 0x61,
-    0x72, 0x6f, 0x6e, 0x06, 0x6e, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x0b, 0x6e, 0x61, 0x70, 0x6f, 0x73, 0x74, 0x72, 0x6f,
-    0x70, 0x68, 0x65, 0x07, 0x4f, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x6f, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e,
-    0x06, 0x4f, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x6f, 0x62, 0x72, 0x65, 0x76, 0x65, 0x0d, 0x4f, 0x68, 0x75, 0x6e,
-    0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x0d, 0x6f, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d,
-    0x6c, 0x61, 0x75, 0x74, 0x06, 0x52, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x72, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0c,
-    0x52, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0c, 0x72, 0x63, 0x6f, 0x6d, 0x6d, 0x61,
-    0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x06, 0x52, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x72, 0x63, 0x61, 0x72, 0x6f,
-    0x6e, 0x06, 0x53, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x73, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0b, 0x53, 0x63, 0x69,
-    0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x73, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65,
-    0x78, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x39, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x32, 0x31, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x31, 0x36, 0x32, 0x0c, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x36, 0x32, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x31, 0x36, 0x33, 0x06, 0x54, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x74, 0x63, 0x61, 0x72, 0x6f, 0x6e,
-    0x06, 0x55, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x06, 0x75, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x07, 0x55, 0x6d, 0x61, 0x63,
-    0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x06, 0x55, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06,
-    0x75, 0x62, 0x72, 0x65, 0x76, 0x65, 0x05, 0x55, 0x72, 0x69, 0x6e, 0x67, 0x05, 0x75, 0x72, 0x69, 0x6e, 0x67, 0x0d,
-    0x55, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x0d, 0x75, 0x68, 0x75, 0x6e, 0x67,
-    0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x07, 0x55, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x07, 0x75, 0x6f,
-    0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x0b, 0x57, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x77,
-    0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x59, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66,
-    0x6c, 0x65, 0x78, 0x0b, 0x79, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x06, 0x5a, 0x61, 0x63,
-    0x75, 0x74, 0x65, 0x06, 0x7a, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0a, 0x5a, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65,
-    0x6e, 0x74, 0x0a, 0x7a, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x07, 0x41, 0x45, 0x61, 0x63, 0x75,
-    0x74, 0x65, 0x07, 0x61, 0x65, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0b, 0x4f, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x61, 0x63,
-    0x75, 0x74, 0x65, 0x0b, 0x6f, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0b, 0x44, 0x63, 0x72,
-    0x6f, 0x61, 0x74, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x08, 0x45, 0x74, 0x68, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x09, 0x54,
-    0x62, 0x61, 0x72, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x41, 0x67, 0x72, 0x61, 0x76, 0x65, 0x2e, 0x73, 0x6d, 0x63,
-    0x70, 0x0b, 0x41, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x10, 0x41, 0x63, 0x69, 0x72, 0x63,
-    0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x41, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x2e,
-    0x73, 0x6d, 0x63, 0x70, 0x0e, 0x41, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x2e, 0x73, 0x6d, 0x63, 0x70,
-    0x0a, 0x41, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0f, 0x41, 0x72, 0x69, 0x6e, 0x67, 0x61, 0x63,
-    0x75, 0x74, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0d, 0x43, 0x63, 0x65, 0x64, 0x69, 0x6c, 0x6c, 0x61, 0x2e, 0x73,
-    0x6d, 0x63, 0x70, 0x0b, 0x45, 0x67, 0x72, 0x61, 0x76, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x45, 0x61, 0x63,
-    0x75, 0x74, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x10, 0x45, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65,
-    0x78, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0e, 0x45, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x2e, 0x73, 0x6d,
-    0x63, 0x70, 0x0b, 0x49, 0x67, 0x72, 0x61, 0x76, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x49, 0x61, 0x63, 0x75,
-    0x74, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x10, 0x49, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78,
-    0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0e, 0x49, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x2e, 0x73, 0x6d, 0x63,
-    0x70, 0x0b, 0x4e, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x4f, 0x67, 0x72, 0x61, 0x76,
-    0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x4f, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x10,
-    0x4f, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x4f, 0x74,
-    0x69, 0x6c, 0x64, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0e, 0x4f, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73,
-    0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x55, 0x67, 0x72, 0x61, 0x76, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x55,
-    0x61, 0x63, 0x75, 0x74, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x10, 0x55, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66,
-    0x6c, 0x65, 0x78, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0e, 0x55, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x2e,
-    0x73, 0x6d, 0x63, 0x70, 0x0b, 0x59, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0c, 0x41, 0x6d,
-    0x61, 0x63, 0x72, 0x6f, 0x6e, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x41, 0x62, 0x72, 0x65, 0x76, 0x65, 0x2e, 0x73,
-    0x6d, 0x63, 0x70, 0x0c, 0x41, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x43, 0x61,
-    0x63, 0x75, 0x74, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x10, 0x43, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c,
-    0x65, 0x78, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0c, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x30, 0x41, 0x2e, 0x73, 0x6d, 0x63,
-    0x70, 0x0b, 0x43, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x44, 0x63, 0x61, 0x72, 0x6f,
-    0x6e, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0c, 0x45, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x2e, 0x73, 0x6d, 0x63, 0x70,
-    0x0b, 0x45, 0x62, 0x72, 0x65, 0x76, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0f, 0x45, 0x64, 0x6f, 0x74, 0x61, 0x63,
-    0x63, 0x65, 0x6e, 0x74, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0c, 0x45, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x2e, 0x73,
-    0x6d, 0x63, 0x70, 0x0b, 0x45, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x10, 0x47, 0x63, 0x69,
-    0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x47, 0x62, 0x72, 0x65, 0x76,
-    0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0c, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x32, 0x30, 0x2e, 0x73, 0x6d, 0x63, 0x70,
-    0x11, 0x47, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x10,
-    0x48, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x49, 0x74,
-    0x69, 0x6c, 0x64, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0c, 0x49, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x2e, 0x73,
-    0x6d, 0x63, 0x70, 0x0b, 0x49, 0x62, 0x72, 0x65, 0x76, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0c, 0x49, 0x6f, 0x67,
-    0x6f, 0x6e, 0x65, 0x6b, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0f, 0x49, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e,
-    0x74, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x10, 0x4a, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2e,
-    0x73, 0x6d, 0x63, 0x70, 0x11, 0x4b, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x2e, 0x73,
-    0x6d, 0x63, 0x70, 0x0b, 0x4c, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x11, 0x4c, 0x63, 0x6f,
-    0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x4c, 0x63, 0x61, 0x72,
-    0x6f, 0x6e, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x09, 0x4c, 0x64, 0x6f, 0x74, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x4e,
-    0x61, 0x63, 0x75, 0x74, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x11, 0x4e, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63,
-    0x63, 0x65, 0x6e, 0x74, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x4e, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x2e, 0x73, 0x6d,
-    0x63, 0x70, 0x0c, 0x4f, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x4f, 0x62, 0x72,
-    0x65, 0x76, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x12, 0x4f, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c,
-    0x61, 0x75, 0x74, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x52, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2e, 0x73, 0x6d, 0x63,
-    0x70, 0x11, 0x52, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x2e, 0x73, 0x6d, 0x63, 0x70,
-    0x0b, 0x52, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x53, 0x61, 0x63, 0x75, 0x74, 0x65,
-    0x2e, 0x73, 0x6d, 0x63, 0x70, 0x10, 0x53, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2e, 0x73,
-    0x6d, 0x63, 0x70, 0x0d, 0x53, 0x63, 0x65, 0x64, 0x69, 0x6c, 0x6c, 0x61, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x53,
-    0x63, 0x61, 0x72, 0x6f, 0x6e, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x11, 0x54, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63,
-    0x63, 0x65, 0x6e, 0x74, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x54, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x2e, 0x73, 0x6d,
-    0x63, 0x70, 0x0b, 0x55, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0c, 0x55, 0x6d, 0x61, 0x63,
-    0x72, 0x6f, 0x6e, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x55, 0x62, 0x72, 0x65, 0x76, 0x65, 0x2e, 0x73, 0x6d, 0x63,
-    0x70, 0x0a, 0x55, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x12, 0x55, 0x68, 0x75, 0x6e, 0x67, 0x61,
-    0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0c, 0x55, 0x6f, 0x67, 0x6f, 0x6e, 0x65,
-    0x6b, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x10, 0x57, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2e,
-    0x73, 0x6d, 0x63, 0x70, 0x10, 0x59, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2e, 0x73, 0x6d,
-    0x63, 0x70, 0x0e, 0x59, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x5a,
-    0x61, 0x63, 0x75, 0x74, 0x65, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0f, 0x5a, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65,
-    0x6e, 0x74, 0x2e, 0x73, 0x6d, 0x63, 0x70, 0x0b, 0x5a, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x2e, 0x73, 0x6d, 0x63, 0x70,
-    0x0a, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0c, 0x45, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e,
-    0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x08, 0x45, 0x74, 0x61, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x09, 0x49, 0x6f, 0x74, 0x61,
-    0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0c, 0x4f, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x6e, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0c,
-    0x55, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0a, 0x4f, 0x6d, 0x65, 0x67, 0x61, 0x74,
-    0x6f, 0x6e, 0x6f, 0x73, 0x11, 0x69, 0x6f, 0x74, 0x61, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x74, 0x6f,
-    0x6e, 0x6f, 0x73, 0x05, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x04, 0x42, 0x65, 0x74, 0x61, 0x07, 0x45, 0x70, 0x73, 0x69,
-    0x6c, 0x6f, 0x6e, 0x04, 0x5a, 0x65, 0x74, 0x61, 0x03, 0x45, 0x74, 0x61, 0x04, 0x49, 0x6f, 0x74, 0x61, 0x05, 0x4b,
-    0x61, 0x70, 0x70, 0x61, 0x02, 0x4d, 0x75, 0x02, 0x4e, 0x75, 0x07, 0x4f, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x6e, 0x03,
-    0x52, 0x68, 0x6f, 0x03, 0x54, 0x61, 0x75, 0x07, 0x55, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x03, 0x43, 0x68, 0x69,
-    0x0c, 0x49, 0x6f, 0x74, 0x61, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x0f, 0x55, 0x70, 0x73, 0x69, 0x6c,
-    0x6f, 0x6e, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x0a, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x74, 0x6f, 0x6e,
-    0x6f, 0x73, 0x0c, 0x65, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x08, 0x65, 0x74, 0x61,
-    0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x09, 0x69, 0x6f, 0x74, 0x61, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x14, 0x75, 0x70, 0x73,
-    0x69, 0x6c, 0x6f, 0x6e, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x05, 0x6b,
-    0x61, 0x70, 0x70, 0x61, 0x07, 0x6f, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x42,
-    0x43, 0x02, 0x6e, 0x75, 0x03, 0x63, 0x68, 0x69, 0x0c, 0x69, 0x6f, 0x74, 0x61, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73,
-    0x69, 0x73, 0x0f, 0x75, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x0c,
-    0x6f, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x6e, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0c, 0x75, 0x70, 0x73, 0x69, 0x6c, 0x6f,
-    0x6e, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x0a, 0x6f, 0x6d, 0x65, 0x67, 0x61, 0x74, 0x6f, 0x6e, 0x6f, 0x73, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x30, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x30, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x37,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x41, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x30, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x31, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x33, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x39, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x31, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31,
-    0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x31, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x30, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x32, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x32, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x32, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x30,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x33, 0x39, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x33, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x34, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x34, 0x35, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x33, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x35, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35,
-    0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x43, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x35, 0x45, 0x06, 0x57, 0x67, 0x72, 0x61, 0x76, 0x65, 0x06, 0x77, 0x67, 0x72, 0x61, 0x76,
-    0x65, 0x06, 0x57, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x77, 0x61, 0x63, 0x75, 0x74, 0x65, 0x09, 0x57, 0x64, 0x69,
-    0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x09, 0x77, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x06, 0x59, 0x67,
-    0x72, 0x61, 0x76, 0x65, 0x06, 0x79, 0x67, 0x72, 0x61, 0x76, 0x65, 0x06, 0x6d, 0x69, 0x6e, 0x75, 0x74, 0x65, 0x06,
-    0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x09, 0x65, 0x78, 0x63, 0x6c, 0x61, 0x6d, 0x64, 0x62, 0x6c, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x31, 0x46, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x42, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
-    0x33, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x33, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x30, 0x30, 0x07,
-    0x75, 0x6e, 0x69, 0x31, 0x45, 0x30, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x46, 0x34, 0x44, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x30, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x30, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35,
-    0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x35, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37, 0x30, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x37, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x37, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x37, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x39,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x42, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x41, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x43, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x32, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x30, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x44, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44,
-    0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x35, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x44, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x44, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x42,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x44, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x44, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x44, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x45, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x34, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x36, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x45, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45,
-    0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x42, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x45, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x45, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x45, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x30,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x32, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x46, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x46, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x39, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x44, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x35, 0x30, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x31, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x35, 0x31,
-    0x33, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x31, 0x07, 0x75,
-    0x6e, 0x69, 0x31, 0x45, 0x41, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x31,
-    0x45, 0x41, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x36,
-    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x38, 0x07, 0x75, 0x6e,
-    0x69, 0x31, 0x45, 0x41, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
-    0x41, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x44, 0x07,
-    0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x46, 0x07, 0x75, 0x6e, 0x69,
-    0x31, 0x45, 0x42, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42,
-    0x32, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x34, 0x07, 0x75,
-    0x6e, 0x69, 0x31, 0x45, 0x42, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x31,
-    0x45, 0x42, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x39,
-    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x42, 0x07, 0x75, 0x6e,
-    0x69, 0x31, 0x45, 0x42, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
-    0x42, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x30, 0x07,
-    0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x32, 0x07, 0x75, 0x6e, 0x69,
-    0x31, 0x45, 0x43, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43,
-    0x35, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x37, 0x07, 0x75,
-    0x6e, 0x69, 0x31, 0x45, 0x43, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x31,
-    0x45, 0x43, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x43,
-    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x45, 0x07, 0x75, 0x6e,
-    0x69, 0x31, 0x45, 0x43, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
-    0x44, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x33, 0x07,
-    0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x35, 0x07, 0x75, 0x6e, 0x69,
-    0x31, 0x45, 0x44, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44,
-    0x38, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x41, 0x07, 0x75,
-    0x6e, 0x69, 0x31, 0x45, 0x44, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x31,
-    0x45, 0x44, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x46,
-    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x31, 0x07, 0x75, 0x6e,
-    0x69, 0x31, 0x45, 0x45, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
-    0x45, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x36, 0x07,
-    0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x38, 0x07, 0x75, 0x6e, 0x69,
-    0x31, 0x45, 0x45, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45,
-    0x42, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x44, 0x07, 0x75,
-    0x6e, 0x69, 0x31, 0x45, 0x45, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x31,
-    0x45, 0x46, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46, 0x34,
-    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46, 0x36, 0x07, 0x75, 0x6e,
-    0x69, 0x31, 0x45, 0x46, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
-    0x46, 0x39, 0x06, 0x64, 0x63, 0x72, 0x6f, 0x61, 0x74, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x41, 0x42, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x39, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x41, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x43,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x41, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x32, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x42, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x42, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x43, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x37, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x39, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42,
-    0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x42, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x34, 0x38, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x34, 0x36, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x33,
-    0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x39, 0x46, 0x07, 0x75, 0x6e,
-    0x69, 0x30, 0x34, 0x38, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x38, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x43, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x44, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x43, 0x35, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x34, 0x43, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x42,
-    0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34, 0x46, 0x46, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x35, 0x31, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x31, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30,
-    0x30, 0x30, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x30, 0x39, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xff,
-    0xff, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xb9, 0x00, 0xb9, 0x00, 0x97, 0x00, 0x97, 0x05, 0xb0, 0x00, 0x00, 0x04, 0x3a, 0x00, 0x00, 0xfe, 0x60,
-    0x08, 0x62, 0xfd, 0xd5, 0x05, 0xc4, 0xff, 0xec, 0x04, 0x4e, 0xff, 0xec, 0xfe, 0x4b, 0x08, 0x62, 0xfd, 0xd5, 0x00,
-    0xb9, 0x00, 0xb9, 0x00, 0x97, 0x00, 0x97, 0x05, 0xb0, 0x00, 0x00, 0x05, 0xb0, 0x04, 0x3a, 0xff, 0xec, 0xfe, 0x60,
-    0x08, 0x62, 0xfd, 0xd5, 0x05, 0xc4, 0xff, 0xec, 0x05, 0xc5, 0x04, 0x4e, 0xff, 0xec, 0xfe, 0x60, 0x08, 0x62, 0xfd,
-    0xd5, 0x00, 0xb9, 0x00, 0xb9, 0x00, 0x97, 0x00, 0x97, 0x05, 0xb0, 0x00, 0x00, 0x05, 0xe1, 0x04, 0x3a, 0x00, 0x00,
-    0xfe, 0x60, 0x08, 0x62, 0xfd, 0xd5, 0x05, 0xc4, 0xff, 0xec, 0x05, 0xe1, 0x04, 0x4e, 0xff, 0xec, 0xfe, 0x4b, 0x08,
-    0x62, 0xfd, 0xd5, 0x00, 0x32, 0x00, 0x32, 0xb0, 0x00, 0x2c, 0x20, 0xb0, 0x00, 0x55, 0x58, 0x45, 0x59, 0x20, 0x20,
-    0x4b, 0xb8, 0x00, 0x0e, 0x51, 0x4b, 0xb0, 0x06, 0x53, 0x5a, 0x58, 0xb0, 0x34, 0x1b, 0xb0, 0x28, 0x59, 0x60, 0x66,
-    0x20, 0x8a, 0x55, 0x58, 0xb0, 0x02, 0x25, 0x61, 0xb9, 0x08, 0x00, 0x08, 0x00, 0x63, 0x63, 0x23, 0x62, 0x1b, 0x21,
-    0x21, 0xb0, 0x00, 0x59, 0xb0, 0x00, 0x43, 0x23, 0x44, 0xb2, 0x00, 0x01, 0x00, 0x43, 0x60, 0x42, 0x2d, 0xb0, 0x01,
-    0x2c, 0xb0, 0x20, 0x60, 0x66, 0x2d, 0xb0, 0x02, 0x2c, 0x20, 0x64, 0x20, 0xb0, 0xc0, 0x50, 0xb0, 0x04, 0x26, 0x5a,
-    0xb2, 0x28, 0x01, 0x0a, 0x43, 0x45, 0x63, 0x45, 0x52, 0x5b, 0x58, 0x21, 0x23, 0x21, 0x1b, 0x8a, 0x58, 0x20, 0xb0,
-    0x50, 0x50, 0x58, 0x21, 0xb0, 0x40, 0x59, 0x1b, 0x20, 0xb0, 0x38, 0x50, 0x58, 0x21, 0xb0, 0x38, 0x59, 0x59, 0x20,
-    0xb1, 0x01, 0x0a, 0x43, 0x45, 0x63, 0x45, 0x61, 0x64, 0xb0, 0x28, 0x50, 0x58, 0x21, 0xb1, 0x01, 0x0a, 0x43, 0x45,
-    0x63, 0x45, 0x20, 0xb0, 0x30, 0x50, 0x58, 0x21, 0xb0, 0x30, 0x59, 0x1b, 0x20, 0xb0, 0xc0, 0x50, 0x58, 0x20, 0x66,
-    0x20, 0x8a, 0x8a, 0x61, 0x20, 0xb0, 0x0a, 0x50, 0x58, 0x60, 0x1b, 0x20, 0xb0, 0x20, 0x50, 0x58, 0x21, 0xb0, 0x0a,
-    0x60, 0x1b, 0x20, 0xb0, 0x36, 0x50, 0x58, 0x21, 0xb0, 0x36, 0x60, 0x1b, 0x60, 0x59, 0x59, 0x59, 0x1b, 0xb0, 0x01,
-    0x2b, 0x59, 0x59, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59, 0x59, 0x2d, 0xb0, 0x03, 0x2c, 0x20, 0x45, 0x20, 0xb0,
-    0x04, 0x25, 0x61, 0x64, 0x20, 0xb0, 0x05, 0x43, 0x50, 0x58, 0xb0, 0x05, 0x23, 0x42, 0xb0, 0x06, 0x23, 0x42, 0x1b,
-    0x21, 0x21, 0x59, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x04, 0x2c, 0x23, 0x21, 0x23, 0x21, 0x20, 0x64, 0xb1, 0x05, 0x62,
-    0x42, 0x20, 0xb0, 0x06, 0x23, 0x42, 0xb1, 0x01, 0x0a, 0x43, 0x45, 0x63, 0xb1, 0x01, 0x0a, 0x43, 0xb0, 0x04, 0x60,
-    0x45, 0x63, 0xb0, 0x03, 0x2a, 0x21, 0x20, 0xb0, 0x06, 0x43, 0x20, 0x8a, 0x20, 0x8a, 0xb0, 0x01, 0x2b, 0xb1, 0x30,
-    0x05, 0x25, 0xb0, 0x04, 0x26, 0x51, 0x58, 0x60, 0x50, 0x1b, 0x61, 0x52, 0x59, 0x58, 0x23, 0x59, 0x21, 0x20, 0xb0,
-    0x40, 0x53, 0x58, 0xb0, 0x01, 0x2b, 0x1b, 0x21, 0xb0, 0x40, 0x59, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59, 0x2d,
-    0xb0, 0x05, 0x2c, 0xb0, 0x07, 0x43, 0x2b, 0xb2, 0x00, 0x02, 0x00, 0x43, 0x60, 0x42, 0x2d, 0xb0, 0x06, 0x2c, 0xb0,
-    0x07, 0x23, 0x42, 0x23, 0x20, 0xb0, 0x00, 0x23, 0x42, 0x61, 0xb0, 0x02, 0x62, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x01,
-    0x60, 0xb0, 0x05, 0x2a, 0x2d, 0xb0, 0x07, 0x2c, 0x20, 0x20, 0x45, 0x20, 0xb0, 0x0b, 0x43, 0x63, 0xb8, 0x04, 0x00,
-    0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x44, 0xb0, 0x01, 0x60,
-    0x2d, 0xb0, 0x08, 0x2c, 0xb2, 0x07, 0x0b, 0x00, 0x43, 0x45, 0x42, 0x2a, 0x21, 0xb2, 0x00, 0x01, 0x00, 0x43, 0x60,
-    0x42, 0x2d, 0xb0, 0x09, 0x2c, 0xb0, 0x00, 0x43, 0x23, 0x44, 0xb2, 0x00, 0x01, 0x00, 0x43, 0x60, 0x42, 0x2d, 0xb0,
-    0x0a, 0x2c, 0x20, 0x20, 0x45, 0x20, 0xb0, 0x01, 0x2b, 0x23, 0xb0, 0x00, 0x43, 0xb0, 0x04, 0x25, 0x60, 0x20, 0x45,
-    0x8a, 0x23, 0x61, 0x20, 0x64, 0x20, 0xb0, 0x20, 0x50, 0x58, 0x21, 0xb0, 0x00, 0x1b, 0xb0, 0x30, 0x50, 0x58, 0xb0,
-    0x20, 0x1b, 0xb0, 0x40, 0x59, 0x59, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59, 0xb0, 0x03, 0x25, 0x23, 0x61, 0x44,
-    0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x0b, 0x2c, 0x20, 0x20, 0x45, 0x20, 0xb0, 0x01, 0x2b, 0x23, 0xb0, 0x00, 0x43,
-    0xb0, 0x04, 0x25, 0x60, 0x20, 0x45, 0x8a, 0x23, 0x61, 0x20, 0x64, 0xb0, 0x24, 0x50, 0x58, 0xb0, 0x00, 0x1b, 0xb0,
-    0x40, 0x59, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59, 0xb0, 0x03, 0x25, 0x23, 0x61, 0x44, 0x44, 0xb0, 0x01, 0x60,
-    0x2d, 0xb0, 0x0c, 0x2c, 0x20, 0xb0, 0x00, 0x23, 0x42, 0xb2, 0x0b, 0x0a, 0x03, 0x45, 0x58, 0x21, 0x1b, 0x23, 0x21,
-    0x59, 0x2a, 0x21, 0x2d, 0xb0, 0x0d, 0x2c, 0xb1, 0x02, 0x02, 0x45, 0xb0, 0x64, 0x61, 0x44, 0x2d, 0xb0, 0x0e, 0x2c,
-    0xb0, 0x01, 0x60, 0x20, 0x20, 0xb0, 0x0c, 0x43, 0x4a, 0xb0, 0x00, 0x50, 0x58, 0x20, 0xb0, 0x0c, 0x23, 0x42, 0x59,
-    0xb0, 0x0d, 0x43, 0x4a, 0xb0, 0x00, 0x52, 0x58, 0x20, 0xb0, 0x0d, 0x23, 0x42, 0x59, 0x2d, 0xb0, 0x0f, 0x2c, 0x20,
-    0xb0, 0x10, 0x62, 0x66, 0xb0, 0x01, 0x63, 0x20, 0xb8, 0x04, 0x00, 0x63, 0x8a, 0x23, 0x61, 0xb0, 0x0e, 0x43, 0x60,
-    0x20, 0x8a, 0x60, 0x20, 0xb0, 0x0e, 0x23, 0x42, 0x23, 0x2d, 0xb0, 0x10, 0x2c, 0x4b, 0x54, 0x58, 0xb1, 0x04, 0x64,
-    0x44, 0x59, 0x24, 0xb0, 0x0d, 0x65, 0x23, 0x78, 0x2d, 0xb0, 0x11, 0x2c, 0x4b, 0x51, 0x58, 0x4b, 0x53, 0x58, 0xb1,
-    0x04, 0x64, 0x44, 0x59, 0x1b, 0x21, 0x59, 0x24, 0xb0, 0x13, 0x65, 0x23, 0x78, 0x2d, 0xb0, 0x12, 0x2c, 0xb1, 0x00,
-    0x0f, 0x43, 0x55, 0x58, 0xb1, 0x0f, 0x0f, 0x43, 0xb0, 0x01, 0x61, 0x42, 0xb0, 0x0f, 0x2b, 0x59, 0xb0, 0x00, 0x43,
-    0xb0, 0x02, 0x25, 0x42, 0xb1, 0x0c, 0x02, 0x25, 0x42, 0xb1, 0x0d, 0x02, 0x25, 0x42, 0xb0, 0x01, 0x16, 0x23, 0x20,
-    0xb0, 0x03, 0x25, 0x50, 0x58, 0xb1, 0x01, 0x00, 0x43, 0x60, 0xb0, 0x04, 0x25, 0x42, 0x8a, 0x8a, 0x20, 0x8a, 0x23,
-    0x61, 0xb0, 0x0e, 0x2a, 0x21, 0x23, 0xb0, 0x01, 0x61, 0x20, 0x8a, 0x23, 0x61, 0xb0, 0x0e, 0x2a, 0x21, 0x1b, 0xb1,
-    0x01, 0x00, 0x43, 0x60, 0xb0, 0x02, 0x25, 0x42, 0xb0, 0x02, 0x25, 0x61, 0xb0, 0x0e, 0x2a, 0x21, 0x59, 0xb0, 0x0c,
-    0x43, 0x47, 0xb0, 0x0d, 0x43, 0x47, 0x60, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59,
-    0x66, 0xb0, 0x01, 0x63, 0x20, 0xb0, 0x0b, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0,
-    0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0xb1, 0x00, 0x00, 0x13, 0x23, 0x44, 0xb0, 0x01, 0x43, 0xb0, 0x00,
-    0x3e, 0xb2, 0x01, 0x01, 0x01, 0x43, 0x60, 0x42, 0x2d, 0xb0, 0x13, 0x2c, 0x00, 0xb1, 0x00, 0x02, 0x45, 0x54, 0x58,
-    0xb0, 0x0f, 0x23, 0x42, 0x20, 0x45, 0xb0, 0x0b, 0x23, 0x42, 0xb0, 0x0a, 0x23, 0xb0, 0x04, 0x60, 0x42, 0x20, 0x60,
-    0xb0, 0x01, 0x61, 0xb5, 0x10, 0x10, 0x01, 0x00, 0x0e, 0x00, 0x42, 0x42, 0x8a, 0x60, 0xb1, 0x12, 0x06, 0x2b, 0xb0,
-    0x75, 0x2b, 0x1b, 0x22, 0x59, 0x2d, 0xb0, 0x14, 0x2c, 0xb1, 0x00, 0x13, 0x2b, 0x2d, 0xb0, 0x15, 0x2c, 0xb1, 0x01,
-    0x13, 0x2b, 0x2d, 0xb0, 0x16, 0x2c, 0xb1, 0x02, 0x13, 0x2b, 0x2d, 0xb0, 0x17, 0x2c, 0xb1, 0x03, 0x13, 0x2b, 0x2d,
-    0xb0, 0x18, 0x2c, 0xb1, 0x04, 0x13, 0x2b, 0x2d, 0xb0, 0x19, 0x2c, 0xb1, 0x05, 0x13, 0x2b, 0x2d, 0xb0, 0x1a, 0x2c,
-    0xb1, 0x06, 0x13, 0x2b, 0x2d, 0xb0, 0x1b, 0x2c, 0xb1, 0x07, 0x13, 0x2b, 0x2d, 0xb0, 0x1c, 0x2c, 0xb1, 0x08, 0x13,
-    0x2b, 0x2d, 0xb0, 0x1d, 0x2c, 0xb1, 0x09, 0x13, 0x2b, 0x2d, 0xb0, 0x29, 0x2c, 0x20, 0x2e, 0xb0, 0x01, 0x5d, 0x2d,
-    0xb0, 0x2a, 0x2c, 0x20, 0x2e, 0xb0, 0x01, 0x71, 0x2d, 0xb0, 0x2b, 0x2c, 0x20, 0x2e, 0xb0, 0x01, 0x72, 0x2d, 0xb0,
-    0x1e, 0x2c, 0x00, 0xb0, 0x0d, 0x2b, 0xb1, 0x00, 0x02, 0x45, 0x54, 0x58, 0xb0, 0x0f, 0x23, 0x42, 0x20, 0x45, 0xb0,
-    0x0b, 0x23, 0x42, 0xb0, 0x0a, 0x23, 0xb0, 0x04, 0x60, 0x42, 0x20, 0x60, 0xb0, 0x01, 0x61, 0xb5, 0x10, 0x10, 0x01,
-    0x00, 0x0e, 0x00, 0x42, 0x42, 0x8a, 0x60, 0xb1, 0x12, 0x06, 0x2b, 0xb0, 0x75, 0x2b, 0x1b, 0x22, 0x59, 0x2d, 0xb0,
-    0x1f, 0x2c, 0xb1, 0x00, 0x1e, 0x2b, 0x2d, 0xb0, 0x20, 0x2c, 0xb1, 0x01, 0x1e, 0x2b, 0x2d, 0xb0, 0x21, 0x2c, 0xb1,
-    0x02, 0x1e, 0x2b, 0x2d, 0xb0, 0x22, 0x2c, 0xb1, 0x03, 0x1e, 0x2b, 0x2d, 0xb0, 0x23, 0x2c, 0xb1, 0x04, 0x1e, 0x2b,
-    0x2d, 0xb0, 0x24, 0x2c, 0xb1, 0x05, 0x1e, 0x2b, 0x2d, 0xb0, 0x25, 0x2c, 0xb1, 0x06, 0x1e, 0x2b, 0x2d, 0xb0, 0x26,
-    0x2c, 0xb1, 0x07, 0x1e, 0x2b, 0x2d, 0xb0, 0x27, 0x2c, 0xb1, 0x08, 0x1e, 0x2b, 0x2d, 0xb0, 0x28, 0x2c, 0xb1, 0x09,
-    0x1e, 0x2b, 0x2d, 0xb0, 0x2c, 0x2c, 0x20, 0x3c, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x2d, 0x2c, 0x20, 0x60, 0xb0, 0x10,
-    0x60, 0x20, 0x43, 0x23, 0xb0, 0x01, 0x60, 0x43, 0xb0, 0x02, 0x25, 0x61, 0xb0, 0x01, 0x60, 0xb0, 0x2c, 0x2a, 0x21,
-    0x2d, 0xb0, 0x2e, 0x2c, 0xb0, 0x2d, 0x2b, 0xb0, 0x2d, 0x2a, 0x2d, 0xb0, 0x2f, 0x2c, 0x20, 0x20, 0x47, 0x20, 0x20,
-    0xb0, 0x0b, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0,
-    0x01, 0x63, 0x60, 0x23, 0x61, 0x38, 0x23, 0x20, 0x8a, 0x55, 0x58, 0x20, 0x47, 0x20, 0x20, 0xb0, 0x0b, 0x43, 0x63,
-    0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x23,
-    0x61, 0x38, 0x1b, 0x21, 0x59, 0x2d, 0xb0, 0x30, 0x2c, 0x00, 0xb1, 0x00, 0x02, 0x45, 0x54, 0x58, 0xb0, 0x01, 0x16,
-    0xb0, 0x2f, 0x2a, 0xb1, 0x05, 0x01, 0x15, 0x45, 0x58, 0x30, 0x59, 0x1b, 0x22, 0x59, 0x2d, 0xb0, 0x31, 0x2c, 0x00,
-    0xb0, 0x0d, 0x2b, 0xb1, 0x00, 0x02, 0x45, 0x54, 0x58, 0xb0, 0x01, 0x16, 0xb0, 0x2f, 0x2a, 0xb1, 0x05, 0x01, 0x15,
-    0x45, 0x58, 0x30, 0x59, 0x1b, 0x22, 0x59, 0x2d, 0xb0, 0x32, 0x2c, 0x20, 0x35, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x33,
-    0x2c, 0x00, 0xb0, 0x01, 0x45, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59,
-    0x66, 0xb0, 0x01, 0x63, 0xb0, 0x01, 0x2b, 0xb0, 0x0b, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50,
-    0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x01, 0x2b, 0xb0, 0x00, 0x16, 0xb4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x44, 0x3e, 0x23, 0x38, 0xb1, 0x32, 0x01, 0x15, 0x2a, 0x2d, 0xb0, 0x34, 0x2c, 0x20, 0x3c, 0x20, 0x47,
-    0x20, 0xb0, 0x0b, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66,
-    0xb0, 0x01, 0x63, 0x60, 0xb0, 0x00, 0x43, 0x61, 0x38, 0x2d, 0xb0, 0x35, 0x2c, 0x2e, 0x17, 0x3c, 0x2d, 0xb0, 0x36,
-    0x2c, 0x20, 0x3c, 0x20, 0x47, 0x20, 0xb0, 0x0b, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58,
-    0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0xb0, 0x00, 0x43, 0x61, 0xb0, 0x01, 0x43, 0x63, 0x38, 0x2d,
-    0xb0, 0x37, 0x2c, 0xb1, 0x02, 0x00, 0x16, 0x25, 0x20, 0x2e, 0x20, 0x47, 0xb0, 0x00, 0x23, 0x42, 0xb0, 0x02, 0x25,
-    0x49, 0x8a, 0x8a, 0x47, 0x23, 0x47, 0x23, 0x61, 0x20, 0x58, 0x62, 0x1b, 0x21, 0x59, 0xb0, 0x01, 0x23, 0x42, 0xb2,
-    0x36, 0x01, 0x01, 0x15, 0x14, 0x2a, 0x2d, 0xb0, 0x38, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25,
-    0x47, 0x23, 0x47, 0x23, 0x61, 0xb0, 0x09, 0x43, 0x2b, 0x65, 0x8a, 0x2e, 0x23, 0x20, 0x20, 0x3c, 0x8a, 0x38, 0x2d,
-    0xb0, 0x39, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61,
-    0x20, 0xb0, 0x04, 0x23, 0x42, 0xb0, 0x09, 0x43, 0x2b, 0x20, 0xb0, 0x60, 0x50, 0x58, 0x20, 0xb0, 0x40, 0x51, 0x58,
-    0xb3, 0x02, 0x20, 0x03, 0x20, 0x1b, 0xb3, 0x02, 0x26, 0x03, 0x1a, 0x59, 0x42, 0x42, 0x23, 0x20, 0xb0, 0x08, 0x43,
-    0x20, 0x8a, 0x23, 0x47, 0x23, 0x47, 0x23, 0x61, 0x23, 0x46, 0x60, 0xb0, 0x04, 0x43, 0xb0, 0x02, 0x62, 0x20, 0xb0,
-    0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x20, 0xb0, 0x01, 0x2b, 0x20, 0x8a, 0x8a,
-    0x61, 0x20, 0xb0, 0x02, 0x43, 0x60, 0x64, 0x23, 0xb0, 0x03, 0x43, 0x61, 0x64, 0x50, 0x58, 0xb0, 0x02, 0x43, 0x61,
-    0x1b, 0xb0, 0x03, 0x43, 0x60, 0x59, 0xb0, 0x03, 0x25, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40,
-    0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x61, 0x23, 0x20, 0x20, 0xb0, 0x04, 0x26, 0x23, 0x46, 0x61, 0x38, 0x1b, 0x23,
-    0xb0, 0x08, 0x43, 0x46, 0xb0, 0x02, 0x25, 0xb0, 0x08, 0x43, 0x47, 0x23, 0x47, 0x23, 0x61, 0x60, 0x20, 0xb0, 0x04,
-    0x43, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x23,
-    0x20, 0xb0, 0x01, 0x2b, 0x23, 0xb0, 0x04, 0x43, 0x60, 0xb0, 0x01, 0x2b, 0xb0, 0x05, 0x25, 0x61, 0xb0, 0x05, 0x25,
-    0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x04, 0x26,
-    0x61, 0x20, 0xb0, 0x04, 0x25, 0x60, 0x64, 0x23, 0xb0, 0x03, 0x25, 0x60, 0x64, 0x50, 0x58, 0x21, 0x1b, 0x23, 0x21,
-    0x59, 0x23, 0x20, 0x20, 0xb0, 0x04, 0x26, 0x23, 0x46, 0x61, 0x38, 0x59, 0x2d, 0xb0, 0x3a, 0x2c, 0xb0, 0x00, 0x16,
-    0x20, 0x20, 0x20, 0xb0, 0x05, 0x26, 0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0x23, 0x3c, 0x38, 0x2d, 0xb0, 0x3b,
-    0x2c, 0xb0, 0x00, 0x16, 0x20, 0xb0, 0x08, 0x23, 0x42, 0x20, 0x20, 0x20, 0x46, 0x23, 0x47, 0xb0, 0x01, 0x2b, 0x23,
-    0x61, 0x38, 0x2d, 0xb0, 0x3c, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x03, 0x25, 0xb0, 0x02, 0x25, 0x47, 0x23, 0x47, 0x23,
-    0x61, 0xb0, 0x00, 0x54, 0x58, 0x2e, 0x20, 0x3c, 0x23, 0x21, 0x1b, 0xb0, 0x02, 0x25, 0xb0, 0x02, 0x25, 0x47, 0x23,
-    0x47, 0x23, 0x61, 0x20, 0xb0, 0x05, 0x25, 0xb0, 0x04, 0x25, 0x47, 0x23, 0x47, 0x23, 0x61, 0xb0, 0x06, 0x25, 0xb0,
-    0x05, 0x25, 0x49, 0xb0, 0x02, 0x25, 0x61, 0xb9, 0x08, 0x00, 0x08, 0x00, 0x63, 0x63, 0x23, 0x20, 0x58, 0x62, 0x1b,
-    0x21, 0x59, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01,
-    0x63, 0x60, 0x23, 0x2e, 0x23, 0x20, 0x20, 0x3c, 0x8a, 0x38, 0x23, 0x21, 0x59, 0x2d, 0xb0, 0x3d, 0x2c, 0xb0, 0x00,
-    0x16, 0x20, 0xb0, 0x08, 0x43, 0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0x20, 0x60, 0xb0, 0x20, 0x60, 0x66, 0xb0,
-    0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x23, 0x20, 0x20, 0x3c,
-    0x8a, 0x38, 0x2d, 0xb0, 0x3e, 0x2c, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0x52, 0x58, 0x20, 0x3c, 0x59,
-    0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x3f, 0x2c, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0x50,
-    0x58, 0x20, 0x3c, 0x59, 0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x40, 0x2c, 0x23, 0x20, 0x2e, 0x46, 0xb0,
-    0x02, 0x25, 0x46, 0x52, 0x58, 0x20, 0x3c, 0x59, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0x50, 0x58, 0x20,
-    0x3c, 0x59, 0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x41, 0x2c, 0xb0, 0x38, 0x2b, 0x23, 0x20, 0x2e, 0x46,
-    0xb0, 0x02, 0x25, 0x46, 0x52, 0x58, 0x20, 0x3c, 0x59, 0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x42, 0x2c,
-    0xb0, 0x39, 0x2b, 0x8a, 0x20, 0x20, 0x3c, 0xb0, 0x04, 0x23, 0x42, 0x8a, 0x38, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02,
-    0x25, 0x46, 0x52, 0x58, 0x20, 0x3c, 0x59, 0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0xb0, 0x04, 0x43, 0x2e, 0xb0, 0x2e,
-    0x2b, 0x2d, 0xb0, 0x43, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x26, 0x20, 0x2e, 0x47, 0x23, 0x47,
-    0x23, 0x61, 0xb0, 0x09, 0x43, 0x2b, 0x23, 0x20, 0x3c, 0x20, 0x2e, 0x23, 0x38, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d,
-    0xb0, 0x44, 0x2c, 0xb1, 0x08, 0x04, 0x25, 0x42, 0xb0, 0x00, 0x16, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0x20, 0x2e,
-    0x47, 0x23, 0x47, 0x23, 0x61, 0x20, 0xb0, 0x04, 0x23, 0x42, 0xb0, 0x09, 0x43, 0x2b, 0x20, 0xb0, 0x60, 0x50, 0x58,
-    0x20, 0xb0, 0x40, 0x51, 0x58, 0xb3, 0x02, 0x20, 0x03, 0x20, 0x1b, 0xb3, 0x02, 0x26, 0x03, 0x1a, 0x59, 0x42, 0x42,
-    0x23, 0x20, 0x47, 0xb0, 0x04, 0x43, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66,
-    0xb0, 0x01, 0x63, 0x60, 0x20, 0xb0, 0x01, 0x2b, 0x20, 0x8a, 0x8a, 0x61, 0x20, 0xb0, 0x02, 0x43, 0x60, 0x64, 0x23,
-    0xb0, 0x03, 0x43, 0x61, 0x64, 0x50, 0x58, 0xb0, 0x02, 0x43, 0x61, 0x1b, 0xb0, 0x03, 0x43, 0x60, 0x59, 0xb0, 0x03,
-    0x25, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x61, 0xb0,
-    0x02, 0x25, 0x46, 0x61, 0x38, 0x23, 0x20, 0x3c, 0x23, 0x38, 0x1b, 0x21, 0x20, 0x20, 0x46, 0x23, 0x47, 0xb0, 0x01,
-    0x2b, 0x23, 0x61, 0x38, 0x21, 0x59, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x45, 0x2c, 0xb0, 0x38, 0x2b, 0x2e,
-    0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x46, 0x2c, 0xb0, 0x39, 0x2b, 0x21, 0x23, 0x20, 0x20, 0x3c, 0xb0, 0x04,
-    0x23, 0x42, 0x23, 0x38, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0xb0, 0x04, 0x43, 0x2e, 0xb0, 0x2e, 0x2b, 0x2d, 0xb0, 0x47,
-    0x2c, 0xb0, 0x00, 0x15, 0x20, 0x47, 0xb0, 0x00, 0x23, 0x42, 0xb2, 0x00, 0x01, 0x01, 0x15, 0x14, 0x13, 0x2e, 0xb0,
-    0x34, 0x2a, 0x2d, 0xb0, 0x48, 0x2c, 0xb0, 0x00, 0x15, 0x20, 0x47, 0xb0, 0x00, 0x23, 0x42, 0xb2, 0x00, 0x01, 0x01,
-    0x15, 0x14, 0x13, 0x2e, 0xb0, 0x34, 0x2a, 0x2d, 0xb0, 0x49, 0x2c, 0xb1, 0x00, 0x01, 0x14, 0x13, 0xb0, 0x35, 0x2a,
-    0x2d, 0xb0, 0x4a, 0x2c, 0xb0, 0x37, 0x2a, 0x2d, 0xb0, 0x4b, 0x2c, 0xb0, 0x00, 0x16, 0x45, 0x23, 0x20, 0x2e, 0x20,
-    0x46, 0x8a, 0x23, 0x61, 0x38, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x4c, 0x2c, 0xb0, 0x08, 0x23, 0x42, 0xb0,
-    0x4b, 0x2b, 0x2d, 0xb0, 0x4d, 0x2c, 0xb2, 0x00, 0x00, 0x44, 0x2b, 0x2d, 0xb0, 0x4e, 0x2c, 0xb2, 0x00, 0x01, 0x44,
-    0x2b, 0x2d, 0xb0, 0x4f, 0x2c, 0xb2, 0x01, 0x00, 0x44, 0x2b, 0x2d, 0xb0, 0x50, 0x2c, 0xb2, 0x01, 0x01, 0x44, 0x2b,
-    0x2d, 0xb0, 0x51, 0x2c, 0xb2, 0x00, 0x00, 0x45, 0x2b, 0x2d, 0xb0, 0x52, 0x2c, 0xb2, 0x00, 0x01, 0x45, 0x2b, 0x2d,
-    0xb0, 0x53, 0x2c, 0xb2, 0x01, 0x00, 0x45, 0x2b, 0x2d, 0xb0, 0x54, 0x2c, 0xb2, 0x01, 0x01, 0x45, 0x2b, 0x2d, 0xb0,
-    0x55, 0x2c, 0xb2, 0x00, 0x00, 0x41, 0x2b, 0x2d, 0xb0, 0x56, 0x2c, 0xb2, 0x00, 0x01, 0x41, 0x2b, 0x2d, 0xb0, 0x57,
-    0x2c, 0xb2, 0x01, 0x00, 0x41, 0x2b, 0x2d, 0xb0, 0x58, 0x2c, 0xb2, 0x01, 0x01, 0x41, 0x2b, 0x2d, 0xb0, 0x59, 0x2c,
-    0xb2, 0x00, 0x00, 0x43, 0x2b, 0x2d, 0xb0, 0x5a, 0x2c, 0xb2, 0x00, 0x01, 0x43, 0x2b, 0x2d, 0xb0, 0x5b, 0x2c, 0xb2,
-    0x01, 0x00, 0x43, 0x2b, 0x2d, 0xb0, 0x5c, 0x2c, 0xb2, 0x01, 0x01, 0x43, 0x2b, 0x2d, 0xb0, 0x5d, 0x2c, 0xb2, 0x00,
-    0x00, 0x46, 0x2b, 0x2d, 0xb0, 0x5e, 0x2c, 0xb2, 0x00, 0x01, 0x46, 0x2b, 0x2d, 0xb0, 0x5f, 0x2c, 0xb2, 0x01, 0x00,
-    0x46, 0x2b, 0x2d, 0xb0, 0x60, 0x2c, 0xb2, 0x01, 0x01, 0x46, 0x2b, 0x2d, 0xb0, 0x61, 0x2c, 0xb2, 0x00, 0x00, 0x42,
-    0x2b, 0x2d, 0xb0, 0x62, 0x2c, 0xb2, 0x00, 0x01, 0x42, 0x2b, 0x2d, 0xb0, 0x63, 0x2c, 0xb2, 0x01, 0x00, 0x42, 0x2b,
-    0x2d, 0xb0, 0x64, 0x2c, 0xb2, 0x01, 0x01, 0x42, 0x2b, 0x2d, 0xb0, 0x65, 0x2c, 0xb0, 0x3a, 0x2b, 0x2e, 0xb1, 0x2e,
-    0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x66, 0x2c, 0xb0, 0x3a, 0x2b, 0xb0, 0x3e, 0x2b, 0x2d, 0xb0, 0x67, 0x2c, 0xb0, 0x3a,
-    0x2b, 0xb0, 0x3f, 0x2b, 0x2d, 0xb0, 0x68, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x3a, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0,
-    0x69, 0x2c, 0xb0, 0x3b, 0x2b, 0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x6a, 0x2c, 0xb0, 0x3b, 0x2b, 0xb0,
-    0x3e, 0x2b, 0x2d, 0xb0, 0x6b, 0x2c, 0xb0, 0x3b, 0x2b, 0xb0, 0x3f, 0x2b, 0x2d, 0xb0, 0x6c, 0x2c, 0xb0, 0x3b, 0x2b,
-    0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x6d, 0x2c, 0xb0, 0x3c, 0x2b, 0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x6e,
-    0x2c, 0xb0, 0x3c, 0x2b, 0xb0, 0x3e, 0x2b, 0x2d, 0xb0, 0x6f, 0x2c, 0xb0, 0x3c, 0x2b, 0xb0, 0x3f, 0x2b, 0x2d, 0xb0,
-    0x70, 0x2c, 0xb0, 0x3c, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x71, 0x2c, 0xb0, 0x3d, 0x2b, 0x2e, 0xb1, 0x2e, 0x01,
-    0x14, 0x2b, 0x2d, 0xb0, 0x72, 0x2c, 0xb0, 0x3d, 0x2b, 0xb0, 0x3e, 0x2b, 0x2d, 0xb0, 0x73, 0x2c, 0xb0, 0x3d, 0x2b,
-    0xb0, 0x3f, 0x2b, 0x2d, 0xb0, 0x74, 0x2c, 0xb0, 0x3d, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x75, 0x2c, 0xb3, 0x09,
-    0x04, 0x02, 0x03, 0x45, 0x58, 0x21, 0x1b, 0x23, 0x21, 0x59, 0x42, 0x2b, 0xb0, 0x08, 0x65, 0xb0, 0x03, 0x24, 0x50,
-    0x78, 0xb1, 0x05, 0x01, 0x15, 0x45, 0x58, 0x30, 0x59, 0x2d, 0x00, 0x00, 0x4b, 0xb8, 0x00, 0xc8, 0x52, 0x58, 0xb1,
-    0x01, 0x01, 0x8e, 0x59, 0xb0, 0x01, 0xb9, 0x08, 0x00, 0x08, 0x00, 0x63, 0x70, 0xb1, 0x00, 0x06, 0x42, 0xb5, 0x00,
-    0x47, 0x33, 0x1f, 0x04, 0x00, 0x2a, 0xb1, 0x00, 0x06, 0x42, 0x40, 0x0a, 0x4d, 0x01, 0x3a, 0x08, 0x26, 0x08, 0x14,
-    0x07, 0x04, 0x08, 0x2a, 0xb1, 0x00, 0x06, 0x42, 0x40, 0x0a, 0x4e, 0x00, 0x44, 0x06, 0x30, 0x06, 0x1d, 0x05, 0x04,
-    0x08, 0x2a, 0xb1, 0x00, 0x0a, 0x42, 0xbd, 0x13, 0x80, 0x0e, 0xc0, 0x09, 0xc0, 0x05, 0x40, 0x00, 0x04, 0x00, 0x09,
-    0x2a, 0xb1, 0x00, 0x0e, 0x42, 0xbd, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x04, 0x00, 0x09, 0x2a,
-    0xb1, 0x03, 0x00, 0x44, 0xb1, 0x24, 0x01, 0x88, 0x51, 0x58, 0xb0, 0x40, 0x88, 0x58, 0xb1, 0x03, 0x64, 0x44, 0xb1,
-    0x26, 0x01, 0x88, 0x51, 0x58, 0xba, 0x08, 0x80, 0x00, 0x01, 0x04, 0x40, 0x88, 0x63, 0x54, 0x58, 0xb1, 0x03, 0x00,
-    0x44, 0x59, 0x59, 0x59, 0x59, 0x40, 0x0a, 0x4e, 0x00, 0x3c, 0x08, 0x28, 0x08, 0x16, 0x07, 0x04, 0x0c, 0x2a, 0xb8,
-    0x01, 0xff, 0x85, 0xb0, 0x04, 0x8d, 0xb1, 0x02, 0x00, 0x44, 0xb1, 0x05, 0x64, 0x44, 0x00, 0x00};
-unsigned int RobotoMono_Regular_ttf_len = 114624;
@@ -0,0 +1,38 @@
+"""Turn a TTF into a zlib-compressed EmbeddedFont_t source file for imfonts.
+
+    python embed_font.py Roboto-Regular.ttf Roboto_Regular RobotoRegular.cpp
+
+Declare the symbol in imfonts.h and add the .cpp to IMFONTS_SRC_LIST.
+"""
+import sys
+import zlib
+
+
+def fnv1a(data):
+    value = 14695981039346656037
+    for byte in data:
+        value = ((value ^ byte) * 1099511628211) & 0xFFFFFFFFFFFFFFFF
+    return value
+
+
+def main(ttf_path, symbol, output_path):
+    with open(ttf_path, "rb") as ttf:
+        data = ttf.read()
+    packed = zlib.compress(data, 9)
+    lines = []
+    for start in range(0, len(packed), 19):
+        lines.append("    " + ", ".join("0x%02x" % byte for byte in packed[start:start + 19]))
+    with open(output_path, "w", newline="\n") as out:
+        out.write('#include "imfonts.h"\n\n')
+        out.write("// %s, zlib level 9 (%d -> %d bytes); generated by embed_font.py\n" % (ttf_path.split("/")[-1], len(data), len(packed)))
+        out.write("static const unsigned char %s_zlib[] = {\n" % symbol)
+        out.write(",\n".join(lines))
+        out.write("};\n\n")
+        out.write('const EmbeddedFont_t %s = {"%s", %s_zlib, %d, %d, 0x%016xULL};\n'
+                  % (symbol, symbol, symbol, len(packed), len(data), fnv1a(data)))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 4:
+        sys.exit(__doc__)
+    main(sys.argv[1], sys.argv[2], sys.argv[3])
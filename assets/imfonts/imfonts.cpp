@@ -0,0 +1,9 @@
+#include "imfonts.h"
+
+#include <zlib.h>
+
+bool inflateEmbeddedFont(const EmbeddedFont_t& font, unsigned char* destination)
+{
+    uLongf size = font.inflatedSize;
+    return uncompress(destination, &size, font.data, font.size) == Z_OK && size == font.inflatedSize;
+}
@@ -3,24 +3,22 @@
 // Taked from mahi-gui project
 // https://github.com/mahilab/mahi-gui
 
-// ROBOTO
-
-extern unsigned char Roboto_Regular_ttf[];
-extern unsigned int  Roboto_Regular_ttf_len;
-
-extern unsigned char Roboto_Bold_ttf[];
-extern unsigned int  Roboto_Bold_ttf_len;
-
-extern unsigned char Roboto_Italic_ttf[];
-extern unsigned int  Roboto_Italic_ttf_len;
+#include <cstdint>
+
+// A TTF compiled into the executable as a zlib stream (see embed_font.py). Only fonts the UI draws are kept:
+// each one costs binary size and page-in at startup even when the baked font atlas makes it unnecessary.
+struct EmbeddedFont_t
+{
+    const char*          name;
+    const unsigned char* data;
+    unsigned int         size;
+    unsigned int         inflatedSize;
+    uint64_t             contentHash; // FNV-1a of the TTF, identifies it without inflating
+};
+
+// Inflate font into destination, which must hold font.inflatedSize bytes
+bool inflateEmbeddedFont(const EmbeddedFont_t& font, unsigned char* destination);
 
-// ROBOTO MONO
-
-extern unsigned char RobotoMono_Regular_ttf[];
-extern unsigned int  RobotoMono_Regular_ttf_len;
-
-extern unsigned char RobotoMono_Bold_ttf[];
-extern unsigned int  RobotoMono_Bold_ttf_len;
+// ROBOTO
 
-extern unsigned char RobotoMono_Italic_ttf[];
-extern unsigned int  RobotoMono_Italic_ttf_len;
+extern const EmbeddedFont_t Roboto_Regular;
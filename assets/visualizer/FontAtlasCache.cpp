@@ -0,0 +1,342 @@
+#include "FontAtlasCache.h"
+#include "MappedFile.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+namespace
+{
+    constexpr char     FILE_MAGIC[8] = {'M', 'P', '3', 'F', 'N', 'T', '0', '1'};
+    constexpr uint64_t FNV_OFFSET    = 14695981039346656037ULL;
+    constexpr size_t   LINE_COUNT    = IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1;
+    constexpr size_t   GLYPH_BYTES   = sizeof(uint32_t) + 9 * sizeof(float);
+
+    struct BakedFont_t
+    {
+        float                    fontSize = 0.0F;
+        float                    ascent   = 0.0F;
+        float                    descent  = 0.0F;
+        std::vector<ImFontGlyph> glyphs;
+    };
+
+    // Bounds-checked little cursor over the mapped file
+    class Reader
+    {
+      public:
+        Reader(const uint8_t* data, size_t size)
+            : mData(data)
+            , mSize(size)
+        {
+        }
+
+        template <typename T>
+        bool read(T& value)
+        {
+            if (mSize - mPosition < sizeof(T))
+            {
+                return false;
+            }
+            memcpy(&value, mData + mPosition, sizeof(T));
+            mPosition += sizeof(T);
+            return true;
+        }
+
+        const uint8_t* take(size_t bytes)
+        {
+            if (mSize - mPosition < bytes)
+            {
+                return nullptr;
+            }
+            const uint8_t* data = mData + mPosition;
+            mPosition += bytes;
+            return data;
+        }
+
+        bool atEnd() const { return mPosition == mSize; }
+
+      private:
+        const uint8_t* mData;
+        size_t         mSize;
+        size_t         mPosition = 0;
+    };
+
+    template <typename T>
+    void writeValue(std::vector<char>& out, T value)
+    {
+        const char* bytes = reinterpret_cast<const char*>(&value);
+        out.insert(out.end(), bytes, bytes + sizeof(T));
+    }
+}
+
+uint64_t FontAtlasCache::hashBytes(const void* data, size_t size, uint64_t hash)
+{
+    // FNV-1a; only short keys go through here, never TTF data
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t index = 0; index < size; ++index)
+    {
+        hash ^= bytes[index];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+FontSource_t FontAtlasCache::fromEmbedded(const EmbeddedFont_t& font, const ImFontConfig& config)
+{
+    FontSource_t source;
+    source.config      = config;
+    source.contentHash = font.contentHash;
+    source.add         = [embedded = &font](ImFontAtlas& atlas, const ImFontConfig& config)
+    {
+        // Inflated straight into a buffer the atlas owns and frees
+        void* data = IM_ALLOC(embedded->inflatedSize);
+        if (!inflateEmbeddedFont(*embedded, static_cast<unsigned char*>(data)))
+        {
+            printf("Unable to inflate the embedded font: %s\n", embedded->name);
+            IM_FREE(data);
+            return;
+        }
+        ImFontConfig owned         = config;
+        owned.FontDataOwnedByAtlas = true;
+        atlas.AddFontFromMemoryTTF(data, static_cast<int>(embedded->inflatedSize), config.SizePixels, &owned, config.GlyphRanges);
+    };
+    return source;
+}
+
+FontSource_t FontAtlasCache::fromFile(const std::filesystem::path& path, const ImFontConfig& config)
+{
+    // Path, size and modification time stand in for the content, so a cached start never reads the file
+    const std::string pathText = path.string();
+    std::error_code   error;
+    const uintmax_t   size     = std::filesystem::file_size(path, error);
+    const auto        modified = std::filesystem::last_write_time(path, error).time_since_epoch().count();
+
+    FontSource_t source;
+    source.config      = config;
+    source.contentHash = hashBytes(pathText.data(), pathText.size(), FNV_OFFSET);
+    source.contentHash = hashBytes(&size, sizeof(size), source.contentHash);
+    source.contentHash = hashBytes(&modified, sizeof(modified), source.contentHash);
+    source.add         = [pathText](ImFontAtlas& atlas, const ImFontConfig& config)
+    { atlas.AddFontFromFileTTF(pathText.c_str(), config.SizePixels, &config, config.GlyphRanges); };
+    return source;
+}
+
+FontSource_t FontAtlasCache::fromDefault(const ImFontConfig& config)
+{
+    // Part of ImGui, so the ImGui version in the key covers it
+    constexpr char name[] = "ProggyClean";
+    FontSource_t   source;
+    source.config      = config;
+    source.contentHash = hashBytes(name, sizeof(name), FNV_OFFSET);
+    source.add         = [](ImFontAtlas& atlas, const ImFontConfig& config) { atlas.AddFontDefault(&config); };
+    return source;
+}
+
+bool FontAtlasCache::loadOrBuild(ImFontAtlas& atlas, const std::vector<FontSource_t>& fonts, const std::filesystem::path& cacheFile)
+{
+    const uint64_t key = getKey(atlas, fonts);
+    if (!cacheFile.empty() && load(atlas, cacheFile, key))
+    {
+        return true;
+    }
+    for (const FontSource_t& font : fonts)
+    {
+        font.add(atlas, font.config);
+    }
+    atlas.Build();
+    if (!cacheFile.empty() && !save(atlas, cacheFile, key))
+    {
+        printf("Unable to write the font atlas cache: %s\n", cacheFile.string().c_str());
+    }
+    return false;
+}
+
+uint64_t FontAtlasCache::getKey(const ImFontAtlas& atlas, const std::vector<FontSource_t>& fonts)
+{
+    const auto hashValue = [](const auto& value, uint64_t hash) { return hashBytes(&value, sizeof(value), hash); };
+
+    uint64_t hash = hashBytes(FILE_MAGIC, sizeof(FILE_MAGIC), FNV_OFFSET);
+    hash          = hashValue(IMGUI_VERSION_NUM, hash);
+    hash          = hashValue(atlas.Flags, hash);
+    hash          = hashValue(atlas.TexDesiredWidth, hash);
+    hash          = hashValue(atlas.TexGlyphPadding, hash);
+    for (const FontSource_t& font : fonts)
+    {
+        const ImFontConfig& config = font.config;
+        hash                       = hashValue(font.contentHash, hash);
+        hash                       = hashValue(config.FontNo, hash);
+        hash                       = hashValue(config.SizePixels, hash);
+        hash                       = hashValue(config.OversampleH, hash);
+        hash                       = hashValue(config.OversampleV, hash);
+        hash                       = hashValue(config.PixelSnapH, hash);
+        hash                       = hashValue(config.GlyphExtraSpacing.x, hash);
+        hash                       = hashValue(config.GlyphExtraSpacing.y, hash);
+        hash                       = hashValue(config.GlyphOffset.x, hash);
+        hash                       = hashValue(config.GlyphOffset.y, hash);
+        hash                       = hashValue(config.GlyphMinAdvanceX, hash);
+        hash                       = hashValue(config.GlyphMaxAdvanceX, hash);
+        hash                       = hashValue(config.MergeMode, hash);
+        hash                       = hashValue(config.FontBuilderFlags, hash);
+        hash                       = hashValue(config.RasterizerMultiply, hash);
+        hash                       = hashValue(config.EllipsisChar, hash);
+        for (const ImWchar* range = config.GlyphRanges; range != nullptr && range[0] != 0; range += 2)
+        {
+            hash = hashValue(range[0], hash);
+            hash = hashValue(range[1], hash);
+        }
+    }
+    return hash;
+}
+
+bool FontAtlasCache::load(ImFontAtlas& atlas, const std::filesystem::path& path, uint64_t key)
+{
+    Player::MappedFile file;
+    if (!file.open(path))
+    {
+        return false;
+    }
+
+    // Parse everything before touching the atlas, so a bad file leaves it ready to build
+    Reader         reader(file.data(), file.size());
+    const uint8_t* magic = reader.take(sizeof(FILE_MAGIC));
+    uint64_t       fileKey;
+    uint32_t       width, height, fontCount, lineCount;
+    ImVec2         whitePixel;
+    if (magic == nullptr || memcmp(magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 || !reader.read(fileKey) ||
+        fileKey != key || !reader.read(width) || !reader.read(height) || !reader.read(fontCount) ||
+        !reader.read(lineCount) || !reader.read(whitePixel) || lineCount != LINE_COUNT || width == 0 || height == 0 ||
+        fontCount == 0 || fontCount > file.size() / (4 * sizeof(float)))
+    {
+        return false;
+    }
+    ImVec4 lines[LINE_COUNT];
+    for (ImVec4& line : lines)
+    {
+        if (!reader.read(line))
+        {
+            return false;
+        }
+    }
+    const uint8_t* pixels = reader.take(static_cast<size_t>(width) * height);
+    if (pixels == nullptr)
+    {
+        return false;
+    }
+
+    std::vector<BakedFont_t> fonts(fontCount);
+    for (BakedFont_t& font : fonts)
+    {
+        uint32_t glyphCount;
+        if (!reader.read(font.fontSize) || !reader.read(font.ascent) || !reader.read(font.descent) ||
+            !reader.read(glyphCount) || glyphCount > file.size() / GLYPH_BYTES)
+        {
+            return false;
+        }
+        font.glyphs.resize(glyphCount);
+        for (ImFontGlyph& glyph : font.glyphs)
+        {
+            uint32_t codepoint;
+            if (!reader.read(codepoint) || !reader.read(glyph.AdvanceX) || !reader.read(glyph.X0) ||
+                !reader.read(glyph.Y0) || !reader.read(glyph.X1) || !reader.read(glyph.Y1) || !reader.read(glyph.U0) ||
+                !reader.read(glyph.V0) || !reader.read(glyph.U1) || !reader.read(glyph.V1))
+            {
+                return false;
+            }
+            glyph.Codepoint = codepoint & 0x3FFFFFFF;
+            glyph.Visible   = (codepoint >> 30) & 1;
+            glyph.Colored   = (codepoint >> 31) & 1;
+        }
+    }
+    if (!reader.atEnd())
+    {
+        return false;
+    }
+
+    // Drop the font input (nothing is rasterized from it now) and install the baked output
+    const ImFontAtlasFlags flags = atlas.Flags;
+    atlas.Clear();
+    atlas.Flags           = flags;
+    atlas.TexWidth        = static_cast<int>(width);
+    atlas.TexHeight       = static_cast<int>(height);
+    atlas.TexUvScale      = ImVec2(1.0F / width, 1.0F / height);
+    atlas.TexUvWhitePixel = whitePixel;
+    std::copy(std::begin(lines), std::end(lines), atlas.TexUvLines);
+    atlas.TexPixelsAlpha8 = static_cast<unsigned char*>(IM_ALLOC(static_cast<size_t>(width) * height));
+    memcpy(atlas.TexPixelsAlpha8, pixels, static_cast<size_t>(width) * height);
+    for (BakedFont_t& baked : fonts)
+    {
+        ImFont* font         = IM_NEW(ImFont);
+        font->FontSize       = baked.fontSize;
+        font->Ascent         = baked.ascent;
+        font->Descent        = baked.descent;
+        font->ContainerAtlas = &atlas;
+        font->Glyphs.reserve(static_cast<int>(baked.glyphs.size()));
+        for (const ImFontGlyph& glyph : baked.glyphs)
+        {
+            font->Glyphs.push_back(glyph);
+        }
+        font->BuildLookupTable();
+        atlas.Fonts.push_back(font);
+    }
+    atlas.TexReady = true;
+    return true;
+}
+
+bool FontAtlasCache::save(ImFontAtlas& atlas, const std::filesystem::path& path, uint64_t key)
+{
+    unsigned char* pixels = nullptr;
+    int            width  = 0;
+    int            height = 0;
+    atlas.GetTexDataAsAlpha8(&pixels, &width, &height);
+    if (pixels == nullptr || atlas.TexPixelsUseColors || atlas.Fonts.empty())
+    {
+        return false;
+    }
+
+    std::vector<char> buffer(std::begin(FILE_MAGIC), std::end(FILE_MAGIC));
+    writeValue(buffer, key);
+    writeValue(buffer, static_cast<uint32_t>(width));
+    writeValue(buffer, static_cast<uint32_t>(height));
+    writeValue(buffer, static_cast<uint32_t>(atlas.Fonts.Size));
+    writeValue(buffer, static_cast<uint32_t>(LINE_COUNT));
+    writeValue(buffer, atlas.TexUvWhitePixel);
+    for (const ImVec4& line : atlas.TexUvLines)
+    {
+        writeValue(buffer, line);
+    }
+    buffer.insert(buffer.end(), pixels, pixels + static_cast<size_t>(width) * height);
+    for (const ImFont* font : atlas.Fonts)
+    {
+        writeValue(buffer, font->FontSize);
+        writeValue(buffer, font->Ascent);
+        writeValue(buffer, font->Descent);
+        writeValue(buffer, static_cast<uint32_t>(font->Glyphs.Size));
+        for (const ImFontGlyph& glyph : font->Glyphs)
+        {
+            const uint32_t visible = glyph.Visible;
+            const uint32_t colored = glyph.Colored;
+            writeValue(buffer, static_cast<uint32_t>(glyph.Codepoint) | (visible << 30) | (colored << 31));
+            for (float value : {glyph.AdvanceX, glyph.X0, glyph.Y0, glyph.X1, glyph.Y1, glyph.U0, glyph.V0, glyph.U1, glyph.V1})
+            {
+                writeValue(buffer, value);
+            }
+        }
+    }
+
+    // Write beside the old file and swap, so an interrupted start never leaves half an atlas behind
+    std::filesystem::path temporary = path;
+    temporary += ".tmp";
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        if (!out.good())
+        {
+            return false;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+    return !error;
+}
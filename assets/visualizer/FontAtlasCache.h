@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <vector>
+
+#include "imfonts.h"
+#include "imgui.h"
+
+// One font of the atlas, registered lazily: add() loads the TTF (inflating or reading it) and hands it to the atlas,
+// and is only called when the baked atlas cannot be used. Until then config and contentHash stand in for the data.
+struct FontSource_t
+{
+    ImFontConfig                                                         config; // size, ranges, merge mode, ...
+    uint64_t                                                             contentHash = 0;
+    std::function<void(ImFontAtlas& atlas, const ImFontConfig& config)> add;
+};
+
+// Baked ImGui font atlas on disk: the alpha8 texture plus every font's metrics and glyph table, so a start with
+// unchanged fonts maps one file instead of loading and rasterizing TTFs. The key is taken from the font sources
+// (content hash, sizes, oversampling, glyph ranges, merge flags) and the ImGui version, so any change to the font
+// setup misses the cache and the file is rewritten after the next build.
+class FontAtlasCache
+{
+  public:
+    // Font sources for the three kinds the player uses
+    static FontSource_t fromEmbedded(const EmbeddedFont_t& font, const ImFontConfig& config);
+    static FontSource_t fromFile(const std::filesystem::path& path, const ImFontConfig& config);
+    static FontSource_t fromDefault(const ImFontConfig& config); // ProggyClean, compiled into ImGui
+
+    // Install the atlas baked for fonts from cacheFile, or add and rasterize them and write cacheFile.
+    // True when the cache was used. An empty cacheFile always builds.
+    static bool loadOrBuild(ImFontAtlas& atlas, const std::vector<FontSource_t>& fonts, const std::filesystem::path& cacheFile);
+
+    static uint64_t getKey(const ImFontAtlas& atlas, const std::vector<FontSource_t>& fonts);
+
+    // Replace the content of atlas with the baked atlas in path when its key matches; false (atlas untouched)
+    // when the file is missing, stale or damaged
+    static bool load(ImFontAtlas& atlas, const std::filesystem::path& path, uint64_t key);
+
+    // Write a built atlas; false on I/O errors or when the texture holds colored glyphs (alpha8 only)
+    static bool save(ImFontAtlas& atlas, const std::filesystem::path& path, uint64_t key);
+
+  private:
+    static uint64_t hashBytes(const void* data, size_t size, uint64_t hash);
+};
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+
+// Per-stage wall clock timer for the render loop. Each stage is closed by a call to mark(), which charges the time
+// elapsed since the previous mark to that stage. A short history is kept so the UI can show averages and peaks.
+class FrameTimer
+{
+  public:
+    enum Stage_e
+    {
+        EVENTS      = 0,
+        UI_BUILD    = 1,
+        RENDER      = 2,
+        SWAP        = 3,
+        STAGE_COUNT = 4
+    };
+
+    static constexpr size_t mHistorySize = 120;
+
+    struct FrameStats_t
+    {
+        std::array<double, STAGE_COUNT> stageMs{};
+        double                          totalMs = 0.0;
+    };
+
+    static const char* getStageName(Stage_e stage)
+    {
+        static const char* names[STAGE_COUNT] = {"Events", "UI build", "Render", "Swap"};
+        return (stage < STAGE_COUNT) ? names[stage] : "";
+    }
+
+    void beginFrame()
+    {
+        mCurrent    = FrameStats_t{};
+        mFrameStart = Clock_t::now();
+        mLastMark   = mFrameStart;
+    }
+
+    void mark(Stage_e stage)
+    {
+        const auto now = Clock_t::now();
+        mCurrent.stageMs[stage] += std::chrono::duration<double, std::milli>(now - mLastMark).count();
+        mLastMark = now;
+    }
+
+    void endFrame()
+    {
+        mCurrent.totalMs = std::chrono::duration<double, std::milli>(mLastMark - mFrameStart).count();
+        mHistory[mHead]  = mCurrent;
+        mHead            = (mHead + 1) % mHistorySize;
+        if (mCount < mHistorySize)
+        {
+            ++mCount;
+        }
+    }
+
+    // Stats of the most recently completed frame
+    const FrameStats_t& getLast() const
+    {
+        return mHistory[(mHead + mHistorySize - 1) % mHistorySize];
+    }
+
+    FrameStats_t getAverage() const
+    {
+        FrameStats_t average;
+        if (mCount == 0)
+        {
+            return average;
+        }
+        for (size_t i = 0; i < mCount; ++i)
+        {
+            for (size_t stage = 0; stage < STAGE_COUNT; ++stage)
+            {
+                average.stageMs[stage] += mHistory[i].stageMs[stage];
+            }
+            average.totalMs += mHistory[i].totalMs;
+        }
+        for (size_t stage = 0; stage < STAGE_COUNT; ++stage)
+        {
+            average.stageMs[stage] /= static_cast<double>(mCount);
+        }
+        average.totalMs /= static_cast<double>(mCount);
+        return average;
+    }
+
+    FrameStats_t getPeak() const
+    {
+        FrameStats_t peak;
+        for (size_t i = 0; i < mCount; ++i)
+        {
+            for (size_t stage = 0; stage < STAGE_COUNT; ++stage)
+            {
+                peak.stageMs[stage] = (peak.stageMs[stage] > mHistory[i].stageMs[stage]) ? peak.stageMs[stage]
+                                                                                         : mHistory[i].stageMs[stage];
+            }
+            peak.totalMs = (peak.totalMs > mHistory[i].totalMs) ? peak.totalMs : mHistory[i].totalMs;
+        }
+        return peak;
+    }
+
+    size_t getFrameCount() const { return mCount; }
+
+  private:
+    using Clock_t = std::chrono::steady_clock;
+
+    std::array<FrameStats_t, mHistorySize> mHistory{};
+    size_t                                 mHead  = 0;
+    size_t                                 mCount = 0;
+    FrameStats_t                           mCurrent;
+    Clock_t::time_point                    mFrameStart;
+    Clock_t::time_point                    mLastMark;
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Wall clock phases of one launch, from the visualizer constructor until the initial track is playable. Each call to
+// mark() closes the phase since the previous mark. finish() appends the whole launch as one line to a log, so cold
+// starts (first launch after a reboot, or without a font atlas cache) and warm starts can be compared across runs.
+class StartupTimeline
+{
+  public:
+    struct Phase_t
+    {
+        const char* name = "";
+        double      ms   = 0.0; // duration of the phase
+        double      atMs = 0.0; // time since begin() when it ended
+    };
+
+    void begin()
+    {
+        mPhases.clear();
+        mStart    = Clock_t::now();
+        mLastMark = mStart;
+        mFinished = false;
+    }
+
+    void mark(const char* name)
+    {
+        const auto now = Clock_t::now();
+        mPhases.push_back({name, toMs(now - mLastMark), toMs(now - mStart)});
+        mLastMark = now;
+    }
+
+    // Record the launch as "date mode=... <phase>=<ms> ... total=<ms>" and print it; only the first call counts
+    void finish(const std::filesystem::path& logFile, const std::string& tags)
+    {
+        if (mFinished)
+        {
+            return;
+        }
+        mFinished = true;
+
+        const std::time_t now = std::time(nullptr);
+        char              date[32];
+        std::strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", std::localtime(&now));
+        std::string line = std::string(date) + " " + tags;
+        char        field[96];
+        for (const Phase_t& phase : mPhases)
+        {
+            snprintf(field, sizeof(field), " %s=%.1f", phase.name, phase.ms);
+            line += field;
+        }
+        snprintf(field, sizeof(field), " total=%.1f", getTotalMs());
+        line += field;
+
+        printf("Startup: %s\n", line.c_str());
+        std::ofstream out(logFile, std::ios::app);
+        out << line << '\n';
+    }
+
+    const std::vector<Phase_t>& getPhases() const { return mPhases; }
+    double                      getTotalMs() const { return mPhases.empty() ? 0.0 : mPhases.back().atMs; }
+    bool                        isFinished() const { return mFinished; }
+
+  private:
+    using Clock_t = std::chrono::steady_clock;
+
+    static double toMs(Clock_t::duration duration) { return std::chrono::duration<double, std::milli>(duration).count(); }
+
+    std::vector<Phase_t> mPhases;
+    Clock_t::time_point  mStart;
+    Clock_t::time_point  mLastMark;
+    bool                 mFinished = false;
+};
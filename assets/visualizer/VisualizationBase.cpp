@@ -145,19 +145,32 @@ void VisualizationBase::createImGuiContext(GLFWwindow* window, bool installCallb
     ImGui_ImplGlfw_InitForOpenGL(window, installCallbacks);
     ImGui_ImplOpenGL3_Init("#version 130");
 
-    // Setup Font
+    // Fonts are added by buildFonts() once the derived class knows all of them
     ImGui::GetIO().Fonts->Clear();
+}
+
+bool VisualizationBase::buildFonts(const std::filesystem::path& cacheFile)
+{
+    // Sources are only described here; their TTFs are loaded when the cached atlas cannot be used
+    ImFontAtlas& atlas = *ImGui::GetIO().Fonts;
+    atlas.Clear();
+    atlas.Flags |= ImFontAtlasFlags_NoMouseCursors; // OS cursors are used, and cursor shapes are not cached
+    std::vector<FontSource_t> fonts;
+    addFonts(fonts);
+    return FontAtlasCache::loadOrBuild(atlas, fonts, cacheFile);
+}
+
+void VisualizationBase::addFonts(std::vector<FontSource_t>& fonts)
+{
+    // Setup Font
     ImFontConfig font_cfg;
     strcpy(font_cfg.Name, "Roboto");
-    font_cfg.PixelSnapH           = true;
-    font_cfg.OversampleH          = 5;
-    font_cfg.OversampleV          = 5;
-    font_cfg.FontDataOwnedByAtlas = false;
-    ImGui::GetIO().Fonts->AddFontFromMemoryTTF(Roboto_Regular_ttf,
-                                               Roboto_Regular_ttf_len,
-                                               std::round(16),
-                                               &font_cfg,
-                                               ImGui::GetIO().Fonts->GetGlyphRangesCyrillic());
+    font_cfg.PixelSnapH  = true;
+    font_cfg.OversampleH = 5;
+    font_cfg.OversampleV = 5;
+    font_cfg.SizePixels  = std::round(16);
+    font_cfg.GlyphRanges = ImGui::GetIO().Fonts->GetGlyphRangesCyrillic();
+    fonts.push_back(FontAtlasCache::fromEmbedded(Roboto_Regular, font_cfg));
 }
 
 void VisualizationBase::newFrameImGui()
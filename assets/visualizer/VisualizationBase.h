@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <atomic>
 #include <array>
+#include <filesystem>
 #include <mutex>
 #include <queue>
 #include <string>
@@ -14,7 +15,7 @@
 #include "imgui_impl_glfw.h"
 #include "imgui_impl_opengl3.h"
 #include <chrono>
-#include <imfonts.h>
+#include "FontAtlasCache.h"
 #include "implot.h"
 
 class VisualizationBase
@@ -54,6 +55,8 @@ class VisualizationBase
                                      GLFWmousebuttonfun mouseButtonCallback    = nullptr,
                                      GLFWscrollfun      scrollCallback         = nullptr);
     void                createImGuiContext(GLFWwindow* window, bool installCallbacks = true);
+    bool                buildFonts(const std::filesystem::path& cacheFile);
+    virtual void        addFonts(std::vector<FontSource_t>& fonts);
     void                newFrameImGui();
     void                renderImGui();
     void                hideWindow(GLFWwindow* window);
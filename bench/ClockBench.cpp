@@ -0,0 +1,54 @@
+#include "PlaybackClock.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <thread>
+
+// Position reads as the UI does several times per frame. The old path was a waveOutGetPosition driver call.
+static void BM_PlaybackClockRead(benchmark::State& state)
+{
+    static Player::PlaybackClock clock;
+    if (state.thread_index() == 0)
+    {
+        clock.start(44100, 0, 2048);
+    }
+
+    uint64_t position = 0;
+    for (auto _ : state)
+    {
+        position = clock.getFramePosition();
+        benchmark::DoNotOptimize(position);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PlaybackClockRead)->Threads(1)->Threads(4);
+
+// Same, with a writer reporting consumed blocks as fast as it can, far above any real callback rate,
+// so readers regularly have to retry
+static void BM_PlaybackClockReadContended(benchmark::State& state)
+{
+    Player::PlaybackClock clock;
+    clock.start(44100, 0, 2048);
+
+    std::atomic<bool> stop{false};
+    std::thread       writer(
+        [&clock, &stop]
+        {
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                clock.onFramesConsumed(2048);
+            }
+        });
+
+    uint64_t position = 0;
+    for (auto _ : state)
+    {
+        position = clock.getFramePosition();
+        benchmark::DoNotOptimize(position);
+    }
+    stop = true;
+    writer.join();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PlaybackClockReadContended)->UseRealTime();
@@ -0,0 +1,138 @@
+#include "ControlServer.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    std::string getBenchEndpoint(const char* name)
+    {
+#ifdef _WIN32
+        return std::string("\\\\.\\pipe\\mp3bench-") + name;
+#else
+        return (std::filesystem::temp_directory_path() / (std::string("mp3bench-") + name + ".sock")).string();
+#endif
+    }
+
+    // Stands in for the UI thread: drains and answers commands as fast as it can instead of once per frame
+    class CommandPump
+    {
+    public:
+        explicit CommandPump(Player::ControlServer& server)
+            : mThread(
+                  [this, &server]
+                  {
+                      std::vector<Player::ControlCommand_t> commands;
+                      while (!mStop.load(std::memory_order_relaxed))
+                      {
+                          commands.clear();
+                          if (server.drainCommands(commands) == 0)
+                          {
+                              std::this_thread::yield();
+                          }
+                          for (const Player::ControlCommand_t& command : commands)
+                          {
+                              server.reply(command);
+                          }
+                      }
+                  })
+        {
+        }
+
+        ~CommandPump()
+        {
+            mStop = true;
+            mThread.join();
+        }
+
+    private:
+        std::atomic<bool> mStop{false};
+        std::thread       mThread;
+    };
+}
+
+// Request answered on the service thread: transport and parsing cost only
+static void BM_ControlPing(benchmark::State& state)
+{
+    Player::ControlServer server;
+    Player::ControlClient client;
+    if (!server.start(getBenchEndpoint("ping")) || !client.connect(server.getEndpoint()))
+    {
+        state.SkipWithError("control endpoint unavailable");
+        return;
+    }
+    std::string line;
+    for (auto _ : state)
+    {
+        client.sendLine("ping");
+        client.readLine(line, 1000);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ControlPing)->UseRealTime();
+
+// Transport command through the queue to the player thread and back, without the UI frame wait
+static void BM_ControlCommandRoundTrip(benchmark::State& state)
+{
+    Player::ControlServer server;
+    Player::ControlClient client;
+    if (!server.start(getBenchEndpoint("command")) || !client.connect(server.getEndpoint()))
+    {
+        state.SkipWithError("control endpoint unavailable");
+        return;
+    }
+    CommandPump pump(server);
+    std::string line;
+    for (auto _ : state)
+    {
+        client.sendLine("volume 0.5");
+        client.readLine(line, 1000);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ControlCommandRoundTrip)->UseRealTime();
+
+// Position pushes reaching N subscribers at 1 ms; items are pushes received
+static void BM_ControlPushFanout(benchmark::State& state)
+{
+    Player::ControlServer server;
+    Player::PlaybackClock clock;
+    clock.start(44100, 0, 2048);
+    server.attachClock(&clock);
+    Player::ControlStatus_t status;
+    status.playing         = true;
+    status.durationSeconds = 600.0;
+    server.publishStatus(status);
+    if (!server.start(getBenchEndpoint("push")))
+    {
+        state.SkipWithError("control endpoint unavailable");
+        return;
+    }
+
+    std::vector<std::unique_ptr<Player::ControlClient>> clients;
+    std::string                                         line;
+    for (int64_t index = 0; index < state.range(0); ++index)
+    {
+        clients.push_back(std::make_unique<Player::ControlClient>());
+        clients.back()->connect(server.getEndpoint());
+        clients.back()->sendLine("subscribe 1");
+        clients.back()->readLine(line, 1000);
+    }
+
+    int64_t pushes = 0;
+    for (auto _ : state)
+    {
+        for (const std::unique_ptr<Player::ControlClient>& client : clients)
+        {
+            pushes += client->readLine(line, 1000) ? 1 : 0;
+        }
+    }
+    state.SetItemsProcessed(pushes);
+}
+BENCHMARK(BM_ControlPushFanout)->Arg(1)->Arg(16)->UseRealTime();
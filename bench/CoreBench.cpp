@@ -0,0 +1,446 @@
+#include "PlayerCore.h"
+#include "SyntheticAudio.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // Transport without a device: enough state for the core's bookkeeping and the snapshot invariants
+    class NullOutput : public Player::PlayerOutput
+    {
+    public:
+        bool openTrack(Player::DecodedAudio_t&& audio, Player::TrackTags_t&&) override
+        {
+            mDuration = audio.getDurationSeconds();
+            mOpen     = true;
+            mPlaying  = false;
+            mPaused   = false;
+            return true;
+        }
+        bool startPlayback(double startSeconds) override
+        {
+            mPosition = startSeconds;
+            mPlaying  = mOpen;
+            mPaused   = false;
+            return mOpen;
+        }
+        void setPause() override { mPaused = mPlaying; }
+        void unSetPause() override { mPaused = false; }
+        void stop() override
+        {
+            mPlaying = false;
+            mPaused  = false;
+        }
+        void   setVolume(float, float) override {}
+        void   setEqualizerGains(const std::vector<float>&) override {}
+        double getPosition() const override { return mPosition; }
+        double getDuration() const override { return mDuration; }
+        bool   isOpen() const override { return mOpen; }
+        bool   isPlaying() const override { return mPlaying; }
+        bool   isPaused() const override { return mPaused; }
+        bool   isPlayedOut() const override { return false; }
+
+    private:
+        double mPosition = 0.0;
+        double mDuration = 0.0;
+        bool   mOpen     = false;
+        bool   mPlaying  = false;
+        bool   mPaused   = false;
+    };
+
+    // Transport whose track ends when playOut() says so, the way the sink reports the last block. Its position
+    // stops short of the duration, like the real clock held back by the output latency.
+    class PlayOutOutput : public Player::PlayerOutput
+    {
+    public:
+        static constexpr double LATENCY_SECONDS = 0.05;
+
+        bool openTrack(Player::DecodedAudio_t&& audio, Player::TrackTags_t&&) override
+        {
+            mDuration  = audio.getDurationSeconds();
+            mOpen      = true;
+            mPlaying   = false;
+            mPaused    = false;
+            mPlayedOut = false;
+            ++mOpenCount;
+            return true;
+        }
+        bool startPlayback(double) override
+        {
+            mPlaying   = mOpen;
+            mPaused    = false;
+            mPlayedOut = false;
+            return mOpen;
+        }
+        void setPause() override { mPaused = mPlaying; }
+        void unSetPause() override { mPaused = false; }
+        void stop() override
+        {
+            mPlaying   = false;
+            mPaused    = false;
+            mPlayedOut = false;
+        }
+        void   setVolume(float, float) override {}
+        void   setEqualizerGains(const std::vector<float>&) override {}
+        double getPosition() const override { return mPlayedOut ? mDuration - LATENCY_SECONDS : 0.0; }
+        double getDuration() const override { return mDuration; }
+        bool   isOpen() const override { return mOpen; }
+        bool   isPlaying() const override { return mPlaying; }
+        bool   isPaused() const override { return mPaused; }
+        bool   isPlayedOut() const override { return mPlayedOut; }
+
+        void   playOut() { mPlayedOut = mPlaying; }
+        size_t getOpenCount() const { return mOpenCount; }
+
+    private:
+        double mDuration  = 0.0;
+        bool   mOpen      = false;
+        bool   mPlaying   = false;
+        bool   mPaused    = false;
+        bool   mPlayedOut = false;
+        size_t mOpenCount = 0;
+    };
+
+    Player::PlayerCommand_t makeRandomCommand(std::mt19937& random)
+    {
+        static constexpr Player::PlayerCommandType_e TYPES[] = {Player::PLAYER_PLAY,
+                                                                Player::PLAYER_PAUSE,
+                                                                Player::PLAYER_RESUME,
+                                                                Player::PLAYER_TOGGLE_PAUSE,
+                                                                Player::PLAYER_STOP,
+                                                                Player::PLAYER_SELECT,
+                                                                Player::PLAYER_NEXT,
+                                                                Player::PLAYER_PREVIOUS,
+                                                                Player::PLAYER_VOLUME,
+                                                                Player::PLAYER_EQ,
+                                                                Player::PLAYER_SHUFFLE,
+                                                                Player::PLAYER_REPEAT,
+                                                                Player::PLAYER_ENQUEUE};
+        std::uniform_real_distribution<double> unit(-0.5, 1.5);
+        Player::PlayerCommand_t                command;
+        command.type   = TYPES[random() % std::size(TYPES)];
+        command.value  = unit(random);
+        command.value2 = unit(random) * 2.0 - 1.0;
+        command.index  = static_cast<int32_t>(random() % 80);  // some out of range on purpose
+        command.band   = static_cast<uint32_t>(random() % 6);  // likewise
+        return command;
+    }
+}
+
+// Several threads hammer one core with random commands (the tag encodes thread and per-thread sequence) while the
+// benchmark thread runs process() and another thread keeps reading snapshots. Fails if a command is lost, applied
+// out of its producer's order, or a snapshot breaks an invariant. Items are commands applied.
+static void BM_PlayerCoreCommandStress(benchmark::State& state)
+{
+    const size_t producers           = static_cast<size_t>(state.range(0));
+    constexpr size_t commandsPerThread = 20000;
+
+    int64_t applied  = 0;
+    int64_t retries  = 0;
+    int64_t readouts = 0;
+    for (auto _ : state)
+    {
+        NullOutput         output;
+        Player::PlayerCore core(output, [](const std::string& path) { return std::vector<std::filesystem::path>{path}; });
+
+        // Paths that do not exist, so track changes exercise the loader without decoding anything
+        Player::PlayerCommand_t playlist;
+        playlist.type = Player::PLAYER_ADD_TRACKS;
+        for (int index = 0; index < 64; ++index)
+        {
+            Player::ScannedTrack_t track;
+            track.path = "missing/stress_" + std::to_string(index) + ".mp3";
+            playlist.tracks.push_back(std::move(track));
+        }
+        core.post(std::move(playlist));
+        core.process();
+
+        std::atomic<bool>     stop{false};
+        std::atomic<int64_t>  queueFull{0};
+        std::atomic<int64_t>  violations{0};
+        std::atomic<int64_t>  snapshotsRead{0};
+        std::vector<uint64_t> lastSequence(producers, 0);
+
+        std::thread reader(
+            [&]
+            {
+                uint64_t lastVersion = 0;
+                while (!stop.load(std::memory_order_relaxed))
+                {
+                    const Player::PlayerSnapshotHandle snapshot = core.getSnapshot();
+                    const bool                         valid =
+                        snapshot->version >= lastVersion && snapshot->trackIndex < static_cast<int32_t>(snapshot->playlistSize) &&
+                        snapshot->volume >= 0.0F && snapshot->volume <= 1.0F && snapshot->balance >= -1.0F &&
+                        snapshot->balance <= 1.0F && snapshot->eqGainsDb.size() == Player::PlayerCore::EQ_BANDS &&
+                        (!snapshot->paused || snapshot->playing);
+                    violations += valid ? 0 : 1;
+                    lastVersion = snapshot->version;
+                    ++snapshotsRead;
+                }
+            });
+
+        std::vector<std::thread> threads;
+        for (size_t producer = 0; producer < producers; ++producer)
+        {
+            threads.emplace_back(
+                [&, producer]
+                {
+                    std::mt19937 random(static_cast<uint32_t>(producer + 1));
+                    for (uint64_t sequence = 1; sequence <= commandsPerThread; ++sequence)
+                    {
+                        Player::PlayerCommand_t command = makeRandomCommand(random);
+                        command.tag                     = (static_cast<uint64_t>(producer) << 32) | sequence;
+                        while (!core.post(std::move(command)))
+                        {
+                            ++queueFull;
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+        }
+
+        const size_t total = producers * commandsPerThread;
+        size_t       done  = 0;
+        while (done < total)
+        {
+            done += core.process(
+                [&](const Player::PlayerCommand_t& command, const std::string&)
+                {
+                    uint64_t& last     = lastSequence[command.tag >> 32];
+                    const uint64_t seq = command.tag & 0xFFFFFFFFu;
+                    violations += seq == last + 1 ? 0 : 1;
+                    last = seq;
+                });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        stop = true;
+        reader.join();
+
+        if (violations.load() != 0)
+        {
+            state.SkipWithError("command order or snapshot invariant violated");
+            break;
+        }
+        applied += static_cast<int64_t>(done);
+        retries += queueFull.load();
+        readouts += snapshotsRead.load();
+    }
+    state.counters["queue_full"]     = benchmark::Counter(static_cast<double>(retries), benchmark::Counter::kAvgIterations);
+    state.counters["snapshot_reads"] = benchmark::Counter(static_cast<double>(readouts), benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(applied);
+}
+BENCHMARK(BM_PlayerCoreCommandStress)->ArgName("producers")->Arg(1)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// A sort of the whole playlist, then reading it back from an M3U file, while the benchmark thread keeps calling
+// process() once a millisecond like the UI does per frame. Both run on the core's worker, so no process() call may
+// take longer than a frame or two. Fails above 50 ms, or if the track added behind each job is not applied after
+// it. What stays on the owner thread is swapping the result in and reordering the durations and flags.
+static void BM_PlayerCoreSortStall(benchmark::State& state)
+{
+    using Clock                     = std::chrono::steady_clock;
+    constexpr double MAX_PROCESS_MS = 50.0;
+    const size_t     entryCount     = static_cast<size_t>(state.range(0));
+    const std::filesystem::path m3uPath =
+        std::filesystem::temp_directory_path() / ("mp3bench_sortstall_" + std::to_string(entryCount) + ".m3u");
+
+    NullOutput              output;
+    Player::PlayerCore      core(output);
+    Player::PlayerCommand_t playlist;
+    playlist.type = Player::PLAYER_ADD_TRACKS;
+    std::mt19937 random(49);
+    for (size_t index = 0; index < entryCount; ++index)
+    {
+        playlist.paths.push_back("C:/Music/Artist " + std::to_string(random() % 5000) + "/Album/" +
+                                 std::to_string(random()) + ".mp3");
+    }
+    core.post(std::move(playlist));
+    core.process();
+
+    // Posts the job and a track behind it, then runs process() until both are applied
+    double     maxProcessMs = 0.0;
+    bool       lastAdded    = true;
+    const auto runJob       = [&](Player::PlayerCommand_t&& job)
+    {
+        // The file holds every entry, so after either job the track lands at the current size
+        const size_t expected = core.getPlaylist().size();
+        core.post(std::move(job));
+        Player::PlayerCommand_t add;
+        add.type  = Player::PLAYER_ADD_TRACKS;
+        add.paths = {"C:/Music/added behind the job.mp3"};
+        core.post(std::move(add));
+        do
+        {
+            const Clock::time_point start = Clock::now();
+            core.process();
+            maxProcessMs = std::max(maxProcessMs,
+                                    std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        } while (core.getSnapshot()->playlistBusy);
+        lastAdded = lastAdded && core.getPlaylist().size() == expected + 1 &&
+                    core.getPlaylist().getPath(expected) == "C:/Music/added behind the job.mp3";
+    };
+
+    for (auto _ : state)
+    {
+        Player::PlayerCommand_t sort;
+        sort.type  = Player::PLAYER_SORT_PLAYLIST;
+        sort.index = Player::PLAYLIST_COLUMN_PATH;
+        sort.value = state.iterations() % 2 == 0 ? 1.0 : 0.0;  // alternate, so every pass moves the entries
+        runJob(std::move(sort));
+
+        state.PauseTiming();
+        Player::PlayerCommand_t save;
+        save.type  = Player::PLAYER_SAVE_PLAYLIST;
+        save.paths = {m3uPath.string()};
+        core.post(std::move(save));
+        core.process();
+        state.ResumeTiming();
+
+        Player::PlayerCommand_t open;
+        open.type  = Player::PLAYER_OPEN_PLAYLIST;
+        open.paths = {m3uPath.string()};
+        runJob(std::move(open));
+    }
+    std::error_code error;
+    std::filesystem::remove(m3uPath, error);
+
+    state.counters["max_process_ms"] = maxProcessMs;
+    if (!lastAdded)
+    {
+        state.SkipWithError("a track added behind a sort or open was not applied after it");
+    }
+    else if (maxProcessMs > MAX_PROCESS_MS)
+    {
+        state.SkipWithError("a single process() stalled longer than 50 ms");
+    }
+}
+BENCHMARK(BM_PlayerCoreSortStall)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Four short tracks under repeat-all, each played out through the output's played-out flag while its position
+// stays short of the duration. Every track that plays out must be followed by the one the snapshot named as next,
+// opened from the prefetch: the resolver counts every decode the core starts, and adopting the prefetched job
+// starts none. Fails if a track does not advance within a second or is decoded a second time. Items are advances.
+static void BM_PlayerCoreAutoAdvance(benchmark::State& state)
+{
+    using Clock                  = std::chrono::steady_clock;
+    constexpr size_t TRACK_COUNT = 4;
+    constexpr size_t ADVANCES    = 8;
+
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "mp3bench_autoadvance";
+    std::filesystem::create_directories(directory);
+    const std::vector<uint8_t> data = Bench::makeSyntheticMp3(2.0);
+    Player::PlayerCommand_t    playlist;
+    playlist.type = Player::PLAYER_ADD_TRACKS;
+    for (size_t index = 0; index < TRACK_COUNT; ++index)
+    {
+        const std::filesystem::path path = directory / ("track_" + std::to_string(index) + ".mp3");
+        std::ofstream               out(path, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        playlist.paths.push_back(path.string());
+    }
+
+    std::string failure;
+    int64_t     advances = 0;
+    for (auto _ : state)
+    {
+        PlayOutOutput      output;
+        size_t             decodes = 0;
+        Player::PlayerCore core(output,
+                                [&decodes](const std::string& path)
+                                {
+                                    ++decodes;
+                                    return std::vector<std::filesystem::path>{path};
+                                });
+        Player::PlayerCommand_t tracks = playlist;
+        core.post(std::move(tracks));
+        Player::PlayerCommand_t repeat;
+        repeat.type  = Player::PLAYER_REPEAT;
+        repeat.index = Player::REPEAT_ALL;
+        core.post(std::move(repeat));
+        core.post(Player::PLAYER_PLAY);
+
+        // Runs process() until the output plays a track opened after openCount, false after a second
+        const auto waitForTrack = [&](size_t openCount)
+        {
+            const Clock::time_point deadline = Clock::now() + std::chrono::seconds(1);
+            while (Clock::now() < deadline)
+            {
+                core.process();
+                if (output.getOpenCount() > openCount && output.isPlaying())
+                {
+                    return true;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            return false;
+        };
+
+        if (!waitForTrack(0))
+        {
+            failure = "the first track never started";
+            break;
+        }
+        for (size_t step = 0; step < ADVANCES && failure.empty(); ++step)
+        {
+            // The first track's load and the prefetch of the second are the only decodes before the advances;
+            // after that, each advance starts exactly one, the prefetch of the track after it
+            const int32_t expected  = core.getSnapshot()->nextIndex;
+            const size_t  openCount = output.getOpenCount();
+            output.playOut();
+            if (!waitForTrack(openCount))
+            {
+                failure = "the track that played out was not followed by the next one";
+            }
+            else if (core.getSnapshot()->trackIndex != expected)
+            {
+                failure = "the track that followed was not the one the snapshot named as next";
+            }
+            else if (decodes != step + 3)
+            {
+                failure = "the next track was decoded again instead of adopting the prefetch";
+            }
+            ++advances;
+        }
+        if (!failure.empty())
+        {
+            break;
+        }
+    }
+    std::error_code error;
+    std::filesystem::remove_all(directory, error);
+
+    state.SetItemsProcessed(advances);
+    if (!failure.empty())
+    {
+        state.SkipWithError(failure.c_str());
+    }
+}
+BENCHMARK(BM_PlayerCoreAutoAdvance)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Uncontended post + drain of one command: the cost a UI click or control request adds before it is applied
+static void BM_CommandQueuePushPop(benchmark::State& state)
+{
+    Player::CommandQueue<Player::PlayerCommand_t> queue(1024);
+    Player::PlayerCommand_t                       command;
+    for (auto _ : state)
+    {
+        command.type = Player::PLAYER_VOLUME;
+        queue.push(std::move(command));
+        queue.pop(command);
+        benchmark::DoNotOptimize(command.value);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CommandQueuePushPop);
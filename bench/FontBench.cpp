@@ -0,0 +1,103 @@
+#include "FontAtlasCache.h"
+#include "SyntheticAudio.h"
+#include "imfonts.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    // The player's fonts (VisualizationBase::addFonts + ImGuiVis::getFontIcon) without the GL headers
+    std::vector<FontSource_t> makePlayerFonts(ImFontAtlas& atlas)
+    {
+        std::vector<FontSource_t> fonts;
+        ImFontConfig              robotoConfig;
+        strcpy(robotoConfig.Name, "Roboto");
+        robotoConfig.PixelSnapH  = true;
+        robotoConfig.OversampleH = 5;
+        robotoConfig.OversampleV = 5;
+        robotoConfig.SizePixels  = std::round(16);
+        robotoConfig.GlyphRanges = atlas.GetGlyphRangesCyrillic();
+        fonts.push_back(FontAtlasCache::fromEmbedded(Roboto_Regular, robotoConfig));
+        fonts.push_back(FontAtlasCache::fromDefault(ImFontConfig()));
+
+        // The GUI build copies the icon font next to the executables
+        const std::filesystem::path iconFile = Bench::findBundledFile("fa-solid-900.ttf");
+        if (!iconFile.empty())
+        {
+            static const ImWchar iconRanges[] = {0xe005, 0xf8ff, 0};
+            ImFontConfig         iconConfig;
+            iconConfig.MergeMode        = true;
+            iconConfig.PixelSnapH       = true;
+            iconConfig.GlyphMinAdvanceX = 16.0F;
+            iconConfig.SizePixels       = 16.0F;
+            iconConfig.GlyphRanges      = iconRanges;
+            fonts.push_back(FontAtlasCache::fromFile(iconFile, iconConfig));
+        }
+        return fonts;
+    }
+
+    std::filesystem::path getCachePath()
+    {
+        return std::filesystem::temp_directory_path() / "mp3bench_fontatlas.cache";
+    }
+}
+
+// Startup font cost without the cache: inflate / read the TTFs and rasterize them into the atlas
+static void BM_FontAtlasBuild(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        ImFontAtlas atlas;
+        atlas.Flags |= ImFontAtlasFlags_NoMouseCursors;
+        FontAtlasCache::loadOrBuild(atlas, makePlayerFonts(atlas), {});
+        benchmark::DoNotOptimize(atlas.TexPixelsAlpha8);
+    }
+}
+BENCHMARK(BM_FontAtlasBuild)->Unit(benchmark::kMillisecond);
+
+// Startup font cost with a warm cache: key the sources, map the baked atlas; no TTF is touched
+static void BM_FontAtlasLoadCached(benchmark::State& state)
+{
+    const std::filesystem::path path = getCachePath();
+    std::filesystem::remove(path);
+    {
+        ImFontAtlas atlas;
+        atlas.Flags |= ImFontAtlasFlags_NoMouseCursors;
+        FontAtlasCache::loadOrBuild(atlas, makePlayerFonts(atlas), path);
+    }
+    for (auto _ : state)
+    {
+        ImFontAtlas atlas;
+        atlas.Flags |= ImFontAtlasFlags_NoMouseCursors;
+        if (!FontAtlasCache::loadOrBuild(atlas, makePlayerFonts(atlas), path))
+        {
+            state.SkipWithError("cached atlas was rejected");
+            break;
+        }
+        benchmark::DoNotOptimize(atlas.TexPixelsAlpha8);
+    }
+    state.counters["file_MB"] = static_cast<double>(std::filesystem::file_size(path)) / (1024.0 * 1024.0);
+    std::filesystem::remove(path);
+}
+BENCHMARK(BM_FontAtlasLoadCached)->Unit(benchmark::kMillisecond);
+
+// What a cache miss pays to get the embedded Roboto back out of its zlib stream
+static void BM_EmbeddedFontInflate(benchmark::State& state)
+{
+    std::vector<unsigned char> data(Roboto_Regular.inflatedSize);
+    for (auto _ : state)
+    {
+        if (!inflateEmbeddedFont(Roboto_Regular, data.data()))
+        {
+            state.SkipWithError("inflate failed");
+            break;
+        }
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.SetBytesProcessed(state.iterations() * Roboto_Regular.inflatedSize);
+}
+BENCHMARK(BM_EmbeddedFontInflate)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,97 @@
+#include "LibraryScanner.h"
+#include "SyntheticAudio.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <map>
+#include <thread>
+
+namespace
+{
+    // Synthetic library trees are generated once per size in the temp directory and removed at exit
+    class SyntheticLibrary
+    {
+    public:
+        ~SyntheticLibrary()
+        {
+            for (const auto& [count, root] : mRoots)
+            {
+                std::error_code error;
+                std::filesystem::remove_all(root, error);
+            }
+        }
+
+        const std::filesystem::path& get(size_t fileCount)
+        {
+            auto found = mRoots.find(fileCount);
+            if (found != mRoots.end())
+            {
+                return found->second;
+            }
+
+            // One frame of audio plus an ID3v1 tag per file, 1000 files per folder
+            const std::filesystem::path root =
+                std::filesystem::temp_directory_path() / ("mp3bench_library_" + std::to_string(fileCount));
+            std::filesystem::remove_all(root);
+            std::vector<uint8_t> content(Bench::SYNTHETIC_FRAME_BYTES, 0);
+            std::copy(std::begin(Bench::SYNTHETIC_FRAME_HEADER), std::end(Bench::SYNTHETIC_FRAME_HEADER), content.begin());
+            std::vector<uint8_t> tag(128, 0);
+            memcpy(tag.data(), "TAG", 3);
+            memcpy(tag.data() + 3, "Synthetic title", 15);
+            memcpy(tag.data() + 33, "Synthetic artist", 16);
+            content.insert(content.end(), tag.begin(), tag.end());
+
+            for (size_t index = 0; index < fileCount; ++index)
+            {
+                const std::filesystem::path folder = root / ("album_" + std::to_string(index / 1000));
+                if (index % 1000 == 0)
+                {
+                    std::filesystem::create_directories(folder);
+                }
+                std::ofstream out(folder / ("track_" + std::to_string(index) + ".mp3"), std::ios::binary);
+                out.write(reinterpret_cast<const char*>(content.data()), static_cast<std::streamsize>(content.size()));
+            }
+            return mRoots.emplace(fileCount, root).first->second;
+        }
+
+    private:
+        std::map<size_t, std::filesystem::path> mRoots;
+    };
+
+    SyntheticLibrary gSyntheticLibrary;
+}
+
+// Full import: walk, probe in parallel and drain into a playlist-like vector the way the UI does each frame
+static void BM_LibraryScan(benchmark::State& state)
+{
+    const size_t                 fileCount   = static_cast<size_t>(state.range(0));
+    const size_t                 threadCount = static_cast<size_t>(state.range(1));
+    const std::filesystem::path& root        = gSyntheticLibrary.get(fileCount);
+
+    std::vector<Player::ScannedTrack_t> imported;
+    for (auto _ : state)
+    {
+        imported.clear();
+        Player::LibraryScanner scanner(threadCount);
+        scanner.start(root);
+        while (scanner.isRunning() || scanner.drainResults(imported, 4096) > 0)
+        {
+            if (scanner.drainResults(imported, 4096) == 0)
+            {
+                std::this_thread::yield();
+            }
+        }
+        if (imported.size() != fileCount)
+        {
+            state.SkipWithError("scan lost files");
+            return;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * fileCount));
+}
+BENCHMARK(BM_LibraryScan)
+    ->ArgNames({"files", "threads"})
+    ->ArgsProduct({{10000, 100000}, {1, 4, 8}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,91 @@
+#include "SyntheticAudio.h"
+#include "TrackLoader.h"
+
+#include <benchmark/benchmark.h>
+
+#include <fstream>
+#include <thread>
+
+namespace
+{
+    // Ten minutes of synthetic audio written once to the temp directory and removed at exit
+    class SyntheticTrackFile
+    {
+    public:
+        ~SyntheticTrackFile()
+        {
+            if (!mPath.empty())
+            {
+                std::error_code error;
+                std::filesystem::remove(mPath, error);
+            }
+        }
+
+        const std::filesystem::path& get()
+        {
+            if (mPath.empty())
+            {
+                mPath                           = std::filesystem::temp_directory_path() / "mp3bench_load.mp3";
+                const std::vector<uint8_t> data = Bench::makeSyntheticMp3(600.0);
+                std::ofstream              out(mPath, std::ios::binary);
+                out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+            }
+            return mPath;
+        }
+
+    private:
+        std::filesystem::path mPath;
+    };
+
+    SyntheticTrackFile gSyntheticTrack;
+}
+
+// Rapid track changes: `clicks` loads issued back to back, then wait for the last one. Superseded loads are
+// cancelled, so the time should stay close to a single load instead of growing with the number of clicks.
+static void BM_TrackLoadSuperseded(benchmark::State& state)
+{
+    const size_t                 clicks = static_cast<size_t>(state.range(0));
+    const std::filesystem::path& path   = gSyntheticTrack.get();
+
+    Player::TrackLoader loader;
+    for (auto _ : state)
+    {
+        Player::TrackLoadHandle last;
+        for (size_t click = 0; click < clicks; ++click)
+        {
+            last = loader.load({path});
+        }
+        loader.waitIdle();
+        if (last->getState() != Player::LOAD_DONE)
+        {
+            state.SkipWithError("load failed");
+            break;
+        }
+    }
+}
+BENCHMARK(BM_TrackLoadSuperseded)->ArgName("clicks")->Arg(1)->Arg(10)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Time from cancel() on a load in progress to the job reporting LOAD_CANCELLED
+static void BM_TrackLoadCancelLatency(benchmark::State& state)
+{
+    const std::filesystem::path& path = gSyntheticTrack.get();
+
+    Player::TrackLoader loader;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        Player::TrackLoadHandle job = loader.load({path});
+        while (job->getProgress() < 0.1F && !job->isFinished())
+        {
+            std::this_thread::yield();
+        }
+        state.ResumeTiming();
+
+        job->cancel();
+        while (!job->isFinished())
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+BENCHMARK(BM_TrackLoadCancelLatency)->Unit(benchmark::kMicrosecond)->UseRealTime();
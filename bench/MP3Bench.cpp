@@ -0,0 +1,219 @@
+#include "MP3Decoder.h"
+#include "ParallelDecoder.h"
+#include "PcmAnalysis.h"
+#include "SyntheticAudio.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+
+// Headless benchmarks of the audio core. Only mp3core is linked, no window or audio device is needed.
+//
+//     mp3bench --benchmark_out=mp3bench.json --benchmark_out_format=json
+
+namespace
+{
+    const std::vector<uint8_t>& getBundledTrack()
+    {
+        static const std::vector<uint8_t> track = []
+        {
+            const std::filesystem::path path = Bench::findBundledFile("Oryza.mp3");
+            return path.empty() ? std::vector<uint8_t>() : Bench::readFile(path);
+        }();
+        return track;
+    }
+
+    void decodeBuffer(benchmark::State& state, const std::vector<uint8_t>& data)
+    {
+        Player::DecodedAudio_t decoded;
+        for (auto _ : state)
+        {
+            if (!Player::MP3Decoder::decode(data.data(), data.size(), decoded))
+            {
+                state.SkipWithError("decode failed");
+                return;
+            }
+            benchmark::DoNotOptimize(decoded.samples.data());
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * data.size()));
+        state.counters["audio_s"]   = decoded.getDurationSeconds();
+        state.counters["realtime_x"] = benchmark::Counter(decoded.getDurationSeconds() * state.iterations(),
+                                                          benchmark::Counter::kIsRate);
+    }
+}
+
+static void BM_DecodeSynthetic(benchmark::State& state)
+{
+    const std::vector<uint8_t> data = Bench::makeSyntheticMp3(static_cast<double>(state.range(0)));
+    decodeBuffer(state, data);
+}
+BENCHMARK(BM_DecodeSynthetic)->Arg(30)->Arg(240)->Unit(benchmark::kMillisecond);
+
+static void BM_DecodeBundled(benchmark::State& state)
+{
+    const std::vector<uint8_t>& data = getBundledTrack();
+    if (data.empty())
+    {
+        state.SkipWithError("test/Oryza.mp3 not found");
+        return;
+    }
+    decodeBuffer(state, data);
+}
+BENCHMARK(BM_DecodeBundled)->Unit(benchmark::kMillisecond);
+
+// Whole-file decode split into chunks across threads; the output is checked against the serial decode once
+static void BM_DecodeParallel(benchmark::State& state)
+{
+    const std::vector<uint8_t> data = Bench::makeSyntheticMp3(static_cast<double>(state.range(0)));
+    Player::DecodedAudio_t     serial;
+    Player::MP3Decoder::decode(data.data(), data.size(), serial);
+
+    Player::ParallelDecoder decoder(static_cast<size_t>(state.range(1)));
+    Player::DecodedAudio_t  decoded;
+    for (auto _ : state)
+    {
+        if (!decoder.decode(data.data(), data.size(), decoded))
+        {
+            state.SkipWithError("decode failed");
+            return;
+        }
+        benchmark::DoNotOptimize(decoded.samples.data());
+    }
+    if (decoded.samples != serial.samples)
+    {
+        state.SkipWithError("output differs from the serial decode");
+        return;
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * data.size()));
+    state.counters["realtime_x"] = benchmark::Counter(decoded.getDurationSeconds() * state.iterations(),
+                                                      benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_DecodeParallel)
+    ->ArgNames({"seconds", "threads"})
+    ->ArgsProduct({{240, 3600}, {1, 2, 4, 8, 16}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// The synthetic stream is silent and never uses the bit reservoir, so it cannot show a chunk that starts without
+// the reservoir bytes it needs. These files can: the bundled track, and test/reservoir.mp3 (noise whose frames
+// start their main data up to 511 bytes back; written by test/make_reservoir_mp3.py). Fails unless the parallel
+// output equals the serial decode at every thread count.
+static void BM_DecodeParallelMatchesSerial(benchmark::State& state)
+{
+    constexpr const char*       FILES[] = {"Oryza.mp3", "reservoir.mp3"};
+    const char*                 name    = FILES[state.range(0)];
+    const std::filesystem::path path    = Bench::findBundledFile(name);
+    if (path.empty())
+    {
+        state.SkipWithError((std::string("test/") + name + " not found").c_str());
+        return;
+    }
+    const std::vector<uint8_t> data = Bench::readFile(path);
+
+    Player::MP3Stream_t stream;
+    if (!Player::MP3Decoder::scanFrames(data.data(), data.size(), stream))
+    {
+        state.SkipWithError("not an MP3 stream");
+        return;
+    }
+    // main_data_begin: the 9 bits after the header (and CRC); nonzero when a frame reads from the reservoir
+    size_t reservoirFrames = 0;
+    for (const Player::MP3Frame_t& frame : stream.frames)
+    {
+        const uint8_t* sideInfo = data.data() + frame.offset + ((data[frame.offset + 1] & 0x01) == 0 ? 6 : 4);
+        reservoirFrames += ((sideInfo[0] << 1) | (sideInfo[1] >> 7)) != 0 ? 1 : 0;
+    }
+
+    Player::DecodedAudio_t serial;
+    if (!Player::MP3Decoder::decode(data.data(), data.size(), serial))
+    {
+        state.SkipWithError("serial decode failed");
+        return;
+    }
+    if (std::all_of(serial.samples.begin(), serial.samples.end(), [](int16_t sample) { return sample == 0; }))
+    {
+        state.SkipWithError("serial decode is silent");
+        return;
+    }
+
+    Player::ParallelDecoder decoder(static_cast<size_t>(state.range(1)));
+    Player::DecodedAudio_t  decoded;
+    for (auto _ : state)
+    {
+        if (!decoder.decode(stream, decoded))
+        {
+            state.SkipWithError("decode failed");
+            return;
+        }
+        benchmark::DoNotOptimize(decoded.samples.data());
+    }
+    if (decoded.samples != serial.samples)
+    {
+        state.SkipWithError("output differs from the serial decode");
+        return;
+    }
+    state.SetLabel(name);
+    state.counters["frames"]           = static_cast<double>(stream.frames.size());
+    state.counters["reservoir_frames"] = static_cast<double>(reservoirFrames);
+    state.counters["realtime_x"]       = benchmark::Counter(decoded.getDurationSeconds() * state.iterations(),
+                                                          benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_DecodeParallelMatchesSerial)
+    ->ArgNames({"file", "threads"})
+    ->ArgsProduct({{0, 1}, {1, 2, 4, 8, 16}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+static void BM_ScanFrames(benchmark::State& state)
+{
+    const std::vector<uint8_t> data = Bench::makeSyntheticMp3(static_cast<double>(state.range(0)));
+    Player::MP3Stream_t        stream;
+    for (auto _ : state)
+    {
+        Player::MP3Decoder::scanFrames(data.data(), data.size(), stream);
+        benchmark::DoNotOptimize(stream.frames.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * data.size()));
+    state.counters["frames"] = static_cast<double>(stream.frames.size());
+}
+BENCHMARK(BM_ScanFrames)->Arg(240)->Unit(benchmark::kMicrosecond);
+
+static void BM_WaveformPreview(benchmark::State& state)
+{
+    const std::vector<int16_t> pcm        = Bench::makeSyntheticPcm(240.0);
+    const size_t               frameCount = pcm.size() / 2;
+    for (auto _ : state)
+    {
+        std::vector<float> preview =
+            Player::PcmAnalysis::getWaveformPreview(pcm.data(), frameCount, 2, static_cast<size_t>(state.range(0)));
+        benchmark::DoNotOptimize(preview.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * state.range(0)));
+}
+BENCHMARK(BM_WaveformPreview)->Arg(512)->Arg(4096)->Unit(benchmark::kMicrosecond);
+
+// Random access: locate the frame for a time offset and decode one second from there, including the priming
+// frames needed for the output to match a whole-stream decode.
+static void BM_SeekDecode(benchmark::State& state)
+{
+    const std::vector<uint8_t> data = Bench::makeSyntheticMp3(240.0);
+    Player::MP3Stream_t        stream;
+    Player::MP3Decoder::scanFrames(data.data(), data.size(), stream);
+    Player::MP3Decoder                    decoder;
+    std::vector<int16_t>                  out;
+    std::mt19937                          random(42);
+    std::uniform_real_distribution<double> position(0.0, stream.getDurationSeconds() - 1.0);
+    const size_t framesPerSecond = static_cast<size_t>(stream.format.sampleRate / stream.format.samplesPerFrame) + 1;
+    for (auto _ : state)
+    {
+        const size_t frame = static_cast<size_t>(position(random) * stream.format.sampleRate /
+                                                 stream.format.samplesPerFrame);
+        out.clear();
+        decoder.decodeRange(stream, frame, framesPerSecond, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_SeekDecode)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,180 @@
+#include "MetadataStore.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <random>
+
+namespace
+{
+    constexpr std::array<const char*, 48> WORDS = {
+        "love",   "night",  "blue",    "river",   "fire",     "dream",  "heart",    "city",
+        "rain",   "summer", "winter",  "light",   "shadow",   "dance",  "golden",   "silver",
+        "ocean",  "wild",   "home",    "road",    "storm",    "echo",   "young",    "forever",
+        "moon",   "sun",    "electric", "paper",  "glass",    "stone",  "velvet",   "midnight",
+        "morning", "ghost", "empire",  "garden",  "thunder",  "crystal", "desert",  "coast",
+        "neon",   "secret", "broken",  "sweet",   "northern", "radio",  "highway",  "mirror"};
+
+    std::string makePhrase(std::mt19937& random, size_t minWords, size_t maxWords)
+    {
+        std::uniform_int_distribution<size_t> wordCount(minWords, maxWords);
+        std::uniform_int_distribution<size_t> word(0, WORDS.size() - 1);
+        std::string                           phrase;
+        for (size_t index = wordCount(random); index > 0; --index)
+        {
+            if (!phrase.empty())
+            {
+                phrase += ' ';
+            }
+            std::string next = WORDS[word(random)];
+            next[0]          = static_cast<char>(next[0] - 'a' + 'A');
+            phrase += next;
+        }
+        return phrase;
+    }
+
+    // Deterministic track: ten albums of twelve tracks per artist
+    Player::TrackInfo_t makeTrack(std::mt19937& random, size_t index)
+    {
+        Player::TrackInfo_t track;
+        track.path = "/music/artist_" + std::to_string(index / 120) + "/album_" + std::to_string(index / 12) +
+                     "/track_" + std::to_string(index) + ".mp3";
+        track.title           = makePhrase(random, 1, 4);
+        track.artist          = makePhrase(random, 1, 2) + " " + std::to_string(index / 120);
+        track.album           = makePhrase(random, 1, 3);
+        track.modifiedTime    = static_cast<int64_t>(index);
+        track.fileSize        = 4000000 + index % 5000000;
+        track.durationSeconds = 120.0F + static_cast<float>(index % 240);
+        track.bitrateKbps     = 192;
+        return track;
+    }
+
+    Player::MetadataStore& getStore(size_t trackCount)
+    {
+        static std::map<size_t, std::unique_ptr<Player::MetadataStore>> stores;
+        auto&                                                          store = stores[trackCount];
+        if (!store)
+        {
+            store = std::make_unique<Player::MetadataStore>();
+            std::mt19937 random(42);
+            for (size_t index = 0; index < trackCount; ++index)
+            {
+                store->put(makeTrack(random, index));
+            }
+            // Measure the steady state, not whatever tail the last import left unindexed
+            store->rebuildIndex();
+        }
+        return *store;
+    }
+
+    constexpr std::array<const char*, 6> QUERIES = {"love", "midnight rain", "neon 7", "ro", "q", "zzzz"};
+}
+
+// One search page (up to 200 results) over the in-memory index; the request target is < 10 ms at 1M tracks
+static void BM_MetadataSearch(benchmark::State& state)
+{
+    const size_t           trackCount = static_cast<size_t>(state.range(0));
+    const char*            query      = QUERIES[static_cast<size_t>(state.range(1))];
+    Player::MetadataStore& store      = getStore(trackCount);
+
+    size_t matches = 0;
+    for (auto _ : state)
+    {
+        const auto results = store.search(query, 200);
+        matches            = results.size();
+        benchmark::DoNotOptimize(results.data());
+    }
+    state.SetLabel(std::string("\"") + query + "\" -> " + std::to_string(matches));
+}
+BENCHMARK(BM_MetadataSearch)
+    ->ArgNames({"tracks", "query"})
+    ->ArgsProduct({{100000, 1000000}, {0, 1, 2, 3, 4, 5}})
+    ->Unit(benchmark::kMicrosecond);
+
+// Startup cost: map the store file, parse every record and rebuild the path and trigram indexes
+static void BM_MetadataStoreOpen(benchmark::State& state)
+{
+    const size_t                trackCount = static_cast<size_t>(state.range(0));
+    const std::filesystem::path path =
+        std::filesystem::temp_directory_path() / ("mp3bench_library_" + std::to_string(trackCount) + ".db");
+    {
+        Player::MetadataStore writer;
+        std::filesystem::remove(path);
+        if (!writer.open(path))
+        {
+            state.SkipWithError("cannot create store file");
+            return;
+        }
+        std::mt19937 random(42);
+        for (size_t index = 0; index < trackCount; ++index)
+        {
+            writer.put(makeTrack(random, index));
+        }
+        writer.flush();
+    }
+
+    for (auto _ : state)
+    {
+        Player::MetadataStore store;
+        if (!store.open(path) || store.getLiveCount() != trackCount)
+        {
+            state.SkipWithError("store did not reload");
+            break;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * trackCount));
+    std::filesystem::remove(path);
+}
+BENCHMARK(BM_MetadataStoreOpen)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+// A folder import as the UI drives it: one put() per scanned file on the frame thread. Index rebuilds run on
+// the store's worker, so no single put() may hold a frame; the bound leaves room for the occasional vector
+// scheduler hiccup on a loaded machine but not for an inline rebuild (~0.9 s at 1M)
+static void BM_MetadataImportStall(benchmark::State& state)
+{
+    using Clock                 = std::chrono::steady_clock;
+    constexpr double MAX_PUT_MS = 50.0;
+    const size_t     trackCount = static_cast<size_t>(state.range(0));
+
+    std::vector<Player::TrackInfo_t> tracks;
+    tracks.reserve(trackCount);
+    std::mt19937 random(42);
+    for (size_t index = 0; index < trackCount; ++index)
+    {
+        tracks.push_back(makeTrack(random, index));
+    }
+
+    double maxPutMs      = 0.0;
+    size_t putsOverFrame = 0;
+    for (auto _ : state)
+    {
+        auto store    = std::make_unique<Player::MetadataStore>();
+        maxPutMs      = 0.0;
+        putsOverFrame = 0;
+        for (const auto& track : tracks)
+        {
+            const auto start = Clock::now();
+            store->put(track);
+            const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            maxPutMs        = std::max(maxPutMs, ms);
+            putsOverFrame += ms > 16.0 ? 1 : 0;
+        }
+
+        // Destroying the store waits for a build still in flight, which is not part of the import
+        state.PauseTiming();
+        store.reset();
+        state.ResumeTiming();
+    }
+    state.counters["max_put_ms"]     = maxPutMs;
+    state.counters["puts_over_16ms"] = static_cast<double>(putsOverFrame);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * trackCount));
+    if (maxPutMs > MAX_PUT_MS)
+    {
+        state.SkipWithError("a single put() stalled longer than 50 ms");
+    }
+}
+BENCHMARK(BM_MetadataImportStall)->Arg(300000)->Arg(1000000)->Iterations(1)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,61 @@
+#include "LevelMeter.h"
+#include "SyntheticAudio.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+
+namespace
+{
+    constexpr size_t   BLOCK_FRAMES = 2048;  // one sink block
+    constexpr uint32_t SAMPLE_RATE  = 44100;
+}
+
+// Metering one stereo sink block on the audio thread, scalar (simd:0) or SSE2 (simd:1). budget_pct is the share of
+// the block's own playback time (~46 ms) spent measuring it.
+static void BM_LevelMeterBlock(benchmark::State& state)
+{
+    const std::vector<int16_t> pcm    = Bench::makeSyntheticPcm(2.0, SAMPLE_RATE);
+    const size_t               blocks = pcm.size() / (BLOCK_FRAMES * 2);
+    Player::LevelMeter         meter;
+    meter.setSimdEnabled(state.range(0) != 0);
+    if (state.range(0) != 0 && !Player::LevelMeter::isSimdAvailable())
+    {
+        state.SkipWithError("SSE2 not available in this build");
+        return;
+    }
+    meter.reset(SAMPLE_RATE);
+
+    uint64_t frame = 0;
+    size_t   block = 0;
+    for (auto _ : state)
+    {
+        meter.process(pcm.data() + block * BLOCK_FRAMES * 2, BLOCK_FRAMES, 2, frame);
+        frame += BLOCK_FRAMES;
+        block = (block + 1) % blocks;
+    }
+    Player::LevelReading_t reading;
+    benchmark::DoNotOptimize(meter.read(frame, reading));
+
+    // kIsRate | kInvert turns this into elapsed time / (iterations * block time / 100)
+    const double blockSeconds    = static_cast<double>(BLOCK_FRAMES) / SAMPLE_RATE;
+    state.counters["budget_pct"] = benchmark::Counter(blockSeconds / 100.0 * static_cast<double>(state.iterations()),
+                                                      benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+    state.SetItemsProcessed(state.iterations() * BLOCK_FRAMES);
+}
+BENCHMARK(BM_LevelMeterBlock)->ArgName("simd")->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+// What the sink already does with every block: copy it into a device buffer. The meter's cost reads against this.
+static void BM_SinkBlockCopy(benchmark::State& state)
+{
+    const std::vector<int16_t> pcm = Bench::makeSyntheticPcm(0.1, SAMPLE_RATE);
+    std::vector<int16_t>       buffer(BLOCK_FRAMES * 2);
+    for (auto _ : state)
+    {
+        std::copy_n(pcm.data(), buffer.size(), buffer.data());
+        benchmark::DoNotOptimize(buffer.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * BLOCK_FRAMES);
+}
+BENCHMARK(BM_SinkBlockCopy)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,416 @@
+#include "LibraryScanner.h"
+#include "PlayOrder.h"
+#include "Playlist.h"
+#include "PlaylistParser.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+
+// Cost of the one-off label formatting the playlist view relies on, for imports of 1k to 1M tracks
+static void BM_PlaylistAddTracks(benchmark::State& state)
+{
+    const size_t                        count = static_cast<size_t>(state.range(0));
+    std::vector<Player::ScannedTrack_t> tracks(count);
+    char                                text[64];
+    for (size_t index = 0; index < count; ++index)
+    {
+        snprintf(text, sizeof(text), "/music/album_%04zu/track_%07zu.mp3", index / 1000, index);
+        tracks[index].path = text;
+        snprintf(text, sizeof(text), "Track %zu", index);
+        tracks[index].title           = text;
+        tracks[index].artist          = "Synthetic artist";
+        tracks[index].durationSeconds = 180.0 + static_cast<double>(index % 120);
+    }
+
+    for (auto _ : state)
+    {
+        Player::Playlist playlist;
+        for (const auto& track : tracks)
+        {
+            playlist.add(track);
+        }
+        benchmark::DoNotOptimize(playlist.getDisplayName(count - 1));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_PlaylistAddTracks)->Arg(1000)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+// Playlist reads for one frame of the clipped list view (label and flags of each visible row) wherever it is
+// scrolled to. The ImGui side of the same frame is BM_PlaylistListBoxFrame in mp3uibench.
+static void BM_PlaylistVisibleRows(benchmark::State& state)
+{
+    const size_t     count = static_cast<size_t>(state.range(0));
+    Player::Playlist playlist;
+    playlist.reserve(count);
+    char path[64];
+    for (size_t index = 0; index < count; ++index)
+    {
+        snprintf(path, sizeof(path), "/music/track_%07zu.mp3", index);
+        playlist.add(path);
+    }
+
+    constexpr size_t visibleRows = 16;
+    size_t           first       = 0;
+    for (auto _ : state)
+    {
+        size_t characters = 0;
+        for (size_t row = first; row < std::min(count, first + visibleRows); ++row)
+        {
+            characters += strlen(playlist.getDisplayName(row)) + playlist.getFlags(row);
+        }
+        benchmark::DoNotOptimize(characters);
+        first = (first + 7919) % count;
+    }
+}
+BENCHMARK(BM_PlaylistVisibleRows)->Arg(1000)->Arg(100000)->Arg(1000000);
+
+namespace
+{
+    // A tagged 1M-entry playlist saved once in each format, shared by the persistence benchmarks below
+    class SavedPlaylists
+    {
+    public:
+        static constexpr size_t ENTRY_COUNT = 1000000;
+
+        ~SavedPlaylists()
+        {
+            if (!mBase.empty())
+            {
+                std::error_code error;
+                std::filesystem::remove_all(mBase, error);
+            }
+        }
+
+        Player::Playlist& getPlaylist()
+        {
+            if (mPlaylist.empty())
+            {
+                Player::ScannedTrack_t track;
+                char                   text[64];
+                mPlaylist.reserve(ENTRY_COUNT);
+                for (size_t index = 0; index < ENTRY_COUNT; ++index)
+                {
+                    snprintf(text, sizeof(text), "/music/album_%04zu/track_%07zu.mp3", index / 1000, index);
+                    track.path = text;
+                    snprintf(text, sizeof(text), "Track %zu", index);
+                    track.title           = text;
+                    track.artist          = "Synthetic artist";
+                    track.durationSeconds = 180.0 + static_cast<double>(index % 120);
+                    mPlaylist.add(track);
+                }
+            }
+            return mPlaylist;
+        }
+
+        const std::filesystem::path& getFile(Player::PlaylistFormat_e format)
+        {
+            if (mBase.empty())
+            {
+                mBase = std::filesystem::temp_directory_path() / "mp3bench_playlists";
+                std::filesystem::create_directories(mBase);
+                mFiles[Player::PLAYLIST_BINARY] = mBase / "playlist.bin";
+                mFiles[Player::PLAYLIST_M3U]    = mBase / "playlist.m3u";
+                mFiles[Player::PLAYLIST_PLS]    = mBase / "playlist.pls";
+                for (const std::filesystem::path& file : mFiles)
+                {
+                    getPlaylist().save(file);
+                }
+            }
+            return mFiles[format];
+        }
+
+    private:
+        std::filesystem::path mBase;
+        std::filesystem::path mFiles[3];
+        Player::Playlist      mPlaylist;
+    };
+
+    SavedPlaylists gSavedPlaylists;
+
+    std::string readFile(const std::filesystem::path& path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+}
+
+// Write 1M entries in the binary format: header, records and string table, no per-entry formatting
+static void BM_PlaylistSaveBinary(benchmark::State& state)
+{
+    Player::Playlist&           playlist = gSavedPlaylists.getPlaylist();
+    const std::filesystem::path path     = std::filesystem::temp_directory_path() / "mp3bench_save.bin";
+    for (auto _ : state)
+    {
+        if (!playlist.save(path))
+        {
+            state.SkipWithError("save failed");
+            break;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * playlist.size()));
+    std::filesystem::remove(path);
+}
+BENCHMARK(BM_PlaylistSaveBinary)->Unit(benchmark::kMillisecond);
+
+// Open the saved 1M-entry playlist and draw its first and last rows: one mapping, the records copied, the strings
+// left in the page cache. Compare with BM_PlaylistAddTracks/1000000, which is what rebuilding it by hand costs.
+static void BM_PlaylistOpenBinary(benchmark::State& state)
+{
+    const std::filesystem::path& path = gSavedPlaylists.getFile(Player::PLAYLIST_BINARY);
+    for (auto _ : state)
+    {
+        Player::Playlist playlist;
+        if (!playlist.open(path))
+        {
+            state.SkipWithError("open failed");
+            break;
+        }
+        benchmark::DoNotOptimize(playlist.getDisplayName(0));
+        benchmark::DoNotOptimize(playlist.getDisplayName(playlist.size() - 1));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * SavedPlaylists::ENTRY_COUNT));
+}
+BENCHMARK(BM_PlaylistOpenBinary)->Unit(benchmark::kMillisecond);
+
+// Parse a 1M-entry M3U or PLS (range(0): 1 = M3U, 2 = PLS) on range(1) threads, text already in memory
+static void BM_PlaylistParseText(benchmark::State& state)
+{
+    const auto        format = static_cast<Player::PlaylistFormat_e>(state.range(0));
+    const std::string text   = readFile(gSavedPlaylists.getFile(format));
+    for (auto _ : state)
+    {
+        std::vector<Player::ScannedTrack_t> tracks;
+        Player::PlaylistParser::parse(text, format, "/music", tracks, static_cast<size_t>(state.range(1)));
+        if (tracks.size() != SavedPlaylists::ENTRY_COUNT)
+        {
+            state.SkipWithError("wrong entry count");
+            break;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * SavedPlaylists::ENTRY_COUNT));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size()));
+}
+BENCHMARK(BM_PlaylistParseText)
+    ->ArgsProduct({{Player::PLAYLIST_M3U, Player::PLAYLIST_PLS}, {1, 4, 8}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Format 1M entries as M3U on range(0) threads
+static void BM_PlaylistFormatM3u(benchmark::State& state)
+{
+    const Player::Playlist& playlist = gSavedPlaylists.getPlaylist();
+    std::string             text;
+    for (auto _ : state)
+    {
+        Player::PlaylistParser::write(playlist, Player::PLAYLIST_M3U, text, static_cast<size_t>(state.range(0)));
+        benchmark::DoNotOptimize(text.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * playlist.size()));
+}
+BENCHMARK(BM_PlaylistFormatM3u)->Arg(1)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+namespace
+{
+    constexpr size_t SORT_ENTRY_COUNT = 1000000;
+
+    // Tracks in random order with random durations and bitrates, so no column starts out sorted
+    std::vector<Player::ScannedTrack_t> makeShuffledTracks()
+    {
+        std::vector<Player::ScannedTrack_t> tracks(SORT_ENTRY_COUNT);
+        std::mt19937                        random(49);
+        char                                text[64];
+        for (size_t index = 0; index < tracks.size(); ++index)
+        {
+            snprintf(text, sizeof(text), "/music/album_%04zu/track_%07zu.mp3", index / 1000, index);
+            tracks[index].path = text;
+            snprintf(text, sizeof(text), "Track %zu", index);
+            tracks[index].title           = text;
+            tracks[index].artist          = "Artist " + std::to_string(index % 5000);
+            tracks[index].durationSeconds = 60.0 + static_cast<double>(random() % 600);
+            tracks[index].bitrateKbps     = 96 + 32 * (random() % 8);
+        }
+        std::shuffle(tracks.begin(), tracks.end(), random);
+        return tracks;
+    }
+
+    bool lessFolded(const std::string& a, const std::string& b)
+    {
+        const auto less = [](unsigned char x, unsigned char y) { return std::tolower(x) < std::tolower(y); };
+        return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(), less);
+    }
+
+    Player::Playlist& getShuffledPlaylist()
+    {
+        static Player::Playlist playlist;
+        if (playlist.empty())
+        {
+            const std::vector<Player::ScannedTrack_t> tracks = makeShuffledTracks();
+            playlist.reserve(tracks.size());
+            for (const Player::ScannedTrack_t& track : tracks)
+            {
+                playlist.add(track);
+            }
+        }
+        return playlist;
+    }
+}
+
+// Sort 1M entries by one column (range(0): PlaylistColumn_e). Numeric columns sort packed key + index words;
+// text columns sort 8-byte prefixes and read the arena only on ties. Every column is permuted afterwards.
+static void BM_PlaylistSortColumn(benchmark::State& state)
+{
+    Player::Playlist& playlist = getShuffledPlaylist();
+    const auto        column   = static_cast<Player::PlaylistColumn_e>(state.range(0));
+    for (auto _ : state)
+    {
+        playlist.sort(column, false);
+        state.PauseTiming();
+        playlist.sort(Player::PLAYLIST_COLUMN_ADDED, false);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * playlist.size()));
+}
+BENCHMARK(BM_PlaylistSortColumn)
+    ->Arg(Player::PLAYLIST_COLUMN_TITLE)
+    ->Arg(Player::PLAYLIST_COLUMN_PATH)
+    ->Arg(Player::PLAYLIST_COLUMN_DURATION)
+    ->Arg(Player::PLAYLIST_COLUMN_BITRATE)
+    ->Arg(Player::PLAYLIST_COLUMN_ADDED)
+    ->Unit(benchmark::kMillisecond);
+
+// The same sorts on an array of structs holding std::strings, the layout the playlist used to have
+static void BM_PlaylistSortStructs(benchmark::State& state)
+{
+    struct Track_t
+    {
+        std::string path;
+        std::string label;
+        float       durationSeconds = 0.0F;
+        uint32_t    bitrateKbps     = 0;
+    };
+    std::vector<Track_t> original;
+    original.reserve(SORT_ENTRY_COUNT);
+    for (const Player::ScannedTrack_t& track : makeShuffledTracks())
+    {
+        original.push_back({track.path,
+                            Player::Playlist::makeDisplayName(track),
+                            static_cast<float>(track.durationSeconds),
+                            track.bitrateKbps});
+    }
+
+    const auto column = static_cast<Player::PlaylistColumn_e>(state.range(0));
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::vector<Track_t> tracks = original;
+        state.ResumeTiming();
+        switch (column)
+        {
+        case Player::PLAYLIST_COLUMN_TITLE:
+            std::stable_sort(tracks.begin(),
+                             tracks.end(),
+                             [](const Track_t& a, const Track_t& b)
+                             { return lessFolded(a.label, b.label); });
+            break;
+        case Player::PLAYLIST_COLUMN_PATH:
+            std::stable_sort(tracks.begin(),
+                             tracks.end(),
+                             [](const Track_t& a, const Track_t& b)
+                             { return lessFolded(a.path, b.path); });
+            break;
+        case Player::PLAYLIST_COLUMN_BITRATE:
+            std::stable_sort(tracks.begin(),
+                             tracks.end(),
+                             [](const Track_t& a, const Track_t& b) { return a.bitrateKbps < b.bitrateKbps; });
+            break;
+        default:
+            std::stable_sort(tracks.begin(),
+                             tracks.end(),
+                             [](const Track_t& a, const Track_t& b) { return a.durationSeconds < b.durationSeconds; });
+            break;
+        }
+        benchmark::DoNotOptimize(tracks.data());
+        state.PauseTiming();
+        tracks = {};
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * original.size()));
+}
+BENCHMARK(BM_PlaylistSortStructs)
+    ->Arg(Player::PLAYLIST_COLUMN_TITLE)
+    ->Arg(Player::PLAYLIST_COLUMN_PATH)
+    ->Arg(Player::PLAYLIST_COLUMN_DURATION)
+    ->Arg(Player::PLAYLIST_COLUMN_BITRATE)
+    ->Unit(benchmark::kMillisecond);
+
+// Label substring filter and flag filter over 1M entries
+static void BM_PlaylistFilter(benchmark::State& state)
+{
+    const Player::Playlist& playlist = getShuffledPlaylist();
+    std::vector<uint32_t>   matches;
+    for (auto _ : state)
+    {
+        if (state.range(0) == 0)
+        {
+            playlist.filter("artist 42 - track 1", matches);
+        }
+        else
+        {
+            playlist.filterFlags(Player::PLAYLIST_FLAG_TAGGED, Player::PLAYLIST_FLAG_MISSING, matches);
+        }
+        benchmark::DoNotOptimize(matches.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * playlist.size()));
+    state.counters["matches"] = static_cast<double>(matches.size());
+}
+BENCHMARK(BM_PlaylistFilter)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+// One track change as the core makes it: peek (what the prefetch decodes) then next, over range(0) entries under
+// repeat-all, in order (range(1) 0) or shuffled (1). Fails unless every entry was played once per round.
+static void BM_PlayOrderNext(benchmark::State& state)
+{
+    const size_t      count = static_cast<size_t>(state.range(0));
+    Player::PlayOrder order(1);
+    order.reset(count);
+    order.setRepeat(Player::REPEAT_ALL);
+    int32_t current = 0;
+    order.setShuffle(state.range(1) != 0, current);
+
+    std::vector<uint32_t> plays(count, 0);
+    plays[current] = 1;
+    size_t steps   = 1;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(order.peekNext(current, false));
+        current = order.next(current, false);
+        ++plays[current];
+        ++steps;
+    }
+
+    // After k full rounds and r more steps, r entries were played k + 1 times and the rest k times
+    const size_t rounds = steps / count;
+    size_t       extra  = 0;
+    for (uint32_t played : plays)
+    {
+        if (played != rounds && played != rounds + 1)
+        {
+            state.SkipWithError("an entry repeated before the round was over");
+            return;
+        }
+        extra += played - rounds;
+    }
+    if (extra != steps % count)
+    {
+        state.SkipWithError("an entry repeated before the round was over");
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PlayOrderNext)->ArgNames({"entries", "shuffle"})->ArgsProduct({{1000, 1000000}, {0, 1}});
@@ -0,0 +1,193 @@
+#include "BufferPool.h"
+#include "MP3Decoder.h"
+#include "Profiler.h"
+#include "SyntheticAudio.h"
+#include "TrackLoader.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <fstream>
+#include <random>
+
+namespace
+{
+    constexpr size_t TRACK_FILES  = 8;
+    constexpr size_t TRACK_LOADS  = 1000;
+    constexpr size_t WARMUP_LOADS = 25;
+
+    // Synthetic tracks of 2 to 8 minutes, written once to the temp directory and removed at exit. Lengths differ
+    // so the decoded buffers rarely match exactly.
+    class SyntheticTracks
+    {
+    public:
+        SyntheticTracks()
+            : mRoot(std::filesystem::temp_directory_path() / "mp3bench_tracks")
+        {
+            std::filesystem::remove_all(mRoot);
+            std::filesystem::create_directories(mRoot);
+            for (size_t index = 0; index < TRACK_FILES; ++index)
+            {
+                const double               seconds = 120.0 + 360.0 * static_cast<double>(index) / (TRACK_FILES - 1);
+                const std::vector<uint8_t> data    = Bench::makeSyntheticMp3(seconds);
+                mPaths.push_back(mRoot / ("track_" + std::to_string(index) + ".mp3"));
+                std::ofstream out(mPaths.back(), std::ios::binary);
+                out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+                const size_t pcmBytes = static_cast<size_t>(seconds * Bench::SYNTHETIC_SAMPLE_RATE) * 2 * sizeof(int16_t);
+                mLongestBytes         = std::max(mLongestBytes, pcmBytes);
+            }
+        }
+
+        ~SyntheticTracks()
+        {
+            std::error_code error;
+            std::filesystem::remove_all(mRoot, error);
+        }
+
+        const std::vector<std::filesystem::path>& getPaths() const { return mPaths; }
+        size_t                                    getLongestBytes() const { return mLongestBytes; }
+
+        static const SyntheticTracks& get()
+        {
+            static const SyntheticTracks tracks;
+            return tracks;
+        }
+
+    private:
+        std::filesystem::path              mRoot;
+        std::vector<std::filesystem::path> mPaths;
+        size_t                             mLongestBytes = 0;
+    };
+
+    // Track changes as the player does them: TrackLoader decodes the next file into a pooled buffer while the
+    // previous track is still held, then the previous one is closed and its PCM goes back to the shared pool
+    class LoadCycle
+    {
+    public:
+        ~LoadCycle() { Player::PcmBufferPool::getShared().release(std::move(mPlaying.samples)); }
+
+        bool run(size_t loads)
+        {
+            const auto&                           paths = SyntheticTracks::get().getPaths();
+            std::uniform_int_distribution<size_t> pick(0, paths.size() - 1);
+            for (size_t load = 0; load < loads; ++load)
+            {
+                Player::TrackLoadHandle job = mLoader.load({paths[pick(mRandom)]});
+                mLoader.waitIdle();
+                if (job->getState() != Player::LOAD_DONE)
+                {
+                    return false;
+                }
+                Player::DecodedAudio_t next = std::move(job->getResult().audio);
+                // MP3Player::close()
+                Player::PcmBufferPool::getShared().release(std::move(mPlaying.samples));
+                mPlaying = std::move(next);
+            }
+            return true;
+        }
+
+    private:
+        Player::TrackLoader    mLoader;
+        std::mt19937           mRandom{42};
+        Player::DecodedAudio_t mPlaying;
+    };
+}
+
+// 1000 real track loads through the shared pool (pooled:1) or straight through the heap (pooled:0, a zero retain
+// budget makes every acquire a miss and every release a free; the reference, not bounded).
+//   rss_MB         resident memory after the last load minus before the first: the PCM of the playing track plus
+//                  whatever the pool keeps idle. Fails above the retain budget plus two tracks.
+//   rss_growth_MB  resident memory after the last load minus after the first 25, once the pool has filled to its
+//                  budget; fails above MAX_GROWTH_MB, which a pool that leaks or fragments would exceed.
+static void BM_PcmLoadCycle(benchmark::State& state)
+{
+    constexpr size_t       MAX_GROWTH_MB = 32;
+    const bool             pooled        = state.range(0) != 0;
+    Player::PcmBufferPool& pool          = Player::PcmBufferPool::getShared();
+    const size_t           budget        = pooled ? Player::PcmBufferPool::DEFAULT_RETAIN_BYTES : 0;
+    const size_t           longest       = SyntheticTracks::get().getLongestBytes();
+    // Class rounding adds up to ~19 % to every buffer, and 32 MB covers the decoder, the mapped file and the heap
+    const size_t maxRssBytes = budget + 2 * (longest + longest / 5) + (size_t(32) << 20);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        pool.trim();
+        pool.setRetainBudget(budget);
+        const Player::BufferPoolStats_t before = pool.getStats();
+        const size_t                    base   = Player::Profiler::getResidentBytes();
+        state.ResumeTiming();
+
+        size_t warm = 0;
+        size_t last = 0;
+        {
+            LoadCycle cycle;
+            if (!cycle.run(WARMUP_LOADS))
+            {
+                state.SkipWithError("track load failed");
+                break;
+            }
+            warm = Player::Profiler::getResidentBytes();
+            if (!cycle.run(TRACK_LOADS - WARMUP_LOADS))
+            {
+                state.SkipWithError("track load failed");
+                break;
+            }
+            last = Player::Profiler::getResidentBytes();
+        }
+
+        const Player::BufferPoolStats_t stats   = pool.getStats();
+        const uint64_t                  acquires = stats.acquires - before.acquires;
+        const double                    growthMB =
+            (static_cast<double>(last) - static_cast<double>(warm)) / (1 << 20);
+        state.counters["rss_MB"]        = (static_cast<double>(last) - static_cast<double>(base)) / (1 << 20);
+        state.counters["rss_growth_MB"] = growthMB;
+        state.counters["retained_MB"]   = static_cast<double>(stats.retainedBytes) / (1 << 20);
+        state.counters["hit_rate"]      = acquires ? static_cast<double>(stats.hits - before.hits) / acquires : 0.0;
+
+        state.PauseTiming();
+        pool.trim();
+        pool.setRetainBudget(Player::PcmBufferPool::DEFAULT_RETAIN_BYTES);
+        state.ResumeTiming();
+
+        if (pooled && growthMB > MAX_GROWTH_MB)
+        {
+            state.SkipWithError("resident memory kept growing after the warm-up loads");
+            break;
+        }
+        if (pooled && last > base && last - base > maxRssBytes)
+        {
+            state.SkipWithError("resident memory above the retain budget plus two tracks");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * TRACK_LOADS);
+}
+BENCHMARK(BM_PcmLoadCycle)
+    ->ArgName("pooled")
+    ->Arg(0)
+    ->Arg(1)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Back-to-back decodes of a short stream into a fresh DecodedAudio_t each time, returned to the shared pool the
+// way MP3Player::close() does; after the first iteration every output buffer comes from the pool.
+static void BM_DecodePooledOutput(benchmark::State& state)
+{
+    const std::vector<uint8_t> data = Bench::makeSyntheticMp3(10.0);
+    for (auto _ : state)
+    {
+        Player::DecodedAudio_t decoded;
+        if (!Player::MP3Decoder::decode(data.data(), data.size(), decoded))
+        {
+            state.SkipWithError("decode failed");
+            break;
+        }
+        Player::PcmBufferPool::getShared().release(std::move(decoded.samples));
+    }
+    const Player::BufferPoolStats_t stats = Player::PcmBufferPool::getShared().getStats();
+    state.counters["hit_rate"]            = stats.acquires ? static_cast<double>(stats.hits) / stats.acquires : 0.0;
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(data.size()));
+}
+BENCHMARK(BM_DecodePooledOutput)->Unit(benchmark::kMillisecond);
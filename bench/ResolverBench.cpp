@@ -0,0 +1,141 @@
+#include "PathResolver.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr size_t FILE_COUNT = 10000;
+
+    // Five search roots like the player's; the files only exist under the fourth, so an uncached lookup fails three
+    // stats before it finds the file, as a relative entry found next to the repo root does in the app
+    class SyntheticRoots
+    {
+    public:
+        ~SyntheticRoots()
+        {
+            if (!mBase.empty())
+            {
+                std::error_code error;
+                std::filesystem::remove_all(mBase, error);
+            }
+        }
+
+        const std::vector<std::filesystem::path>& get()
+        {
+            if (mRoots.empty())
+            {
+                mBase = std::filesystem::temp_directory_path() / "mp3bench_resolver";
+                std::filesystem::remove_all(mBase);
+                for (int root = 0; root < 5; ++root)
+                {
+                    mRoots.push_back(mBase / ("root_" + std::to_string(root)));
+                    std::filesystem::create_directories(mRoots.back() / "music");
+                }
+                for (size_t index = 0; index < FILE_COUNT; ++index)
+                {
+                    std::ofstream out(mRoots[3] / getSource(index), std::ios::binary);
+                    out << "ID3";
+                }
+            }
+            return mRoots;
+        }
+
+        static std::string getSource(size_t index) { return "music/track_" + std::to_string(index) + ".mp3"; }
+
+        std::vector<std::string> getSources() const
+        {
+            std::vector<std::string> sources;
+            sources.reserve(FILE_COUNT);
+            for (size_t index = 0; index < FILE_COUNT; ++index)
+            {
+                sources.push_back(getSource(index));
+            }
+            return sources;
+        }
+
+    private:
+        std::filesystem::path              mBase;
+        std::vector<std::filesystem::path> mRoots;
+    };
+
+    SyntheticRoots gRoots;
+}
+
+// One lookup without the cache: walk the search list until a candidate exists (what every track load did)
+static void BM_PathProbeUncached(benchmark::State& state)
+{
+    Player::PathResolver           resolver(gRoots.get(), 1);
+    const std::vector<std::string> sources = gRoots.getSources();
+    size_t                         index   = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(resolver.probe(sources[index++ % sources.size()]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PathProbeUncached)->Unit(benchmark::kMicrosecond);
+
+// One lookup of a path resolved at insertion: one stat of the canonical path to check its modification time
+static void BM_PathResolveCached(benchmark::State& state)
+{
+    Player::PathResolver           resolver(gRoots.get(), 1);
+    const std::vector<std::string> sources = gRoots.getSources();
+    resolver.resolveAsync(sources);
+    resolver.waitIdle();
+    const uint64_t missesBefore = resolver.getMisses();
+    size_t         index        = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(resolver.resolve(sources[index++ % sources.size()]));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["misses"] = static_cast<double>(resolver.getMisses() - missesBefore);
+}
+BENCHMARK(BM_PathResolveCached)->Unit(benchmark::kMicrosecond);
+
+// What the UI thread pays when a track is selected: the candidate list, cached path first, no I/O
+static void BM_PathCandidatesCached(benchmark::State& state)
+{
+    Player::PathResolver           resolver(gRoots.get(), 1);
+    const std::vector<std::string> sources = gRoots.getSources();
+    resolver.resolveAsync(sources);
+    resolver.waitIdle();
+    size_t index = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(resolver.getCandidates(sources[index++ % sources.size()]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PathCandidatesCached)->Unit(benchmark::kMicrosecond);
+
+// Bulk add: resolve 10k relative paths on range(0) threads into an empty cache; us_per_lookup is wall time per path
+static void BM_PathResolveBulk(benchmark::State& state)
+{
+    const std::vector<std::filesystem::path>& roots   = gRoots.get();
+    const std::vector<std::string>            sources = gRoots.getSources();
+    double                                    totalUs = 0.0;
+    for (auto _ : state)
+    {
+        Player::PathResolver resolver(roots, static_cast<size_t>(state.range(0)));
+        const auto           start = std::chrono::steady_clock::now();
+        resolver.resolveAsync(sources);
+        resolver.waitIdle();
+        totalUs += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        if (resolver.getCachedCount() != sources.size())
+        {
+            state.SkipWithError("not every path was resolved");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(sources.size()));
+    state.counters["us_per_lookup"] =
+        totalUs / static_cast<double>(std::max<int64_t>(state.iterations(), 1) * static_cast<int64_t>(sources.size()));
+}
+BENCHMARK(BM_PathResolveBulk)->Arg(1)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond)->UseRealTime();
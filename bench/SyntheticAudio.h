@@ -0,0 +1,81 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+// Inputs shared by the headless benchmarks: synthetic streams that need no fixtures, and the bundled test track
+namespace Bench
+{
+
+    // MPEG1 Layer III, 128 kbps, 44.1 kHz, joint stereo, no padding: 417 bytes and 1152 samples per frame
+    constexpr uint8_t SYNTHETIC_FRAME_HEADER[4] = {0xFF, 0xFB, 0x90, 0x40};
+    constexpr size_t  SYNTHETIC_FRAME_BYTES     = 417;
+    constexpr size_t  SYNTHETIC_FRAME_SAMPLES   = 1152;
+    constexpr double  SYNTHETIC_SAMPLE_RATE     = 44100.0;
+
+    // A valid MP3 stream of all-zero side info and main data (decodes to silence but runs the full
+    // synthesis path). No encoder is needed to produce it.
+    inline std::vector<uint8_t> makeSyntheticMp3(double seconds)
+    {
+        const size_t         frameCount = static_cast<size_t>(seconds * SYNTHETIC_SAMPLE_RATE / SYNTHETIC_FRAME_SAMPLES);
+        std::vector<uint8_t> data(frameCount * SYNTHETIC_FRAME_BYTES, 0);
+        for (size_t frame = 0; frame < frameCount; ++frame)
+        {
+            std::copy(std::begin(SYNTHETIC_FRAME_HEADER),
+                      std::end(SYNTHETIC_FRAME_HEADER),
+                      data.begin() + frame * SYNTHETIC_FRAME_BYTES);
+        }
+        return data;
+    }
+
+    // Interleaved stereo 16-bit PCM: two detuned tones plus a little noise
+    inline std::vector<int16_t> makeSyntheticPcm(double seconds, uint32_t sampleRate = 44100)
+    {
+        const size_t                          frameCount = static_cast<size_t>(seconds * sampleRate);
+        std::vector<int16_t>                  samples(frameCount * 2);
+        std::mt19937                          random(1234);
+        std::uniform_real_distribution<float> noise(-0.02F, 0.02F);
+        const double                          twoPi = 6.283185307179586;
+        for (size_t frame = 0; frame < frameCount; ++frame)
+        {
+            const double t       = static_cast<double>(frame) / sampleRate;
+            const float  left    = static_cast<float>(0.45 * std::sin(twoPi * 440.0 * t)) + noise(random);
+            const float  right   = static_cast<float>(0.45 * std::sin(twoPi * 443.0 * t)) + noise(random);
+            samples[frame * 2]     = static_cast<int16_t>(left * 32767.0F);
+            samples[frame * 2 + 1] = static_cast<int16_t>(right * 32767.0F);
+        }
+        return samples;
+    }
+
+    // Locate a bundled file next to the executable, in the working directory or in the source tree's test/ folder
+    inline std::filesystem::path findBundledFile(const std::string& name)
+    {
+        std::vector<std::filesystem::path> candidates = {std::filesystem::current_path() / name,
+                                                         std::filesystem::current_path() / "test" / name};
+#ifdef MP3PLAYER_SOURCE_DIR
+        candidates.push_back(std::filesystem::path(MP3PLAYER_SOURCE_DIR) / "test" / name);
+#endif
+        for (const auto& candidate : candidates)
+        {
+            if (std::filesystem::exists(candidate))
+            {
+                return candidate;
+            }
+        }
+        return {};
+    }
+
+    inline std::vector<uint8_t> readFile(const std::filesystem::path& path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        return std::vector<uint8_t>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+}
@@ -0,0 +1,290 @@
+#include "SyntheticAudio.h"
+#include "TagReader.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+    enum CorpusKind_e
+    {
+        KIND_ID3V23_UTF16,  // ID3v2.3 UTF-16 text, Xing + LAME header
+        KIND_ID3V24_ART,    // ID3v2.4 UTF-8 text behind 64 KB of cover art, constant bitrate
+        KIND_APE,           // APEv2 + ID3v1 at the end
+        KIND_ID3V1,         // ID3v1.1 only
+        KIND_COUNT
+    };
+
+    constexpr size_t AUDIO_FRAMES = 24;
+
+    void appendBe32(std::vector<uint8_t>& out, uint32_t value)
+    {
+        out.push_back(static_cast<uint8_t>(value >> 24));
+        out.push_back(static_cast<uint8_t>(value >> 16));
+        out.push_back(static_cast<uint8_t>(value >> 8));
+        out.push_back(static_cast<uint8_t>(value));
+    }
+
+    void appendLe32(std::vector<uint8_t>& out, uint32_t value)
+    {
+        out.push_back(static_cast<uint8_t>(value));
+        out.push_back(static_cast<uint8_t>(value >> 8));
+        out.push_back(static_cast<uint8_t>(value >> 16));
+        out.push_back(static_cast<uint8_t>(value >> 24));
+    }
+
+    void appendSyncsafe32(std::vector<uint8_t>& out, uint32_t value)
+    {
+        out.push_back(static_cast<uint8_t>((value >> 21) & 0x7F));
+        out.push_back(static_cast<uint8_t>((value >> 14) & 0x7F));
+        out.push_back(static_cast<uint8_t>((value >> 7) & 0x7F));
+        out.push_back(static_cast<uint8_t>(value & 0x7F));
+    }
+
+    void appendId3Frame(std::vector<uint8_t>& out, uint8_t major, const char* id, const std::vector<uint8_t>& body)
+    {
+        out.insert(out.end(), id, id + 4);
+        if (major == 4)
+        {
+            appendSyncsafe32(out, static_cast<uint32_t>(body.size()));
+        }
+        else
+        {
+            appendBe32(out, static_cast<uint32_t>(body.size()));
+        }
+        out.push_back(0);
+        out.push_back(0);
+        out.insert(out.end(), body.begin(), body.end());
+    }
+
+    std::vector<uint8_t> makeUtf16Text(const std::string& ascii)
+    {
+        std::vector<uint8_t> body = {1, 0xFF, 0xFE};
+        for (char c : ascii)
+        {
+            body.push_back(static_cast<uint8_t>(c));
+            body.push_back(0);
+        }
+        return body;
+    }
+
+    std::vector<uint8_t> makeUtf8Text(const std::string& text)
+    {
+        std::vector<uint8_t> body = {3};
+        body.insert(body.end(), text.begin(), text.end());
+        return body;
+    }
+
+    std::vector<uint8_t> makeId3v2(uint8_t major, const std::string& title, const std::string& artist, size_t artBytes)
+    {
+        std::vector<uint8_t> frames;
+        auto text = [major](const std::string& value) { return major == 4 ? makeUtf8Text(value) : makeUtf16Text(value); };
+        if (artBytes > 0)
+        {
+            // Latin-1 encoding, "image/jpeg\0", front cover, empty description, then the image bytes
+            const char           header[] = "\0image/jpeg\0\3";
+            std::vector<uint8_t> picture(sizeof(header) + artBytes, 0x5A);
+            memcpy(picture.data(), header, sizeof(header));
+            appendId3Frame(frames, major, "APIC", picture);
+        }
+        appendId3Frame(frames, major, "TIT2", text(title));
+        appendId3Frame(frames, major, "TPE1", text(artist));
+        appendId3Frame(frames, major, "TALB", text("Synthetic album"));
+        appendId3Frame(frames, major, "TRCK", text("7/12"));
+        appendId3Frame(frames, major, "TCON", text("(17)"));
+        frames.resize(frames.size() + 512, 0);
+
+        std::vector<uint8_t> tag = {'I', 'D', '3', major, 0, 0};
+        appendSyncsafe32(tag, static_cast<uint32_t>(frames.size()));
+        tag.insert(tag.end(), frames.begin(), frames.end());
+        return tag;
+    }
+
+    std::vector<uint8_t> makeApe(const std::string& title, const std::string& artist)
+    {
+        std::vector<uint8_t> items;
+        auto                 item = [&items](const char* key, const std::string& value)
+        {
+            appendLe32(items, static_cast<uint32_t>(value.size()));
+            appendLe32(items, 0);
+            items.insert(items.end(), key, key + strlen(key) + 1);
+            items.insert(items.end(), value.begin(), value.end());
+        };
+        item("Title", title);
+        item("Artist", artist);
+        item("Album", "Synthetic album");
+        item("Track", "7");
+
+        std::vector<uint8_t> tag = items;
+        const char*          id  = "APETAGEX";
+        tag.insert(tag.end(), id, id + 8);
+        appendLe32(tag, 2000);
+        appendLe32(tag, static_cast<uint32_t>(items.size() + 32));
+        appendLe32(tag, 4);
+        appendLe32(tag, 0);
+        tag.resize(tag.size() + 8, 0);
+        return tag;
+    }
+
+    std::vector<uint8_t> makeId3v1(const std::string& title, const std::string& artist)
+    {
+        std::vector<uint8_t> tag(128, 0);
+        memcpy(tag.data(), "TAG", 3);
+        memcpy(tag.data() + 3, title.data(), std::min<size_t>(title.size(), 30));
+        memcpy(tag.data() + 33, artist.data(), std::min<size_t>(artist.size(), 30));
+        memcpy(tag.data() + 63, "Synthetic album", 15);
+        tag[126] = 7;
+        tag[127] = 17;
+        return tag;
+    }
+
+    // Silent 128 kbps frames; the first one optionally carries a Xing + LAME header
+    std::vector<uint8_t> makeAudio(bool withXing)
+    {
+        std::vector<uint8_t> audio(AUDIO_FRAMES * Bench::SYNTHETIC_FRAME_BYTES, 0);
+        for (size_t frame = 0; frame < AUDIO_FRAMES; ++frame)
+        {
+            std::copy(std::begin(Bench::SYNTHETIC_FRAME_HEADER),
+                      std::end(Bench::SYNTHETIC_FRAME_HEADER),
+                      audio.begin() + frame * Bench::SYNTHETIC_FRAME_BYTES);
+        }
+        if (withXing)
+        {
+            std::vector<uint8_t> xing = {'X', 'i', 'n', 'g'};
+            appendBe32(xing, 0x3);
+            appendBe32(xing, AUDIO_FRAMES - 1);
+            appendBe32(xing, static_cast<uint32_t>(audio.size()));
+            const char* lame = "LAME3.100";
+            xing.insert(xing.end(), lame, lame + 9);
+            xing.resize(xing.size() + 12, 0);
+            // 576 samples of delay, 1152 of padding
+            xing.push_back(0x24);
+            xing.push_back(0x04);
+            xing.push_back(0x80);
+            std::copy(xing.begin(), xing.end(), audio.begin() + 36);
+        }
+        return audio;
+    }
+
+    std::vector<uint8_t> makeFile(size_t index)
+    {
+        const std::string    title  = "Track " + std::to_string(index);
+        const std::string    artist = "Artist " + std::to_string(index / 120);
+        std::vector<uint8_t> file;
+        std::vector<uint8_t> audio;
+        std::vector<uint8_t> tail;
+        switch (index % KIND_COUNT)
+        {
+            case KIND_ID3V23_UTF16:
+                file  = makeId3v2(3, title, artist, 0);
+                audio = makeAudio(true);
+                break;
+            case KIND_ID3V24_ART:
+                file  = makeId3v2(4, title, artist, 65536);
+                audio = makeAudio(false);
+                break;
+            case KIND_APE:
+                audio = makeAudio(false);
+                tail  = makeApe(title, artist);
+                {
+                    const std::vector<uint8_t> id3v1 = makeId3v1("", "");
+                    tail.insert(tail.end(), id3v1.begin(), id3v1.end());
+                }
+                break;
+            default:
+                audio = makeAudio(false);
+                tail  = makeId3v1(title, artist);
+                break;
+        }
+        file.insert(file.end(), audio.begin(), audio.end());
+        file.insert(file.end(), tail.begin(), tail.end());
+        return file;
+    }
+
+    // Corpus written once to the temp directory and removed at exit
+    class TagCorpus
+    {
+    public:
+        ~TagCorpus()
+        {
+            if (!mRoot.empty())
+            {
+                std::error_code error;
+                std::filesystem::remove_all(mRoot, error);
+            }
+        }
+
+        const std::vector<std::filesystem::path>& get(size_t fileCount)
+        {
+            if (mPaths.size() >= fileCount)
+            {
+                return mPaths;
+            }
+            mRoot = std::filesystem::temp_directory_path() / "mp3bench_tags";
+            std::filesystem::create_directories(mRoot);
+            for (size_t index = mPaths.size(); index < fileCount; ++index)
+            {
+                const std::filesystem::path path = mRoot / ("track_" + std::to_string(index) + ".mp3");
+                const std::vector<uint8_t>  file = makeFile(index);
+                std::ofstream               out(path, std::ios::binary);
+                out.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size()));
+                mPaths.push_back(path);
+            }
+            return mPaths;
+        }
+
+    private:
+        std::filesystem::path              mRoot;
+        std::vector<std::filesystem::path> mPaths;
+    };
+
+    TagCorpus gTagCorpus;
+}
+
+// Tags per second from disk: head + tail reads over a mixed corpus (the cache is warm after the first pass)
+static void BM_TagReadFile(benchmark::State& state)
+{
+    const size_t fileCount = static_cast<size_t>(state.range(0));
+    const auto&  paths     = gTagCorpus.get(fileCount);
+
+    Player::TrackTags_t tags;
+    for (auto _ : state)
+    {
+        size_t titled = 0;
+        for (size_t index = 0; index < fileCount; ++index)
+        {
+            Player::TagReader::readFile(paths[index], tags);
+            titled += tags.title.empty() ? 0 : 1;
+        }
+        if (titled != fileCount)
+        {
+            state.SkipWithError("tags missing");
+            break;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * fileCount));
+}
+BENCHMARK(BM_TagReadFile)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+// Parser alone on an in-memory file of each corpus kind
+static void BM_TagParseBuffer(benchmark::State& state)
+{
+    const std::vector<uint8_t> file = makeFile(static_cast<size_t>(state.range(0)));
+    static constexpr std::array<const char*, KIND_COUNT> names = {"id3v2.3 utf-16 + xing",
+                                                                  "id3v2.4 utf-8 + 64 KB art",
+                                                                  "apev2 + id3v1",
+                                                                  "id3v1"};
+
+    Player::TrackTags_t tags;
+    for (auto _ : state)
+    {
+        Player::TagReader::parseBuffer(file.data(), file.size(), tags);
+        benchmark::DoNotOptimize(tags.title.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    state.SetLabel(names[static_cast<size_t>(state.range(0))]);
+}
+BENCHMARK(BM_TagParseBuffer)->DenseRange(0, KIND_COUNT - 1)->Unit(benchmark::kNanosecond);
@@ -0,0 +1,369 @@
+#include "AllocationTracker.h"
+#include "MP3Visualization.h"
+#include "SyntheticAudio.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+
+// Cost of the player's ImGui frame on the CPU, without a window: an ImGui/ImPlot context with a dummy font atlas
+// stands in for the GLFW/OpenGL backends, and Render() only builds the draw lists that the GL backend would
+// upload. Nothing here touches glfw, GL or the waveOut device. AllocationHooks.cpp is linked in, so heap
+// allocations through operator new and ImGui's allocator are counted on every thread.
+
+namespace
+{
+    // Transport without a device, so the core reports a playing track and the waveform card is drawn
+    class HeadlessOutput : public Player::PlayerOutput
+    {
+    public:
+        bool openTrack(Player::DecodedAudio_t&& audio, Player::TrackTags_t&&) override
+        {
+            mDuration = audio.getDurationSeconds();
+            mOpen     = true;
+            mPlaying  = false;
+            mPaused   = false;
+            return true;
+        }
+        bool startPlayback(double startSeconds) override
+        {
+            mPosition = startSeconds;
+            mPlaying  = mOpen;
+            mPaused   = false;
+            return mOpen;
+        }
+        void setPause() override { mPaused = mPlaying; }
+        void unSetPause() override { mPaused = false; }
+        void stop() override
+        {
+            mPlaying = false;
+            mPaused  = false;
+        }
+        void   setVolume(float, float) override {}
+        void   setEqualizerGains(const std::vector<float>&) override {}
+        double getPosition() const override { return mPosition; }
+        double getDuration() const override { return mDuration; }
+        bool   isOpen() const override { return mOpen; }
+        bool   isPlaying() const override { return mPlaying; }
+        bool   isPaused() const override { return mPaused; }
+        bool   isPlayedOut() const override { return false; }  // the playhead wraps instead
+
+        // The playhead moves like it would at 60 fps, so the progress marker and time labels change every frame
+        void advance(double seconds) { mPosition = mDuration > 0.0 ? std::fmod(mPosition + seconds, mDuration) : 0.0; }
+
+    private:
+        double mPosition = 0.0;
+        double mDuration = 0.0;
+        bool   mOpen     = false;
+        bool   mPlaying  = false;
+        bool   mPaused   = false;
+    };
+
+    // ImGui + ImPlot contexts with the default font baked into an atlas that is never uploaded
+    class HeadlessContext
+    {
+    public:
+        HeadlessContext()
+        {
+            IMGUI_CHECKVERSION();
+            ImGui::SetAllocatorFunctions(Player::AllocationTracker::allocateForImGui, Player::AllocationTracker::freeForImGui);
+            ImGui::CreateContext();
+            ImPlot::CreateContext();
+            ImGuiIO& io     = ImGui::GetIO();
+            io.IniFilename  = nullptr;
+            io.LogFilename  = nullptr;
+            io.DisplaySize  = ImVec2(1480.0F, 900.0F);
+            io.DeltaTime    = 1.0F / 60.0F;
+            io.Fonts->Flags |= ImFontAtlasFlags_NoMouseCursors;
+            io.Fonts->AddFontDefault();
+            io.Fonts->Build();
+            io.Fonts->SetTexID(reinterpret_cast<ImTextureID>(static_cast<intptr_t>(1)));
+        }
+        ~HeadlessContext()
+        {
+            ImPlot::DestroyContext();
+            ImGui::DestroyContext();
+        }
+
+        HeadlessContext(const HeadlessContext&)            = delete;
+        HeadlessContext& operator=(const HeadlessContext&) = delete;
+    };
+
+    struct FrameStats_t
+    {
+        size_t vertices    = 0;
+        size_t indices     = 0;
+        size_t drawLists   = 0;
+        size_t commands    = 0;
+        size_t allocations = 0;
+    };
+
+    // One UI frame as ImGuiVis runs it, minus the backends. The mouse sweeps the window and the wheel scrolls the
+    // playlist, so hover tests, the list clipper and scrolling all do real work; there are no clicks, which keeps
+    // the player's state the same across iterations.
+    FrameStats_t renderFrame(Player::MP3Visualization& visualization, HeadlessOutput& output, size_t frameIndex)
+    {
+        Player::AllocationFrameCounter allocations;
+        allocations.beginFrame();
+        ImGuiIO&    io    = ImGui::GetIO();
+        const float phase = static_cast<float>(frameIndex) * 0.05F;
+        io.AddMousePosEvent(740.0F + 700.0F * std::sin(phase), 450.0F + 430.0F * std::sin(phase * 1.3F));
+        io.AddMouseWheelEvent(0.0F, (frameIndex / 120) % 2 == 0 ? -1.0F : 1.0F);
+        output.advance(io.DeltaTime);
+
+        ImGui::NewFrame();
+        visualization.worldFramePreDisplayFcn(true);
+        visualization.localFrameDisplayFcn();
+        ImGui::Render();
+
+        allocations.endFrame();
+
+        FrameStats_t      stats;
+        const ImDrawData* drawData = ImGui::GetDrawData();
+        stats.allocations          = static_cast<size_t>(allocations.getLast().allocations);
+        stats.vertices             = static_cast<size_t>(drawData->TotalVtxCount);
+        stats.indices              = static_cast<size_t>(drawData->TotalIdxCount);
+        stats.drawLists            = static_cast<size_t>(drawData->CmdListsCount);
+        for (int index = 0; index < drawData->CmdListsCount; ++index)
+        {
+            stats.commands += static_cast<size_t>(drawData->CmdLists[index]->CmdBuffer.Size);
+        }
+        return stats;
+    }
+
+    class SyntheticTrackFile
+    {
+    public:
+        ~SyntheticTrackFile()
+        {
+            if (!mPath.empty())
+            {
+                std::error_code ignored;
+                std::filesystem::remove(mPath, ignored);
+            }
+        }
+
+        const std::filesystem::path& get()
+        {
+            if (mPath.empty())
+            {
+                mPath                           = std::filesystem::temp_directory_path() / "mp3uibench_track.mp3";
+                const std::vector<uint8_t> data = Bench::makeSyntheticMp3(600.0);
+                std::ofstream              out(mPath, std::ios::binary);
+                out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+            }
+            return mPath;
+        }
+
+    private:
+        std::filesystem::path mPath;
+    };
+
+    SyntheticTrackFile gSyntheticTrack;
+}
+
+namespace
+{
+    // Fill the playlist with placeholder entries, then append the synthetic track, play it and render frames until
+    // the snapshot shows it playing. Returns the next frame index, or 0 (with the state skipped) on a timeout.
+    size_t startPlayback(benchmark::State&         state,
+                         Player::MP3Visualization& visualization,
+                         HeadlessOutput&           output,
+                         size_t                    entries)
+    {
+        if (entries > 0)
+        {
+            visualization.fillTestPlaylist(entries);
+        }
+        visualization.addToPlaylist({}, {gSyntheticTrack.get().string()}, true);
+        visualization.mCore.post(Player::PLAYER_PLAY);
+
+        size_t     frameIndex = 0;
+        const auto deadline   = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+        while (!visualization.mSnapshot->playing || !visualization.mSnapshot->track)
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                state.SkipWithError("synthetic track did not load");
+                return 0;
+            }
+            renderFrame(visualization, output, frameIndex++);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return frameIndex;
+    }
+}
+
+// One frame of the player window: range(0) playlist entries, range(1) waveform points, range(2) instrumentation
+// overlay (ImPlot) on/off. Counters are per frame: the geometry the GL backend would upload, the draw calls and
+// heap allocations; alloc_frames counts the timed frames that allocated at all.
+static void BM_PlayerFrame(benchmark::State& state)
+{
+    HeadlessContext          context;
+    HeadlessOutput           output;
+    Player::MP3Visualization visualization(output);
+    visualization.mShowInstrumentation = state.range(2) != 0;
+    visualization.mCore.setWaveformPoints(static_cast<size_t>(state.range(1)));
+    size_t frameIndex = startPlayback(state, visualization, output, static_cast<size_t>(state.range(0)));
+    if (frameIndex == 0)
+    {
+        return;
+    }
+
+    // Let window sizes, the clipper and ImPlot's fit settle before timing
+    for (size_t warmup = 0; warmup < 60; ++warmup)
+    {
+        renderFrame(visualization, output, frameIndex++);
+    }
+
+    FrameStats_t total;
+    size_t       allocatingFrames = 0;
+    for (auto _ : state)
+    {
+        const FrameStats_t stats = renderFrame(visualization, output, frameIndex++);
+        total.vertices += stats.vertices;
+        total.indices += stats.indices;
+        total.drawLists += stats.drawLists;
+        total.commands += stats.commands;
+        total.allocations += stats.allocations;
+        allocatingFrames += stats.allocations > 0 ? 1 : 0;
+    }
+
+    const auto perFrame = [](size_t value)
+    { return benchmark::Counter(static_cast<double>(value), benchmark::Counter::kAvgIterations); };
+    state.counters["vertices"]     = perFrame(total.vertices);
+    state.counters["indices"]      = perFrame(total.indices);
+    state.counters["draw_lists"]   = perFrame(total.drawLists);
+    state.counters["draw_cmds"]    = perFrame(total.commands);
+    state.counters["allocs"]       = perFrame(total.allocations);
+    state.counters["alloc_frames"] = static_cast<double>(allocatingFrames);
+    state.counters["waveform"]     = static_cast<double>(visualization.mSnapshot->track->waveform.size());
+}
+BENCHMARK(BM_PlayerFrame)
+    ->ArgNames({"entries", "points", "overlay"})
+    ->ArgsProduct({{0, 1000, 100000, 1000000}, {512, 65536}, {0}})
+    ->Args({1000000, 65536, 1})
+    ->Iterations(5000)
+    ->Unit(benchmark::kMicrosecond);
+
+// The zero-allocation guarantee: 10k frames of a playing track on a 1M-entry playlist, after a warm-up long enough
+// for the mouse sweep and the wheel to have visited every state once. Any heap allocation on any thread during the
+// timed frames fails the case, naming the first frame that allocated. The clock text (once a second) and the track
+// text (once per load) do not allocate either.
+static void BM_PlayerFrameSteadyStateAllocations(benchmark::State& state)
+{
+    HeadlessContext          context;
+    HeadlessOutput           output;
+    Player::MP3Visualization visualization(output);
+    size_t                   frameIndex = startPlayback(state, visualization, output, 1000000);
+    if (frameIndex == 0)
+    {
+        return;
+    }
+    for (size_t warmup = 0; warmup < 2000; ++warmup)
+    {
+        renderFrame(visualization, output, frameIndex++);
+    }
+
+    size_t allocations      = 0;
+    size_t allocatingFrames = 0;
+    size_t firstFrame       = 0;
+    size_t frame            = 0;
+    for (auto _ : state)
+    {
+        const FrameStats_t stats = renderFrame(visualization, output, frameIndex++);
+        if (stats.allocations > 0 && allocatingFrames++ == 0)
+        {
+            firstFrame = frame;
+        }
+        allocations += stats.allocations;
+        ++frame;
+    }
+
+    state.counters["allocs"]       = static_cast<double>(allocations);
+    state.counters["alloc_frames"] = static_cast<double>(allocatingFrames);
+    if (allocations > 0)
+    {
+        const std::string error = std::to_string(allocations) + " allocations in " + std::to_string(allocatingFrames) +
+                                  " of " + std::to_string(frame) + " steady-state frames, first in frame " +
+                                  std::to_string(firstFrame);
+        state.SkipWithError(error.c_str());
+    }
+}
+BENCHMARK(BM_PlayerFrameSteadyStateAllocations)->Iterations(10000)->Unit(benchmark::kMicrosecond);
+
+// The playlist list box alone, as MP3Visualization draws it, over range(0) placeholder entries: one ImGui frame
+// per iteration while the box scrolls through the list. range(1) 1 goes through ImGuiListClipper, 0 submits a
+// Selectable for every entry (the view before the clipper), which is only run up to 100k entries.
+static void BM_PlaylistListBoxFrame(benchmark::State& state)
+{
+    HeadlessContext  context;
+    const size_t     count   = static_cast<size_t>(state.range(0));
+    const bool       clipped = state.range(1) != 0;
+    Player::Playlist playlist;
+    playlist.reserve(count);
+    char path[64];
+    for (size_t index = 0; index < count; ++index)
+    {
+        snprintf(path, sizeof(path), "test/placeholder_%07zu.mp3", index);
+        playlist.add(path);
+    }
+
+    float scroll = 0.0F;
+    for (auto _ : state)
+    {
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0.0F, 0.0F));
+        ImGui::SetNextWindowSize(ImVec2(600.0F, 400.0F));
+        ImGui::Begin("PlaylistCard");
+        if (ImGui::BeginListBox("##playlistbox", ImVec2(-FLT_MIN, 240)))
+        {
+            ImGui::SetScrollY(scroll);
+            if (clipped)
+            {
+                ImGuiListClipper clipper;
+                clipper.Begin(static_cast<int>(playlist.size()));
+                while (clipper.Step())
+                {
+                    for (int idx = clipper.DisplayStart; idx < clipper.DisplayEnd; ++idx)
+                    {
+                        ImGui::PushID(idx);
+                        ImGui::Selectable(playlist.getDisplayName(idx), idx == 0);
+                        ImGui::PopID();
+                    }
+                }
+            }
+            else
+            {
+                for (int idx = 0; idx < static_cast<int>(playlist.size()); ++idx)
+                {
+                    ImGui::PushID(idx);
+                    ImGui::Selectable(playlist.getDisplayName(idx), idx == 0);
+                    ImGui::PopID();
+                }
+            }
+            scroll = std::fmod(scroll + 7919.0F, std::max(ImGui::GetScrollMaxY(), 1.0F));
+            ImGui::EndListBox();
+        }
+        ImGui::End();
+        ImGui::Render();
+        benchmark::DoNotOptimize(ImGui::GetDrawData()->TotalVtxCount);
+    }
+}
+BENCHMARK(BM_PlaylistListBoxFrame)
+    ->ArgNames({"entries", "clipped"})
+    ->Args({1000, 1})
+    ->Args({100000, 1})
+    ->Args({1000000, 1})
+    ->Args({1000, 0})
+    ->Args({100000, 0})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -50,6 +50,7 @@ class mp3player(ConanFile):
             raise ConanInvalidConfiguration("This package is only compatible with Windows or Linux")
                                                                     
     def requirements(self):
+        self.requires("benchmark/1.8.3")
         self.requires("boost/1.83.0")
         self.requires("eigen/3.4.0")
         self.requires("ffmpeg/4.4.4")
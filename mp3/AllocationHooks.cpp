@@ -0,0 +1,154 @@
+#include "AllocationTracker.h"
+
+#include <cstdlib>
+#include <new>
+
+// Replacement global operator new/delete that count into AllocationTracker. Only linked into executables that
+// want the counts (see MP3PLAYER_TRACK_ALLOCATIONS), never into mp3core: a library must not replace them.
+
+namespace
+{
+    void* allocateCounted(size_t size)
+    {
+        Player::AllocationTracker::recordAllocation(size);
+        return std::malloc(size > 0 ? size : 1);
+    }
+
+    void* allocateCountedAligned(size_t size, std::align_val_t alignment)
+    {
+        Player::AllocationTracker::recordAllocation(size);
+        const size_t align = static_cast<size_t>(alignment);
+#ifdef _WIN32
+        return _aligned_malloc(size > 0 ? size : 1, align);
+#else
+        // aligned_alloc wants a size that is a multiple of the alignment
+        const size_t rounded = ((size > 0 ? size : 1) + align - 1) / align * align;
+        return std::aligned_alloc(align, rounded);
+#endif
+    }
+
+    void freeCounted(void* pointer)
+    {
+        if (pointer != nullptr)
+        {
+            Player::AllocationTracker::recordFree();
+            std::free(pointer);
+        }
+    }
+
+    void freeCountedAligned(void* pointer)
+    {
+        if (pointer != nullptr)
+        {
+            Player::AllocationTracker::recordFree();
+#ifdef _WIN32
+            _aligned_free(pointer);
+#else
+            std::free(pointer);
+#endif
+        }
+    }
+
+    struct HooksInstalled
+    {
+        HooksInstalled() { Player::AllocationTracker::setInstalled(); }
+    };
+
+    const HooksInstalled gHooksInstalled;
+}
+
+void* operator new(size_t size)
+{
+    if (void* pointer = allocateCounted(size))
+    {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+    if (void* pointer = allocateCounted(size))
+    {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    return allocateCounted(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    return allocateCounted(size);
+}
+
+void* operator new(size_t size, std::align_val_t alignment)
+{
+    if (void* pointer = allocateCountedAligned(size, alignment))
+    {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size, std::align_val_t alignment)
+{
+    if (void* pointer = allocateCountedAligned(size, alignment))
+    {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+    freeCounted(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    freeCounted(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    freeCounted(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept
+{
+    freeCounted(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept
+{
+    freeCounted(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept
+{
+    freeCounted(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept
+{
+    freeCountedAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept
+{
+    freeCountedAligned(pointer);
+}
+
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept
+{
+    freeCountedAligned(pointer);
+}
+
+void operator delete[](void* pointer, size_t, std::align_val_t) noexcept
+{
+    freeCountedAligned(pointer);
+}
@@ -0,0 +1,182 @@
+#include "AllocationTracker.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+    // Written by its own thread with relaxed adds, read by anyone
+    struct ThreadSlot
+    {
+        std::atomic<uint64_t> allocations{0};
+        std::atomic<uint64_t> frees{0};
+        std::atomic<uint64_t> bytes{0};
+        std::atomic<bool>     named{false};
+        std::atomic<bool>     released{false};  // its thread exited; the next new thread may take it over
+        char                  name[32] = {};
+    };
+
+    std::array<ThreadSlot, Player::AllocationTracker::mMaxThreads> gSlots;
+    std::atomic<size_t>                                            gSlotsUsed{0};
+
+    size_t getSlotsInUse()
+    {
+        return std::min(gSlotsUsed.load(std::memory_order_relaxed), gSlots.size());
+    }
+
+    // Hands the slot back when its thread exits. The counts stay in the slot, so the totals never go backwards.
+    struct SlotOwner
+    {
+        ThreadSlot* slot = nullptr;
+
+        ~SlotOwner()
+        {
+            if (slot != nullptr)
+            {
+                slot->named.store(false, std::memory_order_relaxed);
+                slot->released.store(true, std::memory_order_release);
+            }
+        }
+    };
+
+    ThreadSlot& getThreadSlot()
+    {
+        // A plain pointer, so the thread_local itself needs no construction (and no allocation). It stays set after
+        // the owner below is destroyed, so frees made later in thread exit still count somewhere.
+        thread_local ThreadSlot* slot = nullptr;
+        if (slot == nullptr)
+        {
+            const size_t used = getSlotsInUse();
+            for (size_t index = 0; index < used && slot == nullptr; ++index)
+            {
+                bool released = true;
+                if (gSlots[index].released.compare_exchange_strong(released, false, std::memory_order_acquire))
+                {
+                    slot = &gSlots[index];
+                }
+            }
+            if (slot == nullptr)
+            {
+                const size_t index = gSlotsUsed.fetch_add(1, std::memory_order_relaxed);
+                slot               = &gSlots[std::min(index, gSlots.size() - 1)];
+            }
+
+            // The last slot may be shared by the threads past mMaxThreads, so it is never handed back
+            thread_local SlotOwner owner;
+            owner.slot = (slot != &gSlots.back()) ? slot : nullptr;
+        }
+        return *slot;
+    }
+
+    Player::AllocationTracker::Counts_t readSlot(const ThreadSlot& slot)
+    {
+        Player::AllocationTracker::Counts_t counts;
+        counts.allocations = slot.allocations.load(std::memory_order_relaxed);
+        counts.frees       = slot.frees.load(std::memory_order_relaxed);
+        counts.bytes       = slot.bytes.load(std::memory_order_relaxed);
+        return counts;
+    }
+}
+
+std::atomic<bool> Player::AllocationTracker::mInstalled{false};
+
+void Player::AllocationTracker::recordAllocation(size_t bytes)
+{
+    ThreadSlot& slot = getThreadSlot();
+    slot.allocations.fetch_add(1, std::memory_order_relaxed);
+    slot.bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void Player::AllocationTracker::recordFree()
+{
+    getThreadSlot().frees.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Player::AllocationTracker::setThreadName(const char* name)
+{
+    ThreadSlot& slot = getThreadSlot();
+    slot.named.store(false, std::memory_order_relaxed);
+    strncpy(slot.name, name, sizeof(slot.name) - 1);
+    slot.named.store(true, std::memory_order_release);
+}
+
+Player::AllocationTracker::Counts_t Player::AllocationTracker::getThreadCounts()
+{
+    return readSlot(getThreadSlot());
+}
+
+Player::AllocationTracker::Counts_t Player::AllocationTracker::getTotalCounts()
+{
+    Counts_t     total;
+    const size_t used = getSlotsInUse();
+    for (size_t index = 0; index < used; ++index)
+    {
+        const Counts_t counts = readSlot(gSlots[index]);
+        total.allocations += counts.allocations;
+        total.frees += counts.frees;
+        total.bytes += counts.bytes;
+    }
+    return total;
+}
+
+void Player::AllocationTracker::getThreads(std::vector<ThreadCounts_t>& threads)
+{
+    const size_t used = getSlotsInUse();
+    threads.resize(used);
+    for (size_t index = 0; index < used; ++index)
+    {
+        ThreadCounts_t& thread = threads[index];
+        thread.slot            = static_cast<uint32_t>(index);
+        thread.counts          = readSlot(gSlots[index]);
+        thread.name[0]         = '\0';
+        if (gSlots[index].named.load(std::memory_order_acquire))
+        {
+            memcpy(thread.name, gSlots[index].name, sizeof(thread.name));
+        }
+    }
+}
+
+void* Player::AllocationTracker::allocateForImGui(size_t size, void*)
+{
+    recordAllocation(size);
+    return std::malloc(size);
+}
+
+void Player::AllocationTracker::freeForImGui(void* pointer, void*)
+{
+    if (pointer != nullptr)
+    {
+        recordFree();
+    }
+    std::free(pointer);
+}
+
+void Player::AllocationFrameCounter::beginFrame()
+{
+    mTotalAtBegin  = AllocationTracker::getTotalCounts();
+    mThreadAtBegin = AllocationTracker::getThreadCounts();
+}
+
+void Player::AllocationFrameCounter::endFrame()
+{
+    const AllocationTracker::Counts_t total  = AllocationTracker::getTotalCounts();
+    const AllocationTracker::Counts_t thread = AllocationTracker::getThreadCounts();
+    mLast.allocations                        = total.allocations - mTotalAtBegin.allocations;
+    mLast.bytes                              = total.bytes - mTotalAtBegin.bytes;
+    mLast.threadAllocations                  = thread.allocations - mThreadAtBegin.allocations;
+    mPeak.allocations                        = std::max(mPeak.allocations, mLast.allocations);
+    mPeak.bytes                              = std::max(mPeak.bytes, mLast.bytes);
+    mPeak.threadAllocations                  = std::max(mPeak.threadAllocations, mLast.threadAllocations);
+    ++mFrames;
+    mAllocatingFrames += mLast.allocations > 0 ? 1 : 0;
+}
+
+void Player::AllocationFrameCounter::reset()
+{
+    mLast             = {};
+    mPeak             = {};
+    mFrames           = 0;
+    mAllocatingFrames = 0;
+}
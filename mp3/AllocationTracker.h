@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Heap allocation counters. The counting operator new/delete in AllocationHooks.cpp feed them; debug builds, the
+// UI benchmark and -DMP3PLAYER_TRACK_ALLOCATIONS=ON link the hooks in, other builds count nothing. Every thread
+// counts into its own slot of a fixed table, claimed on its first allocation, so counting never allocates or locks. A
+// thread that exits leaves its slot, counts included, to the next new thread.
+//
+//     AllocationFrameCounter frames;
+//     frames.beginFrame();  ...build and render the frame...  frames.endFrame();
+namespace Player
+{
+
+	class AllocationTracker
+	{
+	public:
+		struct Counts_t
+		{
+			uint64_t allocations = 0;
+			uint64_t frees       = 0;
+			uint64_t bytes       = 0;  // requested; frees are counted but not sized
+		};
+
+		struct ThreadCounts_t
+		{
+			uint32_t slot     = 0;
+			char     name[32] = {};
+			Counts_t counts;
+		};
+
+		// Threads running at once past this share the last slot
+		static constexpr size_t mMaxThreads = 64;
+
+		// Called by the hooks
+		static void recordAllocation(size_t bytes);
+		static void recordFree();
+		static void setInstalled() { mInstalled.store(true, std::memory_order_relaxed); }
+
+		// True when the hooks are linked into this executable
+		static bool isInstalled() { return mInstalled.load(std::memory_order_relaxed); }
+
+		// Label the calling thread's slot (Profiler::setThreadName forwards here); truncated to 31 bytes
+		static void setThreadName(const char* name);
+
+		static Counts_t getThreadCounts();  // calling thread
+		static Counts_t getTotalCounts();   // all threads
+
+		// Every slot in use, written into threads (which keeps its capacity, so polling it does not allocate)
+		static void getThreads(std::vector<ThreadCounts_t>& threads);
+
+		// ImGui::SetAllocatorFunctions pair, so ImGui's own buffers are counted like operator new
+		static void* allocateForImGui(size_t size, void* userData);
+		static void  freeForImGui(void* pointer, void* userData);
+
+	private:
+		static std::atomic<bool> mInstalled;
+	};
+
+	// Allocations made during each frame, on the calling (UI) thread and in the whole process
+	class AllocationFrameCounter
+	{
+	public:
+		struct Frame_t
+		{
+			uint64_t allocations       = 0;  // all threads
+			uint64_t bytes             = 0;
+			uint64_t threadAllocations = 0;  // the thread that runs the frame
+		};
+
+		void beginFrame();
+		void endFrame();
+
+		const Frame_t& getLast() const { return mLast; }
+		const Frame_t& getPeak() const { return mPeak; }
+		uint64_t       getFrameCount() const { return mFrames; }
+		uint64_t       getAllocatingFrameCount() const { return mAllocatingFrames; }
+
+		// Forget the peak and the counts, e.g. once startup is over
+		void reset();
+
+	private:
+		AllocationTracker::Counts_t mTotalAtBegin;
+		AllocationTracker::Counts_t mThreadAtBegin;
+		Frame_t                     mLast;
+		Frame_t                     mPeak;
+		uint64_t                    mFrames           = 0;
+		uint64_t                    mAllocatingFrames = 0;
+	};
+
+}
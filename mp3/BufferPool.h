@@ -0,0 +1,180 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace Player
+{
+
+	struct BufferPoolStats_t
+	{
+		uint64_t acquires         = 0;
+		uint64_t hits             = 0;  // served from a retained buffer
+		uint64_t releases         = 0;
+		uint64_t dropped          = 0;  // released buffers freed because the pool was full
+		size_t   retainedBytes    = 0;  // idle buffers held for reuse
+		size_t   outstandingBytes = 0;  // handed out and not yet returned
+		size_t   highWaterBytes   = 0;  // peak of retained + outstanding
+	};
+
+	/// @brief Recycles large vectors across track loads so skipping through a playlist does not push a fresh
+	///        100 MB PCM allocation through the heap for every track. Capacities are rounded up to size classes
+	///        a quarter of a power of two apart (at most ~19 % slack); acquire() takes a retained buffer of the
+	///        request's class or up to two classes above it. Idle buffers are kept up to a byte budget, beyond
+	///        that released buffers are simply freed. Requests below MIN_POOLED_ELEMENTS bypass the pool.
+	///        The budget is resident memory the process keeps after a track is closed; the heap-only
+	///        alternative frees each track on close.
+	template<typename T>
+	class BufferPool
+	{
+	public:
+		explicit BufferPool(size_t retainBudgetBytes = DEFAULT_RETAIN_BYTES)
+			: mRetainBudgetBytes(retainBudgetBytes)
+		{
+		}
+
+		BufferPool(const BufferPool&)            = delete;
+		BufferPool& operator=(const BufferPool&) = delete;
+
+		/// @brief empty vector whose capacity holds at least count elements
+		std::vector<T> acquire(size_t count)
+		{
+			std::vector<T> buffer;
+			if (count < MIN_POOLED_ELEMENTS)
+			{
+				buffer.reserve(count);
+				return buffer;
+			}
+
+			const size_t                sizeClass = getClassFor(count);
+			std::lock_guard<std::mutex> guard(mLock);
+			++mStats.acquires;
+			for (size_t candidate = sizeClass; candidate < std::min(sizeClass + 3, CLASS_COUNT); ++candidate)
+			{
+				std::vector<std::vector<T>>& idle = mIdle[candidate];
+				if (!idle.empty())
+				{
+					buffer = std::move(idle.back());
+					idle.pop_back();
+					++mStats.hits;
+					mStats.retainedBytes -= buffer.capacity() * sizeof(T);
+					buffer.clear();
+					break;
+				}
+			}
+			if (buffer.capacity() == 0)
+			{
+				buffer.reserve(getClassElements(sizeClass));
+			}
+			mStats.outstandingBytes += buffer.capacity() * sizeof(T);
+			updateHighWater();
+			return buffer;
+		}
+
+		/// @brief hand a buffer back (from acquire() or not); it is kept for reuse while the budget allows
+		void release(std::vector<T>&& buffer)
+		{
+			std::vector<T> released = std::move(buffer);
+			const size_t   bytes    = released.capacity() * sizeof(T);
+			if (released.capacity() < MIN_POOLED_ELEMENTS)
+			{
+				return;
+			}
+
+			// Filed under the largest class it fully covers, so acquire() never returns less than it promised
+			const size_t                sizeClass = getClassCovering(released.capacity());
+			std::lock_guard<std::mutex> guard(mLock);
+			++mStats.releases;
+			mStats.outstandingBytes -= std::min(mStats.outstandingBytes, bytes);
+			if (mStats.retainedBytes + bytes > mRetainBudgetBytes)
+			{
+				++mStats.dropped;
+				return;
+			}
+			released.clear();
+			mIdle[sizeClass].push_back(std::move(released));
+			mStats.retainedBytes += bytes;
+			updateHighWater();
+		}
+
+		/// @brief free every idle buffer
+		void trim()
+		{
+			std::array<std::vector<std::vector<T>>, CLASS_COUNT> idle;
+			{
+				std::lock_guard<std::mutex> guard(mLock);
+				idle.swap(mIdle);
+				mStats.retainedBytes = 0;
+			}
+		}
+
+		BufferPoolStats_t getStats() const
+		{
+			std::lock_guard<std::mutex> guard(mLock);
+			return mStats;
+		}
+
+		void setRetainBudget(size_t bytes)
+		{
+			std::lock_guard<std::mutex> guard(mLock);
+			mRetainBudgetBytes = bytes;
+		}
+
+		/// @brief capacity acquire() reserves for a request of count elements
+		static size_t getClassElements(size_t sizeClass)
+		{
+			return (4 + sizeClass % 4) << (sizeClass / 4 + MIN_CLASS_SHIFT);
+		}
+
+		static constexpr size_t MIN_CLASS_SHIFT      = 10;  // smallest class: 4 << 10 elements
+		static constexpr size_t MIN_POOLED_ELEMENTS  = size_t(4) << MIN_CLASS_SHIFT;
+		static constexpr size_t CLASS_COUNT          = 4 * 20;  // largest class (7 << 29) still fits a 32-bit size_t
+		static constexpr size_t DEFAULT_RETAIN_BYTES = size_t(256) << 20;  // two 12-minute stereo tracks
+
+		/// @brief process-wide pool for this element type
+		static BufferPool& getShared()
+		{
+			static BufferPool shared;
+			return shared;
+		}
+
+	private:
+		static size_t getClassFor(size_t count)
+		{
+			size_t sizeClass = 0;
+			while (sizeClass + 1 < CLASS_COUNT && getClassElements(sizeClass) < count)
+			{
+				++sizeClass;
+			}
+			return sizeClass;
+		}
+
+		static size_t getClassCovering(size_t capacity)
+		{
+			size_t sizeClass = 0;
+			while (sizeClass + 1 < CLASS_COUNT && getClassElements(sizeClass + 1) <= capacity)
+			{
+				++sizeClass;
+			}
+			return sizeClass;
+		}
+
+		void updateHighWater()
+		{
+			mStats.highWaterBytes = std::max(mStats.highWaterBytes, mStats.retainedBytes + mStats.outstandingBytes);
+		}
+
+		mutable std::mutex                                   mLock;
+		std::array<std::vector<std::vector<T>>, CLASS_COUNT> mIdle;
+		size_t                                               mRetainBudgetBytes = DEFAULT_RETAIN_BYTES;
+		BufferPoolStats_t                                    mStats;
+	};
+
+	using PcmBufferPool  = BufferPool<int16_t>;
+	using ByteBufferPool = BufferPool<uint8_t>;
+
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Player
+{
+
+	/// @brief Bounded lock-free queue for many producers and one consumer. Every slot carries a sequence number:
+	///        a producer claims the tail with one compare-exchange, writes its value and publishes the slot by
+	///        bumping the sequence, so producers never wait on each other or on the consumer. The consumer only
+	///        reads its own head. push() fails instead of blocking once all slots are taken.
+	template<typename T>
+	class CommandQueue
+	{
+	public:
+		/// @brief capacity is rounded up to a power of two
+		explicit CommandQueue(size_t capacity = 1024)
+			: mMask(getSlotCount(capacity) - 1)
+			, mSlots(new Slot_t[mMask + 1])
+		{
+			for (size_t index = 0; index <= mMask; ++index)
+			{
+				mSlots[index].sequence.store(index, std::memory_order_relaxed);
+			}
+		}
+
+		CommandQueue(const CommandQueue&)            = delete;
+		CommandQueue& operator=(const CommandQueue&) = delete;
+
+		/// @brief any thread; false when the queue is full
+		bool push(T&& value)
+		{
+			size_t  position = mTail.load(std::memory_order_relaxed);
+			Slot_t* slot     = nullptr;
+			for (;;)
+			{
+				slot                    = &mSlots[position & mMask];
+				const size_t   sequence = slot->sequence.load(std::memory_order_acquire);
+				const intptr_t lag      = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+				if (lag == 0)
+				{
+					if (mTail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (lag < 0)
+				{
+					// The consumer has not freed this slot from the previous lap yet
+					return false;
+				}
+				else
+				{
+					position = mTail.load(std::memory_order_relaxed);
+				}
+			}
+			slot->value = std::move(value);
+			slot->sequence.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+		/// @brief consumer thread only; false when nothing has been published
+		bool pop(T& value)
+		{
+			Slot_t& slot = mSlots[mHead & mMask];
+			if (slot.sequence.load(std::memory_order_acquire) != mHead + 1)
+			{
+				return false;
+			}
+			value = std::move(slot.value);
+			slot.value = T{};
+			slot.sequence.store(mHead + mMask + 1, std::memory_order_release);
+			++mHead;
+			return true;
+		}
+
+		size_t getCapacity() const { return mMask + 1; }
+
+	private:
+		struct Slot_t
+		{
+			std::atomic<size_t> sequence{0};
+			T                   value{};
+		};
+
+		static size_t getSlotCount(size_t capacity)
+		{
+			size_t count = 2;
+			while (count < capacity)
+			{
+				count <<= 1;
+			}
+			return count;
+		}
+
+		const size_t              mMask;
+		std::unique_ptr<Slot_t[]> mSlots;
+		alignas(64) std::atomic<size_t> mTail{0};  // producers
+		alignas(64) size_t mHead = 0;              // consumer only
+	};
+
+}
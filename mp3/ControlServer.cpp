@@ -0,0 +1,1118 @@
+#include "ControlServer.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    // A client sending longer lines than this is not speaking the protocol and is dropped
+    constexpr size_t MAX_LINE_BYTES = 1024;
+
+    // A client that stops reading its replies is dropped once this much output is waiting for it
+    constexpr size_t MAX_PENDING_OUTPUT = 256 * 1024;
+
+    constexpr size_t READ_CHUNK_BYTES = 4096;
+
+    const char* getCommandName(Player::ControlCommandType_e type)
+    {
+        switch (type)
+        {
+        case Player::CONTROL_PLAY: return "play";
+        case Player::CONTROL_PAUSE: return "pause";
+        case Player::CONTROL_RESUME: return "resume";
+        case Player::CONTROL_STOP: return "stop";
+        case Player::CONTROL_SEEK: return "seek";
+        case Player::CONTROL_NEXT: return "next";
+        case Player::CONTROL_PREVIOUS: return "prev";
+        case Player::CONTROL_VOLUME: return "volume";
+        case Player::CONTROL_EQ: return "eq";
+        }
+        return "?";
+    }
+}
+
+struct Player::ControlServer::Client_t
+{
+    uint32_t    id = 0;
+    std::string input;
+    std::string output;
+    uint64_t    sequence   = 0;
+    uint32_t    pushMs     = 0;  // 0 = not subscribed
+    int64_t     nextPushNs = 0;
+    bool        closing    = false;
+
+#ifdef _WIN32
+    HANDLE      pipe = INVALID_HANDLE_VALUE;
+    OVERLAPPED  readOverlapped{};
+    OVERLAPPED  writeOverlapped{};
+    bool        readPending  = false;
+    bool        writePending = false;
+    std::string writing;  // buffer owned by the pending WriteFile
+    char        readBuffer[READ_CHUNK_BYTES];
+#else
+    int fd = -1;
+#endif
+
+    bool hasUnsentOutput() const
+    {
+#ifdef _WIN32
+        return writePending || !output.empty();
+#else
+        return !output.empty();
+#endif
+    }
+};
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Protocol, shared by both transports
+
+bool Player::ControlServer::parseCommand(const std::string& line, ControlCommand_t& command, std::string& error)
+{
+    std::istringstream stream(line);
+    std::string        name;
+    std::string        token;
+    double             arguments[2] = {0.0, 0.0};
+    stream >> name;
+    command.argCount = 0;
+    while (stream >> token)
+    {
+        char*        end   = nullptr;
+        const double value = std::strtod(token.c_str(), &end);
+        if (command.argCount == 2 || end == token.c_str() || *end != '\0' || !std::isfinite(value))
+        {
+            error = "unexpected argument " + token;
+            return false;
+        }
+        arguments[command.argCount++] = value;
+    }
+
+    struct Syntax_t
+    {
+        const char*          name;
+        ControlCommandType_e type;
+        uint32_t             minArgs;
+        uint32_t             maxArgs;
+    };
+    static constexpr Syntax_t syntax[] = {
+        {"play", CONTROL_PLAY, 0, 1},
+        {"pause", CONTROL_PAUSE, 0, 0},
+        {"resume", CONTROL_RESUME, 0, 0},
+        {"stop", CONTROL_STOP, 0, 0},
+        {"seek", CONTROL_SEEK, 1, 1},
+        {"next", CONTROL_NEXT, 0, 0},
+        {"prev", CONTROL_PREVIOUS, 0, 0},
+        {"volume", CONTROL_VOLUME, 1, 2},
+        {"eq", CONTROL_EQ, 2, 2},
+    };
+    for (const Syntax_t& entry : syntax)
+    {
+        if (name != entry.name)
+        {
+            continue;
+        }
+        if (command.argCount < entry.minArgs || command.argCount > entry.maxArgs)
+        {
+            error = "bad arguments for " + name;
+            return false;
+        }
+        command.type = entry.type;
+        if (entry.type == CONTROL_EQ)
+        {
+            if (arguments[0] < 0.0 || arguments[0] != static_cast<uint32_t>(arguments[0]))
+            {
+                error = "bad band";
+                return false;
+            }
+            command.band  = static_cast<uint32_t>(arguments[0]);
+            command.value = arguments[1];
+        }
+        else
+        {
+            command.value  = arguments[0];
+            command.value2 = arguments[1];
+        }
+        return true;
+    }
+    error = name.empty() ? "empty request" : "unknown command " + name;
+    return false;
+}
+
+void Player::ControlServer::handleLine(Client_t& client, const std::string& line)
+{
+    const uint64_t sequence = ++client.sequence;
+
+    // Answered here without involving the player thread
+    if (line == "ping")
+    {
+        client.output += "ok " + std::to_string(sequence) + " ping\n";
+        return;
+    }
+    if (line == "status")
+    {
+        client.output += "ok " + std::to_string(sequence) + " status\n" + formatStatus();
+        return;
+    }
+    if (line.compare(0, 9, "subscribe") == 0 && (line.size() == 9 || line[9] == ' '))
+    {
+        const long interval = line.size() > 10 ? std::strtol(line.c_str() + 10, nullptr, 10) : DEFAULT_PUSH_MS;
+        if (interval <= 0 || interval > 60000)
+        {
+            client.output += "err " + std::to_string(sequence) + " bad interval\n";
+            return;
+        }
+        client.pushMs     = static_cast<uint32_t>(interval);
+        client.nextPushNs = 0;
+        client.output += "ok " + std::to_string(sequence) + " subscribe\n";
+        return;
+    }
+    if (line == "unsubscribe")
+    {
+        client.pushMs = 0;
+        client.output += "ok " + std::to_string(sequence) + " unsubscribe\n";
+        return;
+    }
+
+    ControlCommand_t command;
+    std::string      error;
+    if (!parseCommand(line, command, error))
+    {
+        client.output += "err " + std::to_string(sequence) + " " + error + "\n";
+        return;
+    }
+    command.clientId   = client.id;
+    command.sequence   = sequence;
+    command.receivedNs = PlaybackClock::getNanoseconds();
+    std::lock_guard<std::mutex> guard(mCommandLock);
+    mCommands.push_back(command);
+}
+
+void Player::ControlServer::onClientData(Client_t& client, const char* data, size_t size)
+{
+    client.input.append(data, size);
+    size_t start = 0;
+    for (size_t end = client.input.find('\n'); end != std::string::npos; end = client.input.find('\n', start))
+    {
+        std::string line = client.input.substr(start, end - start);
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+        start = end + 1;
+        if (!line.empty())
+        {
+            handleLine(client, line);
+        }
+    }
+    client.input.erase(0, start);
+    if (client.input.size() > MAX_LINE_BYTES)
+    {
+        client.closing = true;
+    }
+}
+
+size_t Player::ControlServer::drainCommands(std::vector<ControlCommand_t>& out)
+{
+    std::lock_guard<std::mutex> guard(mCommandLock);
+    const size_t                count = mCommands.size();
+    out.insert(out.end(), mCommands.begin(), mCommands.end());
+    mCommands.clear();
+    return count;
+}
+
+void Player::ControlServer::reply(const ControlCommand_t& command, const std::string& error)
+{
+    Reply_t reply;
+    reply.clientId = command.clientId;
+    reply.line     = error.empty() ? "ok " + std::to_string(command.sequence) + " " + getCommandName(command.type) + "\n"
+                                   : "err " + std::to_string(command.sequence) + " " + error + "\n";
+    {
+        std::lock_guard<std::mutex> guard(mReplyLock);
+        mReplies.push_back(std::move(reply));
+    }
+    wake();
+}
+
+void Player::ControlServer::collectReplies()
+{
+    std::vector<Reply_t> replies;
+    {
+        std::lock_guard<std::mutex> guard(mReplyLock);
+        replies.swap(mReplies);
+    }
+    for (Reply_t& reply : replies)
+    {
+        // Clients that disconnected before their reply came back are simply gone
+        for (const std::unique_ptr<Client_t>& client : mClients)
+        {
+            if (client->id == reply.clientId)
+            {
+                client->output += reply.line;
+                break;
+            }
+        }
+    }
+}
+
+void Player::ControlServer::publishStatus(const ControlStatus_t& status)
+{
+    std::lock_guard<std::mutex> guard(mStatusLock);
+    mStatus = status;
+}
+
+std::string Player::ControlServer::formatStatus() const
+{
+    ControlStatus_t status;
+    {
+        std::lock_guard<std::mutex> guard(mStatusLock);
+        status = mStatus;
+    }
+
+    // While playing (or paused) the clock is fresher than the last status the UI frame published
+    const PlaybackClock* clock      = mClock.load(std::memory_order_acquire);
+    const uint32_t       sampleRate = clock ? clock->getSampleRate() : 0;
+    uint64_t             frame      = 0;
+    double               latencyMs  = 0.0;
+    if (sampleRate > 0)
+    {
+        if (status.playing)
+        {
+            frame                  = clock->getFramePosition();
+            status.positionSeconds = std::min(static_cast<double>(frame) / sampleRate, status.durationSeconds);
+        }
+        else
+        {
+            frame = static_cast<uint64_t>(status.positionSeconds * sampleRate);
+        }
+        latencyMs = clock->getLatencyFrames() * 1000.0 / sampleRate;
+    }
+
+    char line[160];
+    std::snprintf(line,
+                  sizeof(line),
+                  "pos %llu %.4f %.4f %s %.4f %.4f %d %.1f\n",
+                  static_cast<unsigned long long>(frame),
+                  status.positionSeconds,
+                  status.durationSeconds,
+                  status.paused ? "pause" : (status.playing ? "play" : "stop"),
+                  status.peakLeft,
+                  status.peakRight,
+                  status.trackIndex,
+                  latencyMs);
+    return line;
+}
+
+void Player::ControlServer::appendPushes(int64_t nowNs)
+{
+    std::string line;
+    for (const std::unique_ptr<Client_t>& client : mClients)
+    {
+        if (client->pushMs == 0 || client->closing || nowNs < client->nextPushNs)
+        {
+            continue;
+        }
+        client->nextPushNs = nowNs + static_cast<int64_t>(client->pushMs) * 1000000;
+        // Latest state wins: a subscriber still holding its previous push skips this one
+        if (client->hasUnsentOutput())
+        {
+            continue;
+        }
+        if (line.empty())
+        {
+            line = formatStatus();  // formatted once per wake-up, however many subscribers are due
+        }
+        client->output += line;
+    }
+}
+
+int64_t Player::ControlServer::getNextPushNs() const
+{
+    int64_t next = INT64_MAX;
+    for (const std::unique_ptr<Client_t>& client : mClients)
+    {
+        if (client->pushMs > 0)
+        {
+            next = std::min(next, client->nextPushNs);
+        }
+    }
+    return next;
+}
+
+std::string Player::ControlServer::getDefaultEndpoint()
+{
+    if (const char* endpoint = std::getenv("MP3PLAYER_CONTROL"))
+    {
+        if (endpoint[0] != '\0')
+        {
+            return endpoint;
+        }
+    }
+#ifdef _WIN32
+    return getProcessEndpoint(GetCurrentProcessId());
+#else
+    return getProcessEndpoint(static_cast<uint32_t>(getpid()));
+#endif
+}
+
+std::string Player::ControlServer::getProcessEndpoint(uint32_t processId)
+{
+#ifdef _WIN32
+    return "\\\\.\\pipe\\mp3player-" + std::to_string(processId);
+#else
+    const char* runtimeDir = std::getenv("XDG_RUNTIME_DIR");
+    return std::string(runtimeDir && runtimeDir[0] != '\0' ? runtimeDir : "/tmp") + "/mp3player-" +
+           std::to_string(processId) + ".sock";
+#endif
+}
+
+Player::ControlServer::ControlServer() = default;
+
+Player::ControlServer::~ControlServer()
+{
+    stop();
+}
+
+namespace
+{
+    // Milliseconds until deadlineNs for a poll/wait timeout, -1 for none
+    int getTimeoutMs(int64_t deadlineNs)
+    {
+        if (deadlineNs == INT64_MAX)
+        {
+            return -1;
+        }
+        const int64_t remaining = deadlineNs - Player::PlaybackClock::getNanoseconds();
+        return remaining <= 0 ? 0 : static_cast<int>(std::min<int64_t>((remaining + 999999) / 1000000, 60000));
+    }
+}
+
+#ifdef _WIN32
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Named pipe transport: overlapped I/O on every instance, one WaitForMultipleObjects per wake-up
+
+namespace
+{
+    // WaitForMultipleObjects limit, minus the wake and connect events, two events per client
+    constexpr size_t MAX_CLIENTS = (MAXIMUM_WAIT_OBJECTS - 2) / 2;
+}
+
+struct Player::ControlServer::Platform_t
+{
+    HANDLE     wakeEvent   = nullptr;
+    HANDLE     pendingPipe = INVALID_HANDLE_VALUE;  // instance waiting for the next client
+    OVERLAPPED connectOverlapped{};
+    bool       firstInstance = true;
+
+    ~Platform_t()
+    {
+        if (pendingPipe != INVALID_HANDLE_VALUE)
+        {
+            CancelIoEx(pendingPipe, nullptr);
+            DWORD bytes = 0;
+            GetOverlappedResult(pendingPipe, &connectOverlapped, &bytes, TRUE);
+            CloseHandle(pendingPipe);
+        }
+        if (connectOverlapped.hEvent)
+        {
+            CloseHandle(connectOverlapped.hEvent);
+        }
+        if (wakeEvent)
+        {
+            CloseHandle(wakeEvent);
+        }
+    }
+
+    // Create the next pipe instance and start listening on it; false if the name is taken or creation failed
+    bool listen(const std::string& name)
+    {
+        DWORD openMode = PIPE_ACCESS_DUPLEX | FILE_FLAG_OVERLAPPED;
+        if (firstInstance)
+        {
+            openMode |= FILE_FLAG_FIRST_PIPE_INSTANCE;  // another player already owns this name
+        }
+        pendingPipe = CreateNamedPipeA(name.c_str(),
+                                       openMode,
+                                       PIPE_TYPE_BYTE | PIPE_READMODE_BYTE | PIPE_WAIT | PIPE_REJECT_REMOTE_CLIENTS,
+                                       PIPE_UNLIMITED_INSTANCES,
+                                       64 * 1024,
+                                       64 * 1024,
+                                       0,
+                                       nullptr);
+        if (pendingPipe == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+        firstInstance = false;
+        ResetEvent(connectOverlapped.hEvent);
+        if (!ConnectNamedPipe(pendingPipe, &connectOverlapped))
+        {
+            const DWORD error = GetLastError();
+            if (error == ERROR_PIPE_CONNECTED)
+            {
+                SetEvent(connectOverlapped.hEvent);
+            }
+            else if (error != ERROR_IO_PENDING)
+            {
+                CloseHandle(pendingPipe);
+                pendingPipe = INVALID_HANDLE_VALUE;
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+bool Player::ControlServer::start(const std::string& endpoint)
+{
+    stop();
+    mPlatform                           = std::make_unique<Platform_t>();
+    mPlatform->wakeEvent                = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+    mPlatform->connectOverlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+    if (!mPlatform->wakeEvent || !mPlatform->connectOverlapped.hEvent || !mPlatform->listen(endpoint))
+    {
+        mPlatform.reset();
+        return false;
+    }
+    mEndpoint = endpoint;
+    mStopping = false;
+    mRunning  = true;
+    mThread   = std::thread([this] { serviceLoop(); });
+    return true;
+}
+
+void Player::ControlServer::wake()
+{
+    if (mPlatform)
+    {
+        SetEvent(mPlatform->wakeEvent);
+    }
+}
+
+void Player::ControlServer::serviceLoop()
+{
+    Profiler::setThreadName("control");
+    const auto closeClient = [](Client_t& client)
+    {
+        // Outstanding reads and writes must finish before their buffers and events go away
+        CancelIoEx(client.pipe, nullptr);
+        DWORD bytes = 0;
+        if (client.readPending)
+        {
+            GetOverlappedResult(client.pipe, &client.readOverlapped, &bytes, TRUE);
+        }
+        if (client.writePending)
+        {
+            GetOverlappedResult(client.pipe, &client.writeOverlapped, &bytes, TRUE);
+        }
+        DisconnectNamedPipe(client.pipe);
+        CloseHandle(client.pipe);
+        CloseHandle(client.readOverlapped.hEvent);
+        CloseHandle(client.writeOverlapped.hEvent);
+    };
+
+    std::vector<HANDLE> handles;
+    while (!mStopping.load())
+    {
+        handles.clear();
+        handles.push_back(mPlatform->wakeEvent);
+        if (mPlatform->pendingPipe != INVALID_HANDLE_VALUE)
+        {
+            handles.push_back(mPlatform->connectOverlapped.hEvent);
+        }
+        for (const std::unique_ptr<Client_t>& client : mClients)
+        {
+            if (client->readPending)
+            {
+                handles.push_back(client->readOverlapped.hEvent);
+            }
+            if (client->writePending)
+            {
+                handles.push_back(client->writeOverlapped.hEvent);
+            }
+        }
+        const int timeoutMs = getTimeoutMs(getNextPushNs());
+        WaitForMultipleObjects(static_cast<DWORD>(handles.size()),
+                               handles.data(),
+                               FALSE,
+                               timeoutMs < 0 ? INFINITE : static_cast<DWORD>(timeoutMs));
+        if (mStopping.load())
+        {
+            break;
+        }
+        MP3_PROFILE_SCOPE("control.service");
+
+        // New client: hand the connected instance over and listen on a fresh one
+        DWORD bytes = 0;
+        if (mPlatform->pendingPipe != INVALID_HANDLE_VALUE &&
+            GetOverlappedResult(mPlatform->pendingPipe, &mPlatform->connectOverlapped, &bytes, FALSE))
+        {
+            if (mClients.size() < MAX_CLIENTS)
+            {
+                auto client                    = std::make_unique<Client_t>();
+                client->id                     = mNextClientId++;
+                client->pipe                   = mPlatform->pendingPipe;
+                client->readOverlapped.hEvent  = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+                client->writeOverlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+                mClients.push_back(std::move(client));
+            }
+            else
+            {
+                DisconnectNamedPipe(mPlatform->pendingPipe);
+                CloseHandle(mPlatform->pendingPipe);
+            }
+            mPlatform->pendingPipe = INVALID_HANDLE_VALUE;
+            mPlatform->listen(mEndpoint);
+        }
+
+        // Finish completed reads and keep one read outstanding per client
+        for (const std::unique_ptr<Client_t>& client : mClients)
+        {
+            while (!client->closing)
+            {
+                if (client->readPending)
+                {
+                    if (!GetOverlappedResult(client->pipe, &client->readOverlapped, &bytes, FALSE))
+                    {
+                        client->closing = GetLastError() != ERROR_IO_INCOMPLETE;
+                        break;
+                    }
+                    client->readPending = false;
+                    onClientData(*client, client->readBuffer, bytes);
+                    continue;
+                }
+                if (!ReadFile(client->pipe, client->readBuffer, READ_CHUNK_BYTES, nullptr, &client->readOverlapped) &&
+                    GetLastError() != ERROR_IO_PENDING)
+                {
+                    client->closing = true;
+                    break;
+                }
+                client->readPending = true;
+            }
+        }
+
+        collectReplies();
+        appendPushes(PlaybackClock::getNanoseconds());
+
+        // One write per client with everything queued since its last write completed
+        for (const std::unique_ptr<Client_t>& client : mClients)
+        {
+            if (client->writePending && GetOverlappedResult(client->pipe, &client->writeOverlapped, &bytes, FALSE))
+            {
+                client->writePending = false;
+                client->writing.clear();
+            }
+            else if (client->writePending && GetLastError() != ERROR_IO_INCOMPLETE)
+            {
+                client->closing = true;
+            }
+            if (client->closing || client->writePending || client->output.empty())
+            {
+                client->closing |= client->output.size() > MAX_PENDING_OUTPUT;
+                continue;
+            }
+            client->writing.swap(client->output);
+            if (!WriteFile(client->pipe,
+                           client->writing.data(),
+                           static_cast<DWORD>(client->writing.size()),
+                           nullptr,
+                           &client->writeOverlapped) &&
+                GetLastError() != ERROR_IO_PENDING)
+            {
+                client->closing = true;
+                continue;
+            }
+            client->writePending = true;
+        }
+
+        for (const std::unique_ptr<Client_t>& client : mClients)
+        {
+            if (client->closing)
+            {
+                closeClient(*client);
+            }
+        }
+        mClients.erase(std::remove_if(mClients.begin(),
+                                      mClients.end(),
+                                      [](const std::unique_ptr<Client_t>& client) { return client->closing; }),
+                       mClients.end());
+        mClientCount.store(mClients.size(), std::memory_order_relaxed);
+    }
+
+    for (const std::unique_ptr<Client_t>& client : mClients)
+    {
+        closeClient(*client);
+    }
+    mClients.clear();
+    mClientCount = 0;
+}
+
+void Player::ControlServer::stop()
+{
+    if (mThread.joinable())
+    {
+        mStopping = true;
+        wake();
+        mThread.join();
+    }
+    mPlatform.reset();
+    mRunning = false;
+}
+
+#else
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Unix domain socket transport: non-blocking sockets, one poll() per wake-up, a self-pipe for replies and stop
+
+struct Player::ControlServer::Platform_t
+{
+    int listenFd  = -1;
+    int wakeRead  = -1;
+    int wakeWrite = -1;
+
+    ~Platform_t()
+    {
+        for (int fd : {listenFd, wakeRead, wakeWrite})
+        {
+            if (fd >= 0)
+            {
+                ::close(fd);
+            }
+        }
+    }
+};
+
+namespace
+{
+    bool setNonBlocking(int fd)
+    {
+        const int flags = fcntl(fd, F_GETFL, 0);
+        return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0 && fcntl(fd, F_SETFD, FD_CLOEXEC) == 0;
+    }
+
+    bool makeAddress(const std::string& path, sockaddr_un& address)
+    {
+        std::memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (path.empty() || path.size() >= sizeof(address.sun_path))
+        {
+            return false;
+        }
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+        return true;
+    }
+}
+
+bool Player::ControlServer::start(const std::string& endpoint)
+{
+    stop();
+    sockaddr_un address;
+    if (!makeAddress(endpoint, address))
+    {
+        return false;
+    }
+
+    // A socket file left by a crashed player is reused; one a live player still answers on is not
+    const int probe = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (probe >= 0)
+    {
+        const bool live = ::connect(probe, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+        ::close(probe);
+        if (live)
+        {
+            return false;
+        }
+        unlink(endpoint.c_str());
+    }
+
+    auto platform      = std::make_unique<Platform_t>();
+    platform->listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    int wakePipe[2]    = {-1, -1};
+    if (platform->listenFd < 0 || pipe(wakePipe) != 0)
+    {
+        return false;
+    }
+    platform->wakeRead  = wakePipe[0];
+    platform->wakeWrite = wakePipe[1];
+    if (!setNonBlocking(platform->listenFd) || !setNonBlocking(platform->wakeRead) ||
+        !setNonBlocking(platform->wakeWrite) ||
+        bind(platform->listenFd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+        listen(platform->listenFd, 16) != 0)
+    {
+        return false;
+    }
+
+    mPlatform = std::move(platform);
+    mEndpoint = endpoint;
+    mStopping = false;
+    mRunning  = true;
+    mThread   = std::thread([this] { serviceLoop(); });
+    return true;
+}
+
+void Player::ControlServer::wake()
+{
+    if (mPlatform)
+    {
+        // A full pipe already guarantees a wake-up, so a failed write is fine
+        const char byte = 0;
+        [[maybe_unused]] const ssize_t written = write(mPlatform->wakeWrite, &byte, 1);
+    }
+}
+
+void Player::ControlServer::serviceLoop()
+{
+    Profiler::setThreadName("control");
+    std::vector<pollfd> fds;
+    char                buffer[READ_CHUNK_BYTES];
+    while (!mStopping.load())
+    {
+        fds.clear();
+        fds.push_back({mPlatform->wakeRead, POLLIN, 0});
+        fds.push_back({mPlatform->listenFd, POLLIN, 0});
+        for (const std::unique_ptr<Client_t>& client : mClients)
+        {
+            fds.push_back({client->fd, static_cast<short>(POLLIN | (client->output.empty() ? 0 : POLLOUT)), 0});
+        }
+        if (poll(fds.data(), fds.size(), getTimeoutMs(getNextPushNs())) < 0 && errno != EINTR)
+        {
+            break;
+        }
+        if (mStopping.load())
+        {
+            break;
+        }
+        MP3_PROFILE_SCOPE("control.service");
+
+        if (fds[0].revents & POLLIN)
+        {
+            while (read(mPlatform->wakeRead, buffer, sizeof(buffer)) > 0)
+            {
+            }
+        }
+
+        // Only clients that were polled have a matching entry; new ones are appended after this loop
+        for (size_t index = 0; index < mClients.size(); ++index)
+        {
+            Client_t&   client  = *mClients[index];
+            const short revents = fds[index + 2].revents;
+            if (revents & (POLLIN | POLLHUP | POLLERR))
+            {
+                for (;;)
+                {
+                    const ssize_t received = recv(client.fd, buffer, sizeof(buffer), 0);
+                    if (received > 0)
+                    {
+                        onClientData(client, buffer, static_cast<size_t>(received));
+                        continue;
+                    }
+                    client.closing |= received == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR);
+                    break;
+                }
+            }
+        }
+
+        if (fds[1].revents & POLLIN)
+        {
+            for (int fd = accept(mPlatform->listenFd, nullptr, nullptr); fd >= 0;
+                 fd     = accept(mPlatform->listenFd, nullptr, nullptr))
+            {
+                if (!setNonBlocking(fd))
+                {
+                    ::close(fd);
+                    continue;
+                }
+                auto client = std::make_unique<Client_t>();
+                client->id  = mNextClientId++;
+                client->fd  = fd;
+                mClients.push_back(std::move(client));
+            }
+        }
+
+        collectReplies();
+        appendPushes(PlaybackClock::getNanoseconds());
+
+        // One send per client with everything queued; whatever the socket does not take waits for POLLOUT
+        for (const std::unique_ptr<Client_t>& client : mClients)
+        {
+            if (client->closing || client->output.empty())
+            {
+                continue;
+            }
+            const ssize_t sent = send(client->fd, client->output.data(), client->output.size(), MSG_NOSIGNAL);
+            if (sent > 0)
+            {
+                client->output.erase(0, static_cast<size_t>(sent));
+            }
+            else if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            {
+                client->closing = true;
+            }
+            client->closing |= client->output.size() > MAX_PENDING_OUTPUT;
+        }
+
+        for (const std::unique_ptr<Client_t>& client : mClients)
+        {
+            if (client->closing)
+            {
+                ::close(client->fd);
+            }
+        }
+        mClients.erase(std::remove_if(mClients.begin(),
+                                      mClients.end(),
+                                      [](const std::unique_ptr<Client_t>& client) { return client->closing; }),
+                       mClients.end());
+        mClientCount.store(mClients.size(), std::memory_order_relaxed);
+    }
+
+    for (const std::unique_ptr<Client_t>& client : mClients)
+    {
+        ::close(client->fd);
+    }
+    mClients.clear();
+    mClientCount = 0;
+}
+
+void Player::ControlServer::stop()
+{
+    if (mThread.joinable())
+    {
+        mStopping = true;
+        wake();
+        mThread.join();
+    }
+    if (mPlatform)
+    {
+        unlink(mEndpoint.c_str());
+    }
+    mPlatform.reset();
+    mRunning = false;
+}
+
+#endif
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Client
+
+#ifdef _WIN32
+
+struct Player::ControlClient::Platform_t
+{
+    HANDLE     pipe = INVALID_HANDLE_VALUE;
+    OVERLAPPED readOverlapped{};
+    OVERLAPPED writeOverlapped{};
+};
+
+Player::ControlClient::ControlClient()
+    : mPlatform(std::make_unique<Platform_t>())
+{
+    mPlatform->readOverlapped.hEvent  = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+    mPlatform->writeOverlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+}
+
+Player::ControlClient::~ControlClient()
+{
+    close();
+    CloseHandle(mPlatform->readOverlapped.hEvent);
+    CloseHandle(mPlatform->writeOverlapped.hEvent);
+}
+
+bool Player::ControlClient::connect(const std::string& endpoint)
+{
+    close();
+    for (int attempt = 0; attempt < 2; ++attempt)
+    {
+        mPlatform->pipe = CreateFileA(endpoint.c_str(),
+                                      GENERIC_READ | GENERIC_WRITE,
+                                      0,
+                                      nullptr,
+                                      OPEN_EXISTING,
+                                      FILE_FLAG_OVERLAPPED,
+                                      nullptr);
+        if (mPlatform->pipe != INVALID_HANDLE_VALUE)
+        {
+            return true;
+        }
+        // Every instance busy: the server creates the next one right after a connect
+        if (GetLastError() != ERROR_PIPE_BUSY || !WaitNamedPipeA(endpoint.c_str(), 1000))
+        {
+            return false;
+        }
+    }
+    return false;
+}
+
+void Player::ControlClient::close()
+{
+    if (mPlatform->pipe != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(mPlatform->pipe);
+        mPlatform->pipe = INVALID_HANDLE_VALUE;
+    }
+    mInput.clear();
+}
+
+bool Player::ControlClient::isConnected() const
+{
+    return mPlatform->pipe != INVALID_HANDLE_VALUE;
+}
+
+bool Player::ControlClient::sendLine(const std::string& line)
+{
+    if (!isConnected())
+    {
+        return false;
+    }
+    const std::string data  = line + "\n";
+    DWORD             bytes = 0;
+    if (!WriteFile(mPlatform->pipe, data.data(), static_cast<DWORD>(data.size()), nullptr, &mPlatform->writeOverlapped) &&
+        GetLastError() != ERROR_IO_PENDING)
+    {
+        return false;
+    }
+    return GetOverlappedResult(mPlatform->pipe, &mPlatform->writeOverlapped, &bytes, TRUE) && bytes == data.size();
+}
+
+bool Player::ControlClient::fill(int timeoutMs)
+{
+    char  buffer[READ_CHUNK_BYTES];
+    DWORD bytes = 0;
+    if (!ReadFile(mPlatform->pipe, buffer, sizeof(buffer), nullptr, &mPlatform->readOverlapped) &&
+        GetLastError() != ERROR_IO_PENDING)
+    {
+        return false;
+    }
+    if (WaitForSingleObject(mPlatform->readOverlapped.hEvent, timeoutMs < 0 ? INFINITE : timeoutMs) != WAIT_OBJECT_0)
+    {
+        CancelIoEx(mPlatform->pipe, &mPlatform->readOverlapped);
+    }
+    // After a cancel this still returns any bytes that arrived first
+    if (!GetOverlappedResult(mPlatform->pipe, &mPlatform->readOverlapped, &bytes, TRUE) || bytes == 0)
+    {
+        return false;
+    }
+    mInput.append(buffer, bytes);
+    return true;
+}
+
+#else
+
+struct Player::ControlClient::Platform_t
+{
+    int fd = -1;
+};
+
+Player::ControlClient::ControlClient()
+    : mPlatform(std::make_unique<Platform_t>())
+{
+}
+
+Player::ControlClient::~ControlClient()
+{
+    close();
+}
+
+bool Player::ControlClient::connect(const std::string& endpoint)
+{
+    close();
+    sockaddr_un address;
+    if (!makeAddress(endpoint, address))
+    {
+        return false;
+    }
+    mPlatform->fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (mPlatform->fd < 0 || ::connect(mPlatform->fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void Player::ControlClient::close()
+{
+    if (mPlatform->fd >= 0)
+    {
+        ::close(mPlatform->fd);
+        mPlatform->fd = -1;
+    }
+    mInput.clear();
+}
+
+bool Player::ControlClient::isConnected() const
+{
+    return mPlatform->fd >= 0;
+}
+
+bool Player::ControlClient::sendLine(const std::string& line)
+{
+    if (!isConnected())
+    {
+        return false;
+    }
+    const std::string data = line + "\n";
+    size_t            done = 0;
+    while (done < data.size())
+    {
+        const ssize_t sent = send(mPlatform->fd, data.data() + done, data.size() - done, MSG_NOSIGNAL);
+        if (sent <= 0 && errno != EINTR)
+        {
+            return false;
+        }
+        done += sent > 0 ? static_cast<size_t>(sent) : 0;
+    }
+    return true;
+}
+
+bool Player::ControlClient::fill(int timeoutMs)
+{
+    pollfd entry{mPlatform->fd, POLLIN, 0};
+    if (poll(&entry, 1, timeoutMs) <= 0)
+    {
+        return false;
+    }
+    char          buffer[READ_CHUNK_BYTES];
+    const ssize_t received = recv(mPlatform->fd, buffer, sizeof(buffer), 0);
+    if (received <= 0)
+    {
+        return false;
+    }
+    mInput.append(buffer, static_cast<size_t>(received));
+    return true;
+}
+
+#endif
+
+bool Player::ControlClient::readLine(std::string& line, int timeoutMs)
+{
+    const int64_t deadline = timeoutMs < 0 ? INT64_MAX : PlaybackClock::getNanoseconds() + timeoutMs * 1000000LL;
+    for (;;)
+    {
+        const size_t end = mInput.find('\n');
+        if (end != std::string::npos)
+        {
+            line.assign(mInput, 0, end);
+            mInput.erase(0, end + 1);
+            return true;
+        }
+        if (!isConnected() || !fill(getTimeoutMs(deadline)))
+        {
+            return false;
+        }
+    }
+}
@@ -0,0 +1,172 @@
+#pragma once
+
+#include "PlaybackClock.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Player
+{
+
+	enum ControlCommandType_e
+	{
+		CONTROL_PLAY = 0,  // value: start seconds
+		CONTROL_PAUSE,
+		CONTROL_RESUME,
+		CONTROL_STOP,
+		CONTROL_SEEK,      // value: seconds
+		CONTROL_NEXT,
+		CONTROL_PREVIOUS,
+		CONTROL_VOLUME,    // value: 0..1, value2: balance -1..1
+		CONTROL_EQ         // band, value: gain dB
+	};
+
+	// One parsed request, applied by the thread that owns the player
+	struct ControlCommand_t
+	{
+		ControlCommandType_e type       = CONTROL_PLAY;
+		uint32_t             clientId   = 0;
+		uint64_t             sequence   = 0;  // per-connection request number, echoed in the reply
+		uint32_t             argCount   = 0;  // numeric arguments given (play and volume have optional ones)
+		double               value      = 0.0;
+		double               value2     = 0.0;
+		uint32_t             band       = 0;
+		int64_t              receivedNs = 0;  // PlaybackClock::getNanoseconds() when the line arrived
+	};
+
+	// Transport state published by the player thread and pushed to subscribers
+	struct ControlStatus_t
+	{
+		double  positionSeconds = 0.0;
+		double  durationSeconds = 0.0;
+		bool    playing         = false;
+		bool    paused          = false;
+		float   peakLeft        = 0.0F;  // linear 0..1 over the last few ms of output
+		float   peakRight       = 0.0F;
+		int32_t trackIndex      = -1;
+	};
+
+	/// @brief Local control endpoint: a Unix domain socket, or a named pipe on Windows. One service thread accepts
+	///        clients, parses newline-terminated text requests and queues them for the player thread, which drains
+	///        them once per frame and answers through reply(). Subscribers get a "pos" line at their chosen
+	///        interval; the frame comes straight from the playback clock so it is sample accurate regardless of
+	///        the UI frame rate. All output for a client (replies and pushes) is buffered and flushed with one
+	///        write per wake-up, and a subscriber that has not drained its last push is skipped rather than
+	///        queued behind.
+	///
+	///        Requests:  play [s] | pause | resume | stop | seek <s> | next | prev | volume <0..1> [balance]
+	///                   | eq <band> <dB> | status | subscribe [ms] | unsubscribe | ping
+	///        Replies:   ok <seq> <command> | err <seq> <message>      (seq counts requests per connection)
+	///        Push:      pos <frame> <seconds> <duration> <play|pause|stop> <peakL> <peakR> <track> <latencyMs>
+	///                   (latencyMs: device output latency the clock has measured, audio trails the frame by it)
+	class ControlServer
+	{
+	public:
+		ControlServer();
+		~ControlServer();
+
+		ControlServer(const ControlServer&)            = delete;
+		ControlServer& operator=(const ControlServer&) = delete;
+
+		/// @brief listen on endpoint (socket path / pipe name, see getDefaultEndpoint) and start the service thread
+		bool start(const std::string& endpoint);
+		void stop();
+
+		bool               isRunning() const { return mRunning.load(std::memory_order_relaxed); }
+		const std::string& getEndpoint() const { return mEndpoint; }
+		size_t             getClientCount() const { return mClientCount.load(std::memory_order_relaxed); }
+
+		/// @brief player thread: move every queued command to the end of out, never blocks on the service thread
+		size_t drainCommands(std::vector<ControlCommand_t>& out);
+
+		/// @brief player thread: answer a drained command ("ok" when error is empty)
+		void reply(const ControlCommand_t& command, const std::string& error = std::string());
+
+		/// @brief player thread: latest transport state for status requests and the push stream
+		void publishStatus(const ControlStatus_t& status);
+
+		/// @brief position source for pushes while playing; must outlive the server or be detached with nullptr
+		void attachClock(const PlaybackClock* clock) { mClock.store(clock, std::memory_order_release); }
+
+		/// @brief MP3PLAYER_CONTROL if set, else getProcessEndpoint of this process
+		static std::string getDefaultEndpoint();
+
+		/// @brief per-process endpoint name, so several players can run side by side
+		static std::string getProcessEndpoint(uint32_t processId);
+
+		static bool parseCommand(const std::string& line, ControlCommand_t& command, std::string& error);
+
+		static constexpr uint32_t DEFAULT_PUSH_MS = 50;
+
+	private:
+		struct Client_t;
+		struct Platform_t;
+
+		void serviceLoop();
+		void handleLine(Client_t& client, const std::string& line);
+		void onClientData(Client_t& client, const char* data, size_t size);
+		void collectReplies();
+		void appendPushes(int64_t nowNs);
+		int64_t getNextPushNs() const;
+		std::string formatStatus() const;
+		void wake();
+
+		std::string                            mEndpoint;
+		std::unique_ptr<Platform_t>            mPlatform;
+		std::thread                            mThread;
+		std::atomic<bool>                      mRunning{false};
+		std::atomic<bool>                      mStopping{false};
+		std::atomic<size_t>                    mClientCount{0};
+		std::atomic<const PlaybackClock*>      mClock{nullptr};
+		std::vector<std::unique_ptr<Client_t>> mClients;  // service thread only
+		uint32_t                               mNextClientId = 1;
+
+		std::mutex                    mCommandLock;
+		std::vector<ControlCommand_t> mCommands;
+
+		struct Reply_t
+		{
+			uint32_t    clientId = 0;
+			std::string line;
+		};
+		std::mutex           mReplyLock;
+		std::vector<Reply_t> mReplies;
+
+		mutable std::mutex mStatusLock;
+		ControlStatus_t    mStatus;
+	};
+
+	/// @brief Blocking client for the control endpoint, used by the mp3ctl tool and the benchmarks
+	class ControlClient
+	{
+	public:
+		ControlClient();
+		~ControlClient();
+
+		ControlClient(const ControlClient&)            = delete;
+		ControlClient& operator=(const ControlClient&) = delete;
+
+		bool connect(const std::string& endpoint);
+		void close();
+		bool isConnected() const;
+
+		/// @brief send one request, the newline is appended
+		bool sendLine(const std::string& line);
+
+		/// @brief next line from the server without its newline, false on timeout or disconnect
+		bool readLine(std::string& line, int timeoutMs);
+
+	private:
+		bool fill(int timeoutMs);
+
+		struct Platform_t;
+		std::unique_ptr<Platform_t> mPlatform;
+		std::string                 mInput;
+	};
+
+}
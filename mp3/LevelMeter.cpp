@@ -0,0 +1,261 @@
+#include "LevelMeter.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MP3_LEVEL_METER_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    // BS.1770-4 Annex 2: 48-tap interpolating FIR as four 12-tap phases, stored tap-major so one 4-wide
+    // multiply-add advances all four phases by one tap
+    alignas(16) constexpr float INTERPOLATOR[Player::LevelMeter::TAPS][4] = {
+        {0.0017089843750F, -0.0291748046875F, -0.0189208984375F, -0.0083007812500F},
+        {0.0109863281250F, 0.0292968750000F, 0.0330810546875F, 0.0148925781250F},
+        {-0.0196533203125F, -0.0517578125000F, -0.0582275390625F, -0.0266113281250F},
+        {0.0332031250000F, 0.0891113281250F, 0.1015625000000F, 0.0476074218750F},
+        {-0.0594482421875F, -0.1665039062500F, -0.2003173828125F, -0.1022949218750F},
+        {0.1373291015625F, 0.4650878906250F, 0.7797851562500F, 0.9721679687500F},
+        {0.9721679687500F, 0.7797851562500F, 0.4650878906250F, 0.1373291015625F},
+        {-0.1022949218750F, -0.2003173828125F, -0.1665039062500F, -0.0594482421875F},
+        {0.0476074218750F, 0.1015625000000F, 0.0891113281250F, 0.0332031250000F},
+        {-0.0266113281250F, -0.0582275390625F, -0.0517578125000F, -0.0196533203125F},
+        {0.0148925781250F, 0.0330810546875F, 0.0292968750000F, 0.0109863281250F},
+        {-0.0083007812500F, -0.0189208984375F, -0.0291748046875F, 0.0017089843750F},
+    };
+
+    constexpr size_t HISTORY = Player::LevelMeter::TAPS - 1;
+}
+
+Player::LevelMeter::LevelMeter()
+    : mUseSimd(isSimdAvailable())
+{
+}
+
+bool Player::LevelMeter::isSimdAvailable()
+{
+#ifdef MP3_LEVEL_METER_SSE2
+    return true;
+#else
+    return false;
+#endif
+}
+
+float Player::LevelMeter::toDb(float linear)
+{
+    return linear > 1.0e-6F ? 20.0F * std::log10(linear) : -120.0F;
+}
+
+void Player::LevelMeter::reset(uint32_t sampleRate)
+{
+    mSampleRate = sampleRate ? sampleRate : 44100;
+    mMeanSquare = {};
+    mHistory    = {};
+    mGeneration.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Player::LevelMeter::process(const int16_t* samples, size_t frames, uint16_t channels, uint64_t startFrame)
+{
+    if (frames == 0 || channels == 0)
+    {
+        return;
+    }
+    MP3_PROFILE_SCOPE("sink.meter");
+
+    LevelReading_t reading;
+    reading.startFrame = startFrame;
+    reading.frames     = static_cast<uint32_t>(frames);
+    reading.channels   = channels;
+
+    // One-pole average of the mean square with a RMS_SECONDS time constant, stepped once per block
+    const float  smoothing = 1.0F - std::exp(-static_cast<float>(frames) / (RMS_SECONDS * mSampleRate));
+    const size_t measured  = std::min<size_t>(channels, LevelReading_t::MAX_CHANNELS);
+    mScratch.resize(HISTORY + frames);
+    for (size_t channel = 0; channel < measured; ++channel)
+    {
+        // Deinterleave behind the previous block's tail so the interpolator runs across the block boundary
+        std::copy(mHistory[channel].begin(), mHistory[channel].end(), mScratch.begin());
+        const int16_t* source = samples + channel;
+        for (size_t frame = 0; frame < frames; ++frame, source += channels)
+        {
+            mScratch[HISTORY + frame] = *source * (1.0F / 32768.0F);
+        }
+        std::copy(mScratch.end() - HISTORY, mScratch.end(), mHistory[channel].begin());
+
+        double sumSquares = 0.0;
+        measureChannel(frames, reading.peak[channel], sumSquares, reading.truePeak[channel]);
+        mMeanSquare[channel] += smoothing * (static_cast<float>(sumSquares / frames) - mMeanSquare[channel]);
+        reading.rms[channel] = std::sqrt(mMeanSquare[channel]);
+    }
+    if (measured == 1)
+    {
+        reading.peak[1]     = reading.peak[0];
+        reading.rms[1]      = reading.rms[0];
+        reading.truePeak[1] = reading.truePeak[0];
+    }
+    publish(reading);
+}
+
+void Player::LevelMeter::measureChannel(size_t frames, float& peak, double& sumSquares, float& truePeak)
+{
+    const float* block = mScratch.data() + HISTORY;
+    size_t       frame = 0;
+#ifdef MP3_LEVEL_METER_SSE2
+    if (mUseSimd)
+    {
+        const __m128 signMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+        __m128       peak4    = _mm_setzero_ps();
+        __m128       squares4 = _mm_setzero_ps();
+        for (; frame + 4 <= frames; frame += 4)
+        {
+            const __m128 values = _mm_loadu_ps(block + frame);
+            peak4               = _mm_max_ps(peak4, _mm_and_ps(values, signMask));
+            squares4            = _mm_add_ps(squares4, _mm_mul_ps(values, values));
+        }
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, peak4);
+        peak = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+        _mm_store_ps(lanes, squares4);
+        sumSquares = static_cast<double>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+        for (; frame < frames; ++frame)
+        {
+            peak = std::max(peak, std::fabs(block[frame]));
+            sumSquares += block[frame] * block[frame];
+        }
+
+        // Four interpolated outputs per input sample, one per phase, in one register
+        __m128 over4 = _mm_setzero_ps();
+        for (frame = 0; frame < frames; ++frame)
+        {
+            const float* newest = block + frame;
+            __m128       sum    = _mm_mul_ps(_mm_load_ps(INTERPOLATOR[0]), _mm_set1_ps(newest[0]));
+            for (size_t tap = 1; tap < TAPS; ++tap)
+            {
+                const __m128 sample = _mm_set1_ps(newest[-static_cast<ptrdiff_t>(tap)]);
+                sum                 = _mm_add_ps(sum, _mm_mul_ps(_mm_load_ps(INTERPOLATOR[tap]), sample));
+            }
+            over4 = _mm_max_ps(over4, _mm_and_ps(sum, signMask));
+        }
+        _mm_store_ps(lanes, over4);
+        truePeak = std::max({peak, lanes[0], lanes[1], lanes[2], lanes[3]});
+        return;
+    }
+#endif
+    peak       = 0.0F;
+    sumSquares = 0.0;
+    float over = 0.0F;
+    for (; frame < frames; ++frame)
+    {
+        const float* newest = block + frame;
+        peak                = std::max(peak, std::fabs(newest[0]));
+        sumSquares += newest[0] * newest[0];
+        for (size_t phase = 0; phase < 4; ++phase)
+        {
+            float sum = 0.0F;
+            for (size_t tap = 0; tap < TAPS; ++tap)
+            {
+                sum += INTERPOLATOR[tap][phase] * newest[-static_cast<ptrdiff_t>(tap)];
+            }
+            over = std::max(over, std::fabs(sum));
+        }
+    }
+    truePeak = std::max(peak, over);
+}
+
+void Player::LevelMeter::publish(const LevelReading_t& reading)
+{
+    Slot_t&        slot     = mSlots[mNextSlot];
+    const uint32_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    mNextSlot               = (mNextSlot + 1) % SLOT_COUNT;
+
+    slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.generation.store(mGeneration.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    slot.startFrame.store(reading.startFrame, std::memory_order_relaxed);
+    slot.frames.store(reading.frames, std::memory_order_relaxed);
+    slot.channels.store(reading.channels, std::memory_order_relaxed);
+    for (size_t channel = 0; channel < LevelReading_t::MAX_CHANNELS; ++channel)
+    {
+        slot.peak[channel].store(reading.peak[channel], std::memory_order_relaxed);
+        slot.rms[channel].store(reading.rms[channel], std::memory_order_relaxed);
+        slot.truePeak[channel].store(reading.truePeak[channel], std::memory_order_relaxed);
+    }
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+bool Player::LevelMeter::read(uint64_t frame, LevelReading_t& reading) const
+{
+    const uint32_t generation = mGeneration.load(std::memory_order_relaxed);
+    bool           found      = false;
+    for (const Slot_t& slot : mSlots)
+    {
+        // A slot the writer keeps overwriting is skipped after a few tries; its neighbours still answer
+        for (int attempt = 0; attempt < 4; ++attempt)
+        {
+            const uint32_t before = slot.sequence.load(std::memory_order_acquire);
+            if (before & 1U)
+            {
+                continue;
+            }
+            LevelReading_t candidate;
+            const uint32_t slotGeneration = slot.generation.load(std::memory_order_relaxed);
+            candidate.startFrame          = slot.startFrame.load(std::memory_order_relaxed);
+            candidate.frames              = slot.frames.load(std::memory_order_relaxed);
+            candidate.channels            = static_cast<uint16_t>(slot.channels.load(std::memory_order_relaxed));
+            for (size_t channel = 0; channel < LevelReading_t::MAX_CHANNELS; ++channel)
+            {
+                candidate.peak[channel]     = slot.peak[channel].load(std::memory_order_relaxed);
+                candidate.rms[channel]      = slot.rms[channel].load(std::memory_order_relaxed);
+                candidate.truePeak[channel] = slot.truePeak[channel].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) != before)
+            {
+                continue;
+            }
+            if (before != 0 && slotGeneration == generation && candidate.startFrame <= frame &&
+                (!found || candidate.startFrame > reading.startFrame))
+            {
+                reading = candidate;
+                found   = true;
+            }
+            break;
+        }
+    }
+    return found;
+}
+
+void Player::LevelMeterDisplay_t::update(const LevelReading_t& reading, float elapsedSeconds)
+{
+    const float fall = FALL_DB_PER_S * elapsedSeconds;
+    for (size_t channel = 0; channel < LevelReading_t::MAX_CHANNELS; ++channel)
+    {
+        const float peak     = std::max(LevelMeter::toDb(reading.peak[channel]), FLOOR_DB);
+        const float rms      = std::max(LevelMeter::toDb(reading.rms[channel]), FLOOR_DB);
+        const float truePeak = std::max(LevelMeter::toDb(reading.truePeak[channel]), FLOOR_DB);
+        peakDb[channel]      = std::max(peak, peakDb[channel] - fall);
+        rmsDb[channel]       = std::max(rms, rmsDb[channel] - fall);
+
+        // The marker and the true-peak readout each hold their highest value for HOLD_SECONDS
+        holdAge[channel] += elapsedSeconds;
+        if (peak >= holdDb[channel])
+        {
+            holdDb[channel]  = peak;
+            holdAge[channel] = 0.0F;
+        }
+        else if (holdAge[channel] > HOLD_SECONDS)
+        {
+            holdDb[channel] = std::max(peak, holdDb[channel] - fall);
+        }
+        truePeakAge[channel] += elapsedSeconds;
+        if (truePeak >= truePeakDb[channel] || truePeakAge[channel] > HOLD_SECONDS)
+        {
+            truePeakDb[channel]  = truePeak;
+            truePeakAge[channel] = 0.0F;
+        }
+    }
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Player
+{
+
+	// Levels of one output block, linear (1.0 = full scale)
+	struct LevelReading_t
+	{
+		static constexpr size_t MAX_CHANNELS = 2;
+
+		uint64_t startFrame = 0;
+		uint32_t frames     = 0;
+		uint16_t channels   = 0;
+		float    peak[MAX_CHANNELS]     = {};  // sample peak of the block
+		float    rms[MAX_CHANNELS]      = {};  // ~300 ms exponential average up to the end of the block
+		float    truePeak[MAX_CHANNELS] = {};  // 4x oversampled peak, may exceed 1.0 for inter-sample overs
+	};
+
+	/// @brief Per-channel peak, RMS and true-peak (BS.1770-4 Annex 2 interpolator) of every block the audio thread
+	///        queues. Readings go into a small ring of seqlocked slots stamped with the block's first frame, so
+	///        the UI picks the block the playback clock is inside rather than the one just queued ~4 blocks ahead.
+	///        One writer (the sink thread), any number of readers; neither side ever blocks.
+	class LevelMeter
+	{
+	public:
+		LevelMeter();
+
+		/// @brief writer: start a new stream (play or seek); older readings are no longer returned
+		void reset(uint32_t sampleRate);
+
+		/// @brief writer: measure interleaved PCM starting at stream frame startFrame and publish the reading
+		void process(const int16_t* samples, size_t frames, uint16_t channels, uint64_t startFrame);
+
+		/// @brief any thread: reading of the latest block that starts at or before frame, false if there is none
+		bool read(uint64_t frame, LevelReading_t& reading) const;
+
+		/// @brief SSE2 kernels when the build has them; the scalar path stays for comparison
+		void        setSimdEnabled(bool enabled) { mUseSimd = enabled && isSimdAvailable(); }
+		static bool isSimdAvailable();
+
+		/// @brief 20 log10, floored at -120 dB
+		static float toDb(float linear);
+
+		static constexpr size_t SLOT_COUNT  = 16;
+		static constexpr size_t TAPS        = 12;  // per phase of the 48-tap interpolator
+		static constexpr float  RMS_SECONDS = 0.3F;
+
+	private:
+		struct Slot_t
+		{
+			std::atomic<uint32_t> sequence{0};  // odd while the writer is inside
+			std::atomic<uint32_t> generation{0};
+			std::atomic<uint64_t> startFrame{0};
+			std::atomic<uint32_t> frames{0};
+			std::atomic<uint32_t> channels{0};
+			std::atomic<float>    peak[LevelReading_t::MAX_CHANNELS];
+			std::atomic<float>    rms[LevelReading_t::MAX_CHANNELS];
+			std::atomic<float>    truePeak[LevelReading_t::MAX_CHANNELS];
+		};
+
+		/// @brief peaks and sum of squares of the channel deinterleaved into mScratch
+		void measureChannel(size_t frames, float& peak, double& sumSquares, float& truePeak);
+		void publish(const LevelReading_t& reading);
+
+		using History_t = std::array<float, TAPS - 1>;
+
+		// Writer state
+		uint32_t                                             mSampleRate = 44100;
+		bool                                                 mUseSimd    = false;
+		std::array<float, LevelReading_t::MAX_CHANNELS>      mMeanSquare{};
+		std::array<History_t, LevelReading_t::MAX_CHANNELS> mHistory{};   // last input samples, per channel
+		std::vector<float>                                   mScratch;    // history + one channel of the block
+		size_t                                               mNextSlot = 0;
+
+		std::atomic<uint32_t>          mGeneration{1};
+		std::array<Slot_t, SLOT_COUNT> mSlots;
+	};
+
+	// UI-side ballistics in dB: bars fall at a fixed rate, the peak marker holds before it falls
+	struct LevelMeterDisplay_t
+	{
+		static constexpr float FLOOR_DB      = -60.0F;
+		static constexpr float FALL_DB_PER_S = 24.0F;
+		static constexpr float HOLD_SECONDS  = 1.5F;
+
+		float peakDb[LevelReading_t::MAX_CHANNELS]      = {FLOOR_DB, FLOOR_DB};
+		float rmsDb[LevelReading_t::MAX_CHANNELS]       = {FLOOR_DB, FLOOR_DB};
+		float holdDb[LevelReading_t::MAX_CHANNELS]      = {FLOOR_DB, FLOOR_DB};
+		float truePeakDb[LevelReading_t::MAX_CHANNELS]  = {FLOOR_DB, FLOOR_DB};  // highest in the hold window
+		float holdAge[LevelReading_t::MAX_CHANNELS]     = {};
+		float truePeakAge[LevelReading_t::MAX_CHANNELS] = {};
+
+		void update(const LevelReading_t& reading, float elapsedSeconds);
+	};
+
+}
@@ -0,0 +1,185 @@
+#include "LibraryScanner.h"
+#include "Profiler.h"
+#include "TagReader.h"
+
+#include <algorithm>
+
+Player::LibraryScanner::LibraryScanner(size_t threadCount)
+    : mPool(std::make_unique<ThreadPool>(threadCount))
+{
+}
+
+Player::LibraryScanner::~LibraryScanner()
+{
+    cancel();
+}
+
+bool Player::LibraryScanner::start(const std::filesystem::path& root)
+{
+    if (isRunning())
+    {
+        return false;
+    }
+    std::error_code error;
+    if (!std::filesystem::is_directory(root, error))
+    {
+        return false;
+    }
+
+    if (mWalker.joinable())
+    {
+        mWalker.join();
+    }
+    mCancel = false;
+    mWalking = true;
+    mFilesFound = 0;
+    mFilesProbed = 0;
+    mWalker = std::thread(&LibraryScanner::walk, this, root);
+    return true;
+}
+
+void Player::LibraryScanner::cancel()
+{
+    mCancel = true;
+    if (mWalker.joinable())
+    {
+        mWalker.join();
+    }
+    mPool->waitIdle();
+    mCancel = false;
+}
+
+bool Player::LibraryScanner::isRunning() const
+{
+    return mWalking.load() || mFilesProbed.load() < mFilesFound.load();
+}
+
+size_t Player::LibraryScanner::drainResults(std::vector<ScannedTrack_t>& out, size_t maxCount)
+{
+    std::unique_lock<std::mutex> guard(mResultLock, std::try_to_lock);
+    if (!guard.owns_lock())
+    {
+        // A probe batch is publishing; pick the results up next frame rather than waiting
+        return 0;
+    }
+
+    const size_t count = std::min(maxCount, mResults.size() - mResultHead);
+    std::move(mResults.begin() + mResultHead, mResults.begin() + mResultHead + count, std::back_inserter(out));
+    mResultHead += count;
+    if (mResultHead == mResults.size())
+    {
+        mResults.clear();
+        mResultHead = 0;
+    }
+    return count;
+}
+
+bool Player::LibraryScanner::isMp3Path(const std::filesystem::path& path)
+{
+    std::string extension = path.extension().string();
+    std::transform(extension.begin(),
+                   extension.end(),
+                   extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension == ".mp3";
+}
+
+bool Player::LibraryScanner::probeFile(const std::filesystem::path& path, ScannedTrack_t& track)
+{
+    MP3_PROFILE_SCOPE("scan.probe");
+    TrackTags_t tags;
+    if (!TagReader::readFile(path, tags) || tags.sampleRate == 0)
+    {
+        return false;
+    }
+    track.title           = std::move(tags.title);
+    track.artist          = std::move(tags.artist);
+    track.album           = std::move(tags.album);
+    track.durationSeconds = tags.durationSeconds;
+    track.bitrateKbps     = tags.bitrateKbps;
+    track.sampleRate      = tags.sampleRate;
+    return true;
+}
+
+void Player::LibraryScanner::walk(std::filesystem::path root)
+{
+    Profiler::setThreadName("library walker");
+    MP3_PROFILE_SCOPE("scan.walk");
+
+    std::vector<PendingFile_t> batch;
+    batch.reserve(mBatchSize);
+
+    std::error_code error;
+    auto            options  = std::filesystem::directory_options::skip_permission_denied;
+    auto            iterator = std::filesystem::recursive_directory_iterator(root, options, error);
+    for (; !error && iterator != std::filesystem::recursive_directory_iterator(); iterator.increment(error))
+    {
+        if (mCancel)
+        {
+            break;
+        }
+        const std::filesystem::directory_entry& entry = *iterator;
+        std::error_code                         entryError;
+        if (!entry.is_regular_file(entryError) || !isMp3Path(entry.path()))
+        {
+            continue;
+        }
+        const uint64_t fileSize     = entry.file_size(entryError);
+        const int64_t  modifiedTime = entry.last_write_time(entryError).time_since_epoch().count();
+        batch.push_back({entry.path(), fileSize, modifiedTime});
+        if (batch.size() == mBatchSize)
+        {
+            submitBatch(batch);
+        }
+    }
+    if (!batch.empty() && !mCancel)
+    {
+        submitBatch(batch);
+    }
+    mWalking = false;
+}
+
+void Player::LibraryScanner::submitBatch(std::vector<PendingFile_t>& batch)
+{
+    mFilesFound += batch.size();
+    mPool->submit([this, files = std::move(batch)] { probeBatch(files); });
+    batch.clear();
+    batch.reserve(mBatchSize);
+}
+
+void Player::LibraryScanner::probeBatch(const std::vector<PendingFile_t>& batch)
+{
+    std::vector<ScannedTrack_t> probed;
+    probed.reserve(batch.size());
+    for (const PendingFile_t& file : batch)
+    {
+        if (mCancel)
+        {
+            break;
+        }
+        ScannedTrack_t track;
+        track.modifiedTime = file.modifiedTime;
+        track.fileSize     = file.size;
+        try
+        {
+            track.path = file.path.string();
+        }
+        catch (const std::exception&)
+        {
+            // Not representable in the narrow encoding the playlist uses
+            continue;
+        }
+        if (probeFile(file.path, track))
+        {
+            probed.push_back(std::move(track));
+        }
+    }
+
+    // One lock per batch keeps contention with the UI thread's drain negligible
+    {
+        std::lock_guard<std::mutex> guard(mResultLock);
+        std::move(probed.begin(), probed.end(), std::back_inserter(mResults));
+    }
+    // Files skipped by a cancel still count as done so isRunning() settles
+    mFilesProbed += batch.size();
+}
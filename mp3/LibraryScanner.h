@@ -0,0 +1,89 @@
+#pragma once
+
+#include "ThreadPool.h"
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Player
+{
+
+	// Result of probing one file: enough to list it without decoding
+	struct ScannedTrack_t
+	{
+		std::string path;
+		std::string title;
+		std::string artist;
+		std::string album;
+		double      durationSeconds = 0.0;
+		uint32_t    bitrateKbps     = 0;
+		uint32_t    sampleRate      = 0;
+		int64_t     modifiedTime    = 0;  // file_time_type ticks, only compared for equality
+		uint64_t    fileSize        = 0;
+	};
+
+	/// @brief Recursive directory import. One thread walks the tree and hands batches of paths to a pool that
+	///        probes headers and tags in parallel; results are queued for the UI thread to drain at its own pace.
+	class LibraryScanner
+	{
+	public:
+		/// @param threadCount probe threads, 0 picks the hardware concurrency
+		explicit LibraryScanner(size_t threadCount = 0);
+		~LibraryScanner();
+
+		LibraryScanner(const LibraryScanner&)            = delete;
+		LibraryScanner& operator=(const LibraryScanner&) = delete;
+
+		/// @brief start scanning root in the background, returns false if a scan is already running
+		bool start(const std::filesystem::path& root);
+
+		/// @brief stop walking and probing, results already queued stay drainable
+		void cancel();
+
+		/// @brief true while files are being walked or probed
+		bool isRunning() const;
+
+		/// @brief move up to maxCount queued results to the end of out (never blocks on the scan)
+		size_t drainResults(std::vector<ScannedTrack_t>& out, size_t maxCount);
+
+		size_t getFilesFound() const { return mFilesFound.load(std::memory_order_relaxed); }
+		size_t getFilesProbed() const { return mFilesProbed.load(std::memory_order_relaxed); }
+
+		static bool isMp3Path(const std::filesystem::path& path);
+
+		/// @brief fill duration, bitrate and tags through TagReader, false if no audio frame was found
+		static bool probeFile(const std::filesystem::path& path, ScannedTrack_t& track);
+
+	private:
+		struct PendingFile_t
+		{
+			std::filesystem::path path;
+			uint64_t              size         = 0;
+			int64_t               modifiedTime = 0;
+		};
+
+		void walk(std::filesystem::path root);
+		void submitBatch(std::vector<PendingFile_t>& batch);
+		void probeBatch(const std::vector<PendingFile_t>& batch);
+
+		static constexpr size_t mBatchSize = 256;
+
+		std::unique_ptr<ThreadPool> mPool;
+		std::thread                 mWalker;
+		std::atomic<bool>           mCancel{false};
+		std::atomic<bool>           mWalking{false};
+		std::atomic<size_t>         mFilesFound{0};
+		std::atomic<size_t>         mFilesProbed{0};
+
+		std::mutex                  mResultLock;
+		std::vector<ScannedTrack_t> mResults;
+		size_t                      mResultHead = 0;
+	};
+
+}
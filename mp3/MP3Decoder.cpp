@@ -0,0 +1,390 @@
+#include "MP3Decoder.h"
+#include "BufferPool.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+extern "C"
+{
+#include <libavcodec/avcodec.h>
+#include <libavutil/frame.h>
+#include <libavutil/samplefmt.h>
+}
+
+namespace
+{
+    // Layer III bitrates (kbps) indexed by the 4-bit bitrate field
+    constexpr uint32_t BITRATES_MPEG1[16] = {0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 0};
+    constexpr uint32_t BITRATES_MPEG2[16] = {0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160, 0};
+
+    // Sample rates indexed by the 2-bit field, per version
+    constexpr uint32_t SAMPLE_RATES_MPEG1[3]  = {44100, 48000, 32000};
+    constexpr uint32_t SAMPLE_RATES_MPEG2[3]  = {22050, 24000, 16000};
+    constexpr uint32_t SAMPLE_RATES_MPEG25[3] = {11025, 12000, 8000};
+
+    // Largest main_data_begin back-reference allowed by the bit reservoir
+    constexpr size_t MAX_RESERVOIR_BYTES = 511;
+
+    int getChannelCount(const AVFrame* frame)
+    {
+#if LIBAVUTIL_VERSION_INT >= AV_VERSION_INT(57, 28, 100)
+        return frame->ch_layout.nb_channels;
+#else
+        return frame->channels;
+#endif
+    }
+
+    int16_t toPcm16(float value)
+    {
+        return static_cast<int16_t>(std::lrint(std::clamp(value * 32768.0F, -32768.0F, 32767.0F)));
+    }
+
+    int16_t readSample(const AVFrame* frame, int channel, int channels, int index)
+    {
+        switch (frame->format)
+        {
+            case AV_SAMPLE_FMT_FLTP:
+                return toPcm16(reinterpret_cast<const float*>(frame->extended_data[channel])[index]);
+            case AV_SAMPLE_FMT_FLT:
+                return toPcm16(reinterpret_cast<const float*>(frame->extended_data[0])[index * channels + channel]);
+            case AV_SAMPLE_FMT_S16P:
+                return reinterpret_cast<const int16_t*>(frame->extended_data[channel])[index];
+            case AV_SAMPLE_FMT_S16:
+                return reinterpret_cast<const int16_t*>(frame->extended_data[0])[index * channels + channel];
+            default:
+                return 0;
+        }
+    }
+
+    bool isVbrInfoFrame(const uint8_t* frame, const Player::MP3FrameHeader_t& header)
+    {
+        // Xing/Info sit right after the side info, VBRI at a fixed 32 bytes after the header
+        const size_t xingOffset = 4 + (header.hasCrc ? 2 : 0) + header.sideInfoBytes;
+        if (xingOffset + 4 <= header.frameBytes &&
+            (memcmp(frame + xingOffset, "Xing", 4) == 0 || memcmp(frame + xingOffset, "Info", 4) == 0))
+        {
+            return true;
+        }
+        return 36 + 4 <= header.frameBytes && memcmp(frame + 36, "VBRI", 4) == 0;
+    }
+
+    uint32_t readLe32(const uint8_t* data)
+    {
+        return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+               (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+    }
+}
+
+struct Player::MP3Decoder::Impl
+{
+    AVCodecContext*      context = nullptr;
+    AVPacket*            packet  = nullptr;
+    AVFrame*             frame   = nullptr;
+    std::vector<int16_t> scratch;
+};
+
+Player::MP3Decoder::MP3Decoder()
+    : mImpl(std::make_unique<Impl>())
+{
+    // Prefer the floating point decoder: the fixed point one carries a rounding remainder across frames,
+    // which would make range decodes differ from a whole-stream decode in the last bit.
+    const AVCodec* codec = avcodec_find_decoder_by_name("mp3float");
+    if (codec == nullptr)
+    {
+        codec = avcodec_find_decoder(AV_CODEC_ID_MP3);
+    }
+    if (codec == nullptr)
+    {
+        return;
+    }
+
+    mImpl->context = avcodec_alloc_context3(codec);
+    mImpl->packet  = av_packet_alloc();
+    mImpl->frame   = av_frame_alloc();
+    if (!mImpl->context || !mImpl->packet || !mImpl->frame || avcodec_open2(mImpl->context, codec, nullptr) < 0)
+    {
+        avcodec_free_context(&mImpl->context);
+    }
+}
+
+Player::MP3Decoder::~MP3Decoder()
+{
+    avcodec_free_context(&mImpl->context);
+    av_packet_free(&mImpl->packet);
+    av_frame_free(&mImpl->frame);
+}
+
+bool Player::MP3Decoder::isValid() const
+{
+    return mImpl->context != nullptr;
+}
+
+void Player::MP3Decoder::reset()
+{
+    if (mImpl->context)
+    {
+        avcodec_flush_buffers(mImpl->context);
+    }
+}
+
+bool Player::MP3Decoder::decodeFrame(const uint8_t*            frame,
+                                     size_t                    size,
+                                     const MP3FrameHeader_t&   format,
+                                     std::vector<int16_t>&     out)
+{
+    const size_t base = out.size();
+    out.resize(base + static_cast<size_t>(format.samplesPerFrame) * format.channels);
+    return decodeFrame(frame, size, format, out.data() + base);
+}
+
+bool Player::MP3Decoder::decodeFrame(const uint8_t* frame, size_t size, const MP3FrameHeader_t& format, int16_t* out)
+{
+    const size_t channels = format.channels;
+    const size_t expected = static_cast<size_t>(format.samplesPerFrame) * channels;
+    if (!isValid())
+    {
+        std::fill(out, out + expected, static_cast<int16_t>(0));
+        return false;
+    }
+
+    // Packets without a buffer reference are copied (and padded) by libavcodec
+    AVPacket* packet = mImpl->packet;
+    packet->data     = const_cast<uint8_t*>(frame);
+    packet->size     = static_cast<int>(size);
+    const int sent   = avcodec_send_packet(mImpl->context, packet);
+    packet->data     = nullptr;
+    packet->size     = 0;
+
+    size_t written = 0;
+    if (sent >= 0)
+    {
+        AVFrame* decoded = mImpl->frame;
+        while (avcodec_receive_frame(mImpl->context, decoded) == 0)
+        {
+            const int decodedChannels = getChannelCount(decoded);
+            const size_t remaining    = (expected - written) / channels;
+            const int    available    = static_cast<int>(std::min<size_t>(decoded->nb_samples, remaining));
+            int16_t*  dst             = out + written;
+            for (int index = 0; index < available && decodedChannels > 0; ++index)
+            {
+                for (size_t channel = 0; channel < channels; ++channel)
+                {
+                    // Mono sources are duplicated, extra source channels beyond the output layout are dropped
+                    const int source = std::min(static_cast<int>(channel), decodedChannels - 1);
+                    *dst++           = readSample(decoded, source, decodedChannels, index);
+                }
+            }
+            written += static_cast<size_t>(available) * channels;
+            av_frame_unref(decoded);
+        }
+    }
+    std::fill(out + written, out + expected, static_cast<int16_t>(0));
+    return sent >= 0 && written == expected;
+}
+
+bool Player::MP3Decoder::decodeRange(const MP3Stream_t& stream, size_t first, size_t count, std::vector<int16_t>& out)
+{
+    if (first > stream.frames.size())
+    {
+        return false;
+    }
+    count             = std::min(count, stream.frames.size() - first);
+    const size_t base = out.size();
+    out.resize(base + count * stream.format.samplesPerFrame * stream.format.channels);
+    return decodeRange(stream, first, count, out.data() + base);
+}
+
+bool Player::MP3Decoder::decodeRange(const MP3Stream_t& stream, size_t first, size_t count, int16_t* out)
+{
+    MP3_PROFILE_SCOPE("decode.range");
+    if (first > stream.frames.size())
+    {
+        return false;
+    }
+    count = std::min(count, stream.frames.size() - first);
+
+    reset();
+    const size_t priming = getPrimingFrames(stream, first);
+    mImpl->scratch.resize(static_cast<size_t>(stream.format.samplesPerFrame) * stream.format.channels);
+    for (size_t index = first - priming; index < first; ++index)
+    {
+        const MP3Frame_t& frame = stream.frames[index];
+        decodeFrame(stream.data + frame.offset, frame.size, stream.format, mImpl->scratch.data());
+    }
+
+    const size_t frameValues = mImpl->scratch.size();
+    bool         complete    = true;
+    for (size_t index = first; index < first + count; ++index)
+    {
+        const MP3Frame_t& frame = stream.frames[index];
+        complete &= decodeFrame(stream.data + frame.offset, frame.size, stream.format, out);
+        out += frameValues;
+    }
+    return complete;
+}
+
+bool Player::MP3Decoder::parseFrameHeader(const uint8_t* data, size_t size, MP3FrameHeader_t& header)
+{
+    if (size < 4 || data[0] != 0xFF || (data[1] & 0xE0) != 0xE0)
+    {
+        return false;
+    }
+
+    const uint32_t versionBits = (data[1] >> 3) & 0x03;
+    const uint32_t layerBits   = (data[1] >> 1) & 0x03;
+    const uint32_t bitrateBits = (data[2] >> 4) & 0x0F;
+    const uint32_t rateBits    = (data[2] >> 2) & 0x03;
+    const uint32_t padding     = (data[2] >> 1) & 0x01;
+    const uint32_t channelMode = (data[3] >> 6) & 0x03;
+
+    // Layer III only, no reserved version/rate, no free-format or invalid bitrate
+    if (versionBits == 1 || layerBits != 1 || bitrateBits == 0 || bitrateBits == 15 || rateBits == 3)
+    {
+        return false;
+    }
+
+    const bool isMpeg1 = versionBits == 3;
+    header.version     = isMpeg1 ? 10 : (versionBits == 2 ? 20 : 25);
+    header.bitrateKbps = isMpeg1 ? BITRATES_MPEG1[bitrateBits] : BITRATES_MPEG2[bitrateBits];
+    header.sampleRate  = isMpeg1 ? SAMPLE_RATES_MPEG1[rateBits]
+                                 : (versionBits == 2 ? SAMPLE_RATES_MPEG2[rateBits] : SAMPLE_RATES_MPEG25[rateBits]);
+    header.channels        = (channelMode == 3) ? 1 : 2;
+    header.samplesPerFrame = isMpeg1 ? 1152 : 576;
+    header.frameBytes      = (isMpeg1 ? 144000 : 72000) * header.bitrateKbps / header.sampleRate + padding;
+    header.sideInfoBytes   = isMpeg1 ? (header.channels == 1 ? 17 : 32) : (header.channels == 1 ? 9 : 17);
+    header.hasCrc          = (data[1] & 0x01) == 0;
+    return true;
+}
+
+size_t Player::MP3Decoder::getId3v2Size(const uint8_t* data, size_t size)
+{
+    if (size < 10 || memcmp(data, "ID3", 3) != 0)
+    {
+        return 0;
+    }
+    // Sizes are "syncsafe": 7 bits per byte
+    if ((data[6] | data[7] | data[8] | data[9]) & 0x80)
+    {
+        return 0;
+    }
+    const size_t tagSize = (static_cast<size_t>(data[6]) << 21) | (static_cast<size_t>(data[7]) << 14) |
+                           (static_cast<size_t>(data[8]) << 7) | static_cast<size_t>(data[9]);
+    const size_t footer  = (data[5] & 0x10) ? 10 : 0;
+    return 10 + tagSize + footer;
+}
+
+bool Player::MP3Decoder::scanFrames(const uint8_t* data, size_t size, MP3Stream_t& stream)
+{
+    MP3_PROFILE_SCOPE("decode.scan");
+    stream        = MP3Stream_t{};
+    stream.data   = data;
+    stream.size   = size;
+    if (data == nullptr || size < 4)
+    {
+        return false;
+    }
+
+    // Leading ID3v2 tags (there may be more than one)
+    size_t position = 0;
+    while (size_t tagSize = getId3v2Size(data + position, size - position))
+    {
+        position = std::min(size, position + tagSize);
+    }
+
+    // Trailing ID3v1 and APEv2 tags are not audio
+    size_t end = size;
+    if (end - position >= 128 && memcmp(data + end - 128, "TAG", 3) == 0)
+    {
+        end -= 128;
+    }
+    if (end - position >= 32 && memcmp(data + end - 32, "APETAGEX", 8) == 0)
+    {
+        const size_t tagSize   = readLe32(data + end - 32 + 12);
+        const bool   hasHeader = (readLe32(data + end - 32 + 20) & 0x80000000U) != 0;
+        const size_t total     = tagSize + (hasHeader ? 32 : 0);
+        end                    = (total <= end - position) ? end - total : end;
+    }
+
+    bool haveFormat = false;
+    while (position + 4 <= end)
+    {
+        MP3FrameHeader_t header;
+        if (data[position] == 0xFF && parseFrameHeader(data + position, end - position, header) &&
+            position + header.frameBytes <= end)
+        {
+            // Reject false syncs: the frame must match the stream and be followed by another header or the end
+            const bool consistent =
+                !haveFormat || (header.version == stream.format.version && header.sampleRate == stream.format.sampleRate);
+            const size_t     next = position + header.frameBytes;
+            MP3FrameHeader_t nextHeader;
+            const bool       chained = (end - next < 4) || parseFrameHeader(data + next, end - next, nextHeader);
+            if (consistent && chained)
+            {
+                if (!haveFormat)
+                {
+                    stream.format = header;
+                    haveFormat    = true;
+                    if (isVbrInfoFrame(data + position, header))
+                    {
+                        // The Xing/Info/VBRI frame carries no audio
+                        position = next;
+                        continue;
+                    }
+                }
+                stream.frames.push_back({static_cast<uint32_t>(position), header.frameBytes});
+                position = next;
+                continue;
+            }
+        }
+        ++position;
+    }
+    return !stream.frames.empty();
+}
+
+size_t Player::MP3Decoder::getPrimingFrames(const MP3Stream_t& stream, size_t first)
+{
+    // The frame before the range must itself decode correctly (its overlap and filter history feed the first
+    // frame), so cover two full reservoir spans plus a couple of frames of margin.
+    size_t priming = 0;
+    size_t bytes   = 0;
+    while (priming < first && (bytes < 2 * MAX_RESERVOIR_BYTES || priming < 3))
+    {
+        bytes += stream.frames[first - 1 - priming].size;
+        ++priming;
+    }
+    return std::min(first, priming + 1);
+}
+
+bool Player::MP3Decoder::decode(const uint8_t* data, size_t size, DecodedAudio_t& out)
+{
+    MP3_PROFILE_SCOPE("decode.frames");
+    MP3Stream_t stream;
+    if (!scanFrames(data, size, stream))
+    {
+        return false;
+    }
+
+    MP3Decoder decoder;
+    if (!decoder.isValid())
+    {
+        return false;
+    }
+
+    // Reuses the PCM buffer of an earlier track when one of the right size class is idle
+    const size_t sampleCount = stream.getSampleFrameCount() * stream.format.channels;
+    PcmBufferPool::getShared().release(std::move(out.samples));
+    out.samples    = PcmBufferPool::getShared().acquire(sampleCount);
+    out.sampleRate = stream.format.sampleRate;
+    out.channels   = stream.format.channels;
+    out.samples.resize(sampleCount);
+    int16_t*     target      = out.samples.data();
+    const size_t frameValues = static_cast<size_t>(stream.format.samplesPerFrame) * stream.format.channels;
+    for (const MP3Frame_t& frame : stream.frames)
+    {
+        decoder.decodeFrame(data + frame.offset, frame.size, stream.format, target);
+        target += frameValues;
+    }
+    return true;
+}
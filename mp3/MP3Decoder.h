@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Player
+{
+
+	// Fields of a single MPEG audio Layer III frame header
+	struct MP3FrameHeader_t
+	{
+		uint32_t version         = 0;  // 10 = MPEG1, 20 = MPEG2, 25 = MPEG2.5
+		uint32_t bitrateKbps     = 0;
+		uint32_t sampleRate      = 0;
+		uint16_t channels        = 0;
+		uint32_t frameBytes      = 0;
+		uint32_t samplesPerFrame = 0;
+		uint32_t sideInfoBytes   = 0;
+		bool     hasCrc          = false;
+	};
+
+	// Location of one frame inside the compressed buffer
+	struct MP3Frame_t
+	{
+		uint32_t offset = 0;
+		uint32_t size   = 0;
+	};
+
+	// Frame index of an in-memory MP3 stream. The data is not owned.
+	struct MP3Stream_t
+	{
+		const uint8_t*          data = nullptr;
+		size_t                  size = 0;
+		MP3FrameHeader_t        format;
+		std::vector<MP3Frame_t> frames;
+
+		size_t getSampleFrameCount() const { return frames.size() * format.samplesPerFrame; }
+		double getDurationSeconds() const
+		{
+			return format.sampleRate ? static_cast<double>(getSampleFrameCount()) / format.sampleRate : 0.0;
+		}
+	};
+
+	// Interleaved 16-bit PCM
+	struct DecodedAudio_t
+	{
+		std::vector<int16_t> samples;
+		uint32_t             sampleRate = 0;
+		uint16_t             channels   = 0;
+
+		size_t getFrameCount() const { return channels ? samples.size() / channels : 0; }
+		double getDurationSeconds() const
+		{
+			return sampleRate ? static_cast<double>(getFrameCount()) / sampleRate : 0.0;
+		}
+	};
+
+	/// @brief MPEG Layer III decoder shared by the player, the benchmarks and the command line tools.
+	///        Frames are located by a native header scanner and decoded one by one with libavcodec, so every
+	///        compressed frame maps to exactly samplesPerFrame output frames. That fixed mapping is what allows
+	///        seeking and decoding arbitrary frame ranges that line up with a whole-stream decode.
+	class MP3Decoder
+	{
+	public:
+		MP3Decoder();
+		~MP3Decoder();
+
+		MP3Decoder(const MP3Decoder&)            = delete;
+		MP3Decoder& operator=(const MP3Decoder&) = delete;
+
+		bool isValid() const;
+
+		/// @brief drop all decoder state (bit reservoir, overlap buffers)
+		void reset();
+
+		/// @brief decode one frame and append samplesPerFrame * channels interleaved samples to out.
+		///        Frames the codec rejects (e.g. missing bit reservoir after a seek) are appended as silence.
+		bool decodeFrame(const uint8_t* frame, size_t size, const MP3FrameHeader_t& format, std::vector<int16_t>& out);
+
+		/// @brief same, writing exactly samplesPerFrame * channels samples to out
+		bool decodeFrame(const uint8_t* frame, size_t size, const MP3FrameHeader_t& format, int16_t* out);
+
+		/// @brief decode frames [first, first + count) of an indexed stream. Enough preceding frames are decoded
+		///        and discarded first that the output is bit-identical to the same range of a whole-stream decode.
+		bool decodeRange(const MP3Stream_t& stream, size_t first, size_t count, std::vector<int16_t>& out);
+
+		/// @brief same, writing count * samplesPerFrame * channels samples to out (clamped to the stream end)
+		bool decodeRange(const MP3Stream_t& stream, size_t first, size_t count, int16_t* out);
+
+		/// @brief parse a 4-byte frame header, returns false for anything that is not a valid Layer III header
+		static bool parseFrameHeader(const uint8_t* data, size_t size, MP3FrameHeader_t& header);
+
+		/// @brief size in bytes of a leading ID3v2 tag (0 if there is none), as declared by its header
+		static size_t getId3v2Size(const uint8_t* data, size_t size);
+
+		/// @brief index every frame of the buffer, skipping ID3v2/ID3v1/APE tags and junk between frames
+		static bool scanFrames(const uint8_t* data, size_t size, MP3Stream_t& stream);
+
+		/// @brief number of frames decoded and discarded ahead of a range so the bit reservoir and the
+		///        synthesis filter state match a decode that started at the beginning of the stream
+		static size_t getPrimingFrames(const MP3Stream_t& stream, size_t first);
+
+		/// @brief decode a whole in-memory MP3 into interleaved 16-bit PCM
+		static bool decode(const uint8_t* data, size_t size, DecodedAudio_t& out);
+
+	private:
+		struct Impl;
+		std::unique_ptr<Impl> mImpl;
+	};
+
+}
@@ -4,13 +4,23 @@
 #include <assert.h>
 #include <string>
 #include <vector>
+#include <array>
+#include <atomic>
+#include <thread>
 #include <algorithm>
+#include <cstdlib>
 #include <mmreg.h>
-#include <msacm.h>
-#include <wmsdk.h>
 
-#pragma comment(lib, "msacm32.lib") 
-#pragma comment(lib, "wmvcore.lib") 
+#include "BufferPool.h"
+#include "LevelMeter.h"
+#include "MP3Decoder.h"
+#include "ParallelDecoder.h"
+#include "PcmAnalysis.h"
+#include "PlaybackClock.h"
+#include "PlayerCore.h"
+#include "Profiler.h"
+#include "TagReader.h"
+
 #pragma comment(lib, "winmm.lib") 
 #pragma intrinsic(memset,memcpy,memcmp)
 
@@ -22,90 +32,167 @@
 
 /// @brief       This is a MP3Player class: play, stop, pause, rewind and fwd music
 ///              Initally written by Alexandre Mutel and modifed by Rajiv Sit
-class MP3Player
+class MP3Player : public Player::PlayerOutput
 {
 public:
-	struct Metadata
+	// Tags and stream info of the open file, text in UTF-8
+	using Metadata = Player::TrackTags_t;
+
+private:
+	// Output runs as SINK_BLOCK_COUNT blocks of SINK_BLOCK_FRAMES (~46 ms at 44.1 kHz) cycling through waveOut
+	static constexpr DWORD  SINK_BLOCK_FRAMES = 2048;
+	static constexpr size_t SINK_BLOCK_COUNT  = 4;
+
+	struct SinkBlock_t
 	{
-		std::wstring title;
-		std::wstring artist;
-		std::wstring album;
-		DWORD        bitrate = 0;
+		WAVEHDR              header{};
+		std::vector<int16_t> samples;
 	};
 
-private:
 	/// declaring variables
 	HWAVEOUT     mHandleWaveOut = nullptr;
 	DWORD        mBufferLength  = 0;
 	double       mDurationInSecond = 0.0;
 	double       mStartOffsetSeconds = 0.0;
 	BYTE*        mSoundBuffer = nullptr;
-	WAVEHDR      mWaveHeader{};
 	WAVEFORMATEX mPcmFormat{};
-	bool         mHeaderPrepared = false;
 	bool         mIsOpen = false;
 	bool         mIsPlaying = false;
 	bool         mIsPaused = false;
 	Metadata     mMetadata;
+	Player::DecodedAudio_t mDecoded;
 	std::vector<float> mEqGainsDb;
 
-	/// helper to clear playback state
-	void resetWaveOut()
+	std::array<SinkBlock_t, SINK_BLOCK_COUNT> mSinkBlocks;
+	std::thread           mSinkThread;
+	HANDLE                mSinkEvent = nullptr;  // auto-reset, signalled for every finished block
+	std::atomic<bool>     mSinkStop{false};
+	std::atomic<bool>     mPlayedOut{false};     // set by the sink thread once the device returned the last block
+	size_t                mSinkNextFrame = 0;    // next PCM frame to queue, sink thread only
+	Player::PlaybackClock mClock;
+	Player::LevelMeter    mLevelMeter;           // written by the sink thread, read by the UI
+
+	/// waveOut callback: runs on a driver thread where waveOut functions must not be called, so it only
+	/// advances the clock and wakes the sink thread
+	static void CALLBACK waveOutProc(HWAVEOUT, UINT message, DWORD_PTR instance, DWORD_PTR param1, DWORD_PTR)
 	{
-		if (mHandleWaveOut)
+		if (message != WOM_DONE)
 		{
-			waveOutReset(mHandleWaveOut);
-			if (mHeaderPrepared)
-			{
-				waveOutUnprepareHeader(mHandleWaveOut, &mWaveHeader, sizeof(mWaveHeader));
-				mHeaderPrepared = false;
-			}
-			waveOutClose(mHandleWaveOut);
-			mHandleWaveOut = nullptr;
+			return;
 		}
-		mIsPlaying = false;
-		mIsPaused  = false;
+		MP3Player*     self   = reinterpret_cast<MP3Player*>(instance);
+		const WAVEHDR* header = reinterpret_cast<const WAVEHDR*>(param1);
+		self->mClock.onFramesConsumed(header->dwBufferLength / self->mPcmFormat.nBlockAlign);
+		SetEvent(self->mSinkEvent);
 	}
 
-	static std::wstring readHeaderString(IWMHeaderInfo* info, const WCHAR* key)
+	/// copy the next block of PCM and queue it, false once the track is exhausted
+	bool writeSinkBlock(SinkBlock_t& block)
 	{
-		WORD             streamNum    = 0;
-		WMT_ATTR_DATATYPE attrType    = WMT_TYPE_STRING;
-		WORD             length       = 0;
-		if (FAILED(info->GetAttributeByName(&streamNum, key, &attrType, nullptr, &length)) || length == 0)
+		const size_t totalFrames = mDecoded.getFrameCount();
+		if (mSinkNextFrame >= totalFrames)
 		{
-			return L"";
+			return false;
 		}
+		MP3_PROFILE_SCOPE("sink.write");
+		const size_t channels = mDecoded.channels;
+		const size_t frames   = (std::min)(static_cast<size_t>(SINK_BLOCK_FRAMES), totalFrames - mSinkNextFrame);
+		std::copy_n(mDecoded.samples.data() + mSinkNextFrame * channels, frames * channels, block.samples.data());
+		// The last block is padded with silence; the headers stay prepared with a fixed length
+		std::fill(block.samples.begin() + frames * channels, block.samples.end(), static_cast<int16_t>(0));
+		mLevelMeter.process(block.samples.data(), frames, mDecoded.channels, mSinkNextFrame);
+		mSinkNextFrame += frames;
+
+		block.header.dwFlags &= ~WHDR_DONE;
+		waveOutWrite(mHandleWaveOut, &block.header, sizeof(WAVEHDR));
+		return true;
+	}
 
-		std::vector<WCHAR> buffer(length / sizeof(WCHAR) + 1, 0);
-		if (FAILED(info->GetAttributeByName(&streamNum, key, &attrType, reinterpret_cast<BYTE*>(buffer.data()), &length)))
+	/// audio thread: refill every block the device has returned until the track ends or stop is requested
+	void sinkLoop()
+	{
+		Player::Profiler::setThreadName("audio sink");
+		for (;;)
 		{
-			return L"";
+			bool queued = false;
+			for (SinkBlock_t& block : mSinkBlocks)
+			{
+				if ((block.header.dwFlags & WHDR_DONE) && !mSinkStop)
+				{
+					writeSinkBlock(block);
+				}
+				queued |= (block.header.dwFlags & WHDR_DONE) == 0;
+			}
+
+			// Device position against the consumed count gives the output latency the clock subtracts
+			MMTIME time = {TIME_SAMPLES, 0};
+			if (waveOutGetPosition(mHandleWaveOut, &time, sizeof(time)) == MMSYSERR_NOERROR && time.wType == TIME_SAMPLES)
+			{
+				mClock.onDevicePosition(time.u.sample);
+			}
+
+			if (!queued || mSinkStop)
+			{
+				// Nothing left in the device and nothing more to write: the track has played to its end
+				if (!queued && !mSinkStop)
+				{
+					mPlayedOut.store(true, std::memory_order_release);
+				}
+				break;
+			}
+			WaitForSingleObject(mSinkEvent, INFINITE);
+			if (mSinkStop)
+			{
+				break;
+			}
 		}
-		return std::wstring(buffer.data());
 	}
 
-	static DWORD readHeaderDword(IWMHeaderInfo* info, const WCHAR* key)
+	/// helper to clear playback state
+	void resetWaveOut()
 	{
-		WORD             streamNum    = 0;
-		WMT_ATTR_DATATYPE attrType    = WMT_TYPE_DWORD;
-		WORD             length       = sizeof(DWORD);
-		DWORD            value        = 0;
-		if (FAILED(info->GetAttributeByName(&streamNum, key, &attrType, reinterpret_cast<BYTE*>(&value), &length)))
+		if (mSinkThread.joinable())
 		{
-			return 0;
+			mSinkStop = true;
+			SetEvent(mSinkEvent);
+			mSinkThread.join();
 		}
-		return value;
+		if (mHandleWaveOut)
+		{
+			waveOutReset(mHandleWaveOut);
+			for (SinkBlock_t& block : mSinkBlocks)
+			{
+				if (block.header.dwFlags & WHDR_PREPARED)
+				{
+					waveOutUnprepareHeader(mHandleWaveOut, &block.header, sizeof(WAVEHDR));
+				}
+				block.header = {};
+			}
+			waveOutClose(mHandleWaveOut);
+			mHandleWaveOut = nullptr;
+		}
+		mClock.stop();
+		mPlayedOut = false;
+		mIsPlaying = false;
+		mIsPaused  = false;
 	}
 
 public:
 	MP3Player()  = default;
-	~MP3Player() { close(); }
+	~MP3Player()
+	{
+		close();
+		if (mSinkEvent)
+		{
+			CloseHandle(mSinkEvent);
+		}
+	}
 
 	/// @brief       loads a MP3 file (UTF-16 path) and convert it internally to a PCM format, ready for sound playback.
 	HRESULT openFromFile(const wchar_t* inputFileName)
 	{
 		close();
+		MP3_PROFILE_SCOPE("file.open");
 
 		// Open the mp3 file
 		HANDLE hFile = CreateFileW(inputFileName,
@@ -128,32 +215,29 @@ public:
 			return HRESULT_FROM_WIN32(GetLastError());
 		}
 
-		// Alloc buffer for file
-		BYTE* mp3Buffer = (BYTE*)LocalAlloc(LPTR, fileSize);
-		if (!mp3Buffer)
-		{
-			CloseHandle(hFile);
-			return E_OUTOFMEMORY;
-		}
+		// Buffer for the file, recycled across opens
+		std::vector<uint8_t> mp3Buffer = Player::ByteBufferPool::getShared().acquire(fileSize);
+		mp3Buffer.resize(fileSize);
 
 		// Read file and fill mp3Buffer
 		DWORD bytesRead;
-		DWORD resultReadFile = ReadFile(hFile, mp3Buffer, fileSize, &bytesRead, NULL);
+		DWORD resultReadFile = ReadFile(hFile, mp3Buffer.data(), fileSize, &bytesRead, NULL);
 		if (resultReadFile == 0 || bytesRead != fileSize)
 		{
+			const HRESULT error = HRESULT_FROM_WIN32(GetLastError());
 			CloseHandle(hFile);
-			LocalFree(mp3Buffer);
-			return HRESULT_FROM_WIN32(GetLastError());
+			Player::ByteBufferPool::getShared().release(std::move(mp3Buffer));
+			return error;
 		}
 
 		// Close File
 		CloseHandle(hFile);
 
 		// Open and convert MP3
-		HRESULT hr = openFromMemory(mp3Buffer, fileSize);
+		HRESULT hr = openFromMemory(mp3Buffer.data(), fileSize);
 
-		// Free mp3Buffer
-		LocalFree(mp3Buffer);
+		// Return mp3Buffer to the pool
+		Player::ByteBufferPool::getShared().release(std::move(mp3Buffer));
 
 		return hr;
 	}
@@ -185,207 +269,54 @@ public:
 	/// @param [in]  size of the mp3 inpput buffer
 	/// @param [out] handle results
 	HRESULT openFromMemory(BYTE* mp3InputBuffer, DWORD mp3InputBufferSize) {
-		IWMSyncReader* wmSyncReader;
-		IWMHeaderInfo* wmHeaderInfo;
-		IWMProfile* wmProfile;
-		IWMStreamConfig* wmStreamConfig;
-		IWMMediaProps* wmMediaProperties;
-		WORD wmStreamNum = 0;
-		WMT_ATTR_DATATYPE wmAttrDataType;
-		DWORD durationInSecondInt;
-		QWORD durationInNano;
-		DWORD sizeMediaType;
-		DWORD maxFormatSize = 0;
-		HACMSTREAM acmMp3stream = NULL;
-		HGLOBAL mp3HGlobal;
-		IStream* mp3Stream;
-
-		// Define output format
-		mPcmFormat = {
-		 WAVE_FORMAT_PCM, //format type
-		 2,               // number of channels (i.e. mono, stereo...)
-		 44100,           // sample rate
-		 4 * 44100,       // for buffer estimation 
-		 4,               // block size of data
-		 16,              // number of bits per sample of mono data 
-		 0,               // the count in bytes of the size of 
-		};
-
-		const DWORD MP3_BLOCK_SIZE = 522;
-
-		// Define input format
-		static MPEGLAYER3WAVEFORMAT mp3Format = {
-		 {
-		  WAVE_FORMAT_MPEGLAYER3,       // format type 
-		   2,                           // number of channels (i.e. mono, stereo...) 
-		   44100,                       // sample rate 
-		   128 * (1024 / 8),            // average bytes per sec not really used but must be one of 64, 96, 112, 128, 160kbps
-		   1,                           // block size of data 
-		   0,                           // number of bits per sample of mono data 
-		   MPEGLAYER3_WFX_EXTRA_BYTES,  // cbSize       
-		 },
-		 MPEGLAYER3_ID_MPEG,            // wID
-		 MPEGLAYER3_FLAG_PADDING_OFF,   //fdwFlags
-		 MP3_BLOCK_SIZE,                // nBlockSize
-		 1,                             // nFramesPerBlock
-		 1393,                          // nCodecDelay;
-		};
-
-		// -----------------------------------------------------------------------------------
-		// Extract and verify mp3 info : duration, type = mp3, sampleRate = 44100, channels = 2
-		// -----------------------------------------------------------------------------------
-
-		// Initialize COM
-		CoInitialize(0);
-
-		// Create SyncReader
-		mp3Assert(WMCreateSyncReader(NULL, WMT_RIGHT_PLAYBACK, &wmSyncReader));
-
-		// Alloc With global and create IStream
-		mp3HGlobal = GlobalAlloc(GPTR, mp3InputBufferSize);
-		assert(mp3HGlobal != 0);
-		void* mp3HGlobalBuffer = GlobalLock(mp3HGlobal);
-		memcpy(mp3HGlobalBuffer, mp3InputBuffer, mp3InputBufferSize);
-		GlobalUnlock(mp3HGlobal);
-		mp3Assert(CreateStreamOnHGlobal(mp3HGlobal, FALSE, &mp3Stream));
-
-		// Open MP3 Stream
-		mp3Assert(wmSyncReader->OpenStream(mp3Stream));
+		MP3_PROFILE_SCOPE("decode");
 
-		// Get HeaderInfo interface
-		mp3Assert(wmSyncReader->QueryInterface(&wmHeaderInfo));
-
-		// Retrieve mp3 song duration in seconds
-		WORD lengthDataType = sizeof(QWORD);
-		mp3Assert(wmHeaderInfo->GetAttributeByName(&wmStreamNum, L"Duration", &wmAttrDataType, (BYTE*)&durationInNano, &lengthDataType));
-		mDurationInSecond = ((double)durationInNano) / 10000000.0;
-		durationInSecondInt = (int)(durationInNano / 10000000) + 1;
-
-		// Sequence of call to get the MediaType
-		// WAVEFORMATEX for mp3 can then be extract from MediaType
-		mp3Assert(wmSyncReader->QueryInterface(&wmProfile));
-		mp3Assert(wmProfile->GetStream(0, &wmStreamConfig));
-		mp3Assert(wmStreamConfig->QueryInterface(&wmMediaProperties));
-
-		// Retrieve sizeof MediaType
-		mp3Assert(wmMediaProperties->GetMediaType(NULL, &sizeMediaType));
-
-		// Retrieve MediaType
-		WM_MEDIA_TYPE* mediaType = (WM_MEDIA_TYPE*)LocalAlloc(LPTR, sizeMediaType);
-		mp3Assert(wmMediaProperties->GetMediaType(mediaType, &sizeMediaType));
-
-		// Check that MediaType is audio
-		assert(mediaType->majortype == WMMEDIATYPE_Audio);
-
-		// Check that input is mp3
-		WAVEFORMATEX* inputFormat = (WAVEFORMATEX*)mediaType->pbFormat;
-		assert(inputFormat->wFormatTag == WAVE_FORMAT_MPEGLAYER3);
-		assert(inputFormat->nSamplesPerSec == 44100);
-		assert(inputFormat->nChannels == 2);
-
-		// Capture metadata (optional fields)
-		mMetadata.title  = readHeaderString(wmHeaderInfo, L"Title");
-		mMetadata.artist = readHeaderString(wmHeaderInfo, L"Author");
-		mMetadata.album  = readHeaderString(wmHeaderInfo, L"WM/AlbumTitle");
-		mMetadata.bitrate = readHeaderDword(wmHeaderInfo, L"Bitrate");
-
-		// Release COM interface
-		wmMediaProperties->Release();
-		wmStreamConfig->Release();
-		wmProfile->Release();
-		wmHeaderInfo->Release();
-		wmSyncReader->Release();
-
-		// Free allocated mem
-		LocalFree(mediaType);
-
-		// -----------------------------------------------------------------------------------
-		// Convert mp3 to pcm using acm driver
-		// The following code is mainly inspired from http://david.weekly.org/code/mp3acm.html
-		// -----------------------------------------------------------------------------------
-
-		// Get maximum FormatSize for all acm
-		mp3Assert(acmMetrics(NULL, ACM_METRIC_MAX_SIZE_FORMAT, &maxFormatSize));
-
-		// Allocate PCM output sound buffer
-		mBufferLength = mDurationInSecond * mPcmFormat.nAvgBytesPerSec;
-		mSoundBuffer = (BYTE*)LocalAlloc(LPTR, mBufferLength);
-
-		acmMp3stream = NULL;
-		switch (acmStreamOpen(&acmMp3stream,    // Open an ACM conversion stream
-			NULL,                       // Query all ACM drivers
-			(LPWAVEFORMATEX)&mp3Format, // input format :  mp3
-			&mPcmFormat,                // output format : pcm
-			NULL,                       // No filters
-			0,                          // No async callback
-			0,                          // No data for callback
-			0                           // No flags
-		)
-			) {
-		case MMSYSERR_NOERROR:
-			break; // success!
-		case MMSYSERR_INVALPARAM:
-			assert(!"Invalid parameters passed to acmStreamOpen");
-			return E_FAIL;
-		case ACMERR_NOTPOSSIBLE:
-			assert(!"No ACM filter found capable of decoding MP3");
-			return E_FAIL;
-		default:
-			assert(!"Some error opening ACM decoding stream!");
+		// Convert mp3 to pcm with the shared decoder core (native frame scan + libavcodec), chunks decoded in parallel
+		Player::DecodedAudio_t decoded;
+		if (!Player::ParallelDecoder::getShared().decode(mp3InputBuffer, mp3InputBufferSize, decoded))
+		{
 			return E_FAIL;
 		}
 
-		// Determine output decompressed buffer size
-		unsigned long rawbufsize = 0;
-		mp3Assert(acmStreamSize(acmMp3stream, MP3_BLOCK_SIZE, &rawbufsize, ACM_STREAMSIZEF_SOURCE));
-		assert(rawbufsize > 0);
-
-		// allocate our I/O buffers
-		static BYTE mp3BlockBuffer[MP3_BLOCK_SIZE];
-		LPBYTE rawbuf = (LPBYTE)LocalAlloc(LPTR, rawbufsize);
-
-		// prepare the decoder
-		static ACMSTREAMHEADER mp3streamHead;
-		mp3streamHead.cbStruct = sizeof(ACMSTREAMHEADER);
-		mp3streamHead.pbSrc = mp3BlockBuffer;
-		mp3streamHead.cbSrcLength = MP3_BLOCK_SIZE;
-		mp3streamHead.pbDst = rawbuf;
-		mp3streamHead.cbDstLength = rawbufsize;
-		mp3Assert(acmStreamPrepareHeader(acmMp3stream, &mp3streamHead, 0));
-
-		BYTE* currentOutput = mSoundBuffer;
-		DWORD totalDecompressedSize = 0;
-
-		static ULARGE_INTEGER newPosition;
-		static LARGE_INTEGER seekValue;
-		mp3Assert(mp3Stream->Seek(seekValue, STREAM_SEEK_SET, &newPosition));
-
-		while (1) {
-			// suck in some MP3 data
-			ULONG count;
-			mp3Assert(mp3Stream->Read(mp3BlockBuffer, MP3_BLOCK_SIZE, &count));
-			if (count != MP3_BLOCK_SIZE)
-				break;
+		// Capture metadata (optional fields)
+		Metadata metadata;
+		{
+			MP3_PROFILE_SCOPE("decode.header");
+			Player::TagReader::parseBuffer(mp3InputBuffer, mp3InputBufferSize, metadata);
+		}
+		return openDecoded(std::move(decoded), std::move(metadata));
+	}
 
-			// convert the data
-			mp3Assert(acmStreamConvert(acmMp3stream, &mp3streamHead, ACM_STREAMCONVERTF_BLOCKALIGN));
+	/// @brief       take over PCM decoded elsewhere (e.g. by Player::TrackLoader on a worker thread)
+	///
+	/// @param [in]  interleaved 16-bit PCM, moved into the player
+	/// @param [in]  tags of the source file
+	HRESULT openDecoded(Player::DecodedAudio_t&& decoded, Metadata&& metadata)
+	{
+		close();
+		if (decoded.samples.empty() || decoded.channels == 0)
+		{
+			return E_FAIL;
+		}
+		mDecoded  = std::move(decoded);
+		mMetadata = std::move(metadata);
 
-			// write the decoded PCM to disk
-			memcpy(currentOutput, rawbuf, mp3streamHead.cbDstLengthUsed);
-			totalDecompressedSize += mp3streamHead.cbDstLengthUsed;
-			currentOutput += mp3streamHead.cbDstLengthUsed;
+		// Define output format from the decoded stream
+		const WORD blockAlign = static_cast<WORD>(mDecoded.channels * sizeof(int16_t));
+		mPcmFormat = {
+		 WAVE_FORMAT_PCM,                  // format type
+		 mDecoded.channels,                // number of channels (i.e. mono, stereo...)
+		 mDecoded.sampleRate,              // sample rate
+		 mDecoded.sampleRate * blockAlign, // for buffer estimation
+		 blockAlign,                       // block size of data
+		 16,                               // number of bits per sample of mono data
+		 0,                                // the count in bytes of the size of
 		};
 
-		mp3Assert(acmStreamUnprepareHeader(acmMp3stream, &mp3streamHead, 0));
-		LocalFree(rawbuf);
-		mp3Assert(acmStreamClose(acmMp3stream, 0));
+		mSoundBuffer      = reinterpret_cast<BYTE*>(mDecoded.samples.data());
+		mBufferLength     = static_cast<DWORD>(mDecoded.samples.size() * sizeof(int16_t));
+		mDurationInSecond = mDecoded.getDurationSeconds();
 
-		// Update length to match actual decoded PCM size
-		mBufferLength = totalDecompressedSize;
-
-		// Release allocated memory
-		mp3Stream->Release();
-		GlobalFree(mp3HGlobal);
 		mIsOpen             = true;
 		mIsPlaying          = false;
 		mIsPaused           = false;
@@ -393,6 +324,18 @@ public:
 		return S_OK;
 	}
 
+	/// @brief       PlayerOutput: take over a track prepared by the loader
+	bool openTrack(Player::DecodedAudio_t&& audio, Metadata&& tags) override
+	{
+		return SUCCEEDED(openDecoded(std::move(audio), std::move(tags)));
+	}
+
+	/// @brief       PlayerOutput: start the open track at startSeconds
+	bool startPlayback(double startSeconds) override
+	{
+		return SUCCEEDED(play(startSeconds));
+	}
+
 	/// @brief       start playback from a specific time (seconds)
 	HRESULT play(double startSeconds = 0.0)
 	{
@@ -403,58 +346,82 @@ public:
 
 		resetWaveOut();
 
+		const size_t totalFrames    = mDecoded.getFrameCount();
 		const double clampedSeconds = std::clamp(startSeconds, 0.0, mDurationInSecond);
-		DWORD startByte             = static_cast<DWORD>(clampedSeconds * mPcmFormat.nAvgBytesPerSec);
-		if (startByte >= mBufferLength)
+		size_t       startFrame     = static_cast<size_t>(clampedSeconds * mPcmFormat.nSamplesPerSec);
+		if (startFrame >= totalFrames)
 		{
-			startByte = mBufferLength - mPcmFormat.nBlockAlign;
+			startFrame = totalFrames - 1;
 		}
 
-		mp3Assert(waveOutOpen(&mHandleWaveOut, WAVE_MAPPER, &mPcmFormat, NULL, 0, CALLBACK_NULL));
-
-		mWaveHeader               = {};
-		mWaveHeader.lpData        = (LPSTR)(mSoundBuffer + startByte);
-		mWaveHeader.dwBufferLength = mBufferLength - startByte;
+		if (!mSinkEvent)
+		{
+			mSinkEvent = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+		}
+		if (waveOutOpen(&mHandleWaveOut,
+		                WAVE_MAPPER,
+		                &mPcmFormat,
+		                reinterpret_cast<DWORD_PTR>(&MP3Player::waveOutProc),
+		                reinterpret_cast<DWORD_PTR>(this),
+		                CALLBACK_FUNCTION) != MMSYSERR_NOERROR)
+		{
+			mHandleWaveOut = nullptr;
+			return E_FAIL;
+		}
 
-		mp3Assert(waveOutPrepareHeader(mHandleWaveOut, &mWaveHeader, sizeof(mWaveHeader)));
-		mHeaderPrepared = true;
-		mp3Assert(waveOutWrite(mHandleWaveOut, &mWaveHeader, sizeof(mWaveHeader)));
+		for (SinkBlock_t& block : mSinkBlocks)
+		{
+			block.samples.assign(static_cast<size_t>(SINK_BLOCK_FRAMES) * mDecoded.channels, 0);
+			block.header                = {};
+			block.header.lpData         = reinterpret_cast<LPSTR>(block.samples.data());
+			block.header.dwBufferLength = SINK_BLOCK_FRAMES * mPcmFormat.nBlockAlign;
+			mp3Assert(waveOutPrepareHeader(mHandleWaveOut, &block.header, sizeof(WAVEHDR)));
+			// Free blocks are the ones marked done; the sink thread fills and queues them
+			block.header.dwFlags |= WHDR_DONE;
+		}
 
-		mStartOffsetSeconds = startByte / static_cast<double>(mPcmFormat.nAvgBytesPerSec);
-		mIsPlaying          = true;
-		mIsPaused           = false;
+		mSinkNextFrame      = startFrame;
+		mStartOffsetSeconds = startFrame / static_cast<double>(mPcmFormat.nSamplesPerSec);
+		mClock.start(mPcmFormat.nSamplesPerSec, startFrame, SINK_BLOCK_FRAMES);
+		mLevelMeter.reset(mPcmFormat.nSamplesPerSec);
+		mSinkStop   = false;
+		mIsPlaying  = true;
+		mIsPaused   = false;
+		mSinkThread = std::thread([this] { sinkLoop(); });
 		return S_OK;
 	}
 
 	/// @brief pause audio
-	void __inline setPause()
+	void __inline setPause() override
 	{
 		if (mHandleWaveOut && mIsPlaying && !mIsPaused)
 		{
 			mp3Assert(waveOutPause(mHandleWaveOut));
+			mClock.pause();
 			mIsPaused = true;
 		}
 	}
 
 	/// @brief resume audio
-	void __inline unSetPause()
+	void __inline unSetPause() override
 	{
 		if (mHandleWaveOut && mIsPlaying && mIsPaused)
 		{
+			mClock.resume();
 			mp3Assert(waveOutRestart(mHandleWaveOut));
 			mIsPaused = false;
 		}
 	}
 
 	/// @brief stop playback without releasing decoded audio
-	void stop()
+	void stop() override
 	{
 		resetWaveOut();
 		mStartOffsetSeconds = 0.0;
 	}
 
 	/// @brief adjust volume with balance (-1 left, 0 center, 1 right)
-	void setVolume(float master, float balance = 0.0F)
+	void setVolume(float master, float balance = 0.0F) override
 	{
 		const float clampedMaster  = std::clamp(master, 0.0F, 1.0F);
 		const float clampedBalance = std::clamp(balance, -1.0F, 1.0F);
@@ -475,6 +442,7 @@ public:
 		const DWORD rightValue = static_cast<DWORD>(rightGain * 0xFFFF);
 		const DWORD value      = (rightValue << 16) | leftValue;
 
+		MP3_PROFILE_SCOPE("sink.volume");
 		HWAVEOUT outHandle = mHandleWaveOut ? mHandleWaveOut
 			: reinterpret_cast<HWAVEOUT>(static_cast<UINT_PTR>(WAVE_MAPPER));
 		waveOutSetVolume(outHandle, value);
@@ -484,11 +452,10 @@ public:
 	void __inline close()
 	{
 		resetWaveOut();
-		if (mSoundBuffer)
-		{
-			mp3Assert(LocalFree(mSoundBuffer));
-			mSoundBuffer = nullptr;
-		}
+		mSoundBuffer = nullptr;
+		// The PCM goes back to the pool for the next track instead of to the heap
+		Player::PcmBufferPool::getShared().release(std::move(mDecoded.samples));
+		mDecoded     = Player::DecodedAudio_t{};
 		mBufferLength      = 0;
 		mDurationInSecond  = 0.0;
 		mStartOffsetSeconds = 0.0;
@@ -503,33 +470,46 @@ public:
 	/// @brief       get the total duration of audio 
 	///
 	/// @param [out] the music duration in seconds
-	double __inline getDuration()
+	double __inline getDuration() const override
 	{
 		return mDurationInSecond;
 	}
 
 	/// @brief       get the current position from the playback
 	///
-	/// @param [out] current position from the sound playback (used from sync)
-	double getPosition() {
-		static MMTIME MMTime = { TIME_SAMPLES, 0 };
-		if (mHandleWaveOut)
+	/// @param [out] audible position in seconds, from the playback clock (no driver call, cheap to poll)
+	double getPosition() const override
+	{
+		if (mIsPlaying)
 		{
-			waveOutGetPosition(mHandleWaveOut, &MMTime, sizeof(MMTIME));
-			const double played = ((double)MMTime.u.sample) / (44100.0);
-			return (std::min)(mStartOffsetSeconds + played, mDurationInSecond);
+			return (std::min)(mClock.getSeconds(), mDurationInSecond);
 		}
 		return mStartOffsetSeconds;
 	}
 
-	bool isOpen() const { return mIsOpen; }
-	bool isPlaying() const { return mIsPlaying; }
-	bool isPaused() const { return mIsPaused; }
+	/// @brief       levels of the output block that is audible now, measured on the sink thread; false when
+	///              stopped, paused or before the first block reaches the speakers
+	bool getOutputLevels(Player::LevelReading_t& reading) const override
+	{
+		if (!mIsPlaying || mIsPaused)
+		{
+			return false;
+		}
+		return mLevelMeter.read(mClock.getFramePosition(), reading);
+	}
+
+	/// @brief       clock driven by the sink callbacks, safe to read from any thread
+	const Player::PlaybackClock* getClock() const override { return &mClock; }
+
+	bool isOpen() const override { return mIsOpen; }
+	bool isPlaying() const override { return mIsPlaying; }
+	bool isPaused() const override { return mIsPaused; }
+	bool isPlayedOut() const override { return mPlayedOut.load(std::memory_order_acquire); }
 
 	const Metadata& getMetadata() const { return mMetadata; }
 
 	/// @brief Placeholder for future DSP: store requested EQ gains (dB)
-	void setEqualizerGains(const std::vector<float>& gainsDb)
+	void setEqualizerGains(const std::vector<float>& gainsDb) override
 	{
 		mEqGainsDb = gainsDb;
 	}
@@ -537,33 +517,10 @@ public:
 	/// @brief Extract a small waveform preview from the decoded PCM buffer
 	std::vector<float> getWaveformPreview(size_t sampleCount = 256) const
 	{
-		std::vector<float> preview;
-		if (!mSoundBuffer || mBufferLength == 0 || sampleCount == 0)
-		{
-			return preview;
-		}
-
-		const size_t bytesPerSample = mPcmFormat.wBitsPerSample / 8;
-		const size_t frameSize      = bytesPerSample * mPcmFormat.nChannels;
-		if (frameSize == 0)
-		{
-			return preview;
-		}
-
-		const size_t totalFrames = mBufferLength / frameSize;
-		const size_t step        = std::max<size_t>(1, totalFrames / sampleCount);
-		preview.reserve(sampleCount);
-
-		const int16_t* samples = reinterpret_cast<const int16_t*>(mSoundBuffer);
-		for (size_t frame = 0; frame < totalFrames && preview.size() < sampleCount; frame += step)
-		{
-			const size_t idx   = frame * mPcmFormat.nChannels;
-			const int16_t left = samples[idx];
-			const int16_t right = (mPcmFormat.nChannels > 1) ? samples[idx + 1] : left;
-			const float   avg  = static_cast<float>((left + right) / 2.0f / 32768.0f);
-			preview.push_back(avg);
-		}
-		return preview;
+		return Player::PcmAnalysis::getWaveformPreview(mDecoded.samples.data(),
+		                                               mDecoded.getFrameCount(),
+		                                               mDecoded.channels,
+		                                               sampleCount);
 	}
 };
 
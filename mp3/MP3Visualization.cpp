@@ -1,13 +1,19 @@
 #include "MP3Visualization.h"
+#include "Profiler.h"
 
 #undef e
 #include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/io.hpp>
 #include <cfloat>
+#include <chrono>
 #include <filesystem>
 #include <limits>
+#include <thread>
 #include <algorithm>
+
+#ifdef _WIN32
 #include <windows.h>
+#endif
 
 // Helper to wire demo markers located in code to an interactive browser
 typedef void (*ImGuiDemoMarkerCallback)(const char* file, int line, const char* section, void* user_data);
@@ -23,39 +29,42 @@ void*                               GImGuiDemoMarkerCallbackUserData = NULL;
     } while (0)
 
 
-Player::MP3Visualization::MP3Visualization()
-    : VisualizationBase()
-    , mAudioPlayer()
+Player::MP3Visualization::MP3Visualization(PlayerOutput& output)
+    : mOutput(output)
     , mMP3FileName{}
-    , mPlayStatus(false)
-    , mPauseStatus(false)
-    , mVolumeLevel(255)
     , mVisualFrameStatus(true)
-    , mCurrentIndex(-1)
-    , mVolumeNormalized(0.5F)
-    , mBalance(0.0F)
+    , mCore(mOutput, [this](const std::string& path) { return getTrackCandidates(path); })
+    , mSnapshot(mCore.getSnapshot())
+    , mInitialLoadPending(false)
     , mSeekSeconds(0.0F)
+    , mSortColumn(PLAYLIST_COLUMN_ADDED)
+    , mSortDescending(false)
     , mUserSeeking(false)
     , mStatusMessage()
     , mQuitRequested(false)
-    , mEqGainsDb(5, 0.0f)
     , mEqLabels({ "60", "230", "910", "3.6k", "14k" })
-    , mWaveformPreview()
+    , mShowInstrumentation(false)
+    , mScanImported(0)
+    , mLibraryReady(false)
+    , mLibraryOpenFailed(false)
+    , mSearchMs(0.0)
+    , mPathResolver(getSearchRoots())
     , mBuffer(new char[1000])
+    , mClockSecond(0)
 {
+    memset(mClockText, 0, sizeof(mClockText));
     memset(mFileInputBuffer, 0, sizeof(mFileInputBuffer));
+    memset(mSearchBuffer, 0, sizeof(mSearchBuffer));
     // Read in the INI settings
     worldReadIniSettings();
 }
 
 Player::MP3Visualization::~MP3Visualization()
 {
-}
-
-Player::MP3Visualization& Player::MP3Visualization::getInstance()
-{
-    static MP3Visualization instance;
-    return instance;
+    if (mLibraryOpener.joinable())
+    {
+        mLibraryOpener.join();
+    }
 }
 
 void Player::MP3Visualization::initialize()
@@ -78,11 +87,61 @@ void Player::MP3Visualization::worldReadIniSettings()
 
 void Player::MP3Visualization::worldInitFcn()
 {
+    // Parsing and indexing a large library takes seconds; the UI only touches mLibrary once it is ready
+    mLibraryPath   = getExecutableDir() / "mp3player_library.db";
+    mLibraryOpener = std::thread(
+        [this]
+        {
+            Profiler::setThreadName("library open");
+            mLibraryOpenFailed = !mLibrary.open(mLibraryPath);
+            mLibraryReady.store(true, std::memory_order_release);
+        });
+
+    mControlServer.attachClock(mOutput.getClock());
+    if (!mControlServer.start(ControlServer::getDefaultEndpoint()))
+    {
+        mStatusMessage = "Could not open control endpoint: " + ControlServer::getDefaultEndpoint();
+    }
+
+    // The previous session's playlist is mapped, not rebuilt; a track named on the command line is added to it
+    // (or selected, if an earlier launch already added it) and played instead of the first entry
+    mSessionPlaylistPath = getExecutableDir() / "mp3player_playlist.bin";
+    std::error_code error;
+    if (std::filesystem::exists(mSessionPlaylistPath, error))
+    {
+        postPlaylistFile(PLAYER_OPEN_PLAYLIST, mSessionPlaylistPath.string());
+    }
+
     if (!mMP3FileName.empty())
     {
-        mPlaylist.push_back(mMP3FileName);
-        mCurrentIndex = 0;
-        loadCurrentTrack();
+        addToPlaylist({}, {mMP3FileName}, true);
+        mInitialLoadPending = true;
+    }
+}
+
+void Player::MP3Visualization::worldExitFcn()
+{
+    // Unchanged since it was opened, the session playlist is not rewritten
+    if (!mSessionPlaylistPath.empty())
+    {
+        postPlaylistFile(PLAYER_SAVE_PLAYLIST, mSessionPlaylistPath.string());
+        mCore.process();
+        // A sort still running holds the save back until it is applied
+        mCore.finishPlaylistWork();
+    }
+}
+
+void Player::MP3Visualization::finishInitialLoad()
+{
+    // The eager start path: the window stays hidden until the first track is decoded
+    MP3_PROFILE_SCOPE("startup.initialLoad");
+    while (mInitialLoadPending)
+    {
+        serviceControlCommands();
+        if (mInitialLoadPending)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
     }
 }
 
@@ -104,6 +163,24 @@ void Player::MP3Visualization::worldFramePreDisplayFcn(bool demoMode)
             if (ImGui::MenuItem("Close", "Ctrl+W")) { mVisualFrameStatus = false; mQuitRequested = true; }
             ImGui::EndMenu();
         }
+        if (ImGui::BeginMenu("View"))
+        {
+            ImGui::MenuItem("Instrumentation", nullptr, &mShowInstrumentation);
+            if (mControlServer.isRunning())
+            {
+                ImGui::TextDisabled("Control: %s (%zu clients)",
+                                    mControlServer.getEndpoint().c_str(),
+                                    mControlServer.getClientCount());
+            }
+            if (ImGui::BeginMenu("Test playlist"))
+            {
+                if (ImGui::MenuItem("1k entries")) { fillTestPlaylist(1000); }
+                if (ImGui::MenuItem("100k entries")) { fillTestPlaylist(100000); }
+                if (ImGui::MenuItem("1M entries")) { fillTestPlaylist(1000000); }
+                ImGui::EndMenu();
+            }
+            ImGui::EndMenu();
+        }
         ImGui::Separator();
         if (ImGui::MenuItem("Quit", "Alt+F4")) { mQuitRequested = true; }
         ImGui::EndMenuBar();
@@ -111,28 +188,63 @@ void Player::MP3Visualization::worldFramePreDisplayFcn(bool demoMode)
 
     ImGui::TextColored(ImVec4(UTILITYColors::White.r, UTILITYColors::White.g, UTILITYColors::White.b, 1.0F), "Day:");
     ImGui::SameLine(100);
-    ImGui::TextColored(ImVec4{UTILITYColors::Green.r, UTILITYColors::Green.g, UTILITYColors::Green.b, 1.0f}, getDayAndTime().c_str());
+    ImGui::TextColored(ImVec4{UTILITYColors::Green.r, UTILITYColors::Green.g, UTILITYColors::Green.b, 1.0f}, "%s", getDayAndTime());
 
     ImGui::Spacing();
     // Input card
     ImGui::BeginChild("InputRow", ImVec2(-FLT_MIN, 70), true);
-    ImGui::TextUnformatted("Add a track");
+    ImGui::TextUnformatted("Add a track or a folder, open or save a playlist");
     ImGui::InputTextWithHint("##mp3input", "Enter MP3 path", mFileInputBuffer, IM_ARRAYSIZE(mFileInputBuffer));
     ImGui::SameLine();
     if (ImGui::Button("Add to Playlist"))
     {
         if (strlen(mFileInputBuffer) > 0)
         {
-            mPlaylist.emplace_back(mFileInputBuffer);
-            if (mCurrentIndex < 0)
-            {
-                mCurrentIndex = 0;
-                loadCurrentTrack();
-            }
+            addToPlaylist({}, {mFileInputBuffer}, false);
+            memset(mFileInputBuffer, 0, sizeof(mFileInputBuffer));
+        }
+    }
+    ImGui::SameLine();
+    const bool scanning = mLibraryScanner && mLibraryScanner->isRunning();
+    if (scanning)
+    {
+        ImGui::Text("Scanning %zu / %zu", mLibraryScanner->getFilesProbed(), mLibraryScanner->getFilesFound());
+        ImGui::SameLine();
+        if (ImGui::Button("Cancel"))
+        {
+            mLibraryScanner->cancel();
+        }
+    }
+    else if (ImGui::Button("Import Folder"))
+    {
+        if (strlen(mFileInputBuffer) > 0)
+        {
+            startFolderImport(mFileInputBuffer);
+        }
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Open Playlist"))
+    {
+        if (strlen(mFileInputBuffer) > 0)
+        {
+            postPlaylistFile(PLAYER_OPEN_PLAYLIST, mFileInputBuffer);
+            memset(mFileInputBuffer, 0, sizeof(mFileInputBuffer));
+        }
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Save Playlist"))
+    {
+        if (strlen(mFileInputBuffer) > 0)
+        {
+            postPlaylistFile(PLAYER_SAVE_PLAYLIST, mFileInputBuffer);
             memset(mFileInputBuffer, 0, sizeof(mFileInputBuffer));
         }
     }
     ImGui::EndChild();
+    drainFolderImport();
+    serviceControlCommands();
+    const PlayerSnapshot_t& snapshot = *mSnapshot;
+    const Playlist&         playlist = mCore.getPlaylist();
 
     if (ImGui::BeginTable("layout", 2, ImGuiTableFlags_SizingStretchProp))
     {
@@ -143,48 +255,160 @@ void Player::MP3Visualization::worldFramePreDisplayFcn(bool demoMode)
         // Playlist column
         ImGui::TableSetColumnIndex(0);
         ImGui::BeginChild("PlaylistCard", ImVec2(-FLT_MIN, 400), true);
-        ImGui::TextUnformatted("Playlist");
-        if (ImGui::BeginListBox("##playlistbox", ImVec2(-FLT_MIN, 240)))
+        ImGui::Text("Playlist (%zu)", playlist.size());
+        static const char* sortLabels[PLAYLIST_COLUMN_COUNT] = {"Added", "Title", "Path", "Duration", "Bitrate"};
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(110);
+        if (ImGui::Combo("##playlistsort", &mSortColumn, sortLabels, PLAYLIST_COLUMN_COUNT))
+        {
+            postPlaylistSort();
+        }
+        ImGui::SameLine();
+        if (ImGui::Checkbox("Desc", &mSortDescending))
+        {
+            postPlaylistSort();
+        }
+        ImGui::SetNextItemWidth(-FLT_MIN);
+        const bool libraryReady = isLibraryReady();
+        ImGui::BeginDisabled(!libraryReady);
+        if (ImGui::InputTextWithHint("##librarysearch",
+                                     libraryReady ? "Search library" : "Opening library...",
+                                     mSearchBuffer,
+                                     IM_ARRAYSIZE(mSearchBuffer)))
+        {
+            runLibrarySearch();
+        }
+        ImGui::EndDisabled();
+        if (mSearchBuffer[0] != '\0')
+        {
+            ImGui::TextDisabled("%zu matches in %.2f ms", mSearchResults.size(), mSearchMs);
+            if (ImGui::BeginListBox("##searchresults", ImVec2(-FLT_MIN, 240)))
+            {
+                ImGuiListClipper clipper;
+                clipper.Begin(static_cast<int>(mSearchResults.size()));
+                while (clipper.Step())
+                {
+                    for (int idx = clipper.DisplayStart; idx < clipper.DisplayEnd; ++idx)
+                    {
+                        ImGui::PushID(idx);
+                        if (ImGui::Selectable(mSearchLabels[idx].c_str(), false))
+                        {
+                            // Queue the match at the end of the playlist and make it current
+                            const uint32_t id = mSearchResults[idx];
+                            ScannedTrack_t track;
+                            track.path            = std::string(mLibrary.getPath(id));
+                            track.title           = std::string(mLibrary.getTitle(id));
+                            track.artist          = std::string(mLibrary.getArtist(id));
+                            track.durationSeconds = mLibrary.getDuration(id);
+                            track.bitrateKbps     = mLibrary.getBitrate(id);
+                            addToPlaylist({track}, {}, true, {id});
+                        }
+                        ImGui::PopID();
+                    }
+                }
+                ImGui::EndListBox();
+            }
+        }
+        else if (ImGui::BeginListBox("##playlistbox", ImVec2(-FLT_MIN, 240)))
         {
-            for (int idx = 0; idx < static_cast<int>(mPlaylist.size()); ++idx)
+            MP3_PROFILE_SCOPE("ui.playlist");
+            // Only the rows inside the scroll window are submitted, so the cost is independent of the list size
+            ImGuiListClipper clipper;
+            clipper.Begin(static_cast<int>(playlist.size()));
+            while (clipper.Step())
             {
-                const bool selected = idx == mCurrentIndex;
-                if (ImGui::Selectable(mPlaylist[idx].c_str(), selected))
+                for (int idx = clipper.DisplayStart; idx < clipper.DisplayEnd; ++idx)
                 {
-                    mCurrentIndex = idx;
-                    loadCurrentTrack();
+                    const bool selected = idx == snapshot.trackIndex;
+                    // Entries the last load could not find stay selectable (the file may come back) but are dimmed
+                    const bool missing = (playlist.getFlags(idx) & PLAYLIST_FLAG_MISSING) != 0;
+                    ImGui::PushID(idx);
+                    if (missing)
+                    {
+                        ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyleColorVec4(ImGuiCol_TextDisabled));
+                    }
+                    if (ImGui::Selectable(playlist.getDisplayName(idx), selected))
+                    {
+                        PlayerCommand_t command;
+                        command.type  = PLAYER_SELECT;
+                        command.index = idx;
+                        mCore.post(std::move(command));
+                    }
+                    if (missing)
+                    {
+                        ImGui::PopStyleColor();
+                    }
+                    if (ImGui::BeginPopupContextItem())
+                    {
+                        if (ImGui::MenuItem("Add to queue"))
+                        {
+                            PlayerCommand_t command;
+                            command.type  = PLAYER_ENQUEUE;
+                            command.index = idx;
+                            mCore.post(std::move(command));
+                        }
+                        ImGui::EndPopup();
+                    }
+                    if (ImGui::IsItemHovered())
+                    {
+                        drawPlaylistTooltip(playlist, idx);
+                    }
+                    ImGui::PopID();
                 }
             }
             ImGui::EndListBox();
         }
         if (ImGui::Button("Play", ImVec2(-FLT_MIN, 0)))
         {
-            playSelected(mUserSeeking ? mSeekSeconds : 0.0);
+            mCore.post(PLAYER_PLAY, mUserSeeking ? mSeekSeconds : 0.0);
         }
-        if (ImGui::Button(mAudioPlayer.isPaused() ? "Resume" : "Pause", ImVec2(-FLT_MIN, 0)))
+        if (ImGui::Button(snapshot.paused ? "Resume" : "Pause", ImVec2(-FLT_MIN, 0)))
         {
-            if (mAudioPlayer.isPaused())
-            {
-                mAudioPlayer.unSetPause();
-            }
-            else
-            {
-                mAudioPlayer.setPause();
-            }
+            mCore.post(PLAYER_TOGGLE_PAUSE);
         }
         if (ImGui::Button("Stop", ImVec2(-FLT_MIN, 0)))
         {
-            mAudioPlayer.stop();
+            mCore.post(PLAYER_STOP);
             mSeekSeconds = 0.0F;
         }
         ImGui::Separator();
         if (ImGui::Button("Previous", ImVec2(-FLT_MIN, 0)))
         {
-            moveToTrack(-1);
+            mCore.post(PLAYER_PREVIOUS);
         }
         if (ImGui::Button("Next", ImVec2(-FLT_MIN, 0)))
         {
-            moveToTrack(1);
+            mCore.post(PLAYER_NEXT);
+        }
+        bool shuffle = snapshot.shuffle;
+        if (ImGui::Checkbox("Shuffle", &shuffle))
+        {
+            mCore.post(PLAYER_SHUFFLE, shuffle ? 1.0 : 0.0);
+        }
+        ImGui::SameLine();
+        static const char* repeatLabels[] = {"Repeat off", "Repeat all", "Repeat one"};
+        int                repeat         = snapshot.repeat;
+        ImGui::SetNextItemWidth(-FLT_MIN);
+        if (ImGui::Combo("##repeat", &repeat, repeatLabels, IM_ARRAYSIZE(repeatLabels)))
+        {
+            PlayerCommand_t command;
+            command.type  = PLAYER_REPEAT;
+            command.index = repeat;
+            mCore.post(std::move(command));
+        }
+        // Right-click a row to queue it; queued entries play before the playlist order resumes
+        if (snapshot.nextIndex >= 0 && snapshot.nextIndex < static_cast<int32_t>(playlist.size()))
+        {
+            ImGui::TextDisabled("Up next: %s", playlist.getDisplayName(snapshot.nextIndex));
+        }
+        if (snapshot.queueSize > 0)
+        {
+            ImGui::TextDisabled("%zu queued", snapshot.queueSize);
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Clear queue"))
+            {
+                mCore.post(PLAYER_CLEAR_QUEUE);
+            }
         }
         ImGui::EndChild();
 
@@ -192,15 +416,23 @@ void Player::MP3Visualization::worldFramePreDisplayFcn(bool demoMode)
         ImGui::TableSetColumnIndex(1);
         if (mWorldFrameSettings.displayFile)
         {
-            const float duration = static_cast<float>(mAudioPlayer.getDuration());
+            const float duration = static_cast<float>(snapshot.durationSeconds);
 
-            ImGui::BeginChild("PlaybackCard", ImVec2(-FLT_MIN, 420), true);
+            ImGui::BeginChild("PlaybackCard", ImVec2(-FLT_MIN, 480), true);
             ImGui::TextUnformatted("Playback");
+            if (snapshot.loading)
+            {
+                // Progress of the background decode, in compressed bytes
+                const float progress = mCore.getLoadProgress();
+                char        overlay[32];
+                snprintf(overlay, sizeof(overlay), "Loading %d%%", static_cast<int>(progress * 100.0F));
+                ImGui::ProgressBar(progress, ImVec2(-FLT_MIN, 0), overlay);
+            }
             if (duration > 0.0F)
             {
                 if (!mUserSeeking)
                 {
-                    mSeekSeconds = static_cast<float>(mAudioPlayer.getPosition());
+                    mSeekSeconds = static_cast<float>(mOutput.getPosition());
                 }
                 ImGui::SliderFloat("Seek", &mSeekSeconds, 0.0f, duration, "%.2f s", ImGuiSliderFlags_AlwaysClamp);
                 if (ImGui::IsItemActivated())
@@ -209,44 +441,55 @@ void Player::MP3Visualization::worldFramePreDisplayFcn(bool demoMode)
                 }
                 if (ImGui::IsItemDeactivatedAfterEdit())
                 {
-                    playSelected(mSeekSeconds);
+                    mCore.post(PLAYER_PLAY, mSeekSeconds);
                     mUserSeeking = false;
                 }
-                ImGui::Text("Time: %.1fs / %.1fs", mAudioPlayer.getPosition(), mAudioPlayer.getDuration());
+                ImGui::Text("Time: %.1fs / %.1fs", mOutput.getPosition(), snapshot.durationSeconds);
             }
             else
             {
                 ImGui::TextDisabled("Load a track to enable transport.");
             }
 
-            ImGui::SliderFloat("Volume", &mVolumeNormalized, 0.0F, 1.0F);
-            ImGui::SliderFloat("Balance", &mBalance, -1.0F, 1.0F);
+            // The sliders show the core's values; an edit goes back as a command and shows up next frame
+            float      volume        = snapshot.volume;
+            float      balance       = snapshot.balance;
+            const bool volumeEdited  = ImGui::SliderFloat("Volume", &volume, 0.0F, 1.0F);
+            const bool balanceEdited = ImGui::SliderFloat("Balance", &balance, -1.0F, 1.0F);
+            if (volumeEdited || balanceEdited)
+            {
+                mCore.post(PLAYER_VOLUME, volume, balance);
+            }
+            drawLevelMeters();
 
-            const auto& meta = mAudioPlayer.getMetadata();
+            // The lines were formatted by the core when the track was loaded
+            static const PlayerTrack_t noTrack{{}, {}, {}, TrackDisplay_t::make({}, {}, 0.0)};
+            const PlayerTrack_t&       track   = snapshot.track ? *snapshot.track : noTrack;
+            const TrackDisplay_t&      display = track.display;
             ImGui::Separator();
             ImGui::TextUnformatted("Now Playing");
-            ImGui::Text("File: %s", mMP3FileName.c_str());
-            ImGui::Text("Title: %s", wideToUtf8(meta.title).c_str());
-            ImGui::Text("Artist: %s", wideToUtf8(meta.artist).c_str());
-            ImGui::Text("Album: %s", wideToUtf8(meta.album).c_str());
-            if (meta.bitrate > 0)
+            ImGui::TextUnformatted(display.file.c_str());
+            ImGui::TextUnformatted(display.title.c_str());
+            ImGui::TextUnformatted(display.artist.c_str());
+            ImGui::TextUnformatted(display.album.c_str());
+            if (!display.bitrate.empty())
+            {
+                ImGui::TextUnformatted(display.bitrate.c_str());
+            }
+            if (!display.duration.empty())
             {
-                ImGui::Text("Bitrate: %u kbps", meta.bitrate / 1000);
+                ImGui::TextUnformatted(display.duration.c_str());
             }
 
             ImGui::Separator();
             ImGui::TextUnformatted("Waveform");
-            if (mAudioPlayer.isPlaying() && mWaveformPreview.empty() && mAudioPlayer.isOpen())
-            {
-                refreshWaveformPreview();
-            }
-            if (mAudioPlayer.isPlaying() && !mWaveformPreview.empty())
+            if (snapshot.playing && !track.waveform.empty())
             {
                 ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(UTILITYColors::Orange.r, UTILITYColors::Orange.g, UTILITYColors::Orange.b, 1.0f));
                 ImGui::PushStyleColor(ImGuiCol_PlotLinesHovered, ImVec4(UTILITYColors::Orange.r, UTILITYColors::Orange.g, UTILITYColors::Orange.b, 1.0f));
                 ImVec2 waveSize(ImGui::GetContentRegionAvail().x, 120.0f);
-                ImGui::PlotLines("##wave", mWaveformPreview.data(), static_cast<int>(mWaveformPreview.size()), 0, nullptr, -1.0F, 1.0F, waveSize);
-                const float prog = (duration > 0.0F) ? std::clamp(static_cast<float>(mAudioPlayer.getPosition()) / duration, 0.0F, 1.0F) : 0.0F;
+                ImGui::PlotLines("##wave", track.waveform.data(), static_cast<int>(track.waveform.size()), 0, nullptr, -1.0F, 1.0F, waveSize);
+                const float prog = (duration > 0.0F) ? std::clamp(static_cast<float>(mOutput.getPosition()) / duration, 0.0F, 1.0F) : 0.0F;
                 ImVec2 min = ImGui::GetItemRectMin();
                 ImVec2 max = ImGui::GetItemRectMax();
                 const float x = min.x + prog * (max.x - min.x);
@@ -262,41 +505,168 @@ void Player::MP3Visualization::worldFramePreDisplayFcn(bool demoMode)
 
             ImGui::BeginChild("EQCard", ImVec2(-FLT_MIN, 200), true);
             ImGui::TextUnformatted("Equalizer");
-            bool eqChanged = false;
             ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(16, 6));
-            for (size_t i = 0; i < mEqGainsDb.size(); ++i)
+            for (size_t i = 0; i < snapshot.eqGainsDb.size(); ++i)
             {
                 ImGui::BeginGroup();
                 ImGui::PushID(static_cast<int>(i));
-                eqChanged |= ImGui::VSliderFloat("##eq", ImVec2(28, 140), &mEqGainsDb[i], -12.0f, 12.0f, "%.1f");
+                float gain = snapshot.eqGainsDb[i];
+                if (ImGui::VSliderFloat("##eq", ImVec2(28, 140), &gain, -12.0f, 12.0f, "%.1f"))
+                {
+                    PlayerCommand_t command;
+                    command.type  = PLAYER_EQ;
+                    command.band  = static_cast<uint32_t>(i);
+                    command.value = gain;
+                    mCore.post(std::move(command));
+                }
                 ImGui::PopID();
                 ImGui::TextUnformatted(mEqLabels[i]);
                 ImGui::EndGroup();
-                if (i + 1 < mEqGainsDb.size())
+                if (i + 1 < snapshot.eqGainsDb.size())
                 {
                     ImGui::SameLine();
                 }
             }
             ImGui::PopStyleVar();
-            if (eqChanged)
-            {
-                mAudioPlayer.setEqualizerGains(mEqGainsDb);
-            }
             ImGui::EndChild();
         }
 
         ImGui::EndTable();
     }
 
-    if (!mStatusMessage.empty())
+    // The core reports load failures, the UI its own actions (imports, trace export)
+    const std::string* messages[] = {&snapshot.statusMessage, &mStatusMessage};
+    for (const std::string* message : messages)
     {
-        ImGui::TextColored(ImVec4(UTILITYColors::Orange.r, UTILITYColors::Orange.g, UTILITYColors::Orange.b, 1.0F),
-                           "%s",
-                           mStatusMessage.c_str());
+        if (!message->empty())
+        {
+            ImGui::TextColored(ImVec4(UTILITYColors::Orange.r, UTILITYColors::Orange.g, UTILITYColors::Orange.b, 1.0F),
+                               "%s",
+                               message->c_str());
+        }
     }
 
     ImGui::End();
     ImGui::PopStyleVar(3);
+
+    drawInstrumentationOverlay();
+}
+
+void Player::MP3Visualization::drawInstrumentationOverlay()
+{
+    if (!mShowInstrumentation)
+    {
+        return;
+    }
+
+    ImGui::SetNextWindowSize(ImVec2(560, 420), ImGuiCond_FirstUseEver);
+    if (!ImGui::Begin("Instrumentation", &mShowInstrumentation))
+    {
+        ImGui::End();
+        return;
+    }
+
+    bool recording = Profiler::isEnabled();
+    if (ImGui::Checkbox("Record", &recording))
+    {
+        Profiler::setEnabled(recording);
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Clear"))
+    {
+        Profiler::clear();
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Export Chrome trace"))
+    {
+        const std::string tracePath = (std::filesystem::current_path() / "mp3player_trace.json").string();
+        mStatusMessage = Profiler::exportChromeTrace(tracePath) ? "Trace written to " + tracePath
+                                                                : "Failed to write trace: " + tracePath;
+    }
+
+    drawAllocations();
+
+    // Group the buffered events by scope name, keeping the most recent samples of each
+    constexpr size_t maxSamples = 240;
+    for (auto& series : mInstrumentationSeries)
+    {
+        series.durationsMs.clear();
+    }
+    for (const auto& event : Profiler::snapshot())
+    {
+        if (event.name == nullptr)
+        {
+            continue;
+        }
+        auto series = std::find_if(mInstrumentationSeries.begin(),
+                                   mInstrumentationSeries.end(),
+                                   [&event](const InstrumentationSeries_t& entry)
+                                   { return entry.name == event.name || strcmp(entry.name, event.name) == 0; });
+        if (series == mInstrumentationSeries.end())
+        {
+            mInstrumentationSeries.push_back({event.name, {}});
+            series = mInstrumentationSeries.end() - 1;
+        }
+        series->durationsMs.push_back(static_cast<float>(event.durationNs / 1.0e6));
+    }
+    for (auto& series : mInstrumentationSeries)
+    {
+        if (series.durationsMs.size() > maxSamples)
+        {
+            series.durationsMs.erase(series.durationsMs.begin(), series.durationsMs.end() - maxSamples);
+        }
+    }
+
+    if (ImGui::BeginTable("scopes", 5, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV))
+    {
+        ImGui::TableSetupColumn("Scope");
+        ImGui::TableSetupColumn("Samples");
+        ImGui::TableSetupColumn("Last (ms)");
+        ImGui::TableSetupColumn("Avg (ms)");
+        ImGui::TableSetupColumn("Max (ms)");
+        ImGui::TableHeadersRow();
+        for (const auto& series : mInstrumentationSeries)
+        {
+            if (series.durationsMs.empty())
+            {
+                continue;
+            }
+            float sum = 0.0F;
+            float max = 0.0F;
+            for (float value : series.durationsMs)
+            {
+                sum += value;
+                max = std::max(max, value);
+            }
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted(series.name);
+            ImGui::TableSetColumnIndex(1);
+            ImGui::Text("%d", static_cast<int>(series.durationsMs.size()));
+            ImGui::TableSetColumnIndex(2);
+            ImGui::Text("%.3f", series.durationsMs.back());
+            ImGui::TableSetColumnIndex(3);
+            ImGui::Text("%.3f", sum / static_cast<float>(series.durationsMs.size()));
+            ImGui::TableSetColumnIndex(4);
+            ImGui::Text("%.3f", max);
+        }
+        ImGui::EndTable();
+    }
+
+    if (ImPlot::BeginPlot("##scopeTimings", ImVec2(-1, -1)))
+    {
+        ImPlot::SetupAxes("sample", "ms", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+        for (const auto& series : mInstrumentationSeries)
+        {
+            if (!series.durationsMs.empty())
+            {
+                ImPlot::PlotLine(series.name, series.durationsMs.data(), static_cast<int>(series.durationsMs.size()));
+            }
+        }
+        ImPlot::EndPlot();
+    }
+
+    ImGui::End();
 }
 
 void Player::MP3Visualization::localFrameDisplayFcn()
@@ -305,9 +675,65 @@ void Player::MP3Visualization::localFrameDisplayFcn()
     {
         if (!mUserSeeking)
         {
-            mSeekSeconds = static_cast<float>(mAudioPlayer.getPosition());
+            mSeekSeconds = static_cast<float>(mOutput.getPosition());
+        }
+    }
+}
+
+void Player::MP3Visualization::drawAllocations()
+{
+    if (!ImGui::CollapsingHeader("Allocations", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        return;
+    }
+    if (!AllocationTracker::isInstalled())
+    {
+        ImGui::TextDisabled("Not counted: Debug builds and -DMP3PLAYER_TRACK_ALLOCATIONS=ON link the hooks.");
+        return;
+    }
+
+    // This window allocates too (scope snapshots), so the steady-state check is with it closed
+    const AllocationFrameCounter::Frame_t& last = mFrameAllocations.getLast();
+    const AllocationFrameCounter::Frame_t& peak = mFrameAllocations.getPeak();
+    ImGui::Text("Last frame: %llu allocations, %llu bytes (%llu on the UI thread)",
+                static_cast<unsigned long long>(last.allocations),
+                static_cast<unsigned long long>(last.bytes),
+                static_cast<unsigned long long>(last.threadAllocations));
+    ImGui::Text("Peak since startup: %llu allocations, %llu bytes",
+                static_cast<unsigned long long>(peak.allocations),
+                static_cast<unsigned long long>(peak.bytes));
+    ImGui::Text("Frames that allocated: %llu of %llu",
+                static_cast<unsigned long long>(mFrameAllocations.getAllocatingFrameCount()),
+                static_cast<unsigned long long>(mFrameAllocations.getFrameCount()));
+
+    AllocationTracker::getThreads(mAllocationThreads);
+    if (ImGui::BeginTable("allocationThreads", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV))
+    {
+        ImGui::TableSetupColumn("Thread");
+        ImGui::TableSetupColumn("Allocations");
+        ImGui::TableSetupColumn("Frees");
+        ImGui::TableSetupColumn("MB requested");
+        ImGui::TableHeadersRow();
+        for (const AllocationTracker::ThreadCounts_t& thread : mAllocationThreads)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            if (thread.name[0] != '\0')
+            {
+                ImGui::TextUnformatted(thread.name);
+            }
+            else
+            {
+                ImGui::Text("#%u", thread.slot);
+            }
+            ImGui::TableSetColumnIndex(1);
+            ImGui::Text("%llu", static_cast<unsigned long long>(thread.counts.allocations));
+            ImGui::TableSetColumnIndex(2);
+            ImGui::Text("%llu", static_cast<unsigned long long>(thread.counts.frees));
+            ImGui::TableSetColumnIndex(3);
+            ImGui::Text("%.1f", static_cast<double>(thread.counts.bytes) / (1024.0 * 1024.0));
         }
-        mAudioPlayer.setVolume(mVolumeNormalized, mBalance);
+        ImGui::EndTable();
     }
 }
 
@@ -321,137 +747,363 @@ std::string Player::MP3Visualization::getTime()
     return strLocalTime;
 }
 
-std::string Player::MP3Visualization::getDayAndTime()
+const char* Player::MP3Visualization::getDayAndTime()
 {
-    auto        today = std::chrono::system_clock::now();
-    auto        ptr   = std::chrono::system_clock::to_time_t(today);
-    std::string strDayAndTime(ctime(&ptr));
-    return strDayAndTime;
+    // Formatted into a member buffer once a second; the other frames return the same text
+    const std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    if (now != mClockSecond)
+    {
+        mClockSecond = now;
+        std::strftime(mClockText, sizeof(mClockText), "%a %b %d %H:%M:%S %Y", std::localtime(&now));
+    }
+    return mClockText;
 }
 
-bool Player::MP3Visualization::loadCurrentTrack()
+void Player::MP3Visualization::drawLevelMeters()
 {
-    if (mCurrentIndex < 0 || mCurrentIndex >= static_cast<int>(mPlaylist.size()))
+    MP3_PROFILE_SCOPE("ui.meters");
+    mLevelDisplay.update(mOutputLevels, ImGui::GetIO().DeltaTime);
+
+    // One bar per channel on a -60..+3 dB scale: RMS solid, peak above it, the held peak as a marker that turns
+    // red while the true peak in the hold window is over 0 dBTP
+    constexpr float minDb     = LevelMeterDisplay_t::FLOOR_DB;
+    constexpr float maxDb     = 3.0F;
+    constexpr float barHeight = 8.0F;
+    const float     width     = ImGui::GetContentRegionAvail().x;
+    ImDrawList*     draw      = ImGui::GetWindowDrawList();
+    const ImU32     rmsColor  = ImGui::GetColorU32(ImVec4(UTILITYColors::Green.r, UTILITYColors::Green.g, UTILITYColors::Green.b, 1.0F));
+    const ImU32     peakColor = ImGui::GetColorU32(ImVec4(UTILITYColors::DarkGreen.r, UTILITYColors::DarkGreen.g, UTILITYColors::DarkGreen.b, 1.0F));
+    const ImU32     overColor = ImGui::GetColorU32(ImVec4(UTILITYColors::Red.r, UTILITYColors::Red.g, UTILITYColors::Red.b, 1.0F));
+    for (size_t channel = 0; channel < LevelReading_t::MAX_CHANNELS; ++channel)
     {
-        mStatusMessage = "No track selected.";
-        return false;
+        const ImVec2 origin = ImGui::GetCursorScreenPos();
+        const auto   toX    = [&](float db) { return origin.x + width * std::clamp((db - minDb) / (maxDb - minDb), 0.0F, 1.0F); };
+        const float  bottom = origin.y + barHeight;
+        draw->AddRectFilled(origin, ImVec2(origin.x + width, bottom), IM_COL32(40, 40, 40, 255));
+        draw->AddRectFilled(origin, ImVec2(toX(mLevelDisplay.rmsDb[channel]), bottom), rmsColor);
+        draw->AddRectFilled(ImVec2(toX(mLevelDisplay.rmsDb[channel]), origin.y), ImVec2(toX(mLevelDisplay.peakDb[channel]), bottom), peakColor);
+        draw->AddLine(ImVec2(toX(0.0F), origin.y), ImVec2(toX(0.0F), bottom), IM_COL32(120, 120, 120, 255));
+        const float hold = toX(mLevelDisplay.holdDb[channel]);
+        draw->AddLine(ImVec2(hold, origin.y), ImVec2(hold, bottom), mLevelDisplay.truePeakDb[channel] > 0.0F ? overColor : IM_COL32(255, 255, 255, 255), 2.0F);
+        ImGui::Dummy(ImVec2(width, barHeight));
     }
+    // -1 dBTP is the usual delivery ceiling, so the readout warns before the marker does
+    const bool  hot       = std::max(mLevelDisplay.truePeakDb[0], mLevelDisplay.truePeakDb[1]) > -1.0F;
+    const auto& textColor = hot ? UTILITYColors::Red : UTILITYColors::Gray;
+    ImGui::TextColored(ImVec4(textColor.r, textColor.g, textColor.b, 1.0F),
+                       "Peak %5.1f %5.1f  RMS %5.1f %5.1f dBFS  True peak %5.1f %5.1f dBTP",
+                       mLevelDisplay.holdDb[0],
+                       mLevelDisplay.holdDb[1],
+                       mLevelDisplay.rmsDb[0],
+                       mLevelDisplay.rmsDb[1],
+                       mLevelDisplay.truePeakDb[0],
+                       mLevelDisplay.truePeakDb[1]);
+}
 
-    const std::string& source = mPlaylist[mCurrentIndex];
-    std::filesystem::path requested(source);
-
-    // Build candidate search paths for relative inputs
-    std::vector<std::filesystem::path> candidates;
-    if (requested.is_absolute())
+void Player::MP3Visualization::startFolderImport(const std::filesystem::path& root)
+{
+    if (!mLibraryScanner)
+    {
+        mLibraryScanner = std::make_unique<LibraryScanner>();
+    }
+    if (mLibraryScanner->start(root))
     {
-        candidates.push_back(requested);
+        mScanImported  = 0;
+        mStatusMessage = "Importing " + root.string();
+        memset(mFileInputBuffer, 0, sizeof(mFileInputBuffer));
     }
     else
     {
-        candidates.push_back(std::filesystem::current_path() / requested);
-        auto exeDir = getExecutableDir();
-        candidates.push_back(exeDir / requested);
-        candidates.push_back(exeDir.parent_path() / requested);       // build_clean/
-        candidates.push_back(exeDir.parent_path().parent_path() / requested); // repo root
-        candidates.push_back(exeDir.parent_path().parent_path() / "test" / requested);
+        mStatusMessage = "Not a folder: " + root.string();
     }
+}
 
-    std::filesystem::path resolved;
-    for (const auto& candidate : candidates)
+bool Player::MP3Visualization::isLibraryReady()
+{
+    if (mLibraryOpener.joinable() && mLibraryReady.load(std::memory_order_acquire))
     {
-        if (std::filesystem::exists(candidate))
+        mLibraryOpener.join();
+        if (mLibraryOpenFailed)
         {
-            resolved = candidate;
-            break;
+            mStatusMessage = "Could not open track library: " + mLibraryPath.string();
         }
     }
+    return !mLibraryOpener.joinable();
+}
 
-    if (resolved.empty())
+void Player::MP3Visualization::drainFolderImport()
+{
+    // Results stay queued in the scanner until the library can record them
+    if (!mLibraryScanner || !isLibraryReady())
     {
-        mStatusMessage = "File not found: " + source;
-        return false;
+        return;
     }
+    MP3_PROFILE_SCOPE("scan.drain");
 
-    const std::string resolvedStr = resolved.string();
-
-    int wideLen = MultiByteToWideChar(CP_UTF8, 0, resolvedStr.c_str(), -1, nullptr, 0);
-    std::wstring wide;
-    wide.resize(static_cast<size_t>(wideLen));
-    MultiByteToWideChar(CP_UTF8, 0, resolvedStr.c_str(), -1, wide.data(), wideLen);
-
-    HRESULT hr = mAudioPlayer.openFromFile(wide.c_str());
-    if (FAILED(hr))
+    // Bounded per frame so a huge import never holds the UI thread for more than a slice
+    constexpr size_t maxPerFrame = 4096;
+    mScanResults.clear();
+    if (mLibraryScanner->drainResults(mScanResults, maxPerFrame) == 0)
     {
-        mStatusMessage = "Failed to load file: " + resolvedStr;
-        return false;
+        return;
     }
 
-    mMP3FileName  = resolvedStr;
-    refreshWaveformPreview();
-    mStatusMessage.clear();
-    return true;
+    // The library ids go into the playlist with the tracks, so a row can show what only the library keeps
+    std::vector<uint32_t> trackIds;
+    trackIds.reserve(mScanResults.size());
+    for (const ScannedTrack_t& track : mScanResults)
+    {
+        uint32_t id = mLibrary.find(track.path, track.modifiedTime);
+        if (id == MetadataStore::NOT_FOUND)
+        {
+            TrackInfo_t info;
+            info.path            = track.path;
+            info.title           = track.title;
+            info.artist          = track.artist;
+            info.album           = track.album;
+            info.modifiedTime    = track.modifiedTime;
+            info.fileSize        = track.fileSize;
+            info.durationSeconds = static_cast<float>(track.durationSeconds);
+            info.bitrateKbps     = track.bitrateKbps;
+            id                   = mLibrary.put(info);
+        }
+        trackIds.push_back(id);
+    }
+    mLibrary.flush();
+    mScanImported += mScanResults.size();
+    mStatusMessage = "Imported " + std::to_string(mScanImported) + " tracks";
+    addToPlaylist(std::move(mScanResults), {}, false, std::move(trackIds));
 }
 
-void Player::MP3Visualization::playSelected(double startSeconds)
+void Player::MP3Visualization::runLibrarySearch()
 {
-    if (!mAudioPlayer.isOpen())
+    constexpr size_t maxResults = 1000;
+    const auto       start      = std::chrono::steady_clock::now();
+    mSearchResults              = mLibrary.search(mSearchBuffer, maxResults);
+    mSearchMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    // Labels are built once per query, not per frame
+    mSearchLabels.clear();
+    mSearchLabels.reserve(mSearchResults.size());
+    for (uint32_t id : mSearchResults)
     {
-        if (!loadCurrentTrack())
+        std::string label(mLibrary.getArtist(id));
+        if (!label.empty())
         {
-            return;
+            label += " - ";
         }
+        label += mLibrary.getTitle(id).empty() ? Playlist::makeDisplayName(std::string(mLibrary.getPath(id)))
+                                               : std::string(mLibrary.getTitle(id));
+        mSearchLabels.push_back(std::move(label));
     }
-    mAudioPlayer.play(startSeconds);
-    if (mWaveformPreview.empty())
+}
+
+void Player::MP3Visualization::fillTestPlaylist(size_t count)
+{
+    mCore.post(PLAYER_CLEAR_PLAYLIST);
+    std::vector<std::string> paths;
+    paths.reserve(count);
+    char path[64];
+    for (size_t index = 0; index < count; ++index)
     {
-        refreshWaveformPreview();
+        snprintf(path, sizeof(path), "test/placeholder_%07zu.mp3", index);
+        paths.emplace_back(path);
     }
+    // Placeholders never exist, so they skip the path resolution addToPlaylist() starts
+    PlayerCommand_t command;
+    command.type  = PLAYER_ADD_TRACKS;
+    command.paths = std::move(paths);
+    mCore.post(std::move(command));
+    mStatusMessage = "Test playlist: " + std::to_string(count) + " entries";
+}
+
+std::vector<std::filesystem::path> Player::MP3Visualization::getTrackCandidates(const std::string& source) const
+{
+    // No I/O here (UI thread); the loader probes the candidates, the cached resolution first
+    return mPathResolver.getCandidates(source);
 }
 
-void Player::MP3Visualization::moveToTrack(int delta)
+std::vector<std::filesystem::path> Player::MP3Visualization::getSearchRoots() const
 {
-    if (mPlaylist.empty())
+    // Where relative playlist paths are looked for, in order; the EXE location is only queried once
+    const std::filesystem::path exeDir = getExecutableDir();
+    return {std::filesystem::current_path(),
+            exeDir,
+            exeDir.parent_path(),               // build_clean/
+            exeDir.parent_path().parent_path(), // repo root
+            exeDir.parent_path().parent_path() / "test"};
+}
+
+void Player::MP3Visualization::addToPlaylist(std::vector<ScannedTrack_t>&& tracks,
+                                             std::vector<std::string>&&  paths,
+                                             bool                        select,
+                                             std::vector<uint32_t>&&     trackIds)
+{
+    // Bare paths may be relative; scanned tracks already carry the path of a file that was just probed
+    if (!paths.empty())
     {
-        mStatusMessage = "Playlist is empty.";
-        return;
+        mPathResolver.resolveAsync(paths);
     }
-    mCurrentIndex += delta;
-    if (mCurrentIndex < 0)
-        mCurrentIndex = static_cast<int>(mPlaylist.size()) - 1;
-    if (mCurrentIndex >= static_cast<int>(mPlaylist.size()))
-        mCurrentIndex = 0;
-    if (loadCurrentTrack())
+
+    PlayerCommand_t command;
+    command.type   = PLAYER_ADD_TRACKS;
+    command.select = select;
+    command.tracks   = std::move(tracks);
+    command.trackIds = std::move(trackIds);
+    command.paths    = std::move(paths);
+    if (!mCore.post(std::move(command)))
+    {
+        mStatusMessage = "Player is busy, tracks were not added.";
+    }
+}
+
+void Player::MP3Visualization::postPlaylistFile(PlayerCommandType_e type, const std::string& path)
+{
+    // The format follows the extension: .m3u/.m3u8 and .pls as text, anything else binary
+    PlayerCommand_t command;
+    command.type  = type;
+    command.paths = {path};
+    if (!mCore.post(std::move(command)))
+    {
+        mStatusMessage = "Player is busy, try again.";
+    }
+}
+
+void Player::MP3Visualization::postPlaylistSort()
+{
+    PlayerCommand_t command;
+    command.type  = PLAYER_SORT_PLAYLIST;
+    command.index = mSortColumn;
+    command.value = mSortDescending ? 1.0 : 0.0;
+    if (!mCore.post(std::move(command)))
     {
-        playSelected(0.0);
+        mStatusMessage = "Player is busy, try again.";
     }
 }
 
-std::string Player::MP3Visualization::wideToUtf8(const std::wstring& wstr)
+void Player::MP3Visualization::drawPlaylistTooltip(const Playlist& playlist, size_t index)
 {
-    if (wstr.empty())
+    // Everything here is a column read except the album, which only the library has. The id is a hint: the
+    // library may have been compacted since, so it is only used if it still names this entry's path.
+    ImGui::BeginTooltip();
+    const std::string_view path = playlist.getPath(index);
+    ImGui::TextUnformatted(path.data(), path.data() + path.size());
+    const uint32_t id = playlist.getMetadataId(index);
+    if (id != Playlist::NO_METADATA && isLibraryReady() && id < mLibrary.getRecordCount() &&
+        mLibrary.getPath(id) == path)
+    {
+        const std::string_view album = mLibrary.getAlbum(id);
+        if (!album.empty())
+        {
+            ImGui::Text("Album: %.*s", static_cast<int>(album.size()), album.data());
+        }
+    }
+    if (playlist.getBitrate(index) != 0)
     {
-        return "";
+        ImGui::Text("%u kbps", playlist.getBitrate(index));
     }
-    int sizeNeeded = WideCharToMultiByte(CP_UTF8, 0, wstr.c_str(), -1, nullptr, 0, nullptr, nullptr);
-    std::string result;
-    result.resize(static_cast<size_t>(sizeNeeded));
-    WideCharToMultiByte(CP_UTF8, 0, wstr.c_str(), -1, result.data(), sizeNeeded, nullptr, nullptr);
-    if (!result.empty() && result.back() == '\0')
+    if ((playlist.getFlags(index) & PLAYLIST_FLAG_MISSING) != 0)
     {
-        result.pop_back();
+        ImGui::TextDisabled("Could not be loaded");
     }
-    return result;
+    ImGui::EndTooltip();
+}
+
+void Player::MP3Visualization::serviceControlCommands()
+{
+    // Remote requests join the UI's own commands in the core's queue, tagged with their slot here for the reply
+    mControlCommands.clear();
+    mControlServer.drainCommands(mControlCommands);
+    for (size_t index = 0; index < mControlCommands.size(); ++index)
+    {
+        const ControlCommand_t& control = mControlCommands[index];
+        PlayerCommand_t         command;
+        command.tag   = index + 1;
+        command.value = control.value;
+        switch (control.type)
+        {
+        case CONTROL_PLAY:
+            command.type  = PLAYER_PLAY;
+            command.value = control.argCount > 0 ? control.value : 0.0;
+            break;
+        case CONTROL_PAUSE:
+            command.type = PLAYER_PAUSE;
+            break;
+        case CONTROL_RESUME:
+            command.type = PLAYER_RESUME;
+            break;
+        case CONTROL_STOP:
+            command.type = PLAYER_STOP;
+            break;
+        case CONTROL_SEEK:
+            command.type = PLAYER_PLAY;
+            break;
+        case CONTROL_NEXT:
+            command.type = PLAYER_NEXT;
+            break;
+        case CONTROL_PREVIOUS:
+            command.type = PLAYER_PREVIOUS;
+            break;
+        case CONTROL_VOLUME:
+            command.type   = PLAYER_VOLUME;
+            command.value2 = control.argCount > 1 ? control.value2 : mSnapshot->balance;
+            break;
+        case CONTROL_EQ:
+            command.type = PLAYER_EQ;
+            command.band = control.band;
+            break;
+        }
+        if (!mCore.post(std::move(command)))
+        {
+            mControlServer.reply(control, "player busy");
+        }
+    }
+
+    mCore.process(
+        [this](const PlayerCommand_t& command, const std::string& error)
+        {
+            if (command.tag > 0 && command.tag <= mControlCommands.size())
+            {
+                mControlServer.reply(mControlCommands[command.tag - 1], error);
+            }
+            else if (!error.empty())
+            {
+                mStatusMessage = error;
+            }
+        });
+    mSnapshot = mCore.getSnapshot();
+    if (mInitialLoadPending && !mSnapshot->loading && !mSnapshot->playlistBusy)
+    {
+        // process() has applied the queued add (after the session playlist was read), so not loading means the
+        // load is over
+        mInitialLoadPending = false;
+    }
+
+    if (!mOutput.getOutputLevels(mOutputLevels))
+    {
+        mOutputLevels = LevelReading_t{};
+    }
+    ControlStatus_t status;
+    status.positionSeconds = mOutput.getPosition();
+    status.durationSeconds = mSnapshot->durationSeconds;
+    status.playing         = mSnapshot->playing;
+    status.paused          = mSnapshot->paused;
+    status.trackIndex      = mSnapshot->trackIndex;
+    status.peakLeft        = mOutputLevels.peak[0];
+    status.peakRight       = mOutputLevels.peak[1];
+    mControlServer.publishStatus(status);
 }
 
 std::filesystem::path Player::MP3Visualization::getExecutableDir() const
 {
+#ifdef _WIN32
     std::array<wchar_t, MAX_PATH> pathBuf{};
     DWORD len = GetModuleFileNameW(nullptr, pathBuf.data(), static_cast<DWORD>(pathBuf.size()));
     std::filesystem::path exePath(std::wstring(pathBuf.data(), len));
     return exePath.parent_path();
-}
-
-void Player::MP3Visualization::refreshWaveformPreview()
-{
-    mWaveformPreview = mAudioPlayer.getWaveformPreview(512);
+#else
+    std::error_code             error;
+    const std::filesystem::path exePath = std::filesystem::read_symlink("/proc/self/exe", error);
+    return error ? std::filesystem::current_path(error) : exePath.parent_path();
+#endif
 }
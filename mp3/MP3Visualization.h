@@ -1,12 +1,22 @@
 #pragma once
 
-#include "mp3/MP3Player.h"
+#include "AllocationTracker.h"
+#include "ControlServer.h"
+#include "LibraryScanner.h"
+#include "MetadataStore.h"
+#include "PathResolver.h"
+#include "PlayerCore.h"
+#include "UTILITYColors.h"
 #include "UTILITYMath.h"
-#include "VisualizationBase.h"
+#include "imgui.h"
+#include "implot.h"
+#include <atomic>
+#include <thread>
 #include <vector>
 #include <string>
 #include <filesystem>
 #include <array>
+#include <ctime>
 
 namespace Player
 {
@@ -44,67 +54,136 @@ namespace Player
 		}
 	};
 
-	class MP3Visualization : public VisualizationBase
+	// The player window's content. It draws into the current ImGui context and drives audio only through
+	// PlayerCore and the PlayerOutput it is given (the waveOut player in the app, a stand-in in mp3uibench), so it
+	// needs no window, GL backend or audio device of its own.
+	class MP3Visualization
 	{
 
 	public:
 		// Constructor
-		MP3Visualization();
+		explicit MP3Visualization(PlayerOutput& output);
 
 		// Destructor
 		~MP3Visualization();
 
-		static MP3Visualization& getInstance();
-
 		void initialize();
 
 		// Set the worldvis functions
 		WorldFrameSettings_t mWorldFrameSettings;
-		void                 worldReadIniSettings() override;
-		void                 worldInitFcn() override;
-		void                 worldFramePreDisplayFcn(bool demoMode) override;
-		void                 localFrameDisplayFcn() override;
+		void                 worldReadIniSettings();
+		void                 worldInitFcn();
+		// Shutdown: saves the playlist for the next launch
+		void                 worldExitFcn();
+		void                 worldFramePreDisplayFcn(bool demoMode);
+		void                 localFrameDisplayFcn();
 
-		// Data mutex to be used whenever reading/writing to data members
-		std::mutex mVisionLock;
+		// Startup: the track queued by worldInitFcn() is pending until its load has finished or failed
+		bool isInitialLoadPending() const { return mInitialLoadPending; }
+		void finishInitialLoad();
 
 		std::string getTime();
-		std::string getDayAndTime();
+		const char* getDayAndTime();
 
 		void setMP3FileName(std::string& str);
 		std::string getMP3FileName();
 
-		MP3Player mAudioPlayer;
+		PlayerOutput& mOutput;
 		std::string mMP3FileName;
-		bool mPlayStatus;
-		bool mPauseStatus;
-		unsigned long mVolumeLevel;
 		bool mVisualFrameStatus;
 		bool mQuitRequested;
 
-		std::vector<std::string> mPlaylist;
-		int                      mCurrentIndex;
-		float                    mVolumeNormalized;
-		float                    mBalance;
+		// Playlist, transport and track loads live in the core; the UI posts commands and draws the snapshot
+		// taken at the start of the frame
+		PlayerCore           mCore;
+		PlayerSnapshotHandle mSnapshot;
+		bool                 mInitialLoadPending;
+		void addToPlaylist(std::vector<ScannedTrack_t>&& tracks,
+		                   std::vector<std::string>&&  paths,
+		                   bool                        select,
+		                   std::vector<uint32_t>&&     trackIds = {});
+		// Open or save a playlist file through the core (PLAYER_OPEN_PLAYLIST / PLAYER_SAVE_PLAYLIST)
+		void postPlaylistFile(PlayerCommandType_e type, const std::string& path);
+		// The playlist restored at startup and saved at exit, next to the library
+		std::filesystem::path mSessionPlaylistPath;
+		// Sort order picked in the playlist card (PlaylistColumn_e)
+		int  mSortColumn;
+		bool mSortDescending;
+		void postPlaylistSort();
+		// Hover details for a playlist row: path, album from the library, bitrate
+		void drawPlaylistTooltip(const Playlist& playlist, size_t index);
+
 		float                    mSeekSeconds;
 		bool                     mUserSeeking;
 		std::string              mStatusMessage;
-		std::vector<float>       mEqGainsDb;
-		std::array<const char*, 5> mEqLabels;
-		std::vector<float>       mWaveformPreview;
-		void refreshWaveformPreview();
+		std::array<const char*, PlayerCore::EQ_BANDS> mEqLabels;
+
+		// Instrumentation overlay (recent scope timings, Chrome trace export)
+		struct InstrumentationSeries_t
+		{
+			const char*        name = nullptr;
+			std::vector<float> durationsMs;
+		};
+		bool                                 mShowInstrumentation;
+		std::vector<InstrumentationSeries_t> mInstrumentationSeries;
+		void drawInstrumentationOverlay();
+
+		// Heap allocations per frame; the window loop brackets each frame with beginFrame()/endFrame()
+		AllocationFrameCounter                         mFrameAllocations;
+		std::vector<AllocationTracker::ThreadCounts_t> mAllocationThreads;
+		void drawAllocations();
 
 		char mFileInputBuffer[512];
 
-		bool loadCurrentTrack();
+		// Folder import: the scanner probes in the background, results are drained a slice per frame
+		std::unique_ptr<LibraryScanner> mLibraryScanner;
+		std::vector<ScannedTrack_t>     mScanResults;
+		size_t                          mScanImported;
+		void startFolderImport(const std::filesystem::path& root);
+		void drainFolderImport();
+
+		// Track metadata persisted next to the EXE; every imported track is recorded and searchable. It is opened
+		// on mLibraryOpener so a large library does not hold the first frame; until then search is disabled and
+		// scanned tracks wait in the scanner
+		MetadataStore            mLibrary;
+		std::filesystem::path    mLibraryPath;
+		std::thread              mLibraryOpener;
+		std::atomic<bool>        mLibraryReady;
+		bool                     mLibraryOpenFailed;
+		char                     mSearchBuffer[128];
+		std::vector<uint32_t>    mSearchResults;
+		std::vector<std::string> mSearchLabels;
+		double                   mSearchMs;
+		bool isLibraryReady();
+		void runLibrarySearch();
+
+		// Fill the playlist with placeholder entries to check frame times on very large lists
+		void fillTestPlaylist(size_t count);
+
+		// Playlist paths are resolved once when they are added; loads start from the cached canonical path
+		PathResolver                       mPathResolver;
+		std::vector<std::filesystem::path> getTrackCandidates(const std::string& source) const;
+		std::vector<std::filesystem::path> getSearchRoots() const;
+
+		// Remote control: requests arrive on the control server's thread and go through the core once per frame
+		ControlServer                 mControlServer;
+		std::vector<ControlCommand_t> mControlCommands;
+		void serviceControlCommands();
+
+		// Output levels measured on the audio thread for the block playing now, with display ballistics
+		LevelReading_t      mOutputLevels;
+		LevelMeterDisplay_t mLevelDisplay;
+		void drawLevelMeters();
+
 		std::filesystem::path getExecutableDir() const;
 		bool quitRequested() const { return mQuitRequested; }
-		void playSelected(double startSeconds = 0.0);
-		void moveToTrack(int delta);
-		std::string wideToUtf8(const std::wstring& wstr);
 
 		char* mBuffer;
 
+		// Header clock, reformatted only when the second changes
+		std::time_t mClockSecond;
+		char        mClockText[32];
+
 	};
 
 }
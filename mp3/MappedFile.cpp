@@ -0,0 +1,136 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+Player::MappedFile::~MappedFile()
+{
+    close();
+}
+
+#ifdef _WIN32
+
+bool Player::MappedFile::open(const std::filesystem::path& path)
+{
+    close();
+    HANDLE file = CreateFileW(path.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_FLAG_SEQUENTIAL_SCAN,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize{};
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        return false;
+    }
+    mFileHandle = file;
+    mOpen       = true;
+    if (fileSize.QuadPart == 0)
+    {
+        // CreateFileMapping rejects empty files
+        return true;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        close();
+        return false;
+    }
+    mMappingHandle = mapping;
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr)
+    {
+        close();
+        return false;
+    }
+    mData = static_cast<const uint8_t*>(view);
+    mSize = static_cast<size_t>(fileSize.QuadPart);
+    return true;
+}
+
+void Player::MappedFile::close()
+{
+    if (mData != nullptr)
+    {
+        UnmapViewOfFile(mData);
+    }
+    if (mMappingHandle != nullptr)
+    {
+        CloseHandle(mMappingHandle);
+    }
+    if (mFileHandle != nullptr)
+    {
+        CloseHandle(mFileHandle);
+    }
+    mData          = nullptr;
+    mSize          = 0;
+    mOpen          = false;
+    mMappingHandle = nullptr;
+    mFileHandle    = nullptr;
+}
+
+#else
+
+bool Player::MappedFile::open(const std::filesystem::path& path)
+{
+    close();
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat info{};
+    if (fstat(fd, &info) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+    mOpen = true;
+    if (info.st_size > 0)
+    {
+        void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (view == MAP_FAILED)
+        {
+            mOpen = false;
+        }
+        else
+        {
+            madvise(view, static_cast<size_t>(info.st_size), MADV_SEQUENTIAL);
+            mData = static_cast<const uint8_t*>(view);
+            mSize = static_cast<size_t>(info.st_size);
+        }
+    }
+    // The mapping stays valid after the descriptor is closed
+    ::close(fd);
+    return mOpen;
+}
+
+void Player::MappedFile::close()
+{
+    if (mData != nullptr)
+    {
+        munmap(const_cast<uint8_t*>(mData), mSize);
+    }
+    mData = nullptr;
+    mSize = 0;
+    mOpen = false;
+}
+
+#endif
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace Player
+{
+
+	/// @brief Read-only memory mapping of a whole file (MapViewOfFile on Windows, mmap elsewhere).
+	///        Pages are faulted in on first touch, so opening is O(1) whatever the file size.
+	class MappedFile
+	{
+	public:
+		MappedFile() = default;
+		~MappedFile();
+
+		MappedFile(const MappedFile&)            = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		/// @brief map path, returns false if it cannot be opened. An empty file opens with size() == 0.
+		bool open(const std::filesystem::path& path);
+		void close();
+
+		bool           isOpen() const { return mOpen; }
+		const uint8_t* data() const { return mData; }
+		size_t         size() const { return mSize; }
+
+	private:
+		const uint8_t* mData = nullptr;
+		size_t         mSize = 0;
+		bool           mOpen = false;
+#ifdef _WIN32
+		void* mFileHandle    = nullptr;
+		void* mMappingHandle = nullptr;
+#endif
+	};
+
+}
@@ -0,0 +1,769 @@
+#include "MetadataStore.h"
+#include "MappedFile.h"
+#include "Profiler.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+namespace
+{
+    constexpr char   FILE_MAGIC[8]     = {'M', 'P', '3', 'M', 'D', 'B', '0', '1'};
+    constexpr size_t RECORD_FIXED_SIZE = 40;
+    constexpr size_t MAX_FIELD_LENGTH  = 0xFFFF;
+    constexpr char   FIELD_SEPARATOR   = '\x1f';
+
+    // Below this many candidates the substring check is cheaper than intersecting more posting lists
+    constexpr size_t SHORT_CANDIDATE_LIST = 256;
+
+    // Tracks added after the last index build are scanned directly until there are this many
+    constexpr size_t UNINDEXED_TAIL_MIN = 4096;
+
+    // Old path table slots moved per insert while the table grows; the move has to finish before the new table
+    // is half full, which takes as many inserts as the old table has slots / 2
+    constexpr size_t PATH_SLOTS_MIGRATED_PER_INSERT = 8;
+
+    template <typename T>
+    T readValue(const uint8_t* data)
+    {
+        T value;
+        memcpy(&value, data, sizeof(T));
+        return value;
+    }
+
+    template <typename T>
+    void writeValue(std::vector<char>& out, T value)
+    {
+        const char* bytes = reinterpret_cast<const char*>(&value);
+        out.insert(out.end(), bytes, bytes + sizeof(T));
+    }
+
+    char toLowerAscii(char c)
+    {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+
+    void appendLowered(std::vector<char>& out, std::string_view text)
+    {
+        out.push_back(' ');
+        for (char c : text)
+        {
+            out.push_back(c == FIELD_SEPARATOR ? ' ' : toLowerAscii(c));
+        }
+    }
+
+    std::string_view clampField(std::string_view text)
+    {
+        return text.substr(0, std::min(text.size(), MAX_FIELD_LENGTH));
+    }
+}
+
+Player::MetadataStore::~MetadataStore()
+{
+    flush();
+    // The worker is joined before the members it never touches go away; a build still running is waited for
+    mIndexWorker.reset();
+}
+
+bool Player::MetadataStore::open(const std::filesystem::path& path)
+{
+    MP3_PROFILE_SCOPE("library.open");
+    close();
+    mPath = path;
+
+    bool needsRewrite = false;
+    {
+        MappedFile mapped;
+        if (mapped.open(path) && mapped.size() > 0)
+        {
+            size_t validBytes = 0;
+            if (!parse(mapped.data(), mapped.size(), validBytes))
+            {
+                // Not one of ours; leave it alone rather than appending to it
+                mPath.clear();
+                return false;
+            }
+            // A torn final record (crash mid-append) or a log that is mostly dead records gets rewritten
+            needsRewrite = validBytes < mapped.size() || mSupersededCount > getLiveCount();
+            rebuildIndex();
+        }
+        else
+        {
+            needsRewrite = true;
+        }
+    }
+
+    if (needsRewrite)
+    {
+        return compact();
+    }
+    mWriter.open(mPath, std::ios::binary | std::ios::app);
+    return mWriter.good();
+}
+
+void Player::MetadataStore::close()
+{
+    flush();
+    mWriter.close();
+    mPath.clear();
+    mEntries.clear();
+    mText.clear();
+    mSearchText.clear();
+    mSupersededCount = 0;
+    mPathSlots.clear();
+    mOldPathSlots.clear();
+    mPathSlotsUsed     = 0;
+    mPathSlotsMigrated = 0;
+    mIndex.reset();
+    // A build still running owns its own copy of the blocks; its result is dropped
+    mPendingIndex.reset();
+}
+
+uint32_t Player::MetadataStore::put(const TrackInfo_t& track)
+{
+    Entry_t values;
+    values.modifiedTime    = track.modifiedTime;
+    values.fileSize        = track.fileSize;
+    values.durationSeconds = track.durationSeconds;
+    values.bitrateKbps     = track.bitrateKbps;
+    values.loudnessLufs    = track.loudnessLufs;
+    const uint32_t id      = insert(track.path, track.title, track.artist, track.album, values);
+    if (mWriter.is_open())
+    {
+        serialize(id, mPendingWrites);
+    }
+
+    // Rebuilding costs about as much as scanning the whole store once, so only start one once the directly
+    // scanned tail is a sizeable fraction of the indexed part. It runs on the worker; until it is done the
+    // tail keeps growing and is scanned directly.
+    adoptIndex();
+    if (!mPendingIndex)
+    {
+        const size_t indexed   = mIndex ? mIndex->count : 0;
+        const size_t unindexed = mEntries.size() - indexed;
+        if (unindexed >= std::max<size_t>(UNINDEXED_TAIL_MIN, indexed / 16))
+        {
+            startIndexBuild();
+        }
+    }
+    return id;
+}
+
+void Player::MetadataStore::flush()
+{
+    if (mWriter.is_open() && !mPendingWrites.empty())
+    {
+        mWriter.write(mPendingWrites.data(), static_cast<std::streamsize>(mPendingWrites.size()));
+        mWriter.flush();
+    }
+    mPendingWrites.clear();
+}
+
+bool Player::MetadataStore::compact()
+{
+    if (mPath.empty())
+    {
+        return false;
+    }
+    MP3_PROFILE_SCOPE("library.compact");
+    flush();
+    mWriter.close();
+
+    std::vector<char> buffer(std::begin(FILE_MAGIC), std::end(FILE_MAGIC));
+    for (uint32_t id = 0; id < mEntries.size(); ++id)
+    {
+        if (!mEntries[id].superseded)
+        {
+            serialize(id, buffer);
+        }
+    }
+
+    // Write beside the original and swap, so a crash never leaves a half-written store
+    std::filesystem::path temporary = mPath;
+    temporary += ".tmp";
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        if (!out.good())
+        {
+            return false;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(temporary, mPath, error);
+    if (error)
+    {
+        return false;
+    }
+    mWriter.open(mPath, std::ios::binary | std::ios::app);
+    return mWriter.good();
+}
+
+uint32_t Player::MetadataStore::find(std::string_view path) const
+{
+    if (mPathSlots.empty())
+    {
+        return NOT_FOUND;
+    }
+    const uint64_t hash = hashPath(path);
+    const uint32_t id   = findPathSlot(mPathSlots, path, hash);
+    return id == NOT_FOUND && !mOldPathSlots.empty() ? findPathSlot(mOldPathSlots, path, hash) : id;
+}
+
+uint32_t Player::MetadataStore::find(std::string_view path, int64_t modifiedTime) const
+{
+    const uint32_t id = find(path);
+    return (id != NOT_FOUND && mEntries[id].modifiedTime == modifiedTime) ? id : NOT_FOUND;
+}
+
+std::vector<uint32_t> Player::MetadataStore::search(std::string_view query, size_t maxResults) const
+{
+    MP3_PROFILE_SCOPE("library.search");
+    std::vector<uint32_t> results;
+
+    std::string lowered;
+    lowered.reserve(query.size() + 1);
+    for (char c : query)
+    {
+        lowered.push_back(toLowerAscii(c));
+    }
+    if (lowered.empty() || maxResults == 0)
+    {
+        return results;
+    }
+    if (lowered.size() < 3)
+    {
+        // Every field and word starts after a space, so " q" is a word-prefix match
+        lowered.insert(lowered.begin(), ' ');
+    }
+
+    const TrigramIndex_t* index        = getIndex();
+    const uint32_t        indexedCount = index ? index->count : 0;
+    if (indexedCount > 0)
+    {
+        // Posting lists for every trigram of the query; a one-letter prefix uses its word-start bucket
+        std::vector<std::pair<const uint32_t*, const uint32_t*>> postings;
+        auto addBucket = [index, &postings](uint32_t bucket)
+        {
+            postings.emplace_back(index->ids.data() + index->offsets[bucket],
+                                  index->ids.data() + index->offsets[bucket + 1]);
+            return postings.back().first != postings.back().second;
+        };
+        bool possible = true;
+        if (lowered.size() == 2)
+        {
+            possible = addBucket(getTrigramBucket(' ', static_cast<uint8_t>(lowered[1]), 0));
+        }
+        for (size_t index = 0; possible && index + 3 <= lowered.size(); ++index)
+        {
+            possible = addBucket(getTrigramBucket(static_cast<uint8_t>(lowered[index]),
+                                                  static_cast<uint8_t>(lowered[index + 1]),
+                                                  static_cast<uint8_t>(lowered[index + 2])));
+        }
+
+        if (possible)
+        {
+            std::sort(postings.begin(),
+                      postings.end(),
+                      [](const auto& a, const auto& b) { return (a.second - a.first) < (b.second - b.first); });
+
+            // Intersect until the candidate set is small, then let the substring check do the rest
+            const uint32_t*       candidatesBegin = postings.front().first;
+            const uint32_t*       candidatesEnd   = postings.front().second;
+            std::vector<uint32_t> intersection;
+            std::vector<uint32_t> scratch;
+            for (size_t list = 1; list < postings.size() &&
+                                  static_cast<size_t>(candidatesEnd - candidatesBegin) > SHORT_CANDIDATE_LIST;
+                 ++list)
+            {
+                scratch.clear();
+                std::set_intersection(candidatesBegin,
+                                      candidatesEnd,
+                                      postings[list].first,
+                                      postings[list].second,
+                                      std::back_inserter(scratch));
+                intersection.swap(scratch);
+                candidatesBegin = intersection.data();
+                candidatesEnd   = intersection.data() + intersection.size();
+            }
+
+            for (const uint32_t* id = candidatesBegin; id != candidatesEnd && results.size() < maxResults; ++id)
+            {
+                if (matches(*id, lowered))
+                {
+                    results.push_back(*id);
+                }
+            }
+        }
+    }
+
+    // Tracks added since the index in use was started
+    for (uint32_t id = indexedCount; id < mEntries.size() && results.size() < maxResults; ++id)
+    {
+        if (matches(id, lowered))
+        {
+            results.push_back(id);
+        }
+    }
+    return results;
+}
+
+void Player::MetadataStore::rebuildIndex()
+{
+    auto index = std::make_shared<TrigramIndex_t>();
+    buildIndex(mSearchText,
+               mSearchText.empty() ? 0 : mSearchText.back()->used,
+               static_cast<uint32_t>(mEntries.size()),
+               *index);
+    index->ready.store(true, std::memory_order_release);
+    mIndex = std::move(index);
+    mPendingIndex.reset();
+}
+
+void Player::MetadataStore::startIndexBuild()
+{
+    if (!mIndexWorker)
+    {
+        mIndexWorker = std::make_unique<ThreadPool>(1);
+    }
+    // The task gets its own references to the blocks and to the result, so close() can drop both at any time
+    auto           index    = std::make_shared<TrigramIndex_t>();
+    const size_t   lastUsed = mSearchText.empty() ? 0 : mSearchText.back()->used;
+    const uint32_t count    = static_cast<uint32_t>(mEntries.size());
+    mPendingIndex           = index;
+    mIndexWorker->submit(
+        [blocks = mSearchText, lastUsed, count, index]
+        {
+            buildIndex(blocks, lastUsed, count, *index);
+            index->ready.store(true, std::memory_order_release);
+        });
+}
+
+void Player::MetadataStore::adoptIndex()
+{
+    if (mPendingIndex && mPendingIndex->ready.load(std::memory_order_acquire))
+    {
+        mIndex = std::move(mPendingIndex);
+        mPendingIndex.reset();
+    }
+}
+
+const Player::MetadataStore::TrigramIndex_t* Player::MetadataStore::getIndex() const
+{
+    // search() is const, so a finished build is used from here until the next put() adopts it
+    if (mPendingIndex && mPendingIndex->ready.load(std::memory_order_acquire))
+    {
+        return mPendingIndex.get();
+    }
+    return mIndex.get();
+}
+
+void Player::MetadataStore::buildIndex(const TextBlocks_t& blocks,
+                                       size_t              lastUsed,
+                                       uint32_t            count,
+                                       TrigramIndex_t&     index)
+{
+    MP3_PROFILE_SCOPE("library.index");
+    const size_t bucketCount = size_t{1} << TRIGRAM_BUCKET_BITS;
+    const size_t threadCount = std::clamp<size_t>(count / 16384, 1, ThreadPool::getDefaultThreadCount());
+
+    // Records are in id order, so walking the blocks finds the text of every id. Only the last block still
+    // grows; its records past lastUsed were added after the build started.
+    std::vector<std::pair<const uint8_t*, uint32_t>> records;
+    records.reserve(count);
+    for (size_t block = 0; block < blocks.size() && records.size() < count; ++block)
+    {
+        const char*  bytes = blocks[block]->bytes.get();
+        const size_t used  = block + 1 == blocks.size() ? lastUsed : blocks[block]->used;
+        for (size_t position = 0; position < used && records.size() < count;)
+        {
+            const uint32_t length = readValue<uint32_t>(reinterpret_cast<const uint8_t*>(bytes + position));
+            position += sizeof(uint32_t);
+            records.emplace_back(reinterpret_cast<const uint8_t*>(bytes + position), length);
+            position += length;
+        }
+    }
+
+    // Parallel counting sort: each thread owns a contiguous id range, so concatenating the ranges per bucket
+    // keeps every posting list in ascending id order
+    std::vector<std::vector<uint32_t>> cursors(threadCount, std::vector<uint32_t>(bucketCount, 0));
+    auto runChunks = [&](auto&& perBucket)
+    {
+        std::vector<std::thread> workers;
+        for (size_t chunk = 0; chunk < threadCount; ++chunk)
+        {
+            workers.emplace_back(
+                [&, chunk]
+                {
+                    std::vector<uint32_t> buckets;
+                    std::vector<uint32_t> lastSeen(bucketCount, NOT_FOUND);
+                    const uint32_t        first = static_cast<uint32_t>(count * chunk / threadCount);
+                    const uint32_t        last  = static_cast<uint32_t>(count * (chunk + 1) / threadCount);
+                    for (uint32_t id = first; id < last; ++id)
+                    {
+                        collectBuckets(records[id].first, records[id].second, id, buckets, lastSeen);
+                        for (uint32_t bucket : buckets)
+                        {
+                            perBucket(cursors[chunk][bucket], id);
+                        }
+                    }
+                });
+        }
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+    };
+
+    runChunks([](uint32_t& counter, uint32_t) { ++counter; });
+
+    index.offsets.assign(bucketCount + 1, 0);
+    uint64_t total = 0;
+    for (size_t bucket = 0; bucket < bucketCount; ++bucket)
+    {
+        index.offsets[bucket] = static_cast<uint32_t>(total);
+        for (size_t chunk = 0; chunk < threadCount; ++chunk)
+        {
+            const uint32_t chunkCount = cursors[chunk][bucket];
+            cursors[chunk][bucket]    = static_cast<uint32_t>(total);
+            total += chunkCount;
+        }
+    }
+    index.offsets[bucketCount] = static_cast<uint32_t>(total);
+    index.ids.resize(total);
+
+    uint32_t* ids = index.ids.data();
+    runChunks([ids](uint32_t& cursor, uint32_t id) { ids[cursor++] = id; });
+    index.count = count;
+}
+
+std::string_view Player::MetadataStore::getPath(uint32_t id) const
+{
+    return getField(id, 0, mEntries[id].pathLength);
+}
+
+std::string_view Player::MetadataStore::getTitle(uint32_t id) const
+{
+    const Entry_t& entry = mEntries[id];
+    return getField(id, entry.pathLength, entry.titleLength);
+}
+
+std::string_view Player::MetadataStore::getArtist(uint32_t id) const
+{
+    const Entry_t& entry = mEntries[id];
+    return getField(id, entry.pathLength + entry.titleLength, entry.artistLength);
+}
+
+std::string_view Player::MetadataStore::getAlbum(uint32_t id) const
+{
+    const Entry_t& entry = mEntries[id];
+    return getField(id, entry.pathLength + entry.titleLength + entry.artistLength, entry.albumLength);
+}
+
+std::string_view Player::MetadataStore::getField(uint32_t id, size_t skip, size_t length) const
+{
+    return {getText(mText, mEntries[id].textOffset) + skip, length};
+}
+
+Player::TrackInfo_t Player::MetadataStore::getTrack(uint32_t id) const
+{
+    const Entry_t& entry = mEntries[id];
+    TrackInfo_t    track;
+    track.path            = std::string(getPath(id));
+    track.title           = std::string(getTitle(id));
+    track.artist          = std::string(getArtist(id));
+    track.album           = std::string(getAlbum(id));
+    track.modifiedTime    = entry.modifiedTime;
+    track.fileSize        = entry.fileSize;
+    track.durationSeconds = entry.durationSeconds;
+    track.bitrateKbps     = entry.bitrateKbps;
+    track.loudnessLufs    = entry.loudnessLufs;
+    return track;
+}
+
+uint32_t Player::MetadataStore::insert(std::string_view path,
+                                      std::string_view title,
+                                      std::string_view artist,
+                                      std::string_view album,
+                                      const Entry_t&   values)
+{
+    path   = clampField(path);
+    title  = clampField(title);
+    artist = clampField(artist);
+    album  = clampField(album);
+
+    const uint32_t previous = find(path);
+    if (previous != NOT_FOUND)
+    {
+        mEntries[previous].superseded = true;
+        ++mSupersededCount;
+    }
+
+    Entry_t entry      = values;
+    entry.pathHash     = hashPath(path);
+    entry.pathLength   = static_cast<uint16_t>(path.size());
+    entry.titleLength  = static_cast<uint16_t>(title.size());
+    entry.artistLength = static_cast<uint16_t>(artist.size());
+    entry.albumLength  = static_cast<uint16_t>(album.size());
+    entry.superseded   = false;
+    char* text = allocateText(mText, path.size() + title.size() + artist.size() + album.size(), entry.textOffset);
+    for (std::string_view field : {path, title, artist, album})
+    {
+        text = std::copy(field.begin(), field.end(), text);
+    }
+
+    // Untagged files are searchable by their file name
+    std::string_view searchTitle = title;
+    if (searchTitle.empty())
+    {
+        const size_t separator = path.find_last_of("/\\");
+        searchTitle            = separator == std::string_view::npos ? path : path.substr(separator + 1);
+    }
+    entry.searchOffset = appendSearchText(searchTitle, artist, album);
+    entry.searchLength = static_cast<uint32_t>(mSearchRecord.size());
+
+    const uint32_t id = static_cast<uint32_t>(mEntries.size());
+    mEntries.push_back(entry);
+    insertPathSlot(id);
+    return id;
+}
+
+void Player::MetadataStore::insertPathSlot(uint32_t id)
+{
+    // Keep the table at most half full
+    if ((mPathSlotsUsed + 1) * 2 > mPathSlots.size())
+    {
+        migratePathSlots(mOldPathSlots.size());
+        mOldPathSlots.swap(mPathSlots);
+        mPathSlots.assign(std::max<size_t>(1024, mOldPathSlots.size() * 2), NOT_FOUND);
+        mPathSlotsUsed     = 0;
+        mPathSlotsMigrated = 0;
+    }
+    placePathSlot(id);
+    migratePathSlots(PATH_SLOTS_MIGRATED_PER_INSERT);
+}
+
+void Player::MetadataStore::placePathSlot(uint32_t id)
+{
+    const Entry_t&   entry = mEntries[id];
+    const size_t     mask  = mPathSlots.size() - 1;
+    std::string_view path  = getPath(id);
+    for (size_t slot = entry.pathHash & mask;; slot = (slot + 1) & mask)
+    {
+        const uint32_t current = mPathSlots[slot];
+        if (current == NOT_FOUND)
+        {
+            mPathSlots[slot] = id;
+            ++mPathSlotsUsed;
+            return;
+        }
+        if (mEntries[current].pathHash == entry.pathHash && getPath(current) == path)
+        {
+            // Same path: the newer record takes over the slot
+            mPathSlots[slot] = id;
+            return;
+        }
+    }
+}
+
+void Player::MetadataStore::migratePathSlots(size_t count)
+{
+    for (; count > 0 && mPathSlotsMigrated < mOldPathSlots.size(); --count, ++mPathSlotsMigrated)
+    {
+        // A record superseded since the table grew already has its successor in the new table
+        const uint32_t existing = mOldPathSlots[mPathSlotsMigrated];
+        if (existing != NOT_FOUND && !mEntries[existing].superseded)
+        {
+            placePathSlot(existing);
+        }
+    }
+    if (!mOldPathSlots.empty() && mPathSlotsMigrated == mOldPathSlots.size())
+    {
+        std::vector<uint32_t>().swap(mOldPathSlots);
+    }
+}
+
+uint32_t Player::MetadataStore::findPathSlot(const std::vector<uint32_t>& slots,
+                                             std::string_view             path,
+                                             uint64_t                     hash) const
+{
+    const size_t mask = slots.size() - 1;
+    for (size_t slot = hash & mask; slots[slot] != NOT_FOUND; slot = (slot + 1) & mask)
+    {
+        const uint32_t id = slots[slot];
+        if (mEntries[id].pathHash == hash && getPath(id) == path)
+        {
+            return id;
+        }
+    }
+    return NOT_FOUND;
+}
+
+uint64_t Player::MetadataStore::appendSearchText(std::string_view title,
+                                                 std::string_view artist,
+                                                 std::string_view album)
+{
+    mSearchRecord.clear();
+    appendLowered(mSearchRecord, title);
+    mSearchRecord.push_back(FIELD_SEPARATOR);
+    appendLowered(mSearchRecord, artist);
+    mSearchRecord.push_back(FIELD_SEPARATOR);
+    appendLowered(mSearchRecord, album);
+
+    const uint32_t length = static_cast<uint32_t>(mSearchRecord.size());
+    uint64_t       offset = 0;
+    char*          record = allocateText(mSearchText, sizeof(length) + length, offset);
+    memcpy(record, &length, sizeof(length));
+    memcpy(record + sizeof(length), mSearchRecord.data(), length);
+    return offset + sizeof(length);
+}
+
+char* Player::MetadataStore::allocateText(TextBlocks_t& blocks, size_t size, uint64_t& offset)
+{
+    // Four clamped fields make at most 256 KiB, so a record always fits in a fresh block
+    if (blocks.empty() || blocks.back()->used + size > TEXT_BLOCK_SIZE)
+    {
+        auto block   = std::make_shared<TextBlock_t>();
+        block->bytes = std::make_unique_for_overwrite<char[]>(TEXT_BLOCK_SIZE);
+        blocks.push_back(std::move(block));
+    }
+    TextBlock_t& block = *blocks.back();
+    offset             = ((blocks.size() - 1) << TEXT_BLOCK_BITS) | block.used;
+    char* bytes        = block.bytes.get() + block.used;
+    block.used += size;
+    return bytes;
+}
+
+const char* Player::MetadataStore::getText(const TextBlocks_t& blocks, uint64_t offset)
+{
+    return blocks[offset >> TEXT_BLOCK_BITS]->bytes.get() + (offset & (TEXT_BLOCK_SIZE - 1));
+}
+
+void Player::MetadataStore::collectBuckets(const uint8_t*         text,
+                                           uint32_t               length,
+                                           uint32_t               id,
+                                           std::vector<uint32_t>& buckets,
+                                           std::vector<uint32_t>& lastSeen)
+{
+    // lastSeen[bucket] == id marks a bucket already taken for this record, so each posting list holds an id once
+    auto add = [&](uint32_t bucket)
+    {
+        if (lastSeen[bucket] != id)
+        {
+            lastSeen[bucket] = id;
+            buckets.push_back(bucket);
+        }
+    };
+
+    buckets.clear();
+    for (uint32_t index = 0; index + 2 <= length; ++index)
+    {
+        const uint8_t a = text[index];
+        const uint8_t b = text[index + 1];
+        if (a == FIELD_SEPARATOR || b == FIELD_SEPARATOR)
+        {
+            continue;
+        }
+        if (a == ' ' && b != ' ')
+        {
+            // Word start, for one-letter prefix queries
+            add(getTrigramBucket(' ', b, 0));
+        }
+        if (index + 3 <= length && text[index + 2] != FIELD_SEPARATOR)
+        {
+            add(getTrigramBucket(a, b, text[index + 2]));
+        }
+    }
+}
+
+bool Player::MetadataStore::parse(const uint8_t* data, size_t size, size_t& validBytes)
+{
+    MP3_PROFILE_SCOPE("library.parse");
+    validBytes = 0;
+    if (size < sizeof(FILE_MAGIC) || memcmp(data, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0)
+    {
+        return false;
+    }
+
+    size_t position = sizeof(FILE_MAGIC);
+    while (position + RECORD_FIXED_SIZE <= size)
+    {
+        const uint8_t* record       = data + position;
+        const uint32_t recordBytes  = readValue<uint32_t>(record);
+        const uint16_t pathLength   = readValue<uint16_t>(record + 32);
+        const uint16_t titleLength  = readValue<uint16_t>(record + 34);
+        const uint16_t artistLength = readValue<uint16_t>(record + 36);
+        const uint16_t albumLength  = readValue<uint16_t>(record + 38);
+        if (recordBytes != RECORD_FIXED_SIZE + pathLength + titleLength + artistLength + albumLength ||
+            position + recordBytes > size)
+        {
+            break;
+        }
+
+        Entry_t values;
+        values.modifiedTime    = readValue<int64_t>(record + 4);
+        values.fileSize        = readValue<uint64_t>(record + 12);
+        values.durationSeconds = readValue<float>(record + 20);
+        values.bitrateKbps     = readValue<uint32_t>(record + 24);
+        values.loudnessLufs    = readValue<float>(record + 28);
+
+        const char* strings = reinterpret_cast<const char*>(record + RECORD_FIXED_SIZE);
+        insert({strings, pathLength},
+               {strings + pathLength, titleLength},
+               {strings + pathLength + titleLength, artistLength},
+               {strings + pathLength + titleLength + artistLength, albumLength},
+               values);
+
+        position += recordBytes;
+    }
+    validBytes = position;
+    return true;
+}
+
+void Player::MetadataStore::serialize(uint32_t id, std::vector<char>& out) const
+{
+    const Entry_t& entry       = mEntries[id];
+    const uint32_t stringBytes = entry.pathLength + entry.titleLength + entry.artistLength + entry.albumLength;
+    writeValue<uint32_t>(out, static_cast<uint32_t>(RECORD_FIXED_SIZE + stringBytes));
+    writeValue<int64_t>(out, entry.modifiedTime);
+    writeValue<uint64_t>(out, entry.fileSize);
+    writeValue<float>(out, entry.durationSeconds);
+    writeValue<uint32_t>(out, entry.bitrateKbps);
+    writeValue<float>(out, entry.loudnessLufs);
+    writeValue<uint16_t>(out, entry.pathLength);
+    writeValue<uint16_t>(out, entry.titleLength);
+    writeValue<uint16_t>(out, entry.artistLength);
+    writeValue<uint16_t>(out, entry.albumLength);
+    const char*    strings     = getText(mText, entry.textOffset);
+    out.insert(out.end(), strings, strings + stringBytes);
+}
+
+bool Player::MetadataStore::matches(uint32_t id, std::string_view loweredQuery) const
+{
+    const Entry_t& entry = mEntries[id];
+    if (entry.superseded)
+    {
+        return false;
+    }
+    const std::string_view text(getText(mSearchText, entry.searchOffset), entry.searchLength);
+    return text.find(loweredQuery) != std::string_view::npos;
+}
+
+uint64_t Player::MetadataStore::hashPath(std::string_view path)
+{
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ULL;
+    for (char c : path)
+    {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+uint32_t Player::MetadataStore::getTrigramBucket(uint8_t a, uint8_t b, uint8_t c)
+{
+    const uint32_t key = (static_cast<uint32_t>(a) << 16) | (static_cast<uint32_t>(b) << 8) | c;
+    return (key * 2654435761U) >> (32 - TRIGRAM_BUCKET_BITS);
+}
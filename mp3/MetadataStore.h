@@ -0,0 +1,191 @@
+#pragma once
+
+#include "ThreadPool.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Player
+{
+
+	// One track as handed to the store
+	struct TrackInfo_t
+	{
+		std::string path;
+		std::string title;
+		std::string artist;
+		std::string album;
+		int64_t     modifiedTime    = 0;  // opaque file timestamp, compared for equality only
+		uint64_t    fileSize        = 0;
+		float       durationSeconds = 0.0F;
+		uint32_t    bitrateKbps     = 0;
+		float       loudnessLufs    = 0.0F;  // 0 when not measured
+	};
+
+	/// @brief Persistent track metadata keyed by path + modification time.
+	///        On disk it is an append-only log of variable-size records; a newer record for the same path
+	///        supersedes the older one and compact() drops the dead ones. Loading maps the file and copies the
+	///        strings into fixed-size blocks, so adding a track never moves what is already stored. Search goes
+	///        through a trigram index held as flat posting lists. Once enough tracks have been added since the last
+	///        build, put() starts a rebuild on a worker and the newer tracks are scanned directly until the finished
+	///        index is swapped in.
+	class MetadataStore
+	{
+	public:
+		static constexpr uint32_t NOT_FOUND = 0xFFFFFFFF;
+
+		MetadataStore() = default;
+		~MetadataStore();
+
+		MetadataStore(const MetadataStore&)            = delete;
+		MetadataStore& operator=(const MetadataStore&) = delete;
+
+		/// @brief load path (created if missing) and keep it open for appends, returns false on I/O errors
+		bool open(const std::filesystem::path& path);
+		void close();
+
+		/// @brief add or replace a track. Appended to the file when one is open (buffered until flush()).
+		uint32_t put(const TrackInfo_t& track);
+		void     flush();
+
+		/// @brief rewrite the file without superseded records
+		bool compact();
+
+		/// @brief index every record now, on the calling thread, instead of waiting for the unindexed tail to grow
+		void rebuildIndex();
+
+		/// @brief true while a background index build is running
+		bool isIndexing() const { return mPendingIndex && !mPendingIndex->ready.load(std::memory_order_acquire); }
+
+		/// @brief id of the live record for path, or NOT_FOUND
+		uint32_t find(std::string_view path) const;
+
+		/// @brief id of the live record for path if it was stored with the same modification time
+		uint32_t find(std::string_view path, int64_t modifiedTime) const;
+
+		/// @brief case-insensitive search in title, artist and album. Queries of three or more characters
+		///        match anywhere, shorter ones match the start of a word. Results are in insertion order.
+		std::vector<uint32_t> search(std::string_view query, size_t maxResults) const;
+
+		size_t getRecordCount() const { return mEntries.size(); }
+		size_t getLiveCount() const { return mEntries.size() - mSupersededCount; }
+
+		std::string_view getPath(uint32_t id) const;
+		std::string_view getTitle(uint32_t id) const;
+		std::string_view getArtist(uint32_t id) const;
+		std::string_view getAlbum(uint32_t id) const;
+		int64_t          getModifiedTime(uint32_t id) const { return mEntries[id].modifiedTime; }
+		uint64_t         getFileSize(uint32_t id) const { return mEntries[id].fileSize; }
+		float            getDuration(uint32_t id) const { return mEntries[id].durationSeconds; }
+		uint32_t         getBitrate(uint32_t id) const { return mEntries[id].bitrateKbps; }
+		float            getLoudness(uint32_t id) const { return mEntries[id].loudnessLufs; }
+		bool             isSuperseded(uint32_t id) const { return mEntries[id].superseded; }
+
+		TrackInfo_t getTrack(uint32_t id) const;
+
+	private:
+		struct Entry_t
+		{
+			uint64_t pathHash        = 0;
+			uint64_t textOffset      = 0;  // path, title, artist, album back to back in mText
+			uint64_t searchOffset    = 0;  // lower-cased " title\x1f artist\x1f album" in mSearchText
+			uint32_t searchLength    = 0;
+			uint16_t pathLength      = 0;
+			uint16_t titleLength     = 0;
+			uint16_t artistLength    = 0;
+			uint16_t albumLength     = 0;
+			int64_t  modifiedTime    = 0;
+			uint64_t fileSize        = 0;
+			float    durationSeconds = 0.0F;
+			uint32_t bitrateKbps     = 0;
+			float    loudnessLufs    = 0.0F;
+			bool     superseded      = false;
+		};
+
+		uint32_t insert(std::string_view path,
+		                std::string_view title,
+		                std::string_view artist,
+		                std::string_view album,
+		                const Entry_t&   values);
+		void     insertPathSlot(uint32_t id);
+		void     placePathSlot(uint32_t id);
+		void     migratePathSlots(size_t count);
+		uint32_t findPathSlot(const std::vector<uint32_t>& slots, std::string_view path, uint64_t hash) const;
+		uint64_t appendSearchText(std::string_view title, std::string_view artist, std::string_view album);
+		std::string_view getField(uint32_t id, size_t skip, size_t length) const;
+		void     startIndexBuild();
+		void     adoptIndex();
+		bool     parse(const uint8_t* data, size_t size, size_t& validBytes);
+		void     serialize(uint32_t id, std::vector<char>& out) const;
+		bool     matches(uint32_t id, std::string_view loweredQuery) const;
+
+		// Strings live in fixed-size blocks that never move: growing never copies the store on the frame thread,
+		// and an index build reads the search records it was started with while put() appends behind them. An
+		// offset is block << TEXT_BLOCK_BITS | position; a record never spans blocks.
+		struct TextBlock_t
+		{
+			std::unique_ptr<char[]> bytes;
+			size_t                  used = 0;
+		};
+		using TextBlocks_t = std::vector<std::shared_ptr<TextBlock_t>>;
+
+		// Posting lists for ids below count: ids of bucket b are ids[offsets[b], offsets[b + 1]). Superseded
+		// records stay in the lists; matches() skips them.
+		struct TrigramIndex_t
+		{
+			std::vector<uint32_t> offsets;
+			std::vector<uint32_t> ids;
+			uint32_t              count = 0;
+			std::atomic<bool>     ready{false};
+		};
+
+		const TrigramIndex_t* getIndex() const;
+
+		static char*       allocateText(TextBlocks_t& blocks, size_t size, uint64_t& offset);
+		static const char* getText(const TextBlocks_t& blocks, uint64_t offset);
+		static void buildIndex(const TextBlocks_t& blocks, size_t lastUsed, uint32_t count, TrigramIndex_t& index);
+		static void collectBuckets(const uint8_t*         text,
+		                           uint32_t               length,
+		                           uint32_t               id,
+		                           std::vector<uint32_t>& buckets,
+		                           std::vector<uint32_t>& lastSeen);
+
+		static uint64_t hashPath(std::string_view path);
+		static uint32_t getTrigramBucket(uint8_t a, uint8_t b, uint8_t c);
+
+		static constexpr uint32_t TRIGRAM_BUCKET_BITS = 18;
+		static constexpr uint32_t TEXT_BLOCK_BITS     = 20;
+		static constexpr size_t   TEXT_BLOCK_SIZE     = size_t{1} << TEXT_BLOCK_BITS;
+
+		std::deque<Entry_t> mEntries;
+		TextBlocks_t        mText;
+		TextBlocks_t        mSearchText;    // [u32 length][text] per record, in id order
+		std::vector<char>   mSearchRecord;  // scratch for the record being appended
+		size_t              mSupersededCount = 0;
+
+		// Open-addressed path -> live id table; a newer record for a path takes over its slot. When it grows the
+		// old table is moved over a few slots per insert rather than all at once; find() looks in both meanwhile.
+		std::vector<uint32_t> mPathSlots;
+		std::vector<uint32_t> mOldPathSlots;
+		size_t                mPathSlotsUsed     = 0;
+		size_t                mPathSlotsMigrated = 0;
+
+		// mIndex serves searches until mPendingIndex, built on mIndexWorker, is ready and takes its place
+		std::shared_ptr<const TrigramIndex_t> mIndex;
+		std::shared_ptr<TrigramIndex_t>       mPendingIndex;
+		std::unique_ptr<ThreadPool>           mIndexWorker;
+
+		std::filesystem::path mPath;
+		std::ofstream         mWriter;
+		std::vector<char>     mPendingWrites;
+	};
+
+}
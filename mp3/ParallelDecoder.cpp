@@ -0,0 +1,149 @@
+#include "ParallelDecoder.h"
+#include "BufferPool.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+namespace
+{
+    // Shared between the caller and the helper tasks. Helpers may start after every chunk is taken (even after
+    // decode() returned), so they only touch the stream and output once they have claimed a chunk.
+    struct DecodeJob_t
+    {
+        const Player::MP3Stream_t* stream      = nullptr;
+        int16_t*                   output      = nullptr;
+        const std::atomic<bool>*   cancel      = nullptr;
+        std::atomic<uint64_t>*     bytesDone   = nullptr;
+        size_t                     chunkCount  = 0;
+        size_t                     chunkFrames = 0;
+        std::atomic<size_t>        nextChunk{0};
+        std::atomic<size_t>        doneChunks{0};
+        std::atomic<bool>          failed{false};
+        std::mutex                 lock;
+        std::condition_variable    done;
+    };
+
+    void runChunks(DecodeJob_t& job)
+    {
+        std::unique_ptr<Player::MP3Decoder> decoder;
+        for (size_t chunk = job.nextChunk.fetch_add(1); chunk < job.chunkCount; chunk = job.nextChunk.fetch_add(1))
+        {
+            // A cancelled decode still counts off its remaining chunks, so the caller's wait ends
+            if (job.cancel != nullptr && job.cancel->load(std::memory_order_relaxed))
+            {
+                if (job.doneChunks.fetch_add(1) + 1 == job.chunkCount)
+                {
+                    std::lock_guard<std::mutex> guard(job.lock);
+                    job.done.notify_all();
+                }
+                continue;
+            }
+            MP3_PROFILE_SCOPE("decode.chunk");
+            if (!decoder)
+            {
+                decoder = std::make_unique<Player::MP3Decoder>();
+            }
+            const Player::MP3Stream_t& stream = *job.stream;
+            const size_t frameValues = static_cast<size_t>(stream.format.samplesPerFrame) * stream.format.channels;
+            const size_t first       = chunk * job.chunkFrames;
+            const size_t count       = std::min(job.chunkFrames, stream.frames.size() - first);
+
+            // Chunks write straight into their slice of the output; decodeRange fills rejected frames with silence
+            if (!decoder->isValid())
+            {
+                job.failed = true;
+            }
+            decoder->decodeRange(stream, first, count, job.output + first * frameValues);
+            if (job.bytesDone != nullptr)
+            {
+                const Player::MP3Frame_t& last = stream.frames[first + count - 1];
+                job.bytesDone->fetch_add(last.offset + last.size - stream.frames[first].offset,
+                                         std::memory_order_relaxed);
+            }
+
+            if (job.doneChunks.fetch_add(1) + 1 == job.chunkCount)
+            {
+                std::lock_guard<std::mutex> guard(job.lock);
+                job.done.notify_all();
+            }
+        }
+    }
+}
+
+Player::ParallelDecoder::ParallelDecoder(size_t threadCount)
+    : mThreadCount(threadCount == 0 ? ThreadPool::getDefaultThreadCount() : threadCount)
+{
+    if (mThreadCount > 1)
+    {
+        mPool = std::make_unique<ThreadPool>(mThreadCount - 1);
+    }
+}
+
+Player::ParallelDecoder::~ParallelDecoder() = default;
+
+Player::ParallelDecoder& Player::ParallelDecoder::getShared()
+{
+    static ParallelDecoder shared;
+    return shared;
+}
+
+bool Player::ParallelDecoder::decode(const uint8_t* data, size_t size, DecodedAudio_t& out)
+{
+    MP3Stream_t stream;
+    if (!MP3Decoder::scanFrames(data, size, stream))
+    {
+        return false;
+    }
+    return decode(stream, out);
+}
+
+bool Player::ParallelDecoder::decode(const MP3Stream_t& stream, DecodedAudio_t& out)
+{
+    return decode(stream, out, DecodeControl_t{});
+}
+
+bool Player::ParallelDecoder::decode(const MP3Stream_t& stream, DecodedAudio_t& out, const DecodeControl_t& control)
+{
+    MP3_PROFILE_SCOPE("decode.parallel");
+    const size_t frameCount = stream.frames.size();
+    if (frameCount == 0)
+    {
+        return false;
+    }
+
+    // Several chunks per thread so uneven chunks (VBR, silence) even out, but never below MIN_CHUNK_FRAMES. A
+    // controlled decode takes the smallest chunks, since it only notices a cancel or reports progress between them.
+    const bool   controlled = control.cancel != nullptr || control.bytesDone != nullptr;
+    const size_t maxChunks  = std::max<size_t>(1, frameCount / MIN_CHUNK_FRAMES);
+    const size_t chunkCount = controlled ? maxChunks : std::min(maxChunks, mThreadCount * 4);
+
+    auto job         = std::make_shared<DecodeJob_t>();
+    job->stream      = &stream;
+    job->cancel      = control.cancel;
+    job->bytesDone   = control.bytesDone;
+    job->chunkFrames = (frameCount + chunkCount - 1) / chunkCount;
+    job->chunkCount  = (frameCount + job->chunkFrames - 1) / job->chunkFrames;
+
+    const size_t sampleCount = stream.getSampleFrameCount() * stream.format.channels;
+    PcmBufferPool::getShared().release(std::move(out.samples));
+    out.samples    = PcmBufferPool::getShared().acquire(sampleCount);
+    out.sampleRate = stream.format.sampleRate;
+    out.channels   = stream.format.channels;
+    out.samples.resize(sampleCount);
+    job->output = out.samples.data();
+
+    const size_t helpers = mPool ? std::min(mThreadCount - 1, job->chunkCount - 1) : 0;
+    for (size_t index = 0; index < helpers; ++index)
+    {
+        mPool->submit([job] { runChunks(*job); });
+    }
+    runChunks(*job);
+
+    std::unique_lock<std::mutex> guard(job->lock);
+    job->done.wait(guard, [&job] { return job->doneChunks.load() == job->chunkCount; });
+    return !job->failed && (control.cancel == nullptr || !control.cancel->load(std::memory_order_relaxed));
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "MP3Decoder.h"
+#include "ThreadPool.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Player
+{
+
+	/// @brief Whole-file decode split across threads. The frame index is cut into chunks at frame boundaries;
+	///        each chunk is decoded by its own MP3Decoder through decodeRange, which first decodes the preceding
+	///        frames the bit reservoir and filter state depend on, so the stitched PCM is bit-identical to
+	///        MP3Decoder::decode. Chunks outnumber threads and are claimed from a shared counter, so a thread that
+	///        finishes early simply takes the next chunk. The calling thread decodes chunks too.
+	class ParallelDecoder
+	{
+	public:
+		/// @param threadCount total decoding threads including the caller, 0 picks the hardware concurrency
+		explicit ParallelDecoder(size_t threadCount = 0);
+		~ParallelDecoder();
+
+		ParallelDecoder(const ParallelDecoder&)            = delete;
+		ParallelDecoder& operator=(const ParallelDecoder&) = delete;
+
+		/// @brief progress and cancellation for a decode someone is waiting on, such as a track load
+		struct DecodeControl_t
+		{
+			const std::atomic<bool>* cancel    = nullptr;  // checked before every chunk; the rest are skipped
+			std::atomic<uint64_t>*   bytesDone = nullptr;  // grows by the compressed size of every finished chunk
+		};
+
+		bool decode(const uint8_t* data, size_t size, DecodedAudio_t& out);
+
+		/// @brief decode an already indexed stream
+		bool decode(const MP3Stream_t& stream, DecodedAudio_t& out);
+
+		/// @brief decode with progress and cancellation. Chunks are kept near MIN_CHUNK_FRAMES so both respond
+		///        within a few hundred frames. False if cancelled (the output is then incomplete) or on failure.
+		bool decode(const MP3Stream_t& stream, DecodedAudio_t& out, const DecodeControl_t& control);
+
+		size_t getThreadCount() const { return mThreadCount; }
+
+		/// @brief frames per chunk floor: keeps the priming overhead (a handful of frames per chunk) negligible
+		static constexpr size_t MIN_CHUNK_FRAMES = 256;
+
+		/// @brief process-wide instance sized to the hardware, for callers without their own
+		static ParallelDecoder& getShared();
+
+	private:
+		size_t                      mThreadCount = 1;
+		std::unique_ptr<ThreadPool> mPool;  // mThreadCount - 1 helpers, none when single-threaded
+	};
+
+}
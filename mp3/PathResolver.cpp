@@ -0,0 +1,147 @@
+#include "PathResolver.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <mutex>
+
+Player::PathResolver::PathResolver(std::vector<std::filesystem::path> roots, size_t threadCount)
+    : mRoots(std::move(roots))
+    , mPool(std::make_unique<ThreadPool>(std::max<size_t>(threadCount, 1)))
+{
+}
+
+Player::PathResolver::~PathResolver()
+{
+    // Batches still queued return at once; the pool joins after the one in flight
+    mStopping.store(true, std::memory_order_relaxed);
+    mPool.reset();
+}
+
+void Player::PathResolver::appendSearchList(const std::string& source, std::vector<std::filesystem::path>& candidates) const
+{
+    const std::filesystem::path requested(source);
+    if (requested.is_absolute())
+    {
+        candidates.push_back(requested);
+        return;
+    }
+    for (const std::filesystem::path& root : mRoots)
+    {
+        candidates.push_back(root / requested);
+    }
+}
+
+std::vector<std::filesystem::path> Player::PathResolver::getCandidates(const std::string& source) const
+{
+    std::vector<std::filesystem::path> candidates;
+    {
+        std::shared_lock<std::shared_mutex> guard(mLock);
+        const auto                          entry = mCache.find(source);
+        if (entry != mCache.end())
+        {
+            candidates.push_back(entry->second.resolved);
+        }
+    }
+    // The search list stays behind the cached path in case the file was moved since
+    appendSearchList(source, candidates);
+    return candidates;
+}
+
+std::filesystem::path Player::PathResolver::probe(const std::string& source) const
+{
+    std::vector<std::filesystem::path> candidates;
+    appendSearchList(source, candidates);
+    for (const std::filesystem::path& candidate : candidates)
+    {
+        std::error_code error;
+        if (std::filesystem::is_regular_file(candidate, error))
+        {
+            return candidate;
+        }
+    }
+    return {};
+}
+
+std::filesystem::path Player::PathResolver::resolve(const std::string& source)
+{
+    Entry_t cached;
+    bool    found = false;
+    {
+        std::shared_lock<std::shared_mutex> guard(mLock);
+        const auto                          entry = mCache.find(source);
+        if (entry != mCache.end())
+        {
+            cached = entry->second;
+            found  = true;
+        }
+    }
+    if (found)
+    {
+        std::error_code error;
+        const auto      modified = std::filesystem::last_write_time(cached.resolved, error);
+        if (!error && static_cast<int64_t>(modified.time_since_epoch().count()) == cached.modifiedTime)
+        {
+            mHits.fetch_add(1, std::memory_order_relaxed);
+            return cached.resolved;
+        }
+    }
+
+    mMisses.fetch_add(1, std::memory_order_relaxed);
+    MP3_PROFILE_SCOPE("path.resolve");
+    Entry_t               entry;
+    std::filesystem::path resolved = probe(source);
+    std::error_code       error;
+    if (!resolved.empty())
+    {
+        entry.resolved = std::filesystem::canonical(resolved, error);
+        if (error)
+        {
+            entry.resolved = resolved;
+        }
+        entry.modifiedTime =
+            static_cast<int64_t>(std::filesystem::last_write_time(entry.resolved, error).time_since_epoch().count());
+    }
+
+    std::unique_lock<std::shared_mutex> guard(mLock);
+    if (entry.resolved.empty())
+    {
+        mCache.erase(source);
+        return {};
+    }
+    mCache[source] = entry;
+    return entry.resolved;
+}
+
+void Player::PathResolver::resolveAsync(std::vector<std::string> sources)
+{
+    auto shared = std::make_shared<const std::vector<std::string>>(std::move(sources));
+    for (size_t begin = 0; begin < shared->size(); begin += mBatchSize)
+    {
+        const size_t end = std::min(begin + mBatchSize, shared->size());
+        mPool->submit(
+            [this, shared, begin, end]
+            {
+                for (size_t index = begin; index < end && !mStopping.load(std::memory_order_relaxed); ++index)
+                {
+                    resolve((*shared)[index]);
+                }
+            });
+    }
+}
+
+void Player::PathResolver::waitIdle()
+{
+    mPool->waitIdle();
+}
+
+void Player::PathResolver::clear()
+{
+    std::unique_lock<std::shared_mutex> guard(mLock);
+    mCache.clear();
+}
+
+size_t Player::PathResolver::getCachedCount() const
+{
+    std::shared_lock<std::shared_mutex> guard(mLock);
+    return mCache.size();
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "ThreadPool.h"
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Player
+{
+
+	/// @brief Resolves playlist paths to the file they name. A relative path is tried against a fixed list of roots
+	///        (working directory, executable directory, ...), which can mean several failed stats per lookup on a
+	///        network share. Resolved paths are cached in canonical form with the file's modification time: a
+	///        repeat lookup is one stat, and a file that changed or disappeared is resolved again. Paths are
+	///        resolved once when they are added, in parallel for bulk adds, so selecting a track later finds its
+	///        canonical path without probing. Misses are not cached.
+	class PathResolver
+	{
+	public:
+		/// @param roots       directories a relative path is tried against, in order
+		/// @param threadCount threads for resolveAsync()
+		explicit PathResolver(std::vector<std::filesystem::path> roots, size_t threadCount = 4);
+		~PathResolver();
+
+		PathResolver(const PathResolver&)            = delete;
+		PathResolver& operator=(const PathResolver&) = delete;
+
+		/// @brief any thread, no I/O: the cached resolution first (if any), then every place source may be
+		///        (only source itself when absolute). The track loader takes the first one that exists.
+		std::vector<std::filesystem::path> getCandidates(const std::string& source) const;
+
+		/// @brief blocking I/O, any thread: the canonical path of the first candidate that is a file, or empty.
+		///        Cached entries cost one stat while their modification time is unchanged.
+		std::filesystem::path resolve(const std::string& source);
+
+		/// @brief resolve() every source on the pool in batches; returns at once
+		void resolveAsync(std::vector<std::string> sources);
+
+		/// @brief block until every queued resolveAsync() batch has finished
+		void waitIdle();
+
+		/// @brief uncached probe of the search list, what every load did before the cache
+		std::filesystem::path probe(const std::string& source) const;
+
+		void clear();
+
+		size_t   getCachedCount() const;
+		uint64_t getHits() const { return mHits.load(std::memory_order_relaxed); }
+		uint64_t getMisses() const { return mMisses.load(std::memory_order_relaxed); }
+
+	private:
+		struct Entry_t
+		{
+			std::filesystem::path resolved;
+			int64_t               modifiedTime = 0;  // file_time_type ticks, only compared for equality
+		};
+
+		void appendSearchList(const std::string& source, std::vector<std::filesystem::path>& candidates) const;
+
+		static constexpr size_t mBatchSize = 256;
+
+		std::vector<std::filesystem::path>       mRoots;
+		mutable std::shared_mutex                mLock;
+		std::unordered_map<std::string, Entry_t> mCache;
+		std::atomic<uint64_t>                    mHits{0};
+		std::atomic<uint64_t>                    mMisses{0};
+		std::atomic<bool>                        mStopping{false};
+		std::unique_ptr<ThreadPool>              mPool;
+	};
+
+}
@@ -0,0 +1,203 @@
+#include "PcmAnalysis.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+std::vector<float> Player::PcmAnalysis::getWaveformPreview(const int16_t* samples,
+                                                           size_t         frameCount,
+                                                           uint16_t       channels,
+                                                           size_t         sampleCount)
+{
+    MP3_PROFILE_SCOPE("dsp.waveform");
+    std::vector<float> preview;
+    if (samples == nullptr || frameCount == 0 || channels == 0 || sampleCount == 0)
+    {
+        return preview;
+    }
+
+    const size_t step = std::max<size_t>(1, frameCount / sampleCount);
+    preview.reserve(sampleCount);
+    for (size_t frame = 0; frame < frameCount && preview.size() < sampleCount; frame += step)
+    {
+        const size_t  idx   = frame * channels;
+        const int16_t left  = samples[idx];
+        const int16_t right = (channels > 1) ? samples[idx + 1] : left;
+        preview.push_back(static_cast<float>((left + right) / 2.0f / 32768.0f));
+    }
+    return preview;
+}
+
+std::vector<Player::PeakPair_t> Player::PcmAnalysis::getPeaks(const int16_t* samples,
+                                                              size_t         frameCount,
+                                                              uint16_t       channels,
+                                                              size_t         framesPerPeak)
+{
+    MP3_PROFILE_SCOPE("dsp.peaks");
+    std::vector<PeakPair_t> peaks;
+    if (samples == nullptr || frameCount == 0 || channels == 0 || framesPerPeak == 0)
+    {
+        return peaks;
+    }
+
+    peaks.reserve((frameCount + framesPerPeak - 1) / framesPerPeak);
+    for (size_t first = 0; first < frameCount; first += framesPerPeak)
+    {
+        const int16_t* begin = samples + first * channels;
+        const int16_t* end   = samples + std::min(first + framesPerPeak, frameCount) * channels;
+        const auto     range = std::minmax_element(begin, end);
+        peaks.push_back(PeakPair_t{*range.first, *range.second});
+    }
+    return peaks;
+}
+
+namespace
+{
+    // Direct form I biquad, a0 normalised to 1
+    struct Biquad_t
+    {
+        double b0 = 1.0, b1 = 0.0, b2 = 0.0, a1 = 0.0, a2 = 0.0;
+        double x1 = 0.0, x2 = 0.0, y1 = 0.0, y2 = 0.0;
+
+        double process(double x)
+        {
+            const double y = b0 * x + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+            x2             = x1;
+            x1             = x;
+            y2             = y1;
+            y1             = y;
+            return y;
+        }
+    };
+
+    // The BS.1770 K-weighting pre-filter (high shelf) and RLB high-pass, derived from their analog prototypes so
+    // any sample rate gets the response the standard tabulates for 48 kHz
+    void getKWeighting(uint32_t sampleRate, Biquad_t& shelf, Biquad_t& highPass)
+    {
+        const double pi = 3.14159265358979323846;
+
+        double       f0 = 1681.974450955533;
+        double       q  = 0.7071752369554196;
+        double       k  = std::tan(pi * f0 / sampleRate);
+        const double vh = std::pow(10.0, 3.999843853973347 / 20.0);
+        const double vb = std::pow(vh, 0.4996667741545416);
+        double       a0 = 1.0 + k / q + k * k;
+        shelf.b0        = (vh + vb * k / q + k * k) / a0;
+        shelf.b1        = 2.0 * (k * k - vh) / a0;
+        shelf.b2        = (vh - vb * k / q + k * k) / a0;
+        shelf.a1        = 2.0 * (k * k - 1.0) / a0;
+        shelf.a2        = (1.0 - k / q + k * k) / a0;
+
+        f0          = 38.13547087602444;
+        q           = 0.5003270373238773;
+        k           = std::tan(pi * f0 / sampleRate);
+        a0          = 1.0 + k / q + k * k;
+        highPass.b0 = 1.0;
+        highPass.b1 = -2.0;
+        highPass.b2 = 1.0;
+        highPass.a1 = 2.0 * (k * k - 1.0) / a0;
+        highPass.a2 = (1.0 - k / q + k * k) / a0;
+    }
+
+    double toLufs(double meanSquare)
+    {
+        return -0.691 + 10.0 * std::log10(meanSquare);
+    }
+}
+
+Player::Loudness_t Player::PcmAnalysis::getLoudness(const int16_t* samples,
+                                                    size_t         frameCount,
+                                                    uint16_t       channels,
+                                                    uint32_t       sampleRate)
+{
+    MP3_PROFILE_SCOPE("dsp.loudness");
+    const double minusInfinity = -std::numeric_limits<double>::infinity();
+    Loudness_t   loudness{minusInfinity, minusInfinity};
+    if (samples == nullptr || frameCount == 0 || channels == 0 || sampleRate == 0)
+    {
+        return loudness;
+    }
+
+    // Filtered energy summed over 100 ms steps; a gating block is four consecutive steps
+    const size_t stepFrames = sampleRate / 10;
+    const size_t stepCount  = frameCount / stepFrames;
+    if (stepCount < 4)
+    {
+        return loudness;
+    }
+
+    std::vector<Biquad_t> shelves(channels);
+    std::vector<Biquad_t> highPasses(channels);
+    for (uint16_t channel = 0; channel < channels; ++channel)
+    {
+        getKWeighting(sampleRate, shelves[channel], highPasses[channel]);
+    }
+
+    std::vector<double> stepEnergy(stepCount, 0.0);
+    int                 peak = 0;
+    for (size_t step = 0; step < stepCount; ++step)
+    {
+        const int16_t* frame  = samples + step * stepFrames * channels;
+        double         energy = 0.0;
+        for (size_t index = 0; index < stepFrames; ++index, frame += channels)
+        {
+            for (uint16_t channel = 0; channel < channels; ++channel)
+            {
+                const int    value    = frame[channel];
+                const double filtered = highPasses[channel].process(shelves[channel].process(value / 32768.0));
+                energy += filtered * filtered;
+                peak = std::max(peak, value < 0 ? -value : value);
+            }
+        }
+        stepEnergy[step] = energy;
+    }
+    // The tail shorter than one step does not complete a block but still counts towards the peak
+    for (const int16_t* sample = samples + stepCount * stepFrames * channels; sample < samples + frameCount * channels;
+         ++sample)
+    {
+        peak = std::max(peak, *sample < 0 ? -*sample : static_cast<int>(*sample));
+    }
+    if (peak > 0)
+    {
+        loudness.samplePeakDbfs = 20.0 * std::log10(peak / 32768.0);
+    }
+
+    // Mean square per block: summed over channels (weight 1.0 each), averaged over the block's frames
+    std::vector<double> blocks;
+    blocks.reserve(stepCount - 3);
+    const double blockFrames = static_cast<double>(stepFrames) * 4.0;
+    for (size_t step = 3; step < stepCount; ++step)
+    {
+        const double meanSquare =
+            (stepEnergy[step - 3] + stepEnergy[step - 2] + stepEnergy[step - 1] + stepEnergy[step]) / blockFrames;
+        if (meanSquare > 0.0 && toLufs(meanSquare) > -70.0)
+        {
+            blocks.push_back(meanSquare);
+        }
+    }
+    if (blocks.empty())
+    {
+        return loudness;
+    }
+
+    double absoluteSum = 0.0;
+    for (double block : blocks)
+    {
+        absoluteSum += block;
+    }
+    const double relativeGate = toLufs(absoluteSum / blocks.size()) - 10.0;
+
+    double relativeSum   = 0.0;
+    size_t relativeCount = 0;
+    for (double block : blocks)
+    {
+        if (toLufs(block) > relativeGate)
+        {
+            relativeSum += block;
+            ++relativeCount;
+        }
+    }
+    loudness.integratedLufs = relativeCount > 0 ? toLufs(relativeSum / relativeCount) : minusInfinity;
+    return loudness;
+}
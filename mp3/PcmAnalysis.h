@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Player
+{
+
+	// Smallest and largest sample of one peak window, across all channels
+	struct PeakPair_t
+	{
+		int16_t min = 0;
+		int16_t max = 0;
+	};
+
+	// ITU-R BS.1770-4 / EBU R128 programme loudness
+	struct Loudness_t
+	{
+		double integratedLufs = 0.0;  // -inf when every block falls below the -70 LUFS absolute gate
+		double samplePeakDbfs = 0.0;  // -inf for digital silence
+	};
+
+	// Analysis helpers working on interleaved 16-bit PCM, shared by the player and the headless tools
+	class PcmAnalysis
+	{
+	public:
+		/// @brief downsample to sampleCount points by striding through the frames and averaging the first two channels
+		static std::vector<float> getWaveformPreview(const int16_t* samples,
+		                                             size_t         frameCount,
+		                                             uint16_t       channels,
+		                                             size_t         sampleCount);
+
+		/// @brief min/max of every framesPerPeak frames (the last window may be shorter)
+		static std::vector<PeakPair_t> getPeaks(const int16_t* samples,
+		                                        size_t         frameCount,
+		                                        uint16_t       channels,
+		                                        size_t         framesPerPeak);
+
+		/// @brief K-weighted, gated integrated loudness over 400 ms blocks with 75 % overlap. All channels are
+		///        weighted 1.0 (the surround weights do not apply to mono and stereo MP3).
+		static Loudness_t getLoudness(const int16_t* samples, size_t frameCount, uint16_t channels, uint32_t sampleRate);
+	};
+
+}
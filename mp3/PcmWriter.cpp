@@ -0,0 +1,86 @@
+#include "PcmWriter.h"
+#include "Profiler.h"
+
+#include <fstream>
+
+namespace
+{
+    void putU16(std::vector<char>& header, uint16_t value)
+    {
+        header.push_back(static_cast<char>(value & 0xFF));
+        header.push_back(static_cast<char>(value >> 8));
+    }
+
+    void putU32(std::vector<char>& header, uint32_t value)
+    {
+        putU16(header, static_cast<uint16_t>(value & 0xFFFF));
+        putU16(header, static_cast<uint16_t>(value >> 16));
+    }
+
+    void putTag(std::vector<char>& header, const char* tag)
+    {
+        header.insert(header.end(), tag, tag + 4);
+    }
+
+    bool writeFile(const std::filesystem::path& path, const std::vector<char>& header, const void* body, size_t size)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            return false;
+        }
+        file.write(header.data(), static_cast<std::streamsize>(header.size()));
+        file.write(static_cast<const char*>(body), static_cast<std::streamsize>(size));
+        return static_cast<bool>(file);
+    }
+}
+
+bool Player::PcmWriter::writeWav(const std::filesystem::path& path, const DecodedAudio_t& audio)
+{
+    MP3_PROFILE_SCOPE("write.wav");
+    const uint64_t dataBytes = audio.samples.size() * sizeof(int16_t);
+    if (audio.channels == 0 || dataBytes > UINT32_MAX - 36)
+    {
+        return false;
+    }
+
+    std::vector<char> header;
+    header.reserve(44);
+    putTag(header, "RIFF");
+    putU32(header, static_cast<uint32_t>(36 + dataBytes));
+    putTag(header, "WAVE");
+    putTag(header, "fmt ");
+    putU32(header, 16);
+    putU16(header, 1);  // PCM
+    putU16(header, audio.channels);
+    putU32(header, audio.sampleRate);
+    putU32(header, audio.sampleRate * audio.channels * 2);
+    putU16(header, static_cast<uint16_t>(audio.channels * 2));
+    putU16(header, 16);
+    putTag(header, "data");
+    putU32(header, static_cast<uint32_t>(dataBytes));
+    return writeFile(path, header, audio.samples.data(), dataBytes);
+}
+
+bool Player::PcmWriter::writeRaw(const std::filesystem::path& path, const DecodedAudio_t& audio)
+{
+    MP3_PROFILE_SCOPE("write.raw");
+    return writeFile(path, {}, audio.samples.data(), audio.samples.size() * sizeof(int16_t));
+}
+
+bool Player::PcmWriter::writePeaks(const std::filesystem::path&   path,
+                                   const std::vector<PeakPair_t>& peaks,
+                                   uint32_t                       sampleRate,
+                                   uint32_t                       framesPerPeak)
+{
+    MP3_PROFILE_SCOPE("write.peaks");
+    std::vector<char> header;
+    header.reserve(20);
+    putU32(header, 1);  // version
+    putU32(header, 0);  // flags: 16-bit values
+    putU32(header, sampleRate);
+    putU32(header, framesPerPeak);
+    putU32(header, static_cast<uint32_t>(peaks.size()));
+    static_assert(sizeof(PeakPair_t) == 2 * sizeof(int16_t), "peaks are written as packed min/max pairs");
+    return writeFile(path, header, peaks.data(), peaks.size() * sizeof(PeakPair_t));
+}
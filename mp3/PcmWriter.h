@@ -0,0 +1,32 @@
+#pragma once
+
+#include "MP3Decoder.h"
+#include "PcmAnalysis.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace Player
+{
+
+	/// @brief File output for decoded audio and its analysis, used by the command line tools.
+	///        Everything is written little-endian, the byte order of every target this builds for.
+	class PcmWriter
+	{
+	public:
+		/// @brief 16-bit PCM RIFF/WAVE
+		static bool writeWav(const std::filesystem::path& path, const DecodedAudio_t& audio);
+
+		/// @brief headerless interleaved s16le samples
+		static bool writeRaw(const std::filesystem::path& path, const DecodedAudio_t& audio);
+
+		/// @brief peak file in the audiowaveform .dat layout (version 1, 16-bit): a 20-byte header with sample
+		///        rate, frames per peak and peak count, then one min/max pair per peak
+		static bool writePeaks(const std::filesystem::path&   path,
+		                       const std::vector<PeakPair_t>& peaks,
+		                       uint32_t                       sampleRate,
+		                       uint32_t                       framesPerPeak);
+	};
+
+}
@@ -0,0 +1,223 @@
+#include "PlayOrder.h"
+
+#include <numeric>
+#include <utility>
+
+Player::PlayOrder::PlayOrder(uint32_t seed)
+    : mRandom(seed)
+{
+}
+
+void Player::PlayOrder::setShuffle(bool shuffle, int32_t current)
+{
+    if (shuffle == mShuffle)
+    {
+        return;
+    }
+    mShuffle = shuffle;
+    mDrawn   = false;
+    if (!shuffle)
+    {
+        return;
+    }
+    buildDeck();
+    mDealt   = 0;
+    mHistory = 0;
+    select(current);
+}
+
+void Player::PlayOrder::grow(size_t count)
+{
+    if (mShuffle)
+    {
+        for (size_t entry = mCount; entry < count; ++entry)
+        {
+            mSlots.push_back(static_cast<uint32_t>(mDeck.size()));
+            mDeck.push_back(static_cast<uint32_t>(entry));
+        }
+        // An exhausted round goes on with the new entries instead of starting over
+        if (mDealt == mCount)
+        {
+            mDrawn = false;
+        }
+    }
+    mCount = count;
+}
+
+void Player::PlayOrder::reset(size_t count)
+{
+    mCount = count;
+    mQueue.clear();
+    mDealt   = 0;
+    mHistory = 0;
+    mDrawn   = false;
+    if (mShuffle)
+    {
+        buildDeck();
+    }
+}
+
+void Player::PlayOrder::remap(const std::vector<uint32_t>& order)
+{
+    std::vector<uint32_t> moved(order.size());
+    for (size_t position = 0; position < order.size(); ++position)
+    {
+        moved[order[position]] = static_cast<uint32_t>(position);
+    }
+    for (uint32_t& entry : mQueue)
+    {
+        entry = moved[entry];
+    }
+    // The deck keeps its slots, so the round, the history and a drawn card all survive the sort
+    if (mShuffle && mDeck.size() == moved.size())
+    {
+        for (size_t slot = 0; slot < mDeck.size(); ++slot)
+        {
+            mDeck[slot]         = moved[mDeck[slot]];
+            mSlots[mDeck[slot]] = static_cast<uint32_t>(slot);
+        }
+    }
+}
+
+int32_t Player::PlayOrder::previous(int32_t current)
+{
+    if (mCount == 0)
+    {
+        return NONE;
+    }
+    if (!mShuffle)
+    {
+        return current <= 0 ? static_cast<int32_t>(mCount) - 1 : current - 1;
+    }
+    if (mHistory < 2)
+    {
+        return current;
+    }
+    --mHistory;
+    return static_cast<int32_t>(mDeck[mHistory - 1]);
+}
+
+void Player::PlayOrder::select(int32_t current)
+{
+    if (!mShuffle || current < 0 || static_cast<size_t>(current) >= mCount)
+    {
+        return;
+    }
+    if (mDealt == mCount)
+    {
+        // Chosen after the round ran out: it opens the next one
+        mDealt = 0;
+    }
+    const size_t slot = mSlots[current];
+    if (slot >= mDealt)
+    {
+        swapSlots(slot, mDealt);
+        mHistory = ++mDealt;
+    }
+    else
+    {
+        // Played earlier this round: it becomes the newest entry of the history
+        swapSlots(slot, mDealt - 1);
+        mHistory = mDealt;
+    }
+    mDrawn = false;
+}
+
+int32_t Player::PlayOrder::step(int32_t current, bool userRequested, bool commit)
+{
+    if (mCount == 0)
+    {
+        return NONE;
+    }
+    if (!userRequested && mRepeat == REPEAT_ONE && current >= 0)
+    {
+        return current;
+    }
+    if (!mQueue.empty())
+    {
+        const int32_t queued = static_cast<int32_t>(mQueue.front());
+        if (commit)
+        {
+            mQueue.pop_front();
+            select(queued);
+        }
+        return queued;
+    }
+
+    if (!mShuffle)
+    {
+        const size_t following = current < 0 ? 0 : static_cast<size_t>(current) + 1;
+        if (following < mCount)
+        {
+            return static_cast<int32_t>(following);
+        }
+        // Next always wraps; a track that plays out only does under repeat-all
+        return userRequested || mRepeat == REPEAT_ALL ? 0 : NONE;
+    }
+
+    // Forward again over entries Previous went back through
+    if (mHistory < mDealt)
+    {
+        const int32_t replay = static_cast<int32_t>(mDeck[mHistory]);
+        if (commit)
+        {
+            ++mHistory;
+        }
+        return replay;
+    }
+    if (mDealt == mCount && !userRequested && mRepeat != REPEAT_ALL)
+    {
+        return NONE;
+    }
+    const size_t  slot  = draw(current);
+    const int32_t entry = static_cast<int32_t>(mDeck[slot]);
+    if (commit)
+    {
+        if (mDealt == mCount)
+        {
+            // New round: the same deck is dealt again, reshuffled one draw at a time
+            mDealt = 0;
+        }
+        swapSlots(slot, mDealt);
+        mHistory = ++mDealt;
+        mDrawn   = false;
+    }
+    return entry;
+}
+
+size_t Player::PlayOrder::draw(int32_t current)
+{
+    if (!mDrawn)
+    {
+        const bool                            newRound = mDealt == mCount;
+        std::uniform_int_distribution<size_t> pick(newRound ? 0 : mDealt, mCount - 1);
+        mDrawnSlot = pick(mRandom);
+        // A new round does not open with the track that closed the last one
+        while (newRound && mCount > 1 && static_cast<int32_t>(mDeck[mDrawnSlot]) == current)
+        {
+            mDrawnSlot = pick(mRandom);
+        }
+        mDrawn = true;
+    }
+    return mDrawnSlot;
+}
+
+void Player::PlayOrder::buildDeck()
+{
+    // Any permutation is a valid deck, so one kept from an earlier shuffle is reused as it is
+    if (mDeck.size() == mCount)
+    {
+        return;
+    }
+    mDeck.resize(mCount);
+    mSlots.resize(mCount);
+    std::iota(mDeck.begin(), mDeck.end(), 0u);
+    std::iota(mSlots.begin(), mSlots.end(), 0u);
+}
+
+void Player::PlayOrder::swapSlots(size_t a, size_t b)
+{
+    std::swap(mDeck[a], mDeck[b]);
+    mSlots[mDeck[a]] = static_cast<uint32_t>(a);
+    mSlots[mDeck[b]] = static_cast<uint32_t>(b);
+}
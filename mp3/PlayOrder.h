@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <vector>
+
+namespace Player
+{
+
+	enum RepeatMode_e
+	{
+		REPEAT_OFF = 0,  // stop after the last entry (or the last of the shuffled round)
+		REPEAT_ALL,      // start over, with a fresh shuffle when shuffling
+		REPEAT_ONE       // a track that plays out starts again; Next still moves on
+	};
+
+	/// @brief Decides which playlist entry plays next: the up-next queue first, then the playlist in order or
+	///        shuffled, under a repeat mode. Every step is O(1) on any playlist size. Shuffle is a Fisher-Yates
+	///        deck dealt one card per step: the next card is drawn from the undealt part when it is needed, so a
+	///        round plays every entry once before any repeats, and a new round just deals the same deck again.
+	///        The dealt part doubles as the history Previous walks back through. Entries that play out of turn
+	///        (selected, or from the queue) are dealt on the spot so the round does not repeat them.
+	class PlayOrder
+	{
+	public:
+		static constexpr int32_t NONE = -1;
+
+		explicit PlayOrder(uint32_t seed = std::random_device{}());
+
+		/// @brief turning shuffle on starts a new round that counts current as played
+		void setShuffle(bool shuffle, int32_t current);
+		bool getShuffle() const { return mShuffle; }
+
+		void         setRepeat(RepeatMode_e repeat) { mRepeat = repeat; }
+		RepeatMode_e getRepeat() const { return mRepeat; }
+
+		/// @brief the playlist grew to count entries; new entries join the undealt part of the round
+		void grow(size_t count);
+
+		/// @brief the playlist was replaced or cleared: empties the queue and starts a new round
+		void reset(size_t count);
+
+		/// @brief the playlist was reordered; order holds the old index of every new position
+		void remap(const std::vector<uint32_t>& order);
+
+		/// @brief append an entry to the up-next queue
+		void                        enqueue(uint32_t index) { mQueue.push_back(index); }
+		void                        clearQueue() { mQueue.clear(); }
+		const std::deque<uint32_t>& getQueue() const { return mQueue; }
+
+		/// @brief the entry next() would return, without moving. userRequested is a Next click; otherwise the
+		///        current track played out, where repeat-one replays it and repeat-off may end. NONE if nothing
+		///        follows. The shuffle card is drawn here already, so the prefetched track is the one next() takes.
+		int32_t peekNext(int32_t current, bool userRequested) { return step(current, userRequested, false); }
+		int32_t next(int32_t current, bool userRequested) { return step(current, userRequested, true); }
+
+		/// @brief the entry before current: back through the shuffle history, or the previous entry (wrapping).
+		///        current itself when shuffling and nothing was played before it this round.
+		int32_t previous(int32_t current);
+
+		/// @brief current was chosen directly (not through next()); deals it when shuffling
+		void select(int32_t current);
+
+	private:
+		int32_t step(int32_t current, bool userRequested, bool commit);
+		size_t  draw(int32_t current);
+		void    buildDeck();
+		void    swapSlots(size_t a, size_t b);
+
+		std::mt19937         mRandom;
+		bool                 mShuffle = false;
+		RepeatMode_e         mRepeat  = REPEAT_OFF;
+		size_t               mCount   = 0;
+		std::deque<uint32_t> mQueue;
+
+		// Shuffle deck: mDeck[0, mDealt) was played this round, in order; mSlots is its inverse (entry -> slot)
+		std::vector<uint32_t> mDeck;
+		std::vector<uint32_t> mSlots;
+		size_t                mDealt     = 0;
+		size_t                mHistory   = 0;      // slots up to and including the current entry; < mDealt after Previous
+		size_t                mDrawnSlot = 0;      // the card peekNext() drew, dealt by the next() that follows
+		bool                  mDrawn     = false;
+	};
+
+}
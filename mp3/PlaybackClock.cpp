@@ -0,0 +1,143 @@
+#include "PlaybackClock.h"
+
+#include <algorithm>
+#include <chrono>
+
+int64_t Player::PlaybackClock::getNanoseconds()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void Player::PlaybackClock::beginWrite()
+{
+    while (mWriteLock.test_and_set(std::memory_order_acquire))
+    {
+    }
+    const uint32_t sequence = mSequence.load(std::memory_order_relaxed);
+    mSequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+void Player::PlaybackClock::endWrite()
+{
+    mSequence.store(mSequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    mWriteLock.clear(std::memory_order_release);
+}
+
+Player::PlaybackClock::Anchor_t Player::PlaybackClock::loadAnchor() const
+{
+    Anchor_t anchor;
+    anchor.startFrame  = mStartFrame.load(std::memory_order_relaxed);
+    anchor.anchorFrame = mAnchorFrame.load(std::memory_order_relaxed);
+    anchor.limitFrame  = mLimitFrame.load(std::memory_order_relaxed);
+    anchor.anchorNanos = mAnchorNanos.load(std::memory_order_relaxed);
+    anchor.sampleRate  = mSampleRate.load(std::memory_order_relaxed);
+    anchor.running     = mRunning.load(std::memory_order_relaxed);
+    return anchor;
+}
+
+Player::PlaybackClock::Anchor_t Player::PlaybackClock::readAnchor() const
+{
+    for (;;)
+    {
+        const uint32_t before = mSequence.load(std::memory_order_acquire);
+        const Anchor_t anchor = loadAnchor();
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if ((before & 1) == 0 && mSequence.load(std::memory_order_relaxed) == before)
+        {
+            return anchor;
+        }
+    }
+}
+
+uint64_t Player::PlaybackClock::extrapolate(const Anchor_t& anchor, int64_t nowNanos)
+{
+    if (!anchor.running || nowNanos <= anchor.anchorNanos)
+    {
+        return anchor.anchorFrame;
+    }
+    const uint64_t elapsed =
+        static_cast<uint64_t>(static_cast<double>(nowNanos - anchor.anchorNanos) * anchor.sampleRate * 1e-9);
+    return std::min(anchor.anchorFrame + elapsed, std::max(anchor.anchorFrame, anchor.limitFrame));
+}
+
+void Player::PlaybackClock::start(uint32_t sampleRate, uint64_t startFrame, uint32_t blockFrames)
+{
+    beginWrite();
+    mSampleRate.store(sampleRate, std::memory_order_relaxed);
+    mBlockFrames.store(blockFrames, std::memory_order_relaxed);
+    mStartFrame.store(startFrame, std::memory_order_relaxed);
+    mConsumedFrame.store(startFrame, std::memory_order_relaxed);
+    mAnchorFrame.store(startFrame, std::memory_order_relaxed);
+    mLimitFrame.store(startFrame + blockFrames, std::memory_order_relaxed);
+    mAnchorNanos.store(getNanoseconds(), std::memory_order_relaxed);
+    mLatencyFrames.store(0, std::memory_order_relaxed);
+    mRunning.store(true, std::memory_order_relaxed);
+    endWrite();
+}
+
+void Player::PlaybackClock::stop()
+{
+    beginWrite();
+    mRunning.store(false, std::memory_order_relaxed);
+    endWrite();
+}
+
+void Player::PlaybackClock::pause()
+{
+    beginWrite();
+    mAnchorFrame.store(extrapolate(loadAnchor(), getNanoseconds()), std::memory_order_relaxed);
+    mRunning.store(false, std::memory_order_relaxed);
+    endWrite();
+}
+
+void Player::PlaybackClock::resume()
+{
+    beginWrite();
+    mAnchorNanos.store(getNanoseconds(), std::memory_order_relaxed);
+    mRunning.store(true, std::memory_order_relaxed);
+    endWrite();
+}
+
+void Player::PlaybackClock::onFramesConsumed(uint32_t frames)
+{
+    const int64_t now = getNanoseconds();
+    beginWrite();
+    const uint64_t consumed = mConsumedFrame.load(std::memory_order_relaxed) + frames;
+    mConsumedFrame.store(consumed, std::memory_order_relaxed);
+    // A block that completes just after pause() still counts, but never moves the frozen position backwards
+    mAnchorFrame.store(mRunning.load(std::memory_order_relaxed)
+                           ? consumed
+                           : std::max(consumed, mAnchorFrame.load(std::memory_order_relaxed)),
+                       std::memory_order_relaxed);
+    mLimitFrame.store(consumed + mBlockFrames.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    mAnchorNanos.store(now, std::memory_order_relaxed);
+    endWrite();
+}
+
+void Player::PlaybackClock::onDevicePosition(uint64_t playedFrames)
+{
+    const Anchor_t anchor   = readAnchor();
+    const uint64_t consumed = extrapolate(anchor, getNanoseconds()) - anchor.startFrame;
+    const uint64_t measured = consumed > playedFrames ? consumed - playedFrames : 0;
+
+    // Smoothed, the device position only moves in driver-sized steps
+    const uint64_t previous = mLatencyFrames.load(std::memory_order_relaxed);
+    const uint64_t smoothed = previous == 0 ? measured : (previous * 7 + measured) / 8;
+    mLatencyFrames.store(static_cast<uint32_t>(smoothed), std::memory_order_relaxed);
+}
+
+uint64_t Player::PlaybackClock::getFramePosition() const
+{
+    const Anchor_t anchor   = readAnchor();
+    const uint64_t position = extrapolate(anchor, getNanoseconds());
+    const uint64_t latency  = mLatencyFrames.load(std::memory_order_relaxed);
+    return position > anchor.startFrame + latency ? position - latency : anchor.startFrame;
+}
+
+double Player::PlaybackClock::getSeconds() const
+{
+    const uint32_t sampleRate = getSampleRate();
+    return sampleRate > 0 ? static_cast<double>(getFramePosition()) / sampleRate : 0.0;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace Player
+{
+
+	/// @brief Playback position fed by the audio sink and readable from any thread without a driver call.
+	///        The sink reports every block it has consumed; between those callbacks the position is extrapolated
+	///        with the steady clock, capped at the end of the block being played so it never runs ahead and never
+	///        moves backwards. The output latency measured by the sink is subtracted, so the reported frame is the
+	///        one being heard rather than the one last handed to the device.
+	///
+	///        Writers (sink callback, transport calls) serialise on a spin flag; readers use a sequence counter
+	///        and retry in the rare case they overlap a write.
+	class PlaybackClock
+	{
+	public:
+		/// @brief begin a run at startFrame; blockFrames is the sink's block size (the extrapolation limit)
+		void start(uint32_t sampleRate, uint64_t startFrame, uint32_t blockFrames);
+		void stop();
+
+		/// @brief freeze / continue extrapolation while the device is paused
+		void pause();
+		void resume();
+
+		/// @brief sink callback: frames of one block have been consumed by the device
+		void onFramesConsumed(uint32_t frames);
+
+		/// @brief sink thread: the device's own count of frames played since start, used to estimate latency
+		void onDevicePosition(uint64_t playedFrames);
+
+		/// @brief audible frame index (start frame included)
+		uint64_t getFramePosition() const;
+		double   getSeconds() const;
+
+		uint32_t getSampleRate() const { return mSampleRate.load(std::memory_order_relaxed); }
+		uint32_t getLatencyFrames() const { return mLatencyFrames.load(std::memory_order_relaxed); }
+		bool     isRunning() const { return mRunning.load(std::memory_order_relaxed); }
+
+		static int64_t getNanoseconds();
+
+	private:
+		// Consistent copy of the fields below, taken under the sequence counter
+		struct Anchor_t
+		{
+			uint64_t startFrame  = 0;
+			uint64_t anchorFrame = 0;  // consumed position at anchorNanos
+			uint64_t limitFrame  = 0;  // extrapolation never passes this
+			int64_t  anchorNanos = 0;
+			uint32_t sampleRate  = 0;
+			bool     running     = false;
+		};
+
+		Anchor_t loadAnchor() const;  // writers, under the write lock
+		Anchor_t readAnchor() const;  // readers, retried until consistent
+		void     beginWrite();
+		void     endWrite();
+
+		static uint64_t extrapolate(const Anchor_t& anchor, int64_t nowNanos);
+
+		std::atomic_flag      mWriteLock = ATOMIC_FLAG_INIT;
+		std::atomic<uint32_t> mSequence{0};
+		std::atomic<uint64_t> mStartFrame{0};
+		std::atomic<uint64_t> mConsumedFrame{0};  // start frame + every block the sink has reported
+		std::atomic<uint64_t> mAnchorFrame{0};
+		std::atomic<uint64_t> mLimitFrame{0};
+		std::atomic<int64_t>  mAnchorNanos{0};
+		std::atomic<uint32_t> mSampleRate{0};
+		std::atomic<uint32_t> mBlockFrames{0};
+		std::atomic<bool>     mRunning{false};
+		std::atomic<uint32_t> mLatencyFrames{0};
+	};
+
+}
@@ -0,0 +1,589 @@
+#include "PlayerCore.h"
+#include "Profiler.h"
+
+#include <algorithm>
+
+namespace
+{
+    // Commands that have to see the playlist a sort or open in flight leaves behind
+    bool waitsForPlaylist(Player::PlayerCommandType_e type)
+    {
+        return type == Player::PLAYER_ADD_TRACKS || type == Player::PLAYER_CLEAR_PLAYLIST ||
+               type == Player::PLAYER_OPEN_PLAYLIST || type == Player::PLAYER_SAVE_PLAYLIST ||
+               type == Player::PLAYER_SORT_PLAYLIST;
+    }
+}
+
+Player::PlayerCore::PlayerCore(PlayerOutput& output, CandidateFn resolveCandidates, size_t queueCapacity)
+    : mOutput(output)
+    , mResolveCandidates(std::move(resolveCandidates))
+    , mQueue(queueCapacity)
+    , mEqGainsDb(EQ_BANDS, 0.0F)
+{
+    publish();
+}
+
+bool Player::PlayerCore::post(PlayerCommand_t&& command)
+{
+    return mQueue.push(std::move(command));
+}
+
+bool Player::PlayerCore::post(PlayerCommandType_e type, double value, double value2)
+{
+    PlayerCommand_t command;
+    command.type   = type;
+    command.value  = value;
+    command.value2 = value2;
+    return mQueue.push(std::move(command));
+}
+
+size_t Player::PlayerCore::process(const AppliedFn& onApplied)
+{
+    // A finished sort or open goes first, then the commands that waited for it
+    size_t applied = pollPlaylistJob(onApplied);
+
+    // Bounded by the capacity so producers that never stop cannot keep the owner thread here forever. While a
+    // sort or open is in flight, the first command that needs its result waits, and everything after it too, so
+    // commands still apply in the order they were posted.
+    size_t          popped = 0;
+    PlayerCommand_t command;
+    while (popped < mQueue.getCapacity() && mQueue.pop(command))
+    {
+        ++popped;
+        if (mPlaylistJob && (!mDeferred.empty() || waitsForPlaylist(command.type)))
+        {
+            mDeferred.push_back(std::move(command));
+            continue;
+        }
+        applyCommand(command, onApplied);
+        ++applied;
+    }
+
+    // A track that played out moves on first, so a prefetched successor is opened by the pollLoad() right after
+    pollTrackEnd();
+    pollLoad();
+    updatePrefetch();
+    mLoadProgress.store(mTrackLoad ? mTrackLoad->getProgress() : 0.0F, std::memory_order_relaxed);
+
+    // The output also changes on its own, e.g. when a track plays out
+    const PlayerSnapshotHandle current = mSnapshot.load(std::memory_order_relaxed);
+    if (mDirty || current->open != mOutput.isOpen() || current->playing != mOutput.isPlaying() ||
+        current->paused != mOutput.isPaused() || current->loading != static_cast<bool>(mTrackLoad) ||
+        current->playlistBusy != static_cast<bool>(mPlaylistJob))
+    {
+        publish();
+    }
+    return applied;
+}
+
+void Player::PlayerCore::finishPlaylistWork(const AppliedFn& onApplied)
+{
+    // A deferred sort or open may start the next job, so this runs until none is left
+    while (mPlaylistJob)
+    {
+        mPlaylistWorker->waitIdle();
+        process(onApplied);
+    }
+}
+
+void Player::PlayerCore::applyCommand(PlayerCommand_t& command, const AppliedFn& onApplied)
+{
+    MP3_PROFILE_SCOPE("core.apply");
+    const bool        busy  = static_cast<bool>(mPlaylistJob);
+    const std::string error = apply(command);
+    mDirty                  = true;
+    // A sort or open that just started is reported when pollPlaylistJob() applies it
+    if (onApplied && (busy || !mPlaylistJob))
+    {
+        onApplied(command, error);
+    }
+}
+
+std::string Player::PlayerCore::apply(PlayerCommand_t& command)
+{
+    switch (command.type)
+    {
+    case PLAYER_PLAY:
+        if (mCurrentIndex < 0)
+        {
+            return "no track selected";
+        }
+        playCurrent(command.value);
+        break;
+    case PLAYER_PAUSE:
+        mOutput.setPause();
+        break;
+    case PLAYER_RESUME:
+        mOutput.unSetPause();
+        break;
+    case PLAYER_TOGGLE_PAUSE:
+        if (mOutput.isPaused())
+        {
+            mOutput.unSetPause();
+        }
+        else
+        {
+            mOutput.setPause();
+        }
+        break;
+    case PLAYER_STOP:
+        mPlayWhenLoaded = false;
+        mOutput.stop();
+        break;
+    case PLAYER_SELECT:
+        if (command.index < 0 || command.index >= static_cast<int32_t>(mPlaylist.size()))
+        {
+            return "track index out of range";
+        }
+        mCurrentIndex = command.index;
+        mPlayOrder.select(mCurrentIndex);
+        requestLoad(false, 0.0);
+        break;
+    case PLAYER_NEXT:
+    case PLAYER_PREVIOUS:
+        return moveToTrack(command.type == PLAYER_NEXT ? 1 : -1, true);
+    case PLAYER_VOLUME:
+        mVolume  = std::clamp(static_cast<float>(command.value), 0.0F, 1.0F);
+        mBalance = std::clamp(static_cast<float>(command.value2), -1.0F, 1.0F);
+        mOutput.setVolume(mVolume, mBalance);
+        break;
+    case PLAYER_EQ:
+        if (command.band >= mEqGainsDb.size())
+        {
+            return "band out of range";
+        }
+        mEqGainsDb[command.band] = std::clamp(static_cast<float>(command.value), -12.0F, 12.0F);
+        mOutput.setEqualizerGains(mEqGainsDb);
+        break;
+    case PLAYER_ADD_TRACKS:
+    {
+        // The track named on the command line is posted after the session playlist that already holds it from
+        // the last launch; selecting that entry keeps the playlist unmodified, so it is not saved with a copy
+        if (command.select && command.tracks.empty() && command.paths.size() == 1)
+        {
+            const size_t existing = mPlaylist.find(command.paths.front());
+            if (existing != Playlist::NOT_FOUND)
+            {
+                mCurrentIndex = static_cast<int32_t>(existing);
+                mPlayOrder.select(mCurrentIndex);
+                requestLoad(false, 0.0);
+                break;
+            }
+        }
+        // Only a batch larger than the playlist is reserved for: a smaller one regrows the columns at most once by
+        // doubling, while an exact reserve would copy every column again on each add of a track or two
+        const size_t first = mPlaylist.size();
+        const size_t added = command.tracks.size() + command.paths.size();
+        if (added > first)
+        {
+            mPlaylist.reserve(first + added);
+        }
+        for (size_t index = 0; index < command.tracks.size(); ++index)
+        {
+            mPlaylist.add(command.tracks[index],
+                          index < command.trackIds.size() ? command.trackIds[index] : Playlist::NO_METADATA);
+        }
+        for (const std::string& path : command.paths)
+        {
+            mPlaylist.add(path);
+        }
+        mPlayOrder.grow(mPlaylist.size());
+        // The first track added to an empty selection is loaded (not played) so Play starts at once
+        if (first < mPlaylist.size() && (command.select || mCurrentIndex < 0))
+        {
+            mCurrentIndex = static_cast<int32_t>(first);
+            mPlayOrder.select(mCurrentIndex);
+            requestLoad(false, 0.0);
+        }
+        break;
+    }
+    case PLAYER_CLEAR_PLAYLIST:
+        mOutput.stop();
+        cancelLoad();
+        cancelPrefetch();
+        mPlaylist.clear();
+        mPlayOrder.reset(0);
+        mCurrentIndex = -1;
+        mLoadIndex    = -1;
+        break;
+    case PLAYER_OPEN_PLAYLIST:
+    case PLAYER_SAVE_PLAYLIST:
+        if (command.paths.empty())
+        {
+            return "no playlist file given";
+        }
+        if (command.type == PLAYER_OPEN_PLAYLIST)
+        {
+            startPlaylistJob(command);
+            break;
+        }
+        if (!mPlaylist.save(command.paths.front()))
+        {
+            return "could not save playlist: " + command.paths.front();
+        }
+        break;
+    case PLAYER_SORT_PLAYLIST:
+        if (command.index < 0 || command.index >= PLAYLIST_COLUMN_COUNT)
+        {
+            return "no such playlist column";
+        }
+        startPlaylistJob(command);
+        break;
+    case PLAYER_SHUFFLE:
+        mPlayOrder.setShuffle(command.value != 0.0, mCurrentIndex);
+        break;
+    case PLAYER_REPEAT:
+        if (command.index < REPEAT_OFF || command.index > REPEAT_ONE)
+        {
+            return "no such repeat mode";
+        }
+        mPlayOrder.setRepeat(static_cast<RepeatMode_e>(command.index));
+        break;
+    case PLAYER_ENQUEUE:
+        if (command.index < 0 || command.index >= static_cast<int32_t>(mPlaylist.size()))
+        {
+            return "track index out of range";
+        }
+        mPlayOrder.enqueue(static_cast<uint32_t>(command.index));
+        break;
+    case PLAYER_CLEAR_QUEUE:
+        mPlayOrder.clearQueue();
+        break;
+    }
+    return {};
+}
+
+void Player::PlayerCore::requestLoad(bool playWhenLoaded, double startSeconds)
+{
+    cancelLoad();
+    if (mPrefetch && mPrefetchIndex == mCurrentIndex)
+    {
+        // Already decoding (or decoded) ahead: a finished job is opened by the next pollLoad() without a decode
+        mTrackLoad     = std::move(mPrefetch);
+        mPrefetchIndex = -1;
+    }
+    else
+    {
+        // Supersedes (and cancels) whatever load is still running, so rapid Next clicks never queue decodes
+        const std::string path(mPlaylist.getPath(mCurrentIndex));
+        mTrackLoad = mTrackLoader.load(mResolveCandidates ? mResolveCandidates(path)
+                                                          : std::vector<std::filesystem::path>{path},
+                                       mWaveformPoints);
+    }
+    mLoadIndex        = mCurrentIndex;
+    mPlayWhenLoaded   = playWhenLoaded;
+    mLoadStartSeconds = startSeconds;
+}
+
+void Player::PlayerCore::pollLoad()
+{
+    if (!mTrackLoad || !mTrackLoad->isFinished())
+    {
+        return;
+    }
+    const TrackLoadHandle job = std::move(mTrackLoad);
+    mTrackLoad.reset();
+    mDirty                    = true;
+    const bool playWhenLoaded = mPlayWhenLoaded;
+    mPlayWhenLoaded           = false;
+    const int32_t loadIndex   = mLoadIndex;
+    mLoadIndex                = -1;
+
+    // What the load found out stays with the entry: its exact duration, or that the file is missing
+    const auto recordResult = [this, loadIndex](bool loaded, double durationSeconds)
+    {
+        if (loadIndex >= 0 && loadIndex < static_cast<int32_t>(mPlaylist.size()))
+        {
+            mPlaylist.setLoadResult(loadIndex, loaded, static_cast<float>(durationSeconds));
+        }
+    };
+
+    if (job->getState() == LOAD_FAILED)
+    {
+        recordResult(false, 0.0);
+        mStatusMessage = job->getError();
+        return;
+    }
+    if (job->getState() != LOAD_DONE)
+    {
+        return;
+    }
+
+    MP3_PROFILE_SCOPE("load.swap");
+    LoadedTrack_t& loaded = job->getResult();
+    auto           track  = std::make_shared<PlayerTrack_t>();
+    track->path           = loaded.path.string();
+    track->tags           = loaded.tags;
+    track->waveform       = std::move(loaded.waveform);
+    if (!mOutput.openTrack(std::move(loaded.audio), std::move(loaded.tags)))
+    {
+        // The previous track was closed before the open failed
+        mTrack.reset();
+        recordResult(false, 0.0);
+        mStatusMessage = "Failed to load file: " + track->path;
+        return;
+    }
+    recordResult(true, mOutput.getDuration());
+    track->display = TrackDisplay_t::make(track->path, track->tags, mOutput.getDuration());
+    mTrack         = std::move(track);
+    mStatusMessage.clear();
+    if (playWhenLoaded)
+    {
+        playCurrent(mLoadStartSeconds);
+    }
+}
+
+void Player::PlayerCore::playCurrent(double startSeconds)
+{
+    if (mTrackLoad)
+    {
+        // Start as soon as the pending load finishes
+        mPlayWhenLoaded   = true;
+        mLoadStartSeconds = startSeconds;
+        return;
+    }
+    if (!mOutput.isOpen())
+    {
+        requestLoad(true, startSeconds);
+        return;
+    }
+    if (mOutput.startPlayback(startSeconds))
+    {
+        // A new device starts at its default level
+        mOutput.setVolume(mVolume, mBalance);
+    }
+}
+
+std::string Player::PlayerCore::moveToTrack(int delta, bool userRequested)
+{
+    if (mPlaylist.empty())
+    {
+        return "playlist is empty";
+    }
+    const int32_t target =
+        delta > 0 ? mPlayOrder.next(mCurrentIndex, userRequested) : mPlayOrder.previous(mCurrentIndex);
+    if (target < 0)
+    {
+        // Played out with repeat off, at the end of the playlist or of the shuffled round
+        mPlayWhenLoaded = false;
+        mOutput.stop();
+        return userRequested ? "no track to move to" : std::string();
+    }
+    if (target == mCurrentIndex && !mTrackLoad && mOutput.isOpen())
+    {
+        // Repeat-one, a one-entry playlist or the start of the shuffle history: the track is still open
+        playCurrent(0.0);
+        return {};
+    }
+    mCurrentIndex = target;
+    requestLoad(true, 0.0);
+    return {};
+}
+
+void Player::PlayerCore::pollTrackEnd()
+{
+    // The output keeps reporting playing after the last block, so it says when that block is done. Its position
+    // is no use here: the clock holds it back by the output latency and may never quite reach the duration.
+    if (mTrackLoad || !mOutput.isPlaying() || mOutput.isPaused() || !mOutput.isPlayedOut())
+    {
+        return;
+    }
+    mDirty = true;
+    moveToTrack(1, false);
+}
+
+void Player::PlayerCore::updatePrefetch()
+{
+    // What plays when this track ends; under repeat-one that is the track itself, so the one Next would pick is
+    // decoded instead. Waits for the track in flight, so the prefetch never competes with a load the user is
+    // waiting for.
+    const int32_t next = mPlayOrder.peekNext(mCurrentIndex, false);
+    if (next != mNextIndex)
+    {
+        mNextIndex = next;
+        mDirty     = true;
+    }
+    if (mTrackLoad || !mOutput.isOpen())
+    {
+        return;
+    }
+    const int32_t target = mPlayOrder.getRepeat() == REPEAT_ONE ? mPlayOrder.peekNext(mCurrentIndex, true) : next;
+    if (target < 0 || target == mCurrentIndex)
+    {
+        cancelPrefetch();
+        return;
+    }
+    if (target == mPrefetchIndex)
+    {
+        return;
+    }
+    MP3_PROFILE_SCOPE("core.prefetch");
+    const std::string path(mPlaylist.getPath(target));
+    mPrefetch      = mPrefetchLoader.load(mResolveCandidates ? mResolveCandidates(path)
+                                                             : std::vector<std::filesystem::path>{path},
+                                          mWaveformPoints);
+    mPrefetchIndex = target;
+}
+
+void Player::PlayerCore::cancelLoad()
+{
+    // The job may have been adopted from the prefetch loader, which mTrackLoader.cancel() does not reach
+    mTrackLoader.cancel();
+    if (mTrackLoad)
+    {
+        mTrackLoad->cancel();
+        mTrackLoad.reset();
+    }
+}
+
+void Player::PlayerCore::cancelPrefetch()
+{
+    if (mPrefetch)
+    {
+        mPrefetchLoader.cancel();
+        mPrefetch.reset();
+    }
+    mPrefetchIndex = -1;
+}
+
+void Player::PlayerCore::startPlaylistJob(const PlayerCommand_t& command)
+{
+    if (!mPlaylistWorker)
+    {
+        mPlaylistWorker = std::make_unique<ThreadPool>(1);
+    }
+    auto job     = std::make_shared<PlaylistJob_t>();
+    job->command = command;
+    if (command.type == PLAYER_SORT_PLAYLIST)
+    {
+        // Reads the strings of mPlaylist on the worker: nothing adds to or reorders it until the job is applied
+        job->sortOrder = mPlaylist.makeSortOrder(static_cast<PlaylistColumn_e>(command.index), command.value != 0.0);
+    }
+    mPlaylistJob = job;
+    mPlaylistWorker->submit(
+        [job]
+        {
+            if (job->sortOrder)
+            {
+                job->sortOrder(job->reorder);
+            }
+            else
+            {
+                job->opened = job->playlist.open(job->command.paths.front());
+            }
+            job->done.store(true, std::memory_order_release);
+        });
+}
+
+size_t Player::PlayerCore::pollPlaylistJob(const AppliedFn& onApplied)
+{
+    if (!mPlaylistJob || !mPlaylistJob->done.load(std::memory_order_acquire))
+    {
+        return 0;
+    }
+    const std::shared_ptr<PlaylistJob_t> job = std::move(mPlaylistJob);
+    mPlaylistJob.reset();
+    mDirty = true;
+    std::string error;
+    if (job->command.type == PLAYER_SORT_PLAYLIST)
+    {
+        finishSort(job->reorder);
+    }
+    else
+    {
+        error = finishOpen(*job);
+    }
+    if (onApplied)
+    {
+        onApplied(job->command, error);
+    }
+
+    // The waiting commands run until one of them starts the next sort or open
+    size_t applied = 1;
+    while (!mPlaylistJob && !mDeferred.empty())
+    {
+        PlayerCommand_t command = std::move(mDeferred.front());
+        mDeferred.pop_front();
+        applyCommand(command, onApplied);
+        ++applied;
+    }
+    return applied;
+}
+
+std::string Player::PlayerCore::finishOpen(PlaylistJob_t& job)
+{
+    // The current playlist is only replaced once the file has been read
+    if (!job.opened)
+    {
+        return "could not open playlist: " + job.command.paths.front();
+    }
+    mOutput.stop();
+    cancelLoad();
+    cancelPrefetch();
+    mPlaylist = std::move(job.playlist);
+    mPlayOrder.reset(mPlaylist.size());
+    mCurrentIndex = -1;
+    mLoadIndex    = -1;
+    if (!mPlaylist.empty())
+    {
+        mCurrentIndex = 0;
+        mPlayOrder.select(mCurrentIndex);
+        requestLoad(false, 0.0);
+    }
+    return {};
+}
+
+void Player::PlayerCore::finishSort(Playlist::Reorder_t& reorder)
+{
+    mPlaylist.applyOrder(reorder);
+    const std::vector<uint32_t>& order = reorder.order;
+
+    // The current entry, the one loading and the one decoded ahead keep pointing at the same tracks; so do the
+    // queue and the shuffle round
+    const int32_t current     = mCurrentIndex;
+    const int32_t loading     = mLoadIndex;
+    const int32_t prefetching = mPrefetchIndex;
+    for (size_t position = 0; position < order.size(); ++position)
+    {
+        const int32_t previous = static_cast<int32_t>(order[position]);
+        if (previous == current)
+        {
+            mCurrentIndex = static_cast<int32_t>(position);
+        }
+        if (previous == loading)
+        {
+            mLoadIndex = static_cast<int32_t>(position);
+        }
+        if (previous == prefetching)
+        {
+            mPrefetchIndex = static_cast<int32_t>(position);
+        }
+    }
+    mPlayOrder.remap(order);
+}
+
+void Player::PlayerCore::publish()
+{
+    const PlayerSnapshotHandle previous = mSnapshot.load(std::memory_order_relaxed);
+    auto                       snapshot = std::make_shared<PlayerSnapshot_t>();
+    snapshot->version         = previous ? previous->version + 1 : 1;
+    snapshot->trackIndex      = mCurrentIndex;
+    snapshot->playlistSize    = mPlaylist.size();
+    snapshot->open            = mOutput.isOpen();
+    snapshot->playing         = mOutput.isPlaying();
+    snapshot->paused          = mOutput.isPaused();
+    snapshot->loading         = static_cast<bool>(mTrackLoad);
+    snapshot->playlistBusy    = static_cast<bool>(mPlaylistJob);
+    snapshot->shuffle         = mPlayOrder.getShuffle();
+    snapshot->repeat          = mPlayOrder.getRepeat();
+    snapshot->nextIndex       = mNextIndex;
+    snapshot->queueSize       = mPlayOrder.getQueue().size();
+    snapshot->durationSeconds = mOutput.getDuration();
+    snapshot->volume          = mVolume;
+    snapshot->balance         = mBalance;
+    snapshot->eqGainsDb       = mEqGainsDb;
+    snapshot->track           = mTrack;
+    snapshot->statusMessage   = mStatusMessage;
+    mSnapshot.store(std::move(snapshot), std::memory_order_release);
+    mDirty = false;
+}
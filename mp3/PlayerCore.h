@@ -0,0 +1,246 @@
+#pragma once
+
+#include "CommandQueue.h"
+#include "LevelMeter.h"
+#include "LibraryScanner.h"
+#include "MP3Decoder.h"
+#include "PlayOrder.h"
+#include "PlaybackClock.h"
+#include "Playlist.h"
+#include "TagReader.h"
+#include "ThreadPool.h"
+#include "TrackDisplay.h"
+#include "TrackLoader.h"
+
+#include <atomic>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Player
+{
+
+	/// @brief What the core drives: the waveOut player in the app, a stand-in in the benchmarks. Only ever called
+	///        from the thread that runs PlayerCore::process().
+	class PlayerOutput
+	{
+	public:
+		virtual ~PlayerOutput() = default;
+
+		virtual bool   openTrack(DecodedAudio_t&& audio, TrackTags_t&& tags) = 0;
+		virtual bool   startPlayback(double startSeconds) = 0;
+		virtual void   setPause() = 0;
+		virtual void   unSetPause() = 0;
+		virtual void   stop() = 0;
+		virtual void   setVolume(float master, float balance) = 0;
+		virtual void   setEqualizerGains(const std::vector<float>& gainsDb) = 0;
+		virtual double getPosition() const = 0;
+		virtual double getDuration() const = 0;
+		virtual bool   isOpen() const = 0;
+		virtual bool   isPlaying() const = 0;
+		virtual bool   isPaused() const = 0;
+
+		/// @brief the last sample of the track has been played, until the next startPlayback() or stop(). The
+		///        core moves on when this turns true, not when getPosition() reaches getDuration().
+		virtual bool isPlayedOut() const = 0;
+
+		/// @brief clock driven by the device, safe to read from any thread (the control server's status); null for
+		///        an output without a device
+		virtual const PlaybackClock* getClock() const { return nullptr; }
+
+		/// @brief levels of the output block that is audible now; false when there is nothing to meter
+		virtual bool getOutputLevels(LevelReading_t&) const { return false; }
+	};
+
+	enum PlayerCommandType_e
+	{
+		PLAYER_PLAY = 0,      // value: start seconds; loads the current track first if needed
+		PLAYER_PAUSE,
+		PLAYER_RESUME,
+		PLAYER_TOGGLE_PAUSE,
+		PLAYER_STOP,
+		PLAYER_SELECT,        // index: playlist entry to load without playing
+		PLAYER_NEXT,          // the up-next queue first, then the playlist in play order
+		PLAYER_PREVIOUS,
+		PLAYER_VOLUME,        // value: 0..1, value2: balance -1..1
+		PLAYER_EQ,            // band, value: gain dB
+		PLAYER_ADD_TRACKS,    // tracks, then paths; select: make the first one current (a lone path already in
+		                      // the playlist is selected where it is instead of added again)
+		PLAYER_CLEAR_PLAYLIST,
+		PLAYER_OPEN_PLAYLIST, // paths[0]: binary, M3U or PLS file that replaces the playlist (read on a worker)
+		PLAYER_SAVE_PLAYLIST, // paths[0]: written in the format its extension names
+		PLAYER_SORT_PLAYLIST, // index: PlaylistColumn_e, value: non-zero for descending (sorted on a worker)
+		PLAYER_SHUFFLE,       // value: non-zero to shuffle
+		PLAYER_REPEAT,        // index: RepeatMode_e
+		PLAYER_ENQUEUE,       // index: playlist entry appended to the up-next queue
+		PLAYER_CLEAR_QUEUE
+	};
+
+	struct PlayerCommand_t
+	{
+		PlayerCommandType_e         type   = PLAYER_PLAY;
+		double                      value  = 0.0;
+		double                      value2 = 0.0;
+		int32_t                     index  = -1;
+		uint32_t                    band   = 0;
+		bool                        select = false;
+		std::vector<ScannedTrack_t> tracks;
+		std::vector<uint32_t>       trackIds; // library ids of tracks, in the same order (optional)
+		std::vector<std::string>    paths;    // bare paths, labelled with their file name
+		uint64_t                    tag = 0;  // caller's cookie, handed back to the process() callback
+	};
+
+	// The loaded track; shared between snapshots until the next load replaces it
+	struct PlayerTrack_t
+	{
+		std::string        path;
+		TrackTags_t        tags;
+		std::vector<float> waveform;
+		TrackDisplay_t     display;
+	};
+
+	// Immutable view of the player state. A new one is published whenever a command or the output changes
+	// something; readers on any thread keep theirs alive for as long as they hold the pointer.
+	struct PlayerSnapshot_t
+	{
+		uint64_t                             version         = 0;
+		int32_t                              trackIndex      = -1;
+		size_t                               playlistSize    = 0;
+		bool                                 open            = false;
+		bool                                 playing         = false;
+		bool                                 paused          = false;
+		bool                                 loading         = false;
+		bool                                 playlistBusy    = false;  // a sort or a playlist file open is running
+		bool                                 shuffle         = false;
+		RepeatMode_e                         repeat          = REPEAT_OFF;
+		int32_t                              nextIndex       = -1;  // what plays when this track ends, -1 if nothing
+		size_t                               queueSize       = 0;
+		double                               durationSeconds = 0.0;
+		float                                volume          = 0.5F;
+		float                                balance         = 0.0F;
+		std::vector<float>                   eqGainsDb;
+		std::shared_ptr<const PlayerTrack_t> track;
+		std::string                          statusMessage;
+	};
+
+	using PlayerSnapshotHandle = std::shared_ptr<const PlayerSnapshot_t>;
+
+	/// @brief Single-threaded owner of the playlist, the transport and the track loader. Any thread may post()
+	///        commands into a lock-free queue; one thread (the UI thread in the app) calls process(), which applies
+	///        them in order, finishes background loads, moves on when a track plays out and publishes a fresh
+	///        snapshot if anything changed. Nothing else mutates player state, so the output and the playlist need
+	///        no locks. Sorting and reading a playlist file take too long for a frame on large playlists, so they
+	///        run on a worker and are applied by a later process(); commands that would change or save the
+	///        playlist meanwhile, and everything posted after them, wait until then.
+	class PlayerCore
+	{
+	public:
+		using CandidateFn = std::function<std::vector<std::filesystem::path>(const std::string& path)>;
+		using AppliedFn   = std::function<void(const PlayerCommand_t& command, const std::string& error)>;
+
+		/// @brief resolveCandidates turns a playlist path into the locations to try (default: the path itself)
+		explicit PlayerCore(PlayerOutput& output, CandidateFn resolveCandidates = {}, size_t queueCapacity = 1024);
+
+		PlayerCore(const PlayerCore&)            = delete;
+		PlayerCore& operator=(const PlayerCore&) = delete;
+
+		/// @brief any thread; false when the queue is full
+		bool post(PlayerCommand_t&& command);
+		bool post(PlayerCommandType_e type, double value = 0.0, double value2 = 0.0);
+
+		/// @brief owner thread: apply every queued command (onApplied sees each one with its error, empty on
+		///        success), poll the load in flight and publish a snapshot on change. Returns commands applied.
+		size_t process(const AppliedFn& onApplied = {});
+
+		/// @brief owner thread: block until a sort or playlist open in flight has been applied, together with the
+		///        commands waiting behind it (before the last save at shutdown)
+		void finishPlaylistWork(const AppliedFn& onApplied = {});
+
+		/// @brief any thread
+		PlayerSnapshotHandle getSnapshot() const { return mSnapshot.load(std::memory_order_acquire); }
+
+		/// @brief any thread: progress of the load in flight, 0..1
+		float getLoadProgress() const { return mLoadProgress.load(std::memory_order_relaxed); }
+
+		/// @brief owner thread only, for views too large to copy into every snapshot
+		const Playlist& getPlaylist() const { return mPlaylist; }
+
+		/// @brief owner thread only: shuffle, repeat and the up-next queue
+		const PlayOrder& getPlayOrder() const { return mPlayOrder; }
+
+		/// @brief owner thread: resolution of the waveform computed for the next load (default 512 points)
+		void setWaveformPoints(size_t points) { mWaveformPoints = points > 0 ? points : 1; }
+
+		static constexpr size_t EQ_BANDS = 5;
+
+	private:
+		struct PlaylistJob_t;
+
+		void        applyCommand(PlayerCommand_t& command, const AppliedFn& onApplied);
+		std::string apply(PlayerCommand_t& command);
+		void        requestLoad(bool playWhenLoaded, double startSeconds);
+		void        pollLoad();
+		void        cancelLoad();
+		void        playCurrent(double startSeconds);
+		std::string moveToTrack(int delta, bool userRequested);
+		void        pollTrackEnd();
+		void        updatePrefetch();
+		void        cancelPrefetch();
+		void        startPlaylistJob(const PlayerCommand_t& command);
+		size_t      pollPlaylistJob(const AppliedFn& onApplied);
+		std::string finishOpen(PlaylistJob_t& job);
+		void        finishSort(Playlist::Reorder_t& reorder);
+		void        publish();
+
+		PlayerOutput&                 mOutput;
+		CandidateFn                   mResolveCandidates;
+		CommandQueue<PlayerCommand_t> mQueue;
+
+		// Owner thread state
+		Playlist                             mPlaylist;
+		int32_t                              mCurrentIndex = -1;
+		int32_t                              mLoadIndex    = -1;  // playlist entry of mTrackLoad
+		PlayOrder                            mPlayOrder;
+		float                                mVolume       = 0.5F;
+		float                                mBalance      = 0.0F;
+		std::vector<float>                   mEqGainsDb;
+		std::shared_ptr<const PlayerTrack_t> mTrack;
+		std::string                          mStatusMessage;
+		TrackLoader                          mTrackLoader;
+		TrackLoadHandle                      mTrackLoad;
+		bool                                 mPlayWhenLoaded   = false;
+		double                               mLoadStartSeconds = 0.0;
+		size_t                               mWaveformPoints   = 512;
+		bool                                 mDirty            = true;
+
+		// The track that plays after the current one is decoded ahead on its own loader, once nothing else is
+		// loading. Moving to it adopts the job, so a finished prefetch starts without a decode.
+		TrackLoader     mPrefetchLoader;
+		TrackLoadHandle mPrefetch;
+		int32_t         mPrefetchIndex = -1;
+		int32_t         mNextIndex     = -1;
+
+		// A sort or a playlist file open in flight on mPlaylistWorker, and the commands waiting for it
+		struct PlaylistJob_t
+		{
+			PlayerCommand_t                             command;
+			std::function<void(Playlist::Reorder_t&)> sortOrder;  // from Playlist::makeSortOrder
+			Playlist::Reorder_t                       reorder;
+			Playlist                                  playlist;   // the file, once read
+			bool                                      opened = false;
+			std::atomic<bool>                         done{false};
+		};
+		std::shared_ptr<PlaylistJob_t> mPlaylistJob;
+		std::deque<PlayerCommand_t>    mDeferred;
+
+		std::atomic<float>                mLoadProgress{0.0F};
+		std::atomic<PlayerSnapshotHandle> mSnapshot;
+
+		// Last, so it is joined before the playlist a sort reads goes away
+		std::unique_ptr<ThreadPool> mPlaylistWorker;
+	};
+
+}
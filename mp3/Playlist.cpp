@@ -0,0 +1,609 @@
+#include "Playlist.h"
+#include "LibraryScanner.h"
+#include "MappedFile.h"
+#include "PlaylistParser.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+    constexpr char     FILE_MAGIC[8]    = {'M', 'P', '3', 'P', 'L', 'S', '0', '2'};
+    constexpr uint16_t MAX_LABEL_LENGTH = 0xFFFF;
+    constexpr uint32_t COLUMN_COUNT     = 10;
+
+    // Followed by every column (entryCount elements each, in Playlist::forEachColumn order) and then textSize
+    // bytes of NUL-terminated strings
+    struct FileHeader_t
+    {
+        char     magic[8]    = {};
+        uint32_t entryCount  = 0;
+        uint32_t columnCount = 0;
+        uint64_t entryBytes  = 0;  // sum of the column element sizes
+        uint64_t textSize    = 0;
+    };
+    static_assert(sizeof(FileHeader_t) == 32, "FileHeader_t is the on-disk header");
+
+    // ImGui treats "##" as the start of a hidden ID suffix, which would truncate the visible label
+    void escapeLabel(std::string& label)
+    {
+        for (size_t pos = label.find("##"); pos != std::string::npos; pos = label.find("##", pos + 2))
+        {
+            label[pos + 1] = ' ';
+        }
+    }
+
+    // "Artist - Title", or just the title; empty without tags
+    std::string makeTitle(const Player::ScannedTrack_t& track)
+    {
+        if (track.title.empty())
+        {
+            return {};
+        }
+        std::string title = track.artist.empty() ? track.title : track.artist + " - " + track.title;
+        escapeLabel(title);
+        return title;
+    }
+
+    char foldCase(char c)
+    {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+
+    // Up to eight characters, case-folded, as a big-endian number padded with zeros: comparing two of them
+    // orders the strings by those characters without touching the arena again
+    uint64_t getSortPrefix(const char* text)
+    {
+        uint64_t prefix = 0;
+        int      index  = 0;
+        for (; index < 8 && text[index] != '\0'; ++index)
+        {
+            prefix = (prefix << 8) | static_cast<uint8_t>(foldCase(text[index]));
+        }
+        return prefix << (8 * (8 - index));
+    }
+
+    // A column laid out in order: sorted[i] = column[order[i]]. The spare capacity is kept, so the next add after
+    // a sort does not copy the column again.
+    template <typename T>
+    std::vector<T> gather(const std::vector<T>& column, const std::vector<uint32_t>& order)
+    {
+        std::vector<T> sorted;
+        sorted.reserve(column.capacity());
+        sorted.resize(order.size());
+        for (size_t index = 0; index < order.size(); ++index)
+        {
+            sorted[index] = column[order[index]];
+        }
+        return sorted;
+    }
+
+    void appendDuration(std::string& label, double durationSeconds)
+    {
+        if (durationSeconds > 0.0)
+        {
+            const unsigned seconds = static_cast<unsigned>(durationSeconds + 0.5);
+            char           duration[16];
+            snprintf(duration, sizeof(duration), "  %u:%02u", seconds / 60, seconds % 60);
+            label += duration;
+        }
+    }
+
+    // Write beside the target and swap, so a crash never leaves a half-written playlist
+    template <typename Write>
+    bool replaceFile(const std::filesystem::path& path, Write&& write)
+    {
+        std::filesystem::path temporary = path;
+        temporary += ".tmp";
+        {
+            std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+            write(out);
+            if (!out.good())
+            {
+                return false;
+            }
+        }
+        std::error_code error;
+        std::filesystem::rename(temporary, path, error);
+        return !error;
+    }
+}
+
+Player::Playlist::Playlist() = default;
+
+Player::Playlist::~Playlist() = default;
+
+Player::Playlist::Playlist(Playlist&&) noexcept = default;
+
+Player::Playlist& Player::Playlist::operator=(Playlist&&) noexcept = default;
+
+template <typename Visit>
+void Player::Playlist::forEachColumn(Visit&& visit)
+{
+    visit(mPathOffsets);
+    visit(mLabelOffsets);
+    visit(mPathLengths);
+    visit(mDurations);
+    visit(mBitrates);
+    visit(mMetadataIds);
+    visit(mAddedOrder);
+    visit(mLabelLengths);
+    visit(mTitleLengths);
+    visit(mFlags);
+}
+
+void Player::Playlist::add(const std::string& path)
+{
+    const std::string label = makeDisplayName(path);
+    addEntry(path, label, 0, 0.0F, 0, NO_METADATA, 0);
+}
+
+void Player::Playlist::add(const ScannedTrack_t& track, uint32_t metadataId)
+{
+    const float duration = static_cast<float>(std::max(track.durationSeconds, 0.0));
+    std::string label    = makeTitle(track);
+    if (label.empty())
+    {
+        addEntry(track.path, makeDisplayName(track.path), 0, duration, track.bitrateKbps, metadataId, 0);
+        return;
+    }
+    const size_t titleLength = label.size();
+    appendDuration(label, track.durationSeconds);
+    addEntry(track.path, label, titleLength, duration, track.bitrateKbps, metadataId, PLAYLIST_FLAG_TAGGED);
+}
+
+void Player::Playlist::addEntry(std::string_view path,
+                                std::string_view label,
+                                size_t           titleLength,
+                                float            duration,
+                                uint32_t         bitrate,
+                                uint32_t         metadataId,
+                                uint8_t          flags)
+{
+    mPathOffsets.push_back(appendText(path));
+    mLabelOffsets.push_back(appendText(label));
+    mPathLengths.push_back(static_cast<uint32_t>(path.size()));
+    mDurations.push_back(duration);
+    mBitrates.push_back(bitrate);
+    mMetadataIds.push_back(metadataId);
+    mAddedOrder.push_back(mNextAdded++);
+    mLabelLengths.push_back(static_cast<uint16_t>(std::min<size_t>(label.size(), MAX_LABEL_LENGTH)));
+    mTitleLengths.push_back(static_cast<uint16_t>(std::min<size_t>(titleLength, MAX_LABEL_LENGTH)));
+    mFlags.push_back(flags);
+    mModified = true;
+}
+
+uint64_t Player::Playlist::appendText(std::string_view text)
+{
+    const uint64_t offset = mMappedTextSize + mText.size();
+    mText.insert(mText.end(), text.begin(), text.end());
+    mText.push_back('\0');
+    return offset;
+}
+
+void Player::Playlist::reserve(size_t count)
+{
+    forEachColumn([count](auto& column) { column.reserve(count); });
+}
+
+void Player::Playlist::clear()
+{
+    forEachColumn([](auto& column) { column.clear(); });
+    mNextAdded = 0;
+    mText.clear();
+    mMapped.reset();
+    mMappedText     = nullptr;
+    mMappedTextSize = 0;
+    mMappedPath.clear();
+    mModified = false;
+}
+
+std::string_view Player::Playlist::getPath(size_t index) const
+{
+    return std::string_view(getText(mPathOffsets[index]), mPathLengths[index]);
+}
+
+std::string_view Player::Playlist::getTitle(size_t index) const
+{
+    return std::string_view(getText(mLabelOffsets[index]), mTitleLengths[index]);
+}
+
+void Player::Playlist::setLoadResult(size_t index, bool loaded, float durationSeconds)
+{
+    const uint8_t flags = mFlags[index];
+    mFlags[index]       = loaded ? static_cast<uint8_t>((flags | PLAYLIST_FLAG_LOADED) & ~PLAYLIST_FLAG_MISSING)
+                                 : static_cast<uint8_t>(flags | PLAYLIST_FLAG_MISSING);
+    if (loaded && durationSeconds > 0.0F)
+    {
+        mDurations[index] = durationSeconds;
+    }
+    mModified = mModified || mFlags[index] != flags || (loaded && durationSeconds > 0.0F);
+}
+
+void Player::Playlist::sort(PlaylistColumn_e column, bool descending, std::vector<uint32_t>* order)
+{
+    Reorder_t reorder;
+    makeSortOrder(column, descending)(reorder);
+    applyOrder(reorder);
+    if (order != nullptr)
+    {
+        *order = std::move(reorder.order);
+    }
+}
+
+std::function<void(Player::Playlist::Reorder_t&)> Player::Playlist::makeSortOrder(PlaylistColumn_e column,
+                                                                                  bool             descending) const
+{
+    if (column == PLAYLIST_COLUMN_TITLE || column == PLAYLIST_COLUMN_PATH)
+    {
+        const std::vector<uint64_t>* offsets = column == PLAYLIST_COLUMN_TITLE ? &mLabelOffsets : &mPathOffsets;
+        return [this, offsets, descending](Reorder_t& reorder)
+        {
+            MP3_PROFILE_SCOPE("playlist.sort");
+            reorder.order.resize(offsets->size());
+            sortByText(*offsets, descending, reorder.order);
+            gatherUnloaded(reorder);
+        };
+    }
+
+    // Numeric columns: key and index packed into one word, so the sort moves 8-byte values and is stable because
+    // the index breaks ties. Durations are never negative, so their bit patterns order like the values. The keys
+    // are copied here, so a load recording a duration meanwhile does not race the sort.
+    const size_t          count = size();
+    std::vector<uint64_t> keys(count);
+    for (size_t index = 0; index < count; ++index)
+    {
+        uint32_t key = 0;
+        switch (column)
+        {
+        case PLAYLIST_COLUMN_DURATION:
+            key = std::bit_cast<uint32_t>(mDurations[index]);
+            break;
+        case PLAYLIST_COLUMN_BITRATE:
+            key = mBitrates[index];
+            break;
+        default:
+            key = mAddedOrder[index];
+            break;
+        }
+        keys[index] = (static_cast<uint64_t>(descending ? ~key : key) << 32) | index;
+    }
+    return [this, keys = std::move(keys)](Reorder_t& reorder) mutable
+    {
+        MP3_PROFILE_SCOPE("playlist.sort");
+        std::sort(keys.begin(), keys.end());
+        reorder.order.resize(keys.size());
+        for (size_t index = 0; index < keys.size(); ++index)
+        {
+            reorder.order[index] = static_cast<uint32_t>(keys[index]);
+        }
+        gatherUnloaded(reorder);
+    };
+}
+
+void Player::Playlist::gatherUnloaded(Reorder_t& reorder) const
+{
+    const std::vector<uint32_t>& order = reorder.order;
+    reorder.pathOffsets                = gather(mPathOffsets, order);
+    reorder.labelOffsets               = gather(mLabelOffsets, order);
+    reorder.pathLengths                = gather(mPathLengths, order);
+    reorder.bitrates                   = gather(mBitrates, order);
+    reorder.metadataIds                = gather(mMetadataIds, order);
+    reorder.addedOrder                 = gather(mAddedOrder, order);
+    reorder.labelLengths               = gather(mLabelLengths, order);
+    reorder.titleLengths               = gather(mTitleLengths, order);
+}
+
+void Player::Playlist::applyOrder(Reorder_t& reorder)
+{
+    MP3_PROFILE_SCOPE("playlist.reorder");
+    mPathOffsets.swap(reorder.pathOffsets);
+    mLabelOffsets.swap(reorder.labelOffsets);
+    mPathLengths.swap(reorder.pathLengths);
+    mBitrates.swap(reorder.bitrates);
+    mMetadataIds.swap(reorder.metadataIds);
+    mAddedOrder.swap(reorder.addedOrder);
+    mLabelLengths.swap(reorder.labelLengths);
+    mTitleLengths.swap(reorder.titleLengths);
+    // A load may have written these since the order was made, so they are laid out only now
+    mDurations = gather(mDurations, reorder.order);
+    mFlags     = gather(mFlags, reorder.order);
+    mModified  = true;
+}
+
+void Player::Playlist::sortByText(const std::vector<uint64_t>& offsets,
+                                  bool                         descending,
+                                  std::vector<uint32_t>&       order) const
+{
+    // Multikey sort on 8-byte slices held next to the index: sort by the first slice, then re-key only the runs
+    // that tie with the next slice of their strings, and so on. Each level reads every string still tied once,
+    // instead of every comparison chasing two strings through the arena, which matters when most entries share
+    // a prefix (a common music folder, one artist).
+    struct TextKey_t
+    {
+        uint64_t slice;
+        uint32_t index;
+    };
+    struct Range_t
+    {
+        size_t begin;
+        size_t end;
+        size_t depth;
+    };
+
+    std::vector<TextKey_t> keys(offsets.size());
+    for (size_t index = 0; index < offsets.size(); ++index)
+    {
+        keys[index] = {getSortPrefix(getText(offsets[index])), static_cast<uint32_t>(index)};
+    }
+
+    const auto bySlice = [descending](const TextKey_t& a, const TextKey_t& b)
+    {
+        if (a.slice != b.slice)
+        {
+            return descending ? a.slice > b.slice : a.slice < b.slice;
+        }
+        return a.index < b.index;
+    };
+    std::vector<Range_t> pending{{0, keys.size(), 0}};
+    while (!pending.empty())
+    {
+        const Range_t range = pending.back();
+        pending.pop_back();
+        std::sort(keys.begin() + range.begin, keys.begin() + range.end, bySlice);
+
+        for (size_t first = range.begin; first < range.end;)
+        {
+            size_t last = first + 1;
+            while (last < range.end && keys[last].slice == keys[first].slice)
+            {
+                ++last;
+            }
+            // A slice ending in a NUL byte means the strings ended inside it: the run is equal and already in
+            // index order
+            if (last - first > 1 && (keys[first].slice & 0xFF) != 0)
+            {
+                const size_t depth = range.depth + 8;
+                for (size_t key = first; key < last; ++key)
+                {
+                    keys[key].slice = getSortPrefix(getText(offsets[keys[key].index]) + depth);
+                }
+                pending.push_back({first, last, depth});
+            }
+            first = last;
+        }
+    }
+
+    for (size_t index = 0; index < keys.size(); ++index)
+    {
+        order[index] = keys[index].index;
+    }
+}
+
+size_t Player::Playlist::find(std::string_view path) const
+{
+    for (size_t index = 0; index < size(); ++index)
+    {
+        if (mPathLengths[index] == path.size() && getPath(index) == path)
+        {
+            return index;
+        }
+    }
+    return NOT_FOUND;
+}
+
+void Player::Playlist::filter(std::string_view query, std::vector<uint32_t>& matches) const
+{
+    MP3_PROFILE_SCOPE("playlist.filter");
+    matches.clear();
+    std::string folded(query);
+    std::transform(folded.begin(), folded.end(), folded.begin(), foldCase);
+    for (size_t index = 0; index < size(); ++index)
+    {
+        const std::string_view label(getText(mLabelOffsets[index]), mLabelLengths[index]);
+        const auto             found = std::search(label.begin(),
+                                       label.end(),
+                                       folded.begin(),
+                                       folded.end(),
+                                       [](char a, char b) { return foldCase(a) == b; });
+        if (found != label.end() || folded.empty())
+        {
+            matches.push_back(static_cast<uint32_t>(index));
+        }
+    }
+}
+
+void Player::Playlist::filterFlags(uint8_t required, uint8_t excluded, std::vector<uint32_t>& matches) const
+{
+    matches.clear();
+    for (size_t index = 0; index < mFlags.size(); ++index)
+    {
+        if ((mFlags[index] & required) == required && (mFlags[index] & excluded) == 0)
+        {
+            matches.push_back(static_cast<uint32_t>(index));
+        }
+    }
+}
+
+bool Player::Playlist::open(const std::filesystem::path& path)
+{
+    MP3_PROFILE_SCOPE("playlist.open");
+    const PlaylistFormat_e format = PlaylistParser::getFormat(path);
+    if (format == PLAYLIST_BINARY)
+    {
+        return openBinary(path);
+    }
+
+    std::vector<ScannedTrack_t> tracks;
+    {
+        MappedFile file;
+        if (!file.open(path))
+        {
+            return false;
+        }
+        const std::string_view text(reinterpret_cast<const char*>(file.data()), file.size());
+        PlaylistParser::parse(text, format, path.parent_path().generic_string(), tracks);
+    }
+
+    Playlist loaded;
+    loaded.reserve(tracks.size());
+    for (const ScannedTrack_t& track : tracks)
+    {
+        loaded.add(track);
+    }
+    *this = std::move(loaded);
+    return true;
+}
+
+bool Player::Playlist::openBinary(const std::filesystem::path& path)
+{
+    auto mapped = std::make_unique<MappedFile>();
+    if (!mapped->open(path) || mapped->size() < sizeof(FileHeader_t))
+    {
+        return false;
+    }
+
+    Playlist loaded;
+    uint64_t entryBytes = 0;
+    loaded.forEachColumn([&entryBytes](auto& column) { entryBytes += sizeof(column[0]); });
+
+    FileHeader_t header;
+    memcpy(&header, mapped->data(), sizeof(header));
+    const uint64_t columnBytes = static_cast<uint64_t>(header.entryCount) * entryBytes;
+    const uint64_t available   = mapped->size() - sizeof(header);
+    if (memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 || header.columnCount != COLUMN_COUNT ||
+        header.entryBytes != entryBytes || available < columnBytes || available - columnBytes != header.textSize)
+    {
+        return false;
+    }
+    const char* text = reinterpret_cast<const char*>(mapped->data() + sizeof(header) + columnBytes);
+    if (header.textSize > 0 && text[header.textSize - 1] != '\0')
+    {
+        return false;
+    }
+
+    // Only the columns are copied (41 bytes an entry) and bounds-checked; the strings are not touched, so their
+    // pages are read when a row is first drawn. The arena ends with a NUL, so no label can run past it.
+    const size_t   count  = header.entryCount;
+    const uint8_t* cursor = mapped->data() + sizeof(header);
+    loaded.forEachColumn(
+        [&](auto& column)
+        {
+            column.resize(count);
+            if (count > 0)
+            {
+                memcpy(column.data(), cursor, count * sizeof(column[0]));
+            }
+            cursor += count * sizeof(column[0]);
+        });
+    const uint64_t textSize = header.textSize;
+    const auto     inArena  = [textSize](uint64_t offset, uint64_t length)
+    { return offset < textSize && length < textSize - offset; };
+    for (size_t index = 0; index < count; ++index)
+    {
+        if (!inArena(loaded.mPathOffsets[index], loaded.mPathLengths[index]) ||
+            !inArena(loaded.mLabelOffsets[index], loaded.mLabelLengths[index]) ||
+            loaded.mTitleLengths[index] > loaded.mLabelLengths[index])
+        {
+            return false;
+        }
+        loaded.mNextAdded = std::max(loaded.mNextAdded, loaded.mAddedOrder[index] + 1);
+    }
+
+    loaded.mMapped         = std::move(mapped);
+    loaded.mMappedText     = text;
+    loaded.mMappedTextSize = textSize;
+    loaded.mMappedPath     = path;
+    loaded.mModified       = false;
+    *this                  = std::move(loaded);
+    return true;
+}
+
+bool Player::Playlist::save(const std::filesystem::path& path)
+{
+    MP3_PROFILE_SCOPE("playlist.save");
+    const PlaylistFormat_e format = PlaylistParser::getFormat(path);
+    if (format == PLAYLIST_BINARY)
+    {
+        return saveBinary(path);
+    }
+
+    std::string text;
+    PlaylistParser::write(*this, format, text);
+    return replaceFile(path,
+                       [&](std::ofstream& out) { out.write(text.data(), static_cast<std::streamsize>(text.size())); });
+}
+
+bool Player::Playlist::saveBinary(const std::filesystem::path& path)
+{
+    std::error_code error;
+    if (mMapped && std::filesystem::equivalent(path, mMappedPath, error))
+    {
+        if (!mModified)
+        {
+            // Already on disk as it is
+            return true;
+        }
+        // The file is about to be replaced, and Windows will not replace a mapped one
+        releaseMapping();
+    }
+
+    FileHeader_t header;
+    memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+    header.entryCount  = static_cast<uint32_t>(size());
+    header.columnCount = COLUMN_COUNT;
+    header.textSize    = mMappedTextSize + mText.size();
+    forEachColumn([&header](auto& column) { header.entryBytes += sizeof(column[0]); });
+
+    // Offsets already count the mapped arena first, so both arenas are written back to back unchanged
+    return replaceFile(path,
+                       [&](std::ofstream& out)
+                       {
+                           out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                           forEachColumn(
+                               [&out](auto& column)
+                               {
+                                   out.write(reinterpret_cast<const char*>(column.data()),
+                                             static_cast<std::streamsize>(column.size() * sizeof(column[0])));
+                               });
+                           out.write(mMappedText, static_cast<std::streamsize>(mMappedTextSize));
+                           out.write(mText.data(), static_cast<std::streamsize>(mText.size()));
+                       });
+}
+
+void Player::Playlist::releaseMapping()
+{
+    std::vector<char> text(mMappedTextSize + mText.size());
+    memcpy(text.data(), mMappedText, static_cast<size_t>(mMappedTextSize));
+    memcpy(text.data() + mMappedTextSize, mText.data(), mText.size());
+    mText.swap(text);
+    mMapped.reset();
+    mMappedText     = nullptr;
+    mMappedTextSize = 0;
+    mMappedPath.clear();
+}
+
+std::string Player::Playlist::makeDisplayName(const std::string& path)
+{
+    const size_t separator = path.find_last_of("/\\");
+    std::string  label     = (separator == std::string::npos || separator + 1 == path.size())
+                                 ? path
+                                 : path.substr(separator + 1);
+    escapeLabel(label);
+    return label;
+}
+
+std::string Player::Playlist::makeDisplayName(const ScannedTrack_t& track)
+{
+    std::string label = makeTitle(track);
+    if (label.empty())
+    {
+        return makeDisplayName(track.path);
+    }
+    appendDuration(label, track.durationSeconds);
+    return label;
+}
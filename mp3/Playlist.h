@@ -0,0 +1,181 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Player
+{
+
+	class MappedFile;
+	struct ScannedTrack_t;
+
+	enum PlaylistColumn_e
+	{
+		PLAYLIST_COLUMN_ADDED = 0,  // the order entries were added in
+		PLAYLIST_COLUMN_TITLE,      // the label the view shows
+		PLAYLIST_COLUMN_PATH,
+		PLAYLIST_COLUMN_DURATION,
+		PLAYLIST_COLUMN_BITRATE,
+		PLAYLIST_COLUMN_COUNT
+	};
+
+	enum PlaylistFlags_e : uint8_t
+	{
+		PLAYLIST_FLAG_TAGGED  = 1 << 0,  // the label came from tags, not the file name
+		PLAYLIST_FLAG_LOADED  = 1 << 1,  // decoded at least once: the duration is exact and a waveform was built
+		PLAYLIST_FLAG_MISSING = 1 << 2   // the last load could not find or decode the file
+	};
+
+	/// @brief Ordered list of tracks, stored as parallel columns: string offsets into one NUL-terminated arena,
+	///        durations, bitrates, library ids, flags. Sorting or filtering on a field reads only that column, and
+	///        the label the view shows is built once when the entry is added, so drawing a row is a pointer lookup.
+	///        The binary playlist file is the same columns followed by the arena. open() maps it and copies the
+	///        columns. The strings stay in the mapping and are paged in when a row is first drawn or played.
+	///        Entries added later go to a second arena in memory whose offsets continue after the mapped one.
+	class Playlist
+	{
+	public:
+		static constexpr uint32_t NO_METADATA = 0xFFFFFFFF;
+		static constexpr size_t   NOT_FOUND   = static_cast<size_t>(-1);
+
+		Playlist();
+		~Playlist();
+
+		Playlist(Playlist&&) noexcept;
+		Playlist& operator=(Playlist&&) noexcept;
+
+		/// @brief append a path, labelled with its file name
+		void add(const std::string& path);
+
+		/// @brief append a probed track, labelled "Artist - Title  m:ss" when tags are present. metadataId is the
+		///        track's MetadataStore id, if known.
+		void add(const ScannedTrack_t& track, uint32_t metadataId = NO_METADATA);
+
+		void reserve(size_t count);
+		void clear();
+
+		size_t size() const { return mPathOffsets.size(); }
+		bool   empty() const { return mPathOffsets.empty(); }
+
+		std::string_view getPath(size_t index) const;
+		const char*      getDisplayName(size_t index) const { return getText(mLabelOffsets[index]); }
+
+		/// @brief the label without its duration suffix, empty for entries added as bare paths
+		std::string_view getTitle(size_t index) const;
+
+		float    getDuration(size_t index) const { return mDurations[index]; }
+		uint32_t getBitrate(size_t index) const { return mBitrates[index]; }
+		uint8_t  getFlags(size_t index) const { return mFlags[index]; }
+
+		/// @brief library id recorded when the entry was added. Ids change when the library is compacted, so
+		///        check the library's path for the id before trusting it.
+		uint32_t getMetadataId(size_t index) const { return mMetadataIds[index]; }
+
+		/// @brief record what a load found out: the exact duration and LOADED on success, MISSING on failure
+		void setLoadResult(size_t index, bool loaded, float durationSeconds);
+
+		/// @brief reorder by one column (stable, ties keep their order). order receives the old index of every
+		///        new position, for callers that hold indices.
+		void sort(PlaylistColumn_e column, bool descending, std::vector<uint32_t>* order = nullptr);
+
+		/// @brief a sort made by a makeSortOrder() function: order holds the old index of every new position, the
+		///        rest are the columns a load never writes, already laid out in that order
+		struct Reorder_t
+		{
+			std::vector<uint32_t> order;
+			std::vector<uint64_t> pathOffsets;
+			std::vector<uint64_t> labelOffsets;
+			std::vector<uint32_t> pathLengths;
+			std::vector<uint32_t> bitrates;
+			std::vector<uint32_t> metadataIds;
+			std::vector<uint32_t> addedOrder;
+			std::vector<uint16_t> labelLengths;
+			std::vector<uint16_t> titleLengths;
+		};
+
+		/// @brief sort() in two steps, so the sort and most of the reordering can run on another thread. A numeric
+		///        key is copied here; the returned function reads the strings and the columns setLoadResult()
+		///        leaves alone, so until it returns the playlist must not be added to, cleared, reordered or
+		///        destroyed. applyOrder() then swaps the result in and reorders the durations and flags.
+		std::function<void(Reorder_t& reorder)> makeSortOrder(PlaylistColumn_e column, bool descending) const;
+		void                                    applyOrder(Reorder_t& reorder);
+
+		/// @brief index of the first entry stored with exactly this path, or NOT_FOUND. Reads the length column and
+		///        only compares the paths of entries with a matching length.
+		size_t find(std::string_view path) const;
+
+		/// @brief indices of entries whose label contains query (ASCII case-insensitive), in playlist order
+		void filter(std::string_view query, std::vector<uint32_t>& matches) const;
+
+		/// @brief indices of entries with every flag of required and none of excluded, in playlist order
+		void filterFlags(uint8_t required, uint8_t excluded, std::vector<uint32_t>& matches) const;
+
+		/// @brief replace the contents with a playlist file: the binary format is mapped, M3U and PLS are parsed
+		///        in parallel (see PlaylistParser). False (and the playlist unchanged) if it cannot be read.
+		bool open(const std::filesystem::path& path);
+
+		/// @brief write the playlist in the format its extension names (binary for anything but .m3u/.m3u8/.pls).
+		///        Saving an unmodified playlist back to the binary file it was opened from writes nothing.
+		bool save(const std::filesystem::path& path);
+
+		/// @brief label for a bare path: the file name, or the path itself if it has none
+		static std::string makeDisplayName(const std::string& path);
+
+		/// @brief label for a probed track
+		static std::string makeDisplayName(const ScannedTrack_t& track);
+
+	private:
+		void        addEntry(std::string_view path,
+		                     std::string_view label,
+		                     size_t           titleLength,
+		                     float            duration,
+		                     uint32_t         bitrate,
+		                     uint32_t         metadataId,
+		                     uint8_t          flags);
+		uint64_t    appendText(std::string_view text);
+		const char* getText(uint64_t offset) const
+		{
+			return offset < mMappedTextSize ? mMappedText + offset : mText.data() + (offset - mMappedTextSize);
+		}
+
+		void sortByText(const std::vector<uint64_t>& offsets, bool descending, std::vector<uint32_t>& order) const;
+		void gatherUnloaded(Reorder_t& reorder) const;
+
+		/// @brief visit(column) for every column vector, in file order
+		template <typename Visit>
+		void forEachColumn(Visit&& visit);
+
+		bool openBinary(const std::filesystem::path& path);
+		bool saveBinary(const std::filesystem::path& path);
+		void releaseMapping();
+
+		// Columns, one element per entry. The file stores them in this order, widest first.
+		std::vector<uint64_t> mPathOffsets;
+		std::vector<uint64_t> mLabelOffsets;
+		std::vector<uint32_t> mPathLengths;
+		std::vector<float>    mDurations;
+		std::vector<uint32_t> mBitrates;
+		std::vector<uint32_t> mMetadataIds;
+		std::vector<uint32_t> mAddedOrder;
+		std::vector<uint16_t> mLabelLengths;
+		std::vector<uint16_t> mTitleLengths;  // prefix of the label before the duration suffix
+		std::vector<uint8_t>  mFlags;
+		uint32_t              mNextAdded = 0;
+
+		std::vector<char> mText;
+
+		// String arena of the file open() mapped, if any
+		std::unique_ptr<MappedFile> mMapped;
+		const char*                 mMappedText     = nullptr;
+		uint64_t                    mMappedTextSize = 0;
+		std::filesystem::path       mMappedPath;
+		bool                        mModified = false;  // changed since open() mapped mMappedPath
+	};
+
+}
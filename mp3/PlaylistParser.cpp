@@ -0,0 +1,454 @@
+#include "PlaylistParser.h"
+#include "LibraryScanner.h"
+#include "Playlist.h"
+#include "Profiler.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <thread>
+
+namespace
+{
+    constexpr size_t BYTES_PER_THREAD   = 256 * 1024;
+    constexpr size_t ENTRIES_PER_THREAD = 16384;
+
+    struct ParsedEntry_t
+    {
+        uint32_t               number = 0;  // PLS entry number, unused for M3U
+        Player::ScannedTrack_t track;
+    };
+
+    struct ParsedChunk_t
+    {
+        std::vector<ParsedEntry_t> entries;
+        bool                       leadingPath  = false;  // M3U: the first path had no #EXTINF in this chunk
+        bool                       trailingInfo = false;  // M3U: the last entry is an #EXTINF still without a path
+    };
+
+    // Run work(chunk) for every chunk, one thread each; the caller's thread takes the first
+    template <typename Work>
+    void runChunks(size_t chunkCount, Work&& work)
+    {
+        std::vector<std::thread> workers;
+        for (size_t chunk = 1; chunk < chunkCount; ++chunk)
+        {
+            workers.emplace_back([&work, chunk] { work(chunk); });
+        }
+        work(0);
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    size_t pickThreadCount(size_t requested, size_t work, size_t workPerThread)
+    {
+        const size_t limit = requested > 0 ? requested : Player::ThreadPool::getDefaultThreadCount();
+        return std::clamp<size_t>(work / workPerThread, 1, std::max<size_t>(limit, 1));
+    }
+
+    std::string_view trim(std::string_view text)
+    {
+        while (!text.empty() && (text.front() == ' ' || text.front() == '\t'))
+        {
+            text.remove_prefix(1);
+        }
+        while (!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\r'))
+        {
+            text.remove_suffix(1);
+        }
+        return text;
+    }
+
+    bool startsWith(std::string_view text, std::string_view prefix)
+    {
+        if (text.size() < prefix.size())
+        {
+            return false;
+        }
+        for (size_t index = 0; index < prefix.size(); ++index)
+        {
+            const char c = text[index];
+            if (((c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c) != prefix[index])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Seconds, 0 for the "-1" (unknown) both formats use
+    float parseSeconds(std::string_view text)
+    {
+        double seconds = 0.0;
+        std::from_chars(text.data(), text.data() + text.size(), seconds);
+        return seconds > 0.0 ? static_cast<float>(seconds) : 0.0F;
+    }
+
+    // Drive letters, UNC and rooted paths, and URLs are kept as they are; anything else is relative to the playlist
+    bool isAbsolute(std::string_view path)
+    {
+        return path.front() == '/' || path.front() == '\\' || (path.size() > 1 && path[1] == ':') ||
+               path.find("://") != std::string_view::npos;
+    }
+
+    std::string makePath(std::string_view path, const std::string& baseDir)
+    {
+        if (baseDir.empty() || isAbsolute(path))
+        {
+            return std::string(path);
+        }
+        std::string joined;
+        joined.reserve(baseDir.size() + 1 + path.size());
+        joined += baseDir;
+        joined += '/';
+        joined += path;
+        return joined;
+    }
+
+    template <typename Line>
+    void forEachLine(std::string_view text, Line&& line)
+    {
+        while (!text.empty())
+        {
+            const size_t end = text.find('\n');
+            line(trim(text.substr(0, end)));
+            text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+        }
+    }
+
+    void parseM3uChunk(std::string_view text, const std::string& baseDir, ParsedChunk_t& chunk)
+    {
+        Player::ScannedTrack_t info;
+        bool                   hasInfo = false;
+        forEachLine(text,
+                    [&](std::string_view line)
+                    {
+                        if (line.empty())
+                        {
+                            return;
+                        }
+                        if (startsWith(line, "#extinf:"))
+                        {
+                            // #EXTINF:<seconds>[ attributes],<title>
+                            line.remove_prefix(8);
+                            const size_t comma   = line.find(',');
+                            const size_t space   = line.find(' ');
+                            info                 = {};
+                            info.durationSeconds = parseSeconds(line.substr(0, std::min(comma, space)));
+                            if (comma != std::string_view::npos)
+                            {
+                                info.title = std::string(trim(line.substr(comma + 1)));
+                            }
+                            hasInfo = true;
+                            return;
+                        }
+                        if (line.front() == '#')
+                        {
+                            return;
+                        }
+                        if (chunk.entries.empty() && !hasInfo)
+                        {
+                            chunk.leadingPath = true;
+                        }
+                        ParsedEntry_t& entry = chunk.entries.emplace_back();
+                        if (hasInfo)
+                        {
+                            entry.track = std::move(info);
+                            hasInfo     = false;
+                        }
+                        entry.track.path = makePath(line, baseDir);
+                    });
+        if (hasInfo)
+        {
+            chunk.entries.emplace_back().track = std::move(info);
+            chunk.trailingInfo                 = true;
+        }
+    }
+
+    void parsePlsChunk(std::string_view text, const std::string& baseDir, ParsedChunk_t& chunk)
+    {
+        forEachLine(text,
+                    [&](std::string_view line)
+                    {
+                        // FileN=, TitleN=, LengthN=; everything else ([playlist], NumberOfEntries, Version) is skipped
+                        int keyLength = 0;
+                        if (startsWith(line, "file"))
+                        {
+                            keyLength = 4;
+                        }
+                        else if (startsWith(line, "title"))
+                        {
+                            keyLength = 5;
+                        }
+                        else if (startsWith(line, "length"))
+                        {
+                            keyLength = 6;
+                        }
+                        const size_t equals = line.find('=');
+                        uint32_t     number = 0;
+                        if (keyLength == 0 || equals == std::string_view::npos ||
+                            std::from_chars(line.data() + keyLength, line.data() + equals, number).ptr !=
+                                line.data() + equals)
+                        {
+                            return;
+                        }
+                        const std::string_view value = trim(line.substr(equals + 1));
+
+                        // The keys of one entry are normally adjacent; a scattered one gets its own entry and is
+                        // merged after sorting
+                        if (chunk.entries.empty() || chunk.entries.back().number != number)
+                        {
+                            chunk.entries.emplace_back().number = number;
+                        }
+                        Player::ScannedTrack_t& track = chunk.entries.back().track;
+                        if (keyLength == 4 && !value.empty())
+                        {
+                            track.path = makePath(value, baseDir);
+                        }
+                        else if (keyLength == 5)
+                        {
+                            track.title = std::string(value);
+                        }
+                        else if (keyLength == 6)
+                        {
+                            track.durationSeconds = parseSeconds(value);
+                        }
+                    });
+    }
+
+    void mergeTrack(Player::ScannedTrack_t& into, Player::ScannedTrack_t&& from)
+    {
+        if (into.path.empty())
+        {
+            into.path = std::move(from.path);
+        }
+        if (into.title.empty())
+        {
+            into.title = std::move(from.title);
+        }
+        if (into.durationSeconds <= 0.0)
+        {
+            into.durationSeconds = from.durationSeconds;
+        }
+    }
+
+    void stitchM3u(std::vector<ParsedChunk_t>& chunks, std::vector<Player::ScannedTrack_t>& tracks)
+    {
+        size_t total = 0;
+        for (const ParsedChunk_t& chunk : chunks)
+        {
+            total += chunk.entries.size();
+        }
+        tracks.reserve(tracks.size() + total);
+
+        Player::ScannedTrack_t* pendingInfo = nullptr;
+        for (ParsedChunk_t& chunk : chunks)
+        {
+            if (chunk.entries.empty())
+            {
+                continue;
+            }
+            if (pendingInfo != nullptr && chunk.leadingPath)
+            {
+                mergeTrack(chunk.entries.front().track, std::move(*pendingInfo));
+            }
+            pendingInfo        = chunk.trailingInfo ? &chunk.entries.back().track : nullptr;
+            const size_t count = chunk.entries.size() - (chunk.trailingInfo ? 1 : 0);
+            for (size_t index = 0; index < count; ++index)
+            {
+                tracks.push_back(std::move(chunk.entries[index].track));
+            }
+        }
+    }
+
+    void stitchPls(std::vector<ParsedChunk_t>& chunks, std::vector<Player::ScannedTrack_t>& tracks)
+    {
+        std::vector<ParsedEntry_t> entries;
+        size_t                     total = 0;
+        for (const ParsedChunk_t& chunk : chunks)
+        {
+            total += chunk.entries.size();
+        }
+        entries.reserve(total);
+        tracks.reserve(tracks.size() + total);
+        for (ParsedChunk_t& chunk : chunks)
+        {
+            std::move(chunk.entries.begin(), chunk.entries.end(), std::back_inserter(entries));
+        }
+
+        const auto byNumber = [](const ParsedEntry_t& a, const ParsedEntry_t& b) { return a.number < b.number; };
+        if (!std::is_sorted(entries.begin(), entries.end(), byNumber))
+        {
+            std::stable_sort(entries.begin(), entries.end(), byNumber);
+        }
+        for (size_t index = 0; index < entries.size();)
+        {
+            ParsedEntry_t& entry = entries[index];
+            size_t         next  = index + 1;
+            for (; next < entries.size() && entries[next].number == entry.number; ++next)
+            {
+                mergeTrack(entry.track, std::move(entries[next].track));
+            }
+            if (!entry.track.path.empty())
+            {
+                tracks.push_back(std::move(entry.track));
+            }
+            index = next;
+        }
+    }
+
+    void appendDuration(std::string& out, float seconds)
+    {
+        char text[16];
+        snprintf(text, sizeof(text), "%d", seconds > 0.0F ? static_cast<int>(seconds + 0.5F) : -1);
+        out += text;
+    }
+
+    void writeM3uRange(const Player::Playlist& playlist, size_t first, size_t last, std::string& out)
+    {
+        for (size_t index = first; index < last; ++index)
+        {
+            const std::string_view title = playlist.getTitle(index);
+            if (!title.empty() || playlist.getDuration(index) > 0.0F)
+            {
+                out += "#EXTINF:";
+                appendDuration(out, playlist.getDuration(index));
+                out += ',';
+                out += title;
+                out += '\n';
+            }
+            out += playlist.getPath(index);
+            out += '\n';
+        }
+    }
+
+    void writePlsRange(const Player::Playlist& playlist, size_t first, size_t last, std::string& out)
+    {
+        char number[24];
+        for (size_t index = first; index < last; ++index)
+        {
+            snprintf(number, sizeof(number), "%zu=", index + 1);
+            out += "File";
+            out += number;
+            out += playlist.getPath(index);
+            out += '\n';
+            const std::string_view title = playlist.getTitle(index);
+            if (!title.empty())
+            {
+                out += "Title";
+                out += number;
+                out += title;
+                out += '\n';
+            }
+            out += "Length";
+            out += number;
+            appendDuration(out, playlist.getDuration(index));
+            out += '\n';
+        }
+    }
+}
+
+Player::PlaylistFormat_e Player::PlaylistParser::getFormat(const std::filesystem::path& path)
+{
+    const std::string extension = path.extension().string();
+    const auto        is        = [&](std::string_view name)
+    { return extension.size() == name.size() && startsWith(extension, name); };
+    if (is(".m3u") || is(".m3u8"))
+    {
+        return PLAYLIST_M3U;
+    }
+    if (is(".pls"))
+    {
+        return PLAYLIST_PLS;
+    }
+    return PLAYLIST_BINARY;
+}
+
+void Player::PlaylistParser::parse(std::string_view             text,
+                                   PlaylistFormat_e             format,
+                                   const std::string&           baseDir,
+                                   std::vector<ScannedTrack_t>& tracks,
+                                   size_t                       threadCount)
+{
+    MP3_PROFILE_SCOPE("playlist.parse");
+    if (text.size() >= 3 && text.substr(0, 3) == "\xEF\xBB\xBF")
+    {
+        text.remove_prefix(3);
+    }
+
+    // Chunk boundaries are moved forward to the next line start, so every line is parsed by exactly one chunk
+    const size_t        chunkCount = pickThreadCount(threadCount, text.size(), BYTES_PER_THREAD);
+    std::vector<size_t> starts(chunkCount + 1, text.size());
+    starts[0] = 0;
+    for (size_t chunk = 1; chunk < chunkCount; ++chunk)
+    {
+        const size_t newline = text.find('\n', std::max(text.size() * chunk / chunkCount, starts[chunk - 1]));
+        starts[chunk]        = newline == std::string_view::npos ? text.size() : newline + 1;
+    }
+
+    std::vector<ParsedChunk_t> chunks(chunkCount);
+    runChunks(chunkCount,
+              [&](size_t chunk)
+              {
+                  const std::string_view part = text.substr(starts[chunk], starts[chunk + 1] - starts[chunk]);
+                  if (format == PLAYLIST_PLS)
+                  {
+                      parsePlsChunk(part, baseDir, chunks[chunk]);
+                  }
+                  else
+                  {
+                      parseM3uChunk(part, baseDir, chunks[chunk]);
+                  }
+              });
+
+    if (format == PLAYLIST_PLS)
+    {
+        stitchPls(chunks, tracks);
+    }
+    else
+    {
+        stitchM3u(chunks, tracks);
+    }
+}
+
+void Player::PlaylistParser::write(const Playlist& playlist, PlaylistFormat_e format, std::string& out, size_t threadCount)
+{
+    MP3_PROFILE_SCOPE("playlist.format");
+    const size_t             count      = playlist.size();
+    const size_t             chunkCount = pickThreadCount(threadCount, count, ENTRIES_PER_THREAD);
+    std::vector<std::string> parts(chunkCount);
+    runChunks(chunkCount,
+              [&](size_t chunk)
+              {
+                  const size_t first = count * chunk / chunkCount;
+                  const size_t last  = count * (chunk + 1) / chunkCount;
+                  if (format == PLAYLIST_PLS)
+                  {
+                      writePlsRange(playlist, first, last, parts[chunk]);
+                  }
+                  else
+                  {
+                      writeM3uRange(playlist, first, last, parts[chunk]);
+                  }
+              });
+
+    size_t total = 0;
+    for (const std::string& part : parts)
+    {
+        total += part.size();
+    }
+    out.clear();
+    out.reserve(total + 64);
+    out += format == PLAYLIST_PLS ? "[playlist]\n" : "#EXTM3U\n";
+    for (const std::string& part : parts)
+    {
+        out += part;
+    }
+    if (format == PLAYLIST_PLS)
+    {
+        out += "NumberOfEntries=" + std::to_string(count) + "\nVersion=2\n";
+    }
+}
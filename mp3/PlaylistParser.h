@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Player
+{
+
+	class Playlist;
+	struct ScannedTrack_t;
+
+	enum PlaylistFormat_e
+	{
+		PLAYLIST_BINARY = 0,  // Playlist's own mapped format
+		PLAYLIST_M3U,         // .m3u / .m3u8, with #EXTINF duration and title
+		PLAYLIST_PLS          // .pls, FileN / TitleN / LengthN
+	};
+
+	/// @brief Text playlist import and export. The text is cut into chunks at line starts and each chunk is parsed
+	///        on its own thread; the results are stitched back in order, joining an #EXTINF to a path that landed
+	///        in the next chunk and PLS keys of one entry split across chunks. Export formats ranges of entries
+	///        in parallel the same way and concatenates them.
+	class PlaylistParser
+	{
+	public:
+		/// @brief format by extension, binary for anything that is not M3U or PLS
+		static PlaylistFormat_e getFormat(const std::filesystem::path& path);
+
+		/// @brief append the entries of an M3U or PLS text to tracks. Relative paths are joined to baseDir (the
+		///        playlist's folder). threadCount 0 picks one thread per 256 KiB, up to the hardware count.
+		static void parse(std::string_view             text,
+		                  PlaylistFormat_e             format,
+		                  const std::string&           baseDir,
+		                  std::vector<ScannedTrack_t>& tracks,
+		                  size_t                       threadCount = 0);
+
+		/// @brief the whole playlist as M3U or PLS text
+		static void write(const Playlist& playlist, PlaylistFormat_e format, std::string& out, size_t threadCount = 0);
+	};
+
+}
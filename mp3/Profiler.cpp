@@ -0,0 +1,279 @@
+#include "Profiler.h"
+#include "AllocationTracker.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <unistd.h>
+#endif
+
+namespace
+{
+    // Single-writer ring owned by one thread. Slots are atomics so a concurrent snapshot never reads a torn value;
+    // relaxed stores compile to plain moves on x86/ARM.
+    struct ThreadRing
+    {
+        struct Slot
+        {
+            std::atomic<const char*> name{nullptr};
+            std::atomic<uint64_t>    startNs{0};
+            std::atomic<uint64_t>    durationNs{0};
+        };
+
+        uint32_t                                           threadId = 0;
+        std::string                                        name;
+        std::atomic<uint64_t>                              head{0};
+        std::atomic<uint64_t>                              floor{0};
+        std::array<Slot, Player::Profiler::mRingCapacity> slots;
+    };
+
+    struct Registry
+    {
+        std::mutex                               lock;
+        std::vector<std::shared_ptr<ThreadRing>> rings;
+        std::vector<ThreadRing*>                 freeRings;  // left behind by exited threads
+        uint32_t                                 nextThreadId = 1;
+    };
+
+    Registry& getRegistry()
+    {
+        static Registry registry;
+        return registry;
+    }
+
+    // The calling thread's name and, once it has recorded a scope, its ring. A thread that exits hands its ring back
+    // for the next new thread, so threads started per play or seek do not each keep a ring alive.
+    struct ThreadState
+    {
+        ThreadRing* ring = nullptr;
+        std::string name;
+
+        ~ThreadState()
+        {
+            if (ring != nullptr)
+            {
+                Registry&                   registry = getRegistry();
+                std::lock_guard<std::mutex> guard(registry.lock);
+                registry.freeRings.push_back(ring);
+            }
+        }
+    };
+
+    ThreadState& getThreadState()
+    {
+        thread_local ThreadState state;
+        return state;
+    }
+
+    ThreadRing& getThreadRing()
+    {
+        // Rings are owned by the registry so events outlive short-lived worker threads until the ring is reused
+        ThreadState& state = getThreadState();
+        if (state.ring == nullptr)
+        {
+            Registry&                   registry = getRegistry();
+            std::lock_guard<std::mutex> guard(registry.lock);
+            if (!registry.freeRings.empty())
+            {
+                // Only this thread writes head from now on, so the previous owner's events can be hidden here
+                state.ring = registry.freeRings.back();
+                registry.freeRings.pop_back();
+                state.ring->floor.store(state.ring->head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+            else
+            {
+                registry.rings.push_back(std::make_shared<ThreadRing>());
+                state.ring = registry.rings.back().get();
+            }
+            state.ring->threadId = registry.nextThreadId++;
+            state.ring->name     = state.name;
+        }
+        return *state.ring;
+    }
+
+    void writeJsonString(std::ofstream& out, const std::string& text)
+    {
+        out << '"';
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\')
+            {
+                out << '\\' << c;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20)
+            {
+                out << ' ';
+            }
+            else
+            {
+                out << c;
+            }
+        }
+        out << '"';
+    }
+}
+
+std::atomic<bool> Player::Profiler::mEnabled{false};
+
+size_t Player::Profiler::getResidentBytes()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        return counters.WorkingSetSize;
+    }
+    return 0;
+#else
+    // Second field of /proc/self/statm: resident pages
+    std::ifstream statm("/proc/self/statm");
+    size_t        pages    = 0;
+    size_t        resident = 0;
+    if (!(statm >> pages >> resident))
+    {
+        return 0;
+    }
+    return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+uint64_t Player::Profiler::nowNs()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+void Player::Profiler::record(const char* name, uint64_t startNs, uint64_t endNs)
+{
+    ThreadRing&    ring = getThreadRing();
+    const uint64_t head = ring.head.load(std::memory_order_relaxed);
+    auto&          slot = ring.slots[head % mRingCapacity];
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.startNs.store(startNs, std::memory_order_relaxed);
+    slot.durationNs.store(endNs - startNs, std::memory_order_relaxed);
+    ring.head.store(head + 1, std::memory_order_release);
+}
+
+void Player::Profiler::setThreadName(const std::string& name)
+{
+    // The ring is created by the first recorded scope, so naming a thread while profiling is off costs no ring
+    ThreadState& state = getThreadState();
+    {
+        Registry&                   registry = getRegistry();
+        std::lock_guard<std::mutex> guard(registry.lock);
+        state.name = name;
+        if (state.ring != nullptr)
+        {
+            state.ring->name = name;
+        }
+    }
+    AllocationTracker::setThreadName(name.c_str());
+}
+
+std::vector<Player::Profiler::Event_t> Player::Profiler::snapshot()
+{
+    std::vector<Event_t>        events;
+    Registry&                   registry = getRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    for (const auto& ring : registry.rings)
+    {
+        const uint64_t head  = ring->head.load(std::memory_order_acquire);
+        const uint64_t first = std::max((head > mRingCapacity) ? head - mRingCapacity : 0,
+                                        ring->floor.load(std::memory_order_relaxed));
+        const size_t   start = events.size();
+        for (uint64_t index = first; index < head; ++index)
+        {
+            const auto& slot = ring->slots[index % mRingCapacity];
+            Event_t     event;
+            event.name       = slot.name.load(std::memory_order_relaxed);
+            event.startNs    = slot.startNs.load(std::memory_order_relaxed);
+            event.durationNs = slot.durationNs.load(std::memory_order_relaxed);
+            event.threadId   = ring->threadId;
+            events.push_back(event);
+        }
+
+        // Slots the writer lapped while we were copying may mix two events; drop them
+        const uint64_t headAfter = ring->head.load(std::memory_order_acquire);
+        if (head > first && headAfter > mRingCapacity && headAfter - mRingCapacity > first)
+        {
+            const size_t lapped =
+                static_cast<size_t>(std::min<uint64_t>(headAfter - mRingCapacity - first, head - first));
+            events.erase(events.begin() + start, events.begin() + start + lapped);
+        }
+    }
+    return events;
+}
+
+std::vector<Player::Profiler::Thread_t> Player::Profiler::threads()
+{
+    std::vector<Thread_t>       result;
+    Registry&                   registry = getRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    for (const auto& ring : registry.rings)
+    {
+        result.push_back({ring->threadId, ring->name});
+    }
+    return result;
+}
+
+bool Player::Profiler::exportChromeTrace(const std::string& path)
+{
+    std::ofstream out(path, std::ios::binary);
+    if (!out)
+    {
+        return false;
+    }
+
+    const std::vector<Event_t>  events      = snapshot();
+    const std::vector<Thread_t> threadNames = threads();
+
+    uint64_t originNs = UINT64_MAX;
+    for (const auto& event : events)
+    {
+        originNs = std::min(originNs, event.startNs);
+    }
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (const auto& thread : threadNames)
+    {
+        out << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread.threadId
+            << ",\"args\":{\"name\":";
+        writeJsonString(out, thread.name.empty() ? "thread " + std::to_string(thread.threadId) : thread.name);
+        out << "}}";
+        first = false;
+    }
+    for (const auto& event : events)
+    {
+        // Chrome trace timestamps are microseconds
+        out << (first ? "" : ",") << "\n{\"name\":";
+        writeJsonString(out, event.name ? event.name : "?");
+        out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.threadId
+            << ",\"ts\":" << static_cast<double>(event.startNs - originNs) / 1000.0
+            << ",\"dur\":" << static_cast<double>(event.durationNs) / 1000.0 << "}";
+        first = false;
+    }
+    out << "\n]}\n";
+    return static_cast<bool>(out);
+}
+
+void Player::Profiler::clear()
+{
+    Registry&                   registry = getRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    for (const auto& ring : registry.rings)
+    {
+        // Only the owning thread writes head, so hide the older events behind a floor instead of rewinding it
+        ring->floor.store(ring->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Scoped-timer instrumentation. Every thread records into its own fixed-size ring buffer so recording never takes a
+// lock; readers take a snapshot of all rings. When disabled a scope costs a single relaxed atomic load. A thread gets
+// its ring on its first recorded scope, and a thread that exits leaves its ring (and events) to the next new thread.
+//
+//     MP3_PROFILE_SCOPE("decode");
+//
+// Scope names must be string literals (only the pointer is stored).
+#ifndef MP3_DISABLE_PROFILING
+#define MP3_PROFILE_CONCAT_INNER(a, b) a##b
+#define MP3_PROFILE_CONCAT(a, b)       MP3_PROFILE_CONCAT_INNER(a, b)
+#define MP3_PROFILE_SCOPE(name)        Player::ProfileScope MP3_PROFILE_CONCAT(profileScope_, __LINE__)(name)
+#else
+#define MP3_PROFILE_SCOPE(name)
+#endif
+
+namespace Player
+{
+
+	class Profiler
+	{
+	public:
+		struct Event_t
+		{
+			const char* name       = nullptr;
+			uint64_t    startNs    = 0;
+			uint64_t    durationNs = 0;
+			uint32_t    threadId   = 0;
+		};
+
+		struct Thread_t
+		{
+			uint32_t    threadId = 0;
+			std::string name;
+		};
+
+		// Events kept per thread before the oldest ones are overwritten
+		static constexpr size_t mRingCapacity = 8192;
+
+		static bool isEnabled() { return mEnabled.load(std::memory_order_relaxed); }
+		static void setEnabled(bool enabled) { mEnabled.store(enabled, std::memory_order_relaxed); }
+
+		// Monotonic time in nanoseconds (steady clock epoch, never zero in practice)
+		static uint64_t nowNs();
+
+		static void record(const char* name, uint64_t startNs, uint64_t endNs);
+
+		// Label the calling thread in snapshots and trace exports
+		static void setThreadName(const std::string& name);
+
+		// Copy the events currently held by all thread rings, oldest first per thread
+		static std::vector<Event_t> snapshot();
+		static std::vector<Thread_t> threads();
+
+		// Write all buffered events as Chrome trace JSON (chrome://tracing, Perfetto)
+		static bool exportChromeTrace(const std::string& path);
+
+		// Resident set size of the process in bytes (0 where the platform does not report it)
+		static size_t getResidentBytes();
+
+		// Drop all buffered events
+		static void clear();
+
+	private:
+		static std::atomic<bool> mEnabled;
+	};
+
+	class ProfileScope
+	{
+	public:
+		explicit ProfileScope(const char* name)
+			: mName(name)
+			, mStartNs(Profiler::isEnabled() ? Profiler::nowNs() : 0)
+		{
+		}
+
+		~ProfileScope()
+		{
+			if (mStartNs != 0)
+			{
+				Profiler::record(mName, mStartNs, Profiler::nowNs());
+			}
+		}
+
+		ProfileScope(const ProfileScope&)            = delete;
+		ProfileScope& operator=(const ProfileScope&) = delete;
+
+	private:
+		const char* mName;
+		uint64_t    mStartNs;
+	};
+
+}
@@ -0,0 +1,771 @@
+#include "TagReader.h"
+#include "MP3Decoder.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    // Enough for the first frame and its Xing/LAME header, and for typical APEv2 + ID3v1 tails
+    constexpr size_t FRAME_WINDOW_BYTES = 4096;
+    constexpr size_t HEAD_READ_BYTES    = 16384;
+    constexpr size_t TAIL_READ_BYTES    = 8192;
+
+    // Cover art can make tags very large; text frames past this point are not worth reading
+    constexpr size_t MAX_TAG_READ_BYTES = 1 << 20;
+
+    constexpr const char* GENRES[] = {
+        "Blues",        "Classic Rock",     "Country",           "Dance",         "Disco",       "Funk",
+        "Grunge",       "Hip-Hop",          "Jazz",              "Metal",         "New Age",     "Oldies",
+        "Other",        "Pop",              "R&B",               "Rap",           "Reggae",      "Rock",
+        "Techno",       "Industrial",       "Alternative",       "Ska",           "Death Metal", "Pranks",
+        "Soundtrack",   "Euro-Techno",      "Ambient",           "Trip-Hop",      "Vocal",       "Jazz+Funk",
+        "Fusion",       "Trance",           "Classical",         "Instrumental",  "Acid",        "House",
+        "Game",         "Sound Clip",       "Gospel",            "Noise",         "AlternRock",  "Bass",
+        "Soul",         "Punk",             "Space",             "Meditative",    "Instrumental Pop",
+        "Instrumental Rock", "Ethnic",      "Gothic",            "Darkwave",      "Techno-Industrial",
+        "Electronic",   "Pop-Folk",         "Eurodance",         "Dream",         "Southern Rock",
+        "Comedy",       "Cult",             "Gangsta",           "Top 40",        "Christian Rap",
+        "Pop/Funk",     "Jungle",           "Native American",   "Cabaret",       "New Wave",    "Psychadelic",
+        "Rave",         "Showtunes",        "Trailer",           "Lo-Fi",         "Tribal",      "Acid Punk",
+        "Acid Jazz",    "Polka",            "Retro",             "Musical",       "Rock & Roll", "Hard Rock"};
+
+    uint32_t readBe32(const uint8_t* data)
+    {
+        return (static_cast<uint32_t>(data[0]) << 24) | (static_cast<uint32_t>(data[1]) << 16) |
+               (static_cast<uint32_t>(data[2]) << 8) | static_cast<uint32_t>(data[3]);
+    }
+
+    uint32_t readLe32(const uint8_t* data)
+    {
+        return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+               (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+    }
+
+    uint32_t readSyncsafe32(const uint8_t* data)
+    {
+        return (static_cast<uint32_t>(data[0] & 0x7F) << 21) | (static_cast<uint32_t>(data[1] & 0x7F) << 14) |
+               (static_cast<uint32_t>(data[2] & 0x7F) << 7) | static_cast<uint32_t>(data[3] & 0x7F);
+    }
+
+    void appendUtf8(std::string& out, uint32_t codePoint)
+    {
+        if (codePoint < 0x80)
+        {
+            out.push_back(static_cast<char>(codePoint));
+        }
+        else if (codePoint < 0x800)
+        {
+            out.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+            out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        }
+        else if (codePoint < 0x10000)
+        {
+            out.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        }
+        else
+        {
+            out.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+            out.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        }
+    }
+
+    void trimTrailingSpaces(std::string& text)
+    {
+        while (!text.empty() && (text.back() == ' ' || text.back() == '\0'))
+        {
+            text.pop_back();
+        }
+    }
+
+    // Text stops at the first terminator: multi-value ID3v2.4 and APE fields keep only their first value
+    void decodeLatin1(const uint8_t* data, size_t size, std::string& out)
+    {
+        out.clear();
+        for (size_t index = 0; index < size && data[index] != 0; ++index)
+        {
+            appendUtf8(out, data[index]);
+        }
+        trimTrailingSpaces(out);
+    }
+
+    void decodeUtf8(const uint8_t* data, size_t size, std::string& out)
+    {
+        const size_t length = std::find(data, data + size, 0) - data;
+        out.assign(reinterpret_cast<const char*>(data), length);
+        trimTrailingSpaces(out);
+    }
+
+    void decodeUtf16(const uint8_t* data, size_t size, bool bigEndian, std::string& out)
+    {
+        out.clear();
+        auto unit = [data, bigEndian](size_t index) -> uint32_t
+        {
+            return bigEndian ? (static_cast<uint32_t>(data[index]) << 8) | data[index + 1]
+                             : (static_cast<uint32_t>(data[index + 1]) << 8) | data[index];
+        };
+        for (size_t index = 0; index + 2 <= size; index += 2)
+        {
+            uint32_t codePoint = unit(index);
+            if (codePoint == 0)
+            {
+                break;
+            }
+            if (codePoint >= 0xD800 && codePoint < 0xDC00 && index + 4 <= size)
+            {
+                const uint32_t low = unit(index + 2);
+                if (low >= 0xDC00 && low < 0xE000)
+                {
+                    codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                    index += 2;
+                }
+            }
+            appendUtf8(out, codePoint);
+        }
+        trimTrailingSpaces(out);
+    }
+
+    // ID3v2 text frame body: one encoding byte then the text
+    void decodeId3Text(const uint8_t* data, size_t size, std::string& out)
+    {
+        if (size < 1)
+        {
+            out.clear();
+            return;
+        }
+        const uint8_t  encoding = data[0];
+        const uint8_t* text     = data + 1;
+        size_t         length   = size - 1;
+        switch (encoding)
+        {
+            case 0:
+                decodeLatin1(text, length, out);
+                break;
+            case 1:
+            {
+                // UTF-16 with BOM, little-endian if it is missing
+                bool bigEndian = false;
+                if (length >= 2 && ((text[0] == 0xFE && text[1] == 0xFF) || (text[0] == 0xFF && text[1] == 0xFE)))
+                {
+                    bigEndian = text[0] == 0xFE;
+                    text += 2;
+                    length -= 2;
+                }
+                decodeUtf16(text, length, bigEndian, out);
+                break;
+            }
+            case 2:
+                decodeUtf16(text, length, true, out);
+                break;
+            default:
+                decodeUtf8(text, length, out);
+                break;
+        }
+    }
+
+    uint32_t parseLeadingNumber(const std::string& text)
+    {
+        uint32_t value = 0;
+        for (char c : text)
+        {
+            if (c < '0' || c > '9')
+            {
+                break;
+            }
+            value = value * 10 + static_cast<uint32_t>(c - '0');
+        }
+        return value;
+    }
+
+    // "(13)", "13" and "(13)Pop" all refer to ID3v1 genre 13
+    void resolveGenre(std::string& genre)
+    {
+        std::string number = genre;
+        std::string rest;
+        if (!genre.empty() && genre[0] == '(')
+        {
+            const size_t close = genre.find(')');
+            if (close == std::string::npos)
+            {
+                return;
+            }
+            number = genre.substr(1, close - 1);
+            rest   = genre.substr(close + 1);
+        }
+        if (number.empty() || !std::all_of(number.begin(), number.end(), [](char c) { return c >= '0' && c <= '9'; }))
+        {
+            return;
+        }
+        if (!rest.empty())
+        {
+            genre = rest;
+        }
+        else if (const char* name = Player::TagReader::getGenreName(parseLeadingNumber(number)))
+        {
+            genre = name;
+        }
+    }
+
+    // Undo ID3v2 unsynchronisation (every FF 00 pair stands for FF)
+    void removeUnsynchronisation(const uint8_t* data, size_t size, std::vector<uint8_t>& out)
+    {
+        out.clear();
+        out.reserve(size);
+        for (size_t index = 0; index < size; ++index)
+        {
+            out.push_back(data[index]);
+            if (data[index] == 0xFF && index + 1 < size && data[index + 1] == 0x00)
+            {
+                ++index;
+            }
+        }
+    }
+
+    void assignTextFrame(const char* id, const uint8_t* body, size_t size, Player::TrackTags_t& tags)
+    {
+        std::string* field = nullptr;
+        if (memcmp(id, "TIT2", 4) == 0)
+        {
+            field = &tags.title;
+        }
+        else if (memcmp(id, "TPE1", 4) == 0)
+        {
+            field = &tags.artist;
+        }
+        else if (memcmp(id, "TPE2", 4) == 0 && tags.artist.empty())
+        {
+            // Album artist stands in until (or unless) a track artist shows up
+            field = &tags.artist;
+        }
+        else if (memcmp(id, "TALB", 4) == 0)
+        {
+            field = &tags.album;
+        }
+        else if (memcmp(id, "TCON", 4) == 0)
+        {
+            field = &tags.genre;
+        }
+        else if (memcmp(id, "TYER", 4) == 0 || memcmp(id, "TDRC", 4) == 0)
+        {
+            field = &tags.year;
+        }
+        else if (memcmp(id, "TRCK", 4) == 0)
+        {
+            std::string track;
+            decodeId3Text(body, size, track);
+            tags.trackNumber = parseLeadingNumber(track);
+            return;
+        }
+        if (field == nullptr || (!field->empty() && memcmp(id, "TPE1", 4) != 0))
+        {
+            return;
+        }
+        decodeId3Text(body, size, *field);
+        if (field == &tags.year && field->size() > 4)
+        {
+            field->resize(4);
+        }
+        if (field == &tags.genre)
+        {
+            resolveGenre(*field);
+        }
+    }
+
+    // data covers the tag from its "ID3" header; available may be less than the declared size for huge tags
+    bool parseId3v2(const uint8_t* data, size_t available, Player::TrackTags_t& tags)
+    {
+        if (available < 10 || memcmp(data, "ID3", 3) != 0 || data[3] < 2 || data[3] > 4)
+        {
+            return false;
+        }
+        const uint8_t major    = data[3];
+        const uint8_t tagFlags = data[5];
+        const size_t  tagEnd   = std::min<size_t>(available, 10 + readSyncsafe32(data + 6));
+
+        // Version 2.2/2.3 unsynchronise the whole tag; 2.4 does it per frame
+        std::vector<uint8_t> unsynchronised;
+        const uint8_t*       frames    = data + 10;
+        size_t               frameSize = tagEnd - 10;
+        if ((tagFlags & 0x80) && major < 4)
+        {
+            removeUnsynchronisation(frames, frameSize, unsynchronised);
+            frames    = unsynchronised.data();
+            frameSize = unsynchronised.size();
+        }
+
+        size_t position = 0;
+        if ((tagFlags & 0x40) && major >= 3 && frameSize >= 4)
+        {
+            // Extended header: 2.3 counts the bytes after the size field, 2.4 includes it
+            const uint32_t extended = major == 3 ? readBe32(frames) + 4 : readSyncsafe32(frames);
+            position                = std::min<size_t>(frameSize, extended);
+        }
+
+        const size_t         headerBytes = major == 2 ? 6 : 10;
+        std::vector<uint8_t> frameScratch;
+        while (position + headerBytes <= frameSize)
+        {
+            const uint8_t* header = frames + position;
+            if (header[0] == 0)
+            {
+                // Padding
+                break;
+            }
+
+            char     id[4] = {};
+            uint32_t size  = 0;
+            uint16_t flags = 0;
+            if (major == 2)
+            {
+                // Three-letter frame ids map onto their 2.3 names
+                size = (static_cast<uint32_t>(header[3]) << 16) | (static_cast<uint32_t>(header[4]) << 8) | header[5];
+                static constexpr const char* v22Ids[][2] = {
+                    {"TT2", "TIT2"}, {"TP1", "TPE1"}, {"TP2", "TPE2"}, {"TAL", "TALB"},
+                    {"TCO", "TCON"}, {"TYE", "TYER"}, {"TRK", "TRCK"}};
+                for (const auto& mapping : v22Ids)
+                {
+                    if (memcmp(header, mapping[0], 3) == 0)
+                    {
+                        memcpy(id, mapping[1], 4);
+                    }
+                }
+            }
+            else
+            {
+                memcpy(id, header, 4);
+                // Some 2.4 writers store plain sizes; a byte with the high bit set cannot be syncsafe
+                const bool syncsafe = major == 4 && !((header[4] | header[5] | header[6] | header[7]) & 0x80);
+                size                = syncsafe ? readSyncsafe32(header + 4) : readBe32(header + 4);
+                flags               = static_cast<uint16_t>((header[8] << 8) | header[9]);
+            }
+            if (size == 0 || position + headerBytes + size > frameSize)
+            {
+                break;
+            }
+
+            const uint8_t* body     = header + headerBytes;
+            size_t         bodySize = size;
+            position += headerBytes + size;
+            if (id[0] != 'T')
+            {
+                continue;
+            }
+
+            if (major == 3)
+            {
+                if (flags & 0x00C0)
+                {
+                    // Compressed or encrypted
+                    continue;
+                }
+                if (flags & 0x0020)
+                {
+                    ++body;
+                    --bodySize;
+                }
+            }
+            else if (major == 4)
+            {
+                if (flags & 0x000C)
+                {
+                    continue;
+                }
+                const size_t skip = ((flags & 0x0040) ? 1 : 0) + ((flags & 0x0001) ? 4 : 0);
+                if (skip >= bodySize)
+                {
+                    continue;
+                }
+                body += skip;
+                bodySize -= skip;
+                if (flags & 0x0002)
+                {
+                    removeUnsynchronisation(body, bodySize, frameScratch);
+                    body     = frameScratch.data();
+                    bodySize = frameScratch.size();
+                }
+            }
+            assignTextFrame(id, body, bodySize, tags);
+        }
+        tags.sources |= Player::TAG_ID3V2;
+        return true;
+    }
+
+    // APEv2 footer at footer[0..32); items lie in the tagSize - 32 bytes before it
+    size_t parseApe(const uint8_t* begin, const uint8_t* footer, Player::TrackTags_t& tags)
+    {
+        const uint32_t tagSize   = readLe32(footer + 12);
+        const uint32_t itemCount = readLe32(footer + 16);
+        const uint32_t flags     = readLe32(footer + 20);
+        const size_t   headerBytes = (flags & 0x80000000U) ? 32 : 0;
+        if (tagSize < 32 || static_cast<size_t>(footer - begin) < tagSize - 32)
+        {
+            // Not (fully) inside the tail we were given
+            return tagSize + headerBytes;
+        }
+
+        const uint8_t* item = footer + 32 - tagSize;
+        for (uint32_t index = 0; index < itemCount && item + 8 < footer; ++index)
+        {
+            const uint32_t valueSize = readLe32(item);
+            const uint32_t itemFlags = readLe32(item + 4);
+            const uint8_t* key       = item + 8;
+            const uint8_t* keyEnd    = std::find(key, footer, 0);
+            if (keyEnd == footer || static_cast<size_t>(footer - (keyEnd + 1)) < valueSize)
+            {
+                break;
+            }
+            const uint8_t* value = keyEnd + 1;
+            item                 = value + valueSize;
+            if (((itemFlags >> 1) & 0x3) != 0)
+            {
+                // Binary or external item
+                continue;
+            }
+
+            const std::string_view name(reinterpret_cast<const char*>(key), keyEnd - key);
+            auto                   keyIs = [&name](const char* expected)
+            {
+                return name.size() == strlen(expected) &&
+                       std::equal(name.begin(), name.end(), expected, [](char a, char b) {
+                           return std::tolower(static_cast<unsigned char>(a)) == b;
+                       });
+            };
+            std::string* field = nullptr;
+            if (keyIs("title"))
+            {
+                field = &tags.title;
+            }
+            else if (keyIs("artist"))
+            {
+                field = &tags.artist;
+            }
+            else if (keyIs("album"))
+            {
+                field = &tags.album;
+            }
+            else if (keyIs("genre"))
+            {
+                field = &tags.genre;
+            }
+            else if (keyIs("year"))
+            {
+                field = &tags.year;
+            }
+            else if (keyIs("track") && tags.trackNumber == 0)
+            {
+                std::string track;
+                decodeUtf8(value, valueSize, track);
+                tags.trackNumber = parseLeadingNumber(track);
+            }
+            if (field != nullptr && field->empty())
+            {
+                decodeUtf8(value, valueSize, *field);
+            }
+        }
+        tags.sources |= Player::TAG_APE;
+        return tagSize + headerBytes;
+    }
+
+    void parseId3v1(const uint8_t* tag, Player::TrackTags_t& tags)
+    {
+        std::string text;
+        auto        fill = [&text, tag](std::string& field, size_t offset, size_t length)
+        {
+            if (field.empty())
+            {
+                decodeLatin1(tag + offset, length, text);
+                field = text;
+            }
+        };
+        fill(tags.title, 3, 30);
+        fill(tags.artist, 33, 30);
+        fill(tags.album, 63, 30);
+        fill(tags.year, 93, 4);
+        if (tags.trackNumber == 0 && tag[125] == 0 && tag[126] != 0)
+        {
+            // ID3v1.1 keeps the track number in the last comment byte
+            tags.trackNumber = tag[126];
+        }
+        if (tags.genre.empty())
+        {
+            if (const char* name = Player::TagReader::getGenreName(tag[127]))
+            {
+                tags.genre = name;
+            }
+        }
+        tags.sources |= Player::TAG_ID3V1;
+    }
+
+    // Tags at the end of the file, returns how many trailing bytes are not audio
+    size_t parseTail(const uint8_t* tail, size_t size, Player::TrackTags_t& tags)
+    {
+        size_t         trailing = 0;
+        const uint8_t* end      = tail + size;
+        const uint8_t* id3v1    = nullptr;
+        if (size >= 128 && memcmp(end - 128, "TAG", 3) == 0)
+        {
+            id3v1 = end - 128;
+            end -= 128;
+            trailing += 128;
+        }
+        if (static_cast<size_t>(end - tail) >= 32 && memcmp(end - 32, "APETAGEX", 8) == 0)
+        {
+            trailing += parseApe(tail, end - 32, tags);
+        }
+        // ID3v1 only fills what the richer tags left empty
+        if (id3v1 != nullptr)
+        {
+            parseId3v1(id3v1, tags);
+        }
+        return trailing;
+    }
+
+    // First audio frame: stream format plus the Xing/Info/VBRI and LAME headers
+    bool parseFirstFrame(const uint8_t* data, size_t size, Player::TrackTags_t& tags, size_t& frameOffset,
+                         uint64_t& vbrBytes)
+    {
+        // A second header right behind a candidate rules out sync-like bytes in junk data. Without one in the
+        // window (e.g. a single frame followed by a tag) the first candidate is taken.
+        Player::MP3FrameHeader_t header;
+        size_t                   firstCandidate = size;
+        for (frameOffset = 0; frameOffset + 4 <= size; ++frameOffset)
+        {
+            if (!Player::MP3Decoder::parseFrameHeader(data + frameOffset, size - frameOffset, header))
+            {
+                continue;
+            }
+            firstCandidate = std::min(firstCandidate, frameOffset);
+
+            Player::MP3FrameHeader_t next;
+            const size_t             nextOffset = frameOffset + header.frameBytes;
+            if (nextOffset + 4 > size || Player::MP3Decoder::parseFrameHeader(data + nextOffset, size - nextOffset, next))
+            {
+                break;
+            }
+        }
+        if (frameOffset + 4 > size)
+        {
+            if (firstCandidate == size)
+            {
+                return false;
+            }
+            frameOffset = firstCandidate;
+            Player::MP3Decoder::parseFrameHeader(data + frameOffset, size - frameOffset, header);
+        }
+
+        tags.sampleRate  = header.sampleRate;
+        tags.channels    = header.channels;
+        tags.bitrateKbps = header.bitrateKbps;
+
+        const uint8_t* frame      = data + frameOffset;
+        const size_t   available  = std::min<size_t>(size - frameOffset, header.frameBytes);
+        const size_t   xingOffset = 4 + (header.hasCrc ? 2 : 0) + header.sideInfoBytes;
+        vbrBytes                  = 0;
+        if (xingOffset + 8 <= available &&
+            (memcmp(frame + xingOffset, "Xing", 4) == 0 || memcmp(frame + xingOffset, "Info", 4) == 0))
+        {
+            const uint32_t flags    = readBe32(frame + xingOffset + 4);
+            size_t         position = xingOffset + 8;
+            tags.isVbr              = memcmp(frame + xingOffset, "Xing", 4) == 0;
+            if ((flags & 0x1) && position + 4 <= available)
+            {
+                tags.frameCount = readBe32(frame + position);
+                tags.sources |= Player::TAG_XING;
+            }
+            position += (flags & 0x1) ? 4 : 0;
+            if ((flags & 0x2) && position + 4 <= available)
+            {
+                vbrBytes = readBe32(frame + position);
+            }
+            position += ((flags & 0x2) ? 4 : 0) + ((flags & 0x4) ? 100 : 0) + ((flags & 0x8) ? 4 : 0);
+
+            // LAME extension (also written by libavformat as "Lavf"/"Lavc")
+            if (position + 24 <= available &&
+                (memcmp(frame + position, "LAME", 4) == 0 || memcmp(frame + position, "Lavf", 4) == 0 ||
+                 memcmp(frame + position, "Lavc", 4) == 0))
+            {
+                const uint8_t* lame  = frame + position;
+                tags.encoderDelay    = (static_cast<uint32_t>(lame[21]) << 4) | (lame[22] >> 4);
+                tags.encoderPadding  = (static_cast<uint32_t>(lame[22] & 0x0F) << 8) | lame[23];
+                tags.sources |= Player::TAG_LAME;
+            }
+        }
+        else if (36 + 18 <= available && memcmp(frame + 36, "VBRI", 4) == 0)
+        {
+            tags.isVbr      = true;
+            vbrBytes        = readBe32(frame + 36 + 10);
+            tags.frameCount = readBe32(frame + 36 + 14);
+            tags.sources |= Player::TAG_XING;
+        }
+
+        if (tags.frameCount > 0)
+        {
+            tags.durationSeconds = static_cast<double>(tags.frameCount) * header.samplesPerFrame / header.sampleRate;
+        }
+        return true;
+    }
+
+    // Shared by all entry points: the tag bytes (possibly truncated), a window starting at the first byte after
+    // the tag, and the end of the file
+    bool parseParts(const uint8_t*       tag,
+                    size_t               tagAvailable,
+                    size_t               tagDeclared,
+                    const uint8_t*       frame,
+                    size_t               frameAvailable,
+                    const uint8_t*       tail,
+                    size_t               tailSize,
+                    uint64_t             fileSize,
+                    Player::TrackTags_t& tags)
+    {
+        tags = Player::TrackTags_t{};
+        if (tagDeclared > 0)
+        {
+            parseId3v2(tag, tagAvailable, tags);
+        }
+        const size_t trailing = parseTail(tail, tailSize, tags);
+
+        size_t   frameOffset = 0;
+        uint64_t vbrBytes    = 0;
+        if (!parseFirstFrame(frame, frameAvailable, tags, frameOffset, vbrBytes))
+        {
+            return tags.sources != 0;
+        }
+
+        const uint64_t leading    = tagDeclared + frameOffset;
+        const uint64_t audioBytes = fileSize > leading + trailing ? fileSize - leading - trailing : 0;
+        if (tags.durationSeconds > 0.0)
+        {
+            const uint64_t bytes = vbrBytes > 0 ? vbrBytes : audioBytes;
+            tags.bitrateKbps     = static_cast<uint32_t>(bytes * 8 / 1000 / tags.durationSeconds + 0.5);
+        }
+        else if (tags.bitrateKbps > 0)
+        {
+            // Constant bitrate estimate
+            tags.durationSeconds = static_cast<double>(audioBytes) * 8.0 / (tags.bitrateKbps * 1000.0);
+        }
+        return true;
+    }
+}
+
+bool Player::TagReader::parse(const uint8_t* head,
+                              size_t         headSize,
+                              const uint8_t* tail,
+                              size_t         tailSize,
+                              uint64_t       fileSize,
+                              TrackTags_t&   tags)
+{
+    const size_t tagDeclared = MP3Decoder::getId3v2Size(head, headSize);
+    const size_t frameStart  = std::min(headSize, tagDeclared);
+    return parseParts(head,
+                      std::min(headSize, tagDeclared),
+                      tagDeclared,
+                      head + frameStart,
+                      headSize - frameStart,
+                      tail,
+                      tailSize,
+                      fileSize,
+                      tags);
+}
+
+bool Player::TagReader::parseBuffer(const uint8_t* data, size_t size, TrackTags_t& tags)
+{
+    MP3_PROFILE_SCOPE("tags.parse");
+    const size_t tagDeclared = MP3Decoder::getId3v2Size(data, size);
+    const size_t frameStart  = std::min(size, tagDeclared);
+    return parseParts(data,
+                      frameStart,
+                      tagDeclared,
+                      data + frameStart,
+                      std::min(size - frameStart, FRAME_WINDOW_BYTES),
+                      data + frameStart,
+                      size - frameStart,
+                      size,
+                      tags);
+}
+
+bool Player::TagReader::readFile(const std::filesystem::path& path, TrackTags_t& tags)
+{
+    MP3_PROFILE_SCOPE("tags.read");
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in)
+    {
+        return false;
+    }
+    const uint64_t fileSize = static_cast<uint64_t>(in.tellg());
+
+    // Reused per thread: the library scanner calls this for every file
+    thread_local std::vector<uint8_t> head;
+    thread_local std::vector<uint8_t> frame;
+    thread_local std::vector<uint8_t> tail;
+    auto readAt = [&in](std::vector<uint8_t>& buffer, uint64_t offset, size_t count)
+    {
+        buffer.resize(count);
+        in.clear();
+        in.seekg(static_cast<std::streamoff>(offset));
+        in.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(count));
+        buffer.resize(static_cast<size_t>(in.gcount()));
+    };
+
+    readAt(head, 0, static_cast<size_t>(std::min<uint64_t>(fileSize, HEAD_READ_BYTES)));
+    const size_t tagDeclared  = MP3Decoder::getId3v2Size(head.data(), head.size());
+    const size_t tagAvailable = std::min<size_t>(tagDeclared, MAX_TAG_READ_BYTES);
+    if (tagAvailable > head.size())
+    {
+        readAt(head, 0, static_cast<size_t>(std::min<uint64_t>(fileSize, tagAvailable)));
+    }
+
+    // The first frame window usually lies inside what was already read
+    const uint8_t* frameData = nullptr;
+    size_t         frameSize = 0;
+    if (tagDeclared + FRAME_WINDOW_BYTES <= head.size())
+    {
+        frameData = head.data() + tagDeclared;
+        frameSize = FRAME_WINDOW_BYTES;
+    }
+    else if (tagDeclared < fileSize)
+    {
+        readAt(frame, tagDeclared, static_cast<size_t>(std::min<uint64_t>(fileSize - tagDeclared, FRAME_WINDOW_BYTES)));
+        frameData = frame.data();
+        frameSize = frame.size();
+    }
+
+    // Tail: ID3v1 plus APEv2, re-read once if the APE footer announces a larger tag
+    const uint64_t audioStart = std::min<uint64_t>(fileSize, tagDeclared);
+    size_t         tailBytes  = static_cast<size_t>(std::min<uint64_t>(fileSize - audioStart, TAIL_READ_BYTES));
+    readAt(tail, fileSize - tailBytes, tailBytes);
+    const size_t declaredTrailing = [&]
+    {
+        TrackTags_t probe;
+        return parseTail(tail.data(), tail.size(), probe);
+    }();
+    if (declaredTrailing > tail.size() && declaredTrailing <= MAX_TAG_READ_BYTES)
+    {
+        tailBytes = static_cast<size_t>(std::min<uint64_t>(fileSize - audioStart, declaredTrailing));
+        readAt(tail, fileSize - tailBytes, tailBytes);
+    }
+
+    return parseParts(head.data(),
+                      std::min(head.size(), tagAvailable),
+                      tagDeclared,
+                      frameData,
+                      frameSize,
+                      tail.data(),
+                      tail.size(),
+                      fileSize,
+                      tags);
+}
+
+const char* Player::TagReader::getGenreName(uint32_t index)
+{
+    return index < std::size(GENRES) ? GENRES[index] : nullptr;
+}
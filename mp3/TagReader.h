@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+namespace Player
+{
+
+	enum TagSource_e
+	{
+		TAG_ID3V2 = 1 << 0,
+		TAG_ID3V1 = 1 << 1,
+		TAG_APE   = 1 << 2,
+		TAG_XING  = 1 << 3,  // Xing/Info or VBRI header with a frame count
+		TAG_LAME  = 1 << 4   // LAME extension with encoder delay and padding
+	};
+
+	// Everything the tag parser recovers from a file. Text is UTF-8.
+	struct TrackTags_t
+	{
+		std::string title;
+		std::string artist;
+		std::string album;
+		std::string genre;
+		std::string year;
+		uint32_t    trackNumber = 0;
+
+		uint32_t sampleRate      = 0;
+		uint16_t channels        = 0;
+		uint32_t bitrateKbps     = 0;  // average for VBR files
+		uint32_t frameCount      = 0;  // from Xing/VBRI, 0 if unknown
+		double   durationSeconds = 0.0;
+		uint32_t encoderDelay    = 0;  // samples, from the LAME tag
+		uint32_t encoderPadding  = 0;
+		bool     isVbr           = false;
+
+		uint32_t sources = 0;  // TagSource_e bits that were found
+	};
+
+	/// @brief Native ID3v2.2/2.3/2.4, ID3v1.1, APEv2 and Xing/Info/VBRI/LAME reader.
+	///        Only the head and the tail of a file are read. Text is decoded from Latin-1 or UTF-16 straight out of
+	///        the tag bytes into the UTF-8 result, without intermediate wide strings. Where several tags carry the
+	///        same field, ID3v2 wins over APEv2, which wins over ID3v1.
+	class TagReader
+	{
+	public:
+		/// @brief read the head and tail of a file and parse every tag found there
+		static bool readFile(const std::filesystem::path& path, TrackTags_t& tags);
+
+		/// @brief parse a whole file already in memory
+		static bool parseBuffer(const uint8_t* data, size_t size, TrackTags_t& tags);
+
+		/// @brief parse the leading bytes of a file (ID3v2 and the first audio frame) and its trailing bytes
+		///        (APEv2 and ID3v1). fileSize is the size of the whole file, for the constant bitrate estimate.
+		static bool parse(const uint8_t* head,
+		                  size_t         headSize,
+		                  const uint8_t* tail,
+		                  size_t         tailSize,
+		                  uint64_t       fileSize,
+		                  TrackTags_t&   tags);
+
+		/// @brief name of an ID3v1 genre index, or nullptr when out of range
+		static const char* getGenreName(uint32_t index);
+	};
+
+}
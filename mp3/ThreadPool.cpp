@@ -0,0 +1,84 @@
+#include "ThreadPool.h"
+#include "Profiler.h"
+
+#include <string>
+
+Player::ThreadPool::ThreadPool(size_t threadCount)
+{
+    if (threadCount == 0)
+    {
+        threadCount = getDefaultThreadCount();
+    }
+    mWorkers.reserve(threadCount);
+    for (size_t index = 0; index < threadCount; ++index)
+    {
+        mWorkers.emplace_back(
+            [this, index]
+            {
+                Profiler::setThreadName("pool " + std::to_string(index));
+                workerLoop();
+            });
+    }
+}
+
+Player::ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(mLock);
+        mStopping = true;
+    }
+    mTaskReady.notify_all();
+    for (auto& worker : mWorkers)
+    {
+        worker.join();
+    }
+}
+
+void Player::ThreadPool::submit(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> guard(mLock);
+        mTasks.push_back(std::move(task));
+    }
+    mTaskReady.notify_one();
+}
+
+void Player::ThreadPool::waitIdle()
+{
+    std::unique_lock<std::mutex> guard(mLock);
+    mIdle.wait(guard, [this] { return mTasks.empty() && mActive == 0; });
+}
+
+size_t Player::ThreadPool::getDefaultThreadCount()
+{
+    const size_t hardware = std::thread::hardware_concurrency();
+    return hardware > 0 ? hardware : 4;
+}
+
+void Player::ThreadPool::workerLoop()
+{
+    std::unique_lock<std::mutex> guard(mLock);
+    while (true)
+    {
+        mTaskReady.wait(guard, [this] { return mStopping || !mTasks.empty(); });
+        if (mTasks.empty())
+        {
+            // Stopping and drained
+            return;
+        }
+
+        std::function<void()> task = std::move(mTasks.front());
+        mTasks.pop_front();
+        ++mActive;
+        guard.unlock();
+
+        task();
+
+        guard.lock();
+        --mActive;
+        if (mTasks.empty() && mActive == 0)
+        {
+            mIdle.notify_all();
+        }
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Player
+{
+
+	/// @brief Fixed set of worker threads draining a shared FIFO of tasks
+	class ThreadPool
+	{
+	public:
+		/// @param threadCount 0 picks std::thread::hardware_concurrency()
+		explicit ThreadPool(size_t threadCount = 0);
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&)            = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		void submit(std::function<void()> task);
+
+		/// @brief block until every submitted task has finished
+		void waitIdle();
+
+		size_t getThreadCount() const { return mWorkers.size(); }
+
+		static size_t getDefaultThreadCount();
+
+	private:
+		void workerLoop();
+
+		std::vector<std::thread>          mWorkers;
+		std::deque<std::function<void()>> mTasks;
+		std::mutex                        mLock;
+		std::condition_variable           mTaskReady;
+		std::condition_variable           mIdle;
+		size_t                            mActive = 0;
+		bool                              mStopping = false;
+	};
+
+}
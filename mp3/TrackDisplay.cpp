@@ -0,0 +1,26 @@
+#include "TrackDisplay.h"
+
+#include <cstdio>
+
+Player::TrackDisplay_t Player::TrackDisplay_t::make(const std::string& path, const TrackTags_t& tags, double durationSeconds)
+{
+    TrackDisplay_t display;
+    display.file   = "File: " + path;
+    display.title  = "Title: " + tags.title;
+    display.artist = "Artist: " + tags.artist;
+    display.album  = "Album: " + tags.album;
+
+    char text[48];
+    if (tags.bitrateKbps > 0)
+    {
+        snprintf(text, sizeof(text), "Bitrate: %u kbps%s", tags.bitrateKbps, tags.isVbr ? " (VBR)" : "");
+        display.bitrate = text;
+    }
+    if (durationSeconds > 0.0)
+    {
+        const unsigned seconds = static_cast<unsigned>(durationSeconds + 0.5);
+        snprintf(text, sizeof(text), "Duration: %u:%02u", seconds / 60, seconds % 60);
+        display.duration = text;
+    }
+    return display;
+}
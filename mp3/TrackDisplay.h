@@ -0,0 +1,24 @@
+#pragma once
+
+#include "TagReader.h"
+
+#include <string>
+
+namespace Player
+{
+
+	/// @brief The Now Playing card's text for one track. Built once when the track is loaded, so drawing it is a
+	///        TextUnformatted per line: no tag conversion, formatting or allocation in the frame.
+	struct TrackDisplay_t
+	{
+		std::string file;      // "File: <path>"
+		std::string title;     // "Title: ..."
+		std::string artist;    // "Artist: ..."
+		std::string album;     // "Album: ..."
+		std::string bitrate;   // "Bitrate: 192 kbps (VBR)", empty when unknown
+		std::string duration;  // "Duration: 3:05", empty when unknown
+
+		static TrackDisplay_t make(const std::string& path, const TrackTags_t& tags, double durationSeconds);
+	};
+
+}
@@ -0,0 +1,142 @@
+#include "TrackLoader.h"
+#include "BufferPool.h"
+#include "MappedFile.h"
+#include "ParallelDecoder.h"
+#include "PcmAnalysis.h"
+#include "Profiler.h"
+
+Player::TrackLoadJob::TrackLoadJob(std::vector<std::filesystem::path> candidates, size_t waveformPoints)
+    : mCandidates(std::move(candidates))
+    , mWaveformPoints(waveformPoints)
+{
+}
+
+Player::TrackLoadJob::~TrackLoadJob()
+{
+    // A finished load nobody took (superseded after completing) still hands its PCM back
+    PcmBufferPool::getShared().release(std::move(mResult.audio.samples));
+}
+
+float Player::TrackLoadJob::getProgress() const
+{
+    const uint64_t total = mBytesTotal.load(std::memory_order_relaxed);
+    return total > 0 ? static_cast<float>(mBytesDone.load(std::memory_order_relaxed)) / static_cast<float>(total)
+                     : 0.0F;
+}
+
+Player::TrackLoadState_e Player::TrackLoadJob::finish(TrackLoadState_e state, std::string error)
+{
+    mError = std::move(error);
+    if (state != LOAD_DONE)
+    {
+        PcmBufferPool::getShared().release(std::move(mResult.audio.samples));
+        mResult = LoadedTrack_t{};
+    }
+    // Release: the result and error are complete before the UI thread can observe the final state
+    mState.store(state, std::memory_order_release);
+    return state;
+}
+
+void Player::TrackLoadJob::run()
+{
+    if (isCancelled())
+    {
+        finish(LOAD_CANCELLED);
+        return;
+    }
+    mState.store(LOAD_RUNNING, std::memory_order_relaxed);
+    MP3_PROFILE_SCOPE("load.track");
+
+    // Path probing can stall on network drives, so it happens here rather than on the UI thread
+    for (const std::filesystem::path& candidate : mCandidates)
+    {
+        std::error_code error;
+        if (std::filesystem::is_regular_file(candidate, error))
+        {
+            mResult.path = candidate;
+            break;
+        }
+    }
+    if (mResult.path.empty())
+    {
+        finish(LOAD_FAILED, mCandidates.empty() ? "File not found" : "File not found: " + mCandidates.front().string());
+        return;
+    }
+
+    MappedFile file;
+    if (!file.open(mResult.path))
+    {
+        finish(LOAD_FAILED, "Failed to open file: " + mResult.path.string());
+        return;
+    }
+    mBytesTotal.store(file.size(), std::memory_order_relaxed);
+    TagReader::parseBuffer(file.data(), file.size(), mResult.tags);
+
+    MP3Stream_t stream;
+    if (!MP3Decoder::scanFrames(file.data(), file.size(), stream))
+    {
+        finish(LOAD_FAILED, "Failed to load file: " + mResult.path.string());
+        return;
+    }
+
+    // Chunks spread over the shared decoder's threads; the cancel flag is checked and progress reported per chunk
+    bool decoded = false;
+    {
+        MP3_PROFILE_SCOPE("load.decode");
+        mBytesDone.store(stream.frames.empty() ? 0 : stream.frames.front().offset, std::memory_order_relaxed);
+        ParallelDecoder::DecodeControl_t control;
+        control.cancel    = &mCancel;
+        control.bytesDone = &mBytesDone;
+        decoded           = ParallelDecoder::getShared().decode(stream, mResult.audio, control);
+    }
+    if (isCancelled())
+    {
+        finish(LOAD_CANCELLED);
+        return;
+    }
+    if (!decoded || mResult.audio.samples.empty())
+    {
+        finish(LOAD_FAILED, "Failed to load file: " + mResult.path.string());
+        return;
+    }
+
+    mResult.waveform = PcmAnalysis::getWaveformPreview(mResult.audio.samples.data(),
+                                                       mResult.audio.getFrameCount(),
+                                                       mResult.audio.channels,
+                                                       mWaveformPoints);
+    mBytesDone.store(file.size(), std::memory_order_relaxed);
+    finish(isCancelled() ? LOAD_CANCELLED : LOAD_DONE);
+}
+
+Player::TrackLoader::TrackLoader() = default;
+
+Player::TrackLoader::~TrackLoader()
+{
+    // The pool joins its worker after this; a cancelled job returns within a few frames
+    cancel();
+}
+
+Player::TrackLoadHandle Player::TrackLoader::load(std::vector<std::filesystem::path> candidates, size_t waveformPoints)
+{
+    auto job = std::make_shared<TrackLoadJob>(std::move(candidates), waveformPoints);
+    {
+        std::lock_guard<std::mutex> guard(mLock);
+        if (mLatest)
+        {
+            mLatest->cancel();
+        }
+        mLatest = job;
+    }
+    mPool.submit([job] { job->run(); });
+    return job;
+}
+
+void Player::TrackLoader::cancel()
+{
+    std::lock_guard<std::mutex> guard(mLock);
+    if (mLatest)
+    {
+        mLatest->cancel();
+        mLatest.reset();
+    }
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "MP3Decoder.h"
+#include "TagReader.h"
+#include "ThreadPool.h"
+
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Player
+{
+
+	enum TrackLoadState_e
+	{
+		LOAD_PENDING = 0,
+		LOAD_RUNNING,
+		LOAD_DONE,
+		LOAD_FAILED,
+		LOAD_CANCELLED
+	};
+
+	// Everything the player needs to start a track, prepared off the UI thread
+	struct LoadedTrack_t
+	{
+		std::filesystem::path path;
+		DecodedAudio_t        audio;
+		TrackTags_t           tags;
+		std::vector<float>    waveform;
+	};
+
+	/// @brief One background load. The UI keeps the handle, polls getState()/getProgress() each frame and takes
+	///        the result once the state is LOAD_DONE. Cancelling is a flag the decode checks between chunks.
+	class TrackLoadJob
+	{
+	public:
+		TrackLoadJob(std::vector<std::filesystem::path> candidates, size_t waveformPoints);
+		~TrackLoadJob();
+
+		TrackLoadState_e getState() const { return mState.load(std::memory_order_acquire); }
+		bool             isFinished() const { return getState() >= LOAD_DONE; }
+
+		/// @brief fraction of the compressed stream decoded so far, 0..1
+		float getProgress() const;
+
+		void cancel() { mCancel.store(true, std::memory_order_relaxed); }
+		bool isCancelled() const { return mCancel.load(std::memory_order_relaxed); }
+
+		/// @brief reason for LOAD_FAILED, only valid once finished
+		const std::string& getError() const { return mError; }
+
+		/// @brief the loaded track, only valid in LOAD_DONE
+		LoadedTrack_t& getResult() { return mResult; }
+
+		/// @brief run the load on the calling thread: resolve the first existing candidate, map it, parse the tags,
+		///        decode every frame and extract the waveform preview
+		void run();
+
+	private:
+		TrackLoadState_e finish(TrackLoadState_e state, std::string error = {});
+
+		std::vector<std::filesystem::path> mCandidates;
+		size_t                             mWaveformPoints = 0;
+		std::atomic<TrackLoadState_e>      mState{LOAD_PENDING};
+		std::atomic<bool>                  mCancel{false};
+		std::atomic<uint64_t>              mBytesDone{0};
+		std::atomic<uint64_t>              mBytesTotal{0};
+		LoadedTrack_t                      mResult;
+		std::string                        mError;
+	};
+
+	using TrackLoadHandle = std::shared_ptr<TrackLoadJob>;
+
+	/// @brief Single worker that loads tracks in the background. Starting a load cancels the previous one, so
+	///        rapid track changes never queue up: superseded jobs stop at their next frame (or before starting).
+	class TrackLoader
+	{
+	public:
+		TrackLoader();
+		~TrackLoader();
+
+		TrackLoader(const TrackLoader&)            = delete;
+		TrackLoader& operator=(const TrackLoader&) = delete;
+
+		/// @brief load the first candidate path that exists, superseding any load still in flight
+		TrackLoadHandle load(std::vector<std::filesystem::path> candidates, size_t waveformPoints = 512);
+
+		/// @brief cancel the load in flight, if any
+		void cancel();
+
+		/// @brief block until the worker is idle (tests and benchmarks)
+		void waitIdle() { mPool.waitIdle(); }
+
+	private:
+		ThreadPool      mPool{1};
+		std::mutex      mLock;
+		TrackLoadHandle mLatest;
+	};
+
+}
@@ -6,12 +6,21 @@
 
 static ImGuiID _dockSpaceId;
 
-ImGuiVis::ImGuiVis(const std::string mp3Sourc)
-    : mMP3PlayerVisualization(Player::MP3Visualization::getInstance())
+// Baked font atlas written next to the executable by the first start
+static const char* FONT_ATLAS_CACHE_FILE = "fontatlas.cache";
+
+// One line per launch: phase durations up to the initial track being ready
+static const char* STARTUP_LOG_FILE = "startup.log";
+
+ImGuiVis::ImGuiVis(const std::string mp3Sourc, bool fastStart)
+    : mAudioPlayer()
+    , mMP3PlayerVisualization(mAudioPlayer)
     , mBaseFontSize(24.0f)
     , mPauseRequested(false)
     , mMP3SourceFile(mp3Sourc)
+    , mFastStart(fastStart)
 {
+    mStartupTimeline.begin();
     try
     {
         std::filesystem::current_path(getExecutableDir());
@@ -35,57 +44,82 @@ void ImGuiVis::run()
         std::cout << "Error in initializing glfw" << std::endl;
     }
 
+    Player::Profiler::setThreadName("main");
+    mStartupTimeline.mark("glfw");
+
     // Initialize the imGui
     auto window = initFcn();
+    mStartupTimeline.mark("window");
 
-    mMP3PlayerVisualization.worldInitFcn();
+    if (!mFastStart)
+    {
+        mMP3PlayerVisualization.worldInitFcn();
+        mStartupTimeline.mark("world_init");
+        mMP3PlayerVisualization.finishInitialLoad();
+        mStartupTimeline.mark("track");
+    }
 
     // Setting up the texts font.
-    getFontIcon();
+    mFontCacheHit = buildFonts(getExecutableDir() / FONT_ATLAS_CACHE_FILE);
+    mStartupTimeline.mark("fonts");
 
+    size_t frameIndex = 0;
     while (!glfwWindowShouldClose(window))
     {
+        mFrameTimer.beginFrame();
+        mMP3PlayerVisualization.mFrameAllocations.beginFrame();
         glfwPollEvents();
+        mFrameTimer.mark(FrameTimer::EVENTS);
+
         newFrameImGui();
-        ImGui::CreateContext();
-        ImPlot::CreateContext();
 
         // Docking
         constexpr ImGuiDockNodeFlags dockSpaceFlags = ImGuiDockNodeFlags_PassthruCentralNode;
         _dockSpaceId = ImGui::DockSpaceOverViewport(ImGui::GetMainViewport(), dockSpaceFlags);
 
-        mMP3PlayerVisualization.worldFramePreDisplayFcn(true);
-
-        // For convenience, get a reference to the I/O information
-        const ImGuiIO& io = ImGui::GetIO();
+        {
+            MP3_PROFILE_SCOPE("ui.build");
+            mMP3PlayerVisualization.worldFramePreDisplayFcn(true);
+            drawFrameTimings();
+            mMP3PlayerVisualization.localFrameDisplayFcn();
+        }
+        mFrameTimer.mark(FrameTimer::UI_BUILD);
 
-        // Prepare the world frame
+        // Prepare the world frame, (re)allocating the render target only when the size changes
+        resizeWorldFrame(mWorldWindowWidth, mWorldWindowHeight);
         glViewport(0, 0, mWorldWindowWidth, mWorldWindowHeight);
-        glfwSetWindowSize(mWorldWindow, mWorldWindowWidth, mWorldWindowHeight);
         UTILITY::Color3f_t backgroundColor = UTILITYColors::VLightGray;
         glClearColor(backgroundColor.r, backgroundColor.g, backgroundColor.b, 1);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
+        // Transfer the pixels of the hidden context to the world texture object (only when someone samples it)
+        if (mCaptureWorldTexture)
+        {
+            glBindTexture(GL_TEXTURE_2D, mWorldTexture);
+            glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 0, 0, mWorldTextureWidth, mWorldTextureHeight);
+            glBindTexture(GL_TEXTURE_2D, 0);
+        }
 
-        mMP3PlayerVisualization.localFrameDisplayFcn();
-
-
-        // Transfer the pixels of the hidden context to the world texture object
-        glBindTexture(GL_TEXTURE_2D, mWorldTexture);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, mWorldWindowWidth, mWorldWindowHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
-        glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 0, 0, mWorldWindowWidth, mWorldWindowHeight);
-        glBindTexture(GL_TEXTURE_2D, 0);
-
-        renderImGui();
+        {
+            MP3_PROFILE_SCOPE("RenderImGui");
+            renderImGui();
+        }
+        mFrameTimer.mark(FrameTimer::RENDER);
 
         if (mPauseRequested)
         {
             std::this_thread::sleep_for(std::chrono::seconds(1));
         }
 
-        glfwSwapBuffers(window);
+        {
+            MP3_PROFILE_SCOPE("frame.swap");
+            glfwSwapBuffers(window);
+        }
+        mFrameTimer.mark(FrameTimer::SWAP);
+        mFrameTimer.endFrame();
+        mMP3PlayerVisualization.mFrameAllocations.endFrame();
+
+        updateStartupTimeline(frameIndex++);
 
         if (mMP3PlayerVisualization.quitRequested())
         {
@@ -93,6 +127,7 @@ void ImGuiVis::run()
         }
     }
 
+    mMP3PlayerVisualization.worldExitFcn();
     cleanUp();
     Distroy(window);
 }
@@ -121,11 +156,23 @@ GLFWwindow* ImGuiVis::initFcn()
     // Hide the raw window by default to avoid the initial flicker
     hideWindow(mWorldWindow);
 
-    // Create the ImGui context
+    // Count ImGui's and ImPlot's buffers with the rest of the heap when the allocation hooks are linked
+    if (Player::AllocationTracker::isInstalled())
+    {
+        ImGui::SetAllocatorFunctions(Player::AllocationTracker::allocateForImGui,
+                                     Player::AllocationTracker::freeForImGui);
+    }
+
+    // Create the ImGui and ImPlot contexts once for the lifetime of the window
     createImGuiContext(mWorldWindow, false);
+    ImPlot::CreateContext();
 
-    //// Create texture to store world display
+    // Create texture to store world display; its storage is allocated by resizeWorldFrame()
     glGenTextures(1, &mWorldTexture);
+    glBindTexture(GL_TEXTURE_2D, mWorldTexture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glBindTexture(GL_TEXTURE_2D, 0);
 
     // Get the OpenGL version running on this machine
     std::array<char, 200> openGLVersion;
@@ -136,11 +183,117 @@ GLFWwindow* ImGuiVis::initFcn()
     return mWorldWindow;
 }
 
-void ImGuiVis::getFontIcon()
+void ImGuiVis::resizeWorldFrame(int32_t width, int32_t height)
+{
+    if (width == mWorldTextureWidth && height == mWorldTextureHeight)
+    {
+        return;
+    }
+
+    glfwSetWindowSize(mWorldWindow, width, height);
+
+    glBindTexture(GL_TEXTURE_2D, mWorldTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    mWorldTextureWidth  = width;
+    mWorldTextureHeight = height;
+}
+
+void ImGuiVis::drawFrameTimings()
+{
+    ImGui::SetNextWindowCollapsed(true, ImGuiCond_FirstUseEver);
+    if (ImGui::Begin("Frame Timings"))
+    {
+        const FrameTimer::FrameStats_t& last    = mFrameTimer.getLast();
+        const FrameTimer::FrameStats_t  average = mFrameTimer.getAverage();
+        const FrameTimer::FrameStats_t  peak    = mFrameTimer.getPeak();
+        if (ImGui::BeginTable("frameTimings", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV))
+        {
+            ImGui::TableSetupColumn("Stage");
+            ImGui::TableSetupColumn("Last (ms)");
+            ImGui::TableSetupColumn("Avg (ms)");
+            ImGui::TableSetupColumn("Peak (ms)");
+            ImGui::TableHeadersRow();
+            for (int stage = 0; stage < FrameTimer::STAGE_COUNT; ++stage)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+                ImGui::TextUnformatted(FrameTimer::getStageName(static_cast<FrameTimer::Stage_e>(stage)));
+                ImGui::TableSetColumnIndex(1);
+                ImGui::Text("%.3f", last.stageMs[stage]);
+                ImGui::TableSetColumnIndex(2);
+                ImGui::Text("%.3f", average.stageMs[stage]);
+                ImGui::TableSetColumnIndex(3);
+                ImGui::Text("%.3f", peak.stageMs[stage]);
+            }
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted("Total");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::Text("%.3f", last.totalMs);
+            ImGui::TableSetColumnIndex(2);
+            ImGui::Text("%.3f", average.totalMs);
+            ImGui::TableSetColumnIndex(3);
+            ImGui::Text("%.3f", peak.totalMs);
+            ImGui::EndTable();
+        }
+        if (ImGui::TreeNode("Startup"))
+        {
+            ImGui::Text("%s start, fonts %s", mFastStart ? "Fast" : "Eager", mFontCacheHit ? "cached" : "built");
+            for (const StartupTimeline::Phase_t& phase : mStartupTimeline.getPhases())
+            {
+                ImGui::Text("%-12s %8.1f ms  (at %.1f ms)", phase.name, phase.ms, phase.atMs);
+            }
+            ImGui::TreePop();
+        }
+    }
+    ImGui::End();
+}
+
+void ImGuiVis::updateStartupTimeline(size_t frameIndex)
+{
+    if (mStartupTimeline.isFinished())
+    {
+        return;
+    }
+    if (frameIndex == 0)
+    {
+        // The first frame also uploads the font texture and compiles the shaders; the window is now on screen
+        mStartupTimeline.mark("first_frame");
+        if (mFastStart)
+        {
+            mMP3PlayerVisualization.worldInitFcn();
+            mStartupTimeline.mark("world_init");
+        }
+        return;
+    }
+    if (mMP3PlayerVisualization.isInitialLoadPending())
+    {
+        return;
+    }
+    if (mFastStart)
+    {
+        mStartupTimeline.mark("track");
+    }
+    const std::string tags =
+        std::string("mode=") + (mFastStart ? "fast" : "eager") + " fonts=" + (mFontCacheHit ? "cached" : "built");
+    mStartupTimeline.finish(getExecutableDir() / STARTUP_LOG_FILE, tags);
+
+    // From here on the frame should not allocate; start the peak over without the startup frames
+    mMP3PlayerVisualization.mFrameAllocations.reset();
+}
+
+void ImGuiVis::addFonts(std::vector<FontSource_t>& fonts)
+{
+    VisualizationBase::addFonts(fonts);
+    getFontIcon(fonts);
+}
+
+void ImGuiVis::getFontIcon(std::vector<FontSource_t>& fonts)
 {
     mFontIcon.lock();
-    ImGuiIO& io = ImGui::GetIO();
-    io.Fonts->AddFontDefault();
+    fonts.push_back(FontAtlasCache::fromDefault(ImFontConfig()));
     float baseFontSize = mBaseFontSize; // 13.0f is the size of the default font. Change to the font size you use.
     float iconFontSize =
         baseFontSize * 2.0f /
@@ -152,7 +305,9 @@ void ImGuiVis::getFontIcon()
     icons_config.MergeMode        = true;
     icons_config.PixelSnapH       = true;
     icons_config.GlyphMinAdvanceX = iconFontSize;
-    io.Fonts->AddFontFromFileTTF(FONT_ICON_FILE_NAME_FAS, iconFontSize, &icons_config, icons_ranges);
+    icons_config.SizePixels       = iconFontSize;
+    icons_config.GlyphRanges      = icons_ranges;
+    fonts.push_back(FontAtlasCache::fromFile(FONT_ICON_FILE_NAME_FAS, icons_config));
     // use FONT_ICON_FILE_NAME_FAR if you want regular instead of solid
     mFontIcon.unlock();
 }
@@ -167,8 +322,9 @@ void ImGuiVis::cleanUp()
     // Cleanup
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplGlfw_Shutdown();
-    ImGui::DestroyContext();
     ImPlot::DestroyContext();
+    ImGui::DestroyContext();
+    glDeleteTextures(1, &mWorldTexture);
 }
 
 void ImGuiVis::Distroy(GLFWwindow* window)
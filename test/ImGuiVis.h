@@ -3,14 +3,20 @@
 #include <iostream>
 #include <filesystem>
 
+#include "FrameTimer.h"
 #include "IconsFontAwesome5.h"
 #include "MP3Player.h"
 #include "MP3Visualization.h"
+#include "Profiler.h"
+#include "StartupTimeline.h"
+#include "VisualizationBase.h"
 
 class ImGuiVis : public VisualizationBase
 {
   public:
-    ImGuiVis(const std::string mp3Source);
+    // fastStart shows the window first and runs worldInitFcn() (library, control server, initial track load)
+    // after the first frame; otherwise all of it, including the initial decode, happens before the window appears
+    ImGuiVis(const std::string mp3Source, bool fastStart = true);
     ~ImGuiVis();
 
   private:
@@ -19,6 +25,9 @@ class ImGuiVis : public VisualizationBase
 
     // ImGui initialization
     GLFWwindow* initFcn();
+    void        resizeWorldFrame(int32_t width, int32_t height);
+    void        drawFrameTimings();
+    void        addFonts(std::vector<FontSource_t>& fonts) override;
     std::filesystem::path getExecutableDir() const;
 
     // Callback functions.
@@ -31,18 +40,30 @@ class ImGuiVis : public VisualizationBase
     void Distroy(GLFWwindow* window);
 
     // Additional
-    void getFontIcon();
+    void getFontIcon(std::vector<FontSource_t>& fonts);
     void toLower(std::string& data);
 
   private:
-    Player::MP3Visualization& mMP3PlayerVisualization;
+    // The waveOut device the player window drives through its PlayerCore; declared first so it outlives the core
+    MP3Player                mAudioPlayer;
+    Player::MP3Visualization mMP3PlayerVisualization;
 
     // Declaring variables
     std::string   mOpenGLVersion = "Unavailable";
     GLFWwindow*   mWorldWindow;
     GLuint        mWorldTexture;
+    int32_t       mWorldTextureWidth  = -1;
+    int32_t       mWorldTextureHeight = -1;
+    bool          mCaptureWorldTexture = false;
+    FrameTimer    mFrameTimer;
     bool          mPauseRequested;
     float         mBaseFontSize;
     std::mutex    mFontIcon;
     std::string   mMP3SourceFile;
+
+    // Launch timeline, appended to startup.log once the initial track is ready
+    bool            mFastStart;
+    bool            mFontCacheHit = false;
+    StartupTimeline mStartupTimeline;
+    void            updateStartupTimeline(size_t frameIndex);
 };
@@ -2,9 +2,19 @@
 
 using namespace std;
 
-int main(void)
+int main(int argc, char** argv)
 {
 	string musicFile = "Oryza.mp3";
-    std::shared_ptr<ImGuiVis> run(new ImGuiVis(musicFile));
+
+    // --eager-start: decode the first track before the window appears (the old start order, for comparison)
+    bool fastStart = true;
+    for (int index = 1; index < argc; ++index)
+    {
+        if (string(argv[index]) == "--eager-start")
+        {
+            fastStart = false;
+        }
+    }
+    std::shared_ptr<ImGuiVis> run(new ImGuiVis(musicFile, fastStart));
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,110 @@
+"""Write reservoir.mp3, the fixture the parallel decode benchmark checks against the serial decode.
+
+    python make_reservoir_mp3.py reservoir.mp3
+
+MPEG-1 Layer III, 32 kbps, 44.1 kHz, mono, 1024 frames (about 27 s). Every granule is a long block of random
++-1 spectral lines coded with Huffman table 1, so it decodes to noise rather than silence. Granules vary from a
+few to 288 line pairs while a frame only has 83 bytes for main data, so most frames start their main data in
+the bit reservoir, up to the full 511 bytes back. No encoder is needed; the output is the same on every run.
+"""
+import random
+import sys
+
+FRAME_COUNT = 1024
+FRAME_BYTES = 104  # 144 * 32000 / 44100, no padding
+HEADER = bytes([0xFF, 0xFB, 0x10, 0xC0])  # MPEG-1, Layer III, no CRC, 32 kbps, 44.1 kHz, mono
+SIDE_INFO_BYTES = 17
+SLOT_BYTES = FRAME_BYTES - len(HEADER) - SIDE_INFO_BYTES
+MAX_MAIN_DATA_BEGIN = 511
+MAX_BIG_VALUES = 288
+
+# Huffman table 1 (ISO 11172-3 table B.7): (x, y) -> (code, length)
+TABLE_1 = {(0, 0): (0b1, 1), (0, 1): (0b001, 3), (1, 0): (0b01, 2), (1, 1): (0b000, 3)}
+
+
+class BitWriter:
+    def __init__(self):
+        self.bits = []
+
+    def put(self, value, count):
+        for shift in range(count - 1, -1, -1):
+            self.bits.append((value >> shift) & 1)
+
+    def to_bytes(self):
+        padded = self.bits + [0] * (-len(self.bits) % 8)
+        return bytes(int("".join(map(str, padded[start:start + 8])), 2) for start in range(0, len(padded), 8))
+
+
+def code_granule(rng, pairs):
+    """Huffman-coded big_values region of one granule; no scalefactor bits (scalefac_compress 0)."""
+    bits = BitWriter()
+    for _ in range(pairs):
+        x, y = rng.random() < 0.5, rng.random() < 0.5
+        code, length = TABLE_1[(int(x), int(y))]
+        bits.put(code, length)
+        if x:
+            bits.put(rng.getrandbits(1), 1)
+        if y:
+            bits.put(rng.getrandbits(1), 1)
+    return bits.bits
+
+
+def side_info(main_data_begin, granules):
+    bits = BitWriter()
+    bits.put(main_data_begin, 9)
+    bits.put(0, 5)  # private bits
+    bits.put(0, 4)  # scfsi
+    for part2_3_length, big_values, global_gain in granules:
+        bits.put(part2_3_length, 12)
+        bits.put(big_values, 9)
+        bits.put(global_gain, 8)
+        bits.put(0, 4)  # scalefac_compress: no scalefactor bits
+        bits.put(0, 1)  # window_switching_flag: long blocks
+        for _ in range(3):
+            bits.put(1, 5)  # table_select: table 1 in every region
+        bits.put(7, 4)  # region0_count
+        bits.put(7, 3)  # region1_count
+        bits.put(0, 1)  # preflag
+        bits.put(0, 1)  # scalefac_scale
+        bits.put(0, 1)  # count1table_select
+    data = bits.to_bytes()
+    assert len(data) == SIDE_INFO_BYTES
+    return data
+
+
+def main(output_path):
+    rng = random.Random(35)
+    stream = bytearray(FRAME_COUNT * SLOT_BYTES)  # the main data slots of all frames back to back
+    side_infos = []
+    end = 0  # first main data byte not taken yet
+    for frame in range(FRAME_COUNT):
+        slot_start = frame * SLOT_BYTES
+        start = max(end, slot_start - MAX_MAIN_DATA_BEGIN)
+        room = slot_start + SLOT_BYTES - start
+        while True:
+            # Mostly small granules that fill the reservoir, now and then a large one that drains it
+            granules = []
+            bits = []
+            for _ in range(2):
+                pairs = rng.randint(200, MAX_BIG_VALUES) if rng.random() < 0.2 else rng.randint(4, 120)
+                coded = code_granule(rng, pairs)
+                granules.append((len(coded), pairs, rng.randint(172, 186)))
+                bits += coded
+            main_data = BitWriter()
+            main_data.bits = bits
+            data = main_data.to_bytes()
+            if len(data) <= room:
+                break
+        stream[start:start + len(data)] = data
+        end = start + len(data)
+        side_infos.append(side_info(slot_start - start, granules))
+
+    with open(output_path, "wb") as out:
+        for frame in range(FRAME_COUNT):
+            out.write(HEADER)
+            out.write(side_infos[frame])
+            out.write(stream[frame * SLOT_BYTES:(frame + 1) * SLOT_BYTES])
+
+
+if __name__ == "__main__":
+    main(sys.argv[1] if len(sys.argv) > 1 else "reservoir.mp3")
@@ -0,0 +1,238 @@
+// mp3ctl: drive a running player through its control endpoint.
+//
+//     mp3ctl [--endpoint NAME | --pid N] <request...>    send one request and print the reply
+//     mp3ctl [--endpoint NAME | --pid N] watch [ms]      print the position / level stream
+//     mp3ctl [--endpoint NAME | --pid N] latency [n]     measure command-to-audio latency with n pause/resume pairs
+//
+// Without --endpoint or --pid the MP3PLAYER_CONTROL environment variable names the endpoint.
+#include "ControlServer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct Position_t
+    {
+        unsigned long long frame     = 0;
+        std::string        state;
+        double             latencyMs = 0.0;
+    };
+
+    bool parsePosition(const std::string& line, Position_t& position)
+    {
+        std::istringstream stream(line);
+        std::string        tag;
+        double             seconds = 0.0, duration = 0.0, peakLeft = 0.0, peakRight = 0.0;
+        int                track   = 0;
+        stream >> tag >> position.frame >> seconds >> duration >> position.state >> peakLeft >> peakRight >> track >>
+            position.latencyMs;
+        return tag == "pos" && !stream.fail();
+    }
+
+    double getMs()
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Read until the reply to the request numbered sequence, pushes in between are passed to onPush
+    template<typename Fn>
+    bool waitReply(Player::ControlClient& client, uint64_t sequence, std::string& reply, Fn&& onPush)
+    {
+        const std::string ok    = "ok " + std::to_string(sequence) + " ";
+        const std::string error = "err " + std::to_string(sequence) + " ";
+        std::string       line;
+        while (client.readLine(line, 2000))
+        {
+            if (line.compare(0, ok.size(), ok) == 0 || line.compare(0, error.size(), error) == 0)
+            {
+                reply = line;
+                return true;
+            }
+            onPush(line);
+        }
+        return false;
+    }
+
+    void printStats(const char* label, std::vector<double> values)
+    {
+        if (values.empty())
+        {
+            return;
+        }
+        std::sort(values.begin(), values.end());
+        std::printf("%-22s min %7.2f  median %7.2f  p95 %7.2f  max %7.2f ms\n",
+                    label,
+                    values.front(),
+                    values[values.size() / 2],
+                    values[std::min(values.size() - 1, values.size() * 95 / 100)],
+                    values.back());
+    }
+
+    // Pause, then time resume until its reply and until the pushed frame moves again. The clock restarts when the
+    // device does, so the second figure plus the device latency it reports is the command-to-audio latency.
+    int runLatency(Player::ControlClient& client, int count)
+    {
+        uint64_t    sequence = 0;
+        std::string reply;
+        const auto  ignore   = [](const std::string&) {};
+        client.sendLine("subscribe 1");
+        if (!waitReply(client, ++sequence, reply, ignore))
+        {
+            std::fprintf(stderr, "mp3ctl: no reply\n");
+            return 1;
+        }
+
+        std::vector<double> replyMs;
+        std::vector<double> clockMs;
+        std::vector<double> audioMs;
+        for (int iteration = 0; iteration < count; ++iteration)
+        {
+            Position_t paused;
+            client.sendLine("pause");
+            if (!waitReply(client, ++sequence, reply, ignore) || reply.compare(0, 3, "ok ") != 0)
+            {
+                std::fprintf(stderr, "mp3ctl: pause failed: %s\n", reply.c_str());
+                return 1;
+            }
+            // Let the frozen frame reach us so the first moving one after resume is unambiguous
+            std::string line;
+            while (client.readLine(line, 2000) && !(parsePosition(line, paused) && paused.state == "pause"))
+            {
+            }
+            if (paused.state != "pause")
+            {
+                std::fprintf(stderr, "mp3ctl: player is not playing\n");
+                return 1;
+            }
+
+            const double sentMs    = getMs();
+            double       movedMs   = 0.0;
+            double       latency   = 0.0;
+            const auto   watchMove = [&](const std::string& push)
+            {
+                Position_t position;
+                if (movedMs == 0.0 && parsePosition(push, position) && position.state == "play" &&
+                    position.frame > paused.frame)
+                {
+                    movedMs = getMs();
+                    latency = position.latencyMs;
+                }
+            };
+            client.sendLine("resume");
+            if (!waitReply(client, ++sequence, reply, watchMove) || reply.compare(0, 3, "ok ") != 0)
+            {
+                std::fprintf(stderr, "mp3ctl: resume failed: %s\n", reply.c_str());
+                return 1;
+            }
+            replyMs.push_back(getMs() - sentMs);
+            while (movedMs == 0.0 && client.readLine(line, 2000))
+            {
+                watchMove(line);
+            }
+            if (movedMs == 0.0)
+            {
+                std::fprintf(stderr, "mp3ctl: position did not advance after resume\n");
+                return 1;
+            }
+            clockMs.push_back(movedMs - sentMs);
+            audioMs.push_back(movedMs - sentMs + latency);
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+
+        std::printf("%d pause/resume pairs\n", count);
+        printStats("command -> reply", replyMs);
+        printStats("command -> clock", clockMs);
+        printStats("command -> audio (est)", audioMs);
+        return 0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::string endpoint;
+    int         first = 1;
+    for (; first < argc; ++first)
+    {
+        const std::string argument = argv[first];
+        if (argument == "--endpoint" && first + 1 < argc)
+        {
+            endpoint = argv[++first];
+        }
+        else if (argument == "--pid" && first + 1 < argc)
+        {
+            endpoint = Player::ControlServer::getProcessEndpoint(
+                static_cast<uint32_t>(std::strtoul(argv[++first], nullptr, 10)));
+        }
+        else
+        {
+            break;
+        }
+    }
+    if (endpoint.empty())
+    {
+        const char* variable = std::getenv("MP3PLAYER_CONTROL");
+        endpoint             = variable ? variable : "";
+    }
+    if (first >= argc || endpoint.empty())
+    {
+        std::fprintf(stderr,
+                     "usage: mp3ctl [--endpoint NAME | --pid N] <request...>\n"
+                     "       mp3ctl [--endpoint NAME | --pid N] watch [ms]\n"
+                     "       mp3ctl [--endpoint NAME | --pid N] latency [count]\n"
+                     "Requests: play [s], pause, resume, stop, seek <s>, next, prev, volume <0..1> [balance],\n"
+                     "          eq <band> <dB>, status, ping. MP3PLAYER_CONTROL names the default endpoint.\n");
+        return 2;
+    }
+
+    Player::ControlClient client;
+    if (!client.connect(endpoint))
+    {
+        std::fprintf(stderr, "mp3ctl: cannot connect to %s\n", endpoint.c_str());
+        return 1;
+    }
+
+    const std::string command = argv[first];
+    if (command == "latency")
+    {
+        return runLatency(client, first + 1 < argc ? std::max(1, std::atoi(argv[first + 1])) : 20);
+    }
+    if (command == "watch")
+    {
+        client.sendLine("subscribe " + std::string(first + 1 < argc ? argv[first + 1] : "100"));
+        std::string line;
+        while (client.readLine(line, -1))
+        {
+            std::printf("%s\n", line.c_str());
+            std::fflush(stdout);
+        }
+        return 0;
+    }
+
+    std::string request = command;
+    for (int index = first + 1; index < argc; ++index)
+    {
+        request += ' ';
+        request += argv[index];
+    }
+    std::string reply;
+    client.sendLine(request);
+    if (!waitReply(client, 1, reply, [](const std::string&) {}))
+    {
+        std::fprintf(stderr, "mp3ctl: no reply\n");
+        return 1;
+    }
+    std::printf("%s\n", reply.c_str());
+    const bool accepted = reply.compare(0, 3, "ok ") == 0;
+    if (accepted && command == "status" && client.readLine(reply, 2000))
+    {
+        std::printf("%s\n", reply.c_str());
+    }
+    return accepted ? 0 : 1;
+}
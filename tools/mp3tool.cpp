@@ -0,0 +1,377 @@
+// mp3tool: headless batch decode / analysis on the player's audio core.
+//
+//     mp3tool [options] <file | directory | @listfile | ->...
+//
+// Every input is mapped, indexed and decoded in chunks across threads with the ParallelDecoder the player's track
+// loader uses, then the requested outputs are written next to it (or under --out). One tab-separated line per file
+// goes to stdout in input order; the throughput summary goes to stderr.
+#include "LibraryScanner.h"
+#include "MP3Decoder.h"
+#include "MappedFile.h"
+#include "ParallelDecoder.h"
+#include "PcmAnalysis.h"
+#include "PcmWriter.h"
+#include "Profiler.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct Options_t
+    {
+        std::filesystem::path outputDir;
+        bool                  writeWav      = false;
+        bool                  writeRaw      = false;
+        bool                  loudness      = false;
+        uint32_t              framesPerPeak = 0;  // 0 = no peak file
+        size_t                jobs          = 0;  // 0 = hardware concurrency
+        std::string           tracePath;
+    };
+
+    struct Input_t
+    {
+        std::filesystem::path path;
+        std::filesystem::path outputStem;  // output path without extension
+    };
+
+    struct Result_t
+    {
+        std::string        error;
+        uint64_t           fileBytes  = 0;
+        double             duration   = 0.0;
+        uint32_t           sampleRate = 0;
+        uint16_t           channels   = 0;
+        Player::Loudness_t loudness;
+        double             decodeMs = 0.0;
+    };
+
+    void printUsage()
+    {
+        std::fprintf(stderr,
+                     "usage: mp3tool [options] <file | directory | @listfile | ->...\n"
+                     "\n"
+                     "Directories are searched recursively for .mp3 files; @listfile and - read one path per line.\n"
+                     "\n"
+                     "  -o, --out DIR     write outputs under DIR (directory inputs keep their relative layout)\n"
+                     "      --wav         write <name>.wav (16-bit PCM)\n"
+                     "      --raw         write <name>.pcm (interleaved s16le, no header)\n"
+                     "      --peaks N     write <name>.dat, one min/max pair per N frames (audiowaveform layout)\n"
+                     "      --loudness    report integrated loudness (LUFS) and sample peak (dBFS)\n"
+                     "  -j, --jobs N      files processed concurrently (default: hardware threads)\n"
+                     "      --trace FILE  write a Chrome trace of the run\n"
+                     "  -h, --help\n");
+    }
+
+    bool parseCount(const char* text, uint64_t& value)
+    {
+        char* end = nullptr;
+        value     = std::strtoull(text, &end, 10);
+        return end != text && *end == '\0' && value > 0;
+    }
+
+    void addListFile(std::istream& list, const std::filesystem::path& outputDir, std::vector<Input_t>& inputs)
+    {
+        std::string line;
+        while (std::getline(list, line))
+        {
+            if (!line.empty() && line.back() == '\r')
+            {
+                line.pop_back();
+            }
+            if (line.empty() || line.front() == '#')
+            {
+                continue;
+            }
+            const std::filesystem::path path(line);
+            inputs.push_back({path, outputDir.empty() ? path.parent_path() / path.stem() : outputDir / path.stem()});
+        }
+    }
+
+    bool addInput(const std::string& argument, const std::filesystem::path& outputDir, std::vector<Input_t>& inputs)
+    {
+        if (argument == "-")
+        {
+            addListFile(std::cin, outputDir, inputs);
+            return true;
+        }
+        if (argument.front() == '@')
+        {
+            std::ifstream list(argument.substr(1));
+            if (!list)
+            {
+                std::fprintf(stderr, "mp3tool: cannot read list %s\n", argument.c_str() + 1);
+                return false;
+            }
+            addListFile(list, outputDir, inputs);
+            return true;
+        }
+
+        const std::filesystem::path path(argument);
+        std::error_code             error;
+        if (!std::filesystem::is_directory(path, error))
+        {
+            inputs.push_back({path, outputDir.empty() ? path.parent_path() / path.stem() : outputDir / path.stem()});
+            return true;
+        }
+
+        // Sorted so output order and names do not depend on the file system's enumeration order
+        std::vector<std::filesystem::path> found;
+        for (std::filesystem::recursive_directory_iterator it(
+                 path, std::filesystem::directory_options::skip_permission_denied, error);
+             !error && it != std::filesystem::recursive_directory_iterator();
+             it.increment(error))
+        {
+            std::error_code entryError;
+            if (it->is_regular_file(entryError) && Player::LibraryScanner::isMp3Path(it->path()))
+            {
+                found.push_back(it->path());
+            }
+        }
+        std::sort(found.begin(), found.end());
+        for (std::filesystem::path& file : found)
+        {
+            const std::filesystem::path relative = file.lexically_relative(path);
+            std::filesystem::path       stem     = outputDir.empty() ? file : outputDir / relative;
+            stem.replace_extension();
+            inputs.push_back({std::move(file), std::move(stem)});
+        }
+        return true;
+    }
+
+    Result_t processFile(const Input_t& input, const Options_t& options)
+    {
+        MP3_PROFILE_SCOPE("tool.file");
+        Result_t           result;
+        Player::MappedFile file;
+        if (!file.open(input.path))
+        {
+            result.error = "cannot open";
+            return result;
+        }
+        result.fileBytes = file.size();
+
+        const auto             start = std::chrono::steady_clock::now();
+        Player::DecodedAudio_t audio;
+        // The shared decoder's threads also serve the other files in flight, so a batch ending in one long file
+        // still uses every core for it
+        if (!Player::ParallelDecoder::getShared().decode(file.data(), file.size(), audio) || audio.samples.empty())
+        {
+            result.error = "no audio frames";
+            return result;
+        }
+        result.decodeMs   = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        result.duration   = audio.getDurationSeconds();
+        result.sampleRate = audio.sampleRate;
+        result.channels   = audio.channels;
+
+        if (options.loudness)
+        {
+            result.loudness = Player::PcmAnalysis::getLoudness(
+                audio.samples.data(), audio.getFrameCount(), audio.channels, audio.sampleRate);
+        }
+
+        if (options.writeWav || options.writeRaw || options.framesPerPeak > 0)
+        {
+            std::error_code error;
+            std::filesystem::create_directories(input.outputStem.parent_path(), error);
+        }
+        // Appended rather than replace_extension(): stems may contain dots ("01. Intro")
+        const auto outputPath = [&input](const char* extension)
+        {
+            std::filesystem::path path = input.outputStem;
+            path += extension;
+            return path;
+        };
+        if (options.writeWav && !Player::PcmWriter::writeWav(outputPath(".wav"), audio))
+        {
+            result.error = "cannot write " + outputPath(".wav").string();
+        }
+        if (options.writeRaw && !Player::PcmWriter::writeRaw(outputPath(".pcm"), audio))
+        {
+            result.error = "cannot write " + outputPath(".pcm").string();
+        }
+        if (options.framesPerPeak > 0)
+        {
+            const std::vector<Player::PeakPair_t> peaks = Player::PcmAnalysis::getPeaks(
+                audio.samples.data(), audio.getFrameCount(), audio.channels, options.framesPerPeak);
+            if (!Player::PcmWriter::writePeaks(outputPath(".dat"), peaks, audio.sampleRate, options.framesPerPeak))
+            {
+                result.error = "cannot write " + outputPath(".dat").string();
+            }
+        }
+        return result;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options_t                options;
+    std::vector<std::string> arguments;
+    for (int index = 1; index < argc; ++index)
+    {
+        const std::string argument = argv[index];
+        const bool        hasValue = index + 1 < argc;
+        uint64_t          count    = 0;
+        if (argument == "-h" || argument == "--help")
+        {
+            printUsage();
+            return 0;
+        }
+        else if ((argument == "-o" || argument == "--out") && hasValue)
+        {
+            options.outputDir = argv[++index];
+        }
+        else if (argument == "--wav")
+        {
+            options.writeWav = true;
+        }
+        else if (argument == "--raw")
+        {
+            options.writeRaw = true;
+        }
+        else if (argument == "--loudness")
+        {
+            options.loudness = true;
+        }
+        else if (argument == "--peaks" && hasValue && parseCount(argv[index + 1], count) && count <= UINT32_MAX)
+        {
+            options.framesPerPeak = static_cast<uint32_t>(count);
+            ++index;
+        }
+        else if ((argument == "-j" || argument == "--jobs") && hasValue && parseCount(argv[index + 1], count))
+        {
+            options.jobs = static_cast<size_t>(count);
+            ++index;
+        }
+        else if (argument == "--trace" && hasValue)
+        {
+            options.tracePath = argv[++index];
+        }
+        else if (argument.size() > 1 && argument.front() == '-')
+        {
+            std::fprintf(stderr, "mp3tool: bad option %s\n", argument.c_str());
+            printUsage();
+            return 2;
+        }
+        else
+        {
+            arguments.push_back(argument);
+        }
+    }
+
+    // Inputs are expanded after all options so --out applies wherever it appears
+    std::vector<Input_t> inputs;
+    for (const std::string& argument : arguments)
+    {
+        if (!addInput(argument, options.outputDir, inputs))
+        {
+            return 2;
+        }
+    }
+    if (inputs.empty())
+    {
+        if (arguments.empty())
+        {
+            printUsage();
+        }
+        else
+        {
+            std::fprintf(stderr, "mp3tool: no .mp3 files found\n");
+        }
+        return 2;
+    }
+
+    if (!options.tracePath.empty())
+    {
+        Player::Profiler::setEnabled(true);
+        Player::Profiler::setThreadName("main");
+    }
+
+    // Files are handed out one at a time so a long track does not hold up a queue of short ones
+    const size_t jobs =
+        std::min(options.jobs > 0 ? options.jobs : Player::ThreadPool::getDefaultThreadCount(), inputs.size());
+    std::vector<Result_t> results(inputs.size());
+    std::atomic<size_t>   nextInput{0};
+    const auto            start = std::chrono::steady_clock::now();
+    {
+        Player::ThreadPool pool(jobs);
+        for (size_t job = 0; job < jobs; ++job)
+        {
+            pool.submit(
+                [&]
+                {
+                    for (size_t index = nextInput.fetch_add(1); index < inputs.size(); index = nextInput.fetch_add(1))
+                    {
+                        results[index] = processFile(inputs[index], options);
+                    }
+                });
+        }
+        pool.waitIdle();
+    }
+    const double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::printf("#path\tstatus\tseconds\trate\tchannels\tlufs\tpeak_dbfs\tdecode_ms\n");
+    size_t   failed       = 0;
+    uint64_t totalBytes   = 0;
+    double   totalSeconds = 0.0;
+    for (size_t index = 0; index < inputs.size(); ++index)
+    {
+        const Result_t& result = results[index];
+        totalBytes += result.fileBytes;
+        if (!result.error.empty())
+        {
+            ++failed;
+            std::printf("%s\terror: %s\n", inputs[index].path.string().c_str(), result.error.c_str());
+            continue;
+        }
+        totalSeconds += result.duration;
+        if (options.loudness)
+        {
+            std::printf("%s\tok\t%.3f\t%u\t%u\t%.2f\t%.2f\t%.1f\n",
+                        inputs[index].path.string().c_str(),
+                        result.duration,
+                        result.sampleRate,
+                        result.channels,
+                        result.loudness.integratedLufs,
+                        result.loudness.samplePeakDbfs,
+                        result.decodeMs);
+        }
+        else
+        {
+            std::printf("%s\tok\t%.3f\t%u\t%u\t-\t-\t%.1f\n",
+                        inputs[index].path.string().c_str(),
+                        result.duration,
+                        result.sampleRate,
+                        result.channels,
+                        result.decodeMs);
+        }
+    }
+
+    const double megabytes = totalBytes / (1024.0 * 1024.0);
+    std::fprintf(stderr,
+                 "%zu files (%zu failed), %.1f MB, %.1f s of audio in %.2f s with %zu jobs: %.1f MB/s, %.1fx realtime\n",
+                 inputs.size(),
+                 failed,
+                 megabytes,
+                 totalSeconds,
+                 wallSeconds,
+                 jobs,
+                 wallSeconds > 0.0 ? megabytes / wallSeconds : 0.0,
+                 wallSeconds > 0.0 ? totalSeconds / wallSeconds : 0.0);
+
+    if (!options.tracePath.empty() && !Player::Profiler::exportChromeTrace(options.tracePath))
+    {
+        std::fprintf(stderr, "mp3tool: cannot write trace %s\n", options.tracePath.c_str());
+    }
+    return failed == 0 ? 0 : 1;
+}